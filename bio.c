@@ -1,6 +1,6 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
@@ -13,83 +13,248 @@
 // * Only one process at a time can use a buffer,
 //     so do not keep them longer than necessary.
 //
-// The implementation uses two state flags internally:
+// The implementation uses three state flags internally:
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+// * B_ASYNC: a read-ahead is in progress; the disk driver
+//     releases the buffer when it completes.
+//
+// Locking:
+// * bucket[h].lock protects the hash chain of bucket h and
+//   b->refcnt of the buffers on it. A lookup takes only the
+//   lock of the block's own bucket.
+// * lrulock protects the list of unreferenced buffers, in
+//   least-recently-released order; that list is where recycling
+//   looks for victims. It is only ever taken last.
+// * bcache.lock serializes recycling, the only thing that moves a
+//   buffer between buckets, so whoever holds it may lock a second
+//   bucket without risk of deadlock.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
 
+#define NBUCKET 31
+#define BHASH(dev, blockno) (((dev)*7 + (blockno)) % NBUCKET)
+#define NASYNC (NBUF/4)   // most read-aheads in flight at once
+
+struct bucket {
+  struct spinlock lock;
+  struct buf *head;   // chain through hnext
+};
+
 struct {
   struct spinlock lock;
   struct buf buf[NBUF];
+  struct bucket bucket[NBUCKET];
+  int nasync;         // read-aheads in flight, under lock
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
-  struct buf head;
+  // Linked list of buffers with refcnt == 0, through prev/next.
+  // lru.next is least recently used.
+  struct spinlock lrulock;
+  struct buf lru;
 } bcache;
 
 void
 binit(void)
 {
   struct buf *b;
+  char *mem;
+  int h;
 
   initlock(&bcache.lock, "bcache");
+  initlock(&bcache.lrulock, "bcache.lru");
+  for(h = 0; h < NBUCKET; h++)
+    initlock(&bcache.bucket[h].lock, "bcache.bucket");
 
 //PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
+  // Put every buffer on the free list and, since they all
+  // start out as block 0 of device 0, in that block's bucket.
+  bcache.lru.prev = &bcache.lru;
+  bcache.lru.next = &bcache.lru;
+  h = BHASH(0, 0);
   for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
+    b->next = &bcache.lru;
+    b->prev = bcache.lru.prev;
+    bcache.lru.prev->next = b;
+    bcache.lru.prev = b;
+    b->hnext = bcache.bucket[h].head;
+    bcache.bucket[h].head = b;
     initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+  }
+
+  // Buffer data comes from whole pages, PGSIZE/BSIZE to a page.
+  if(PGSIZE % BSIZE != 0)
+    panic("binit: BSIZE");
+  mem = 0;
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+    if((b - bcache.buf) % (PGSIZE/BSIZE) == 0 && (mem = kalloc()) == 0)
+      panic("binit: out of memory");
+    b->data = (uchar*)mem + (b - bcache.buf) % (PGSIZE/BSIZE) * BSIZE;
   }
 }
 
-// Look through buffer cache for block on device dev.
-// If not found, allocate a buffer.
-// In either case, return locked buffer.
+// Take b off the free list. Caller holds lrulock.
+static void
+lruremove(struct buf *b)
+{
+  b->next->prev = b->prev;
+  b->prev->next = b->next;
+}
+
+// Look for block (dev, blockno) in bucket h and take a
+// reference to it. Caller holds bucket[h].lock.
 static struct buf*
-bget(uint dev, uint blockno)
+bfind(int h, uint dev, uint blockno)
 {
   struct buf *b;
 
-  acquire(&bcache.lock);
-
-  // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+  for(b = bcache.bucket[h].head; b; b = b->hnext){
     if(b->dev == dev && b->blockno == blockno){
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
+      if(b->refcnt++ == 0){
+        acquire(&bcache.lrulock);
+        lruremove(b);
+        release(&bcache.lrulock);
+      }
       return b;
     }
   }
+  return 0;
+}
+
+// Find an unused buffer and move it into bucket h, or
+// return 0 if every buffer is in use.
+// Caller holds bcache.lock and bucket[h].lock.
+static struct buf*
+brecycle(int h)
+{
+  struct buf *b, **pp;
+  int h2;
+
+  for(;;){
+    // Even if refcnt==0, B_DIRTY indicates a buffer is in use
+    // because log.c has modified it but not yet committed it.
+    acquire(&bcache.lrulock);
+    for(b = bcache.lru.next; b != &bcache.lru; b = b->next)
+      if((b->flags & B_DIRTY) == 0)
+        break;
+    release(&bcache.lrulock);
+    if(b == &bcache.lru)
+      return 0;
+
+    // b cannot change buckets (we hold bcache.lock), but it may
+    // have been looked up since; check again under its bucket lock.
+    h2 = BHASH(b->dev, b->blockno);
+    if(h2 != h)
+      acquire(&bcache.bucket[h2].lock);
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0)
+      break;
+    if(h2 != h)
+      release(&bcache.bucket[h2].lock);
+  }
 
-  // Not cached; recycle an unused buffer.
-  // Even if refcnt==0, B_DIRTY indicates a buffer is in use
-  // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
+  acquire(&bcache.lrulock);
+  lruremove(b);
+  release(&bcache.lrulock);
+
+  for(pp = &bcache.bucket[h2].head; *pp != b; pp = &(*pp)->hnext)
+    ;
+  *pp = b->hnext;
+  if(h2 != h)
+    release(&bcache.bucket[h2].lock);
+
+  b->hnext = bcache.bucket[h].head;
+  bcache.bucket[h].head = b;
+  return b;
+}
+
+// Look through buffer cache for block on device dev.
+// If not found, allocate a buffer.
+// In either case, return the buffer with a reference
+// taken, but not locked. If every buffer is in use,
+// return 0 if mayfail, else panic.
+static struct buf*
+bref(uint dev, uint blockno, int mayfail)
+{
+  struct buf *b;
+  int h = BHASH(dev, blockno);
+
+  // Is the block already cached?
+  acquire(&bcache.bucket[h].lock);
+  if((b = bfind(h, dev, blockno)) != 0)
+    goto found;
+  release(&bcache.bucket[h].lock);
+
+  // Not cached; recycle an unused buffer. Check again once
+  // we may recycle, in case another CPU got here first.
+  acquire(&bcache.lock);
+  acquire(&bcache.bucket[h].lock);
+  if((b = bfind(h, dev, blockno)) == 0){
+    if((b = brecycle(h)) == 0){
+      if(!mayfail)
+        panic("bget: no buffers");
       release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+      goto found;
     }
+    b->dev = dev;
+    b->blockno = blockno;
+    b->flags = 0;
+    b->refcnt = 1;
+  }
+  release(&bcache.lock);
+
+found:
+  release(&bcache.bucket[h].lock);
+  return b;
+}
+
+// Drop a reference to b, taken by bref().
+// Move to the tail of the free list once unreferenced.
+static void
+bunref(struct buf *b)
+{
+  int h;
+
+  h = BHASH(b->dev, b->blockno);
+  acquire(&bcache.bucket[h].lock);
+  b->refcnt--;
+  if (b->refcnt == 0) {
+    // no one is waiting for it.
+    acquire(&bcache.lrulock);
+    b->next = &bcache.lru;
+    b->prev = bcache.lru.prev;
+    bcache.lru.prev->next = b;
+    bcache.lru.prev = b;
+    release(&bcache.lrulock);
   }
-  panic("bget: no buffers");
+  release(&bcache.bucket[h].lock);
+}
+
+// A read-ahead has finished or been abandoned.
+static void
+bunasync(void)
+{
+  acquire(&bcache.lock);
+  bcache.nasync--;
+  release(&bcache.lock);
+}
+
+// Return a locked buffer for the block, as for bread,
+// but without reading it.
+static struct buf*
+bget(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bref(dev, blockno, 0);
+  acquiresleep(&b->lock);
+  return b;
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -115,8 +280,70 @@ bwrite(struct buf *b)
   iderw(b);
 }
 
+// Write the n locked bufs in bp to disk together.
+void
+bwritev(struct buf **bp, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(!holdingsleep(&bp[i]->lock))
+      panic("bwritev");
+    bp[i]->flags |= B_DIRTY;
+  }
+  iderwv(bp, n);
+}
+
+// Start reading the block into the cache without waiting
+// for it, so that a later bread() finds it ready. Does
+// nothing if the block is already cached or someone is
+// using its buffer, and, since read-ahead is only a hint,
+// if NASYNC read-aheads are already in flight or there is
+// no free buffer. The disk driver calls bdone() when the
+// read completes.
+void
+breadahead(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  acquire(&bcache.lock);
+  if(bcache.nasync >= NASYNC){
+    release(&bcache.lock);
+    return;
+  }
+  bcache.nasync++;
+  release(&bcache.lock);
+
+  if((b = bref(dev, blockno, 1)) == 0){
+    bunasync();
+    return;
+  }
+  if((b->flags & B_VALID) || !tryacquiresleep(&b->lock)){
+    bunasync();
+    bunref(b);
+    return;
+  }
+  if(b->flags & B_VALID){
+    releasesleep(&b->lock);
+    bunasync();
+    bunref(b);
+    return;
+  }
+  b->flags |= B_ASYNC;
+  iderwasync(b);
+}
+
+// Release a buffer whose read-ahead has completed.
+// Called by the disk driver, in interrupt context.
+void
+bdone(struct buf *b)
+{
+  releasesleep(&b->lock);
+  bunasync();
+  bunref(b);
+}
+
 // Release a locked buffer.
-// Move to the head of the MRU list.
 void
 brelse(struct buf *b)
 {
@@ -124,20 +351,7 @@ brelse(struct buf *b)
     panic("brelse");
 
   releasesleep(&b->lock);
-
-  acquire(&bcache.lock);
-  b->refcnt--;
-  if (b->refcnt == 0) {
-    // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
-  }
-  
-  release(&bcache.lock);
+  bunref(b);
 }
 //PAGEBREAK!
 // Blank page.
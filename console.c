@@ -232,6 +232,12 @@ consoleintr(int (*getc)(void))
   if(doprocdump){
 #ifdef PRIORITY_SCHED
     cprintf("PID STATE NAME  prio=E(base=B)\n");
+#elif defined(MLFQ_SCHED)
+    cprintf("PID STATE NAME  level=L(top=T) used=U (quantum used)\n");
+#elif defined(FAIR_SCHED)
+    cprintf("PID STATE NAME  nice=N vrun=V (units of 2^20 ns)\n");
+#elif defined(STRIDE_SCHED)
+    cprintf("PID STATE NAME  tickets=T+B(orrowed) pass=P (units of 2^20)\n");
 #else
     cprintf("PID STATE NAME\n");
 #endif
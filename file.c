@@ -32,6 +32,7 @@ filealloc(void)
   for(f = ftable.file; f < ftable.file + NFILE; f++){
     if(f->ref == 0){
       f->ref = 1;
+      f->raoff = f->rawin = f->raend = 0;
       release(&ftable.lock);
       return f;
     }
@@ -92,11 +93,44 @@ filestat(struct file *f, struct stat *st)
   return -1;
 }
 
+#define RAMIN  2   // initial read-ahead window, in blocks
+#define RAMAX  32  // largest read-ahead window, in blocks
+
+// Called after a read of f that started at off.
+// A read that begins where the last one ended is sequential:
+// double the read-ahead window and start reading that far
+// past the new offset. Any other read closes the window.
+// Caller must hold f->ip->lock.
+static void
+readahead(struct file *f, uint off)
+{
+  uint start, end;
+
+  if(off != f->raoff){
+    f->rawin = 0;
+    f->raend = 0;
+  } else if(f->rawin == 0)
+    f->rawin = RAMIN;
+  else if(f->rawin < RAMAX)
+    f->rawin *= 2;
+  f->raoff = f->off;
+  if(f->rawin == 0)
+    return;
+
+  start = f->off > f->raend ? f->off : f->raend;
+  end = f->off + f->rawin*BSIZE;
+  if(start < end){
+    ireadahead(f->ip, start, end - start);
+    f->raend = end;
+  }
+}
+
 // Read from file f.
 int
 fileread(struct file *f, char *addr, int n)
 {
   int r;
+  uint off;
 
   if(f->readable == 0)
     return -1;
@@ -104,8 +138,11 @@ fileread(struct file *f, char *addr, int n)
     return piperead(f->pipe, addr, n);
   if(f->type == FD_INODE){
     ilock(f->ip);
-    if((r = readi(f->ip, addr, f->off, n)) > 0)
+    off = f->off;
+    if((r = readi(f->ip, addr, off, n)) > 0){
       f->off += r;
+      readahead(f, off);
+    }
     iunlock(f->ip);
     return r;
   }
@@ -126,11 +163,12 @@ filewrite(struct file *f, char *addr, int n)
   if(f->type == FD_INODE){
     // write a few blocks at a time to avoid exceeding
     // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
-    // and 2 blocks of slop for non-aligned writes.
+    // i-node, double-indirect and indirect blocks,
+    // allocation blocks, and 2 blocks of slop for
+    // non-aligned writes.
     // this really belongs lower down, since writei()
     // might be writing a device like the console.
-    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
+    int max = ((MAXOPBLOCKS-1-2-2) / 2) * BSIZE;
     int i = 0;
     while(i < n){
       int n1 = n - i;
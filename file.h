@@ -6,6 +6,9 @@ struct file {
   struct pipe *pipe;
   struct inode *ip;
   uint off;
+  uint raoff;  // offset at which a sequential read would continue
+  uint rawin;  // read-ahead window, in blocks; 0 if not sequential
+  uint raend;  // read-ahead has been started up to here
 };
 
 
@@ -14,15 +17,19 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
+  struct inode *hnext; // hash chain; protected by icache.lock
+  struct inode *prev;  // free list; protected by icache.lock
+  struct inode *next;
   struct sleeplock lock; // protects everything below here
   int valid;          // inode has been read from disk?
+  uint lastblk;       // block last allocated to it, or 0
 
   short type;         // copy of disk inode
   short major;
   short minor;
   short nlink;
   uint size;
-  uint addrs[NDIRECT+1];
+  uint addrs[NDIRECT+2];
 };
 
 // table mapping major device number to
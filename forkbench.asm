@@ -0,0 +1,1746 @@
+
+_forkbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 28             	sub    $0x28,%esp
+  14:	8b 19                	mov    (%ecx),%ebx
+  16:	8b 71 04             	mov    0x4(%ecx),%esi
+  int maxw = 4, dur = 200;
+  int w, i, ops, total, fds[2];
+
+  if (argc > 1) maxw = atoi(argv[1]);
+  19:	83 fb 01             	cmp    $0x1,%ebx
+  1c:	0f 8f a0 01 00 00    	jg     1c2 <main+0x1c2>
+  if (argc > 2) dur = atoi(argv[2]);
+
+  printf(1, "\n[FORKBENCH] up to %d workers, %d ticks each\n", maxw, dur);
+  22:	68 c8 00 00 00       	push   $0xc8
+  27:	6a 04                	push   $0x4
+  29:	68 50 0c 00 00       	push   $0xc50
+  2e:	6a 01                	push   $0x1
+  30:	e8 bb 05 00 00       	call   5f0 <printf>
+  int maxw = 4, dur = 200;
+  35:	c7 45 cc 04 00 00 00 	movl   $0x4,-0x34(%ebp)
+  printf(1, "\n[FORKBENCH] up to %d workers, %d ticks each\n", maxw, dur);
+  3c:	83 c4 10             	add    $0x10,%esp
+  int maxw = 4, dur = 200;
+  3f:	c7 45 d0 c8 00 00 00 	movl   $0xc8,-0x30(%ebp)
+
+  for (w = 1; w <= maxw; w++) {
+  46:	be 01 00 00 00       	mov    $0x1,%esi
+    if (pipe(fds) < 0) {
+  4b:	83 ec 0c             	sub    $0xc,%esp
+  4e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  51:	50                   	push   %eax
+  52:	e8 2c 04 00 00       	call   483 <pipe>
+  57:	83 c4 10             	add    $0x10,%esp
+  5a:	85 c0                	test   %eax,%eax
+  5c:	0f 88 b1 01 00 00    	js     213 <main+0x213>
+      printf(2, "forkbench: pipe failed\n");
+      exit();
+    }
+    for (i = 0; i < w; i++) {
+  62:	31 db                	xor    %ebx,%ebx
+  64:	eb 17                	jmp    7d <main+0x7d>
+  66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6d:	8d 76 00             	lea    0x0(%esi),%esi
+      int pid = fork();
+      if (pid < 0) {
+        printf(2, "forkbench: fork failed\n");
+        exit();
+      }
+      if (pid == 0) {
+  70:	0f 84 a3 00 00 00    	je     119 <main+0x119>
+    for (i = 0; i < w; i++) {
+  76:	83 c3 01             	add    $0x1,%ebx
+  79:	39 de                	cmp    %ebx,%esi
+  7b:	74 1c                	je     99 <main+0x99>
+      int pid = fork();
+  7d:	e8 e9 03 00 00       	call   46b <fork>
+      if (pid < 0) {
+  82:	85 c0                	test   %eax,%eax
+  84:	79 ea                	jns    70 <main+0x70>
+        printf(2, "forkbench: fork failed\n");
+  86:	51                   	push   %ecx
+  87:	51                   	push   %ecx
+  88:	68 c3 0c 00 00       	push   $0xcc3
+  8d:	6a 02                	push   $0x2
+  8f:	e8 5c 05 00 00       	call   5f0 <printf>
+        exit();
+  94:	e8 da 03 00 00       	call   473 <exit>
+        close(fds[0]);
+        worker(dur, fds[1]);
+      }
+    }
+    close(fds[1]);
+  99:	83 ec 0c             	sub    $0xc,%esp
+  9c:	ff 75 e4             	push   -0x1c(%ebp)
+
+    total = 0;
+    for (i = 0; i < w; i++) {
+  9f:	31 db                	xor    %ebx,%ebx
+  a1:	8d 7d d8             	lea    -0x28(%ebp),%edi
+    close(fds[1]);
+  a4:	e8 f2 03 00 00       	call   49b <close>
+    total = 0;
+  a9:	31 c0                	xor    %eax,%eax
+    close(fds[1]);
+  ab:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+  ae:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if (read(fds[0], &ops, sizeof(ops)) == sizeof(ops))
+  b8:	83 ec 04             	sub    $0x4,%esp
+  bb:	6a 04                	push   $0x4
+  bd:	57                   	push   %edi
+  be:	ff 75 e0             	push   -0x20(%ebp)
+  c1:	e8 c5 03 00 00       	call   48b <read>
+  c6:	83 c4 10             	add    $0x10,%esp
+  c9:	83 f8 04             	cmp    $0x4,%eax
+  cc:	75 06                	jne    d4 <main+0xd4>
+        total += ops;
+  ce:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  d1:	01 4d d4             	add    %ecx,-0x2c(%ebp)
+      wait();
+  d4:	e8 a2 03 00 00       	call   47b <wait>
+    for (i = 0; i < w; i++) {
+  d9:	83 c3 01             	add    $0x1,%ebx
+  dc:	39 f3                	cmp    %esi,%ebx
+  de:	75 d8                	jne    b8 <main+0xb8>
+    }
+    close(fds[0]);
+  e0:	83 ec 0c             	sub    $0xc,%esp
+  e3:	ff 75 e0             	push   -0x20(%ebp)
+  e6:	e8 b0 03 00 00       	call   49b <close>
+
+    printf(1, "[FORKBENCH] workers=%d ops=%d ops/tick=%d\n",
+  eb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  ee:	99                   	cltd
+  ef:	f7 7d d0             	idivl  -0x30(%ebp)
+  f2:	89 04 24             	mov    %eax,(%esp)
+  f5:	ff 75 d4             	push   -0x2c(%ebp)
+  f8:	56                   	push   %esi
+  for (w = 1; w <= maxw; w++) {
+  f9:	83 c6 01             	add    $0x1,%esi
+    printf(1, "[FORKBENCH] workers=%d ops=%d ops/tick=%d\n",
+  fc:	68 80 0c 00 00       	push   $0xc80
+ 101:	6a 01                	push   $0x1
+ 103:	e8 e8 04 00 00       	call   5f0 <printf>
+  for (w = 1; w <= maxw; w++) {
+ 108:	83 c4 20             	add    $0x20,%esp
+ 10b:	39 75 cc             	cmp    %esi,-0x34(%ebp)
+ 10e:	0f 8d 37 ff ff ff    	jge    4b <main+0x4b>
+      exit();
+ 114:	e8 5a 03 00 00       	call   473 <exit>
+        close(fds[0]);
+ 119:	83 ec 0c             	sub    $0xc,%esp
+ 11c:	ff 75 e0             	push   -0x20(%ebp)
+ 11f:	89 c7                	mov    %eax,%edi
+ 121:	e8 75 03 00 00       	call   49b <close>
+        worker(dur, fds[1]);
+ 126:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  int start = uptime();
+ 129:	e8 dd 03 00 00       	call   50b <uptime>
+  while (uptime() - start < dur_ticks) {
+ 12e:	83 c4 10             	add    $0x10,%esp
+  int start = uptime();
+ 131:	89 c3                	mov    %eax,%ebx
+  while (uptime() - start < dur_ticks) {
+ 133:	89 f8                	mov    %edi,%eax
+  int i, pid, ops = 0;
+ 135:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  while (uptime() - start < dur_ticks) {
+ 138:	89 df                	mov    %ebx,%edi
+ 13a:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 13d:	e8 c9 03 00 00       	call   50b <uptime>
+ 142:	29 f8                	sub    %edi,%eax
+ 144:	39 d8                	cmp    %ebx,%eax
+ 146:	7d 68                	jge    1b0 <main+0x1b0>
+ 148:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+    pid = fork();
+ 150:	e8 16 03 00 00       	call   46b <fork>
+    if (pid < 0)
+ 155:	85 c0                	test   %eax,%eax
+ 157:	78 57                	js     1b0 <main+0x1b0>
+    if (pid == 0)
+ 159:	74 b9                	je     114 <main+0x114>
+    wait();
+ 15b:	e8 1b 03 00 00       	call   47b <wait>
+    a = sbrk(HEAPPAGES * 4096);
+ 160:	83 ec 0c             	sub    $0xc,%esp
+    ops++;
+ 163:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+    a = sbrk(HEAPPAGES * 4096);
+ 167:	68 00 00 01 00       	push   $0x10000
+ 16c:	e8 8a 03 00 00       	call   4fb <sbrk>
+    if (a == (char*)-1)
+ 171:	83 c4 10             	add    $0x10,%esp
+ 174:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 177:	74 37                	je     1b0 <main+0x1b0>
+ 179:	8d 90 00 00 01 00    	lea    0x10000(%eax),%edx
+ 17f:	90                   	nop
+      a[i * 4096] = 1;
+ 180:	c6 00 01             	movb   $0x1,(%eax)
+    for (i = 0; i < HEAPPAGES; i++)
+ 183:	05 00 10 00 00       	add    $0x1000,%eax
+ 188:	39 c2                	cmp    %eax,%edx
+ 18a:	75 f4                	jne    180 <main+0x180>
+    sbrk(-HEAPPAGES * 4096);
+ 18c:	83 ec 0c             	sub    $0xc,%esp
+ 18f:	68 00 00 ff ff       	push   $0xffff0000
+ 194:	e8 62 03 00 00       	call   4fb <sbrk>
+    ops++;
+ 199:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 19c:	83 c4 10             	add    $0x10,%esp
+ 19f:	83 c0 01             	add    $0x1,%eax
+  int i, pid, ops = 0;
+ 1a2:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  while (uptime() - start < dur_ticks) {
+ 1a5:	e8 61 03 00 00       	call   50b <uptime>
+ 1aa:	29 f8                	sub    %edi,%eax
+ 1ac:	39 d8                	cmp    %ebx,%eax
+ 1ae:	7c a0                	jl     150 <main+0x150>
+  write(fd, &ops, sizeof(ops));
+ 1b0:	8d 45 dc             	lea    -0x24(%ebp),%eax
+ 1b3:	52                   	push   %edx
+ 1b4:	6a 04                	push   $0x4
+ 1b6:	50                   	push   %eax
+ 1b7:	56                   	push   %esi
+ 1b8:	e8 d6 02 00 00       	call   493 <write>
+  exit();
+ 1bd:	e8 b1 02 00 00       	call   473 <exit>
+  if (argc > 1) maxw = atoi(argv[1]);
+ 1c2:	83 ec 0c             	sub    $0xc,%esp
+ 1c5:	ff 76 04             	push   0x4(%esi)
+ 1c8:	e8 33 02 00 00       	call   400 <atoi>
+  int maxw = 4, dur = 200;
+ 1cd:	c7 45 d0 c8 00 00 00 	movl   $0xc8,-0x30(%ebp)
+  if (argc > 2) dur = atoi(argv[2]);
+ 1d4:	83 c4 10             	add    $0x10,%esp
+  if (argc > 1) maxw = atoi(argv[1]);
+ 1d7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  if (argc > 2) dur = atoi(argv[2]);
+ 1da:	83 fb 02             	cmp    $0x2,%ebx
+ 1dd:	74 11                	je     1f0 <main+0x1f0>
+ 1df:	83 ec 0c             	sub    $0xc,%esp
+ 1e2:	ff 76 08             	push   0x8(%esi)
+ 1e5:	e8 16 02 00 00       	call   400 <atoi>
+ 1ea:	83 c4 10             	add    $0x10,%esp
+ 1ed:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  printf(1, "\n[FORKBENCH] up to %d workers, %d ticks each\n", maxw, dur);
+ 1f0:	ff 75 d0             	push   -0x30(%ebp)
+ 1f3:	8b 7d cc             	mov    -0x34(%ebp),%edi
+ 1f6:	57                   	push   %edi
+ 1f7:	68 50 0c 00 00       	push   $0xc50
+ 1fc:	6a 01                	push   $0x1
+ 1fe:	e8 ed 03 00 00       	call   5f0 <printf>
+  for (w = 1; w <= maxw; w++) {
+ 203:	83 c4 10             	add    $0x10,%esp
+ 206:	85 ff                	test   %edi,%edi
+ 208:	0f 8f 38 fe ff ff    	jg     46 <main+0x46>
+ 20e:	e9 01 ff ff ff       	jmp    114 <main+0x114>
+      printf(2, "forkbench: pipe failed\n");
+ 213:	53                   	push   %ebx
+ 214:	53                   	push   %ebx
+ 215:	68 ab 0c 00 00       	push   $0xcab
+ 21a:	6a 02                	push   $0x2
+ 21c:	e8 cf 03 00 00       	call   5f0 <printf>
+      exit();
+ 221:	e8 4d 02 00 00       	call   473 <exit>
+ 226:	66 90                	xchg   %ax,%ax
+ 228:	66 90                	xchg   %ax,%ax
+ 22a:	66 90                	xchg   %ax,%ax
+ 22c:	66 90                	xchg   %ax,%ax
+ 22e:	66 90                	xchg   %ax,%ax
+
+00000230 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 230:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 231:	31 c0                	xor    %eax,%eax
+{
+ 233:	89 e5                	mov    %esp,%ebp
+ 235:	53                   	push   %ebx
+ 236:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 239:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 240:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 244:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 247:	83 c0 01             	add    $0x1,%eax
+ 24a:	84 d2                	test   %dl,%dl
+ 24c:	75 f2                	jne    240 <strcpy+0x10>
+    ;
+  return os;
+}
+ 24e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 251:	89 c8                	mov    %ecx,%eax
+ 253:	c9                   	leave
+ 254:	c3                   	ret
+ 255:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	53                   	push   %ebx
+ 264:	8b 55 08             	mov    0x8(%ebp),%edx
+ 267:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 26a:	0f b6 02             	movzbl (%edx),%eax
+ 26d:	84 c0                	test   %al,%al
+ 26f:	75 17                	jne    288 <strcmp+0x28>
+ 271:	eb 3a                	jmp    2ad <strcmp+0x4d>
+ 273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 277:	90                   	nop
+ 278:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 27c:	83 c2 01             	add    $0x1,%edx
+ 27f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 282:	84 c0                	test   %al,%al
+ 284:	74 1a                	je     2a0 <strcmp+0x40>
+    p++, q++;
+ 286:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 288:	0f b6 19             	movzbl (%ecx),%ebx
+ 28b:	38 c3                	cmp    %al,%bl
+ 28d:	74 e9                	je     278 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 28f:	29 d8                	sub    %ebx,%eax
+}
+ 291:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 294:	c9                   	leave
+ 295:	c3                   	ret
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2a4:	31 c0                	xor    %eax,%eax
+ 2a6:	29 d8                	sub    %ebx,%eax
+}
+ 2a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2ab:	c9                   	leave
+ 2ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2ad:	0f b6 19             	movzbl (%ecx),%ebx
+ 2b0:	31 c0                	xor    %eax,%eax
+ 2b2:	eb db                	jmp    28f <strcmp+0x2f>
+ 2b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2c6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2c9:	74 15                	je     2e0 <strlen+0x20>
+ 2cb:	31 c0                	xor    %eax,%eax
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+ 2d0:	83 c0 01             	add    $0x1,%eax
+ 2d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2d7:	89 c1                	mov    %eax,%ecx
+ 2d9:	75 f5                	jne    2d0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2db:	89 c8                	mov    %ecx,%eax
+ 2dd:	5d                   	pop    %ebp
+ 2de:	c3                   	ret
+ 2df:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2e0:	31 c9                	xor    %ecx,%ecx
+}
+ 2e2:	5d                   	pop    %ebp
+ 2e3:	89 c8                	mov    %ecx,%eax
+ 2e5:	c3                   	ret
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2fd:	89 d7                	mov    %edx,%edi
+ 2ff:	fc                   	cld
+ 300:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 302:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 305:	89 d0                	mov    %edx,%eax
+ 307:	c9                   	leave
+ 308:	c3                   	ret
+ 309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	8b 45 08             	mov    0x8(%ebp),%eax
+ 316:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 31a:	0f b6 10             	movzbl (%eax),%edx
+ 31d:	84 d2                	test   %dl,%dl
+ 31f:	75 12                	jne    333 <strchr+0x23>
+ 321:	eb 1d                	jmp    340 <strchr+0x30>
+ 323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 327:	90                   	nop
+ 328:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 32c:	83 c0 01             	add    $0x1,%eax
+ 32f:	84 d2                	test   %dl,%dl
+ 331:	74 0d                	je     340 <strchr+0x30>
+    if(*s == c)
+ 333:	38 d1                	cmp    %dl,%cl
+ 335:	75 f1                	jne    328 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 337:	5d                   	pop    %ebp
+ 338:	c3                   	ret
+ 339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 340:	31 c0                	xor    %eax,%eax
+}
+ 342:	5d                   	pop    %ebp
+ 343:	c3                   	ret
+ 344:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	57                   	push   %edi
+ 354:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 355:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 358:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 359:	31 db                	xor    %ebx,%ebx
+{
+ 35b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 35e:	eb 27                	jmp    387 <gets+0x37>
+    cc = read(0, &c, 1);
+ 360:	83 ec 04             	sub    $0x4,%esp
+ 363:	6a 01                	push   $0x1
+ 365:	56                   	push   %esi
+ 366:	6a 00                	push   $0x0
+ 368:	e8 1e 01 00 00       	call   48b <read>
+    if(cc < 1)
+ 36d:	83 c4 10             	add    $0x10,%esp
+ 370:	85 c0                	test   %eax,%eax
+ 372:	7e 1d                	jle    391 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 374:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 378:	8b 55 08             	mov    0x8(%ebp),%edx
+ 37b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 37f:	3c 0a                	cmp    $0xa,%al
+ 381:	74 10                	je     393 <gets+0x43>
+ 383:	3c 0d                	cmp    $0xd,%al
+ 385:	74 0c                	je     393 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 387:	89 df                	mov    %ebx,%edi
+ 389:	83 c3 01             	add    $0x1,%ebx
+ 38c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 38f:	7c cf                	jl     360 <gets+0x10>
+ 391:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 393:	8b 45 08             	mov    0x8(%ebp),%eax
+ 396:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 39a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 39d:	5b                   	pop    %ebx
+ 39e:	5e                   	pop    %esi
+ 39f:	5f                   	pop    %edi
+ 3a0:	5d                   	pop    %ebp
+ 3a1:	c3                   	ret
+ 3a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	56                   	push   %esi
+ 3b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3b5:	83 ec 08             	sub    $0x8,%esp
+ 3b8:	6a 00                	push   $0x0
+ 3ba:	ff 75 08             	push   0x8(%ebp)
+ 3bd:	e8 f1 00 00 00       	call   4b3 <open>
+  if(fd < 0)
+ 3c2:	83 c4 10             	add    $0x10,%esp
+ 3c5:	85 c0                	test   %eax,%eax
+ 3c7:	78 27                	js     3f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3c9:	83 ec 08             	sub    $0x8,%esp
+ 3cc:	ff 75 0c             	push   0xc(%ebp)
+ 3cf:	89 c3                	mov    %eax,%ebx
+ 3d1:	50                   	push   %eax
+ 3d2:	e8 f4 00 00 00       	call   4cb <fstat>
+  close(fd);
+ 3d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3dc:	e8 ba 00 00 00       	call   49b <close>
+  return r;
+ 3e1:	83 c4 10             	add    $0x10,%esp
+}
+ 3e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3e7:	89 f0                	mov    %esi,%eax
+ 3e9:	5b                   	pop    %ebx
+ 3ea:	5e                   	pop    %esi
+ 3eb:	5d                   	pop    %ebp
+ 3ec:	c3                   	ret
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3f5:	eb ed                	jmp    3e4 <stat+0x34>
+ 3f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fe:	66 90                	xchg   %ax,%ax
+
+00000400 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	53                   	push   %ebx
+ 404:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 407:	0f be 02             	movsbl (%edx),%eax
+ 40a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 40d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 410:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 415:	77 1e                	ja     435 <atoi+0x35>
+ 417:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 420:	83 c2 01             	add    $0x1,%edx
+ 423:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 426:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 42a:	0f be 02             	movsbl (%edx),%eax
+ 42d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 430:	80 fb 09             	cmp    $0x9,%bl
+ 433:	76 eb                	jbe    420 <atoi+0x20>
+  return n;
+}
+ 435:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 438:	89 c8                	mov    %ecx,%eax
+ 43a:	c9                   	leave
+ 43b:	c3                   	ret
+ 43c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000440 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	57                   	push   %edi
+ 444:	56                   	push   %esi
+ 445:	8b 45 10             	mov    0x10(%ebp),%eax
+ 448:	8b 55 08             	mov    0x8(%ebp),%edx
+ 44b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 44e:	85 c0                	test   %eax,%eax
+ 450:	7e 13                	jle    465 <memmove+0x25>
+ 452:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 454:	89 d7                	mov    %edx,%edi
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 460:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 461:	39 f8                	cmp    %edi,%eax
+ 463:	75 fb                	jne    460 <memmove+0x20>
+  return vdst;
+}
+ 465:	5e                   	pop    %esi
+ 466:	89 d0                	mov    %edx,%eax
+ 468:	5f                   	pop    %edi
+ 469:	5d                   	pop    %ebp
+ 46a:	c3                   	ret
+
+0000046b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 46b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <exit>:
+SYSCALL(exit)
+ 473:	b8 02 00 00 00       	mov    $0x2,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <wait>:
+SYSCALL(wait)
+ 47b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <pipe>:
+SYSCALL(pipe)
+ 483:	b8 04 00 00 00       	mov    $0x4,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <read>:
+SYSCALL(read)
+ 48b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <write>:
+SYSCALL(write)
+ 493:	b8 10 00 00 00       	mov    $0x10,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <close>:
+SYSCALL(close)
+ 49b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <kill>:
+SYSCALL(kill)
+ 4a3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <exec>:
+SYSCALL(exec)
+ 4ab:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <open>:
+SYSCALL(open)
+ 4b3:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <mknod>:
+SYSCALL(mknod)
+ 4bb:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <unlink>:
+SYSCALL(unlink)
+ 4c3:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <fstat>:
+SYSCALL(fstat)
+ 4cb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <link>:
+SYSCALL(link)
+ 4d3:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <mkdir>:
+SYSCALL(mkdir)
+ 4db:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <chdir>:
+SYSCALL(chdir)
+ 4e3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <dup>:
+SYSCALL(dup)
+ 4eb:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <getpid>:
+SYSCALL(getpid)
+ 4f3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <sbrk>:
+SYSCALL(sbrk)
+ 4fb:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <sleep>:
+SYSCALL(sleep)
+ 503:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <uptime>:
+SYSCALL(uptime)
+ 50b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <nice>:
+SYSCALL(nice)
+ 513:	b8 16 00 00 00       	mov    $0x16,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <fsync>:
+SYSCALL(fsync)
+ 51b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <getpstat>:
+SYSCALL(getpstat)
+ 523:	b8 18 00 00 00       	mov    $0x18,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <pipesize>:
+SYSCALL(pipesize)
+ 52b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <uptimens>:
+SYSCALL(uptimens)
+ 533:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <settickets>:
+SYSCALL(settickets)
+ 53b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <transfer>:
+SYSCALL(transfer)
+ 543:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+ 54b:	66 90                	xchg   %ax,%ax
+ 54d:	66 90                	xchg   %ax,%ax
+ 54f:	90                   	nop
+
+00000550 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	53                   	push   %ebx
+ 556:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 558:	89 d1                	mov    %edx,%ecx
+{
+ 55a:	83 ec 3c             	sub    $0x3c,%esp
+ 55d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 560:	85 d2                	test   %edx,%edx
+ 562:	0f 89 80 00 00 00    	jns    5e8 <printint+0x98>
+ 568:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 56c:	74 7a                	je     5e8 <printint+0x98>
+    x = -xx;
+ 56e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 570:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 575:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 578:	31 f6                	xor    %esi,%esi
+ 57a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 580:	89 c8                	mov    %ecx,%eax
+ 582:	31 d2                	xor    %edx,%edx
+ 584:	89 f7                	mov    %esi,%edi
+ 586:	f7 f3                	div    %ebx
+ 588:	8d 76 01             	lea    0x1(%esi),%esi
+ 58b:	0f b6 92 3c 0d 00 00 	movzbl 0xd3c(%edx),%edx
+ 592:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 596:	89 ca                	mov    %ecx,%edx
+ 598:	89 c1                	mov    %eax,%ecx
+ 59a:	39 da                	cmp    %ebx,%edx
+ 59c:	73 e2                	jae    580 <printint+0x30>
+  if(neg)
+ 59e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5a1:	85 c0                	test   %eax,%eax
+ 5a3:	74 07                	je     5ac <printint+0x5c>
+    buf[i++] = '-';
+ 5a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5aa:	89 f7                	mov    %esi,%edi
+ 5ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5b2:	01 df                	add    %ebx,%edi
+ 5b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5bb:	83 ec 04             	sub    $0x4,%esp
+ 5be:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 5c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 5c4:	6a 01                	push   $0x1
+ 5c6:	50                   	push   %eax
+ 5c7:	56                   	push   %esi
+ 5c8:	e8 c6 fe ff ff       	call   493 <write>
+  while(--i >= 0)
+ 5cd:	89 f8                	mov    %edi,%eax
+ 5cf:	83 c4 10             	add    $0x10,%esp
+ 5d2:	83 ef 01             	sub    $0x1,%edi
+ 5d5:	39 d8                	cmp    %ebx,%eax
+ 5d7:	75 df                	jne    5b8 <printint+0x68>
+}
+ 5d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5dc:	5b                   	pop    %ebx
+ 5dd:	5e                   	pop    %esi
+ 5de:	5f                   	pop    %edi
+ 5df:	5d                   	pop    %ebp
+ 5e0:	c3                   	ret
+ 5e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 5e8:	31 c0                	xor    %eax,%eax
+ 5ea:	eb 89                	jmp    575 <printint+0x25>
+ 5ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	57                   	push   %edi
+ 5f4:	56                   	push   %esi
+ 5f5:	53                   	push   %ebx
+ 5f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 5f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 5fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 5ff:	0f b6 1e             	movzbl (%esi),%ebx
+ 602:	83 c6 01             	add    $0x1,%esi
+ 605:	84 db                	test   %bl,%bl
+ 607:	74 67                	je     670 <printf+0x80>
+ 609:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 60c:	31 d2                	xor    %edx,%edx
+ 60e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 611:	eb 34                	jmp    647 <printf+0x57>
+ 613:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 617:	90                   	nop
+ 618:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 61b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 620:	83 f8 25             	cmp    $0x25,%eax
+ 623:	74 18                	je     63d <printf+0x4d>
+  write(fd, &c, 1);
+ 625:	83 ec 04             	sub    $0x4,%esp
+ 628:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 62b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 62e:	6a 01                	push   $0x1
+ 630:	50                   	push   %eax
+ 631:	57                   	push   %edi
+ 632:	e8 5c fe ff ff       	call   493 <write>
+ 637:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 63a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 63d:	0f b6 1e             	movzbl (%esi),%ebx
+ 640:	83 c6 01             	add    $0x1,%esi
+ 643:	84 db                	test   %bl,%bl
+ 645:	74 29                	je     670 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 647:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 64a:	85 d2                	test   %edx,%edx
+ 64c:	74 ca                	je     618 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 64e:	83 fa 25             	cmp    $0x25,%edx
+ 651:	75 ea                	jne    63d <printf+0x4d>
+      if(c == 'd'){
+ 653:	83 f8 25             	cmp    $0x25,%eax
+ 656:	0f 84 24 01 00 00    	je     780 <printf+0x190>
+ 65c:	83 e8 63             	sub    $0x63,%eax
+ 65f:	83 f8 15             	cmp    $0x15,%eax
+ 662:	77 1c                	ja     680 <printf+0x90>
+ 664:	ff 24 85 e4 0c 00 00 	jmp    *0xce4(,%eax,4)
+ 66b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 66f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 670:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 673:	5b                   	pop    %ebx
+ 674:	5e                   	pop    %esi
+ 675:	5f                   	pop    %edi
+ 676:	5d                   	pop    %ebp
+ 677:	c3                   	ret
+ 678:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67f:	90                   	nop
+  write(fd, &c, 1);
+ 680:	83 ec 04             	sub    $0x4,%esp
+ 683:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 686:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 68a:	6a 01                	push   $0x1
+ 68c:	52                   	push   %edx
+ 68d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 690:	57                   	push   %edi
+ 691:	e8 fd fd ff ff       	call   493 <write>
+ 696:	83 c4 0c             	add    $0xc,%esp
+ 699:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 69c:	6a 01                	push   $0x1
+ 69e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6a1:	52                   	push   %edx
+ 6a2:	57                   	push   %edi
+ 6a3:	e8 eb fd ff ff       	call   493 <write>
+        putc(fd, c);
+ 6a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6ab:	31 d2                	xor    %edx,%edx
+ 6ad:	eb 8e                	jmp    63d <printf+0x4d>
+ 6af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6b3:	83 ec 0c             	sub    $0xc,%esp
+ 6b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6bb:	8b 13                	mov    (%ebx),%edx
+ 6bd:	6a 00                	push   $0x0
+ 6bf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 6c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 6c4:	e8 87 fe ff ff       	call   550 <printint>
+        ap++;
+ 6c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6cf:	31 d2                	xor    %edx,%edx
+ 6d1:	e9 67 ff ff ff       	jmp    63d <printf+0x4d>
+ 6d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 6e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 6e5:	83 c0 04             	add    $0x4,%eax
+ 6e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 6eb:	85 db                	test   %ebx,%ebx
+ 6ed:	0f 84 9d 00 00 00    	je     790 <printf+0x1a0>
+        while(*s != 0){
+ 6f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 6f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 6f8:	84 c0                	test   %al,%al
+ 6fa:	0f 84 3d ff ff ff    	je     63d <printf+0x4d>
+ 700:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 703:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 706:	89 de                	mov    %ebx,%esi
+ 708:	89 d3                	mov    %edx,%ebx
+ 70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 710:	83 ec 04             	sub    $0x4,%esp
+ 713:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 716:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 719:	6a 01                	push   $0x1
+ 71b:	53                   	push   %ebx
+ 71c:	57                   	push   %edi
+ 71d:	e8 71 fd ff ff       	call   493 <write>
+        while(*s != 0){
+ 722:	0f b6 06             	movzbl (%esi),%eax
+ 725:	83 c4 10             	add    $0x10,%esp
+ 728:	84 c0                	test   %al,%al
+ 72a:	75 e4                	jne    710 <printf+0x120>
+      state = 0;
+ 72c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 72f:	31 d2                	xor    %edx,%edx
+ 731:	e9 07 ff ff ff       	jmp    63d <printf+0x4d>
+ 736:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 73d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 740:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 743:	83 ec 0c             	sub    $0xc,%esp
+ 746:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 74b:	8b 13                	mov    (%ebx),%edx
+ 74d:	6a 01                	push   $0x1
+ 74f:	e9 6b ff ff ff       	jmp    6bf <printf+0xcf>
+ 754:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 758:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 75b:	83 ec 04             	sub    $0x4,%esp
+ 75e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 761:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 763:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 766:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 769:	6a 01                	push   $0x1
+ 76b:	52                   	push   %edx
+ 76c:	57                   	push   %edi
+ 76d:	e8 21 fd ff ff       	call   493 <write>
+        ap++;
+ 772:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 775:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 778:	31 d2                	xor    %edx,%edx
+ 77a:	e9 be fe ff ff       	jmp    63d <printf+0x4d>
+ 77f:	90                   	nop
+  write(fd, &c, 1);
+ 780:	83 ec 04             	sub    $0x4,%esp
+ 783:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 786:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 789:	6a 01                	push   $0x1
+ 78b:	e9 11 ff ff ff       	jmp    6a1 <printf+0xb1>
+ 790:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 795:	bb db 0c 00 00       	mov    $0xcdb,%ebx
+ 79a:	e9 61 ff ff ff       	jmp    700 <printf+0x110>
+ 79f:	90                   	nop
+
+000007a0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7a0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7a1:	a1 ac 10 00 00       	mov    0x10ac,%eax
+{
+ 7a6:	89 e5                	mov    %esp,%ebp
+ 7a8:	57                   	push   %edi
+ 7a9:	56                   	push   %esi
+ 7aa:	53                   	push   %ebx
+ 7ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 7ae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7b8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7ba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7bc:	39 ca                	cmp    %ecx,%edx
+ 7be:	73 30                	jae    7f0 <free+0x50>
+ 7c0:	39 c1                	cmp    %eax,%ecx
+ 7c2:	72 04                	jb     7c8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7c4:	39 c2                	cmp    %eax,%edx
+ 7c6:	72 f0                	jb     7b8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 7c8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 7cb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 7ce:	39 f8                	cmp    %edi,%eax
+ 7d0:	74 2e                	je     800 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7d2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 7d5:	8b 42 04             	mov    0x4(%edx),%eax
+ 7d8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7db:	39 f1                	cmp    %esi,%ecx
+ 7dd:	74 38                	je     817 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 7df:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 7e1:	5b                   	pop    %ebx
+  freep = p;
+ 7e2:	89 15 ac 10 00 00    	mov    %edx,0x10ac
+}
+ 7e8:	5e                   	pop    %esi
+ 7e9:	5f                   	pop    %edi
+ 7ea:	5d                   	pop    %ebp
+ 7eb:	c3                   	ret
+ 7ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7f0:	39 c1                	cmp    %eax,%ecx
+ 7f2:	72 d0                	jb     7c4 <free+0x24>
+ 7f4:	eb c2                	jmp    7b8 <free+0x18>
+ 7f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 800:	03 70 04             	add    0x4(%eax),%esi
+ 803:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 806:	8b 02                	mov    (%edx),%eax
+ 808:	8b 00                	mov    (%eax),%eax
+ 80a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 80d:	8b 42 04             	mov    0x4(%edx),%eax
+ 810:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 813:	39 f1                	cmp    %esi,%ecx
+ 815:	75 c8                	jne    7df <free+0x3f>
+    p->s.size += bp->s.size;
+ 817:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 81a:	89 15 ac 10 00 00    	mov    %edx,0x10ac
+    p->s.size += bp->s.size;
+ 820:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 823:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 826:	89 0a                	mov    %ecx,(%edx)
+}
+ 828:	5b                   	pop    %ebx
+ 829:	5e                   	pop    %esi
+ 82a:	5f                   	pop    %edi
+ 82b:	5d                   	pop    %ebp
+ 82c:	c3                   	ret
+ 82d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000830 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 830:	55                   	push   %ebp
+ 831:	89 e5                	mov    %esp,%ebp
+ 833:	57                   	push   %edi
+ 834:	56                   	push   %esi
+ 835:	53                   	push   %ebx
+ 836:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 839:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 83c:	8b 15 ac 10 00 00    	mov    0x10ac,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 842:	8d 78 07             	lea    0x7(%eax),%edi
+ 845:	c1 ef 03             	shr    $0x3,%edi
+ 848:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 84b:	85 d2                	test   %edx,%edx
+ 84d:	0f 84 8d 00 00 00    	je     8e0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 853:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 855:	8b 48 04             	mov    0x4(%eax),%ecx
+ 858:	39 f9                	cmp    %edi,%ecx
+ 85a:	73 64                	jae    8c0 <malloc+0x90>
+  if(nu < 4096)
+ 85c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 861:	39 df                	cmp    %ebx,%edi
+ 863:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 866:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 86d:	eb 0a                	jmp    879 <malloc+0x49>
+ 86f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 870:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 872:	8b 48 04             	mov    0x4(%eax),%ecx
+ 875:	39 f9                	cmp    %edi,%ecx
+ 877:	73 47                	jae    8c0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 879:	89 c2                	mov    %eax,%edx
+ 87b:	39 05 ac 10 00 00    	cmp    %eax,0x10ac
+ 881:	75 ed                	jne    870 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 883:	83 ec 0c             	sub    $0xc,%esp
+ 886:	56                   	push   %esi
+ 887:	e8 6f fc ff ff       	call   4fb <sbrk>
+  if(p == (char*)-1)
+ 88c:	83 c4 10             	add    $0x10,%esp
+ 88f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 892:	74 1c                	je     8b0 <malloc+0x80>
+  hp->s.size = nu;
+ 894:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 897:	83 ec 0c             	sub    $0xc,%esp
+ 89a:	83 c0 08             	add    $0x8,%eax
+ 89d:	50                   	push   %eax
+ 89e:	e8 fd fe ff ff       	call   7a0 <free>
+  return freep;
+ 8a3:	8b 15 ac 10 00 00    	mov    0x10ac,%edx
+      if((p = morecore(nunits)) == 0)
+ 8a9:	83 c4 10             	add    $0x10,%esp
+ 8ac:	85 d2                	test   %edx,%edx
+ 8ae:	75 c0                	jne    870 <malloc+0x40>
+        return 0;
+  }
+}
+ 8b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8b3:	31 c0                	xor    %eax,%eax
+}
+ 8b5:	5b                   	pop    %ebx
+ 8b6:	5e                   	pop    %esi
+ 8b7:	5f                   	pop    %edi
+ 8b8:	5d                   	pop    %ebp
+ 8b9:	c3                   	ret
+ 8ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 8c0:	39 cf                	cmp    %ecx,%edi
+ 8c2:	74 4c                	je     910 <malloc+0xe0>
+        p->s.size -= nunits;
+ 8c4:	29 f9                	sub    %edi,%ecx
+ 8c6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 8c9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 8cc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 8cf:	89 15 ac 10 00 00    	mov    %edx,0x10ac
+}
+ 8d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 8d8:	83 c0 08             	add    $0x8,%eax
+}
+ 8db:	5b                   	pop    %ebx
+ 8dc:	5e                   	pop    %esi
+ 8dd:	5f                   	pop    %edi
+ 8de:	5d                   	pop    %ebp
+ 8df:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 8e0:	c7 05 ac 10 00 00 b0 	movl   $0x10b0,0x10ac
+ 8e7:	10 00 00 
+    base.s.size = 0;
+ 8ea:	b8 b0 10 00 00       	mov    $0x10b0,%eax
+    base.s.ptr = freep = prevp = &base;
+ 8ef:	c7 05 b0 10 00 00 b0 	movl   $0x10b0,0x10b0
+ 8f6:	10 00 00 
+    base.s.size = 0;
+ 8f9:	c7 05 b4 10 00 00 00 	movl   $0x0,0x10b4
+ 900:	00 00 00 
+    if(p->s.size >= nunits){
+ 903:	e9 54 ff ff ff       	jmp    85c <malloc+0x2c>
+ 908:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 910:	8b 08                	mov    (%eax),%ecx
+ 912:	89 0a                	mov    %ecx,(%edx)
+ 914:	eb b9                	jmp    8cf <malloc+0x9f>
+ 916:	66 90                	xchg   %ax,%ax
+ 918:	66 90                	xchg   %ax,%ax
+ 91a:	66 90                	xchg   %ax,%ax
+ 91c:	66 90                	xchg   %ax,%ax
+ 91e:	66 90                	xchg   %ax,%ax
+
+00000920 <pidstat>:
+
+// Fill in *st with the statistics of process pid.
+// Returns 0, or -1 if there is no such process.
+int
+pidstat(int pid, struct pstat *st)
+{
+ 920:	55                   	push   %ebp
+ 921:	89 e5                	mov    %esp,%ebp
+ 923:	56                   	push   %esi
+ 924:	53                   	push   %ebx
+  static struct pstat *ps;
+  int i, n;
+
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ 925:	a1 b8 10 00 00       	mov    0x10b8,%eax
+{
+ 92a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 92d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ 930:	85 c0                	test   %eax,%eax
+ 932:	0f 84 98 00 00 00    	je     9d0 <pidstat+0xb0>
+    return -1;
+  n = getpstat(ps, NPROC);
+ 938:	83 ec 08             	sub    $0x8,%esp
+ 93b:	6a 40                	push   $0x40
+ 93d:	50                   	push   %eax
+ 93e:	e8 e0 fb ff ff       	call   523 <getpstat>
+  for(i = 0; i < n; i++){
+ 943:	83 c4 10             	add    $0x10,%esp
+ 946:	85 c0                	test   %eax,%eax
+ 948:	0f 8e 9f 00 00 00    	jle    9ed <pidstat+0xcd>
+ 94e:	8b 15 b8 10 00 00    	mov    0x10b8,%edx
+ 954:	31 c9                	xor    %ecx,%ecx
+ 956:	eb 16                	jmp    96e <pidstat+0x4e>
+ 958:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95f:	90                   	nop
+ 960:	83 c1 01             	add    $0x1,%ecx
+ 963:	83 c2 38             	add    $0x38,%edx
+ 966:	39 c8                	cmp    %ecx,%eax
+ 968:	0f 84 7f 00 00 00    	je     9ed <pidstat+0xcd>
+    if(ps[i].pid == pid){
+ 96e:	39 1a                	cmp    %ebx,(%edx)
+ 970:	75 ee                	jne    960 <pidstat+0x40>
+      *st = ps[i];
+ 972:	89 1e                	mov    %ebx,(%esi)
+ 974:	8b 42 04             	mov    0x4(%edx),%eax
+ 977:	89 46 04             	mov    %eax,0x4(%esi)
+ 97a:	8b 42 08             	mov    0x8(%edx),%eax
+ 97d:	89 46 08             	mov    %eax,0x8(%esi)
+ 980:	8b 42 0c             	mov    0xc(%edx),%eax
+ 983:	89 46 0c             	mov    %eax,0xc(%esi)
+ 986:	8b 42 10             	mov    0x10(%edx),%eax
+ 989:	89 46 10             	mov    %eax,0x10(%esi)
+ 98c:	8b 42 14             	mov    0x14(%edx),%eax
+ 98f:	89 46 14             	mov    %eax,0x14(%esi)
+ 992:	8b 42 18             	mov    0x18(%edx),%eax
+ 995:	89 46 18             	mov    %eax,0x18(%esi)
+ 998:	8b 42 1c             	mov    0x1c(%edx),%eax
+ 99b:	89 46 1c             	mov    %eax,0x1c(%esi)
+ 99e:	8b 42 20             	mov    0x20(%edx),%eax
+ 9a1:	89 46 20             	mov    %eax,0x20(%esi)
+ 9a4:	8b 42 24             	mov    0x24(%edx),%eax
+ 9a7:	89 46 24             	mov    %eax,0x24(%esi)
+ 9aa:	8b 42 28             	mov    0x28(%edx),%eax
+ 9ad:	89 46 28             	mov    %eax,0x28(%esi)
+ 9b0:	8b 42 2c             	mov    0x2c(%edx),%eax
+ 9b3:	89 46 2c             	mov    %eax,0x2c(%esi)
+ 9b6:	8b 42 30             	mov    0x30(%edx),%eax
+ 9b9:	89 46 30             	mov    %eax,0x30(%esi)
+ 9bc:	8b 42 34             	mov    0x34(%edx),%eax
+ 9bf:	89 46 34             	mov    %eax,0x34(%esi)
+      return 0;
+    }
+  }
+  return -1;
+}
+ 9c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ 9c5:	31 c0                	xor    %eax,%eax
+}
+ 9c7:	5b                   	pop    %ebx
+ 9c8:	5e                   	pop    %esi
+ 9c9:	5d                   	pop    %ebp
+ 9ca:	c3                   	ret
+ 9cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9cf:	90                   	nop
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ 9d0:	83 ec 0c             	sub    $0xc,%esp
+ 9d3:	68 00 0e 00 00       	push   $0xe00
+ 9d8:	e8 53 fe ff ff       	call   830 <malloc>
+ 9dd:	83 c4 10             	add    $0x10,%esp
+ 9e0:	a3 b8 10 00 00       	mov    %eax,0x10b8
+ 9e5:	85 c0                	test   %eax,%eax
+ 9e7:	0f 85 4b ff ff ff    	jne    938 <pidstat+0x18>
+}
+ 9ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return -1;
+ 9f0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 9f5:	5b                   	pop    %ebx
+ 9f6:	5e                   	pop    %esi
+ 9f7:	5d                   	pop    %ebp
+ 9f8:	c3                   	ret
+ 9f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a00 <sharetable>:
+// key[i] is printed in a column headed keyname, and so is
+// extra[i] under extraname unless extra is 0.
+void
+sharetable(char *tag, char *keyname, int *key, char *extraname, int *extra,
+           int n, int *pid, int *weight, uint *ticks)
+{
+ a00:	55                   	push   %ebp
+ a01:	89 e5                	mov    %esp,%ebp
+ a03:	57                   	push   %edi
+ a04:	56                   	push   %esi
+ a05:	53                   	push   %ebx
+ a06:	83 ec 3c             	sub    $0x3c,%esp
+ a09:	8b 45 08             	mov    0x8(%ebp),%eax
+ a0c:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+ a0f:	8b 75 24             	mov    0x24(%ebp),%esi
+ a12:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ a15:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ a18:	8b 45 10             	mov    0x10(%ebp),%eax
+ a1b:	89 7d d0             	mov    %edi,-0x30(%ebp)
+ a1e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+ a21:	89 45 cc             	mov    %eax,-0x34(%ebp)
+ a24:	8b 45 18             	mov    0x18(%ebp),%eax
+ a27:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ a2a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ a2d:	8b 45 20             	mov    0x20(%ebp),%eax
+ a30:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ a33:	8b 45 28             	mov    0x28(%ebp),%eax
+ a36:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  int i, wsum, share, expect, err, maxerr;
+  uint tsum;
+
+  wsum = 0;
+  tsum = 0;
+  for(i = 0; i < n; i++){
+ a39:	85 ff                	test   %edi,%edi
+ a3b:	0f 8e df 01 00 00    	jle    c20 <sharetable+0x220>
+ a41:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+ a44:	89 fb                	mov    %edi,%ebx
+ a46:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  tsum = 0;
+ a49:	31 d2                	xor    %edx,%edx
+  for(i = 0; i < n; i++){
+ a4b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ a4e:	31 c0                	xor    %eax,%eax
+ a50:	31 c9                	xor    %ecx,%ecx
+ a52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wsum += weight[i];
+ a58:	03 0c 86             	add    (%esi,%eax,4),%ecx
+    tsum += ticks[i];
+ a5b:	03 14 87             	add    (%edi,%eax,4),%edx
+  for(i = 0; i < n; i++){
+ a5e:	83 c0 01             	add    $0x1,%eax
+ a61:	39 c3                	cmp    %eax,%ebx
+ a63:	75 f3                	jne    a58 <sharetable+0x58>
+ a65:	85 d2                	test   %edx,%edx
+ a67:	b8 01 00 00 00       	mov    $0x1,%eax
+ a6c:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  }
+  if(tsum == 0)
+    tsum = 1;
+  if(wsum == 0)
+    wsum = 1;
+ a6f:	8b 7d d8             	mov    -0x28(%ebp),%edi
+ a72:	0f 45 c2             	cmovne %edx,%eax
+ a75:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+  if(tsum == 0)
+ a78:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    wsum = 1;
+ a7b:	85 ff                	test   %edi,%edi
+ a7d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ a80:	b8 01 00 00 00       	mov    $0x1,%eax
+ a85:	0f 45 c7             	cmovne %edi,%eax
+ a88:	89 45 d8             	mov    %eax,-0x28(%ebp)
+
+  printf(1, "[%s]  pid %s ", tag, keyname);
+ a8b:	51                   	push   %ecx
+ a8c:	ff 75 dc             	push   -0x24(%ebp)
+ a8f:	68 4d 0d 00 00       	push   $0xd4d
+ a94:	6a 01                	push   $0x1
+ a96:	e8 55 fb ff ff       	call   5f0 <printf>
+  if(extra)
+ a9b:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a9e:	83 c4 10             	add    $0x10,%esp
+ aa1:	85 f6                	test   %esi,%esi
+ aa3:	0f 84 47 01 00 00    	je     bf0 <sharetable+0x1f0>
+    printf(1, "%s ", extraname);
+ aa9:	83 ec 04             	sub    $0x4,%esp
+ aac:	53                   	push   %ebx
+ aad:	68 57 0d 00 00       	push   $0xd57
+ ab2:	6a 01                	push   $0x1
+ ab4:	e8 37 fb ff ff       	call   5f0 <printf>
+  printf(1, "ticks  share expected\n");
+ ab9:	58                   	pop    %eax
+ aba:	5a                   	pop    %edx
+ abb:	68 5b 0d 00 00       	push   $0xd5b
+ ac0:	6a 01                	push   $0x1
+ ac2:	e8 29 fb ff ff       	call   5f0 <printf>
+  maxerr = 0;
+  for(i = 0; i < n; i++){
+ ac7:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+ aca:	83 c4 10             	add    $0x10,%esp
+ acd:	85 c9                	test   %ecx,%ecx
+ acf:	0f 8e 44 01 00 00    	jle    c19 <sharetable+0x219>
+  if(extra)
+ ad5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+ adc:	31 ff                	xor    %edi,%edi
+ ade:	66 90                	xchg   %ax,%ax
+    share = ticks[i] * 1000 / tsum;
+ ae0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ ae3:	31 d2                	xor    %edx,%edx
+    expect = weight[i] * 1000 / wsum;
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+ ae5:	83 ec 0c             	sub    $0xc,%esp
+    share = ticks[i] * 1000 / tsum;
+ ae8:	69 04 b8 e8 03 00 00 	imul   $0x3e8,(%eax,%edi,4),%eax
+ aef:	f7 75 c0             	divl   -0x40(%ebp)
+ af2:	89 c6                	mov    %eax,%esi
+    expect = weight[i] * 1000 / wsum;
+ af4:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ af7:	69 04 b8 e8 03 00 00 	imul   $0x3e8,(%eax,%edi,4),%eax
+ afe:	99                   	cltd
+ aff:	f7 7d d8             	idivl  -0x28(%ebp)
+ b02:	89 c3                	mov    %eax,%ebx
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+ b04:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ b07:	ff 34 b8             	push   (%eax,%edi,4)
+ b0a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ b0d:	ff 34 b8             	push   (%eax,%edi,4)
+ b10:	ff 75 dc             	push   -0x24(%ebp)
+ b13:	68 72 0d 00 00       	push   $0xd72
+ b18:	6a 01                	push   $0x1
+ b1a:	e8 d1 fa ff ff       	call   5f0 <printf>
+    if(extra)
+ b1f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ b22:	83 c4 20             	add    $0x20,%esp
+ b25:	85 c0                	test   %eax,%eax
+ b27:	74 15                	je     b3e <sharetable+0x13e>
+      printf(1, "%d ", extra[i]);
+ b29:	83 ec 04             	sub    $0x4,%esp
+ b2c:	ff 34 b8             	push   (%eax,%edi,4)
+ b2f:	68 7a 0d 00 00       	push   $0xd7a
+ b34:	6a 01                	push   $0x1
+ b36:	e8 b5 fa ff ff       	call   5f0 <printf>
+ b3b:	83 c4 10             	add    $0x10,%esp
+    printf(1, "%d %d.%d%% %d.%d%%\n", ticks[i], share / 10, share % 10,
+ b3e:	b8 67 66 66 66       	mov    $0x66666667,%eax
+ b43:	89 d9                	mov    %ebx,%ecx
+ b45:	83 ec 04             	sub    $0x4,%esp
+ b48:	f7 eb                	imul   %ebx
+ b4a:	89 d8                	mov    %ebx,%eax
+ b4c:	c1 f8 1f             	sar    $0x1f,%eax
+ b4f:	c1 fa 02             	sar    $0x2,%edx
+ b52:	29 c2                	sub    %eax,%edx
+ b54:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ b57:	01 c0                	add    %eax,%eax
+ b59:	29 c1                	sub    %eax,%ecx
+ b5b:	b8 67 66 66 66       	mov    $0x66666667,%eax
+ b60:	51                   	push   %ecx
+ b61:	89 f1                	mov    %esi,%ecx
+ b63:	52                   	push   %edx
+ b64:	f7 ee                	imul   %esi
+ b66:	89 f0                	mov    %esi,%eax
+ b68:	c1 f8 1f             	sar    $0x1f,%eax
+ b6b:	c1 fa 02             	sar    $0x2,%edx
+ b6e:	29 c2                	sub    %eax,%edx
+ b70:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ b73:	01 c0                	add    %eax,%eax
+ b75:	29 c1                	sub    %eax,%ecx
+ b77:	51                   	push   %ecx
+ b78:	52                   	push   %edx
+ b79:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ b7c:	ff 34 b8             	push   (%eax,%edi,4)
+ b7f:	68 7e 0d 00 00       	push   $0xd7e
+ b84:	6a 01                	push   $0x1
+ b86:	e8 65 fa ff ff       	call   5f0 <printf>
+           expect / 10, expect % 10);
+    err = share > expect ? share - expect : expect - share;
+ b8b:	89 f2                	mov    %esi,%edx
+ b8d:	89 d8                	mov    %ebx,%eax
+ b8f:	83 c4 20             	add    $0x20,%esp
+ b92:	29 f0                	sub    %esi,%eax
+ b94:	29 da                	sub    %ebx,%edx
+ b96:	39 de                	cmp    %ebx,%esi
+ b98:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ b9b:	0f 4f c2             	cmovg  %edx,%eax
+    if(err > maxerr)
+ b9e:	39 c6                	cmp    %eax,%esi
+ ba0:	0f 4d c6             	cmovge %esi,%eax
+  for(i = 0; i < n; i++){
+ ba3:	83 c7 01             	add    $0x1,%edi
+ ba6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ ba9:	39 7d d0             	cmp    %edi,-0x30(%ebp)
+ bac:	0f 85 2e ff ff ff    	jne    ae0 <sharetable+0xe0>
+      maxerr = err;
+  }
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+ bb2:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+ bb7:	f7 e2                	mul    %edx
+ bb9:	c1 ea 03             	shr    $0x3,%edx
+ bbc:	8d 0c 92             	lea    (%edx,%edx,4),%ecx
+ bbf:	89 d0                	mov    %edx,%eax
+ bc1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ bc4:	01 c9                	add    %ecx,%ecx
+ bc6:	29 ca                	sub    %ecx,%edx
+ bc8:	89 45 14             	mov    %eax,0x14(%ebp)
+ bcb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ bce:	89 55 18             	mov    %edx,0x18(%ebp)
+ bd1:	89 45 10             	mov    %eax,0x10(%ebp)
+ bd4:	c7 45 0c 94 0d 00 00 	movl   $0xd94,0xc(%ebp)
+ bdb:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+ be2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ be5:	5b                   	pop    %ebx
+ be6:	5e                   	pop    %esi
+ be7:	5f                   	pop    %edi
+ be8:	5d                   	pop    %ebp
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+ be9:	e9 02 fa ff ff       	jmp    5f0 <printf>
+ bee:	66 90                	xchg   %ax,%ax
+  printf(1, "ticks  share expected\n");
+ bf0:	83 ec 08             	sub    $0x8,%esp
+ bf3:	68 5b 0d 00 00       	push   $0xd5b
+ bf8:	6a 01                	push   $0x1
+ bfa:	e8 f1 f9 ff ff       	call   5f0 <printf>
+ bff:	83 c4 10             	add    $0x10,%esp
+ c02:	e9 ce fe ff ff       	jmp    ad5 <sharetable+0xd5>
+ c07:	83 ec 08             	sub    $0x8,%esp
+ c0a:	68 5b 0d 00 00       	push   $0xd5b
+ c0f:	6a 01                	push   $0x1
+ c11:	e8 da f9 ff ff       	call   5f0 <printf>
+ c16:	83 c4 10             	add    $0x10,%esp
+  if(extra)
+ c19:	31 c0                	xor    %eax,%eax
+ c1b:	31 d2                	xor    %edx,%edx
+ c1d:	eb a9                	jmp    bc8 <sharetable+0x1c8>
+ c1f:	90                   	nop
+  printf(1, "[%s]  pid %s ", tag, keyname);
+ c20:	51                   	push   %ecx
+ c21:	ff 75 dc             	push   -0x24(%ebp)
+ c24:	68 4d 0d 00 00       	push   $0xd4d
+ c29:	6a 01                	push   $0x1
+ c2b:	e8 c0 f9 ff ff       	call   5f0 <printf>
+  if(extra)
+ c30:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ c33:	83 c4 10             	add    $0x10,%esp
+ c36:	85 ff                	test   %edi,%edi
+ c38:	74 cd                	je     c07 <sharetable+0x207>
+    wsum = 1;
+ c3a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  if(extra)
+ c41:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+ c48:	e9 5c fe ff ff       	jmp    aa9 <sharetable+0xa9>
@@ -0,0 +1,86 @@
+// forkbench.c — page allocator throughput benchmark
+// Runs 1..maxworkers concurrent workers for a fixed time window each.
+// Every worker loops on fork()+exit()+wait() and on growing its heap
+// by a few pages, touching them, and shrinking it again, so nearly
+// all of its time is spent in kalloc()/kfree().
+// Expect: total ops to scale with workers up to the number of CPUs.
+//
+// usage: forkbench [maxworkers] [ticks]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define HEAPPAGES 16
+
+static void
+worker(int dur_ticks, int fd)
+{
+  int start = uptime();
+  int i, pid, ops = 0;
+  char *a;
+
+  while (uptime() - start < dur_ticks) {
+    pid = fork();
+    if (pid < 0)
+      break;
+    if (pid == 0)
+      exit();
+    wait();
+    ops++;
+
+    a = sbrk(HEAPPAGES * 4096);
+    if (a == (char*)-1)
+      break;
+    for (i = 0; i < HEAPPAGES; i++)
+      a[i * 4096] = 1;
+    sbrk(-HEAPPAGES * 4096);
+    ops++;
+  }
+
+  write(fd, &ops, sizeof(ops));
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  int maxw = 4, dur = 200;
+  int w, i, ops, total, fds[2];
+
+  if (argc > 1) maxw = atoi(argv[1]);
+  if (argc > 2) dur = atoi(argv[2]);
+
+  printf(1, "\n[FORKBENCH] up to %d workers, %d ticks each\n", maxw, dur);
+
+  for (w = 1; w <= maxw; w++) {
+    if (pipe(fds) < 0) {
+      printf(2, "forkbench: pipe failed\n");
+      exit();
+    }
+    for (i = 0; i < w; i++) {
+      int pid = fork();
+      if (pid < 0) {
+        printf(2, "forkbench: fork failed\n");
+        exit();
+      }
+      if (pid == 0) {
+        close(fds[0]);
+        worker(dur, fds[1]);
+      }
+    }
+    close(fds[1]);
+
+    total = 0;
+    for (i = 0; i < w; i++) {
+      if (read(fds[0], &ops, sizeof(ops)) == sizeof(ops))
+        total += ops;
+      wait();
+    }
+    close(fds[0]);
+
+    printf(1, "[FORKBENCH] workers=%d ops=%d ops/tick=%d\n",
+           w, total, total / dur);
+  }
+  exit();
+}
@@ -51,26 +51,80 @@ bzero(int dev, int bno)
 }
 
 // Blocks.
+//
+// bsum keeps the number of free blocks each bitmap block
+// describes, so balloc() need not read bitmap blocks that
+// have none, and a cursor just past the last block allocated,
+// where the next search starts unless the caller has a better
+// idea. A bitmap block's count changes only while its buffer
+// is locked; balloc() reads the counts without a lock, as hints.
 
-// Allocate a zeroed disk block.
-static uint
-balloc(uint dev)
+#define NBMAP (FSSIZE/BPB + 1)
+
+static struct {
+  uint nfree[NBMAP];
+  uint cursor;
+} bsum;
+
+// Count the free blocks described by each bitmap block.
+static void
+bsuminit(int dev)
 {
-  int b, bi, m;
   struct buf *bp;
+  uint b, bi, *w, x;
 
-  bp = 0;
+  if(sb.size > NBMAP*BPB)
+    panic("bsuminit: bitmap too big");
   for(b = 0; b < sb.size; b += BPB){
     bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
-      m = 1 << (bi % 8);
-      if((bp->data[bi/8] & m) == 0){  // Is block free?
-        bp->data[bi/8] |= m;  // Mark block in use.
-        log_write(bp);
-        brelse(bp);
-        bzero(dev, b + bi);
-        return b + bi;
-      }
+    w = (uint*)bp->data;
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi += 32){
+      x = ~w[bi/32];
+      if(sb.size - (b + bi) < 32)
+        x &= (1 << (sb.size - (b + bi))) - 1;
+      for(; x; x &= x - 1)
+        bsum.nfree[b/BPB]++;
+    }
+    brelse(bp);
+  }
+}
+
+// Allocate a zeroed disk block, as close after
+// block goal as possible if goal is not 0.
+static uint
+balloc(uint dev, uint goal)
+{
+  uint b, bb, bi, n, nb, x, *w;
+  struct buf *bp;
+
+  if(goal == 0 || goal >= sb.size)
+    goal = bsum.cursor % sb.size;
+  nb = (sb.size + BPB - 1) / BPB;
+  for(n = 0; n <= nb; n++){
+    // Start in goal's bitmap block at goal's word, and come
+    // back round to the beginning of that block at the end.
+    bb = (goal/BPB + n) % nb;
+    if(bsum.nfree[bb] == 0)
+      continue;
+    bp = bread(dev, sb.bmapstart + bb);
+    w = (uint*)bp->data;
+    bi = n == 0 ? goal % BPB / 32 * 32 : 0;
+    for(; bi < BPB && bb*BPB + bi < sb.size; bi += 32){
+      x = ~w[bi/32];
+      if(n == 0 && bi/32 == goal % BPB / 32)
+        x &= ~0U << (goal % 32);   // prefer goal and after
+      if(x == 0)
+        continue;
+      b = bb*BPB + bi + __builtin_ctz(x);
+      if(b >= sb.size)
+        break;
+      w[bi/32] |= 1 << (b % 32);   // Mark block in use.
+      bsum.nfree[bb]--;
+      bsum.cursor = b + 1;
+      log_write(bp);
+      brelse(bp);
+      bzero(dev, b);
+      return b;
     }
     brelse(bp);
   }
@@ -90,6 +144,7 @@ bfree(int dev, uint b)
   if((bp->data[bi/8] & m) == 0)
     panic("freeing free block");
   bp->data[bi/8] &= ~m;
+  bsum.nfree[b/BPB]++;
   log_write(bp);
   brelse(bp);
 }
@@ -158,27 +213,74 @@ bfree(int dev, uint b)
 // entries. Since ip->ref indicates whether an entry is free,
 // and ip->dev and ip->inum indicate which i-node an entry
 // holds, one must hold icache.lock while using any of those fields.
+// It also protects the hash chains and the free list.
+//
+// Entries are found through a hash table on (dev, inum). An
+// entry whose ref drops to zero goes on a free list, least
+// recently used first, but stays in its hash chain, so a later
+// iget() of the same inode finds it still valid; iget() only
+// recycles an entry when it takes it off the front of that list.
 //
 // An ip->lock sleep-lock protects all ip-> fields other than ref,
 // dev, and inum.  One must hold ip->lock in order to
 // read or write that inode's ip->valid, ip->size, ip->type, &c.
 
+#define NIHASH 61
+#define IHASH(dev, inum) (((dev)*7 + (inum)) % NIHASH)
+
 struct {
   struct spinlock lock;
   struct inode inode[NINODE];
+  struct inode *hash[NIHASH];  // chains through hnext
+
+  // Entries with ref == 0, through prev/next.
+  // lru.next is least recently used.
+  struct inode lru;
 } icache;
 
+// Append ip to the free list. Caller holds icache.lock.
+static void
+ilruadd(struct inode *ip)
+{
+  ip->next = &icache.lru;
+  ip->prev = icache.lru.prev;
+  icache.lru.prev->next = ip;
+  icache.lru.prev = ip;
+}
+
+// Take ip off the free list. Caller holds icache.lock.
+static void
+ilruremove(struct inode *ip)
+{
+  ip->next->prev = ip->prev;
+  ip->prev->next = ip->next;
+}
+
+static void dcinit(void);
+static void dcpurge(struct inode*);
+
 void
 iinit(int dev)
 {
-  int i = 0;
-  
+  struct inode *ip;
+  int h;
+
   initlock(&icache.lock, "icache");
-  for(i = 0; i < NINODE; i++) {
-    initsleeplock(&icache.inode[i].lock, "inode");
+  icache.lru.prev = &icache.lru;
+  icache.lru.next = &icache.lru;
+  // Every entry starts out free, as inode 0 of device 0.
+  h = IHASH(0, 0);
+  for(ip = icache.inode; ip < &icache.inode[NINODE]; ip++){
+    initsleeplock(&ip->lock, "inode");
+    ilruadd(ip);
+    ip->hnext = icache.hash[h];
+    icache.hash[h] = ip;
   }
 
+  dcinit();
+
   readsb(dev, &sb);
+  bsuminit(dev);
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
  inodestart %d bmap start %d\n", sb.size, sb.nblocks,
           sb.ninodes, sb.nlog, sb.logstart, sb.inodestart,
@@ -241,27 +343,33 @@ iupdate(struct inode *ip)
 static struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct inode *ip, **pp;
+  int h;
 
   acquire(&icache.lock);
 
   // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
-      ip->ref++;
+  h = IHASH(dev, inum);
+  for(ip = icache.hash[h]; ip; ip = ip->hnext){
+    if(ip->dev == dev && ip->inum == inum){
+      if(ip->ref++ == 0)
+        ilruremove(ip);
       release(&icache.lock);
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
   }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
+  // Recycle the least recently used free entry.
+  ip = icache.lru.next;
+  if(ip == &icache.lru)
     panic("iget: no inodes");
+  ilruremove(ip);
+  for(pp = &icache.hash[IHASH(ip->dev, ip->inum)]; *pp != ip; pp = &(*pp)->hnext)
+    ;
+  *pp = ip->hnext;
+  ip->hnext = icache.hash[h];
+  icache.hash[h] = ip;
 
-  ip = empty;
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
@@ -305,6 +413,7 @@ ilock(struct inode *ip)
     ip->size = dip->size;
     memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
     brelse(bp);
+    ip->lastblk = 0;
     ip->valid = 1;
     if(ip->type == 0)
       panic("ilock: no type");
@@ -338,6 +447,8 @@ iput(struct inode *ip)
     release(&icache.lock);
     if(r == 1){
       // inode has no links and no other references: truncate and free.
+      if(ip->type == T_DIR)
+        dcpurge(ip);
       itrunc(ip);
       ip->type = 0;
       iupdate(ip);
@@ -347,7 +458,8 @@ iput(struct inode *ip)
   releasesleep(&ip->lock);
 
   acquire(&icache.lock);
-  ip->ref--;
+  if(--ip->ref == 0)
+    ilruadd(ip);
   release(&icache.lock);
 }
 
@@ -365,19 +477,47 @@ iunlockput(struct inode *ip)
 // The content (data) associated with each inode is stored
 // in blocks on the disk. The first NDIRECT block numbers
 // are listed in ip->addrs[].  The next NINDIRECT blocks are
-// listed in block ip->addrs[NDIRECT].
+// listed in block ip->addrs[NDIRECT]. The NDINDIRECT blocks
+// after those are listed in the indirect blocks that
+// block ip->addrs[NDIRECT+1] lists.
+
+// Allocate a block for ip right after the one last
+// allocated for it if possible, so files stay contiguous.
+static uint
+iballoc(struct inode *ip)
+{
+  ip->lastblk = balloc(ip->dev, ip->lastblk ? ip->lastblk + 1 : 0);
+  return ip->lastblk;
+}
+
+// Return the bn'th block number in the indirect block
+// at addr, allocating a block for it if necessary.
+static uint
+bindirect(struct inode *ip, uint addr, uint bn)
+{
+  uint *a;
+  struct buf *bp;
+
+  bp = bread(ip->dev, addr);
+  a = (uint*)bp->data;
+  if((addr = a[bn]) == 0){
+    a[bn] = addr = iballoc(ip);
+    log_write(bp);
+  }
+  brelse(bp);
+  return addr;
+}
 
 // Return the disk block address of the nth block in inode ip.
 // If there is no such block, bmap allocates one.
 static uint
 bmap(struct inode *ip, uint bn)
 {
-  uint addr, *a;
-  struct buf *bp;
+  uint addr;
 
   if(bn < NDIRECT){
     if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
+      ip->addrs[bn] = addr = iballoc(ip);
     return addr;
   }
   bn -= NDIRECT;
@@ -385,20 +525,44 @@ bmap(struct inode *ip, uint bn)
   if(bn < NINDIRECT){
     // Load indirect block, allocating if necessary.
     if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
-    bp = bread(ip->dev, addr);
-    a = (uint*)bp->data;
-    if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
-      log_write(bp);
-    }
-    brelse(bp);
-    return addr;
+      ip->addrs[NDIRECT] = addr = iballoc(ip);
+    return bindirect(ip, addr, bn);
+  }
+  bn -= NINDIRECT;
+
+  if(bn < NDINDIRECT){
+    if((addr = ip->addrs[NDIRECT+1]) == 0)
+      ip->addrs[NDIRECT+1] = addr = iballoc(ip);
+    addr = bindirect(ip, addr, bn / NINDIRECT);
+    return bindirect(ip, addr, bn % NINDIRECT);
   }
 
   panic("bmap: out of range");
 }
 
+// Free the indirect block at addr and the blocks it lists,
+// which are themselves indirect blocks if depth > 1.
+static void
+bfreeind(struct inode *ip, uint addr, int depth)
+{
+  int j;
+  struct buf *bp;
+  uint *a;
+
+  bp = bread(ip->dev, addr);
+  a = (uint*)bp->data;
+  for(j = 0; j < NINDIRECT; j++){
+    if(a[j] == 0)
+      continue;
+    if(depth > 1)
+      bfreeind(ip, a[j], depth-1);
+    else
+      bfree(ip->dev, a[j]);
+  }
+  brelse(bp);
+  bfree(ip->dev, addr);
+}
+
 // Truncate inode (discard contents).
 // Only called when the inode has no links
 // to it (no directory entries referring to it)
@@ -407,9 +571,7 @@ bmap(struct inode *ip, uint bn)
 static void
 itrunc(struct inode *ip)
 {
-  int i, j;
-  struct buf *bp;
-  uint *a;
+  int i;
 
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
@@ -419,17 +581,15 @@ itrunc(struct inode *ip)
   }
 
   if(ip->addrs[NDIRECT]){
-    bp = bread(ip->dev, ip->addrs[NDIRECT]);
-    a = (uint*)bp->data;
-    for(j = 0; j < NINDIRECT; j++){
-      if(a[j])
-        bfree(ip->dev, a[j]);
-    }
-    brelse(bp);
-    bfree(ip->dev, ip->addrs[NDIRECT]);
+    bfreeind(ip, ip->addrs[NDIRECT], 1);
     ip->addrs[NDIRECT] = 0;
   }
 
+  if(ip->addrs[NDIRECT+1]){
+    bfreeind(ip, ip->addrs[NDIRECT+1], 2);
+    ip->addrs[NDIRECT+1] = 0;
+  }
+
   ip->size = 0;
   iupdate(ip);
 }
@@ -475,7 +635,29 @@ readi(struct inode *ip, char *dst, uint off, uint n)
   return n;
 }
 
+// Start reading the blocks of ip that hold bytes off..off+n
+// into the buffer cache, without waiting for them.
+// Caller must hold ip->lock.
+void
+ireadahead(struct inode *ip, uint off, uint n)
+{
+  uint bn, end;
+
+  if(ip->type == T_DEV || off >= ip->size)
+    return;
+  end = off + n;
+  if(end > ip->size || end < off)
+    end = ip->size;
+  for(bn = off/BSIZE; bn*BSIZE < end; bn++)
+    breadahead(ip->dev, bmap(ip, bn));
+}
+
 // PAGEBREAK!
+// MAXFILE*BSIZE is past 4GB, so writei checks the limit in
+// blocks; the block count itself must fit in a uint.
+_Static_assert((uint64)NDIRECT + NINDIRECT + (uint64)NINDIRECT*NINDIRECT
+               <= 0xffffffff, "MAXFILE does not fit in a uint");
+
 // Write data to inode.
 // Caller must hold ip->lock.
 int
@@ -492,7 +674,7 @@ writei(struct inode *ip, char *src, uint off, uint n)
 
   if(off > ip->size || off + n < off)
     return -1;
-  if(off + n > MAXFILE*BSIZE)
+  if(n > 0 && (off + n - 1) / BSIZE >= MAXFILE)
     return -1;
 
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
@@ -519,31 +701,434 @@ namecmp(const char *s, const char *t)
   return strncmp(s, t, DIRSIZ);
 }
 
+//PAGEBREAK!
+// Name cache.
+//
+// The name cache remembers what dirlookup() found: that name
+// in directory dir is the dirent at byte offset off and refers
+// to inode inum, or, if inum is 0, that dir has no such name.
+// Entries are hashed on (dev, dir, name) and recycled least
+// recently used first.
+//
+// A directory's entries change only while it is locked, so
+// dirlink() and sys_unlink(), which hold that lock, keep the
+// cache up to date, and dirlookup() fills it under the same
+// lock. When a directory inode is freed, everything cached
+// about it is dropped, since its inum may be reused.
+// dcache.lock protects the table; it is never held across I/O.
+
+#define NDHASH 61
+
+struct dentry {
+  uint dev;
+  uint dir;            // directory inode number; 0 if unused
+  char name[DIRSIZ];
+  uint inum;           // 0 if name is not in dir
+  uint off;            // byte offset of the dirent in dir
+  struct dentry *hnext; // hash chain
+  struct dentry *prev;  // LRU list
+  struct dentry *next;
+};
+
+struct {
+  struct spinlock lock;
+  struct dentry dentry[NDENTRY];
+  struct dentry *hash[NDHASH];
+
+  // All entries, unused ones first, then
+  // least recently used first.
+  struct dentry lru;
+} dcache;
+
+static void
+dcinit(void)
+{
+  struct dentry *d;
+
+  initlock(&dcache.lock, "dcache");
+  dcache.lru.prev = &dcache.lru;
+  dcache.lru.next = &dcache.lru;
+  for(d = dcache.dentry; d < &dcache.dentry[NDENTRY]; d++){
+    d->next = &dcache.lru;
+    d->prev = dcache.lru.prev;
+    dcache.lru.prev->next = d;
+    dcache.lru.prev = d;
+  }
+}
+
+static uint
+dhash(uint dev, uint dir, char *name)
+{
+  uint h;
+  int i;
+
+  h = dev*7 + dir;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = h*31 + (uchar)name[i];
+  return h % NDHASH;
+}
+
+// Move d to the most recently used end of the list
+// (or, if front is set, to the least recently used end).
+// Caller holds dcache.lock.
+static void
+dctouch(struct dentry *d, int front)
+{
+  d->next->prev = d->prev;
+  d->prev->next = d->next;
+  if(front){
+    d->prev = &dcache.lru;
+    d->next = dcache.lru.next;
+  } else {
+    d->next = &dcache.lru;
+    d->prev = dcache.lru.prev;
+  }
+  d->prev->next = d;
+  d->next->prev = d;
+}
+
+// Take d out of its hash chain and mark it unused.
+// Caller holds dcache.lock.
+static void
+dcdrop(struct dentry *d)
+{
+  struct dentry **pp;
+
+  for(pp = &dcache.hash[dhash(d->dev, d->dir, d->name)]; *pp != d; pp = &(*pp)->hnext)
+    ;
+  *pp = d->hnext;
+  d->dir = 0;
+  dctouch(d, 1);
+}
+
+// Find the entry for name in dp. Caller holds dcache.lock.
+static struct dentry*
+dcfind(struct inode *dp, char *name)
+{
+  struct dentry *d;
+
+  for(d = dcache.hash[dhash(dp->dev, dp->inum, name)]; d; d = d->hnext)
+    if(d->dev == dp->dev && d->dir == dp->inum && namecmp(d->name, name) == 0)
+      return d;
+  return 0;
+}
+
+// Record that name in dp is the dirent at off referring
+// to inum, or that there is no such name if inum is 0.
+static void
+dcenter(struct inode *dp, char *name, uint inum, uint off)
+{
+  struct dentry *d;
+  uint h;
+
+  acquire(&dcache.lock);
+  if((d = dcfind(dp, name)) == 0){
+    d = dcache.lru.next;
+    if(d->dir != 0)
+      dcdrop(d);
+    d->dev = dp->dev;
+    d->dir = dp->inum;
+    strncpy(d->name, name, DIRSIZ);
+    h = dhash(d->dev, d->dir, d->name);
+    d->hnext = dcache.hash[h];
+    dcache.hash[h] = d;
+  }
+  d->inum = inum;
+  d->off = off;
+  dctouch(d, 0);
+  release(&dcache.lock);
+}
+
+// The dirent for name in dp has moved to off. Fixes up the
+// cached entry, if there is one, without adding one: moving a
+// whole leaf should not flush the rest of the cache.
+static void
+dcmove(struct inode *dp, char *name, uint off)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  if((d = dcfind(dp, name)) != 0)
+    d->off = off;
+  release(&dcache.lock);
+}
+
+// Forget what is cached about name in dp.
+// Caller must hold dp->lock.
+void
+dcinval(struct inode *dp, char *name)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  if((d = dcfind(dp, name)) != 0)
+    dcdrop(d);
+  release(&dcache.lock);
+}
+
+// Forget everything cached about directory dp,
+// which is being freed.
+static void
+dcpurge(struct inode *dp)
+{
+  struct dentry *d;
+
+  acquire(&dcache.lock);
+  for(d = dcache.dentry; d < &dcache.dentry[NDENTRY]; d++)
+    if(d->dir == dp->inum && d->dev == dp->dev)
+      dcdrop(d);
+  release(&dcache.lock);
+}
+
+//PAGEBREAK!
+// Hashed directories.
+//
+// A directory of at most one block is a plain array of dirents.
+// When dirlink() finds that block full, it moves the dirents to
+// block 1 and makes block 0 an index with a single leaf (see
+// struct dxentry in fs.h). A lookup then reads the index and
+// one leaf; an insert into a full leaf splits it at the median
+// hash into itself and a new last block. Removing a name just
+// clears its slot, so directories never shrink back.
+
+// FNV-1a; mkfs.c has a copy.
+static uint
+dirhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 2166136261U;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = (h ^ (uchar)name[i]) * 16777619;
+  return h;
+}
+
+// Return the position in the index dx, which has n entries,
+// of the leaf for hash h: the last entry whose hash is <= h.
+static int
+dxfind(struct dxentry *dx, int n, uint h)
+{
+  int lo, hi, mid;
+
+  lo = 0;
+  hi = n - 1;
+  while(lo < hi){
+    mid = (lo + hi + 1) / 2;
+    if(dx[mid].hash <= h)
+      lo = mid;
+    else
+      hi = mid - 1;
+  }
+  return lo;
+}
+
+// Return the directory block that would hold name:
+// block 0 unless dp is hashed.
+static uint
+dirblock(struct inode *dp, char *name)
+{
+  struct buf *bp;
+  struct dxentry *dx;
+  uint bn;
+
+  if(dp->size <= BSIZE)
+    return 0;
+  bp = bread(dp->dev, bmap(dp, 0));
+  dx = (struct dxentry*)bp->data;
+  bn = dx[dxfind(dx, dp->size/BSIZE - 1, dirhash(name))].blk;
+  brelse(bp);
+  return bn;
+}
+
 // Look for a directory entry in a directory.
 // If found, set *poff to byte offset of entry.
+// Caller must hold dp->lock.
 struct inode*
 dirlookup(struct inode *dp, char *name, uint *poff)
 {
-  uint off, inum;
-  struct dirent de;
+  uint off, inum, bn, i;
+  struct buf *bp;
+  struct dirent *de;
+  struct dentry *d;
 
   if(dp->type != T_DIR)
     panic("dirlookup not DIR");
 
-  for(off = 0; off < dp->size; off += sizeof(de)){
-    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
-      panic("dirlookup read");
-    if(de.inum == 0)
+  acquire(&dcache.lock);
+  if((d = dcfind(dp, name)) != 0){
+    dctouch(d, 0);
+    inum = d->inum;
+    off = d->off;
+    release(&dcache.lock);
+    if(inum == 0)
+      return 0;
+    if(poff)
+      *poff = off;
+    return iget(dp->dev, inum);
+  }
+  release(&dcache.lock);
+
+  if(dp->size > 0){
+    bn = dirblock(dp, name);
+    bp = bread(dp->dev, bmap(dp, bn));
+    de = (struct dirent*)bp->data;
+    for(i = 0; i < DPB && bn*BSIZE + i*sizeof(*de) < dp->size; i++){
+      if(de[i].inum == 0)
+        continue;
+      if(namecmp(name, de[i].name) == 0){
+        // entry matches path element
+        off = bn*BSIZE + i*sizeof(*de);
+        inum = de[i].inum;
+        brelse(bp);
+        if(poff)
+          *poff = off;
+        dcenter(dp, name, inum, off);
+        return iget(dp->dev, inum);
+      }
+    }
+    brelse(bp);
+  }
+
+  dcenter(dp, name, 0, 0);
+  return 0;
+}
+
+// Return the index of a free slot in the leaf de, or -1.
+static int
+dirfree(struct dirent *de)
+{
+  int i;
+
+  for(i = 0; i < DPB; i++)
+    if(de[i].inum == 0)
+      return i;
+  return -1;
+}
+
+// Choose the hash at which to split the full leaf de so that
+// it and a new entry hashing to h divide about evenly.
+// Return 0 if all of them have the same hash.
+static uint
+dxmedian(struct dirent *de, uint h)
+{
+  uint x, best;
+  int i, j, below, d, bestd;
+
+  best = 0;
+  bestd = DPB + 1;
+  for(i = 0; i <= DPB; i++){
+    x = i < DPB ? dirhash(de[i].name) : h;
+    below = h < x;
+    for(j = 0; j < DPB; j++)
+      if(dirhash(de[j].name) < x)
+        below++;
+    if(below == 0)
       continue;
-    if(namecmp(name, de.name) == 0){
-      // entry matches path element
-      if(poff)
-        *poff = off;
-      inum = de.inum;
-      return iget(dp->dev, inum);
+    d = below - (DPB+1)/2;
+    if(d < 0)
+      d = -d;
+    if(d < bestd){
+      best = x;
+      bestd = d;
     }
   }
+  return best;
+}
+
+// Turn the full one-block directory dp into a hashed
+// one whose only leaf is block 1.
+static void
+dxconvert(struct inode *dp)
+{
+  struct buf *bp, *lp;
+  struct dirent *de;
+  struct dxentry *dx;
+  int i;
+
+  lp = bread(dp->dev, bmap(dp, 1));
+  bp = bread(dp->dev, bmap(dp, 0));
+  memmove(lp->data, bp->data, BSIZE);
+  memset(bp->data, 0, BSIZE);
+  dx = (struct dxentry*)bp->data;
+  dx[0].blk = 1;
+  dx[0].hash = 0;
+  log_write(lp);
+  log_write(bp);
+  brelse(bp);
+  dp->size = 2*BSIZE;
+  iupdate(dp);
+
+  de = (struct dirent*)lp->data;
+  for(i = 0; i < DPB; i++)
+    if(de[i].inum != 0)
+      dcmove(dp, de[i].name, BSIZE + i*sizeof(*de));
+  brelse(lp);
+}
 
+// Add (name, inum) to the hashed directory dp, splitting
+// its leaf if that is full. Return -1 if the leaf cannot
+// be split.
+static int
+dxlink(struct inode *dp, char *name, uint inum)
+{
+  struct buf *bp, *lp, *np;
+  struct dxentry *dx;
+  struct dirent *de, *nde;
+  uint h, m, bn, nb;
+  int i, j, k, n;
+
+  h = dirhash(name);
+  bp = bread(dp->dev, bmap(dp, 0));
+  dx = (struct dxentry*)bp->data;
+  n = dp->size/BSIZE - 1;
+  k = dxfind(dx, n, h);
+  bn = dx[k].blk;
+  lp = bread(dp->dev, bmap(dp, bn));
+  de = (struct dirent*)lp->data;
+
+  if((i = dirfree(de)) < 0){
+    if(n == NDXENTRY || (m = dxmedian(de, h)) == 0){
+      brelse(lp);
+      brelse(bp);
+      return -1;
+    }
+    // Move the names hashing to m or above to a new leaf.
+    nb = n + 1;
+    np = bread(dp->dev, bmap(dp, nb));
+    nde = (struct dirent*)np->data;
+    for(i = j = 0; i < DPB; i++){
+      if(dirhash(de[i].name) < m)
+        continue;
+      nde[j] = de[i];
+      memset(&de[i], 0, sizeof(de[i]));
+      dcmove(dp, nde[j].name, nb*BSIZE + j*sizeof(*de));
+      j++;
+    }
+    memmove(&dx[k+2], &dx[k+1], (n-k-1)*sizeof(*dx));
+    dx[k+1].blk = nb;
+    dx[k+1].hash = m;
+    log_write(bp);
+    log_write(lp);
+    log_write(np);
+    dp->size += BSIZE;
+    iupdate(dp);
+    if(h >= m){
+      brelse(lp);
+      lp = np;
+      bn = nb;
+      de = nde;
+    } else
+      brelse(np);
+    i = dirfree(de);
+  }
+  brelse(bp);
+
+  strncpy(de[i].name, name, DIRSIZ);
+  de[i].inum = inum;
+  log_write(lp);
+  brelse(lp);
+  dcenter(dp, name, inum, bn*BSIZE + i*sizeof(*de));
   return 0;
 }
 
@@ -561,6 +1146,9 @@ dirlink(struct inode *dp, char *name, uint inum)
     return -1;
   }
 
+  if(dp->size > BSIZE)
+    return dxlink(dp, name, inum);
+
   // Look for an empty dirent.
   for(off = 0; off < dp->size; off += sizeof(de)){
     if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
@@ -568,11 +1156,16 @@ dirlink(struct inode *dp, char *name, uint inum)
     if(de.inum == 0)
       break;
   }
+  if(off == BSIZE){
+    dxconvert(dp);
+    return dxlink(dp, name, inum);
+  }
 
   strncpy(de.name, name, DIRSIZ);
   de.inum = inum;
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("dirlink");
+  dcenter(dp, name, inum, off);
 
   return 0;
 }
@@ -3,7 +3,7 @@
 
 
 #define ROOTINO 1  // root i-number
-#define BSIZE 512  // block size
+#define BSIZE 4096  // block size; a divisor of PGSIZE
 
 // Disk layout:
 // [ boot block | super block | log | inode blocks |
@@ -21,9 +21,10 @@ struct superblock {
   uint bmapstart;    // Block number of first free map block
 };
 
-#define NDIRECT 12
+#define NDIRECT 11
 #define NINDIRECT (BSIZE / sizeof(uint))
-#define MAXFILE (NDIRECT + NINDIRECT)
+#define NDINDIRECT (NINDIRECT * NINDIRECT)
+#define MAXFILE (NDIRECT + NINDIRECT + NDINDIRECT)
 
 // On-disk inode structure
 struct dinode {
@@ -32,7 +33,7 @@ struct dinode {
   short minor;          // Minor device number (T_DEV only)
   short nlink;          // Number of links to inode in file system
   uint size;            // Size of file (bytes)
-  uint addrs[NDIRECT+1];   // Data block addresses
+  uint addrs[NDIRECT+2];   // Data block addresses
 };
 
 // Inodes per block.
@@ -55,3 +56,20 @@ struct dirent {
   char name[DIRSIZ];
 };
 
+// Dirents per block.
+#define DPB           (BSIZE / sizeof(struct dirent))
+
+// A directory that outgrows one block is hashed: block 0 holds
+// one dxentry per leaf block, sorted by hash, and a leaf holds
+// the dirents whose dirhash() is at least its entry's hash and
+// below the next one's. Every other dxentry starts a dirent
+// slot, and zero is 0, so the index reads as free slots.
+struct dxentry {
+  ushort zero;
+  ushort blk;           // leaf block number within the directory
+  uint hash;            // lowest hash the leaf holds
+};
+
+// Leaves per hashed directory.
+#define NDXENTRY      (BSIZE / sizeof(struct dxentry))
+
@@ -0,0 +1,1965 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 01                	mov    (%ecx),%eax
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+  1c:	83 f8 01             	cmp    $0x1,%eax
+  1f:	7e 6f                	jle    90 <main+0x90>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit();
+  }
+  pattern = argv[1];
+  21:	8b 43 04             	mov    0x4(%ebx),%eax
+  24:	83 c3 08             	add    $0x8,%ebx
+
+  if(argc <= 2){
+  27:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+    grep(pattern, 0);
+    exit();
+  }
+
+  for(i = 2; i < argc; i++){
+  2b:	be 02 00 00 00       	mov    $0x2,%esi
+  pattern = argv[1];
+  30:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+  33:	75 2d                	jne    62 <main+0x62>
+  35:	eb 6c                	jmp    a3 <main+0xa3>
+  37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3e:	66 90                	xchg   %ax,%ax
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit();
+    }
+    grep(pattern, fd);
+  40:	83 ec 08             	sub    $0x8,%esp
+  for(i = 2; i < argc; i++){
+  43:	83 c6 01             	add    $0x1,%esi
+  46:	83 c3 04             	add    $0x4,%ebx
+    grep(pattern, fd);
+  49:	50                   	push   %eax
+  4a:	ff 75 e0             	push   -0x20(%ebp)
+  4d:	e8 9e 01 00 00       	call   1f0 <grep>
+    close(fd);
+  52:	89 3c 24             	mov    %edi,(%esp)
+  55:	e8 b1 05 00 00       	call   60b <close>
+  for(i = 2; i < argc; i++){
+  5a:	83 c4 10             	add    $0x10,%esp
+  5d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  60:	7e 29                	jle    8b <main+0x8b>
+    if((fd = open(argv[i], 0)) < 0){
+  62:	83 ec 08             	sub    $0x8,%esp
+  65:	6a 00                	push   $0x0
+  67:	ff 33                	push   (%ebx)
+  69:	e8 b5 05 00 00       	call   623 <open>
+  6e:	83 c4 10             	add    $0x10,%esp
+  71:	89 c7                	mov    %eax,%edi
+  73:	85 c0                	test   %eax,%eax
+  75:	79 c9                	jns    40 <main+0x40>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+  77:	50                   	push   %eax
+  78:	ff 33                	push   (%ebx)
+  7a:	68 e0 0d 00 00       	push   $0xde0
+  7f:	6a 01                	push   $0x1
+  81:	e8 da 06 00 00       	call   760 <printf>
+      exit();
+  86:	e8 58 05 00 00       	call   5e3 <exit>
+  }
+  exit();
+  8b:	e8 53 05 00 00       	call   5e3 <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+  90:	51                   	push   %ecx
+  91:	51                   	push   %ecx
+  92:	68 c0 0d 00 00       	push   $0xdc0
+  97:	6a 02                	push   $0x2
+  99:	e8 c2 06 00 00       	call   760 <printf>
+    exit();
+  9e:	e8 40 05 00 00       	call   5e3 <exit>
+    grep(pattern, 0);
+  a3:	52                   	push   %edx
+  a4:	52                   	push   %edx
+  a5:	6a 00                	push   $0x0
+  a7:	50                   	push   %eax
+  a8:	e8 43 01 00 00       	call   1f0 <grep>
+    exit();
+  ad:	e8 31 05 00 00       	call   5e3 <exit>
+  b2:	66 90                	xchg   %ax,%ax
+  b4:	66 90                	xchg   %ax,%ax
+  b6:	66 90                	xchg   %ax,%ax
+  b8:	66 90                	xchg   %ax,%ax
+  ba:	66 90                	xchg   %ax,%ax
+  bc:	66 90                	xchg   %ax,%ax
+  be:	66 90                	xchg   %ax,%ax
+
+000000c0 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	57                   	push   %edi
+  c4:	56                   	push   %esi
+  c5:	53                   	push   %ebx
+  c6:	83 ec 0c             	sub    $0xc,%esp
+  c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+  cf:	0f b6 0f             	movzbl (%edi),%ecx
+  d2:	84 c9                	test   %cl,%cl
+  d4:	0f 84 96 00 00 00    	je     170 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+  da:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+  de:	3c 2a                	cmp    $0x2a,%al
+  e0:	74 2d                	je     10f <matchhere+0x4f>
+  e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+  e8:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+  eb:	80 f9 24             	cmp    $0x24,%cl
+  ee:	74 50                	je     140 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+  f0:	89 f2                	mov    %esi,%edx
+  f2:	84 d2                	test   %dl,%dl
+  f4:	74 6e                	je     164 <matchhere+0xa4>
+  f6:	80 f9 2e             	cmp    $0x2e,%cl
+  f9:	75 65                	jne    160 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+  fb:	83 c3 01             	add    $0x1,%ebx
+  fe:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 101:	84 c0                	test   %al,%al
+ 103:	74 6b                	je     170 <matchhere+0xb0>
+ 105:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+ 107:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+ 10b:	3c 2a                	cmp    $0x2a,%al
+ 10d:	75 d9                	jne    e8 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+ 10f:	8d 77 02             	lea    0x2(%edi),%esi
+ 112:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+ 115:	8d 76 00             	lea    0x0(%esi),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+ 118:	83 ec 08             	sub    $0x8,%esp
+ 11b:	53                   	push   %ebx
+ 11c:	56                   	push   %esi
+ 11d:	e8 9e ff ff ff       	call   c0 <matchhere>
+ 122:	83 c4 10             	add    $0x10,%esp
+ 125:	85 c0                	test   %eax,%eax
+ 127:	75 47                	jne    170 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 129:	0f be 13             	movsbl (%ebx),%edx
+ 12c:	84 d2                	test   %dl,%dl
+ 12e:	74 45                	je     175 <matchhere+0xb5>
+ 130:	83 c3 01             	add    $0x1,%ebx
+ 133:	39 fa                	cmp    %edi,%edx
+ 135:	74 e1                	je     118 <matchhere+0x58>
+ 137:	83 ff 2e             	cmp    $0x2e,%edi
+ 13a:	74 dc                	je     118 <matchhere+0x58>
+ 13c:	eb 37                	jmp    175 <matchhere+0xb5>
+ 13e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+ 140:	84 c0                	test   %al,%al
+ 142:	74 39                	je     17d <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 144:	89 f2                	mov    %esi,%edx
+ 146:	84 d2                	test   %dl,%dl
+ 148:	74 1a                	je     164 <matchhere+0xa4>
+ 14a:	80 fa 24             	cmp    $0x24,%dl
+ 14d:	75 15                	jne    164 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+ 14f:	83 c3 01             	add    $0x1,%ebx
+ 152:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 155:	89 c1                	mov    %eax,%ecx
+ 157:	eb ae                	jmp    107 <matchhere+0x47>
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 160:	38 ca                	cmp    %cl,%dl
+ 162:	74 97                	je     fb <matchhere+0x3b>
+}
+ 164:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+ 167:	31 c0                	xor    %eax,%eax
+}
+ 169:	5b                   	pop    %ebx
+ 16a:	5e                   	pop    %esi
+ 16b:	5f                   	pop    %edi
+ 16c:	5d                   	pop    %ebp
+ 16d:	c3                   	ret
+ 16e:	66 90                	xchg   %ax,%ax
+    return 1;
+ 170:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 178:	5b                   	pop    %ebx
+ 179:	5e                   	pop    %esi
+ 17a:	5f                   	pop    %edi
+ 17b:	5d                   	pop    %ebp
+ 17c:	c3                   	ret
+    return *text == '\0';
+ 17d:	89 f0                	mov    %esi,%eax
+ 17f:	84 c0                	test   %al,%al
+ 181:	0f 94 c0             	sete   %al
+ 184:	0f b6 c0             	movzbl %al,%eax
+ 187:	eb ec                	jmp    175 <matchhere+0xb5>
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <match>:
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	56                   	push   %esi
+ 194:	53                   	push   %ebx
+ 195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 198:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+ 19b:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+ 19e:	75 11                	jne    1b1 <match+0x21>
+ 1a0:	eb 2e                	jmp    1d0 <match+0x40>
+ 1a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+ 1a8:	83 c6 01             	add    $0x1,%esi
+ 1ab:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+ 1af:	74 16                	je     1c7 <match+0x37>
+    if(matchhere(re, text))
+ 1b1:	83 ec 08             	sub    $0x8,%esp
+ 1b4:	56                   	push   %esi
+ 1b5:	53                   	push   %ebx
+ 1b6:	e8 05 ff ff ff       	call   c0 <matchhere>
+ 1bb:	83 c4 10             	add    $0x10,%esp
+ 1be:	85 c0                	test   %eax,%eax
+ 1c0:	74 e6                	je     1a8 <match+0x18>
+      return 1;
+ 1c2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 1c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1ca:	5b                   	pop    %ebx
+ 1cb:	5e                   	pop    %esi
+ 1cc:	5d                   	pop    %ebp
+ 1cd:	c3                   	ret
+ 1ce:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+ 1d0:	83 c3 01             	add    $0x1,%ebx
+ 1d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 1d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1d9:	5b                   	pop    %ebx
+ 1da:	5e                   	pop    %esi
+ 1db:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+ 1dc:	e9 df fe ff ff       	jmp    c0 <matchhere>
+ 1e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+
+000001f0 <grep>:
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+  m = 0;
+ 1f4:	31 ff                	xor    %edi,%edi
+{
+ 1f6:	56                   	push   %esi
+ 1f7:	53                   	push   %ebx
+ 1f8:	83 ec 1c             	sub    $0x1c,%esp
+ 1fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 1fe:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    return matchhere(re+1, text);
+ 201:	8d 43 01             	lea    0x1(%ebx),%eax
+ 204:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 210:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 213:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+ 218:	83 ec 04             	sub    $0x4,%esp
+ 21b:	29 c8                	sub    %ecx,%eax
+ 21d:	50                   	push   %eax
+ 21e:	8d 81 c0 12 00 00    	lea    0x12c0(%ecx),%eax
+ 224:	50                   	push   %eax
+ 225:	ff 75 0c             	push   0xc(%ebp)
+ 228:	e8 ce 03 00 00       	call   5fb <read>
+ 22d:	83 c4 10             	add    $0x10,%esp
+ 230:	85 c0                	test   %eax,%eax
+ 232:	0f 8e fd 00 00 00    	jle    335 <grep+0x145>
+    m += n;
+ 238:	01 45 e0             	add    %eax,-0x20(%ebp)
+ 23b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    buf[m] = '\0';
+ 23e:	bf c0 12 00 00       	mov    $0x12c0,%edi
+ 243:	89 de                	mov    %ebx,%esi
+ 245:	c6 81 c0 12 00 00 00 	movb   $0x0,0x12c0(%ecx)
+    while((q = strchr(p, '\n')) != 0){
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 250:	83 ec 08             	sub    $0x8,%esp
+ 253:	6a 0a                	push   $0xa
+ 255:	57                   	push   %edi
+ 256:	e8 25 02 00 00       	call   480 <strchr>
+ 25b:	83 c4 10             	add    $0x10,%esp
+ 25e:	89 c2                	mov    %eax,%edx
+ 260:	85 c0                	test   %eax,%eax
+ 262:	0f 84 88 00 00 00    	je     2f0 <grep+0x100>
+      *q = 0;
+ 268:	c6 02 00             	movb   $0x0,(%edx)
+  if(re[0] == '^')
+ 26b:	80 3e 5e             	cmpb   $0x5e,(%esi)
+ 26e:	74 58                	je     2c8 <grep+0xd8>
+ 270:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 273:	89 d3                	mov    %edx,%ebx
+ 275:	eb 12                	jmp    289 <grep+0x99>
+ 277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27e:	66 90                	xchg   %ax,%ax
+  }while(*text++ != '\0');
+ 280:	83 c7 01             	add    $0x1,%edi
+ 283:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+ 287:	74 37                	je     2c0 <grep+0xd0>
+    if(matchhere(re, text))
+ 289:	83 ec 08             	sub    $0x8,%esp
+ 28c:	57                   	push   %edi
+ 28d:	56                   	push   %esi
+ 28e:	e8 2d fe ff ff       	call   c0 <matchhere>
+ 293:	83 c4 10             	add    $0x10,%esp
+ 296:	85 c0                	test   %eax,%eax
+ 298:	74 e6                	je     280 <grep+0x90>
+        write(1, p, q+1 - p);
+ 29a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 29d:	89 da                	mov    %ebx,%edx
+ 29f:	8d 5b 01             	lea    0x1(%ebx),%ebx
+ 2a2:	89 d8                	mov    %ebx,%eax
+ 2a4:	83 ec 04             	sub    $0x4,%esp
+        *q = '\n';
+ 2a7:	c6 02 0a             	movb   $0xa,(%edx)
+        write(1, p, q+1 - p);
+ 2aa:	29 f8                	sub    %edi,%eax
+ 2ac:	50                   	push   %eax
+ 2ad:	57                   	push   %edi
+ 2ae:	89 df                	mov    %ebx,%edi
+ 2b0:	6a 01                	push   $0x1
+ 2b2:	e8 4c 03 00 00       	call   603 <write>
+ 2b7:	83 c4 10             	add    $0x10,%esp
+ 2ba:	eb 94                	jmp    250 <grep+0x60>
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c0:	8d 7b 01             	lea    0x1(%ebx),%edi
+      p = q+1;
+ 2c3:	eb 8b                	jmp    250 <grep+0x60>
+ 2c5:	8d 76 00             	lea    0x0(%esi),%esi
+    return matchhere(re+1, text);
+ 2c8:	83 ec 08             	sub    $0x8,%esp
+ 2cb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 2ce:	57                   	push   %edi
+ 2cf:	ff 75 dc             	push   -0x24(%ebp)
+ 2d2:	e8 e9 fd ff ff       	call   c0 <matchhere>
+        write(1, p, q+1 - p);
+ 2d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    return matchhere(re+1, text);
+ 2da:	83 c4 10             	add    $0x10,%esp
+        write(1, p, q+1 - p);
+ 2dd:	8d 5a 01             	lea    0x1(%edx),%ebx
+      if(match(pattern, p)){
+ 2e0:	85 c0                	test   %eax,%eax
+ 2e2:	75 be                	jne    2a2 <grep+0xb2>
+        write(1, p, q+1 - p);
+ 2e4:	89 df                	mov    %ebx,%edi
+ 2e6:	e9 65 ff ff ff       	jmp    250 <grep+0x60>
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+    if(p == buf)
+ 2f0:	89 f3                	mov    %esi,%ebx
+ 2f2:	81 ff c0 12 00 00    	cmp    $0x12c0,%edi
+ 2f8:	74 2f                	je     329 <grep+0x139>
+    if(m > 0){
+ 2fa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 2fd:	85 c0                	test   %eax,%eax
+ 2ff:	0f 8e 0b ff ff ff    	jle    210 <grep+0x20>
+      m -= p - buf;
+ 305:	89 f8                	mov    %edi,%eax
+      memmove(buf, p, m);
+ 307:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+ 30a:	2d c0 12 00 00       	sub    $0x12c0,%eax
+ 30f:	29 45 e0             	sub    %eax,-0x20(%ebp)
+ 312:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      memmove(buf, p, m);
+ 315:	51                   	push   %ecx
+ 316:	57                   	push   %edi
+ 317:	68 c0 12 00 00       	push   $0x12c0
+ 31c:	e8 8f 02 00 00       	call   5b0 <memmove>
+ 321:	83 c4 10             	add    $0x10,%esp
+ 324:	e9 e7 fe ff ff       	jmp    210 <grep+0x20>
+      m = 0;
+ 329:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 330:	e9 db fe ff ff       	jmp    210 <grep+0x20>
+}
+ 335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 338:	5b                   	pop    %ebx
+ 339:	5e                   	pop    %esi
+ 33a:	5f                   	pop    %edi
+ 33b:	5d                   	pop    %ebp
+ 33c:	c3                   	ret
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <matchstar>:
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+ 345:	53                   	push   %ebx
+ 346:	83 ec 0c             	sub    $0xc,%esp
+ 349:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 34c:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 34f:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 352:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+ 358:	83 ec 08             	sub    $0x8,%esp
+ 35b:	57                   	push   %edi
+ 35c:	56                   	push   %esi
+ 35d:	e8 5e fd ff ff       	call   c0 <matchhere>
+ 362:	83 c4 10             	add    $0x10,%esp
+ 365:	85 c0                	test   %eax,%eax
+ 367:	75 1f                	jne    388 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 369:	0f be 17             	movsbl (%edi),%edx
+ 36c:	84 d2                	test   %dl,%dl
+ 36e:	74 0c                	je     37c <matchstar+0x3c>
+ 370:	83 c7 01             	add    $0x1,%edi
+ 373:	39 da                	cmp    %ebx,%edx
+ 375:	74 e1                	je     358 <matchstar+0x18>
+ 377:	83 fb 2e             	cmp    $0x2e,%ebx
+ 37a:	74 dc                	je     358 <matchstar+0x18>
+}
+ 37c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 37f:	5b                   	pop    %ebx
+ 380:	5e                   	pop    %esi
+ 381:	5f                   	pop    %edi
+ 382:	5d                   	pop    %ebp
+ 383:	c3                   	ret
+ 384:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+ 38b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 390:	5b                   	pop    %ebx
+ 391:	5e                   	pop    %esi
+ 392:	5f                   	pop    %edi
+ 393:	5d                   	pop    %ebp
+ 394:	c3                   	ret
+ 395:	66 90                	xchg   %ax,%ax
+ 397:	66 90                	xchg   %ax,%ax
+ 399:	66 90                	xchg   %ax,%ax
+ 39b:	66 90                	xchg   %ax,%ax
+ 39d:	66 90                	xchg   %ax,%ax
+ 39f:	90                   	nop
+
+000003a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 3a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3a1:	31 c0                	xor    %eax,%eax
+{
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	53                   	push   %ebx
+ 3a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3b7:	83 c0 01             	add    $0x1,%eax
+ 3ba:	84 d2                	test   %dl,%dl
+ 3bc:	75 f2                	jne    3b0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 3be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c1:	89 c8                	mov    %ecx,%eax
+ 3c3:	c9                   	leave
+ 3c4:	c3                   	ret
+ 3c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	53                   	push   %ebx
+ 3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3da:	0f b6 02             	movzbl (%edx),%eax
+ 3dd:	84 c0                	test   %al,%al
+ 3df:	75 17                	jne    3f8 <strcmp+0x28>
+ 3e1:	eb 3a                	jmp    41d <strcmp+0x4d>
+ 3e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3e7:	90                   	nop
+ 3e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3ec:	83 c2 01             	add    $0x1,%edx
+ 3ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3f2:	84 c0                	test   %al,%al
+ 3f4:	74 1a                	je     410 <strcmp+0x40>
+    p++, q++;
+ 3f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3f8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3fb:	38 c3                	cmp    %al,%bl
+ 3fd:	74 e9                	je     3e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3ff:	29 d8                	sub    %ebx,%eax
+}
+ 401:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 404:	c9                   	leave
+ 405:	c3                   	ret
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 410:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 414:	31 c0                	xor    %eax,%eax
+ 416:	29 d8                	sub    %ebx,%eax
+}
+ 418:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 41b:	c9                   	leave
+ 41c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 41d:	0f b6 19             	movzbl (%ecx),%ebx
+ 420:	31 c0                	xor    %eax,%eax
+ 422:	eb db                	jmp    3ff <strcmp+0x2f>
+ 424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 436:	80 3a 00             	cmpb   $0x0,(%edx)
+ 439:	74 15                	je     450 <strlen+0x20>
+ 43b:	31 c0                	xor    %eax,%eax
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+ 440:	83 c0 01             	add    $0x1,%eax
+ 443:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 447:	89 c1                	mov    %eax,%ecx
+ 449:	75 f5                	jne    440 <strlen+0x10>
+    ;
+  return n;
+}
+ 44b:	89 c8                	mov    %ecx,%eax
+ 44d:	5d                   	pop    %ebp
+ 44e:	c3                   	ret
+ 44f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 450:	31 c9                	xor    %ecx,%ecx
+}
+ 452:	5d                   	pop    %ebp
+ 453:	89 c8                	mov    %ecx,%eax
+ 455:	c3                   	ret
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000460 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 467:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 46a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 46d:	89 d7                	mov    %edx,%edi
+ 46f:	fc                   	cld
+ 470:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 472:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 475:	89 d0                	mov    %edx,%eax
+ 477:	c9                   	leave
+ 478:	c3                   	ret
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	8b 45 08             	mov    0x8(%ebp),%eax
+ 486:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 48a:	0f b6 10             	movzbl (%eax),%edx
+ 48d:	84 d2                	test   %dl,%dl
+ 48f:	75 12                	jne    4a3 <strchr+0x23>
+ 491:	eb 1d                	jmp    4b0 <strchr+0x30>
+ 493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 497:	90                   	nop
+ 498:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 49c:	83 c0 01             	add    $0x1,%eax
+ 49f:	84 d2                	test   %dl,%dl
+ 4a1:	74 0d                	je     4b0 <strchr+0x30>
+    if(*s == c)
+ 4a3:	38 d1                	cmp    %dl,%cl
+ 4a5:	75 f1                	jne    498 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 4a7:	5d                   	pop    %ebp
+ 4a8:	c3                   	ret
+ 4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4b0:	31 c0                	xor    %eax,%eax
+}
+ 4b2:	5d                   	pop    %ebp
+ 4b3:	c3                   	ret
+ 4b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4bf:	90                   	nop
+
+000004c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 4c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 4c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 4c9:	31 db                	xor    %ebx,%ebx
+{
+ 4cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 4ce:	eb 27                	jmp    4f7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 4d0:	83 ec 04             	sub    $0x4,%esp
+ 4d3:	6a 01                	push   $0x1
+ 4d5:	56                   	push   %esi
+ 4d6:	6a 00                	push   $0x0
+ 4d8:	e8 1e 01 00 00       	call   5fb <read>
+    if(cc < 1)
+ 4dd:	83 c4 10             	add    $0x10,%esp
+ 4e0:	85 c0                	test   %eax,%eax
+ 4e2:	7e 1d                	jle    501 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 4e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 4ef:	3c 0a                	cmp    $0xa,%al
+ 4f1:	74 10                	je     503 <gets+0x43>
+ 4f3:	3c 0d                	cmp    $0xd,%al
+ 4f5:	74 0c                	je     503 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 4f7:	89 df                	mov    %ebx,%edi
+ 4f9:	83 c3 01             	add    $0x1,%ebx
+ 4fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 4ff:	7c cf                	jl     4d0 <gets+0x10>
+ 501:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 503:	8b 45 08             	mov    0x8(%ebp),%eax
+ 506:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 50a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 50d:	5b                   	pop    %ebx
+ 50e:	5e                   	pop    %esi
+ 50f:	5f                   	pop    %edi
+ 510:	5d                   	pop    %ebp
+ 511:	c3                   	ret
+ 512:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	56                   	push   %esi
+ 524:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 525:	83 ec 08             	sub    $0x8,%esp
+ 528:	6a 00                	push   $0x0
+ 52a:	ff 75 08             	push   0x8(%ebp)
+ 52d:	e8 f1 00 00 00       	call   623 <open>
+  if(fd < 0)
+ 532:	83 c4 10             	add    $0x10,%esp
+ 535:	85 c0                	test   %eax,%eax
+ 537:	78 27                	js     560 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 539:	83 ec 08             	sub    $0x8,%esp
+ 53c:	ff 75 0c             	push   0xc(%ebp)
+ 53f:	89 c3                	mov    %eax,%ebx
+ 541:	50                   	push   %eax
+ 542:	e8 f4 00 00 00       	call   63b <fstat>
+  close(fd);
+ 547:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 54a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 54c:	e8 ba 00 00 00       	call   60b <close>
+  return r;
+ 551:	83 c4 10             	add    $0x10,%esp
+}
+ 554:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 557:	89 f0                	mov    %esi,%eax
+ 559:	5b                   	pop    %ebx
+ 55a:	5e                   	pop    %esi
+ 55b:	5d                   	pop    %ebp
+ 55c:	c3                   	ret
+ 55d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 560:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 565:	eb ed                	jmp    554 <stat+0x34>
+ 567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56e:	66 90                	xchg   %ax,%ax
+
+00000570 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	53                   	push   %ebx
+ 574:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 577:	0f be 02             	movsbl (%edx),%eax
+ 57a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 57d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 580:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 585:	77 1e                	ja     5a5 <atoi+0x35>
+ 587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 590:	83 c2 01             	add    $0x1,%edx
+ 593:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 596:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 59a:	0f be 02             	movsbl (%edx),%eax
+ 59d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5a0:	80 fb 09             	cmp    $0x9,%bl
+ 5a3:	76 eb                	jbe    590 <atoi+0x20>
+  return n;
+}
+ 5a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5a8:	89 c8                	mov    %ecx,%eax
+ 5aa:	c9                   	leave
+ 5ab:	c3                   	ret
+ 5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 5be:	85 c0                	test   %eax,%eax
+ 5c0:	7e 13                	jle    5d5 <memmove+0x25>
+ 5c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 5c4:	89 d7                	mov    %edx,%edi
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5d1:	39 f8                	cmp    %edi,%eax
+ 5d3:	75 fb                	jne    5d0 <memmove+0x20>
+  return vdst;
+}
+ 5d5:	5e                   	pop    %esi
+ 5d6:	89 d0                	mov    %edx,%eax
+ 5d8:	5f                   	pop    %edi
+ 5d9:	5d                   	pop    %ebp
+ 5da:	c3                   	ret
+
+000005db <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5db:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5e0:	cd 40                	int    $0x40
+ 5e2:	c3                   	ret
+
+000005e3 <exit>:
+SYSCALL(exit)
+ 5e3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5e8:	cd 40                	int    $0x40
+ 5ea:	c3                   	ret
+
+000005eb <wait>:
+SYSCALL(wait)
+ 5eb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5f0:	cd 40                	int    $0x40
+ 5f2:	c3                   	ret
+
+000005f3 <pipe>:
+SYSCALL(pipe)
+ 5f3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5f8:	cd 40                	int    $0x40
+ 5fa:	c3                   	ret
+
+000005fb <read>:
+SYSCALL(read)
+ 5fb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 600:	cd 40                	int    $0x40
+ 602:	c3                   	ret
+
+00000603 <write>:
+SYSCALL(write)
+ 603:	b8 10 00 00 00       	mov    $0x10,%eax
+ 608:	cd 40                	int    $0x40
+ 60a:	c3                   	ret
+
+0000060b <close>:
+SYSCALL(close)
+ 60b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 610:	cd 40                	int    $0x40
+ 612:	c3                   	ret
+
+00000613 <kill>:
+SYSCALL(kill)
+ 613:	b8 06 00 00 00       	mov    $0x6,%eax
+ 618:	cd 40                	int    $0x40
+ 61a:	c3                   	ret
+
+0000061b <exec>:
+SYSCALL(exec)
+ 61b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 620:	cd 40                	int    $0x40
+ 622:	c3                   	ret
+
+00000623 <open>:
+SYSCALL(open)
+ 623:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 628:	cd 40                	int    $0x40
+ 62a:	c3                   	ret
+
+0000062b <mknod>:
+SYSCALL(mknod)
+ 62b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 630:	cd 40                	int    $0x40
+ 632:	c3                   	ret
+
+00000633 <unlink>:
+SYSCALL(unlink)
+ 633:	b8 12 00 00 00       	mov    $0x12,%eax
+ 638:	cd 40                	int    $0x40
+ 63a:	c3                   	ret
+
+0000063b <fstat>:
+SYSCALL(fstat)
+ 63b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 640:	cd 40                	int    $0x40
+ 642:	c3                   	ret
+
+00000643 <link>:
+SYSCALL(link)
+ 643:	b8 13 00 00 00       	mov    $0x13,%eax
+ 648:	cd 40                	int    $0x40
+ 64a:	c3                   	ret
+
+0000064b <mkdir>:
+SYSCALL(mkdir)
+ 64b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 650:	cd 40                	int    $0x40
+ 652:	c3                   	ret
+
+00000653 <chdir>:
+SYSCALL(chdir)
+ 653:	b8 09 00 00 00       	mov    $0x9,%eax
+ 658:	cd 40                	int    $0x40
+ 65a:	c3                   	ret
+
+0000065b <dup>:
+SYSCALL(dup)
+ 65b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 660:	cd 40                	int    $0x40
+ 662:	c3                   	ret
+
+00000663 <getpid>:
+SYSCALL(getpid)
+ 663:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 668:	cd 40                	int    $0x40
+ 66a:	c3                   	ret
+
+0000066b <sbrk>:
+SYSCALL(sbrk)
+ 66b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 670:	cd 40                	int    $0x40
+ 672:	c3                   	ret
+
+00000673 <sleep>:
+SYSCALL(sleep)
+ 673:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 678:	cd 40                	int    $0x40
+ 67a:	c3                   	ret
+
+0000067b <uptime>:
+SYSCALL(uptime)
+ 67b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 680:	cd 40                	int    $0x40
+ 682:	c3                   	ret
+
+00000683 <nice>:
+SYSCALL(nice)
+ 683:	b8 16 00 00 00       	mov    $0x16,%eax
+ 688:	cd 40                	int    $0x40
+ 68a:	c3                   	ret
+
+0000068b <fsync>:
+SYSCALL(fsync)
+ 68b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 690:	cd 40                	int    $0x40
+ 692:	c3                   	ret
+
+00000693 <getpstat>:
+SYSCALL(getpstat)
+ 693:	b8 18 00 00 00       	mov    $0x18,%eax
+ 698:	cd 40                	int    $0x40
+ 69a:	c3                   	ret
+
+0000069b <pipesize>:
+SYSCALL(pipesize)
+ 69b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6a0:	cd 40                	int    $0x40
+ 6a2:	c3                   	ret
+
+000006a3 <uptimens>:
+SYSCALL(uptimens)
+ 6a3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6a8:	cd 40                	int    $0x40
+ 6aa:	c3                   	ret
+
+000006ab <settickets>:
+SYSCALL(settickets)
+ 6ab:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6b0:	cd 40                	int    $0x40
+ 6b2:	c3                   	ret
+
+000006b3 <transfer>:
+SYSCALL(transfer)
+ 6b3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6b8:	cd 40                	int    $0x40
+ 6ba:	c3                   	ret
+ 6bb:	66 90                	xchg   %ax,%ax
+ 6bd:	66 90                	xchg   %ax,%ax
+ 6bf:	90                   	nop
+
+000006c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+ 6c3:	57                   	push   %edi
+ 6c4:	56                   	push   %esi
+ 6c5:	53                   	push   %ebx
+ 6c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 6c8:	89 d1                	mov    %edx,%ecx
+{
+ 6ca:	83 ec 3c             	sub    $0x3c,%esp
+ 6cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 6d0:	85 d2                	test   %edx,%edx
+ 6d2:	0f 89 80 00 00 00    	jns    758 <printint+0x98>
+ 6d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 6dc:	74 7a                	je     758 <printint+0x98>
+    x = -xx;
+ 6de:	f7 d9                	neg    %ecx
+    neg = 1;
+ 6e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 6e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 6e8:	31 f6                	xor    %esi,%esi
+ 6ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 6f0:	89 c8                	mov    %ecx,%eax
+ 6f2:	31 d2                	xor    %edx,%edx
+ 6f4:	89 f7                	mov    %esi,%edi
+ 6f6:	f7 f3                	div    %ebx
+ 6f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 6fb:	0f b6 92 58 0e 00 00 	movzbl 0xe58(%edx),%edx
+ 702:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 706:	89 ca                	mov    %ecx,%edx
+ 708:	89 c1                	mov    %eax,%ecx
+ 70a:	39 da                	cmp    %ebx,%edx
+ 70c:	73 e2                	jae    6f0 <printint+0x30>
+  if(neg)
+ 70e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 711:	85 c0                	test   %eax,%eax
+ 713:	74 07                	je     71c <printint+0x5c>
+    buf[i++] = '-';
+ 715:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 71a:	89 f7                	mov    %esi,%edi
+ 71c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 71f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 722:	01 df                	add    %ebx,%edi
+ 724:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 728:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 72b:	83 ec 04             	sub    $0x4,%esp
+ 72e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 731:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 734:	6a 01                	push   $0x1
+ 736:	50                   	push   %eax
+ 737:	56                   	push   %esi
+ 738:	e8 c6 fe ff ff       	call   603 <write>
+  while(--i >= 0)
+ 73d:	89 f8                	mov    %edi,%eax
+ 73f:	83 c4 10             	add    $0x10,%esp
+ 742:	83 ef 01             	sub    $0x1,%edi
+ 745:	39 d8                	cmp    %ebx,%eax
+ 747:	75 df                	jne    728 <printint+0x68>
+}
+ 749:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 74c:	5b                   	pop    %ebx
+ 74d:	5e                   	pop    %esi
+ 74e:	5f                   	pop    %edi
+ 74f:	5d                   	pop    %ebp
+ 750:	c3                   	ret
+ 751:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 758:	31 c0                	xor    %eax,%eax
+ 75a:	eb 89                	jmp    6e5 <printint+0x25>
+ 75c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000760 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 760:	55                   	push   %ebp
+ 761:	89 e5                	mov    %esp,%ebp
+ 763:	57                   	push   %edi
+ 764:	56                   	push   %esi
+ 765:	53                   	push   %ebx
+ 766:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 769:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 76c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 76f:	0f b6 1e             	movzbl (%esi),%ebx
+ 772:	83 c6 01             	add    $0x1,%esi
+ 775:	84 db                	test   %bl,%bl
+ 777:	74 67                	je     7e0 <printf+0x80>
+ 779:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 77c:	31 d2                	xor    %edx,%edx
+ 77e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 781:	eb 34                	jmp    7b7 <printf+0x57>
+ 783:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 787:	90                   	nop
+ 788:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 78b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 790:	83 f8 25             	cmp    $0x25,%eax
+ 793:	74 18                	je     7ad <printf+0x4d>
+  write(fd, &c, 1);
+ 795:	83 ec 04             	sub    $0x4,%esp
+ 798:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 79b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 79e:	6a 01                	push   $0x1
+ 7a0:	50                   	push   %eax
+ 7a1:	57                   	push   %edi
+ 7a2:	e8 5c fe ff ff       	call   603 <write>
+ 7a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 7aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 7ad:	0f b6 1e             	movzbl (%esi),%ebx
+ 7b0:	83 c6 01             	add    $0x1,%esi
+ 7b3:	84 db                	test   %bl,%bl
+ 7b5:	74 29                	je     7e0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 7b7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 7ba:	85 d2                	test   %edx,%edx
+ 7bc:	74 ca                	je     788 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 7be:	83 fa 25             	cmp    $0x25,%edx
+ 7c1:	75 ea                	jne    7ad <printf+0x4d>
+      if(c == 'd'){
+ 7c3:	83 f8 25             	cmp    $0x25,%eax
+ 7c6:	0f 84 24 01 00 00    	je     8f0 <printf+0x190>
+ 7cc:	83 e8 63             	sub    $0x63,%eax
+ 7cf:	83 f8 15             	cmp    $0x15,%eax
+ 7d2:	77 1c                	ja     7f0 <printf+0x90>
+ 7d4:	ff 24 85 00 0e 00 00 	jmp    *0xe00(,%eax,4)
+ 7db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7df:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 7e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7e3:	5b                   	pop    %ebx
+ 7e4:	5e                   	pop    %esi
+ 7e5:	5f                   	pop    %edi
+ 7e6:	5d                   	pop    %ebp
+ 7e7:	c3                   	ret
+ 7e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ef:	90                   	nop
+  write(fd, &c, 1);
+ 7f0:	83 ec 04             	sub    $0x4,%esp
+ 7f3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7f6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 7fa:	6a 01                	push   $0x1
+ 7fc:	52                   	push   %edx
+ 7fd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 800:	57                   	push   %edi
+ 801:	e8 fd fd ff ff       	call   603 <write>
+ 806:	83 c4 0c             	add    $0xc,%esp
+ 809:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 80c:	6a 01                	push   $0x1
+ 80e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 811:	52                   	push   %edx
+ 812:	57                   	push   %edi
+ 813:	e8 eb fd ff ff       	call   603 <write>
+        putc(fd, c);
+ 818:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 81b:	31 d2                	xor    %edx,%edx
+ 81d:	eb 8e                	jmp    7ad <printf+0x4d>
+ 81f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 820:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 823:	83 ec 0c             	sub    $0xc,%esp
+ 826:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 82b:	8b 13                	mov    (%ebx),%edx
+ 82d:	6a 00                	push   $0x0
+ 82f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 831:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 834:	e8 87 fe ff ff       	call   6c0 <printint>
+        ap++;
+ 839:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 83c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 83f:	31 d2                	xor    %edx,%edx
+ 841:	e9 67 ff ff ff       	jmp    7ad <printf+0x4d>
+ 846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 850:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 853:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 855:	83 c0 04             	add    $0x4,%eax
+ 858:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 85b:	85 db                	test   %ebx,%ebx
+ 85d:	0f 84 9d 00 00 00    	je     900 <printf+0x1a0>
+        while(*s != 0){
+ 863:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 866:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 868:	84 c0                	test   %al,%al
+ 86a:	0f 84 3d ff ff ff    	je     7ad <printf+0x4d>
+ 870:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 873:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 876:	89 de                	mov    %ebx,%esi
+ 878:	89 d3                	mov    %edx,%ebx
+ 87a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 880:	83 ec 04             	sub    $0x4,%esp
+ 883:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 886:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 889:	6a 01                	push   $0x1
+ 88b:	53                   	push   %ebx
+ 88c:	57                   	push   %edi
+ 88d:	e8 71 fd ff ff       	call   603 <write>
+        while(*s != 0){
+ 892:	0f b6 06             	movzbl (%esi),%eax
+ 895:	83 c4 10             	add    $0x10,%esp
+ 898:	84 c0                	test   %al,%al
+ 89a:	75 e4                	jne    880 <printf+0x120>
+      state = 0;
+ 89c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 89f:	31 d2                	xor    %edx,%edx
+ 8a1:	e9 07 ff ff ff       	jmp    7ad <printf+0x4d>
+ 8a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 8b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8b3:	83 ec 0c             	sub    $0xc,%esp
+ 8b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 8bb:	8b 13                	mov    (%ebx),%edx
+ 8bd:	6a 01                	push   $0x1
+ 8bf:	e9 6b ff ff ff       	jmp    82f <printf+0xcf>
+ 8c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 8c8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 8cb:	83 ec 04             	sub    $0x4,%esp
+ 8ce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 8d1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 8d3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 8d6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8d9:	6a 01                	push   $0x1
+ 8db:	52                   	push   %edx
+ 8dc:	57                   	push   %edi
+ 8dd:	e8 21 fd ff ff       	call   603 <write>
+        ap++;
+ 8e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8e5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8e8:	31 d2                	xor    %edx,%edx
+ 8ea:	e9 be fe ff ff       	jmp    7ad <printf+0x4d>
+ 8ef:	90                   	nop
+  write(fd, &c, 1);
+ 8f0:	83 ec 04             	sub    $0x4,%esp
+ 8f3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8f6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8f9:	6a 01                	push   $0x1
+ 8fb:	e9 11 ff ff ff       	jmp    811 <printf+0xb1>
+ 900:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 905:	bb f6 0d 00 00       	mov    $0xdf6,%ebx
+ 90a:	e9 61 ff ff ff       	jmp    870 <printf+0x110>
+ 90f:	90                   	nop
+
+00000910 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 910:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 911:	a1 c0 16 00 00       	mov    0x16c0,%eax
+{
+ 916:	89 e5                	mov    %esp,%ebp
+ 918:	57                   	push   %edi
+ 919:	56                   	push   %esi
+ 91a:	53                   	push   %ebx
+ 91b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 91e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 921:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 928:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 92a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 92c:	39 ca                	cmp    %ecx,%edx
+ 92e:	73 30                	jae    960 <free+0x50>
+ 930:	39 c1                	cmp    %eax,%ecx
+ 932:	72 04                	jb     938 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 934:	39 c2                	cmp    %eax,%edx
+ 936:	72 f0                	jb     928 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 938:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 93b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 93e:	39 f8                	cmp    %edi,%eax
+ 940:	74 2e                	je     970 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 942:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 945:	8b 42 04             	mov    0x4(%edx),%eax
+ 948:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 94b:	39 f1                	cmp    %esi,%ecx
+ 94d:	74 38                	je     987 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 94f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 951:	5b                   	pop    %ebx
+  freep = p;
+ 952:	89 15 c0 16 00 00    	mov    %edx,0x16c0
+}
+ 958:	5e                   	pop    %esi
+ 959:	5f                   	pop    %edi
+ 95a:	5d                   	pop    %ebp
+ 95b:	c3                   	ret
+ 95c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 960:	39 c1                	cmp    %eax,%ecx
+ 962:	72 d0                	jb     934 <free+0x24>
+ 964:	eb c2                	jmp    928 <free+0x18>
+ 966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 970:	03 70 04             	add    0x4(%eax),%esi
+ 973:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 976:	8b 02                	mov    (%edx),%eax
+ 978:	8b 00                	mov    (%eax),%eax
+ 97a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 97d:	8b 42 04             	mov    0x4(%edx),%eax
+ 980:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 983:	39 f1                	cmp    %esi,%ecx
+ 985:	75 c8                	jne    94f <free+0x3f>
+    p->s.size += bp->s.size;
+ 987:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 98a:	89 15 c0 16 00 00    	mov    %edx,0x16c0
+    p->s.size += bp->s.size;
+ 990:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 993:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 996:	89 0a                	mov    %ecx,(%edx)
+}
+ 998:	5b                   	pop    %ebx
+ 999:	5e                   	pop    %esi
+ 99a:	5f                   	pop    %edi
+ 99b:	5d                   	pop    %ebp
+ 99c:	c3                   	ret
+ 99d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009a0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 9a0:	55                   	push   %ebp
+ 9a1:	89 e5                	mov    %esp,%ebp
+ 9a3:	57                   	push   %edi
+ 9a4:	56                   	push   %esi
+ 9a5:	53                   	push   %ebx
+ 9a6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 9ac:	8b 15 c0 16 00 00    	mov    0x16c0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9b2:	8d 78 07             	lea    0x7(%eax),%edi
+ 9b5:	c1 ef 03             	shr    $0x3,%edi
+ 9b8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 9bb:	85 d2                	test   %edx,%edx
+ 9bd:	0f 84 8d 00 00 00    	je     a50 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9c3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9c5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9c8:	39 f9                	cmp    %edi,%ecx
+ 9ca:	73 64                	jae    a30 <malloc+0x90>
+  if(nu < 4096)
+ 9cc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 9d1:	39 df                	cmp    %ebx,%edi
+ 9d3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 9d6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 9dd:	eb 0a                	jmp    9e9 <malloc+0x49>
+ 9df:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9e0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9e2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9e5:	39 f9                	cmp    %edi,%ecx
+ 9e7:	73 47                	jae    a30 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 9e9:	89 c2                	mov    %eax,%edx
+ 9eb:	39 05 c0 16 00 00    	cmp    %eax,0x16c0
+ 9f1:	75 ed                	jne    9e0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 9f3:	83 ec 0c             	sub    $0xc,%esp
+ 9f6:	56                   	push   %esi
+ 9f7:	e8 6f fc ff ff       	call   66b <sbrk>
+  if(p == (char*)-1)
+ 9fc:	83 c4 10             	add    $0x10,%esp
+ 9ff:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a02:	74 1c                	je     a20 <malloc+0x80>
+  hp->s.size = nu;
+ a04:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a07:	83 ec 0c             	sub    $0xc,%esp
+ a0a:	83 c0 08             	add    $0x8,%eax
+ a0d:	50                   	push   %eax
+ a0e:	e8 fd fe ff ff       	call   910 <free>
+  return freep;
+ a13:	8b 15 c0 16 00 00    	mov    0x16c0,%edx
+      if((p = morecore(nunits)) == 0)
+ a19:	83 c4 10             	add    $0x10,%esp
+ a1c:	85 d2                	test   %edx,%edx
+ a1e:	75 c0                	jne    9e0 <malloc+0x40>
+        return 0;
+  }
+}
+ a20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a23:	31 c0                	xor    %eax,%eax
+}
+ a25:	5b                   	pop    %ebx
+ a26:	5e                   	pop    %esi
+ a27:	5f                   	pop    %edi
+ a28:	5d                   	pop    %ebp
+ a29:	c3                   	ret
+ a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a30:	39 cf                	cmp    %ecx,%edi
+ a32:	74 4c                	je     a80 <malloc+0xe0>
+        p->s.size -= nunits;
+ a34:	29 f9                	sub    %edi,%ecx
+ a36:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a39:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a3c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a3f:	89 15 c0 16 00 00    	mov    %edx,0x16c0
+}
+ a45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a48:	83 c0 08             	add    $0x8,%eax
+}
+ a4b:	5b                   	pop    %ebx
+ a4c:	5e                   	pop    %esi
+ a4d:	5f                   	pop    %edi
+ a4e:	5d                   	pop    %ebp
+ a4f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a50:	c7 05 c0 16 00 00 c4 	movl   $0x16c4,0x16c0
+ a57:	16 00 00 
+    base.s.size = 0;
+ a5a:	b8 c4 16 00 00       	mov    $0x16c4,%eax
+    base.s.ptr = freep = prevp = &base;
+ a5f:	c7 05 c4 16 00 00 c4 	movl   $0x16c4,0x16c4
+ a66:	16 00 00 
+    base.s.size = 0;
+ a69:	c7 05 c8 16 00 00 00 	movl   $0x0,0x16c8
+ a70:	00 00 00 
+    if(p->s.size >= nunits){
+ a73:	e9 54 ff ff ff       	jmp    9cc <malloc+0x2c>
+ a78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a7f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a80:	8b 08                	mov    (%eax),%ecx
+ a82:	89 0a                	mov    %ecx,(%edx)
+ a84:	eb b9                	jmp    a3f <malloc+0x9f>
+ a86:	66 90                	xchg   %ax,%ax
+ a88:	66 90                	xchg   %ax,%ax
+ a8a:	66 90                	xchg   %ax,%ax
+ a8c:	66 90                	xchg   %ax,%ax
+ a8e:	66 90                	xchg   %ax,%ax
+
+00000a90 <pidstat>:
+
+// Fill in *st with the statistics of process pid.
+// Returns 0, or -1 if there is no such process.
+int
+pidstat(int pid, struct pstat *st)
+{
+ a90:	55                   	push   %ebp
+ a91:	89 e5                	mov    %esp,%ebp
+ a93:	56                   	push   %esi
+ a94:	53                   	push   %ebx
+  static struct pstat *ps;
+  int i, n;
+
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ a95:	a1 cc 16 00 00       	mov    0x16cc,%eax
+{
+ a9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ a9d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ aa0:	85 c0                	test   %eax,%eax
+ aa2:	0f 84 98 00 00 00    	je     b40 <pidstat+0xb0>
+    return -1;
+  n = getpstat(ps, NPROC);
+ aa8:	83 ec 08             	sub    $0x8,%esp
+ aab:	6a 40                	push   $0x40
+ aad:	50                   	push   %eax
+ aae:	e8 e0 fb ff ff       	call   693 <getpstat>
+  for(i = 0; i < n; i++){
+ ab3:	83 c4 10             	add    $0x10,%esp
+ ab6:	85 c0                	test   %eax,%eax
+ ab8:	0f 8e 9f 00 00 00    	jle    b5d <pidstat+0xcd>
+ abe:	8b 15 cc 16 00 00    	mov    0x16cc,%edx
+ ac4:	31 c9                	xor    %ecx,%ecx
+ ac6:	eb 16                	jmp    ade <pidstat+0x4e>
+ ac8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ acf:	90                   	nop
+ ad0:	83 c1 01             	add    $0x1,%ecx
+ ad3:	83 c2 38             	add    $0x38,%edx
+ ad6:	39 c8                	cmp    %ecx,%eax
+ ad8:	0f 84 7f 00 00 00    	je     b5d <pidstat+0xcd>
+    if(ps[i].pid == pid){
+ ade:	39 1a                	cmp    %ebx,(%edx)
+ ae0:	75 ee                	jne    ad0 <pidstat+0x40>
+      *st = ps[i];
+ ae2:	89 1e                	mov    %ebx,(%esi)
+ ae4:	8b 42 04             	mov    0x4(%edx),%eax
+ ae7:	89 46 04             	mov    %eax,0x4(%esi)
+ aea:	8b 42 08             	mov    0x8(%edx),%eax
+ aed:	89 46 08             	mov    %eax,0x8(%esi)
+ af0:	8b 42 0c             	mov    0xc(%edx),%eax
+ af3:	89 46 0c             	mov    %eax,0xc(%esi)
+ af6:	8b 42 10             	mov    0x10(%edx),%eax
+ af9:	89 46 10             	mov    %eax,0x10(%esi)
+ afc:	8b 42 14             	mov    0x14(%edx),%eax
+ aff:	89 46 14             	mov    %eax,0x14(%esi)
+ b02:	8b 42 18             	mov    0x18(%edx),%eax
+ b05:	89 46 18             	mov    %eax,0x18(%esi)
+ b08:	8b 42 1c             	mov    0x1c(%edx),%eax
+ b0b:	89 46 1c             	mov    %eax,0x1c(%esi)
+ b0e:	8b 42 20             	mov    0x20(%edx),%eax
+ b11:	89 46 20             	mov    %eax,0x20(%esi)
+ b14:	8b 42 24             	mov    0x24(%edx),%eax
+ b17:	89 46 24             	mov    %eax,0x24(%esi)
+ b1a:	8b 42 28             	mov    0x28(%edx),%eax
+ b1d:	89 46 28             	mov    %eax,0x28(%esi)
+ b20:	8b 42 2c             	mov    0x2c(%edx),%eax
+ b23:	89 46 2c             	mov    %eax,0x2c(%esi)
+ b26:	8b 42 30             	mov    0x30(%edx),%eax
+ b29:	89 46 30             	mov    %eax,0x30(%esi)
+ b2c:	8b 42 34             	mov    0x34(%edx),%eax
+ b2f:	89 46 34             	mov    %eax,0x34(%esi)
+      return 0;
+    }
+  }
+  return -1;
+}
+ b32:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ b35:	31 c0                	xor    %eax,%eax
+}
+ b37:	5b                   	pop    %ebx
+ b38:	5e                   	pop    %esi
+ b39:	5d                   	pop    %ebp
+ b3a:	c3                   	ret
+ b3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b3f:	90                   	nop
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ b40:	83 ec 0c             	sub    $0xc,%esp
+ b43:	68 00 0e 00 00       	push   $0xe00
+ b48:	e8 53 fe ff ff       	call   9a0 <malloc>
+ b4d:	83 c4 10             	add    $0x10,%esp
+ b50:	a3 cc 16 00 00       	mov    %eax,0x16cc
+ b55:	85 c0                	test   %eax,%eax
+ b57:	0f 85 4b ff ff ff    	jne    aa8 <pidstat+0x18>
+}
+ b5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return -1;
+ b60:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ b65:	5b                   	pop    %ebx
+ b66:	5e                   	pop    %esi
+ b67:	5d                   	pop    %ebp
+ b68:	c3                   	ret
+ b69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000b70 <sharetable>:
+// key[i] is printed in a column headed keyname, and so is
+// extra[i] under extraname unless extra is 0.
+void
+sharetable(char *tag, char *keyname, int *key, char *extraname, int *extra,
+           int n, int *pid, int *weight, uint *ticks)
+{
+ b70:	55                   	push   %ebp
+ b71:	89 e5                	mov    %esp,%ebp
+ b73:	57                   	push   %edi
+ b74:	56                   	push   %esi
+ b75:	53                   	push   %ebx
+ b76:	83 ec 3c             	sub    $0x3c,%esp
+ b79:	8b 45 08             	mov    0x8(%ebp),%eax
+ b7c:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+ b7f:	8b 75 24             	mov    0x24(%ebp),%esi
+ b82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ b85:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ b88:	8b 45 10             	mov    0x10(%ebp),%eax
+ b8b:	89 7d d0             	mov    %edi,-0x30(%ebp)
+ b8e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+ b91:	89 45 cc             	mov    %eax,-0x34(%ebp)
+ b94:	8b 45 18             	mov    0x18(%ebp),%eax
+ b97:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ b9a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ b9d:	8b 45 20             	mov    0x20(%ebp),%eax
+ ba0:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ ba3:	8b 45 28             	mov    0x28(%ebp),%eax
+ ba6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  int i, wsum, share, expect, err, maxerr;
+  uint tsum;
+
+  wsum = 0;
+  tsum = 0;
+  for(i = 0; i < n; i++){
+ ba9:	85 ff                	test   %edi,%edi
+ bab:	0f 8e df 01 00 00    	jle    d90 <sharetable+0x220>
+ bb1:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+ bb4:	89 fb                	mov    %edi,%ebx
+ bb6:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  tsum = 0;
+ bb9:	31 d2                	xor    %edx,%edx
+  for(i = 0; i < n; i++){
+ bbb:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ bbe:	31 c0                	xor    %eax,%eax
+ bc0:	31 c9                	xor    %ecx,%ecx
+ bc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wsum += weight[i];
+ bc8:	03 0c 86             	add    (%esi,%eax,4),%ecx
+    tsum += ticks[i];
+ bcb:	03 14 87             	add    (%edi,%eax,4),%edx
+  for(i = 0; i < n; i++){
+ bce:	83 c0 01             	add    $0x1,%eax
+ bd1:	39 c3                	cmp    %eax,%ebx
+ bd3:	75 f3                	jne    bc8 <sharetable+0x58>
+ bd5:	85 d2                	test   %edx,%edx
+ bd7:	b8 01 00 00 00       	mov    $0x1,%eax
+ bdc:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  }
+  if(tsum == 0)
+    tsum = 1;
+  if(wsum == 0)
+    wsum = 1;
+ bdf:	8b 7d d8             	mov    -0x28(%ebp),%edi
+ be2:	0f 45 c2             	cmovne %edx,%eax
+ be5:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+  if(tsum == 0)
+ be8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    wsum = 1;
+ beb:	85 ff                	test   %edi,%edi
+ bed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ bf0:	b8 01 00 00 00       	mov    $0x1,%eax
+ bf5:	0f 45 c7             	cmovne %edi,%eax
+ bf8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+
+  printf(1, "[%s]  pid %s ", tag, keyname);
+ bfb:	51                   	push   %ecx
+ bfc:	ff 75 dc             	push   -0x24(%ebp)
+ bff:	68 69 0e 00 00       	push   $0xe69
+ c04:	6a 01                	push   $0x1
+ c06:	e8 55 fb ff ff       	call   760 <printf>
+  if(extra)
+ c0b:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ c0e:	83 c4 10             	add    $0x10,%esp
+ c11:	85 f6                	test   %esi,%esi
+ c13:	0f 84 47 01 00 00    	je     d60 <sharetable+0x1f0>
+    printf(1, "%s ", extraname);
+ c19:	83 ec 04             	sub    $0x4,%esp
+ c1c:	53                   	push   %ebx
+ c1d:	68 73 0e 00 00       	push   $0xe73
+ c22:	6a 01                	push   $0x1
+ c24:	e8 37 fb ff ff       	call   760 <printf>
+  printf(1, "ticks  share expected\n");
+ c29:	58                   	pop    %eax
+ c2a:	5a                   	pop    %edx
+ c2b:	68 77 0e 00 00       	push   $0xe77
+ c30:	6a 01                	push   $0x1
+ c32:	e8 29 fb ff ff       	call   760 <printf>
+  maxerr = 0;
+  for(i = 0; i < n; i++){
+ c37:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+ c3a:	83 c4 10             	add    $0x10,%esp
+ c3d:	85 c9                	test   %ecx,%ecx
+ c3f:	0f 8e 44 01 00 00    	jle    d89 <sharetable+0x219>
+  if(extra)
+ c45:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+ c4c:	31 ff                	xor    %edi,%edi
+ c4e:	66 90                	xchg   %ax,%ax
+    share = ticks[i] * 1000 / tsum;
+ c50:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ c53:	31 d2                	xor    %edx,%edx
+    expect = weight[i] * 1000 / wsum;
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+ c55:	83 ec 0c             	sub    $0xc,%esp
+    share = ticks[i] * 1000 / tsum;
+ c58:	69 04 b8 e8 03 00 00 	imul   $0x3e8,(%eax,%edi,4),%eax
+ c5f:	f7 75 c0             	divl   -0x40(%ebp)
+ c62:	89 c6                	mov    %eax,%esi
+    expect = weight[i] * 1000 / wsum;
+ c64:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ c67:	69 04 b8 e8 03 00 00 	imul   $0x3e8,(%eax,%edi,4),%eax
+ c6e:	99                   	cltd
+ c6f:	f7 7d d8             	idivl  -0x28(%ebp)
+ c72:	89 c3                	mov    %eax,%ebx
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+ c74:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ c77:	ff 34 b8             	push   (%eax,%edi,4)
+ c7a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ c7d:	ff 34 b8             	push   (%eax,%edi,4)
+ c80:	ff 75 dc             	push   -0x24(%ebp)
+ c83:	68 8e 0e 00 00       	push   $0xe8e
+ c88:	6a 01                	push   $0x1
+ c8a:	e8 d1 fa ff ff       	call   760 <printf>
+    if(extra)
+ c8f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ c92:	83 c4 20             	add    $0x20,%esp
+ c95:	85 c0                	test   %eax,%eax
+ c97:	74 15                	je     cae <sharetable+0x13e>
+      printf(1, "%d ", extra[i]);
+ c99:	83 ec 04             	sub    $0x4,%esp
+ c9c:	ff 34 b8             	push   (%eax,%edi,4)
+ c9f:	68 96 0e 00 00       	push   $0xe96
+ ca4:	6a 01                	push   $0x1
+ ca6:	e8 b5 fa ff ff       	call   760 <printf>
+ cab:	83 c4 10             	add    $0x10,%esp
+    printf(1, "%d %d.%d%% %d.%d%%\n", ticks[i], share / 10, share % 10,
+ cae:	b8 67 66 66 66       	mov    $0x66666667,%eax
+ cb3:	89 d9                	mov    %ebx,%ecx
+ cb5:	83 ec 04             	sub    $0x4,%esp
+ cb8:	f7 eb                	imul   %ebx
+ cba:	89 d8                	mov    %ebx,%eax
+ cbc:	c1 f8 1f             	sar    $0x1f,%eax
+ cbf:	c1 fa 02             	sar    $0x2,%edx
+ cc2:	29 c2                	sub    %eax,%edx
+ cc4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ cc7:	01 c0                	add    %eax,%eax
+ cc9:	29 c1                	sub    %eax,%ecx
+ ccb:	b8 67 66 66 66       	mov    $0x66666667,%eax
+ cd0:	51                   	push   %ecx
+ cd1:	89 f1                	mov    %esi,%ecx
+ cd3:	52                   	push   %edx
+ cd4:	f7 ee                	imul   %esi
+ cd6:	89 f0                	mov    %esi,%eax
+ cd8:	c1 f8 1f             	sar    $0x1f,%eax
+ cdb:	c1 fa 02             	sar    $0x2,%edx
+ cde:	29 c2                	sub    %eax,%edx
+ ce0:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ ce3:	01 c0                	add    %eax,%eax
+ ce5:	29 c1                	sub    %eax,%ecx
+ ce7:	51                   	push   %ecx
+ ce8:	52                   	push   %edx
+ ce9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ cec:	ff 34 b8             	push   (%eax,%edi,4)
+ cef:	68 9a 0e 00 00       	push   $0xe9a
+ cf4:	6a 01                	push   $0x1
+ cf6:	e8 65 fa ff ff       	call   760 <printf>
+           expect / 10, expect % 10);
+    err = share > expect ? share - expect : expect - share;
+ cfb:	89 f2                	mov    %esi,%edx
+ cfd:	89 d8                	mov    %ebx,%eax
+ cff:	83 c4 20             	add    $0x20,%esp
+ d02:	29 f0                	sub    %esi,%eax
+ d04:	29 da                	sub    %ebx,%edx
+ d06:	39 de                	cmp    %ebx,%esi
+ d08:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ d0b:	0f 4f c2             	cmovg  %edx,%eax
+    if(err > maxerr)
+ d0e:	39 c6                	cmp    %eax,%esi
+ d10:	0f 4d c6             	cmovge %esi,%eax
+  for(i = 0; i < n; i++){
+ d13:	83 c7 01             	add    $0x1,%edi
+ d16:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ d19:	39 7d d0             	cmp    %edi,-0x30(%ebp)
+ d1c:	0f 85 2e ff ff ff    	jne    c50 <sharetable+0xe0>
+      maxerr = err;
+  }
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+ d22:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+ d27:	f7 e2                	mul    %edx
+ d29:	c1 ea 03             	shr    $0x3,%edx
+ d2c:	8d 0c 92             	lea    (%edx,%edx,4),%ecx
+ d2f:	89 d0                	mov    %edx,%eax
+ d31:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ d34:	01 c9                	add    %ecx,%ecx
+ d36:	29 ca                	sub    %ecx,%edx
+ d38:	89 45 14             	mov    %eax,0x14(%ebp)
+ d3b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ d3e:	89 55 18             	mov    %edx,0x18(%ebp)
+ d41:	89 45 10             	mov    %eax,0x10(%ebp)
+ d44:	c7 45 0c b0 0e 00 00 	movl   $0xeb0,0xc(%ebp)
+ d4b:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+ d52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d55:	5b                   	pop    %ebx
+ d56:	5e                   	pop    %esi
+ d57:	5f                   	pop    %edi
+ d58:	5d                   	pop    %ebp
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+ d59:	e9 02 fa ff ff       	jmp    760 <printf>
+ d5e:	66 90                	xchg   %ax,%ax
+  printf(1, "ticks  share expected\n");
+ d60:	83 ec 08             	sub    $0x8,%esp
+ d63:	68 77 0e 00 00       	push   $0xe77
+ d68:	6a 01                	push   $0x1
+ d6a:	e8 f1 f9 ff ff       	call   760 <printf>
+ d6f:	83 c4 10             	add    $0x10,%esp
+ d72:	e9 ce fe ff ff       	jmp    c45 <sharetable+0xd5>
+ d77:	83 ec 08             	sub    $0x8,%esp
+ d7a:	68 77 0e 00 00       	push   $0xe77
+ d7f:	6a 01                	push   $0x1
+ d81:	e8 da f9 ff ff       	call   760 <printf>
+ d86:	83 c4 10             	add    $0x10,%esp
+  if(extra)
+ d89:	31 c0                	xor    %eax,%eax
+ d8b:	31 d2                	xor    %edx,%edx
+ d8d:	eb a9                	jmp    d38 <sharetable+0x1c8>
+ d8f:	90                   	nop
+  printf(1, "[%s]  pid %s ", tag, keyname);
+ d90:	51                   	push   %ecx
+ d91:	ff 75 dc             	push   -0x24(%ebp)
+ d94:	68 69 0e 00 00       	push   $0xe69
+ d99:	6a 01                	push   $0x1
+ d9b:	e8 c0 f9 ff ff       	call   760 <printf>
+  if(extra)
+ da0:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ da3:	83 c4 10             	add    $0x10,%esp
+ da6:	85 ff                	test   %edi,%edi
+ da8:	74 cd                	je     d77 <sharetable+0x207>
+    wsum = 1;
+ daa:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  if(extra)
+ db1:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+ db8:	e9 5c fe ff ff       	jmp    c19 <sharetable+0xa9>
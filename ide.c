@@ -1,4 +1,6 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// IDE driver code: bus-master DMA on a PCI IDE controller
+// (the PIIX that QEMU and Bochs emulate), with PIO as a
+// fallback when there is none.
 
 #include "types.h"
 #include "defs.h"
@@ -23,15 +25,61 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
+#define IDE_CMD_SETMUL 0xc6
+
+// Without DMA a block moves in one READ/WRITE MULTIPLE
+// data transfer, which may be no more than IDE_MAXMUL
+// sectors (the most QEMU allows).
+#define IDE_MAXMUL    16
+
+// Bus-master IDE registers, relative to bmbase (primary channel).
+#define BM_CMD        0
+  #define BM_CMD_START  0x01
+  #define BM_CMD_READ   0x08   // transfer from disk to memory
+#define BM_STATUS     2
+  #define BM_ST_ERR     0x02
+  #define BM_ST_INT     0x04
+#define BM_PRDT       4
+
+// PCI configuration space access.
+#define PCI_CONFIG_ADDR 0xcf8
+#define PCI_CONFIG_DATA 0xcfc
+#define PCI_COMMAND     0x04
+  #define PCI_CMD_IO      0x01
+  #define PCI_CMD_MASTER  0x04
+#define PCI_CLASS       0x08
+#define PCI_BAR4        0x20
+
+// A DMA transfer moves up to IDE_MAXSECT sectors, so up to
+// IDE_MAXBLKS adjacent requests can be merged into one.
+#define IDE_MAXSECT   128
+#define IDE_MAXBLKS   (IDE_MAXSECT / (BSIZE/SECTOR_SIZE))
+#define NPRD          (2*IDE_MAXBLKS)
+
+// Physical region descriptor: one contiguous piece of a DMA
+// transfer. A region may not cross a 64KB boundary.
+struct prd {
+  uint addr;
+  ushort len;          // bytes; 0 means 64KB
+  ushort flags;
+};
+#define PRD_EOT       0x8000   // last entry in the table
 
 // idequeue points to the buf now being read/written to the disk.
 // idequeue->qnext points to the next buf to be processed.
+// The first ideinflight bufs make up the transfer in progress;
+// the rest are kept in C-SCAN order (see iderw).
 // You must hold idelock while manipulating queue.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static int ideinflight;
 
 static int havedisk1;
+static ushort bmbase;     // bus-master registers; 0 if no DMA
+static struct prd prdt[NPRD] __attribute__((aligned(NPRD*sizeof(struct prd))));
 static void idestart(struct buf*);
 
 // Wait for IDE disk to become ready.
@@ -47,6 +95,45 @@ idewait(int checkerr)
   return 0;
 }
 
+static uint
+pciread(int dev, int func, int off)
+{
+  outl(PCI_CONFIG_ADDR, 0x80000000 | dev<<11 | func<<8 | (off & 0xfc));
+  return inl(PCI_CONFIG_DATA);
+}
+
+static void
+pciwrite(int dev, int func, int off, uint val)
+{
+  outl(PCI_CONFIG_ADDR, 0x80000000 | dev<<11 | func<<8 | (off & 0xfc));
+  outl(PCI_CONFIG_DATA, val);
+}
+
+// Look on PCI bus 0 for an IDE controller that can do bus-master
+// DMA, and turn bus mastering on.
+static void
+idedmainit(void)
+{
+  int dev, func;
+  uint bar;
+
+  for(dev = 0; dev < 32; dev++){
+    for(func = 0; func < 8; func++){
+      if((pciread(dev, func, 0) & 0xffff) == 0xffff)
+        continue;
+      if((pciread(dev, func, PCI_CLASS) >> 16) != 0x0101)
+        continue;
+      bar = pciread(dev, func, PCI_BAR4);
+      if((bar & 1) == 0 || (bar & 0xfffc) == 0)
+        continue;
+      pciwrite(dev, func, PCI_COMMAND, pciread(dev, func, PCI_COMMAND) |
+               PCI_CMD_IO | PCI_CMD_MASTER);
+      bmbase = bar & 0xfffc;
+      return;
+    }
+  }
+}
+
 void
 ideinit(void)
 {
@@ -65,14 +152,63 @@ ideinit(void)
     }
   }
 
+  // Make each READ/WRITE MULTIPLE data transfer a whole block.
+  if(BSIZE/SECTOR_SIZE > 1){
+    for(i = 0; i <= havedisk1; i++){
+      outb(0x1f6, 0xe0 | (i<<4));
+      outb(0x1f2, BSIZE/SECTOR_SIZE);
+      outb(0x1f7, IDE_CMD_SETMUL);
+      idewait(0);
+    }
+  }
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
+
+  idedmainit();
+}
+
+// Can request n be transferred together with request b,
+// just ahead of it?
+static int
+idemerge(struct buf *b, struct buf *n)
+{
+  return n->dev == b->dev && n->blockno == b->blockno + 1 &&
+         (n->flags & B_DIRTY) == (b->flags & B_DIRTY);
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Describe the data of the nblk bufs starting at b in prdt.
+static void
+prdfill(struct buf *b, int nblk)
+{
+  struct prd *p;
+  uint addr, n, left;
+
+  p = prdt;
+  for(; nblk > 0; nblk--, b = b->qnext){
+    addr = V2P(b->data);
+    for(left = BSIZE; left > 0; left -= n, addr += n){
+      n = 0x10000 - (addr & 0xffff);
+      if(n > left)
+        n = left;
+      p->addr = addr;
+      p->len = n;
+      p->flags = 0;
+      p++;
+    }
+  }
+  p[-1].flags = PRD_EOT;
+}
+
+// Start the request for b, together with any requests for the
+// blocks right after it that are queued behind it.
+// Caller must hold idelock.
 static void
 idestart(struct buf *b)
 {
+  struct buf *n;
+  int nblk;
+
   if(b == 0)
     panic("idestart");
   if(b->blockno >= FSSIZE)
@@ -81,17 +217,32 @@ idestart(struct buf *b)
   int sector = b->blockno * sector_per_block;
   int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
   int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  int bmdir = (b->flags & B_DIRTY) ? 0 : BM_CMD_READ;
 
-  if (sector_per_block > 7) panic("idestart");
+  nblk = 1;
+  if(bmbase){
+    for(n = b; n->qnext && nblk < IDE_MAXBLKS && idemerge(n, n->qnext);
+        n = n->qnext)
+      nblk++;
+    prdfill(b, nblk);
+  } else if(sector_per_block > IDE_MAXMUL)
+    panic("idestart");
+  ideinflight = nblk;
 
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, nblk * sector_per_block);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
+  if(bmbase){
+    outl(bmbase + BM_PRDT, V2P(prdt));
+    outb(bmbase + BM_CMD, bmdir);
+    outb(bmbase + BM_STATUS, inb(bmbase + BM_STATUS) | BM_ST_INT | BM_ST_ERR);
+    outb(0x1f7, bmdir ? IDE_CMD_RDDMA : IDE_CMD_WRDMA);
+    outb(bmbase + BM_CMD, bmdir | BM_CMD_START);
+  } else if(b->flags & B_DIRTY){
     outb(0x1f7, write_cmd);
     outsl(0x1f0, b->data, BSIZE/4);
   } else {
@@ -103,41 +254,71 @@ idestart(struct buf *b)
 void
 ideintr(void)
 {
-  struct buf *b;
+  struct buf *b, *done;
+  int st;
 
-  // First queued buffer is the active request.
+  // First queued buffers are the active request.
   acquire(&idelock);
 
   if((b = idequeue) == 0){
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
+  if(bmbase){
+    // Stop the DMA engine and acknowledge its interrupt.
+    st = inb(bmbase + BM_STATUS);
+    outb(bmbase + BM_CMD, 0);
+    outb(bmbase + BM_STATUS, st | BM_ST_INT | BM_ST_ERR);
+    if((st & BM_ST_ERR) || idewait(1) < 0)
+      panic("ideintr: dma error");
+  } else if(!(b->flags & B_DIRTY) && idewait(1) >= 0){
+    // Read data if needed.
     insl(0x1f0, b->data, BSIZE/4);
+  }
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+  // Wake processes waiting for the bufs of the transfer.
+  // Read-ahead bufs have no waiter; collect them to be
+  // released once idelock is dropped.
+  done = 0;
+  for(; ideinflight > 0; ideinflight--){
+    b = idequeue;
+    idequeue = b->qnext;
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    if(b->flags & B_ASYNC){
+      b->flags &= ~B_ASYNC;
+      b->qnext = done;
+      done = b;
+    } else
+      wakeup(b);
+  }
 
   // Start disk on next buf in queue.
   if(idequeue != 0)
     idestart(idequeue);
 
   release(&idelock);
+
+  while((b = done) != 0){
+    done = b->qnext;
+    bdone(b);
+  }
 }
 
 //PAGEBREAK!
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
-void
-iderw(struct buf *b)
+// Insert b into idequeue behind the transfer in progress,
+// in C-SCAN elevator order: ascending block number from
+// where the disk head is, then wrapping around to block 0.
+// Comparing block numbers relative to pos, as unsigned,
+// gives exactly that order.
+// Caller must hold idelock.
+static void
+ideenqueue(struct buf *b)
 {
   struct buf **pp;
+  uint pos;
+  int i;
 
   if(!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
@@ -146,23 +327,65 @@ iderw(struct buf *b)
   if(b->dev != 0 && !havedisk1)
     panic("iderw: ide disk 1 not present");
 
-  acquire(&idelock);  //DOC:acquire-lock
-
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+  pp = &idequeue;
+  for(i = 0; i < ideinflight; i++)
+    pp = &(*pp)->qnext;
+  pos = idequeue ? idequeue->blockno : 0;
+  for(; *pp && (*pp)->blockno - pos <= b->blockno - pos; pp = &(*pp)->qnext)  //DOC:insert-queue
     ;
+  b->qnext = *pp;
   *pp = b;
+}
+
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+  acquire(&idelock);  //DOC:acquire-lock
+
+  ideenqueue(b);
 
   // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+  if(ideinflight == 0)
+    idestart(idequeue);
 
   // Wait for request to finish.
   while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
     sleep(b, &idelock);
   }
 
+  release(&idelock);
+}
+
+// Queue a B_ASYNC read of b and return without waiting.
+// ideintr() hands b to bdone() when the read completes.
+void
+iderwasync(struct buf *b)
+{
+  acquire(&idelock);
+  ideenqueue(b);
+  if(ideinflight == 0)
+    idestart(idequeue);
+  release(&idelock);
+}
+
+// Sync the n bufs in bp with disk, as iderw does, and wait
+// for all of them. Queueing them together lets idestart()
+// merge adjacent blocks into one transfer.
+void
+iderwv(struct buf **bp, int n)
+{
+  int i;
 
+  acquire(&idelock);
+  for(i = 0; i < n; i++)
+    ideenqueue(bp[i]);
+  if(ideinflight == 0)
+    idestart(idequeue);
+  for(i = 0; i < n; i++)
+    while((bp[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+      sleep(bp[i], &idelock);
   release(&idelock);
 }
@@ -1,6 +1,14 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
 // and pipe buffers. Allocates 4096-byte pages.
+//
+// Free pages live on a global list protected by kmem.lock and
+// in a small per-CPU cache that only its own CPU touches, with
+// interrupts off. kalloc() and kfree() normally use just the
+// cache; it is refilled from and drained to the global list
+// KBATCH pages at a time, so kmem.lock is taken about once
+// every KBATCH operations. Up to KCACHE pages per CPU can sit
+// in caches, out of reach of other CPUs.
 
 #include "types.h"
 #include "defs.h"
@@ -9,6 +17,9 @@
 #include "mmu.h"
 #include "spinlock.h"
 
+#define KCACHE 32  // max pages in a per-CPU cache
+#define KBATCH 16  // pages moved to/from the global list at once
+
 void freerange(void *vstart, void *vend);
 extern char end[]; // first address after kernel loaded from ELF file
                    // defined by the kernel linker script in kernel.ld
@@ -17,10 +28,22 @@ struct run {
   struct run *next;
 };
 
+struct kcache {
+  struct run *freelist;
+  int n;
+};
+
 struct {
   struct spinlock lock;
   int use_lock;
   struct run *freelist;
+  int nfree;              // pages on freelist
+  struct kcache cache[NCPU];
+  // Number of page tables (plus kernel users) referring to each
+  // physical page. Pages shared copy-on-write after fork() have
+  // a count above one; kfree() only frees at zero. Updated
+  // atomically, since the cache paths take no lock.
+  ushort ref[PHYSTOP/PGSIZE];
 } kmem;
 
 // Initialization happens in two phases.
@@ -48,32 +71,62 @@ freerange(void *vstart, void *vend)
 {
   char *p;
   p = (char*)PGROUNDUP((uint)vstart);
-  for(; p + PGSIZE <= (char*)vend; p += PGSIZE)
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+    kmem.ref[V2P(p)/PGSIZE] = 1;
     kfree(p);
+  }
 }
 //PAGEBREAK: 21
-// Free the page of physical memory pointed at by v,
-// which normally should have been returned by a
+// Drop a reference to the page of physical memory pointed
+// at by v, which normally should have been returned by a
 // call to kalloc().  (The exception is when
 // initializing the allocator; see kinit above.)
+// The page is freed when the last reference goes away.
 void
 kfree(char *v)
 {
   struct run *r;
+  struct kcache *c;
+  int i;
 
   if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
     panic("kfree");
 
+  if(kmem.ref[V2P(v)/PGSIZE] == 0)
+    panic("kfree: ref");
+  if(__sync_sub_and_fetch(&kmem.ref[V2P(v)/PGSIZE], 1) > 0)
+    return;
+
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
+  r = (struct run*)v;
 
-  if(kmem.use_lock)
+  if(!kmem.use_lock){
+    // Still booting on one CPU.
+    r->next = kmem.freelist;
+    kmem.freelist = r;
+    kmem.nfree++;
+    return;
+  }
+
+  pushcli();
+  c = &kmem.cache[cpuid()];
+  r->next = c->freelist;
+  c->freelist = r;
+  if(++c->n > KCACHE){
+    // Cache overflowed: give a batch back.
     acquire(&kmem.lock);
-  r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
-  if(kmem.use_lock)
+    for(i = 0; i < KBATCH; i++){
+      r = c->freelist;
+      c->freelist = r->next;
+      r->next = kmem.freelist;
+      kmem.freelist = r;
+    }
+    c->n -= KBATCH;
+    kmem.nfree += KBATCH;
     release(&kmem.lock);
+  }
+  popcli();
 }
 
 // Allocate one 4096-byte page of physical memory.
@@ -83,14 +136,67 @@ char*
 kalloc(void)
 {
   struct run *r;
+  struct kcache *c;
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
-  r = kmem.freelist;
+  if(!kmem.use_lock){
+    r = kmem.freelist;
+    if(r){
+      kmem.freelist = r->next;
+      kmem.nfree--;
+    }
+  } else {
+    pushcli();
+    c = &kmem.cache[cpuid()];
+    if(c->n == 0){
+      // Cache empty: refill a batch from the global list.
+      acquire(&kmem.lock);
+      while(c->n < KBATCH && (r = kmem.freelist) != 0){
+        kmem.freelist = r->next;
+        kmem.nfree--;
+        r->next = c->freelist;
+        c->freelist = r;
+        c->n++;
+      }
+      release(&kmem.lock);
+    }
+    if((r = c->freelist) != 0){
+      c->freelist = r->next;
+      c->n--;
+    }
+    popcli();
+  }
   if(r)
-    kmem.freelist = r->next;
-  if(kmem.use_lock)
-    release(&kmem.lock);
+    kmem.ref[V2P(r)/PGSIZE] = 1;
   return (char*)r;
 }
 
+// Add a reference to the page at v, which must already
+// be allocated. Used to share user pages copy-on-write.
+void
+kincref(char *v)
+{
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+    panic("kincref");
+  if(__sync_fetch_and_add(&kmem.ref[V2P(v)/PGSIZE], 1) == 0)
+    panic("kincref: free page");
+}
+
+// Return the number of references to the page at v.
+int
+krefcount(char *v)
+{
+  return kmem.ref[V2P(v)/PGSIZE];
+}
+
+// Return the number of free pages. Does not lock the
+// per-CPU caches, so the answer is only approximate.
+int
+kfreecount(void)
+{
+  int i, n;
+
+  n = kmem.nfree;
+  for(i = 0; i < NCPU; i++)
+    n += kmem.cache[i].n;
+  return n;
+}
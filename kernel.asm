@@ -0,0 +1,23439 @@
+
+kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+80100000 <multiboot_header>:
+80100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+80100006:	00 00                	add    %al,(%eax)
+80100008:	fe 4f 52             	decb   0x52(%edi)
+8010000b:	e4                   	.byte 0xe4
+
+8010000c <entry>:
+
+# Entering xv6 on boot processor, with paging off.
+.globl entry
+entry:
+  # Turn on page size extension for 4Mbyte pages
+  movl    %cr4, %eax
+8010000c:	0f 20 e0             	mov    %cr4,%eax
+  orl     $(CR4_PSE), %eax
+8010000f:	83 c8 10             	or     $0x10,%eax
+  movl    %eax, %cr4
+80100012:	0f 22 e0             	mov    %eax,%cr4
+  # Set page directory
+  movl    $(V2P_WO(entrypgdir)), %eax
+80100015:	b8 00 e0 10 00       	mov    $0x10e000,%eax
+  movl    %eax, %cr3
+8010001a:	0f 22 d8             	mov    %eax,%cr3
+  # Turn on paging.
+  movl    %cr0, %eax
+8010001d:	0f 20 c0             	mov    %cr0,%eax
+  orl     $(CR0_PG|CR0_WP), %eax
+80100020:	0d 00 00 01 80       	or     $0x80010000,%eax
+  movl    %eax, %cr0
+80100025:	0f 22 c0             	mov    %eax,%cr0
+
+  # Set up the stack pointer.
+  movl $(stack + KSTACKSIZE), %esp
+80100028:	bc b0 4d 14 80       	mov    $0x80144db0,%esp
+
+  # Jump to main(), and switch to executing at
+  # high addresses. The indirect call is needed because
+  # the assembler produces a PC-relative instruction
+  # for a direct jump.
+  mov $main, %eax
+8010002d:	b8 50 52 10 80       	mov    $0x80105250,%eax
+  jmp *%eax
+80100032:	ff e0                	jmp    *%eax
+80100034:	66 90                	xchg   %ax,%ax
+80100036:	66 90                	xchg   %ax,%ax
+80100038:	66 90                	xchg   %ax,%ax
+8010003a:	66 90                	xchg   %ax,%ax
+8010003c:	66 90                	xchg   %ax,%ax
+8010003e:	66 90                	xchg   %ax,%ax
+
+80100040 <bfind>:
+static struct buf*
+bfind(int h, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = bcache.bucket[h].head; b; b = b->hnext){
+80100040:	6b c0 38             	imul   $0x38,%eax,%eax
+80100043:	8b 80 68 5a 11 80    	mov    -0x7feea598(%eax),%eax
+80100049:	85 c0                	test   %eax,%eax
+8010004b:	75 0a                	jne    80100057 <bfind+0x17>
+8010004d:	eb 1f                	jmp    8010006e <bfind+0x2e>
+8010004f:	90                   	nop
+80100050:	8b 40 58             	mov    0x58(%eax),%eax
+80100053:	85 c0                	test   %eax,%eax
+80100055:	74 19                	je     80100070 <bfind+0x30>
+    if(b->dev == dev && b->blockno == blockno){
+80100057:	39 50 04             	cmp    %edx,0x4(%eax)
+8010005a:	75 f4                	jne    80100050 <bfind+0x10>
+8010005c:	39 48 08             	cmp    %ecx,0x8(%eax)
+8010005f:	75 ef                	jne    80100050 <bfind+0x10>
+      if(b->refcnt++ == 0){
+80100061:	8b 50 4c             	mov    0x4c(%eax),%edx
+80100064:	8d 4a 01             	lea    0x1(%edx),%ecx
+80100067:	89 48 4c             	mov    %ecx,0x4c(%eax)
+8010006a:	85 d2                	test   %edx,%edx
+8010006c:	74 03                	je     80100071 <bfind+0x31>
+      }
+      return b;
+    }
+  }
+  return 0;
+}
+8010006e:	c3                   	ret
+8010006f:	90                   	nop
+80100070:	c3                   	ret
+{
+80100071:	55                   	push   %ebp
+80100072:	89 e5                	mov    %esp,%ebp
+80100074:	83 ec 24             	sub    $0x24,%esp
+80100077:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        acquire(&bcache.lrulock);
+8010007a:	68 00 61 11 80       	push   $0x80116100
+8010007f:	e8 9c 7c 00 00       	call   80107d20 <acquire>
+  b->next->prev = b->prev;
+80100084:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80100087:	8b 48 54             	mov    0x54(%eax),%ecx
+8010008a:	8b 50 50             	mov    0x50(%eax),%edx
+8010008d:	89 51 50             	mov    %edx,0x50(%ecx)
+  b->prev->next = b->next;
+80100090:	8b 48 54             	mov    0x54(%eax),%ecx
+80100093:	89 4a 54             	mov    %ecx,0x54(%edx)
+        release(&bcache.lrulock);
+80100096:	c7 04 24 00 61 11 80 	movl   $0x80116100,(%esp)
+8010009d:	e8 1e 7c 00 00       	call   80107cc0 <release>
+801000a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+801000a5:	83 c4 10             	add    $0x10,%esp
+}
+801000a8:	c9                   	leave
+801000a9:	c3                   	ret
+801000aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801000b0 <bref>:
+// In either case, return the buffer with a reference
+// taken, but not locked. If every buffer is in use,
+// return 0 if mayfail, else panic.
+static struct buf*
+bref(uint dev, uint blockno, int mayfail)
+{
+801000b0:	55                   	push   %ebp
+801000b1:	89 e5                	mov    %esp,%ebp
+801000b3:	57                   	push   %edi
+801000b4:	89 c7                	mov    %eax,%edi
+801000b6:	56                   	push   %esi
+801000b7:	89 d6                	mov    %edx,%esi
+801000b9:	53                   	push   %ebx
+801000ba:	83 ec 38             	sub    $0x38,%esp
+801000bd:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  struct buf *b;
+  int h = BHASH(dev, blockno);
+801000c0:	8d 0c c5 00 00 00 00 	lea    0x0(,%eax,8),%ecx
+801000c7:	29 c1                	sub    %eax,%ecx
+801000c9:	b8 85 10 42 08       	mov    $0x8421085,%eax
+{
+801000ce:	89 55 d8             	mov    %edx,-0x28(%ebp)
+  int h = BHASH(dev, blockno);
+801000d1:	01 d1                	add    %edx,%ecx
+801000d3:	f7 e1                	mul    %ecx
+801000d5:	89 c8                	mov    %ecx,%eax
+801000d7:	29 d0                	sub    %edx,%eax
+801000d9:	d1 e8                	shr    %eax
+801000db:	8d 1c 02             	lea    (%edx,%eax,1),%ebx
+801000de:	c1 eb 04             	shr    $0x4,%ebx
+801000e1:	89 d8                	mov    %ebx,%eax
+801000e3:	c1 e0 05             	shl    $0x5,%eax
+801000e6:	29 d8                	sub    %ebx,%eax
+801000e8:	29 c1                	sub    %eax,%ecx
+
+  // Is the block already cached?
+  acquire(&bcache.bucket[h].lock);
+801000ea:	6b c1 38             	imul   $0x38,%ecx,%eax
+  int h = BHASH(dev, blockno);
+801000ed:	89 cb                	mov    %ecx,%ebx
+  acquire(&bcache.bucket[h].lock);
+801000ef:	05 34 5a 11 80       	add    $0x80115a34,%eax
+801000f4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801000f7:	50                   	push   %eax
+801000f8:	e8 23 7c 00 00       	call   80107d20 <acquire>
+  if((b = bfind(h, dev, blockno)) != 0)
+801000fd:	89 f1                	mov    %esi,%ecx
+801000ff:	89 fa                	mov    %edi,%edx
+80100101:	89 d8                	mov    %ebx,%eax
+80100103:	e8 38 ff ff ff       	call   80100040 <bfind>
+80100108:	83 c4 10             	add    $0x10,%esp
+8010010b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010010e:	85 c0                	test   %eax,%eax
+80100110:	74 1e                	je     80100130 <bref+0x80>
+    b->refcnt = 1;
+  }
+  release(&bcache.lock);
+
+found:
+  release(&bcache.bucket[h].lock);
+80100112:	83 ec 0c             	sub    $0xc,%esp
+80100115:	ff 75 e0             	push   -0x20(%ebp)
+80100118:	e8 a3 7b 00 00       	call   80107cc0 <release>
+  return b;
+}
+8010011d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80100120:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100123:	5b                   	pop    %ebx
+80100124:	5e                   	pop    %esi
+80100125:	5f                   	pop    %edi
+80100126:	5d                   	pop    %ebp
+80100127:	c3                   	ret
+80100128:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010012f:	90                   	nop
+  release(&bcache.bucket[h].lock);
+80100130:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80100133:	83 ec 0c             	sub    $0xc,%esp
+80100136:	56                   	push   %esi
+80100137:	e8 84 7b 00 00       	call   80107cc0 <release>
+  acquire(&bcache.lock);
+8010013c:	c7 04 24 00 f6 10 80 	movl   $0x8010f600,(%esp)
+80100143:	e8 d8 7b 00 00       	call   80107d20 <acquire>
+  acquire(&bcache.bucket[h].lock);
+80100148:	89 34 24             	mov    %esi,(%esp)
+8010014b:	e8 d0 7b 00 00       	call   80107d20 <acquire>
+  if((b = bfind(h, dev, blockno)) == 0){
+80100150:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+80100153:	89 fa                	mov    %edi,%edx
+80100155:	89 d8                	mov    %ebx,%eax
+80100157:	e8 e4 fe ff ff       	call   80100040 <bfind>
+8010015c:	83 c4 10             	add    $0x10,%esp
+8010015f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80100162:	85 c0                	test   %eax,%eax
+80100164:	74 12                	je     80100178 <bref+0xc8>
+  release(&bcache.lock);
+80100166:	83 ec 0c             	sub    $0xc,%esp
+80100169:	68 00 f6 10 80       	push   $0x8010f600
+8010016e:	e8 4d 7b 00 00       	call   80107cc0 <release>
+80100173:	83 c4 10             	add    $0x10,%esp
+80100176:	eb 9a                	jmp    80100112 <bref+0x62>
+    h2 = BHASH(b->dev, b->blockno);
+80100178:	89 7d d0             	mov    %edi,-0x30(%ebp)
+8010017b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010017f:	90                   	nop
+    acquire(&bcache.lrulock);
+80100180:	83 ec 0c             	sub    $0xc,%esp
+80100183:	68 00 61 11 80       	push   $0x80116100
+80100188:	e8 93 7b 00 00       	call   80107d20 <acquire>
+    for(b = bcache.lru.next; b != &bcache.lru; b = b->next)
+8010018d:	8b 3d 88 61 11 80    	mov    0x80116188,%edi
+80100193:	83 c4 10             	add    $0x10,%esp
+80100196:	81 ff 34 61 11 80    	cmp    $0x80116134,%edi
+8010019c:	75 19                	jne    801001b7 <bref+0x107>
+8010019e:	e9 6d 01 00 00       	jmp    80100310 <bref+0x260>
+801001a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801001a7:	90                   	nop
+801001a8:	8b 7f 54             	mov    0x54(%edi),%edi
+801001ab:	81 ff 34 61 11 80    	cmp    $0x80116134,%edi
+801001b1:	0f 84 59 01 00 00    	je     80100310 <bref+0x260>
+      if((b->flags & B_DIRTY) == 0)
+801001b7:	f6 07 04             	testb  $0x4,(%edi)
+801001ba:	75 ec                	jne    801001a8 <bref+0xf8>
+    release(&bcache.lrulock);
+801001bc:	83 ec 0c             	sub    $0xc,%esp
+801001bf:	68 00 61 11 80       	push   $0x80116100
+801001c4:	e8 f7 7a 00 00       	call   80107cc0 <release>
+    if(b == &bcache.lru)
+801001c9:	83 c4 10             	add    $0x10,%esp
+801001cc:	81 ff 34 61 11 80    	cmp    $0x80116134,%edi
+801001d2:	0f 84 48 01 00 00    	je     80100320 <bref+0x270>
+    h2 = BHASH(b->dev, b->blockno);
+801001d8:	8b 47 04             	mov    0x4(%edi),%eax
+801001db:	8d 34 c5 00 00 00 00 	lea    0x0(,%eax,8),%esi
+801001e2:	29 c6                	sub    %eax,%esi
+801001e4:	b8 85 10 42 08       	mov    $0x8421085,%eax
+801001e9:	03 77 08             	add    0x8(%edi),%esi
+801001ec:	f7 e6                	mul    %esi
+801001ee:	89 f0                	mov    %esi,%eax
+801001f0:	29 d0                	sub    %edx,%eax
+801001f2:	d1 e8                	shr    %eax
+801001f4:	01 c2                	add    %eax,%edx
+801001f6:	c1 ea 04             	shr    $0x4,%edx
+801001f9:	89 d0                	mov    %edx,%eax
+801001fb:	c1 e0 05             	shl    $0x5,%eax
+801001fe:	29 d0                	sub    %edx,%eax
+80100200:	29 c6                	sub    %eax,%esi
+80100202:	89 f2                	mov    %esi,%edx
+    if(h2 != h)
+80100204:	39 f3                	cmp    %esi,%ebx
+80100206:	74 38                	je     80100240 <bref+0x190>
+      acquire(&bcache.bucket[h2].lock);
+80100208:	6b f6 38             	imul   $0x38,%esi,%esi
+8010020b:	83 ec 0c             	sub    $0xc,%esp
+8010020e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80100211:	81 c6 34 5a 11 80    	add    $0x80115a34,%esi
+80100217:	56                   	push   %esi
+80100218:	e8 03 7b 00 00       	call   80107d20 <acquire>
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0)
+8010021d:	8b 47 4c             	mov    0x4c(%edi),%eax
+80100220:	83 c4 10             	add    $0x10,%esp
+80100223:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80100226:	85 c0                	test   %eax,%eax
+80100228:	74 36                	je     80100260 <bref+0x1b0>
+      release(&bcache.bucket[h2].lock);
+8010022a:	83 ec 0c             	sub    $0xc,%esp
+8010022d:	56                   	push   %esi
+8010022e:	e8 8d 7a 00 00       	call   80107cc0 <release>
+80100233:	83 c4 10             	add    $0x10,%esp
+80100236:	e9 45 ff ff ff       	jmp    80100180 <bref+0xd0>
+8010023b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010023f:	90                   	nop
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0)
+80100240:	8b 4f 4c             	mov    0x4c(%edi),%ecx
+80100243:	85 c9                	test   %ecx,%ecx
+80100245:	0f 85 35 ff ff ff    	jne    80100180 <bref+0xd0>
+8010024b:	f6 07 04             	testb  $0x4,(%edi)
+8010024e:	0f 85 2c ff ff ff    	jne    80100180 <bref+0xd0>
+80100254:	eb 0f                	jmp    80100265 <bref+0x1b5>
+80100256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010025d:	8d 76 00             	lea    0x0(%esi),%esi
+80100260:	f6 07 04             	testb  $0x4,(%edi)
+80100263:	75 c5                	jne    8010022a <bref+0x17a>
+  acquire(&bcache.lrulock);
+80100265:	83 ec 0c             	sub    $0xc,%esp
+80100268:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010026b:	89 fe                	mov    %edi,%esi
+8010026d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+80100270:	68 00 61 11 80       	push   $0x80116100
+80100275:	e8 a6 7a 00 00       	call   80107d20 <acquire>
+  b->next->prev = b->prev;
+8010027a:	8b 4e 54             	mov    0x54(%esi),%ecx
+8010027d:	8b 46 50             	mov    0x50(%esi),%eax
+80100280:	89 41 50             	mov    %eax,0x50(%ecx)
+  b->prev->next = b->next;
+80100283:	8b 4e 54             	mov    0x54(%esi),%ecx
+80100286:	89 48 54             	mov    %ecx,0x54(%eax)
+  release(&bcache.lrulock);
+80100289:	c7 04 24 00 61 11 80 	movl   $0x80116100,(%esp)
+80100290:	e8 2b 7a 00 00       	call   80107cc0 <release>
+  for(pp = &bcache.bucket[h2].head; *pp != b; pp = &(*pp)->hnext)
+80100295:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80100298:	83 c4 10             	add    $0x10,%esp
+8010029b:	6b ca 38             	imul   $0x38,%edx,%ecx
+8010029e:	8b 81 68 5a 11 80    	mov    -0x7feea598(%ecx),%eax
+801002a4:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+801002a7:	39 c6                	cmp    %eax,%esi
+801002a9:	0f 84 91 00 00 00    	je     80100340 <bref+0x290>
+801002af:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801002b2:	8b 40 58             	mov    0x58(%eax),%eax
+801002b5:	39 f0                	cmp    %esi,%eax
+801002b7:	75 f6                	jne    801002af <bref+0x1ff>
+801002b9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801002bc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+801002bf:	83 c0 58             	add    $0x58,%eax
+  *pp = b->hnext;
+801002c2:	8b 4e 58             	mov    0x58(%esi),%ecx
+801002c5:	89 08                	mov    %ecx,(%eax)
+  if(h2 != h)
+801002c7:	39 d3                	cmp    %edx,%ebx
+801002c9:	74 14                	je     801002df <bref+0x22f>
+    release(&bcache.bucket[h2].lock);
+801002cb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801002ce:	83 ec 0c             	sub    $0xc,%esp
+801002d1:	05 34 5a 11 80       	add    $0x80115a34,%eax
+801002d6:	50                   	push   %eax
+801002d7:	e8 e4 79 00 00       	call   80107cc0 <release>
+801002dc:	83 c4 10             	add    $0x10,%esp
+  b->hnext = bcache.bucket[h].head;
+801002df:	6b c3 38             	imul   $0x38,%ebx,%eax
+    b->refcnt = 1;
+801002e2:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  b->hnext = bcache.bucket[h].head;
+801002e5:	8b 90 68 5a 11 80    	mov    -0x7feea598(%eax),%edx
+801002eb:	89 56 58             	mov    %edx,0x58(%esi)
+  bcache.bucket[h].head = b;
+801002ee:	89 b0 68 5a 11 80    	mov    %esi,-0x7feea598(%eax)
+    b->blockno = blockno;
+801002f4:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    b->dev = dev;
+801002f7:	89 7e 04             	mov    %edi,0x4(%esi)
+    b->blockno = blockno;
+801002fa:	89 46 08             	mov    %eax,0x8(%esi)
+    b->flags = 0;
+801002fd:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    b->refcnt = 1;
+80100303:	c7 46 4c 01 00 00 00 	movl   $0x1,0x4c(%esi)
+8010030a:	e9 57 fe ff ff       	jmp    80100166 <bref+0xb6>
+8010030f:	90                   	nop
+    release(&bcache.lrulock);
+80100310:	83 ec 0c             	sub    $0xc,%esp
+80100313:	68 00 61 11 80       	push   $0x80116100
+80100318:	e8 a3 79 00 00       	call   80107cc0 <release>
+8010031d:	83 c4 10             	add    $0x10,%esp
+      if(!mayfail)
+80100320:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80100323:	85 c0                	test   %eax,%eax
+80100325:	0f 85 3b fe ff ff    	jne    80100166 <bref+0xb6>
+        panic("bget: no buffers");
+8010032b:	83 ec 0c             	sub    $0xc,%esp
+8010032e:	68 60 b5 10 80       	push   $0x8010b560
+80100333:	e8 48 05 00 00       	call   80100880 <panic>
+80100338:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010033f:	90                   	nop
+  for(pp = &bcache.bucket[h2].head; *pp != b; pp = &(*pp)->hnext)
+80100340:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80100343:	05 68 5a 11 80       	add    $0x80115a68,%eax
+80100348:	e9 75 ff ff ff       	jmp    801002c2 <bref+0x212>
+8010034d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80100350 <bunref>:
+
+// Drop a reference to b, taken by bref().
+// Move to the tail of the free list once unreferenced.
+static void
+bunref(struct buf *b)
+{
+80100350:	55                   	push   %ebp
+80100351:	89 e5                	mov    %esp,%ebp
+80100353:	56                   	push   %esi
+80100354:	89 c6                	mov    %eax,%esi
+80100356:	53                   	push   %ebx
+  int h;
+
+  h = BHASH(b->dev, b->blockno);
+80100357:	8b 40 04             	mov    0x4(%eax),%eax
+8010035a:	8d 0c c5 00 00 00 00 	lea    0x0(,%eax,8),%ecx
+80100361:	29 c1                	sub    %eax,%ecx
+80100363:	b8 85 10 42 08       	mov    $0x8421085,%eax
+80100368:	03 4e 08             	add    0x8(%esi),%ecx
+  acquire(&bcache.bucket[h].lock);
+8010036b:	83 ec 0c             	sub    $0xc,%esp
+  h = BHASH(b->dev, b->blockno);
+8010036e:	f7 e1                	mul    %ecx
+80100370:	89 c8                	mov    %ecx,%eax
+80100372:	29 d0                	sub    %edx,%eax
+80100374:	d1 e8                	shr    %eax
+80100376:	01 c2                	add    %eax,%edx
+80100378:	c1 ea 04             	shr    $0x4,%edx
+8010037b:	89 d0                	mov    %edx,%eax
+8010037d:	c1 e0 05             	shl    $0x5,%eax
+80100380:	29 d0                	sub    %edx,%eax
+80100382:	29 c1                	sub    %eax,%ecx
+  acquire(&bcache.bucket[h].lock);
+80100384:	6b d9 38             	imul   $0x38,%ecx,%ebx
+80100387:	81 c3 34 5a 11 80    	add    $0x80115a34,%ebx
+8010038d:	53                   	push   %ebx
+8010038e:	e8 8d 79 00 00       	call   80107d20 <acquire>
+  b->refcnt--;
+80100393:	8b 46 4c             	mov    0x4c(%esi),%eax
+  if (b->refcnt == 0) {
+80100396:	83 c4 10             	add    $0x10,%esp
+  b->refcnt--;
+80100399:	83 e8 01             	sub    $0x1,%eax
+8010039c:	89 46 4c             	mov    %eax,0x4c(%esi)
+  if (b->refcnt == 0) {
+8010039f:	85 c0                	test   %eax,%eax
+801003a1:	74 1d                	je     801003c0 <bunref+0x70>
+    b->prev = bcache.lru.prev;
+    bcache.lru.prev->next = b;
+    bcache.lru.prev = b;
+    release(&bcache.lrulock);
+  }
+  release(&bcache.bucket[h].lock);
+801003a3:	83 ec 0c             	sub    $0xc,%esp
+801003a6:	53                   	push   %ebx
+801003a7:	e8 14 79 00 00       	call   80107cc0 <release>
+}
+801003ac:	83 c4 10             	add    $0x10,%esp
+801003af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801003b2:	5b                   	pop    %ebx
+801003b3:	5e                   	pop    %esi
+801003b4:	5d                   	pop    %ebp
+801003b5:	c3                   	ret
+801003b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801003bd:	8d 76 00             	lea    0x0(%esi),%esi
+    acquire(&bcache.lrulock);
+801003c0:	83 ec 0c             	sub    $0xc,%esp
+801003c3:	68 00 61 11 80       	push   $0x80116100
+801003c8:	e8 53 79 00 00       	call   80107d20 <acquire>
+    b->next = &bcache.lru;
+801003cd:	c7 46 54 34 61 11 80 	movl   $0x80116134,0x54(%esi)
+    b->prev = bcache.lru.prev;
+801003d4:	a1 84 61 11 80       	mov    0x80116184,%eax
+801003d9:	89 46 50             	mov    %eax,0x50(%esi)
+    bcache.lru.prev->next = b;
+801003dc:	89 70 54             	mov    %esi,0x54(%eax)
+    bcache.lru.prev = b;
+801003df:	89 35 84 61 11 80    	mov    %esi,0x80116184
+    release(&bcache.lrulock);
+801003e5:	c7 04 24 00 61 11 80 	movl   $0x80116100,(%esp)
+801003ec:	e8 cf 78 00 00       	call   80107cc0 <release>
+801003f1:	83 c4 10             	add    $0x10,%esp
+801003f4:	eb ad                	jmp    801003a3 <bunref+0x53>
+801003f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801003fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80100400 <binit>:
+{
+80100400:	55                   	push   %ebp
+80100401:	89 e5                	mov    %esp,%ebp
+80100403:	53                   	push   %ebx
+80100404:	bb 34 5a 11 80       	mov    $0x80115a34,%ebx
+80100409:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&bcache.lock, "bcache");
+8010040c:	68 71 b5 10 80       	push   $0x8010b571
+80100411:	68 00 f6 10 80       	push   $0x8010f600
+80100416:	e8 25 77 00 00       	call   80107b40 <initlock>
+  initlock(&bcache.lrulock, "bcache.lru");
+8010041b:	58                   	pop    %eax
+8010041c:	5a                   	pop    %edx
+8010041d:	68 78 b5 10 80       	push   $0x8010b578
+80100422:	68 00 61 11 80       	push   $0x80116100
+80100427:	e8 14 77 00 00       	call   80107b40 <initlock>
+  for(h = 0; h < NBUCKET; h++)
+8010042c:	83 c4 10             	add    $0x10,%esp
+8010042f:	90                   	nop
+    initlock(&bcache.bucket[h].lock, "bcache.bucket");
+80100430:	83 ec 08             	sub    $0x8,%esp
+80100433:	68 83 b5 10 80       	push   $0x8010b583
+80100438:	53                   	push   %ebx
+  for(h = 0; h < NBUCKET; h++)
+80100439:	83 c3 38             	add    $0x38,%ebx
+    initlock(&bcache.bucket[h].lock, "bcache.bucket");
+8010043c:	e8 ff 76 00 00       	call   80107b40 <initlock>
+  for(h = 0; h < NBUCKET; h++)
+80100441:	83 c4 10             	add    $0x10,%esp
+80100444:	81 fb fc 60 11 80    	cmp    $0x801160fc,%ebx
+8010044a:	75 e4                	jne    80100430 <binit+0x30>
+  bcache.lru.prev = &bcache.lru;
+8010044c:	c7 05 84 61 11 80 34 	movl   $0x80116134,0x80116184
+80100453:	61 11 80 
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+80100456:	bb 34 f6 10 80       	mov    $0x8010f634,%ebx
+  bcache.lru.next = &bcache.lru;
+8010045b:	c7 05 88 61 11 80 34 	movl   $0x80116134,0x80116188
+80100462:	61 11 80 
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+80100465:	8d 76 00             	lea    0x0(%esi),%esi
+    b->next = &bcache.lru;
+80100468:	c7 43 54 34 61 11 80 	movl   $0x80116134,0x54(%ebx)
+    b->prev = bcache.lru.prev;
+8010046f:	a1 84 61 11 80       	mov    0x80116184,%eax
+    initsleeplock(&b->lock, "buffer");
+80100474:	83 ec 08             	sub    $0x8,%esp
+    b->prev = bcache.lru.prev;
+80100477:	89 43 50             	mov    %eax,0x50(%ebx)
+    bcache.lru.prev->next = b;
+8010047a:	89 58 54             	mov    %ebx,0x54(%eax)
+    b->hnext = bcache.bucket[h].head;
+8010047d:	a1 68 5a 11 80       	mov    0x80115a68,%eax
+    bcache.lru.prev = b;
+80100482:	89 1d 84 61 11 80    	mov    %ebx,0x80116184
+    b->hnext = bcache.bucket[h].head;
+80100488:	89 43 58             	mov    %eax,0x58(%ebx)
+    initsleeplock(&b->lock, "buffer");
+8010048b:	8d 43 0c             	lea    0xc(%ebx),%eax
+    bcache.bucket[h].head = b;
+8010048e:	89 1d 68 5a 11 80    	mov    %ebx,0x80115a68
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+80100494:	83 c3 64             	add    $0x64,%ebx
+    initsleeplock(&b->lock, "buffer");
+80100497:	68 91 b5 10 80       	push   $0x8010b591
+8010049c:	50                   	push   %eax
+8010049d:	e8 0e 75 00 00       	call   801079b0 <initsleeplock>
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+801004a2:	83 c4 10             	add    $0x10,%esp
+801004a5:	81 fb 34 5a 11 80    	cmp    $0x80115a34,%ebx
+801004ab:	75 bb                	jne    80100468 <binit+0x68>
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+801004ad:	bb 34 f6 10 80       	mov    $0x8010f634,%ebx
+801004b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if((b - bcache.buf) % (PGSIZE/BSIZE) == 0 && (mem = kalloc()) == 0)
+801004b8:	e8 23 3d 00 00       	call   801041e0 <kalloc>
+801004bd:	85 c0                	test   %eax,%eax
+801004bf:	74 13                	je     801004d4 <binit+0xd4>
+    b->data = (uchar*)mem + (b - bcache.buf) % (PGSIZE/BSIZE) * BSIZE;
+801004c1:	89 43 60             	mov    %eax,0x60(%ebx)
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+801004c4:	83 c3 64             	add    $0x64,%ebx
+801004c7:	81 fb 34 5a 11 80    	cmp    $0x80115a34,%ebx
+801004cd:	75 e9                	jne    801004b8 <binit+0xb8>
+}
+801004cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801004d2:	c9                   	leave
+801004d3:	c3                   	ret
+      panic("binit: out of memory");
+801004d4:	83 ec 0c             	sub    $0xc,%esp
+801004d7:	68 98 b5 10 80       	push   $0x8010b598
+801004dc:	e8 9f 03 00 00       	call   80100880 <panic>
+801004e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801004e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801004ef:	90                   	nop
+
+801004f0 <bread>:
+}
+
+// Return a locked buf with the contents of the indicated block.
+struct buf*
+bread(uint dev, uint blockno)
+{
+801004f0:	55                   	push   %ebp
+  b = bref(dev, blockno, 0);
+801004f1:	31 c9                	xor    %ecx,%ecx
+{
+801004f3:	89 e5                	mov    %esp,%ebp
+801004f5:	53                   	push   %ebx
+801004f6:	83 ec 04             	sub    $0x4,%esp
+  b = bref(dev, blockno, 0);
+801004f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+801004fc:	8b 45 08             	mov    0x8(%ebp),%eax
+801004ff:	e8 ac fb ff ff       	call   801000b0 <bref>
+  acquiresleep(&b->lock);
+80100504:	83 ec 0c             	sub    $0xc,%esp
+  b = bref(dev, blockno, 0);
+80100507:	89 c3                	mov    %eax,%ebx
+  acquiresleep(&b->lock);
+80100509:	83 c0 0c             	add    $0xc,%eax
+8010050c:	50                   	push   %eax
+8010050d:	e8 de 74 00 00       	call   801079f0 <acquiresleep>
+  struct buf *b;
+
+  b = bget(dev, blockno);
+  if((b->flags & B_VALID) == 0) {
+80100512:	83 c4 10             	add    $0x10,%esp
+80100515:	f6 03 02             	testb  $0x2,(%ebx)
+80100518:	74 0e                	je     80100528 <bread+0x38>
+    iderw(b);
+  }
+  return b;
+}
+8010051a:	89 d8                	mov    %ebx,%eax
+8010051c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010051f:	c9                   	leave
+80100520:	c3                   	ret
+80100521:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    iderw(b);
+80100528:	83 ec 0c             	sub    $0xc,%esp
+8010052b:	53                   	push   %ebx
+8010052c:	e8 6f 37 00 00       	call   80103ca0 <iderw>
+}
+80100531:	89 d8                	mov    %ebx,%eax
+    iderw(b);
+80100533:	83 c4 10             	add    $0x10,%esp
+}
+80100536:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100539:	c9                   	leave
+8010053a:	c3                   	ret
+8010053b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010053f:	90                   	nop
+
+80100540 <bwrite>:
+
+// Write b's contents to disk.  Must be locked.
+void
+bwrite(struct buf *b)
+{
+80100540:	55                   	push   %ebp
+80100541:	89 e5                	mov    %esp,%ebp
+80100543:	53                   	push   %ebx
+80100544:	83 ec 10             	sub    $0x10,%esp
+80100547:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+8010054a:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010054d:	50                   	push   %eax
+8010054e:	e8 9d 75 00 00       	call   80107af0 <holdingsleep>
+80100553:	83 c4 10             	add    $0x10,%esp
+80100556:	85 c0                	test   %eax,%eax
+80100558:	74 0f                	je     80100569 <bwrite+0x29>
+    panic("bwrite");
+  b->flags |= B_DIRTY;
+8010055a:	83 0b 04             	orl    $0x4,(%ebx)
+  iderw(b);
+8010055d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+80100560:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100563:	c9                   	leave
+  iderw(b);
+80100564:	e9 37 37 00 00       	jmp    80103ca0 <iderw>
+    panic("bwrite");
+80100569:	83 ec 0c             	sub    $0xc,%esp
+8010056c:	68 ad b5 10 80       	push   $0x8010b5ad
+80100571:	e8 0a 03 00 00       	call   80100880 <panic>
+80100576:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010057d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80100580 <bwritev>:
+
+// Write the n locked bufs in bp to disk together.
+void
+bwritev(struct buf **bp, int n)
+{
+80100580:	55                   	push   %ebp
+80100581:	89 e5                	mov    %esp,%ebp
+80100583:	57                   	push   %edi
+80100584:	56                   	push   %esi
+80100585:	53                   	push   %ebx
+80100586:	83 ec 0c             	sub    $0xc,%esp
+80100589:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010058c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i;
+
+  for(i = 0; i < n; i++){
+8010058f:	85 f6                	test   %esi,%esi
+80100591:	7e 28                	jle    801005bb <bwritev+0x3b>
+80100593:	31 db                	xor    %ebx,%ebx
+80100595:	8d 76 00             	lea    0x0(%esi),%esi
+    if(!holdingsleep(&bp[i]->lock))
+80100598:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+8010059b:	83 ec 0c             	sub    $0xc,%esp
+8010059e:	83 c0 0c             	add    $0xc,%eax
+801005a1:	50                   	push   %eax
+801005a2:	e8 49 75 00 00       	call   80107af0 <holdingsleep>
+801005a7:	83 c4 10             	add    $0x10,%esp
+801005aa:	85 c0                	test   %eax,%eax
+801005ac:	74 1f                	je     801005cd <bwritev+0x4d>
+      panic("bwritev");
+    bp[i]->flags |= B_DIRTY;
+801005ae:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  for(i = 0; i < n; i++){
+801005b1:	83 c3 01             	add    $0x1,%ebx
+    bp[i]->flags |= B_DIRTY;
+801005b4:	83 08 04             	orl    $0x4,(%eax)
+  for(i = 0; i < n; i++){
+801005b7:	39 de                	cmp    %ebx,%esi
+801005b9:	75 dd                	jne    80100598 <bwritev+0x18>
+  }
+  iderwv(bp, n);
+801005bb:	89 75 0c             	mov    %esi,0xc(%ebp)
+801005be:	89 7d 08             	mov    %edi,0x8(%ebp)
+}
+801005c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801005c4:	5b                   	pop    %ebx
+801005c5:	5e                   	pop    %esi
+801005c6:	5f                   	pop    %edi
+801005c7:	5d                   	pop    %ebp
+  iderwv(bp, n);
+801005c8:	e9 b3 37 00 00       	jmp    80103d80 <iderwv>
+      panic("bwritev");
+801005cd:	83 ec 0c             	sub    $0xc,%esp
+801005d0:	68 b4 b5 10 80       	push   $0x8010b5b4
+801005d5:	e8 a6 02 00 00       	call   80100880 <panic>
+801005da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801005e0 <breadahead>:
+// if NASYNC read-aheads are already in flight or there is
+// no free buffer. The disk driver calls bdone() when the
+// read completes.
+void
+breadahead(uint dev, uint blockno)
+{
+801005e0:	55                   	push   %ebp
+801005e1:	89 e5                	mov    %esp,%ebp
+801005e3:	56                   	push   %esi
+801005e4:	53                   	push   %ebx
+801005e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801005e8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  struct buf *b;
+
+  acquire(&bcache.lock);
+801005eb:	83 ec 0c             	sub    $0xc,%esp
+801005ee:	68 00 f6 10 80       	push   $0x8010f600
+801005f3:	e8 28 77 00 00       	call   80107d20 <acquire>
+  if(bcache.nasync >= NASYNC){
+801005f8:	a1 fc 60 11 80       	mov    0x801160fc,%eax
+801005fd:	83 c4 10             	add    $0x10,%esp
+80100600:	83 f8 3f             	cmp    $0x3f,%eax
+80100603:	0f 8f ae 00 00 00    	jg     801006b7 <breadahead+0xd7>
+    release(&bcache.lock);
+    return;
+  }
+  bcache.nasync++;
+  release(&bcache.lock);
+80100609:	83 ec 0c             	sub    $0xc,%esp
+  bcache.nasync++;
+8010060c:	83 c0 01             	add    $0x1,%eax
+8010060f:	a3 fc 60 11 80       	mov    %eax,0x801160fc
+  release(&bcache.lock);
+80100614:	68 00 f6 10 80       	push   $0x8010f600
+80100619:	e8 a2 76 00 00       	call   80107cc0 <release>
+
+  if((b = bref(dev, blockno, 1)) == 0){
+8010061e:	89 d8                	mov    %ebx,%eax
+80100620:	b9 01 00 00 00       	mov    $0x1,%ecx
+80100625:	89 f2                	mov    %esi,%edx
+80100627:	e8 84 fa ff ff       	call   801000b0 <bref>
+8010062c:	83 c4 10             	add    $0x10,%esp
+8010062f:	89 c3                	mov    %eax,%ebx
+80100631:	85 c0                	test   %eax,%eax
+80100633:	74 6b                	je     801006a0 <breadahead+0xc0>
+    bunasync();
+    return;
+  }
+  if((b->flags & B_VALID) || !tryacquiresleep(&b->lock)){
+80100635:	f6 00 02             	testb  $0x2,(%eax)
+80100638:	75 36                	jne    80100670 <breadahead+0x90>
+8010063a:	83 ec 0c             	sub    $0xc,%esp
+8010063d:	8d 70 0c             	lea    0xc(%eax),%esi
+80100640:	56                   	push   %esi
+80100641:	e8 0a 74 00 00       	call   80107a50 <tryacquiresleep>
+80100646:	83 c4 10             	add    $0x10,%esp
+80100649:	85 c0                	test   %eax,%eax
+8010064b:	74 23                	je     80100670 <breadahead+0x90>
+    bunasync();
+    bunref(b);
+    return;
+  }
+  if(b->flags & B_VALID){
+8010064d:	8b 03                	mov    (%ebx),%eax
+8010064f:	a8 02                	test   $0x2,%al
+80100651:	75 7d                	jne    801006d0 <breadahead+0xf0>
+    releasesleep(&b->lock);
+    bunasync();
+    bunref(b);
+    return;
+  }
+  b->flags |= B_ASYNC;
+80100653:	83 c8 08             	or     $0x8,%eax
+80100656:	89 03                	mov    %eax,(%ebx)
+  iderwasync(b);
+80100658:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+8010065b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010065e:	5b                   	pop    %ebx
+8010065f:	5e                   	pop    %esi
+80100660:	5d                   	pop    %ebp
+  iderwasync(b);
+80100661:	e9 ba 36 00 00       	jmp    80103d20 <iderwasync>
+80100666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010066d:	8d 76 00             	lea    0x0(%esi),%esi
+  acquire(&bcache.lock);
+80100670:	83 ec 0c             	sub    $0xc,%esp
+80100673:	68 00 f6 10 80       	push   $0x8010f600
+80100678:	e8 a3 76 00 00       	call   80107d20 <acquire>
+  bcache.nasync--;
+8010067d:	83 2d fc 60 11 80 01 	subl   $0x1,0x801160fc
+  release(&bcache.lock);
+80100684:	c7 04 24 00 f6 10 80 	movl   $0x8010f600,(%esp)
+8010068b:	e8 30 76 00 00       	call   80107cc0 <release>
+    bunref(b);
+80100690:	83 c4 10             	add    $0x10,%esp
+}
+80100693:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    bunref(b);
+80100696:	89 d8                	mov    %ebx,%eax
+}
+80100698:	5b                   	pop    %ebx
+80100699:	5e                   	pop    %esi
+8010069a:	5d                   	pop    %ebp
+    bunref(b);
+8010069b:	e9 b0 fc ff ff       	jmp    80100350 <bunref>
+  acquire(&bcache.lock);
+801006a0:	83 ec 0c             	sub    $0xc,%esp
+801006a3:	68 00 f6 10 80       	push   $0x8010f600
+801006a8:	e8 73 76 00 00       	call   80107d20 <acquire>
+  bcache.nasync--;
+801006ad:	83 2d fc 60 11 80 01 	subl   $0x1,0x801160fc
+  release(&bcache.lock);
+801006b4:	83 c4 10             	add    $0x10,%esp
+801006b7:	c7 45 08 00 f6 10 80 	movl   $0x8010f600,0x8(%ebp)
+}
+801006be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801006c1:	5b                   	pop    %ebx
+801006c2:	5e                   	pop    %esi
+801006c3:	5d                   	pop    %ebp
+  release(&bcache.lock);
+801006c4:	e9 f7 75 00 00       	jmp    80107cc0 <release>
+801006c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    releasesleep(&b->lock);
+801006d0:	83 ec 0c             	sub    $0xc,%esp
+801006d3:	56                   	push   %esi
+801006d4:	e8 d7 73 00 00       	call   80107ab0 <releasesleep>
+  acquire(&bcache.lock);
+801006d9:	c7 04 24 00 f6 10 80 	movl   $0x8010f600,(%esp)
+801006e0:	eb 96                	jmp    80100678 <breadahead+0x98>
+801006e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801006e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801006f0 <bdone>:
+
+// Release a buffer whose read-ahead has completed.
+// Called by the disk driver, in interrupt context.
+void
+bdone(struct buf *b)
+{
+801006f0:	55                   	push   %ebp
+801006f1:	89 e5                	mov    %esp,%ebp
+801006f3:	53                   	push   %ebx
+801006f4:	83 ec 10             	sub    $0x10,%esp
+801006f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  releasesleep(&b->lock);
+801006fa:	8d 43 0c             	lea    0xc(%ebx),%eax
+801006fd:	50                   	push   %eax
+801006fe:	e8 ad 73 00 00       	call   80107ab0 <releasesleep>
+  acquire(&bcache.lock);
+80100703:	c7 04 24 00 f6 10 80 	movl   $0x8010f600,(%esp)
+8010070a:	e8 11 76 00 00       	call   80107d20 <acquire>
+  bcache.nasync--;
+8010070f:	83 2d fc 60 11 80 01 	subl   $0x1,0x801160fc
+  release(&bcache.lock);
+80100716:	c7 04 24 00 f6 10 80 	movl   $0x8010f600,(%esp)
+8010071d:	e8 9e 75 00 00       	call   80107cc0 <release>
+  bunasync();
+  bunref(b);
+80100722:	83 c4 10             	add    $0x10,%esp
+80100725:	89 d8                	mov    %ebx,%eax
+}
+80100727:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010072a:	c9                   	leave
+  bunref(b);
+8010072b:	e9 20 fc ff ff       	jmp    80100350 <bunref>
+
+80100730 <brelse>:
+
+// Release a locked buffer.
+void
+brelse(struct buf *b)
+{
+80100730:	55                   	push   %ebp
+80100731:	89 e5                	mov    %esp,%ebp
+80100733:	56                   	push   %esi
+80100734:	53                   	push   %ebx
+80100735:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+80100738:	8d 73 0c             	lea    0xc(%ebx),%esi
+8010073b:	83 ec 0c             	sub    $0xc,%esp
+8010073e:	56                   	push   %esi
+8010073f:	e8 ac 73 00 00       	call   80107af0 <holdingsleep>
+80100744:	83 c4 10             	add    $0x10,%esp
+80100747:	85 c0                	test   %eax,%eax
+80100749:	74 19                	je     80100764 <brelse+0x34>
+    panic("brelse");
+
+  releasesleep(&b->lock);
+8010074b:	83 ec 0c             	sub    $0xc,%esp
+8010074e:	56                   	push   %esi
+8010074f:	e8 5c 73 00 00       	call   80107ab0 <releasesleep>
+  bunref(b);
+80100754:	83 c4 10             	add    $0x10,%esp
+}
+80100757:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  bunref(b);
+8010075a:	89 d8                	mov    %ebx,%eax
+}
+8010075c:	5b                   	pop    %ebx
+8010075d:	5e                   	pop    %esi
+8010075e:	5d                   	pop    %ebp
+  bunref(b);
+8010075f:	e9 ec fb ff ff       	jmp    80100350 <bunref>
+    panic("brelse");
+80100764:	83 ec 0c             	sub    $0xc,%esp
+80100767:	68 bc b5 10 80       	push   $0x8010b5bc
+8010076c:	e8 0f 01 00 00       	call   80100880 <panic>
+80100771:	66 90                	xchg   %ax,%ax
+80100773:	66 90                	xchg   %ax,%ax
+80100775:	66 90                	xchg   %ax,%ax
+80100777:	66 90                	xchg   %ax,%ax
+80100779:	66 90                	xchg   %ax,%ax
+8010077b:	66 90                	xchg   %ax,%ax
+8010077d:	66 90                	xchg   %ax,%ax
+8010077f:	90                   	nop
+
+80100780 <consoleread>:
+  }
+}
+
+int
+consoleread(struct inode *ip, char *dst, int n)
+{
+80100780:	55                   	push   %ebp
+80100781:	89 e5                	mov    %esp,%ebp
+80100783:	57                   	push   %edi
+80100784:	56                   	push   %esi
+80100785:	53                   	push   %ebx
+80100786:	83 ec 18             	sub    $0x18,%esp
+80100789:	8b 5d 10             	mov    0x10(%ebp),%ebx
+8010078c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  uint target;
+  int c;
+
+  iunlock(ip);
+8010078f:	ff 75 08             	push   0x8(%ebp)
+  target = n;
+80100792:	89 df                	mov    %ebx,%edi
+  iunlock(ip);
+80100794:	e8 a7 21 00 00       	call   80102940 <iunlock>
+  acquire(&cons.lock);
+80100799:	c7 04 24 40 62 11 80 	movl   $0x80116240,(%esp)
+801007a0:	e8 7b 75 00 00       	call   80107d20 <acquire>
+  while(n > 0){
+801007a5:	83 c4 10             	add    $0x10,%esp
+801007a8:	85 db                	test   %ebx,%ebx
+801007aa:	0f 8e 94 00 00 00    	jle    80100844 <consoleread+0xc4>
+    while(input.r == input.w){
+801007b0:	a1 20 62 11 80       	mov    0x80116220,%eax
+801007b5:	39 05 24 62 11 80    	cmp    %eax,0x80116224
+801007bb:	74 25                	je     801007e2 <consoleread+0x62>
+801007bd:	eb 59                	jmp    80100818 <consoleread+0x98>
+801007bf:	90                   	nop
+      if(myproc()->killed){
+        release(&cons.lock);
+        ilock(ip);
+        return -1;
+      }
+      sleep(&input.r, &cons.lock);
+801007c0:	83 ec 08             	sub    $0x8,%esp
+801007c3:	68 40 62 11 80       	push   $0x80116240
+801007c8:	68 20 62 11 80       	push   $0x80116220
+801007cd:	e8 ee 69 00 00       	call   801071c0 <sleep>
+    while(input.r == input.w){
+801007d2:	a1 20 62 11 80       	mov    0x80116220,%eax
+801007d7:	83 c4 10             	add    $0x10,%esp
+801007da:	3b 05 24 62 11 80    	cmp    0x80116224,%eax
+801007e0:	75 36                	jne    80100818 <consoleread+0x98>
+      if(myproc()->killed){
+801007e2:	e8 69 5d 00 00       	call   80106550 <myproc>
+801007e7:	8b 48 40             	mov    0x40(%eax),%ecx
+801007ea:	85 c9                	test   %ecx,%ecx
+801007ec:	74 d2                	je     801007c0 <consoleread+0x40>
+        release(&cons.lock);
+801007ee:	83 ec 0c             	sub    $0xc,%esp
+801007f1:	68 40 62 11 80       	push   $0x80116240
+801007f6:	e8 c5 74 00 00       	call   80107cc0 <release>
+        ilock(ip);
+801007fb:	5a                   	pop    %edx
+801007fc:	ff 75 08             	push   0x8(%ebp)
+801007ff:	e8 5c 20 00 00       	call   80102860 <ilock>
+        return -1;
+80100804:	83 c4 10             	add    $0x10,%esp
+  }
+  release(&cons.lock);
+  ilock(ip);
+
+  return target - n;
+}
+80100807:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return -1;
+8010080a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010080f:	5b                   	pop    %ebx
+80100810:	5e                   	pop    %esi
+80100811:	5f                   	pop    %edi
+80100812:	5d                   	pop    %ebp
+80100813:	c3                   	ret
+80100814:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = input.buf[input.r++ % INPUT_BUF];
+80100818:	8d 50 01             	lea    0x1(%eax),%edx
+8010081b:	89 15 20 62 11 80    	mov    %edx,0x80116220
+80100821:	89 c2                	mov    %eax,%edx
+80100823:	83 e2 7f             	and    $0x7f,%edx
+80100826:	0f be 8a a0 61 11 80 	movsbl -0x7fee9e60(%edx),%ecx
+    if(c == C('D')){  // EOF
+8010082d:	80 f9 04             	cmp    $0x4,%cl
+80100830:	74 37                	je     80100869 <consoleread+0xe9>
+    *dst++ = c;
+80100832:	83 c6 01             	add    $0x1,%esi
+    --n;
+80100835:	83 eb 01             	sub    $0x1,%ebx
+    *dst++ = c;
+80100838:	88 4e ff             	mov    %cl,-0x1(%esi)
+    if(c == '\n')
+8010083b:	83 f9 0a             	cmp    $0xa,%ecx
+8010083e:	0f 85 64 ff ff ff    	jne    801007a8 <consoleread+0x28>
+  release(&cons.lock);
+80100844:	83 ec 0c             	sub    $0xc,%esp
+80100847:	68 40 62 11 80       	push   $0x80116240
+8010084c:	e8 6f 74 00 00       	call   80107cc0 <release>
+  ilock(ip);
+80100851:	58                   	pop    %eax
+80100852:	ff 75 08             	push   0x8(%ebp)
+80100855:	e8 06 20 00 00       	call   80102860 <ilock>
+  return target - n;
+8010085a:	89 f8                	mov    %edi,%eax
+8010085c:	83 c4 10             	add    $0x10,%esp
+}
+8010085f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return target - n;
+80100862:	29 d8                	sub    %ebx,%eax
+}
+80100864:	5b                   	pop    %ebx
+80100865:	5e                   	pop    %esi
+80100866:	5f                   	pop    %edi
+80100867:	5d                   	pop    %ebp
+80100868:	c3                   	ret
+      if(n < target){
+80100869:	39 fb                	cmp    %edi,%ebx
+8010086b:	73 d7                	jae    80100844 <consoleread+0xc4>
+        input.r--;
+8010086d:	a3 20 62 11 80       	mov    %eax,0x80116220
+80100872:	eb d0                	jmp    80100844 <consoleread+0xc4>
+80100874:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010087b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010087f:	90                   	nop
+
+80100880 <panic>:
+{
+80100880:	55                   	push   %ebp
+80100881:	89 e5                	mov    %esp,%ebp
+80100883:	56                   	push   %esi
+80100884:	53                   	push   %ebx
+80100885:	83 ec 30             	sub    $0x30,%esp
+}
+
+static inline void
+cli(void)
+{
+  asm volatile("cli");
+80100888:	fa                   	cli
+  cons.locking = 0;
+80100889:	c7 05 74 62 11 80 00 	movl   $0x0,0x80116274
+80100890:	00 00 00 
+  getcallerpcs(&s, pcs);
+80100893:	8d 5d d0             	lea    -0x30(%ebp),%ebx
+80100896:	8d 75 f8             	lea    -0x8(%ebp),%esi
+  cprintf("lapicid %d: panic: ", lapicid());
+80100899:	e8 92 3f 00 00       	call   80104830 <lapicid>
+8010089e:	83 ec 08             	sub    $0x8,%esp
+801008a1:	50                   	push   %eax
+801008a2:	68 c3 b5 10 80       	push   $0x8010b5c3
+801008a7:	e8 04 03 00 00       	call   80100bb0 <cprintf>
+  cprintf(s);
+801008ac:	58                   	pop    %eax
+801008ad:	ff 75 08             	push   0x8(%ebp)
+801008b0:	e8 fb 02 00 00       	call   80100bb0 <cprintf>
+  cprintf("\n");
+801008b5:	c7 04 24 f3 bf 10 80 	movl   $0x8010bff3,(%esp)
+801008bc:	e8 ef 02 00 00       	call   80100bb0 <cprintf>
+  getcallerpcs(&s, pcs);
+801008c1:	8d 45 08             	lea    0x8(%ebp),%eax
+801008c4:	5a                   	pop    %edx
+801008c5:	59                   	pop    %ecx
+801008c6:	53                   	push   %ebx
+801008c7:	50                   	push   %eax
+801008c8:	e8 93 72 00 00       	call   80107b60 <getcallerpcs>
+  for(i=0; i<10; i++)
+801008cd:	83 c4 10             	add    $0x10,%esp
+    cprintf(" %p", pcs[i]);
+801008d0:	83 ec 08             	sub    $0x8,%esp
+801008d3:	ff 33                	push   (%ebx)
+  for(i=0; i<10; i++)
+801008d5:	83 c3 04             	add    $0x4,%ebx
+    cprintf(" %p", pcs[i]);
+801008d8:	68 d7 b5 10 80       	push   $0x8010b5d7
+801008dd:	e8 ce 02 00 00       	call   80100bb0 <cprintf>
+  for(i=0; i<10; i++)
+801008e2:	83 c4 10             	add    $0x10,%esp
+801008e5:	39 f3                	cmp    %esi,%ebx
+801008e7:	75 e7                	jne    801008d0 <panic+0x50>
+  panicked = 1; // freeze other CPU
+801008e9:	c7 05 78 62 11 80 01 	movl   $0x1,0x80116278
+801008f0:	00 00 00 
+  for(;;)
+801008f3:	eb fe                	jmp    801008f3 <panic+0x73>
+801008f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801008fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100900 <consputc.part.0>:
+consputc(int c)
+80100900:	55                   	push   %ebp
+80100901:	89 e5                	mov    %esp,%ebp
+80100903:	57                   	push   %edi
+80100904:	56                   	push   %esi
+80100905:	53                   	push   %ebx
+80100906:	83 ec 1c             	sub    $0x1c,%esp
+  if(c == BACKSPACE){
+80100909:	3d 00 01 00 00       	cmp    $0x100,%eax
+8010090e:	0f 84 cc 00 00 00    	je     801009e0 <consputc.part.0+0xe0>
+    uartputc(c);
+80100914:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100917:	bf d4 03 00 00       	mov    $0x3d4,%edi
+8010091c:	89 c3                	mov    %eax,%ebx
+8010091e:	50                   	push   %eax
+8010091f:	e8 ec 92 00 00       	call   80109c10 <uartputc>
+80100924:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100929:	89 fa                	mov    %edi,%edx
+8010092b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010092c:	be d5 03 00 00       	mov    $0x3d5,%esi
+80100931:	89 f2                	mov    %esi,%edx
+80100933:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+80100934:	0f b6 c8             	movzbl %al,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100937:	89 fa                	mov    %edi,%edx
+80100939:	b8 0f 00 00 00       	mov    $0xf,%eax
+8010093e:	c1 e1 08             	shl    $0x8,%ecx
+80100941:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100942:	89 f2                	mov    %esi,%edx
+80100944:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+80100945:	0f b6 c0             	movzbl %al,%eax
+  if(c == '\n')
+80100948:	83 c4 10             	add    $0x10,%esp
+  pos |= inb(CRTPORT+1);
+8010094b:	09 c8                	or     %ecx,%eax
+  if(c == '\n')
+8010094d:	83 fb 0a             	cmp    $0xa,%ebx
+80100950:	75 76                	jne    801009c8 <consputc.part.0+0xc8>
+    pos += 80 - pos%80;
+80100952:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+80100957:	f7 e2                	mul    %edx
+80100959:	c1 ea 06             	shr    $0x6,%edx
+8010095c:	8d 04 92             	lea    (%edx,%edx,4),%eax
+8010095f:	c1 e0 04             	shl    $0x4,%eax
+80100962:	8d 70 50             	lea    0x50(%eax),%esi
+  if(pos < 0 || pos > 25*80)
+80100965:	81 fe d0 07 00 00    	cmp    $0x7d0,%esi
+8010096b:	0f 8f 2f 01 00 00    	jg     80100aa0 <consputc.part.0+0x1a0>
+  if((pos/80) >= 24){  // Scroll up.
+80100971:	81 fe 7f 07 00 00    	cmp    $0x77f,%esi
+80100977:	0f 8f c3 00 00 00    	jg     80100a40 <consputc.part.0+0x140>
+  outb(CRTPORT+1, pos>>8);
+8010097d:	89 f0                	mov    %esi,%eax
+  crt[pos] = ' ' | 0x0700;
+8010097f:	8d b4 36 00 80 0b 80 	lea    -0x7ff48000(%esi,%esi,1),%esi
+  outb(CRTPORT+1, pos);
+80100986:	88 45 e7             	mov    %al,-0x19(%ebp)
+  outb(CRTPORT+1, pos>>8);
+80100989:	0f b6 fc             	movzbl %ah,%edi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010098c:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+80100991:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100996:	89 da                	mov    %ebx,%edx
+80100998:	ee                   	out    %al,(%dx)
+80100999:	b9 d5 03 00 00       	mov    $0x3d5,%ecx
+8010099e:	89 f8                	mov    %edi,%eax
+801009a0:	89 ca                	mov    %ecx,%edx
+801009a2:	ee                   	out    %al,(%dx)
+801009a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+801009a8:	89 da                	mov    %ebx,%edx
+801009aa:	ee                   	out    %al,(%dx)
+801009ab:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+801009af:	89 ca                	mov    %ecx,%edx
+801009b1:	ee                   	out    %al,(%dx)
+  crt[pos] = ' ' | 0x0700;
+801009b2:	b8 20 07 00 00       	mov    $0x720,%eax
+801009b7:	66 89 06             	mov    %ax,(%esi)
+}
+801009ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801009bd:	5b                   	pop    %ebx
+801009be:	5e                   	pop    %esi
+801009bf:	5f                   	pop    %edi
+801009c0:	5d                   	pop    %ebp
+801009c1:	c3                   	ret
+801009c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    crt[pos++] = (c&0xff) | 0x0700;  // black on white
+801009c8:	0f b6 db             	movzbl %bl,%ebx
+801009cb:	8d 70 01             	lea    0x1(%eax),%esi
+801009ce:	80 cf 07             	or     $0x7,%bh
+801009d1:	66 89 9c 00 00 80 0b 	mov    %bx,-0x7ff48000(%eax,%eax,1)
+801009d8:	80 
+801009d9:	eb 8a                	jmp    80100965 <consputc.part.0+0x65>
+801009db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801009df:	90                   	nop
+    uartputc('\b'); uartputc(' '); uartputc('\b');
+801009e0:	83 ec 0c             	sub    $0xc,%esp
+801009e3:	be d4 03 00 00       	mov    $0x3d4,%esi
+801009e8:	6a 08                	push   $0x8
+801009ea:	e8 21 92 00 00       	call   80109c10 <uartputc>
+801009ef:	c7 04 24 20 00 00 00 	movl   $0x20,(%esp)
+801009f6:	e8 15 92 00 00       	call   80109c10 <uartputc>
+801009fb:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+80100a02:	e8 09 92 00 00       	call   80109c10 <uartputc>
+80100a07:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100a0c:	89 f2                	mov    %esi,%edx
+80100a0e:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100a0f:	bb d5 03 00 00       	mov    $0x3d5,%ebx
+80100a14:	89 da                	mov    %ebx,%edx
+80100a16:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+80100a17:	0f b6 c8             	movzbl %al,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100a1a:	89 f2                	mov    %esi,%edx
+80100a1c:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100a21:	c1 e1 08             	shl    $0x8,%ecx
+80100a24:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100a25:	89 da                	mov    %ebx,%edx
+80100a27:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+80100a28:	0f b6 f0             	movzbl %al,%esi
+    if(pos > 0) --pos;
+80100a2b:	83 c4 10             	add    $0x10,%esp
+80100a2e:	09 ce                	or     %ecx,%esi
+80100a30:	74 5e                	je     80100a90 <consputc.part.0+0x190>
+80100a32:	83 ee 01             	sub    $0x1,%esi
+80100a35:	e9 2b ff ff ff       	jmp    80100965 <consputc.part.0+0x65>
+80100a3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+80100a40:	83 ec 04             	sub    $0x4,%esp
+    pos -= 80;
+80100a43:	8d 5e b0             	lea    -0x50(%esi),%ebx
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+80100a46:	8d b4 36 60 7f 0b 80 	lea    -0x7ff480a0(%esi,%esi,1),%esi
+  outb(CRTPORT+1, pos);
+80100a4d:	bf 07 00 00 00       	mov    $0x7,%edi
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+80100a52:	68 60 0e 00 00       	push   $0xe60
+80100a57:	68 a0 80 0b 80       	push   $0x800b80a0
+80100a5c:	68 00 80 0b 80       	push   $0x800b8000
+80100a61:	e8 2a 74 00 00       	call   80107e90 <memmove>
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+80100a66:	b8 80 07 00 00       	mov    $0x780,%eax
+80100a6b:	83 c4 0c             	add    $0xc,%esp
+80100a6e:	29 d8                	sub    %ebx,%eax
+80100a70:	01 c0                	add    %eax,%eax
+80100a72:	50                   	push   %eax
+80100a73:	6a 00                	push   $0x0
+80100a75:	56                   	push   %esi
+80100a76:	e8 85 73 00 00       	call   80107e00 <memset>
+  outb(CRTPORT+1, pos);
+80100a7b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+80100a7e:	83 c4 10             	add    $0x10,%esp
+80100a81:	e9 06 ff ff ff       	jmp    8010098c <consputc.part.0+0x8c>
+80100a86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100a8d:	8d 76 00             	lea    0x0(%esi),%esi
+80100a90:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+80100a94:	be 00 80 0b 80       	mov    $0x800b8000,%esi
+80100a99:	31 ff                	xor    %edi,%edi
+80100a9b:	e9 ec fe ff ff       	jmp    8010098c <consputc.part.0+0x8c>
+    panic("pos under/overflow");
+80100aa0:	83 ec 0c             	sub    $0xc,%esp
+80100aa3:	68 db b5 10 80       	push   $0x8010b5db
+80100aa8:	e8 d3 fd ff ff       	call   80100880 <panic>
+80100aad:	8d 76 00             	lea    0x0(%esi),%esi
+
+80100ab0 <consolewrite>:
+
+int
+consolewrite(struct inode *ip, char *buf, int n)
+{
+80100ab0:	55                   	push   %ebp
+80100ab1:	89 e5                	mov    %esp,%ebp
+80100ab3:	57                   	push   %edi
+80100ab4:	56                   	push   %esi
+80100ab5:	53                   	push   %ebx
+80100ab6:	83 ec 18             	sub    $0x18,%esp
+80100ab9:	8b 75 10             	mov    0x10(%ebp),%esi
+  int i;
+
+  iunlock(ip);
+80100abc:	ff 75 08             	push   0x8(%ebp)
+80100abf:	e8 7c 1e 00 00       	call   80102940 <iunlock>
+  acquire(&cons.lock);
+80100ac4:	c7 04 24 40 62 11 80 	movl   $0x80116240,(%esp)
+80100acb:	e8 50 72 00 00       	call   80107d20 <acquire>
+  for(i = 0; i < n; i++)
+80100ad0:	83 c4 10             	add    $0x10,%esp
+80100ad3:	85 f6                	test   %esi,%esi
+80100ad5:	7e 25                	jle    80100afc <consolewrite+0x4c>
+80100ad7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+80100ada:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+  if(panicked){
+80100add:	8b 15 78 62 11 80    	mov    0x80116278,%edx
+    consputc(buf[i] & 0xff);
+80100ae3:	0f b6 03             	movzbl (%ebx),%eax
+  if(panicked){
+80100ae6:	85 d2                	test   %edx,%edx
+80100ae8:	74 06                	je     80100af0 <consolewrite+0x40>
+  asm volatile("cli");
+80100aea:	fa                   	cli
+    for(;;)
+80100aeb:	eb fe                	jmp    80100aeb <consolewrite+0x3b>
+80100aed:	8d 76 00             	lea    0x0(%esi),%esi
+80100af0:	e8 0b fe ff ff       	call   80100900 <consputc.part.0>
+  for(i = 0; i < n; i++)
+80100af5:	83 c3 01             	add    $0x1,%ebx
+80100af8:	39 df                	cmp    %ebx,%edi
+80100afa:	75 e1                	jne    80100add <consolewrite+0x2d>
+  release(&cons.lock);
+80100afc:	83 ec 0c             	sub    $0xc,%esp
+80100aff:	68 40 62 11 80       	push   $0x80116240
+80100b04:	e8 b7 71 00 00       	call   80107cc0 <release>
+  ilock(ip);
+80100b09:	58                   	pop    %eax
+80100b0a:	ff 75 08             	push   0x8(%ebp)
+80100b0d:	e8 4e 1d 00 00       	call   80102860 <ilock>
+
+  return n;
+}
+80100b12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100b15:	89 f0                	mov    %esi,%eax
+80100b17:	5b                   	pop    %ebx
+80100b18:	5e                   	pop    %esi
+80100b19:	5f                   	pop    %edi
+80100b1a:	5d                   	pop    %ebp
+80100b1b:	c3                   	ret
+80100b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100b20 <printint>:
+{
+80100b20:	55                   	push   %ebp
+80100b21:	89 e5                	mov    %esp,%ebp
+80100b23:	57                   	push   %edi
+80100b24:	56                   	push   %esi
+80100b25:	89 c6                	mov    %eax,%esi
+80100b27:	53                   	push   %ebx
+80100b28:	89 d3                	mov    %edx,%ebx
+80100b2a:	83 ec 2c             	sub    $0x2c,%esp
+  if(sign && (sign = xx < 0))
+80100b2d:	85 c9                	test   %ecx,%ecx
+80100b2f:	74 04                	je     80100b35 <printint+0x15>
+80100b31:	85 c0                	test   %eax,%eax
+80100b33:	78 63                	js     80100b98 <printint+0x78>
+    x = xx;
+80100b35:	89 f1                	mov    %esi,%ecx
+80100b37:	31 c0                	xor    %eax,%eax
+  i = 0;
+80100b39:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+80100b3c:	31 f6                	xor    %esi,%esi
+80100b3e:	66 90                	xchg   %ax,%ax
+    buf[i++] = digits[x % base];
+80100b40:	89 c8                	mov    %ecx,%eax
+80100b42:	31 d2                	xor    %edx,%edx
+80100b44:	89 f7                	mov    %esi,%edi
+80100b46:	f7 f3                	div    %ebx
+80100b48:	8d 76 01             	lea    0x1(%esi),%esi
+80100b4b:	0f b6 92 28 b6 10 80 	movzbl -0x7fef49d8(%edx),%edx
+80100b52:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+80100b56:	89 ca                	mov    %ecx,%edx
+80100b58:	89 c1                	mov    %eax,%ecx
+80100b5a:	39 da                	cmp    %ebx,%edx
+80100b5c:	73 e2                	jae    80100b40 <printint+0x20>
+  if(sign)
+80100b5e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80100b61:	85 c0                	test   %eax,%eax
+80100b63:	74 07                	je     80100b6c <printint+0x4c>
+    buf[i++] = '-';
+80100b65:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+80100b6a:	89 f7                	mov    %esi,%edi
+80100b6c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+80100b6f:	01 df                	add    %ebx,%edi
+  if(panicked){
+80100b71:	8b 15 78 62 11 80    	mov    0x80116278,%edx
+    consputc(buf[i]);
+80100b77:	0f be 07             	movsbl (%edi),%eax
+  if(panicked){
+80100b7a:	85 d2                	test   %edx,%edx
+80100b7c:	74 0a                	je     80100b88 <printint+0x68>
+80100b7e:	fa                   	cli
+    for(;;)
+80100b7f:	eb fe                	jmp    80100b7f <printint+0x5f>
+80100b81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100b88:	e8 73 fd ff ff       	call   80100900 <consputc.part.0>
+  while(--i >= 0)
+80100b8d:	8d 47 ff             	lea    -0x1(%edi),%eax
+80100b90:	39 df                	cmp    %ebx,%edi
+80100b92:	74 0c                	je     80100ba0 <printint+0x80>
+80100b94:	89 c7                	mov    %eax,%edi
+80100b96:	eb d9                	jmp    80100b71 <printint+0x51>
+80100b98:	89 c8                	mov    %ecx,%eax
+    x = -xx;
+80100b9a:	89 f1                	mov    %esi,%ecx
+80100b9c:	f7 d9                	neg    %ecx
+80100b9e:	eb 99                	jmp    80100b39 <printint+0x19>
+}
+80100ba0:	83 c4 2c             	add    $0x2c,%esp
+80100ba3:	5b                   	pop    %ebx
+80100ba4:	5e                   	pop    %esi
+80100ba5:	5f                   	pop    %edi
+80100ba6:	5d                   	pop    %ebp
+80100ba7:	c3                   	ret
+80100ba8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100baf:	90                   	nop
+
+80100bb0 <cprintf>:
+{
+80100bb0:	55                   	push   %ebp
+80100bb1:	89 e5                	mov    %esp,%ebp
+80100bb3:	57                   	push   %edi
+80100bb4:	56                   	push   %esi
+80100bb5:	53                   	push   %ebx
+80100bb6:	83 ec 1c             	sub    $0x1c,%esp
+  locking = cons.locking;
+80100bb9:	8b 3d 74 62 11 80    	mov    0x80116274,%edi
+  if (fmt == 0)
+80100bbf:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(locking)
+80100bc2:	85 ff                	test   %edi,%edi
+80100bc4:	0f 85 36 01 00 00    	jne    80100d00 <cprintf+0x150>
+  if (fmt == 0)
+80100bca:	85 f6                	test   %esi,%esi
+80100bcc:	0f 84 e0 01 00 00    	je     80100db2 <cprintf+0x202>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100bd2:	0f b6 06             	movzbl (%esi),%eax
+80100bd5:	85 c0                	test   %eax,%eax
+80100bd7:	74 6b                	je     80100c44 <cprintf+0x94>
+  argp = (uint*)(void*)(&fmt + 1);
+80100bd9:	8d 55 0c             	lea    0xc(%ebp),%edx
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100bdc:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80100bdf:	31 db                	xor    %ebx,%ebx
+80100be1:	89 d7                	mov    %edx,%edi
+    if(c != '%'){
+80100be3:	83 f8 25             	cmp    $0x25,%eax
+80100be6:	0f 85 dc 00 00 00    	jne    80100cc8 <cprintf+0x118>
+    c = fmt[++i] & 0xff;
+80100bec:	83 c3 01             	add    $0x1,%ebx
+80100bef:	0f b6 0c 1e          	movzbl (%esi,%ebx,1),%ecx
+    if(c == 0)
+80100bf3:	85 c9                	test   %ecx,%ecx
+80100bf5:	74 42                	je     80100c39 <cprintf+0x89>
+    switch(c){
+80100bf7:	83 f9 70             	cmp    $0x70,%ecx
+80100bfa:	0f 84 99 00 00 00    	je     80100c99 <cprintf+0xe9>
+80100c00:	7f 4e                	jg     80100c50 <cprintf+0xa0>
+80100c02:	83 f9 25             	cmp    $0x25,%ecx
+80100c05:	0f 84 cd 00 00 00    	je     80100cd8 <cprintf+0x128>
+80100c0b:	83 f9 64             	cmp    $0x64,%ecx
+80100c0e:	0f 85 24 01 00 00    	jne    80100d38 <cprintf+0x188>
+      printint(*argp++, 10, 1);
+80100c14:	8d 47 04             	lea    0x4(%edi),%eax
+80100c17:	b9 01 00 00 00       	mov    $0x1,%ecx
+80100c1c:	ba 0a 00 00 00       	mov    $0xa,%edx
+80100c21:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80100c24:	8b 07                	mov    (%edi),%eax
+80100c26:	e8 f5 fe ff ff       	call   80100b20 <printint>
+80100c2b:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100c2e:	83 c3 01             	add    $0x1,%ebx
+80100c31:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+80100c35:	85 c0                	test   %eax,%eax
+80100c37:	75 aa                	jne    80100be3 <cprintf+0x33>
+80100c39:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  if(locking)
+80100c3c:	85 ff                	test   %edi,%edi
+80100c3e:	0f 85 df 00 00 00    	jne    80100d23 <cprintf+0x173>
+}
+80100c44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100c47:	5b                   	pop    %ebx
+80100c48:	5e                   	pop    %esi
+80100c49:	5f                   	pop    %edi
+80100c4a:	5d                   	pop    %ebp
+80100c4b:	c3                   	ret
+80100c4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+80100c50:	83 f9 73             	cmp    $0x73,%ecx
+80100c53:	75 3b                	jne    80100c90 <cprintf+0xe0>
+      if((s = (char*)*argp++) == 0)
+80100c55:	8b 17                	mov    (%edi),%edx
+80100c57:	8d 47 04             	lea    0x4(%edi),%eax
+80100c5a:	85 d2                	test   %edx,%edx
+80100c5c:	0f 85 0e 01 00 00    	jne    80100d70 <cprintf+0x1c0>
+80100c62:	b9 28 00 00 00       	mov    $0x28,%ecx
+        s = "(null)";
+80100c67:	bf ee b5 10 80       	mov    $0x8010b5ee,%edi
+80100c6c:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+80100c6f:	89 fb                	mov    %edi,%ebx
+80100c71:	89 f7                	mov    %esi,%edi
+80100c73:	89 c6                	mov    %eax,%esi
+80100c75:	0f be c1             	movsbl %cl,%eax
+  if(panicked){
+80100c78:	8b 15 78 62 11 80    	mov    0x80116278,%edx
+80100c7e:	85 d2                	test   %edx,%edx
+80100c80:	0f 84 fe 00 00 00    	je     80100d84 <cprintf+0x1d4>
+80100c86:	fa                   	cli
+    for(;;)
+80100c87:	eb fe                	jmp    80100c87 <cprintf+0xd7>
+80100c89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+80100c90:	83 f9 78             	cmp    $0x78,%ecx
+80100c93:	0f 85 9f 00 00 00    	jne    80100d38 <cprintf+0x188>
+      printint(*argp++, 16, 0);
+80100c99:	8d 47 04             	lea    0x4(%edi),%eax
+80100c9c:	31 c9                	xor    %ecx,%ecx
+80100c9e:	ba 10 00 00 00       	mov    $0x10,%edx
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100ca3:	83 c3 01             	add    $0x1,%ebx
+      printint(*argp++, 16, 0);
+80100ca6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80100ca9:	8b 07                	mov    (%edi),%eax
+80100cab:	e8 70 fe ff ff       	call   80100b20 <printint>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100cb0:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+      printint(*argp++, 16, 0);
+80100cb4:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100cb7:	85 c0                	test   %eax,%eax
+80100cb9:	0f 85 24 ff ff ff    	jne    80100be3 <cprintf+0x33>
+80100cbf:	e9 75 ff ff ff       	jmp    80100c39 <cprintf+0x89>
+80100cc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(panicked){
+80100cc8:	8b 0d 78 62 11 80    	mov    0x80116278,%ecx
+80100cce:	85 c9                	test   %ecx,%ecx
+80100cd0:	74 15                	je     80100ce7 <cprintf+0x137>
+80100cd2:	fa                   	cli
+    for(;;)
+80100cd3:	eb fe                	jmp    80100cd3 <cprintf+0x123>
+80100cd5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(panicked){
+80100cd8:	8b 0d 78 62 11 80    	mov    0x80116278,%ecx
+80100cde:	85 c9                	test   %ecx,%ecx
+80100ce0:	75 7e                	jne    80100d60 <cprintf+0x1b0>
+80100ce2:	b8 25 00 00 00       	mov    $0x25,%eax
+80100ce7:	e8 14 fc ff ff       	call   80100900 <consputc.part.0>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100cec:	83 c3 01             	add    $0x1,%ebx
+80100cef:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+80100cf3:	85 c0                	test   %eax,%eax
+80100cf5:	0f 85 e8 fe ff ff    	jne    80100be3 <cprintf+0x33>
+80100cfb:	e9 39 ff ff ff       	jmp    80100c39 <cprintf+0x89>
+    acquire(&cons.lock);
+80100d00:	83 ec 0c             	sub    $0xc,%esp
+80100d03:	68 40 62 11 80       	push   $0x80116240
+80100d08:	e8 13 70 00 00       	call   80107d20 <acquire>
+  if (fmt == 0)
+80100d0d:	83 c4 10             	add    $0x10,%esp
+80100d10:	85 f6                	test   %esi,%esi
+80100d12:	0f 84 9a 00 00 00    	je     80100db2 <cprintf+0x202>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100d18:	0f b6 06             	movzbl (%esi),%eax
+80100d1b:	85 c0                	test   %eax,%eax
+80100d1d:	0f 85 b6 fe ff ff    	jne    80100bd9 <cprintf+0x29>
+    release(&cons.lock);
+80100d23:	83 ec 0c             	sub    $0xc,%esp
+80100d26:	68 40 62 11 80       	push   $0x80116240
+80100d2b:	e8 90 6f 00 00       	call   80107cc0 <release>
+80100d30:	83 c4 10             	add    $0x10,%esp
+80100d33:	e9 0c ff ff ff       	jmp    80100c44 <cprintf+0x94>
+  if(panicked){
+80100d38:	8b 15 78 62 11 80    	mov    0x80116278,%edx
+80100d3e:	85 d2                	test   %edx,%edx
+80100d40:	75 26                	jne    80100d68 <cprintf+0x1b8>
+80100d42:	b8 25 00 00 00       	mov    $0x25,%eax
+80100d47:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+80100d4a:	e8 b1 fb ff ff       	call   80100900 <consputc.part.0>
+80100d4f:	a1 78 62 11 80       	mov    0x80116278,%eax
+80100d54:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80100d57:	85 c0                	test   %eax,%eax
+80100d59:	74 4b                	je     80100da6 <cprintf+0x1f6>
+80100d5b:	fa                   	cli
+    for(;;)
+80100d5c:	eb fe                	jmp    80100d5c <cprintf+0x1ac>
+80100d5e:	66 90                	xchg   %ax,%ax
+80100d60:	fa                   	cli
+80100d61:	eb fe                	jmp    80100d61 <cprintf+0x1b1>
+80100d63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100d67:	90                   	nop
+80100d68:	fa                   	cli
+80100d69:	eb fe                	jmp    80100d69 <cprintf+0x1b9>
+80100d6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100d6f:	90                   	nop
+      for(; *s; s++)
+80100d70:	0f b6 0a             	movzbl (%edx),%ecx
+      if((s = (char*)*argp++) == 0)
+80100d73:	89 d7                	mov    %edx,%edi
+      for(; *s; s++)
+80100d75:	84 c9                	test   %cl,%cl
+80100d77:	0f 85 ef fe ff ff    	jne    80100c6c <cprintf+0xbc>
+      if((s = (char*)*argp++) == 0)
+80100d7d:	89 c7                	mov    %eax,%edi
+80100d7f:	e9 aa fe ff ff       	jmp    80100c2e <cprintf+0x7e>
+80100d84:	e8 77 fb ff ff       	call   80100900 <consputc.part.0>
+      for(; *s; s++)
+80100d89:	0f be 43 01          	movsbl 0x1(%ebx),%eax
+80100d8d:	83 c3 01             	add    $0x1,%ebx
+80100d90:	84 c0                	test   %al,%al
+80100d92:	0f 85 e0 fe ff ff    	jne    80100c78 <cprintf+0xc8>
+      if((s = (char*)*argp++) == 0)
+80100d98:	89 f0                	mov    %esi,%eax
+80100d9a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80100d9d:	89 fe                	mov    %edi,%esi
+80100d9f:	89 c7                	mov    %eax,%edi
+80100da1:	e9 88 fe ff ff       	jmp    80100c2e <cprintf+0x7e>
+80100da6:	89 c8                	mov    %ecx,%eax
+80100da8:	e8 53 fb ff ff       	call   80100900 <consputc.part.0>
+80100dad:	e9 7c fe ff ff       	jmp    80100c2e <cprintf+0x7e>
+    panic("null fmt");
+80100db2:	83 ec 0c             	sub    $0xc,%esp
+80100db5:	68 f5 b5 10 80       	push   $0x8010b5f5
+80100dba:	e8 c1 fa ff ff       	call   80100880 <panic>
+80100dbf:	90                   	nop
+
+80100dc0 <consoleintr>:
+{
+80100dc0:	55                   	push   %ebp
+80100dc1:	89 e5                	mov    %esp,%ebp
+80100dc3:	57                   	push   %edi
+80100dc4:	56                   	push   %esi
+  int c, doprocdump = 0;
+80100dc5:	31 f6                	xor    %esi,%esi
+{
+80100dc7:	53                   	push   %ebx
+80100dc8:	83 ec 18             	sub    $0x18,%esp
+80100dcb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  acquire(&cons.lock);
+80100dce:	68 40 62 11 80       	push   $0x80116240
+80100dd3:	e8 48 6f 00 00       	call   80107d20 <acquire>
+  while((c = getc()) >= 0){
+80100dd8:	83 c4 10             	add    $0x10,%esp
+80100ddb:	eb 1a                	jmp    80100df7 <consoleintr+0x37>
+80100ddd:	8d 76 00             	lea    0x0(%esi),%esi
+    switch(c){
+80100de0:	83 fb 08             	cmp    $0x8,%ebx
+80100de3:	0f 84 d7 00 00 00    	je     80100ec0 <consoleintr+0x100>
+80100de9:	83 fb 10             	cmp    $0x10,%ebx
+80100dec:	0f 85 3d 01 00 00    	jne    80100f2f <consoleintr+0x16f>
+80100df2:	be 01 00 00 00       	mov    $0x1,%esi
+  while((c = getc()) >= 0){
+80100df7:	ff d7                	call   *%edi
+80100df9:	89 c3                	mov    %eax,%ebx
+80100dfb:	85 c0                	test   %eax,%eax
+80100dfd:	0f 88 e5 00 00 00    	js     80100ee8 <consoleintr+0x128>
+    switch(c){
+80100e03:	83 fb 15             	cmp    $0x15,%ebx
+80100e06:	74 7a                	je     80100e82 <consoleintr+0xc2>
+80100e08:	7e d6                	jle    80100de0 <consoleintr+0x20>
+80100e0a:	83 fb 7f             	cmp    $0x7f,%ebx
+80100e0d:	0f 84 ad 00 00 00    	je     80100ec0 <consoleintr+0x100>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+80100e13:	a1 28 62 11 80       	mov    0x80116228,%eax
+80100e18:	89 c2                	mov    %eax,%edx
+80100e1a:	2b 15 20 62 11 80    	sub    0x80116220,%edx
+80100e20:	83 fa 7f             	cmp    $0x7f,%edx
+80100e23:	77 d2                	ja     80100df7 <consoleintr+0x37>
+  if(panicked){
+80100e25:	8b 15 78 62 11 80    	mov    0x80116278,%edx
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100e2b:	8d 48 01             	lea    0x1(%eax),%ecx
+80100e2e:	83 e0 7f             	and    $0x7f,%eax
+80100e31:	89 0d 28 62 11 80    	mov    %ecx,0x80116228
+80100e37:	88 98 a0 61 11 80    	mov    %bl,-0x7fee9e60(%eax)
+  if(panicked){
+80100e3d:	85 d2                	test   %edx,%edx
+80100e3f:	0f 85 57 01 00 00    	jne    80100f9c <consoleintr+0x1dc>
+80100e45:	89 d8                	mov    %ebx,%eax
+80100e47:	e8 b4 fa ff ff       	call   80100900 <consputc.part.0>
+        if(c == '\n' || c == C('D') || input.e == input.r+INPUT_BUF){
+80100e4c:	83 fb 0a             	cmp    $0xa,%ebx
+80100e4f:	0f 84 28 01 00 00    	je     80100f7d <consoleintr+0x1bd>
+80100e55:	83 fb 04             	cmp    $0x4,%ebx
+80100e58:	0f 84 1f 01 00 00    	je     80100f7d <consoleintr+0x1bd>
+80100e5e:	a1 20 62 11 80       	mov    0x80116220,%eax
+80100e63:	83 e8 80             	sub    $0xffffff80,%eax
+80100e66:	39 05 28 62 11 80    	cmp    %eax,0x80116228
+80100e6c:	75 89                	jne    80100df7 <consoleintr+0x37>
+80100e6e:	e9 0f 01 00 00       	jmp    80100f82 <consoleintr+0x1c2>
+80100e73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100e77:	90                   	nop
+80100e78:	b8 00 01 00 00       	mov    $0x100,%eax
+80100e7d:	e8 7e fa ff ff       	call   80100900 <consputc.part.0>
+      while(input.e != input.w &&
+80100e82:	a1 28 62 11 80       	mov    0x80116228,%eax
+80100e87:	3b 05 24 62 11 80    	cmp    0x80116224,%eax
+80100e8d:	0f 84 64 ff ff ff    	je     80100df7 <consoleintr+0x37>
+            input.buf[(input.e-1) % INPUT_BUF] != '\n'){
+80100e93:	83 e8 01             	sub    $0x1,%eax
+80100e96:	89 c2                	mov    %eax,%edx
+80100e98:	83 e2 7f             	and    $0x7f,%edx
+      while(input.e != input.w &&
+80100e9b:	80 ba a0 61 11 80 0a 	cmpb   $0xa,-0x7fee9e60(%edx)
+80100ea2:	0f 84 4f ff ff ff    	je     80100df7 <consoleintr+0x37>
+  if(panicked){
+80100ea8:	8b 15 78 62 11 80    	mov    0x80116278,%edx
+        input.e--;
+80100eae:	a3 28 62 11 80       	mov    %eax,0x80116228
+  if(panicked){
+80100eb3:	85 d2                	test   %edx,%edx
+80100eb5:	74 c1                	je     80100e78 <consoleintr+0xb8>
+80100eb7:	fa                   	cli
+    for(;;)
+80100eb8:	eb fe                	jmp    80100eb8 <consoleintr+0xf8>
+80100eba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(input.e != input.w){
+80100ec0:	a1 28 62 11 80       	mov    0x80116228,%eax
+80100ec5:	3b 05 24 62 11 80    	cmp    0x80116224,%eax
+80100ecb:	0f 84 26 ff ff ff    	je     80100df7 <consoleintr+0x37>
+        input.e--;
+80100ed1:	83 e8 01             	sub    $0x1,%eax
+80100ed4:	a3 28 62 11 80       	mov    %eax,0x80116228
+  if(panicked){
+80100ed9:	a1 78 62 11 80       	mov    0x80116278,%eax
+80100ede:	85 c0                	test   %eax,%eax
+80100ee0:	74 22                	je     80100f04 <consoleintr+0x144>
+80100ee2:	fa                   	cli
+    for(;;)
+80100ee3:	eb fe                	jmp    80100ee3 <consoleintr+0x123>
+80100ee5:	8d 76 00             	lea    0x0(%esi),%esi
+  release(&cons.lock);
+80100ee8:	83 ec 0c             	sub    $0xc,%esp
+80100eeb:	68 40 62 11 80       	push   $0x80116240
+80100ef0:	e8 cb 6d 00 00       	call   80107cc0 <release>
+  if(doprocdump){
+80100ef5:	83 c4 10             	add    $0x10,%esp
+80100ef8:	85 f6                	test   %esi,%esi
+80100efa:	75 17                	jne    80100f13 <consoleintr+0x153>
+}
+80100efc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100eff:	5b                   	pop    %ebx
+80100f00:	5e                   	pop    %esi
+80100f01:	5f                   	pop    %edi
+80100f02:	5d                   	pop    %ebp
+80100f03:	c3                   	ret
+80100f04:	b8 00 01 00 00       	mov    $0x100,%eax
+80100f09:	e8 f2 f9 ff ff       	call   80100900 <consputc.part.0>
+80100f0e:	e9 e4 fe ff ff       	jmp    80100df7 <consoleintr+0x37>
+    cprintf("PID STATE NAME  prio=E(base=B)\n");
+80100f13:	83 ec 0c             	sub    $0xc,%esp
+80100f16:	68 08 b6 10 80       	push   $0x8010b608
+80100f1b:	e8 90 fc ff ff       	call   80100bb0 <cprintf>
+    procdump();  // now call procdump() w/o cons.lock held
+80100f20:	83 c4 10             	add    $0x10,%esp
+}
+80100f23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100f26:	5b                   	pop    %ebx
+80100f27:	5e                   	pop    %esi
+80100f28:	5f                   	pop    %edi
+80100f29:	5d                   	pop    %ebp
+    procdump();  // now call procdump() w/o cons.lock held
+80100f2a:	e9 c1 66 00 00       	jmp    801075f0 <procdump>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+80100f2f:	85 db                	test   %ebx,%ebx
+80100f31:	0f 84 c0 fe ff ff    	je     80100df7 <consoleintr+0x37>
+80100f37:	a1 28 62 11 80       	mov    0x80116228,%eax
+80100f3c:	89 c2                	mov    %eax,%edx
+80100f3e:	2b 15 20 62 11 80    	sub    0x80116220,%edx
+80100f44:	83 fa 7f             	cmp    $0x7f,%edx
+80100f47:	0f 87 aa fe ff ff    	ja     80100df7 <consoleintr+0x37>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100f4d:	8d 48 01             	lea    0x1(%eax),%ecx
+  if(panicked){
+80100f50:	8b 15 78 62 11 80    	mov    0x80116278,%edx
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100f56:	83 e0 7f             	and    $0x7f,%eax
+        c = (c == '\r') ? '\n' : c;
+80100f59:	83 fb 0d             	cmp    $0xd,%ebx
+80100f5c:	0f 85 cf fe ff ff    	jne    80100e31 <consoleintr+0x71>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100f62:	89 0d 28 62 11 80    	mov    %ecx,0x80116228
+80100f68:	c6 80 a0 61 11 80 0a 	movb   $0xa,-0x7fee9e60(%eax)
+  if(panicked){
+80100f6f:	85 d2                	test   %edx,%edx
+80100f71:	75 29                	jne    80100f9c <consoleintr+0x1dc>
+80100f73:	b8 0a 00 00 00       	mov    $0xa,%eax
+80100f78:	e8 83 f9 ff ff       	call   80100900 <consputc.part.0>
+          input.w = input.e;
+80100f7d:	a1 28 62 11 80       	mov    0x80116228,%eax
+          wakeup(&input.r);
+80100f82:	83 ec 0c             	sub    $0xc,%esp
+          input.w = input.e;
+80100f85:	a3 24 62 11 80       	mov    %eax,0x80116224
+          wakeup(&input.r);
+80100f8a:	68 20 62 11 80       	push   $0x80116220
+80100f8f:	e8 5c 65 00 00       	call   801074f0 <wakeup>
+80100f94:	83 c4 10             	add    $0x10,%esp
+80100f97:	e9 5b fe ff ff       	jmp    80100df7 <consoleintr+0x37>
+80100f9c:	fa                   	cli
+    for(;;)
+80100f9d:	eb fe                	jmp    80100f9d <consoleintr+0x1dd>
+80100f9f:	90                   	nop
+
+80100fa0 <consoleinit>:
+
+void
+consoleinit(void)
+{
+80100fa0:	55                   	push   %ebp
+80100fa1:	89 e5                	mov    %esp,%ebp
+80100fa3:	83 ec 10             	sub    $0x10,%esp
+  initlock(&cons.lock, "console");
+80100fa6:	68 fe b5 10 80       	push   $0x8010b5fe
+80100fab:	68 40 62 11 80       	push   $0x80116240
+80100fb0:	e8 8b 6b 00 00       	call   80107b40 <initlock>
+
+  devsw[CONSOLE].write = consolewrite;
+80100fb5:	c7 05 ec 70 11 80 b0 	movl   $0x80100ab0,0x801170ec
+80100fbc:	0a 10 80 
+  devsw[CONSOLE].read = consoleread;
+80100fbf:	c7 05 e8 70 11 80 80 	movl   $0x80100780,0x801170e8
+80100fc6:	07 10 80 
+  cons.locking = 1;
+80100fc9:	c7 05 74 62 11 80 01 	movl   $0x1,0x80116274
+80100fd0:	00 00 00 
+
+  ioapicenable(IRQ_KBD, 0);
+80100fd3:	58                   	pop    %eax
+80100fd4:	5a                   	pop    %edx
+80100fd5:	6a 00                	push   $0x0
+80100fd7:	6a 01                	push   $0x1
+80100fd9:	e8 02 2f 00 00       	call   80103ee0 <ioapicenable>
+}
+80100fde:	83 c4 10             	add    $0x10,%esp
+80100fe1:	c9                   	leave
+80100fe2:	c3                   	ret
+80100fe3:	66 90                	xchg   %ax,%ax
+80100fe5:	66 90                	xchg   %ax,%ax
+80100fe7:	66 90                	xchg   %ax,%ax
+80100fe9:	66 90                	xchg   %ax,%ax
+80100feb:	66 90                	xchg   %ax,%ax
+80100fed:	66 90                	xchg   %ax,%ax
+80100fef:	90                   	nop
+
+80100ff0 <exec>:
+#include "x86.h"
+#include "elf.h"
+
+int
+exec(char *path, char **argv)
+{
+80100ff0:	55                   	push   %ebp
+80100ff1:	89 e5                	mov    %esp,%ebp
+80100ff3:	57                   	push   %edi
+80100ff4:	56                   	push   %esi
+80100ff5:	53                   	push   %ebx
+80100ff6:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+  uint argc, sz, sp, ustack[3+MAXARG+1];
+  struct elfhdr elf;
+  struct inode *ip;
+  struct proghdr ph;
+  pde_t *pgdir, *oldpgdir;
+  struct proc *curproc = myproc();
+80100ffc:	e8 4f 55 00 00       	call   80106550 <myproc>
+80101001:	89 85 ec fe ff ff    	mov    %eax,-0x114(%ebp)
+
+  begin_op();
+80101007:	e8 54 3f 00 00       	call   80104f60 <begin_op>
+
+  if((ip = namei(path)) == 0){
+8010100c:	83 ec 0c             	sub    $0xc,%esp
+8010100f:	ff 75 08             	push   0x8(%ebp)
+80101012:	e8 e9 25 00 00       	call   80103600 <namei>
+80101017:	83 c4 10             	add    $0x10,%esp
+8010101a:	85 c0                	test   %eax,%eax
+8010101c:	0f 84 33 03 00 00    	je     80101355 <exec+0x365>
+    end_op();
+    cprintf("exec: fail\n");
+    return -1;
+  }
+  ilock(ip);
+80101022:	83 ec 0c             	sub    $0xc,%esp
+80101025:	89 c7                	mov    %eax,%edi
+80101027:	50                   	push   %eax
+80101028:	e8 33 18 00 00       	call   80102860 <ilock>
+  pgdir = 0;
+
+  // Check ELF header
+  if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
+8010102d:	8d 85 24 ff ff ff    	lea    -0xdc(%ebp),%eax
+80101033:	6a 34                	push   $0x34
+80101035:	6a 00                	push   $0x0
+80101037:	50                   	push   %eax
+80101038:	57                   	push   %edi
+80101039:	e8 92 1b 00 00       	call   80102bd0 <readi>
+8010103e:	83 c4 20             	add    $0x20,%esp
+80101041:	83 f8 34             	cmp    $0x34,%eax
+80101044:	0f 85 01 01 00 00    	jne    8010114b <exec+0x15b>
+    goto bad;
+  if(elf.magic != ELF_MAGIC)
+8010104a:	81 bd 24 ff ff ff 7f 	cmpl   $0x464c457f,-0xdc(%ebp)
+80101051:	45 4c 46 
+80101054:	0f 85 f1 00 00 00    	jne    8010114b <exec+0x15b>
+    goto bad;
+
+  if((pgdir = setupkvm()) == 0)
+8010105a:	e8 21 9d 00 00       	call   8010ad80 <setupkvm>
+8010105f:	89 85 f4 fe ff ff    	mov    %eax,-0x10c(%ebp)
+80101065:	85 c0                	test   %eax,%eax
+80101067:	0f 84 de 00 00 00    	je     8010114b <exec+0x15b>
+    goto bad;
+
+  // Load program into memory.
+  sz = 0;
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+8010106d:	66 83 bd 50 ff ff ff 	cmpw   $0x0,-0xb0(%ebp)
+80101074:	00 
+80101075:	8b b5 40 ff ff ff    	mov    -0xc0(%ebp),%esi
+8010107b:	0f 84 a4 02 00 00    	je     80101325 <exec+0x335>
+  sz = 0;
+80101081:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+80101088:	00 00 00 
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+8010108b:	31 db                	xor    %ebx,%ebx
+8010108d:	e9 8c 00 00 00       	jmp    8010111e <exec+0x12e>
+80101092:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+      goto bad;
+    if(ph.type != ELF_PROG_LOAD)
+80101098:	83 bd 04 ff ff ff 01 	cmpl   $0x1,-0xfc(%ebp)
+8010109f:	75 6c                	jne    8010110d <exec+0x11d>
+      continue;
+    if(ph.memsz < ph.filesz)
+801010a1:	8b 85 18 ff ff ff    	mov    -0xe8(%ebp),%eax
+801010a7:	3b 85 14 ff ff ff    	cmp    -0xec(%ebp),%eax
+801010ad:	0f 82 87 00 00 00    	jb     8010113a <exec+0x14a>
+      goto bad;
+    if(ph.vaddr + ph.memsz < ph.vaddr)
+801010b3:	03 85 0c ff ff ff    	add    -0xf4(%ebp),%eax
+801010b9:	72 7f                	jb     8010113a <exec+0x14a>
+      goto bad;
+    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+801010bb:	83 ec 04             	sub    $0x4,%esp
+801010be:	50                   	push   %eax
+801010bf:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+801010c5:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+801010cb:	e8 e0 9a 00 00       	call   8010abb0 <allocuvm>
+801010d0:	83 c4 10             	add    $0x10,%esp
+801010d3:	89 85 f0 fe ff ff    	mov    %eax,-0x110(%ebp)
+801010d9:	85 c0                	test   %eax,%eax
+801010db:	74 5d                	je     8010113a <exec+0x14a>
+      goto bad;
+    if(ph.vaddr % PGSIZE != 0)
+801010dd:	8b 85 0c ff ff ff    	mov    -0xf4(%ebp),%eax
+801010e3:	a9 ff 0f 00 00       	test   $0xfff,%eax
+801010e8:	75 50                	jne    8010113a <exec+0x14a>
+      goto bad;
+    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+801010ea:	83 ec 0c             	sub    $0xc,%esp
+801010ed:	ff b5 14 ff ff ff    	push   -0xec(%ebp)
+801010f3:	ff b5 08 ff ff ff    	push   -0xf8(%ebp)
+801010f9:	57                   	push   %edi
+801010fa:	50                   	push   %eax
+801010fb:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80101101:	e8 da 99 00 00       	call   8010aae0 <loaduvm>
+80101106:	83 c4 20             	add    $0x20,%esp
+80101109:	85 c0                	test   %eax,%eax
+8010110b:	78 2d                	js     8010113a <exec+0x14a>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+8010110d:	0f b7 85 50 ff ff ff 	movzwl -0xb0(%ebp),%eax
+80101114:	83 c3 01             	add    $0x1,%ebx
+80101117:	83 c6 20             	add    $0x20,%esi
+8010111a:	39 d8                	cmp    %ebx,%eax
+8010111c:	7e 52                	jle    80101170 <exec+0x180>
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+8010111e:	8d 85 04 ff ff ff    	lea    -0xfc(%ebp),%eax
+80101124:	6a 20                	push   $0x20
+80101126:	56                   	push   %esi
+80101127:	50                   	push   %eax
+80101128:	57                   	push   %edi
+80101129:	e8 a2 1a 00 00       	call   80102bd0 <readi>
+8010112e:	83 c4 10             	add    $0x10,%esp
+80101131:	83 f8 20             	cmp    $0x20,%eax
+80101134:	0f 84 5e ff ff ff    	je     80101098 <exec+0xa8>
+  freevm(oldpgdir);
+  return 0;
+
+ bad:
+  if(pgdir)
+    freevm(pgdir);
+8010113a:	83 ec 0c             	sub    $0xc,%esp
+8010113d:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80101143:	e8 b8 9b 00 00       	call   8010ad00 <freevm>
+  if(ip){
+80101148:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+8010114b:	83 ec 0c             	sub    $0xc,%esp
+8010114e:	57                   	push   %edi
+8010114f:	e8 fc 19 00 00       	call   80102b50 <iunlockput>
+    end_op();
+80101154:	e8 a7 3e 00 00       	call   80105000 <end_op>
+80101159:	83 c4 10             	add    $0x10,%esp
+    return -1;
+8010115c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  }
+  return -1;
+}
+80101161:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101164:	5b                   	pop    %ebx
+80101165:	5e                   	pop    %esi
+80101166:	5f                   	pop    %edi
+80101167:	5d                   	pop    %ebp
+80101168:	c3                   	ret
+80101169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sz = PGROUNDUP(sz);
+80101170:	8b b5 f0 fe ff ff    	mov    -0x110(%ebp),%esi
+80101176:	81 c6 ff 0f 00 00    	add    $0xfff,%esi
+8010117c:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+80101182:	8d 9e 00 20 00 00    	lea    0x2000(%esi),%ebx
+  iunlockput(ip);
+80101188:	83 ec 0c             	sub    $0xc,%esp
+8010118b:	57                   	push   %edi
+8010118c:	e8 bf 19 00 00       	call   80102b50 <iunlockput>
+  end_op();
+80101191:	e8 6a 3e 00 00       	call   80105000 <end_op>
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+80101196:	83 c4 0c             	add    $0xc,%esp
+80101199:	53                   	push   %ebx
+8010119a:	56                   	push   %esi
+8010119b:	8b b5 f4 fe ff ff    	mov    -0x10c(%ebp),%esi
+801011a1:	56                   	push   %esi
+801011a2:	e8 09 9a 00 00       	call   8010abb0 <allocuvm>
+801011a7:	83 c4 10             	add    $0x10,%esp
+801011aa:	89 c7                	mov    %eax,%edi
+801011ac:	85 c0                	test   %eax,%eax
+801011ae:	0f 84 86 00 00 00    	je     8010123a <exec+0x24a>
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+801011b4:	83 ec 08             	sub    $0x8,%esp
+801011b7:	8d 80 00 e0 ff ff    	lea    -0x2000(%eax),%eax
+  for(argc = 0; argv[argc]; argc++) {
+801011bd:	89 fb                	mov    %edi,%ebx
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+801011bf:	50                   	push   %eax
+801011c0:	56                   	push   %esi
+  for(argc = 0; argv[argc]; argc++) {
+801011c1:	31 f6                	xor    %esi,%esi
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+801011c3:	e8 58 9c 00 00       	call   8010ae20 <clearpteu>
+  for(argc = 0; argv[argc]; argc++) {
+801011c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+801011cb:	83 c4 10             	add    $0x10,%esp
+801011ce:	8b 10                	mov    (%eax),%edx
+801011d0:	85 d2                	test   %edx,%edx
+801011d2:	0f 84 59 01 00 00    	je     80101331 <exec+0x341>
+801011d8:	89 bd f0 fe ff ff    	mov    %edi,-0x110(%ebp)
+801011de:	8b 7d 0c             	mov    0xc(%ebp),%edi
+801011e1:	eb 23                	jmp    80101206 <exec+0x216>
+801011e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801011e7:	90                   	nop
+801011e8:	8d 46 01             	lea    0x1(%esi),%eax
+    ustack[3+argc] = sp;
+801011eb:	89 9c b5 64 ff ff ff 	mov    %ebx,-0x9c(%ebp,%esi,4)
+801011f2:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+  for(argc = 0; argv[argc]; argc++) {
+801011f8:	8b 14 87             	mov    (%edi,%eax,4),%edx
+801011fb:	85 d2                	test   %edx,%edx
+801011fd:	74 51                	je     80101250 <exec+0x260>
+    if(argc >= MAXARG)
+801011ff:	83 f8 20             	cmp    $0x20,%eax
+80101202:	74 36                	je     8010123a <exec+0x24a>
+  for(argc = 0; argv[argc]; argc++) {
+80101204:	89 c6                	mov    %eax,%esi
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+80101206:	83 ec 0c             	sub    $0xc,%esp
+80101209:	52                   	push   %edx
+8010120a:	e8 e1 6d 00 00       	call   80107ff0 <strlen>
+8010120f:	29 c3                	sub    %eax,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+80101211:	58                   	pop    %eax
+80101212:	ff 34 b7             	push   (%edi,%esi,4)
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+80101215:	83 eb 01             	sub    $0x1,%ebx
+80101218:	83 e3 fc             	and    $0xfffffffc,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+8010121b:	e8 d0 6d 00 00       	call   80107ff0 <strlen>
+80101220:	83 c0 01             	add    $0x1,%eax
+80101223:	50                   	push   %eax
+80101224:	ff 34 b7             	push   (%edi,%esi,4)
+80101227:	53                   	push   %ebx
+80101228:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+8010122e:	e8 ad a1 00 00       	call   8010b3e0 <copyout>
+80101233:	83 c4 20             	add    $0x20,%esp
+80101236:	85 c0                	test   %eax,%eax
+80101238:	79 ae                	jns    801011e8 <exec+0x1f8>
+    freevm(pgdir);
+8010123a:	83 ec 0c             	sub    $0xc,%esp
+8010123d:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80101243:	e8 b8 9a 00 00       	call   8010ad00 <freevm>
+80101248:	83 c4 10             	add    $0x10,%esp
+8010124b:	e9 0c ff ff ff       	jmp    8010115c <exec+0x16c>
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80101250:	8d 14 b5 08 00 00 00 	lea    0x8(,%esi,4),%edx
+  ustack[3+argc] = 0;
+80101257:	8b bd f0 fe ff ff    	mov    -0x110(%ebp),%edi
+8010125d:	89 85 f0 fe ff ff    	mov    %eax,-0x110(%ebp)
+80101263:	8d 46 04             	lea    0x4(%esi),%eax
+  sp -= (3+argc+1) * 4;
+80101266:	8d 72 0c             	lea    0xc(%edx),%esi
+  ustack[3+argc] = 0;
+80101269:	c7 84 85 58 ff ff ff 	movl   $0x0,-0xa8(%ebp,%eax,4)
+80101270:	00 00 00 00 
+  ustack[1] = argc;
+80101274:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  ustack[0] = 0xffffffff;  // fake return PC
+8010127a:	c7 85 58 ff ff ff ff 	movl   $0xffffffff,-0xa8(%ebp)
+80101281:	ff ff ff 
+  ustack[1] = argc;
+80101284:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+8010128a:	89 d8                	mov    %ebx,%eax
+  sp -= (3+argc+1) * 4;
+8010128c:	29 f3                	sub    %esi,%ebx
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+8010128e:	29 d0                	sub    %edx,%eax
+80101290:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+  if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
+80101296:	56                   	push   %esi
+80101297:	51                   	push   %ecx
+80101298:	53                   	push   %ebx
+80101299:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+8010129f:	e8 3c a1 00 00       	call   8010b3e0 <copyout>
+801012a4:	83 c4 10             	add    $0x10,%esp
+801012a7:	85 c0                	test   %eax,%eax
+801012a9:	78 8f                	js     8010123a <exec+0x24a>
+  for(last=s=path; *s; s++)
+801012ab:	8b 45 08             	mov    0x8(%ebp),%eax
+801012ae:	8b 55 08             	mov    0x8(%ebp),%edx
+801012b1:	0f b6 00             	movzbl (%eax),%eax
+801012b4:	84 c0                	test   %al,%al
+801012b6:	74 17                	je     801012cf <exec+0x2df>
+801012b8:	89 d1                	mov    %edx,%ecx
+801012ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      last = s+1;
+801012c0:	83 c1 01             	add    $0x1,%ecx
+801012c3:	3c 2f                	cmp    $0x2f,%al
+  for(last=s=path; *s; s++)
+801012c5:	0f b6 01             	movzbl (%ecx),%eax
+      last = s+1;
+801012c8:	0f 44 d1             	cmove  %ecx,%edx
+  for(last=s=path; *s; s++)
+801012cb:	84 c0                	test   %al,%al
+801012cd:	75 f1                	jne    801012c0 <exec+0x2d0>
+  safestrcpy(curproc->name, last, sizeof(curproc->name));
+801012cf:	83 ec 04             	sub    $0x4,%esp
+801012d2:	6a 10                	push   $0x10
+801012d4:	52                   	push   %edx
+801012d5:	8b b5 ec fe ff ff    	mov    -0x114(%ebp),%esi
+801012db:	8d 86 88 00 00 00    	lea    0x88(%esi),%eax
+801012e1:	50                   	push   %eax
+801012e2:	e8 c9 6c 00 00       	call   80107fb0 <safestrcpy>
+  curproc->pgdir = pgdir;
+801012e7:	8b 8d f4 fe ff ff    	mov    -0x10c(%ebp),%ecx
+  oldpgdir = curproc->pgdir;
+801012ed:	89 f0                	mov    %esi,%eax
+801012ef:	8b 76 04             	mov    0x4(%esi),%esi
+  curproc->sz = sz;
+801012f2:	89 38                	mov    %edi,(%eax)
+  curproc->pgdir = pgdir;
+801012f4:	89 48 04             	mov    %ecx,0x4(%eax)
+  curproc->tf->eip = elf.entry;  // main
+801012f7:	89 c1                	mov    %eax,%ecx
+801012f9:	8b 95 3c ff ff ff    	mov    -0xc4(%ebp),%edx
+801012ff:	8b 40 28             	mov    0x28(%eax),%eax
+80101302:	89 50 38             	mov    %edx,0x38(%eax)
+  curproc->tf->esp = sp;
+80101305:	8b 41 28             	mov    0x28(%ecx),%eax
+80101308:	89 58 44             	mov    %ebx,0x44(%eax)
+  switchuvm(curproc);
+8010130b:	89 0c 24             	mov    %ecx,(%esp)
+8010130e:	e8 3d 96 00 00       	call   8010a950 <switchuvm>
+  freevm(oldpgdir);
+80101313:	89 34 24             	mov    %esi,(%esp)
+80101316:	e8 e5 99 00 00       	call   8010ad00 <freevm>
+  return 0;
+8010131b:	83 c4 10             	add    $0x10,%esp
+8010131e:	31 c0                	xor    %eax,%eax
+80101320:	e9 3c fe ff ff       	jmp    80101161 <exec+0x171>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80101325:	bb 00 20 00 00       	mov    $0x2000,%ebx
+8010132a:	31 f6                	xor    %esi,%esi
+8010132c:	e9 57 fe ff ff       	jmp    80101188 <exec+0x198>
+  for(argc = 0; argv[argc]; argc++) {
+80101331:	be 10 00 00 00       	mov    $0x10,%esi
+80101336:	ba 04 00 00 00       	mov    $0x4,%edx
+8010133b:	b8 03 00 00 00       	mov    $0x3,%eax
+80101340:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+80101347:	00 00 00 
+8010134a:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+80101350:	e9 14 ff ff ff       	jmp    80101269 <exec+0x279>
+    end_op();
+80101355:	e8 a6 3c 00 00       	call   80105000 <end_op>
+    cprintf("exec: fail\n");
+8010135a:	83 ec 0c             	sub    $0xc,%esp
+8010135d:	68 39 b6 10 80       	push   $0x8010b639
+80101362:	e8 49 f8 ff ff       	call   80100bb0 <cprintf>
+    return -1;
+80101367:	83 c4 10             	add    $0x10,%esp
+8010136a:	e9 ed fd ff ff       	jmp    8010115c <exec+0x16c>
+8010136f:	90                   	nop
+
+80101370 <fileinit>:
+  struct file file[NFILE];
+} ftable;
+
+void
+fileinit(void)
+{
+80101370:	55                   	push   %ebp
+80101371:	89 e5                	mov    %esp,%ebp
+80101373:	83 ec 10             	sub    $0x10,%esp
+  initlock(&ftable.lock, "ftable");
+80101376:	68 45 b6 10 80       	push   $0x8010b645
+8010137b:	68 80 62 11 80       	push   $0x80116280
+80101380:	e8 bb 67 00 00       	call   80107b40 <initlock>
+}
+80101385:	83 c4 10             	add    $0x10,%esp
+80101388:	c9                   	leave
+80101389:	c3                   	ret
+8010138a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80101390 <filealloc>:
+
+// Allocate a file structure.
+struct file*
+filealloc(void)
+{
+80101390:	55                   	push   %ebp
+80101391:	89 e5                	mov    %esp,%ebp
+80101393:	53                   	push   %ebx
+  struct file *f;
+
+  acquire(&ftable.lock);
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+80101394:	bb b4 62 11 80       	mov    $0x801162b4,%ebx
+{
+80101399:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ftable.lock);
+8010139c:	68 80 62 11 80       	push   $0x80116280
+801013a1:	e8 7a 69 00 00       	call   80107d20 <acquire>
+801013a6:	83 c4 10             	add    $0x10,%esp
+801013a9:	eb 10                	jmp    801013bb <filealloc+0x2b>
+801013ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801013af:	90                   	nop
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+801013b0:	83 c3 24             	add    $0x24,%ebx
+801013b3:	81 fb c4 70 11 80    	cmp    $0x801170c4,%ebx
+801013b9:	74 3a                	je     801013f5 <filealloc+0x65>
+    if(f->ref == 0){
+801013bb:	8b 43 04             	mov    0x4(%ebx),%eax
+801013be:	85 c0                	test   %eax,%eax
+801013c0:	75 ee                	jne    801013b0 <filealloc+0x20>
+      f->ref = 1;
+      f->raoff = f->rawin = f->raend = 0;
+      release(&ftable.lock);
+801013c2:	83 ec 0c             	sub    $0xc,%esp
+      f->ref = 1;
+801013c5:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+      f->raoff = f->rawin = f->raend = 0;
+801013cc:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+801013d3:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+801013da:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+      release(&ftable.lock);
+801013e1:	68 80 62 11 80       	push   $0x80116280
+801013e6:	e8 d5 68 00 00       	call   80107cc0 <release>
+      return f;
+    }
+  }
+  release(&ftable.lock);
+  return 0;
+}
+801013eb:	89 d8                	mov    %ebx,%eax
+      return f;
+801013ed:	83 c4 10             	add    $0x10,%esp
+}
+801013f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801013f3:	c9                   	leave
+801013f4:	c3                   	ret
+  release(&ftable.lock);
+801013f5:	83 ec 0c             	sub    $0xc,%esp
+  return 0;
+801013f8:	31 db                	xor    %ebx,%ebx
+  release(&ftable.lock);
+801013fa:	68 80 62 11 80       	push   $0x80116280
+801013ff:	e8 bc 68 00 00       	call   80107cc0 <release>
+}
+80101404:	89 d8                	mov    %ebx,%eax
+  return 0;
+80101406:	83 c4 10             	add    $0x10,%esp
+}
+80101409:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010140c:	c9                   	leave
+8010140d:	c3                   	ret
+8010140e:	66 90                	xchg   %ax,%ax
+
+80101410 <filedup>:
+
+// Increment ref count for file f.
+struct file*
+filedup(struct file *f)
+{
+80101410:	55                   	push   %ebp
+80101411:	89 e5                	mov    %esp,%ebp
+80101413:	53                   	push   %ebx
+80101414:	83 ec 10             	sub    $0x10,%esp
+80101417:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ftable.lock);
+8010141a:	68 80 62 11 80       	push   $0x80116280
+8010141f:	e8 fc 68 00 00       	call   80107d20 <acquire>
+  if(f->ref < 1)
+80101424:	8b 43 04             	mov    0x4(%ebx),%eax
+80101427:	83 c4 10             	add    $0x10,%esp
+8010142a:	85 c0                	test   %eax,%eax
+8010142c:	7e 1a                	jle    80101448 <filedup+0x38>
+    panic("filedup");
+  f->ref++;
+8010142e:	83 c0 01             	add    $0x1,%eax
+  release(&ftable.lock);
+80101431:	83 ec 0c             	sub    $0xc,%esp
+  f->ref++;
+80101434:	89 43 04             	mov    %eax,0x4(%ebx)
+  release(&ftable.lock);
+80101437:	68 80 62 11 80       	push   $0x80116280
+8010143c:	e8 7f 68 00 00       	call   80107cc0 <release>
+  return f;
+}
+80101441:	89 d8                	mov    %ebx,%eax
+80101443:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101446:	c9                   	leave
+80101447:	c3                   	ret
+    panic("filedup");
+80101448:	83 ec 0c             	sub    $0xc,%esp
+8010144b:	68 4c b6 10 80       	push   $0x8010b64c
+80101450:	e8 2b f4 ff ff       	call   80100880 <panic>
+80101455:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010145c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101460 <fileclose>:
+
+// Close file f.  (Decrement ref count, close when reaches 0.)
+void
+fileclose(struct file *f)
+{
+80101460:	55                   	push   %ebp
+80101461:	89 e5                	mov    %esp,%ebp
+80101463:	57                   	push   %edi
+80101464:	56                   	push   %esi
+80101465:	53                   	push   %ebx
+80101466:	83 ec 28             	sub    $0x28,%esp
+80101469:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct file ff;
+
+  acquire(&ftable.lock);
+8010146c:	68 80 62 11 80       	push   $0x80116280
+80101471:	e8 aa 68 00 00       	call   80107d20 <acquire>
+  if(f->ref < 1)
+80101476:	8b 53 04             	mov    0x4(%ebx),%edx
+80101479:	83 c4 10             	add    $0x10,%esp
+8010147c:	85 d2                	test   %edx,%edx
+8010147e:	0f 8e a5 00 00 00    	jle    80101529 <fileclose+0xc9>
+    panic("fileclose");
+  if(--f->ref > 0){
+80101484:	83 ea 01             	sub    $0x1,%edx
+80101487:	89 53 04             	mov    %edx,0x4(%ebx)
+8010148a:	75 44                	jne    801014d0 <fileclose+0x70>
+    release(&ftable.lock);
+    return;
+  }
+  ff = *f;
+8010148c:	0f b6 43 09          	movzbl 0x9(%ebx),%eax
+  f->ref = 0;
+  f->type = FD_NONE;
+  release(&ftable.lock);
+80101490:	83 ec 0c             	sub    $0xc,%esp
+  ff = *f;
+80101493:	8b 3b                	mov    (%ebx),%edi
+  f->type = FD_NONE;
+80101495:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  ff = *f;
+8010149b:	8b 73 0c             	mov    0xc(%ebx),%esi
+8010149e:	88 45 e7             	mov    %al,-0x19(%ebp)
+801014a1:	8b 43 10             	mov    0x10(%ebx),%eax
+801014a4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  release(&ftable.lock);
+801014a7:	68 80 62 11 80       	push   $0x80116280
+801014ac:	e8 0f 68 00 00       	call   80107cc0 <release>
+
+  if(ff.type == FD_PIPE)
+801014b1:	83 c4 10             	add    $0x10,%esp
+801014b4:	83 ff 01             	cmp    $0x1,%edi
+801014b7:	74 57                	je     80101510 <fileclose+0xb0>
+    pipeclose(ff.pipe, ff.writable);
+  else if(ff.type == FD_INODE){
+801014b9:	83 ff 02             	cmp    $0x2,%edi
+801014bc:	74 2a                	je     801014e8 <fileclose+0x88>
+    begin_op();
+    iput(ff.ip);
+    end_op();
+  }
+}
+801014be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801014c1:	5b                   	pop    %ebx
+801014c2:	5e                   	pop    %esi
+801014c3:	5f                   	pop    %edi
+801014c4:	5d                   	pop    %ebp
+801014c5:	c3                   	ret
+801014c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801014cd:	8d 76 00             	lea    0x0(%esi),%esi
+    release(&ftable.lock);
+801014d0:	c7 45 08 80 62 11 80 	movl   $0x80116280,0x8(%ebp)
+}
+801014d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801014da:	5b                   	pop    %ebx
+801014db:	5e                   	pop    %esi
+801014dc:	5f                   	pop    %edi
+801014dd:	5d                   	pop    %ebp
+    release(&ftable.lock);
+801014de:	e9 dd 67 00 00       	jmp    80107cc0 <release>
+801014e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801014e7:	90                   	nop
+    begin_op();
+801014e8:	e8 73 3a 00 00       	call   80104f60 <begin_op>
+    iput(ff.ip);
+801014ed:	83 ec 0c             	sub    $0xc,%esp
+801014f0:	ff 75 e0             	push   -0x20(%ebp)
+801014f3:	e8 98 14 00 00       	call   80102990 <iput>
+    end_op();
+801014f8:	83 c4 10             	add    $0x10,%esp
+}
+801014fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801014fe:	5b                   	pop    %ebx
+801014ff:	5e                   	pop    %esi
+80101500:	5f                   	pop    %edi
+80101501:	5d                   	pop    %ebp
+    end_op();
+80101502:	e9 f9 3a 00 00       	jmp    80105000 <end_op>
+80101507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010150e:	66 90                	xchg   %ax,%ax
+    pipeclose(ff.pipe, ff.writable);
+80101510:	0f be 5d e7          	movsbl -0x19(%ebp),%ebx
+80101514:	83 ec 08             	sub    $0x8,%esp
+80101517:	53                   	push   %ebx
+80101518:	56                   	push   %esi
+80101519:	e8 c2 42 00 00       	call   801057e0 <pipeclose>
+8010151e:	83 c4 10             	add    $0x10,%esp
+}
+80101521:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101524:	5b                   	pop    %ebx
+80101525:	5e                   	pop    %esi
+80101526:	5f                   	pop    %edi
+80101527:	5d                   	pop    %ebp
+80101528:	c3                   	ret
+    panic("fileclose");
+80101529:	83 ec 0c             	sub    $0xc,%esp
+8010152c:	68 54 b6 10 80       	push   $0x8010b654
+80101531:	e8 4a f3 ff ff       	call   80100880 <panic>
+80101536:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010153d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80101540 <filestat>:
+
+// Get metadata about file f.
+int
+filestat(struct file *f, struct stat *st)
+{
+80101540:	55                   	push   %ebp
+80101541:	89 e5                	mov    %esp,%ebp
+80101543:	53                   	push   %ebx
+80101544:	83 ec 04             	sub    $0x4,%esp
+80101547:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->type == FD_INODE){
+8010154a:	83 3b 02             	cmpl   $0x2,(%ebx)
+8010154d:	75 31                	jne    80101580 <filestat+0x40>
+    ilock(f->ip);
+8010154f:	83 ec 0c             	sub    $0xc,%esp
+80101552:	ff 73 10             	push   0x10(%ebx)
+80101555:	e8 06 13 00 00       	call   80102860 <ilock>
+    stati(f->ip, st);
+8010155a:	58                   	pop    %eax
+8010155b:	5a                   	pop    %edx
+8010155c:	ff 75 0c             	push   0xc(%ebp)
+8010155f:	ff 73 10             	push   0x10(%ebx)
+80101562:	e8 39 16 00 00       	call   80102ba0 <stati>
+    iunlock(f->ip);
+80101567:	59                   	pop    %ecx
+80101568:	ff 73 10             	push   0x10(%ebx)
+8010156b:	e8 d0 13 00 00       	call   80102940 <iunlock>
+    return 0;
+  }
+  return -1;
+}
+80101570:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+80101573:	83 c4 10             	add    $0x10,%esp
+80101576:	31 c0                	xor    %eax,%eax
+}
+80101578:	c9                   	leave
+80101579:	c3                   	ret
+8010157a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80101580:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return -1;
+80101583:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80101588:	c9                   	leave
+80101589:	c3                   	ret
+8010158a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80101590 <fileread>:
+}
+
+// Read from file f.
+int
+fileread(struct file *f, char *addr, int n)
+{
+80101590:	55                   	push   %ebp
+80101591:	89 e5                	mov    %esp,%ebp
+80101593:	57                   	push   %edi
+80101594:	56                   	push   %esi
+80101595:	53                   	push   %ebx
+80101596:	83 ec 1c             	sub    $0x1c,%esp
+80101599:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010159c:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010159f:	8b 45 10             	mov    0x10(%ebp),%eax
+  int r;
+  uint off;
+
+  if(f->readable == 0)
+801015a2:	80 7b 08 00          	cmpb   $0x0,0x8(%ebx)
+801015a6:	0f 84 04 01 00 00    	je     801016b0 <fileread+0x120>
+    return -1;
+  if(f->type == FD_PIPE)
+801015ac:	8b 3b                	mov    (%ebx),%edi
+801015ae:	83 ff 01             	cmp    $0x1,%edi
+801015b1:	0f 84 b9 00 00 00    	je     80101670 <fileread+0xe0>
+801015b7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    return piperead(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+801015ba:	83 ff 02             	cmp    $0x2,%edi
+801015bd:	0f 85 f7 00 00 00    	jne    801016ba <fileread+0x12a>
+    ilock(f->ip);
+801015c3:	83 ec 0c             	sub    $0xc,%esp
+801015c6:	ff 73 10             	push   0x10(%ebx)
+801015c9:	e8 92 12 00 00       	call   80102860 <ilock>
+    off = f->off;
+801015ce:	8b 53 14             	mov    0x14(%ebx),%edx
+    if((r = readi(f->ip, addr, off, n)) > 0){
+801015d1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801015d4:	50                   	push   %eax
+801015d5:	52                   	push   %edx
+801015d6:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801015d9:	56                   	push   %esi
+801015da:	ff 73 10             	push   0x10(%ebx)
+801015dd:	e8 ee 15 00 00       	call   80102bd0 <readi>
+801015e2:	83 c4 20             	add    $0x20,%esp
+801015e5:	89 c6                	mov    %eax,%esi
+801015e7:	85 c0                	test   %eax,%eax
+801015e9:	7f 1d                	jg     80101608 <fileread+0x78>
+      f->off += r;
+      readahead(f, off);
+    }
+    iunlock(f->ip);
+801015eb:	83 ec 0c             	sub    $0xc,%esp
+801015ee:	ff 73 10             	push   0x10(%ebx)
+801015f1:	e8 4a 13 00 00       	call   80102940 <iunlock>
+    return r;
+801015f6:	83 c4 10             	add    $0x10,%esp
+  }
+  panic("fileread");
+}
+801015f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801015fc:	89 f0                	mov    %esi,%eax
+801015fe:	5b                   	pop    %ebx
+801015ff:	5e                   	pop    %esi
+80101600:	5f                   	pop    %edi
+80101601:	5d                   	pop    %ebp
+80101602:	c3                   	ret
+80101603:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101607:	90                   	nop
+      f->off += r;
+80101608:	8b 4b 14             	mov    0x14(%ebx),%ecx
+  if(off != f->raoff){
+8010160b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      f->off += r;
+8010160e:	01 c1                	add    %eax,%ecx
+80101610:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  if(off != f->raoff){
+80101613:	3b 53 18             	cmp    0x18(%ebx),%edx
+80101616:	74 18                	je     80101630 <fileread+0xa0>
+    f->rawin = 0;
+80101618:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+    f->raend = 0;
+8010161f:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+  f->raoff = f->off;
+80101626:	89 4b 18             	mov    %ecx,0x18(%ebx)
+  if(f->rawin == 0)
+80101629:	eb c0                	jmp    801015eb <fileread+0x5b>
+8010162b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010162f:	90                   	nop
+  } else if(f->rawin == 0)
+80101630:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80101633:	85 c0                	test   %eax,%eax
+80101635:	75 51                	jne    80101688 <fileread+0xf8>
+    f->rawin = RAMIN;
+80101637:	c7 43 1c 02 00 00 00 	movl   $0x2,0x1c(%ebx)
+    ireadahead(f->ip, start, end - start);
+8010163e:	8b 53 10             	mov    0x10(%ebx),%edx
+  f->raoff = f->off;
+80101641:	89 4b 18             	mov    %ecx,0x18(%ebx)
+  start = f->off > f->raend ? f->off : f->raend;
+80101644:	8b 43 20             	mov    0x20(%ebx),%eax
+80101647:	39 c1                	cmp    %eax,%ecx
+80101649:	0f 43 c1             	cmovae %ecx,%eax
+  end = f->off + f->rawin*BSIZE;
+8010164c:	c1 e7 0c             	shl    $0xc,%edi
+8010164f:	01 cf                	add    %ecx,%edi
+  if(start < end){
+80101651:	39 f8                	cmp    %edi,%eax
+80101653:	73 96                	jae    801015eb <fileread+0x5b>
+    ireadahead(f->ip, start, end - start);
+80101655:	89 f9                	mov    %edi,%ecx
+80101657:	83 ec 04             	sub    $0x4,%esp
+8010165a:	29 c1                	sub    %eax,%ecx
+8010165c:	51                   	push   %ecx
+8010165d:	50                   	push   %eax
+8010165e:	52                   	push   %edx
+8010165f:	e8 6c 16 00 00       	call   80102cd0 <ireadahead>
+    f->raend = end;
+80101664:	89 7b 20             	mov    %edi,0x20(%ebx)
+80101667:	83 c4 10             	add    $0x10,%esp
+8010166a:	e9 7c ff ff ff       	jmp    801015eb <fileread+0x5b>
+8010166f:	90                   	nop
+    return piperead(f->pipe, addr, n);
+80101670:	8b 43 0c             	mov    0xc(%ebx),%eax
+80101673:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80101676:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101679:	5b                   	pop    %ebx
+8010167a:	5e                   	pop    %esi
+8010167b:	5f                   	pop    %edi
+8010167c:	5d                   	pop    %ebp
+    return piperead(f->pipe, addr, n);
+8010167d:	e9 7e 44 00 00       	jmp    80105b00 <piperead>
+80101682:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  else if(f->rawin < RAMAX)
+80101688:	83 f8 1f             	cmp    $0x1f,%eax
+8010168b:	77 13                	ja     801016a0 <fileread+0x110>
+    f->rawin *= 2;
+8010168d:	8d 3c 00             	lea    (%eax,%eax,1),%edi
+  f->raoff = f->off;
+80101690:	89 4b 18             	mov    %ecx,0x18(%ebx)
+    ireadahead(f->ip, start, end - start);
+80101693:	8b 53 10             	mov    0x10(%ebx),%edx
+    f->rawin *= 2;
+80101696:	89 7b 1c             	mov    %edi,0x1c(%ebx)
+  if(f->rawin == 0)
+80101699:	eb a9                	jmp    80101644 <fileread+0xb4>
+8010169b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010169f:	90                   	nop
+  f->raoff = f->off;
+801016a0:	89 4b 18             	mov    %ecx,0x18(%ebx)
+    ireadahead(f->ip, start, end - start);
+801016a3:	8b 53 10             	mov    0x10(%ebx),%edx
+801016a6:	89 c7                	mov    %eax,%edi
+801016a8:	eb 9a                	jmp    80101644 <fileread+0xb4>
+801016aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+801016b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+801016b5:	e9 3f ff ff ff       	jmp    801015f9 <fileread+0x69>
+  panic("fileread");
+801016ba:	83 ec 0c             	sub    $0xc,%esp
+801016bd:	68 5e b6 10 80       	push   $0x8010b65e
+801016c2:	e8 b9 f1 ff ff       	call   80100880 <panic>
+801016c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801016ce:	66 90                	xchg   %ax,%ax
+
+801016d0 <filewrite>:
+
+//PAGEBREAK!
+// Write to file f.
+int
+filewrite(struct file *f, char *addr, int n)
+{
+801016d0:	55                   	push   %ebp
+801016d1:	89 e5                	mov    %esp,%ebp
+801016d3:	57                   	push   %edi
+801016d4:	56                   	push   %esi
+801016d5:	53                   	push   %ebx
+801016d6:	83 ec 1c             	sub    $0x1c,%esp
+801016d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+801016dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801016df:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801016e2:	8b 45 10             	mov    0x10(%ebp),%eax
+  int r;
+
+  if(f->writable == 0)
+801016e5:	80 7b 09 00          	cmpb   $0x0,0x9(%ebx)
+{
+801016e9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(f->writable == 0)
+801016ec:	0f 84 bb 00 00 00    	je     801017ad <filewrite+0xdd>
+    return -1;
+  if(f->type == FD_PIPE)
+801016f2:	8b 03                	mov    (%ebx),%eax
+801016f4:	83 f8 01             	cmp    $0x1,%eax
+801016f7:	0f 84 bf 00 00 00    	je     801017bc <filewrite+0xec>
+    return pipewrite(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+801016fd:	83 f8 02             	cmp    $0x2,%eax
+80101700:	0f 85 c8 00 00 00    	jne    801017ce <filewrite+0xfe>
+    // non-aligned writes.
+    // this really belongs lower down, since writei()
+    // might be writing a device like the console.
+    int max = ((MAXOPBLOCKS-1-2-2) / 2) * BSIZE;
+    int i = 0;
+    while(i < n){
+80101706:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    int i = 0;
+80101709:	31 f6                	xor    %esi,%esi
+    while(i < n){
+8010170b:	85 c0                	test   %eax,%eax
+8010170d:	7f 30                	jg     8010173f <filewrite+0x6f>
+8010170f:	e9 94 00 00 00       	jmp    801017a8 <filewrite+0xd8>
+80101714:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        n1 = max;
+
+      begin_op();
+      ilock(f->ip);
+      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+        f->off += r;
+80101718:	01 43 14             	add    %eax,0x14(%ebx)
+      iunlock(f->ip);
+8010171b:	83 ec 0c             	sub    $0xc,%esp
+        f->off += r;
+8010171e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      iunlock(f->ip);
+80101721:	ff 73 10             	push   0x10(%ebx)
+80101724:	e8 17 12 00 00       	call   80102940 <iunlock>
+      end_op();
+80101729:	e8 d2 38 00 00       	call   80105000 <end_op>
+
+      if(r < 0)
+        break;
+      if(r != n1)
+8010172e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80101731:	83 c4 10             	add    $0x10,%esp
+80101734:	39 c7                	cmp    %eax,%edi
+80101736:	75 5c                	jne    80101794 <filewrite+0xc4>
+        panic("short filewrite");
+      i += r;
+80101738:	01 fe                	add    %edi,%esi
+    while(i < n){
+8010173a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+8010173d:	7e 69                	jle    801017a8 <filewrite+0xd8>
+      int n1 = n - i;
+8010173f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if(n1 > max)
+80101742:	b8 00 20 00 00       	mov    $0x2000,%eax
+      int n1 = n - i;
+80101747:	29 f7                	sub    %esi,%edi
+      if(n1 > max)
+80101749:	39 c7                	cmp    %eax,%edi
+8010174b:	0f 4f f8             	cmovg  %eax,%edi
+      begin_op();
+8010174e:	e8 0d 38 00 00       	call   80104f60 <begin_op>
+      ilock(f->ip);
+80101753:	83 ec 0c             	sub    $0xc,%esp
+80101756:	ff 73 10             	push   0x10(%ebx)
+80101759:	e8 02 11 00 00       	call   80102860 <ilock>
+      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+8010175e:	57                   	push   %edi
+8010175f:	ff 73 14             	push   0x14(%ebx)
+80101762:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80101765:	01 f0                	add    %esi,%eax
+80101767:	50                   	push   %eax
+80101768:	ff 73 10             	push   0x10(%ebx)
+8010176b:	e8 d0 15 00 00       	call   80102d40 <writei>
+80101770:	83 c4 20             	add    $0x20,%esp
+80101773:	85 c0                	test   %eax,%eax
+80101775:	7f a1                	jg     80101718 <filewrite+0x48>
+80101777:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      iunlock(f->ip);
+8010177a:	83 ec 0c             	sub    $0xc,%esp
+8010177d:	ff 73 10             	push   0x10(%ebx)
+80101780:	e8 bb 11 00 00       	call   80102940 <iunlock>
+      end_op();
+80101785:	e8 76 38 00 00       	call   80105000 <end_op>
+      if(r < 0)
+8010178a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010178d:	83 c4 10             	add    $0x10,%esp
+80101790:	85 c0                	test   %eax,%eax
+80101792:	75 14                	jne    801017a8 <filewrite+0xd8>
+        panic("short filewrite");
+80101794:	83 ec 0c             	sub    $0xc,%esp
+80101797:	68 67 b6 10 80       	push   $0x8010b667
+8010179c:	e8 df f0 ff ff       	call   80100880 <panic>
+801017a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    }
+    return i == n ? n : -1;
+801017a8:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+801017ab:	74 05                	je     801017b2 <filewrite+0xe2>
+    return -1;
+801017ad:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  }
+  panic("filewrite");
+}
+801017b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801017b5:	89 f0                	mov    %esi,%eax
+801017b7:	5b                   	pop    %ebx
+801017b8:	5e                   	pop    %esi
+801017b9:	5f                   	pop    %edi
+801017ba:	5d                   	pop    %ebp
+801017bb:	c3                   	ret
+    return pipewrite(f->pipe, addr, n);
+801017bc:	8b 43 0c             	mov    0xc(%ebx),%eax
+801017bf:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+801017c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801017c5:	5b                   	pop    %ebx
+801017c6:	5e                   	pop    %esi
+801017c7:	5f                   	pop    %edi
+801017c8:	5d                   	pop    %ebp
+    return pipewrite(f->pipe, addr, n);
+801017c9:	e9 22 41 00 00       	jmp    801058f0 <pipewrite>
+  panic("filewrite");
+801017ce:	83 ec 0c             	sub    $0xc,%esp
+801017d1:	68 6d b6 10 80       	push   $0x8010b66d
+801017d6:	e8 a5 f0 ff ff       	call   80100880 <panic>
+801017db:	66 90                	xchg   %ax,%ax
+801017dd:	66 90                	xchg   %ax,%ax
+801017df:	90                   	nop
+
+801017e0 <bfree>:
+}
+
+// Free a disk block.
+static void
+bfree(int dev, uint b)
+{
+801017e0:	55                   	push   %ebp
+801017e1:	89 e5                	mov    %esp,%ebp
+801017e3:	57                   	push   %edi
+801017e4:	56                   	push   %esi
+  struct buf *bp;
+  int bi, m;
+
+  bp = bread(dev, BBLOCK(b, sb));
+801017e5:	89 d6                	mov    %edx,%esi
+{
+801017e7:	53                   	push   %ebx
+801017e8:	89 d3                	mov    %edx,%ebx
+  bp = bread(dev, BBLOCK(b, sb));
+801017ea:	c1 ee 0f             	shr    $0xf,%esi
+{
+801017ed:	83 ec 14             	sub    $0x14,%esp
+  bp = bread(dev, BBLOCK(b, sb));
+801017f0:	8b 15 80 1d 12 80    	mov    0x80121d80,%edx
+801017f6:	01 f2                	add    %esi,%edx
+801017f8:	52                   	push   %edx
+801017f9:	50                   	push   %eax
+801017fa:	e8 f1 ec ff ff       	call   801004f0 <bread>
+  bi = b % BPB;
+  m = 1 << (bi % 8);
+801017ff:	89 d9                	mov    %ebx,%ecx
+  if((bp->data[bi/8] & m) == 0)
+80101801:	c1 fb 03             	sar    $0x3,%ebx
+80101804:	83 c4 10             	add    $0x10,%esp
+  bp = bread(dev, BBLOCK(b, sb));
+80101807:	89 c7                	mov    %eax,%edi
+  m = 1 << (bi % 8);
+80101809:	83 e1 07             	and    $0x7,%ecx
+8010180c:	b8 01 00 00 00       	mov    $0x1,%eax
+  if((bp->data[bi/8] & m) == 0)
+80101811:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+80101817:	03 5f 60             	add    0x60(%edi),%ebx
+  m = 1 << (bi % 8);
+8010181a:	d3 e0                	shl    %cl,%eax
+  if((bp->data[bi/8] & m) == 0)
+8010181c:	0f b6 0b             	movzbl (%ebx),%ecx
+8010181f:	85 c1                	test   %eax,%ecx
+80101821:	74 2a                	je     8010184d <bfree+0x6d>
+    panic("freeing free block");
+  bp->data[bi/8] &= ~m;
+80101823:	f7 d0                	not    %eax
+  bsum.nfree[b/BPB]++;
+  log_write(bp);
+80101825:	83 ec 0c             	sub    $0xc,%esp
+  bsum.nfree[b/BPB]++;
+80101828:	83 04 b5 84 1d 12 80 	addl   $0x1,-0x7fede27c(,%esi,4)
+8010182f:	01 
+  bp->data[bi/8] &= ~m;
+80101830:	21 c8                	and    %ecx,%eax
+80101832:	88 03                	mov    %al,(%ebx)
+  log_write(bp);
+80101834:	57                   	push   %edi
+80101835:	e8 c6 38 00 00       	call   80105100 <log_write>
+  brelse(bp);
+8010183a:	89 3c 24             	mov    %edi,(%esp)
+8010183d:	e8 ee ee ff ff       	call   80100730 <brelse>
+}
+80101842:	83 c4 10             	add    $0x10,%esp
+80101845:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101848:	5b                   	pop    %ebx
+80101849:	5e                   	pop    %esi
+8010184a:	5f                   	pop    %edi
+8010184b:	5d                   	pop    %ebp
+8010184c:	c3                   	ret
+    panic("freeing free block");
+8010184d:	83 ec 0c             	sub    $0xc,%esp
+80101850:	68 77 b6 10 80       	push   $0x8010b677
+80101855:	e8 26 f0 ff ff       	call   80100880 <panic>
+8010185a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80101860 <bfreeind>:
+
+// Free the indirect block at addr and the blocks it lists,
+// which are themselves indirect blocks if depth > 1.
+static void
+bfreeind(struct inode *ip, uint addr, int depth)
+{
+80101860:	55                   	push   %ebp
+80101861:	89 e5                	mov    %esp,%ebp
+80101863:	57                   	push   %edi
+80101864:	89 c7                	mov    %eax,%edi
+80101866:	56                   	push   %esi
+80101867:	53                   	push   %ebx
+80101868:	83 ec 24             	sub    $0x24,%esp
+8010186b:	89 55 e0             	mov    %edx,-0x20(%ebp)
+8010186e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  int j;
+  struct buf *bp;
+  uint *a;
+
+  bp = bread(ip->dev, addr);
+80101871:	52                   	push   %edx
+80101872:	ff 30                	push   (%eax)
+80101874:	e8 77 ec ff ff       	call   801004f0 <bread>
+  a = (uint*)bp->data;
+  for(j = 0; j < NINDIRECT; j++){
+80101879:	83 c4 10             	add    $0x10,%esp
+8010187c:	8b 58 60             	mov    0x60(%eax),%ebx
+8010187f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80101882:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+80101888:	eb 1d                	jmp    801018a7 <bfreeind+0x47>
+8010188a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(a[j] == 0)
+      continue;
+    if(depth > 1)
+      bfreeind(ip, a[j], depth-1);
+80101890:	8d 48 ff             	lea    -0x1(%eax),%ecx
+80101893:	89 f8                	mov    %edi,%eax
+80101895:	e8 c6 ff ff ff       	call   80101860 <bfreeind>
+8010189a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(j = 0; j < NINDIRECT; j++){
+801018a0:	83 c3 04             	add    $0x4,%ebx
+801018a3:	39 f3                	cmp    %esi,%ebx
+801018a5:	74 1c                	je     801018c3 <bfreeind+0x63>
+    if(a[j] == 0)
+801018a7:	8b 13                	mov    (%ebx),%edx
+801018a9:	85 d2                	test   %edx,%edx
+801018ab:	74 f3                	je     801018a0 <bfreeind+0x40>
+    if(depth > 1)
+801018ad:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801018b0:	83 f8 01             	cmp    $0x1,%eax
+801018b3:	75 db                	jne    80101890 <bfreeind+0x30>
+    else
+      bfree(ip->dev, a[j]);
+801018b5:	8b 07                	mov    (%edi),%eax
+  for(j = 0; j < NINDIRECT; j++){
+801018b7:	83 c3 04             	add    $0x4,%ebx
+      bfree(ip->dev, a[j]);
+801018ba:	e8 21 ff ff ff       	call   801017e0 <bfree>
+  for(j = 0; j < NINDIRECT; j++){
+801018bf:	39 f3                	cmp    %esi,%ebx
+801018c1:	75 e4                	jne    801018a7 <bfreeind+0x47>
+  }
+  brelse(bp);
+801018c3:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801018c6:	83 ec 0c             	sub    $0xc,%esp
+801018c9:	50                   	push   %eax
+801018ca:	e8 61 ee ff ff       	call   80100730 <brelse>
+  bfree(ip->dev, addr);
+801018cf:	8b 07                	mov    (%edi),%eax
+801018d1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+801018d4:	83 c4 10             	add    $0x10,%esp
+}
+801018d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801018da:	5b                   	pop    %ebx
+801018db:	5e                   	pop    %esi
+801018dc:	5f                   	pop    %edi
+801018dd:	5d                   	pop    %ebp
+  bfree(ip->dev, addr);
+801018de:	e9 fd fe ff ff       	jmp    801017e0 <bfree>
+801018e3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801018ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801018f0 <iget>:
+{
+801018f0:	55                   	push   %ebp
+801018f1:	89 e5                	mov    %esp,%ebp
+801018f3:	57                   	push   %edi
+801018f4:	89 d7                	mov    %edx,%edi
+801018f6:	56                   	push   %esi
+801018f7:	89 c6                	mov    %eax,%esi
+801018f9:	53                   	push   %ebx
+  h = IHASH(dev, inum);
+801018fa:	8d 1c f5 00 00 00 00 	lea    0x0(,%esi,8),%ebx
+80101901:	29 f3                	sub    %esi,%ebx
+80101903:	01 fb                	add    %edi,%ebx
+{
+80101905:	83 ec 28             	sub    $0x28,%esp
+  acquire(&icache.lock);
+80101908:	68 a0 9e 11 80       	push   $0x80119ea0
+8010190d:	e8 0e 64 00 00       	call   80107d20 <acquire>
+  h = IHASH(dev, inum);
+80101912:	b8 3f c5 25 43       	mov    $0x4325c53f,%eax
+  for(ip = icache.hash[h]; ip; ip = ip->hnext){
+80101917:	83 c4 10             	add    $0x10,%esp
+  h = IHASH(dev, inum);
+8010191a:	f7 e3                	mul    %ebx
+8010191c:	c1 ea 04             	shr    $0x4,%edx
+8010191f:	6b c2 3d             	imul   $0x3d,%edx,%eax
+80101922:	89 da                	mov    %ebx,%edx
+80101924:	29 c2                	sub    %eax,%edx
+  for(ip = icache.hash[h]; ip; ip = ip->hnext){
+80101926:	8d 8a 4c 1f 00 00    	lea    0x1f4c(%edx),%ecx
+8010192c:	8b 1c 8d a4 9e 11 80 	mov    -0x7fee615c(,%ecx,4),%ebx
+80101933:	85 db                	test   %ebx,%ebx
+80101935:	75 10                	jne    80101947 <iget+0x57>
+80101937:	eb 3f                	jmp    80101978 <iget+0x88>
+80101939:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101940:	8b 5b 0c             	mov    0xc(%ebx),%ebx
+80101943:	85 db                	test   %ebx,%ebx
+80101945:	74 31                	je     80101978 <iget+0x88>
+    if(ip->dev == dev && ip->inum == inum){
+80101947:	39 33                	cmp    %esi,(%ebx)
+80101949:	75 f5                	jne    80101940 <iget+0x50>
+8010194b:	39 7b 04             	cmp    %edi,0x4(%ebx)
+8010194e:	75 f0                	jne    80101940 <iget+0x50>
+      if(ip->ref++ == 0)
+80101950:	8b 43 08             	mov    0x8(%ebx),%eax
+80101953:	8d 50 01             	lea    0x1(%eax),%edx
+80101956:	89 53 08             	mov    %edx,0x8(%ebx)
+80101959:	85 c0                	test   %eax,%eax
+8010195b:	0f 85 a4 00 00 00    	jne    80101a05 <iget+0x115>
+  ip->next->prev = ip->prev;
+80101961:	8b 53 14             	mov    0x14(%ebx),%edx
+80101964:	8b 43 10             	mov    0x10(%ebx),%eax
+80101967:	89 42 10             	mov    %eax,0x10(%edx)
+  ip->prev->next = ip->next;
+8010196a:	8b 53 14             	mov    0x14(%ebx),%edx
+8010196d:	89 50 14             	mov    %edx,0x14(%eax)
+}
+80101970:	e9 90 00 00 00       	jmp    80101a05 <iget+0x115>
+80101975:	8d 76 00             	lea    0x0(%esi),%esi
+  ip = icache.lru.next;
+80101978:	8b 1d dc 1c 12 80    	mov    0x80121cdc,%ebx
+  if(ip == &icache.lru)
+8010197e:	81 fb c8 1c 12 80    	cmp    $0x80121cc8,%ebx
+80101984:	0f 84 9e 00 00 00    	je     80101a28 <iget+0x138>
+  ip->next->prev = ip->prev;
+8010198a:	8b 53 14             	mov    0x14(%ebx),%edx
+8010198d:	8b 43 10             	mov    0x10(%ebx),%eax
+80101990:	89 42 10             	mov    %eax,0x10(%edx)
+  ip->prev->next = ip->next;
+80101993:	8b 53 14             	mov    0x14(%ebx),%edx
+80101996:	89 50 14             	mov    %edx,0x14(%eax)
+  for(pp = &icache.hash[IHASH(ip->dev, ip->inum)]; *pp != ip; pp = &(*pp)->hnext)
+80101999:	8b 13                	mov    (%ebx),%edx
+8010199b:	8d 04 d5 00 00 00 00 	lea    0x0(,%edx,8),%eax
+801019a2:	29 d0                	sub    %edx,%eax
+801019a4:	ba 3f c5 25 43       	mov    $0x4325c53f,%edx
+801019a9:	03 43 04             	add    0x4(%ebx),%eax
+801019ac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801019af:	f7 e2                	mul    %edx
+801019b1:	c1 ea 04             	shr    $0x4,%edx
+801019b4:	6b c2 3d             	imul   $0x3d,%edx,%eax
+801019b7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801019ba:	29 c2                	sub    %eax,%edx
+801019bc:	8b 04 95 d4 1b 12 80 	mov    -0x7fede42c(,%edx,4),%eax
+801019c3:	39 c3                	cmp    %eax,%ebx
+801019c5:	74 58                	je     80101a1f <iget+0x12f>
+801019c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801019ce:	66 90                	xchg   %ax,%ax
+801019d0:	89 c2                	mov    %eax,%edx
+801019d2:	8b 40 0c             	mov    0xc(%eax),%eax
+801019d5:	39 c3                	cmp    %eax,%ebx
+801019d7:	75 f7                	jne    801019d0 <iget+0xe0>
+801019d9:	83 c2 0c             	add    $0xc,%edx
+  *pp = ip->hnext;
+801019dc:	8b 43 0c             	mov    0xc(%ebx),%eax
+801019df:	89 02                	mov    %eax,(%edx)
+  ip->hnext = icache.hash[h];
+801019e1:	8b 04 8d a4 9e 11 80 	mov    -0x7fee615c(,%ecx,4),%eax
+801019e8:	89 43 0c             	mov    %eax,0xc(%ebx)
+  icache.hash[h] = ip;
+801019eb:	89 1c 8d a4 9e 11 80 	mov    %ebx,-0x7fee615c(,%ecx,4)
+  ip->dev = dev;
+801019f2:	89 33                	mov    %esi,(%ebx)
+  ip->inum = inum;
+801019f4:	89 7b 04             	mov    %edi,0x4(%ebx)
+  ip->ref = 1;
+801019f7:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+  ip->valid = 0;
+801019fe:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+  release(&icache.lock);
+80101a05:	83 ec 0c             	sub    $0xc,%esp
+80101a08:	68 a0 9e 11 80       	push   $0x80119ea0
+80101a0d:	e8 ae 62 00 00       	call   80107cc0 <release>
+  return ip;
+80101a12:	83 c4 10             	add    $0x10,%esp
+}
+80101a15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101a18:	89 d8                	mov    %ebx,%eax
+80101a1a:	5b                   	pop    %ebx
+80101a1b:	5e                   	pop    %esi
+80101a1c:	5f                   	pop    %edi
+80101a1d:	5d                   	pop    %ebp
+80101a1e:	c3                   	ret
+  for(pp = &icache.hash[IHASH(ip->dev, ip->inum)]; *pp != ip; pp = &(*pp)->hnext)
+80101a1f:	8d 14 95 d4 1b 12 80 	lea    -0x7fede42c(,%edx,4),%edx
+80101a26:	eb b4                	jmp    801019dc <iget+0xec>
+    panic("iget: no inodes");
+80101a28:	83 ec 0c             	sub    $0xc,%esp
+80101a2b:	68 8a b6 10 80       	push   $0x8010b68a
+80101a30:	e8 4b ee ff ff       	call   80100880 <panic>
+80101a35:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101a40 <balloc>:
+{
+80101a40:	55                   	push   %ebp
+80101a41:	89 e5                	mov    %esp,%ebp
+80101a43:	57                   	push   %edi
+80101a44:	56                   	push   %esi
+80101a45:	53                   	push   %ebx
+80101a46:	83 ec 3c             	sub    $0x3c,%esp
+80101a49:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(goal == 0 || goal >= sb.size)
+80101a4c:	8b 0d 68 1d 12 80    	mov    0x80121d68,%ecx
+{
+80101a52:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+  if(goal == 0 || goal >= sb.size)
+80101a55:	85 d2                	test   %edx,%edx
+80101a57:	0f 84 f3 00 00 00    	je     80101b50 <balloc+0x110>
+80101a5d:	39 ca                	cmp    %ecx,%edx
+80101a5f:	0f 83 eb 00 00 00    	jae    80101b50 <balloc+0x110>
+    bb = (goal/BPB + n) % nb;
+80101a65:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  nb = (sb.size + BPB - 1) / BPB;
+80101a68:	81 c1 ff 7f 00 00    	add    $0x7fff,%ecx
+  for(n = 0; n <= nb; n++){
+80101a6e:	31 f6                	xor    %esi,%esi
+  nb = (sb.size + BPB - 1) / BPB;
+80101a70:	89 cb                	mov    %ecx,%ebx
+    bb = (goal/BPB + n) % nb;
+80101a72:	89 c7                	mov    %eax,%edi
+      if(n == 0 && bi/32 == goal % BPB / 32)
+80101a74:	c1 e8 05             	shr    $0x5,%eax
+    bb = (goal/BPB + n) % nb;
+80101a77:	c1 ef 0f             	shr    $0xf,%edi
+      if(n == 0 && bi/32 == goal % BPB / 32)
+80101a7a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  nb = (sb.size + BPB - 1) / BPB;
+80101a7f:	c1 eb 0f             	shr    $0xf,%ebx
+    bb = (goal/BPB + n) % nb;
+80101a82:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      if(n == 0 && bi/32 == goal % BPB / 32)
+80101a85:	89 45 bc             	mov    %eax,-0x44(%ebp)
+80101a88:	eb 13                	jmp    80101a9d <balloc+0x5d>
+80101a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(n = 0; n <= nb; n++){
+80101a90:	8d 46 01             	lea    0x1(%esi),%eax
+80101a93:	39 de                	cmp    %ebx,%esi
+80101a95:	0f 84 75 01 00 00    	je     80101c10 <balloc+0x1d0>
+80101a9b:	89 c6                	mov    %eax,%esi
+    bb = (goal/BPB + n) % nb;
+80101a9d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101aa0:	31 d2                	xor    %edx,%edx
+80101aa2:	01 f0                	add    %esi,%eax
+80101aa4:	f7 f3                	div    %ebx
+    if(bsum.nfree[bb] == 0)
+80101aa6:	8b 0c 95 84 1d 12 80 	mov    -0x7fede27c(,%edx,4),%ecx
+    bb = (goal/BPB + n) % nb;
+80101aad:	89 d7                	mov    %edx,%edi
+    if(bsum.nfree[bb] == 0)
+80101aaf:	85 c9                	test   %ecx,%ecx
+80101ab1:	74 dd                	je     80101a90 <balloc+0x50>
+    bp = bread(dev, sb.bmapstart + bb);
+80101ab3:	a1 80 1d 12 80       	mov    0x80121d80,%eax
+80101ab8:	83 ec 08             	sub    $0x8,%esp
+80101abb:	01 d0                	add    %edx,%eax
+80101abd:	50                   	push   %eax
+80101abe:	ff 75 c0             	push   -0x40(%ebp)
+80101ac1:	e8 2a ea ff ff       	call   801004f0 <bread>
+    bi = n == 0 ? goal % BPB / 32 * 32 : 0;
+80101ac6:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+80101ac9:	83 c4 10             	add    $0x10,%esp
+80101acc:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+    bp = bread(dev, sb.bmapstart + bb);
+80101acf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    w = (uint*)bp->data;
+80101ad2:	8b 40 60             	mov    0x60(%eax),%eax
+    bi = n == 0 ? goal % BPB / 32 * 32 : 0;
+80101ad5:	81 e1 e0 7f 00 00    	and    $0x7fe0,%ecx
+80101adb:	89 7d d0             	mov    %edi,-0x30(%ebp)
+    w = (uint*)bp->data;
+80101ade:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    bi = n == 0 ? goal % BPB / 32 * 32 : 0;
+80101ae1:	31 c0                	xor    %eax,%eax
+80101ae3:	85 f6                	test   %esi,%esi
+80101ae5:	0f 44 c1             	cmove  %ecx,%eax
+    for(; bi < BPB && bb*BPB + bi < sb.size; bi += 32){
+80101ae8:	8b 0d 68 1d 12 80    	mov    0x80121d68,%ecx
+    bi = n == 0 ? goal % BPB / 32 * 32 : 0;
+80101aee:	89 c2                	mov    %eax,%edx
+    for(; bi < BPB && bb*BPB + bi < sb.size; bi += 32){
+80101af0:	89 f8                	mov    %edi,%eax
+80101af2:	c1 e0 0f             	shl    $0xf,%eax
+80101af5:	89 d7                	mov    %edx,%edi
+80101af7:	01 d0                	add    %edx,%eax
+80101af9:	89 ca                	mov    %ecx,%edx
+80101afb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80101afe:	39 55 e0             	cmp    %edx,-0x20(%ebp)
+80101b01:	0f 83 8c 00 00 00    	jae    80101b93 <balloc+0x153>
+      x = ~w[bi/32];
+80101b07:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80101b0a:	89 f9                	mov    %edi,%ecx
+80101b0c:	c1 e9 05             	shr    $0x5,%ecx
+80101b0f:	8d 04 88             	lea    (%eax,%ecx,4),%eax
+80101b12:	89 45 cc             	mov    %eax,-0x34(%ebp)
+80101b15:	8b 00                	mov    (%eax),%eax
+80101b17:	89 45 c8             	mov    %eax,-0x38(%ebp)
+80101b1a:	f7 d0                	not    %eax
+      if(n == 0 && bi/32 == goal % BPB / 32)
+80101b1c:	85 f6                	test   %esi,%esi
+80101b1e:	74 48                	je     80101b68 <balloc+0x128>
+      if(x == 0)
+80101b20:	85 c0                	test   %eax,%eax
+80101b22:	74 5c                	je     80101b80 <balloc+0x140>
+      b = bb*BPB + bi + __builtin_ctz(x);
+80101b24:	89 d1                	mov    %edx,%ecx
+80101b26:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80101b29:	f3 0f bc c0          	tzcnt  %eax,%eax
+80101b2d:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+80101b30:	8b 7d d0             	mov    -0x30(%ebp),%edi
+80101b33:	01 d0                	add    %edx,%eax
+      if(b >= sb.size)
+80101b35:	39 c8                	cmp    %ecx,%eax
+80101b37:	72 67                	jb     80101ba0 <balloc+0x160>
+    brelse(bp);
+80101b39:	83 ec 0c             	sub    $0xc,%esp
+80101b3c:	ff 75 d8             	push   -0x28(%ebp)
+80101b3f:	e8 ec eb ff ff       	call   80100730 <brelse>
+80101b44:	83 c4 10             	add    $0x10,%esp
+80101b47:	e9 44 ff ff ff       	jmp    80101a90 <balloc+0x50>
+80101b4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    goal = bsum.cursor % sb.size;
+80101b50:	a1 88 1d 12 80       	mov    0x80121d88,%eax
+80101b55:	31 d2                	xor    %edx,%edx
+80101b57:	f7 f1                	div    %ecx
+80101b59:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+80101b5c:	e9 04 ff ff ff       	jmp    80101a65 <balloc+0x25>
+80101b61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(n == 0 && bi/32 == goal % BPB / 32)
+80101b68:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+80101b6b:	39 d9                	cmp    %ebx,%ecx
+80101b6d:	75 b1                	jne    80101b20 <balloc+0xe0>
+        x &= ~0U << (goal % 32);   // prefer goal and after
+80101b6f:	0f b6 4d c4          	movzbl -0x3c(%ebp),%ecx
+80101b73:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80101b78:	d3 e3                	shl    %cl,%ebx
+80101b7a:	21 d8                	and    %ebx,%eax
+      if(x == 0)
+80101b7c:	85 c0                	test   %eax,%eax
+80101b7e:	75 a4                	jne    80101b24 <balloc+0xe4>
+    for(; bi < BPB && bb*BPB + bi < sb.size; bi += 32){
+80101b80:	83 c7 20             	add    $0x20,%edi
+80101b83:	83 45 e0 20          	addl   $0x20,-0x20(%ebp)
+80101b87:	81 ff ff 7f 00 00    	cmp    $0x7fff,%edi
+80101b8d:	0f 86 6b ff ff ff    	jbe    80101afe <balloc+0xbe>
+80101b93:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+80101b96:	eb a1                	jmp    80101b39 <balloc+0xf9>
+80101b98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101b9f:	90                   	nop
+      w[bi/32] |= 1 << (b % 32);   // Mark block in use.
+80101ba0:	89 c3                	mov    %eax,%ebx
+80101ba2:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80101ba5:	8b 55 cc             	mov    -0x34(%ebp),%edx
+      log_write(bp);
+80101ba8:	83 ec 0c             	sub    $0xc,%esp
+      w[bi/32] |= 1 << (b % 32);   // Mark block in use.
+80101bab:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+      bsum.nfree[bb]--;
+80101bae:	83 2c bd 84 1d 12 80 	subl   $0x1,-0x7fede27c(,%edi,4)
+80101bb5:	01 
+      w[bi/32] |= 1 << (b % 32);   // Mark block in use.
+80101bb6:	0f ab d8             	bts    %ebx,%eax
+80101bb9:	89 02                	mov    %eax,(%edx)
+      bsum.cursor = b + 1;
+80101bbb:	8d 43 01             	lea    0x1(%ebx),%eax
+80101bbe:	a3 88 1d 12 80       	mov    %eax,0x80121d88
+      log_write(bp);
+80101bc3:	51                   	push   %ecx
+80101bc4:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80101bc7:	e8 34 35 00 00       	call   80105100 <log_write>
+      brelse(bp);
+80101bcc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80101bcf:	89 0c 24             	mov    %ecx,(%esp)
+80101bd2:	e8 59 eb ff ff       	call   80100730 <brelse>
+  bp = bread(dev, bno);
+80101bd7:	58                   	pop    %eax
+80101bd8:	5a                   	pop    %edx
+80101bd9:	53                   	push   %ebx
+80101bda:	ff 75 c0             	push   -0x40(%ebp)
+80101bdd:	e8 0e e9 ff ff       	call   801004f0 <bread>
+  memset(bp->data, 0, BSIZE);
+80101be2:	83 c4 0c             	add    $0xc,%esp
+80101be5:	68 00 10 00 00       	push   $0x1000
+  bp = bread(dev, bno);
+80101bea:	89 c6                	mov    %eax,%esi
+  memset(bp->data, 0, BSIZE);
+80101bec:	6a 00                	push   $0x0
+80101bee:	ff 70 60             	push   0x60(%eax)
+80101bf1:	e8 0a 62 00 00       	call   80107e00 <memset>
+  log_write(bp);
+80101bf6:	89 34 24             	mov    %esi,(%esp)
+80101bf9:	e8 02 35 00 00       	call   80105100 <log_write>
+  brelse(bp);
+80101bfe:	89 34 24             	mov    %esi,(%esp)
+80101c01:	e8 2a eb ff ff       	call   80100730 <brelse>
+}
+80101c06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101c09:	89 d8                	mov    %ebx,%eax
+80101c0b:	5b                   	pop    %ebx
+80101c0c:	5e                   	pop    %esi
+80101c0d:	5f                   	pop    %edi
+80101c0e:	5d                   	pop    %ebp
+80101c0f:	c3                   	ret
+  panic("balloc: out of blocks");
+80101c10:	83 ec 0c             	sub    $0xc,%esp
+80101c13:	68 9a b6 10 80       	push   $0x8010b69a
+80101c18:	e8 63 ec ff ff       	call   80100880 <panic>
+80101c1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80101c20 <dcdrop>:
+
+// Take d out of its hash chain and mark it unused.
+// Caller holds dcache.lock.
+static void
+dcdrop(struct dentry *d)
+{
+80101c20:	55                   	push   %ebp
+80101c21:	89 c1                	mov    %eax,%ecx
+80101c23:	8d 51 08             	lea    0x8(%ecx),%edx
+80101c26:	89 e5                	mov    %esp,%ebp
+80101c28:	57                   	push   %edi
+80101c29:	8d 79 16             	lea    0x16(%ecx),%edi
+80101c2c:	56                   	push   %esi
+80101c2d:	53                   	push   %ebx
+  h = dev*7 + dir;
+80101c2e:	8b 00                	mov    (%eax),%eax
+80101c30:	8d 1c c5 00 00 00 00 	lea    0x0(,%eax,8),%ebx
+80101c37:	29 c3                	sub    %eax,%ebx
+80101c39:	03 59 04             	add    0x4(%ecx),%ebx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101c3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101c40:	0f b6 02             	movzbl (%edx),%eax
+80101c43:	84 c0                	test   %al,%al
+80101c45:	74 11                	je     80101c58 <dcdrop+0x38>
+    h = h*31 + (uchar)name[i];
+80101c47:	89 de                	mov    %ebx,%esi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101c49:	83 c2 01             	add    $0x1,%edx
+    h = h*31 + (uchar)name[i];
+80101c4c:	c1 e6 05             	shl    $0x5,%esi
+80101c4f:	29 de                	sub    %ebx,%esi
+80101c51:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101c54:	39 fa                	cmp    %edi,%edx
+80101c56:	75 e8                	jne    80101c40 <dcdrop+0x20>
+  return h % NDHASH;
+80101c58:	b8 3f c5 25 43       	mov    $0x4325c53f,%eax
+80101c5d:	f7 e3                	mul    %ebx
+80101c5f:	c1 ea 04             	shr    $0x4,%edx
+80101c62:	6b c2 3d             	imul   $0x3d,%edx,%eax
+80101c65:	29 c3                	sub    %eax,%ebx
+  struct dentry **pp;
+
+  for(pp = &dcache.hash[dhash(d->dev, d->dir, d->name)]; *pp != d; pp = &(*pp)->hnext)
+80101c67:	8b 04 9d 74 9d 11 80 	mov    -0x7fee628c(,%ebx,4),%eax
+80101c6e:	39 c1                	cmp    %eax,%ecx
+80101c70:	74 4e                	je     80101cc0 <dcdrop+0xa0>
+80101c72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80101c78:	89 c2                	mov    %eax,%edx
+80101c7a:	8b 40 20             	mov    0x20(%eax),%eax
+80101c7d:	39 c1                	cmp    %eax,%ecx
+80101c7f:	75 f7                	jne    80101c78 <dcdrop+0x58>
+80101c81:	83 c2 20             	add    $0x20,%edx
+    ;
+  *pp = d->hnext;
+80101c84:	8b 41 20             	mov    0x20(%ecx),%eax
+80101c87:	89 02                	mov    %eax,(%edx)
+  d->next->prev = d->prev;
+80101c89:	8b 51 28             	mov    0x28(%ecx),%edx
+80101c8c:	8b 41 24             	mov    0x24(%ecx),%eax
+  d->dir = 0;
+80101c8f:	c7 41 04 00 00 00 00 	movl   $0x0,0x4(%ecx)
+  d->next->prev = d->prev;
+80101c96:	89 42 24             	mov    %eax,0x24(%edx)
+  d->prev->next = d->next;
+80101c99:	8b 51 28             	mov    0x28(%ecx),%edx
+80101c9c:	89 50 28             	mov    %edx,0x28(%eax)
+    d->prev = &dcache.lru;
+80101c9f:	c7 41 24 68 9e 11 80 	movl   $0x80119e68,0x24(%ecx)
+    d->next = dcache.lru.next;
+80101ca6:	a1 90 9e 11 80       	mov    0x80119e90,%eax
+80101cab:	89 41 28             	mov    %eax,0x28(%ecx)
+  d->prev->next = d;
+80101cae:	89 0d 90 9e 11 80    	mov    %ecx,0x80119e90
+  d->next->prev = d;
+80101cb4:	8b 41 28             	mov    0x28(%ecx),%eax
+80101cb7:	89 48 24             	mov    %ecx,0x24(%eax)
+  dctouch(d, 1);
+}
+80101cba:	5b                   	pop    %ebx
+80101cbb:	5e                   	pop    %esi
+80101cbc:	5f                   	pop    %edi
+80101cbd:	5d                   	pop    %ebp
+80101cbe:	c3                   	ret
+80101cbf:	90                   	nop
+  for(pp = &dcache.hash[dhash(d->dev, d->dir, d->name)]; *pp != d; pp = &(*pp)->hnext)
+80101cc0:	8d 14 9d 74 9d 11 80 	lea    -0x7fee628c(,%ebx,4),%edx
+80101cc7:	eb bb                	jmp    80101c84 <dcdrop+0x64>
+80101cc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80101cd0 <dcfind>:
+
+// Find the entry for name in dp. Caller holds dcache.lock.
+static struct dentry*
+dcfind(struct inode *dp, char *name)
+{
+80101cd0:	55                   	push   %ebp
+80101cd1:	89 e5                	mov    %esp,%ebp
+80101cd3:	57                   	push   %edi
+80101cd4:	89 d7                	mov    %edx,%edi
+80101cd6:	56                   	push   %esi
+80101cd7:	89 c6                	mov    %eax,%esi
+80101cd9:	53                   	push   %ebx
+80101cda:	83 ec 1c             	sub    $0x1c,%esp
+  struct dentry *d;
+
+  for(d = dcache.hash[dhash(dp->dev, dp->inum, name)]; d; d = d->hnext)
+80101cdd:	8b 18                	mov    (%eax),%ebx
+  h = dev*7 + dir;
+80101cdf:	89 75 e0             	mov    %esi,-0x20(%ebp)
+80101ce2:	8d 0c dd 00 00 00 00 	lea    0x0(,%ebx,8),%ecx
+80101ce9:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+80101cec:	29 d9                	sub    %ebx,%ecx
+80101cee:	03 48 04             	add    0x4(%eax),%ecx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101cf1:	8d 42 0e             	lea    0xe(%edx),%eax
+80101cf4:	89 c6                	mov    %eax,%esi
+80101cf6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101cfd:	8d 76 00             	lea    0x0(%esi),%esi
+80101d00:	0f b6 1a             	movzbl (%edx),%ebx
+80101d03:	84 db                	test   %bl,%bl
+80101d05:	74 13                	je     80101d1a <dcfind+0x4a>
+    h = h*31 + (uchar)name[i];
+80101d07:	89 c8                	mov    %ecx,%eax
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101d09:	83 c2 01             	add    $0x1,%edx
+    h = h*31 + (uchar)name[i];
+80101d0c:	c1 e0 05             	shl    $0x5,%eax
+80101d0f:	29 c8                	sub    %ecx,%eax
+80101d11:	0f b6 cb             	movzbl %bl,%ecx
+80101d14:	01 c1                	add    %eax,%ecx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101d16:	39 f2                	cmp    %esi,%edx
+80101d18:	75 e6                	jne    80101d00 <dcfind+0x30>
+  return h % NDHASH;
+80101d1a:	b8 3f c5 25 43       	mov    $0x4325c53f,%eax
+80101d1f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80101d22:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80101d25:	f7 e1                	mul    %ecx
+80101d27:	c1 ea 04             	shr    $0x4,%edx
+80101d2a:	6b d2 3d             	imul   $0x3d,%edx,%edx
+80101d2d:	29 d1                	sub    %edx,%ecx
+  for(d = dcache.hash[dhash(dp->dev, dp->inum, name)]; d; d = d->hnext)
+80101d2f:	8b 14 8d 74 9d 11 80 	mov    -0x7fee628c(,%ecx,4),%edx
+80101d36:	85 d2                	test   %edx,%edx
+80101d38:	74 36                	je     80101d70 <dcfind+0xa0>
+80101d3a:	89 d8                	mov    %ebx,%eax
+80101d3c:	89 d3                	mov    %edx,%ebx
+80101d3e:	eb 09                	jmp    80101d49 <dcfind+0x79>
+80101d40:	8b 5b 20             	mov    0x20(%ebx),%ebx
+80101d43:	85 db                	test   %ebx,%ebx
+80101d45:	74 29                	je     80101d70 <dcfind+0xa0>
+    if(d->dev == dp->dev && d->dir == dp->inum && namecmp(d->name, name) == 0)
+80101d47:	8b 06                	mov    (%esi),%eax
+80101d49:	39 03                	cmp    %eax,(%ebx)
+80101d4b:	75 f3                	jne    80101d40 <dcfind+0x70>
+80101d4d:	8b 46 04             	mov    0x4(%esi),%eax
+80101d50:	39 43 04             	cmp    %eax,0x4(%ebx)
+80101d53:	75 eb                	jne    80101d40 <dcfind+0x70>
+  return strncmp(s, t, DIRSIZ);
+80101d55:	83 ec 04             	sub    $0x4,%esp
+    if(d->dev == dp->dev && d->dir == dp->inum && namecmp(d->name, name) == 0)
+80101d58:	8d 43 08             	lea    0x8(%ebx),%eax
+  return strncmp(s, t, DIRSIZ);
+80101d5b:	6a 0e                	push   $0xe
+80101d5d:	57                   	push   %edi
+80101d5e:	50                   	push   %eax
+80101d5f:	e8 9c 61 00 00       	call   80107f00 <strncmp>
+    if(d->dev == dp->dev && d->dir == dp->inum && namecmp(d->name, name) == 0)
+80101d64:	83 c4 10             	add    $0x10,%esp
+80101d67:	85 c0                	test   %eax,%eax
+80101d69:	75 d5                	jne    80101d40 <dcfind+0x70>
+80101d6b:	89 da                	mov    %ebx,%edx
+80101d6d:	eb 03                	jmp    80101d72 <dcfind+0xa2>
+80101d6f:	90                   	nop
+      return d;
+  return 0;
+80101d70:	31 d2                	xor    %edx,%edx
+}
+80101d72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101d75:	89 d0                	mov    %edx,%eax
+80101d77:	5b                   	pop    %ebx
+80101d78:	5e                   	pop    %esi
+80101d79:	5f                   	pop    %edi
+80101d7a:	5d                   	pop    %ebp
+80101d7b:	c3                   	ret
+80101d7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101d80 <dcenter>:
+
+// Record that name in dp is the dirent at off referring
+// to inum, or that there is no such name if inum is 0.
+static void
+dcenter(struct inode *dp, char *name, uint inum, uint off)
+{
+80101d80:	55                   	push   %ebp
+80101d81:	89 e5                	mov    %esp,%ebp
+80101d83:	57                   	push   %edi
+80101d84:	89 d7                	mov    %edx,%edi
+80101d86:	56                   	push   %esi
+80101d87:	89 c6                	mov    %eax,%esi
+80101d89:	53                   	push   %ebx
+80101d8a:	83 ec 28             	sub    $0x28,%esp
+80101d8d:	8b 45 08             	mov    0x8(%ebp),%eax
+80101d90:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80101d93:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  struct dentry *d;
+  uint h;
+
+  acquire(&dcache.lock);
+80101d96:	68 40 71 11 80       	push   $0x80117140
+80101d9b:	e8 80 5f 00 00       	call   80107d20 <acquire>
+  if((d = dcfind(dp, name)) == 0){
+80101da0:	89 fa                	mov    %edi,%edx
+80101da2:	89 f0                	mov    %esi,%eax
+80101da4:	e8 27 ff ff ff       	call   80101cd0 <dcfind>
+80101da9:	83 c4 10             	add    $0x10,%esp
+80101dac:	89 c3                	mov    %eax,%ebx
+80101dae:	85 c0                	test   %eax,%eax
+80101db0:	74 4e                	je     80101e00 <dcenter+0x80>
+    strncpy(d->name, name, DIRSIZ);
+    h = dhash(d->dev, d->dir, d->name);
+    d->hnext = dcache.hash[h];
+    dcache.hash[h] = d;
+  }
+  d->inum = inum;
+80101db2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  d->next->prev = d->prev;
+80101db5:	8b 53 28             	mov    0x28(%ebx),%edx
+  d->inum = inum;
+80101db8:	89 43 18             	mov    %eax,0x18(%ebx)
+  d->off = off;
+80101dbb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80101dbe:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  d->next->prev = d->prev;
+80101dc1:	8b 43 24             	mov    0x24(%ebx),%eax
+80101dc4:	89 42 24             	mov    %eax,0x24(%edx)
+  d->prev->next = d->next;
+80101dc7:	8b 53 28             	mov    0x28(%ebx),%edx
+80101dca:	89 50 28             	mov    %edx,0x28(%eax)
+    d->next = &dcache.lru;
+80101dcd:	c7 43 28 68 9e 11 80 	movl   $0x80119e68,0x28(%ebx)
+    d->prev = dcache.lru.prev;
+80101dd4:	a1 8c 9e 11 80       	mov    0x80119e8c,%eax
+80101dd9:	89 43 24             	mov    %eax,0x24(%ebx)
+  d->prev->next = d;
+80101ddc:	89 58 28             	mov    %ebx,0x28(%eax)
+  d->next->prev = d;
+80101ddf:	8b 43 28             	mov    0x28(%ebx),%eax
+80101de2:	89 58 24             	mov    %ebx,0x24(%eax)
+  dctouch(d, 0);
+  release(&dcache.lock);
+80101de5:	c7 45 08 40 71 11 80 	movl   $0x80117140,0x8(%ebp)
+}
+80101dec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101def:	5b                   	pop    %ebx
+80101df0:	5e                   	pop    %esi
+80101df1:	5f                   	pop    %edi
+80101df2:	5d                   	pop    %ebp
+  release(&dcache.lock);
+80101df3:	e9 c8 5e 00 00       	jmp    80107cc0 <release>
+80101df8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101dff:	90                   	nop
+    d = dcache.lru.next;
+80101e00:	8b 1d 90 9e 11 80    	mov    0x80119e90,%ebx
+    if(d->dir != 0)
+80101e06:	8b 43 04             	mov    0x4(%ebx),%eax
+80101e09:	85 c0                	test   %eax,%eax
+80101e0b:	0f 85 87 00 00 00    	jne    80101e98 <dcenter+0x118>
+    d->dev = dp->dev;
+80101e11:	8b 06                	mov    (%esi),%eax
+    strncpy(d->name, name, DIRSIZ);
+80101e13:	83 ec 04             	sub    $0x4,%esp
+    d->dev = dp->dev;
+80101e16:	89 03                	mov    %eax,(%ebx)
+    d->dir = dp->inum;
+80101e18:	8b 46 04             	mov    0x4(%esi),%eax
+    strncpy(d->name, name, DIRSIZ);
+80101e1b:	8d 73 08             	lea    0x8(%ebx),%esi
+    d->dir = dp->inum;
+80101e1e:	89 43 04             	mov    %eax,0x4(%ebx)
+    strncpy(d->name, name, DIRSIZ);
+80101e21:	6a 0e                	push   $0xe
+80101e23:	57                   	push   %edi
+80101e24:	8d 7b 16             	lea    0x16(%ebx),%edi
+80101e27:	56                   	push   %esi
+80101e28:	e8 23 61 00 00       	call   80107f50 <strncpy>
+  h = dev*7 + dir;
+80101e2d:	8b 03                	mov    (%ebx),%eax
+80101e2f:	89 f2                	mov    %esi,%edx
+80101e31:	83 c4 10             	add    $0x10,%esp
+80101e34:	89 de                	mov    %ebx,%esi
+80101e36:	8d 0c c5 00 00 00 00 	lea    0x0(,%eax,8),%ecx
+80101e3d:	29 c1                	sub    %eax,%ecx
+80101e3f:	03 4b 04             	add    0x4(%ebx),%ecx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101e42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80101e48:	0f b6 1a             	movzbl (%edx),%ebx
+80101e4b:	84 db                	test   %bl,%bl
+80101e4d:	74 13                	je     80101e62 <dcenter+0xe2>
+    h = h*31 + (uchar)name[i];
+80101e4f:	89 c8                	mov    %ecx,%eax
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101e51:	83 c2 01             	add    $0x1,%edx
+    h = h*31 + (uchar)name[i];
+80101e54:	c1 e0 05             	shl    $0x5,%eax
+80101e57:	29 c8                	sub    %ecx,%eax
+80101e59:	0f b6 cb             	movzbl %bl,%ecx
+80101e5c:	01 c1                	add    %eax,%ecx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101e5e:	39 fa                	cmp    %edi,%edx
+80101e60:	75 e6                	jne    80101e48 <dcenter+0xc8>
+  return h % NDHASH;
+80101e62:	b8 3f c5 25 43       	mov    $0x4325c53f,%eax
+80101e67:	89 f3                	mov    %esi,%ebx
+80101e69:	f7 e1                	mul    %ecx
+80101e6b:	c1 ea 04             	shr    $0x4,%edx
+80101e6e:	6b c2 3d             	imul   $0x3d,%edx,%eax
+80101e71:	29 c1                	sub    %eax,%ecx
+80101e73:	89 ca                	mov    %ecx,%edx
+    d->hnext = dcache.hash[h];
+80101e75:	81 c2 0c 0b 00 00    	add    $0xb0c,%edx
+80101e7b:	8b 04 95 44 71 11 80 	mov    -0x7fee8ebc(,%edx,4),%eax
+80101e82:	89 46 20             	mov    %eax,0x20(%esi)
+    dcache.hash[h] = d;
+80101e85:	89 34 95 44 71 11 80 	mov    %esi,-0x7fee8ebc(,%edx,4)
+80101e8c:	e9 21 ff ff ff       	jmp    80101db2 <dcenter+0x32>
+80101e91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      dcdrop(d);
+80101e98:	89 d8                	mov    %ebx,%eax
+80101e9a:	e8 81 fd ff ff       	call   80101c20 <dcdrop>
+80101e9f:	e9 6d ff ff ff       	jmp    80101e11 <dcenter+0x91>
+80101ea4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101eab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101eaf:	90                   	nop
+
+80101eb0 <bindirect>:
+{
+80101eb0:	55                   	push   %ebp
+80101eb1:	89 e5                	mov    %esp,%ebp
+80101eb3:	57                   	push   %edi
+80101eb4:	89 cf                	mov    %ecx,%edi
+80101eb6:	56                   	push   %esi
+80101eb7:	89 c6                	mov    %eax,%esi
+80101eb9:	53                   	push   %ebx
+80101eba:	83 ec 24             	sub    $0x24,%esp
+  bp = bread(ip->dev, addr);
+80101ebd:	52                   	push   %edx
+80101ebe:	ff 30                	push   (%eax)
+80101ec0:	e8 2b e6 ff ff       	call   801004f0 <bread>
+  if((addr = a[bn]) == 0){
+80101ec5:	83 c4 10             	add    $0x10,%esp
+  bp = bread(ip->dev, addr);
+80101ec8:	89 c3                	mov    %eax,%ebx
+  if((addr = a[bn]) == 0){
+80101eca:	8b 40 60             	mov    0x60(%eax),%eax
+80101ecd:	8d 0c b8             	lea    (%eax,%edi,4),%ecx
+80101ed0:	8b 39                	mov    (%ecx),%edi
+80101ed2:	85 ff                	test   %edi,%edi
+80101ed4:	74 1a                	je     80101ef0 <bindirect+0x40>
+  brelse(bp);
+80101ed6:	83 ec 0c             	sub    $0xc,%esp
+80101ed9:	53                   	push   %ebx
+80101eda:	e8 51 e8 ff ff       	call   80100730 <brelse>
+}
+80101edf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101ee2:	89 f8                	mov    %edi,%eax
+80101ee4:	5b                   	pop    %ebx
+80101ee5:	5e                   	pop    %esi
+80101ee6:	5f                   	pop    %edi
+80101ee7:	5d                   	pop    %ebp
+80101ee8:	c3                   	ret
+80101ee9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ip->lastblk = balloc(ip->dev, ip->lastblk ? ip->lastblk + 1 : 0);
+80101ef0:	8b 56 5c             	mov    0x5c(%esi),%edx
+80101ef3:	8b 06                	mov    (%esi),%eax
+80101ef5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80101ef8:	83 fa 01             	cmp    $0x1,%edx
+80101efb:	83 da ff             	sbb    $0xffffffff,%edx
+80101efe:	e8 3d fb ff ff       	call   80101a40 <balloc>
+    a[bn] = addr = iballoc(ip);
+80101f03:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    log_write(bp);
+80101f06:	83 ec 0c             	sub    $0xc,%esp
+  ip->lastblk = balloc(ip->dev, ip->lastblk ? ip->lastblk + 1 : 0);
+80101f09:	89 46 5c             	mov    %eax,0x5c(%esi)
+80101f0c:	89 c7                	mov    %eax,%edi
+    a[bn] = addr = iballoc(ip);
+80101f0e:	89 01                	mov    %eax,(%ecx)
+    log_write(bp);
+80101f10:	53                   	push   %ebx
+80101f11:	e8 ea 31 00 00       	call   80105100 <log_write>
+80101f16:	83 c4 10             	add    $0x10,%esp
+80101f19:	eb bb                	jmp    80101ed6 <bindirect+0x26>
+80101f1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101f1f:	90                   	nop
+
+80101f20 <bmap>:
+{
+80101f20:	55                   	push   %ebp
+80101f21:	89 e5                	mov    %esp,%ebp
+80101f23:	56                   	push   %esi
+80101f24:	53                   	push   %ebx
+80101f25:	89 c3                	mov    %eax,%ebx
+  if(bn < NDIRECT){
+80101f27:	83 fa 0a             	cmp    $0xa,%edx
+80101f2a:	0f 86 80 00 00 00    	jbe    80101fb0 <bmap+0x90>
+  bn -= NDIRECT;
+80101f30:	8d 72 f5             	lea    -0xb(%edx),%esi
+  if(bn < NINDIRECT){
+80101f33:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+80101f39:	76 45                	jbe    80101f80 <bmap+0x60>
+  bn -= NINDIRECT;
+80101f3b:	8d b2 f5 fb ff ff    	lea    -0x40b(%edx),%esi
+  if(bn < NDINDIRECT){
+80101f41:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+80101f47:	0f 87 c1 00 00 00    	ja     8010200e <bmap+0xee>
+    if((addr = ip->addrs[NDIRECT+1]) == 0)
+80101f4d:	8b 90 9c 00 00 00    	mov    0x9c(%eax),%edx
+80101f53:	85 d2                	test   %edx,%edx
+80101f55:	74 71                	je     80101fc8 <bmap+0xa8>
+    addr = bindirect(ip, addr, bn / NINDIRECT);
+80101f57:	89 f1                	mov    %esi,%ecx
+80101f59:	89 d8                	mov    %ebx,%eax
+    return bindirect(ip, addr, bn % NINDIRECT);
+80101f5b:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    addr = bindirect(ip, addr, bn / NINDIRECT);
+80101f61:	c1 e9 0a             	shr    $0xa,%ecx
+80101f64:	e8 47 ff ff ff       	call   80101eb0 <bindirect>
+80101f69:	89 c2                	mov    %eax,%edx
+}
+80101f6b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return bindirect(ip, addr, bn % NINDIRECT);
+80101f6e:	89 f1                	mov    %esi,%ecx
+80101f70:	89 d8                	mov    %ebx,%eax
+}
+80101f72:	5b                   	pop    %ebx
+80101f73:	5e                   	pop    %esi
+80101f74:	5d                   	pop    %ebp
+    return bindirect(ip, addr, bn % NINDIRECT);
+80101f75:	e9 36 ff ff ff       	jmp    80101eb0 <bindirect>
+80101f7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if((addr = ip->addrs[NDIRECT]) == 0)
+80101f80:	8b 90 98 00 00 00    	mov    0x98(%eax),%edx
+80101f86:	85 d2                	test   %edx,%edx
+80101f88:	75 e1                	jne    80101f6b <bmap+0x4b>
+  ip->lastblk = balloc(ip->dev, ip->lastblk ? ip->lastblk + 1 : 0);
+80101f8a:	8b 50 5c             	mov    0x5c(%eax),%edx
+80101f8d:	8b 00                	mov    (%eax),%eax
+80101f8f:	83 fa 01             	cmp    $0x1,%edx
+80101f92:	83 da ff             	sbb    $0xffffffff,%edx
+80101f95:	e8 a6 fa ff ff       	call   80101a40 <balloc>
+80101f9a:	89 43 5c             	mov    %eax,0x5c(%ebx)
+80101f9d:	89 c2                	mov    %eax,%edx
+      ip->addrs[NDIRECT] = addr = iballoc(ip);
+80101f9f:	89 83 98 00 00 00    	mov    %eax,0x98(%ebx)
+    return bindirect(ip, addr, bn);
+80101fa5:	eb c4                	jmp    80101f6b <bmap+0x4b>
+80101fa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101fae:	66 90                	xchg   %ax,%ax
+    if((addr = ip->addrs[bn]) == 0)
+80101fb0:	8d 72 18             	lea    0x18(%edx),%esi
+80101fb3:	8b 44 b0 0c          	mov    0xc(%eax,%esi,4),%eax
+80101fb7:	85 c0                	test   %eax,%eax
+80101fb9:	74 35                	je     80101ff0 <bmap+0xd0>
+}
+80101fbb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101fbe:	5b                   	pop    %ebx
+80101fbf:	5e                   	pop    %esi
+80101fc0:	5d                   	pop    %ebp
+80101fc1:	c3                   	ret
+80101fc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ip->lastblk = balloc(ip->dev, ip->lastblk ? ip->lastblk + 1 : 0);
+80101fc8:	8b 50 5c             	mov    0x5c(%eax),%edx
+80101fcb:	8b 00                	mov    (%eax),%eax
+80101fcd:	83 fa 01             	cmp    $0x1,%edx
+80101fd0:	83 da ff             	sbb    $0xffffffff,%edx
+80101fd3:	e8 68 fa ff ff       	call   80101a40 <balloc>
+80101fd8:	89 43 5c             	mov    %eax,0x5c(%ebx)
+80101fdb:	89 c2                	mov    %eax,%edx
+      ip->addrs[NDIRECT+1] = addr = iballoc(ip);
+80101fdd:	89 83 9c 00 00 00    	mov    %eax,0x9c(%ebx)
+80101fe3:	e9 6f ff ff ff       	jmp    80101f57 <bmap+0x37>
+80101fe8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101fef:	90                   	nop
+  ip->lastblk = balloc(ip->dev, ip->lastblk ? ip->lastblk + 1 : 0);
+80101ff0:	8b 53 5c             	mov    0x5c(%ebx),%edx
+80101ff3:	8b 03                	mov    (%ebx),%eax
+80101ff5:	83 fa 01             	cmp    $0x1,%edx
+80101ff8:	83 da ff             	sbb    $0xffffffff,%edx
+80101ffb:	e8 40 fa ff ff       	call   80101a40 <balloc>
+80102000:	89 43 5c             	mov    %eax,0x5c(%ebx)
+      ip->addrs[bn] = addr = iballoc(ip);
+80102003:	89 44 b3 0c          	mov    %eax,0xc(%ebx,%esi,4)
+}
+80102007:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010200a:	5b                   	pop    %ebx
+8010200b:	5e                   	pop    %esi
+8010200c:	5d                   	pop    %ebp
+8010200d:	c3                   	ret
+  panic("bmap: out of range");
+8010200e:	83 ec 0c             	sub    $0xc,%esp
+80102011:	68 b0 b6 10 80       	push   $0x8010b6b0
+80102016:	e8 65 e8 ff ff       	call   80100880 <panic>
+8010201b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010201f:	90                   	nop
+
+80102020 <readsb>:
+{
+80102020:	55                   	push   %ebp
+80102021:	89 e5                	mov    %esp,%ebp
+80102023:	56                   	push   %esi
+80102024:	53                   	push   %ebx
+80102025:	8b 75 0c             	mov    0xc(%ebp),%esi
+  bp = bread(dev, 1);
+80102028:	83 ec 08             	sub    $0x8,%esp
+8010202b:	6a 01                	push   $0x1
+8010202d:	ff 75 08             	push   0x8(%ebp)
+80102030:	e8 bb e4 ff ff       	call   801004f0 <bread>
+  memmove(sb, bp->data, sizeof(*sb));
+80102035:	83 c4 0c             	add    $0xc,%esp
+80102038:	6a 1c                	push   $0x1c
+  bp = bread(dev, 1);
+8010203a:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+8010203c:	ff 70 60             	push   0x60(%eax)
+8010203f:	56                   	push   %esi
+80102040:	e8 4b 5e 00 00       	call   80107e90 <memmove>
+  brelse(bp);
+80102045:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80102048:	83 c4 10             	add    $0x10,%esp
+}
+8010204b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010204e:	5b                   	pop    %ebx
+8010204f:	5e                   	pop    %esi
+80102050:	5d                   	pop    %ebp
+  brelse(bp);
+80102051:	e9 da e6 ff ff       	jmp    80100730 <brelse>
+80102056:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010205d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80102060 <iinit>:
+{
+80102060:	55                   	push   %ebp
+80102061:	89 e5                	mov    %esp,%ebp
+80102063:	57                   	push   %edi
+80102064:	56                   	push   %esi
+80102065:	53                   	push   %ebx
+  for(ip = icache.inode; ip < &icache.inode[NINODE]; ip++){
+80102066:	bb d4 9e 11 80       	mov    $0x80119ed4,%ebx
+{
+8010206b:	83 ec 34             	sub    $0x34,%esp
+  initlock(&icache.lock, "icache");
+8010206e:	68 c3 b6 10 80       	push   $0x8010b6c3
+80102073:	68 a0 9e 11 80       	push   $0x80119ea0
+80102078:	e8 c3 5a 00 00       	call   80107b40 <initlock>
+  icache.lru.next = &icache.lru;
+8010207d:	83 c4 10             	add    $0x10,%esp
+  icache.lru.prev = &icache.lru;
+80102080:	c7 05 d8 1c 12 80 c8 	movl   $0x80121cc8,0x80121cd8
+80102087:	1c 12 80 
+  icache.lru.next = &icache.lru;
+8010208a:	c7 05 dc 1c 12 80 c8 	movl   $0x80121cc8,0x80121cdc
+80102091:	1c 12 80 
+  for(ip = icache.inode; ip < &icache.inode[NINODE]; ip++){
+80102094:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    initsleeplock(&ip->lock, "inode");
+80102098:	83 ec 08             	sub    $0x8,%esp
+8010209b:	8d 43 18             	lea    0x18(%ebx),%eax
+8010209e:	68 ca b6 10 80       	push   $0x8010b6ca
+801020a3:	50                   	push   %eax
+801020a4:	e8 07 59 00 00       	call   801079b0 <initsleeplock>
+  ip->next = &icache.lru;
+801020a9:	c7 43 14 c8 1c 12 80 	movl   $0x80121cc8,0x14(%ebx)
+  for(ip = icache.inode; ip < &icache.inode[NINODE]; ip++){
+801020b0:	83 c4 10             	add    $0x10,%esp
+  ip->prev = icache.lru.prev;
+801020b3:	a1 d8 1c 12 80       	mov    0x80121cd8,%eax
+801020b8:	89 43 10             	mov    %eax,0x10(%ebx)
+  icache.lru.prev->next = ip;
+801020bb:	89 58 14             	mov    %ebx,0x14(%eax)
+    ip->hnext = icache.hash[h];
+801020be:	a1 d4 1b 12 80       	mov    0x80121bd4,%eax
+  icache.lru.prev = ip;
+801020c3:	89 1d d8 1c 12 80    	mov    %ebx,0x80121cd8
+    ip->hnext = icache.hash[h];
+801020c9:	89 43 0c             	mov    %eax,0xc(%ebx)
+    icache.hash[h] = ip;
+801020cc:	89 1d d4 1b 12 80    	mov    %ebx,0x80121bd4
+  for(ip = icache.inode; ip < &icache.inode[NINODE]; ip++){
+801020d2:	81 c3 a0 00 00 00    	add    $0xa0,%ebx
+801020d8:	81 fb d4 1b 12 80    	cmp    $0x80121bd4,%ebx
+801020de:	75 b8                	jne    80102098 <iinit+0x38>
+  initlock(&dcache.lock, "dcache");
+801020e0:	83 ec 08             	sub    $0x8,%esp
+801020e3:	68 d0 b6 10 80       	push   $0x8010b6d0
+801020e8:	68 40 71 11 80       	push   $0x80117140
+801020ed:	e8 4e 5a 00 00       	call   80107b40 <initlock>
+  dcache.lru.next = &dcache.lru;
+801020f2:	83 c4 10             	add    $0x10,%esp
+  for(d = dcache.dentry; d < &dcache.dentry[NDENTRY]; d++){
+801020f5:	b8 74 71 11 80       	mov    $0x80117174,%eax
+  dcache.lru.prev = &dcache.lru;
+801020fa:	c7 05 8c 9e 11 80 68 	movl   $0x80119e68,0x80119e8c
+80102101:	9e 11 80 
+  dcache.lru.next = &dcache.lru;
+80102104:	c7 05 90 9e 11 80 68 	movl   $0x80119e68,0x80119e90
+8010210b:	9e 11 80 
+  for(d = dcache.dentry; d < &dcache.dentry[NDENTRY]; d++){
+8010210e:	66 90                	xchg   %ax,%ax
+    d->next = &dcache.lru;
+80102110:	c7 40 28 68 9e 11 80 	movl   $0x80119e68,0x28(%eax)
+    d->prev = dcache.lru.prev;
+80102117:	8b 15 8c 9e 11 80    	mov    0x80119e8c,%edx
+8010211d:	89 50 24             	mov    %edx,0x24(%eax)
+    dcache.lru.prev->next = d;
+80102120:	89 42 28             	mov    %eax,0x28(%edx)
+    dcache.lru.prev = d;
+80102123:	a3 8c 9e 11 80       	mov    %eax,0x80119e8c
+  for(d = dcache.dentry; d < &dcache.dentry[NDENTRY]; d++){
+80102128:	83 c0 2c             	add    $0x2c,%eax
+8010212b:	3d 74 9d 11 80       	cmp    $0x80119d74,%eax
+80102130:	75 de                	jne    80102110 <iinit+0xb0>
+  bp = bread(dev, 1);
+80102132:	83 ec 08             	sub    $0x8,%esp
+80102135:	6a 01                	push   $0x1
+80102137:	ff 75 08             	push   0x8(%ebp)
+8010213a:	e8 b1 e3 ff ff       	call   801004f0 <bread>
+  memmove(sb, bp->data, sizeof(*sb));
+8010213f:	83 c4 0c             	add    $0xc,%esp
+80102142:	6a 1c                	push   $0x1c
+  bp = bread(dev, 1);
+80102144:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+80102146:	ff 70 60             	push   0x60(%eax)
+80102149:	68 68 1d 12 80       	push   $0x80121d68
+8010214e:	e8 3d 5d 00 00       	call   80107e90 <memmove>
+  brelse(bp);
+80102153:	89 1c 24             	mov    %ebx,(%esp)
+80102156:	e8 d5 e5 ff ff       	call   80100730 <brelse>
+  if(sb.size > NBMAP*BPB)
+8010215b:	a1 68 1d 12 80       	mov    0x80121d68,%eax
+80102160:	83 c4 10             	add    $0x10,%esp
+80102163:	3d 00 80 00 00       	cmp    $0x8000,%eax
+80102168:	0f 87 05 01 00 00    	ja     80102273 <iinit+0x213>
+  for(b = 0; b < sb.size; b += BPB){
+8010216e:	31 f6                	xor    %esi,%esi
+80102170:	85 c0                	test   %eax,%eax
+80102172:	0f 84 c1 00 00 00    	je     80102239 <iinit+0x1d9>
+    bp = bread(dev, BBLOCK(b, sb));
+80102178:	a1 80 1d 12 80       	mov    0x80121d80,%eax
+8010217d:	89 f3                	mov    %esi,%ebx
+8010217f:	83 ec 08             	sub    $0x8,%esp
+80102182:	c1 eb 0f             	shr    $0xf,%ebx
+80102185:	01 d8                	add    %ebx,%eax
+80102187:	50                   	push   %eax
+80102188:	ff 75 08             	push   0x8(%ebp)
+8010218b:	e8 60 e3 ff ff       	call   801004f0 <bread>
+    w = (uint*)bp->data;
+80102190:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+80102193:	83 c4 10             	add    $0x10,%esp
+80102196:	8b 78 60             	mov    0x60(%eax),%edi
+80102199:	89 45 d8             	mov    %eax,-0x28(%ebp)
+8010219c:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi += 32){
+8010219f:	8b 3d 68 1d 12 80    	mov    0x80121d68,%edi
+801021a5:	89 f9                	mov    %edi,%ecx
+801021a7:	89 7d e0             	mov    %edi,-0x20(%ebp)
+801021aa:	31 ff                	xor    %edi,%edi
+801021ac:	29 f1                	sub    %esi,%ecx
+801021ae:	66 90                	xchg   %ax,%ax
+801021b0:	8b 75 e0             	mov    -0x20(%ebp),%esi
+801021b3:	89 f0                	mov    %esi,%eax
+801021b5:	29 c8                	sub    %ecx,%eax
+801021b7:	39 f0                	cmp    %esi,%eax
+801021b9:	73 59                	jae    80102214 <iinit+0x1b4>
+      x = ~w[bi/32];
+801021bb:	8b 75 dc             	mov    -0x24(%ebp),%esi
+801021be:	89 f8                	mov    %edi,%eax
+801021c0:	c1 e8 05             	shr    $0x5,%eax
+801021c3:	8b 04 86             	mov    (%esi,%eax,4),%eax
+801021c6:	f7 d0                	not    %eax
+      if(sb.size - (b + bi) < 32)
+801021c8:	83 f9 1f             	cmp    $0x1f,%ecx
+801021cb:	77 0c                	ja     801021d9 <iinit+0x179>
+        x &= (1 << (sb.size - (b + bi))) - 1;
+801021cd:	ba 01 00 00 00       	mov    $0x1,%edx
+801021d2:	d3 e2                	shl    %cl,%edx
+801021d4:	83 ea 01             	sub    $0x1,%edx
+801021d7:	21 d0                	and    %edx,%eax
+      for(; x; x &= x - 1)
+801021d9:	85 c0                	test   %eax,%eax
+801021db:	74 29                	je     80102206 <iinit+0x1a6>
+801021dd:	8b 34 9d 84 1d 12 80 	mov    -0x7fede27c(,%ebx,4),%esi
+801021e4:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+801021e7:	8d 56 01             	lea    0x1(%esi),%edx
+801021ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801021f0:	8d 58 ff             	lea    -0x1(%eax),%ebx
+801021f3:	89 d6                	mov    %edx,%esi
+801021f5:	83 c2 01             	add    $0x1,%edx
+801021f8:	21 d8                	and    %ebx,%eax
+801021fa:	75 f4                	jne    801021f0 <iinit+0x190>
+801021fc:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+801021ff:	89 34 9d 84 1d 12 80 	mov    %esi,-0x7fede27c(,%ebx,4)
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi += 32){
+80102206:	83 c7 20             	add    $0x20,%edi
+80102209:	83 e9 20             	sub    $0x20,%ecx
+8010220c:	81 ff 00 80 00 00    	cmp    $0x8000,%edi
+80102212:	75 9c                	jne    801021b0 <iinit+0x150>
+80102214:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    brelse(bp);
+80102217:	83 ec 0c             	sub    $0xc,%esp
+8010221a:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+8010221d:	50                   	push   %eax
+  for(b = 0; b < sb.size; b += BPB){
+8010221e:	81 c6 00 80 00 00    	add    $0x8000,%esi
+    brelse(bp);
+80102224:	e8 07 e5 ff ff       	call   80100730 <brelse>
+  for(b = 0; b < sb.size; b += BPB){
+80102229:	a1 68 1d 12 80       	mov    0x80121d68,%eax
+8010222e:	83 c4 10             	add    $0x10,%esp
+80102231:	39 c6                	cmp    %eax,%esi
+80102233:	0f 82 3f ff ff ff    	jb     80102178 <iinit+0x118>
+  cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
+80102239:	ff 35 80 1d 12 80    	push   0x80121d80
+8010223f:	ff 35 7c 1d 12 80    	push   0x80121d7c
+80102245:	ff 35 78 1d 12 80    	push   0x80121d78
+8010224b:	ff 35 74 1d 12 80    	push   0x80121d74
+80102251:	ff 35 70 1d 12 80    	push   0x80121d70
+80102257:	ff 35 6c 1d 12 80    	push   0x80121d6c
+8010225d:	50                   	push   %eax
+8010225e:	68 48 b7 10 80       	push   $0x8010b748
+80102263:	e8 48 e9 ff ff       	call   80100bb0 <cprintf>
+}
+80102268:	83 c4 20             	add    $0x20,%esp
+8010226b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010226e:	5b                   	pop    %ebx
+8010226f:	5e                   	pop    %esi
+80102270:	5f                   	pop    %edi
+80102271:	5d                   	pop    %ebp
+80102272:	c3                   	ret
+    panic("bsuminit: bitmap too big");
+80102273:	83 ec 0c             	sub    $0xc,%esp
+80102276:	68 d7 b6 10 80       	push   $0x8010b6d7
+8010227b:	e8 00 e6 ff ff       	call   80100880 <panic>
+
+80102280 <ialloc>:
+{
+80102280:	55                   	push   %ebp
+80102281:	89 e5                	mov    %esp,%ebp
+80102283:	57                   	push   %edi
+80102284:	56                   	push   %esi
+80102285:	53                   	push   %ebx
+80102286:	83 ec 1c             	sub    $0x1c,%esp
+80102289:	8b 45 0c             	mov    0xc(%ebp),%eax
+  for(inum = 1; inum < sb.ninodes; inum++){
+8010228c:	83 3d 70 1d 12 80 01 	cmpl   $0x1,0x80121d70
+{
+80102293:	8b 75 08             	mov    0x8(%ebp),%esi
+80102296:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(inum = 1; inum < sb.ninodes; inum++){
+80102299:	0f 86 94 00 00 00    	jbe    80102333 <ialloc+0xb3>
+8010229f:	bf 01 00 00 00       	mov    $0x1,%edi
+801022a4:	eb 21                	jmp    801022c7 <ialloc+0x47>
+801022a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801022ad:	8d 76 00             	lea    0x0(%esi),%esi
+    brelse(bp);
+801022b0:	83 ec 0c             	sub    $0xc,%esp
+  for(inum = 1; inum < sb.ninodes; inum++){
+801022b3:	83 c7 01             	add    $0x1,%edi
+    brelse(bp);
+801022b6:	50                   	push   %eax
+801022b7:	e8 74 e4 ff ff       	call   80100730 <brelse>
+  for(inum = 1; inum < sb.ninodes; inum++){
+801022bc:	83 c4 10             	add    $0x10,%esp
+801022bf:	3b 3d 70 1d 12 80    	cmp    0x80121d70,%edi
+801022c5:	73 6c                	jae    80102333 <ialloc+0xb3>
+    bp = bread(dev, IBLOCK(inum, sb));
+801022c7:	89 f8                	mov    %edi,%eax
+801022c9:	83 ec 08             	sub    $0x8,%esp
+    dip = (struct dinode*)bp->data + inum%IPB;
+801022cc:	89 fb                	mov    %edi,%ebx
+    bp = bread(dev, IBLOCK(inum, sb));
+801022ce:	c1 e8 06             	shr    $0x6,%eax
+801022d1:	03 05 7c 1d 12 80    	add    0x80121d7c,%eax
+    dip = (struct dinode*)bp->data + inum%IPB;
+801022d7:	83 e3 3f             	and    $0x3f,%ebx
+    bp = bread(dev, IBLOCK(inum, sb));
+801022da:	50                   	push   %eax
+    dip = (struct dinode*)bp->data + inum%IPB;
+801022db:	c1 e3 06             	shl    $0x6,%ebx
+    bp = bread(dev, IBLOCK(inum, sb));
+801022de:	56                   	push   %esi
+801022df:	e8 0c e2 ff ff       	call   801004f0 <bread>
+    if(dip->type == 0){  // a free inode
+801022e4:	83 c4 10             	add    $0x10,%esp
+    dip = (struct dinode*)bp->data + inum%IPB;
+801022e7:	03 58 60             	add    0x60(%eax),%ebx
+    if(dip->type == 0){  // a free inode
+801022ea:	66 83 3b 00          	cmpw   $0x0,(%ebx)
+801022ee:	75 c0                	jne    801022b0 <ialloc+0x30>
+      memset(dip, 0, sizeof(*dip));
+801022f0:	83 ec 04             	sub    $0x4,%esp
+801022f3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801022f6:	6a 40                	push   $0x40
+801022f8:	6a 00                	push   $0x0
+801022fa:	53                   	push   %ebx
+801022fb:	e8 00 5b 00 00       	call   80107e00 <memset>
+      dip->type = type;
+80102300:	0f b7 45 e4          	movzwl -0x1c(%ebp),%eax
+      log_write(bp);   // mark it allocated on the disk
+80102304:	8b 55 e0             	mov    -0x20(%ebp),%edx
+      dip->type = type;
+80102307:	66 89 03             	mov    %ax,(%ebx)
+      log_write(bp);   // mark it allocated on the disk
+8010230a:	89 14 24             	mov    %edx,(%esp)
+8010230d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80102310:	e8 eb 2d 00 00       	call   80105100 <log_write>
+      brelse(bp);
+80102315:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102318:	89 14 24             	mov    %edx,(%esp)
+8010231b:	e8 10 e4 ff ff       	call   80100730 <brelse>
+      return iget(dev, inum);
+80102320:	83 c4 10             	add    $0x10,%esp
+}
+80102323:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return iget(dev, inum);
+80102326:	89 fa                	mov    %edi,%edx
+}
+80102328:	5b                   	pop    %ebx
+      return iget(dev, inum);
+80102329:	89 f0                	mov    %esi,%eax
+}
+8010232b:	5e                   	pop    %esi
+8010232c:	5f                   	pop    %edi
+8010232d:	5d                   	pop    %ebp
+      return iget(dev, inum);
+8010232e:	e9 bd f5 ff ff       	jmp    801018f0 <iget>
+  panic("ialloc: no inodes");
+80102333:	83 ec 0c             	sub    $0xc,%esp
+80102336:	68 f0 b6 10 80       	push   $0x8010b6f0
+8010233b:	e8 40 e5 ff ff       	call   80100880 <panic>
+
+80102340 <iupdate>:
+{
+80102340:	55                   	push   %ebp
+80102341:	89 e5                	mov    %esp,%ebp
+80102343:	56                   	push   %esi
+80102344:	53                   	push   %ebx
+80102345:	8b 75 08             	mov    0x8(%ebp),%esi
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80102348:	8b 46 04             	mov    0x4(%esi),%eax
+8010234b:	83 ec 08             	sub    $0x8,%esp
+8010234e:	c1 e8 06             	shr    $0x6,%eax
+80102351:	03 05 7c 1d 12 80    	add    0x80121d7c,%eax
+80102357:	50                   	push   %eax
+80102358:	ff 36                	push   (%esi)
+8010235a:	e8 91 e1 ff ff       	call   801004f0 <bread>
+  dip->type = ip->type;
+8010235f:	0f b7 56 60          	movzwl 0x60(%esi),%edx
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80102363:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80102366:	89 c3                	mov    %eax,%ebx
+  dip = (struct dinode*)bp->data + ip->inum%IPB;
+80102368:	8b 46 04             	mov    0x4(%esi),%eax
+8010236b:	83 e0 3f             	and    $0x3f,%eax
+8010236e:	c1 e0 06             	shl    $0x6,%eax
+80102371:	03 43 60             	add    0x60(%ebx),%eax
+  dip->type = ip->type;
+80102374:	66 89 10             	mov    %dx,(%eax)
+  dip->major = ip->major;
+80102377:	0f b7 56 62          	movzwl 0x62(%esi),%edx
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+8010237b:	83 c0 0c             	add    $0xc,%eax
+  dip->major = ip->major;
+8010237e:	66 89 50 f6          	mov    %dx,-0xa(%eax)
+  dip->minor = ip->minor;
+80102382:	0f b7 56 64          	movzwl 0x64(%esi),%edx
+80102386:	66 89 50 f8          	mov    %dx,-0x8(%eax)
+  dip->nlink = ip->nlink;
+8010238a:	0f b7 56 66          	movzwl 0x66(%esi),%edx
+8010238e:	66 89 50 fa          	mov    %dx,-0x6(%eax)
+  dip->size = ip->size;
+80102392:	8b 56 68             	mov    0x68(%esi),%edx
+80102395:	89 50 fc             	mov    %edx,-0x4(%eax)
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80102398:	8d 56 6c             	lea    0x6c(%esi),%edx
+8010239b:	6a 34                	push   $0x34
+8010239d:	52                   	push   %edx
+8010239e:	50                   	push   %eax
+8010239f:	e8 ec 5a 00 00       	call   80107e90 <memmove>
+  log_write(bp);
+801023a4:	89 1c 24             	mov    %ebx,(%esp)
+801023a7:	e8 54 2d 00 00       	call   80105100 <log_write>
+  brelse(bp);
+801023ac:	89 5d 08             	mov    %ebx,0x8(%ebp)
+801023af:	83 c4 10             	add    $0x10,%esp
+}
+801023b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801023b5:	5b                   	pop    %ebx
+801023b6:	5e                   	pop    %esi
+801023b7:	5d                   	pop    %ebp
+  brelse(bp);
+801023b8:	e9 73 e3 ff ff       	jmp    80100730 <brelse>
+801023bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+801023c0 <dxlink>:
+// Add (name, inum) to the hashed directory dp, splitting
+// its leaf if that is full. Return -1 if the leaf cannot
+// be split.
+static int
+dxlink(struct inode *dp, char *name, uint inum)
+{
+801023c0:	55                   	push   %ebp
+801023c1:	89 e5                	mov    %esp,%ebp
+801023c3:	57                   	push   %edi
+801023c4:	56                   	push   %esi
+801023c5:	53                   	push   %ebx
+801023c6:	89 c3                	mov    %eax,%ebx
+801023c8:	83 ec 5c             	sub    $0x5c,%esp
+801023cb:	89 55 b0             	mov    %edx,-0x50(%ebp)
+  h = 2166136261U;
+801023ce:	c7 45 e0 c5 9d 1c 81 	movl   $0x811c9dc5,-0x20(%ebp)
+{
+801023d5:	89 4d ac             	mov    %ecx,-0x54(%ebp)
+801023d8:	8d 4a 0e             	lea    0xe(%edx),%ecx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+801023db:	0f b6 02             	movzbl (%edx),%eax
+801023de:	84 c0                	test   %al,%al
+801023e0:	74 15                	je     801023f7 <dxlink+0x37>
+    h = (h ^ (uchar)name[i]) * 16777619;
+801023e2:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+801023e5:	83 c2 01             	add    $0x1,%edx
+    h = (h ^ (uchar)name[i]) * 16777619;
+801023e8:	31 f0                	xor    %esi,%eax
+801023ea:	69 c0 93 01 00 01    	imul   $0x1000193,%eax,%eax
+801023f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+801023f3:	39 ca                	cmp    %ecx,%edx
+801023f5:	75 e4                	jne    801023db <dxlink+0x1b>
+    if((addr = ip->addrs[bn]) == 0)
+801023f7:	8b 43 6c             	mov    0x6c(%ebx),%eax
+801023fa:	85 c0                	test   %eax,%eax
+801023fc:	0f 84 c8 03 00 00    	je     801027ca <dxlink+0x40a>
+  struct dirent *de, *nde;
+  uint h, m, bn, nb;
+  int i, j, k, n;
+
+  h = dirhash(name);
+  bp = bread(dp->dev, bmap(dp, 0));
+80102402:	83 ec 08             	sub    $0x8,%esp
+  lo = 0;
+80102405:	31 ff                	xor    %edi,%edi
+  bp = bread(dp->dev, bmap(dp, 0));
+80102407:	50                   	push   %eax
+80102408:	ff 33                	push   (%ebx)
+8010240a:	e8 e1 e0 ff ff       	call   801004f0 <bread>
+  while(lo < hi){
+8010240f:	83 c4 10             	add    $0x10,%esp
+  bp = bread(dp->dev, bmap(dp, 0));
+80102412:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  dx = (struct dxentry*)bp->data;
+80102415:	8b 40 60             	mov    0x60(%eax),%eax
+80102418:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  n = dp->size/BSIZE - 1;
+8010241b:	8b 43 68             	mov    0x68(%ebx),%eax
+8010241e:	c1 e8 0c             	shr    $0xc,%eax
+80102421:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  hi = n - 1;
+80102424:	8d 50 fe             	lea    -0x2(%eax),%edx
+  while(lo < hi){
+80102427:	eb 18                	jmp    80102441 <dxlink+0x81>
+    mid = (lo + hi + 1) / 2;
+80102429:	8d 44 17 01          	lea    0x1(%edi,%edx,1),%eax
+    if(dx[mid].hash <= h)
+8010242d:	8b 75 bc             	mov    -0x44(%ebp),%esi
+80102430:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    mid = (lo + hi + 1) / 2;
+80102433:	d1 f8                	sar    %eax
+    if(dx[mid].hash <= h)
+80102435:	3b 4c c6 04          	cmp    0x4(%esi,%eax,8),%ecx
+80102439:	0f 82 da 00 00 00    	jb     80102519 <dxlink+0x159>
+    mid = (lo + hi + 1) / 2;
+8010243f:	89 c7                	mov    %eax,%edi
+  while(lo < hi){
+80102441:	39 d7                	cmp    %edx,%edi
+80102443:	7c e4                	jl     80102429 <dxlink+0x69>
+  k = dxfind(dx, n, h);
+  bn = dx[k].blk;
+80102445:	8d 04 fd 00 00 00 00 	lea    0x0(,%edi,8),%eax
+8010244c:	89 45 b8             	mov    %eax,-0x48(%ebp)
+8010244f:	8b 45 bc             	mov    -0x44(%ebp),%eax
+80102452:	0f b7 44 f8 02       	movzwl 0x2(%eax,%edi,8),%eax
+  lp = bread(dp->dev, bmap(dp, bn));
+80102457:	89 c2                	mov    %eax,%edx
+  bn = dx[k].blk;
+80102459:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  lp = bread(dp->dev, bmap(dp, bn));
+8010245c:	89 d8                	mov    %ebx,%eax
+8010245e:	e8 bd fa ff ff       	call   80101f20 <bmap>
+80102463:	83 ec 08             	sub    $0x8,%esp
+80102466:	50                   	push   %eax
+80102467:	ff 33                	push   (%ebx)
+80102469:	e8 82 e0 ff ff       	call   801004f0 <bread>
+  de = (struct dirent*)lp->data;
+8010246e:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < DPB; i++)
+80102471:	31 d2                	xor    %edx,%edx
+  lp = bread(dp->dev, bmap(dp, bn));
+80102473:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  de = (struct dirent*)lp->data;
+80102476:	8b 40 60             	mov    0x60(%eax),%eax
+80102479:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  for(i = 0; i < DPB; i++)
+8010247c:	eb 0f                	jmp    8010248d <dxlink+0xcd>
+8010247e:	83 c2 01             	add    $0x1,%edx
+80102481:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+80102487:	0f 84 94 00 00 00    	je     80102521 <dxlink+0x161>
+    if(de[i].inum == 0)
+8010248d:	8b 75 d0             	mov    -0x30(%ebp),%esi
+80102490:	89 d0                	mov    %edx,%eax
+80102492:	c1 e0 04             	shl    $0x4,%eax
+80102495:	66 83 3c 06 00       	cmpw   $0x0,(%esi,%eax,1)
+8010249a:	75 e2                	jne    8010247e <dxlink+0xbe>
+
+  strncpy(de[i].name, name, DIRSIZ);
+  de[i].inum = inum;
+  log_write(lp);
+  brelse(lp);
+  dcenter(dp, name, inum, bn*BSIZE + i*sizeof(*de));
+8010249c:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+  strncpy(de[i].name, name, DIRSIZ);
+8010249f:	89 d7                	mov    %edx,%edi
+  dcenter(dp, name, inum, bn*BSIZE + i*sizeof(*de));
+801024a1:	c1 e6 08             	shl    $0x8,%esi
+801024a4:	89 75 c8             	mov    %esi,-0x38(%ebp)
+  de = (struct dirent*)lp->data;
+801024a7:	8b 75 d0             	mov    -0x30(%ebp),%esi
+801024aa:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  dcenter(dp, name, inum, bn*BSIZE + i*sizeof(*de));
+801024ad:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  brelse(bp);
+801024b0:	83 ec 0c             	sub    $0xc,%esp
+801024b3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801024b6:	ff 75 c0             	push   -0x40(%ebp)
+801024b9:	e8 72 e2 ff ff       	call   80100730 <brelse>
+  strncpy(de[i].name, name, DIRSIZ);
+801024be:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801024c1:	8b 55 dc             	mov    -0x24(%ebp),%edx
+801024c4:	83 c4 0c             	add    $0xc,%esp
+801024c7:	6a 0e                	push   $0xe
+801024c9:	01 c2                	add    %eax,%edx
+801024cb:	ff 75 b0             	push   -0x50(%ebp)
+801024ce:	8d 42 02             	lea    0x2(%edx),%eax
+801024d1:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801024d4:	50                   	push   %eax
+801024d5:	e8 76 5a 00 00       	call   80107f50 <strncpy>
+  de[i].inum = inum;
+801024da:	0f b7 45 ac          	movzwl -0x54(%ebp),%eax
+801024de:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801024e1:	66 89 02             	mov    %ax,(%edx)
+  log_write(lp);
+801024e4:	89 34 24             	mov    %esi,(%esp)
+801024e7:	e8 14 2c 00 00       	call   80105100 <log_write>
+  brelse(lp);
+801024ec:	89 34 24             	mov    %esi,(%esp)
+801024ef:	e8 3c e2 ff ff       	call   80100730 <brelse>
+  dcenter(dp, name, inum, bn*BSIZE + i*sizeof(*de));
+801024f4:	8b 45 c8             	mov    -0x38(%ebp),%eax
+801024f7:	01 f8                	add    %edi,%eax
+801024f9:	c1 e0 04             	shl    $0x4,%eax
+801024fc:	89 04 24             	mov    %eax,(%esp)
+801024ff:	8b 4d ac             	mov    -0x54(%ebp),%ecx
+80102502:	89 d8                	mov    %ebx,%eax
+80102504:	8b 55 b0             	mov    -0x50(%ebp),%edx
+80102507:	e8 74 f8 ff ff       	call   80101d80 <dcenter>
+  return 0;
+8010250c:	83 c4 10             	add    $0x10,%esp
+8010250f:	31 c0                	xor    %eax,%eax
+}
+80102511:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102514:	5b                   	pop    %ebx
+80102515:	5e                   	pop    %esi
+80102516:	5f                   	pop    %edi
+80102517:	5d                   	pop    %ebp
+80102518:	c3                   	ret
+      hi = mid - 1;
+80102519:	8d 50 ff             	lea    -0x1(%eax),%edx
+8010251c:	e9 20 ff ff ff       	jmp    80102441 <dxlink+0x81>
+  n = dp->size/BSIZE - 1;
+80102521:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80102524:	8d 70 ff             	lea    -0x1(%eax),%esi
+80102527:	89 75 a4             	mov    %esi,-0x5c(%ebp)
+    if(n == NDXENTRY || (m = dxmedian(de, h)) == 0){
+8010252a:	3d 01 02 00 00       	cmp    $0x201,%eax
+8010252f:	0f 84 d0 02 00 00    	je     80102805 <dxlink+0x445>
+80102535:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  best = 0;
+80102538:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  for(i = 0; i <= DPB; i++){
+8010253f:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+80102546:	8d 70 02             	lea    0x2(%eax),%esi
+  bestd = DPB + 1;
+80102549:	c7 45 c8 01 01 00 00 	movl   $0x101,-0x38(%ebp)
+80102550:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+80102553:	8d 70 10             	lea    0x10(%eax),%esi
+80102556:	05 10 10 00 00       	add    $0x1010,%eax
+8010255b:	89 75 a8             	mov    %esi,-0x58(%ebp)
+8010255e:	89 7d a0             	mov    %edi,-0x60(%ebp)
+80102561:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80102564:	89 d8                	mov    %ebx,%eax
+    x = i < DPB ? dirhash(de[i].name) : h;
+80102566:	8b 75 dc             	mov    -0x24(%ebp),%esi
+80102569:	81 fe 00 01 00 00    	cmp    $0x100,%esi
+8010256f:	0f 84 4b 02 00 00    	je     801027c0 <dxlink+0x400>
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80102575:	c1 e6 04             	shl    $0x4,%esi
+    x = i < DPB ? dirhash(de[i].name) : h;
+80102578:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+  h = 2166136261U;
+8010257b:	bf c5 9d 1c 81       	mov    $0x811c9dc5,%edi
+80102580:	89 f3                	mov    %esi,%ebx
+80102582:	8b 75 a8             	mov    -0x58(%ebp),%esi
+80102585:	01 f3                	add    %esi,%ebx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80102587:	0f b6 11             	movzbl (%ecx),%edx
+8010258a:	84 d2                	test   %dl,%dl
+8010258c:	74 0f                	je     8010259d <dxlink+0x1dd>
+    h = (h ^ (uchar)name[i]) * 16777619;
+8010258e:	31 d7                	xor    %edx,%edi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80102590:	83 c1 01             	add    $0x1,%ecx
+    h = (h ^ (uchar)name[i]) * 16777619;
+80102593:	69 ff 93 01 00 01    	imul   $0x1000193,%edi,%edi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80102599:	39 d9                	cmp    %ebx,%ecx
+8010259b:	75 ea                	jne    80102587 <dxlink+0x1c7>
+    below = h < x;
+8010259d:	31 db                	xor    %ebx,%ebx
+8010259f:	39 7d e0             	cmp    %edi,-0x20(%ebp)
+801025a2:	0f 92 c3             	setb   %bl
+801025a5:	89 de                	mov    %ebx,%esi
+    for(j = 0; j < DPB; j++)
+801025a7:	8b 5d a8             	mov    -0x58(%ebp),%ebx
+801025aa:	89 45 98             	mov    %eax,-0x68(%ebp)
+801025ad:	89 5d 9c             	mov    %ebx,-0x64(%ebp)
+      if(dirhash(de[j].name) < x)
+801025b0:	8d 4b f2             	lea    -0xe(%ebx),%ecx
+  h = 2166136261U;
+801025b3:	ba c5 9d 1c 81       	mov    $0x811c9dc5,%edx
+801025b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801025bf:	90                   	nop
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+801025c0:	0f b6 01             	movzbl (%ecx),%eax
+801025c3:	84 c0                	test   %al,%al
+801025c5:	74 0f                	je     801025d6 <dxlink+0x216>
+    h = (h ^ (uchar)name[i]) * 16777619;
+801025c7:	31 d0                	xor    %edx,%eax
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+801025c9:	83 c1 01             	add    $0x1,%ecx
+    h = (h ^ (uchar)name[i]) * 16777619;
+801025cc:	69 d0 93 01 00 01    	imul   $0x1000193,%eax,%edx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+801025d2:	39 d9                	cmp    %ebx,%ecx
+801025d4:	75 ea                	jne    801025c0 <dxlink+0x200>
+        below++;
+801025d6:	39 fa                	cmp    %edi,%edx
+    for(j = 0; j < DPB; j++)
+801025d8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+        below++;
+801025db:	83 d6 00             	adc    $0x0,%esi
+    for(j = 0; j < DPB; j++)
+801025de:	83 c3 10             	add    $0x10,%ebx
+801025e1:	39 c3                	cmp    %eax,%ebx
+801025e3:	75 cb                	jne    801025b0 <dxlink+0x1f0>
+    if(below == 0)
+801025e5:	8b 4d 9c             	mov    -0x64(%ebp),%ecx
+801025e8:	8b 45 98             	mov    -0x68(%ebp),%eax
+801025eb:	85 f6                	test   %esi,%esi
+801025ed:	74 17                	je     80102606 <dxlink+0x246>
+    d = below - (DPB+1)/2;
+801025ef:	83 c6 80             	add    $0xffffff80,%esi
+    if(d < 0)
+801025f2:	89 f2                	mov    %esi,%edx
+801025f4:	f7 da                	neg    %edx
+801025f6:	0f 48 d6             	cmovs  %esi,%edx
+    if(d < bestd){
+801025f9:	8b 75 c8             	mov    -0x38(%ebp),%esi
+801025fc:	39 f2                	cmp    %esi,%edx
+801025fe:	7d 06                	jge    80102606 <dxlink+0x246>
+80102600:	89 55 c8             	mov    %edx,-0x38(%ebp)
+      best = x;
+80102603:	89 7d cc             	mov    %edi,-0x34(%ebp)
+  for(i = 0; i <= DPB; i++){
+80102606:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+8010260a:	8b 75 dc             	mov    -0x24(%ebp),%esi
+8010260d:	83 45 c4 10          	addl   $0x10,-0x3c(%ebp)
+80102611:	81 fe 01 01 00 00    	cmp    $0x101,%esi
+80102617:	0f 85 49 ff ff ff    	jne    80102566 <dxlink+0x1a6>
+    if(n == NDXENTRY || (m = dxmedian(de, h)) == 0){
+8010261d:	8b 75 cc             	mov    -0x34(%ebp),%esi
+80102620:	8b 7d a0             	mov    -0x60(%ebp),%edi
+80102623:	89 c3                	mov    %eax,%ebx
+80102625:	85 f6                	test   %esi,%esi
+80102627:	0f 84 d8 01 00 00    	je     80102805 <dxlink+0x445>
+    np = bread(dp->dev, bmap(dp, nb));
+8010262d:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+80102630:	89 4d a0             	mov    %ecx,-0x60(%ebp)
+80102633:	e8 e8 f8 ff ff       	call   80101f20 <bmap>
+80102638:	83 ec 08             	sub    $0x8,%esp
+8010263b:	50                   	push   %eax
+8010263c:	ff 33                	push   (%ebx)
+8010263e:	e8 ad de ff ff       	call   801004f0 <bread>
+    for(i = j = 0; i < DPB; i++){
+80102643:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+      dcmove(dp, nde[j].name, nb*BSIZE + j*sizeof(*de));
+8010264a:	83 c4 10             	add    $0x10,%esp
+    np = bread(dp->dev, bmap(dp, nb));
+8010264d:	89 c6                	mov    %eax,%esi
+    nde = (struct dirent*)np->data;
+8010264f:	8b 48 60             	mov    0x60(%eax),%ecx
+      dcmove(dp, nde[j].name, nb*BSIZE + j*sizeof(*de));
+80102652:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    for(i = j = 0; i < DPB; i++){
+80102655:	89 75 a8             	mov    %esi,-0x58(%ebp)
+80102658:	8b 75 a0             	mov    -0x60(%ebp),%esi
+      dcmove(dp, nde[j].name, nb*BSIZE + j*sizeof(*de));
+8010265b:	c1 e0 08             	shl    $0x8,%eax
+    nde = (struct dirent*)np->data;
+8010265e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+      dcmove(dp, nde[j].name, nb*BSIZE + j*sizeof(*de));
+80102661:	89 45 c8             	mov    %eax,-0x38(%ebp)
+      if(dirhash(de[i].name) < m)
+80102664:	8d 4e f2             	lea    -0xe(%esi),%ecx
+  h = 2166136261U;
+80102667:	ba c5 9d 1c 81       	mov    $0x811c9dc5,%edx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+8010266c:	0f b6 01             	movzbl (%ecx),%eax
+8010266f:	84 c0                	test   %al,%al
+80102671:	74 0f                	je     80102682 <dxlink+0x2c2>
+    h = (h ^ (uchar)name[i]) * 16777619;
+80102673:	31 d0                	xor    %edx,%eax
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80102675:	83 c1 01             	add    $0x1,%ecx
+    h = (h ^ (uchar)name[i]) * 16777619;
+80102678:	69 d0 93 01 00 01    	imul   $0x1000193,%eax,%edx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+8010267e:	39 ce                	cmp    %ecx,%esi
+80102680:	75 ea                	jne    8010266c <dxlink+0x2ac>
+      if(dirhash(de[i].name) < m)
+80102682:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80102685:	39 c2                	cmp    %eax,%edx
+80102687:	72 77                	jb     80102700 <dxlink+0x340>
+      nde[j] = de[i];
+80102689:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+8010268c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+      memset(&de[i], 0, sizeof(de[i]));
+8010268f:	83 ec 04             	sub    $0x4,%esp
+      nde[j] = de[i];
+80102692:	c1 e2 04             	shl    $0x4,%edx
+80102695:	01 c2                	add    %eax,%edx
+80102697:	8b 46 f0             	mov    -0x10(%esi),%eax
+8010269a:	89 55 a0             	mov    %edx,-0x60(%ebp)
+8010269d:	89 02                	mov    %eax,(%edx)
+8010269f:	8b 46 f4             	mov    -0xc(%esi),%eax
+801026a2:	89 42 04             	mov    %eax,0x4(%edx)
+801026a5:	8b 46 f8             	mov    -0x8(%esi),%eax
+801026a8:	89 42 08             	mov    %eax,0x8(%edx)
+801026ab:	8b 46 fc             	mov    -0x4(%esi),%eax
+801026ae:	89 42 0c             	mov    %eax,0xc(%edx)
+      if(dirhash(de[i].name) < m)
+801026b1:	8d 46 f0             	lea    -0x10(%esi),%eax
+      memset(&de[i], 0, sizeof(de[i]));
+801026b4:	6a 10                	push   $0x10
+801026b6:	6a 00                	push   $0x0
+801026b8:	50                   	push   %eax
+801026b9:	e8 42 57 00 00       	call   80107e00 <memset>
+  acquire(&dcache.lock);
+801026be:	c7 04 24 40 71 11 80 	movl   $0x80117140,(%esp)
+801026c5:	e8 56 56 00 00       	call   80107d20 <acquire>
+      dcmove(dp, nde[j].name, nb*BSIZE + j*sizeof(*de));
+801026ca:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  if((d = dcfind(dp, name)) != 0)
+801026cd:	89 d8                	mov    %ebx,%eax
+      dcmove(dp, nde[j].name, nb*BSIZE + j*sizeof(*de));
+801026cf:	83 c2 02             	add    $0x2,%edx
+  if((d = dcfind(dp, name)) != 0)
+801026d2:	e8 f9 f5 ff ff       	call   80101cd0 <dcfind>
+801026d7:	83 c4 10             	add    $0x10,%esp
+801026da:	85 c0                	test   %eax,%eax
+801026dc:	74 0e                	je     801026ec <dxlink+0x32c>
+      dcmove(dp, nde[j].name, nb*BSIZE + j*sizeof(*de));
+801026de:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+801026e1:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+801026e4:	01 ca                	add    %ecx,%edx
+801026e6:	c1 e2 04             	shl    $0x4,%edx
+801026e9:	89 50 1c             	mov    %edx,0x1c(%eax)
+  release(&dcache.lock);
+801026ec:	83 ec 0c             	sub    $0xc,%esp
+801026ef:	68 40 71 11 80       	push   $0x80117140
+801026f4:	e8 c7 55 00 00       	call   80107cc0 <release>
+      j++;
+801026f9:	83 45 c4 01          	addl   $0x1,-0x3c(%ebp)
+801026fd:	83 c4 10             	add    $0x10,%esp
+    for(i = j = 0; i < DPB; i++){
+80102700:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80102703:	83 c6 10             	add    $0x10,%esi
+80102706:	39 c6                	cmp    %eax,%esi
+80102708:	0f 85 56 ff ff ff    	jne    80102664 <dxlink+0x2a4>
+    memmove(&dx[k+2], &dx[k+1], (n-k-1)*sizeof(*dx));
+8010270e:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+80102711:	8b 45 b8             	mov    -0x48(%ebp),%eax
+80102714:	83 ec 04             	sub    $0x4,%esp
+80102717:	8b 75 a8             	mov    -0x58(%ebp),%esi
+8010271a:	8d 54 01 08          	lea    0x8(%ecx,%eax,1),%edx
+8010271e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+80102721:	29 f8                	sub    %edi,%eax
+80102723:	8d 04 c5 f8 ff ff ff 	lea    -0x8(,%eax,8),%eax
+8010272a:	50                   	push   %eax
+8010272b:	52                   	push   %edx
+8010272c:	8b 45 b8             	mov    -0x48(%ebp),%eax
+8010272f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80102732:	8d 44 01 10          	lea    0x10(%ecx,%eax,1),%eax
+80102736:	50                   	push   %eax
+80102737:	e8 54 57 00 00       	call   80107e90 <memmove>
+    dx[k+1].blk = nb;
+8010273c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010273f:	0f b7 45 d4          	movzwl -0x2c(%ebp),%eax
+    dx[k+1].hash = m;
+80102743:	8b 7d cc             	mov    -0x34(%ebp),%edi
+    dx[k+1].blk = nb;
+80102746:	66 89 42 02          	mov    %ax,0x2(%edx)
+    dx[k+1].hash = m;
+8010274a:	89 7a 04             	mov    %edi,0x4(%edx)
+    log_write(bp);
+8010274d:	58                   	pop    %eax
+8010274e:	ff 75 c0             	push   -0x40(%ebp)
+80102751:	e8 aa 29 00 00       	call   80105100 <log_write>
+    log_write(lp);
+80102756:	5a                   	pop    %edx
+80102757:	ff 75 d8             	push   -0x28(%ebp)
+8010275a:	e8 a1 29 00 00       	call   80105100 <log_write>
+    log_write(np);
+8010275f:	89 34 24             	mov    %esi,(%esp)
+80102762:	e8 99 29 00 00       	call   80105100 <log_write>
+    dp->size += BSIZE;
+80102767:	81 43 68 00 10 00 00 	addl   $0x1000,0x68(%ebx)
+    iupdate(dp);
+8010276e:	89 1c 24             	mov    %ebx,(%esp)
+80102771:	e8 ca fb ff ff       	call   80102340 <iupdate>
+    if(h >= m){
+80102776:	83 c4 10             	add    $0x10,%esp
+80102779:	39 7d e0             	cmp    %edi,-0x20(%ebp)
+8010277c:	72 67                	jb     801027e5 <dxlink+0x425>
+      brelse(lp);
+8010277e:	83 ec 0c             	sub    $0xc,%esp
+80102781:	ff 75 d8             	push   -0x28(%ebp)
+80102784:	e8 a7 df ff ff       	call   80100730 <brelse>
+      de = nde;
+80102789:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < DPB; i++)
+8010278c:	31 c0                	xor    %eax,%eax
+    if(de[i].inum == 0)
+8010278e:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80102791:	89 c7                	mov    %eax,%edi
+80102793:	c1 e0 04             	shl    $0x4,%eax
+80102796:	66 83 3c 02 00       	cmpw   $0x0,(%edx,%eax,1)
+8010279b:	0f 84 0f fd ff ff    	je     801024b0 <dxlink+0xf0>
+  for(i = 0; i < DPB; i++)
+801027a1:	8d 47 01             	lea    0x1(%edi),%eax
+801027a4:	81 ff ff 00 00 00    	cmp    $0xff,%edi
+801027aa:	75 e2                	jne    8010278e <dxlink+0x3ce>
+801027ac:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+801027b1:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+801027b6:	e9 f5 fc ff ff       	jmp    801024b0 <dxlink+0xf0>
+801027bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801027bf:	90                   	nop
+801027c0:	8b 7d e0             	mov    -0x20(%ebp),%edi
+801027c3:	31 f6                	xor    %esi,%esi
+801027c5:	e9 dd fd ff ff       	jmp    801025a7 <dxlink+0x1e7>
+  ip->lastblk = balloc(ip->dev, ip->lastblk ? ip->lastblk + 1 : 0);
+801027ca:	8b 53 5c             	mov    0x5c(%ebx),%edx
+801027cd:	8b 03                	mov    (%ebx),%eax
+801027cf:	83 fa 01             	cmp    $0x1,%edx
+801027d2:	83 da ff             	sbb    $0xffffffff,%edx
+801027d5:	e8 66 f2 ff ff       	call   80101a40 <balloc>
+801027da:	89 43 5c             	mov    %eax,0x5c(%ebx)
+      ip->addrs[bn] = addr = iballoc(ip);
+801027dd:	89 43 6c             	mov    %eax,0x6c(%ebx)
+801027e0:	e9 1d fc ff ff       	jmp    80102402 <dxlink+0x42>
+      brelse(np);
+801027e5:	83 ec 0c             	sub    $0xc,%esp
+801027e8:	56                   	push   %esi
+801027e9:	e8 42 df ff ff       	call   80100730 <brelse>
+  dcenter(dp, name, inum, bn*BSIZE + i*sizeof(*de));
+801027ee:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+801027f1:	8b 75 d8             	mov    -0x28(%ebp),%esi
+801027f4:	83 c4 10             	add    $0x10,%esp
+801027f7:	c1 e0 08             	shl    $0x8,%eax
+801027fa:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  de = (struct dirent*)lp->data;
+801027fd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80102800:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80102803:	eb 87                	jmp    8010278c <dxlink+0x3cc>
+      brelse(lp);
+80102805:	83 ec 0c             	sub    $0xc,%esp
+80102808:	ff 75 d8             	push   -0x28(%ebp)
+8010280b:	e8 20 df ff ff       	call   80100730 <brelse>
+      brelse(bp);
+80102810:	59                   	pop    %ecx
+80102811:	ff 75 c0             	push   -0x40(%ebp)
+80102814:	e8 17 df ff ff       	call   80100730 <brelse>
+      return -1;
+80102819:	83 c4 10             	add    $0x10,%esp
+8010281c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102821:	e9 eb fc ff ff       	jmp    80102511 <dxlink+0x151>
+80102826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010282d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80102830 <idup>:
+{
+80102830:	55                   	push   %ebp
+80102831:	89 e5                	mov    %esp,%ebp
+80102833:	53                   	push   %ebx
+80102834:	83 ec 10             	sub    $0x10,%esp
+80102837:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&icache.lock);
+8010283a:	68 a0 9e 11 80       	push   $0x80119ea0
+8010283f:	e8 dc 54 00 00       	call   80107d20 <acquire>
+  ip->ref++;
+80102844:	83 43 08 01          	addl   $0x1,0x8(%ebx)
+  release(&icache.lock);
+80102848:	c7 04 24 a0 9e 11 80 	movl   $0x80119ea0,(%esp)
+8010284f:	e8 6c 54 00 00       	call   80107cc0 <release>
+}
+80102854:	89 d8                	mov    %ebx,%eax
+80102856:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102859:	c9                   	leave
+8010285a:	c3                   	ret
+8010285b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010285f:	90                   	nop
+
+80102860 <ilock>:
+{
+80102860:	55                   	push   %ebp
+80102861:	89 e5                	mov    %esp,%ebp
+80102863:	56                   	push   %esi
+80102864:	53                   	push   %ebx
+80102865:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || ip->ref < 1)
+80102868:	85 db                	test   %ebx,%ebx
+8010286a:	0f 84 bd 00 00 00    	je     8010292d <ilock+0xcd>
+80102870:	8b 53 08             	mov    0x8(%ebx),%edx
+80102873:	85 d2                	test   %edx,%edx
+80102875:	0f 8e b2 00 00 00    	jle    8010292d <ilock+0xcd>
+  acquiresleep(&ip->lock);
+8010287b:	83 ec 0c             	sub    $0xc,%esp
+8010287e:	8d 43 18             	lea    0x18(%ebx),%eax
+80102881:	50                   	push   %eax
+80102882:	e8 69 51 00 00       	call   801079f0 <acquiresleep>
+  if(ip->valid == 0){
+80102887:	8b 43 58             	mov    0x58(%ebx),%eax
+8010288a:	83 c4 10             	add    $0x10,%esp
+8010288d:	85 c0                	test   %eax,%eax
+8010288f:	74 0f                	je     801028a0 <ilock+0x40>
+}
+80102891:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102894:	5b                   	pop    %ebx
+80102895:	5e                   	pop    %esi
+80102896:	5d                   	pop    %ebp
+80102897:	c3                   	ret
+80102898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010289f:	90                   	nop
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+801028a0:	8b 43 04             	mov    0x4(%ebx),%eax
+801028a3:	83 ec 08             	sub    $0x8,%esp
+801028a6:	c1 e8 06             	shr    $0x6,%eax
+801028a9:	03 05 7c 1d 12 80    	add    0x80121d7c,%eax
+801028af:	50                   	push   %eax
+801028b0:	ff 33                	push   (%ebx)
+801028b2:	e8 39 dc ff ff       	call   801004f0 <bread>
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+801028b7:	83 c4 0c             	add    $0xc,%esp
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+801028ba:	89 c6                	mov    %eax,%esi
+    dip = (struct dinode*)bp->data + ip->inum%IPB;
+801028bc:	8b 43 04             	mov    0x4(%ebx),%eax
+801028bf:	83 e0 3f             	and    $0x3f,%eax
+801028c2:	c1 e0 06             	shl    $0x6,%eax
+801028c5:	03 46 60             	add    0x60(%esi),%eax
+    ip->type = dip->type;
+801028c8:	0f b7 10             	movzwl (%eax),%edx
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+801028cb:	83 c0 0c             	add    $0xc,%eax
+    ip->type = dip->type;
+801028ce:	66 89 53 60          	mov    %dx,0x60(%ebx)
+    ip->major = dip->major;
+801028d2:	0f b7 50 f6          	movzwl -0xa(%eax),%edx
+801028d6:	66 89 53 62          	mov    %dx,0x62(%ebx)
+    ip->minor = dip->minor;
+801028da:	0f b7 50 f8          	movzwl -0x8(%eax),%edx
+801028de:	66 89 53 64          	mov    %dx,0x64(%ebx)
+    ip->nlink = dip->nlink;
+801028e2:	0f b7 50 fa          	movzwl -0x6(%eax),%edx
+801028e6:	66 89 53 66          	mov    %dx,0x66(%ebx)
+    ip->size = dip->size;
+801028ea:	8b 50 fc             	mov    -0x4(%eax),%edx
+801028ed:	89 53 68             	mov    %edx,0x68(%ebx)
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+801028f0:	6a 34                	push   $0x34
+801028f2:	50                   	push   %eax
+801028f3:	8d 43 6c             	lea    0x6c(%ebx),%eax
+801028f6:	50                   	push   %eax
+801028f7:	e8 94 55 00 00       	call   80107e90 <memmove>
+    brelse(bp);
+801028fc:	89 34 24             	mov    %esi,(%esp)
+801028ff:	e8 2c de ff ff       	call   80100730 <brelse>
+    if(ip->type == 0)
+80102904:	83 c4 10             	add    $0x10,%esp
+80102907:	66 83 7b 60 00       	cmpw   $0x0,0x60(%ebx)
+    ip->lastblk = 0;
+8010290c:	c7 43 5c 00 00 00 00 	movl   $0x0,0x5c(%ebx)
+    ip->valid = 1;
+80102913:	c7 43 58 01 00 00 00 	movl   $0x1,0x58(%ebx)
+    if(ip->type == 0)
+8010291a:	0f 85 71 ff ff ff    	jne    80102891 <ilock+0x31>
+      panic("ilock: no type");
+80102920:	83 ec 0c             	sub    $0xc,%esp
+80102923:	68 08 b7 10 80       	push   $0x8010b708
+80102928:	e8 53 df ff ff       	call   80100880 <panic>
+    panic("ilock");
+8010292d:	83 ec 0c             	sub    $0xc,%esp
+80102930:	68 02 b7 10 80       	push   $0x8010b702
+80102935:	e8 46 df ff ff       	call   80100880 <panic>
+8010293a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80102940 <iunlock>:
+{
+80102940:	55                   	push   %ebp
+80102941:	89 e5                	mov    %esp,%ebp
+80102943:	56                   	push   %esi
+80102944:	53                   	push   %ebx
+80102945:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102948:	85 db                	test   %ebx,%ebx
+8010294a:	74 28                	je     80102974 <iunlock+0x34>
+8010294c:	83 ec 0c             	sub    $0xc,%esp
+8010294f:	8d 73 18             	lea    0x18(%ebx),%esi
+80102952:	56                   	push   %esi
+80102953:	e8 98 51 00 00       	call   80107af0 <holdingsleep>
+80102958:	83 c4 10             	add    $0x10,%esp
+8010295b:	85 c0                	test   %eax,%eax
+8010295d:	74 15                	je     80102974 <iunlock+0x34>
+8010295f:	8b 43 08             	mov    0x8(%ebx),%eax
+80102962:	85 c0                	test   %eax,%eax
+80102964:	7e 0e                	jle    80102974 <iunlock+0x34>
+  releasesleep(&ip->lock);
+80102966:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80102969:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010296c:	5b                   	pop    %ebx
+8010296d:	5e                   	pop    %esi
+8010296e:	5d                   	pop    %ebp
+  releasesleep(&ip->lock);
+8010296f:	e9 3c 51 00 00       	jmp    80107ab0 <releasesleep>
+    panic("iunlock");
+80102974:	83 ec 0c             	sub    $0xc,%esp
+80102977:	68 17 b7 10 80       	push   $0x8010b717
+8010297c:	e8 ff de ff ff       	call   80100880 <panic>
+80102981:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010298f:	90                   	nop
+
+80102990 <iput>:
+{
+80102990:	55                   	push   %ebp
+80102991:	89 e5                	mov    %esp,%ebp
+80102993:	57                   	push   %edi
+80102994:	56                   	push   %esi
+80102995:	53                   	push   %ebx
+80102996:	83 ec 28             	sub    $0x28,%esp
+80102999:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquiresleep(&ip->lock);
+8010299c:	8d 7b 18             	lea    0x18(%ebx),%edi
+8010299f:	57                   	push   %edi
+801029a0:	e8 4b 50 00 00       	call   801079f0 <acquiresleep>
+  if(ip->valid && ip->nlink == 0){
+801029a5:	8b 53 58             	mov    0x58(%ebx),%edx
+801029a8:	83 c4 10             	add    $0x10,%esp
+801029ab:	85 d2                	test   %edx,%edx
+801029ad:	74 07                	je     801029b6 <iput+0x26>
+801029af:	66 83 7b 66 00       	cmpw   $0x0,0x66(%ebx)
+801029b4:	74 5a                	je     80102a10 <iput+0x80>
+  releasesleep(&ip->lock);
+801029b6:	83 ec 0c             	sub    $0xc,%esp
+801029b9:	57                   	push   %edi
+801029ba:	e8 f1 50 00 00       	call   80107ab0 <releasesleep>
+  acquire(&icache.lock);
+801029bf:	c7 04 24 a0 9e 11 80 	movl   $0x80119ea0,(%esp)
+801029c6:	e8 55 53 00 00       	call   80107d20 <acquire>
+  if(--ip->ref == 0)
+801029cb:	8b 43 08             	mov    0x8(%ebx),%eax
+801029ce:	83 c4 10             	add    $0x10,%esp
+801029d1:	83 e8 01             	sub    $0x1,%eax
+801029d4:	89 43 08             	mov    %eax,0x8(%ebx)
+801029d7:	85 c0                	test   %eax,%eax
+801029d9:	75 18                	jne    801029f3 <iput+0x63>
+  ip->next = &icache.lru;
+801029db:	c7 43 14 c8 1c 12 80 	movl   $0x80121cc8,0x14(%ebx)
+  ip->prev = icache.lru.prev;
+801029e2:	a1 d8 1c 12 80       	mov    0x80121cd8,%eax
+801029e7:	89 43 10             	mov    %eax,0x10(%ebx)
+  icache.lru.prev->next = ip;
+801029ea:	89 58 14             	mov    %ebx,0x14(%eax)
+  icache.lru.prev = ip;
+801029ed:	89 1d d8 1c 12 80    	mov    %ebx,0x80121cd8
+  release(&icache.lock);
+801029f3:	c7 45 08 a0 9e 11 80 	movl   $0x80119ea0,0x8(%ebp)
+}
+801029fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801029fd:	5b                   	pop    %ebx
+801029fe:	5e                   	pop    %esi
+801029ff:	5f                   	pop    %edi
+80102a00:	5d                   	pop    %ebp
+  release(&icache.lock);
+80102a01:	e9 ba 52 00 00       	jmp    80107cc0 <release>
+80102a06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102a0d:	8d 76 00             	lea    0x0(%esi),%esi
+    acquire(&icache.lock);
+80102a10:	83 ec 0c             	sub    $0xc,%esp
+80102a13:	68 a0 9e 11 80       	push   $0x80119ea0
+80102a18:	e8 03 53 00 00       	call   80107d20 <acquire>
+    int r = ip->ref;
+80102a1d:	8b 73 08             	mov    0x8(%ebx),%esi
+    release(&icache.lock);
+80102a20:	c7 04 24 a0 9e 11 80 	movl   $0x80119ea0,(%esp)
+80102a27:	e8 94 52 00 00       	call   80107cc0 <release>
+    if(r == 1){
+80102a2c:	83 c4 10             	add    $0x10,%esp
+80102a2f:	83 fe 01             	cmp    $0x1,%esi
+80102a32:	75 82                	jne    801029b6 <iput+0x26>
+      if(ip->type == T_DIR)
+80102a34:	66 83 7b 60 01       	cmpw   $0x1,0x60(%ebx)
+80102a39:	0f 84 b9 00 00 00    	je     80102af8 <iput+0x168>
+80102a3f:	8d 73 6c             	lea    0x6c(%ebx),%esi
+80102a42:	8d 8b 98 00 00 00    	lea    0x98(%ebx),%ecx
+80102a48:	eb 0d                	jmp    80102a57 <iput+0xc7>
+80102a4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < NDIRECT; i++){
+80102a50:	83 c6 04             	add    $0x4,%esi
+80102a53:	39 f1                	cmp    %esi,%ecx
+80102a55:	74 21                	je     80102a78 <iput+0xe8>
+    if(ip->addrs[i]){
+80102a57:	8b 16                	mov    (%esi),%edx
+80102a59:	85 d2                	test   %edx,%edx
+80102a5b:	74 f3                	je     80102a50 <iput+0xc0>
+      bfree(ip->dev, ip->addrs[i]);
+80102a5d:	8b 03                	mov    (%ebx),%eax
+80102a5f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80102a62:	e8 79 ed ff ff       	call   801017e0 <bfree>
+      ip->addrs[i] = 0;
+80102a67:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+80102a6d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80102a70:	eb de                	jmp    80102a50 <iput+0xc0>
+80102a72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(ip->addrs[NDIRECT]){
+80102a78:	8b 93 98 00 00 00    	mov    0x98(%ebx),%edx
+80102a7e:	85 d2                	test   %edx,%edx
+80102a80:	75 5e                	jne    80102ae0 <iput+0x150>
+  if(ip->addrs[NDIRECT+1]){
+80102a82:	8b 93 9c 00 00 00    	mov    0x9c(%ebx),%edx
+80102a88:	85 d2                	test   %edx,%edx
+80102a8a:	75 34                	jne    80102ac0 <iput+0x130>
+  iupdate(ip);
+80102a8c:	83 ec 0c             	sub    $0xc,%esp
+  ip->size = 0;
+80102a8f:	c7 43 68 00 00 00 00 	movl   $0x0,0x68(%ebx)
+  iupdate(ip);
+80102a96:	53                   	push   %ebx
+80102a97:	e8 a4 f8 ff ff       	call   80102340 <iupdate>
+      ip->type = 0;
+80102a9c:	31 c0                	xor    %eax,%eax
+80102a9e:	66 89 43 60          	mov    %ax,0x60(%ebx)
+      iupdate(ip);
+80102aa2:	89 1c 24             	mov    %ebx,(%esp)
+80102aa5:	e8 96 f8 ff ff       	call   80102340 <iupdate>
+      ip->valid = 0;
+80102aaa:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+80102ab1:	83 c4 10             	add    $0x10,%esp
+80102ab4:	e9 fd fe ff ff       	jmp    801029b6 <iput+0x26>
+80102ab9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    bfreeind(ip, ip->addrs[NDIRECT+1], 2);
+80102ac0:	b9 02 00 00 00       	mov    $0x2,%ecx
+80102ac5:	89 d8                	mov    %ebx,%eax
+80102ac7:	e8 94 ed ff ff       	call   80101860 <bfreeind>
+    ip->addrs[NDIRECT+1] = 0;
+80102acc:	c7 83 9c 00 00 00 00 	movl   $0x0,0x9c(%ebx)
+80102ad3:	00 00 00 
+80102ad6:	eb b4                	jmp    80102a8c <iput+0xfc>
+80102ad8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102adf:	90                   	nop
+    bfreeind(ip, ip->addrs[NDIRECT], 1);
+80102ae0:	b9 01 00 00 00       	mov    $0x1,%ecx
+80102ae5:	89 d8                	mov    %ebx,%eax
+80102ae7:	e8 74 ed ff ff       	call   80101860 <bfreeind>
+    ip->addrs[NDIRECT] = 0;
+80102aec:	c7 83 98 00 00 00 00 	movl   $0x0,0x98(%ebx)
+80102af3:	00 00 00 
+80102af6:	eb 8a                	jmp    80102a82 <iput+0xf2>
+  acquire(&dcache.lock);
+80102af8:	83 ec 0c             	sub    $0xc,%esp
+  for(d = dcache.dentry; d < &dcache.dentry[NDENTRY]; d++)
+80102afb:	be 74 71 11 80       	mov    $0x80117174,%esi
+  acquire(&dcache.lock);
+80102b00:	68 40 71 11 80       	push   $0x80117140
+80102b05:	e8 16 52 00 00       	call   80107d20 <acquire>
+80102b0a:	83 c4 10             	add    $0x10,%esp
+80102b0d:	eb 0c                	jmp    80102b1b <iput+0x18b>
+80102b0f:	90                   	nop
+  for(d = dcache.dentry; d < &dcache.dentry[NDENTRY]; d++)
+80102b10:	83 c6 2c             	add    $0x2c,%esi
+80102b13:	81 fe 74 9d 11 80    	cmp    $0x80119d74,%esi
+80102b19:	74 17                	je     80102b32 <iput+0x1a2>
+    if(d->dir == dp->inum && d->dev == dp->dev)
+80102b1b:	8b 43 04             	mov    0x4(%ebx),%eax
+80102b1e:	39 46 04             	cmp    %eax,0x4(%esi)
+80102b21:	75 ed                	jne    80102b10 <iput+0x180>
+80102b23:	8b 03                	mov    (%ebx),%eax
+80102b25:	39 06                	cmp    %eax,(%esi)
+80102b27:	75 e7                	jne    80102b10 <iput+0x180>
+      dcdrop(d);
+80102b29:	89 f0                	mov    %esi,%eax
+80102b2b:	e8 f0 f0 ff ff       	call   80101c20 <dcdrop>
+80102b30:	eb de                	jmp    80102b10 <iput+0x180>
+  release(&dcache.lock);
+80102b32:	83 ec 0c             	sub    $0xc,%esp
+80102b35:	68 40 71 11 80       	push   $0x80117140
+80102b3a:	e8 81 51 00 00       	call   80107cc0 <release>
+80102b3f:	83 c4 10             	add    $0x10,%esp
+80102b42:	e9 f8 fe ff ff       	jmp    80102a3f <iput+0xaf>
+80102b47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102b4e:	66 90                	xchg   %ax,%ax
+
+80102b50 <iunlockput>:
+{
+80102b50:	55                   	push   %ebp
+80102b51:	89 e5                	mov    %esp,%ebp
+80102b53:	56                   	push   %esi
+80102b54:	53                   	push   %ebx
+80102b55:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102b58:	85 db                	test   %ebx,%ebx
+80102b5a:	74 34                	je     80102b90 <iunlockput+0x40>
+80102b5c:	83 ec 0c             	sub    $0xc,%esp
+80102b5f:	8d 73 18             	lea    0x18(%ebx),%esi
+80102b62:	56                   	push   %esi
+80102b63:	e8 88 4f 00 00       	call   80107af0 <holdingsleep>
+80102b68:	83 c4 10             	add    $0x10,%esp
+80102b6b:	85 c0                	test   %eax,%eax
+80102b6d:	74 21                	je     80102b90 <iunlockput+0x40>
+80102b6f:	8b 43 08             	mov    0x8(%ebx),%eax
+80102b72:	85 c0                	test   %eax,%eax
+80102b74:	7e 1a                	jle    80102b90 <iunlockput+0x40>
+  releasesleep(&ip->lock);
+80102b76:	83 ec 0c             	sub    $0xc,%esp
+80102b79:	56                   	push   %esi
+80102b7a:	e8 31 4f 00 00       	call   80107ab0 <releasesleep>
+  iput(ip);
+80102b7f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80102b82:	83 c4 10             	add    $0x10,%esp
+}
+80102b85:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102b88:	5b                   	pop    %ebx
+80102b89:	5e                   	pop    %esi
+80102b8a:	5d                   	pop    %ebp
+  iput(ip);
+80102b8b:	e9 00 fe ff ff       	jmp    80102990 <iput>
+    panic("iunlock");
+80102b90:	83 ec 0c             	sub    $0xc,%esp
+80102b93:	68 17 b7 10 80       	push   $0x8010b717
+80102b98:	e8 e3 dc ff ff       	call   80100880 <panic>
+80102b9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80102ba0 <stati>:
+{
+80102ba0:	55                   	push   %ebp
+80102ba1:	89 e5                	mov    %esp,%ebp
+80102ba3:	8b 55 08             	mov    0x8(%ebp),%edx
+80102ba6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  st->dev = ip->dev;
+80102ba9:	8b 0a                	mov    (%edx),%ecx
+80102bab:	89 48 04             	mov    %ecx,0x4(%eax)
+  st->ino = ip->inum;
+80102bae:	8b 4a 04             	mov    0x4(%edx),%ecx
+80102bb1:	89 48 08             	mov    %ecx,0x8(%eax)
+  st->type = ip->type;
+80102bb4:	0f b7 4a 60          	movzwl 0x60(%edx),%ecx
+80102bb8:	66 89 08             	mov    %cx,(%eax)
+  st->nlink = ip->nlink;
+80102bbb:	0f b7 4a 66          	movzwl 0x66(%edx),%ecx
+80102bbf:	66 89 48 0c          	mov    %cx,0xc(%eax)
+  st->size = ip->size;
+80102bc3:	8b 52 68             	mov    0x68(%edx),%edx
+80102bc6:	89 50 10             	mov    %edx,0x10(%eax)
+}
+80102bc9:	5d                   	pop    %ebp
+80102bca:	c3                   	ret
+80102bcb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102bcf:	90                   	nop
+
+80102bd0 <readi>:
+{
+80102bd0:	55                   	push   %ebp
+80102bd1:	89 e5                	mov    %esp,%ebp
+80102bd3:	57                   	push   %edi
+80102bd4:	56                   	push   %esi
+80102bd5:	53                   	push   %ebx
+80102bd6:	83 ec 1c             	sub    $0x1c,%esp
+80102bd9:	8b 75 08             	mov    0x8(%ebp),%esi
+80102bdc:	8b 45 0c             	mov    0xc(%ebp),%eax
+80102bdf:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(ip->type == T_DEV){
+80102be2:	66 83 7e 60 03       	cmpw   $0x3,0x60(%esi)
+{
+80102be7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80102bea:	89 75 d8             	mov    %esi,-0x28(%ebp)
+80102bed:	8b 45 14             	mov    0x14(%ebp),%eax
+  if(ip->type == T_DEV){
+80102bf0:	0f 84 aa 00 00 00    	je     80102ca0 <readi+0xd0>
+  if(off > ip->size || off + n < off)
+80102bf6:	8b 75 d8             	mov    -0x28(%ebp),%esi
+80102bf9:	8b 56 68             	mov    0x68(%esi),%edx
+80102bfc:	39 fa                	cmp    %edi,%edx
+80102bfe:	0f 82 bd 00 00 00    	jb     80102cc1 <readi+0xf1>
+80102c04:	89 f9                	mov    %edi,%ecx
+80102c06:	31 db                	xor    %ebx,%ebx
+80102c08:	01 c1                	add    %eax,%ecx
+80102c0a:	0f 92 c3             	setb   %bl
+80102c0d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+80102c10:	0f 82 ab 00 00 00    	jb     80102cc1 <readi+0xf1>
+    n = ip->size - off;
+80102c16:	89 d3                	mov    %edx,%ebx
+80102c18:	29 fb                	sub    %edi,%ebx
+80102c1a:	39 ca                	cmp    %ecx,%edx
+80102c1c:	0f 42 c3             	cmovb  %ebx,%eax
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80102c1f:	85 c0                	test   %eax,%eax
+80102c21:	74 72                	je     80102c95 <readi+0xc5>
+    m = min(n - tot, BSIZE - off%BSIZE);
+80102c23:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80102c26:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80102c29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80102c30:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+80102c33:	89 fa                	mov    %edi,%edx
+80102c35:	c1 ea 0c             	shr    $0xc,%edx
+80102c38:	89 d8                	mov    %ebx,%eax
+80102c3a:	e8 e1 f2 ff ff       	call   80101f20 <bmap>
+80102c3f:	83 ec 08             	sub    $0x8,%esp
+80102c42:	50                   	push   %eax
+80102c43:	ff 33                	push   (%ebx)
+80102c45:	e8 a6 d8 ff ff       	call   801004f0 <bread>
+    m = min(n - tot, BSIZE - off%BSIZE);
+80102c4a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80102c4d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80102c52:	89 c2                	mov    %eax,%edx
+    m = min(n - tot, BSIZE - off%BSIZE);
+80102c54:	89 f8                	mov    %edi,%eax
+80102c56:	25 ff 0f 00 00       	and    $0xfff,%eax
+80102c5b:	29 f3                	sub    %esi,%ebx
+80102c5d:	29 c1                	sub    %eax,%ecx
+80102c5f:	39 d9                	cmp    %ebx,%ecx
+80102c61:	0f 46 d9             	cmovbe %ecx,%ebx
+    memmove(dst, bp->data + off%BSIZE, m);
+80102c64:	83 c4 0c             	add    $0xc,%esp
+80102c67:	53                   	push   %ebx
+80102c68:	03 42 60             	add    0x60(%edx),%eax
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80102c6b:	01 de                	add    %ebx,%esi
+80102c6d:	01 df                	add    %ebx,%edi
+    memmove(dst, bp->data + off%BSIZE, m);
+80102c6f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80102c72:	50                   	push   %eax
+80102c73:	ff 75 e0             	push   -0x20(%ebp)
+80102c76:	e8 15 52 00 00       	call   80107e90 <memmove>
+    brelse(bp);
+80102c7b:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80102c7e:	89 14 24             	mov    %edx,(%esp)
+80102c81:	e8 aa da ff ff       	call   80100730 <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80102c86:	01 5d e0             	add    %ebx,-0x20(%ebp)
+80102c89:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80102c8c:	83 c4 10             	add    $0x10,%esp
+80102c8f:	39 de                	cmp    %ebx,%esi
+80102c91:	72 9d                	jb     80102c30 <readi+0x60>
+80102c93:	89 d8                	mov    %ebx,%eax
+}
+80102c95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102c98:	5b                   	pop    %ebx
+80102c99:	5e                   	pop    %esi
+80102c9a:	5f                   	pop    %edi
+80102c9b:	5d                   	pop    %ebp
+80102c9c:	c3                   	ret
+80102c9d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+80102ca0:	0f bf 56 62          	movswl 0x62(%esi),%edx
+80102ca4:	66 83 fa 09          	cmp    $0x9,%dx
+80102ca8:	77 17                	ja     80102cc1 <readi+0xf1>
+80102caa:	8b 14 d5 e0 70 11 80 	mov    -0x7fee8f20(,%edx,8),%edx
+80102cb1:	85 d2                	test   %edx,%edx
+80102cb3:	74 0c                	je     80102cc1 <readi+0xf1>
+    return devsw[ip->major].read(ip, dst, n);
+80102cb5:	89 45 10             	mov    %eax,0x10(%ebp)
+}
+80102cb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102cbb:	5b                   	pop    %ebx
+80102cbc:	5e                   	pop    %esi
+80102cbd:	5f                   	pop    %edi
+80102cbe:	5d                   	pop    %ebp
+    return devsw[ip->major].read(ip, dst, n);
+80102cbf:	ff e2                	jmp    *%edx
+      return -1;
+80102cc1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102cc6:	eb cd                	jmp    80102c95 <readi+0xc5>
+80102cc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102ccf:	90                   	nop
+
+80102cd0 <ireadahead>:
+{
+80102cd0:	55                   	push   %ebp
+80102cd1:	89 e5                	mov    %esp,%ebp
+80102cd3:	57                   	push   %edi
+80102cd4:	56                   	push   %esi
+80102cd5:	53                   	push   %ebx
+80102cd6:	83 ec 0c             	sub    $0xc,%esp
+80102cd9:	8b 75 08             	mov    0x8(%ebp),%esi
+80102cdc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(ip->type == T_DEV || off >= ip->size)
+80102cdf:	66 83 7e 60 03       	cmpw   $0x3,0x60(%esi)
+80102ce4:	74 4d                	je     80102d33 <ireadahead+0x63>
+80102ce6:	8b 7e 68             	mov    0x68(%esi),%edi
+80102ce9:	39 f8                	cmp    %edi,%eax
+80102ceb:	73 46                	jae    80102d33 <ireadahead+0x63>
+  end = off + n;
+80102ced:	31 c9                	xor    %ecx,%ecx
+80102cef:	89 c2                	mov    %eax,%edx
+80102cf1:	03 55 10             	add    0x10(%ebp),%edx
+80102cf4:	0f 92 c1             	setb   %cl
+  if(end > ip->size || end < off)
+80102cf7:	39 d7                	cmp    %edx,%edi
+80102cf9:	72 05                	jb     80102d00 <ireadahead+0x30>
+80102cfb:	85 c9                	test   %ecx,%ecx
+80102cfd:	0f 44 fa             	cmove  %edx,%edi
+  for(bn = off/BSIZE; bn*BSIZE < end; bn++)
+80102d00:	89 c3                	mov    %eax,%ebx
+80102d02:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+80102d07:	c1 eb 0c             	shr    $0xc,%ebx
+80102d0a:	39 f8                	cmp    %edi,%eax
+80102d0c:	73 25                	jae    80102d33 <ireadahead+0x63>
+80102d0e:	66 90                	xchg   %ax,%ax
+    breadahead(ip->dev, bmap(ip, bn));
+80102d10:	89 da                	mov    %ebx,%edx
+80102d12:	89 f0                	mov    %esi,%eax
+  for(bn = off/BSIZE; bn*BSIZE < end; bn++)
+80102d14:	83 c3 01             	add    $0x1,%ebx
+    breadahead(ip->dev, bmap(ip, bn));
+80102d17:	e8 04 f2 ff ff       	call   80101f20 <bmap>
+80102d1c:	83 ec 08             	sub    $0x8,%esp
+80102d1f:	50                   	push   %eax
+80102d20:	ff 36                	push   (%esi)
+80102d22:	e8 b9 d8 ff ff       	call   801005e0 <breadahead>
+  for(bn = off/BSIZE; bn*BSIZE < end; bn++)
+80102d27:	89 d8                	mov    %ebx,%eax
+80102d29:	83 c4 10             	add    $0x10,%esp
+80102d2c:	c1 e0 0c             	shl    $0xc,%eax
+80102d2f:	39 f8                	cmp    %edi,%eax
+80102d31:	72 dd                	jb     80102d10 <ireadahead+0x40>
+}
+80102d33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102d36:	5b                   	pop    %ebx
+80102d37:	5e                   	pop    %esi
+80102d38:	5f                   	pop    %edi
+80102d39:	5d                   	pop    %ebp
+80102d3a:	c3                   	ret
+80102d3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102d3f:	90                   	nop
+
+80102d40 <writei>:
+{
+80102d40:	55                   	push   %ebp
+80102d41:	89 e5                	mov    %esp,%ebp
+80102d43:	57                   	push   %edi
+80102d44:	56                   	push   %esi
+80102d45:	53                   	push   %ebx
+80102d46:	83 ec 1c             	sub    $0x1c,%esp
+80102d49:	8b 45 0c             	mov    0xc(%ebp),%eax
+80102d4c:	8b 55 08             	mov    0x8(%ebp),%edx
+80102d4f:	8b 7d 10             	mov    0x10(%ebp),%edi
+80102d52:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80102d55:	8b 45 14             	mov    0x14(%ebp),%eax
+  if(ip->type == T_DEV){
+80102d58:	66 83 7a 60 03       	cmpw   $0x3,0x60(%edx)
+{
+80102d5d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(ip->type == T_DEV){
+80102d60:	0f 84 aa 00 00 00    	je     80102e10 <writei+0xd0>
+  if(off > ip->size || off + n < off)
+80102d66:	39 7a 68             	cmp    %edi,0x68(%edx)
+80102d69:	0f 82 da 00 00 00    	jb     80102e49 <writei+0x109>
+80102d6f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80102d72:	89 c6                	mov    %eax,%esi
+80102d74:	01 fe                	add    %edi,%esi
+80102d76:	0f 82 cd 00 00 00    	jb     80102e49 <writei+0x109>
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+80102d7c:	85 c0                	test   %eax,%eax
+80102d7e:	0f 84 80 00 00 00    	je     80102e04 <writei+0xc4>
+80102d84:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    m = min(n - tot, BSIZE - off%BSIZE);
+80102d8b:	89 55 d8             	mov    %edx,-0x28(%ebp)
+80102d8e:	66 90                	xchg   %ax,%ax
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80102d90:	8b 75 d8             	mov    -0x28(%ebp),%esi
+80102d93:	89 fa                	mov    %edi,%edx
+80102d95:	c1 ea 0c             	shr    $0xc,%edx
+80102d98:	89 f0                	mov    %esi,%eax
+80102d9a:	e8 81 f1 ff ff       	call   80101f20 <bmap>
+80102d9f:	83 ec 08             	sub    $0x8,%esp
+80102da2:	50                   	push   %eax
+80102da3:	ff 36                	push   (%esi)
+80102da5:	e8 46 d7 ff ff       	call   801004f0 <bread>
+    m = min(n - tot, BSIZE - off%BSIZE);
+80102daa:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102dad:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80102db0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80102db5:	89 c6                	mov    %eax,%esi
+    m = min(n - tot, BSIZE - off%BSIZE);
+80102db7:	89 f8                	mov    %edi,%eax
+80102db9:	25 ff 0f 00 00       	and    $0xfff,%eax
+80102dbe:	29 d3                	sub    %edx,%ebx
+80102dc0:	29 c1                	sub    %eax,%ecx
+80102dc2:	39 d9                	cmp    %ebx,%ecx
+80102dc4:	0f 46 d9             	cmovbe %ecx,%ebx
+    memmove(bp->data + off%BSIZE, src, m);
+80102dc7:	83 c4 0c             	add    $0xc,%esp
+80102dca:	53                   	push   %ebx
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+80102dcb:	01 df                	add    %ebx,%edi
+    memmove(bp->data + off%BSIZE, src, m);
+80102dcd:	ff 75 dc             	push   -0x24(%ebp)
+80102dd0:	03 46 60             	add    0x60(%esi),%eax
+80102dd3:	50                   	push   %eax
+80102dd4:	e8 b7 50 00 00       	call   80107e90 <memmove>
+    log_write(bp);
+80102dd9:	89 34 24             	mov    %esi,(%esp)
+80102ddc:	e8 1f 23 00 00       	call   80105100 <log_write>
+    brelse(bp);
+80102de1:	89 34 24             	mov    %esi,(%esp)
+80102de4:	e8 47 d9 ff ff       	call   80100730 <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+80102de9:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+80102dec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80102def:	83 c4 10             	add    $0x10,%esp
+80102df2:	01 5d dc             	add    %ebx,-0x24(%ebp)
+80102df5:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80102df8:	39 d8                	cmp    %ebx,%eax
+80102dfa:	72 94                	jb     80102d90 <writei+0x50>
+  if(n > 0 && off > ip->size){
+80102dfc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+80102dff:	39 7a 68             	cmp    %edi,0x68(%edx)
+80102e02:	72 34                	jb     80102e38 <writei+0xf8>
+  return n;
+80102e04:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+80102e07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102e0a:	5b                   	pop    %ebx
+80102e0b:	5e                   	pop    %esi
+80102e0c:	5f                   	pop    %edi
+80102e0d:	5d                   	pop    %ebp
+80102e0e:	c3                   	ret
+80102e0f:	90                   	nop
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+80102e10:	0f bf 42 62          	movswl 0x62(%edx),%eax
+80102e14:	66 83 f8 09          	cmp    $0x9,%ax
+80102e18:	77 2f                	ja     80102e49 <writei+0x109>
+80102e1a:	8b 04 c5 e4 70 11 80 	mov    -0x7fee8f1c(,%eax,8),%eax
+80102e21:	85 c0                	test   %eax,%eax
+80102e23:	74 24                	je     80102e49 <writei+0x109>
+    return devsw[ip->major].write(ip, src, n);
+80102e25:	8b 7d e0             	mov    -0x20(%ebp),%edi
+80102e28:	89 7d 10             	mov    %edi,0x10(%ebp)
+}
+80102e2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102e2e:	5b                   	pop    %ebx
+80102e2f:	5e                   	pop    %esi
+80102e30:	5f                   	pop    %edi
+80102e31:	5d                   	pop    %ebp
+    return devsw[ip->major].write(ip, src, n);
+80102e32:	ff e0                	jmp    *%eax
+80102e34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iupdate(ip);
+80102e38:	83 ec 0c             	sub    $0xc,%esp
+    ip->size = off;
+80102e3b:	89 7a 68             	mov    %edi,0x68(%edx)
+    iupdate(ip);
+80102e3e:	52                   	push   %edx
+80102e3f:	e8 fc f4 ff ff       	call   80102340 <iupdate>
+80102e44:	83 c4 10             	add    $0x10,%esp
+80102e47:	eb bb                	jmp    80102e04 <writei+0xc4>
+      return -1;
+80102e49:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102e4e:	eb b7                	jmp    80102e07 <writei+0xc7>
+
+80102e50 <namecmp>:
+{
+80102e50:	55                   	push   %ebp
+80102e51:	89 e5                	mov    %esp,%ebp
+80102e53:	83 ec 0c             	sub    $0xc,%esp
+  return strncmp(s, t, DIRSIZ);
+80102e56:	6a 0e                	push   $0xe
+80102e58:	ff 75 0c             	push   0xc(%ebp)
+80102e5b:	ff 75 08             	push   0x8(%ebp)
+80102e5e:	e8 9d 50 00 00       	call   80107f00 <strncmp>
+}
+80102e63:	c9                   	leave
+80102e64:	c3                   	ret
+80102e65:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102e6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102e70 <dcinval>:
+{
+80102e70:	55                   	push   %ebp
+80102e71:	89 e5                	mov    %esp,%ebp
+80102e73:	56                   	push   %esi
+80102e74:	53                   	push   %ebx
+80102e75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80102e78:	8b 75 0c             	mov    0xc(%ebp),%esi
+  acquire(&dcache.lock);
+80102e7b:	83 ec 0c             	sub    $0xc,%esp
+80102e7e:	68 40 71 11 80       	push   $0x80117140
+80102e83:	e8 98 4e 00 00       	call   80107d20 <acquire>
+  if((d = dcfind(dp, name)) != 0)
+80102e88:	89 f2                	mov    %esi,%edx
+80102e8a:	89 d8                	mov    %ebx,%eax
+80102e8c:	e8 3f ee ff ff       	call   80101cd0 <dcfind>
+80102e91:	83 c4 10             	add    $0x10,%esp
+80102e94:	85 c0                	test   %eax,%eax
+80102e96:	74 05                	je     80102e9d <dcinval+0x2d>
+    dcdrop(d);
+80102e98:	e8 83 ed ff ff       	call   80101c20 <dcdrop>
+  release(&dcache.lock);
+80102e9d:	c7 45 08 40 71 11 80 	movl   $0x80117140,0x8(%ebp)
+}
+80102ea4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102ea7:	5b                   	pop    %ebx
+80102ea8:	5e                   	pop    %esi
+80102ea9:	5d                   	pop    %ebp
+  release(&dcache.lock);
+80102eaa:	e9 11 4e 00 00       	jmp    80107cc0 <release>
+80102eaf:	90                   	nop
+
+80102eb0 <dirlookup>:
+{
+80102eb0:	55                   	push   %ebp
+80102eb1:	89 e5                	mov    %esp,%ebp
+80102eb3:	57                   	push   %edi
+80102eb4:	56                   	push   %esi
+80102eb5:	53                   	push   %ebx
+80102eb6:	83 ec 1c             	sub    $0x1c,%esp
+80102eb9:	8b 45 0c             	mov    0xc(%ebp),%eax
+80102ebc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80102ebf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80102ec2:	8b 45 10             	mov    0x10(%ebp),%eax
+  if(dp->type != T_DIR)
+80102ec5:	66 83 7b 60 01       	cmpw   $0x1,0x60(%ebx)
+{
+80102eca:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  if(dp->type != T_DIR)
+80102ecd:	0f 85 30 02 00 00    	jne    80103103 <dirlookup+0x253>
+  acquire(&dcache.lock);
+80102ed3:	83 ec 0c             	sub    $0xc,%esp
+80102ed6:	68 40 71 11 80       	push   $0x80117140
+80102edb:	e8 40 4e 00 00       	call   80107d20 <acquire>
+  if((d = dcfind(dp, name)) != 0){
+80102ee0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102ee3:	89 d8                	mov    %ebx,%eax
+80102ee5:	e8 e6 ed ff ff       	call   80101cd0 <dcfind>
+80102eea:	83 c4 10             	add    $0x10,%esp
+80102eed:	85 c0                	test   %eax,%eax
+80102eef:	74 5f                	je     80102f50 <dirlookup+0xa0>
+  d->next->prev = d->prev;
+80102ef1:	8b 48 28             	mov    0x28(%eax),%ecx
+80102ef4:	8b 50 24             	mov    0x24(%eax),%edx
+    release(&dcache.lock);
+80102ef7:	83 ec 0c             	sub    $0xc,%esp
+  d->next->prev = d->prev;
+80102efa:	89 51 24             	mov    %edx,0x24(%ecx)
+  d->prev->next = d->next;
+80102efd:	8b 48 28             	mov    0x28(%eax),%ecx
+80102f00:	89 4a 28             	mov    %ecx,0x28(%edx)
+    d->next = &dcache.lru;
+80102f03:	c7 40 28 68 9e 11 80 	movl   $0x80119e68,0x28(%eax)
+    d->prev = dcache.lru.prev;
+80102f0a:	8b 15 8c 9e 11 80    	mov    0x80119e8c,%edx
+80102f10:	89 50 24             	mov    %edx,0x24(%eax)
+  d->prev->next = d;
+80102f13:	89 42 28             	mov    %eax,0x28(%edx)
+  d->next->prev = d;
+80102f16:	8b 50 28             	mov    0x28(%eax),%edx
+80102f19:	89 42 24             	mov    %eax,0x24(%edx)
+    inum = d->inum;
+80102f1c:	8b 78 18             	mov    0x18(%eax),%edi
+    off = d->off;
+80102f1f:	8b 70 1c             	mov    0x1c(%eax),%esi
+    release(&dcache.lock);
+80102f22:	68 40 71 11 80       	push   $0x80117140
+80102f27:	e8 94 4d 00 00       	call   80107cc0 <release>
+    if(inum == 0)
+80102f2c:	83 c4 10             	add    $0x10,%esp
+80102f2f:	85 ff                	test   %edi,%edi
+80102f31:	0f 84 d0 00 00 00    	je     80103007 <dirlookup+0x157>
+    if(poff)
+80102f37:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80102f3a:	85 c0                	test   %eax,%eax
+80102f3c:	74 02                	je     80102f40 <dirlookup+0x90>
+      *poff = off;
+80102f3e:	89 30                	mov    %esi,(%eax)
+    return iget(dp->dev, inum);
+80102f40:	8b 03                	mov    (%ebx),%eax
+80102f42:	89 fa                	mov    %edi,%edx
+}
+80102f44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102f47:	5b                   	pop    %ebx
+80102f48:	5e                   	pop    %esi
+80102f49:	5f                   	pop    %edi
+80102f4a:	5d                   	pop    %ebp
+        return iget(dp->dev, inum);
+80102f4b:	e9 a0 e9 ff ff       	jmp    801018f0 <iget>
+  release(&dcache.lock);
+80102f50:	83 ec 0c             	sub    $0xc,%esp
+80102f53:	68 40 71 11 80       	push   $0x80117140
+80102f58:	e8 63 4d 00 00       	call   80107cc0 <release>
+  if(dp->size > 0){
+80102f5d:	8b 43 68             	mov    0x68(%ebx),%eax
+80102f60:	83 c4 10             	add    $0x10,%esp
+80102f63:	85 c0                	test   %eax,%eax
+80102f65:	0f 84 88 00 00 00    	je     80102ff3 <dirlookup+0x143>
+  if(dp->size <= BSIZE)
+80102f6b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+80102f70:	0f 87 a2 00 00 00    	ja     80103018 <dirlookup+0x168>
+80102f76:	31 f6                	xor    %esi,%esi
+    return 0;
+80102f78:	31 ff                	xor    %edi,%edi
+    bp = bread(dp->dev, bmap(dp, bn));
+80102f7a:	89 fa                	mov    %edi,%edx
+80102f7c:	89 d8                	mov    %ebx,%eax
+80102f7e:	89 f7                	mov    %esi,%edi
+80102f80:	e8 9b ef ff ff       	call   80101f20 <bmap>
+80102f85:	83 ec 08             	sub    $0x8,%esp
+80102f88:	c1 e7 04             	shl    $0x4,%edi
+80102f8b:	50                   	push   %eax
+80102f8c:	ff 33                	push   (%ebx)
+80102f8e:	e8 5d d5 ff ff       	call   801004f0 <bread>
+80102f93:	83 c4 10             	add    $0x10,%esp
+80102f96:	8b 70 60             	mov    0x60(%eax),%esi
+80102f99:	89 c1                	mov    %eax,%ecx
+    for(i = 0; i < DPB && bn*BSIZE + i*sizeof(*de) < dp->size; i++){
+80102f9b:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+80102f9e:	8d 86 00 10 00 00    	lea    0x1000(%esi),%eax
+80102fa4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80102fa7:	89 d8                	mov    %ebx,%eax
+80102fa9:	89 fb                	mov    %edi,%ebx
+80102fab:	89 c7                	mov    %eax,%edi
+80102fad:	eb 2e                	jmp    80102fdd <dirlookup+0x12d>
+80102faf:	90                   	nop
+      if(de[i].inum == 0)
+80102fb0:	66 83 3e 00          	cmpw   $0x0,(%esi)
+80102fb4:	74 1c                	je     80102fd2 <dirlookup+0x122>
+  return strncmp(s, t, DIRSIZ);
+80102fb6:	83 ec 04             	sub    $0x4,%esp
+      if(namecmp(name, de[i].name) == 0){
+80102fb9:	8d 46 02             	lea    0x2(%esi),%eax
+  return strncmp(s, t, DIRSIZ);
+80102fbc:	6a 0e                	push   $0xe
+80102fbe:	50                   	push   %eax
+80102fbf:	ff 75 e4             	push   -0x1c(%ebp)
+80102fc2:	e8 39 4f 00 00       	call   80107f00 <strncmp>
+      if(namecmp(name, de[i].name) == 0){
+80102fc7:	83 c4 10             	add    $0x10,%esp
+80102fca:	85 c0                	test   %eax,%eax
+80102fcc:	0f 84 d6 00 00 00    	je     801030a8 <dirlookup+0x1f8>
+    for(i = 0; i < DPB && bn*BSIZE + i*sizeof(*de) < dp->size; i++){
+80102fd2:	83 c3 10             	add    $0x10,%ebx
+80102fd5:	83 c6 10             	add    $0x10,%esi
+80102fd8:	39 75 e0             	cmp    %esi,-0x20(%ebp)
+80102fdb:	74 05                	je     80102fe2 <dirlookup+0x132>
+80102fdd:	3b 5f 68             	cmp    0x68(%edi),%ebx
+80102fe0:	72 ce                	jb     80102fb0 <dirlookup+0x100>
+80102fe2:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+    brelse(bp);
+80102fe5:	83 ec 0c             	sub    $0xc,%esp
+80102fe8:	89 fb                	mov    %edi,%ebx
+80102fea:	51                   	push   %ecx
+80102feb:	e8 40 d7 ff ff       	call   80100730 <brelse>
+80102ff0:	83 c4 10             	add    $0x10,%esp
+  dcenter(dp, name, 0, 0);
+80102ff3:	83 ec 0c             	sub    $0xc,%esp
+80102ff6:	31 c9                	xor    %ecx,%ecx
+80102ff8:	89 d8                	mov    %ebx,%eax
+80102ffa:	6a 00                	push   $0x0
+80102ffc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102fff:	e8 7c ed ff ff       	call   80101d80 <dcenter>
+  return 0;
+80103004:	83 c4 10             	add    $0x10,%esp
+}
+80103007:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010300a:	31 c0                	xor    %eax,%eax
+8010300c:	5b                   	pop    %ebx
+8010300d:	5e                   	pop    %esi
+8010300e:	5f                   	pop    %edi
+8010300f:	5d                   	pop    %ebp
+80103010:	c3                   	ret
+80103011:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if((addr = ip->addrs[bn]) == 0)
+80103018:	8b 43 6c             	mov    0x6c(%ebx),%eax
+8010301b:	85 c0                	test   %eax,%eax
+8010301d:	0f 84 c5 00 00 00    	je     801030e8 <dirlookup+0x238>
+  bp = bread(dp->dev, bmap(dp, 0));
+80103023:	83 ec 08             	sub    $0x8,%esp
+80103026:	50                   	push   %eax
+80103027:	ff 33                	push   (%ebx)
+80103029:	e8 c2 d4 ff ff       	call   801004f0 <bread>
+8010302e:	83 c4 10             	add    $0x10,%esp
+80103031:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  dx = (struct dxentry*)bp->data;
+80103034:	8b 78 60             	mov    0x60(%eax),%edi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103037:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010303a:	89 c1                	mov    %eax,%ecx
+8010303c:	8d 70 0e             	lea    0xe(%eax),%esi
+  h = 2166136261U;
+8010303f:	b8 c5 9d 1c 81       	mov    $0x811c9dc5,%eax
+80103044:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103048:	0f b6 11             	movzbl (%ecx),%edx
+8010304b:	84 d2                	test   %dl,%dl
+8010304d:	74 0f                	je     8010305e <dirlookup+0x1ae>
+    h = (h ^ (uchar)name[i]) * 16777619;
+8010304f:	31 c2                	xor    %eax,%edx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103051:	83 c1 01             	add    $0x1,%ecx
+    h = (h ^ (uchar)name[i]) * 16777619;
+80103054:	69 c2 93 01 00 01    	imul   $0x1000193,%edx,%eax
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+8010305a:	39 f1                	cmp    %esi,%ecx
+8010305c:	75 ea                	jne    80103048 <dirlookup+0x198>
+  bn = dx[dxfind(dx, dp->size/BSIZE - 1, dirhash(name))].blk;
+8010305e:	8b 73 68             	mov    0x68(%ebx),%esi
+  lo = 0;
+80103061:	31 c9                	xor    %ecx,%ecx
+  bn = dx[dxfind(dx, dp->size/BSIZE - 1, dirhash(name))].blk;
+80103063:	c1 ee 0c             	shr    $0xc,%esi
+  hi = n - 1;
+80103066:	83 ee 02             	sub    $0x2,%esi
+  while(lo < hi){
+80103069:	eb 13                	jmp    8010307e <dirlookup+0x1ce>
+8010306b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010306f:	90                   	nop
+    mid = (lo + hi + 1) / 2;
+80103070:	8d 54 0e 01          	lea    0x1(%esi,%ecx,1),%edx
+80103074:	d1 fa                	sar    %edx
+    if(dx[mid].hash <= h)
+80103076:	3b 44 d7 04          	cmp    0x4(%edi,%edx,8),%eax
+8010307a:	72 24                	jb     801030a0 <dirlookup+0x1f0>
+    mid = (lo + hi + 1) / 2;
+8010307c:	89 d1                	mov    %edx,%ecx
+  while(lo < hi){
+8010307e:	39 f1                	cmp    %esi,%ecx
+80103080:	7c ee                	jl     80103070 <dirlookup+0x1c0>
+  bn = dx[dxfind(dx, dp->size/BSIZE - 1, dirhash(name))].blk;
+80103082:	0f b7 7c cf 02       	movzwl 0x2(%edi,%ecx,8),%edi
+  brelse(bp);
+80103087:	83 ec 0c             	sub    $0xc,%esp
+8010308a:	ff 75 e0             	push   -0x20(%ebp)
+    for(i = 0; i < DPB && bn*BSIZE + i*sizeof(*de) < dp->size; i++){
+8010308d:	89 fe                	mov    %edi,%esi
+  brelse(bp);
+8010308f:	e8 9c d6 ff ff       	call   80100730 <brelse>
+    for(i = 0; i < DPB && bn*BSIZE + i*sizeof(*de) < dp->size; i++){
+80103094:	c1 e6 08             	shl    $0x8,%esi
+  return bn;
+80103097:	83 c4 10             	add    $0x10,%esp
+8010309a:	e9 db fe ff ff       	jmp    80102f7a <dirlookup+0xca>
+8010309f:	90                   	nop
+      hi = mid - 1;
+801030a0:	8d 72 ff             	lea    -0x1(%edx),%esi
+801030a3:	eb d9                	jmp    8010307e <dirlookup+0x1ce>
+801030a5:	8d 76 00             	lea    0x0(%esi),%esi
+        inum = de[i].inum;
+801030a8:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+        brelse(bp);
+801030ab:	83 ec 0c             	sub    $0xc,%esp
+        inum = de[i].inum;
+801030ae:	0f b7 36             	movzwl (%esi),%esi
+801030b1:	89 f8                	mov    %edi,%eax
+801030b3:	89 df                	mov    %ebx,%edi
+801030b5:	89 c3                	mov    %eax,%ebx
+        brelse(bp);
+801030b7:	51                   	push   %ecx
+801030b8:	e8 73 d6 ff ff       	call   80100730 <brelse>
+        if(poff)
+801030bd:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801030c0:	83 c4 10             	add    $0x10,%esp
+801030c3:	85 c0                	test   %eax,%eax
+801030c5:	74 02                	je     801030c9 <dirlookup+0x219>
+          *poff = off;
+801030c7:	89 38                	mov    %edi,(%eax)
+        dcenter(dp, name, inum, off);
+801030c9:	83 ec 0c             	sub    $0xc,%esp
+801030cc:	89 d8                	mov    %ebx,%eax
+801030ce:	89 f1                	mov    %esi,%ecx
+801030d0:	57                   	push   %edi
+801030d1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801030d4:	e8 a7 ec ff ff       	call   80101d80 <dcenter>
+        return iget(dp->dev, inum);
+801030d9:	8b 03                	mov    (%ebx),%eax
+801030db:	83 c4 10             	add    $0x10,%esp
+801030de:	89 f2                	mov    %esi,%edx
+801030e0:	e9 5f fe ff ff       	jmp    80102f44 <dirlookup+0x94>
+801030e5:	8d 76 00             	lea    0x0(%esi),%esi
+  ip->lastblk = balloc(ip->dev, ip->lastblk ? ip->lastblk + 1 : 0);
+801030e8:	8b 53 5c             	mov    0x5c(%ebx),%edx
+801030eb:	8b 03                	mov    (%ebx),%eax
+801030ed:	83 fa 01             	cmp    $0x1,%edx
+801030f0:	83 da ff             	sbb    $0xffffffff,%edx
+801030f3:	e8 48 e9 ff ff       	call   80101a40 <balloc>
+801030f8:	89 43 5c             	mov    %eax,0x5c(%ebx)
+      ip->addrs[bn] = addr = iballoc(ip);
+801030fb:	89 43 6c             	mov    %eax,0x6c(%ebx)
+801030fe:	e9 20 ff ff ff       	jmp    80103023 <dirlookup+0x173>
+    panic("dirlookup not DIR");
+80103103:	83 ec 0c             	sub    $0xc,%esp
+80103106:	68 1f b7 10 80       	push   $0x8010b71f
+8010310b:	e8 70 d7 ff ff       	call   80100880 <panic>
+
+80103110 <namex>:
+// If parent != 0, return the inode for the parent and copy the final
+// path element into name, which must have room for DIRSIZ bytes.
+// Must be called inside a transaction since it calls iput().
+static struct inode*
+namex(char *path, int nameiparent, char *name)
+{
+80103110:	55                   	push   %ebp
+80103111:	89 e5                	mov    %esp,%ebp
+80103113:	57                   	push   %edi
+80103114:	56                   	push   %esi
+80103115:	53                   	push   %ebx
+80103116:	89 c3                	mov    %eax,%ebx
+80103118:	83 ec 1c             	sub    $0x1c,%esp
+  struct inode *ip, *next;
+
+  if(*path == '/')
+8010311b:	80 38 2f             	cmpb   $0x2f,(%eax)
+{
+8010311e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80103121:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  if(*path == '/')
+80103124:	0f 84 74 01 00 00    	je     8010329e <namex+0x18e>
+    ip = iget(ROOTDEV, ROOTINO);
+  else
+    ip = idup(myproc()->cwd);
+8010312a:	e8 21 34 00 00       	call   80106550 <myproc>
+  acquire(&icache.lock);
+8010312f:	83 ec 0c             	sub    $0xc,%esp
+    ip = idup(myproc()->cwd);
+80103132:	8b b0 84 00 00 00    	mov    0x84(%eax),%esi
+  acquire(&icache.lock);
+80103138:	68 a0 9e 11 80       	push   $0x80119ea0
+8010313d:	e8 de 4b 00 00       	call   80107d20 <acquire>
+  ip->ref++;
+80103142:	83 46 08 01          	addl   $0x1,0x8(%esi)
+  release(&icache.lock);
+80103146:	c7 04 24 a0 9e 11 80 	movl   $0x80119ea0,(%esp)
+8010314d:	e8 6e 4b 00 00       	call   80107cc0 <release>
+80103152:	83 c4 10             	add    $0x10,%esp
+80103155:	eb 0c                	jmp    80103163 <namex+0x53>
+80103157:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010315e:	66 90                	xchg   %ax,%ax
+    path++;
+80103160:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+80103163:	0f b6 03             	movzbl (%ebx),%eax
+80103166:	3c 2f                	cmp    $0x2f,%al
+80103168:	74 f6                	je     80103160 <namex+0x50>
+  if(*path == 0)
+8010316a:	84 c0                	test   %al,%al
+8010316c:	0f 84 0e 01 00 00    	je     80103280 <namex+0x170>
+  while(*path != '/' && *path != 0)
+80103172:	0f b6 03             	movzbl (%ebx),%eax
+80103175:	84 c0                	test   %al,%al
+80103177:	0f 84 18 01 00 00    	je     80103295 <namex+0x185>
+8010317d:	89 df                	mov    %ebx,%edi
+8010317f:	3c 2f                	cmp    $0x2f,%al
+80103181:	0f 84 0e 01 00 00    	je     80103295 <namex+0x185>
+80103187:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010318e:	66 90                	xchg   %ax,%ax
+80103190:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+    path++;
+80103194:	83 c7 01             	add    $0x1,%edi
+  while(*path != '/' && *path != 0)
+80103197:	3c 2f                	cmp    $0x2f,%al
+80103199:	74 04                	je     8010319f <namex+0x8f>
+8010319b:	84 c0                	test   %al,%al
+8010319d:	75 f1                	jne    80103190 <namex+0x80>
+  len = path - s;
+8010319f:	89 f8                	mov    %edi,%eax
+801031a1:	29 d8                	sub    %ebx,%eax
+  if(len >= DIRSIZ)
+801031a3:	83 f8 0d             	cmp    $0xd,%eax
+801031a6:	0f 8e ac 00 00 00    	jle    80103258 <namex+0x148>
+    memmove(name, s, DIRSIZ);
+801031ac:	83 ec 04             	sub    $0x4,%esp
+801031af:	6a 0e                	push   $0xe
+801031b1:	53                   	push   %ebx
+    path++;
+801031b2:	89 fb                	mov    %edi,%ebx
+    memmove(name, s, DIRSIZ);
+801031b4:	ff 75 e4             	push   -0x1c(%ebp)
+801031b7:	e8 d4 4c 00 00       	call   80107e90 <memmove>
+801031bc:	83 c4 10             	add    $0x10,%esp
+  while(*path == '/')
+801031bf:	80 3f 2f             	cmpb   $0x2f,(%edi)
+801031c2:	75 0c                	jne    801031d0 <namex+0xc0>
+801031c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    path++;
+801031c8:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+801031cb:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+801031ce:	74 f8                	je     801031c8 <namex+0xb8>
+
+  while((path = skipelem(path, name)) != 0){
+    ilock(ip);
+801031d0:	83 ec 0c             	sub    $0xc,%esp
+801031d3:	56                   	push   %esi
+801031d4:	e8 87 f6 ff ff       	call   80102860 <ilock>
+    if(ip->type != T_DIR){
+801031d9:	83 c4 10             	add    $0x10,%esp
+801031dc:	66 83 7e 60 01       	cmpw   $0x1,0x60(%esi)
+801031e1:	0f 85 cd 00 00 00    	jne    801032b4 <namex+0x1a4>
+      iunlockput(ip);
+      return 0;
+    }
+    if(nameiparent && *path == '\0'){
+801031e7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801031ea:	85 c0                	test   %eax,%eax
+801031ec:	74 09                	je     801031f7 <namex+0xe7>
+801031ee:	80 3b 00             	cmpb   $0x0,(%ebx)
+801031f1:	0f 84 34 01 00 00    	je     8010332b <namex+0x21b>
+      // Stop one level early.
+      iunlock(ip);
+      return ip;
+    }
+    if((next = dirlookup(ip, name, 0)) == 0){
+801031f7:	83 ec 04             	sub    $0x4,%esp
+801031fa:	6a 00                	push   $0x0
+801031fc:	ff 75 e4             	push   -0x1c(%ebp)
+801031ff:	56                   	push   %esi
+80103200:	e8 ab fc ff ff       	call   80102eb0 <dirlookup>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80103205:	8d 56 18             	lea    0x18(%esi),%edx
+    if((next = dirlookup(ip, name, 0)) == 0){
+80103208:	83 c4 10             	add    $0x10,%esp
+8010320b:	89 c7                	mov    %eax,%edi
+8010320d:	85 c0                	test   %eax,%eax
+8010320f:	0f 84 e1 00 00 00    	je     801032f6 <namex+0x1e6>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80103215:	83 ec 0c             	sub    $0xc,%esp
+80103218:	52                   	push   %edx
+80103219:	89 55 e0             	mov    %edx,-0x20(%ebp)
+8010321c:	e8 cf 48 00 00       	call   80107af0 <holdingsleep>
+80103221:	83 c4 10             	add    $0x10,%esp
+80103224:	85 c0                	test   %eax,%eax
+80103226:	0f 84 3f 01 00 00    	je     8010336b <namex+0x25b>
+8010322c:	8b 56 08             	mov    0x8(%esi),%edx
+8010322f:	85 d2                	test   %edx,%edx
+80103231:	0f 8e 34 01 00 00    	jle    8010336b <namex+0x25b>
+  releasesleep(&ip->lock);
+80103237:	8b 55 e0             	mov    -0x20(%ebp),%edx
+8010323a:	83 ec 0c             	sub    $0xc,%esp
+8010323d:	52                   	push   %edx
+8010323e:	e8 6d 48 00 00       	call   80107ab0 <releasesleep>
+  iput(ip);
+80103243:	89 34 24             	mov    %esi,(%esp)
+80103246:	89 fe                	mov    %edi,%esi
+80103248:	e8 43 f7 ff ff       	call   80102990 <iput>
+8010324d:	83 c4 10             	add    $0x10,%esp
+  while(*path == '/')
+80103250:	e9 0e ff ff ff       	jmp    80103163 <namex+0x53>
+80103255:	8d 76 00             	lea    0x0(%esi),%esi
+    name[len] = 0;
+80103258:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010325b:	8d 14 01             	lea    (%ecx,%eax,1),%edx
+    memmove(name, s, len);
+8010325e:	83 ec 04             	sub    $0x4,%esp
+80103261:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80103264:	50                   	push   %eax
+80103265:	53                   	push   %ebx
+    name[len] = 0;
+80103266:	89 fb                	mov    %edi,%ebx
+    memmove(name, s, len);
+80103268:	ff 75 e4             	push   -0x1c(%ebp)
+8010326b:	e8 20 4c 00 00       	call   80107e90 <memmove>
+    name[len] = 0;
+80103270:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80103273:	83 c4 10             	add    $0x10,%esp
+80103276:	c6 02 00             	movb   $0x0,(%edx)
+80103279:	e9 41 ff ff ff       	jmp    801031bf <namex+0xaf>
+8010327e:	66 90                	xchg   %ax,%ax
+      return 0;
+    }
+    iunlockput(ip);
+    ip = next;
+  }
+  if(nameiparent){
+80103280:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80103283:	85 c0                	test   %eax,%eax
+80103285:	0f 85 d0 00 00 00    	jne    8010335b <namex+0x24b>
+    iput(ip);
+    return 0;
+  }
+  return ip;
+}
+8010328b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010328e:	89 f0                	mov    %esi,%eax
+80103290:	5b                   	pop    %ebx
+80103291:	5e                   	pop    %esi
+80103292:	5f                   	pop    %edi
+80103293:	5d                   	pop    %ebp
+80103294:	c3                   	ret
+  while(*path != '/' && *path != 0)
+80103295:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80103298:	89 df                	mov    %ebx,%edi
+8010329a:	31 c0                	xor    %eax,%eax
+8010329c:	eb c0                	jmp    8010325e <namex+0x14e>
+    ip = iget(ROOTDEV, ROOTINO);
+8010329e:	ba 01 00 00 00       	mov    $0x1,%edx
+801032a3:	b8 01 00 00 00       	mov    $0x1,%eax
+801032a8:	e8 43 e6 ff ff       	call   801018f0 <iget>
+801032ad:	89 c6                	mov    %eax,%esi
+801032af:	e9 af fe ff ff       	jmp    80103163 <namex+0x53>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+801032b4:	83 ec 0c             	sub    $0xc,%esp
+801032b7:	8d 5e 18             	lea    0x18(%esi),%ebx
+801032ba:	53                   	push   %ebx
+801032bb:	e8 30 48 00 00       	call   80107af0 <holdingsleep>
+801032c0:	83 c4 10             	add    $0x10,%esp
+801032c3:	85 c0                	test   %eax,%eax
+801032c5:	0f 84 a0 00 00 00    	je     8010336b <namex+0x25b>
+801032cb:	8b 46 08             	mov    0x8(%esi),%eax
+801032ce:	85 c0                	test   %eax,%eax
+801032d0:	0f 8e 95 00 00 00    	jle    8010336b <namex+0x25b>
+  releasesleep(&ip->lock);
+801032d6:	83 ec 0c             	sub    $0xc,%esp
+801032d9:	53                   	push   %ebx
+801032da:	e8 d1 47 00 00       	call   80107ab0 <releasesleep>
+  iput(ip);
+801032df:	89 34 24             	mov    %esi,(%esp)
+      return 0;
+801032e2:	31 f6                	xor    %esi,%esi
+  iput(ip);
+801032e4:	e8 a7 f6 ff ff       	call   80102990 <iput>
+      return 0;
+801032e9:	83 c4 10             	add    $0x10,%esp
+}
+801032ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801032ef:	89 f0                	mov    %esi,%eax
+801032f1:	5b                   	pop    %ebx
+801032f2:	5e                   	pop    %esi
+801032f3:	5f                   	pop    %edi
+801032f4:	5d                   	pop    %ebp
+801032f5:	c3                   	ret
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+801032f6:	83 ec 0c             	sub    $0xc,%esp
+801032f9:	52                   	push   %edx
+801032fa:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801032fd:	e8 ee 47 00 00       	call   80107af0 <holdingsleep>
+80103302:	83 c4 10             	add    $0x10,%esp
+80103305:	85 c0                	test   %eax,%eax
+80103307:	74 62                	je     8010336b <namex+0x25b>
+80103309:	8b 4e 08             	mov    0x8(%esi),%ecx
+8010330c:	85 c9                	test   %ecx,%ecx
+8010330e:	7e 5b                	jle    8010336b <namex+0x25b>
+  releasesleep(&ip->lock);
+80103310:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80103313:	83 ec 0c             	sub    $0xc,%esp
+80103316:	52                   	push   %edx
+80103317:	e8 94 47 00 00       	call   80107ab0 <releasesleep>
+  iput(ip);
+8010331c:	89 34 24             	mov    %esi,(%esp)
+      return 0;
+8010331f:	31 f6                	xor    %esi,%esi
+  iput(ip);
+80103321:	e8 6a f6 ff ff       	call   80102990 <iput>
+      return 0;
+80103326:	83 c4 10             	add    $0x10,%esp
+80103329:	eb c1                	jmp    801032ec <namex+0x1dc>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+8010332b:	83 ec 0c             	sub    $0xc,%esp
+8010332e:	8d 5e 18             	lea    0x18(%esi),%ebx
+80103331:	53                   	push   %ebx
+80103332:	e8 b9 47 00 00       	call   80107af0 <holdingsleep>
+80103337:	83 c4 10             	add    $0x10,%esp
+8010333a:	85 c0                	test   %eax,%eax
+8010333c:	74 2d                	je     8010336b <namex+0x25b>
+8010333e:	8b 7e 08             	mov    0x8(%esi),%edi
+80103341:	85 ff                	test   %edi,%edi
+80103343:	7e 26                	jle    8010336b <namex+0x25b>
+  releasesleep(&ip->lock);
+80103345:	83 ec 0c             	sub    $0xc,%esp
+80103348:	53                   	push   %ebx
+80103349:	e8 62 47 00 00       	call   80107ab0 <releasesleep>
+}
+8010334e:	83 c4 10             	add    $0x10,%esp
+}
+80103351:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103354:	89 f0                	mov    %esi,%eax
+80103356:	5b                   	pop    %ebx
+80103357:	5e                   	pop    %esi
+80103358:	5f                   	pop    %edi
+80103359:	5d                   	pop    %ebp
+8010335a:	c3                   	ret
+    iput(ip);
+8010335b:	83 ec 0c             	sub    $0xc,%esp
+8010335e:	56                   	push   %esi
+      return 0;
+8010335f:	31 f6                	xor    %esi,%esi
+    iput(ip);
+80103361:	e8 2a f6 ff ff       	call   80102990 <iput>
+    return 0;
+80103366:	83 c4 10             	add    $0x10,%esp
+80103369:	eb 81                	jmp    801032ec <namex+0x1dc>
+    panic("iunlock");
+8010336b:	83 ec 0c             	sub    $0xc,%esp
+8010336e:	68 17 b7 10 80       	push   $0x8010b717
+80103373:	e8 08 d5 ff ff       	call   80100880 <panic>
+80103378:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010337f:	90                   	nop
+
+80103380 <dirlink>:
+{
+80103380:	55                   	push   %ebp
+80103381:	89 e5                	mov    %esp,%ebp
+80103383:	57                   	push   %edi
+80103384:	56                   	push   %esi
+80103385:	53                   	push   %ebx
+80103386:	83 ec 30             	sub    $0x30,%esp
+80103389:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010338c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+8010338f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80103392:	89 45 d0             	mov    %eax,-0x30(%ebp)
+80103395:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if((ip = dirlookup(dp, name, 0)) != 0){
+80103398:	6a 00                	push   $0x0
+8010339a:	50                   	push   %eax
+8010339b:	53                   	push   %ebx
+8010339c:	e8 0f fb ff ff       	call   80102eb0 <dirlookup>
+801033a1:	83 c4 10             	add    $0x10,%esp
+801033a4:	85 c0                	test   %eax,%eax
+801033a6:	0f 85 18 02 00 00    	jne    801035c4 <dirlink+0x244>
+  if(dp->size > BSIZE)
+801033ac:	8b 7b 68             	mov    0x68(%ebx),%edi
+801033af:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+801033b5:	0f 87 95 00 00 00    	ja     80103450 <dirlink+0xd0>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+801033bb:	8d 75 d8             	lea    -0x28(%ebp),%esi
+801033be:	85 ff                	test   %edi,%edi
+801033c0:	74 3f                	je     80103401 <dirlink+0x81>
+801033c2:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+801033c9:	31 ff                	xor    %edi,%edi
+801033cb:	8d 75 d8             	lea    -0x28(%ebp),%esi
+801033ce:	eb 0b                	jmp    801033db <dirlink+0x5b>
+801033d0:	83 c7 10             	add    $0x10,%edi
+801033d3:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+801033d6:	3b 7b 68             	cmp    0x68(%ebx),%edi
+801033d9:	73 1d                	jae    801033f8 <dirlink+0x78>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+801033db:	6a 10                	push   $0x10
+801033dd:	57                   	push   %edi
+801033de:	56                   	push   %esi
+801033df:	53                   	push   %ebx
+801033e0:	e8 eb f7 ff ff       	call   80102bd0 <readi>
+801033e5:	83 c4 10             	add    $0x10,%esp
+801033e8:	83 f8 10             	cmp    $0x10,%eax
+801033eb:	0f 85 e9 01 00 00    	jne    801035da <dirlink+0x25a>
+    if(de.inum == 0)
+801033f1:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+801033f6:	75 d8                	jne    801033d0 <dirlink+0x50>
+  if(off == BSIZE){
+801033f8:	81 7d d4 00 10 00 00 	cmpl   $0x1000,-0x2c(%ebp)
+801033ff:	74 67                	je     80103468 <dirlink+0xe8>
+  strncpy(de.name, name, DIRSIZ);
+80103401:	83 ec 04             	sub    $0x4,%esp
+80103404:	8d 45 da             	lea    -0x26(%ebp),%eax
+80103407:	6a 0e                	push   $0xe
+80103409:	ff 75 d0             	push   -0x30(%ebp)
+8010340c:	50                   	push   %eax
+8010340d:	e8 3e 4b 00 00       	call   80107f50 <strncpy>
+  de.inum = inum;
+80103412:	0f b7 45 cc          	movzwl -0x34(%ebp),%eax
+80103416:	66 89 45 d8          	mov    %ax,-0x28(%ebp)
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+8010341a:	6a 10                	push   $0x10
+8010341c:	57                   	push   %edi
+8010341d:	56                   	push   %esi
+8010341e:	53                   	push   %ebx
+8010341f:	e8 1c f9 ff ff       	call   80102d40 <writei>
+80103424:	83 c4 20             	add    $0x20,%esp
+80103427:	83 f8 10             	cmp    $0x10,%eax
+8010342a:	0f 85 b7 01 00 00    	jne    801035e7 <dirlink+0x267>
+  dcenter(dp, name, inum, off);
+80103430:	83 ec 0c             	sub    $0xc,%esp
+80103433:	89 d8                	mov    %ebx,%eax
+80103435:	57                   	push   %edi
+80103436:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+80103439:	8b 55 d0             	mov    -0x30(%ebp),%edx
+8010343c:	e8 3f e9 ff ff       	call   80101d80 <dcenter>
+  return 0;
+80103441:	83 c4 10             	add    $0x10,%esp
+80103444:	31 c0                	xor    %eax,%eax
+}
+80103446:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103449:	5b                   	pop    %ebx
+8010344a:	5e                   	pop    %esi
+8010344b:	5f                   	pop    %edi
+8010344c:	5d                   	pop    %ebp
+8010344d:	c3                   	ret
+8010344e:	66 90                	xchg   %ax,%ax
+    return dxlink(dp, name, inum);
+80103450:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+80103453:	8b 55 d0             	mov    -0x30(%ebp),%edx
+}
+80103456:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return dxlink(dp, name, inum);
+80103459:	89 d8                	mov    %ebx,%eax
+}
+8010345b:	5b                   	pop    %ebx
+8010345c:	5e                   	pop    %esi
+8010345d:	5f                   	pop    %edi
+8010345e:	5d                   	pop    %ebp
+    return dxlink(dp, name, inum);
+8010345f:	e9 5c ef ff ff       	jmp    801023c0 <dxlink>
+80103464:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((addr = ip->addrs[bn]) == 0)
+80103468:	8b 43 70             	mov    0x70(%ebx),%eax
+8010346b:	85 c0                	test   %eax,%eax
+8010346d:	0f 84 36 01 00 00    	je     801035a9 <dirlink+0x229>
+  lp = bread(dp->dev, bmap(dp, 1));
+80103473:	83 ec 08             	sub    $0x8,%esp
+80103476:	50                   	push   %eax
+80103477:	ff 33                	push   (%ebx)
+80103479:	e8 72 d0 ff ff       	call   801004f0 <bread>
+    if((addr = ip->addrs[bn]) == 0)
+8010347e:	83 c4 10             	add    $0x10,%esp
+  lp = bread(dp->dev, bmap(dp, 1));
+80103481:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    if((addr = ip->addrs[bn]) == 0)
+80103484:	8b 43 6c             	mov    0x6c(%ebx),%eax
+80103487:	85 c0                	test   %eax,%eax
+80103489:	0f 84 ff 00 00 00    	je     8010358e <dirlink+0x20e>
+  bp = bread(dp->dev, bmap(dp, 0));
+8010348f:	83 ec 08             	sub    $0x8,%esp
+80103492:	50                   	push   %eax
+80103493:	ff 33                	push   (%ebx)
+80103495:	e8 56 d0 ff ff       	call   801004f0 <bread>
+  memmove(lp->data, bp->data, BSIZE);
+8010349a:	83 c4 0c             	add    $0xc,%esp
+8010349d:	68 00 10 00 00       	push   $0x1000
+  bp = bread(dp->dev, bmap(dp, 0));
+801034a2:	89 c6                	mov    %eax,%esi
+  memmove(lp->data, bp->data, BSIZE);
+801034a4:	ff 70 60             	push   0x60(%eax)
+801034a7:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+801034aa:	ff 77 60             	push   0x60(%edi)
+801034ad:	e8 de 49 00 00       	call   80107e90 <memmove>
+  memset(bp->data, 0, BSIZE);
+801034b2:	83 c4 0c             	add    $0xc,%esp
+801034b5:	68 00 10 00 00       	push   $0x1000
+801034ba:	6a 00                	push   $0x0
+801034bc:	ff 76 60             	push   0x60(%esi)
+801034bf:	e8 3c 49 00 00       	call   80107e00 <memset>
+  dx = (struct dxentry*)bp->data;
+801034c4:	8b 46 60             	mov    0x60(%esi),%eax
+  dx[0].blk = 1;
+801034c7:	ba 01 00 00 00       	mov    $0x1,%edx
+801034cc:	66 89 50 02          	mov    %dx,0x2(%eax)
+  dx[0].hash = 0;
+801034d0:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  log_write(lp);
+801034d7:	89 3c 24             	mov    %edi,(%esp)
+801034da:	e8 21 1c 00 00       	call   80105100 <log_write>
+  log_write(bp);
+801034df:	89 34 24             	mov    %esi,(%esp)
+801034e2:	e8 19 1c 00 00       	call   80105100 <log_write>
+  brelse(bp);
+801034e7:	89 34 24             	mov    %esi,(%esp)
+  de = (struct dirent*)lp->data;
+801034ea:	be 00 10 00 00       	mov    $0x1000,%esi
+  brelse(bp);
+801034ef:	e8 3c d2 ff ff       	call   80100730 <brelse>
+  dp->size = 2*BSIZE;
+801034f4:	c7 43 68 00 20 00 00 	movl   $0x2000,0x68(%ebx)
+  iupdate(dp);
+801034fb:	89 1c 24             	mov    %ebx,(%esp)
+801034fe:	e8 3d ee ff ff       	call   80102340 <iupdate>
+  for(i = 0; i < DPB; i++)
+80103503:	8b 47 60             	mov    0x60(%edi),%eax
+80103506:	83 c4 10             	add    $0x10,%esp
+80103509:	89 45 c8             	mov    %eax,-0x38(%ebp)
+8010350c:	8d 78 02             	lea    0x2(%eax),%edi
+8010350f:	eb 15                	jmp    80103526 <dirlink+0x1a6>
+80103511:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103518:	83 c6 10             	add    $0x10,%esi
+8010351b:	83 c7 10             	add    $0x10,%edi
+8010351e:	81 fe 00 20 00 00    	cmp    $0x2000,%esi
+80103524:	74 45                	je     8010356b <dirlink+0x1eb>
+    if(de[i].inum != 0)
+80103526:	66 83 7f fe 00       	cmpw   $0x0,-0x2(%edi)
+8010352b:	74 eb                	je     80103518 <dirlink+0x198>
+  acquire(&dcache.lock);
+8010352d:	83 ec 0c             	sub    $0xc,%esp
+80103530:	68 40 71 11 80       	push   $0x80117140
+80103535:	e8 e6 47 00 00       	call   80107d20 <acquire>
+  if((d = dcfind(dp, name)) != 0)
+8010353a:	89 fa                	mov    %edi,%edx
+8010353c:	89 d8                	mov    %ebx,%eax
+8010353e:	e8 8d e7 ff ff       	call   80101cd0 <dcfind>
+80103543:	83 c4 10             	add    $0x10,%esp
+80103546:	85 c0                	test   %eax,%eax
+80103548:	74 03                	je     8010354d <dirlink+0x1cd>
+    d->off = off;
+8010354a:	89 70 1c             	mov    %esi,0x1c(%eax)
+  release(&dcache.lock);
+8010354d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < DPB; i++)
+80103550:	83 c6 10             	add    $0x10,%esi
+80103553:	83 c7 10             	add    $0x10,%edi
+  release(&dcache.lock);
+80103556:	68 40 71 11 80       	push   $0x80117140
+8010355b:	e8 60 47 00 00       	call   80107cc0 <release>
+}
+80103560:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < DPB; i++)
+80103563:	81 fe 00 20 00 00    	cmp    $0x2000,%esi
+80103569:	75 bb                	jne    80103526 <dirlink+0x1a6>
+  brelse(lp);
+8010356b:	83 ec 0c             	sub    $0xc,%esp
+8010356e:	ff 75 d4             	push   -0x2c(%ebp)
+80103571:	e8 ba d1 ff ff       	call   80100730 <brelse>
+    return dxlink(dp, name, inum);
+80103576:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+80103579:	8b 55 d0             	mov    -0x30(%ebp),%edx
+8010357c:	89 d8                	mov    %ebx,%eax
+8010357e:	e8 3d ee ff ff       	call   801023c0 <dxlink>
+80103583:	83 c4 10             	add    $0x10,%esp
+}
+80103586:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103589:	5b                   	pop    %ebx
+8010358a:	5e                   	pop    %esi
+8010358b:	5f                   	pop    %edi
+8010358c:	5d                   	pop    %ebp
+8010358d:	c3                   	ret
+  ip->lastblk = balloc(ip->dev, ip->lastblk ? ip->lastblk + 1 : 0);
+8010358e:	8b 53 5c             	mov    0x5c(%ebx),%edx
+80103591:	8b 03                	mov    (%ebx),%eax
+80103593:	83 fa 01             	cmp    $0x1,%edx
+80103596:	83 da ff             	sbb    $0xffffffff,%edx
+80103599:	e8 a2 e4 ff ff       	call   80101a40 <balloc>
+8010359e:	89 43 5c             	mov    %eax,0x5c(%ebx)
+      ip->addrs[bn] = addr = iballoc(ip);
+801035a1:	89 43 6c             	mov    %eax,0x6c(%ebx)
+801035a4:	e9 e6 fe ff ff       	jmp    8010348f <dirlink+0x10f>
+  ip->lastblk = balloc(ip->dev, ip->lastblk ? ip->lastblk + 1 : 0);
+801035a9:	8b 53 5c             	mov    0x5c(%ebx),%edx
+801035ac:	8b 03                	mov    (%ebx),%eax
+801035ae:	83 fa 01             	cmp    $0x1,%edx
+801035b1:	83 da ff             	sbb    $0xffffffff,%edx
+801035b4:	e8 87 e4 ff ff       	call   80101a40 <balloc>
+801035b9:	89 43 5c             	mov    %eax,0x5c(%ebx)
+      ip->addrs[bn] = addr = iballoc(ip);
+801035bc:	89 43 70             	mov    %eax,0x70(%ebx)
+801035bf:	e9 af fe ff ff       	jmp    80103473 <dirlink+0xf3>
+    iput(ip);
+801035c4:	83 ec 0c             	sub    $0xc,%esp
+801035c7:	50                   	push   %eax
+801035c8:	e8 c3 f3 ff ff       	call   80102990 <iput>
+    return -1;
+801035cd:	83 c4 10             	add    $0x10,%esp
+801035d0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801035d5:	e9 6c fe ff ff       	jmp    80103446 <dirlink+0xc6>
+      panic("dirlink read");
+801035da:	83 ec 0c             	sub    $0xc,%esp
+801035dd:	68 31 b7 10 80       	push   $0x8010b731
+801035e2:	e8 99 d2 ff ff       	call   80100880 <panic>
+    panic("dirlink");
+801035e7:	83 ec 0c             	sub    $0xc,%esp
+801035ea:	68 3e b7 10 80       	push   $0x8010b73e
+801035ef:	e8 8c d2 ff ff       	call   80100880 <panic>
+801035f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801035fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801035ff:	90                   	nop
+
+80103600 <namei>:
+
+struct inode*
+namei(char *path)
+{
+80103600:	55                   	push   %ebp
+  char name[DIRSIZ];
+  return namex(path, 0, name);
+80103601:	31 d2                	xor    %edx,%edx
+{
+80103603:	89 e5                	mov    %esp,%ebp
+80103605:	83 ec 18             	sub    $0x18,%esp
+  return namex(path, 0, name);
+80103608:	8b 45 08             	mov    0x8(%ebp),%eax
+8010360b:	8d 4d ea             	lea    -0x16(%ebp),%ecx
+8010360e:	e8 fd fa ff ff       	call   80103110 <namex>
+}
+80103613:	c9                   	leave
+80103614:	c3                   	ret
+80103615:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010361c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80103620 <nameiparent>:
+
+struct inode*
+nameiparent(char *path, char *name)
+{
+80103620:	55                   	push   %ebp
+  return namex(path, 1, name);
+80103621:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+80103626:	89 e5                	mov    %esp,%ebp
+  return namex(path, 1, name);
+80103628:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010362b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+8010362e:	5d                   	pop    %ebp
+  return namex(path, 1, name);
+8010362f:	e9 dc fa ff ff       	jmp    80103110 <namex>
+80103634:	66 90                	xchg   %ax,%ax
+80103636:	66 90                	xchg   %ax,%ax
+80103638:	66 90                	xchg   %ax,%ax
+8010363a:	66 90                	xchg   %ax,%ax
+8010363c:	66 90                	xchg   %ax,%ax
+8010363e:	66 90                	xchg   %ax,%ax
+
+80103640 <idestart>:
+// Start the request for b, together with any requests for the
+// blocks right after it that are queued behind it.
+// Caller must hold idelock.
+static void
+idestart(struct buf *b)
+{
+80103640:	55                   	push   %ebp
+80103641:	89 e5                	mov    %esp,%ebp
+80103643:	57                   	push   %edi
+80103644:	56                   	push   %esi
+80103645:	53                   	push   %ebx
+80103646:	83 ec 2c             	sub    $0x2c,%esp
+80103649:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  struct buf *n;
+  int nblk;
+
+  if(b == 0)
+8010364c:	85 c0                	test   %eax,%eax
+8010364e:	0f 84 3a 02 00 00    	je     8010388e <idestart+0x24e>
+    panic("idestart");
+  if(b->blockno >= FSSIZE)
+80103654:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80103657:	8b 40 08             	mov    0x8(%eax),%eax
+8010365a:	3d cf 07 00 00       	cmp    $0x7cf,%eax
+8010365f:	0f 87 1c 02 00 00    	ja     80103881 <idestart+0x241>
+    panic("incorrect blockno");
+  int sector_per_block =  BSIZE/SECTOR_SIZE;
+  int sector = b->blockno * sector_per_block;
+80103665:	c1 e0 03             	shl    $0x3,%eax
+80103668:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  int bmdir = (b->flags & B_DIRTY) ? 0 : BM_CMD_READ;
+8010366b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010366e:	8b 38                	mov    (%eax),%edi
+80103670:	89 7d d0             	mov    %edi,-0x30(%ebp)
+
+  nblk = 1;
+  if(bmbase){
+80103673:	0f b7 3d 00 1f 12 80 	movzwl 0x80121f00,%edi
+8010367a:	66 89 7d d6          	mov    %di,-0x2a(%ebp)
+8010367e:	66 85 ff             	test   %di,%di
+80103681:	0f 84 a9 00 00 00    	je     80103730 <idestart+0xf0>
+    for(n = b; n->qnext && nblk < IDE_MAXBLKS && idemerge(n, n->qnext);
+80103687:	8b 50 5c             	mov    0x5c(%eax),%edx
+8010368a:	85 d2                	test   %edx,%edx
+8010368c:	0f 84 e0 01 00 00    	je     80103872 <idestart+0x232>
+  outb(0x3f6, 0);  // generate interrupt
+  outb(0x1f2, nblk * sector_per_block);  // number of sectors
+  outb(0x1f3, sector & 0xff);
+  outb(0x1f4, (sector >> 8) & 0xff);
+  outb(0x1f5, (sector >> 16) & 0xff);
+  outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+80103692:	8b 48 04             	mov    0x4(%eax),%ecx
+80103695:	89 c6                	mov    %eax,%esi
+  nblk = 1;
+80103697:	b8 01 00 00 00       	mov    $0x1,%eax
+8010369c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return n->dev == b->dev && n->blockno == b->blockno + 1 &&
+801036a0:	89 cb                	mov    %ecx,%ebx
+801036a2:	8b 4a 04             	mov    0x4(%edx),%ecx
+801036a5:	39 d9                	cmp    %ebx,%ecx
+801036a7:	0f 84 43 01 00 00    	je     801037f0 <idestart+0x1b0>
+  outb(0x1f2, nblk * sector_per_block);  // number of sectors
+801036ad:	8d 1c c5 00 00 00 00 	lea    0x0(,%eax,8),%ebx
+  nblk = 1;
+801036b4:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801036b7:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  p = prdt;
+801036ba:	b9 00 1e 12 80       	mov    $0x80121e00,%ecx
+      n = 0x10000 - (addr & 0xffff);
+801036bf:	bf 00 00 01 00       	mov    $0x10000,%edi
+801036c4:	89 45 cc             	mov    %eax,-0x34(%ebp)
+801036c7:	88 5d d5             	mov    %bl,-0x2b(%ebp)
+801036ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    addr = V2P(b->data);
+801036d0:	8b 46 60             	mov    0x60(%esi),%eax
+    for(left = BSIZE; left > 0; left -= n, addr += n){
+801036d3:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+801036d6:	ba 00 10 00 00       	mov    $0x1000,%edx
+    addr = V2P(b->data);
+801036db:	8d 98 00 00 00 80    	lea    -0x80000000(%eax),%ebx
+    for(left = BSIZE; left > 0; left -= n, addr += n){
+801036e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      n = 0x10000 - (addr & 0xffff);
+801036e8:	0f b7 f3             	movzwl %bx,%esi
+801036eb:	89 f8                	mov    %edi,%eax
+      p->addr = addr;
+801036ed:	89 19                	mov    %ebx,(%ecx)
+      n = 0x10000 - (addr & 0xffff);
+801036ef:	29 f0                	sub    %esi,%eax
+801036f1:	39 d0                	cmp    %edx,%eax
+801036f3:	0f 47 c2             	cmova  %edx,%eax
+      p->flags = 0;
+801036f6:	31 f6                	xor    %esi,%esi
+      p++;
+801036f8:	83 c1 08             	add    $0x8,%ecx
+      p->flags = 0;
+801036fb:	66 89 71 fe          	mov    %si,-0x2(%ecx)
+      p->len = n;
+801036ff:	66 89 41 fc          	mov    %ax,-0x4(%ecx)
+    for(left = BSIZE; left > 0; left -= n, addr += n){
+80103703:	01 c3                	add    %eax,%ebx
+80103705:	29 c2                	sub    %eax,%edx
+80103707:	75 df                	jne    801036e8 <idestart+0xa8>
+  for(; nblk > 0; nblk--, b = b->qnext){
+80103709:	83 6d dc 01          	subl   $0x1,-0x24(%ebp)
+8010370d:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80103710:	8b 76 5c             	mov    0x5c(%esi),%esi
+80103713:	75 bb                	jne    801036d0 <idestart+0x90>
+  p[-1].flags = PRD_EOT;
+80103715:	ba 00 80 ff ff       	mov    $0xffff8000,%edx
+8010371a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+8010371d:	0f b6 5d d5          	movzbl -0x2b(%ebp),%ebx
+80103721:	66 89 51 fe          	mov    %dx,-0x2(%ecx)
+}
+80103725:	eb 13                	jmp    8010373a <idestart+0xfa>
+80103727:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010372e:	66 90                	xchg   %ax,%ax
+80103730:	bb 08 00 00 00       	mov    $0x8,%ebx
+  nblk = 1;
+80103735:	b8 01 00 00 00       	mov    $0x1,%eax
+  ideinflight = nblk;
+8010373a:	a3 08 1f 12 80       	mov    %eax,0x80121f08
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010373f:	b9 f7 01 00 00       	mov    $0x1f7,%ecx
+80103744:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103748:	89 ca                	mov    %ecx,%edx
+8010374a:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+8010374b:	83 e0 c0             	and    $0xffffffc0,%eax
+8010374e:	3c 40                	cmp    $0x40,%al
+80103750:	75 f6                	jne    80103748 <idestart+0x108>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103752:	31 f6                	xor    %esi,%esi
+80103754:	ba f6 03 00 00       	mov    $0x3f6,%edx
+80103759:	89 f0                	mov    %esi,%eax
+8010375b:	ee                   	out    %al,(%dx)
+8010375c:	ba f2 01 00 00       	mov    $0x1f2,%edx
+80103761:	89 d8                	mov    %ebx,%eax
+80103763:	ee                   	out    %al,(%dx)
+80103764:	8b 7d d8             	mov    -0x28(%ebp),%edi
+80103767:	ba f3 01 00 00       	mov    $0x1f3,%edx
+8010376c:	89 f8                	mov    %edi,%eax
+8010376e:	ee                   	out    %al,(%dx)
+  outb(0x1f4, (sector >> 8) & 0xff);
+8010376f:	89 f8                	mov    %edi,%eax
+80103771:	ba f4 01 00 00       	mov    $0x1f4,%edx
+80103776:	c1 f8 08             	sar    $0x8,%eax
+80103779:	ee                   	out    %al,(%dx)
+8010377a:	ba f5 01 00 00       	mov    $0x1f5,%edx
+8010377f:	89 f0                	mov    %esi,%eax
+80103781:	ee                   	out    %al,(%dx)
+  outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
+80103782:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80103785:	ba f6 01 00 00       	mov    $0x1f6,%edx
+8010378a:	8b 40 04             	mov    0x4(%eax),%eax
+8010378d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80103790:	0f b6 45 e4          	movzbl -0x1c(%ebp),%eax
+80103794:	c1 e0 04             	shl    $0x4,%eax
+80103797:	83 e0 10             	and    $0x10,%eax
+8010379a:	83 c8 e0             	or     $0xffffffe0,%eax
+8010379d:	ee                   	out    %al,(%dx)
+  if(bmbase){
+8010379e:	0f b7 7d d6          	movzwl -0x2a(%ebp),%edi
+801037a2:	89 fa                	mov    %edi,%edx
+801037a4:	66 85 ff             	test   %di,%di
+801037a7:	0f 84 83 00 00 00    	je     80103830 <idestart+0x1f0>
+  int bmdir = (b->flags & B_DIRTY) ? 0 : BM_CMD_READ;
+801037ad:	31 c9                	xor    %ecx,%ecx
+801037af:	f6 45 d0 04          	testb  $0x4,-0x30(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801037b3:	b8 00 1e 12 00       	mov    $0x121e00,%eax
+801037b8:	0f 94 c1             	sete   %cl
+    outl(bmbase + BM_PRDT, V2P(prdt));
+801037bb:	83 c2 04             	add    $0x4,%edx
+  int bmdir = (b->flags & B_DIRTY) ? 0 : BM_CMD_READ;
+801037be:	c1 e1 03             	shl    $0x3,%ecx
+801037c1:	ef                   	out    %eax,(%dx)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801037c2:	89 c8                	mov    %ecx,%eax
+801037c4:	89 fa                	mov    %edi,%edx
+801037c6:	ee                   	out    %al,(%dx)
+    outb(bmbase + BM_CMD, bmdir);
+    outb(bmbase + BM_STATUS, inb(bmbase + BM_STATUS) | BM_ST_INT | BM_ST_ERR);
+801037c7:	83 c2 02             	add    $0x2,%edx
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801037ca:	ec                   	in     (%dx),%al
+801037cb:	83 c8 06             	or     $0x6,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801037ce:	ee                   	out    %al,(%dx)
+    outb(0x1f7, bmdir ? IDE_CMD_RDDMA : IDE_CMD_WRDMA);
+801037cf:	83 f9 01             	cmp    $0x1,%ecx
+801037d2:	ba f7 01 00 00       	mov    $0x1f7,%edx
+801037d7:	19 c0                	sbb    %eax,%eax
+801037d9:	83 e0 02             	and    $0x2,%eax
+801037dc:	83 e8 38             	sub    $0x38,%eax
+801037df:	ee                   	out    %al,(%dx)
+    outb(bmbase + BM_CMD, bmdir | BM_CMD_START);
+801037e0:	89 c8                	mov    %ecx,%eax
+801037e2:	89 fa                	mov    %edi,%edx
+801037e4:	83 c8 01             	or     $0x1,%eax
+801037e7:	ee                   	out    %al,(%dx)
+    outb(0x1f7, write_cmd);
+    outsl(0x1f0, b->data, BSIZE/4);
+  } else {
+    outb(0x1f7, read_cmd);
+  }
+}
+801037e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801037eb:	5b                   	pop    %ebx
+801037ec:	5e                   	pop    %esi
+801037ed:	5f                   	pop    %edi
+801037ee:	5d                   	pop    %ebp
+801037ef:	c3                   	ret
+  return n->dev == b->dev && n->blockno == b->blockno + 1 &&
+801037f0:	8b 7e 08             	mov    0x8(%esi),%edi
+801037f3:	8d 5f 01             	lea    0x1(%edi),%ebx
+801037f6:	39 5a 08             	cmp    %ebx,0x8(%edx)
+801037f9:	0f 85 ae fe ff ff    	jne    801036ad <idestart+0x6d>
+         (n->flags & B_DIRTY) == (b->flags & B_DIRTY);
+801037ff:	8b 1a                	mov    (%edx),%ebx
+80103801:	33 1e                	xor    (%esi),%ebx
+  return n->dev == b->dev && n->blockno == b->blockno + 1 &&
+80103803:	83 e3 04             	and    $0x4,%ebx
+80103806:	0f 85 a1 fe ff ff    	jne    801036ad <idestart+0x6d>
+    for(n = b; n->qnext && nblk < IDE_MAXBLKS && idemerge(n, n->qnext);
+8010380c:	8b 5a 5c             	mov    0x5c(%edx),%ebx
+      nblk++;
+8010380f:	83 c0 01             	add    $0x1,%eax
+    for(n = b; n->qnext && nblk < IDE_MAXBLKS && idemerge(n, n->qnext);
+80103812:	85 db                	test   %ebx,%ebx
+80103814:	0f 84 93 fe ff ff    	je     801036ad <idestart+0x6d>
+8010381a:	89 d6                	mov    %edx,%esi
+8010381c:	83 f8 10             	cmp    $0x10,%eax
+8010381f:	74 47                	je     80103868 <idestart+0x228>
+80103821:	89 da                	mov    %ebx,%edx
+80103823:	e9 78 fe ff ff       	jmp    801036a0 <idestart+0x60>
+80103828:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010382f:	90                   	nop
+  } else if(b->flags & B_DIRTY){
+80103830:	8b 7d e0             	mov    -0x20(%ebp),%edi
+80103833:	f6 07 04             	testb  $0x4,(%edi)
+80103836:	74 20                	je     80103858 <idestart+0x218>
+80103838:	b8 c5 ff ff ff       	mov    $0xffffffc5,%eax
+8010383d:	89 ca                	mov    %ecx,%edx
+8010383f:	ee                   	out    %al,(%dx)
+  asm volatile("cld; rep outsl" :
+80103840:	b9 00 04 00 00       	mov    $0x400,%ecx
+80103845:	8b 77 60             	mov    0x60(%edi),%esi
+80103848:	ba f0 01 00 00       	mov    $0x1f0,%edx
+8010384d:	fc                   	cld
+8010384e:	f3 6f                	rep outsl %ds:(%esi),(%dx)
+}
+80103850:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103853:	5b                   	pop    %ebx
+80103854:	5e                   	pop    %esi
+80103855:	5f                   	pop    %edi
+80103856:	5d                   	pop    %ebp
+80103857:	c3                   	ret
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103858:	b8 c4 ff ff ff       	mov    $0xffffffc4,%eax
+8010385d:	89 ca                	mov    %ecx,%edx
+8010385f:	ee                   	out    %al,(%dx)
+80103860:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103863:	5b                   	pop    %ebx
+80103864:	5e                   	pop    %esi
+80103865:	5f                   	pop    %edi
+80103866:	5d                   	pop    %ebp
+80103867:	c3                   	ret
+80103868:	bb 80 ff ff ff       	mov    $0xffffff80,%ebx
+  for(; nblk > 0; nblk--, b = b->qnext){
+8010386d:	e9 42 fe ff ff       	jmp    801036b4 <idestart+0x74>
+    for(n = b; n->qnext && nblk < IDE_MAXBLKS && idemerge(n, n->qnext);
+80103872:	bb 08 00 00 00       	mov    $0x8,%ebx
+  nblk = 1;
+80103877:	b8 01 00 00 00       	mov    $0x1,%eax
+8010387c:	e9 33 fe ff ff       	jmp    801036b4 <idestart+0x74>
+    panic("incorrect blockno");
+80103881:	83 ec 0c             	sub    $0xc,%esp
+80103884:	68 a4 b7 10 80       	push   $0x8010b7a4
+80103889:	e8 f2 cf ff ff       	call   80100880 <panic>
+    panic("idestart");
+8010388e:	83 ec 0c             	sub    $0xc,%esp
+80103891:	68 9b b7 10 80       	push   $0x8010b79b
+80103896:	e8 e5 cf ff ff       	call   80100880 <panic>
+8010389b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010389f:	90                   	nop
+
+801038a0 <ideenqueue>:
+// Comparing block numbers relative to pos, as unsigned,
+// gives exactly that order.
+// Caller must hold idelock.
+static void
+ideenqueue(struct buf *b)
+{
+801038a0:	55                   	push   %ebp
+801038a1:	89 e5                	mov    %esp,%ebp
+801038a3:	57                   	push   %edi
+801038a4:	56                   	push   %esi
+801038a5:	53                   	push   %ebx
+801038a6:	89 c3                	mov    %eax,%ebx
+  struct buf **pp;
+  uint pos;
+  int i;
+
+  if(!holdingsleep(&b->lock))
+801038a8:	83 c0 0c             	add    $0xc,%eax
+{
+801038ab:	83 ec 18             	sub    $0x18,%esp
+  if(!holdingsleep(&b->lock))
+801038ae:	50                   	push   %eax
+801038af:	e8 3c 42 00 00       	call   80107af0 <holdingsleep>
+801038b4:	83 c4 10             	add    $0x10,%esp
+801038b7:	85 c0                	test   %eax,%eax
+801038b9:	0f 84 94 00 00 00    	je     80103953 <ideenqueue+0xb3>
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+801038bf:	8b 03                	mov    (%ebx),%eax
+801038c1:	83 e0 06             	and    $0x6,%eax
+801038c4:	83 f8 02             	cmp    $0x2,%eax
+801038c7:	74 7d                	je     80103946 <ideenqueue+0xa6>
+    panic("iderw: nothing to do");
+  if(b->dev != 0 && !havedisk1)
+801038c9:	8b 53 04             	mov    0x4(%ebx),%edx
+801038cc:	85 d2                	test   %edx,%edx
+801038ce:	75 60                	jne    80103930 <ideenqueue+0x90>
+    panic("iderw: ide disk 1 not present");
+
+  pp = &idequeue;
+  for(i = 0; i < ideinflight; i++)
+801038d0:	8b 0d 08 1f 12 80    	mov    0x80121f08,%ecx
+801038d6:	31 c0                	xor    %eax,%eax
+801038d8:	ba 0c 1f 12 80       	mov    $0x80121f0c,%edx
+801038dd:	85 c9                	test   %ecx,%ecx
+801038df:	7e 13                	jle    801038f4 <ideenqueue+0x54>
+801038e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    pp = &(*pp)->qnext;
+801038e8:	8b 12                	mov    (%edx),%edx
+  for(i = 0; i < ideinflight; i++)
+801038ea:	83 c0 01             	add    $0x1,%eax
+    pp = &(*pp)->qnext;
+801038ed:	83 c2 5c             	add    $0x5c,%edx
+  for(i = 0; i < ideinflight; i++)
+801038f0:	39 c1                	cmp    %eax,%ecx
+801038f2:	75 f4                	jne    801038e8 <ideenqueue+0x48>
+  pos = idequeue ? idequeue->blockno : 0;
+801038f4:	a1 0c 1f 12 80       	mov    0x80121f0c,%eax
+801038f9:	31 ff                	xor    %edi,%edi
+801038fb:	85 c0                	test   %eax,%eax
+801038fd:	74 03                	je     80103902 <ideenqueue+0x62>
+801038ff:	8b 78 08             	mov    0x8(%eax),%edi
+  for(; *pp && (*pp)->blockno - pos <= b->blockno - pos; pp = &(*pp)->qnext)  //DOC:insert-queue
+80103902:	8b 02                	mov    (%edx),%eax
+80103904:	85 c0                	test   %eax,%eax
+80103906:	74 1b                	je     80103923 <ideenqueue+0x83>
+80103908:	8b 73 08             	mov    0x8(%ebx),%esi
+8010390b:	29 fe                	sub    %edi,%esi
+8010390d:	eb 0b                	jmp    8010391a <ideenqueue+0x7a>
+8010390f:	90                   	nop
+80103910:	8d 50 5c             	lea    0x5c(%eax),%edx
+80103913:	8b 40 5c             	mov    0x5c(%eax),%eax
+80103916:	85 c0                	test   %eax,%eax
+80103918:	74 09                	je     80103923 <ideenqueue+0x83>
+8010391a:	8b 48 08             	mov    0x8(%eax),%ecx
+8010391d:	29 f9                	sub    %edi,%ecx
+8010391f:	39 ce                	cmp    %ecx,%esi
+80103921:	73 ed                	jae    80103910 <ideenqueue+0x70>
+    ;
+  b->qnext = *pp;
+80103923:	89 43 5c             	mov    %eax,0x5c(%ebx)
+  *pp = b;
+80103926:	89 1a                	mov    %ebx,(%edx)
+}
+80103928:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010392b:	5b                   	pop    %ebx
+8010392c:	5e                   	pop    %esi
+8010392d:	5f                   	pop    %edi
+8010392e:	5d                   	pop    %ebp
+8010392f:	c3                   	ret
+  if(b->dev != 0 && !havedisk1)
+80103930:	a1 04 1f 12 80       	mov    0x80121f04,%eax
+80103935:	85 c0                	test   %eax,%eax
+80103937:	75 97                	jne    801038d0 <ideenqueue+0x30>
+    panic("iderw: ide disk 1 not present");
+80103939:	83 ec 0c             	sub    $0xc,%esp
+8010393c:	68 e1 b7 10 80       	push   $0x8010b7e1
+80103941:	e8 3a cf ff ff       	call   80100880 <panic>
+    panic("iderw: nothing to do");
+80103946:	83 ec 0c             	sub    $0xc,%esp
+80103949:	68 cc b7 10 80       	push   $0x8010b7cc
+8010394e:	e8 2d cf ff ff       	call   80100880 <panic>
+    panic("iderw: buf not locked");
+80103953:	83 ec 0c             	sub    $0xc,%esp
+80103956:	68 b6 b7 10 80       	push   $0x8010b7b6
+8010395b:	e8 20 cf ff ff       	call   80100880 <panic>
+
+80103960 <ideinit>:
+{
+80103960:	55                   	push   %ebp
+80103961:	89 e5                	mov    %esp,%ebp
+80103963:	57                   	push   %edi
+80103964:	56                   	push   %esi
+80103965:	53                   	push   %ebx
+80103966:	83 ec 24             	sub    $0x24,%esp
+  initlock(&idelock, "ide");
+80103969:	68 ff b7 10 80       	push   $0x8010b7ff
+8010396e:	68 20 1f 12 80       	push   $0x80121f20
+80103973:	e8 c8 41 00 00       	call   80107b40 <initlock>
+  ioapicenable(IRQ_IDE, ncpu - 1);
+80103978:	58                   	pop    %eax
+80103979:	a1 a4 e1 13 80       	mov    0x8013e1a4,%eax
+8010397e:	5a                   	pop    %edx
+8010397f:	83 e8 01             	sub    $0x1,%eax
+80103982:	50                   	push   %eax
+80103983:	6a 0e                	push   $0xe
+80103985:	e8 56 05 00 00       	call   80103ee0 <ioapicenable>
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+8010398a:	83 c4 10             	add    $0x10,%esp
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010398d:	b9 f7 01 00 00       	mov    $0x1f7,%ecx
+80103992:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80103998:	89 ca                	mov    %ecx,%edx
+8010399a:	ec                   	in     (%dx),%al
+8010399b:	83 e0 c0             	and    $0xffffffc0,%eax
+8010399e:	3c 40                	cmp    $0x40,%al
+801039a0:	75 f6                	jne    80103998 <ideinit+0x38>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801039a2:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+801039a7:	ba f6 01 00 00       	mov    $0x1f6,%edx
+801039ac:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801039ad:	89 ca                	mov    %ecx,%edx
+801039af:	ec                   	in     (%dx),%al
+    if(inb(0x1f7) != 0){
+801039b0:	84 c0                	test   %al,%al
+801039b2:	75 1a                	jne    801039ce <ideinit+0x6e>
+801039b4:	b9 e8 03 00 00       	mov    $0x3e8,%ecx
+801039b9:	ba f7 01 00 00       	mov    $0x1f7,%edx
+801039be:	66 90                	xchg   %ax,%ax
+  for(i=0; i<1000; i++){
+801039c0:	83 e9 01             	sub    $0x1,%ecx
+801039c3:	0f 84 20 01 00 00    	je     80103ae9 <ideinit+0x189>
+801039c9:	ec                   	in     (%dx),%al
+    if(inb(0x1f7) != 0){
+801039ca:	84 c0                	test   %al,%al
+801039cc:	74 f2                	je     801039c0 <ideinit+0x60>
+      havedisk1 = 1;
+801039ce:	c7 05 04 1f 12 80 01 	movl   $0x1,0x80121f04
+801039d5:	00 00 00 
+801039d8:	be 01 00 00 00       	mov    $0x1,%esi
+801039dd:	31 db                	xor    %ebx,%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801039df:	bf f6 01 00 00       	mov    $0x1f6,%edi
+801039e4:	b9 f7 01 00 00       	mov    $0x1f7,%ecx
+801039e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801039f0:	89 d8                	mov    %ebx,%eax
+801039f2:	89 fa                	mov    %edi,%edx
+801039f4:	c1 e0 04             	shl    $0x4,%eax
+801039f7:	83 c8 e0             	or     $0xffffffe0,%eax
+801039fa:	ee                   	out    %al,(%dx)
+801039fb:	b8 08 00 00 00       	mov    $0x8,%eax
+80103a00:	ba f2 01 00 00       	mov    $0x1f2,%edx
+80103a05:	ee                   	out    %al,(%dx)
+80103a06:	b8 c6 ff ff ff       	mov    $0xffffffc6,%eax
+80103a0b:	89 ca                	mov    %ecx,%edx
+80103a0d:	ee                   	out    %al,(%dx)
+80103a0e:	66 90                	xchg   %ax,%ax
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103a10:	89 ca                	mov    %ecx,%edx
+80103a12:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80103a13:	83 e0 c0             	and    $0xffffffc0,%eax
+80103a16:	3c 40                	cmp    $0x40,%al
+80103a18:	75 f6                	jne    80103a10 <ideinit+0xb0>
+    for(i = 0; i <= havedisk1; i++){
+80103a1a:	83 c3 01             	add    $0x1,%ebx
+80103a1d:	39 f3                	cmp    %esi,%ebx
+80103a1f:	7e cf                	jle    801039f0 <ideinit+0x90>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103a21:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+80103a26:	ba f6 01 00 00       	mov    $0x1f6,%edx
+80103a2b:	ee                   	out    %al,(%dx)
+80103a2c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103a33:	bf f8 0c 00 00       	mov    $0xcf8,%edi
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103a38:	be fc 0c 00 00       	mov    $0xcfc,%esi
+      havedisk1 = 1;
+80103a3d:	31 db                	xor    %ebx,%ebx
+  outl(PCI_CONFIG_ADDR, 0x80000000 | dev<<11 | func<<8 | (off & 0xfc));
+80103a3f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103a42:	89 fa                	mov    %edi,%edx
+80103a44:	09 d9                	or     %ebx,%ecx
+80103a46:	89 c8                	mov    %ecx,%eax
+80103a48:	0d 00 00 00 80       	or     $0x80000000,%eax
+80103a4d:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103a4e:	89 f2                	mov    %esi,%edx
+80103a50:	ed                   	in     (%dx),%eax
+      if((pciread(dev, func, 0) & 0xffff) == 0xffff)
+80103a51:	0f b7 c0             	movzwl %ax,%eax
+80103a54:	3d ff ff 00 00       	cmp    $0xffff,%eax
+80103a59:	74 65                	je     80103ac0 <ideinit+0x160>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103a5b:	89 c8                	mov    %ecx,%eax
+80103a5d:	89 fa                	mov    %edi,%edx
+80103a5f:	0d 08 00 00 80       	or     $0x80000008,%eax
+80103a64:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103a65:	89 f2                	mov    %esi,%edx
+80103a67:	ed                   	in     (%dx),%eax
+      if((pciread(dev, func, PCI_CLASS) >> 16) != 0x0101)
+80103a68:	c1 e8 10             	shr    $0x10,%eax
+80103a6b:	3d 01 01 00 00       	cmp    $0x101,%eax
+80103a70:	75 4e                	jne    80103ac0 <ideinit+0x160>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103a72:	89 c8                	mov    %ecx,%eax
+80103a74:	89 fa                	mov    %edi,%edx
+80103a76:	0d 20 00 00 80       	or     $0x80000020,%eax
+80103a7b:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103a7c:	89 f2                	mov    %esi,%edx
+80103a7e:	ed                   	in     (%dx),%eax
+      if((bar & 1) == 0 || (bar & 0xfffc) == 0)
+80103a7f:	a8 01                	test   $0x1,%al
+80103a81:	74 3d                	je     80103ac0 <ideinit+0x160>
+80103a83:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80103a86:	a9 fc ff 00 00       	test   $0xfffc,%eax
+80103a8b:	74 33                	je     80103ac0 <ideinit+0x160>
+  outl(PCI_CONFIG_ADDR, 0x80000000 | dev<<11 | func<<8 | (off & 0xfc));
+80103a8d:	81 c9 04 00 00 80    	or     $0x80000004,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103a93:	89 fa                	mov    %edi,%edx
+80103a95:	89 c8                	mov    %ecx,%eax
+80103a97:	ef                   	out    %eax,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103a98:	89 f2                	mov    %esi,%edx
+80103a9a:	ed                   	in     (%dx),%eax
+80103a9b:	89 c3                	mov    %eax,%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103a9d:	89 fa                	mov    %edi,%edx
+80103a9f:	89 c8                	mov    %ecx,%eax
+80103aa1:	ef                   	out    %eax,(%dx)
+      pciwrite(dev, func, PCI_COMMAND, pciread(dev, func, PCI_COMMAND) |
+80103aa2:	83 cb 05             	or     $0x5,%ebx
+80103aa5:	89 f2                	mov    %esi,%edx
+80103aa7:	89 d8                	mov    %ebx,%eax
+80103aa9:	ef                   	out    %eax,(%dx)
+      bmbase = bar & 0xfffc;
+80103aaa:	0f b7 45 e0          	movzwl -0x20(%ebp),%eax
+80103aae:	83 e0 fc             	and    $0xfffffffc,%eax
+80103ab1:	66 a3 00 1f 12 80    	mov    %ax,0x80121f00
+}
+80103ab7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103aba:	5b                   	pop    %ebx
+80103abb:	5e                   	pop    %esi
+80103abc:	5f                   	pop    %edi
+80103abd:	5d                   	pop    %ebp
+80103abe:	c3                   	ret
+80103abf:	90                   	nop
+    for(func = 0; func < 8; func++){
+80103ac0:	81 c3 00 01 00 00    	add    $0x100,%ebx
+80103ac6:	81 fb 00 08 00 00    	cmp    $0x800,%ebx
+80103acc:	0f 85 6d ff ff ff    	jne    80103a3f <ideinit+0xdf>
+  for(dev = 0; dev < 32; dev++){
+80103ad2:	81 45 e4 00 08 00 00 	addl   $0x800,-0x1c(%ebp)
+80103ad9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80103adc:	3d 00 00 01 00       	cmp    $0x10000,%eax
+80103ae1:	0f 85 56 ff ff ff    	jne    80103a3d <ideinit+0xdd>
+80103ae7:	eb ce                	jmp    80103ab7 <ideinit+0x157>
+    for(i = 0; i <= havedisk1; i++){
+80103ae9:	8b 35 04 1f 12 80    	mov    0x80121f04,%esi
+80103aef:	85 f6                	test   %esi,%esi
+80103af1:	0f 89 e6 fe ff ff    	jns    801039dd <ideinit+0x7d>
+80103af7:	e9 25 ff ff ff       	jmp    80103a21 <ideinit+0xc1>
+80103afc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80103b00 <ideintr>:
+{
+80103b00:	55                   	push   %ebp
+80103b01:	89 e5                	mov    %esp,%ebp
+80103b03:	57                   	push   %edi
+80103b04:	56                   	push   %esi
+80103b05:	53                   	push   %ebx
+80103b06:	83 ec 18             	sub    $0x18,%esp
+  acquire(&idelock);
+80103b09:	68 20 1f 12 80       	push   $0x80121f20
+80103b0e:	e8 0d 42 00 00       	call   80107d20 <acquire>
+  if((b = idequeue) == 0){
+80103b13:	8b 0d 0c 1f 12 80    	mov    0x80121f0c,%ecx
+80103b19:	83 c4 10             	add    $0x10,%esp
+80103b1c:	85 c9                	test   %ecx,%ecx
+80103b1e:	0f 84 0e 01 00 00    	je     80103c32 <ideintr+0x132>
+  if(bmbase){
+80103b24:	0f b7 1d 00 1f 12 80 	movzwl 0x80121f00,%ebx
+80103b2b:	66 85 db             	test   %bx,%bx
+80103b2e:	0f 84 ac 00 00 00    	je     80103be0 <ideintr+0xe0>
+    st = inb(bmbase + BM_STATUS);
+80103b34:	8d 7b 02             	lea    0x2(%ebx),%edi
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103b37:	89 fa                	mov    %edi,%edx
+80103b39:	ec                   	in     (%dx),%al
+80103b3a:	89 c6                	mov    %eax,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103b3c:	89 da                	mov    %ebx,%edx
+80103b3e:	31 c0                	xor    %eax,%eax
+80103b40:	ee                   	out    %al,(%dx)
+80103b41:	89 f0                	mov    %esi,%eax
+80103b43:	89 fa                	mov    %edi,%edx
+80103b45:	83 c8 06             	or     $0x6,%eax
+80103b48:	ee                   	out    %al,(%dx)
+    if((st & BM_ST_ERR) || idewait(1) < 0)
+80103b49:	83 e6 02             	and    $0x2,%esi
+80103b4c:	0f 85 3b 01 00 00    	jne    80103c8d <ideintr+0x18d>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103b52:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80103b57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103b5e:	66 90                	xchg   %ax,%ax
+80103b60:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80103b61:	89 c3                	mov    %eax,%ebx
+80103b63:	83 e3 c0             	and    $0xffffffc0,%ebx
+80103b66:	80 fb 40             	cmp    $0x40,%bl
+80103b69:	75 f5                	jne    80103b60 <ideintr+0x60>
+  if(checkerr && (r & (IDE_DF|IDE_ERR)) != 0)
+80103b6b:	a8 21                	test   $0x21,%al
+80103b6d:	0f 85 1a 01 00 00    	jne    80103c8d <ideintr+0x18d>
+  for(; ideinflight > 0; ideinflight--){
+80103b73:	a1 08 1f 12 80       	mov    0x80121f08,%eax
+80103b78:	85 c0                	test   %eax,%eax
+80103b7a:	0f 8e ab 00 00 00    	jle    80103c2b <ideintr+0x12b>
+{
+80103b80:	31 db                	xor    %ebx,%ebx
+80103b82:	eb 2c                	jmp    80103bb0 <ideintr+0xb0>
+80103b84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      b->flags &= ~B_ASYNC;
+80103b88:	83 e0 f3             	and    $0xfffffff3,%eax
+      b->qnext = done;
+80103b8b:	89 59 5c             	mov    %ebx,0x5c(%ecx)
+80103b8e:	89 cb                	mov    %ecx,%ebx
+      b->flags &= ~B_ASYNC;
+80103b90:	83 c8 02             	or     $0x2,%eax
+80103b93:	89 01                	mov    %eax,(%ecx)
+  for(; ideinflight > 0; ideinflight--){
+80103b95:	a1 08 1f 12 80       	mov    0x80121f08,%eax
+  if(idequeue != 0)
+80103b9a:	8b 0d 0c 1f 12 80    	mov    0x80121f0c,%ecx
+  for(; ideinflight > 0; ideinflight--){
+80103ba0:	83 e8 01             	sub    $0x1,%eax
+80103ba3:	a3 08 1f 12 80       	mov    %eax,0x80121f08
+80103ba8:	85 c0                	test   %eax,%eax
+80103baa:	0f 8e a0 00 00 00    	jle    80103c50 <ideintr+0x150>
+    idequeue = b->qnext;
+80103bb0:	8b 41 5c             	mov    0x5c(%ecx),%eax
+80103bb3:	a3 0c 1f 12 80       	mov    %eax,0x80121f0c
+    b->flags |= B_VALID;
+80103bb8:	8b 01                	mov    (%ecx),%eax
+    b->flags &= ~B_DIRTY;
+80103bba:	89 c2                	mov    %eax,%edx
+80103bbc:	83 e2 fb             	and    $0xfffffffb,%edx
+80103bbf:	83 ca 02             	or     $0x2,%edx
+80103bc2:	89 11                	mov    %edx,(%ecx)
+    if(b->flags & B_ASYNC){
+80103bc4:	a8 08                	test   $0x8,%al
+80103bc6:	75 c0                	jne    80103b88 <ideintr+0x88>
+      wakeup(b);
+80103bc8:	83 ec 0c             	sub    $0xc,%esp
+80103bcb:	51                   	push   %ecx
+80103bcc:	e8 1f 39 00 00       	call   801074f0 <wakeup>
+80103bd1:	83 c4 10             	add    $0x10,%esp
+80103bd4:	eb bf                	jmp    80103b95 <ideintr+0x95>
+80103bd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103bdd:	8d 76 00             	lea    0x0(%esi),%esi
+  } else if(!(b->flags & B_DIRTY) && idewait(1) >= 0){
+80103be0:	f6 01 04             	testb  $0x4,(%ecx)
+80103be3:	75 8e                	jne    80103b73 <ideintr+0x73>
+80103be5:	ba f7 01 00 00       	mov    $0x1f7,%edx
+80103bea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80103bf0:	ec                   	in     (%dx),%al
+  while(((r = inb(0x1f7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+80103bf1:	89 c3                	mov    %eax,%ebx
+80103bf3:	83 e3 c0             	and    $0xffffffc0,%ebx
+80103bf6:	80 fb 40             	cmp    $0x40,%bl
+80103bf9:	75 f5                	jne    80103bf0 <ideintr+0xf0>
+  if(checkerr && (r & (IDE_DF|IDE_ERR)) != 0)
+80103bfb:	a8 21                	test   $0x21,%al
+80103bfd:	0f 85 70 ff ff ff    	jne    80103b73 <ideintr+0x73>
+  asm volatile("cld; rep insl" :
+80103c03:	8b 79 60             	mov    0x60(%ecx),%edi
+80103c06:	ba f0 01 00 00       	mov    $0x1f0,%edx
+80103c0b:	b9 00 04 00 00       	mov    $0x400,%ecx
+80103c10:	fc                   	cld
+80103c11:	f3 6d                	rep insl (%dx),%es:(%edi)
+  for(; ideinflight > 0; ideinflight--){
+80103c13:	8b 15 08 1f 12 80    	mov    0x80121f08,%edx
+  if(idequeue != 0)
+80103c19:	8b 0d 0c 1f 12 80    	mov    0x80121f0c,%ecx
+  for(; ideinflight > 0; ideinflight--){
+80103c1f:	85 d2                	test   %edx,%edx
+80103c21:	0f 8f 59 ff ff ff    	jg     80103b80 <ideintr+0x80>
+  if(idequeue != 0)
+80103c27:	85 c9                	test   %ecx,%ecx
+80103c29:	74 07                	je     80103c32 <ideintr+0x132>
+    idestart(idequeue);
+80103c2b:	89 c8                	mov    %ecx,%eax
+80103c2d:	e8 0e fa ff ff       	call   80103640 <idestart>
+  release(&idelock);
+80103c32:	83 ec 0c             	sub    $0xc,%esp
+80103c35:	68 20 1f 12 80       	push   $0x80121f20
+80103c3a:	e8 81 40 00 00       	call   80107cc0 <release>
+80103c3f:	83 c4 10             	add    $0x10,%esp
+}
+80103c42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103c45:	5b                   	pop    %ebx
+80103c46:	5e                   	pop    %esi
+80103c47:	5f                   	pop    %edi
+80103c48:	5d                   	pop    %ebp
+80103c49:	c3                   	ret
+80103c4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(idequeue != 0)
+80103c50:	85 c9                	test   %ecx,%ecx
+80103c52:	74 07                	je     80103c5b <ideintr+0x15b>
+    idestart(idequeue);
+80103c54:	89 c8                	mov    %ecx,%eax
+80103c56:	e8 e5 f9 ff ff       	call   80103640 <idestart>
+  release(&idelock);
+80103c5b:	83 ec 0c             	sub    $0xc,%esp
+80103c5e:	68 20 1f 12 80       	push   $0x80121f20
+80103c63:	e8 58 40 00 00       	call   80107cc0 <release>
+  while((b = done) != 0){
+80103c68:	83 c4 10             	add    $0x10,%esp
+80103c6b:	85 db                	test   %ebx,%ebx
+80103c6d:	74 d3                	je     80103c42 <ideintr+0x142>
+80103c6f:	90                   	nop
+    done = b->qnext;
+80103c70:	89 d8                	mov    %ebx,%eax
+    bdone(b);
+80103c72:	83 ec 0c             	sub    $0xc,%esp
+    done = b->qnext;
+80103c75:	8b 5b 5c             	mov    0x5c(%ebx),%ebx
+    bdone(b);
+80103c78:	50                   	push   %eax
+80103c79:	e8 72 ca ff ff       	call   801006f0 <bdone>
+  while((b = done) != 0){
+80103c7e:	83 c4 10             	add    $0x10,%esp
+80103c81:	85 db                	test   %ebx,%ebx
+80103c83:	75 eb                	jne    80103c70 <ideintr+0x170>
+}
+80103c85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103c88:	5b                   	pop    %ebx
+80103c89:	5e                   	pop    %esi
+80103c8a:	5f                   	pop    %edi
+80103c8b:	5d                   	pop    %ebp
+80103c8c:	c3                   	ret
+      panic("ideintr: dma error");
+80103c8d:	83 ec 0c             	sub    $0xc,%esp
+80103c90:	68 03 b8 10 80       	push   $0x8010b803
+80103c95:	e8 e6 cb ff ff       	call   80100880 <panic>
+80103c9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80103ca0 <iderw>:
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+80103ca0:	55                   	push   %ebp
+80103ca1:	89 e5                	mov    %esp,%ebp
+80103ca3:	53                   	push   %ebx
+80103ca4:	83 ec 10             	sub    $0x10,%esp
+80103ca7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&idelock);  //DOC:acquire-lock
+80103caa:	68 20 1f 12 80       	push   $0x80121f20
+80103caf:	e8 6c 40 00 00       	call   80107d20 <acquire>
+
+  ideenqueue(b);
+80103cb4:	89 d8                	mov    %ebx,%eax
+80103cb6:	e8 e5 fb ff ff       	call   801038a0 <ideenqueue>
+
+  // Start disk if necessary.
+  if(ideinflight == 0)
+80103cbb:	a1 08 1f 12 80       	mov    0x80121f08,%eax
+80103cc0:	83 c4 10             	add    $0x10,%esp
+80103cc3:	85 c0                	test   %eax,%eax
+80103cc5:	74 41                	je     80103d08 <iderw+0x68>
+    idestart(idequeue);
+
+  // Wait for request to finish.
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+80103cc7:	8b 03                	mov    (%ebx),%eax
+80103cc9:	83 e0 06             	and    $0x6,%eax
+80103ccc:	83 f8 02             	cmp    $0x2,%eax
+80103ccf:	74 22                	je     80103cf3 <iderw+0x53>
+80103cd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    sleep(b, &idelock);
+80103cd8:	83 ec 08             	sub    $0x8,%esp
+80103cdb:	68 20 1f 12 80       	push   $0x80121f20
+80103ce0:	53                   	push   %ebx
+80103ce1:	e8 da 34 00 00       	call   801071c0 <sleep>
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+80103ce6:	8b 03                	mov    (%ebx),%eax
+80103ce8:	83 c4 10             	add    $0x10,%esp
+80103ceb:	83 e0 06             	and    $0x6,%eax
+80103cee:	83 f8 02             	cmp    $0x2,%eax
+80103cf1:	75 e5                	jne    80103cd8 <iderw+0x38>
+  }
+
+  release(&idelock);
+80103cf3:	c7 45 08 20 1f 12 80 	movl   $0x80121f20,0x8(%ebp)
+}
+80103cfa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103cfd:	c9                   	leave
+  release(&idelock);
+80103cfe:	e9 bd 3f 00 00       	jmp    80107cc0 <release>
+80103d03:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103d07:	90                   	nop
+    idestart(idequeue);
+80103d08:	a1 0c 1f 12 80       	mov    0x80121f0c,%eax
+80103d0d:	e8 2e f9 ff ff       	call   80103640 <idestart>
+80103d12:	eb b3                	jmp    80103cc7 <iderw+0x27>
+80103d14:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103d1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103d1f:	90                   	nop
+
+80103d20 <iderwasync>:
+
+// Queue a B_ASYNC read of b and return without waiting.
+// ideintr() hands b to bdone() when the read completes.
+void
+iderwasync(struct buf *b)
+{
+80103d20:	55                   	push   %ebp
+80103d21:	89 e5                	mov    %esp,%ebp
+80103d23:	53                   	push   %ebx
+80103d24:	83 ec 10             	sub    $0x10,%esp
+80103d27:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&idelock);
+80103d2a:	68 20 1f 12 80       	push   $0x80121f20
+80103d2f:	e8 ec 3f 00 00       	call   80107d20 <acquire>
+  ideenqueue(b);
+80103d34:	89 d8                	mov    %ebx,%eax
+80103d36:	e8 65 fb ff ff       	call   801038a0 <ideenqueue>
+  if(ideinflight == 0)
+80103d3b:	a1 08 1f 12 80       	mov    0x80121f08,%eax
+80103d40:	83 c4 10             	add    $0x10,%esp
+80103d43:	85 c0                	test   %eax,%eax
+80103d45:	74 19                	je     80103d60 <iderwasync+0x40>
+    idestart(idequeue);
+  release(&idelock);
+80103d47:	c7 45 08 20 1f 12 80 	movl   $0x80121f20,0x8(%ebp)
+}
+80103d4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103d51:	c9                   	leave
+  release(&idelock);
+80103d52:	e9 69 3f 00 00       	jmp    80107cc0 <release>
+80103d57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103d5e:	66 90                	xchg   %ax,%ax
+    idestart(idequeue);
+80103d60:	a1 0c 1f 12 80       	mov    0x80121f0c,%eax
+80103d65:	e8 d6 f8 ff ff       	call   80103640 <idestart>
+  release(&idelock);
+80103d6a:	c7 45 08 20 1f 12 80 	movl   $0x80121f20,0x8(%ebp)
+}
+80103d71:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103d74:	c9                   	leave
+  release(&idelock);
+80103d75:	e9 46 3f 00 00       	jmp    80107cc0 <release>
+80103d7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80103d80 <iderwv>:
+// Sync the n bufs in bp with disk, as iderw does, and wait
+// for all of them. Queueing them together lets idestart()
+// merge adjacent blocks into one transfer.
+void
+iderwv(struct buf **bp, int n)
+{
+80103d80:	55                   	push   %ebp
+80103d81:	89 e5                	mov    %esp,%ebp
+80103d83:	57                   	push   %edi
+80103d84:	56                   	push   %esi
+80103d85:	53                   	push   %ebx
+80103d86:	83 ec 28             	sub    $0x28,%esp
+80103d89:	8b 45 0c             	mov    0xc(%ebp),%eax
+80103d8c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80103d8f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80103d92:	89 c6                	mov    %eax,%esi
+  int i;
+
+  acquire(&idelock);
+80103d94:	68 20 1f 12 80       	push   $0x80121f20
+80103d99:	e8 82 3f 00 00       	call   80107d20 <acquire>
+  for(i = 0; i < n; i++)
+80103d9e:	83 c4 10             	add    $0x10,%esp
+80103da1:	85 f6                	test   %esi,%esi
+80103da3:	7e 66                	jle    80103e0b <iderwv+0x8b>
+80103da5:	31 ff                	xor    %edi,%edi
+80103da7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103dae:	66 90                	xchg   %ax,%ax
+    ideenqueue(bp[i]);
+80103db0:	8b 04 bb             	mov    (%ebx,%edi,4),%eax
+80103db3:	89 fe                	mov    %edi,%esi
+  for(i = 0; i < n; i++)
+80103db5:	8d 7f 01             	lea    0x1(%edi),%edi
+    ideenqueue(bp[i]);
+80103db8:	e8 e3 fa ff ff       	call   801038a0 <ideenqueue>
+  for(i = 0; i < n; i++)
+80103dbd:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+80103dc0:	75 ee                	jne    80103db0 <iderwv+0x30>
+  if(ideinflight == 0)
+80103dc2:	a1 08 1f 12 80       	mov    0x80121f08,%eax
+80103dc7:	85 c0                	test   %eax,%eax
+80103dc9:	74 5d                	je     80103e28 <iderwv+0xa8>
+    idestart(idequeue);
+  for(i = 0; i < n; i++)
+80103dcb:	31 ff                	xor    %edi,%edi
+80103dcd:	8d 76 00             	lea    0x0(%esi),%esi
+    while((bp[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+80103dd0:	8b 13                	mov    (%ebx),%edx
+80103dd2:	8b 02                	mov    (%edx),%eax
+80103dd4:	83 e0 06             	and    $0x6,%eax
+80103dd7:	83 f8 02             	cmp    $0x2,%eax
+80103dda:	74 21                	je     80103dfd <iderwv+0x7d>
+80103ddc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      sleep(bp[i], &idelock);
+80103de0:	83 ec 08             	sub    $0x8,%esp
+80103de3:	68 20 1f 12 80       	push   $0x80121f20
+80103de8:	52                   	push   %edx
+80103de9:	e8 d2 33 00 00       	call   801071c0 <sleep>
+    while((bp[i]->flags & (B_VALID|B_DIRTY)) != B_VALID)
+80103dee:	8b 13                	mov    (%ebx),%edx
+80103df0:	83 c4 10             	add    $0x10,%esp
+80103df3:	8b 02                	mov    (%edx),%eax
+80103df5:	83 e0 06             	and    $0x6,%eax
+80103df8:	83 f8 02             	cmp    $0x2,%eax
+80103dfb:	75 e3                	jne    80103de0 <iderwv+0x60>
+  for(i = 0; i < n; i++)
+80103dfd:	8d 47 01             	lea    0x1(%edi),%eax
+80103e00:	83 c3 04             	add    $0x4,%ebx
+80103e03:	39 fe                	cmp    %edi,%esi
+80103e05:	74 0e                	je     80103e15 <iderwv+0x95>
+80103e07:	89 c7                	mov    %eax,%edi
+80103e09:	eb c5                	jmp    80103dd0 <iderwv+0x50>
+  if(ideinflight == 0)
+80103e0b:	8b 15 08 1f 12 80    	mov    0x80121f08,%edx
+80103e11:	85 d2                	test   %edx,%edx
+80103e13:	74 1f                	je     80103e34 <iderwv+0xb4>
+  release(&idelock);
+80103e15:	c7 45 08 20 1f 12 80 	movl   $0x80121f20,0x8(%ebp)
+}
+80103e1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103e1f:	5b                   	pop    %ebx
+80103e20:	5e                   	pop    %esi
+80103e21:	5f                   	pop    %edi
+80103e22:	5d                   	pop    %ebp
+  release(&idelock);
+80103e23:	e9 98 3e 00 00       	jmp    80107cc0 <release>
+    idestart(idequeue);
+80103e28:	a1 0c 1f 12 80       	mov    0x80121f0c,%eax
+80103e2d:	e8 0e f8 ff ff       	call   80103640 <idestart>
+80103e32:	eb 97                	jmp    80103dcb <iderwv+0x4b>
+80103e34:	a1 0c 1f 12 80       	mov    0x80121f0c,%eax
+80103e39:	e8 02 f8 ff ff       	call   80103640 <idestart>
+  for(i = 0; i < n; i++)
+80103e3e:	eb d5                	jmp    80103e15 <iderwv+0x95>
+
+80103e40 <ioapicinit>:
+  ioapic->data = data;
+}
+
+void
+ioapicinit(void)
+{
+80103e40:	55                   	push   %ebp
+80103e41:	89 e5                	mov    %esp,%ebp
+80103e43:	56                   	push   %esi
+80103e44:	53                   	push   %ebx
+  int i, id, maxintr;
+
+  ioapic = (volatile struct ioapic*)IOAPIC;
+80103e45:	c7 05 54 1f 12 80 00 	movl   $0xfec00000,0x80121f54
+80103e4c:	00 c0 fe 
+  ioapic->reg = reg;
+80103e4f:	c7 05 00 00 c0 fe 01 	movl   $0x1,0xfec00000
+80103e56:	00 00 00 
+  return ioapic->data;
+80103e59:	8b 15 54 1f 12 80    	mov    0x80121f54,%edx
+80103e5f:	8b 72 10             	mov    0x10(%edx),%esi
+  ioapic->reg = reg;
+80103e62:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+  return ioapic->data;
+80103e68:	8b 1d 54 1f 12 80    	mov    0x80121f54,%ebx
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+  id = ioapicread(REG_ID) >> 24;
+  if(id != ioapicid)
+80103e6e:	0f b6 15 a0 e1 13 80 	movzbl 0x8013e1a0,%edx
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+80103e75:	c1 ee 10             	shr    $0x10,%esi
+80103e78:	89 f0                	mov    %esi,%eax
+80103e7a:	0f b6 f0             	movzbl %al,%esi
+  return ioapic->data;
+80103e7d:	8b 43 10             	mov    0x10(%ebx),%eax
+  id = ioapicread(REG_ID) >> 24;
+80103e80:	c1 e8 18             	shr    $0x18,%eax
+  if(id != ioapicid)
+80103e83:	39 c2                	cmp    %eax,%edx
+80103e85:	74 16                	je     80103e9d <ioapicinit+0x5d>
+    cprintf("ioapicinit: id isn't equal to ioapicid; not a MP\n");
+80103e87:	83 ec 0c             	sub    $0xc,%esp
+80103e8a:	68 18 b8 10 80       	push   $0x8010b818
+80103e8f:	e8 1c cd ff ff       	call   80100bb0 <cprintf>
+  ioapic->reg = reg;
+80103e94:	8b 1d 54 1f 12 80    	mov    0x80121f54,%ebx
+80103e9a:	83 c4 10             	add    $0x10,%esp
+{
+80103e9d:	ba 10 00 00 00       	mov    $0x10,%edx
+80103ea2:	31 c0                	xor    %eax,%eax
+80103ea4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ioapic->reg = reg;
+80103ea8:	89 13                	mov    %edx,(%ebx)
+80103eaa:	8d 48 20             	lea    0x20(%eax),%ecx
+  ioapic->data = data;
+80103ead:	8b 1d 54 1f 12 80    	mov    0x80121f54,%ebx
+
+  // Mark all interrupts edge-triggered, active high, disabled,
+  // and not routed to any CPUs.
+  for(i = 0; i <= maxintr; i++){
+80103eb3:	83 c0 01             	add    $0x1,%eax
+80103eb6:	81 c9 00 00 01 00    	or     $0x10000,%ecx
+  ioapic->data = data;
+80103ebc:	89 4b 10             	mov    %ecx,0x10(%ebx)
+  ioapic->reg = reg;
+80103ebf:	8d 4a 01             	lea    0x1(%edx),%ecx
+  for(i = 0; i <= maxintr; i++){
+80103ec2:	83 c2 02             	add    $0x2,%edx
+  ioapic->reg = reg;
+80103ec5:	89 0b                	mov    %ecx,(%ebx)
+  ioapic->data = data;
+80103ec7:	8b 1d 54 1f 12 80    	mov    0x80121f54,%ebx
+80103ecd:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  for(i = 0; i <= maxintr; i++){
+80103ed4:	39 c6                	cmp    %eax,%esi
+80103ed6:	7d d0                	jge    80103ea8 <ioapicinit+0x68>
+    ioapicwrite(REG_TABLE+2*i, INT_DISABLED | (T_IRQ0 + i));
+    ioapicwrite(REG_TABLE+2*i+1, 0);
+  }
+}
+80103ed8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103edb:	5b                   	pop    %ebx
+80103edc:	5e                   	pop    %esi
+80103edd:	5d                   	pop    %ebp
+80103ede:	c3                   	ret
+80103edf:	90                   	nop
+
+80103ee0 <ioapicenable>:
+
+void
+ioapicenable(int irq, int cpunum)
+{
+80103ee0:	55                   	push   %ebp
+  ioapic->reg = reg;
+80103ee1:	8b 0d 54 1f 12 80    	mov    0x80121f54,%ecx
+{
+80103ee7:	89 e5                	mov    %esp,%ebp
+80103ee9:	8b 45 08             	mov    0x8(%ebp),%eax
+  // Mark interrupt edge-triggered, active high,
+  // enabled, and routed to the given cpunum,
+  // which happens to be that cpu's APIC ID.
+  ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
+80103eec:	8d 50 20             	lea    0x20(%eax),%edx
+80103eef:	8d 44 00 10          	lea    0x10(%eax,%eax,1),%eax
+  ioapic->reg = reg;
+80103ef3:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+80103ef5:	8b 0d 54 1f 12 80    	mov    0x80121f54,%ecx
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+80103efb:	83 c0 01             	add    $0x1,%eax
+  ioapic->data = data;
+80103efe:	89 51 10             	mov    %edx,0x10(%ecx)
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+80103f01:	8b 55 0c             	mov    0xc(%ebp),%edx
+  ioapic->reg = reg;
+80103f04:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+80103f06:	a1 54 1f 12 80       	mov    0x80121f54,%eax
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+80103f0b:	c1 e2 18             	shl    $0x18,%edx
+  ioapic->data = data;
+80103f0e:	89 50 10             	mov    %edx,0x10(%eax)
+}
+80103f11:	5d                   	pop    %ebp
+80103f12:	c3                   	ret
+80103f13:	66 90                	xchg   %ax,%ax
+80103f15:	66 90                	xchg   %ax,%ax
+80103f17:	66 90                	xchg   %ax,%ax
+80103f19:	66 90                	xchg   %ax,%ax
+80103f1b:	66 90                	xchg   %ax,%ax
+80103f1d:	66 90                	xchg   %ax,%ax
+80103f1f:	90                   	nop
+
+80103f20 <kfree>:
+// call to kalloc().  (The exception is when
+// initializing the allocator; see kinit above.)
+// The page is freed when the last reference goes away.
+void
+kfree(char *v)
+{
+80103f20:	55                   	push   %ebp
+80103f21:	89 e5                	mov    %esp,%ebp
+80103f23:	56                   	push   %esi
+80103f24:	53                   	push   %ebx
+80103f25:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct run *r;
+  struct kcache *c;
+  int i;
+
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+80103f28:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+80103f2e:	0f 85 2b 01 00 00    	jne    8010405f <kfree+0x13f>
+80103f34:	81 fb b0 4d 14 80    	cmp    $0x80144db0,%ebx
+80103f3a:	0f 82 1f 01 00 00    	jb     8010405f <kfree+0x13f>
+80103f40:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+80103f46:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+80103f4b:	0f 87 0e 01 00 00    	ja     8010405f <kfree+0x13f>
+    panic("kfree");
+
+  if(kmem.ref[V2P(v)/PGSIZE] == 0)
+80103f51:	c1 e8 0c             	shr    $0xc,%eax
+80103f54:	66 83 bc 00 e0 1f 12 	cmpw   $0x0,-0x7fede020(%eax,%eax,1)
+80103f5b:	80 00 
+80103f5d:	8d 50 40             	lea    0x40(%eax),%edx
+80103f60:	0f 84 06 01 00 00    	je     8010406c <kfree+0x14c>
+    panic("kfree: ref");
+  if(__sync_sub_and_fetch(&kmem.ref[V2P(v)/PGSIZE], 1) > 0)
+80103f66:	66 f0 83 ac 12 60 1f 	lock subw $0x1,-0x7fede0a0(%edx,%edx,1)
+80103f6d:	12 80 01 
+80103f70:	74 0e                	je     80103f80 <kfree+0x60>
+    c->n -= KBATCH;
+    kmem.nfree += KBATCH;
+    release(&kmem.lock);
+  }
+  popcli();
+}
+80103f72:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103f75:	5b                   	pop    %ebx
+80103f76:	5e                   	pop    %esi
+80103f77:	5d                   	pop    %ebp
+80103f78:	c3                   	ret
+80103f79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  memset(v, 1, PGSIZE);
+80103f80:	83 ec 04             	sub    $0x4,%esp
+80103f83:	68 00 10 00 00       	push   $0x1000
+80103f88:	6a 01                	push   $0x1
+80103f8a:	53                   	push   %ebx
+80103f8b:	e8 70 3e 00 00       	call   80107e00 <memset>
+  if(!kmem.use_lock){
+80103f90:	a1 94 1f 12 80       	mov    0x80121f94,%eax
+80103f95:	83 c4 10             	add    $0x10,%esp
+80103f98:	85 c0                	test   %eax,%eax
+80103f9a:	75 24                	jne    80103fc0 <kfree+0xa0>
+    r->next = kmem.freelist;
+80103f9c:	a1 98 1f 12 80       	mov    0x80121f98,%eax
+80103fa1:	89 03                	mov    %eax,(%ebx)
+    kmem.freelist = r;
+80103fa3:	89 1d 98 1f 12 80    	mov    %ebx,0x80121f98
+    kmem.nfree++;
+80103fa9:	83 05 9c 1f 12 80 01 	addl   $0x1,0x80121f9c
+}
+80103fb0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103fb3:	5b                   	pop    %ebx
+80103fb4:	5e                   	pop    %esi
+80103fb5:	5d                   	pop    %ebp
+80103fb6:	c3                   	ret
+80103fb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103fbe:	66 90                	xchg   %ax,%ax
+  pushcli();
+80103fc0:	e8 0b 3c 00 00       	call   80107bd0 <pushcli>
+  c = &kmem.cache[cpuid()];
+80103fc5:	e8 06 23 00 00       	call   801062d0 <cpuid>
+  r->next = c->freelist;
+80103fca:	8d 70 08             	lea    0x8(%eax),%esi
+80103fcd:	8b 04 f5 60 1f 12 80 	mov    -0x7fede0a0(,%esi,8),%eax
+80103fd4:	89 03                	mov    %eax,(%ebx)
+  if(++c->n > KCACHE){
+80103fd6:	8b 04 f5 64 1f 12 80 	mov    -0x7fede09c(,%esi,8),%eax
+  c->freelist = r;
+80103fdd:	89 1c f5 60 1f 12 80 	mov    %ebx,-0x7fede0a0(,%esi,8)
+  if(++c->n > KCACHE){
+80103fe4:	83 c0 01             	add    $0x1,%eax
+80103fe7:	89 04 f5 64 1f 12 80 	mov    %eax,-0x7fede09c(,%esi,8)
+80103fee:	83 f8 20             	cmp    $0x20,%eax
+80103ff1:	7f 0d                	jg     80104000 <kfree+0xe0>
+}
+80103ff3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103ff6:	5b                   	pop    %ebx
+80103ff7:	5e                   	pop    %esi
+80103ff8:	5d                   	pop    %ebp
+  popcli();
+80103ff9:	e9 22 3c 00 00       	jmp    80107c20 <popcli>
+80103ffe:	66 90                	xchg   %ax,%ax
+    acquire(&kmem.lock);
+80104000:	83 ec 0c             	sub    $0xc,%esp
+80104003:	68 60 1f 12 80       	push   $0x80121f60
+80104008:	e8 13 3d 00 00       	call   80107d20 <acquire>
+      r->next = kmem.freelist;
+8010400d:	a1 98 1f 12 80       	mov    0x80121f98,%eax
+80104012:	83 c4 10             	add    $0x10,%esp
+80104015:	ba 10 00 00 00       	mov    $0x10,%edx
+8010401a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      r = c->freelist;
+80104020:	89 c1                	mov    %eax,%ecx
+80104022:	8b 04 f5 60 1f 12 80 	mov    -0x7fede0a0(,%esi,8),%eax
+      c->freelist = r->next;
+80104029:	8b 18                	mov    (%eax),%ebx
+8010402b:	89 1c f5 60 1f 12 80 	mov    %ebx,-0x7fede0a0(,%esi,8)
+      r->next = kmem.freelist;
+80104032:	89 08                	mov    %ecx,(%eax)
+      kmem.freelist = r;
+80104034:	a3 98 1f 12 80       	mov    %eax,0x80121f98
+    for(i = 0; i < KBATCH; i++){
+80104039:	83 ea 01             	sub    $0x1,%edx
+8010403c:	75 e2                	jne    80104020 <kfree+0x100>
+    release(&kmem.lock);
+8010403e:	83 ec 0c             	sub    $0xc,%esp
+    c->n -= KBATCH;
+80104041:	83 2c f5 64 1f 12 80 	subl   $0x10,-0x7fede09c(,%esi,8)
+80104048:	10 
+    kmem.nfree += KBATCH;
+80104049:	83 05 9c 1f 12 80 10 	addl   $0x10,0x80121f9c
+    release(&kmem.lock);
+80104050:	68 60 1f 12 80       	push   $0x80121f60
+80104055:	e8 66 3c 00 00       	call   80107cc0 <release>
+8010405a:	83 c4 10             	add    $0x10,%esp
+8010405d:	eb 94                	jmp    80103ff3 <kfree+0xd3>
+    panic("kfree");
+8010405f:	83 ec 0c             	sub    $0xc,%esp
+80104062:	68 4a b8 10 80       	push   $0x8010b84a
+80104067:	e8 14 c8 ff ff       	call   80100880 <panic>
+    panic("kfree: ref");
+8010406c:	83 ec 0c             	sub    $0xc,%esp
+8010406f:	68 50 b8 10 80       	push   $0x8010b850
+80104074:	e8 07 c8 ff ff       	call   80100880 <panic>
+80104079:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80104080 <freerange>:
+{
+80104080:	55                   	push   %ebp
+80104081:	89 e5                	mov    %esp,%ebp
+80104083:	56                   	push   %esi
+80104084:	53                   	push   %ebx
+  p = (char*)PGROUNDUP((uint)vstart);
+80104085:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+80104088:	8b 75 0c             	mov    0xc(%ebp),%esi
+  p = (char*)PGROUNDUP((uint)vstart);
+8010408b:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80104091:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80104097:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010409d:	39 de                	cmp    %ebx,%esi
+8010409f:	72 39                	jb     801040da <freerange+0x5a>
+801040a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    kmem.ref[V2P(p)/PGSIZE] = 1;
+801040a8:	8d 83 00 f0 ff 7f    	lea    0x7ffff000(%ebx),%eax
+801040ae:	ba 01 00 00 00       	mov    $0x1,%edx
+    kfree(p);
+801040b3:	83 ec 0c             	sub    $0xc,%esp
+    kmem.ref[V2P(p)/PGSIZE] = 1;
+801040b6:	c1 e8 0c             	shr    $0xc,%eax
+801040b9:	66 89 94 00 e0 1f 12 	mov    %dx,-0x7fede020(%eax,%eax,1)
+801040c0:	80 
+    kfree(p);
+801040c1:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+801040c7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+801040cd:	50                   	push   %eax
+801040ce:	e8 4d fe ff ff       	call   80103f20 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+801040d3:	83 c4 10             	add    $0x10,%esp
+801040d6:	39 de                	cmp    %ebx,%esi
+801040d8:	73 ce                	jae    801040a8 <freerange+0x28>
+}
+801040da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801040dd:	5b                   	pop    %ebx
+801040de:	5e                   	pop    %esi
+801040df:	5d                   	pop    %ebp
+801040e0:	c3                   	ret
+801040e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801040e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801040ef:	90                   	nop
+
+801040f0 <kinit2>:
+{
+801040f0:	55                   	push   %ebp
+801040f1:	89 e5                	mov    %esp,%ebp
+801040f3:	56                   	push   %esi
+801040f4:	53                   	push   %ebx
+  p = (char*)PGROUNDUP((uint)vstart);
+801040f5:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+801040f8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  p = (char*)PGROUNDUP((uint)vstart);
+801040fb:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80104101:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80104107:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010410d:	39 de                	cmp    %ebx,%esi
+8010410f:	72 39                	jb     8010414a <kinit2+0x5a>
+80104111:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    kmem.ref[V2P(p)/PGSIZE] = 1;
+80104118:	8d 83 00 f0 ff 7f    	lea    0x7ffff000(%ebx),%eax
+8010411e:	ba 01 00 00 00       	mov    $0x1,%edx
+    kfree(p);
+80104123:	83 ec 0c             	sub    $0xc,%esp
+    kmem.ref[V2P(p)/PGSIZE] = 1;
+80104126:	c1 e8 0c             	shr    $0xc,%eax
+80104129:	66 89 94 00 e0 1f 12 	mov    %dx,-0x7fede020(%eax,%eax,1)
+80104130:	80 
+    kfree(p);
+80104131:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80104137:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+8010413d:	50                   	push   %eax
+8010413e:	e8 dd fd ff ff       	call   80103f20 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80104143:	83 c4 10             	add    $0x10,%esp
+80104146:	39 de                	cmp    %ebx,%esi
+80104148:	73 ce                	jae    80104118 <kinit2+0x28>
+  kmem.use_lock = 1;
+8010414a:	c7 05 94 1f 12 80 01 	movl   $0x1,0x80121f94
+80104151:	00 00 00 
+}
+80104154:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104157:	5b                   	pop    %ebx
+80104158:	5e                   	pop    %esi
+80104159:	5d                   	pop    %ebp
+8010415a:	c3                   	ret
+8010415b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010415f:	90                   	nop
+
+80104160 <kinit1>:
+{
+80104160:	55                   	push   %ebp
+80104161:	89 e5                	mov    %esp,%ebp
+80104163:	56                   	push   %esi
+80104164:	53                   	push   %ebx
+80104165:	8b 75 0c             	mov    0xc(%ebp),%esi
+  initlock(&kmem.lock, "kmem");
+80104168:	83 ec 08             	sub    $0x8,%esp
+8010416b:	68 5b b8 10 80       	push   $0x8010b85b
+80104170:	68 60 1f 12 80       	push   $0x80121f60
+80104175:	e8 c6 39 00 00       	call   80107b40 <initlock>
+  p = (char*)PGROUNDUP((uint)vstart);
+8010417a:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+8010417d:	83 c4 10             	add    $0x10,%esp
+  kmem.use_lock = 0;
+80104180:	c7 05 94 1f 12 80 00 	movl   $0x0,0x80121f94
+80104187:	00 00 00 
+  p = (char*)PGROUNDUP((uint)vstart);
+8010418a:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80104190:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80104196:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010419c:	39 de                	cmp    %ebx,%esi
+8010419e:	72 32                	jb     801041d2 <kinit1+0x72>
+    kmem.ref[V2P(p)/PGSIZE] = 1;
+801041a0:	8d 83 00 f0 ff 7f    	lea    0x7ffff000(%ebx),%eax
+801041a6:	ba 01 00 00 00       	mov    $0x1,%edx
+    kfree(p);
+801041ab:	83 ec 0c             	sub    $0xc,%esp
+    kmem.ref[V2P(p)/PGSIZE] = 1;
+801041ae:	c1 e8 0c             	shr    $0xc,%eax
+801041b1:	66 89 94 00 e0 1f 12 	mov    %dx,-0x7fede020(%eax,%eax,1)
+801041b8:	80 
+    kfree(p);
+801041b9:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+801041bf:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+801041c5:	50                   	push   %eax
+801041c6:	e8 55 fd ff ff       	call   80103f20 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+801041cb:	83 c4 10             	add    $0x10,%esp
+801041ce:	39 de                	cmp    %ebx,%esi
+801041d0:	73 ce                	jae    801041a0 <kinit1+0x40>
+}
+801041d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801041d5:	5b                   	pop    %ebx
+801041d6:	5e                   	pop    %esi
+801041d7:	5d                   	pop    %ebp
+801041d8:	c3                   	ret
+801041d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801041e0 <kalloc>:
+// Allocate one 4096-byte page of physical memory.
+// Returns a pointer that the kernel can use.
+// Returns 0 if the memory cannot be allocated.
+char*
+kalloc(void)
+{
+801041e0:	55                   	push   %ebp
+801041e1:	89 e5                	mov    %esp,%ebp
+801041e3:	56                   	push   %esi
+801041e4:	53                   	push   %ebx
+  struct run *r;
+  struct kcache *c;
+
+  if(!kmem.use_lock){
+801041e5:	8b 1d 94 1f 12 80    	mov    0x80121f94,%ebx
+801041eb:	85 db                	test   %ebx,%ebx
+801041ed:	75 41                	jne    80104230 <kalloc+0x50>
+    r = kmem.freelist;
+801041ef:	8b 35 98 1f 12 80    	mov    0x80121f98,%esi
+    if(r){
+801041f5:	85 f6                	test   %esi,%esi
+801041f7:	0f 84 f0 00 00 00    	je     801042ed <kalloc+0x10d>
+      kmem.freelist = r->next;
+801041fd:	8b 06                	mov    (%esi),%eax
+      kmem.nfree--;
+801041ff:	83 2d 9c 1f 12 80 01 	subl   $0x1,0x80121f9c
+      kmem.freelist = r->next;
+80104206:	a3 98 1f 12 80       	mov    %eax,0x80121f98
+      c->n--;
+    }
+    popcli();
+  }
+  if(r)
+    kmem.ref[V2P(r)/PGSIZE] = 1;
+8010420b:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+80104211:	ba 01 00 00 00       	mov    $0x1,%edx
+80104216:	c1 e8 0c             	shr    $0xc,%eax
+80104219:	66 89 94 00 e0 1f 12 	mov    %dx,-0x7fede020(%eax,%eax,1)
+80104220:	80 
+  return (char*)r;
+}
+80104221:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104224:	89 f0                	mov    %esi,%eax
+80104226:	5b                   	pop    %ebx
+80104227:	5e                   	pop    %esi
+80104228:	5d                   	pop    %ebp
+80104229:	c3                   	ret
+8010422a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pushcli();
+80104230:	e8 9b 39 00 00       	call   80107bd0 <pushcli>
+    c = &kmem.cache[cpuid()];
+80104235:	e8 96 20 00 00       	call   801062d0 <cpuid>
+    if(c->n == 0){
+8010423a:	8b 0c c5 a4 1f 12 80 	mov    -0x7fede05c(,%eax,8),%ecx
+80104241:	8d 58 08             	lea    0x8(%eax),%ebx
+80104244:	85 c9                	test   %ecx,%ecx
+80104246:	74 28                	je     80104270 <kalloc+0x90>
+    if((r = c->freelist) != 0){
+80104248:	8b 34 dd 60 1f 12 80 	mov    -0x7fede0a0(,%ebx,8),%esi
+8010424f:	85 f6                	test   %esi,%esi
+80104251:	0f 84 91 00 00 00    	je     801042e8 <kalloc+0x108>
+      c->freelist = r->next;
+80104257:	8b 06                	mov    (%esi),%eax
+      c->n--;
+80104259:	83 2c dd 64 1f 12 80 	subl   $0x1,-0x7fede09c(,%ebx,8)
+80104260:	01 
+      c->freelist = r->next;
+80104261:	89 04 dd 60 1f 12 80 	mov    %eax,-0x7fede0a0(,%ebx,8)
+    popcli();
+80104268:	e8 b3 39 00 00       	call   80107c20 <popcli>
+  if(r)
+8010426d:	eb 9c                	jmp    8010420b <kalloc+0x2b>
+8010426f:	90                   	nop
+      acquire(&kmem.lock);
+80104270:	83 ec 0c             	sub    $0xc,%esp
+80104273:	68 60 1f 12 80       	push   $0x80121f60
+80104278:	e8 a3 3a 00 00       	call   80107d20 <acquire>
+      while(c->n < KBATCH && (r = kmem.freelist) != 0){
+8010427d:	83 c4 10             	add    $0x10,%esp
+80104280:	83 3c dd 64 1f 12 80 	cmpl   $0xf,-0x7fede09c(,%ebx,8)
+80104287:	0f 
+80104288:	7e 3b                	jle    801042c5 <kalloc+0xe5>
+8010428a:	eb 42                	jmp    801042ce <kalloc+0xee>
+8010428c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        kmem.freelist = r->next;
+80104290:	8b 10                	mov    (%eax),%edx
+        kmem.nfree--;
+80104292:	83 2d 9c 1f 12 80 01 	subl   $0x1,0x80121f9c
+        kmem.freelist = r->next;
+80104299:	89 15 98 1f 12 80    	mov    %edx,0x80121f98
+        r->next = c->freelist;
+8010429f:	8b 14 dd 60 1f 12 80 	mov    -0x7fede0a0(,%ebx,8),%edx
+801042a6:	89 10                	mov    %edx,(%eax)
+        c->freelist = r;
+801042a8:	89 04 dd 60 1f 12 80 	mov    %eax,-0x7fede0a0(,%ebx,8)
+        c->n++;
+801042af:	8b 04 dd 64 1f 12 80 	mov    -0x7fede09c(,%ebx,8),%eax
+801042b6:	83 c0 01             	add    $0x1,%eax
+801042b9:	89 04 dd 64 1f 12 80 	mov    %eax,-0x7fede09c(,%ebx,8)
+      while(c->n < KBATCH && (r = kmem.freelist) != 0){
+801042c0:	83 f8 0f             	cmp    $0xf,%eax
+801042c3:	7f 09                	jg     801042ce <kalloc+0xee>
+801042c5:	a1 98 1f 12 80       	mov    0x80121f98,%eax
+801042ca:	85 c0                	test   %eax,%eax
+801042cc:	75 c2                	jne    80104290 <kalloc+0xb0>
+      release(&kmem.lock);
+801042ce:	83 ec 0c             	sub    $0xc,%esp
+801042d1:	68 60 1f 12 80       	push   $0x80121f60
+801042d6:	e8 e5 39 00 00       	call   80107cc0 <release>
+801042db:	83 c4 10             	add    $0x10,%esp
+801042de:	e9 65 ff ff ff       	jmp    80104248 <kalloc+0x68>
+801042e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801042e7:	90                   	nop
+    popcli();
+801042e8:	e8 33 39 00 00       	call   80107c20 <popcli>
+    if((r = c->freelist) != 0){
+801042ed:	31 f6                	xor    %esi,%esi
+801042ef:	e9 2d ff ff ff       	jmp    80104221 <kalloc+0x41>
+801042f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801042fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801042ff:	90                   	nop
+
+80104300 <kincref>:
+
+// Add a reference to the page at v, which must already
+// be allocated. Used to share user pages copy-on-write.
+void
+kincref(char *v)
+{
+80104300:	55                   	push   %ebp
+80104301:	89 e5                	mov    %esp,%ebp
+80104303:	83 ec 08             	sub    $0x8,%esp
+80104306:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+80104309:	a9 ff 0f 00 00       	test   $0xfff,%eax
+8010430e:	75 2f                	jne    8010433f <kincref+0x3f>
+80104310:	3d b0 4d 14 80       	cmp    $0x80144db0,%eax
+80104315:	72 28                	jb     8010433f <kincref+0x3f>
+80104317:	05 00 00 00 80       	add    $0x80000000,%eax
+8010431c:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+80104321:	77 1c                	ja     8010433f <kincref+0x3f>
+    panic("kincref");
+  if(__sync_fetch_and_add(&kmem.ref[V2P(v)/PGSIZE], 1) == 0)
+80104323:	c1 e8 0c             	shr    $0xc,%eax
+80104326:	ba 01 00 00 00       	mov    $0x1,%edx
+8010432b:	83 c0 40             	add    $0x40,%eax
+8010432e:	66 f0 0f c1 94 00 60 	lock xadd %dx,-0x7fede0a0(%eax,%eax,1)
+80104335:	1f 12 80 
+80104338:	66 85 d2             	test   %dx,%dx
+8010433b:	74 0f                	je     8010434c <kincref+0x4c>
+    panic("kincref: free page");
+}
+8010433d:	c9                   	leave
+8010433e:	c3                   	ret
+    panic("kincref");
+8010433f:	83 ec 0c             	sub    $0xc,%esp
+80104342:	68 60 b8 10 80       	push   $0x8010b860
+80104347:	e8 34 c5 ff ff       	call   80100880 <panic>
+    panic("kincref: free page");
+8010434c:	83 ec 0c             	sub    $0xc,%esp
+8010434f:	68 68 b8 10 80       	push   $0x8010b868
+80104354:	e8 27 c5 ff ff       	call   80100880 <panic>
+80104359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80104360 <krefcount>:
+
+// Return the number of references to the page at v.
+int
+krefcount(char *v)
+{
+80104360:	55                   	push   %ebp
+80104361:	89 e5                	mov    %esp,%ebp
+  return kmem.ref[V2P(v)/PGSIZE];
+80104363:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+80104366:	5d                   	pop    %ebp
+  return kmem.ref[V2P(v)/PGSIZE];
+80104367:	05 00 00 00 80       	add    $0x80000000,%eax
+8010436c:	c1 e8 0c             	shr    $0xc,%eax
+8010436f:	0f b7 84 00 e0 1f 12 	movzwl -0x7fede020(%eax,%eax,1),%eax
+80104376:	80 
+}
+80104377:	c3                   	ret
+80104378:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010437f:	90                   	nop
+
+80104380 <kfreecount>:
+int
+kfreecount(void)
+{
+  int i, n;
+
+  n = kmem.nfree;
+80104380:	8b 15 9c 1f 12 80    	mov    0x80121f9c,%edx
+  for(i = 0; i < NCPU; i++)
+80104386:	31 c0                	xor    %eax,%eax
+80104388:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010438f:	90                   	nop
+    n += kmem.cache[i].n;
+80104390:	03 14 c5 a4 1f 12 80 	add    -0x7fede05c(,%eax,8),%edx
+  for(i = 0; i < NCPU; i++)
+80104397:	83 c0 01             	add    $0x1,%eax
+8010439a:	83 f8 08             	cmp    $0x8,%eax
+8010439d:	75 f1                	jne    80104390 <kfreecount+0x10>
+  return n;
+}
+8010439f:	89 d0                	mov    %edx,%eax
+801043a1:	c3                   	ret
+801043a2:	66 90                	xchg   %ax,%ax
+801043a4:	66 90                	xchg   %ax,%ax
+801043a6:	66 90                	xchg   %ax,%ax
+801043a8:	66 90                	xchg   %ax,%ax
+801043aa:	66 90                	xchg   %ax,%ax
+801043ac:	66 90                	xchg   %ax,%ax
+801043ae:	66 90                	xchg   %ax,%ax
+
+801043b0 <kbdgetc>:
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801043b0:	ba 64 00 00 00       	mov    $0x64,%edx
+801043b5:	ec                   	in     (%dx),%al
+    normalmap, shiftmap, ctlmap, ctlmap
+  };
+  uint st, data, c;
+
+  st = inb(KBSTATP);
+  if((st & KBS_DIB) == 0)
+801043b6:	a8 01                	test   $0x1,%al
+801043b8:	0f 84 c2 00 00 00    	je     80104480 <kbdgetc+0xd0>
+{
+801043be:	55                   	push   %ebp
+801043bf:	ba 60 00 00 00       	mov    $0x60,%edx
+801043c4:	89 e5                	mov    %esp,%ebp
+801043c6:	53                   	push   %ebx
+801043c7:	ec                   	in     (%dx),%al
+    return -1;
+  data = inb(KBDATAP);
+
+  if(data == 0xE0){
+    shift |= E0ESC;
+801043c8:	8b 1d e0 df 13 80    	mov    0x8013dfe0,%ebx
+  data = inb(KBDATAP);
+801043ce:	0f b6 c8             	movzbl %al,%ecx
+  if(data == 0xE0){
+801043d1:	3c e0                	cmp    $0xe0,%al
+801043d3:	74 5b                	je     80104430 <kbdgetc+0x80>
+    return 0;
+  } else if(data & 0x80){
+    // Key released
+    data = (shift & E0ESC ? data : data & 0x7F);
+801043d5:	89 da                	mov    %ebx,%edx
+801043d7:	83 e2 40             	and    $0x40,%edx
+  } else if(data & 0x80){
+801043da:	84 c0                	test   %al,%al
+801043dc:	78 6a                	js     80104448 <kbdgetc+0x98>
+    shift &= ~(shiftcode[data] | E0ESC);
+    return 0;
+  } else if(shift & E0ESC){
+801043de:	85 d2                	test   %edx,%edx
+801043e0:	74 09                	je     801043eb <kbdgetc+0x3b>
+    // Last character was an E0 escape; or with 0x80
+    data |= 0x80;
+801043e2:	83 c8 80             	or     $0xffffff80,%eax
+    shift &= ~E0ESC;
+801043e5:	83 e3 bf             	and    $0xffffffbf,%ebx
+    data |= 0x80;
+801043e8:	0f b6 c8             	movzbl %al,%ecx
+  }
+
+  shift |= shiftcode[data];
+801043eb:	0f b6 91 a0 b9 10 80 	movzbl -0x7fef4660(%ecx),%edx
+  shift ^= togglecode[data];
+801043f2:	0f b6 81 a0 b8 10 80 	movzbl -0x7fef4760(%ecx),%eax
+  shift |= shiftcode[data];
+801043f9:	09 da                	or     %ebx,%edx
+  shift ^= togglecode[data];
+801043fb:	31 c2                	xor    %eax,%edx
+  c = charcode[shift & (CTL | SHIFT)][data];
+801043fd:	89 d0                	mov    %edx,%eax
+  shift ^= togglecode[data];
+801043ff:	89 15 e0 df 13 80    	mov    %edx,0x8013dfe0
+  c = charcode[shift & (CTL | SHIFT)][data];
+80104405:	83 e0 03             	and    $0x3,%eax
+  if(shift & CAPSLOCK){
+80104408:	83 e2 08             	and    $0x8,%edx
+  c = charcode[shift & (CTL | SHIFT)][data];
+8010440b:	8b 04 85 80 b8 10 80 	mov    -0x7fef4780(,%eax,4),%eax
+80104412:	0f b6 04 08          	movzbl (%eax,%ecx,1),%eax
+  if(shift & CAPSLOCK){
+80104416:	74 0b                	je     80104423 <kbdgetc+0x73>
+    if('a' <= c && c <= 'z')
+80104418:	8d 50 9f             	lea    -0x61(%eax),%edx
+8010441b:	83 fa 19             	cmp    $0x19,%edx
+8010441e:	77 48                	ja     80104468 <kbdgetc+0xb8>
+      c += 'A' - 'a';
+80104420:	83 e8 20             	sub    $0x20,%eax
+    else if('A' <= c && c <= 'Z')
+      c += 'a' - 'A';
+  }
+  return c;
+}
+80104423:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104426:	c9                   	leave
+80104427:	c3                   	ret
+80104428:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010442f:	90                   	nop
+    shift |= E0ESC;
+80104430:	89 d8                	mov    %ebx,%eax
+80104432:	83 c8 40             	or     $0x40,%eax
+    shift &= ~(shiftcode[data] | E0ESC);
+80104435:	a3 e0 df 13 80       	mov    %eax,0x8013dfe0
+    return 0;
+8010443a:	31 c0                	xor    %eax,%eax
+}
+8010443c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010443f:	c9                   	leave
+80104440:	c3                   	ret
+80104441:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    data = (shift & E0ESC ? data : data & 0x7F);
+80104448:	83 e0 7f             	and    $0x7f,%eax
+8010444b:	85 d2                	test   %edx,%edx
+8010444d:	0f 44 c8             	cmove  %eax,%ecx
+    shift &= ~(shiftcode[data] | E0ESC);
+80104450:	0f b6 81 a0 b9 10 80 	movzbl -0x7fef4660(%ecx),%eax
+80104457:	83 c8 40             	or     $0x40,%eax
+8010445a:	0f b6 c0             	movzbl %al,%eax
+8010445d:	f7 d0                	not    %eax
+8010445f:	21 d8                	and    %ebx,%eax
+    return 0;
+80104461:	eb d2                	jmp    80104435 <kbdgetc+0x85>
+80104463:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104467:	90                   	nop
+    else if('A' <= c && c <= 'Z')
+80104468:	8d 48 bf             	lea    -0x41(%eax),%ecx
+      c += 'a' - 'A';
+8010446b:	8d 50 20             	lea    0x20(%eax),%edx
+}
+8010446e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80104471:	c9                   	leave
+      c += 'a' - 'A';
+80104472:	83 f9 1a             	cmp    $0x1a,%ecx
+80104475:	0f 42 c2             	cmovb  %edx,%eax
+}
+80104478:	c3                   	ret
+80104479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+80104480:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80104485:	c3                   	ret
+80104486:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010448d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80104490 <kbdintr>:
+
+void
+kbdintr(void)
+{
+80104490:	55                   	push   %ebp
+80104491:	89 e5                	mov    %esp,%ebp
+80104493:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(kbdgetc);
+80104496:	68 b0 43 10 80       	push   $0x801043b0
+8010449b:	e8 20 c9 ff ff       	call   80100dc0 <consoleintr>
+}
+801044a0:	83 c4 10             	add    $0x10,%esp
+801044a3:	c9                   	leave
+801044a4:	c3                   	ret
+801044a5:	66 90                	xchg   %ax,%ax
+801044a7:	66 90                	xchg   %ax,%ax
+801044a9:	66 90                	xchg   %ax,%ax
+801044ab:	66 90                	xchg   %ax,%ax
+801044ad:	66 90                	xchg   %ax,%ax
+801044af:	90                   	nop
+
+801044b0 <lapictimer>:
+
+// Interrupt every tick if n is 0, else just once, n ticks
+// from now.
+void
+lapictimer(uint n)
+{
+801044b0:	55                   	push   %ebp
+  if(!lapic)
+801044b1:	8b 0d e8 df 13 80    	mov    0x8013dfe8,%ecx
+{
+801044b7:	89 e5                	mov    %esp,%ebp
+801044b9:	56                   	push   %esi
+801044ba:	53                   	push   %ebx
+801044bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!lapic)
+801044be:	85 c9                	test   %ecx,%ecx
+801044c0:	74 29                	je     801044eb <lapictimer+0x3b>
+    return;
+  if(n == 0){
+    lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
+    lapicw(TICR, lapictick);
+801044c2:	8b 35 fc df 13 80    	mov    0x8013dffc,%esi
+  if(n == 0){
+801044c8:	85 db                	test   %ebx,%ebx
+801044ca:	74 24                	je     801044f0 <lapictimer+0x40>
+    return;
+  }
+  if(n > 0xffffffff / lapictick)
+801044cc:	89 d8                	mov    %ebx,%eax
+801044ce:	f7 e6                	mul    %esi
+801044d0:	70 38                	jo     8010450a <lapictimer+0x5a>
+  lapic[index] = value;
+801044d2:	c7 81 20 03 00 00 20 	movl   $0x20,0x320(%ecx)
+801044d9:	00 00 00 
+    n = 0xffffffff / lapictick;
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+  lapicw(TICR, n * lapictick);
+801044dc:	0f af de             	imul   %esi,%ebx
+  lapic[ID];  // wait for write to finish, by reading
+801044df:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+801044e2:	89 99 80 03 00 00    	mov    %ebx,0x380(%ecx)
+  lapic[ID];  // wait for write to finish, by reading
+801044e8:	8b 41 20             	mov    0x20(%ecx),%eax
+}
+801044eb:	5b                   	pop    %ebx
+801044ec:	5e                   	pop    %esi
+801044ed:	5d                   	pop    %ebp
+801044ee:	c3                   	ret
+801044ef:	90                   	nop
+  lapic[index] = value;
+801044f0:	c7 81 20 03 00 00 20 	movl   $0x20020,0x320(%ecx)
+801044f7:	00 02 00 
+  lapic[ID];  // wait for write to finish, by reading
+801044fa:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+801044fd:	89 b1 80 03 00 00    	mov    %esi,0x380(%ecx)
+}
+80104503:	5b                   	pop    %ebx
+  lapic[ID];  // wait for write to finish, by reading
+80104504:	8b 41 20             	mov    0x20(%ecx),%eax
+}
+80104507:	5e                   	pop    %esi
+80104508:	5d                   	pop    %ebp
+80104509:	c3                   	ret
+  if(n > 0xffffffff / lapictick)
+8010450a:	83 c8 ff             	or     $0xffffffff,%eax
+8010450d:	31 d2                	xor    %edx,%edx
+8010450f:	f7 f6                	div    %esi
+80104511:	89 c3                	mov    %eax,%ebx
+80104513:	eb bd                	jmp    801044d2 <lapictimer+0x22>
+80104515:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010451c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80104520 <lapicipi>:
+
+// Send interrupt vector to the CPU whose local APIC id is
+// apicid. Caller must have interrupts off.
+void
+lapicipi(int apicid, int vector)
+{
+80104520:	55                   	push   %ebp
+  lapic[index] = value;
+80104521:	8b 15 e8 df 13 80    	mov    0x8013dfe8,%edx
+{
+80104527:	89 e5                	mov    %esp,%ebp
+  lapicw(ICRHI, apicid<<24);
+80104529:	8b 45 08             	mov    0x8(%ebp),%eax
+8010452c:	c1 e0 18             	shl    $0x18,%eax
+  lapic[index] = value;
+8010452f:	89 82 10 03 00 00    	mov    %eax,0x310(%edx)
+  lapic[ID];  // wait for write to finish, by reading
+80104535:	8b 42 20             	mov    0x20(%edx),%eax
+  lapic[index] = value;
+80104538:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010453b:	89 82 00 03 00 00    	mov    %eax,0x300(%edx)
+  lapic[ID];  // wait for write to finish, by reading
+80104541:	8b 42 20             	mov    0x20(%edx),%eax
+80104544:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  lapicw(ICRLO, FIXED | vector);
+  while(lapic[ICRLO] & DELIVS)
+80104548:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+8010454e:	f6 c4 10             	test   $0x10,%ah
+80104551:	75 f5                	jne    80104548 <lapicipi+0x28>
+    ;
+}
+80104553:	5d                   	pop    %ebp
+80104554:	c3                   	ret
+80104555:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010455c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80104560 <nsecs>:
+}
+
+// Nanoseconds since boot, from the TSC.
+uint64
+nsecs(void)
+{
+80104560:	55                   	push   %ebp
+80104561:	89 e5                	mov    %esp,%ebp
+80104563:	57                   	push   %edi
+80104564:	56                   	push   %esi
+80104565:	53                   	push   %ebx
+80104566:	83 ec 1c             	sub    $0x1c,%esp
+  uint64 ms;
+  uint r;
+
+  if(tscperms == 0)
+80104569:	8b 1d f8 df 13 80    	mov    0x8013dff8,%ebx
+8010456f:	85 db                	test   %ebx,%ebx
+80104571:	74 6d                	je     801045e0 <nsecs+0x80>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+80104573:	0f 31                	rdtsc
+    return 0;
+  ms = div64(rdtsc() - tsc0, tscperms, &r);
+80104575:	2b 05 f0 df 13 80    	sub    0x8013dff0,%eax
+8010457b:	1b 15 f4 df 13 80    	sbb    0x8013dff4,%edx
+  return ms * 1000000 + div64((uint64)r * 1000000, tscperms, 0);
+80104581:	bf 40 42 0f 00       	mov    $0xf4240,%edi
+  ms = div64(rdtsc() - tsc0, tscperms, &r);
+80104586:	89 c6                	mov    %eax,%esi
+  hi = n >> 32;
+80104588:	89 d0                	mov    %edx,%eax
+8010458a:	31 d2                	xor    %edx,%edx
+8010458c:	f7 f3                	div    %ebx
+  asm("divl %2" : "+a" (lo), "+d" (r) : "rm" (d));
+8010458e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80104591:	89 f0                	mov    %esi,%eax
+80104593:	f7 f3                	div    %ebx
+80104595:	89 c1                	mov    %eax,%ecx
+  return ms * 1000000 + div64((uint64)r * 1000000, tscperms, 0);
+80104597:	89 d0                	mov    %edx,%eax
+80104599:	f7 e7                	mul    %edi
+  hi = n >> 32;
+8010459b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+8010459e:	89 d0                	mov    %edx,%eax
+801045a0:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801045a3:	31 d2                	xor    %edx,%edx
+801045a5:	f7 f3                	div    %ebx
+801045a7:	89 c7                	mov    %eax,%edi
+  asm("divl %2" : "+a" (lo), "+d" (r) : "rm" (d));
+801045a9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+801045ac:	f7 f3                	div    %ebx
+  return (uint64)hi << 32 | lo;
+801045ae:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  asm("divl %2" : "+a" (lo), "+d" (r) : "rm" (d));
+801045b1:	89 c6                	mov    %eax,%esi
+  return (uint64)hi << 32 | lo;
+801045b3:	89 c8                	mov    %ecx,%eax
+  return ms * 1000000 + div64((uint64)r * 1000000, tscperms, 0);
+801045b5:	b9 40 42 0f 00       	mov    $0xf4240,%ecx
+801045ba:	f7 e1                	mul    %ecx
+  return (uint64)hi << 32 | lo;
+801045bc:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  return ms * 1000000 + div64((uint64)r * 1000000, tscperms, 0);
+801045bf:	69 db 40 42 0f 00    	imul   $0xf4240,%ebx,%ebx
+  return (uint64)hi << 32 | lo;
+801045c5:	89 75 e8             	mov    %esi,-0x18(%ebp)
+  return ms * 1000000 + div64((uint64)r * 1000000, tscperms, 0);
+801045c8:	01 da                	add    %ebx,%edx
+801045ca:	03 45 e8             	add    -0x18(%ebp),%eax
+801045cd:	13 55 ec             	adc    -0x14(%ebp),%edx
+}
+801045d0:	83 c4 1c             	add    $0x1c,%esp
+801045d3:	5b                   	pop    %ebx
+801045d4:	5e                   	pop    %esi
+801045d5:	5f                   	pop    %edi
+801045d6:	5d                   	pop    %ebp
+801045d7:	c3                   	ret
+801045d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801045df:	90                   	nop
+801045e0:	83 c4 1c             	add    $0x1c,%esp
+801045e3:	31 c0                	xor    %eax,%eax
+801045e5:	31 d2                	xor    %edx,%edx
+801045e7:	5b                   	pop    %ebx
+801045e8:	5e                   	pop    %esi
+801045e9:	5f                   	pop    %edi
+801045ea:	5d                   	pop    %ebp
+801045eb:	c3                   	ret
+801045ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801045f0 <clockticks>:
+// Ticks since boot, from the TSC. Unlike counting timer
+// interrupts, this stays right when CPUs leave their
+// timers off while idle.
+uint
+clockticks(void)
+{
+801045f0:	55                   	push   %ebp
+801045f1:	89 e5                	mov    %esp,%ebp
+801045f3:	56                   	push   %esi
+  if(tscperms == 0)
+801045f4:	8b 35 f8 df 13 80    	mov    0x8013dff8,%esi
+{
+801045fa:	53                   	push   %ebx
+  if(tscperms == 0)
+801045fb:	85 f6                	test   %esi,%esi
+801045fd:	74 26                	je     80104625 <clockticks+0x35>
+801045ff:	0f 31                	rdtsc
+    return 0;
+  return (uint)div64(rdtsc() - tsc0, tscperms, 0) / (1000/HZ);
+80104601:	2b 05 f0 df 13 80    	sub    0x8013dff0,%eax
+80104607:	1b 15 f4 df 13 80    	sbb    0x8013dff4,%edx
+8010460d:	89 c1                	mov    %eax,%ecx
+  hi = n >> 32;
+8010460f:	89 d0                	mov    %edx,%eax
+80104611:	31 d2                	xor    %edx,%edx
+80104613:	f7 f6                	div    %esi
+  asm("divl %2" : "+a" (lo), "+d" (r) : "rm" (d));
+80104615:	89 c8                	mov    %ecx,%eax
+80104617:	f7 f6                	div    %esi
+  return (uint)div64(rdtsc() - tsc0, tscperms, 0) / (1000/HZ);
+80104619:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+8010461e:	f7 e2                	mul    %edx
+80104620:	89 d6                	mov    %edx,%esi
+80104622:	c1 ee 03             	shr    $0x3,%esi
+}
+80104625:	89 f0                	mov    %esi,%eax
+80104627:	5b                   	pop    %ebx
+80104628:	5e                   	pop    %esi
+80104629:	5d                   	pop    %ebp
+8010462a:	c3                   	ret
+8010462b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010462f:	90                   	nop
+
+80104630 <lapicinit>:
+
+void
+lapicinit(void)
+{
+  if(!lapic)
+80104630:	8b 0d e8 df 13 80    	mov    0x8013dfe8,%ecx
+80104636:	85 c9                	test   %ecx,%ecx
+80104638:	0f 84 e2 01 00 00    	je     80104820 <lapicinit+0x1f0>
+{
+8010463e:	55                   	push   %ebp
+8010463f:	89 e5                	mov    %esp,%ebp
+80104641:	57                   	push   %edi
+80104642:	56                   	push   %esi
+80104643:	53                   	push   %ebx
+80104644:	83 ec 14             	sub    $0x14,%esp
+  // The timer repeatedly counts down at bus frequency
+  // from lapic[TICR] and then issues an interrupt.
+  // The first CPU up measures the bus frequency, so
+  // that TICR gives HZ interrupts a second.
+  lapicw(TDCR, X1);
+  if(lapictick == 0)
+80104647:	8b 1d fc df 13 80    	mov    0x8013dffc,%ebx
+  lapic[index] = value;
+8010464d:	c7 81 f0 00 00 00 3f 	movl   $0x13f,0xf0(%ecx)
+80104654:	01 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104657:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+8010465a:	c7 81 e0 03 00 00 0b 	movl   $0xb,0x3e0(%ecx)
+80104661:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104664:	8b 41 20             	mov    0x20(%ecx),%eax
+  if(lapictick == 0)
+80104667:	85 db                	test   %ebx,%ebx
+80104669:	0f 84 c9 00 00 00    	je     80104738 <lapicinit+0x108>
+  lapic[index] = value;
+8010466f:	c7 81 20 03 00 00 20 	movl   $0x20020,0x320(%ecx)
+80104676:	00 02 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104679:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+8010467c:	89 99 80 03 00 00    	mov    %ebx,0x380(%ecx)
+  lapic[ID];  // wait for write to finish, by reading
+80104682:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80104685:	c7 81 50 03 00 00 00 	movl   $0x10000,0x350(%ecx)
+8010468c:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+8010468f:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80104692:	c7 81 60 03 00 00 00 	movl   $0x10000,0x360(%ecx)
+80104699:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+8010469c:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapicw(LINT0, MASKED);
+  lapicw(LINT1, MASKED);
+
+  // Disable performance counter overflow interrupts
+  // on machines that provide that interrupt entry.
+  if(((lapic[VER]>>16) & 0xFF) >= 4)
+8010469f:	8b 41 30             	mov    0x30(%ecx),%eax
+801046a2:	c1 e8 10             	shr    $0x10,%eax
+801046a5:	a8 fc                	test   $0xfc,%al
+801046a7:	75 77                	jne    80104720 <lapicinit+0xf0>
+  lapic[index] = value;
+801046a9:	c7 81 70 03 00 00 33 	movl   $0x33,0x370(%ecx)
+801046b0:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+801046b3:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+801046b6:	c7 81 80 02 00 00 00 	movl   $0x0,0x280(%ecx)
+801046bd:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+801046c0:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+801046c3:	c7 81 80 02 00 00 00 	movl   $0x0,0x280(%ecx)
+801046ca:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+801046cd:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+801046d0:	c7 81 b0 00 00 00 00 	movl   $0x0,0xb0(%ecx)
+801046d7:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+801046da:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+801046dd:	c7 81 10 03 00 00 00 	movl   $0x0,0x310(%ecx)
+801046e4:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+801046e7:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+801046ea:	c7 81 00 03 00 00 00 	movl   $0x88500,0x300(%ecx)
+801046f1:	85 08 00 
+  lapic[ID];  // wait for write to finish, by reading
+801046f4:	8b 41 20             	mov    0x20(%ecx),%eax
+801046f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801046fe:	66 90                	xchg   %ax,%ax
+  lapicw(EOI, 0);
+
+  // Send an Init Level De-Assert to synchronise arbitration ID's.
+  lapicw(ICRHI, 0);
+  lapicw(ICRLO, BCAST | INIT | LEVEL);
+  while(lapic[ICRLO] & DELIVS)
+80104700:	8b 81 00 03 00 00    	mov    0x300(%ecx),%eax
+80104706:	f6 c4 10             	test   $0x10,%ah
+80104709:	75 f5                	jne    80104700 <lapicinit+0xd0>
+  lapic[index] = value;
+8010470b:	c7 81 80 00 00 00 00 	movl   $0x0,0x80(%ecx)
+80104712:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104715:	8b 41 20             	mov    0x20(%ecx),%eax
+    ;
+
+  // Enable interrupts on the APIC (but not on the processor).
+  lapicw(TPR, 0);
+}
+80104718:	83 c4 14             	add    $0x14,%esp
+8010471b:	5b                   	pop    %ebx
+8010471c:	5e                   	pop    %esi
+8010471d:	5f                   	pop    %edi
+8010471e:	5d                   	pop    %ebp
+8010471f:	c3                   	ret
+  lapic[index] = value;
+80104720:	c7 81 40 03 00 00 00 	movl   $0x10000,0x340(%ecx)
+80104727:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+8010472a:	8b 41 20             	mov    0x20(%ecx),%eax
+}
+8010472d:	e9 77 ff ff ff       	jmp    801046a9 <lapicinit+0x79>
+80104732:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104738:	be 61 00 00 00       	mov    $0x61,%esi
+8010473d:	89 f2                	mov    %esi,%edx
+8010473f:	ec                   	in     (%dx),%al
+  gate = inb(PIT_GATE) & ~0x03;
+80104740:	83 e0 fc             	and    $0xfffffffc,%eax
+80104743:	89 c3                	mov    %eax,%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104745:	ee                   	out    %al,(%dx)
+80104746:	b8 b0 ff ff ff       	mov    $0xffffffb0,%eax
+8010474b:	ba 43 00 00 00       	mov    $0x43,%edx
+80104750:	ee                   	out    %al,(%dx)
+80104751:	ba 42 00 00 00       	mov    $0x42,%edx
+80104756:	b8 9b ff ff ff       	mov    $0xffffff9b,%eax
+8010475b:	ee                   	out    %al,(%dx)
+8010475c:	b8 2e 00 00 00       	mov    $0x2e,%eax
+80104761:	ee                   	out    %al,(%dx)
+  lapic[index] = value;
+80104762:	c7 81 20 03 00 00 00 	movl   $0x10000,0x320(%ecx)
+80104769:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+8010476c:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+8010476f:	c7 81 80 03 00 00 ff 	movl   $0xffffffff,0x380(%ecx)
+80104776:	ff ff ff 
+  lapic[ID];  // wait for write to finish, by reading
+80104779:	8b 41 20             	mov    0x20(%ecx),%eax
+  asm volatile("rdtsc" : "=A" (t));
+8010477c:	0f 31                	rdtsc
+8010477e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  outb(PIT_GATE, gate | 0x01);  // start counting
+80104781:	89 d8                	mov    %ebx,%eax
+80104783:	89 55 ec             	mov    %edx,-0x14(%ebp)
+80104786:	83 c8 01             	or     $0x1,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104789:	89 f2                	mov    %esi,%edx
+8010478b:	ee                   	out    %al,(%dx)
+8010478c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104790:	ec                   	in     (%dx),%al
+  while((inb(PIT_GATE) & 0x20) == 0)
+80104791:	a8 20                	test   $0x20,%al
+80104793:	74 fb                	je     80104790 <lapicinit+0x160>
+  n = 0xffffffff - lapic[TCCR];
+80104795:	8b 99 90 03 00 00    	mov    0x390(%ecx),%ebx
+  asm volatile("rdtsc" : "=A" (t));
+8010479b:	0f 31                	rdtsc
+  lapic[index] = value;
+8010479d:	c7 81 80 03 00 00 00 	movl   $0x0,0x380(%ecx)
+801047a4:	00 00 00 
+  n = 0xffffffff - lapic[TCCR];
+801047a7:	f7 d3                	not    %ebx
+801047a9:	89 c6                	mov    %eax,%esi
+  lapic[ID];  // wait for write to finish, by reading
+801047ab:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapictick = n * (1000/HZ) / CALIBMS;
+801047ae:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+801047b1:	01 c0                	add    %eax,%eax
+801047b3:	89 c3                	mov    %eax,%ebx
+801047b5:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+801047ba:	f7 e3                	mul    %ebx
+  t = rdtsc() - t;
+801047bc:	89 f0                	mov    %esi,%eax
+  lapictick = n * (1000/HZ) / CALIBMS;
+801047be:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+801047c1:	c1 ea 03             	shr    $0x3,%edx
+  t = rdtsc() - t;
+801047c4:	2b 45 e8             	sub    -0x18(%ebp),%eax
+  tscperms = (uint)t / CALIBMS;
+801047c7:	89 c6                	mov    %eax,%esi
+801047c9:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  lapictick = n * (1000/HZ) / CALIBMS;
+801047ce:	89 15 fc df 13 80    	mov    %edx,0x8013dffc
+801047d4:	89 d3                	mov    %edx,%ebx
+  tscperms = (uint)t / CALIBMS;
+801047d6:	f7 e6                	mul    %esi
+801047d8:	89 d7                	mov    %edx,%edi
+801047da:	c1 ef 03             	shr    $0x3,%edi
+  if(lapictick == 0)
+801047dd:	83 7d e4 09          	cmpl   $0x9,-0x1c(%ebp)
+  tscperms = (uint)t / CALIBMS;
+801047e1:	89 3d f8 df 13 80    	mov    %edi,0x8013dff8
+  if(lapictick == 0)
+801047e7:	77 0f                	ja     801047f8 <lapicinit+0x1c8>
+    lapictick = 10000000;
+801047e9:	c7 05 fc df 13 80 80 	movl   $0x989680,0x8013dffc
+801047f0:	96 98 00 
+801047f3:	bb 80 96 98 00       	mov    $0x989680,%ebx
+  if(tscperms == 0)
+801047f8:	83 fe 09             	cmp    $0x9,%esi
+801047fb:	77 0a                	ja     80104807 <lapicinit+0x1d7>
+    tscperms = 1000000;
+801047fd:	c7 05 f8 df 13 80 40 	movl   $0xf4240,0x8013dff8
+80104804:	42 0f 00 
+80104807:	0f 31                	rdtsc
+  tsc0 = rdtsc();
+80104809:	a3 f0 df 13 80       	mov    %eax,0x8013dff0
+8010480e:	89 15 f4 df 13 80    	mov    %edx,0x8013dff4
+}
+80104814:	e9 56 fe ff ff       	jmp    8010466f <lapicinit+0x3f>
+80104819:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104820:	c3                   	ret
+80104821:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104828:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010482f:	90                   	nop
+
+80104830 <lapicid>:
+
+int
+lapicid(void)
+{
+  if (!lapic)
+80104830:	a1 e8 df 13 80       	mov    0x8013dfe8,%eax
+80104835:	85 c0                	test   %eax,%eax
+80104837:	74 07                	je     80104840 <lapicid+0x10>
+    return 0;
+  return lapic[ID] >> 24;
+80104839:	8b 40 20             	mov    0x20(%eax),%eax
+8010483c:	c1 e8 18             	shr    $0x18,%eax
+8010483f:	c3                   	ret
+    return 0;
+80104840:	31 c0                	xor    %eax,%eax
+}
+80104842:	c3                   	ret
+80104843:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010484a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80104850 <lapiceoi>:
+
+// Acknowledge interrupt.
+void
+lapiceoi(void)
+{
+  if(lapic)
+80104850:	a1 e8 df 13 80       	mov    0x8013dfe8,%eax
+80104855:	85 c0                	test   %eax,%eax
+80104857:	74 0d                	je     80104866 <lapiceoi+0x16>
+  lapic[index] = value;
+80104859:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+80104860:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104863:	8b 40 20             	mov    0x20(%eax),%eax
+    lapicw(EOI, 0);
+}
+80104866:	c3                   	ret
+80104867:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010486e:	66 90                	xchg   %ax,%ax
+
+80104870 <microdelay>:
+// Spin for a given number of microseconds.
+// On real hardware would want to tune this dynamically.
+void
+microdelay(int us)
+{
+}
+80104870:	c3                   	ret
+80104871:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104878:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010487f:	90                   	nop
+
+80104880 <lapicstartap>:
+
+// Start additional processor running entry code at addr.
+// See Appendix B of MultiProcessor Specification.
+void
+lapicstartap(uchar apicid, uint addr)
+{
+80104880:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104881:	b8 0f 00 00 00       	mov    $0xf,%eax
+80104886:	ba 70 00 00 00       	mov    $0x70,%edx
+8010488b:	89 e5                	mov    %esp,%ebp
+8010488d:	53                   	push   %ebx
+8010488e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80104891:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80104894:	ee                   	out    %al,(%dx)
+80104895:	b8 0a 00 00 00       	mov    $0xa,%eax
+8010489a:	ba 71 00 00 00       	mov    $0x71,%edx
+8010489f:	ee                   	out    %al,(%dx)
+  // and the warm reset vector (DWORD based at 40:67) to point at
+  // the AP startup code prior to the [universal startup algorithm]."
+  outb(CMOS_PORT, 0xF);  // offset 0xF is shutdown code
+  outb(CMOS_PORT+1, 0x0A);
+  wrv = (ushort*)P2V((0x40<<4 | 0x67));  // Warm reset vector
+  wrv[0] = 0;
+801048a0:	31 c0                	xor    %eax,%eax
+  lapic[index] = value;
+801048a2:	c1 e3 18             	shl    $0x18,%ebx
+  wrv[0] = 0;
+801048a5:	66 a3 67 04 00 80    	mov    %ax,0x80000467
+  wrv[1] = addr >> 4;
+801048ab:	89 c8                	mov    %ecx,%eax
+  // when it is in the halted state due to an INIT.  So the second
+  // should be ignored, but it is part of the official Intel algorithm.
+  // Bochs complains about the second one.  Too bad for Bochs.
+  for(i = 0; i < 2; i++){
+    lapicw(ICRHI, apicid<<24);
+    lapicw(ICRLO, STARTUP | (addr>>12));
+801048ad:	c1 e9 0c             	shr    $0xc,%ecx
+  lapic[index] = value;
+801048b0:	89 da                	mov    %ebx,%edx
+  wrv[1] = addr >> 4;
+801048b2:	c1 e8 04             	shr    $0x4,%eax
+    lapicw(ICRLO, STARTUP | (addr>>12));
+801048b5:	80 cd 06             	or     $0x6,%ch
+  wrv[1] = addr >> 4;
+801048b8:	66 a3 69 04 00 80    	mov    %ax,0x80000469
+  lapic[index] = value;
+801048be:	a1 e8 df 13 80       	mov    0x8013dfe8,%eax
+801048c3:	89 98 10 03 00 00    	mov    %ebx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+801048c9:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+801048cc:	c7 80 00 03 00 00 00 	movl   $0xc500,0x300(%eax)
+801048d3:	c5 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+801048d6:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+801048d9:	c7 80 00 03 00 00 00 	movl   $0x8500,0x300(%eax)
+801048e0:	85 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+801048e3:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+801048e6:	89 90 10 03 00 00    	mov    %edx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+801048ec:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+801048ef:	89 88 00 03 00 00    	mov    %ecx,0x300(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+801048f5:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+801048f8:	89 90 10 03 00 00    	mov    %edx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+801048fe:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80104901:	89 88 00 03 00 00    	mov    %ecx,0x300(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80104907:	8b 40 20             	mov    0x20(%eax),%eax
+    microdelay(200);
+  }
+}
+8010490a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010490d:	c9                   	leave
+8010490e:	c3                   	ret
+8010490f:	90                   	nop
+
+80104910 <cmostime>:
+}
+
+// qemu seems to use 24-hour GWT and the values are BCD encoded
+void
+cmostime(struct rtcdate *r)
+{
+80104910:	55                   	push   %ebp
+80104911:	b8 0b 00 00 00       	mov    $0xb,%eax
+80104916:	ba 70 00 00 00       	mov    $0x70,%edx
+8010491b:	89 e5                	mov    %esp,%ebp
+8010491d:	57                   	push   %edi
+8010491e:	56                   	push   %esi
+8010491f:	53                   	push   %ebx
+80104920:	83 ec 4c             	sub    $0x4c,%esp
+80104923:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104924:	ba 71 00 00 00       	mov    $0x71,%edx
+80104929:	ec                   	in     (%dx),%al
+  struct rtcdate t1, t2;
+  int sb, bcd;
+
+  sb = cmos_read(CMOS_STATB);
+
+  bcd = (sb & (1 << 2)) == 0;
+8010492a:	83 e0 04             	and    $0x4,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010492d:	bf 70 00 00 00       	mov    $0x70,%edi
+80104932:	88 45 b3             	mov    %al,-0x4d(%ebp)
+80104935:	8d 76 00             	lea    0x0(%esi),%esi
+80104938:	31 c0                	xor    %eax,%eax
+8010493a:	89 fa                	mov    %edi,%edx
+8010493c:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010493d:	b9 71 00 00 00       	mov    $0x71,%ecx
+80104942:	89 ca                	mov    %ecx,%edx
+80104944:	ec                   	in     (%dx),%al
+80104945:	88 45 b7             	mov    %al,-0x49(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104948:	89 fa                	mov    %edi,%edx
+8010494a:	b8 02 00 00 00       	mov    $0x2,%eax
+8010494f:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104950:	89 ca                	mov    %ecx,%edx
+80104952:	ec                   	in     (%dx),%al
+80104953:	88 45 b6             	mov    %al,-0x4a(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104956:	89 fa                	mov    %edi,%edx
+80104958:	b8 04 00 00 00       	mov    $0x4,%eax
+8010495d:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010495e:	89 ca                	mov    %ecx,%edx
+80104960:	ec                   	in     (%dx),%al
+80104961:	88 45 b5             	mov    %al,-0x4b(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104964:	89 fa                	mov    %edi,%edx
+80104966:	b8 07 00 00 00       	mov    $0x7,%eax
+8010496b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010496c:	89 ca                	mov    %ecx,%edx
+8010496e:	ec                   	in     (%dx),%al
+8010496f:	88 45 b4             	mov    %al,-0x4c(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104972:	89 fa                	mov    %edi,%edx
+80104974:	b8 08 00 00 00       	mov    $0x8,%eax
+80104979:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010497a:	89 ca                	mov    %ecx,%edx
+8010497c:	ec                   	in     (%dx),%al
+8010497d:	89 c6                	mov    %eax,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010497f:	89 fa                	mov    %edi,%edx
+80104981:	b8 09 00 00 00       	mov    $0x9,%eax
+80104986:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104987:	89 ca                	mov    %ecx,%edx
+80104989:	ec                   	in     (%dx),%al
+8010498a:	0f b6 d8             	movzbl %al,%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010498d:	89 fa                	mov    %edi,%edx
+8010498f:	b8 0a 00 00 00       	mov    $0xa,%eax
+80104994:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104995:	89 ca                	mov    %ecx,%edx
+80104997:	ec                   	in     (%dx),%al
+
+  // make sure CMOS doesn't modify time while we read it
+  for(;;) {
+    fill_rtcdate(&t1);
+    if(cmos_read(CMOS_STATA) & CMOS_UIP)
+80104998:	84 c0                	test   %al,%al
+8010499a:	78 9c                	js     80104938 <cmostime+0x28>
+  return inb(CMOS_RETURN);
+8010499c:	0f b6 45 b7          	movzbl -0x49(%ebp),%eax
+801049a0:	89 f2                	mov    %esi,%edx
+801049a2:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+801049a5:	0f b6 f2             	movzbl %dl,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801049a8:	89 fa                	mov    %edi,%edx
+801049aa:	89 45 b8             	mov    %eax,-0x48(%ebp)
+801049ad:	0f b6 45 b6          	movzbl -0x4a(%ebp),%eax
+801049b1:	89 75 c8             	mov    %esi,-0x38(%ebp)
+801049b4:	89 45 bc             	mov    %eax,-0x44(%ebp)
+801049b7:	0f b6 45 b5          	movzbl -0x4b(%ebp),%eax
+801049bb:	89 45 c0             	mov    %eax,-0x40(%ebp)
+801049be:	0f b6 45 b4          	movzbl -0x4c(%ebp),%eax
+801049c2:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+801049c5:	31 c0                	xor    %eax,%eax
+801049c7:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801049c8:	89 ca                	mov    %ecx,%edx
+801049ca:	ec                   	in     (%dx),%al
+801049cb:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801049ce:	89 fa                	mov    %edi,%edx
+801049d0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+801049d3:	b8 02 00 00 00       	mov    $0x2,%eax
+801049d8:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801049d9:	89 ca                	mov    %ecx,%edx
+801049db:	ec                   	in     (%dx),%al
+801049dc:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801049df:	89 fa                	mov    %edi,%edx
+801049e1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+801049e4:	b8 04 00 00 00       	mov    $0x4,%eax
+801049e9:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801049ea:	89 ca                	mov    %ecx,%edx
+801049ec:	ec                   	in     (%dx),%al
+801049ed:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801049f0:	89 fa                	mov    %edi,%edx
+801049f2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+801049f5:	b8 07 00 00 00       	mov    $0x7,%eax
+801049fa:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801049fb:	89 ca                	mov    %ecx,%edx
+801049fd:	ec                   	in     (%dx),%al
+801049fe:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104a01:	89 fa                	mov    %edi,%edx
+80104a03:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80104a06:	b8 08 00 00 00       	mov    $0x8,%eax
+80104a0b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104a0c:	89 ca                	mov    %ecx,%edx
+80104a0e:	ec                   	in     (%dx),%al
+80104a0f:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104a12:	89 fa                	mov    %edi,%edx
+80104a14:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80104a17:	b8 09 00 00 00       	mov    $0x9,%eax
+80104a1c:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104a1d:	89 ca                	mov    %ecx,%edx
+80104a1f:	ec                   	in     (%dx),%al
+80104a20:	0f b6 c0             	movzbl %al,%eax
+        continue;
+    fill_rtcdate(&t2);
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+80104a23:	83 ec 04             	sub    $0x4,%esp
+  return inb(CMOS_RETURN);
+80104a26:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+80104a29:	8d 45 d0             	lea    -0x30(%ebp),%eax
+80104a2c:	6a 18                	push   $0x18
+80104a2e:	50                   	push   %eax
+80104a2f:	8d 45 b8             	lea    -0x48(%ebp),%eax
+80104a32:	50                   	push   %eax
+80104a33:	e8 08 34 00 00       	call   80107e40 <memcmp>
+80104a38:	83 c4 10             	add    $0x10,%esp
+80104a3b:	85 c0                	test   %eax,%eax
+80104a3d:	0f 85 f5 fe ff ff    	jne    80104938 <cmostime+0x28>
+      break;
+  }
+
+  // convert
+  if(bcd) {
+80104a43:	0f b6 75 b3          	movzbl -0x4d(%ebp),%esi
+80104a47:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80104a4a:	89 f0                	mov    %esi,%eax
+80104a4c:	84 c0                	test   %al,%al
+80104a4e:	75 78                	jne    80104ac8 <cmostime+0x1b8>
+#define    CONV(x)     (t1.x = ((t1.x >> 4) * 10) + (t1.x & 0xf))
+    CONV(second);
+80104a50:	8b 45 b8             	mov    -0x48(%ebp),%eax
+80104a53:	89 c2                	mov    %eax,%edx
+80104a55:	83 e0 0f             	and    $0xf,%eax
+80104a58:	c1 ea 04             	shr    $0x4,%edx
+80104a5b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80104a5e:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104a61:	89 45 b8             	mov    %eax,-0x48(%ebp)
+    CONV(minute);
+80104a64:	8b 45 bc             	mov    -0x44(%ebp),%eax
+80104a67:	89 c2                	mov    %eax,%edx
+80104a69:	83 e0 0f             	and    $0xf,%eax
+80104a6c:	c1 ea 04             	shr    $0x4,%edx
+80104a6f:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80104a72:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104a75:	89 45 bc             	mov    %eax,-0x44(%ebp)
+    CONV(hour  );
+80104a78:	8b 45 c0             	mov    -0x40(%ebp),%eax
+80104a7b:	89 c2                	mov    %eax,%edx
+80104a7d:	83 e0 0f             	and    $0xf,%eax
+80104a80:	c1 ea 04             	shr    $0x4,%edx
+80104a83:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80104a86:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104a89:	89 45 c0             	mov    %eax,-0x40(%ebp)
+    CONV(day   );
+80104a8c:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+80104a8f:	89 c2                	mov    %eax,%edx
+80104a91:	83 e0 0f             	and    $0xf,%eax
+80104a94:	c1 ea 04             	shr    $0x4,%edx
+80104a97:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80104a9a:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104a9d:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    CONV(month );
+80104aa0:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80104aa3:	89 c2                	mov    %eax,%edx
+80104aa5:	83 e0 0f             	and    $0xf,%eax
+80104aa8:	c1 ea 04             	shr    $0x4,%edx
+80104aab:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80104aae:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104ab1:	89 45 c8             	mov    %eax,-0x38(%ebp)
+    CONV(year  );
+80104ab4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80104ab7:	89 c2                	mov    %eax,%edx
+80104ab9:	83 e0 0f             	and    $0xf,%eax
+80104abc:	c1 ea 04             	shr    $0x4,%edx
+80104abf:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80104ac2:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104ac5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+#undef     CONV
+  }
+
+  *r = t1;
+80104ac8:	8b 45 b8             	mov    -0x48(%ebp),%eax
+80104acb:	89 03                	mov    %eax,(%ebx)
+80104acd:	8b 45 bc             	mov    -0x44(%ebp),%eax
+80104ad0:	89 43 04             	mov    %eax,0x4(%ebx)
+80104ad3:	8b 45 c0             	mov    -0x40(%ebp),%eax
+80104ad6:	89 43 08             	mov    %eax,0x8(%ebx)
+80104ad9:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+80104adc:	89 43 0c             	mov    %eax,0xc(%ebx)
+80104adf:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80104ae2:	89 43 10             	mov    %eax,0x10(%ebx)
+80104ae5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80104ae8:	89 43 14             	mov    %eax,0x14(%ebx)
+  r->year += 2000;
+80104aeb:	81 43 14 d0 07 00 00 	addl   $0x7d0,0x14(%ebx)
+}
+80104af2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104af5:	5b                   	pop    %ebx
+80104af6:	5e                   	pop    %esi
+80104af7:	5f                   	pop    %edi
+80104af8:	5d                   	pop    %ebp
+80104af9:	c3                   	ret
+80104afa:	66 90                	xchg   %ax,%ax
+80104afc:	66 90                	xchg   %ax,%ax
+80104afe:	66 90                	xchg   %ax,%ax
+
+80104b00 <write_log>:
+}
+
+// Copy modified blocks from cache to log.
+static void
+write_log(void)
+{
+80104b00:	55                   	push   %ebp
+80104b01:	89 e5                	mov    %esp,%ebp
+80104b03:	57                   	push   %edi
+80104b04:	56                   	push   %esi
+80104b05:	8d bd a8 fe ff ff    	lea    -0x158(%ebp),%edi
+80104b0b:	53                   	push   %ebx
+80104b0c:	81 ec 4c 01 00 00    	sub    $0x14c,%esp
+  struct buf *to[LOGSIZE];
+  int tail;
+
+  for (tail = 0; tail < log.lh.n; tail++) {
+80104b12:	a1 54 e0 13 80       	mov    0x8013e054,%eax
+80104b17:	85 c0                	test   %eax,%eax
+80104b19:	7e 6c                	jle    80104b87 <write_log+0x87>
+80104b1b:	31 db                	xor    %ebx,%ebx
+80104b1d:	8d bd a8 fe ff ff    	lea    -0x158(%ebp),%edi
+80104b23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104b27:	90                   	nop
+    to[tail] = bread(log.dev, log.start+tail+1); // log block
+80104b28:	a1 34 e0 13 80       	mov    0x8013e034,%eax
+80104b2d:	83 ec 08             	sub    $0x8,%esp
+80104b30:	01 d8                	add    %ebx,%eax
+80104b32:	83 c0 01             	add    $0x1,%eax
+80104b35:	50                   	push   %eax
+80104b36:	ff 35 44 e0 13 80    	push   0x8013e044
+80104b3c:	e8 af b9 ff ff       	call   801004f0 <bread>
+80104b41:	89 04 9f             	mov    %eax,(%edi,%ebx,4)
+    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+80104b44:	5a                   	pop    %edx
+80104b45:	59                   	pop    %ecx
+80104b46:	ff 34 9d 58 e0 13 80 	push   -0x7fec1fa8(,%ebx,4)
+80104b4d:	ff 35 44 e0 13 80    	push   0x8013e044
+80104b53:	e8 98 b9 ff ff       	call   801004f0 <bread>
+    memmove(to[tail]->data, from->data, BSIZE);
+80104b58:	83 c4 0c             	add    $0xc,%esp
+80104b5b:	68 00 10 00 00       	push   $0x1000
+    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+80104b60:	89 c6                	mov    %eax,%esi
+    memmove(to[tail]->data, from->data, BSIZE);
+80104b62:	ff 70 60             	push   0x60(%eax)
+80104b65:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  for (tail = 0; tail < log.lh.n; tail++) {
+80104b68:	83 c3 01             	add    $0x1,%ebx
+    memmove(to[tail]->data, from->data, BSIZE);
+80104b6b:	ff 70 60             	push   0x60(%eax)
+80104b6e:	e8 1d 33 00 00       	call   80107e90 <memmove>
+    brelse(from);
+80104b73:	89 34 24             	mov    %esi,(%esp)
+80104b76:	e8 b5 bb ff ff       	call   80100730 <brelse>
+  for (tail = 0; tail < log.lh.n; tail++) {
+80104b7b:	a1 54 e0 13 80       	mov    0x8013e054,%eax
+80104b80:	83 c4 10             	add    $0x10,%esp
+80104b83:	39 d8                	cmp    %ebx,%eax
+80104b85:	7f a1                	jg     80104b28 <write_log+0x28>
+  }
+  bwritev(to, log.lh.n);  // write the log
+80104b87:	83 ec 08             	sub    $0x8,%esp
+80104b8a:	50                   	push   %eax
+80104b8b:	57                   	push   %edi
+80104b8c:	e8 ef b9 ff ff       	call   80100580 <bwritev>
+  for (tail = 0; tail < log.lh.n; tail++)
+80104b91:	a1 54 e0 13 80       	mov    0x8013e054,%eax
+80104b96:	83 c4 10             	add    $0x10,%esp
+80104b99:	85 c0                	test   %eax,%eax
+80104b9b:	7e 1c                	jle    80104bb9 <write_log+0xb9>
+80104b9d:	31 db                	xor    %ebx,%ebx
+80104b9f:	90                   	nop
+    brelse(to[tail]);
+80104ba0:	83 ec 0c             	sub    $0xc,%esp
+80104ba3:	ff 34 9f             	push   (%edi,%ebx,4)
+  for (tail = 0; tail < log.lh.n; tail++)
+80104ba6:	83 c3 01             	add    $0x1,%ebx
+    brelse(to[tail]);
+80104ba9:	e8 82 bb ff ff       	call   80100730 <brelse>
+  for (tail = 0; tail < log.lh.n; tail++)
+80104bae:	83 c4 10             	add    $0x10,%esp
+80104bb1:	39 1d 54 e0 13 80    	cmp    %ebx,0x8013e054
+80104bb7:	7f e7                	jg     80104ba0 <write_log+0xa0>
+}
+80104bb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104bbc:	5b                   	pop    %ebx
+80104bbd:	5e                   	pop    %esi
+80104bbe:	5f                   	pop    %edi
+80104bbf:	5d                   	pop    %ebp
+80104bc0:	c3                   	ret
+80104bc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104bc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104bcf:	90                   	nop
+
+80104bd0 <install_trans>:
+{
+80104bd0:	55                   	push   %ebp
+80104bd1:	89 e5                	mov    %esp,%ebp
+80104bd3:	57                   	push   %edi
+80104bd4:	89 c7                	mov    %eax,%edi
+80104bd6:	56                   	push   %esi
+80104bd7:	8d b5 a8 fe ff ff    	lea    -0x158(%ebp),%esi
+80104bdd:	53                   	push   %ebx
+80104bde:	81 ec 5c 01 00 00    	sub    $0x15c,%esp
+  for (tail = 0; tail < log.lh.n; tail++) {
+80104be4:	a1 54 e0 13 80       	mov    0x8013e054,%eax
+80104be9:	85 c0                	test   %eax,%eax
+80104beb:	0f 8e 8c 00 00 00    	jle    80104c7d <install_trans+0xad>
+80104bf1:	31 db                	xor    %ebx,%ebx
+80104bf3:	8d b5 a8 fe ff ff    	lea    -0x158(%ebp),%esi
+80104bf9:	eb 11                	jmp    80104c0c <install_trans+0x3c>
+80104bfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104bff:	90                   	nop
+80104c00:	a1 54 e0 13 80       	mov    0x8013e054,%eax
+80104c05:	83 c3 01             	add    $0x1,%ebx
+80104c08:	39 d8                	cmp    %ebx,%eax
+80104c0a:	7e 71                	jle    80104c7d <install_trans+0xad>
+    dbuf[tail] = bread(log.dev, log.lh.block[tail]); // read dst
+80104c0c:	83 ec 08             	sub    $0x8,%esp
+80104c0f:	ff 34 9d 58 e0 13 80 	push   -0x7fec1fa8(,%ebx,4)
+80104c16:	ff 35 44 e0 13 80    	push   0x8013e044
+80104c1c:	e8 cf b8 ff ff       	call   801004f0 <bread>
+    if(recovering){
+80104c21:	83 c4 10             	add    $0x10,%esp
+    dbuf[tail] = bread(log.dev, log.lh.block[tail]); // read dst
+80104c24:	89 04 9e             	mov    %eax,(%esi,%ebx,4)
+    if(recovering){
+80104c27:	85 ff                	test   %edi,%edi
+80104c29:	74 d5                	je     80104c00 <install_trans+0x30>
+      struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
+80104c2b:	a1 34 e0 13 80       	mov    0x8013e034,%eax
+80104c30:	83 ec 08             	sub    $0x8,%esp
+80104c33:	01 d8                	add    %ebx,%eax
+80104c35:	83 c0 01             	add    $0x1,%eax
+80104c38:	50                   	push   %eax
+80104c39:	ff 35 44 e0 13 80    	push   0x8013e044
+80104c3f:	e8 ac b8 ff ff       	call   801004f0 <bread>
+      memmove(dbuf[tail]->data, lbuf->data, BSIZE);  // copy block to dst
+80104c44:	83 c4 0c             	add    $0xc,%esp
+80104c47:	68 00 10 00 00       	push   $0x1000
+80104c4c:	ff 70 60             	push   0x60(%eax)
+80104c4f:	89 85 a4 fe ff ff    	mov    %eax,-0x15c(%ebp)
+80104c55:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  for (tail = 0; tail < log.lh.n; tail++) {
+80104c58:	83 c3 01             	add    $0x1,%ebx
+      memmove(dbuf[tail]->data, lbuf->data, BSIZE);  // copy block to dst
+80104c5b:	ff 70 60             	push   0x60(%eax)
+80104c5e:	e8 2d 32 00 00       	call   80107e90 <memmove>
+      brelse(lbuf);
+80104c63:	8b 95 a4 fe ff ff    	mov    -0x15c(%ebp),%edx
+80104c69:	89 14 24             	mov    %edx,(%esp)
+80104c6c:	e8 bf ba ff ff       	call   80100730 <brelse>
+  for (tail = 0; tail < log.lh.n; tail++) {
+80104c71:	a1 54 e0 13 80       	mov    0x8013e054,%eax
+      brelse(lbuf);
+80104c76:	83 c4 10             	add    $0x10,%esp
+  for (tail = 0; tail < log.lh.n; tail++) {
+80104c79:	39 d8                	cmp    %ebx,%eax
+80104c7b:	7f 8f                	jg     80104c0c <install_trans+0x3c>
+  bwritev(dbuf, log.lh.n);  // write dst to disk
+80104c7d:	83 ec 08             	sub    $0x8,%esp
+80104c80:	50                   	push   %eax
+80104c81:	56                   	push   %esi
+80104c82:	e8 f9 b8 ff ff       	call   80100580 <bwritev>
+  for (tail = 0; tail < log.lh.n; tail++)
+80104c87:	a1 54 e0 13 80       	mov    0x8013e054,%eax
+80104c8c:	83 c4 10             	add    $0x10,%esp
+80104c8f:	85 c0                	test   %eax,%eax
+80104c91:	7e 1e                	jle    80104cb1 <install_trans+0xe1>
+80104c93:	31 db                	xor    %ebx,%ebx
+80104c95:	8d 76 00             	lea    0x0(%esi),%esi
+    brelse(dbuf[tail]);
+80104c98:	83 ec 0c             	sub    $0xc,%esp
+80104c9b:	ff 34 9e             	push   (%esi,%ebx,4)
+  for (tail = 0; tail < log.lh.n; tail++)
+80104c9e:	83 c3 01             	add    $0x1,%ebx
+    brelse(dbuf[tail]);
+80104ca1:	e8 8a ba ff ff       	call   80100730 <brelse>
+  for (tail = 0; tail < log.lh.n; tail++)
+80104ca6:	83 c4 10             	add    $0x10,%esp
+80104ca9:	39 1d 54 e0 13 80    	cmp    %ebx,0x8013e054
+80104caf:	7f e7                	jg     80104c98 <install_trans+0xc8>
+}
+80104cb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104cb4:	5b                   	pop    %ebx
+80104cb5:	5e                   	pop    %esi
+80104cb6:	5f                   	pop    %edi
+80104cb7:	5d                   	pop    %ebp
+80104cb8:	c3                   	ret
+80104cb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80104cc0 <write_head>:
+{
+80104cc0:	55                   	push   %ebp
+80104cc1:	89 e5                	mov    %esp,%ebp
+80104cc3:	56                   	push   %esi
+80104cc4:	53                   	push   %ebx
+  struct buf *buf = bread(log.dev, log.start);
+80104cc5:	83 ec 08             	sub    $0x8,%esp
+80104cc8:	ff 35 34 e0 13 80    	push   0x8013e034
+80104cce:	ff 35 44 e0 13 80    	push   0x8013e044
+80104cd4:	e8 17 b8 ff ff       	call   801004f0 <bread>
+  for (i = 0; i < log.lh.n; i++) {
+80104cd9:	83 c4 10             	add    $0x10,%esp
+80104cdc:	31 d2                	xor    %edx,%edx
+  struct logheader *hb = (struct logheader *) (buf->data);
+80104cde:	8b 58 60             	mov    0x60(%eax),%ebx
+  struct buf *buf = bread(log.dev, log.start);
+80104ce1:	89 c6                	mov    %eax,%esi
+  hb->n = log.lh.n;
+80104ce3:	a1 54 e0 13 80       	mov    0x8013e054,%eax
+80104ce8:	89 03                	mov    %eax,(%ebx)
+  for (i = 0; i < log.lh.n; i++) {
+80104cea:	85 c0                	test   %eax,%eax
+80104cec:	7e 18                	jle    80104d06 <write_head+0x46>
+80104cee:	66 90                	xchg   %ax,%ax
+    hb->block[i] = log.lh.block[i];
+80104cf0:	8b 0c 95 58 e0 13 80 	mov    -0x7fec1fa8(,%edx,4),%ecx
+80104cf7:	89 4c 93 04          	mov    %ecx,0x4(%ebx,%edx,4)
+  for (i = 0; i < log.lh.n; i++) {
+80104cfb:	83 c2 01             	add    $0x1,%edx
+80104cfe:	39 15 54 e0 13 80    	cmp    %edx,0x8013e054
+80104d04:	7f ea                	jg     80104cf0 <write_head+0x30>
+  bwrite(buf);
+80104d06:	83 ec 0c             	sub    $0xc,%esp
+80104d09:	56                   	push   %esi
+80104d0a:	e8 31 b8 ff ff       	call   80100540 <bwrite>
+  brelse(buf);
+80104d0f:	89 34 24             	mov    %esi,(%esp)
+80104d12:	e8 19 ba ff ff       	call   80100730 <brelse>
+}
+80104d17:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104d1a:	5b                   	pop    %ebx
+80104d1b:	5e                   	pop    %esi
+80104d1c:	5d                   	pop    %ebp
+80104d1d:	c3                   	ret
+80104d1e:	66 90                	xchg   %ax,%ax
+
+80104d20 <logflusher>:
+{
+80104d20:	55                   	push   %ebp
+80104d21:	89 e5                	mov    %esp,%ebp
+80104d23:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+80104d26:	68 00 e0 13 80       	push   $0x8013e000
+80104d2b:	e8 f0 2f 00 00       	call   80107d20 <acquire>
+80104d30:	83 c4 10             	add    $0x10,%esp
+80104d33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104d37:	90                   	nop
+  if(log.lh.n == 0)
+80104d38:	a1 54 e0 13 80       	mov    0x8013e054,%eax
+80104d3d:	85 c0                	test   %eax,%eax
+80104d3f:	0f 84 e3 00 00 00    	je     80104e28 <logflusher+0x108>
+         log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE ||
+80104d45:	8b 15 4c e0 13 80    	mov    0x8013e04c,%edx
+80104d4b:	85 d2                	test   %edx,%edx
+80104d4d:	0f 8e f5 00 00 00    	jle    80104e48 <logflusher+0x128>
+    acquire(&tickslock);
+80104d53:	83 ec 0c             	sub    $0xc,%esp
+80104d56:	68 60 35 14 80       	push   $0x80143560
+80104d5b:	e8 c0 2f 00 00       	call   80107d20 <acquire>
+    timerdel(myproc());
+80104d60:	e8 eb 17 00 00       	call   80106550 <myproc>
+80104d65:	89 04 24             	mov    %eax,(%esp)
+80104d68:	e8 c3 46 00 00       	call   80109430 <timerdel>
+    release(&tickslock);
+80104d6d:	c7 04 24 60 35 14 80 	movl   $0x80143560,(%esp)
+80104d74:	e8 47 2f 00 00       	call   80107cc0 <release>
+    while(log.outstanding > 0)
+80104d79:	8b 0d 3c e0 13 80    	mov    0x8013e03c,%ecx
+80104d7f:	83 c4 10             	add    $0x10,%esp
+    log.committing = 1;
+80104d82:	c7 05 40 e0 13 80 01 	movl   $0x1,0x8013e040
+80104d89:	00 00 00 
+    while(log.outstanding > 0)
+80104d8c:	85 c9                	test   %ecx,%ecx
+80104d8e:	7e 1f                	jle    80104daf <logflusher+0x8f>
+      sleep(&log.lh, &log.lock);
+80104d90:	83 ec 08             	sub    $0x8,%esp
+80104d93:	68 00 e0 13 80       	push   $0x8013e000
+80104d98:	68 54 e0 13 80       	push   $0x8013e054
+80104d9d:	e8 1e 24 00 00       	call   801071c0 <sleep>
+    while(log.outstanding > 0)
+80104da2:	8b 15 3c e0 13 80    	mov    0x8013e03c,%edx
+80104da8:	83 c4 10             	add    $0x10,%esp
+80104dab:	85 d2                	test   %edx,%edx
+80104dad:	7f e1                	jg     80104d90 <logflusher+0x70>
+    release(&log.lock);
+80104daf:	83 ec 0c             	sub    $0xc,%esp
+80104db2:	68 00 e0 13 80       	push   $0x8013e000
+80104db7:	e8 04 2f 00 00       	call   80107cc0 <release>
+
+static void
+commit()
+{
+  if (log.lh.n > 0) {
+80104dbc:	a1 54 e0 13 80       	mov    0x8013e054,%eax
+80104dc1:	83 c4 10             	add    $0x10,%esp
+80104dc4:	85 c0                	test   %eax,%eax
+80104dc6:	7e 20                	jle    80104de8 <logflusher+0xc8>
+    write_log();     // Write modified blocks from cache to log
+80104dc8:	e8 33 fd ff ff       	call   80104b00 <write_log>
+    write_head();    // Write header to disk -- the real commit
+80104dcd:	e8 ee fe ff ff       	call   80104cc0 <write_head>
+    install_trans(0); // Now install writes to home locations
+80104dd2:	31 c0                	xor    %eax,%eax
+80104dd4:	e8 f7 fd ff ff       	call   80104bd0 <install_trans>
+    log.lh.n = 0;
+80104dd9:	c7 05 54 e0 13 80 00 	movl   $0x0,0x8013e054
+80104de0:	00 00 00 
+    write_head();    // Erase the transaction from the log
+80104de3:	e8 d8 fe ff ff       	call   80104cc0 <write_head>
+    acquire(&log.lock);
+80104de8:	83 ec 0c             	sub    $0xc,%esp
+80104deb:	68 00 e0 13 80       	push   $0x8013e000
+80104df0:	e8 2b 2f 00 00       	call   80107d20 <acquire>
+    wakeup(&log);
+80104df5:	c7 04 24 00 e0 13 80 	movl   $0x8013e000,(%esp)
+    log.ncommit++;
+80104dfc:	83 05 48 e0 13 80 01 	addl   $0x1,0x8013e048
+    log.committing = 0;
+80104e03:	c7 05 40 e0 13 80 00 	movl   $0x0,0x8013e040
+80104e0a:	00 00 00 
+    wakeup(&log);
+80104e0d:	e8 de 26 00 00       	call   801074f0 <wakeup>
+  if(log.lh.n == 0)
+80104e12:	a1 54 e0 13 80       	mov    0x8013e054,%eax
+    while(!flushdue()){
+80104e17:	83 c4 10             	add    $0x10,%esp
+  if(log.lh.n == 0)
+80104e1a:	85 c0                	test   %eax,%eax
+80104e1c:	0f 85 23 ff ff ff    	jne    80104d45 <logflusher+0x25>
+80104e22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      sleep(&log.lh, &log.lock);
+80104e28:	83 ec 08             	sub    $0x8,%esp
+80104e2b:	68 00 e0 13 80       	push   $0x8013e000
+80104e30:	68 54 e0 13 80       	push   $0x8013e054
+80104e35:	e8 86 23 00 00       	call   801071c0 <sleep>
+80104e3a:	83 c4 10             	add    $0x10,%esp
+80104e3d:	e9 f6 fe ff ff       	jmp    80104d38 <logflusher+0x18>
+80104e42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+         log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE ||
+80104e48:	8b 15 3c e0 13 80    	mov    0x8013e03c,%edx
+80104e4e:	8d 54 92 05          	lea    0x5(%edx,%edx,4),%edx
+80104e52:	8d 14 50             	lea    (%eax,%edx,2),%edx
+  return log.syncwait > 0 ||
+80104e55:	83 fa 50             	cmp    $0x50,%edx
+80104e58:	0f 8f f5 fe ff ff    	jg     80104d53 <logflusher+0x33>
+         ticks - log.opened >= LOGDELAY;
+80104e5e:	8b 15 40 35 14 80    	mov    0x80143540,%edx
+80104e64:	2b 15 50 e0 13 80    	sub    0x8013e050,%edx
+         log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE ||
+80104e6a:	83 fa 63             	cmp    $0x63,%edx
+80104e6d:	0f 87 e0 fe ff ff    	ja     80104d53 <logflusher+0x33>
+      if(log.lh.n > 0){
+80104e73:	85 c0                	test   %eax,%eax
+80104e75:	7e b1                	jle    80104e28 <logflusher+0x108>
+        acquire(&tickslock);
+80104e77:	83 ec 0c             	sub    $0xc,%esp
+80104e7a:	68 60 35 14 80       	push   $0x80143560
+80104e7f:	e8 9c 2e 00 00       	call   80107d20 <acquire>
+        timerset(log.opened + LOGDELAY, &log.lh);
+80104e84:	59                   	pop    %ecx
+80104e85:	58                   	pop    %eax
+80104e86:	68 54 e0 13 80       	push   $0x8013e054
+80104e8b:	a1 50 e0 13 80       	mov    0x8013e050,%eax
+80104e90:	83 c0 64             	add    $0x64,%eax
+80104e93:	50                   	push   %eax
+80104e94:	e8 07 46 00 00       	call   801094a0 <timerset>
+        release(&tickslock);
+80104e99:	c7 04 24 60 35 14 80 	movl   $0x80143560,(%esp)
+80104ea0:	e8 1b 2e 00 00       	call   80107cc0 <release>
+80104ea5:	83 c4 10             	add    $0x10,%esp
+80104ea8:	e9 7b ff ff ff       	jmp    80104e28 <logflusher+0x108>
+80104ead:	8d 76 00             	lea    0x0(%esi),%esi
+
+80104eb0 <initlog>:
+{
+80104eb0:	55                   	push   %ebp
+80104eb1:	89 e5                	mov    %esp,%ebp
+80104eb3:	56                   	push   %esi
+80104eb4:	53                   	push   %ebx
+80104eb5:	83 ec 28             	sub    $0x28,%esp
+80104eb8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&log.lock, "log");
+80104ebb:	68 a0 ba 10 80       	push   $0x8010baa0
+80104ec0:	68 00 e0 13 80       	push   $0x8013e000
+80104ec5:	e8 76 2c 00 00       	call   80107b40 <initlock>
+  readsb(dev, &sb);
+80104eca:	8d 45 dc             	lea    -0x24(%ebp),%eax
+80104ecd:	59                   	pop    %ecx
+80104ece:	5e                   	pop    %esi
+80104ecf:	50                   	push   %eax
+80104ed0:	53                   	push   %ebx
+80104ed1:	e8 4a d1 ff ff       	call   80102020 <readsb>
+  log.size = sb.nlog;
+80104ed6:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  log.start = sb.logstart;
+80104ed9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  log.dev = dev;
+80104edc:	89 1d 44 e0 13 80    	mov    %ebx,0x8013e044
+  log.start = sb.logstart;
+80104ee2:	a3 34 e0 13 80       	mov    %eax,0x8013e034
+  log.size = sb.nlog;
+80104ee7:	89 15 38 e0 13 80    	mov    %edx,0x8013e038
+  struct buf *buf = bread(log.dev, log.start);
+80104eed:	5a                   	pop    %edx
+80104eee:	59                   	pop    %ecx
+80104eef:	50                   	push   %eax
+80104ef0:	53                   	push   %ebx
+80104ef1:	e8 fa b5 ff ff       	call   801004f0 <bread>
+  for (i = 0; i < log.lh.n; i++) {
+80104ef6:	83 c4 10             	add    $0x10,%esp
+  struct logheader *lh = (struct logheader *) (buf->data);
+80104ef9:	8b 70 60             	mov    0x60(%eax),%esi
+  log.lh.n = lh->n;
+80104efc:	8b 1e                	mov    (%esi),%ebx
+80104efe:	89 1d 54 e0 13 80    	mov    %ebx,0x8013e054
+  for (i = 0; i < log.lh.n; i++) {
+80104f04:	85 db                	test   %ebx,%ebx
+80104f06:	7e 1a                	jle    80104f22 <initlog+0x72>
+80104f08:	31 d2                	xor    %edx,%edx
+80104f0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    log.lh.block[i] = lh->block[i];
+80104f10:	8b 4c 96 04          	mov    0x4(%esi,%edx,4),%ecx
+80104f14:	89 0c 95 58 e0 13 80 	mov    %ecx,-0x7fec1fa8(,%edx,4)
+  for (i = 0; i < log.lh.n; i++) {
+80104f1b:	83 c2 01             	add    $0x1,%edx
+80104f1e:	39 d3                	cmp    %edx,%ebx
+80104f20:	75 ee                	jne    80104f10 <initlog+0x60>
+  brelse(buf);
+80104f22:	83 ec 0c             	sub    $0xc,%esp
+80104f25:	50                   	push   %eax
+80104f26:	e8 05 b8 ff ff       	call   80100730 <brelse>
+  install_trans(1); // if committed, copy from log to disk
+80104f2b:	b8 01 00 00 00       	mov    $0x1,%eax
+80104f30:	e8 9b fc ff ff       	call   80104bd0 <install_trans>
+  log.lh.n = 0;
+80104f35:	c7 05 54 e0 13 80 00 	movl   $0x0,0x8013e054
+80104f3c:	00 00 00 
+  write_head(); // clear the log
+80104f3f:	e8 7c fd ff ff       	call   80104cc0 <write_head>
+  kthread("logflush", logflusher);
+80104f44:	58                   	pop    %eax
+80104f45:	5a                   	pop    %edx
+80104f46:	68 20 4d 10 80       	push   $0x80104d20
+80104f4b:	68 a4 ba 10 80       	push   $0x8010baa4
+80104f50:	e8 7b 17 00 00       	call   801066d0 <kthread>
+}
+80104f55:	83 c4 10             	add    $0x10,%esp
+80104f58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104f5b:	5b                   	pop    %ebx
+80104f5c:	5e                   	pop    %esi
+80104f5d:	5d                   	pop    %ebp
+80104f5e:	c3                   	ret
+80104f5f:	90                   	nop
+
+80104f60 <begin_op>:
+{
+80104f60:	55                   	push   %ebp
+80104f61:	89 e5                	mov    %esp,%ebp
+80104f63:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+80104f66:	68 00 e0 13 80       	push   $0x8013e000
+80104f6b:	e8 b0 2d 00 00       	call   80107d20 <acquire>
+80104f70:	83 c4 10             	add    $0x10,%esp
+80104f73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104f77:	90                   	nop
+    if(log.committing){
+80104f78:	8b 0d 40 e0 13 80    	mov    0x8013e040,%ecx
+80104f7e:	85 c9                	test   %ecx,%ecx
+80104f80:	75 44                	jne    80104fc6 <begin_op+0x66>
+    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+80104f82:	a1 3c e0 13 80       	mov    0x8013e03c,%eax
+80104f87:	8b 15 54 e0 13 80    	mov    0x8013e054,%edx
+80104f8d:	83 c0 01             	add    $0x1,%eax
+80104f90:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+80104f93:	8d 14 4a             	lea    (%edx,%ecx,2),%edx
+80104f96:	83 fa 50             	cmp    $0x50,%edx
+80104f99:	7e 45                	jle    80104fe0 <begin_op+0x80>
+      wakeup(&log.lh);
+80104f9b:	83 ec 0c             	sub    $0xc,%esp
+80104f9e:	68 54 e0 13 80       	push   $0x8013e054
+80104fa3:	e8 48 25 00 00       	call   801074f0 <wakeup>
+      sleep(&log, &log.lock);
+80104fa8:	58                   	pop    %eax
+80104fa9:	5a                   	pop    %edx
+80104faa:	68 00 e0 13 80       	push   $0x8013e000
+80104faf:	68 00 e0 13 80       	push   $0x8013e000
+80104fb4:	e8 07 22 00 00       	call   801071c0 <sleep>
+    if(log.committing){
+80104fb9:	8b 0d 40 e0 13 80    	mov    0x8013e040,%ecx
+80104fbf:	83 c4 10             	add    $0x10,%esp
+80104fc2:	85 c9                	test   %ecx,%ecx
+80104fc4:	74 bc                	je     80104f82 <begin_op+0x22>
+      sleep(&log, &log.lock);
+80104fc6:	83 ec 08             	sub    $0x8,%esp
+80104fc9:	68 00 e0 13 80       	push   $0x8013e000
+80104fce:	68 00 e0 13 80       	push   $0x8013e000
+80104fd3:	e8 e8 21 00 00       	call   801071c0 <sleep>
+80104fd8:	83 c4 10             	add    $0x10,%esp
+80104fdb:	eb 9b                	jmp    80104f78 <begin_op+0x18>
+80104fdd:	8d 76 00             	lea    0x0(%esi),%esi
+      release(&log.lock);
+80104fe0:	83 ec 0c             	sub    $0xc,%esp
+      log.outstanding += 1;
+80104fe3:	a3 3c e0 13 80       	mov    %eax,0x8013e03c
+      release(&log.lock);
+80104fe8:	68 00 e0 13 80       	push   $0x8013e000
+80104fed:	e8 ce 2c 00 00       	call   80107cc0 <release>
+}
+80104ff2:	83 c4 10             	add    $0x10,%esp
+80104ff5:	c9                   	leave
+80104ff6:	c3                   	ret
+80104ff7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104ffe:	66 90                	xchg   %ax,%ax
+
+80105000 <end_op>:
+{
+80105000:	55                   	push   %ebp
+80105001:	89 e5                	mov    %esp,%ebp
+80105003:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+80105006:	68 00 e0 13 80       	push   $0x8013e000
+8010500b:	e8 10 2d 00 00       	call   80107d20 <acquire>
+  log.outstanding -= 1;
+80105010:	a1 3c e0 13 80       	mov    0x8013e03c,%eax
+  if(log.committing){
+80105015:	8b 15 40 e0 13 80    	mov    0x8013e040,%edx
+8010501b:	83 c4 10             	add    $0x10,%esp
+  log.outstanding -= 1;
+8010501e:	83 e8 01             	sub    $0x1,%eax
+80105021:	a3 3c e0 13 80       	mov    %eax,0x8013e03c
+  if(log.committing){
+80105026:	85 d2                	test   %edx,%edx
+80105028:	74 2e                	je     80105058 <end_op+0x58>
+    if(log.outstanding == 0)
+8010502a:	85 c0                	test   %eax,%eax
+8010502c:	74 12                	je     80105040 <end_op+0x40>
+  release(&log.lock);
+8010502e:	83 ec 0c             	sub    $0xc,%esp
+80105031:	68 00 e0 13 80       	push   $0x8013e000
+80105036:	e8 85 2c 00 00       	call   80107cc0 <release>
+}
+8010503b:	83 c4 10             	add    $0x10,%esp
+8010503e:	c9                   	leave
+8010503f:	c3                   	ret
+      wakeup(&log.lh);
+80105040:	83 ec 0c             	sub    $0xc,%esp
+80105043:	68 54 e0 13 80       	push   $0x8013e054
+80105048:	e8 a3 24 00 00       	call   801074f0 <wakeup>
+8010504d:	83 c4 10             	add    $0x10,%esp
+80105050:	eb dc                	jmp    8010502e <end_op+0x2e>
+80105052:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wakeup(&log);
+80105058:	83 ec 0c             	sub    $0xc,%esp
+8010505b:	68 00 e0 13 80       	push   $0x8013e000
+80105060:	e8 8b 24 00 00       	call   801074f0 <wakeup>
+80105065:	83 c4 10             	add    $0x10,%esp
+80105068:	eb c4                	jmp    8010502e <end_op+0x2e>
+8010506a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80105070 <log_sync>:
+{
+80105070:	55                   	push   %ebp
+80105071:	89 e5                	mov    %esp,%ebp
+80105073:	53                   	push   %ebx
+80105074:	83 ec 10             	sub    $0x10,%esp
+  acquire(&log.lock);
+80105077:	68 00 e0 13 80       	push   $0x8013e000
+8010507c:	e8 9f 2c 00 00       	call   80107d20 <acquire>
+  if(log.committing || log.lh.n > 0){
+80105081:	8b 15 40 e0 13 80    	mov    0x8013e040,%edx
+80105087:	83 c4 10             	add    $0x10,%esp
+8010508a:	85 d2                	test   %edx,%edx
+8010508c:	75 09                	jne    80105097 <log_sync+0x27>
+8010508e:	a1 54 e0 13 80       	mov    0x8013e054,%eax
+80105093:	85 c0                	test   %eax,%eax
+80105095:	7e 4d                	jle    801050e4 <log_sync+0x74>
+    wakeup(&log.lh);
+80105097:	83 ec 0c             	sub    $0xc,%esp
+    log.syncwait++;
+8010509a:	83 05 4c e0 13 80 01 	addl   $0x1,0x8013e04c
+    n = log.ncommit + 1;
+801050a1:	8b 1d 48 e0 13 80    	mov    0x8013e048,%ebx
+    wakeup(&log.lh);
+801050a7:	68 54 e0 13 80       	push   $0x8013e054
+801050ac:	e8 3f 24 00 00       	call   801074f0 <wakeup>
+    while(log.ncommit < n)
+801050b1:	83 c4 10             	add    $0x10,%esp
+801050b4:	3b 1d 48 e0 13 80    	cmp    0x8013e048,%ebx
+801050ba:	7c 21                	jl     801050dd <log_sync+0x6d>
+801050bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      sleep(&log, &log.lock);
+801050c0:	83 ec 08             	sub    $0x8,%esp
+801050c3:	68 00 e0 13 80       	push   $0x8013e000
+801050c8:	68 00 e0 13 80       	push   $0x8013e000
+801050cd:	e8 ee 20 00 00       	call   801071c0 <sleep>
+    while(log.ncommit < n)
+801050d2:	83 c4 10             	add    $0x10,%esp
+801050d5:	3b 1d 48 e0 13 80    	cmp    0x8013e048,%ebx
+801050db:	7d e3                	jge    801050c0 <log_sync+0x50>
+    log.syncwait--;
+801050dd:	83 2d 4c e0 13 80 01 	subl   $0x1,0x8013e04c
+  release(&log.lock);
+801050e4:	83 ec 0c             	sub    $0xc,%esp
+801050e7:	68 00 e0 13 80       	push   $0x8013e000
+801050ec:	e8 cf 2b 00 00       	call   80107cc0 <release>
+}
+801050f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801050f4:	83 c4 10             	add    $0x10,%esp
+801050f7:	c9                   	leave
+801050f8:	c3                   	ret
+801050f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80105100 <log_write>:
+//   modify bp->data[]
+//   log_write(bp)
+//   brelse(bp)
+void
+log_write(struct buf *b)
+{
+80105100:	55                   	push   %ebp
+80105101:	89 e5                	mov    %esp,%ebp
+80105103:	53                   	push   %ebx
+80105104:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+80105107:	8b 15 54 e0 13 80    	mov    0x8013e054,%edx
+{
+8010510d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+80105110:	83 fa 4f             	cmp    $0x4f,%edx
+80105113:	0f 8f b9 00 00 00    	jg     801051d2 <log_write+0xd2>
+80105119:	a1 38 e0 13 80       	mov    0x8013e038,%eax
+8010511e:	83 e8 01             	sub    $0x1,%eax
+80105121:	39 c2                	cmp    %eax,%edx
+80105123:	0f 8d a9 00 00 00    	jge    801051d2 <log_write+0xd2>
+    panic("too big a transaction");
+  if (log.outstanding < 1)
+80105129:	a1 3c e0 13 80       	mov    0x8013e03c,%eax
+8010512e:	85 c0                	test   %eax,%eax
+80105130:	0f 8e a9 00 00 00    	jle    801051df <log_write+0xdf>
+    panic("log_write outside of trans");
+
+  acquire(&log.lock);
+80105136:	83 ec 0c             	sub    $0xc,%esp
+80105139:	68 00 e0 13 80       	push   $0x8013e000
+8010513e:	e8 dd 2b 00 00       	call   80107d20 <acquire>
+  for (i = 0; i < log.lh.n; i++) {
+80105143:	8b 15 54 e0 13 80    	mov    0x8013e054,%edx
+80105149:	83 c4 10             	add    $0x10,%esp
+8010514c:	85 d2                	test   %edx,%edx
+8010514e:	7e 52                	jle    801051a2 <log_write+0xa2>
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+80105150:	8b 4b 08             	mov    0x8(%ebx),%ecx
+  for (i = 0; i < log.lh.n; i++) {
+80105153:	31 c0                	xor    %eax,%eax
+80105155:	eb 10                	jmp    80105167 <log_write+0x67>
+80105157:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010515e:	66 90                	xchg   %ax,%ax
+80105160:	83 c0 01             	add    $0x1,%eax
+80105163:	39 c2                	cmp    %eax,%edx
+80105165:	74 29                	je     80105190 <log_write+0x90>
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+80105167:	39 0c 85 58 e0 13 80 	cmp    %ecx,-0x7fec1fa8(,%eax,4)
+8010516e:	75 f0                	jne    80105160 <log_write+0x60>
+      break;
+  }
+  log.lh.block[i] = b->blockno;
+80105170:	89 0c 85 58 e0 13 80 	mov    %ecx,-0x7fec1fa8(,%eax,4)
+  if (i == log.lh.n){
+80105177:	39 c2                	cmp    %eax,%edx
+80105179:	74 1c                	je     80105197 <log_write+0x97>
+      // first write of a new group; start its clock.
+      log.opened = ticks;
+      wakeup(&log.lh);
+    }
+  }
+  b->flags |= B_DIRTY; // prevent eviction
+8010517b:	83 0b 04             	orl    $0x4,(%ebx)
+  release(&log.lock);
+}
+8010517e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  release(&log.lock);
+80105181:	c7 45 08 00 e0 13 80 	movl   $0x8013e000,0x8(%ebp)
+}
+80105188:	c9                   	leave
+  release(&log.lock);
+80105189:	e9 32 2b 00 00       	jmp    80107cc0 <release>
+8010518e:	66 90                	xchg   %ax,%ax
+  log.lh.block[i] = b->blockno;
+80105190:	89 0c 95 58 e0 13 80 	mov    %ecx,-0x7fec1fa8(,%edx,4)
+    if (log.lh.n++ == 0){
+80105197:	83 c2 01             	add    $0x1,%edx
+8010519a:	89 15 54 e0 13 80    	mov    %edx,0x8013e054
+801051a0:	eb d9                	jmp    8010517b <log_write+0x7b>
+  log.lh.block[i] = b->blockno;
+801051a2:	8b 43 08             	mov    0x8(%ebx),%eax
+801051a5:	a3 58 e0 13 80       	mov    %eax,0x8013e058
+  if (i == log.lh.n){
+801051aa:	75 cf                	jne    8010517b <log_write+0x7b>
+      log.opened = ticks;
+801051ac:	a1 40 35 14 80       	mov    0x80143540,%eax
+      wakeup(&log.lh);
+801051b1:	83 ec 0c             	sub    $0xc,%esp
+    if (log.lh.n++ == 0){
+801051b4:	c7 05 54 e0 13 80 01 	movl   $0x1,0x8013e054
+801051bb:	00 00 00 
+      log.opened = ticks;
+801051be:	a3 50 e0 13 80       	mov    %eax,0x8013e050
+      wakeup(&log.lh);
+801051c3:	68 54 e0 13 80       	push   $0x8013e054
+801051c8:	e8 23 23 00 00       	call   801074f0 <wakeup>
+801051cd:	83 c4 10             	add    $0x10,%esp
+801051d0:	eb a9                	jmp    8010517b <log_write+0x7b>
+    panic("too big a transaction");
+801051d2:	83 ec 0c             	sub    $0xc,%esp
+801051d5:	68 ad ba 10 80       	push   $0x8010baad
+801051da:	e8 a1 b6 ff ff       	call   80100880 <panic>
+    panic("log_write outside of trans");
+801051df:	83 ec 0c             	sub    $0xc,%esp
+801051e2:	68 c3 ba 10 80       	push   $0x8010bac3
+801051e7:	e8 94 b6 ff ff       	call   80100880 <panic>
+801051ec:	66 90                	xchg   %ax,%ax
+801051ee:	66 90                	xchg   %ax,%ax
+
+801051f0 <mpmain>:
+}
+
+// Common CPU setup code.
+static void
+mpmain(void)
+{
+801051f0:	55                   	push   %ebp
+801051f1:	89 e5                	mov    %esp,%ebp
+801051f3:	53                   	push   %ebx
+801051f4:	83 ec 04             	sub    $0x4,%esp
+  cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
+801051f7:	e8 d4 10 00 00       	call   801062d0 <cpuid>
+801051fc:	89 c3                	mov    %eax,%ebx
+801051fe:	e8 cd 10 00 00       	call   801062d0 <cpuid>
+80105203:	83 ec 04             	sub    $0x4,%esp
+80105206:	53                   	push   %ebx
+80105207:	50                   	push   %eax
+80105208:	68 de ba 10 80       	push   $0x8010bade
+8010520d:	e8 9e b9 ff ff       	call   80100bb0 <cprintf>
+  idtinit();       // load idt register
+80105212:	e8 49 45 00 00       	call   80109760 <idtinit>
+  xchg(&(mycpu()->started), 1); // tell startothers() we're up
+80105217:	e8 54 10 00 00       	call   80106270 <mycpu>
+8010521c:	89 c2                	mov    %eax,%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+8010521e:	b8 01 00 00 00       	mov    $0x1,%eax
+80105223:	f0 87 82 a0 00 00 00 	lock xchg %eax,0xa0(%edx)
+  scheduler();     // start running processes
+8010522a:	e8 71 18 00 00       	call   80106aa0 <scheduler>
+8010522f:	90                   	nop
+
+80105230 <mpenter>:
+{
+80105230:	55                   	push   %ebp
+80105231:	89 e5                	mov    %esp,%ebp
+80105233:	83 ec 08             	sub    $0x8,%esp
+  switchkvm();
+80105236:	e8 05 57 00 00       	call   8010a940 <switchkvm>
+  seginit();
+8010523b:	e8 70 56 00 00       	call   8010a8b0 <seginit>
+  lapicinit();
+80105240:	e8 eb f3 ff ff       	call   80104630 <lapicinit>
+  mpmain();
+80105245:	e8 a6 ff ff ff       	call   801051f0 <mpmain>
+8010524a:	66 90                	xchg   %ax,%ax
+8010524c:	66 90                	xchg   %ax,%ax
+8010524e:	66 90                	xchg   %ax,%ax
+
+80105250 <main>:
+{
+80105250:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+80105254:	83 e4 f0             	and    $0xfffffff0,%esp
+80105257:	ff 71 fc             	push   -0x4(%ecx)
+8010525a:	55                   	push   %ebp
+8010525b:	89 e5                	mov    %esp,%ebp
+8010525d:	53                   	push   %ebx
+8010525e:	51                   	push   %ecx
+  kinit1(end, P2V(ENTRYTOP)); // phys page allocator
+8010525f:	83 ec 08             	sub    $0x8,%esp
+80105262:	68 00 00 00 81       	push   $0x81000000
+80105267:	68 b0 4d 14 80       	push   $0x80144db0
+8010526c:	e8 ef ee ff ff       	call   80104160 <kinit1>
+  kvmalloc();      // kernel page table
+80105271:	e8 8a 5b 00 00       	call   8010ae00 <kvmalloc>
+  mpinit();        // detect other processors
+80105276:	e8 85 01 00 00       	call   80105400 <mpinit>
+  lapicinit();     // interrupt controller
+8010527b:	e8 b0 f3 ff ff       	call   80104630 <lapicinit>
+  seginit();       // segment descriptors
+80105280:	e8 2b 56 00 00       	call   8010a8b0 <seginit>
+  picinit();       // disable pic
+80105285:	e8 86 03 00 00       	call   80105610 <picinit>
+  ioapicinit();    // another interrupt controller
+8010528a:	e8 b1 eb ff ff       	call   80103e40 <ioapicinit>
+  consoleinit();   // console hardware
+8010528f:	e8 0c bd ff ff       	call   80100fa0 <consoleinit>
+  uartinit();      // serial port
+80105294:	e8 87 48 00 00       	call   80109b20 <uartinit>
+  pinit();         // process table
+80105299:	e8 82 0f 00 00       	call   80106220 <pinit>
+  tvinit();        // trap vectors
+8010529e:	e8 3d 44 00 00       	call   801096e0 <tvinit>
+  fileinit();      // file table
+801052a3:	e8 c8 c0 ff ff       	call   80101370 <fileinit>
+  ideinit();       // disk 
+801052a8:	e8 b3 e6 ff ff       	call   80103960 <ideinit>
+
+  // Write entry code to unused memory at 0x7000.
+  // The linker has placed the image of entryother.S in
+  // _binary_entryother_start.
+  code = P2V(0x7000);
+  memmove(code, _binary_entryother_start, (uint)_binary_entryother_size);
+801052ad:	83 c4 0c             	add    $0xc,%esp
+801052b0:	68 8a 00 00 00       	push   $0x8a
+801052b5:	68 8c f4 10 80       	push   $0x8010f48c
+801052ba:	68 00 70 00 80       	push   $0x80007000
+801052bf:	e8 cc 2b 00 00       	call   80107e90 <memmove>
+
+  for(c = cpus; c < cpus+ncpu; c++){
+801052c4:	83 c4 10             	add    $0x10,%esp
+801052c7:	69 05 a4 e1 13 80 b4 	imul   $0xb4,0x8013e1a4,%eax
+801052ce:	00 00 00 
+801052d1:	05 c0 e1 13 80       	add    $0x8013e1c0,%eax
+801052d6:	3d c0 e1 13 80       	cmp    $0x8013e1c0,%eax
+801052db:	76 7b                	jbe    80105358 <main+0x108>
+801052dd:	bb c0 e1 13 80       	mov    $0x8013e1c0,%ebx
+801052e2:	eb 1d                	jmp    80105301 <main+0xb1>
+801052e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801052e8:	69 05 a4 e1 13 80 b4 	imul   $0xb4,0x8013e1a4,%eax
+801052ef:	00 00 00 
+801052f2:	81 c3 b4 00 00 00    	add    $0xb4,%ebx
+801052f8:	05 c0 e1 13 80       	add    $0x8013e1c0,%eax
+801052fd:	39 c3                	cmp    %eax,%ebx
+801052ff:	73 57                	jae    80105358 <main+0x108>
+    if(c == mycpu())  // We've started already.
+80105301:	e8 6a 0f 00 00       	call   80106270 <mycpu>
+80105306:	39 c3                	cmp    %eax,%ebx
+80105308:	74 de                	je     801052e8 <main+0x98>
+      continue;
+
+    // Tell entryother.S what stack to use, where to enter, and what
+    // pgdir to use. We cannot use kpgdir yet, because the AP processor
+    // is running in low  memory, so we use entrypgdir for the APs too.
+    stack = kalloc();
+8010530a:	e8 d1 ee ff ff       	call   801041e0 <kalloc>
+    *(void**)(code-4) = stack + KSTACKSIZE;
+    *(void(**)(void))(code-8) = mpenter;
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+
+    lapicstartap(c->apicid, V2P(code));
+8010530f:	83 ec 08             	sub    $0x8,%esp
+    *(void(**)(void))(code-8) = mpenter;
+80105312:	c7 05 f8 6f 00 80 30 	movl   $0x80105230,0x80006ff8
+80105319:	52 10 80 
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+8010531c:	c7 05 f4 6f 00 80 00 	movl   $0x10e000,0x80006ff4
+80105323:	e0 10 00 
+    *(void**)(code-4) = stack + KSTACKSIZE;
+80105326:	05 00 10 00 00       	add    $0x1000,%eax
+8010532b:	a3 fc 6f 00 80       	mov    %eax,0x80006ffc
+    lapicstartap(c->apicid, V2P(code));
+80105330:	0f b6 03             	movzbl (%ebx),%eax
+80105333:	68 00 70 00 00       	push   $0x7000
+80105338:	50                   	push   %eax
+80105339:	e8 42 f5 ff ff       	call   80104880 <lapicstartap>
+
+    // wait for cpu to finish mpmain()
+    while(c->started == 0)
+8010533e:	83 c4 10             	add    $0x10,%esp
+80105341:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105348:	8b 83 a0 00 00 00    	mov    0xa0(%ebx),%eax
+8010534e:	85 c0                	test   %eax,%eax
+80105350:	74 f6                	je     80105348 <main+0xf8>
+80105352:	eb 94                	jmp    801052e8 <main+0x98>
+80105354:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  kinit2(P2V(ENTRYTOP), P2V(PHYSTOP)); // must come after startothers()
+80105358:	83 ec 08             	sub    $0x8,%esp
+8010535b:	68 00 00 00 8e       	push   $0x8e000000
+80105360:	68 00 00 00 81       	push   $0x81000000
+80105365:	e8 86 ed ff ff       	call   801040f0 <kinit2>
+  binit();         // buffer cache; allocates pages
+8010536a:	e8 91 b0 ff ff       	call   80100400 <binit>
+  userinit();      // first user process
+8010536f:	e8 0c 12 00 00       	call   80106580 <userinit>
+  mpmain();        // finish this processor's setup
+80105374:	e8 77 fe ff ff       	call   801051f0 <mpmain>
+80105379:	66 90                	xchg   %ax,%ax
+8010537b:	66 90                	xchg   %ax,%ax
+8010537d:	66 90                	xchg   %ax,%ax
+8010537f:	90                   	nop
+
+80105380 <mpsearch1>:
+}
+
+// Look for an MP structure in the len bytes at addr.
+static struct mp*
+mpsearch1(uint a, int len)
+{
+80105380:	55                   	push   %ebp
+80105381:	89 e5                	mov    %esp,%ebp
+80105383:	57                   	push   %edi
+80105384:	56                   	push   %esi
+  uchar *e, *p, *addr;
+
+  addr = P2V(a);
+80105385:	8d b0 00 00 00 80    	lea    -0x80000000(%eax),%esi
+{
+8010538b:	53                   	push   %ebx
+  e = addr+len;
+8010538c:	8d 1c 16             	lea    (%esi,%edx,1),%ebx
+{
+8010538f:	83 ec 0c             	sub    $0xc,%esp
+  for(p = addr; p < e; p += sizeof(struct mp))
+80105392:	39 de                	cmp    %ebx,%esi
+80105394:	72 10                	jb     801053a6 <mpsearch1+0x26>
+80105396:	eb 50                	jmp    801053e8 <mpsearch1+0x68>
+80105398:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010539f:	90                   	nop
+801053a0:	89 fe                	mov    %edi,%esi
+801053a2:	39 df                	cmp    %ebx,%edi
+801053a4:	73 42                	jae    801053e8 <mpsearch1+0x68>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+801053a6:	83 ec 04             	sub    $0x4,%esp
+801053a9:	8d 7e 10             	lea    0x10(%esi),%edi
+801053ac:	6a 04                	push   $0x4
+801053ae:	68 f2 ba 10 80       	push   $0x8010baf2
+801053b3:	56                   	push   %esi
+801053b4:	e8 87 2a 00 00       	call   80107e40 <memcmp>
+801053b9:	83 c4 10             	add    $0x10,%esp
+801053bc:	85 c0                	test   %eax,%eax
+801053be:	75 e0                	jne    801053a0 <mpsearch1+0x20>
+801053c0:	89 f2                	mov    %esi,%edx
+801053c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    sum += addr[i];
+801053c8:	0f b6 0a             	movzbl (%edx),%ecx
+  for(i=0; i<len; i++)
+801053cb:	83 c2 01             	add    $0x1,%edx
+    sum += addr[i];
+801053ce:	01 c8                	add    %ecx,%eax
+  for(i=0; i<len; i++)
+801053d0:	39 fa                	cmp    %edi,%edx
+801053d2:	75 f4                	jne    801053c8 <mpsearch1+0x48>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+801053d4:	84 c0                	test   %al,%al
+801053d6:	75 c8                	jne    801053a0 <mpsearch1+0x20>
+      return (struct mp*)p;
+  return 0;
+}
+801053d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801053db:	89 f0                	mov    %esi,%eax
+801053dd:	5b                   	pop    %ebx
+801053de:	5e                   	pop    %esi
+801053df:	5f                   	pop    %edi
+801053e0:	5d                   	pop    %ebp
+801053e1:	c3                   	ret
+801053e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801053e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+801053eb:	31 f6                	xor    %esi,%esi
+}
+801053ed:	5b                   	pop    %ebx
+801053ee:	89 f0                	mov    %esi,%eax
+801053f0:	5e                   	pop    %esi
+801053f1:	5f                   	pop    %edi
+801053f2:	5d                   	pop    %ebp
+801053f3:	c3                   	ret
+801053f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801053fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801053ff:	90                   	nop
+
+80105400 <mpinit>:
+  return conf;
+}
+
+void
+mpinit(void)
+{
+80105400:	55                   	push   %ebp
+80105401:	89 e5                	mov    %esp,%ebp
+80105403:	57                   	push   %edi
+80105404:	56                   	push   %esi
+80105405:	53                   	push   %ebx
+80105406:	83 ec 1c             	sub    $0x1c,%esp
+  if((p = ((bda[0x0F]<<8)| bda[0x0E]) << 4)){
+80105409:	0f b6 05 0f 04 00 80 	movzbl 0x8000040f,%eax
+80105410:	0f b6 15 0e 04 00 80 	movzbl 0x8000040e,%edx
+80105417:	c1 e0 08             	shl    $0x8,%eax
+8010541a:	09 d0                	or     %edx,%eax
+8010541c:	c1 e0 04             	shl    $0x4,%eax
+8010541f:	75 1b                	jne    8010543c <mpinit+0x3c>
+    p = ((bda[0x14]<<8)|bda[0x13])*1024;
+80105421:	0f b6 05 14 04 00 80 	movzbl 0x80000414,%eax
+80105428:	0f b6 15 13 04 00 80 	movzbl 0x80000413,%edx
+8010542f:	c1 e0 08             	shl    $0x8,%eax
+80105432:	09 d0                	or     %edx,%eax
+80105434:	c1 e0 0a             	shl    $0xa,%eax
+    if((mp = mpsearch1(p-1024, 1024)))
+80105437:	2d 00 04 00 00       	sub    $0x400,%eax
+    if((mp = mpsearch1(p, 1024)))
+8010543c:	ba 00 04 00 00       	mov    $0x400,%edx
+80105441:	e8 3a ff ff ff       	call   80105380 <mpsearch1>
+80105446:	89 c3                	mov    %eax,%ebx
+80105448:	85 c0                	test   %eax,%eax
+8010544a:	0f 84 50 01 00 00    	je     801055a0 <mpinit+0x1a0>
+  if((mp = mpsearch()) == 0 || mp->physaddr == 0)
+80105450:	8b 73 04             	mov    0x4(%ebx),%esi
+80105453:	85 f6                	test   %esi,%esi
+80105455:	0f 84 35 01 00 00    	je     80105590 <mpinit+0x190>
+  if(memcmp(conf, "PCMP", 4) != 0)
+8010545b:	83 ec 04             	sub    $0x4,%esp
+  conf = (struct mpconf*) P2V((uint) mp->physaddr);
+8010545e:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+80105464:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(memcmp(conf, "PCMP", 4) != 0)
+80105467:	6a 04                	push   $0x4
+80105469:	68 f7 ba 10 80       	push   $0x8010baf7
+8010546e:	50                   	push   %eax
+8010546f:	e8 cc 29 00 00       	call   80107e40 <memcmp>
+80105474:	83 c4 10             	add    $0x10,%esp
+80105477:	85 c0                	test   %eax,%eax
+80105479:	0f 85 11 01 00 00    	jne    80105590 <mpinit+0x190>
+  if(conf->version != 1 && conf->version != 4)
+8010547f:	0f b6 86 06 00 00 80 	movzbl -0x7ffffffa(%esi),%eax
+80105486:	3c 01                	cmp    $0x1,%al
+80105488:	74 08                	je     80105492 <mpinit+0x92>
+8010548a:	3c 04                	cmp    $0x4,%al
+8010548c:	0f 85 fe 00 00 00    	jne    80105590 <mpinit+0x190>
+  if(sum((uchar*)conf, conf->length) != 0)
+80105492:	0f b7 96 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edx
+  for(i=0; i<len; i++)
+80105499:	66 85 d2             	test   %dx,%dx
+8010549c:	74 22                	je     801054c0 <mpinit+0xc0>
+8010549e:	8d 3c 32             	lea    (%edx,%esi,1),%edi
+801054a1:	89 f0                	mov    %esi,%eax
+  sum = 0;
+801054a3:	31 d2                	xor    %edx,%edx
+801054a5:	8d 76 00             	lea    0x0(%esi),%esi
+    sum += addr[i];
+801054a8:	0f b6 88 00 00 00 80 	movzbl -0x80000000(%eax),%ecx
+  for(i=0; i<len; i++)
+801054af:	83 c0 01             	add    $0x1,%eax
+    sum += addr[i];
+801054b2:	01 ca                	add    %ecx,%edx
+  for(i=0; i<len; i++)
+801054b4:	39 c7                	cmp    %eax,%edi
+801054b6:	75 f0                	jne    801054a8 <mpinit+0xa8>
+  if(sum((uchar*)conf, conf->length) != 0)
+801054b8:	84 d2                	test   %dl,%dl
+801054ba:	0f 85 d0 00 00 00    	jne    80105590 <mpinit+0x190>
+  struct mpioapic *ioapic;
+
+  if((conf = mpconfig(&mp)) == 0)
+    panic("Expect to run on an SMP");
+  ismp = 1;
+  lapic = (uint*)conf->lapicaddr;
+801054c0:	8b 86 24 00 00 80    	mov    -0x7fffffdc(%esi),%eax
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+801054c6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801054c9:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  lapic = (uint*)conf->lapicaddr;
+801054cc:	a3 e8 df 13 80       	mov    %eax,0x8013dfe8
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+801054d1:	0f b7 96 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edx
+801054d8:	8d 86 2c 00 00 80    	lea    -0x7fffffd4(%esi),%eax
+  ismp = 1;
+801054de:	be 01 00 00 00       	mov    $0x1,%esi
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+801054e3:	01 d7                	add    %edx,%edi
+801054e5:	89 fa                	mov    %edi,%edx
+801054e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801054ee:	66 90                	xchg   %ax,%ax
+801054f0:	39 d0                	cmp    %edx,%eax
+801054f2:	73 15                	jae    80105509 <mpinit+0x109>
+    switch(*p){
+801054f4:	0f b6 08             	movzbl (%eax),%ecx
+801054f7:	80 f9 02             	cmp    $0x2,%cl
+801054fa:	74 54                	je     80105550 <mpinit+0x150>
+801054fc:	77 42                	ja     80105540 <mpinit+0x140>
+801054fe:	84 c9                	test   %cl,%cl
+80105500:	74 5e                	je     80105560 <mpinit+0x160>
+      p += sizeof(struct mpioapic);
+      continue;
+    case MPBUS:
+    case MPIOINTR:
+    case MPLINTR:
+      p += 8;
+80105502:	83 c0 08             	add    $0x8,%eax
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80105505:	39 d0                	cmp    %edx,%eax
+80105507:	72 eb                	jb     801054f4 <mpinit+0xf4>
+    default:
+      ismp = 0;
+      break;
+    }
+  }
+  if(!ismp)
+80105509:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+8010550c:	85 f6                	test   %esi,%esi
+8010550e:	0f 84 e1 00 00 00    	je     801055f5 <mpinit+0x1f5>
+    panic("Didn't find a suitable machine");
+
+  if(mp->imcrp){
+80105514:	80 7b 0c 00          	cmpb   $0x0,0xc(%ebx)
+80105518:	74 15                	je     8010552f <mpinit+0x12f>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010551a:	b8 70 00 00 00       	mov    $0x70,%eax
+8010551f:	ba 22 00 00 00       	mov    $0x22,%edx
+80105524:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80105525:	ba 23 00 00 00       	mov    $0x23,%edx
+8010552a:	ec                   	in     (%dx),%al
+    // Bochs doesn't support IMCR, so this doesn't run on Bochs.
+    // But it would on real hardware.
+    outb(0x22, 0x70);   // Select IMCR
+    outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+8010552b:	83 c8 01             	or     $0x1,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010552e:	ee                   	out    %al,(%dx)
+  }
+}
+8010552f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105532:	5b                   	pop    %ebx
+80105533:	5e                   	pop    %esi
+80105534:	5f                   	pop    %edi
+80105535:	5d                   	pop    %ebp
+80105536:	c3                   	ret
+80105537:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010553e:	66 90                	xchg   %ax,%ax
+    switch(*p){
+80105540:	83 e9 03             	sub    $0x3,%ecx
+80105543:	80 f9 01             	cmp    $0x1,%cl
+80105546:	76 ba                	jbe    80105502 <mpinit+0x102>
+80105548:	31 f6                	xor    %esi,%esi
+8010554a:	eb a4                	jmp    801054f0 <mpinit+0xf0>
+8010554c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      ioapicid = ioapic->apicno;
+80105550:	0f b6 48 01          	movzbl 0x1(%eax),%ecx
+      p += sizeof(struct mpioapic);
+80105554:	83 c0 08             	add    $0x8,%eax
+      ioapicid = ioapic->apicno;
+80105557:	88 0d a0 e1 13 80    	mov    %cl,0x8013e1a0
+      continue;
+8010555d:	eb 91                	jmp    801054f0 <mpinit+0xf0>
+8010555f:	90                   	nop
+      if(ncpu < NCPU) {
+80105560:	8b 0d a4 e1 13 80    	mov    0x8013e1a4,%ecx
+80105566:	83 f9 07             	cmp    $0x7,%ecx
+80105569:	7f 19                	jg     80105584 <mpinit+0x184>
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+8010556b:	69 f9 b4 00 00 00    	imul   $0xb4,%ecx,%edi
+80105571:	0f b6 58 01          	movzbl 0x1(%eax),%ebx
+        ncpu++;
+80105575:	83 c1 01             	add    $0x1,%ecx
+80105578:	89 0d a4 e1 13 80    	mov    %ecx,0x8013e1a4
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+8010557e:	88 9f c0 e1 13 80    	mov    %bl,-0x7fec1e40(%edi)
+      p += sizeof(struct mpproc);
+80105584:	83 c0 14             	add    $0x14,%eax
+      continue;
+80105587:	e9 64 ff ff ff       	jmp    801054f0 <mpinit+0xf0>
+8010558c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    panic("Expect to run on an SMP");
+80105590:	83 ec 0c             	sub    $0xc,%esp
+80105593:	68 fc ba 10 80       	push   $0x8010bafc
+80105598:	e8 e3 b2 ff ff       	call   80100880 <panic>
+8010559d:	8d 76 00             	lea    0x0(%esi),%esi
+{
+801055a0:	bb 00 00 0f 80       	mov    $0x800f0000,%ebx
+801055a5:	eb 13                	jmp    801055ba <mpinit+0x1ba>
+801055a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801055ae:	66 90                	xchg   %ax,%ax
+  for(p = addr; p < e; p += sizeof(struct mp))
+801055b0:	89 f3                	mov    %esi,%ebx
+801055b2:	81 fe 00 00 10 80    	cmp    $0x80100000,%esi
+801055b8:	74 d6                	je     80105590 <mpinit+0x190>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+801055ba:	83 ec 04             	sub    $0x4,%esp
+801055bd:	8d 73 10             	lea    0x10(%ebx),%esi
+801055c0:	6a 04                	push   $0x4
+801055c2:	68 f2 ba 10 80       	push   $0x8010baf2
+801055c7:	53                   	push   %ebx
+801055c8:	e8 73 28 00 00       	call   80107e40 <memcmp>
+801055cd:	83 c4 10             	add    $0x10,%esp
+801055d0:	85 c0                	test   %eax,%eax
+801055d2:	75 dc                	jne    801055b0 <mpinit+0x1b0>
+801055d4:	89 da                	mov    %ebx,%edx
+801055d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801055dd:	8d 76 00             	lea    0x0(%esi),%esi
+    sum += addr[i];
+801055e0:	0f b6 0a             	movzbl (%edx),%ecx
+  for(i=0; i<len; i++)
+801055e3:	83 c2 01             	add    $0x1,%edx
+    sum += addr[i];
+801055e6:	01 c8                	add    %ecx,%eax
+  for(i=0; i<len; i++)
+801055e8:	39 f2                	cmp    %esi,%edx
+801055ea:	75 f4                	jne    801055e0 <mpinit+0x1e0>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+801055ec:	84 c0                	test   %al,%al
+801055ee:	75 c0                	jne    801055b0 <mpinit+0x1b0>
+801055f0:	e9 5b fe ff ff       	jmp    80105450 <mpinit+0x50>
+    panic("Didn't find a suitable machine");
+801055f5:	83 ec 0c             	sub    $0xc,%esp
+801055f8:	68 14 bb 10 80       	push   $0x8010bb14
+801055fd:	e8 7e b2 ff ff       	call   80100880 <panic>
+80105602:	66 90                	xchg   %ax,%ax
+80105604:	66 90                	xchg   %ax,%ax
+80105606:	66 90                	xchg   %ax,%ax
+80105608:	66 90                	xchg   %ax,%ax
+8010560a:	66 90                	xchg   %ax,%ax
+8010560c:	66 90                	xchg   %ax,%ax
+8010560e:	66 90                	xchg   %ax,%ax
+
+80105610 <picinit>:
+80105610:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80105615:	ba 21 00 00 00       	mov    $0x21,%edx
+8010561a:	ee                   	out    %al,(%dx)
+8010561b:	ba a1 00 00 00       	mov    $0xa1,%edx
+80105620:	ee                   	out    %al,(%dx)
+picinit(void)
+{
+  // mask all interrupts
+  outb(IO_PIC1+1, 0xFF);
+  outb(IO_PIC2+1, 0xFF);
+}
+80105621:	c3                   	ret
+80105622:	66 90                	xchg   %ax,%ax
+80105624:	66 90                	xchg   %ax,%ax
+80105626:	66 90                	xchg   %ax,%ax
+80105628:	66 90                	xchg   %ax,%ax
+8010562a:	66 90                	xchg   %ax,%ax
+8010562c:	66 90                	xchg   %ax,%ax
+8010562e:	66 90                	xchg   %ax,%ax
+
+80105630 <pipewait>:
+
+// Wait for room in p. Returns -1 if the pipe is closed
+// or the caller killed.
+static int
+pipewait(struct pipe *p)
+{
+80105630:	55                   	push   %ebp
+80105631:	89 e5                	mov    %esp,%ebp
+80105633:	56                   	push   %esi
+80105634:	53                   	push   %ebx
+  if(p->readopen == 0 || myproc()->killed){
+80105635:	8b 90 f4 00 00 00    	mov    0xf4(%eax),%edx
+{
+8010563b:	89 c3                	mov    %eax,%ebx
+  if(p->readopen == 0 || myproc()->killed){
+8010563d:	85 d2                	test   %edx,%edx
+8010563f:	74 57                	je     80105698 <pipewait+0x68>
+80105641:	e8 0a 0f 00 00       	call   80106550 <myproc>
+80105646:	8b 70 40             	mov    0x40(%eax),%esi
+80105649:	85 f6                	test   %esi,%esi
+8010564b:	75 4b                	jne    80105698 <pipewait+0x68>
+    release(&p->lock);
+    return -1;
+  }
+  if(p->rwait)
+8010564d:	8b 83 fc 00 00 00    	mov    0xfc(%ebx),%eax
+80105653:	85 c0                	test   %eax,%eax
+80105655:	75 29                	jne    80105680 <pipewait+0x50>
+    wakeup(&p->nread);
+  p->wwait++;
+  sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+80105657:	83 ec 08             	sub    $0x8,%esp
+  p->wwait++;
+8010565a:	83 83 00 01 00 00 01 	addl   $0x1,0x100(%ebx)
+  sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+80105661:	8d 43 38             	lea    0x38(%ebx),%eax
+80105664:	53                   	push   %ebx
+80105665:	50                   	push   %eax
+80105666:	e8 55 1b 00 00       	call   801071c0 <sleep>
+  p->wwait--;
+8010566b:	83 ab 00 01 00 00 01 	subl   $0x1,0x100(%ebx)
+  return 0;
+80105672:	83 c4 10             	add    $0x10,%esp
+}
+80105675:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105678:	89 f0                	mov    %esi,%eax
+8010567a:	5b                   	pop    %ebx
+8010567b:	5e                   	pop    %esi
+8010567c:	5d                   	pop    %ebp
+8010567d:	c3                   	ret
+8010567e:	66 90                	xchg   %ax,%ax
+    wakeup(&p->nread);
+80105680:	83 ec 0c             	sub    $0xc,%esp
+80105683:	8d 43 34             	lea    0x34(%ebx),%eax
+80105686:	50                   	push   %eax
+80105687:	e8 64 1e 00 00       	call   801074f0 <wakeup>
+8010568c:	83 c4 10             	add    $0x10,%esp
+8010568f:	eb c6                	jmp    80105657 <pipewait+0x27>
+80105691:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    release(&p->lock);
+80105698:	83 ec 0c             	sub    $0xc,%esp
+    return -1;
+8010569b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    release(&p->lock);
+801056a0:	53                   	push   %ebx
+801056a1:	e8 1a 26 00 00       	call   80107cc0 <release>
+    return -1;
+801056a6:	83 c4 10             	add    $0x10,%esp
+801056a9:	eb ca                	jmp    80105675 <pipewait+0x45>
+801056ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801056af:	90                   	nop
+
+801056b0 <pipealloc>:
+{
+801056b0:	55                   	push   %ebp
+801056b1:	89 e5                	mov    %esp,%ebp
+801056b3:	57                   	push   %edi
+801056b4:	56                   	push   %esi
+801056b5:	53                   	push   %ebx
+801056b6:	83 ec 0c             	sub    $0xc,%esp
+801056b9:	8b 75 08             	mov    0x8(%ebp),%esi
+801056bc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  *f0 = *f1 = 0;
+801056bf:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+801056c5:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
+801056cb:	e8 c0 bc ff ff       	call   80101390 <filealloc>
+801056d0:	89 06                	mov    %eax,(%esi)
+801056d2:	85 c0                	test   %eax,%eax
+801056d4:	0f 84 e3 00 00 00    	je     801057bd <pipealloc+0x10d>
+801056da:	e8 b1 bc ff ff       	call   80101390 <filealloc>
+801056df:	89 07                	mov    %eax,(%edi)
+801056e1:	85 c0                	test   %eax,%eax
+801056e3:	0f 84 c2 00 00 00    	je     801057ab <pipealloc+0xfb>
+  if((p = (struct pipe*)kalloc()) == 0)
+801056e9:	e8 f2 ea ff ff       	call   801041e0 <kalloc>
+801056ee:	89 c3                	mov    %eax,%ebx
+801056f0:	85 c0                	test   %eax,%eax
+801056f2:	0f 84 de 00 00 00    	je     801057d6 <pipealloc+0x126>
+  initlock(&p->lock, "pipe");
+801056f8:	83 ec 08             	sub    $0x8,%esp
+  p->nwrite = 0;
+801056fb:	c7 40 38 00 00 00 00 	movl   $0x0,0x38(%eax)
+  p->readopen = 1;
+80105702:	c7 80 f4 00 00 00 01 	movl   $0x1,0xf4(%eax)
+80105709:	00 00 00 
+  p->writeopen = 1;
+8010570c:	c7 80 f8 00 00 00 01 	movl   $0x1,0xf8(%eax)
+80105713:	00 00 00 
+  p->nread = 0;
+80105716:	c7 40 34 00 00 00 00 	movl   $0x0,0x34(%eax)
+  p->size = PIPEDATA;
+8010571d:	c7 40 3c fc 0e 00 00 	movl   $0xefc,0x3c(%eax)
+  p->rhead = 0;
+80105724:	c7 40 40 00 00 00 00 	movl   $0x0,0x40(%eax)
+  p->rcount = 0;
+8010572b:	c7 40 44 00 00 00 00 	movl   $0x0,0x44(%eax)
+  p->npage = 0;
+80105732:	c7 40 48 00 00 00 00 	movl   $0x0,0x48(%eax)
+  p->lwrite = 0;
+80105739:	c7 80 f0 00 00 00 00 	movl   $0x0,0xf0(%eax)
+80105740:	00 00 00 
+  p->lread = 0;
+80105743:	c7 80 ec 00 00 00 00 	movl   $0x0,0xec(%eax)
+8010574a:	00 00 00 
+  p->rwait = 0;
+8010574d:	c7 80 fc 00 00 00 00 	movl   $0x0,0xfc(%eax)
+80105754:	00 00 00 
+  p->wwait = 0;
+80105757:	c7 80 00 01 00 00 00 	movl   $0x0,0x100(%eax)
+8010575e:	00 00 00 
+  initlock(&p->lock, "pipe");
+80105761:	68 33 bb 10 80       	push   $0x8010bb33
+80105766:	50                   	push   %eax
+80105767:	e8 d4 23 00 00       	call   80107b40 <initlock>
+  (*f0)->type = FD_PIPE;
+8010576c:	8b 06                	mov    (%esi),%eax
+  return 0;
+8010576e:	83 c4 10             	add    $0x10,%esp
+  (*f0)->type = FD_PIPE;
+80105771:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f0)->readable = 1;
+80105777:	8b 06                	mov    (%esi),%eax
+80105779:	c6 40 08 01          	movb   $0x1,0x8(%eax)
+  (*f0)->writable = 0;
+8010577d:	8b 06                	mov    (%esi),%eax
+8010577f:	c6 40 09 00          	movb   $0x0,0x9(%eax)
+  (*f0)->pipe = p;
+80105783:	8b 06                	mov    (%esi),%eax
+80105785:	89 58 0c             	mov    %ebx,0xc(%eax)
+  (*f1)->type = FD_PIPE;
+80105788:	8b 07                	mov    (%edi),%eax
+8010578a:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f1)->readable = 0;
+80105790:	8b 07                	mov    (%edi),%eax
+80105792:	c6 40 08 00          	movb   $0x0,0x8(%eax)
+  (*f1)->writable = 1;
+80105796:	8b 07                	mov    (%edi),%eax
+80105798:	c6 40 09 01          	movb   $0x1,0x9(%eax)
+  (*f1)->pipe = p;
+8010579c:	8b 07                	mov    (%edi),%eax
+8010579e:	89 58 0c             	mov    %ebx,0xc(%eax)
+  return 0;
+801057a1:	31 c0                	xor    %eax,%eax
+}
+801057a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801057a6:	5b                   	pop    %ebx
+801057a7:	5e                   	pop    %esi
+801057a8:	5f                   	pop    %edi
+801057a9:	5d                   	pop    %ebp
+801057aa:	c3                   	ret
+  if(*f0)
+801057ab:	8b 06                	mov    (%esi),%eax
+801057ad:	85 c0                	test   %eax,%eax
+801057af:	74 1e                	je     801057cf <pipealloc+0x11f>
+    fileclose(*f0);
+801057b1:	83 ec 0c             	sub    $0xc,%esp
+801057b4:	50                   	push   %eax
+801057b5:	e8 a6 bc ff ff       	call   80101460 <fileclose>
+801057ba:	83 c4 10             	add    $0x10,%esp
+  if(*f1)
+801057bd:	8b 07                	mov    (%edi),%eax
+801057bf:	85 c0                	test   %eax,%eax
+801057c1:	74 0c                	je     801057cf <pipealloc+0x11f>
+    fileclose(*f1);
+801057c3:	83 ec 0c             	sub    $0xc,%esp
+801057c6:	50                   	push   %eax
+801057c7:	e8 94 bc ff ff       	call   80101460 <fileclose>
+801057cc:	83 c4 10             	add    $0x10,%esp
+  return -1;
+801057cf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801057d4:	eb cd                	jmp    801057a3 <pipealloc+0xf3>
+  if(*f0)
+801057d6:	8b 06                	mov    (%esi),%eax
+801057d8:	85 c0                	test   %eax,%eax
+801057da:	75 d5                	jne    801057b1 <pipealloc+0x101>
+801057dc:	eb df                	jmp    801057bd <pipealloc+0x10d>
+801057de:	66 90                	xchg   %ax,%ax
+
+801057e0 <pipeclose>:
+{
+801057e0:	55                   	push   %ebp
+801057e1:	89 e5                	mov    %esp,%ebp
+801057e3:	56                   	push   %esi
+801057e4:	53                   	push   %ebx
+801057e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801057e8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  acquire(&p->lock);
+801057eb:	83 ec 0c             	sub    $0xc,%esp
+801057ee:	53                   	push   %ebx
+801057ef:	e8 2c 25 00 00       	call   80107d20 <acquire>
+  if(writable){
+801057f4:	83 c4 10             	add    $0x10,%esp
+801057f7:	85 f6                	test   %esi,%esi
+801057f9:	74 45                	je     80105840 <pipeclose+0x60>
+    p->writeopen = 0;
+801057fb:	c7 83 f8 00 00 00 00 	movl   $0x0,0xf8(%ebx)
+80105802:	00 00 00 
+    wakeup(&p->nread);
+80105805:	83 ec 0c             	sub    $0xc,%esp
+80105808:	8d 43 34             	lea    0x34(%ebx),%eax
+8010580b:	50                   	push   %eax
+8010580c:	e8 df 1c 00 00       	call   801074f0 <wakeup>
+80105811:	83 c4 10             	add    $0x10,%esp
+  if(p->readopen == 0 && p->writeopen == 0){
+80105814:	8b 93 f4 00 00 00    	mov    0xf4(%ebx),%edx
+8010581a:	85 d2                	test   %edx,%edx
+8010581c:	75 0a                	jne    80105828 <pipeclose+0x48>
+8010581e:	8b 83 f8 00 00 00    	mov    0xf8(%ebx),%eax
+80105824:	85 c0                	test   %eax,%eax
+80105826:	74 38                	je     80105860 <pipeclose+0x80>
+    release(&p->lock);
+80105828:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+8010582b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010582e:	5b                   	pop    %ebx
+8010582f:	5e                   	pop    %esi
+80105830:	5d                   	pop    %ebp
+    release(&p->lock);
+80105831:	e9 8a 24 00 00       	jmp    80107cc0 <release>
+80105836:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010583d:	8d 76 00             	lea    0x0(%esi),%esi
+    p->readopen = 0;
+80105840:	c7 83 f4 00 00 00 00 	movl   $0x0,0xf4(%ebx)
+80105847:	00 00 00 
+    wakeup(&p->nwrite);
+8010584a:	83 ec 0c             	sub    $0xc,%esp
+8010584d:	8d 43 38             	lea    0x38(%ebx),%eax
+80105850:	50                   	push   %eax
+80105851:	e8 9a 1c 00 00       	call   801074f0 <wakeup>
+80105856:	83 c4 10             	add    $0x10,%esp
+80105859:	eb b9                	jmp    80105814 <pipeclose+0x34>
+8010585b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010585f:	90                   	nop
+    release(&p->lock);
+80105860:	83 ec 0c             	sub    $0xc,%esp
+80105863:	53                   	push   %ebx
+80105864:	e8 57 24 00 00       	call   80107cc0 <release>
+    for(; p->lread != p->lwrite; p->lread++)
+80105869:	8b 83 ec 00 00 00    	mov    0xec(%ebx),%eax
+8010586f:	83 c4 10             	add    $0x10,%esp
+80105872:	39 83 f0 00 00 00    	cmp    %eax,0xf0(%ebx)
+80105878:	74 3b                	je     801058b5 <pipeclose+0xd5>
+8010587a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      kfree(P2V(p->loan[p->lread % NLOAN].pa));
+80105880:	83 e0 07             	and    $0x7,%eax
+80105883:	83 ec 0c             	sub    $0xc,%esp
+80105886:	8d 04 40             	lea    (%eax,%eax,2),%eax
+80105889:	8b 84 83 90 00 00 00 	mov    0x90(%ebx,%eax,4),%eax
+80105890:	05 00 00 00 80       	add    $0x80000000,%eax
+80105895:	50                   	push   %eax
+80105896:	e8 85 e6 ff ff       	call   80103f20 <kfree>
+    for(; p->lread != p->lwrite; p->lread++)
+8010589b:	8b 83 ec 00 00 00    	mov    0xec(%ebx),%eax
+801058a1:	83 c4 10             	add    $0x10,%esp
+801058a4:	83 c0 01             	add    $0x1,%eax
+801058a7:	89 83 ec 00 00 00    	mov    %eax,0xec(%ebx)
+801058ad:	3b 83 f0 00 00 00    	cmp    0xf0(%ebx),%eax
+801058b3:	75 cb                	jne    80105880 <pipeclose+0xa0>
+    while(p->npage > 0)
+801058b5:	8b 43 48             	mov    0x48(%ebx),%eax
+801058b8:	85 c0                	test   %eax,%eax
+801058ba:	7e 20                	jle    801058dc <pipeclose+0xfc>
+801058bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      kfree(p->page[--p->npage]);
+801058c0:	8d 50 ff             	lea    -0x1(%eax),%edx
+801058c3:	83 ec 0c             	sub    $0xc,%esp
+801058c6:	89 53 48             	mov    %edx,0x48(%ebx)
+801058c9:	ff 74 83 48          	push   0x48(%ebx,%eax,4)
+801058cd:	e8 4e e6 ff ff       	call   80103f20 <kfree>
+    while(p->npage > 0)
+801058d2:	8b 43 48             	mov    0x48(%ebx),%eax
+801058d5:	83 c4 10             	add    $0x10,%esp
+801058d8:	85 c0                	test   %eax,%eax
+801058da:	7f e4                	jg     801058c0 <pipeclose+0xe0>
+    kfree((char*)p);
+801058dc:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+801058df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801058e2:	5b                   	pop    %ebx
+801058e3:	5e                   	pop    %esi
+801058e4:	5d                   	pop    %ebp
+    kfree((char*)p);
+801058e5:	e9 36 e6 ff ff       	jmp    80103f20 <kfree>
+801058ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801058f0 <pipewrite>:
+
+//PAGEBREAK: 40
+int
+pipewrite(struct pipe *p, char *addr, int n)
+{
+801058f0:	55                   	push   %ebp
+801058f1:	89 e5                	mov    %esp,%ebp
+801058f3:	57                   	push   %edi
+801058f4:	56                   	push   %esi
+801058f5:	53                   	push   %ebx
+801058f6:	83 ec 28             	sub    $0x28,%esp
+801058f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct loan *l;
+  uint pa, m, run;
+  char *dst;
+  int i;
+
+  acquire(&p->lock);
+801058fc:	56                   	push   %esi
+801058fd:	e8 1e 24 00 00       	call   80107d20 <acquire>
+  for(i = 0; i < n; i += m){
+80105902:	8b 5d 10             	mov    0x10(%ebp),%ebx
+80105905:	83 c4 10             	add    $0x10,%esp
+80105908:	85 db                	test   %ebx,%ebx
+8010590a:	0f 8e b8 00 00 00    	jle    801059c8 <pipewrite+0xd8>
+80105910:	31 ff                	xor    %edi,%edi
+    if((uint)(addr+i) % PGSIZE == 0 && n - i >= PGSIZE){
+80105912:	8b 45 0c             	mov    0xc(%ebp),%eax
+80105915:	01 f8                	add    %edi,%eax
+80105917:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010591a:	25 ff 0f 00 00       	and    $0xfff,%eax
+8010591f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80105922:	0f 85 d7 00 00 00    	jne    801059ff <pipewrite+0x10f>
+80105928:	8b 45 10             	mov    0x10(%ebp),%eax
+8010592b:	29 f8                	sub    %edi,%eax
+8010592d:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+80105932:	7f 1b                	jg     8010594f <pipewrite+0x5f>
+80105934:	e9 c6 00 00 00       	jmp    801059ff <pipewrite+0x10f>
+80105939:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      // A whole page: lend it, unless the loans are all out.
+      while(p->lwrite == p->lread + NLOAN)
+        if(pipewait(p) < 0)
+80105940:	89 f0                	mov    %esi,%eax
+80105942:	e8 e9 fc ff ff       	call   80105630 <pipewait>
+80105947:	85 c0                	test   %eax,%eax
+80105949:	0f 88 71 01 00 00    	js     80105ac0 <pipewrite+0x1d0>
+      while(p->lwrite == p->lread + NLOAN)
+8010594f:	8b 86 ec 00 00 00    	mov    0xec(%esi),%eax
+80105955:	83 c0 08             	add    $0x8,%eax
+80105958:	39 86 f0 00 00 00    	cmp    %eax,0xf0(%esi)
+8010595e:	74 e0                	je     80105940 <pipewrite+0x50>
+          return -1;
+      if((pa = loanpage(myproc()->pgdir, addr+i)) != 0){
+80105960:	e8 eb 0b 00 00       	call   80106550 <myproc>
+80105965:	83 ec 08             	sub    $0x8,%esp
+80105968:	ff 75 e4             	push   -0x1c(%ebp)
+8010596b:	ff 70 04             	push   0x4(%eax)
+8010596e:	e8 cd 58 00 00       	call   8010b240 <loanpage>
+80105973:	83 c4 10             	add    $0x10,%esp
+80105976:	85 c0                	test   %eax,%eax
+80105978:	0f 84 81 00 00 00    	je     801059ff <pipewrite+0x10f>
+        l = &p->loan[p->lwrite++ % NLOAN];
+8010597e:	8b 96 f0 00 00 00    	mov    0xf0(%esi),%edx
+        l->pos = p->nwrite;
+        l->pa = pa;
+        l->off = 0;
+        p->nwrite += PGSIZE;
+        m = PGSIZE;
+80105984:	bb 00 10 00 00       	mov    $0x1000,%ebx
+        l = &p->loan[p->lwrite++ % NLOAN];
+80105989:	8d 4a 01             	lea    0x1(%edx),%ecx
+8010598c:	83 e2 07             	and    $0x7,%edx
+8010598f:	89 8e f0 00 00 00    	mov    %ecx,0xf0(%esi)
+        l->pos = p->nwrite;
+80105995:	8d 14 52             	lea    (%edx,%edx,2),%edx
+80105998:	8b 4e 38             	mov    0x38(%esi),%ecx
+8010599b:	8d 14 96             	lea    (%esi,%edx,4),%edx
+8010599e:	89 8a 8c 00 00 00    	mov    %ecx,0x8c(%edx)
+        p->nwrite += PGSIZE;
+801059a4:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+        l->pa = pa;
+801059aa:	89 82 90 00 00 00    	mov    %eax,0x90(%edx)
+        l->off = 0;
+801059b0:	c7 82 94 00 00 00 00 	movl   $0x0,0x94(%edx)
+801059b7:	00 00 00 
+        p->nwrite += PGSIZE;
+801059ba:	89 4e 38             	mov    %ecx,0x38(%esi)
+  for(i = 0; i < n; i += m){
+801059bd:	01 df                	add    %ebx,%edi
+801059bf:	39 7d 10             	cmp    %edi,0x10(%ebp)
+801059c2:	0f 8f 4a ff ff ff    	jg     80105912 <pipewrite+0x22>
+    p->rcount += m;
+    p->nwrite += m;
+    if(p->rwait && p->rcount >= HIWAT(p) && p->rcount - m < HIWAT(p))
+      wakeup(&p->nread);
+  }
+  if(p->rwait)
+801059c8:	8b 86 fc 00 00 00    	mov    0xfc(%esi),%eax
+801059ce:	85 c0                	test   %eax,%eax
+801059d0:	0f 85 10 01 00 00    	jne    80105ae6 <pipewrite+0x1f6>
+    wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+  release(&p->lock);
+801059d6:	83 ec 0c             	sub    $0xc,%esp
+801059d9:	56                   	push   %esi
+801059da:	e8 e1 22 00 00       	call   80107cc0 <release>
+  return n;
+801059df:	8b 45 10             	mov    0x10(%ebp),%eax
+801059e2:	83 c4 10             	add    $0x10,%esp
+801059e5:	e9 db 00 00 00       	jmp    80105ac5 <pipewrite+0x1d5>
+801059ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(pipewait(p) < 0)
+801059f0:	89 f0                	mov    %esi,%eax
+801059f2:	e8 39 fc ff ff       	call   80105630 <pipewait>
+801059f7:	85 c0                	test   %eax,%eax
+801059f9:	0f 88 c1 00 00 00    	js     80105ac0 <pipewrite+0x1d0>
+    while(p->rcount == p->size)  //DOC: pipewrite-full
+801059ff:	8b 5e 44             	mov    0x44(%esi),%ebx
+80105a02:	8b 4e 3c             	mov    0x3c(%esi),%ecx
+80105a05:	39 cb                	cmp    %ecx,%ebx
+80105a07:	74 e7                	je     801059f0 <pipewrite+0x100>
+    dst = ringptr(p, (p->rhead + p->rcount) % p->size, &run);
+80105a09:	8b 46 40             	mov    0x40(%esi),%eax
+80105a0c:	31 d2                	xor    %edx,%edx
+80105a0e:	01 d8                	add    %ebx,%eax
+80105a10:	f7 f1                	div    %ecx
+  if(i < PIPEDATA){
+80105a12:	81 fa fb 0e 00 00    	cmp    $0xefb,%edx
+80105a18:	0f 86 b2 00 00 00    	jbe    80105ad0 <pipewrite+0x1e0>
+  i -= PIPEDATA;
+80105a1e:	81 ea fc 0e 00 00    	sub    $0xefc,%edx
+  *n = PGSIZE - i%PGSIZE;
+80105a24:	89 d0                	mov    %edx,%eax
+80105a26:	89 55 d8             	mov    %edx,-0x28(%ebp)
+80105a29:	ba 00 10 00 00       	mov    $0x1000,%edx
+80105a2e:	25 ff 0f 00 00       	and    $0xfff,%eax
+80105a33:	29 c2                	sub    %eax,%edx
+80105a35:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  return p->page[i/PGSIZE] + i%PGSIZE;
+80105a38:	8b 55 d8             	mov    -0x28(%ebp),%edx
+80105a3b:	c1 ea 0c             	shr    $0xc,%edx
+80105a3e:	03 44 96 4c          	add    0x4c(%esi,%edx,4),%eax
+80105a42:	89 c2                	mov    %eax,%edx
+    m = n - i;
+80105a44:	8b 45 10             	mov    0x10(%ebp),%eax
+    if(m > p->size - p->rcount)
+80105a47:	29 d9                	sub    %ebx,%ecx
+    if(m > PGSIZE - (uint)(addr+i) % PGSIZE)
+80105a49:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    m = n - i;
+80105a4c:	29 f8                	sub    %edi,%eax
+80105a4e:	39 c1                	cmp    %eax,%ecx
+80105a50:	0f 47 c8             	cmova  %eax,%ecx
+    if(m > PGSIZE - (uint)(addr+i) % PGSIZE)
+80105a53:	b8 00 10 00 00       	mov    $0x1000,%eax
+80105a58:	29 d8                	sub    %ebx,%eax
+80105a5a:	39 c1                	cmp    %eax,%ecx
+80105a5c:	0f 47 c8             	cmova  %eax,%ecx
+80105a5f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80105a62:	39 c1                	cmp    %eax,%ecx
+80105a64:	89 c3                	mov    %eax,%ebx
+80105a66:	0f 46 d9             	cmovbe %ecx,%ebx
+    memmove(dst, addr+i, m);
+80105a69:	83 ec 04             	sub    $0x4,%esp
+80105a6c:	53                   	push   %ebx
+80105a6d:	ff 75 e4             	push   -0x1c(%ebp)
+80105a70:	52                   	push   %edx
+80105a71:	e8 1a 24 00 00       	call   80107e90 <memmove>
+    p->rcount += m;
+80105a76:	8b 46 44             	mov    0x44(%esi),%eax
+    p->nwrite += m;
+80105a79:	01 5e 38             	add    %ebx,0x38(%esi)
+    if(p->rwait && p->rcount >= HIWAT(p) && p->rcount - m < HIWAT(p))
+80105a7c:	83 c4 10             	add    $0x10,%esp
+80105a7f:	8b 8e fc 00 00 00    	mov    0xfc(%esi),%ecx
+    p->rcount += m;
+80105a85:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+80105a88:	89 56 44             	mov    %edx,0x44(%esi)
+    if(p->rwait && p->rcount >= HIWAT(p) && p->rcount - m < HIWAT(p))
+80105a8b:	85 c9                	test   %ecx,%ecx
+80105a8d:	0f 84 2a ff ff ff    	je     801059bd <pipewrite+0xcd>
+80105a93:	8b 4e 3c             	mov    0x3c(%esi),%ecx
+80105a96:	d1 e9                	shr    %ecx
+80105a98:	39 c8                	cmp    %ecx,%eax
+80105a9a:	0f 83 1d ff ff ff    	jae    801059bd <pipewrite+0xcd>
+80105aa0:	39 ca                	cmp    %ecx,%edx
+80105aa2:	0f 82 15 ff ff ff    	jb     801059bd <pipewrite+0xcd>
+      wakeup(&p->nread);
+80105aa8:	83 ec 0c             	sub    $0xc,%esp
+80105aab:	8d 46 34             	lea    0x34(%esi),%eax
+80105aae:	50                   	push   %eax
+80105aaf:	e8 3c 1a 00 00       	call   801074f0 <wakeup>
+80105ab4:	83 c4 10             	add    $0x10,%esp
+80105ab7:	e9 01 ff ff ff       	jmp    801059bd <pipewrite+0xcd>
+80105abc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          return -1;
+80105ac0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80105ac5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105ac8:	5b                   	pop    %ebx
+80105ac9:	5e                   	pop    %esi
+80105aca:	5f                   	pop    %edi
+80105acb:	5d                   	pop    %ebp
+80105acc:	c3                   	ret
+80105acd:	8d 76 00             	lea    0x0(%esi),%esi
+    *n = PIPEDATA - i;
+80105ad0:	b8 fc 0e 00 00       	mov    $0xefc,%eax
+80105ad5:	29 d0                	sub    %edx,%eax
+    return p->data + i;
+80105ad7:	8d 94 16 04 01 00 00 	lea    0x104(%esi,%edx,1),%edx
+    *n = PIPEDATA - i;
+80105ade:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    return p->data + i;
+80105ae1:	e9 5e ff ff ff       	jmp    80105a44 <pipewrite+0x154>
+    wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+80105ae6:	83 ec 0c             	sub    $0xc,%esp
+80105ae9:	8d 46 34             	lea    0x34(%esi),%eax
+80105aec:	50                   	push   %eax
+80105aed:	e8 fe 19 00 00       	call   801074f0 <wakeup>
+80105af2:	83 c4 10             	add    $0x10,%esp
+80105af5:	e9 dc fe ff ff       	jmp    801059d6 <pipewrite+0xe6>
+80105afa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80105b00 <piperead>:
+
+int
+piperead(struct pipe *p, char *addr, int n)
+{
+80105b00:	55                   	push   %ebp
+80105b01:	89 e5                	mov    %esp,%ebp
+80105b03:	57                   	push   %edi
+80105b04:	56                   	push   %esi
+80105b05:	53                   	push   %ebx
+80105b06:	83 ec 38             	sub    $0x38,%esp
+80105b09:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct loan *l;
+  uint m, run;
+  char *src;
+  int i;
+
+  acquire(&p->lock);
+80105b0c:	57                   	push   %edi
+80105b0d:	8d 5f 34             	lea    0x34(%edi),%ebx
+80105b10:	e8 0b 22 00 00       	call   80107d20 <acquire>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+80105b15:	8b 47 34             	mov    0x34(%edi),%eax
+80105b18:	83 c4 10             	add    $0x10,%esp
+80105b1b:	39 47 38             	cmp    %eax,0x38(%edi)
+80105b1e:	74 3b                	je     80105b5b <piperead+0x5b>
+80105b20:	eb 43                	jmp    80105b65 <piperead+0x65>
+80105b22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(myproc()->killed){
+80105b28:	e8 23 0a 00 00       	call   80106550 <myproc>
+80105b2d:	8b 48 40             	mov    0x40(%eax),%ecx
+80105b30:	85 c9                	test   %ecx,%ecx
+80105b32:	0f 85 58 02 00 00    	jne    80105d90 <piperead+0x290>
+      release(&p->lock);
+      return -1;
+    }
+    p->rwait++;
+    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+80105b38:	83 ec 08             	sub    $0x8,%esp
+    p->rwait++;
+80105b3b:	83 87 fc 00 00 00 01 	addl   $0x1,0xfc(%edi)
+    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+80105b42:	57                   	push   %edi
+80105b43:	53                   	push   %ebx
+80105b44:	e8 77 16 00 00       	call   801071c0 <sleep>
+    p->rwait--;
+80105b49:	83 af fc 00 00 00 01 	subl   $0x1,0xfc(%edi)
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+80105b50:	8b 47 38             	mov    0x38(%edi),%eax
+80105b53:	83 c4 10             	add    $0x10,%esp
+80105b56:	39 47 34             	cmp    %eax,0x34(%edi)
+80105b59:	75 0a                	jne    80105b65 <piperead+0x65>
+80105b5b:	8b 97 f8 00 00 00    	mov    0xf8(%edi),%edx
+80105b61:	85 d2                	test   %edx,%edx
+80105b63:	75 c3                	jne    80105b28 <piperead+0x28>
+  }
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+80105b65:	8b 5d 10             	mov    0x10(%ebp),%ebx
+80105b68:	31 f6                	xor    %esi,%esi
+80105b6a:	85 db                	test   %ebx,%ebx
+80105b6c:	0f 8f a0 00 00 00    	jg     80105c12 <piperead+0x112>
+80105b72:	e9 91 01 00 00       	jmp    80105d08 <piperead+0x208>
+80105b77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105b7e:	66 90                	xchg   %ax,%ax
+      continue;
+    }
+
+    // From a lent page: take the page itself if the reader
+    // wants all of it at a page boundary, else copy.
+    m = PGSIZE - l->off;
+80105b80:	8b 55 cc             	mov    -0x34(%ebp),%edx
+80105b83:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+80105b86:	bb 00 10 00 00       	mov    $0x1000,%ebx
+80105b8b:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+    if(m > n - i)
+      m = n - i;
+    if(m == PGSIZE && (uint)(addr+i) % PGSIZE == 0 &&
+       maploan(myproc()->pgdir, addr+i, l->pa) == 0){
+80105b91:	8b 92 90 00 00 00    	mov    0x90(%edx),%edx
+    m = PGSIZE - l->off;
+80105b97:	29 c3                	sub    %eax,%ebx
+80105b99:	39 cb                	cmp    %ecx,%ebx
+80105b9b:	0f 47 d9             	cmova  %ecx,%ebx
+    if(m == PGSIZE && (uint)(addr+i) % PGSIZE == 0 &&
+80105b9e:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+80105ba4:	75 0d                	jne    80105bb3 <piperead+0xb3>
+80105ba6:	f7 45 e0 ff 0f 00 00 	testl  $0xfff,-0x20(%ebp)
+80105bad:	0f 84 ad 01 00 00    	je     80105d60 <piperead+0x260>
+      l->pa = 0;
+    } else
+      memmove(addr+i, (char*)P2V(l->pa) + l->off, m);
+80105bb3:	83 ec 04             	sub    $0x4,%esp
+80105bb6:	53                   	push   %ebx
+80105bb7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+80105bba:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+80105bbd:	01 ca                	add    %ecx,%edx
+80105bbf:	8b 94 97 90 00 00 00 	mov    0x90(%edi,%edx,4),%edx
+80105bc6:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+80105bcd:	50                   	push   %eax
+80105bce:	ff 75 e0             	push   -0x20(%ebp)
+80105bd1:	e8 ba 22 00 00       	call   80107e90 <memmove>
+80105bd6:	83 c4 10             	add    $0x10,%esp
+    l->off += m;
+80105bd9:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80105bdc:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80105bdf:	01 d0                	add    %edx,%eax
+80105be1:	8d 04 87             	lea    (%edi,%eax,4),%eax
+80105be4:	8b 90 94 00 00 00    	mov    0x94(%eax),%edx
+    l->pos += m;
+80105bea:	01 98 8c 00 00 00    	add    %ebx,0x8c(%eax)
+    l->off += m;
+80105bf0:	01 da                	add    %ebx,%edx
+80105bf2:	89 90 94 00 00 00    	mov    %edx,0x94(%eax)
+    p->nread += m;
+80105bf8:	01 5f 34             	add    %ebx,0x34(%edi)
+    if(l->off == PGSIZE){
+80105bfb:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+80105c01:	0f 84 39 01 00 00    	je     80105d40 <piperead+0x240>
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+80105c07:	01 de                	add    %ebx,%esi
+80105c09:	39 75 10             	cmp    %esi,0x10(%ebp)
+80105c0c:	0f 8e e4 00 00 00    	jle    80105cf6 <piperead+0x1f6>
+80105c12:	8b 47 34             	mov    0x34(%edi),%eax
+80105c15:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80105c18:	3b 47 38             	cmp    0x38(%edi),%eax
+80105c1b:	0f 84 d5 00 00 00    	je     80105cf6 <piperead+0x1f6>
+    if(m > n - i)
+80105c21:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    l = &p->loan[p->lread % NLOAN];
+80105c24:	8b 97 ec 00 00 00    	mov    0xec(%edi),%edx
+    if(p->lread == p->lwrite || l->pos != p->nread){
+80105c2a:	8b 9f f0 00 00 00    	mov    0xf0(%edi),%ebx
+    if(m > n - i)
+80105c30:	29 f1                	sub    %esi,%ecx
+    l = &p->loan[p->lread % NLOAN];
+80105c32:	89 d0                	mov    %edx,%eax
+    if(m > n - i)
+80105c34:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    if(m == PGSIZE && (uint)(addr+i) % PGSIZE == 0 &&
+80105c37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    l = &p->loan[p->lread % NLOAN];
+80105c3a:	83 e0 07             	and    $0x7,%eax
+80105c3d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    if(m == PGSIZE && (uint)(addr+i) % PGSIZE == 0 &&
+80105c40:	01 f1                	add    %esi,%ecx
+    if(p->lread == p->lwrite || l->pos != p->nread){
+80105c42:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    if(m == PGSIZE && (uint)(addr+i) % PGSIZE == 0 &&
+80105c45:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    if(p->lread == p->lwrite || l->pos != p->nread){
+80105c48:	39 da                	cmp    %ebx,%edx
+80105c4a:	74 1d                	je     80105c69 <piperead+0x169>
+80105c4c:	8d 0c 00             	lea    (%eax,%eax,1),%ecx
+80105c4f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80105c52:	01 c8                	add    %ecx,%eax
+80105c54:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+80105c57:	8d 04 87             	lea    (%edi,%eax,4),%eax
+80105c5a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+80105c5d:	39 98 8c 00 00 00    	cmp    %ebx,0x8c(%eax)
+80105c63:	0f 84 17 ff ff ff    	je     80105b80 <piperead+0x80>
+      src = ringptr(p, p->rhead, &run);
+80105c69:	8b 47 40             	mov    0x40(%edi),%eax
+  if(i < PIPEDATA){
+80105c6c:	3d fb 0e 00 00       	cmp    $0xefb,%eax
+80105c71:	0f 86 a9 00 00 00    	jbe    80105d20 <piperead+0x220>
+  i -= PIPEDATA;
+80105c77:	2d fc 0e 00 00       	sub    $0xefc,%eax
+  *n = PGSIZE - i%PGSIZE;
+80105c7c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+80105c81:	89 c3                	mov    %eax,%ebx
+  return p->page[i/PGSIZE] + i%PGSIZE;
+80105c83:	c1 e8 0c             	shr    $0xc,%eax
+  *n = PGSIZE - i%PGSIZE;
+80105c86:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+80105c8c:	29 d9                	sub    %ebx,%ecx
+  return p->page[i/PGSIZE] + i%PGSIZE;
+80105c8e:	03 5c 87 4c          	add    0x4c(%edi,%eax,4),%ebx
+  *n = PGSIZE - i%PGSIZE;
+80105c92:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  return p->page[i/PGSIZE] + i%PGSIZE;
+80105c95:	89 d8                	mov    %ebx,%eax
+      if(m > run)
+80105c97:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+80105c9a:	8b 5f 44             	mov    0x44(%edi),%ebx
+80105c9d:	39 d9                	cmp    %ebx,%ecx
+80105c9f:	0f 46 d9             	cmovbe %ecx,%ebx
+80105ca2:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+80105ca5:	39 cb                	cmp    %ecx,%ebx
+80105ca7:	0f 47 d9             	cmova  %ecx,%ebx
+      if(p->lread != p->lwrite && m > l->pos - p->nread)
+80105caa:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+80105cad:	39 ca                	cmp    %ecx,%edx
+80105caf:	74 17                	je     80105cc8 <piperead+0x1c8>
+80105cb1:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80105cb4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80105cb7:	8d 14 52             	lea    (%edx,%edx,2),%edx
+80105cba:	8b 94 97 8c 00 00 00 	mov    0x8c(%edi,%edx,4),%edx
+80105cc1:	29 ca                	sub    %ecx,%edx
+80105cc3:	39 d3                	cmp    %edx,%ebx
+80105cc5:	0f 47 da             	cmova  %edx,%ebx
+      memmove(addr+i, src, m);
+80105cc8:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+80105ccb:	01 de                	add    %ebx,%esi
+      memmove(addr+i, src, m);
+80105ccd:	53                   	push   %ebx
+80105cce:	50                   	push   %eax
+80105ccf:	ff 75 e0             	push   -0x20(%ebp)
+80105cd2:	e8 b9 21 00 00       	call   80107e90 <memmove>
+      p->rhead = (p->rhead + m) % p->size;
+80105cd7:	8b 47 40             	mov    0x40(%edi),%eax
+80105cda:	31 d2                	xor    %edx,%edx
+      p->rcount -= m;
+80105cdc:	29 5f 44             	sub    %ebx,0x44(%edi)
+      p->nread += m;
+80105cdf:	01 5f 34             	add    %ebx,0x34(%edi)
+      continue;
+80105ce2:	83 c4 10             	add    $0x10,%esp
+      p->rhead = (p->rhead + m) % p->size;
+80105ce5:	01 d8                	add    %ebx,%eax
+80105ce7:	f7 77 3c             	divl   0x3c(%edi)
+80105cea:	89 57 40             	mov    %edx,0x40(%edi)
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+80105ced:	39 75 10             	cmp    %esi,0x10(%ebp)
+80105cf0:	0f 8f 1c ff ff ff    	jg     80105c12 <piperead+0x112>
+      if(l->pa)
+        kfree(P2V(l->pa));
+      p->lread++;
+    }
+  }
+  if(p->wwait && i > 0)
+80105cf6:	8b 87 00 01 00 00    	mov    0x100(%edi),%eax
+80105cfc:	85 c0                	test   %eax,%eax
+80105cfe:	74 08                	je     80105d08 <piperead+0x208>
+80105d00:	85 f6                	test   %esi,%esi
+80105d02:	0f 8f d8 00 00 00    	jg     80105de0 <piperead+0x2e0>
+    wakeup(&p->nwrite);  //DOC: piperead-wakeup
+  release(&p->lock);
+80105d08:	83 ec 0c             	sub    $0xc,%esp
+80105d0b:	57                   	push   %edi
+80105d0c:	e8 af 1f 00 00       	call   80107cc0 <release>
+  return i;
+80105d11:	83 c4 10             	add    $0x10,%esp
+}
+80105d14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105d17:	89 f0                	mov    %esi,%eax
+80105d19:	5b                   	pop    %ebx
+80105d1a:	5e                   	pop    %esi
+80105d1b:	5f                   	pop    %edi
+80105d1c:	5d                   	pop    %ebp
+80105d1d:	c3                   	ret
+80105d1e:	66 90                	xchg   %ax,%ax
+    *n = PIPEDATA - i;
+80105d20:	bb fc 0e 00 00       	mov    $0xefc,%ebx
+80105d25:	29 c3                	sub    %eax,%ebx
+    return p->data + i;
+80105d27:	8d 84 07 04 01 00 00 	lea    0x104(%edi,%eax,1),%eax
+    *n = PIPEDATA - i;
+80105d2e:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+    return p->data + i;
+80105d31:	e9 61 ff ff ff       	jmp    80105c97 <piperead+0x197>
+80105d36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105d3d:	8d 76 00             	lea    0x0(%esi),%esi
+      if(l->pa)
+80105d40:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+80105d46:	85 c0                	test   %eax,%eax
+80105d48:	75 66                	jne    80105db0 <piperead+0x2b0>
+      p->lread++;
+80105d4a:	83 87 ec 00 00 00 01 	addl   $0x1,0xec(%edi)
+80105d51:	e9 b1 fe ff ff       	jmp    80105c07 <piperead+0x107>
+80105d56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105d5d:	8d 76 00             	lea    0x0(%esi),%esi
+80105d60:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+       maploan(myproc()->pgdir, addr+i, l->pa) == 0){
+80105d63:	e8 e8 07 00 00       	call   80106550 <myproc>
+80105d68:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80105d6b:	83 ec 04             	sub    $0x4,%esp
+80105d6e:	52                   	push   %edx
+80105d6f:	ff 75 e0             	push   -0x20(%ebp)
+80105d72:	ff 70 04             	push   0x4(%eax)
+80105d75:	e8 56 55 00 00       	call   8010b2d0 <maploan>
+    if(m == PGSIZE && (uint)(addr+i) % PGSIZE == 0 &&
+80105d7a:	83 c4 10             	add    $0x10,%esp
+80105d7d:	85 c0                	test   %eax,%eax
+      l->pa = 0;
+80105d7f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    if(m == PGSIZE && (uint)(addr+i) % PGSIZE == 0 &&
+80105d82:	74 44                	je     80105dc8 <piperead+0x2c8>
+      memmove(addr+i, (char*)P2V(l->pa) + l->off, m);
+80105d84:	8b 80 94 00 00 00    	mov    0x94(%eax),%eax
+80105d8a:	e9 24 fe ff ff       	jmp    80105bb3 <piperead+0xb3>
+80105d8f:	90                   	nop
+      release(&p->lock);
+80105d90:	83 ec 0c             	sub    $0xc,%esp
+      return -1;
+80105d93:	be ff ff ff ff       	mov    $0xffffffff,%esi
+      release(&p->lock);
+80105d98:	57                   	push   %edi
+80105d99:	e8 22 1f 00 00       	call   80107cc0 <release>
+      return -1;
+80105d9e:	83 c4 10             	add    $0x10,%esp
+}
+80105da1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105da4:	89 f0                	mov    %esi,%eax
+80105da6:	5b                   	pop    %ebx
+80105da7:	5e                   	pop    %esi
+80105da8:	5f                   	pop    %edi
+80105da9:	5d                   	pop    %ebp
+80105daa:	c3                   	ret
+80105dab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105daf:	90                   	nop
+        kfree(P2V(l->pa));
+80105db0:	83 ec 0c             	sub    $0xc,%esp
+80105db3:	05 00 00 00 80       	add    $0x80000000,%eax
+80105db8:	50                   	push   %eax
+80105db9:	e8 62 e1 ff ff       	call   80103f20 <kfree>
+80105dbe:	83 c4 10             	add    $0x10,%esp
+80105dc1:	eb 87                	jmp    80105d4a <piperead+0x24a>
+80105dc3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105dc7:	90                   	nop
+      l->pa = 0;
+80105dc8:	c7 80 90 00 00 00 00 	movl   $0x0,0x90(%eax)
+80105dcf:	00 00 00 
+80105dd2:	e9 02 fe ff ff       	jmp    80105bd9 <piperead+0xd9>
+80105dd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105dde:	66 90                	xchg   %ax,%ax
+    wakeup(&p->nwrite);  //DOC: piperead-wakeup
+80105de0:	83 ec 0c             	sub    $0xc,%esp
+80105de3:	8d 47 38             	lea    0x38(%edi),%eax
+80105de6:	50                   	push   %eax
+80105de7:	e8 04 17 00 00       	call   801074f0 <wakeup>
+80105dec:	83 c4 10             	add    $0x10,%esp
+80105def:	e9 14 ff ff ff       	jmp    80105d08 <piperead+0x208>
+80105df4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105dfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105dff:	90                   	nop
+
+80105e00 <pipesize>:
+// Make p's ring hold at least n bytes, or if n is 0 just
+// report its capacity. The ring can only change size while
+// it is empty. Returns the capacity, or -1.
+int
+pipesize(struct pipe *p, int n)
+{
+80105e00:	55                   	push   %ebp
+80105e01:	89 e5                	mov    %esp,%ebp
+80105e03:	56                   	push   %esi
+80105e04:	53                   	push   %ebx
+80105e05:	8b 75 0c             	mov    0xc(%ebp),%esi
+80105e08:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int npage, r;
+  char *pg;
+
+  if(n < 0)
+80105e0b:	85 f6                	test   %esi,%esi
+80105e0d:	0f 88 4a 01 00 00    	js     80105f5d <pipesize+0x15d>
+    return -1;
+  acquire(&p->lock);
+80105e13:	83 ec 0c             	sub    $0xc,%esp
+80105e16:	53                   	push   %ebx
+80105e17:	e8 04 1f 00 00       	call   80107d20 <acquire>
+  r = 0;
+  if(n > 0){
+80105e1c:	83 c4 10             	add    $0x10,%esp
+80105e1f:	85 f6                	test   %esi,%esi
+80105e21:	0f 84 c6 00 00 00    	je     80105eed <pipesize+0xed>
+    npage = n <= PIPEDATA ? 0 : (n - PIPEDATA + PGSIZE-1) / PGSIZE;
+80105e27:	81 fe fc 0e 00 00    	cmp    $0xefc,%esi
+80105e2d:	0f 8e d5 00 00 00    	jle    80105f08 <pipesize+0x108>
+80105e33:	8d 86 03 01 00 00    	lea    0x103(%esi),%eax
+80105e39:	89 c6                	mov    %eax,%esi
+80105e3b:	c1 ee 0c             	shr    $0xc,%esi
+    if(npage > PIPEMAXPG || p->rcount > 0){
+80105e3e:	3d ff 0f 01 00       	cmp    $0x10fff,%eax
+80105e43:	0f 87 08 01 00 00    	ja     80105f51 <pipesize+0x151>
+80105e49:	8b 43 44             	mov    0x44(%ebx),%eax
+80105e4c:	85 c0                	test   %eax,%eax
+80105e4e:	0f 85 fd 00 00 00    	jne    80105f51 <pipesize+0x151>
+      release(&p->lock);
+      return -1;
+    }
+    while(p->npage > npage)
+80105e54:	8b 43 48             	mov    0x48(%ebx),%eax
+80105e57:	39 c6                	cmp    %eax,%esi
+80105e59:	7d 21                	jge    80105e7c <pipesize+0x7c>
+80105e5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105e5f:	90                   	nop
+      kfree(p->page[--p->npage]);
+80105e60:	8d 50 ff             	lea    -0x1(%eax),%edx
+80105e63:	83 ec 0c             	sub    $0xc,%esp
+80105e66:	89 53 48             	mov    %edx,0x48(%ebx)
+80105e69:	ff 74 83 48          	push   0x48(%ebx,%eax,4)
+80105e6d:	e8 ae e0 ff ff       	call   80103f20 <kfree>
+    while(p->npage > npage)
+80105e72:	8b 43 48             	mov    0x48(%ebx),%eax
+80105e75:	83 c4 10             	add    $0x10,%esp
+80105e78:	39 f0                	cmp    %esi,%eax
+80105e7a:	7f e4                	jg     80105e60 <pipesize+0x60>
+    while(p->npage < npage){
+80105e7c:	39 c6                	cmp    %eax,%esi
+80105e7e:	7f 19                	jg     80105e99 <pipesize+0x99>
+80105e80:	e9 9c 00 00 00       	jmp    80105f21 <pipesize+0x121>
+80105e85:	8d 76 00             	lea    0x0(%esi),%esi
+      if((pg = kalloc()) == 0){
+        r = -1;
+        break;
+      }
+      p->page[p->npage++] = pg;
+80105e88:	8b 4b 48             	mov    0x48(%ebx),%ecx
+80105e8b:	8d 51 01             	lea    0x1(%ecx),%edx
+80105e8e:	89 53 48             	mov    %edx,0x48(%ebx)
+80105e91:	89 44 8b 4c          	mov    %eax,0x4c(%ebx,%ecx,4)
+    while(p->npage < npage){
+80105e95:	39 d6                	cmp    %edx,%esi
+80105e97:	7e 37                	jle    80105ed0 <pipesize+0xd0>
+      if((pg = kalloc()) == 0){
+80105e99:	e8 42 e3 ff ff       	call   801041e0 <kalloc>
+80105e9e:	85 c0                	test   %eax,%eax
+80105ea0:	75 e6                	jne    80105e88 <pipesize+0x88>
+    }
+    p->size = PIPEDATA + p->npage*PGSIZE;
+80105ea2:	8b 43 48             	mov    0x48(%ebx),%eax
+    p->rhead = 0;
+    if(p->wwait)
+80105ea5:	8b 8b 00 01 00 00    	mov    0x100(%ebx),%ecx
+    p->rhead = 0;
+80105eab:	c7 43 40 00 00 00 00 	movl   $0x0,0x40(%ebx)
+    p->size = PIPEDATA + p->npage*PGSIZE;
+80105eb2:	c1 e0 0c             	shl    $0xc,%eax
+80105eb5:	05 fc 0e 00 00       	add    $0xefc,%eax
+80105eba:	89 43 3c             	mov    %eax,0x3c(%ebx)
+    if(p->wwait)
+80105ebd:	85 c9                	test   %ecx,%ecx
+80105ebf:	75 4f                	jne    80105f10 <pipesize+0x110>
+    npage = n <= PIPEDATA ? 0 : (n - PIPEDATA + PGSIZE-1) / PGSIZE;
+80105ec1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80105ec6:	eb 28                	jmp    80105ef0 <pipesize+0xf0>
+80105ec8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105ecf:	90                   	nop
+    p->size = PIPEDATA + p->npage*PGSIZE;
+80105ed0:	c1 e2 0c             	shl    $0xc,%edx
+    if(p->wwait)
+80105ed3:	8b 83 00 01 00 00    	mov    0x100(%ebx),%eax
+    p->rhead = 0;
+80105ed9:	c7 43 40 00 00 00 00 	movl   $0x0,0x40(%ebx)
+    p->size = PIPEDATA + p->npage*PGSIZE;
+80105ee0:	81 c2 fc 0e 00 00    	add    $0xefc,%edx
+80105ee6:	89 53 3c             	mov    %edx,0x3c(%ebx)
+    if(p->wwait)
+80105ee9:	85 c0                	test   %eax,%eax
+80105eeb:	75 53                	jne    80105f40 <pipesize+0x140>
+      wakeup(&p->nwrite);
+  }
+  if(r == 0)
+    r = p->size;
+80105eed:	8b 73 3c             	mov    0x3c(%ebx),%esi
+  release(&p->lock);
+80105ef0:	83 ec 0c             	sub    $0xc,%esp
+80105ef3:	53                   	push   %ebx
+80105ef4:	e8 c7 1d 00 00       	call   80107cc0 <release>
+  return r;
+80105ef9:	83 c4 10             	add    $0x10,%esp
+}
+80105efc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80105eff:	89 f0                	mov    %esi,%eax
+80105f01:	5b                   	pop    %ebx
+80105f02:	5e                   	pop    %esi
+80105f03:	5d                   	pop    %ebp
+80105f04:	c3                   	ret
+80105f05:	8d 76 00             	lea    0x0(%esi),%esi
+    npage = n <= PIPEDATA ? 0 : (n - PIPEDATA + PGSIZE-1) / PGSIZE;
+80105f08:	31 f6                	xor    %esi,%esi
+80105f0a:	e9 3a ff ff ff       	jmp    80105e49 <pipesize+0x49>
+80105f0f:	90                   	nop
+      wakeup(&p->nwrite);
+80105f10:	83 ec 0c             	sub    $0xc,%esp
+80105f13:	8d 43 38             	lea    0x38(%ebx),%eax
+80105f16:	50                   	push   %eax
+80105f17:	e8 d4 15 00 00       	call   801074f0 <wakeup>
+80105f1c:	83 c4 10             	add    $0x10,%esp
+80105f1f:	eb a0                	jmp    80105ec1 <pipesize+0xc1>
+    p->size = PIPEDATA + p->npage*PGSIZE;
+80105f21:	c1 e0 0c             	shl    $0xc,%eax
+    if(p->wwait)
+80105f24:	8b 93 00 01 00 00    	mov    0x100(%ebx),%edx
+    p->rhead = 0;
+80105f2a:	c7 43 40 00 00 00 00 	movl   $0x0,0x40(%ebx)
+    p->size = PIPEDATA + p->npage*PGSIZE;
+80105f31:	8d b0 fc 0e 00 00    	lea    0xefc(%eax),%esi
+80105f37:	89 73 3c             	mov    %esi,0x3c(%ebx)
+    if(p->wwait)
+80105f3a:	85 d2                	test   %edx,%edx
+80105f3c:	74 b2                	je     80105ef0 <pipesize+0xf0>
+80105f3e:	66 90                	xchg   %ax,%ax
+      wakeup(&p->nwrite);
+80105f40:	83 ec 0c             	sub    $0xc,%esp
+80105f43:	8d 43 38             	lea    0x38(%ebx),%eax
+80105f46:	50                   	push   %eax
+80105f47:	e8 a4 15 00 00       	call   801074f0 <wakeup>
+80105f4c:	83 c4 10             	add    $0x10,%esp
+80105f4f:	eb 9c                	jmp    80105eed <pipesize+0xed>
+      release(&p->lock);
+80105f51:	83 ec 0c             	sub    $0xc,%esp
+80105f54:	53                   	push   %ebx
+80105f55:	e8 66 1d 00 00       	call   80107cc0 <release>
+      return -1;
+80105f5a:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80105f5d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80105f62:	eb 98                	jmp    80105efc <pipesize+0xfc>
+80105f64:	66 90                	xchg   %ax,%ax
+80105f66:	66 90                	xchg   %ax,%ax
+80105f68:	66 90                	xchg   %ax,%ax
+80105f6a:	66 90                	xchg   %ax,%ax
+80105f6c:	66 90                	xchg   %ax,%ax
+80105f6e:	66 90                	xchg   %ax,%ax
+
+80105f70 <rqremove>:
+}
+
+// Unlink p from rq.
+static void
+rqremove(struct runq *rq, struct proc *p)
+{
+80105f70:	55                   	push   %ebp
+80105f71:	89 e5                	mov    %esp,%ebp
+80105f73:	57                   	push   %edi
+80105f74:	56                   	push   %esi
+80105f75:	53                   	push   %ebx
+80105f76:	89 c3                	mov    %eax,%ebx
+  return p->eff_priority;
+80105f78:	8b 8a a0 00 00 00    	mov    0xa0(%edx),%ecx
+{
+80105f7e:	89 d0                	mov    %edx,%eax
+  int lvl = rqlevel(p);
+
+  if(p->rqprev)
+80105f80:	8b 92 e4 00 00 00    	mov    0xe4(%edx),%edx
+    p->rqprev->rqnext = p->rqnext;
+80105f86:	8b b8 e0 00 00 00    	mov    0xe0(%eax),%edi
+  if(p->rqprev)
+80105f8c:	85 d2                	test   %edx,%edx
+80105f8e:	74 48                	je     80105fd8 <rqremove+0x68>
+    p->rqprev->rqnext = p->rqnext;
+80105f90:	89 ba e0 00 00 00    	mov    %edi,0xe0(%edx)
+  else
+    rq->head[lvl] = p->rqnext;
+  if(p->rqnext)
+80105f96:	8b 90 e0 00 00 00    	mov    0xe0(%eax),%edx
+80105f9c:	8d 71 0c             	lea    0xc(%ecx),%esi
+    p->rqnext->rqprev = p->rqprev;
+80105f9f:	8b b8 e4 00 00 00    	mov    0xe4(%eax),%edi
+  if(p->rqnext)
+80105fa5:	85 d2                	test   %edx,%edx
+80105fa7:	74 46                	je     80105fef <rqremove+0x7f>
+    p->rqnext->rqprev = p->rqprev;
+80105fa9:	89 ba e4 00 00 00    	mov    %edi,0xe4(%edx)
+  else
+    rq->tail[lvl] = p->rqprev;
+  if(rq->head[lvl] == 0)
+80105faf:	8b 54 b3 04          	mov    0x4(%ebx,%esi,4),%edx
+80105fb3:	85 d2                	test   %edx,%edx
+80105fb5:	74 44                	je     80105ffb <rqremove+0x8b>
+    rq->bitmap &= ~(1 << lvl);
+  p->rqnext = p->rqprev = 0;
+80105fb7:	c7 80 e4 00 00 00 00 	movl   $0x0,0xe4(%eax)
+80105fbe:	00 00 00 
+80105fc1:	c7 80 e0 00 00 00 00 	movl   $0x0,0xe0(%eax)
+80105fc8:	00 00 00 
+  rq->nrunnable--;
+80105fcb:	83 6b 60 01          	subl   $0x1,0x60(%ebx)
+}
+80105fcf:	5b                   	pop    %ebx
+80105fd0:	5e                   	pop    %esi
+80105fd1:	5f                   	pop    %edi
+80105fd2:	5d                   	pop    %ebp
+80105fd3:	c3                   	ret
+80105fd4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    rq->head[lvl] = p->rqnext;
+80105fd8:	8d 71 0c             	lea    0xc(%ecx),%esi
+80105fdb:	89 7c b3 04          	mov    %edi,0x4(%ebx,%esi,4)
+  if(p->rqnext)
+80105fdf:	8b 90 e0 00 00 00    	mov    0xe0(%eax),%edx
+    p->rqnext->rqprev = p->rqprev;
+80105fe5:	8b b8 e4 00 00 00    	mov    0xe4(%eax),%edi
+  if(p->rqnext)
+80105feb:	85 d2                	test   %edx,%edx
+80105fed:	75 ba                	jne    80105fa9 <rqremove+0x39>
+    rq->tail[lvl] = p->rqprev;
+80105fef:	89 7c 8b 48          	mov    %edi,0x48(%ebx,%ecx,4)
+  if(rq->head[lvl] == 0)
+80105ff3:	8b 54 b3 04          	mov    0x4(%ebx,%esi,4),%edx
+80105ff7:	85 d2                	test   %edx,%edx
+80105ff9:	75 bc                	jne    80105fb7 <rqremove+0x47>
+    rq->bitmap &= ~(1 << lvl);
+80105ffb:	ba fe ff ff ff       	mov    $0xfffffffe,%edx
+80106000:	d3 c2                	rol    %cl,%edx
+80106002:	21 53 5c             	and    %edx,0x5c(%ebx)
+80106005:	eb b0                	jmp    80105fb7 <rqremove+0x47>
+80106007:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010600e:	66 90                	xchg   %ax,%ax
+
+80106010 <allocproc>:
+}
+
+//PAGEBREAK: 32
+static struct proc*
+allocproc(void)
+{
+80106010:	55                   	push   %ebp
+80106011:	89 e5                	mov    %esp,%ebp
+80106013:	53                   	push   %ebx
+  struct proc *p;
+  char *sp;
+
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80106014:	bb 14 eb 13 80       	mov    $0x8013eb14,%ebx
+{
+80106019:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ptable.lock);
+8010601c:	68 e0 ea 13 80       	push   $0x8013eae0
+80106021:	e8 fa 1c 00 00       	call   80107d20 <acquire>
+80106026:	83 c4 10             	add    $0x10,%esp
+80106029:	eb 17                	jmp    80106042 <allocproc+0x32>
+8010602b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010602f:	90                   	nop
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80106030:	81 c3 10 01 00 00    	add    $0x110,%ebx
+80106036:	81 fb 14 2f 14 80    	cmp    $0x80142f14,%ebx
+8010603c:	0f 84 ad 01 00 00    	je     801061ef <allocproc+0x1df>
+    if(p->state == UNUSED)
+80106042:	8b 43 0c             	mov    0xc(%ebx),%eax
+80106045:	85 c0                	test   %eax,%eax
+80106047:	75 e7                	jne    80106030 <allocproc+0x20>
+  release(&ptable.lock);
+  return 0;
+
+found:
+  p->state = EMBRYO;
+  p->pid = nextpid++;
+80106049:	a1 04 f0 10 80       	mov    0x8010f004,%eax
+  p->state = EMBRYO;
+8010604e:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  pidhash(p);
+  release(&ptable.lock);
+80106055:	83 ec 0c             	sub    $0xc,%esp
+  p->pid = nextpid++;
+80106058:	8d 50 01             	lea    0x1(%eax),%edx
+8010605b:	89 43 10             	mov    %eax,0x10(%ebx)
+8010605e:	89 15 04 f0 10 80    	mov    %edx,0x8010f004
+  struct proc **pp = &ptable.pidhash[PIDHASH(p->pid)];
+80106064:	99                   	cltd
+80106065:	c1 ea 1a             	shr    $0x1a,%edx
+80106068:	01 d0                	add    %edx,%eax
+8010606a:	83 e0 3f             	and    $0x3f,%eax
+8010606d:	29 d0                	sub    %edx,%eax
+  p->pidnext = *pp;
+8010606f:	05 4c 11 00 00       	add    $0x114c,%eax
+80106074:	8b 14 85 e4 ea 13 80 	mov    -0x7fec151c(,%eax,4),%edx
+8010607b:	89 53 3c             	mov    %edx,0x3c(%ebx)
+  *pp = p;
+8010607e:	89 1c 85 e4 ea 13 80 	mov    %ebx,-0x7fec151c(,%eax,4)
+  release(&ptable.lock);
+80106085:	68 e0 ea 13 80       	push   $0x8013eae0
+8010608a:	e8 31 1c 00 00       	call   80107cc0 <release>
+
+  // Allocate kernel stack.
+  if((p->kstack = kalloc()) == 0){
+8010608f:	e8 4c e1 ff ff       	call   801041e0 <kalloc>
+80106094:	83 c4 10             	add    $0x10,%esp
+80106097:	89 43 08             	mov    %eax,0x8(%ebx)
+8010609a:	85 c0                	test   %eax,%eax
+8010609c:	0f 84 f7 00 00 00    	je     80106199 <allocproc+0x189>
+    return 0;
+  }
+  sp = p->kstack + KSTACKSIZE;
+
+  // Leave room for trap frame.
+  sp -= sizeof *p->tf;
+801060a2:	8d 90 b4 0f 00 00    	lea    0xfb4(%eax),%edx
+  sp -= 4;
+  *(uint*)sp = (uint)trapret;
+
+  sp -= sizeof *p->context;
+  p->context = (struct context*)sp;
+  memset(p->context, 0, sizeof *p->context);
+801060a8:	83 ec 04             	sub    $0x4,%esp
+  sp -= sizeof *p->context;
+801060ab:	05 9c 0f 00 00       	add    $0xf9c,%eax
+  sp -= sizeof *p->tf;
+801060b0:	89 53 28             	mov    %edx,0x28(%ebx)
+  *(uint*)sp = (uint)trapret;
+801060b3:	c7 40 14 c6 96 10 80 	movl   $0x801096c6,0x14(%eax)
+  p->context = (struct context*)sp;
+801060ba:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  memset(p->context, 0, sizeof *p->context);
+801060bd:	6a 14                	push   $0x14
+801060bf:	6a 00                	push   $0x0
+801060c1:	50                   	push   %eax
+801060c2:	e8 39 1d 00 00       	call   80107e00 <memset>
+  p->context->eip = (uint)forkret;
+801060c7:	8b 43 2c             	mov    0x2c(%ebx),%eax
+
+  p->tprev = 0;
+  p->runticks = p->waitticks = p->maxwait = 0;
+  p->nswitch = p->nboost = 0;
+
+  return p;
+801060ca:	83 c4 10             	add    $0x10,%esp
+  p->context->eip = (uint)forkret;
+801060cd:	c7 40 10 e0 64 10 80 	movl   $0x801064e0,0x10(%eax)
+}
+801060d4:	89 d8                	mov    %ebx,%eax
+  p->nice          = 2;
+801060d6:	c7 83 98 00 00 00 02 	movl   $0x2,0x98(%ebx)
+801060dd:	00 00 00 
+  p->base_priority = 2;
+801060e0:	c7 83 9c 00 00 00 02 	movl   $0x2,0x9c(%ebx)
+801060e7:	00 00 00 
+  p->eff_priority  = 2;
+801060ea:	c7 83 a0 00 00 00 02 	movl   $0x2,0xa0(%ebx)
+801060f1:	00 00 00 
+  p->agestart      = 0;   // EXTRA CREDIT: aging clock
+801060f4:	c7 83 a4 00 00 00 00 	movl   $0x0,0xa4(%ebx)
+801060fb:	00 00 00 
+  p->slice         = 0;
+801060fe:	c7 83 a8 00 00 00 00 	movl   $0x0,0xa8(%ebx)
+80106105:	00 00 00 
+  p->boosted       = -1;
+80106108:	c7 83 ac 00 00 00 ff 	movl   $0xffffffff,0xac(%ebx)
+8010610f:	ff ff ff 
+  p->vruntime      = 0;
+80106112:	c7 83 b0 00 00 00 00 	movl   $0x0,0xb0(%ebx)
+80106119:	00 00 00 
+8010611c:	c7 83 b4 00 00 00 00 	movl   $0x0,0xb4(%ebx)
+80106123:	00 00 00 
+  p->tickets       = DEFTICKETS;
+80106126:	c7 83 c4 00 00 00 00 	movl   $0x400,0xc4(%ebx)
+8010612d:	04 00 00 
+  p->borrowed      = 0;
+80106130:	c7 83 c8 00 00 00 00 	movl   $0x0,0xc8(%ebx)
+80106137:	00 00 00 
+  p->lendto        = 0;
+8010613a:	c7 83 cc 00 00 00 00 	movl   $0x0,0xcc(%ebx)
+80106141:	00 00 00 
+  p->lendpid       = 0;
+80106144:	c7 83 d0 00 00 00 00 	movl   $0x0,0xd0(%ebx)
+8010614b:	00 00 00 
+  p->lending       = 0;
+8010614e:	c7 83 d4 00 00 00 00 	movl   $0x0,0xd4(%ebx)
+80106155:	00 00 00 
+  p->tprev = 0;
+80106158:	c7 83 f4 00 00 00 00 	movl   $0x0,0xf4(%ebx)
+8010615f:	00 00 00 
+  p->runticks = p->waitticks = p->maxwait = 0;
+80106162:	c7 83 04 01 00 00 00 	movl   $0x0,0x104(%ebx)
+80106169:	00 00 00 
+8010616c:	c7 83 00 01 00 00 00 	movl   $0x0,0x100(%ebx)
+80106173:	00 00 00 
+80106176:	c7 83 fc 00 00 00 00 	movl   $0x0,0xfc(%ebx)
+8010617d:	00 00 00 
+  p->nswitch = p->nboost = 0;
+80106180:	c7 83 0c 01 00 00 00 	movl   $0x0,0x10c(%ebx)
+80106187:	00 00 00 
+8010618a:	c7 83 08 01 00 00 00 	movl   $0x0,0x108(%ebx)
+80106191:	00 00 00 
+}
+80106194:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106197:	c9                   	leave
+80106198:	c3                   	ret
+    acquire(&ptable.lock);
+80106199:	83 ec 0c             	sub    $0xc,%esp
+8010619c:	68 e0 ea 13 80       	push   $0x8013eae0
+801061a1:	e8 7a 1b 00 00       	call   80107d20 <acquire>
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+801061a6:	8b 43 10             	mov    0x10(%ebx),%eax
+801061a9:	83 c4 10             	add    $0x10,%esp
+801061ac:	89 c1                	mov    %eax,%ecx
+801061ae:	c1 f9 1f             	sar    $0x1f,%ecx
+801061b1:	c1 e9 1a             	shr    $0x1a,%ecx
+801061b4:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+801061b7:	83 e2 3f             	and    $0x3f,%edx
+801061ba:	29 ca                	sub    %ecx,%edx
+801061bc:	8b 04 95 14 30 14 80 	mov    -0x7febcfec(,%edx,4),%eax
+801061c3:	39 c3                	cmp    %eax,%ebx
+801061c5:	74 41                	je     80106208 <allocproc+0x1f8>
+801061c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801061ce:	66 90                	xchg   %ax,%ax
+801061d0:	89 c2                	mov    %eax,%edx
+801061d2:	8b 40 3c             	mov    0x3c(%eax),%eax
+801061d5:	39 c3                	cmp    %eax,%ebx
+801061d7:	75 f7                	jne    801061d0 <allocproc+0x1c0>
+801061d9:	83 c2 3c             	add    $0x3c,%edx
+  *pp = p->pidnext;
+801061dc:	8b 43 3c             	mov    0x3c(%ebx),%eax
+801061df:	89 02                	mov    %eax,(%edx)
+  p->pid = 0;
+801061e1:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  p->state = UNUSED;
+801061e8:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    release(&ptable.lock);
+801061ef:	83 ec 0c             	sub    $0xc,%esp
+  return 0;
+801061f2:	31 db                	xor    %ebx,%ebx
+    release(&ptable.lock);
+801061f4:	68 e0 ea 13 80       	push   $0x8013eae0
+801061f9:	e8 c2 1a 00 00       	call   80107cc0 <release>
+}
+801061fe:	89 d8                	mov    %ebx,%eax
+    return 0;
+80106200:	83 c4 10             	add    $0x10,%esp
+}
+80106203:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106206:	c9                   	leave
+80106207:	c3                   	ret
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+80106208:	8d 14 95 14 30 14 80 	lea    -0x7febcfec(,%edx,4),%edx
+8010620f:	eb cb                	jmp    801061dc <allocproc+0x1cc>
+80106211:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106218:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010621f:	90                   	nop
+
+80106220 <pinit>:
+{
+80106220:	55                   	push   %ebp
+80106221:	89 e5                	mov    %esp,%ebp
+80106223:	53                   	push   %ebx
+80106224:	bb 60 e7 13 80       	mov    $0x8013e760,%ebx
+80106229:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&ptable.lock, "ptable");
+8010622c:	68 38 bb 10 80       	push   $0x8010bb38
+80106231:	68 e0 ea 13 80       	push   $0x8013eae0
+80106236:	e8 05 19 00 00       	call   80107b40 <initlock>
+  for(i = 0; i < NCPU; i++)
+8010623b:	83 c4 10             	add    $0x10,%esp
+8010623e:	66 90                	xchg   %ax,%ax
+    initlock(&runq[i].lock, "runq");
+80106240:	83 ec 08             	sub    $0x8,%esp
+80106243:	68 3f bb 10 80       	push   $0x8010bb3f
+80106248:	53                   	push   %ebx
+  for(i = 0; i < NCPU; i++)
+80106249:	83 c3 70             	add    $0x70,%ebx
+    initlock(&runq[i].lock, "runq");
+8010624c:	e8 ef 18 00 00       	call   80107b40 <initlock>
+  for(i = 0; i < NCPU; i++)
+80106251:	83 c4 10             	add    $0x10,%esp
+80106254:	81 fb e0 ea 13 80    	cmp    $0x8013eae0,%ebx
+8010625a:	75 e4                	jne    80106240 <pinit+0x20>
+}
+8010625c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010625f:	c9                   	leave
+80106260:	c3                   	ret
+80106261:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106268:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010626f:	90                   	nop
+
+80106270 <mycpu>:
+{
+80106270:	55                   	push   %ebp
+80106271:	89 e5                	mov    %esp,%ebp
+80106273:	56                   	push   %esi
+80106274:	53                   	push   %ebx
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80106275:	9c                   	pushf
+80106276:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80106277:	f6 c4 02             	test   $0x2,%ah
+8010627a:	75 46                	jne    801062c2 <mycpu+0x52>
+  apicid = lapicid();
+8010627c:	e8 af e5 ff ff       	call   80104830 <lapicid>
+  for (i = 0; i < ncpu; ++i) {
+80106281:	8b 35 a4 e1 13 80    	mov    0x8013e1a4,%esi
+80106287:	85 f6                	test   %esi,%esi
+80106289:	7e 2a                	jle    801062b5 <mycpu+0x45>
+8010628b:	31 d2                	xor    %edx,%edx
+8010628d:	eb 08                	jmp    80106297 <mycpu+0x27>
+8010628f:	90                   	nop
+80106290:	83 c2 01             	add    $0x1,%edx
+80106293:	39 f2                	cmp    %esi,%edx
+80106295:	74 1e                	je     801062b5 <mycpu+0x45>
+    if (cpus[i].apicid == apicid)
+80106297:	69 ca b4 00 00 00    	imul   $0xb4,%edx,%ecx
+8010629d:	0f b6 99 c0 e1 13 80 	movzbl -0x7fec1e40(%ecx),%ebx
+801062a4:	39 c3                	cmp    %eax,%ebx
+801062a6:	75 e8                	jne    80106290 <mycpu+0x20>
+}
+801062a8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return &cpus[i];
+801062ab:	8d 81 c0 e1 13 80    	lea    -0x7fec1e40(%ecx),%eax
+}
+801062b1:	5b                   	pop    %ebx
+801062b2:	5e                   	pop    %esi
+801062b3:	5d                   	pop    %ebp
+801062b4:	c3                   	ret
+  panic("unknown apicid\n");
+801062b5:	83 ec 0c             	sub    $0xc,%esp
+801062b8:	68 44 bb 10 80       	push   $0x8010bb44
+801062bd:	e8 be a5 ff ff       	call   80100880 <panic>
+    panic("mycpu called with interrupts enabled\n");
+801062c2:	83 ec 0c             	sub    $0xc,%esp
+801062c5:	68 38 bc 10 80       	push   $0x8010bc38
+801062ca:	e8 b1 a5 ff ff       	call   80100880 <panic>
+801062cf:	90                   	nop
+
+801062d0 <cpuid>:
+cpuid() {
+801062d0:	55                   	push   %ebp
+801062d1:	89 e5                	mov    %esp,%ebp
+801062d3:	83 ec 08             	sub    $0x8,%esp
+  return mycpu()-cpus;
+801062d6:	e8 95 ff ff ff       	call   80106270 <mycpu>
+}
+801062db:	c9                   	leave
+  return mycpu()-cpus;
+801062dc:	2d c0 e1 13 80       	sub    $0x8013e1c0,%eax
+801062e1:	c1 f8 02             	sar    $0x2,%eax
+801062e4:	69 c0 a5 4f fa a4    	imul   $0xa4fa4fa5,%eax,%eax
+}
+801062ea:	c3                   	ret
+801062eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801062ef:	90                   	nop
+
+801062f0 <setrunnable>:
+{
+801062f0:	55                   	push   %ebp
+801062f1:	89 e5                	mov    %esp,%ebp
+801062f3:	57                   	push   %edi
+801062f4:	56                   	push   %esi
+801062f5:	53                   	push   %ebx
+801062f6:	83 ec 0c             	sub    $0xc,%esp
+  p->readyat = ticks;
+801062f9:	8b 0d 40 35 14 80    	mov    0x80143540,%ecx
+  p->state = RUNNABLE;
+801062ff:	c7 42 0c 03 00 00 00 	movl   $0x3,0xc(%edx)
+  p->readyat = ticks;
+80106306:	89 8a f8 00 00 00    	mov    %ecx,0xf8(%edx)
+  p->agestart = rq->passes;       // start aging from zero
+8010630c:	8b 48 64             	mov    0x64(%eax),%ecx
+  p->rqnext = 0;
+8010630f:	c7 82 e0 00 00 00 00 	movl   $0x0,0xe0(%edx)
+80106316:	00 00 00 
+  p->agestart = rq->passes;       // start aging from zero
+80106319:	89 8a a4 00 00 00    	mov    %ecx,0xa4(%edx)
+  return p->eff_priority;
+8010631f:	8b 8a a0 00 00 00    	mov    0xa0(%edx),%ecx
+  p->rqprev = rq->tail[lvl];
+80106325:	8d 71 10             	lea    0x10(%ecx),%esi
+80106328:	8b 5c b0 08          	mov    0x8(%eax,%esi,4),%ebx
+8010632c:	89 9a e4 00 00 00    	mov    %ebx,0xe4(%edx)
+  if(rq->tail[lvl])
+80106332:	85 db                	test   %ebx,%ebx
+80106334:	0f 84 a6 00 00 00    	je     801063e0 <setrunnable+0xf0>
+    rq->tail[lvl]->rqnext = p;
+8010633a:	89 93 e0 00 00 00    	mov    %edx,0xe0(%ebx)
+  rq->tail[lvl] = p;
+80106340:	89 54 b0 08          	mov    %edx,0x8(%eax,%esi,4)
+  rq->bitmap |= 1 << lvl;
+80106344:	ba 01 00 00 00       	mov    $0x1,%edx
+80106349:	d3 e2                	shl    %cl,%edx
+  rq->nrunnable++;
+8010634b:	8b 48 60             	mov    0x60(%eax),%ecx
+  rq->bitmap |= 1 << lvl;
+8010634e:	09 50 5c             	or     %edx,0x5c(%eax)
+  rq->nrunnable++;
+80106351:	8d 51 01             	lea    0x1(%ecx),%edx
+80106354:	89 50 60             	mov    %edx,0x60(%eax)
+  c = &cpus[rq - runq];
+80106357:	2d 60 e7 13 80       	sub    $0x8013e760,%eax
+8010635c:	c1 f8 04             	sar    $0x4,%eax
+  if(c->idle){
+8010635f:	69 f0 ac 24 49 92    	imul   $0x924924ac,%eax,%esi
+80106365:	8b 9e 70 e2 13 80    	mov    -0x7fec1d90(%esi),%ebx
+8010636b:	8d be c0 e1 13 80    	lea    -0x7fec1e40(%esi),%edi
+80106371:	85 db                	test   %ebx,%ebx
+80106373:	75 7b                	jne    801063f0 <setrunnable+0x100>
+  if(rq->nrunnable < 2)
+80106375:	83 fa 01             	cmp    $0x1,%edx
+80106378:	7e 55                	jle    801063cf <setrunnable+0xdf>
+  for(i = 0; i < ncpu; i++){
+8010637a:	a1 a4 e1 13 80       	mov    0x8013e1a4,%eax
+8010637f:	85 c0                	test   %eax,%eax
+80106381:	7e 4c                	jle    801063cf <setrunnable+0xdf>
+80106383:	be c0 e1 13 80       	mov    $0x8013e1c0,%esi
+80106388:	eb 17                	jmp    801063a1 <setrunnable+0xb1>
+8010638a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80106390:	83 c3 01             	add    $0x1,%ebx
+80106393:	81 c6 b4 00 00 00    	add    $0xb4,%esi
+80106399:	3b 1d a4 e1 13 80    	cmp    0x8013e1a4,%ebx
+8010639f:	7d 2e                	jge    801063cf <setrunnable+0xdf>
+    if(cpus[i].idle && &cpus[i] != mycpu()){
+801063a1:	69 fb b4 00 00 00    	imul   $0xb4,%ebx,%edi
+801063a7:	8b 87 70 e2 13 80    	mov    -0x7fec1d90(%edi),%eax
+801063ad:	85 c0                	test   %eax,%eax
+801063af:	74 df                	je     80106390 <setrunnable+0xa0>
+801063b1:	e8 ba fe ff ff       	call   80106270 <mycpu>
+801063b6:	39 f0                	cmp    %esi,%eax
+801063b8:	74 d6                	je     80106390 <setrunnable+0xa0>
+      lapicipi(cpus[i].apicid, T_IRQ0 + IRQ_WAKEUP);
+801063ba:	83 ec 08             	sub    $0x8,%esp
+801063bd:	6a 3e                	push   $0x3e
+801063bf:	0f b6 87 c0 e1 13 80 	movzbl -0x7fec1e40(%edi),%eax
+801063c6:	50                   	push   %eax
+801063c7:	e8 54 e1 ff ff       	call   80104520 <lapicipi>
+      return;
+801063cc:	83 c4 10             	add    $0x10,%esp
+}
+801063cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801063d2:	5b                   	pop    %ebx
+801063d3:	5e                   	pop    %esi
+801063d4:	5f                   	pop    %edi
+801063d5:	5d                   	pop    %ebp
+801063d6:	c3                   	ret
+801063d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801063de:	66 90                	xchg   %ax,%ax
+    rq->head[lvl] = p;
+801063e0:	89 54 88 34          	mov    %edx,0x34(%eax,%ecx,4)
+801063e4:	e9 57 ff ff ff       	jmp    80106340 <setrunnable+0x50>
+801063e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(c != mycpu())
+801063f0:	e8 7b fe ff ff       	call   80106270 <mycpu>
+801063f5:	39 c7                	cmp    %eax,%edi
+801063f7:	74 d6                	je     801063cf <setrunnable+0xdf>
+      lapicipi(c->apicid, T_IRQ0 + IRQ_WAKEUP);
+801063f9:	83 ec 08             	sub    $0x8,%esp
+801063fc:	6a 3e                	push   $0x3e
+801063fe:	0f b6 86 c0 e1 13 80 	movzbl -0x7fec1e40(%esi),%eax
+80106405:	50                   	push   %eax
+80106406:	e8 15 e1 ff ff       	call   80104520 <lapicipi>
+8010640b:	83 c4 10             	add    $0x10,%esp
+}
+8010640e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106411:	5b                   	pop    %ebx
+80106412:	5e                   	pop    %esi
+80106413:	5f                   	pop    %edi
+80106414:	5d                   	pop    %ebp
+80106415:	c3                   	ret
+80106416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010641d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80106420 <wake1>:
+}
+
+// Wake p, which is SLEEPING. Caller holds ptable.lock.
+static void
+wake1(struct proc *p)
+{
+80106420:	55                   	push   %ebp
+80106421:	89 e5                	mov    %esp,%ebp
+80106423:	57                   	push   %edi
+80106424:	89 c7                	mov    %eax,%edi
+80106426:	56                   	push   %esi
+80106427:	53                   	push   %ebx
+80106428:	83 ec 0c             	sub    $0xc,%esp
+  struct runq *rq;
+
+  *p->sprev = p->snext;
+8010642b:	8b 50 38             	mov    0x38(%eax),%edx
+8010642e:	8b 40 34             	mov    0x34(%eax),%eax
+80106431:	89 02                	mov    %eax,(%edx)
+  if(p->snext)
+80106433:	85 c0                	test   %eax,%eax
+80106435:	74 06                	je     8010643d <wake1+0x1d>
+    p->snext->sprev = p->sprev;
+80106437:	8b 57 38             	mov    0x38(%edi),%edx
+8010643a:	89 50 38             	mov    %edx,0x38(%eax)
+  p->chan = 0;
+8010643d:	c7 47 30 00 00 00 00 	movl   $0x0,0x30(%edi)
+lockrq(struct proc *p)
+80106444:	eb 16                	jmp    8010645c <wake1+0x3c>
+80106446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010644d:	8d 76 00             	lea    0x0(%esi),%esi
+    release(&rq->lock);
+80106450:	83 ec 0c             	sub    $0xc,%esp
+80106453:	53                   	push   %ebx
+80106454:	e8 67 18 00 00       	call   80107cc0 <release>
+    rq = &runq[p->cpu];
+80106459:	83 c4 10             	add    $0x10,%esp
+8010645c:	6b b7 d8 00 00 00 70 	imul   $0x70,0xd8(%edi),%esi
+    acquire(&rq->lock);
+80106463:	83 ec 0c             	sub    $0xc,%esp
+    rq = &runq[p->cpu];
+80106466:	8d 9e 60 e7 13 80    	lea    -0x7fec18a0(%esi),%ebx
+    acquire(&rq->lock);
+8010646c:	53                   	push   %ebx
+8010646d:	e8 ae 18 00 00       	call   80107d20 <acquire>
+    if(rq == &runq[p->cpu])
+80106472:	6b 87 d8 00 00 00 70 	imul   $0x70,0xd8(%edi),%eax
+80106479:	83 c4 10             	add    $0x10,%esp
+8010647c:	39 c6                	cmp    %eax,%esi
+8010647e:	75 d0                	jne    80106450 <wake1+0x30>
+  unlend(p);
+  rq = lockrq(p);
+  setrunnable(rq, p);
+80106480:	89 fa                	mov    %edi,%edx
+80106482:	89 d8                	mov    %ebx,%eax
+80106484:	e8 67 fe ff ff       	call   801062f0 <setrunnable>
+  release(&rq->lock);
+80106489:	83 ec 0c             	sub    $0xc,%esp
+8010648c:	53                   	push   %ebx
+8010648d:	e8 2e 18 00 00       	call   80107cc0 <release>
+}
+80106492:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106495:	5b                   	pop    %ebx
+80106496:	5e                   	pop    %esi
+80106497:	5f                   	pop    %edi
+80106498:	5d                   	pop    %ebp
+80106499:	c3                   	ret
+8010649a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801064a0 <wakeup1>:
+}
+
+// The ptable lock must be held.
+static void
+wakeup1(void *chan)
+{
+801064a0:	55                   	push   %ebp
+801064a1:	89 e5                	mov    %esp,%ebp
+801064a3:	56                   	push   %esi
+801064a4:	89 c6                	mov    %eax,%esi
+  struct proc *p, *next;
+
+  for(p = ptable.sleepq[SQHASH(chan)]; p; p = next){
+801064a6:	69 c0 b1 79 37 9e    	imul   $0x9e3779b1,%eax,%eax
+{
+801064ac:	53                   	push   %ebx
+  for(p = ptable.sleepq[SQHASH(chan)]; p; p = next){
+801064ad:	c1 e8 1a             	shr    $0x1a,%eax
+801064b0:	8b 1c 85 14 2f 14 80 	mov    -0x7febd0ec(,%eax,4),%ebx
+801064b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801064be:	66 90                	xchg   %ax,%ax
+801064c0:	85 db                	test   %ebx,%ebx
+801064c2:	74 13                	je     801064d7 <wakeup1+0x37>
+    next = p->snext;
+801064c4:	89 d8                	mov    %ebx,%eax
+801064c6:	8b 5b 34             	mov    0x34(%ebx),%ebx
+    if(p->chan == chan)
+801064c9:	39 70 30             	cmp    %esi,0x30(%eax)
+801064cc:	75 f2                	jne    801064c0 <wakeup1+0x20>
+      wake1(p);
+801064ce:	e8 4d ff ff ff       	call   80106420 <wake1>
+  for(p = ptable.sleepq[SQHASH(chan)]; p; p = next){
+801064d3:	85 db                	test   %ebx,%ebx
+801064d5:	75 ed                	jne    801064c4 <wakeup1+0x24>
+  }
+}
+801064d7:	5b                   	pop    %ebx
+801064d8:	5e                   	pop    %esi
+801064d9:	5d                   	pop    %ebp
+801064da:	c3                   	ret
+801064db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801064df:	90                   	nop
+
+801064e0 <forkret>:
+{
+801064e0:	55                   	push   %ebp
+801064e1:	89 e5                	mov    %esp,%ebp
+801064e3:	53                   	push   %ebx
+801064e4:	83 ec 04             	sub    $0x4,%esp
+  pushcli();
+801064e7:	e8 e4 16 00 00       	call   80107bd0 <pushcli>
+  c = mycpu();
+801064ec:	e8 7f fd ff ff       	call   80106270 <mycpu>
+  p = c->proc;
+801064f1:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+801064f7:	e8 24 17 00 00       	call   80107c20 <popcli>
+  release(&runq[myproc()->cpu].lock);
+801064fc:	83 ec 0c             	sub    $0xc,%esp
+801064ff:	6b 83 d8 00 00 00 70 	imul   $0x70,0xd8(%ebx),%eax
+80106506:	05 60 e7 13 80       	add    $0x8013e760,%eax
+8010650b:	50                   	push   %eax
+8010650c:	e8 af 17 00 00       	call   80107cc0 <release>
+  if (first) {
+80106511:	a1 00 f0 10 80       	mov    0x8010f000,%eax
+80106516:	83 c4 10             	add    $0x10,%esp
+80106519:	85 c0                	test   %eax,%eax
+8010651b:	75 0b                	jne    80106528 <forkret+0x48>
+}
+8010651d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106520:	c9                   	leave
+80106521:	c3                   	ret
+80106522:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    first = 0;
+80106528:	c7 05 00 f0 10 80 00 	movl   $0x0,0x8010f000
+8010652f:	00 00 00 
+    iinit(ROOTDEV);
+80106532:	83 ec 0c             	sub    $0xc,%esp
+80106535:	6a 01                	push   $0x1
+80106537:	e8 24 bb ff ff       	call   80102060 <iinit>
+    initlog(ROOTDEV);
+8010653c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+80106543:	e8 68 e9 ff ff       	call   80104eb0 <initlog>
+}
+80106548:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010654b:	83 c4 10             	add    $0x10,%esp
+8010654e:	c9                   	leave
+8010654f:	c3                   	ret
+
+80106550 <myproc>:
+myproc(void) {
+80106550:	55                   	push   %ebp
+80106551:	89 e5                	mov    %esp,%ebp
+80106553:	53                   	push   %ebx
+80106554:	83 ec 04             	sub    $0x4,%esp
+  pushcli();
+80106557:	e8 74 16 00 00       	call   80107bd0 <pushcli>
+  c = mycpu();
+8010655c:	e8 0f fd ff ff       	call   80106270 <mycpu>
+  p = c->proc;
+80106561:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80106567:	e8 b4 16 00 00       	call   80107c20 <popcli>
+}
+8010656c:	89 d8                	mov    %ebx,%eax
+8010656e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106571:	c9                   	leave
+80106572:	c3                   	ret
+80106573:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010657a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106580 <userinit>:
+{
+80106580:	55                   	push   %ebp
+80106581:	89 e5                	mov    %esp,%ebp
+80106583:	57                   	push   %edi
+80106584:	56                   	push   %esi
+80106585:	53                   	push   %ebx
+80106586:	83 ec 0c             	sub    $0xc,%esp
+  p = allocproc();
+80106589:	e8 82 fa ff ff       	call   80106010 <allocproc>
+8010658e:	89 c6                	mov    %eax,%esi
+  initproc = p;
+80106590:	a3 14 31 14 80       	mov    %eax,0x80143114
+  if((p->pgdir = setupkvm()) == 0)
+80106595:	e8 e6 47 00 00       	call   8010ad80 <setupkvm>
+8010659a:	89 46 04             	mov    %eax,0x4(%esi)
+8010659d:	85 c0                	test   %eax,%eax
+8010659f:	0f 84 0f 01 00 00    	je     801066b4 <userinit+0x134>
+  inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+801065a5:	83 ec 04             	sub    $0x4,%esp
+801065a8:	68 2c 00 00 00       	push   $0x2c
+801065ad:	68 60 f4 10 80       	push   $0x8010f460
+801065b2:	50                   	push   %eax
+801065b3:	e8 a8 44 00 00       	call   8010aa60 <inituvm>
+  memset(p->tf, 0, sizeof(*p->tf));
+801065b8:	83 c4 0c             	add    $0xc,%esp
+  p->sz = PGSIZE;
+801065bb:	c7 06 00 10 00 00    	movl   $0x1000,(%esi)
+  memset(p->tf, 0, sizeof(*p->tf));
+801065c1:	6a 4c                	push   $0x4c
+801065c3:	6a 00                	push   $0x0
+801065c5:	ff 76 28             	push   0x28(%esi)
+801065c8:	e8 33 18 00 00       	call   80107e00 <memset>
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+801065cd:	8b 46 28             	mov    0x28(%esi),%eax
+801065d0:	ba 1b 00 00 00       	mov    $0x1b,%edx
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+801065d5:	83 c4 0c             	add    $0xc,%esp
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+801065d8:	b9 23 00 00 00       	mov    $0x23,%ecx
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+801065dd:	66 89 50 3c          	mov    %dx,0x3c(%eax)
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+801065e1:	8b 46 28             	mov    0x28(%esi),%eax
+801065e4:	66 89 48 2c          	mov    %cx,0x2c(%eax)
+  p->tf->es = p->tf->ds;
+801065e8:	8b 46 28             	mov    0x28(%esi),%eax
+801065eb:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+801065ef:	66 89 50 28          	mov    %dx,0x28(%eax)
+  p->tf->ss = p->tf->ds;
+801065f3:	8b 46 28             	mov    0x28(%esi),%eax
+801065f6:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+801065fa:	66 89 50 48          	mov    %dx,0x48(%eax)
+  p->tf->eflags = FL_IF;
+801065fe:	8b 46 28             	mov    0x28(%esi),%eax
+80106601:	c7 40 40 00 02 00 00 	movl   $0x200,0x40(%eax)
+  p->tf->esp = PGSIZE;
+80106608:	8b 46 28             	mov    0x28(%esi),%eax
+8010660b:	c7 40 44 00 10 00 00 	movl   $0x1000,0x44(%eax)
+  p->tf->eip = 0;  // beginning of initcode.S
+80106612:	8b 46 28             	mov    0x28(%esi),%eax
+80106615:	c7 40 38 00 00 00 00 	movl   $0x0,0x38(%eax)
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+8010661c:	8d 86 88 00 00 00    	lea    0x88(%esi),%eax
+80106622:	6a 10                	push   $0x10
+80106624:	68 6d bb 10 80       	push   $0x8010bb6d
+80106629:	50                   	push   %eax
+8010662a:	e8 81 19 00 00       	call   80107fb0 <safestrcpy>
+  p->cwd = namei("/");
+8010662f:	c7 04 24 76 bb 10 80 	movl   $0x8010bb76,(%esp)
+80106636:	e8 c5 cf ff ff       	call   80103600 <namei>
+8010663b:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  return mycpu()-cpus;
+80106641:	e8 2a fc ff ff       	call   80106270 <mycpu>
+  p->cpu = cpuid();
+80106646:	83 c4 10             	add    $0x10,%esp
+  return mycpu()-cpus;
+80106649:	2d c0 e1 13 80       	sub    $0x8013e1c0,%eax
+8010664e:	89 c3                	mov    %eax,%ebx
+80106650:	c1 fb 02             	sar    $0x2,%ebx
+80106653:	69 db a5 4f fa a4    	imul   $0xa4fa4fa5,%ebx,%ebx
+  p->cpu = cpuid();
+80106659:	89 9e d8 00 00 00    	mov    %ebx,0xd8(%esi)
+lockrq(struct proc *p)
+8010665f:	eb 19                	jmp    8010667a <userinit+0xfa>
+80106661:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    release(&rq->lock);
+80106668:	83 ec 0c             	sub    $0xc,%esp
+8010666b:	57                   	push   %edi
+8010666c:	e8 4f 16 00 00       	call   80107cc0 <release>
+    rq = &runq[p->cpu];
+80106671:	8b 9e d8 00 00 00    	mov    0xd8(%esi),%ebx
+80106677:	83 c4 10             	add    $0x10,%esp
+8010667a:	6b db 70             	imul   $0x70,%ebx,%ebx
+    acquire(&rq->lock);
+8010667d:	83 ec 0c             	sub    $0xc,%esp
+    rq = &runq[p->cpu];
+80106680:	8d bb 60 e7 13 80    	lea    -0x7fec18a0(%ebx),%edi
+    acquire(&rq->lock);
+80106686:	57                   	push   %edi
+80106687:	e8 94 16 00 00       	call   80107d20 <acquire>
+    if(rq == &runq[p->cpu])
+8010668c:	6b 86 d8 00 00 00 70 	imul   $0x70,0xd8(%esi),%eax
+80106693:	83 c4 10             	add    $0x10,%esp
+80106696:	39 d8                	cmp    %ebx,%eax
+80106698:	75 ce                	jne    80106668 <userinit+0xe8>
+  setrunnable(rq, p);
+8010669a:	89 f2                	mov    %esi,%edx
+8010669c:	89 f8                	mov    %edi,%eax
+8010669e:	e8 4d fc ff ff       	call   801062f0 <setrunnable>
+  release(&rq->lock);
+801066a3:	83 ec 0c             	sub    $0xc,%esp
+801066a6:	57                   	push   %edi
+801066a7:	e8 14 16 00 00       	call   80107cc0 <release>
+}
+801066ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801066af:	5b                   	pop    %ebx
+801066b0:	5e                   	pop    %esi
+801066b1:	5f                   	pop    %edi
+801066b2:	5d                   	pop    %ebp
+801066b3:	c3                   	ret
+    panic("userinit: out of memory?");
+801066b4:	83 ec 0c             	sub    $0xc,%esp
+801066b7:	68 54 bb 10 80       	push   $0x8010bb54
+801066bc:	e8 bf a1 ff ff       	call   80100880 <panic>
+801066c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801066c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801066cf:	90                   	nop
+
+801066d0 <kthread>:
+{
+801066d0:	55                   	push   %ebp
+801066d1:	89 e5                	mov    %esp,%ebp
+801066d3:	57                   	push   %edi
+801066d4:	56                   	push   %esi
+801066d5:	53                   	push   %ebx
+801066d6:	83 ec 0c             	sub    $0xc,%esp
+801066d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801066dc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if((p = allocproc()) == 0 || (p->pgdir = setupkvm()) == 0)
+801066df:	e8 2c f9 ff ff       	call   80106010 <allocproc>
+801066e4:	85 c0                	test   %eax,%eax
+801066e6:	0f 84 9e 00 00 00    	je     8010678a <kthread+0xba>
+801066ec:	89 c6                	mov    %eax,%esi
+801066ee:	e8 8d 46 00 00       	call   8010ad80 <setupkvm>
+801066f3:	89 46 04             	mov    %eax,0x4(%esi)
+801066f6:	85 c0                	test   %eax,%eax
+801066f8:	0f 84 8c 00 00 00    	je     8010678a <kthread+0xba>
+  *(uint*)(p->context + 1) = (uint)fn;
+801066fe:	8b 46 2c             	mov    0x2c(%esi),%eax
+  safestrcpy(p->name, name, sizeof(p->name));
+80106701:	83 ec 04             	sub    $0x4,%esp
+  *(uint*)(p->context + 1) = (uint)fn;
+80106704:	89 78 14             	mov    %edi,0x14(%eax)
+  safestrcpy(p->name, name, sizeof(p->name));
+80106707:	8d 86 88 00 00 00    	lea    0x88(%esi),%eax
+8010670d:	6a 10                	push   $0x10
+8010670f:	53                   	push   %ebx
+80106710:	50                   	push   %eax
+80106711:	e8 9a 18 00 00       	call   80107fb0 <safestrcpy>
+  p->parent = 0;
+80106716:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+  return mycpu()-cpus;
+8010671d:	e8 4e fb ff ff       	call   80106270 <mycpu>
+  p->cpu = cpuid();
+80106722:	83 c4 10             	add    $0x10,%esp
+  return mycpu()-cpus;
+80106725:	2d c0 e1 13 80       	sub    $0x8013e1c0,%eax
+8010672a:	89 c3                	mov    %eax,%ebx
+8010672c:	c1 fb 02             	sar    $0x2,%ebx
+8010672f:	69 db a5 4f fa a4    	imul   $0xa4fa4fa5,%ebx,%ebx
+  p->cpu = cpuid();
+80106735:	89 9e d8 00 00 00    	mov    %ebx,0xd8(%esi)
+lockrq(struct proc *p)
+8010673b:	eb 15                	jmp    80106752 <kthread+0x82>
+8010673d:	8d 76 00             	lea    0x0(%esi),%esi
+    release(&rq->lock);
+80106740:	83 ec 0c             	sub    $0xc,%esp
+80106743:	57                   	push   %edi
+80106744:	e8 77 15 00 00       	call   80107cc0 <release>
+    rq = &runq[p->cpu];
+80106749:	8b 9e d8 00 00 00    	mov    0xd8(%esi),%ebx
+8010674f:	83 c4 10             	add    $0x10,%esp
+80106752:	6b db 70             	imul   $0x70,%ebx,%ebx
+    acquire(&rq->lock);
+80106755:	83 ec 0c             	sub    $0xc,%esp
+    rq = &runq[p->cpu];
+80106758:	8d bb 60 e7 13 80    	lea    -0x7fec18a0(%ebx),%edi
+    acquire(&rq->lock);
+8010675e:	57                   	push   %edi
+8010675f:	e8 bc 15 00 00       	call   80107d20 <acquire>
+    if(rq == &runq[p->cpu])
+80106764:	6b 86 d8 00 00 00 70 	imul   $0x70,0xd8(%esi),%eax
+8010676b:	83 c4 10             	add    $0x10,%esp
+8010676e:	39 d8                	cmp    %ebx,%eax
+80106770:	75 ce                	jne    80106740 <kthread+0x70>
+  setrunnable(rq, p);
+80106772:	89 f2                	mov    %esi,%edx
+80106774:	89 f8                	mov    %edi,%eax
+80106776:	e8 75 fb ff ff       	call   801062f0 <setrunnable>
+  release(&rq->lock);
+8010677b:	89 7d 08             	mov    %edi,0x8(%ebp)
+}
+8010677e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106781:	5b                   	pop    %ebx
+80106782:	5e                   	pop    %esi
+80106783:	5f                   	pop    %edi
+80106784:	5d                   	pop    %ebp
+  release(&rq->lock);
+80106785:	e9 36 15 00 00       	jmp    80107cc0 <release>
+    panic("kthread");
+8010678a:	83 ec 0c             	sub    $0xc,%esp
+8010678d:	68 78 bb 10 80       	push   $0x8010bb78
+80106792:	e8 e9 a0 ff ff       	call   80100880 <panic>
+80106797:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010679e:	66 90                	xchg   %ax,%ax
+
+801067a0 <growproc>:
+{
+801067a0:	55                   	push   %ebp
+801067a1:	89 e5                	mov    %esp,%ebp
+801067a3:	57                   	push   %edi
+801067a4:	56                   	push   %esi
+801067a5:	53                   	push   %ebx
+801067a6:	83 ec 0c             	sub    $0xc,%esp
+801067a9:	8b 75 08             	mov    0x8(%ebp),%esi
+  pushcli();
+801067ac:	e8 1f 14 00 00       	call   80107bd0 <pushcli>
+  c = mycpu();
+801067b1:	e8 ba fa ff ff       	call   80106270 <mycpu>
+  p = c->proc;
+801067b6:	8b b8 ac 00 00 00    	mov    0xac(%eax),%edi
+  popcli();
+801067bc:	e8 5f 14 00 00       	call   80107c20 <popcli>
+  sz = curproc->sz;
+801067c1:	8b 07                	mov    (%edi),%eax
+  if(n > 0){
+801067c3:	85 f6                	test   %esi,%esi
+801067c5:	7e 49                	jle    80106810 <growproc+0x70>
+    if(sz + n < sz || sz + n >= KERNBASE ||
+801067c7:	89 f3                	mov    %esi,%ebx
+801067c9:	01 c3                	add    %eax,%ebx
+801067cb:	72 63                	jb     80106830 <growproc+0x90>
+801067cd:	85 db                	test   %ebx,%ebx
+801067cf:	78 5f                	js     80106830 <growproc+0x90>
+       PGROUNDUP(sz + n) - PGROUNDUP(sz) > (uint)kfreecount()*PGSIZE)
+801067d1:	8d b3 ff 0f 00 00    	lea    0xfff(%ebx),%esi
+801067d7:	05 ff 0f 00 00       	add    $0xfff,%eax
+801067dc:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+801067e1:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+801067e7:	29 c6                	sub    %eax,%esi
+801067e9:	e8 92 db ff ff       	call   80104380 <kfreecount>
+801067ee:	c1 e0 0c             	shl    $0xc,%eax
+    if(sz + n < sz || sz + n >= KERNBASE ||
+801067f1:	39 f0                	cmp    %esi,%eax
+801067f3:	72 3b                	jb     80106830 <growproc+0x90>
+  switchuvm(curproc);
+801067f5:	83 ec 0c             	sub    $0xc,%esp
+  curproc->sz = sz;
+801067f8:	89 1f                	mov    %ebx,(%edi)
+  switchuvm(curproc);
+801067fa:	57                   	push   %edi
+801067fb:	e8 50 41 00 00       	call   8010a950 <switchuvm>
+  return 0;
+80106800:	83 c4 10             	add    $0x10,%esp
+80106803:	31 c0                	xor    %eax,%eax
+}
+80106805:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106808:	5b                   	pop    %ebx
+80106809:	5e                   	pop    %esi
+8010680a:	5f                   	pop    %edi
+8010680b:	5d                   	pop    %ebp
+8010680c:	c3                   	ret
+8010680d:	8d 76 00             	lea    0x0(%esi),%esi
+  sz = curproc->sz;
+80106810:	89 c3                	mov    %eax,%ebx
+  } else if(n < 0){
+80106812:	74 e1                	je     801067f5 <growproc+0x55>
+    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+80106814:	83 ec 04             	sub    $0x4,%esp
+80106817:	01 c6                	add    %eax,%esi
+80106819:	56                   	push   %esi
+8010681a:	50                   	push   %eax
+8010681b:	ff 77 04             	push   0x4(%edi)
+8010681e:	e8 ad 44 00 00       	call   8010acd0 <deallocuvm>
+80106823:	83 c4 10             	add    $0x10,%esp
+80106826:	89 c3                	mov    %eax,%ebx
+80106828:	85 c0                	test   %eax,%eax
+8010682a:	75 c9                	jne    801067f5 <growproc+0x55>
+8010682c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      return -1;
+80106830:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106835:	eb ce                	jmp    80106805 <growproc+0x65>
+80106837:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010683e:	66 90                	xchg   %ax,%ax
+
+80106840 <fork>:
+{
+80106840:	55                   	push   %ebp
+80106841:	89 e5                	mov    %esp,%ebp
+80106843:	57                   	push   %edi
+80106844:	56                   	push   %esi
+80106845:	53                   	push   %ebx
+80106846:	83 ec 1c             	sub    $0x1c,%esp
+  pushcli();
+80106849:	e8 82 13 00 00       	call   80107bd0 <pushcli>
+  c = mycpu();
+8010684e:	e8 1d fa ff ff       	call   80106270 <mycpu>
+  p = c->proc;
+80106853:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80106859:	e8 c2 13 00 00       	call   80107c20 <popcli>
+  if((np = allocproc()) == 0)
+8010685e:	e8 ad f7 ff ff       	call   80106010 <allocproc>
+80106863:	85 c0                	test   %eax,%eax
+80106865:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80106868:	0f 84 1b 02 00 00    	je     80106a89 <fork+0x249>
+  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+8010686e:	83 ec 08             	sub    $0x8,%esp
+80106871:	ff 33                	push   (%ebx)
+80106873:	ff 73 04             	push   0x4(%ebx)
+80106876:	e8 f5 45 00 00       	call   8010ae70 <copyuvm>
+8010687b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010687e:	83 c4 10             	add    $0x10,%esp
+80106881:	89 42 04             	mov    %eax,0x4(%edx)
+80106884:	85 c0                	test   %eax,%eax
+80106886:	0f 84 8a 01 00 00    	je     80106a16 <fork+0x1d6>
+  np->sz = curproc->sz;
+8010688c:	8b 03                	mov    (%ebx),%eax
+  *np->tf = *curproc->tf;
+8010688e:	8b 7a 28             	mov    0x28(%edx),%edi
+80106891:	b9 13 00 00 00       	mov    $0x13,%ecx
+  np->sz = curproc->sz;
+80106896:	89 02                	mov    %eax,(%edx)
+  *np->tf = *curproc->tf;
+80106898:	8b 73 28             	mov    0x28(%ebx),%esi
+8010689b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  for(i = 0; i < NOFILE; i++)
+8010689d:	31 f6                	xor    %esi,%esi
+8010689f:	89 d7                	mov    %edx,%edi
+  np->tf->eax = 0;
+801068a1:	8b 42 28             	mov    0x28(%edx),%eax
+801068a4:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  for(i = 0; i < NOFILE; i++)
+801068ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801068af:	90                   	nop
+    if(curproc->ofile[i])
+801068b0:	8b 44 b3 44          	mov    0x44(%ebx,%esi,4),%eax
+801068b4:	85 c0                	test   %eax,%eax
+801068b6:	74 10                	je     801068c8 <fork+0x88>
+      np->ofile[i] = filedup(curproc->ofile[i]);
+801068b8:	83 ec 0c             	sub    $0xc,%esp
+801068bb:	50                   	push   %eax
+801068bc:	e8 4f ab ff ff       	call   80101410 <filedup>
+801068c1:	83 c4 10             	add    $0x10,%esp
+801068c4:	89 44 b7 44          	mov    %eax,0x44(%edi,%esi,4)
+  for(i = 0; i < NOFILE; i++)
+801068c8:	83 c6 01             	add    $0x1,%esi
+801068cb:	83 fe 10             	cmp    $0x10,%esi
+801068ce:	75 e0                	jne    801068b0 <fork+0x70>
+  np->cwd = idup(curproc->cwd);
+801068d0:	83 ec 0c             	sub    $0xc,%esp
+801068d3:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+801068d6:	ff b3 84 00 00 00    	push   0x84(%ebx)
+801068dc:	e8 4f bf ff ff       	call   80102830 <idup>
+801068e1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+801068e4:	83 c4 0c             	add    $0xc,%esp
+  np->cwd = idup(curproc->cwd);
+801068e7:	89 82 84 00 00 00    	mov    %eax,0x84(%edx)
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+801068ed:	8d 83 88 00 00 00    	lea    0x88(%ebx),%eax
+801068f3:	6a 10                	push   $0x10
+801068f5:	50                   	push   %eax
+801068f6:	8d 82 88 00 00 00    	lea    0x88(%edx),%eax
+801068fc:	50                   	push   %eax
+801068fd:	e8 ae 16 00 00       	call   80107fb0 <safestrcpy>
+  np->nice          = curproc->nice;
+80106902:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80106905:	8b 83 98 00 00 00    	mov    0x98(%ebx),%eax
+8010690b:	89 82 98 00 00 00    	mov    %eax,0x98(%edx)
+  np->base_priority = curproc->base_priority;
+80106911:	8b 83 9c 00 00 00    	mov    0x9c(%ebx),%eax
+  pid = np->pid;
+80106917:	8b 72 10             	mov    0x10(%edx),%esi
+  np->base_priority = curproc->base_priority;
+8010691a:	89 82 9c 00 00 00    	mov    %eax,0x9c(%edx)
+  np->eff_priority  = curproc->eff_priority;
+80106920:	8b 83 a0 00 00 00    	mov    0xa0(%ebx),%eax
+80106926:	89 82 a0 00 00 00    	mov    %eax,0xa0(%edx)
+  np->tickets       = curproc->tickets;
+8010692c:	8b 83 c4 00 00 00    	mov    0xc4(%ebx),%eax
+80106932:	89 82 c4 00 00 00    	mov    %eax,0xc4(%edx)
+  acquire(&ptable.lock);
+80106938:	c7 04 24 e0 ea 13 80 	movl   $0x8013eae0,(%esp)
+8010693f:	e8 dc 13 00 00       	call   80107d20 <acquire>
+  np->parent = curproc;
+80106944:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  childlink(&curproc->children, np);
+80106947:	8d 4b 18             	lea    0x18(%ebx),%ecx
+  if(*head)
+8010694a:	83 c4 10             	add    $0x10,%esp
+  np->parent = curproc;
+8010694d:	89 5a 14             	mov    %ebx,0x14(%edx)
+  p->sibling = *head;
+80106950:	8b 43 18             	mov    0x18(%ebx),%eax
+80106953:	89 42 20             	mov    %eax,0x20(%edx)
+  if(*head)
+80106956:	85 c0                	test   %eax,%eax
+80106958:	74 06                	je     80106960 <fork+0x120>
+    (*head)->psibling = &p->sibling;
+8010695a:	8d 7a 20             	lea    0x20(%edx),%edi
+8010695d:	89 78 24             	mov    %edi,0x24(%eax)
+  release(&ptable.lock);
+80106960:	83 ec 0c             	sub    $0xc,%esp
+  p->psibling = head;
+80106963:	89 4a 24             	mov    %ecx,0x24(%edx)
+  *head = p;
+80106966:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80106969:	89 53 18             	mov    %edx,0x18(%ebx)
+  release(&ptable.lock);
+8010696c:	68 e0 ea 13 80       	push   $0x8013eae0
+80106971:	e8 4a 13 00 00       	call   80107cc0 <release>
+  for(i = 1; i < ncpu; i++)
+80106976:	83 c4 10             	add    $0x10,%esp
+  best = 0;
+80106979:	31 c0                	xor    %eax,%eax
+  for(i = 1; i < ncpu; i++)
+8010697b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010697e:	8b 3d a4 e1 13 80    	mov    0x8013e1a4,%edi
+80106984:	83 ff 01             	cmp    $0x1,%edi
+80106987:	7e 26                	jle    801069af <fork+0x16f>
+80106989:	b9 01 00 00 00       	mov    $0x1,%ecx
+8010698e:	66 90                	xchg   %ax,%ax
+    if(runq[i].nrunnable < runq[best].nrunnable)
+80106990:	6b d1 70             	imul   $0x70,%ecx,%edx
+80106993:	6b d8 70             	imul   $0x70,%eax,%ebx
+80106996:	8b 92 c0 e7 13 80    	mov    -0x7fec1840(%edx),%edx
+8010699c:	39 93 c0 e7 13 80    	cmp    %edx,-0x7fec1840(%ebx)
+801069a2:	0f 4f c1             	cmovg  %ecx,%eax
+  for(i = 1; i < ncpu; i++)
+801069a5:	83 c1 01             	add    $0x1,%ecx
+801069a8:	39 cf                	cmp    %ecx,%edi
+801069aa:	75 e4                	jne    80106990 <fork+0x150>
+801069ac:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  np->cpu = leastloaded();
+801069af:	89 82 d8 00 00 00    	mov    %eax,0xd8(%edx)
+801069b5:	89 d3                	mov    %edx,%ebx
+801069b7:	89 c7                	mov    %eax,%edi
+801069b9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+801069bc:	eb 14                	jmp    801069d2 <fork+0x192>
+801069be:	66 90                	xchg   %ax,%ax
+    release(&rq->lock);
+801069c0:	83 ec 0c             	sub    $0xc,%esp
+801069c3:	56                   	push   %esi
+801069c4:	e8 f7 12 00 00       	call   80107cc0 <release>
+    rq = &runq[p->cpu];
+801069c9:	8b bb d8 00 00 00    	mov    0xd8(%ebx),%edi
+801069cf:	83 c4 10             	add    $0x10,%esp
+801069d2:	6b ff 70             	imul   $0x70,%edi,%edi
+    acquire(&rq->lock);
+801069d5:	83 ec 0c             	sub    $0xc,%esp
+    rq = &runq[p->cpu];
+801069d8:	8d b7 60 e7 13 80    	lea    -0x7fec18a0(%edi),%esi
+    acquire(&rq->lock);
+801069de:	56                   	push   %esi
+801069df:	e8 3c 13 00 00       	call   80107d20 <acquire>
+    if(rq == &runq[p->cpu])
+801069e4:	6b 93 d8 00 00 00 70 	imul   $0x70,0xd8(%ebx),%edx
+801069eb:	83 c4 10             	add    $0x10,%esp
+801069ee:	39 fa                	cmp    %edi,%edx
+801069f0:	75 ce                	jne    801069c0 <fork+0x180>
+  setrunnable(rq, np);
+801069f2:	89 da                	mov    %ebx,%edx
+801069f4:	89 f3                	mov    %esi,%ebx
+801069f6:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+801069f9:	89 d8                	mov    %ebx,%eax
+801069fb:	e8 f0 f8 ff ff       	call   801062f0 <setrunnable>
+  release(&rq->lock);
+80106a00:	83 ec 0c             	sub    $0xc,%esp
+80106a03:	53                   	push   %ebx
+80106a04:	e8 b7 12 00 00       	call   80107cc0 <release>
+  return pid;
+80106a09:	83 c4 10             	add    $0x10,%esp
+}
+80106a0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106a0f:	89 f0                	mov    %esi,%eax
+80106a11:	5b                   	pop    %ebx
+80106a12:	5e                   	pop    %esi
+80106a13:	5f                   	pop    %edi
+80106a14:	5d                   	pop    %ebp
+80106a15:	c3                   	ret
+    kfree(np->kstack);
+80106a16:	83 ec 0c             	sub    $0xc,%esp
+80106a19:	ff 72 08             	push   0x8(%edx)
+80106a1c:	e8 ff d4 ff ff       	call   80103f20 <kfree>
+    np->kstack = 0;
+80106a21:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80106a24:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+    acquire(&ptable.lock);
+80106a2b:	c7 04 24 e0 ea 13 80 	movl   $0x8013eae0,(%esp)
+80106a32:	e8 e9 12 00 00       	call   80107d20 <acquire>
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+80106a37:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80106a3a:	83 c4 10             	add    $0x10,%esp
+80106a3d:	8b 42 10             	mov    0x10(%edx),%eax
+80106a40:	89 c1                	mov    %eax,%ecx
+80106a42:	c1 f9 1f             	sar    $0x1f,%ecx
+80106a45:	c1 e9 1a             	shr    $0x1a,%ecx
+80106a48:	01 c8                	add    %ecx,%eax
+80106a4a:	83 e0 3f             	and    $0x3f,%eax
+80106a4d:	29 c8                	sub    %ecx,%eax
+80106a4f:	8b 0c 85 14 30 14 80 	mov    -0x7febcfec(,%eax,4),%ecx
+80106a56:	39 ca                	cmp    %ecx,%edx
+80106a58:	74 39                	je     80106a93 <fork+0x253>
+80106a5a:	89 c8                	mov    %ecx,%eax
+80106a5c:	8b 49 3c             	mov    0x3c(%ecx),%ecx
+80106a5f:	39 d1                	cmp    %edx,%ecx
+80106a61:	75 f7                	jne    80106a5a <fork+0x21a>
+80106a63:	83 c0 3c             	add    $0x3c,%eax
+  *pp = p->pidnext;
+80106a66:	8b 4a 3c             	mov    0x3c(%edx),%ecx
+    release(&ptable.lock);
+80106a69:	83 ec 0c             	sub    $0xc,%esp
+  *pp = p->pidnext;
+80106a6c:	89 08                	mov    %ecx,(%eax)
+  p->pid = 0;
+80106a6e:	c7 42 10 00 00 00 00 	movl   $0x0,0x10(%edx)
+  p->state = UNUSED;
+80106a75:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    release(&ptable.lock);
+80106a7c:	68 e0 ea 13 80       	push   $0x8013eae0
+80106a81:	e8 3a 12 00 00       	call   80107cc0 <release>
+    return -1;
+80106a86:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80106a89:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80106a8e:	e9 79 ff ff ff       	jmp    80106a0c <fork+0x1cc>
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+80106a93:	8d 04 85 14 30 14 80 	lea    -0x7febcfec(,%eax,4),%eax
+80106a9a:	eb ca                	jmp    80106a66 <fork+0x226>
+80106a9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80106aa0 <scheduler>:
+{
+80106aa0:	55                   	push   %ebp
+80106aa1:	89 e5                	mov    %esp,%ebp
+80106aa3:	57                   	push   %edi
+80106aa4:	56                   	push   %esi
+80106aa5:	53                   	push   %ebx
+80106aa6:	83 ec 3c             	sub    $0x3c,%esp
+  struct cpu *c = mycpu();
+80106aa9:	e8 c2 f7 ff ff       	call   80106270 <mycpu>
+80106aae:	89 c6                	mov    %eax,%esi
+80106ab0:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  struct runq *rq = &runq[c - cpus];
+80106ab3:	2d c0 e1 13 80       	sub    $0x8013e1c0,%eax
+  c->proc = 0;
+80106ab8:	c7 86 ac 00 00 00 00 	movl   $0x0,0xac(%esi)
+80106abf:	00 00 00 
+  struct runq *rq = &runq[c - cpus];
+80106ac2:	c1 f8 02             	sar    $0x2,%eax
+80106ac5:	83 c6 04             	add    $0x4,%esi
+80106ac8:	69 d0 30 d8 82 2d    	imul   $0x2d82d830,%eax,%edx
+80106ace:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  p->rqprev = rq->tail[lvl];
+80106ad1:	69 c0 0c b6 60 0b    	imul   $0xb60b60c,%eax,%eax
+      p->cpu = rq - runq;
+80106ad7:	89 d1                	mov    %edx,%ecx
+  struct runq *rq = &runq[c - cpus];
+80106ad9:	8d ba 60 e7 13 80    	lea    -0x7fec18a0(%edx),%edi
+  c->proc = 0;
+80106adf:	81 c2 70 e7 13 80    	add    $0x8013e770,%edx
+      p->cpu = rq - runq;
+80106ae5:	c1 f9 04             	sar    $0x4,%ecx
+80106ae8:	89 55 d0             	mov    %edx,-0x30(%ebp)
+80106aeb:	69 c9 b7 6d db b6    	imul   $0xb6db6db7,%ecx,%ecx
+  p->rqprev = rq->tail[lvl];
+80106af1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      p->cpu = rq - runq;
+80106af4:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+80106af7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106afe:	66 90                	xchg   %ax,%ax
+  asm volatile("sti");
+80106b00:	fb                   	sti
+    if(rq->nrunnable == 0)
+80106b01:	8b 47 60             	mov    0x60(%edi),%eax
+80106b04:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80106b07:	85 c0                	test   %eax,%eax
+80106b09:	0f 84 d6 01 00 00    	je     80106ce5 <scheduler+0x245>
+  asm volatile("cli");
+80106b0f:	fa                   	cli
+    acquire(&rq->lock);
+80106b10:	83 ec 0c             	sub    $0xc,%esp
+80106b13:	57                   	push   %edi
+80106b14:	e8 07 12 00 00       	call   80107d20 <acquire>
+  rq->passes++;
+80106b19:	83 47 64 01          	addl   $0x1,0x64(%edi)
+  for(lvl = 1; lvl < NPRIO; lvl++){
+80106b1d:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  rq->passes++;
+80106b20:	83 c4 10             	add    $0x10,%esp
+80106b23:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80106b26:	eb 27                	jmp    80106b4f <scheduler+0xaf>
+80106b28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106b2f:	90                   	nop
+    rq->tail[lvl]->rqnext = p;
+80106b30:	89 98 e0 00 00 00    	mov    %ebx,0xe0(%eax)
+  rq->tail[lvl] = p;
+80106b36:	8d 44 31 10          	lea    0x10(%ecx,%esi,1),%eax
+  rq->nrunnable++;
+80106b3a:	83 47 60 01          	addl   $0x1,0x60(%edi)
+  rq->tail[lvl] = p;
+80106b3e:	89 1c 85 68 e7 13 80 	mov    %ebx,-0x7fec1898(,%eax,4)
+  rq->bitmap |= 1 << lvl;
+80106b45:	b8 01 00 00 00       	mov    $0x1,%eax
+80106b4a:	d3 e0                	shl    %cl,%eax
+80106b4c:	09 47 5c             	or     %eax,0x5c(%edi)
+    while((p = rq->head[lvl]) != 0 &&
+80106b4f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80106b52:	8b 58 38             	mov    0x38(%eax),%ebx
+80106b55:	85 db                	test   %ebx,%ebx
+80106b57:	74 67                	je     80106bc0 <scheduler+0x120>
+          rq->passes - p->agestart >= AGING_INTERVAL){
+80106b59:	8b 47 64             	mov    0x64(%edi),%eax
+80106b5c:	2b 83 a4 00 00 00    	sub    0xa4(%ebx),%eax
+    while((p = rq->head[lvl]) != 0 &&
+80106b62:	3d c7 00 00 00       	cmp    $0xc7,%eax
+80106b67:	76 57                	jbe    80106bc0 <scheduler+0x120>
+      rqremove(rq, p);
+80106b69:	89 da                	mov    %ebx,%edx
+80106b6b:	89 f8                	mov    %edi,%eax
+80106b6d:	e8 fe f3 ff ff       	call   80105f70 <rqremove>
+      p->eff_priority--;          // smaller number = higher priority
+80106b72:	8b 83 a0 00 00 00    	mov    0xa0(%ebx),%eax
+80106b78:	8d 48 ff             	lea    -0x1(%eax),%ecx
+80106b7b:	89 8b a0 00 00 00    	mov    %ecx,0xa0(%ebx)
+      p->agestart = rq->passes;
+80106b81:	8b 47 64             	mov    0x64(%edi),%eax
+  p->rqprev = rq->tail[lvl];
+80106b84:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+      p->nboost++;
+80106b87:	83 83 0c 01 00 00 01 	addl   $0x1,0x10c(%ebx)
+      p->agestart = rq->passes;
+80106b8e:	89 83 a4 00 00 00    	mov    %eax,0xa4(%ebx)
+  p->rqnext = 0;
+80106b94:	c7 83 e0 00 00 00 00 	movl   $0x0,0xe0(%ebx)
+80106b9b:	00 00 00 
+  p->rqprev = rq->tail[lvl];
+80106b9e:	8b 04 95 a8 e7 13 80 	mov    -0x7fec1858(,%edx,4),%eax
+80106ba5:	89 83 e4 00 00 00    	mov    %eax,0xe4(%ebx)
+  if(rq->tail[lvl])
+80106bab:	85 c0                	test   %eax,%eax
+80106bad:	75 81                	jne    80106b30 <scheduler+0x90>
+    rq->head[lvl] = p;
+80106baf:	89 1c 95 94 e7 13 80 	mov    %ebx,-0x7fec186c(,%edx,4)
+80106bb6:	e9 7b ff ff ff       	jmp    80106b36 <scheduler+0x96>
+80106bbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106bbf:	90                   	nop
+  for(lvl = 1; lvl < NPRIO; lvl++){
+80106bc0:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+80106bc4:	8b 55 d0             	mov    -0x30(%ebp),%edx
+80106bc7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80106bca:	39 d0                	cmp    %edx,%eax
+80106bcc:	75 81                	jne    80106b4f <scheduler+0xaf>
+  if(rq->bitmap == 0)
+80106bce:	8b 47 5c             	mov    0x5c(%edi),%eax
+80106bd1:	85 c0                	test   %eax,%eax
+80106bd3:	0f 84 95 00 00 00    	je     80106c6e <scheduler+0x1ce>
+  p = rq->head[__builtin_ctz(rq->bitmap)];
+80106bd9:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80106bdc:	f3 0f bc c0          	tzcnt  %eax,%eax
+80106be0:	8d 44 30 0c          	lea    0xc(%eax,%esi,1),%eax
+80106be4:	8b 1c 85 64 e7 13 80 	mov    -0x7fec189c(,%eax,4),%ebx
+  rqremove(rq, p);
+80106beb:	89 f8                	mov    %edi,%eax
+80106bed:	89 da                	mov    %ebx,%edx
+80106bef:	e8 7c f3 ff ff       	call   80105f70 <rqremove>
+    if((p = rqpop(rq)) != 0){
+80106bf4:	85 db                	test   %ebx,%ebx
+80106bf6:	74 76                	je     80106c6e <scheduler+0x1ce>
+      w = ticks - p->readyat;
+80106bf8:	a1 40 35 14 80       	mov    0x80143540,%eax
+80106bfd:	2b 83 f8 00 00 00    	sub    0xf8(%ebx),%eax
+      p->waitticks += w;
+80106c03:	01 83 00 01 00 00    	add    %eax,0x100(%ebx)
+      if(w > p->maxwait)
+80106c09:	39 83 04 01 00 00    	cmp    %eax,0x104(%ebx)
+80106c0f:	73 06                	jae    80106c17 <scheduler+0x177>
+        p->maxwait = w;
+80106c11:	89 83 04 01 00 00    	mov    %eax,0x104(%ebx)
+      c->proc = p;
+80106c17:	8b 75 c8             	mov    -0x38(%ebp),%esi
+      switchuvm(p);
+80106c1a:	83 ec 0c             	sub    $0xc,%esp
+      p->nswitch++;
+80106c1d:	83 83 08 01 00 00 01 	addl   $0x1,0x108(%ebx)
+      c->proc = p;
+80106c24:	89 9e ac 00 00 00    	mov    %ebx,0xac(%esi)
+      switchuvm(p);
+80106c2a:	53                   	push   %ebx
+80106c2b:	e8 20 3d 00 00       	call   8010a950 <switchuvm>
+      p->state = RUNNING;
+80106c30:	c7 43 0c 04 00 00 00 	movl   $0x4,0xc(%ebx)
+      swtch(&(c->scheduler), p->context);
+80106c37:	58                   	pop    %eax
+80106c38:	5a                   	pop    %edx
+80106c39:	ff 73 2c             	push   0x2c(%ebx)
+80106c3c:	ff 75 c4             	push   -0x3c(%ebp)
+80106c3f:	e8 c7 13 00 00       	call   8010800b <swtch>
+      switchkvm();
+80106c44:	e8 f7 3c 00 00       	call   8010a940 <switchkvm>
+      p->lastrun = ticks;
+80106c49:	a1 40 35 14 80       	mov    0x80143540,%eax
+80106c4e:	89 83 dc 00 00 00    	mov    %eax,0xdc(%ebx)
+      c->proc = 0;
+80106c54:	c7 86 ac 00 00 00 00 	movl   $0x0,0xac(%esi)
+80106c5b:	00 00 00 
+      release(&rq->lock);
+80106c5e:	89 3c 24             	mov    %edi,(%esp)
+80106c61:	e8 5a 10 00 00       	call   80107cc0 <release>
+      continue;
+80106c66:	83 c4 10             	add    $0x10,%esp
+80106c69:	e9 92 fe ff ff       	jmp    80106b00 <scheduler+0x60>
+    c->idle = 1;
+80106c6e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    release(&rq->lock);
+80106c71:	83 ec 0c             	sub    $0xc,%esp
+    c->idle = 1;
+80106c74:	c7 80 b0 00 00 00 01 	movl   $0x1,0xb0(%eax)
+80106c7b:	00 00 00 
+    release(&rq->lock);
+80106c7e:	57                   	push   %edi
+80106c7f:	e8 3c 10 00 00       	call   80107cc0 <release>
+  for(i = 0; i < ncpu; i++)
+80106c84:	8b 0d a4 e1 13 80    	mov    0x8013e1a4,%ecx
+80106c8a:	83 c4 10             	add    $0x10,%esp
+80106c8d:	85 c9                	test   %ecx,%ecx
+80106c8f:	0f 8e fb 01 00 00    	jle    80106e90 <scheduler+0x3f0>
+80106c95:	b8 c0 e7 13 80       	mov    $0x8013e7c0,%eax
+80106c9a:	31 d2                	xor    %edx,%edx
+80106c9c:	eb 10                	jmp    80106cae <scheduler+0x20e>
+80106c9e:	66 90                	xchg   %ax,%ax
+80106ca0:	83 c2 01             	add    $0x1,%edx
+80106ca3:	83 c0 70             	add    $0x70,%eax
+80106ca6:	39 d1                	cmp    %edx,%ecx
+80106ca8:	0f 84 e2 01 00 00    	je     80106e90 <scheduler+0x3f0>
+    if(runq[i].nrunnable > 0)
+80106cae:	8b 18                	mov    (%eax),%ebx
+80106cb0:	85 db                	test   %ebx,%ebx
+80106cb2:	7e ec                	jle    80106ca0 <scheduler+0x200>
+      return MIGRATE_COST;
+80106cb4:	b8 01 00 00 00       	mov    $0x1,%eax
+    lapictimer(idlefor());
+80106cb9:	83 ec 0c             	sub    $0xc,%esp
+80106cbc:	50                   	push   %eax
+80106cbd:	e8 ee d7 ff ff       	call   801044b0 <lapictimer>
+  asm volatile("sti; hlt");
+80106cc2:	fb                   	sti
+80106cc3:	f4                   	hlt
+    c->idle = 0;
+80106cc4:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80106cc7:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+80106cce:	00 00 00 
+    lapictimer(0);
+80106cd1:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+80106cd8:	e8 d3 d7 ff ff       	call   801044b0 <lapictimer>
+80106cdd:	83 c4 10             	add    $0x10,%esp
+80106ce0:	e9 1b fe ff ff       	jmp    80106b00 <scheduler+0x60>
+  for(i = 0; i < ncpu; i++)
+80106ce5:	a1 a4 e1 13 80       	mov    0x8013e1a4,%eax
+80106cea:	85 c0                	test   %eax,%eax
+80106cec:	0f 8e 1d fe ff ff    	jle    80106b0f <scheduler+0x6f>
+80106cf2:	6b c0 70             	imul   $0x70,%eax,%eax
+  src = 0;
+80106cf5:	31 db                	xor    %ebx,%ebx
+80106cf7:	8d 88 60 e7 13 80    	lea    -0x7fec18a0(%eax),%ecx
+  for(i = 0; i < ncpu; i++)
+80106cfd:	b8 60 e7 13 80       	mov    $0x8013e760,%eax
+80106d02:	eb 11                	jmp    80106d15 <scheduler+0x275>
+80106d04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+       (src == 0 || runq[i].nrunnable > src->nrunnable))
+80106d08:	3b 53 60             	cmp    0x60(%ebx),%edx
+80106d0b:	0f 4f d8             	cmovg  %eax,%ebx
+  for(i = 0; i < ncpu; i++)
+80106d0e:	83 c0 70             	add    $0x70,%eax
+80106d11:	39 c8                	cmp    %ecx,%eax
+80106d13:	74 18                	je     80106d2d <scheduler+0x28d>
+    if(&runq[i] != rq && runq[i].nrunnable > 0 &&
+80106d15:	39 c7                	cmp    %eax,%edi
+80106d17:	74 f5                	je     80106d0e <scheduler+0x26e>
+80106d19:	8b 50 60             	mov    0x60(%eax),%edx
+80106d1c:	85 d2                	test   %edx,%edx
+80106d1e:	7e ee                	jle    80106d0e <scheduler+0x26e>
+80106d20:	85 db                	test   %ebx,%ebx
+80106d22:	75 e4                	jne    80106d08 <scheduler+0x268>
+80106d24:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < ncpu; i++)
+80106d26:	83 c0 70             	add    $0x70,%eax
+80106d29:	39 c8                	cmp    %ecx,%eax
+80106d2b:	75 e8                	jne    80106d15 <scheduler+0x275>
+  if(src == 0)
+80106d2d:	89 d8                	mov    %ebx,%eax
+80106d2f:	85 db                	test   %ebx,%ebx
+80106d31:	0f 84 d8 fd ff ff    	je     80106b0f <scheduler+0x6f>
+  second = src < rq ? rq : src;
+80106d37:	39 df                	cmp    %ebx,%edi
+  first = src < rq ? src : rq;
+80106d39:	89 c6                	mov    %eax,%esi
+80106d3b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80106d3e:	0f 46 f7             	cmovbe %edi,%esi
+  second = src < rq ? rq : src;
+80106d41:	0f 43 df             	cmovae %edi,%ebx
+  acquire(&first->lock);
+80106d44:	83 ec 0c             	sub    $0xc,%esp
+80106d47:	56                   	push   %esi
+80106d48:	e8 d3 0f 00 00       	call   80107d20 <acquire>
+  acquire(&second->lock);
+80106d4d:	89 1c 24             	mov    %ebx,(%esp)
+80106d50:	e8 cb 0f 00 00       	call   80107d20 <acquire>
+  n = (src->nrunnable + 1) / 2;
+80106d55:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  for(lvl = 0; lvl < NPRIO && moved < n; lvl++){
+80106d58:	83 c4 10             	add    $0x10,%esp
+  n = (src->nrunnable + 1) / 2;
+80106d5b:	8b 48 60             	mov    0x60(%eax),%ecx
+80106d5e:	8d 51 01             	lea    0x1(%ecx),%edx
+80106d61:	89 d0                	mov    %edx,%eax
+80106d63:	c1 e8 1f             	shr    $0x1f,%eax
+80106d66:	01 d0                	add    %edx,%eax
+  for(lvl = 0; lvl < NPRIO && moved < n; lvl++){
+80106d68:	31 d2                	xor    %edx,%edx
+  n = (src->nrunnable + 1) / 2;
+80106d6a:	d1 f8                	sar    %eax
+80106d6c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(lvl = 0; lvl < NPRIO && moved < n; lvl++){
+80106d6f:	85 c9                	test   %ecx,%ecx
+80106d71:	0f 8e 00 01 00 00    	jle    80106e77 <scheduler+0x3d7>
+80106d77:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+80106d7a:	89 75 bc             	mov    %esi,-0x44(%ebp)
+80106d7d:	8d 76 00             	lea    0x0(%esi),%esi
+    for(p = src->head[lvl]; p != 0 && moved < n; p = next){
+80106d80:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80106d83:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+80106d86:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+80106d89:	8b 74 90 34          	mov    0x34(%eax,%edx,4),%esi
+80106d8d:	0f 9c c0             	setl   %al
+80106d90:	85 f6                	test   %esi,%esi
+80106d92:	0f 84 bb 00 00 00    	je     80106e53 <scheduler+0x3b3>
+80106d98:	84 c0                	test   %al,%al
+80106d9a:	0f 84 b3 00 00 00    	je     80106e53 <scheduler+0x3b3>
+80106da0:	89 55 cc             	mov    %edx,-0x34(%ebp)
+80106da3:	eb 3a                	jmp    80106ddf <scheduler+0x33f>
+80106da5:	8d 76 00             	lea    0x0(%esi),%esi
+    rq->tail[lvl]->rqnext = p;
+80106da8:	89 98 e0 00 00 00    	mov    %ebx,0xe0(%eax)
+  rq->tail[lvl] = p;
+80106dae:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  rq->nrunnable++;
+80106db1:	83 47 60 01          	addl   $0x1,0x60(%edi)
+      moved++;
+80106db5:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+  rq->tail[lvl] = p;
+80106db9:	8d 44 01 10          	lea    0x10(%ecx,%eax,1),%eax
+80106dbd:	89 1c 85 68 e7 13 80 	mov    %ebx,-0x7fec1898(,%eax,4)
+  rq->bitmap |= 1 << lvl;
+80106dc4:	b8 01 00 00 00       	mov    $0x1,%eax
+80106dc9:	d3 e0                	shl    %cl,%eax
+80106dcb:	09 47 5c             	or     %eax,0x5c(%edi)
+    for(p = src->head[lvl]; p != 0 && moved < n; p = next){
+80106dce:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80106dd1:	39 55 dc             	cmp    %edx,-0x24(%ebp)
+80106dd4:	0f 9f c0             	setg   %al
+80106dd7:	85 f6                	test   %esi,%esi
+80106dd9:	74 75                	je     80106e50 <scheduler+0x3b0>
+80106ddb:	84 c0                	test   %al,%al
+80106ddd:	74 71                	je     80106e50 <scheduler+0x3b0>
+      next = p->rqnext;
+80106ddf:	89 f3                	mov    %esi,%ebx
+      if(ticks - p->lastrun < MIGRATE_COST)
+80106de1:	a1 40 35 14 80       	mov    0x80143540,%eax
+      next = p->rqnext;
+80106de6:	8b b6 e0 00 00 00    	mov    0xe0(%esi),%esi
+      if(ticks - p->lastrun < MIGRATE_COST)
+80106dec:	39 83 dc 00 00 00    	cmp    %eax,0xdc(%ebx)
+80106df2:	74 da                	je     80106dce <scheduler+0x32e>
+      rqremove(src, p);
+80106df4:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80106df7:	89 da                	mov    %ebx,%edx
+80106df9:	e8 72 f1 ff ff       	call   80105f70 <rqremove>
+      p->cpu = rq - runq;
+80106dfe:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  return p->eff_priority;
+80106e01:	8b 8b a0 00 00 00    	mov    0xa0(%ebx),%ecx
+      p->cpu = rq - runq;
+80106e07:	89 83 d8 00 00 00    	mov    %eax,0xd8(%ebx)
+      p->agestart = rq->passes;
+80106e0d:	8b 47 64             	mov    0x64(%edi),%eax
+  p->rqnext = 0;
+80106e10:	c7 83 e0 00 00 00 00 	movl   $0x0,0xe0(%ebx)
+80106e17:	00 00 00 
+      p->agestart = rq->passes;
+80106e1a:	89 83 a4 00 00 00    	mov    %eax,0xa4(%ebx)
+  p->rqprev = rq->tail[lvl];
+80106e20:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80106e23:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+80106e26:	8b 04 95 a8 e7 13 80 	mov    -0x7fec1858(,%edx,4),%eax
+80106e2d:	89 83 e4 00 00 00    	mov    %eax,0xe4(%ebx)
+  if(rq->tail[lvl])
+80106e33:	85 c0                	test   %eax,%eax
+80106e35:	0f 85 6d ff ff ff    	jne    80106da8 <scheduler+0x308>
+    rq->head[lvl] = p;
+80106e3b:	89 1c 95 94 e7 13 80 	mov    %ebx,-0x7fec186c(,%edx,4)
+80106e42:	e9 67 ff ff ff       	jmp    80106dae <scheduler+0x30e>
+80106e47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106e4e:	66 90                	xchg   %ax,%ax
+80106e50:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  for(lvl = 0; lvl < NPRIO && moved < n; lvl++){
+80106e53:	83 c2 01             	add    $0x1,%edx
+80106e56:	83 fa 04             	cmp    $0x4,%edx
+80106e59:	7f 08                	jg     80106e63 <scheduler+0x3c3>
+80106e5b:	84 c0                	test   %al,%al
+80106e5d:	0f 85 1d ff ff ff    	jne    80106d80 <scheduler+0x2e0>
+  if(moved > 0){
+80106e63:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80106e66:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+80106e69:	8b 75 bc             	mov    -0x44(%ebp),%esi
+80106e6c:	85 c0                	test   %eax,%eax
+80106e6e:	74 07                	je     80106e77 <scheduler+0x3d7>
+    rq->nsteals++;
+80106e70:	83 47 68 01          	addl   $0x1,0x68(%edi)
+    rq->nmigrations += moved;
+80106e74:	01 47 6c             	add    %eax,0x6c(%edi)
+  release(&second->lock);
+80106e77:	83 ec 0c             	sub    $0xc,%esp
+80106e7a:	53                   	push   %ebx
+80106e7b:	e8 40 0e 00 00       	call   80107cc0 <release>
+  release(&first->lock);
+80106e80:	89 34 24             	mov    %esi,(%esp)
+80106e83:	e8 38 0e 00 00       	call   80107cc0 <release>
+80106e88:	83 c4 10             	add    $0x10,%esp
+80106e8b:	e9 7f fc ff ff       	jmp    80106b0f <scheduler+0x6f>
+  return idleticks();
+80106e90:	e8 fb 28 00 00       	call   80109790 <idleticks>
+80106e95:	e9 1f fe ff ff       	jmp    80106cb9 <scheduler+0x219>
+80106e9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106ea0 <sched>:
+{
+80106ea0:	55                   	push   %ebp
+80106ea1:	89 e5                	mov    %esp,%ebp
+80106ea3:	56                   	push   %esi
+80106ea4:	53                   	push   %ebx
+  pushcli();
+80106ea5:	e8 26 0d 00 00       	call   80107bd0 <pushcli>
+  c = mycpu();
+80106eaa:	e8 c1 f3 ff ff       	call   80106270 <mycpu>
+  p = c->proc;
+80106eaf:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80106eb5:	e8 66 0d 00 00       	call   80107c20 <popcli>
+  if(!holding(&runq[p->cpu].lock))
+80106eba:	83 ec 0c             	sub    $0xc,%esp
+80106ebd:	6b 83 d8 00 00 00 70 	imul   $0x70,0xd8(%ebx),%eax
+80106ec4:	05 60 e7 13 80       	add    $0x8013e760,%eax
+80106ec9:	50                   	push   %eax
+80106eca:	e8 b1 0d 00 00       	call   80107c80 <holding>
+80106ecf:	83 c4 10             	add    $0x10,%esp
+80106ed2:	85 c0                	test   %eax,%eax
+80106ed4:	74 4f                	je     80106f25 <sched+0x85>
+  if(mycpu()->ncli != 1)
+80106ed6:	e8 95 f3 ff ff       	call   80106270 <mycpu>
+80106edb:	83 b8 a4 00 00 00 01 	cmpl   $0x1,0xa4(%eax)
+80106ee2:	75 68                	jne    80106f4c <sched+0xac>
+  if(p->state == RUNNING)
+80106ee4:	83 7b 0c 04          	cmpl   $0x4,0xc(%ebx)
+80106ee8:	74 55                	je     80106f3f <sched+0x9f>
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80106eea:	9c                   	pushf
+80106eeb:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80106eec:	f6 c4 02             	test   $0x2,%ah
+80106eef:	75 41                	jne    80106f32 <sched+0x92>
+  intena = mycpu()->intena;
+80106ef1:	e8 7a f3 ff ff       	call   80106270 <mycpu>
+  swtch(&p->context, mycpu()->scheduler);
+80106ef6:	83 c3 2c             	add    $0x2c,%ebx
+  intena = mycpu()->intena;
+80106ef9:	8b b0 a8 00 00 00    	mov    0xa8(%eax),%esi
+  swtch(&p->context, mycpu()->scheduler);
+80106eff:	e8 6c f3 ff ff       	call   80106270 <mycpu>
+80106f04:	83 ec 08             	sub    $0x8,%esp
+80106f07:	ff 70 04             	push   0x4(%eax)
+80106f0a:	53                   	push   %ebx
+80106f0b:	e8 fb 10 00 00       	call   8010800b <swtch>
+  mycpu()->intena = intena;
+80106f10:	e8 5b f3 ff ff       	call   80106270 <mycpu>
+}
+80106f15:	83 c4 10             	add    $0x10,%esp
+  mycpu()->intena = intena;
+80106f18:	89 b0 a8 00 00 00    	mov    %esi,0xa8(%eax)
+}
+80106f1e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106f21:	5b                   	pop    %ebx
+80106f22:	5e                   	pop    %esi
+80106f23:	5d                   	pop    %ebp
+80106f24:	c3                   	ret
+    panic("sched runq lock");
+80106f25:	83 ec 0c             	sub    $0xc,%esp
+80106f28:	68 80 bb 10 80       	push   $0x8010bb80
+80106f2d:	e8 4e 99 ff ff       	call   80100880 <panic>
+    panic("sched interruptible");
+80106f32:	83 ec 0c             	sub    $0xc,%esp
+80106f35:	68 aa bb 10 80       	push   $0x8010bbaa
+80106f3a:	e8 41 99 ff ff       	call   80100880 <panic>
+    panic("sched running");
+80106f3f:	83 ec 0c             	sub    $0xc,%esp
+80106f42:	68 9c bb 10 80       	push   $0x8010bb9c
+80106f47:	e8 34 99 ff ff       	call   80100880 <panic>
+    panic("sched locks");
+80106f4c:	83 ec 0c             	sub    $0xc,%esp
+80106f4f:	68 90 bb 10 80       	push   $0x8010bb90
+80106f54:	e8 27 99 ff ff       	call   80100880 <panic>
+80106f59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80106f60 <exit>:
+{
+80106f60:	55                   	push   %ebp
+80106f61:	89 e5                	mov    %esp,%ebp
+80106f63:	57                   	push   %edi
+80106f64:	56                   	push   %esi
+80106f65:	53                   	push   %ebx
+80106f66:	83 ec 0c             	sub    $0xc,%esp
+  struct proc *curproc = myproc();
+80106f69:	e8 e2 f5 ff ff       	call   80106550 <myproc>
+  if(curproc == initproc)
+80106f6e:	39 05 14 31 14 80    	cmp    %eax,0x80143114
+80106f74:	0f 84 8c 01 00 00    	je     80107106 <exit+0x1a6>
+80106f7a:	89 c3                	mov    %eax,%ebx
+80106f7c:	8d 70 44             	lea    0x44(%eax),%esi
+80106f7f:	8d b8 84 00 00 00    	lea    0x84(%eax),%edi
+80106f85:	8d 76 00             	lea    0x0(%esi),%esi
+    if(curproc->ofile[fd]){
+80106f88:	8b 06                	mov    (%esi),%eax
+80106f8a:	85 c0                	test   %eax,%eax
+80106f8c:	74 12                	je     80106fa0 <exit+0x40>
+      fileclose(curproc->ofile[fd]);
+80106f8e:	83 ec 0c             	sub    $0xc,%esp
+80106f91:	50                   	push   %eax
+80106f92:	e8 c9 a4 ff ff       	call   80101460 <fileclose>
+      curproc->ofile[fd] = 0;
+80106f97:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+80106f9d:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++){
+80106fa0:	83 c6 04             	add    $0x4,%esi
+80106fa3:	39 f7                	cmp    %esi,%edi
+80106fa5:	75 e1                	jne    80106f88 <exit+0x28>
+  begin_op();
+80106fa7:	e8 b4 df ff ff       	call   80104f60 <begin_op>
+  iput(curproc->cwd);
+80106fac:	83 ec 0c             	sub    $0xc,%esp
+80106faf:	ff b3 84 00 00 00    	push   0x84(%ebx)
+80106fb5:	e8 d6 b9 ff ff       	call   80102990 <iput>
+  end_op();
+80106fba:	e8 41 e0 ff ff       	call   80105000 <end_op>
+  curproc->cwd = 0;
+80106fbf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+80106fc6:	00 00 00 
+  acquire(&ptable.lock);
+80106fc9:	c7 04 24 e0 ea 13 80 	movl   $0x8013eae0,(%esp)
+80106fd0:	e8 4b 0d 00 00       	call   80107d20 <acquire>
+  wakeup1(curproc->parent);
+80106fd5:	8b 43 14             	mov    0x14(%ebx),%eax
+80106fd8:	e8 c3 f4 ff ff       	call   801064a0 <wakeup1>
+  while((p = curproc->children) != 0){
+80106fdd:	8b 43 18             	mov    0x18(%ebx),%eax
+80106fe0:	83 c4 10             	add    $0x10,%esp
+80106fe3:	85 c0                	test   %eax,%eax
+80106fe5:	74 3b                	je     80107022 <exit+0xc2>
+    p->parent = initproc;
+80106fe7:	8b 0d 14 31 14 80    	mov    0x80143114,%ecx
+    childlink(&initproc->children, p);
+80106fed:	8d 71 18             	lea    0x18(%ecx),%esi
+  *p->psibling = p->sibling;
+80106ff0:	8b 78 24             	mov    0x24(%eax),%edi
+80106ff3:	8b 50 20             	mov    0x20(%eax),%edx
+80106ff6:	89 17                	mov    %edx,(%edi)
+  if(p->sibling)
+80106ff8:	85 d2                	test   %edx,%edx
+80106ffa:	74 06                	je     80107002 <exit+0xa2>
+    p->sibling->psibling = p->psibling;
+80106ffc:	8b 78 24             	mov    0x24(%eax),%edi
+80106fff:	89 7a 24             	mov    %edi,0x24(%edx)
+    p->parent = initproc;
+80107002:	89 48 14             	mov    %ecx,0x14(%eax)
+  p->sibling = *head;
+80107005:	8b 51 18             	mov    0x18(%ecx),%edx
+80107008:	89 50 20             	mov    %edx,0x20(%eax)
+  if(*head)
+8010700b:	85 d2                	test   %edx,%edx
+8010700d:	74 06                	je     80107015 <exit+0xb5>
+    (*head)->psibling = &p->sibling;
+8010700f:	8d 78 20             	lea    0x20(%eax),%edi
+80107012:	89 7a 24             	mov    %edi,0x24(%edx)
+  p->psibling = head;
+80107015:	89 70 24             	mov    %esi,0x24(%eax)
+  *head = p;
+80107018:	89 41 18             	mov    %eax,0x18(%ecx)
+  while((p = curproc->children) != 0){
+8010701b:	8b 43 18             	mov    0x18(%ebx),%eax
+8010701e:	85 c0                	test   %eax,%eax
+80107020:	75 ce                	jne    80106ff0 <exit+0x90>
+  if(curproc->zombies)
+80107022:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80107025:	85 c0                	test   %eax,%eax
+80107027:	74 51                	je     8010707a <exit+0x11a>
+    wakeup1(initproc);
+80107029:	a1 14 31 14 80       	mov    0x80143114,%eax
+8010702e:	e8 6d f4 ff ff       	call   801064a0 <wakeup1>
+  while((p = curproc->zombies) != 0){
+80107033:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80107036:	85 c0                	test   %eax,%eax
+80107038:	74 40                	je     8010707a <exit+0x11a>
+    p->parent = initproc;
+8010703a:	8b 0d 14 31 14 80    	mov    0x80143114,%ecx
+    childlink(&initproc->zombies, p);
+80107040:	8d 71 1c             	lea    0x1c(%ecx),%esi
+80107043:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107047:	90                   	nop
+  *p->psibling = p->sibling;
+80107048:	8b 78 24             	mov    0x24(%eax),%edi
+8010704b:	8b 50 20             	mov    0x20(%eax),%edx
+8010704e:	89 17                	mov    %edx,(%edi)
+  if(p->sibling)
+80107050:	85 d2                	test   %edx,%edx
+80107052:	74 06                	je     8010705a <exit+0xfa>
+    p->sibling->psibling = p->psibling;
+80107054:	8b 78 24             	mov    0x24(%eax),%edi
+80107057:	89 7a 24             	mov    %edi,0x24(%edx)
+    p->parent = initproc;
+8010705a:	89 48 14             	mov    %ecx,0x14(%eax)
+  p->sibling = *head;
+8010705d:	8b 51 1c             	mov    0x1c(%ecx),%edx
+80107060:	89 50 20             	mov    %edx,0x20(%eax)
+  if(*head)
+80107063:	85 d2                	test   %edx,%edx
+80107065:	74 06                	je     8010706d <exit+0x10d>
+    (*head)->psibling = &p->sibling;
+80107067:	8d 78 20             	lea    0x20(%eax),%edi
+8010706a:	89 7a 24             	mov    %edi,0x24(%edx)
+  p->psibling = head;
+8010706d:	89 70 24             	mov    %esi,0x24(%eax)
+  *head = p;
+80107070:	89 41 1c             	mov    %eax,0x1c(%ecx)
+  while((p = curproc->zombies) != 0){
+80107073:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80107076:	85 c0                	test   %eax,%eax
+80107078:	75 ce                	jne    80107048 <exit+0xe8>
+  *p->psibling = p->sibling;
+8010707a:	8b 53 24             	mov    0x24(%ebx),%edx
+8010707d:	8b 43 20             	mov    0x20(%ebx),%eax
+  curproc->state = ZOMBIE;
+80107080:	c7 43 0c 05 00 00 00 	movl   $0x5,0xc(%ebx)
+  *p->psibling = p->sibling;
+80107087:	89 02                	mov    %eax,(%edx)
+  if(p->sibling)
+80107089:	85 c0                	test   %eax,%eax
+8010708b:	74 06                	je     80107093 <exit+0x133>
+    p->sibling->psibling = p->psibling;
+8010708d:	8b 53 24             	mov    0x24(%ebx),%edx
+80107090:	89 50 24             	mov    %edx,0x24(%eax)
+  childlink(&curproc->parent->zombies, curproc);
+80107093:	8b 43 14             	mov    0x14(%ebx),%eax
+  p->sibling = *head;
+80107096:	8b 50 1c             	mov    0x1c(%eax),%edx
+  childlink(&curproc->parent->zombies, curproc);
+80107099:	8d 48 1c             	lea    0x1c(%eax),%ecx
+  p->sibling = *head;
+8010709c:	89 53 20             	mov    %edx,0x20(%ebx)
+  if(*head)
+8010709f:	85 d2                	test   %edx,%edx
+801070a1:	74 06                	je     801070a9 <exit+0x149>
+    (*head)->psibling = &p->sibling;
+801070a3:	8d 73 20             	lea    0x20(%ebx),%esi
+801070a6:	89 72 24             	mov    %esi,0x24(%edx)
+  p->psibling = head;
+801070a9:	89 4b 24             	mov    %ecx,0x24(%ebx)
+  *head = p;
+801070ac:	89 58 1c             	mov    %ebx,0x1c(%eax)
+lockrq(struct proc *p)
+801070af:	eb 13                	jmp    801070c4 <exit+0x164>
+801070b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    release(&rq->lock);
+801070b8:	83 ec 0c             	sub    $0xc,%esp
+801070bb:	57                   	push   %edi
+801070bc:	e8 ff 0b 00 00       	call   80107cc0 <release>
+    rq = &runq[p->cpu];
+801070c1:	83 c4 10             	add    $0x10,%esp
+801070c4:	6b b3 d8 00 00 00 70 	imul   $0x70,0xd8(%ebx),%esi
+    acquire(&rq->lock);
+801070cb:	83 ec 0c             	sub    $0xc,%esp
+    rq = &runq[p->cpu];
+801070ce:	8d be 60 e7 13 80    	lea    -0x7fec18a0(%esi),%edi
+    acquire(&rq->lock);
+801070d4:	57                   	push   %edi
+801070d5:	e8 46 0c 00 00       	call   80107d20 <acquire>
+    if(rq == &runq[p->cpu])
+801070da:	6b 83 d8 00 00 00 70 	imul   $0x70,0xd8(%ebx),%eax
+801070e1:	83 c4 10             	add    $0x10,%esp
+801070e4:	39 c6                	cmp    %eax,%esi
+801070e6:	75 d0                	jne    801070b8 <exit+0x158>
+  release(&ptable.lock);
+801070e8:	83 ec 0c             	sub    $0xc,%esp
+801070eb:	68 e0 ea 13 80       	push   $0x8013eae0
+801070f0:	e8 cb 0b 00 00       	call   80107cc0 <release>
+  sched();
+801070f5:	e8 a6 fd ff ff       	call   80106ea0 <sched>
+  panic("zombie exit");
+801070fa:	c7 04 24 cb bb 10 80 	movl   $0x8010bbcb,(%esp)
+80107101:	e8 7a 97 ff ff       	call   80100880 <panic>
+    panic("init exiting");
+80107106:	83 ec 0c             	sub    $0xc,%esp
+80107109:	68 be bb 10 80       	push   $0x8010bbbe
+8010710e:	e8 6d 97 ff ff       	call   80100880 <panic>
+80107113:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010711a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107120 <timeslice>:
+}
+80107120:	b8 01 00 00 00       	mov    $0x1,%eax
+80107125:	c3                   	ret
+80107126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010712d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107130 <yield>:
+{
+80107130:	55                   	push   %ebp
+80107131:	89 e5                	mov    %esp,%ebp
+80107133:	57                   	push   %edi
+80107134:	56                   	push   %esi
+80107135:	53                   	push   %ebx
+80107136:	83 ec 0c             	sub    $0xc,%esp
+  pushcli();
+80107139:	e8 92 0a 00 00       	call   80107bd0 <pushcli>
+  c = mycpu();
+8010713e:	e8 2d f1 ff ff       	call   80106270 <mycpu>
+  p = c->proc;
+80107143:	8b b8 ac 00 00 00    	mov    0xac(%eax),%edi
+  popcli();
+80107149:	e8 d2 0a 00 00       	call   80107c20 <popcli>
+lockrq(struct proc *p)
+8010714e:	eb 0c                	jmp    8010715c <yield+0x2c>
+    release(&rq->lock);
+80107150:	83 ec 0c             	sub    $0xc,%esp
+80107153:	53                   	push   %ebx
+80107154:	e8 67 0b 00 00       	call   80107cc0 <release>
+    rq = &runq[p->cpu];
+80107159:	83 c4 10             	add    $0x10,%esp
+8010715c:	6b b7 d8 00 00 00 70 	imul   $0x70,0xd8(%edi),%esi
+    acquire(&rq->lock);
+80107163:	83 ec 0c             	sub    $0xc,%esp
+    rq = &runq[p->cpu];
+80107166:	8d 9e 60 e7 13 80    	lea    -0x7fec18a0(%esi),%ebx
+    acquire(&rq->lock);
+8010716c:	53                   	push   %ebx
+8010716d:	e8 ae 0b 00 00       	call   80107d20 <acquire>
+    if(rq == &runq[p->cpu])
+80107172:	6b 87 d8 00 00 00 70 	imul   $0x70,0xd8(%edi),%eax
+80107179:	83 c4 10             	add    $0x10,%esp
+8010717c:	39 f0                	cmp    %esi,%eax
+8010717e:	75 d0                	jne    80107150 <yield+0x20>
+  p->eff_priority = p->base_priority;
+80107180:	8b 87 9c 00 00 00    	mov    0x9c(%edi),%eax
+  setrunnable(rq, p);
+80107186:	89 fa                	mov    %edi,%edx
+  p->eff_priority = p->base_priority;
+80107188:	89 87 a0 00 00 00    	mov    %eax,0xa0(%edi)
+  setrunnable(rq, p);
+8010718e:	89 d8                	mov    %ebx,%eax
+80107190:	e8 5b f1 ff ff       	call   801062f0 <setrunnable>
+  sched();
+80107195:	e8 06 fd ff ff       	call   80106ea0 <sched>
+  release(&runq[p->cpu].lock);
+8010719a:	6b 87 d8 00 00 00 70 	imul   $0x70,0xd8(%edi),%eax
+801071a1:	83 ec 0c             	sub    $0xc,%esp
+801071a4:	05 60 e7 13 80       	add    $0x8013e760,%eax
+801071a9:	50                   	push   %eax
+801071aa:	e8 11 0b 00 00       	call   80107cc0 <release>
+}
+801071af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801071b2:	5b                   	pop    %ebx
+801071b3:	5e                   	pop    %esi
+801071b4:	5f                   	pop    %edi
+801071b5:	5d                   	pop    %ebp
+801071b6:	c3                   	ret
+801071b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801071be:	66 90                	xchg   %ax,%ax
+
+801071c0 <sleep>:
+{
+801071c0:	55                   	push   %ebp
+801071c1:	89 e5                	mov    %esp,%ebp
+801071c3:	57                   	push   %edi
+801071c4:	56                   	push   %esi
+801071c5:	53                   	push   %ebx
+801071c6:	83 ec 1c             	sub    $0x1c,%esp
+801071c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+801071cc:	8b 75 08             	mov    0x8(%ebp),%esi
+801071cf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  pushcli();
+801071d2:	e8 f9 09 00 00       	call   80107bd0 <pushcli>
+  c = mycpu();
+801071d7:	e8 94 f0 ff ff       	call   80106270 <mycpu>
+  p = c->proc;
+801071dc:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+801071e2:	e8 39 0a 00 00       	call   80107c20 <popcli>
+  if(p == 0) panic("sleep");
+801071e7:	85 db                	test   %ebx,%ebx
+801071e9:	0f 84 ec 00 00 00    	je     801072db <sleep+0x11b>
+  if(lk == 0) panic("sleep without lk");
+801071ef:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801071f2:	85 c0                	test   %eax,%eax
+801071f4:	0f 84 ee 00 00 00    	je     801072e8 <sleep+0x128>
+  if(lk != &ptable.lock){
+801071fa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+801071fd:	81 ff e0 ea 13 80    	cmp    $0x8013eae0,%edi
+80107203:	74 18                	je     8010721d <sleep+0x5d>
+    acquire(&ptable.lock);
+80107205:	83 ec 0c             	sub    $0xc,%esp
+80107208:	68 e0 ea 13 80       	push   $0x8013eae0
+8010720d:	e8 0e 0b 00 00       	call   80107d20 <acquire>
+    release(lk);
+80107212:	89 3c 24             	mov    %edi,(%esp)
+80107215:	e8 a6 0a 00 00       	call   80107cc0 <release>
+8010721a:	83 c4 10             	add    $0x10,%esp
+  p->chan = chan;
+8010721d:	89 73 30             	mov    %esi,0x30(%ebx)
+  struct proc **pp = &ptable.sleepq[SQHASH(p->chan)];
+80107220:	69 f6 b1 79 37 9e    	imul   $0x9e3779b1,%esi,%esi
+  p->state = SLEEPING;
+80107226:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+  struct proc **pp = &ptable.sleepq[SQHASH(p->chan)];
+8010722d:	c1 ee 1a             	shr    $0x1a,%esi
+80107230:	8d 14 b5 14 2f 14 80 	lea    -0x7febd0ec(,%esi,4),%edx
+  p->snext = *pp;
+80107237:	81 c6 0c 11 00 00    	add    $0x110c,%esi
+8010723d:	8b 04 b5 e4 ea 13 80 	mov    -0x7fec151c(,%esi,4),%eax
+80107244:	89 43 34             	mov    %eax,0x34(%ebx)
+  if(*pp)
+80107247:	85 c0                	test   %eax,%eax
+80107249:	74 06                	je     80107251 <sleep+0x91>
+    (*pp)->sprev = &p->snext;
+8010724b:	8d 4b 34             	lea    0x34(%ebx),%ecx
+8010724e:	89 48 38             	mov    %ecx,0x38(%eax)
+  p->sprev = pp;
+80107251:	89 53 38             	mov    %edx,0x38(%ebx)
+  *pp = p;
+80107254:	89 1c b5 e4 ea 13 80 	mov    %ebx,-0x7fec151c(,%esi,4)
+  p->eff_priority = p->base_priority;
+8010725b:	8b 83 9c 00 00 00    	mov    0x9c(%ebx),%eax
+80107261:	89 83 a0 00 00 00    	mov    %eax,0xa0(%ebx)
+lockrq(struct proc *p)
+80107267:	eb 13                	jmp    8010727c <sleep+0xbc>
+80107269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    release(&rq->lock);
+80107270:	83 ec 0c             	sub    $0xc,%esp
+80107273:	57                   	push   %edi
+80107274:	e8 47 0a 00 00       	call   80107cc0 <release>
+    rq = &runq[p->cpu];
+80107279:	83 c4 10             	add    $0x10,%esp
+8010727c:	6b b3 d8 00 00 00 70 	imul   $0x70,0xd8(%ebx),%esi
+    acquire(&rq->lock);
+80107283:	83 ec 0c             	sub    $0xc,%esp
+    rq = &runq[p->cpu];
+80107286:	8d be 60 e7 13 80    	lea    -0x7fec18a0(%esi),%edi
+    acquire(&rq->lock);
+8010728c:	57                   	push   %edi
+8010728d:	e8 8e 0a 00 00       	call   80107d20 <acquire>
+    if(rq == &runq[p->cpu])
+80107292:	6b 93 d8 00 00 00 70 	imul   $0x70,0xd8(%ebx),%edx
+80107299:	83 c4 10             	add    $0x10,%esp
+8010729c:	39 d6                	cmp    %edx,%esi
+8010729e:	75 d0                	jne    80107270 <sleep+0xb0>
+  release(&ptable.lock);
+801072a0:	83 ec 0c             	sub    $0xc,%esp
+801072a3:	68 e0 ea 13 80       	push   $0x8013eae0
+801072a8:	e8 13 0a 00 00       	call   80107cc0 <release>
+  sched();
+801072ad:	e8 ee fb ff ff       	call   80106ea0 <sched>
+  release(&runq[p->cpu].lock);
+801072b2:	6b 83 d8 00 00 00 70 	imul   $0x70,0xd8(%ebx),%eax
+801072b9:	05 60 e7 13 80       	add    $0x8013e760,%eax
+801072be:	89 04 24             	mov    %eax,(%esp)
+801072c1:	e8 fa 09 00 00       	call   80107cc0 <release>
+  acquire(lk);
+801072c6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801072c9:	83 c4 10             	add    $0x10,%esp
+801072cc:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+801072cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801072d2:	5b                   	pop    %ebx
+801072d3:	5e                   	pop    %esi
+801072d4:	5f                   	pop    %edi
+801072d5:	5d                   	pop    %ebp
+  acquire(lk);
+801072d6:	e9 45 0a 00 00       	jmp    80107d20 <acquire>
+  if(p == 0) panic("sleep");
+801072db:	83 ec 0c             	sub    $0xc,%esp
+801072de:	68 d7 bb 10 80       	push   $0x8010bbd7
+801072e3:	e8 98 95 ff ff       	call   80100880 <panic>
+  if(lk == 0) panic("sleep without lk");
+801072e8:	83 ec 0c             	sub    $0xc,%esp
+801072eb:	68 dd bb 10 80       	push   $0x8010bbdd
+801072f0:	e8 8b 95 ff ff       	call   80100880 <panic>
+801072f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801072fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80107300 <wait>:
+{
+80107300:	55                   	push   %ebp
+80107301:	89 e5                	mov    %esp,%ebp
+80107303:	56                   	push   %esi
+80107304:	53                   	push   %ebx
+  pushcli();
+80107305:	e8 c6 08 00 00       	call   80107bd0 <pushcli>
+  c = mycpu();
+8010730a:	e8 61 ef ff ff       	call   80106270 <mycpu>
+  p = c->proc;
+8010730f:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80107315:	e8 06 09 00 00       	call   80107c20 <popcli>
+  acquire(&ptable.lock);
+8010731a:	83 ec 0c             	sub    $0xc,%esp
+8010731d:	68 e0 ea 13 80       	push   $0x8013eae0
+80107322:	e8 f9 09 00 00       	call   80107d20 <acquire>
+    if((p = curproc->zombies) != 0){
+80107327:	8b 73 1c             	mov    0x1c(%ebx),%esi
+8010732a:	83 c4 10             	add    $0x10,%esp
+8010732d:	85 f6                	test   %esi,%esi
+8010732f:	74 26                	je     80107357 <wait+0x57>
+80107331:	eb 4d                	jmp    80107380 <wait+0x80>
+80107333:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107337:	90                   	nop
+    if(curproc->children == 0 || curproc->killed){
+80107338:	8b 43 40             	mov    0x40(%ebx),%eax
+8010733b:	85 c0                	test   %eax,%eax
+8010733d:	75 1f                	jne    8010735e <wait+0x5e>
+    sleep(curproc, &ptable.lock);
+8010733f:	83 ec 08             	sub    $0x8,%esp
+80107342:	68 e0 ea 13 80       	push   $0x8013eae0
+80107347:	53                   	push   %ebx
+80107348:	e8 73 fe ff ff       	call   801071c0 <sleep>
+    if((p = curproc->zombies) != 0){
+8010734d:	8b 73 1c             	mov    0x1c(%ebx),%esi
+80107350:	83 c4 10             	add    $0x10,%esp
+80107353:	85 f6                	test   %esi,%esi
+80107355:	75 29                	jne    80107380 <wait+0x80>
+    if(curproc->children == 0 || curproc->killed){
+80107357:	8b 53 18             	mov    0x18(%ebx),%edx
+8010735a:	85 d2                	test   %edx,%edx
+8010735c:	75 da                	jne    80107338 <wait+0x38>
+      release(&ptable.lock);
+8010735e:	83 ec 0c             	sub    $0xc,%esp
+      return -1;
+80107361:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+      release(&ptable.lock);
+80107366:	68 e0 ea 13 80       	push   $0x8013eae0
+8010736b:	e8 50 09 00 00       	call   80107cc0 <release>
+      return -1;
+80107370:	83 c4 10             	add    $0x10,%esp
+}
+80107373:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107376:	89 d8                	mov    %ebx,%eax
+80107378:	5b                   	pop    %ebx
+80107379:	5e                   	pop    %esi
+8010737a:	5d                   	pop    %ebp
+8010737b:	c3                   	ret
+8010737c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      acquire(&runq[p->cpu].lock);
+80107380:	6b 86 d8 00 00 00 70 	imul   $0x70,0xd8(%esi),%eax
+80107387:	83 ec 0c             	sub    $0xc,%esp
+8010738a:	05 60 e7 13 80       	add    $0x8013e760,%eax
+8010738f:	50                   	push   %eax
+80107390:	e8 8b 09 00 00       	call   80107d20 <acquire>
+      release(&runq[p->cpu].lock);
+80107395:	6b 86 d8 00 00 00 70 	imul   $0x70,0xd8(%esi),%eax
+8010739c:	05 60 e7 13 80       	add    $0x8013e760,%eax
+801073a1:	89 04 24             	mov    %eax,(%esp)
+801073a4:	e8 17 09 00 00       	call   80107cc0 <release>
+  *p->psibling = p->sibling;
+801073a9:	8b 56 24             	mov    0x24(%esi),%edx
+801073ac:	8b 46 20             	mov    0x20(%esi),%eax
+  if(p->sibling)
+801073af:	83 c4 10             	add    $0x10,%esp
+  *p->psibling = p->sibling;
+801073b2:	89 02                	mov    %eax,(%edx)
+  if(p->sibling)
+801073b4:	85 c0                	test   %eax,%eax
+801073b6:	74 06                	je     801073be <wait+0xbe>
+    p->sibling->psibling = p->psibling;
+801073b8:	8b 56 24             	mov    0x24(%esi),%edx
+801073bb:	89 50 24             	mov    %edx,0x24(%eax)
+      kfree(p->kstack);
+801073be:	83 ec 0c             	sub    $0xc,%esp
+      pid = p->pid;
+801073c1:	8b 5e 10             	mov    0x10(%esi),%ebx
+      kfree(p->kstack);
+801073c4:	ff 76 08             	push   0x8(%esi)
+801073c7:	e8 54 cb ff ff       	call   80103f20 <kfree>
+      p->kstack = 0;
+801073cc:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+      freevm(p->pgdir);
+801073d3:	59                   	pop    %ecx
+801073d4:	ff 76 04             	push   0x4(%esi)
+801073d7:	e8 24 39 00 00       	call   8010ad00 <freevm>
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+801073dc:	8b 46 10             	mov    0x10(%esi),%eax
+801073df:	83 c4 10             	add    $0x10,%esp
+      p->parent = 0;
+801073e2:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      p->name[0] = 0;
+801073e9:	c6 86 88 00 00 00 00 	movb   $0x0,0x88(%esi)
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+801073f0:	89 c1                	mov    %eax,%ecx
+      p->killed = 0;
+801073f2:	c7 46 40 00 00 00 00 	movl   $0x0,0x40(%esi)
+      p->nice = 2;
+801073f9:	c7 86 98 00 00 00 02 	movl   $0x2,0x98(%esi)
+80107400:	00 00 00 
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+80107403:	c1 f9 1f             	sar    $0x1f,%ecx
+      p->base_priority = 2;
+80107406:	c7 86 9c 00 00 00 02 	movl   $0x2,0x9c(%esi)
+8010740d:	00 00 00 
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+80107410:	c1 e9 1a             	shr    $0x1a,%ecx
+      p->eff_priority = 2;
+80107413:	c7 86 a0 00 00 00 02 	movl   $0x2,0xa0(%esi)
+8010741a:	00 00 00 
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+8010741d:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+      p->agestart = 0;
+80107420:	c7 86 a4 00 00 00 00 	movl   $0x0,0xa4(%esi)
+80107427:	00 00 00 
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+8010742a:	83 e2 3f             	and    $0x3f,%edx
+8010742d:	29 ca                	sub    %ecx,%edx
+8010742f:	8b 04 95 14 30 14 80 	mov    -0x7febcfec(,%edx,4),%eax
+80107436:	39 f0                	cmp    %esi,%eax
+80107438:	74 3e                	je     80107478 <wait+0x178>
+8010743a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80107440:	89 c2                	mov    %eax,%edx
+80107442:	8b 40 3c             	mov    0x3c(%eax),%eax
+80107445:	39 f0                	cmp    %esi,%eax
+80107447:	75 f7                	jne    80107440 <wait+0x140>
+80107449:	83 c2 3c             	add    $0x3c,%edx
+  *pp = p->pidnext;
+8010744c:	8b 46 3c             	mov    0x3c(%esi),%eax
+      release(&ptable.lock);
+8010744f:	83 ec 0c             	sub    $0xc,%esp
+  *pp = p->pidnext;
+80107452:	89 02                	mov    %eax,(%edx)
+  p->pid = 0;
+80107454:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+  p->state = UNUSED;
+8010745b:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+      release(&ptable.lock);
+80107462:	68 e0 ea 13 80       	push   $0x8013eae0
+80107467:	e8 54 08 00 00       	call   80107cc0 <release>
+      return pid;
+8010746c:	83 c4 10             	add    $0x10,%esp
+}
+8010746f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107472:	89 d8                	mov    %ebx,%eax
+80107474:	5b                   	pop    %ebx
+80107475:	5e                   	pop    %esi
+80107476:	5d                   	pop    %ebp
+80107477:	c3                   	ret
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+80107478:	8d 14 95 14 30 14 80 	lea    -0x7febcfec(,%edx,4),%edx
+8010747f:	eb cb                	jmp    8010744c <wait+0x14c>
+80107481:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107488:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010748f:	90                   	nop
+
+80107490 <wakeproc>:
+
+// Wake p if it is sleeping on chan. Returns whether it was.
+int
+wakeproc(struct proc *p, void *chan)
+{
+80107490:	55                   	push   %ebp
+80107491:	89 e5                	mov    %esp,%ebp
+80107493:	56                   	push   %esi
+  int r;
+
+  acquire(&ptable.lock);
+  r = p->state == SLEEPING && p->chan == chan;
+80107494:	31 f6                	xor    %esi,%esi
+{
+80107496:	53                   	push   %ebx
+80107497:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ptable.lock);
+8010749a:	83 ec 0c             	sub    $0xc,%esp
+8010749d:	68 e0 ea 13 80       	push   $0x8013eae0
+801074a2:	e8 79 08 00 00       	call   80107d20 <acquire>
+  r = p->state == SLEEPING && p->chan == chan;
+801074a7:	83 c4 10             	add    $0x10,%esp
+801074aa:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+801074ae:	74 20                	je     801074d0 <wakeproc+0x40>
+  if(r)
+    wake1(p);
+  release(&ptable.lock);
+801074b0:	83 ec 0c             	sub    $0xc,%esp
+801074b3:	68 e0 ea 13 80       	push   $0x8013eae0
+801074b8:	e8 03 08 00 00       	call   80107cc0 <release>
+  return r;
+}
+801074bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801074c0:	89 f0                	mov    %esi,%eax
+801074c2:	5b                   	pop    %ebx
+801074c3:	5e                   	pop    %esi
+801074c4:	5d                   	pop    %ebp
+801074c5:	c3                   	ret
+801074c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801074cd:	8d 76 00             	lea    0x0(%esi),%esi
+  r = p->state == SLEEPING && p->chan == chan;
+801074d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+801074d3:	39 43 30             	cmp    %eax,0x30(%ebx)
+801074d6:	75 d8                	jne    801074b0 <wakeproc+0x20>
+    wake1(p);
+801074d8:	89 d8                	mov    %ebx,%eax
+  r = p->state == SLEEPING && p->chan == chan;
+801074da:	be 01 00 00 00       	mov    $0x1,%esi
+    wake1(p);
+801074df:	e8 3c ef ff ff       	call   80106420 <wake1>
+801074e4:	eb ca                	jmp    801074b0 <wakeproc+0x20>
+801074e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801074ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+801074f0 <wakeup>:
+
+void
+wakeup(void *chan)
+{
+801074f0:	55                   	push   %ebp
+801074f1:	89 e5                	mov    %esp,%ebp
+801074f3:	56                   	push   %esi
+801074f4:	53                   	push   %ebx
+801074f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  acquire(&ptable.lock);
+801074f8:	83 ec 0c             	sub    $0xc,%esp
+801074fb:	68 e0 ea 13 80       	push   $0x8013eae0
+80107500:	e8 1b 08 00 00       	call   80107d20 <acquire>
+  for(p = ptable.sleepq[SQHASH(chan)]; p; p = next){
+80107505:	69 c6 b1 79 37 9e    	imul   $0x9e3779b1,%esi,%eax
+8010750b:	83 c4 10             	add    $0x10,%esp
+8010750e:	c1 e8 1a             	shr    $0x1a,%eax
+80107511:	8b 1c 85 14 2f 14 80 	mov    -0x7febd0ec(,%eax,4),%ebx
+80107518:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010751f:	90                   	nop
+80107520:	85 db                	test   %ebx,%ebx
+80107522:	74 13                	je     80107537 <wakeup+0x47>
+    next = p->snext;
+80107524:	89 d8                	mov    %ebx,%eax
+80107526:	8b 5b 34             	mov    0x34(%ebx),%ebx
+    if(p->chan == chan)
+80107529:	3b 70 30             	cmp    0x30(%eax),%esi
+8010752c:	75 f2                	jne    80107520 <wakeup+0x30>
+      wake1(p);
+8010752e:	e8 ed ee ff ff       	call   80106420 <wake1>
+  for(p = ptable.sleepq[SQHASH(chan)]; p; p = next){
+80107533:	85 db                	test   %ebx,%ebx
+80107535:	75 ed                	jne    80107524 <wakeup+0x34>
+  wakeup1(chan);
+  release(&ptable.lock);
+80107537:	c7 45 08 e0 ea 13 80 	movl   $0x8013eae0,0x8(%ebp)
+}
+8010753e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107541:	5b                   	pop    %ebx
+80107542:	5e                   	pop    %esi
+80107543:	5d                   	pop    %ebp
+  release(&ptable.lock);
+80107544:	e9 77 07 00 00       	jmp    80107cc0 <release>
+80107549:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107550 <kill>:
+
+int
+kill(int pid)
+{
+80107550:	55                   	push   %ebp
+80107551:	89 e5                	mov    %esp,%ebp
+80107553:	53                   	push   %ebx
+80107554:	83 ec 10             	sub    $0x10,%esp
+80107557:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *p;
+
+  acquire(&ptable.lock);
+8010755a:	68 e0 ea 13 80       	push   $0x8013eae0
+8010755f:	e8 bc 07 00 00       	call   80107d20 <acquire>
+  for(p = ptable.pidhash[PIDHASH(pid)]; p; p = p->pidnext)
+80107564:	89 da                	mov    %ebx,%edx
+80107566:	83 c4 10             	add    $0x10,%esp
+80107569:	c1 fa 1f             	sar    $0x1f,%edx
+8010756c:	c1 ea 1a             	shr    $0x1a,%edx
+8010756f:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+80107572:	83 e0 3f             	and    $0x3f,%eax
+80107575:	29 d0                	sub    %edx,%eax
+80107577:	8b 04 85 14 30 14 80 	mov    -0x7febcfec(,%eax,4),%eax
+8010757e:	85 c0                	test   %eax,%eax
+80107580:	75 0d                	jne    8010758f <kill+0x3f>
+80107582:	eb 4c                	jmp    801075d0 <kill+0x80>
+80107584:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107588:	8b 40 3c             	mov    0x3c(%eax),%eax
+8010758b:	85 c0                	test   %eax,%eax
+8010758d:	74 41                	je     801075d0 <kill+0x80>
+    if(p->pid == pid)
+8010758f:	3b 58 10             	cmp    0x10(%eax),%ebx
+80107592:	75 f4                	jne    80107588 <kill+0x38>
+    release(&ptable.lock);
+    return -1;
+  }
+  p->killed = 1;
+  // Wake process from sleep if necessary.
+  if(p->state == SLEEPING)
+80107594:	83 78 0c 02          	cmpl   $0x2,0xc(%eax)
+  p->killed = 1;
+80107598:	c7 40 40 01 00 00 00 	movl   $0x1,0x40(%eax)
+  if(p->state == SLEEPING)
+8010759f:	74 1f                	je     801075c0 <kill+0x70>
+    wake1(p);
+  release(&ptable.lock);
+801075a1:	83 ec 0c             	sub    $0xc,%esp
+801075a4:	68 e0 ea 13 80       	push   $0x8013eae0
+801075a9:	e8 12 07 00 00       	call   80107cc0 <release>
+  return 0;
+801075ae:	83 c4 10             	add    $0x10,%esp
+801075b1:	31 c0                	xor    %eax,%eax
+}
+801075b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801075b6:	c9                   	leave
+801075b7:	c3                   	ret
+801075b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801075bf:	90                   	nop
+    wake1(p);
+801075c0:	e8 5b ee ff ff       	call   80106420 <wake1>
+801075c5:	eb da                	jmp    801075a1 <kill+0x51>
+801075c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801075ce:	66 90                	xchg   %ax,%ax
+    release(&ptable.lock);
+801075d0:	83 ec 0c             	sub    $0xc,%esp
+801075d3:	68 e0 ea 13 80       	push   $0x8013eae0
+801075d8:	e8 e3 06 00 00       	call   80107cc0 <release>
+    return -1;
+801075dd:	83 c4 10             	add    $0x10,%esp
+801075e0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801075e5:	eb cc                	jmp    801075b3 <kill+0x63>
+801075e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801075ee:	66 90                	xchg   %ax,%ax
+
+801075f0 <procdump>:
+
+//PAGEBREAK: 36
+void
+procdump(void)
+{
+801075f0:	55                   	push   %ebp
+801075f1:	89 e5                	mov    %esp,%ebp
+801075f3:	57                   	push   %edi
+801075f4:	56                   	push   %esi
+801075f5:	8d 75 e8             	lea    -0x18(%ebp),%esi
+801075f8:	53                   	push   %ebx
+801075f9:	bb 9c eb 13 80       	mov    $0x8013eb9c,%ebx
+801075fe:	83 ec 3c             	sub    $0x3c,%esp
+80107601:	eb 27                	jmp    8010762a <procdump+0x3a>
+80107603:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107607:	90                   	nop
+    if(p->state == SLEEPING){
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+      for(i=0; i<10 && pc[i] != 0; i++)
+        cprintf(" %p", pc[i]);
+    }
+    cprintf("\n");
+80107608:	83 ec 0c             	sub    $0xc,%esp
+8010760b:	68 f3 bf 10 80       	push   $0x8010bff3
+80107610:	e8 9b 95 ff ff       	call   80100bb0 <cprintf>
+80107615:	83 c4 10             	add    $0x10,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80107618:	81 c3 10 01 00 00    	add    $0x110,%ebx
+8010761e:	81 fb 9c 2f 14 80    	cmp    $0x80142f9c,%ebx
+80107624:	0f 84 96 00 00 00    	je     801076c0 <procdump+0xd0>
+    if(p->state == UNUSED)
+8010762a:	8b 43 84             	mov    -0x7c(%ebx),%eax
+8010762d:	85 c0                	test   %eax,%eax
+8010762f:	74 e7                	je     80107618 <procdump+0x28>
+      state = "???";
+80107631:	ba ee bb 10 80       	mov    $0x8010bbee,%edx
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+80107636:	83 f8 05             	cmp    $0x5,%eax
+80107639:	77 11                	ja     8010764c <procdump+0x5c>
+8010763b:	8b 14 85 8c bc 10 80 	mov    -0x7fef4374(,%eax,4),%edx
+      state = "???";
+80107642:	b8 ee bb 10 80       	mov    $0x8010bbee,%eax
+80107647:	85 d2                	test   %edx,%edx
+80107649:	0f 44 d0             	cmove  %eax,%edx
+    cprintf("%d %s %s", p->pid, state, p->name);
+8010764c:	53                   	push   %ebx
+8010764d:	52                   	push   %edx
+8010764e:	ff 73 88             	push   -0x78(%ebx)
+80107651:	68 f2 bb 10 80       	push   $0x8010bbf2
+80107656:	e8 55 95 ff ff       	call   80100bb0 <cprintf>
+    cprintf("  prio=%d(base=%d)", p->eff_priority, p->base_priority);
+8010765b:	83 c4 0c             	add    $0xc,%esp
+8010765e:	ff 73 14             	push   0x14(%ebx)
+80107661:	ff 73 18             	push   0x18(%ebx)
+80107664:	68 fb bb 10 80       	push   $0x8010bbfb
+80107669:	e8 42 95 ff ff       	call   80100bb0 <cprintf>
+    if(p->state == SLEEPING){
+8010766e:	83 c4 10             	add    $0x10,%esp
+80107671:	83 7b 84 02          	cmpl   $0x2,-0x7c(%ebx)
+80107675:	75 91                	jne    80107608 <procdump+0x18>
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+80107677:	83 ec 08             	sub    $0x8,%esp
+8010767a:	8d 45 c0             	lea    -0x40(%ebp),%eax
+8010767d:	8d 7d c0             	lea    -0x40(%ebp),%edi
+80107680:	50                   	push   %eax
+80107681:	8b 43 a4             	mov    -0x5c(%ebx),%eax
+80107684:	8b 40 0c             	mov    0xc(%eax),%eax
+80107687:	83 c0 08             	add    $0x8,%eax
+8010768a:	50                   	push   %eax
+8010768b:	e8 d0 04 00 00       	call   80107b60 <getcallerpcs>
+      for(i=0; i<10 && pc[i] != 0; i++)
+80107690:	83 c4 10             	add    $0x10,%esp
+80107693:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107697:	90                   	nop
+80107698:	8b 17                	mov    (%edi),%edx
+8010769a:	85 d2                	test   %edx,%edx
+8010769c:	0f 84 66 ff ff ff    	je     80107608 <procdump+0x18>
+        cprintf(" %p", pc[i]);
+801076a2:	83 ec 08             	sub    $0x8,%esp
+      for(i=0; i<10 && pc[i] != 0; i++)
+801076a5:	83 c7 04             	add    $0x4,%edi
+        cprintf(" %p", pc[i]);
+801076a8:	52                   	push   %edx
+801076a9:	68 d7 b5 10 80       	push   $0x8010b5d7
+801076ae:	e8 fd 94 ff ff       	call   80100bb0 <cprintf>
+      for(i=0; i<10 && pc[i] != 0; i++)
+801076b3:	83 c4 10             	add    $0x10,%esp
+801076b6:	39 f7                	cmp    %esi,%edi
+801076b8:	75 de                	jne    80107698 <procdump+0xa8>
+801076ba:	e9 49 ff ff ff       	jmp    80107608 <procdump+0x18>
+801076bf:	90                   	nop
+  }
+
+  for(i = 0; i < ncpu; i++)
+801076c0:	a1 a4 e1 13 80       	mov    0x8013e1a4,%eax
+801076c5:	85 c0                	test   %eax,%eax
+801076c7:	7e 2f                	jle    801076f8 <procdump+0x108>
+801076c9:	bb c0 e7 13 80       	mov    $0x8013e7c0,%ebx
+801076ce:	31 f6                	xor    %esi,%esi
+    cprintf("cpu%d: runnable %d steals %d migrations %d\n", i,
+801076d0:	83 ec 0c             	sub    $0xc,%esp
+801076d3:	ff 73 0c             	push   0xc(%ebx)
+  for(i = 0; i < ncpu; i++)
+801076d6:	83 c3 70             	add    $0x70,%ebx
+    cprintf("cpu%d: runnable %d steals %d migrations %d\n", i,
+801076d9:	ff 73 98             	push   -0x68(%ebx)
+801076dc:	ff 73 90             	push   -0x70(%ebx)
+801076df:	56                   	push   %esi
+  for(i = 0; i < ncpu; i++)
+801076e0:	83 c6 01             	add    $0x1,%esi
+    cprintf("cpu%d: runnable %d steals %d migrations %d\n", i,
+801076e3:	68 60 bc 10 80       	push   $0x8010bc60
+801076e8:	e8 c3 94 ff ff       	call   80100bb0 <cprintf>
+  for(i = 0; i < ncpu; i++)
+801076ed:	83 c4 20             	add    $0x20,%esp
+801076f0:	39 35 a4 e1 13 80    	cmp    %esi,0x8013e1a4
+801076f6:	7f d8                	jg     801076d0 <procdump+0xe0>
+            runq[i].nrunnable, runq[i].nsteals, runq[i].nmigrations);
+}
+801076f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801076fb:	5b                   	pop    %ebx
+801076fc:	5e                   	pop    %esi
+801076fd:	5f                   	pop    %edi
+801076fe:	5d                   	pop    %ebp
+801076ff:	c3                   	ret
+
+80107700 <setnice>:
+
+/* --------- HW3 helper for nice/priority ---------- */
+// Returns previous nice on success, -1 on error.
+int
+setnice(int pid, int value)
+{
+80107700:	55                   	push   %ebp
+80107701:	89 e5                	mov    %esp,%ebp
+80107703:	57                   	push   %edi
+80107704:	56                   	push   %esi
+80107705:	53                   	push   %ebx
+80107706:	83 ec 1c             	sub    $0x1c,%esp
+80107709:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010770c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if (value < 0 || value > 4)
+8010770f:	83 fe 04             	cmp    $0x4,%esi
+80107712:	0f 87 20 01 00 00    	ja     80107838 <setnice+0x138>
+    return -1;
+
+  acquire(&ptable.lock);
+80107718:	83 ec 0c             	sub    $0xc,%esp
+8010771b:	68 e0 ea 13 80       	push   $0x8013eae0
+80107720:	e8 fb 05 00 00       	call   80107d20 <acquire>
+  for(p = ptable.pidhash[PIDHASH(pid)]; p; p = p->pidnext)
+80107725:	89 fa                	mov    %edi,%edx
+80107727:	83 c4 10             	add    $0x10,%esp
+8010772a:	c1 fa 1f             	sar    $0x1f,%edx
+8010772d:	c1 ea 1a             	shr    $0x1a,%edx
+80107730:	8d 04 17             	lea    (%edi,%edx,1),%eax
+80107733:	83 e0 3f             	and    $0x3f,%eax
+80107736:	29 d0                	sub    %edx,%eax
+80107738:	8b 1c 85 14 30 14 80 	mov    -0x7febcfec(,%eax,4),%ebx
+8010773f:	85 db                	test   %ebx,%ebx
+80107741:	75 18                	jne    8010775b <setnice+0x5b>
+80107743:	e9 e0 00 00 00       	jmp    80107828 <setnice+0x128>
+80107748:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010774f:	90                   	nop
+80107750:	8b 5b 3c             	mov    0x3c(%ebx),%ebx
+80107753:	85 db                	test   %ebx,%ebx
+80107755:	0f 84 cd 00 00 00    	je     80107828 <setnice+0x128>
+    if(p->pid == pid)
+8010775b:	3b 7b 10             	cmp    0x10(%ebx),%edi
+8010775e:	75 f0                	jne    80107750 <setnice+0x50>
+  struct proc *p = findproc(pid);
+  if (p != 0) {
+    int old = p->nice;
+80107760:	8b 83 98 00 00 00    	mov    0x98(%ebx),%eax
+80107766:	89 75 0c             	mov    %esi,0xc(%ebp)
+80107769:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    uint readyat = p->readyat;
+8010776c:	8b 83 f8 00 00 00    	mov    0xf8(%ebx),%eax
+80107772:	89 45 e0             	mov    %eax,-0x20(%ebp)
+lockrq(struct proc *p)
+80107775:	eb 15                	jmp    8010778c <setnice+0x8c>
+80107777:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010777e:	66 90                	xchg   %ax,%ax
+    release(&rq->lock);
+80107780:	83 ec 0c             	sub    $0xc,%esp
+80107783:	56                   	push   %esi
+80107784:	e8 37 05 00 00       	call   80107cc0 <release>
+    rq = &runq[p->cpu];
+80107789:	83 c4 10             	add    $0x10,%esp
+8010778c:	6b bb d8 00 00 00 70 	imul   $0x70,0xd8(%ebx),%edi
+    acquire(&rq->lock);
+80107793:	83 ec 0c             	sub    $0xc,%esp
+    rq = &runq[p->cpu];
+80107796:	8d b7 60 e7 13 80    	lea    -0x7fec18a0(%edi),%esi
+    acquire(&rq->lock);
+8010779c:	56                   	push   %esi
+8010779d:	e8 7e 05 00 00       	call   80107d20 <acquire>
+    if(rq == &runq[p->cpu])
+801077a2:	6b 93 d8 00 00 00 70 	imul   $0x70,0xd8(%ebx),%edx
+801077a9:	83 c4 10             	add    $0x10,%esp
+801077ac:	39 d7                	cmp    %edx,%edi
+801077ae:	75 d0                	jne    80107780 <setnice+0x80>
+    struct runq *rq = lockrq(p);
+
+    // A queued process has to move to its new level.
+    if (p->state == RUNNABLE)
+801077b0:	83 7b 0c 03          	cmpl   $0x3,0xc(%ebx)
+801077b4:	89 f7                	mov    %esi,%edi
+801077b6:	8b 75 0c             	mov    0xc(%ebp),%esi
+801077b9:	74 35                	je     801077f0 <setnice+0xf0>
+      rqremove(rq, p);
+    p->nice = value;
+801077bb:	89 b3 98 00 00 00    	mov    %esi,0x98(%ebx)
+    p->base_priority = value;
+801077c1:	89 b3 9c 00 00 00    	mov    %esi,0x9c(%ebx)
+    p->eff_priority  = value;
+801077c7:	89 b3 a0 00 00 00    	mov    %esi,0xa0(%ebx)
+#endif
+    if (p->state == RUNNABLE) {
+      setrunnable(rq, p);
+      p->readyat = readyat;    // still the same wait
+    }
+    release(&rq->lock);
+801077cd:	83 ec 0c             	sub    $0xc,%esp
+801077d0:	57                   	push   %edi
+801077d1:	e8 ea 04 00 00       	call   80107cc0 <release>
+
+    release(&ptable.lock);
+801077d6:	c7 04 24 e0 ea 13 80 	movl   $0x8013eae0,(%esp)
+801077dd:	e8 de 04 00 00       	call   80107cc0 <release>
+    return old;
+801077e2:	83 c4 10             	add    $0x10,%esp
+  }
+  release(&ptable.lock);
+  return -1;
+}
+801077e5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801077e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801077eb:	5b                   	pop    %ebx
+801077ec:	5e                   	pop    %esi
+801077ed:	5f                   	pop    %edi
+801077ee:	5d                   	pop    %ebp
+801077ef:	c3                   	ret
+      rqremove(rq, p);
+801077f0:	89 da                	mov    %ebx,%edx
+801077f2:	89 f8                	mov    %edi,%eax
+801077f4:	e8 77 e7 ff ff       	call   80105f70 <rqremove>
+    if (p->state == RUNNABLE) {
+801077f9:	83 7b 0c 03          	cmpl   $0x3,0xc(%ebx)
+    p->nice = value;
+801077fd:	89 b3 98 00 00 00    	mov    %esi,0x98(%ebx)
+    p->base_priority = value;
+80107803:	89 b3 9c 00 00 00    	mov    %esi,0x9c(%ebx)
+    p->eff_priority  = value;
+80107809:	89 b3 a0 00 00 00    	mov    %esi,0xa0(%ebx)
+    if (p->state == RUNNABLE) {
+8010780f:	75 bc                	jne    801077cd <setnice+0xcd>
+      setrunnable(rq, p);
+80107811:	89 f8                	mov    %edi,%eax
+80107813:	89 da                	mov    %ebx,%edx
+80107815:	e8 d6 ea ff ff       	call   801062f0 <setrunnable>
+      p->readyat = readyat;    // still the same wait
+8010781a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010781d:	89 83 f8 00 00 00    	mov    %eax,0xf8(%ebx)
+80107823:	eb a8                	jmp    801077cd <setnice+0xcd>
+80107825:	8d 76 00             	lea    0x0(%esi),%esi
+  release(&ptable.lock);
+80107828:	83 ec 0c             	sub    $0xc,%esp
+8010782b:	68 e0 ea 13 80       	push   $0x8013eae0
+80107830:	e8 8b 04 00 00       	call   80107cc0 <release>
+  return -1;
+80107835:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80107838:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+8010783f:	eb a4                	jmp    801077e5 <setnice+0xe5>
+80107841:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107848:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010784f:	90                   	nop
+
+80107850 <settickets>:
+  release(&ptable.lock);
+  return old;
+#else
+  return -1;
+#endif
+}
+80107850:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107855:	c3                   	ret
+80107856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010785d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107860 <lendtickets>:
+  release(&ptable.lock);
+  return 0;
+#else
+  return -1;
+#endif
+}
+80107860:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107865:	c3                   	ret
+80107866:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010786d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107870 <getpstat>:
+
+// Copy scheduler statistics for up to n processes out to
+// user address uva. Returns the number copied, or -1.
+int
+getpstat(uint uva, int n)
+{
+80107870:	55                   	push   %ebp
+80107871:	89 e5                	mov    %esp,%ebp
+80107873:	57                   	push   %edi
+  struct proc *p;
+  struct pstat ps;
+  int i;
+
+  i = 0;
+80107874:	31 ff                	xor    %edi,%edi
+{
+80107876:	56                   	push   %esi
+80107877:	53                   	push   %ebx
+80107878:	83 ec 5c             	sub    $0x5c,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC] && i < n; p++){
+8010787b:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010787e:	85 c0                	test   %eax,%eax
+80107880:	0f 8e 01 01 00 00    	jle    80107987 <getpstat+0x117>
+80107886:	be 14 eb 13 80       	mov    $0x8013eb14,%esi
+8010788b:	e9 be 00 00 00       	jmp    8010794e <getpstat+0xde>
+    acquire(&ptable.lock);
+    if(p->state == UNUSED){
+      release(&ptable.lock);
+      continue;
+    }
+    ps.pid = p->pid;
+80107890:	8b 4e 10             	mov    0x10(%esi),%ecx
+    ps.state = p->state;
+    safestrcpy(ps.name, p->name, sizeof(ps.name));
+80107893:	83 ec 04             	sub    $0x4,%esp
+    ps.state = p->state;
+80107896:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+    safestrcpy(ps.name, p->name, sizeof(ps.name));
+80107899:	8d 86 88 00 00 00    	lea    0x88(%esi),%eax
+    ps.pid = p->pid;
+8010789f:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+    safestrcpy(ps.name, p->name, sizeof(ps.name));
+801078a2:	6a 10                	push   $0x10
+801078a4:	50                   	push   %eax
+801078a5:	8d 45 b8             	lea    -0x48(%ebp),%eax
+801078a8:	50                   	push   %eax
+801078a9:	e8 02 07 00 00       	call   80107fb0 <safestrcpy>
+    ps.cpu = p->cpu;
+801078ae:	8b 86 98 00 00 00    	mov    0x98(%esi),%eax
+801078b4:	8b 9e a0 00 00 00    	mov    0xa0(%esi),%ebx
+801078ba:	8b 8e d8 00 00 00    	mov    0xd8(%esi),%ecx
+801078c0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    ps.nice = p->nice;
+    ps.prio = p->eff_priority;
+    ps.runticks = p->runticks;
+801078c3:	8b 86 00 01 00 00    	mov    0x100(%esi),%eax
+    ps.cpu = p->cpu;
+801078c9:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+    ps.runticks = p->runticks;
+801078cc:	8b 8e fc 00 00 00    	mov    0xfc(%esi),%ecx
+801078d2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+801078d5:	8b 86 08 01 00 00    	mov    0x108(%esi),%eax
+    ps.cpu = p->cpu;
+801078db:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    ps.runticks = p->runticks;
+801078de:	8b 9e 04 01 00 00    	mov    0x104(%esi),%ebx
+801078e4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801078e7:	8b 86 0c 01 00 00    	mov    0x10c(%esi),%eax
+801078ed:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+801078f0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801078f3:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+    ps.nswitch = p->nswitch;
+    ps.nboost = p->nboost;
+    release(&ptable.lock);
+
+    // copyout() may allocate, so not under ptable.lock.
+    if(copyout(myproc()->pgdir, uva + i*sizeof(ps), &ps, sizeof(ps)) < 0)
+801078f6:	6b df 38             	imul   $0x38,%edi,%ebx
+    release(&ptable.lock);
+801078f9:	c7 04 24 e0 ea 13 80 	movl   $0x8013eae0,(%esp)
+80107900:	e8 bb 03 00 00       	call   80107cc0 <release>
+    if(copyout(myproc()->pgdir, uva + i*sizeof(ps), &ps, sizeof(ps)) < 0)
+80107905:	03 5d 08             	add    0x8(%ebp),%ebx
+80107908:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+  pushcli();
+8010790b:	e8 c0 02 00 00       	call   80107bd0 <pushcli>
+  c = mycpu();
+80107910:	e8 5b e9 ff ff       	call   80106270 <mycpu>
+  p = c->proc;
+80107915:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+8010791b:	e8 00 03 00 00       	call   80107c20 <popcli>
+    if(copyout(myproc()->pgdir, uva + i*sizeof(ps), &ps, sizeof(ps)) < 0)
+80107920:	8d 45 b0             	lea    -0x50(%ebp),%eax
+80107923:	6a 38                	push   $0x38
+80107925:	50                   	push   %eax
+80107926:	ff 75 a4             	push   -0x5c(%ebp)
+80107929:	ff 73 04             	push   0x4(%ebx)
+8010792c:	e8 af 3a 00 00       	call   8010b3e0 <copyout>
+80107931:	83 c4 20             	add    $0x20,%esp
+80107934:	85 c0                	test   %eax,%eax
+80107936:	78 60                	js     80107998 <getpstat+0x128>
+  for(p = ptable.proc; p < &ptable.proc[NPROC] && i < n; p++){
+80107938:	81 c6 10 01 00 00    	add    $0x110,%esi
+      return -1;
+    i++;
+8010793e:	83 c7 01             	add    $0x1,%edi
+  for(p = ptable.proc; p < &ptable.proc[NPROC] && i < n; p++){
+80107941:	81 fe 14 2f 14 80    	cmp    $0x80142f14,%esi
+80107947:	73 3e                	jae    80107987 <getpstat+0x117>
+80107949:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+8010794c:	7d 39                	jge    80107987 <getpstat+0x117>
+    acquire(&ptable.lock);
+8010794e:	83 ec 0c             	sub    $0xc,%esp
+80107951:	68 e0 ea 13 80       	push   $0x8013eae0
+80107956:	e8 c5 03 00 00       	call   80107d20 <acquire>
+    if(p->state == UNUSED){
+8010795b:	8b 46 0c             	mov    0xc(%esi),%eax
+8010795e:	83 c4 10             	add    $0x10,%esp
+80107961:	85 c0                	test   %eax,%eax
+80107963:	0f 85 27 ff ff ff    	jne    80107890 <getpstat+0x20>
+      release(&ptable.lock);
+80107969:	83 ec 0c             	sub    $0xc,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC] && i < n; p++){
+8010796c:	81 c6 10 01 00 00    	add    $0x110,%esi
+      release(&ptable.lock);
+80107972:	68 e0 ea 13 80       	push   $0x8013eae0
+80107977:	e8 44 03 00 00       	call   80107cc0 <release>
+      continue;
+8010797c:	83 c4 10             	add    $0x10,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC] && i < n; p++){
+8010797f:	81 fe 14 2f 14 80    	cmp    $0x80142f14,%esi
+80107985:	72 c2                	jb     80107949 <getpstat+0xd9>
+  }
+  return i;
+}
+80107987:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010798a:	89 f8                	mov    %edi,%eax
+8010798c:	5b                   	pop    %ebx
+8010798d:	5e                   	pop    %esi
+8010798e:	5f                   	pop    %edi
+8010798f:	5d                   	pop    %ebp
+80107990:	c3                   	ret
+80107991:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107998:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010799b:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+}
+801079a0:	5b                   	pop    %ebx
+801079a1:	89 f8                	mov    %edi,%eax
+801079a3:	5e                   	pop    %esi
+801079a4:	5f                   	pop    %edi
+801079a5:	5d                   	pop    %ebp
+801079a6:	c3                   	ret
+801079a7:	66 90                	xchg   %ax,%ax
+801079a9:	66 90                	xchg   %ax,%ax
+801079ab:	66 90                	xchg   %ax,%ax
+801079ad:	66 90                	xchg   %ax,%ax
+801079af:	90                   	nop
+
+801079b0 <initsleeplock>:
+#include "spinlock.h"
+#include "sleeplock.h"
+
+void
+initsleeplock(struct sleeplock *lk, char *name)
+{
+801079b0:	55                   	push   %ebp
+801079b1:	89 e5                	mov    %esp,%ebp
+801079b3:	53                   	push   %ebx
+801079b4:	83 ec 0c             	sub    $0xc,%esp
+801079b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&lk->lk, "sleep lock");
+801079ba:	68 a4 bc 10 80       	push   $0x8010bca4
+801079bf:	8d 43 04             	lea    0x4(%ebx),%eax
+801079c2:	50                   	push   %eax
+801079c3:	e8 78 01 00 00       	call   80107b40 <initlock>
+  lk->name = name;
+801079c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  lk->locked = 0;
+801079cb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+}
+801079d1:	83 c4 10             	add    $0x10,%esp
+  lk->pid = 0;
+801079d4:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+  lk->name = name;
+801079db:	89 43 38             	mov    %eax,0x38(%ebx)
+}
+801079de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801079e1:	c9                   	leave
+801079e2:	c3                   	ret
+801079e3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801079ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801079f0 <acquiresleep>:
+
+void
+acquiresleep(struct sleeplock *lk)
+{
+801079f0:	55                   	push   %ebp
+801079f1:	89 e5                	mov    %esp,%ebp
+801079f3:	56                   	push   %esi
+801079f4:	53                   	push   %ebx
+801079f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+801079f8:	8d 73 04             	lea    0x4(%ebx),%esi
+801079fb:	83 ec 0c             	sub    $0xc,%esp
+801079fe:	56                   	push   %esi
+801079ff:	e8 1c 03 00 00       	call   80107d20 <acquire>
+  while (lk->locked) {
+80107a04:	8b 13                	mov    (%ebx),%edx
+80107a06:	83 c4 10             	add    $0x10,%esp
+80107a09:	85 d2                	test   %edx,%edx
+80107a0b:	74 16                	je     80107a23 <acquiresleep+0x33>
+80107a0d:	8d 76 00             	lea    0x0(%esi),%esi
+    sleep(lk, &lk->lk);
+80107a10:	83 ec 08             	sub    $0x8,%esp
+80107a13:	56                   	push   %esi
+80107a14:	53                   	push   %ebx
+80107a15:	e8 a6 f7 ff ff       	call   801071c0 <sleep>
+  while (lk->locked) {
+80107a1a:	8b 03                	mov    (%ebx),%eax
+80107a1c:	83 c4 10             	add    $0x10,%esp
+80107a1f:	85 c0                	test   %eax,%eax
+80107a21:	75 ed                	jne    80107a10 <acquiresleep+0x20>
+  }
+  lk->locked = 1;
+80107a23:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  lk->pid = myproc()->pid;
+80107a29:	e8 22 eb ff ff       	call   80106550 <myproc>
+80107a2e:	8b 40 10             	mov    0x10(%eax),%eax
+80107a31:	89 43 3c             	mov    %eax,0x3c(%ebx)
+  release(&lk->lk);
+80107a34:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80107a37:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107a3a:	5b                   	pop    %ebx
+80107a3b:	5e                   	pop    %esi
+80107a3c:	5d                   	pop    %ebp
+  release(&lk->lk);
+80107a3d:	e9 7e 02 00 00       	jmp    80107cc0 <release>
+80107a42:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107a49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107a50 <tryacquiresleep>:
+
+// Acquire lk only if no one holds it.
+// Returns 1 if it was acquired, 0 if not.
+int
+tryacquiresleep(struct sleeplock *lk)
+{
+80107a50:	55                   	push   %ebp
+80107a51:	89 e5                	mov    %esp,%ebp
+80107a53:	57                   	push   %edi
+80107a54:	56                   	push   %esi
+80107a55:	53                   	push   %ebx
+80107a56:	83 ec 18             	sub    $0x18,%esp
+80107a59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  acquire(&lk->lk);
+80107a5c:	8d 73 04             	lea    0x4(%ebx),%esi
+80107a5f:	56                   	push   %esi
+80107a60:	e8 bb 02 00 00       	call   80107d20 <acquire>
+  r = !lk->locked;
+80107a65:	8b 13                	mov    (%ebx),%edx
+80107a67:	31 c0                	xor    %eax,%eax
+80107a69:	83 c4 10             	add    $0x10,%esp
+80107a6c:	85 d2                	test   %edx,%edx
+80107a6e:	0f 94 c0             	sete   %al
+80107a71:	89 c7                	mov    %eax,%edi
+  if(r){
+80107a73:	74 1b                	je     80107a90 <tryacquiresleep+0x40>
+    lk->locked = 1;
+    lk->pid = myproc()->pid;
+  }
+  release(&lk->lk);
+80107a75:	83 ec 0c             	sub    $0xc,%esp
+80107a78:	56                   	push   %esi
+80107a79:	e8 42 02 00 00       	call   80107cc0 <release>
+  return r;
+}
+80107a7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107a81:	89 f8                	mov    %edi,%eax
+80107a83:	5b                   	pop    %ebx
+80107a84:	5e                   	pop    %esi
+80107a85:	5f                   	pop    %edi
+80107a86:	5d                   	pop    %ebp
+80107a87:	c3                   	ret
+80107a88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107a8f:	90                   	nop
+    lk->locked = 1;
+80107a90:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+    lk->pid = myproc()->pid;
+80107a96:	e8 b5 ea ff ff       	call   80106550 <myproc>
+80107a9b:	8b 40 10             	mov    0x10(%eax),%eax
+80107a9e:	89 43 3c             	mov    %eax,0x3c(%ebx)
+80107aa1:	eb d2                	jmp    80107a75 <tryacquiresleep+0x25>
+80107aa3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107aaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107ab0 <releasesleep>:
+
+void
+releasesleep(struct sleeplock *lk)
+{
+80107ab0:	55                   	push   %ebp
+80107ab1:	89 e5                	mov    %esp,%ebp
+80107ab3:	56                   	push   %esi
+80107ab4:	53                   	push   %ebx
+80107ab5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+80107ab8:	8d 73 04             	lea    0x4(%ebx),%esi
+80107abb:	83 ec 0c             	sub    $0xc,%esp
+80107abe:	56                   	push   %esi
+80107abf:	e8 5c 02 00 00       	call   80107d20 <acquire>
+  lk->locked = 0;
+80107ac4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+80107aca:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+  wakeup(lk);
+80107ad1:	89 1c 24             	mov    %ebx,(%esp)
+80107ad4:	e8 17 fa ff ff       	call   801074f0 <wakeup>
+  release(&lk->lk);
+80107ad9:	89 75 08             	mov    %esi,0x8(%ebp)
+80107adc:	83 c4 10             	add    $0x10,%esp
+}
+80107adf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107ae2:	5b                   	pop    %ebx
+80107ae3:	5e                   	pop    %esi
+80107ae4:	5d                   	pop    %ebp
+  release(&lk->lk);
+80107ae5:	e9 d6 01 00 00       	jmp    80107cc0 <release>
+80107aea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107af0 <holdingsleep>:
+
+int
+holdingsleep(struct sleeplock *lk)
+{
+80107af0:	55                   	push   %ebp
+80107af1:	89 e5                	mov    %esp,%ebp
+80107af3:	57                   	push   %edi
+80107af4:	31 ff                	xor    %edi,%edi
+80107af6:	56                   	push   %esi
+80107af7:	53                   	push   %ebx
+80107af8:	83 ec 18             	sub    $0x18,%esp
+80107afb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  
+  acquire(&lk->lk);
+80107afe:	8d 73 04             	lea    0x4(%ebx),%esi
+80107b01:	56                   	push   %esi
+80107b02:	e8 19 02 00 00       	call   80107d20 <acquire>
+  r = lk->locked && (lk->pid == myproc()->pid);
+80107b07:	8b 03                	mov    (%ebx),%eax
+80107b09:	83 c4 10             	add    $0x10,%esp
+80107b0c:	85 c0                	test   %eax,%eax
+80107b0e:	75 18                	jne    80107b28 <holdingsleep+0x38>
+  release(&lk->lk);
+80107b10:	83 ec 0c             	sub    $0xc,%esp
+80107b13:	56                   	push   %esi
+80107b14:	e8 a7 01 00 00       	call   80107cc0 <release>
+  return r;
+}
+80107b19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107b1c:	89 f8                	mov    %edi,%eax
+80107b1e:	5b                   	pop    %ebx
+80107b1f:	5e                   	pop    %esi
+80107b20:	5f                   	pop    %edi
+80107b21:	5d                   	pop    %ebp
+80107b22:	c3                   	ret
+80107b23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107b27:	90                   	nop
+  r = lk->locked && (lk->pid == myproc()->pid);
+80107b28:	8b 5b 3c             	mov    0x3c(%ebx),%ebx
+80107b2b:	e8 20 ea ff ff       	call   80106550 <myproc>
+80107b30:	39 58 10             	cmp    %ebx,0x10(%eax)
+80107b33:	0f 94 c0             	sete   %al
+80107b36:	0f b6 c0             	movzbl %al,%eax
+80107b39:	89 c7                	mov    %eax,%edi
+80107b3b:	eb d3                	jmp    80107b10 <holdingsleep+0x20>
+80107b3d:	66 90                	xchg   %ax,%ax
+80107b3f:	90                   	nop
+
+80107b40 <initlock>:
+#include "proc.h"
+#include "spinlock.h"
+
+void
+initlock(struct spinlock *lk, char *name)
+{
+80107b40:	55                   	push   %ebp
+80107b41:	89 e5                	mov    %esp,%ebp
+80107b43:	8b 45 08             	mov    0x8(%ebp),%eax
+  lk->name = name;
+80107b46:	8b 55 0c             	mov    0xc(%ebp),%edx
+  lk->locked = 0;
+80107b49:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  lk->name = name;
+80107b4f:	89 50 04             	mov    %edx,0x4(%eax)
+  lk->cpu = 0;
+80107b52:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+80107b59:	5d                   	pop    %ebp
+80107b5a:	c3                   	ret
+80107b5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107b5f:	90                   	nop
+
+80107b60 <getcallerpcs>:
+}
+
+// Record the current call stack in pcs[] by following the %ebp chain.
+void
+getcallerpcs(void *v, uint pcs[])
+{
+80107b60:	55                   	push   %ebp
+80107b61:	89 e5                	mov    %esp,%ebp
+80107b63:	53                   	push   %ebx
+80107b64:	8b 45 08             	mov    0x8(%ebp),%eax
+80107b67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  uint *ebp;
+  int i;
+
+  ebp = (uint*)v - 2;
+80107b6a:	8d 50 f8             	lea    -0x8(%eax),%edx
+  for(i = 0; i < 10; i++){
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80107b6d:	05 f8 ff ff 7f       	add    $0x7ffffff8,%eax
+80107b72:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+  for(i = 0; i < 10; i++){
+80107b77:	b8 00 00 00 00       	mov    $0x0,%eax
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80107b7c:	76 10                	jbe    80107b8e <getcallerpcs+0x2e>
+80107b7e:	eb 28                	jmp    80107ba8 <getcallerpcs+0x48>
+80107b80:	8d 9a 00 00 00 80    	lea    -0x80000000(%edx),%ebx
+80107b86:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+80107b8c:	77 1a                	ja     80107ba8 <getcallerpcs+0x48>
+      break;
+    pcs[i] = ebp[1];     // saved %eip
+80107b8e:	8b 5a 04             	mov    0x4(%edx),%ebx
+80107b91:	89 1c 81             	mov    %ebx,(%ecx,%eax,4)
+  for(i = 0; i < 10; i++){
+80107b94:	83 c0 01             	add    $0x1,%eax
+    ebp = (uint*)ebp[0]; // saved %ebp
+80107b97:	8b 12                	mov    (%edx),%edx
+  for(i = 0; i < 10; i++){
+80107b99:	83 f8 0a             	cmp    $0xa,%eax
+80107b9c:	75 e2                	jne    80107b80 <getcallerpcs+0x20>
+  }
+  for(; i < 10; i++)
+    pcs[i] = 0;
+}
+80107b9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107ba1:	c9                   	leave
+80107ba2:	c3                   	ret
+80107ba3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107ba7:	90                   	nop
+80107ba8:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+80107bab:	8d 51 28             	lea    0x28(%ecx),%edx
+80107bae:	66 90                	xchg   %ax,%ax
+    pcs[i] = 0;
+80107bb0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(; i < 10; i++)
+80107bb6:	83 c0 04             	add    $0x4,%eax
+80107bb9:	39 d0                	cmp    %edx,%eax
+80107bbb:	75 f3                	jne    80107bb0 <getcallerpcs+0x50>
+}
+80107bbd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107bc0:	c9                   	leave
+80107bc1:	c3                   	ret
+80107bc2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107bc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107bd0 <pushcli>:
+// it takes two popcli to undo two pushcli.  Also, if interrupts
+// are off, then pushcli, popcli leaves them off.
+
+void
+pushcli(void)
+{
+80107bd0:	55                   	push   %ebp
+80107bd1:	89 e5                	mov    %esp,%ebp
+80107bd3:	53                   	push   %ebx
+80107bd4:	83 ec 04             	sub    $0x4,%esp
+80107bd7:	9c                   	pushf
+80107bd8:	5b                   	pop    %ebx
+  asm volatile("cli");
+80107bd9:	fa                   	cli
+  int eflags;
+
+  eflags = readeflags();
+  cli();
+  if(mycpu()->ncli == 0)
+80107bda:	e8 91 e6 ff ff       	call   80106270 <mycpu>
+80107bdf:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+80107be5:	85 c0                	test   %eax,%eax
+80107be7:	74 17                	je     80107c00 <pushcli+0x30>
+    mycpu()->intena = eflags & FL_IF;
+  mycpu()->ncli += 1;
+80107be9:	e8 82 e6 ff ff       	call   80106270 <mycpu>
+80107bee:	83 80 a4 00 00 00 01 	addl   $0x1,0xa4(%eax)
+}
+80107bf5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107bf8:	c9                   	leave
+80107bf9:	c3                   	ret
+80107bfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mycpu()->intena = eflags & FL_IF;
+80107c00:	e8 6b e6 ff ff       	call   80106270 <mycpu>
+80107c05:	81 e3 00 02 00 00    	and    $0x200,%ebx
+80107c0b:	89 98 a8 00 00 00    	mov    %ebx,0xa8(%eax)
+80107c11:	eb d6                	jmp    80107be9 <pushcli+0x19>
+80107c13:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107c1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107c20 <popcli>:
+
+void
+popcli(void)
+{
+80107c20:	55                   	push   %ebp
+80107c21:	89 e5                	mov    %esp,%ebp
+80107c23:	83 ec 08             	sub    $0x8,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80107c26:	9c                   	pushf
+80107c27:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80107c28:	f6 c4 02             	test   $0x2,%ah
+80107c2b:	75 35                	jne    80107c62 <popcli+0x42>
+    panic("popcli - interruptible");
+  if(--mycpu()->ncli < 0)
+80107c2d:	e8 3e e6 ff ff       	call   80106270 <mycpu>
+80107c32:	83 a8 a4 00 00 00 01 	subl   $0x1,0xa4(%eax)
+80107c39:	78 34                	js     80107c6f <popcli+0x4f>
+    panic("popcli");
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+80107c3b:	e8 30 e6 ff ff       	call   80106270 <mycpu>
+80107c40:	8b 90 a4 00 00 00    	mov    0xa4(%eax),%edx
+80107c46:	85 d2                	test   %edx,%edx
+80107c48:	74 06                	je     80107c50 <popcli+0x30>
+    sti();
+}
+80107c4a:	c9                   	leave
+80107c4b:	c3                   	ret
+80107c4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+80107c50:	e8 1b e6 ff ff       	call   80106270 <mycpu>
+80107c55:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+80107c5b:	85 c0                	test   %eax,%eax
+80107c5d:	74 eb                	je     80107c4a <popcli+0x2a>
+  asm volatile("sti");
+80107c5f:	fb                   	sti
+}
+80107c60:	c9                   	leave
+80107c61:	c3                   	ret
+    panic("popcli - interruptible");
+80107c62:	83 ec 0c             	sub    $0xc,%esp
+80107c65:	68 af bc 10 80       	push   $0x8010bcaf
+80107c6a:	e8 11 8c ff ff       	call   80100880 <panic>
+    panic("popcli");
+80107c6f:	83 ec 0c             	sub    $0xc,%esp
+80107c72:	68 c6 bc 10 80       	push   $0x8010bcc6
+80107c77:	e8 04 8c ff ff       	call   80100880 <panic>
+80107c7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80107c80 <holding>:
+{
+80107c80:	55                   	push   %ebp
+80107c81:	89 e5                	mov    %esp,%ebp
+80107c83:	56                   	push   %esi
+80107c84:	53                   	push   %ebx
+80107c85:	8b 75 08             	mov    0x8(%ebp),%esi
+80107c88:	31 db                	xor    %ebx,%ebx
+  pushcli();
+80107c8a:	e8 41 ff ff ff       	call   80107bd0 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+80107c8f:	8b 06                	mov    (%esi),%eax
+80107c91:	85 c0                	test   %eax,%eax
+80107c93:	75 0b                	jne    80107ca0 <holding+0x20>
+  popcli();
+80107c95:	e8 86 ff ff ff       	call   80107c20 <popcli>
+}
+80107c9a:	89 d8                	mov    %ebx,%eax
+80107c9c:	5b                   	pop    %ebx
+80107c9d:	5e                   	pop    %esi
+80107c9e:	5d                   	pop    %ebp
+80107c9f:	c3                   	ret
+  r = lock->locked && lock->cpu == mycpu();
+80107ca0:	8b 5e 08             	mov    0x8(%esi),%ebx
+80107ca3:	e8 c8 e5 ff ff       	call   80106270 <mycpu>
+80107ca8:	39 c3                	cmp    %eax,%ebx
+80107caa:	0f 94 c3             	sete   %bl
+  popcli();
+80107cad:	e8 6e ff ff ff       	call   80107c20 <popcli>
+  r = lock->locked && lock->cpu == mycpu();
+80107cb2:	0f b6 db             	movzbl %bl,%ebx
+}
+80107cb5:	89 d8                	mov    %ebx,%eax
+80107cb7:	5b                   	pop    %ebx
+80107cb8:	5e                   	pop    %esi
+80107cb9:	5d                   	pop    %ebp
+80107cba:	c3                   	ret
+80107cbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107cbf:	90                   	nop
+
+80107cc0 <release>:
+{
+80107cc0:	55                   	push   %ebp
+80107cc1:	89 e5                	mov    %esp,%ebp
+80107cc3:	56                   	push   %esi
+80107cc4:	53                   	push   %ebx
+80107cc5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+80107cc8:	e8 03 ff ff ff       	call   80107bd0 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+80107ccd:	8b 03                	mov    (%ebx),%eax
+80107ccf:	85 c0                	test   %eax,%eax
+80107cd1:	75 15                	jne    80107ce8 <release+0x28>
+  popcli();
+80107cd3:	e8 48 ff ff ff       	call   80107c20 <popcli>
+    panic("release");
+80107cd8:	83 ec 0c             	sub    $0xc,%esp
+80107cdb:	68 cd bc 10 80       	push   $0x8010bccd
+80107ce0:	e8 9b 8b ff ff       	call   80100880 <panic>
+80107ce5:	8d 76 00             	lea    0x0(%esi),%esi
+  r = lock->locked && lock->cpu == mycpu();
+80107ce8:	8b 73 08             	mov    0x8(%ebx),%esi
+80107ceb:	e8 80 e5 ff ff       	call   80106270 <mycpu>
+80107cf0:	39 c6                	cmp    %eax,%esi
+80107cf2:	75 df                	jne    80107cd3 <release+0x13>
+  popcli();
+80107cf4:	e8 27 ff ff ff       	call   80107c20 <popcli>
+  lk->pcs[0] = 0;
+80107cf9:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  lk->cpu = 0;
+80107d00:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  __sync_synchronize();
+80107d07:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+80107d0c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+}
+80107d12:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107d15:	5b                   	pop    %ebx
+80107d16:	5e                   	pop    %esi
+80107d17:	5d                   	pop    %ebp
+  popcli();
+80107d18:	e9 03 ff ff ff       	jmp    80107c20 <popcli>
+80107d1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107d20 <acquire>:
+{
+80107d20:	55                   	push   %ebp
+80107d21:	89 e5                	mov    %esp,%ebp
+80107d23:	53                   	push   %ebx
+80107d24:	83 ec 04             	sub    $0x4,%esp
+  pushcli(); // disable interrupts to avoid deadlock.
+80107d27:	e8 a4 fe ff ff       	call   80107bd0 <pushcli>
+  if(holding(lk))
+80107d2c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+80107d2f:	e8 9c fe ff ff       	call   80107bd0 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+80107d34:	8b 03                	mov    (%ebx),%eax
+80107d36:	85 c0                	test   %eax,%eax
+80107d38:	0f 85 9a 00 00 00    	jne    80107dd8 <acquire+0xb8>
+  popcli();
+80107d3e:	e8 dd fe ff ff       	call   80107c20 <popcli>
+  asm volatile("lock; xchgl %0, %1" :
+80107d43:	b9 01 00 00 00       	mov    $0x1,%ecx
+80107d48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107d4f:	90                   	nop
+  while(xchg(&lk->locked, 1) != 0)
+80107d50:	8b 55 08             	mov    0x8(%ebp),%edx
+80107d53:	89 c8                	mov    %ecx,%eax
+80107d55:	f0 87 02             	lock xchg %eax,(%edx)
+80107d58:	85 c0                	test   %eax,%eax
+80107d5a:	75 f4                	jne    80107d50 <acquire+0x30>
+  __sync_synchronize();
+80107d5c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  lk->cpu = mycpu();
+80107d61:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80107d64:	e8 07 e5 ff ff       	call   80106270 <mycpu>
+  getcallerpcs(&lk, lk->pcs);
+80107d69:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  for(i = 0; i < 10; i++){
+80107d6c:	31 d2                	xor    %edx,%edx
+  lk->cpu = mycpu();
+80107d6e:	89 43 08             	mov    %eax,0x8(%ebx)
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80107d71:	8d 85 00 00 00 80    	lea    -0x80000000(%ebp),%eax
+80107d77:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+80107d7c:	77 32                	ja     80107db0 <acquire+0x90>
+  ebp = (uint*)v - 2;
+80107d7e:	89 e8                	mov    %ebp,%eax
+80107d80:	eb 14                	jmp    80107d96 <acquire+0x76>
+80107d82:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+80107d88:	8d 98 00 00 00 80    	lea    -0x80000000(%eax),%ebx
+80107d8e:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+80107d94:	77 1a                	ja     80107db0 <acquire+0x90>
+    pcs[i] = ebp[1];     // saved %eip
+80107d96:	8b 58 04             	mov    0x4(%eax),%ebx
+80107d99:	89 5c 91 0c          	mov    %ebx,0xc(%ecx,%edx,4)
+  for(i = 0; i < 10; i++){
+80107d9d:	83 c2 01             	add    $0x1,%edx
+    ebp = (uint*)ebp[0]; // saved %ebp
+80107da0:	8b 00                	mov    (%eax),%eax
+  for(i = 0; i < 10; i++){
+80107da2:	83 fa 0a             	cmp    $0xa,%edx
+80107da5:	75 e1                	jne    80107d88 <acquire+0x68>
+}
+80107da7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107daa:	c9                   	leave
+80107dab:	c3                   	ret
+80107dac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107db0:	8d 44 91 0c          	lea    0xc(%ecx,%edx,4),%eax
+80107db4:	8d 51 34             	lea    0x34(%ecx),%edx
+80107db7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107dbe:	66 90                	xchg   %ax,%ax
+    pcs[i] = 0;
+80107dc0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(; i < 10; i++)
+80107dc6:	83 c0 04             	add    $0x4,%eax
+80107dc9:	39 c2                	cmp    %eax,%edx
+80107dcb:	75 f3                	jne    80107dc0 <acquire+0xa0>
+}
+80107dcd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107dd0:	c9                   	leave
+80107dd1:	c3                   	ret
+80107dd2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  r = lock->locked && lock->cpu == mycpu();
+80107dd8:	8b 5b 08             	mov    0x8(%ebx),%ebx
+80107ddb:	e8 90 e4 ff ff       	call   80106270 <mycpu>
+80107de0:	39 c3                	cmp    %eax,%ebx
+80107de2:	0f 85 56 ff ff ff    	jne    80107d3e <acquire+0x1e>
+  popcli();
+80107de8:	e8 33 fe ff ff       	call   80107c20 <popcli>
+    panic("acquire");
+80107ded:	83 ec 0c             	sub    $0xc,%esp
+80107df0:	68 d5 bc 10 80       	push   $0x8010bcd5
+80107df5:	e8 86 8a ff ff       	call   80100880 <panic>
+80107dfa:	66 90                	xchg   %ax,%ax
+80107dfc:	66 90                	xchg   %ax,%ax
+80107dfe:	66 90                	xchg   %ax,%ax
+
+80107e00 <memset>:
+#include "types.h"
+#include "x86.h"
+
+void*
+memset(void *dst, int c, uint n)
+{
+80107e00:	55                   	push   %ebp
+80107e01:	89 e5                	mov    %esp,%ebp
+80107e03:	57                   	push   %edi
+80107e04:	8b 55 08             	mov    0x8(%ebp),%edx
+80107e07:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  if ((int)dst%4 == 0 && n%4 == 0){
+80107e0a:	89 d0                	mov    %edx,%eax
+80107e0c:	09 c8                	or     %ecx,%eax
+80107e0e:	a8 03                	test   $0x3,%al
+80107e10:	75 1e                	jne    80107e30 <memset+0x30>
+    c &= 0xFF;
+80107e12:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+    stosl(dst, (c<<24)|(c<<16)|(c<<8)|c, n/4);
+80107e16:	c1 e9 02             	shr    $0x2,%ecx
+  asm volatile("cld; rep stosl" :
+80107e19:	89 d7                	mov    %edx,%edi
+80107e1b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+80107e21:	fc                   	cld
+80107e22:	f3 ab                	rep stos %eax,%es:(%edi)
+  } else
+    stosb(dst, c, n);
+  return dst;
+}
+80107e24:	8b 7d fc             	mov    -0x4(%ebp),%edi
+80107e27:	89 d0                	mov    %edx,%eax
+80107e29:	c9                   	leave
+80107e2a:	c3                   	ret
+80107e2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107e2f:	90                   	nop
+  asm volatile("cld; rep stosb" :
+80107e30:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107e33:	89 d7                	mov    %edx,%edi
+80107e35:	fc                   	cld
+80107e36:	f3 aa                	rep stos %al,%es:(%edi)
+80107e38:	8b 7d fc             	mov    -0x4(%ebp),%edi
+80107e3b:	89 d0                	mov    %edx,%eax
+80107e3d:	c9                   	leave
+80107e3e:	c3                   	ret
+80107e3f:	90                   	nop
+
+80107e40 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+80107e40:	55                   	push   %ebp
+80107e41:	89 e5                	mov    %esp,%ebp
+80107e43:	56                   	push   %esi
+80107e44:	53                   	push   %ebx
+80107e45:	8b 75 10             	mov    0x10(%ebp),%esi
+80107e48:	8b 55 08             	mov    0x8(%ebp),%edx
+80107e4b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+80107e4e:	85 f6                	test   %esi,%esi
+80107e50:	74 2e                	je     80107e80 <memcmp+0x40>
+80107e52:	01 c6                	add    %eax,%esi
+80107e54:	eb 14                	jmp    80107e6a <memcmp+0x2a>
+80107e56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107e5d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+80107e60:	83 c0 01             	add    $0x1,%eax
+80107e63:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+80107e66:	39 f0                	cmp    %esi,%eax
+80107e68:	74 16                	je     80107e80 <memcmp+0x40>
+    if(*s1 != *s2)
+80107e6a:	0f b6 0a             	movzbl (%edx),%ecx
+80107e6d:	0f b6 18             	movzbl (%eax),%ebx
+80107e70:	38 d9                	cmp    %bl,%cl
+80107e72:	74 ec                	je     80107e60 <memcmp+0x20>
+      return *s1 - *s2;
+80107e74:	0f b6 c1             	movzbl %cl,%eax
+80107e77:	29 d8                	sub    %ebx,%eax
+  }
+
+  return 0;
+}
+80107e79:	5b                   	pop    %ebx
+80107e7a:	5e                   	pop    %esi
+80107e7b:	5d                   	pop    %ebp
+80107e7c:	c3                   	ret
+80107e7d:	8d 76 00             	lea    0x0(%esi),%esi
+80107e80:	5b                   	pop    %ebx
+  return 0;
+80107e81:	31 c0                	xor    %eax,%eax
+}
+80107e83:	5e                   	pop    %esi
+80107e84:	5d                   	pop    %ebp
+80107e85:	c3                   	ret
+80107e86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107e8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107e90 <memmove>:
+
+void*
+memmove(void *dst, const void *src, uint n)
+{
+80107e90:	55                   	push   %ebp
+80107e91:	89 e5                	mov    %esp,%ebp
+80107e93:	57                   	push   %edi
+80107e94:	56                   	push   %esi
+80107e95:	8b 55 08             	mov    0x8(%ebp),%edx
+80107e98:	8b 75 0c             	mov    0xc(%ebp),%esi
+80107e9b:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if(s < d && s + n > d){
+80107e9e:	39 d6                	cmp    %edx,%esi
+80107ea0:	73 26                	jae    80107ec8 <memmove+0x38>
+80107ea2:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+80107ea5:	39 ca                	cmp    %ecx,%edx
+80107ea7:	73 1f                	jae    80107ec8 <memmove+0x38>
+    s += n;
+    d += n;
+    while(n-- > 0)
+80107ea9:	85 c0                	test   %eax,%eax
+80107eab:	74 0f                	je     80107ebc <memmove+0x2c>
+80107ead:	83 e8 01             	sub    $0x1,%eax
+      *--d = *--s;
+80107eb0:	0f b6 0c 06          	movzbl (%esi,%eax,1),%ecx
+80107eb4:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+    while(n-- > 0)
+80107eb7:	83 e8 01             	sub    $0x1,%eax
+80107eba:	73 f4                	jae    80107eb0 <memmove+0x20>
+  } else
+    while(n-- > 0)
+      *d++ = *s++;
+
+  return dst;
+}
+80107ebc:	5e                   	pop    %esi
+80107ebd:	89 d0                	mov    %edx,%eax
+80107ebf:	5f                   	pop    %edi
+80107ec0:	5d                   	pop    %ebp
+80107ec1:	c3                   	ret
+80107ec2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    while(n-- > 0)
+80107ec8:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+80107ecb:	89 d7                	mov    %edx,%edi
+80107ecd:	85 c0                	test   %eax,%eax
+80107ecf:	74 eb                	je     80107ebc <memmove+0x2c>
+80107ed1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      *d++ = *s++;
+80107ed8:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+    while(n-- > 0)
+80107ed9:	39 ce                	cmp    %ecx,%esi
+80107edb:	75 fb                	jne    80107ed8 <memmove+0x48>
+}
+80107edd:	5e                   	pop    %esi
+80107ede:	89 d0                	mov    %edx,%eax
+80107ee0:	5f                   	pop    %edi
+80107ee1:	5d                   	pop    %ebp
+80107ee2:	c3                   	ret
+80107ee3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107eea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107ef0 <memcpy>:
+
+// memcpy exists to placate GCC.  Use memmove.
+void*
+memcpy(void *dst, const void *src, uint n)
+{
+  return memmove(dst, src, n);
+80107ef0:	eb 9e                	jmp    80107e90 <memmove>
+80107ef2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107ef9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107f00 <strncmp>:
+}
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+80107f00:	55                   	push   %ebp
+80107f01:	89 e5                	mov    %esp,%ebp
+80107f03:	53                   	push   %ebx
+80107f04:	8b 55 10             	mov    0x10(%ebp),%edx
+80107f07:	8b 45 08             	mov    0x8(%ebp),%eax
+80107f0a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(n > 0 && *p && *p == *q)
+80107f0d:	85 d2                	test   %edx,%edx
+80107f0f:	75 16                	jne    80107f27 <strncmp+0x27>
+80107f11:	eb 2d                	jmp    80107f40 <strncmp+0x40>
+80107f13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107f17:	90                   	nop
+80107f18:	3a 19                	cmp    (%ecx),%bl
+80107f1a:	75 12                	jne    80107f2e <strncmp+0x2e>
+    n--, p++, q++;
+80107f1c:	83 c0 01             	add    $0x1,%eax
+80107f1f:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+80107f22:	83 ea 01             	sub    $0x1,%edx
+80107f25:	74 19                	je     80107f40 <strncmp+0x40>
+80107f27:	0f b6 18             	movzbl (%eax),%ebx
+80107f2a:	84 db                	test   %bl,%bl
+80107f2c:	75 ea                	jne    80107f18 <strncmp+0x18>
+  if(n == 0)
+    return 0;
+  return (uchar)*p - (uchar)*q;
+80107f2e:	0f b6 00             	movzbl (%eax),%eax
+80107f31:	0f b6 11             	movzbl (%ecx),%edx
+}
+80107f34:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107f37:	c9                   	leave
+  return (uchar)*p - (uchar)*q;
+80107f38:	29 d0                	sub    %edx,%eax
+}
+80107f3a:	c3                   	ret
+80107f3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107f3f:	90                   	nop
+80107f40:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+80107f43:	31 c0                	xor    %eax,%eax
+}
+80107f45:	c9                   	leave
+80107f46:	c3                   	ret
+80107f47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107f4e:	66 90                	xchg   %ax,%ax
+
+80107f50 <strncpy>:
+
+char*
+strncpy(char *s, const char *t, int n)
+{
+80107f50:	55                   	push   %ebp
+80107f51:	89 e5                	mov    %esp,%ebp
+80107f53:	57                   	push   %edi
+80107f54:	56                   	push   %esi
+80107f55:	53                   	push   %ebx
+80107f56:	8b 75 08             	mov    0x8(%ebp),%esi
+80107f59:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *os;
+
+  os = s;
+  while(n-- > 0 && (*s++ = *t++) != 0)
+80107f5c:	89 f0                	mov    %esi,%eax
+80107f5e:	eb 15                	jmp    80107f75 <strncpy+0x25>
+80107f60:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+80107f64:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80107f67:	83 c0 01             	add    $0x1,%eax
+80107f6a:	0f b6 4f ff          	movzbl -0x1(%edi),%ecx
+80107f6e:	88 48 ff             	mov    %cl,-0x1(%eax)
+80107f71:	84 c9                	test   %cl,%cl
+80107f73:	74 13                	je     80107f88 <strncpy+0x38>
+80107f75:	89 d3                	mov    %edx,%ebx
+80107f77:	83 ea 01             	sub    $0x1,%edx
+80107f7a:	85 db                	test   %ebx,%ebx
+80107f7c:	7f e2                	jg     80107f60 <strncpy+0x10>
+    ;
+  while(n-- > 0)
+    *s++ = 0;
+  return os;
+}
+80107f7e:	5b                   	pop    %ebx
+80107f7f:	89 f0                	mov    %esi,%eax
+80107f81:	5e                   	pop    %esi
+80107f82:	5f                   	pop    %edi
+80107f83:	5d                   	pop    %ebp
+80107f84:	c3                   	ret
+80107f85:	8d 76 00             	lea    0x0(%esi),%esi
+  while(n-- > 0)
+80107f88:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+80107f8b:	83 e9 01             	sub    $0x1,%ecx
+80107f8e:	85 d2                	test   %edx,%edx
+80107f90:	74 ec                	je     80107f7e <strncpy+0x2e>
+80107f92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *s++ = 0;
+80107f98:	83 c0 01             	add    $0x1,%eax
+80107f9b:	89 ca                	mov    %ecx,%edx
+80107f9d:	c6 40 ff 00          	movb   $0x0,-0x1(%eax)
+  while(n-- > 0)
+80107fa1:	29 c2                	sub    %eax,%edx
+80107fa3:	85 d2                	test   %edx,%edx
+80107fa5:	7f f1                	jg     80107f98 <strncpy+0x48>
+}
+80107fa7:	5b                   	pop    %ebx
+80107fa8:	89 f0                	mov    %esi,%eax
+80107faa:	5e                   	pop    %esi
+80107fab:	5f                   	pop    %edi
+80107fac:	5d                   	pop    %ebp
+80107fad:	c3                   	ret
+80107fae:	66 90                	xchg   %ax,%ax
+
+80107fb0 <safestrcpy>:
+
+// Like strncpy but guaranteed to NUL-terminate.
+char*
+safestrcpy(char *s, const char *t, int n)
+{
+80107fb0:	55                   	push   %ebp
+80107fb1:	89 e5                	mov    %esp,%ebp
+80107fb3:	56                   	push   %esi
+80107fb4:	53                   	push   %ebx
+80107fb5:	8b 55 10             	mov    0x10(%ebp),%edx
+80107fb8:	8b 75 08             	mov    0x8(%ebp),%esi
+80107fbb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  char *os;
+
+  os = s;
+  if(n <= 0)
+80107fbe:	85 d2                	test   %edx,%edx
+80107fc0:	7e 25                	jle    80107fe7 <safestrcpy+0x37>
+80107fc2:	8d 5c 10 ff          	lea    -0x1(%eax,%edx,1),%ebx
+80107fc6:	89 f2                	mov    %esi,%edx
+80107fc8:	eb 16                	jmp    80107fe0 <safestrcpy+0x30>
+80107fca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return os;
+  while(--n > 0 && (*s++ = *t++) != 0)
+80107fd0:	0f b6 08             	movzbl (%eax),%ecx
+80107fd3:	83 c0 01             	add    $0x1,%eax
+80107fd6:	83 c2 01             	add    $0x1,%edx
+80107fd9:	88 4a ff             	mov    %cl,-0x1(%edx)
+80107fdc:	84 c9                	test   %cl,%cl
+80107fde:	74 04                	je     80107fe4 <safestrcpy+0x34>
+80107fe0:	39 d8                	cmp    %ebx,%eax
+80107fe2:	75 ec                	jne    80107fd0 <safestrcpy+0x20>
+    ;
+  *s = 0;
+80107fe4:	c6 02 00             	movb   $0x0,(%edx)
+  return os;
+}
+80107fe7:	89 f0                	mov    %esi,%eax
+80107fe9:	5b                   	pop    %ebx
+80107fea:	5e                   	pop    %esi
+80107feb:	5d                   	pop    %ebp
+80107fec:	c3                   	ret
+80107fed:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107ff0 <strlen>:
+
+int
+strlen(const char *s)
+{
+80107ff0:	55                   	push   %ebp
+  int n;
+
+  for(n = 0; s[n]; n++)
+80107ff1:	31 c0                	xor    %eax,%eax
+{
+80107ff3:	89 e5                	mov    %esp,%ebp
+80107ff5:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+80107ff8:	80 3a 00             	cmpb   $0x0,(%edx)
+80107ffb:	74 0c                	je     80108009 <strlen+0x19>
+80107ffd:	8d 76 00             	lea    0x0(%esi),%esi
+80108000:	83 c0 01             	add    $0x1,%eax
+80108003:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+80108007:	75 f7                	jne    80108000 <strlen+0x10>
+    ;
+  return n;
+}
+80108009:	5d                   	pop    %ebp
+8010800a:	c3                   	ret
+
+8010800b <swtch>:
+# a struct context, and save its address in *old.
+# Switch stacks to new and pop previously-saved registers.
+
+.globl swtch
+swtch:
+  movl 4(%esp), %eax
+8010800b:	8b 44 24 04          	mov    0x4(%esp),%eax
+  movl 8(%esp), %edx
+8010800f:	8b 54 24 08          	mov    0x8(%esp),%edx
+
+  # Save old callee-saved registers
+  pushl %ebp
+80108013:	55                   	push   %ebp
+  pushl %ebx
+80108014:	53                   	push   %ebx
+  pushl %esi
+80108015:	56                   	push   %esi
+  pushl %edi
+80108016:	57                   	push   %edi
+
+  # Switch stacks
+  movl %esp, (%eax)
+80108017:	89 20                	mov    %esp,(%eax)
+  movl %edx, %esp
+80108019:	89 d4                	mov    %edx,%esp
+
+  # Load new callee-saved registers
+  popl %edi
+8010801b:	5f                   	pop    %edi
+  popl %esi
+8010801c:	5e                   	pop    %esi
+  popl %ebx
+8010801d:	5b                   	pop    %ebx
+  popl %ebp
+8010801e:	5d                   	pop    %ebp
+  ret
+8010801f:	c3                   	ret
+
+80108020 <fetchint>:
+// to a saved program counter, and then the first argument.
+
+// Fetch the int at addr from the current process.
+int
+fetchint(uint addr, int *ip)
+{
+80108020:	55                   	push   %ebp
+80108021:	89 e5                	mov    %esp,%ebp
+80108023:	53                   	push   %ebx
+80108024:	83 ec 04             	sub    $0x4,%esp
+80108027:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *curproc = myproc();
+8010802a:	e8 21 e5 ff ff       	call   80106550 <myproc>
+
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+8010802f:	8b 10                	mov    (%eax),%edx
+80108031:	39 d3                	cmp    %edx,%ebx
+80108033:	73 2b                	jae    80108060 <fetchint+0x40>
+80108035:	8d 4b 04             	lea    0x4(%ebx),%ecx
+80108038:	39 ca                	cmp    %ecx,%edx
+8010803a:	72 24                	jb     80108060 <fetchint+0x40>
+    return -1;
+  if(lazyfill(curproc->pgdir, curproc->sz, addr, 4) < 0)
+8010803c:	6a 04                	push   $0x4
+8010803e:	53                   	push   %ebx
+8010803f:	52                   	push   %edx
+80108040:	ff 70 04             	push   0x4(%eax)
+80108043:	e8 68 31 00 00       	call   8010b1b0 <lazyfill>
+80108048:	83 c4 10             	add    $0x10,%esp
+8010804b:	85 c0                	test   %eax,%eax
+8010804d:	78 11                	js     80108060 <fetchint+0x40>
+    return -1;
+  *ip = *(int*)(addr);
+8010804f:	8b 45 0c             	mov    0xc(%ebp),%eax
+80108052:	8b 13                	mov    (%ebx),%edx
+80108054:	89 10                	mov    %edx,(%eax)
+  return 0;
+80108056:	31 c0                	xor    %eax,%eax
+}
+80108058:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010805b:	c9                   	leave
+8010805c:	c3                   	ret
+8010805d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80108060:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108065:	eb f1                	jmp    80108058 <fetchint+0x38>
+80108067:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010806e:	66 90                	xchg   %ax,%ax
+
+80108070 <fetchstr>:
+// Fetch the nul-terminated string at addr from the current process.
+// Doesn't actually copy the string - just sets *pp to point at it.
+// Returns length of string, not including nul.
+int
+fetchstr(uint addr, char **pp)
+{
+80108070:	55                   	push   %ebp
+80108071:	89 e5                	mov    %esp,%ebp
+80108073:	57                   	push   %edi
+80108074:	56                   	push   %esi
+80108075:	53                   	push   %ebx
+80108076:	83 ec 0c             	sub    $0xc,%esp
+80108079:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  char *s, *ep;
+  struct proc *curproc = myproc();
+8010807c:	e8 cf e4 ff ff       	call   80106550 <myproc>
+
+  if(addr >= curproc->sz)
+80108081:	3b 18                	cmp    (%eax),%ebx
+80108083:	73 5b                	jae    801080e0 <fetchstr+0x70>
+80108085:	89 c6                	mov    %eax,%esi
+    return -1;
+  *pp = (char*)addr;
+80108087:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010808a:	89 18                	mov    %ebx,(%eax)
+  ep = (char*)curproc->sz;
+8010808c:	8b 3e                	mov    (%esi),%edi
+  for(s = *pp; s < ep; s++){
+8010808e:	39 fb                	cmp    %edi,%ebx
+80108090:	73 4e                	jae    801080e0 <fetchstr+0x70>
+80108092:	89 d8                	mov    %ebx,%eax
+80108094:	eb 16                	jmp    801080ac <fetchstr+0x3c>
+80108096:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010809d:	8d 76 00             	lea    0x0(%esi),%esi
+801080a0:	83 c3 01             	add    $0x1,%ebx
+801080a3:	39 fb                	cmp    %edi,%ebx
+801080a5:	73 39                	jae    801080e0 <fetchstr+0x70>
+    if((s == *pp || (uint)s % PGSIZE == 0) &&
+       lazyfill(curproc->pgdir, curproc->sz, (uint)s, 1) < 0)
+      return -1;
+    if(*s == 0)
+      return s - *pp;
+801080a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+801080aa:	8b 00                	mov    (%eax),%eax
+    if((s == *pp || (uint)s % PGSIZE == 0) &&
+801080ac:	39 d8                	cmp    %ebx,%eax
+801080ae:	74 08                	je     801080b8 <fetchstr+0x48>
+801080b0:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+801080b6:	75 14                	jne    801080cc <fetchstr+0x5c>
+       lazyfill(curproc->pgdir, curproc->sz, (uint)s, 1) < 0)
+801080b8:	6a 01                	push   $0x1
+801080ba:	53                   	push   %ebx
+801080bb:	ff 36                	push   (%esi)
+801080bd:	ff 76 04             	push   0x4(%esi)
+801080c0:	e8 eb 30 00 00       	call   8010b1b0 <lazyfill>
+    if((s == *pp || (uint)s % PGSIZE == 0) &&
+801080c5:	83 c4 10             	add    $0x10,%esp
+801080c8:	85 c0                	test   %eax,%eax
+801080ca:	78 14                	js     801080e0 <fetchstr+0x70>
+    if(*s == 0)
+801080cc:	80 3b 00             	cmpb   $0x0,(%ebx)
+801080cf:	75 cf                	jne    801080a0 <fetchstr+0x30>
+      return s - *pp;
+801080d1:	8b 55 0c             	mov    0xc(%ebp),%edx
+801080d4:	89 d8                	mov    %ebx,%eax
+801080d6:	2b 02                	sub    (%edx),%eax
+  }
+  return -1;
+}
+801080d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801080db:	5b                   	pop    %ebx
+801080dc:	5e                   	pop    %esi
+801080dd:	5f                   	pop    %edi
+801080de:	5d                   	pop    %ebp
+801080df:	c3                   	ret
+801080e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+801080e3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801080e8:	5b                   	pop    %ebx
+801080e9:	5e                   	pop    %esi
+801080ea:	5f                   	pop    %edi
+801080eb:	5d                   	pop    %ebp
+801080ec:	c3                   	ret
+801080ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+801080f0 <argint>:
+
+// Fetch the nth 32-bit system call argument.
+int
+argint(int n, int *ip)
+{
+801080f0:	55                   	push   %ebp
+801080f1:	89 e5                	mov    %esp,%ebp
+801080f3:	56                   	push   %esi
+801080f4:	53                   	push   %ebx
+801080f5:	8b 75 0c             	mov    0xc(%ebp),%esi
+801080f8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+801080fb:	e8 50 e4 ff ff       	call   80106550 <myproc>
+80108100:	89 75 0c             	mov    %esi,0xc(%ebp)
+80108103:	8b 40 28             	mov    0x28(%eax),%eax
+80108106:	8b 40 44             	mov    0x44(%eax),%eax
+80108109:	8d 44 98 04          	lea    0x4(%eax,%ebx,4),%eax
+8010810d:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80108110:	5b                   	pop    %ebx
+80108111:	5e                   	pop    %esi
+80108112:	5d                   	pop    %ebp
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80108113:	e9 08 ff ff ff       	jmp    80108020 <fetchint>
+80108118:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010811f:	90                   	nop
+
+80108120 <argptr>:
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+80108120:	55                   	push   %ebp
+80108121:	89 e5                	mov    %esp,%ebp
+80108123:	57                   	push   %edi
+80108124:	56                   	push   %esi
+80108125:	53                   	push   %ebx
+80108126:	83 ec 1c             	sub    $0x1c,%esp
+80108129:	8b 7d 10             	mov    0x10(%ebp),%edi
+  int i;
+  struct proc *curproc = myproc();
+8010812c:	e8 1f e4 ff ff       	call   80106550 <myproc>
+80108131:	89 c3                	mov    %eax,%ebx
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80108133:	e8 18 e4 ff ff       	call   80106550 <myproc>
+80108138:	83 ec 08             	sub    $0x8,%esp
+8010813b:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+8010813e:	52                   	push   %edx
+8010813f:	8b 40 28             	mov    0x28(%eax),%eax
+80108142:	8b 55 08             	mov    0x8(%ebp),%edx
+80108145:	8b 40 44             	mov    0x44(%eax),%eax
+80108148:	8d 44 90 04          	lea    0x4(%eax,%edx,4),%eax
+8010814c:	50                   	push   %eax
+8010814d:	e8 ce fe ff ff       	call   80108020 <fetchint>
+ 
+  if(argint(n, &i) < 0)
+    return -1;
+  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+80108152:	83 c4 10             	add    $0x10,%esp
+80108155:	09 f8                	or     %edi,%eax
+80108157:	78 37                	js     80108190 <argptr+0x70>
+80108159:	8b 03                	mov    (%ebx),%eax
+8010815b:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+8010815e:	39 c6                	cmp    %eax,%esi
+80108160:	73 2e                	jae    80108190 <argptr+0x70>
+80108162:	8d 14 3e             	lea    (%esi,%edi,1),%edx
+80108165:	39 d0                	cmp    %edx,%eax
+80108167:	72 27                	jb     80108190 <argptr+0x70>
+    return -1;
+  if(lazyfill(curproc->pgdir, curproc->sz, i, size) < 0)
+80108169:	57                   	push   %edi
+8010816a:	56                   	push   %esi
+8010816b:	50                   	push   %eax
+8010816c:	ff 73 04             	push   0x4(%ebx)
+8010816f:	e8 3c 30 00 00       	call   8010b1b0 <lazyfill>
+80108174:	83 c4 10             	add    $0x10,%esp
+80108177:	85 c0                	test   %eax,%eax
+80108179:	78 15                	js     80108190 <argptr+0x70>
+    return -1;
+  *pp = (char*)i;
+8010817b:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010817e:	89 30                	mov    %esi,(%eax)
+  return 0;
+80108180:	31 c0                	xor    %eax,%eax
+}
+80108182:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108185:	5b                   	pop    %ebx
+80108186:	5e                   	pop    %esi
+80108187:	5f                   	pop    %edi
+80108188:	5d                   	pop    %ebp
+80108189:	c3                   	ret
+8010818a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+80108190:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108195:	eb eb                	jmp    80108182 <argptr+0x62>
+80108197:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010819e:	66 90                	xchg   %ax,%ax
+
+801081a0 <argwptr>:
+// Like argptr, for a block of memory the system call is going
+// to write. Breaks copy-on-write sharing up front, so that a
+// failed copy makes the call fail rather than the kernel fault.
+int
+argwptr(int n, char **pp, int size)
+{
+801081a0:	55                   	push   %ebp
+801081a1:	89 e5                	mov    %esp,%ebp
+801081a3:	56                   	push   %esi
+801081a4:	53                   	push   %ebx
+801081a5:	8b 75 0c             	mov    0xc(%ebp),%esi
+801081a8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(argptr(n, pp, size) < 0)
+801081ab:	83 ec 04             	sub    $0x4,%esp
+801081ae:	53                   	push   %ebx
+801081af:	56                   	push   %esi
+801081b0:	ff 75 08             	push   0x8(%ebp)
+801081b3:	e8 68 ff ff ff       	call   80108120 <argptr>
+801081b8:	83 c4 10             	add    $0x10,%esp
+801081bb:	85 c0                	test   %eax,%eax
+801081bd:	78 21                	js     801081e0 <argwptr+0x40>
+    return -1;
+  return cowbreak(myproc()->pgdir, (uint)*pp, size);
+801081bf:	8b 36                	mov    (%esi),%esi
+801081c1:	e8 8a e3 ff ff       	call   80106550 <myproc>
+801081c6:	89 5d 10             	mov    %ebx,0x10(%ebp)
+801081c9:	89 75 0c             	mov    %esi,0xc(%ebp)
+801081cc:	8b 40 04             	mov    0x4(%eax),%eax
+801081cf:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+801081d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801081d5:	5b                   	pop    %ebx
+801081d6:	5e                   	pop    %esi
+801081d7:	5d                   	pop    %ebp
+  return cowbreak(myproc()->pgdir, (uint)*pp, size);
+801081d8:	e9 93 2e 00 00       	jmp    8010b070 <cowbreak>
+801081dd:	8d 76 00             	lea    0x0(%esi),%esi
+}
+801081e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801081e3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801081e8:	5b                   	pop    %ebx
+801081e9:	5e                   	pop    %esi
+801081ea:	5d                   	pop    %ebp
+801081eb:	c3                   	ret
+801081ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801081f0 <argstr>:
+// Check that the pointer is valid and the string is nul-terminated.
+// (There is no shared writable memory, so the string can't change
+// between this check and being used by the kernel.)
+int
+argstr(int n, char **pp)
+{
+801081f0:	55                   	push   %ebp
+801081f1:	89 e5                	mov    %esp,%ebp
+801081f3:	56                   	push   %esi
+801081f4:	53                   	push   %ebx
+801081f5:	83 ec 10             	sub    $0x10,%esp
+801081f8:	8b 75 08             	mov    0x8(%ebp),%esi
+801081fb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+801081fe:	e8 4d e3 ff ff       	call   80106550 <myproc>
+80108203:	83 ec 08             	sub    $0x8,%esp
+80108206:	8d 55 f4             	lea    -0xc(%ebp),%edx
+80108209:	52                   	push   %edx
+8010820a:	8b 40 28             	mov    0x28(%eax),%eax
+8010820d:	8b 40 44             	mov    0x44(%eax),%eax
+80108210:	8d 44 b0 04          	lea    0x4(%eax,%esi,4),%eax
+80108214:	50                   	push   %eax
+80108215:	e8 06 fe ff ff       	call   80108020 <fetchint>
+  int addr;
+  if(argint(n, &addr) < 0)
+8010821a:	83 c4 10             	add    $0x10,%esp
+8010821d:	85 c0                	test   %eax,%eax
+8010821f:	78 17                	js     80108238 <argstr+0x48>
+    return -1;
+  return fetchstr(addr, pp);
+80108221:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108224:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+80108227:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+8010822a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010822d:	5b                   	pop    %ebx
+8010822e:	5e                   	pop    %esi
+8010822f:	5d                   	pop    %ebp
+  return fetchstr(addr, pp);
+80108230:	e9 3b fe ff ff       	jmp    80108070 <fetchstr>
+80108235:	8d 76 00             	lea    0x0(%esi),%esi
+}
+80108238:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010823b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108240:	5b                   	pop    %ebx
+80108241:	5e                   	pop    %esi
+80108242:	5d                   	pop    %ebp
+80108243:	c3                   	ret
+80108244:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010824b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010824f:	90                   	nop
+
+80108250 <syscall>:
+[SYS_transfer] sys_transfer,
+};
+
+void
+syscall(void)
+{
+80108250:	55                   	push   %ebp
+80108251:	89 e5                	mov    %esp,%ebp
+80108253:	53                   	push   %ebx
+80108254:	83 ec 04             	sub    $0x4,%esp
+  int num;
+  struct proc *curproc = myproc();
+80108257:	e8 f4 e2 ff ff       	call   80106550 <myproc>
+8010825c:	89 c3                	mov    %eax,%ebx
+
+  num = curproc->tf->eax;
+8010825e:	8b 40 28             	mov    0x28(%eax),%eax
+80108261:	8b 40 1c             	mov    0x1c(%eax),%eax
+  if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+80108264:	8d 50 ff             	lea    -0x1(%eax),%edx
+80108267:	83 fa 1b             	cmp    $0x1b,%edx
+8010826a:	77 24                	ja     80108290 <syscall+0x40>
+8010826c:	8b 14 85 00 bd 10 80 	mov    -0x7fef4300(,%eax,4),%edx
+80108273:	85 d2                	test   %edx,%edx
+80108275:	74 19                	je     80108290 <syscall+0x40>
+    curproc->tf->eax = syscalls[num]();
+80108277:	ff d2                	call   *%edx
+80108279:	89 c2                	mov    %eax,%edx
+8010827b:	8b 43 28             	mov    0x28(%ebx),%eax
+8010827e:	89 50 1c             	mov    %edx,0x1c(%eax)
+  } else {
+    cprintf("%d %s: unknown sys call %d\n",
+            curproc->pid, curproc->name, num);
+    curproc->tf->eax = -1;
+  }
+}
+80108281:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108284:	c9                   	leave
+80108285:	c3                   	ret
+80108286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010828d:	8d 76 00             	lea    0x0(%esi),%esi
+    cprintf("%d %s: unknown sys call %d\n",
+80108290:	50                   	push   %eax
+            curproc->pid, curproc->name, num);
+80108291:	8d 83 88 00 00 00    	lea    0x88(%ebx),%eax
+    cprintf("%d %s: unknown sys call %d\n",
+80108297:	50                   	push   %eax
+80108298:	ff 73 10             	push   0x10(%ebx)
+8010829b:	68 dd bc 10 80       	push   $0x8010bcdd
+801082a0:	e8 0b 89 ff ff       	call   80100bb0 <cprintf>
+    curproc->tf->eax = -1;
+801082a5:	8b 43 28             	mov    0x28(%ebx),%eax
+801082a8:	83 c4 10             	add    $0x10,%esp
+801082ab:	c7 40 1c ff ff ff ff 	movl   $0xffffffff,0x1c(%eax)
+}
+801082b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801082b5:	c9                   	leave
+801082b6:	c3                   	ret
+801082b7:	66 90                	xchg   %ax,%ax
+801082b9:	66 90                	xchg   %ax,%ax
+801082bb:	66 90                	xchg   %ax,%ax
+801082bd:	66 90                	xchg   %ax,%ax
+801082bf:	90                   	nop
+
+801082c0 <create>:
+  return -1;
+}
+
+static struct inode*
+create(char *path, short type, short major, short minor)
+{
+801082c0:	55                   	push   %ebp
+801082c1:	89 e5                	mov    %esp,%ebp
+801082c3:	57                   	push   %edi
+801082c4:	56                   	push   %esi
+  struct inode *ip, *dp;
+  char name[DIRSIZ];
+
+  if((dp = nameiparent(path, name)) == 0)
+801082c5:	8d 7d da             	lea    -0x26(%ebp),%edi
+{
+801082c8:	53                   	push   %ebx
+801082c9:	83 ec 34             	sub    $0x34,%esp
+801082cc:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+801082cf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+801082d2:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+801082d5:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if((dp = nameiparent(path, name)) == 0)
+801082d8:	57                   	push   %edi
+801082d9:	50                   	push   %eax
+801082da:	e8 41 b3 ff ff       	call   80103620 <nameiparent>
+801082df:	83 c4 10             	add    $0x10,%esp
+801082e2:	85 c0                	test   %eax,%eax
+801082e4:	74 5e                	je     80108344 <create+0x84>
+    return 0;
+  ilock(dp);
+801082e6:	83 ec 0c             	sub    $0xc,%esp
+801082e9:	89 c3                	mov    %eax,%ebx
+801082eb:	50                   	push   %eax
+801082ec:	e8 6f a5 ff ff       	call   80102860 <ilock>
+
+  if((ip = dirlookup(dp, name, 0)) != 0){
+801082f1:	83 c4 0c             	add    $0xc,%esp
+801082f4:	6a 00                	push   $0x0
+801082f6:	57                   	push   %edi
+801082f7:	53                   	push   %ebx
+801082f8:	e8 b3 ab ff ff       	call   80102eb0 <dirlookup>
+801082fd:	83 c4 10             	add    $0x10,%esp
+80108300:	89 c6                	mov    %eax,%esi
+80108302:	85 c0                	test   %eax,%eax
+80108304:	74 4a                	je     80108350 <create+0x90>
+    iunlockput(dp);
+80108306:	83 ec 0c             	sub    $0xc,%esp
+80108309:	53                   	push   %ebx
+8010830a:	e8 41 a8 ff ff       	call   80102b50 <iunlockput>
+    ilock(ip);
+8010830f:	89 34 24             	mov    %esi,(%esp)
+80108312:	e8 49 a5 ff ff       	call   80102860 <ilock>
+    if(type == T_FILE && ip->type == T_FILE)
+80108317:	83 c4 10             	add    $0x10,%esp
+8010831a:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+8010831f:	75 17                	jne    80108338 <create+0x78>
+80108321:	66 83 7e 60 02       	cmpw   $0x2,0x60(%esi)
+80108326:	75 10                	jne    80108338 <create+0x78>
+  }
+
+  iunlockput(dp);
+
+  return ip;
+}
+80108328:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010832b:	89 f0                	mov    %esi,%eax
+8010832d:	5b                   	pop    %ebx
+8010832e:	5e                   	pop    %esi
+8010832f:	5f                   	pop    %edi
+80108330:	5d                   	pop    %ebp
+80108331:	c3                   	ret
+80108332:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iunlockput(ip);
+80108338:	83 ec 0c             	sub    $0xc,%esp
+8010833b:	56                   	push   %esi
+8010833c:	e8 0f a8 ff ff       	call   80102b50 <iunlockput>
+    return 0;
+80108341:	83 c4 10             	add    $0x10,%esp
+    return 0;
+80108344:	31 f6                	xor    %esi,%esi
+}
+80108346:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108349:	89 f0                	mov    %esi,%eax
+8010834b:	5b                   	pop    %ebx
+8010834c:	5e                   	pop    %esi
+8010834d:	5f                   	pop    %edi
+8010834e:	5d                   	pop    %ebp
+8010834f:	c3                   	ret
+  if((ip = ialloc(dp->dev, type)) == 0)
+80108350:	0f bf 45 d4          	movswl -0x2c(%ebp),%eax
+80108354:	83 ec 08             	sub    $0x8,%esp
+80108357:	50                   	push   %eax
+80108358:	ff 33                	push   (%ebx)
+8010835a:	e8 21 9f ff ff       	call   80102280 <ialloc>
+8010835f:	83 c4 10             	add    $0x10,%esp
+80108362:	89 c6                	mov    %eax,%esi
+80108364:	85 c0                	test   %eax,%eax
+80108366:	0f 84 fd 00 00 00    	je     80108469 <create+0x1a9>
+  ilock(ip);
+8010836c:	83 ec 0c             	sub    $0xc,%esp
+8010836f:	50                   	push   %eax
+80108370:	e8 eb a4 ff ff       	call   80102860 <ilock>
+  ip->major = major;
+80108375:	0f b7 45 d0          	movzwl -0x30(%ebp),%eax
+  ip->nlink = 1;
+80108379:	ba 01 00 00 00       	mov    $0x1,%edx
+8010837e:	66 89 56 66          	mov    %dx,0x66(%esi)
+  ip->major = major;
+80108382:	66 89 46 62          	mov    %ax,0x62(%esi)
+  ip->minor = minor;
+80108386:	0f b7 45 cc          	movzwl -0x34(%ebp),%eax
+8010838a:	66 89 46 64          	mov    %ax,0x64(%esi)
+  iupdate(ip);
+8010838e:	89 34 24             	mov    %esi,(%esp)
+80108391:	e8 aa 9f ff ff       	call   80102340 <iupdate>
+  if(type == T_DIR){  // Create . and .. entries.
+80108396:	83 c4 10             	add    $0x10,%esp
+80108399:	66 83 7d d4 01       	cmpw   $0x1,-0x2c(%ebp)
+8010839e:	74 30                	je     801083d0 <create+0x110>
+  if(dirlink(dp, name, ip->inum) < 0){
+801083a0:	83 ec 04             	sub    $0x4,%esp
+801083a3:	ff 76 04             	push   0x4(%esi)
+801083a6:	57                   	push   %edi
+801083a7:	53                   	push   %ebx
+801083a8:	e8 d3 af ff ff       	call   80103380 <dirlink>
+801083ad:	83 c4 10             	add    $0x10,%esp
+801083b0:	85 c0                	test   %eax,%eax
+801083b2:	78 7f                	js     80108433 <create+0x173>
+  iunlockput(dp);
+801083b4:	83 ec 0c             	sub    $0xc,%esp
+801083b7:	53                   	push   %ebx
+801083b8:	e8 93 a7 ff ff       	call   80102b50 <iunlockput>
+  return ip;
+801083bd:	83 c4 10             	add    $0x10,%esp
+}
+801083c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801083c3:	89 f0                	mov    %esi,%eax
+801083c5:	5b                   	pop    %ebx
+801083c6:	5e                   	pop    %esi
+801083c7:	5f                   	pop    %edi
+801083c8:	5d                   	pop    %ebp
+801083c9:	c3                   	ret
+801083ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iupdate(dp);
+801083d0:	83 ec 0c             	sub    $0xc,%esp
+    dp->nlink++;  // for ".."
+801083d3:	66 83 43 66 01       	addw   $0x1,0x66(%ebx)
+    iupdate(dp);
+801083d8:	53                   	push   %ebx
+801083d9:	e8 62 9f ff ff       	call   80102340 <iupdate>
+    if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
+801083de:	83 c4 0c             	add    $0xc,%esp
+801083e1:	ff 76 04             	push   0x4(%esi)
+801083e4:	68 90 bd 10 80       	push   $0x8010bd90
+801083e9:	56                   	push   %esi
+801083ea:	e8 91 af ff ff       	call   80103380 <dirlink>
+801083ef:	83 c4 10             	add    $0x10,%esp
+801083f2:	85 c0                	test   %eax,%eax
+801083f4:	78 66                	js     8010845c <create+0x19c>
+801083f6:	83 ec 04             	sub    $0x4,%esp
+801083f9:	ff 73 04             	push   0x4(%ebx)
+801083fc:	68 8f bd 10 80       	push   $0x8010bd8f
+80108401:	56                   	push   %esi
+80108402:	e8 79 af ff ff       	call   80103380 <dirlink>
+80108407:	83 c4 10             	add    $0x10,%esp
+8010840a:	85 c0                	test   %eax,%eax
+8010840c:	78 4e                	js     8010845c <create+0x19c>
+  if(dirlink(dp, name, ip->inum) < 0){
+8010840e:	83 ec 04             	sub    $0x4,%esp
+80108411:	ff 76 04             	push   0x4(%esi)
+80108414:	57                   	push   %edi
+80108415:	53                   	push   %ebx
+80108416:	e8 65 af ff ff       	call   80103380 <dirlink>
+8010841b:	83 c4 10             	add    $0x10,%esp
+8010841e:	85 c0                	test   %eax,%eax
+80108420:	79 92                	jns    801083b4 <create+0xf4>
+      iupdate(dp);
+80108422:	83 ec 0c             	sub    $0xc,%esp
+      dp->nlink--;
+80108425:	66 83 6b 66 01       	subw   $0x1,0x66(%ebx)
+      iupdate(dp);
+8010842a:	53                   	push   %ebx
+8010842b:	e8 10 9f ff ff       	call   80102340 <iupdate>
+80108430:	83 c4 10             	add    $0x10,%esp
+    iupdate(ip);
+80108433:	83 ec 0c             	sub    $0xc,%esp
+    ip->nlink = 0;
+80108436:	31 c0                	xor    %eax,%eax
+80108438:	66 89 46 66          	mov    %ax,0x66(%esi)
+    iupdate(ip);
+8010843c:	56                   	push   %esi
+8010843d:	e8 fe 9e ff ff       	call   80102340 <iupdate>
+    iunlockput(ip);
+80108442:	89 34 24             	mov    %esi,(%esp)
+    return 0;
+80108445:	31 f6                	xor    %esi,%esi
+    iunlockput(ip);
+80108447:	e8 04 a7 ff ff       	call   80102b50 <iunlockput>
+    iunlockput(dp);
+8010844c:	89 1c 24             	mov    %ebx,(%esp)
+8010844f:	e8 fc a6 ff ff       	call   80102b50 <iunlockput>
+    return 0;
+80108454:	83 c4 10             	add    $0x10,%esp
+80108457:	e9 ea fe ff ff       	jmp    80108346 <create+0x86>
+      panic("create dots");
+8010845c:	83 ec 0c             	sub    $0xc,%esp
+8010845f:	68 83 bd 10 80       	push   $0x8010bd83
+80108464:	e8 17 84 ff ff       	call   80100880 <panic>
+    panic("create: ialloc");
+80108469:	83 ec 0c             	sub    $0xc,%esp
+8010846c:	68 74 bd 10 80       	push   $0x8010bd74
+80108471:	e8 0a 84 ff ff       	call   80100880 <panic>
+80108476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010847d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80108480 <sys_dup>:
+{
+80108480:	55                   	push   %ebp
+80108481:	89 e5                	mov    %esp,%ebp
+80108483:	56                   	push   %esi
+80108484:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80108485:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80108488:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+8010848b:	50                   	push   %eax
+8010848c:	6a 00                	push   $0x0
+8010848e:	e8 5d fc ff ff       	call   801080f0 <argint>
+80108493:	83 c4 10             	add    $0x10,%esp
+80108496:	85 c0                	test   %eax,%eax
+80108498:	78 36                	js     801084d0 <sys_dup+0x50>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+8010849a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+8010849e:	77 30                	ja     801084d0 <sys_dup+0x50>
+801084a0:	e8 ab e0 ff ff       	call   80106550 <myproc>
+801084a5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+801084a8:	8b 74 90 44          	mov    0x44(%eax,%edx,4),%esi
+801084ac:	85 f6                	test   %esi,%esi
+801084ae:	74 20                	je     801084d0 <sys_dup+0x50>
+  struct proc *curproc = myproc();
+801084b0:	e8 9b e0 ff ff       	call   80106550 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+801084b5:	31 db                	xor    %ebx,%ebx
+801084b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801084be:	66 90                	xchg   %ax,%ax
+    if(curproc->ofile[fd] == 0){
+801084c0:	8b 54 98 44          	mov    0x44(%eax,%ebx,4),%edx
+801084c4:	85 d2                	test   %edx,%edx
+801084c6:	74 18                	je     801084e0 <sys_dup+0x60>
+  for(fd = 0; fd < NOFILE; fd++){
+801084c8:	83 c3 01             	add    $0x1,%ebx
+801084cb:	83 fb 10             	cmp    $0x10,%ebx
+801084ce:	75 f0                	jne    801084c0 <sys_dup+0x40>
+}
+801084d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return -1;
+801084d3:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+}
+801084d8:	89 d8                	mov    %ebx,%eax
+801084da:	5b                   	pop    %ebx
+801084db:	5e                   	pop    %esi
+801084dc:	5d                   	pop    %ebp
+801084dd:	c3                   	ret
+801084de:	66 90                	xchg   %ax,%ax
+  filedup(f);
+801084e0:	83 ec 0c             	sub    $0xc,%esp
+      curproc->ofile[fd] = f;
+801084e3:	89 74 98 44          	mov    %esi,0x44(%eax,%ebx,4)
+  filedup(f);
+801084e7:	56                   	push   %esi
+801084e8:	e8 23 8f ff ff       	call   80101410 <filedup>
+  return fd;
+801084ed:	83 c4 10             	add    $0x10,%esp
+}
+801084f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801084f3:	89 d8                	mov    %ebx,%eax
+801084f5:	5b                   	pop    %ebx
+801084f6:	5e                   	pop    %esi
+801084f7:	5d                   	pop    %ebp
+801084f8:	c3                   	ret
+801084f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80108500 <sys_read>:
+{
+80108500:	55                   	push   %ebp
+80108501:	89 e5                	mov    %esp,%ebp
+80108503:	56                   	push   %esi
+80108504:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80108505:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80108508:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+8010850b:	53                   	push   %ebx
+8010850c:	6a 00                	push   $0x0
+8010850e:	e8 dd fb ff ff       	call   801080f0 <argint>
+80108513:	83 c4 10             	add    $0x10,%esp
+80108516:	85 c0                	test   %eax,%eax
+80108518:	78 5e                	js     80108578 <sys_read+0x78>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+8010851a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+8010851e:	77 58                	ja     80108578 <sys_read+0x78>
+80108520:	e8 2b e0 ff ff       	call   80106550 <myproc>
+80108525:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108528:	8b 74 90 44          	mov    0x44(%eax,%edx,4),%esi
+8010852c:	85 f6                	test   %esi,%esi
+8010852e:	74 48                	je     80108578 <sys_read+0x78>
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argwptr(1, &p, n) < 0)
+80108530:	83 ec 08             	sub    $0x8,%esp
+80108533:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108536:	50                   	push   %eax
+80108537:	6a 02                	push   $0x2
+80108539:	e8 b2 fb ff ff       	call   801080f0 <argint>
+8010853e:	83 c4 10             	add    $0x10,%esp
+80108541:	85 c0                	test   %eax,%eax
+80108543:	78 33                	js     80108578 <sys_read+0x78>
+80108545:	83 ec 04             	sub    $0x4,%esp
+80108548:	ff 75 f0             	push   -0x10(%ebp)
+8010854b:	53                   	push   %ebx
+8010854c:	6a 01                	push   $0x1
+8010854e:	e8 4d fc ff ff       	call   801081a0 <argwptr>
+80108553:	83 c4 10             	add    $0x10,%esp
+80108556:	85 c0                	test   %eax,%eax
+80108558:	78 1e                	js     80108578 <sys_read+0x78>
+  return fileread(f, p, n);
+8010855a:	83 ec 04             	sub    $0x4,%esp
+8010855d:	ff 75 f0             	push   -0x10(%ebp)
+80108560:	ff 75 f4             	push   -0xc(%ebp)
+80108563:	56                   	push   %esi
+80108564:	e8 27 90 ff ff       	call   80101590 <fileread>
+80108569:	83 c4 10             	add    $0x10,%esp
+}
+8010856c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010856f:	5b                   	pop    %ebx
+80108570:	5e                   	pop    %esi
+80108571:	5d                   	pop    %ebp
+80108572:	c3                   	ret
+80108573:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108577:	90                   	nop
+    return -1;
+80108578:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010857d:	eb ed                	jmp    8010856c <sys_read+0x6c>
+8010857f:	90                   	nop
+
+80108580 <sys_write>:
+{
+80108580:	55                   	push   %ebp
+80108581:	89 e5                	mov    %esp,%ebp
+80108583:	56                   	push   %esi
+80108584:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80108585:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80108588:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+8010858b:	53                   	push   %ebx
+8010858c:	6a 00                	push   $0x0
+8010858e:	e8 5d fb ff ff       	call   801080f0 <argint>
+80108593:	83 c4 10             	add    $0x10,%esp
+80108596:	85 c0                	test   %eax,%eax
+80108598:	78 5e                	js     801085f8 <sys_write+0x78>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+8010859a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+8010859e:	77 58                	ja     801085f8 <sys_write+0x78>
+801085a0:	e8 ab df ff ff       	call   80106550 <myproc>
+801085a5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+801085a8:	8b 74 90 44          	mov    0x44(%eax,%edx,4),%esi
+801085ac:	85 f6                	test   %esi,%esi
+801085ae:	74 48                	je     801085f8 <sys_write+0x78>
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+801085b0:	83 ec 08             	sub    $0x8,%esp
+801085b3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801085b6:	50                   	push   %eax
+801085b7:	6a 02                	push   $0x2
+801085b9:	e8 32 fb ff ff       	call   801080f0 <argint>
+801085be:	83 c4 10             	add    $0x10,%esp
+801085c1:	85 c0                	test   %eax,%eax
+801085c3:	78 33                	js     801085f8 <sys_write+0x78>
+801085c5:	83 ec 04             	sub    $0x4,%esp
+801085c8:	ff 75 f0             	push   -0x10(%ebp)
+801085cb:	53                   	push   %ebx
+801085cc:	6a 01                	push   $0x1
+801085ce:	e8 4d fb ff ff       	call   80108120 <argptr>
+801085d3:	83 c4 10             	add    $0x10,%esp
+801085d6:	85 c0                	test   %eax,%eax
+801085d8:	78 1e                	js     801085f8 <sys_write+0x78>
+  return filewrite(f, p, n);
+801085da:	83 ec 04             	sub    $0x4,%esp
+801085dd:	ff 75 f0             	push   -0x10(%ebp)
+801085e0:	ff 75 f4             	push   -0xc(%ebp)
+801085e3:	56                   	push   %esi
+801085e4:	e8 e7 90 ff ff       	call   801016d0 <filewrite>
+801085e9:	83 c4 10             	add    $0x10,%esp
+}
+801085ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801085ef:	5b                   	pop    %ebx
+801085f0:	5e                   	pop    %esi
+801085f1:	5d                   	pop    %ebp
+801085f2:	c3                   	ret
+801085f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801085f7:	90                   	nop
+    return -1;
+801085f8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801085fd:	eb ed                	jmp    801085ec <sys_write+0x6c>
+801085ff:	90                   	nop
+
+80108600 <sys_close>:
+{
+80108600:	55                   	push   %ebp
+80108601:	89 e5                	mov    %esp,%ebp
+80108603:	56                   	push   %esi
+80108604:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80108605:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80108608:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+8010860b:	50                   	push   %eax
+8010860c:	6a 00                	push   $0x0
+8010860e:	e8 dd fa ff ff       	call   801080f0 <argint>
+80108613:	83 c4 10             	add    $0x10,%esp
+80108616:	85 c0                	test   %eax,%eax
+80108618:	78 3e                	js     80108658 <sys_close+0x58>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+8010861a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+8010861e:	77 38                	ja     80108658 <sys_close+0x58>
+80108620:	e8 2b df ff ff       	call   80106550 <myproc>
+80108625:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108628:	8d 5a 10             	lea    0x10(%edx),%ebx
+8010862b:	8b 74 98 04          	mov    0x4(%eax,%ebx,4),%esi
+8010862f:	85 f6                	test   %esi,%esi
+80108631:	74 25                	je     80108658 <sys_close+0x58>
+  myproc()->ofile[fd] = 0;
+80108633:	e8 18 df ff ff       	call   80106550 <myproc>
+  fileclose(f);
+80108638:	83 ec 0c             	sub    $0xc,%esp
+  myproc()->ofile[fd] = 0;
+8010863b:	c7 44 98 04 00 00 00 	movl   $0x0,0x4(%eax,%ebx,4)
+80108642:	00 
+  fileclose(f);
+80108643:	56                   	push   %esi
+80108644:	e8 17 8e ff ff       	call   80101460 <fileclose>
+  return 0;
+80108649:	83 c4 10             	add    $0x10,%esp
+8010864c:	31 c0                	xor    %eax,%eax
+}
+8010864e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108651:	5b                   	pop    %ebx
+80108652:	5e                   	pop    %esi
+80108653:	5d                   	pop    %ebp
+80108654:	c3                   	ret
+80108655:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80108658:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010865d:	eb ef                	jmp    8010864e <sys_close+0x4e>
+8010865f:	90                   	nop
+
+80108660 <sys_fstat>:
+{
+80108660:	55                   	push   %ebp
+80108661:	89 e5                	mov    %esp,%ebp
+80108663:	56                   	push   %esi
+80108664:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80108665:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80108668:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+8010866b:	53                   	push   %ebx
+8010866c:	6a 00                	push   $0x0
+8010866e:	e8 7d fa ff ff       	call   801080f0 <argint>
+80108673:	83 c4 10             	add    $0x10,%esp
+80108676:	85 c0                	test   %eax,%eax
+80108678:	78 46                	js     801086c0 <sys_fstat+0x60>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+8010867a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+8010867e:	77 40                	ja     801086c0 <sys_fstat+0x60>
+80108680:	e8 cb de ff ff       	call   80106550 <myproc>
+80108685:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108688:	8b 74 90 44          	mov    0x44(%eax,%edx,4),%esi
+8010868c:	85 f6                	test   %esi,%esi
+8010868e:	74 30                	je     801086c0 <sys_fstat+0x60>
+  if(argfd(0, 0, &f) < 0 || argwptr(1, (void*)&st, sizeof(*st)) < 0)
+80108690:	83 ec 04             	sub    $0x4,%esp
+80108693:	6a 14                	push   $0x14
+80108695:	53                   	push   %ebx
+80108696:	6a 01                	push   $0x1
+80108698:	e8 03 fb ff ff       	call   801081a0 <argwptr>
+8010869d:	83 c4 10             	add    $0x10,%esp
+801086a0:	85 c0                	test   %eax,%eax
+801086a2:	78 1c                	js     801086c0 <sys_fstat+0x60>
+  return filestat(f, st);
+801086a4:	83 ec 08             	sub    $0x8,%esp
+801086a7:	ff 75 f4             	push   -0xc(%ebp)
+801086aa:	56                   	push   %esi
+801086ab:	e8 90 8e ff ff       	call   80101540 <filestat>
+801086b0:	83 c4 10             	add    $0x10,%esp
+}
+801086b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801086b6:	5b                   	pop    %ebx
+801086b7:	5e                   	pop    %esi
+801086b8:	5d                   	pop    %ebp
+801086b9:	c3                   	ret
+801086ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+801086c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801086c5:	eb ec                	jmp    801086b3 <sys_fstat+0x53>
+801086c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801086ce:	66 90                	xchg   %ax,%ax
+
+801086d0 <sys_fsync>:
+{
+801086d0:	55                   	push   %ebp
+801086d1:	89 e5                	mov    %esp,%ebp
+801086d3:	83 ec 20             	sub    $0x20,%esp
+  if(argint(n, &fd) < 0)
+801086d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801086d9:	50                   	push   %eax
+801086da:	6a 00                	push   $0x0
+801086dc:	e8 0f fa ff ff       	call   801080f0 <argint>
+801086e1:	83 c4 10             	add    $0x10,%esp
+801086e4:	85 c0                	test   %eax,%eax
+801086e6:	78 28                	js     80108710 <sys_fsync+0x40>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+801086e8:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+801086ec:	77 22                	ja     80108710 <sys_fsync+0x40>
+801086ee:	e8 5d de ff ff       	call   80106550 <myproc>
+801086f3:	8b 55 f4             	mov    -0xc(%ebp),%edx
+801086f6:	8b 44 90 44          	mov    0x44(%eax,%edx,4),%eax
+801086fa:	85 c0                	test   %eax,%eax
+801086fc:	74 12                	je     80108710 <sys_fsync+0x40>
+  log_sync();
+801086fe:	e8 6d c9 ff ff       	call   80105070 <log_sync>
+  return 0;
+80108703:	31 c0                	xor    %eax,%eax
+}
+80108705:	c9                   	leave
+80108706:	c3                   	ret
+80108707:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010870e:	66 90                	xchg   %ax,%ax
+80108710:	c9                   	leave
+    return -1;
+80108711:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108716:	c3                   	ret
+80108717:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010871e:	66 90                	xchg   %ax,%ax
+
+80108720 <sys_link>:
+{
+80108720:	55                   	push   %ebp
+80108721:	89 e5                	mov    %esp,%ebp
+80108723:	57                   	push   %edi
+80108724:	56                   	push   %esi
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+80108725:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+{
+80108728:	53                   	push   %ebx
+80108729:	83 ec 34             	sub    $0x34,%esp
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+8010872c:	50                   	push   %eax
+8010872d:	6a 00                	push   $0x0
+8010872f:	e8 bc fa ff ff       	call   801081f0 <argstr>
+80108734:	83 c4 10             	add    $0x10,%esp
+80108737:	85 c0                	test   %eax,%eax
+80108739:	0f 88 fb 00 00 00    	js     8010883a <sys_link+0x11a>
+8010873f:	83 ec 08             	sub    $0x8,%esp
+80108742:	8d 45 d0             	lea    -0x30(%ebp),%eax
+80108745:	50                   	push   %eax
+80108746:	6a 01                	push   $0x1
+80108748:	e8 a3 fa ff ff       	call   801081f0 <argstr>
+8010874d:	83 c4 10             	add    $0x10,%esp
+80108750:	85 c0                	test   %eax,%eax
+80108752:	0f 88 e2 00 00 00    	js     8010883a <sys_link+0x11a>
+  begin_op();
+80108758:	e8 03 c8 ff ff       	call   80104f60 <begin_op>
+  if((ip = namei(old)) == 0){
+8010875d:	83 ec 0c             	sub    $0xc,%esp
+80108760:	ff 75 d4             	push   -0x2c(%ebp)
+80108763:	e8 98 ae ff ff       	call   80103600 <namei>
+80108768:	83 c4 10             	add    $0x10,%esp
+8010876b:	89 c3                	mov    %eax,%ebx
+8010876d:	85 c0                	test   %eax,%eax
+8010876f:	0f 84 df 00 00 00    	je     80108854 <sys_link+0x134>
+  ilock(ip);
+80108775:	83 ec 0c             	sub    $0xc,%esp
+80108778:	50                   	push   %eax
+80108779:	e8 e2 a0 ff ff       	call   80102860 <ilock>
+  if(ip->type == T_DIR){
+8010877e:	83 c4 10             	add    $0x10,%esp
+80108781:	66 83 7b 60 01       	cmpw   $0x1,0x60(%ebx)
+80108786:	0f 84 b5 00 00 00    	je     80108841 <sys_link+0x121>
+  iupdate(ip);
+8010878c:	83 ec 0c             	sub    $0xc,%esp
+  ip->nlink++;
+8010878f:	66 83 43 66 01       	addw   $0x1,0x66(%ebx)
+  if((dp = nameiparent(new, name)) == 0)
+80108794:	8d 7d da             	lea    -0x26(%ebp),%edi
+  iupdate(ip);
+80108797:	53                   	push   %ebx
+80108798:	e8 a3 9b ff ff       	call   80102340 <iupdate>
+  iunlock(ip);
+8010879d:	89 1c 24             	mov    %ebx,(%esp)
+801087a0:	e8 9b a1 ff ff       	call   80102940 <iunlock>
+  if((dp = nameiparent(new, name)) == 0)
+801087a5:	58                   	pop    %eax
+801087a6:	5a                   	pop    %edx
+801087a7:	57                   	push   %edi
+801087a8:	ff 75 d0             	push   -0x30(%ebp)
+801087ab:	e8 70 ae ff ff       	call   80103620 <nameiparent>
+801087b0:	83 c4 10             	add    $0x10,%esp
+801087b3:	89 c6                	mov    %eax,%esi
+801087b5:	85 c0                	test   %eax,%eax
+801087b7:	74 5b                	je     80108814 <sys_link+0xf4>
+  ilock(dp);
+801087b9:	83 ec 0c             	sub    $0xc,%esp
+801087bc:	50                   	push   %eax
+801087bd:	e8 9e a0 ff ff       	call   80102860 <ilock>
+  if(dp->dev != ip->dev || dirlink(dp, name, ip->inum) < 0){
+801087c2:	8b 03                	mov    (%ebx),%eax
+801087c4:	83 c4 10             	add    $0x10,%esp
+801087c7:	39 06                	cmp    %eax,(%esi)
+801087c9:	75 3d                	jne    80108808 <sys_link+0xe8>
+801087cb:	83 ec 04             	sub    $0x4,%esp
+801087ce:	ff 73 04             	push   0x4(%ebx)
+801087d1:	57                   	push   %edi
+801087d2:	56                   	push   %esi
+801087d3:	e8 a8 ab ff ff       	call   80103380 <dirlink>
+801087d8:	83 c4 10             	add    $0x10,%esp
+801087db:	85 c0                	test   %eax,%eax
+801087dd:	78 29                	js     80108808 <sys_link+0xe8>
+  iunlockput(dp);
+801087df:	83 ec 0c             	sub    $0xc,%esp
+801087e2:	56                   	push   %esi
+801087e3:	e8 68 a3 ff ff       	call   80102b50 <iunlockput>
+  iput(ip);
+801087e8:	89 1c 24             	mov    %ebx,(%esp)
+801087eb:	e8 a0 a1 ff ff       	call   80102990 <iput>
+  end_op();
+801087f0:	e8 0b c8 ff ff       	call   80105000 <end_op>
+  return 0;
+801087f5:	83 c4 10             	add    $0x10,%esp
+801087f8:	31 c0                	xor    %eax,%eax
+}
+801087fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801087fd:	5b                   	pop    %ebx
+801087fe:	5e                   	pop    %esi
+801087ff:	5f                   	pop    %edi
+80108800:	5d                   	pop    %ebp
+80108801:	c3                   	ret
+80108802:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iunlockput(dp);
+80108808:	83 ec 0c             	sub    $0xc,%esp
+8010880b:	56                   	push   %esi
+8010880c:	e8 3f a3 ff ff       	call   80102b50 <iunlockput>
+    goto bad;
+80108811:	83 c4 10             	add    $0x10,%esp
+  ilock(ip);
+80108814:	83 ec 0c             	sub    $0xc,%esp
+80108817:	53                   	push   %ebx
+80108818:	e8 43 a0 ff ff       	call   80102860 <ilock>
+  ip->nlink--;
+8010881d:	66 83 6b 66 01       	subw   $0x1,0x66(%ebx)
+  iupdate(ip);
+80108822:	89 1c 24             	mov    %ebx,(%esp)
+80108825:	e8 16 9b ff ff       	call   80102340 <iupdate>
+  iunlockput(ip);
+8010882a:	89 1c 24             	mov    %ebx,(%esp)
+8010882d:	e8 1e a3 ff ff       	call   80102b50 <iunlockput>
+  end_op();
+80108832:	e8 c9 c7 ff ff       	call   80105000 <end_op>
+  return -1;
+80108837:	83 c4 10             	add    $0x10,%esp
+    return -1;
+8010883a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010883f:	eb b9                	jmp    801087fa <sys_link+0xda>
+    iunlockput(ip);
+80108841:	83 ec 0c             	sub    $0xc,%esp
+80108844:	53                   	push   %ebx
+80108845:	e8 06 a3 ff ff       	call   80102b50 <iunlockput>
+    end_op();
+8010884a:	e8 b1 c7 ff ff       	call   80105000 <end_op>
+    return -1;
+8010884f:	83 c4 10             	add    $0x10,%esp
+80108852:	eb e6                	jmp    8010883a <sys_link+0x11a>
+    end_op();
+80108854:	e8 a7 c7 ff ff       	call   80105000 <end_op>
+    return -1;
+80108859:	eb df                	jmp    8010883a <sys_link+0x11a>
+8010885b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010885f:	90                   	nop
+
+80108860 <sys_unlink>:
+{
+80108860:	55                   	push   %ebp
+80108861:	89 e5                	mov    %esp,%ebp
+80108863:	57                   	push   %edi
+80108864:	56                   	push   %esi
+  if(argstr(0, &path) < 0)
+80108865:	8d 45 c0             	lea    -0x40(%ebp),%eax
+{
+80108868:	53                   	push   %ebx
+80108869:	83 ec 54             	sub    $0x54,%esp
+  if(argstr(0, &path) < 0)
+8010886c:	50                   	push   %eax
+8010886d:	6a 00                	push   $0x0
+8010886f:	e8 7c f9 ff ff       	call   801081f0 <argstr>
+80108874:	83 c4 10             	add    $0x10,%esp
+80108877:	85 c0                	test   %eax,%eax
+80108879:	0f 88 a9 01 00 00    	js     80108a28 <sys_unlink+0x1c8>
+  begin_op();
+8010887f:	e8 dc c6 ff ff       	call   80104f60 <begin_op>
+  if((dp = nameiparent(path, name)) == 0){
+80108884:	83 ec 08             	sub    $0x8,%esp
+80108887:	8d 45 ca             	lea    -0x36(%ebp),%eax
+8010888a:	50                   	push   %eax
+8010888b:	ff 75 c0             	push   -0x40(%ebp)
+8010888e:	e8 8d ad ff ff       	call   80103620 <nameiparent>
+80108893:	83 c4 10             	add    $0x10,%esp
+80108896:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+80108899:	85 c0                	test   %eax,%eax
+8010889b:	0f 84 b0 01 00 00    	je     80108a51 <sys_unlink+0x1f1>
+  ilock(dp);
+801088a1:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+801088a4:	83 ec 0c             	sub    $0xc,%esp
+801088a7:	56                   	push   %esi
+801088a8:	e8 b3 9f ff ff       	call   80102860 <ilock>
+  if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+801088ad:	8d 45 ca             	lea    -0x36(%ebp),%eax
+801088b0:	5a                   	pop    %edx
+801088b1:	59                   	pop    %ecx
+801088b2:	68 90 bd 10 80       	push   $0x8010bd90
+801088b7:	50                   	push   %eax
+801088b8:	e8 93 a5 ff ff       	call   80102e50 <namecmp>
+801088bd:	83 c4 10             	add    $0x10,%esp
+801088c0:	85 c0                	test   %eax,%eax
+801088c2:	0f 84 4d 01 00 00    	je     80108a15 <sys_unlink+0x1b5>
+801088c8:	83 ec 08             	sub    $0x8,%esp
+801088cb:	8d 45 ca             	lea    -0x36(%ebp),%eax
+801088ce:	68 8f bd 10 80       	push   $0x8010bd8f
+801088d3:	50                   	push   %eax
+801088d4:	e8 77 a5 ff ff       	call   80102e50 <namecmp>
+801088d9:	83 c4 10             	add    $0x10,%esp
+801088dc:	85 c0                	test   %eax,%eax
+801088de:	0f 84 31 01 00 00    	je     80108a15 <sys_unlink+0x1b5>
+  if((ip = dirlookup(dp, name, &off)) == 0)
+801088e4:	83 ec 04             	sub    $0x4,%esp
+801088e7:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+801088ea:	50                   	push   %eax
+801088eb:	8d 45 ca             	lea    -0x36(%ebp),%eax
+801088ee:	50                   	push   %eax
+801088ef:	56                   	push   %esi
+801088f0:	e8 bb a5 ff ff       	call   80102eb0 <dirlookup>
+801088f5:	83 c4 10             	add    $0x10,%esp
+801088f8:	89 c3                	mov    %eax,%ebx
+801088fa:	85 c0                	test   %eax,%eax
+801088fc:	0f 84 13 01 00 00    	je     80108a15 <sys_unlink+0x1b5>
+  ilock(ip);
+80108902:	83 ec 0c             	sub    $0xc,%esp
+80108905:	50                   	push   %eax
+80108906:	e8 55 9f ff ff       	call   80102860 <ilock>
+  if(ip->nlink < 1)
+8010890b:	83 c4 10             	add    $0x10,%esp
+8010890e:	66 83 7b 66 00       	cmpw   $0x0,0x66(%ebx)
+80108913:	0f 8e 59 01 00 00    	jle    80108a72 <sys_unlink+0x212>
+  if(ip->type == T_DIR && !isdirempty(ip)){
+80108919:	66 83 7b 60 01       	cmpw   $0x1,0x60(%ebx)
+8010891e:	8d 75 d8             	lea    -0x28(%ebp),%esi
+80108921:	74 7d                	je     801089a0 <sys_unlink+0x140>
+  memset(&de, 0, sizeof(de));
+80108923:	83 ec 04             	sub    $0x4,%esp
+80108926:	6a 10                	push   $0x10
+80108928:	6a 00                	push   $0x0
+8010892a:	56                   	push   %esi
+8010892b:	e8 d0 f4 ff ff       	call   80107e00 <memset>
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80108930:	6a 10                	push   $0x10
+80108932:	ff 75 c4             	push   -0x3c(%ebp)
+80108935:	56                   	push   %esi
+80108936:	ff 75 b4             	push   -0x4c(%ebp)
+80108939:	e8 02 a4 ff ff       	call   80102d40 <writei>
+8010893e:	83 c4 20             	add    $0x20,%esp
+80108941:	83 f8 10             	cmp    $0x10,%eax
+80108944:	0f 85 1b 01 00 00    	jne    80108a65 <sys_unlink+0x205>
+  dcinval(dp, name);
+8010894a:	83 ec 08             	sub    $0x8,%esp
+8010894d:	8d 45 ca             	lea    -0x36(%ebp),%eax
+80108950:	50                   	push   %eax
+80108951:	ff 75 b4             	push   -0x4c(%ebp)
+80108954:	e8 17 a5 ff ff       	call   80102e70 <dcinval>
+  if(ip->type == T_DIR){
+80108959:	83 c4 10             	add    $0x10,%esp
+8010895c:	66 83 7b 60 01       	cmpw   $0x1,0x60(%ebx)
+80108961:	0f 84 d1 00 00 00    	je     80108a38 <sys_unlink+0x1d8>
+  iunlockput(dp);
+80108967:	83 ec 0c             	sub    $0xc,%esp
+8010896a:	ff 75 b4             	push   -0x4c(%ebp)
+8010896d:	e8 de a1 ff ff       	call   80102b50 <iunlockput>
+  ip->nlink--;
+80108972:	66 83 6b 66 01       	subw   $0x1,0x66(%ebx)
+  iupdate(ip);
+80108977:	89 1c 24             	mov    %ebx,(%esp)
+8010897a:	e8 c1 99 ff ff       	call   80102340 <iupdate>
+  iunlockput(ip);
+8010897f:	89 1c 24             	mov    %ebx,(%esp)
+80108982:	e8 c9 a1 ff ff       	call   80102b50 <iunlockput>
+  end_op();
+80108987:	e8 74 c6 ff ff       	call   80105000 <end_op>
+  return 0;
+8010898c:	83 c4 10             	add    $0x10,%esp
+8010898f:	31 c0                	xor    %eax,%eax
+}
+80108991:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108994:	5b                   	pop    %ebx
+80108995:	5e                   	pop    %esi
+80108996:	5f                   	pop    %edi
+80108997:	5d                   	pop    %ebp
+80108998:	c3                   	ret
+80108999:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(off=0; off<dp->size; off+=sizeof(de)){
+801089a0:	8b 43 68             	mov    0x68(%ebx),%eax
+801089a3:	85 c0                	test   %eax,%eax
+801089a5:	0f 84 78 ff ff ff    	je     80108923 <sys_unlink+0xc3>
+801089ab:	31 ff                	xor    %edi,%edi
+801089ad:	eb 0d                	jmp    801089bc <sys_unlink+0x15c>
+801089af:	90                   	nop
+801089b0:	83 c7 10             	add    $0x10,%edi
+801089b3:	3b 7b 68             	cmp    0x68(%ebx),%edi
+801089b6:	0f 83 67 ff ff ff    	jae    80108923 <sys_unlink+0xc3>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+801089bc:	6a 10                	push   $0x10
+801089be:	57                   	push   %edi
+801089bf:	56                   	push   %esi
+801089c0:	53                   	push   %ebx
+801089c1:	e8 0a a2 ff ff       	call   80102bd0 <readi>
+801089c6:	83 c4 10             	add    $0x10,%esp
+801089c9:	83 f8 10             	cmp    $0x10,%eax
+801089cc:	0f 85 86 00 00 00    	jne    80108a58 <sys_unlink+0x1f8>
+    if(de.inum != 0 && namecmp(de.name, ".") != 0 && namecmp(de.name, "..") != 0)
+801089d2:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+801089d7:	74 d7                	je     801089b0 <sys_unlink+0x150>
+801089d9:	83 ec 08             	sub    $0x8,%esp
+801089dc:	8d 45 da             	lea    -0x26(%ebp),%eax
+801089df:	68 90 bd 10 80       	push   $0x8010bd90
+801089e4:	50                   	push   %eax
+801089e5:	e8 66 a4 ff ff       	call   80102e50 <namecmp>
+801089ea:	83 c4 10             	add    $0x10,%esp
+801089ed:	85 c0                	test   %eax,%eax
+801089ef:	74 bf                	je     801089b0 <sys_unlink+0x150>
+801089f1:	83 ec 08             	sub    $0x8,%esp
+801089f4:	8d 45 da             	lea    -0x26(%ebp),%eax
+801089f7:	68 8f bd 10 80       	push   $0x8010bd8f
+801089fc:	50                   	push   %eax
+801089fd:	e8 4e a4 ff ff       	call   80102e50 <namecmp>
+80108a02:	83 c4 10             	add    $0x10,%esp
+80108a05:	85 c0                	test   %eax,%eax
+80108a07:	74 a7                	je     801089b0 <sys_unlink+0x150>
+    iunlockput(ip);
+80108a09:	83 ec 0c             	sub    $0xc,%esp
+80108a0c:	53                   	push   %ebx
+80108a0d:	e8 3e a1 ff ff       	call   80102b50 <iunlockput>
+    goto bad;
+80108a12:	83 c4 10             	add    $0x10,%esp
+  iunlockput(dp);
+80108a15:	83 ec 0c             	sub    $0xc,%esp
+80108a18:	ff 75 b4             	push   -0x4c(%ebp)
+80108a1b:	e8 30 a1 ff ff       	call   80102b50 <iunlockput>
+  end_op();
+80108a20:	e8 db c5 ff ff       	call   80105000 <end_op>
+  return -1;
+80108a25:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80108a28:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108a2d:	e9 5f ff ff ff       	jmp    80108991 <sys_unlink+0x131>
+80108a32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    dp->nlink--;
+80108a38:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    iupdate(dp);
+80108a3b:	83 ec 0c             	sub    $0xc,%esp
+    dp->nlink--;
+80108a3e:	66 83 68 66 01       	subw   $0x1,0x66(%eax)
+    iupdate(dp);
+80108a43:	50                   	push   %eax
+80108a44:	e8 f7 98 ff ff       	call   80102340 <iupdate>
+80108a49:	83 c4 10             	add    $0x10,%esp
+80108a4c:	e9 16 ff ff ff       	jmp    80108967 <sys_unlink+0x107>
+    end_op();
+80108a51:	e8 aa c5 ff ff       	call   80105000 <end_op>
+    return -1;
+80108a56:	eb d0                	jmp    80108a28 <sys_unlink+0x1c8>
+      panic("isdirempty: readi");
+80108a58:	83 ec 0c             	sub    $0xc,%esp
+80108a5b:	68 a4 bd 10 80       	push   $0x8010bda4
+80108a60:	e8 1b 7e ff ff       	call   80100880 <panic>
+    panic("unlink: writei");
+80108a65:	83 ec 0c             	sub    $0xc,%esp
+80108a68:	68 b6 bd 10 80       	push   $0x8010bdb6
+80108a6d:	e8 0e 7e ff ff       	call   80100880 <panic>
+    panic("unlink: nlink < 1");
+80108a72:	83 ec 0c             	sub    $0xc,%esp
+80108a75:	68 92 bd 10 80       	push   $0x8010bd92
+80108a7a:	e8 01 7e ff ff       	call   80100880 <panic>
+80108a7f:	90                   	nop
+
+80108a80 <sys_open>:
+
+int
+sys_open(void)
+{
+80108a80:	55                   	push   %ebp
+80108a81:	89 e5                	mov    %esp,%ebp
+80108a83:	57                   	push   %edi
+80108a84:	56                   	push   %esi
+  char *path;
+  int fd, omode;
+  struct file *f;
+  struct inode *ip;
+
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+80108a85:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+80108a88:	53                   	push   %ebx
+80108a89:	83 ec 24             	sub    $0x24,%esp
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+80108a8c:	50                   	push   %eax
+80108a8d:	6a 00                	push   $0x0
+80108a8f:	e8 5c f7 ff ff       	call   801081f0 <argstr>
+80108a94:	83 c4 10             	add    $0x10,%esp
+80108a97:	85 c0                	test   %eax,%eax
+80108a99:	0f 88 8e 00 00 00    	js     80108b2d <sys_open+0xad>
+80108a9f:	83 ec 08             	sub    $0x8,%esp
+80108aa2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80108aa5:	50                   	push   %eax
+80108aa6:	6a 01                	push   $0x1
+80108aa8:	e8 43 f6 ff ff       	call   801080f0 <argint>
+80108aad:	83 c4 10             	add    $0x10,%esp
+80108ab0:	85 c0                	test   %eax,%eax
+80108ab2:	78 79                	js     80108b2d <sys_open+0xad>
+    return -1;
+
+  begin_op();
+80108ab4:	e8 a7 c4 ff ff       	call   80104f60 <begin_op>
+
+  if(omode & O_CREATE){
+80108ab9:	f6 45 e5 02          	testb  $0x2,-0x1b(%ebp)
+80108abd:	75 79                	jne    80108b38 <sys_open+0xb8>
+    if(ip == 0){
+      end_op();
+      return -1;
+    }
+  } else {
+    if((ip = namei(path)) == 0){
+80108abf:	83 ec 0c             	sub    $0xc,%esp
+80108ac2:	ff 75 e0             	push   -0x20(%ebp)
+80108ac5:	e8 36 ab ff ff       	call   80103600 <namei>
+80108aca:	83 c4 10             	add    $0x10,%esp
+80108acd:	89 c6                	mov    %eax,%esi
+80108acf:	85 c0                	test   %eax,%eax
+80108ad1:	0f 84 7e 00 00 00    	je     80108b55 <sys_open+0xd5>
+      end_op();
+      return -1;
+    }
+    ilock(ip);
+80108ad7:	83 ec 0c             	sub    $0xc,%esp
+80108ada:	50                   	push   %eax
+80108adb:	e8 80 9d ff ff       	call   80102860 <ilock>
+    if(ip->type == T_DIR && omode != O_RDONLY){
+80108ae0:	83 c4 10             	add    $0x10,%esp
+80108ae3:	66 83 7e 60 01       	cmpw   $0x1,0x60(%esi)
+80108ae8:	0f 84 ba 00 00 00    	je     80108ba8 <sys_open+0x128>
+      end_op();
+      return -1;
+    }
+  }
+
+  if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
+80108aee:	e8 9d 88 ff ff       	call   80101390 <filealloc>
+80108af3:	89 c7                	mov    %eax,%edi
+80108af5:	85 c0                	test   %eax,%eax
+80108af7:	74 23                	je     80108b1c <sys_open+0x9c>
+  struct proc *curproc = myproc();
+80108af9:	e8 52 da ff ff       	call   80106550 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+80108afe:	31 db                	xor    %ebx,%ebx
+    if(curproc->ofile[fd] == 0){
+80108b00:	8b 54 98 44          	mov    0x44(%eax,%ebx,4),%edx
+80108b04:	85 d2                	test   %edx,%edx
+80108b06:	74 58                	je     80108b60 <sys_open+0xe0>
+  for(fd = 0; fd < NOFILE; fd++){
+80108b08:	83 c3 01             	add    $0x1,%ebx
+80108b0b:	83 fb 10             	cmp    $0x10,%ebx
+80108b0e:	75 f0                	jne    80108b00 <sys_open+0x80>
+    if(f)
+      fileclose(f);
+80108b10:	83 ec 0c             	sub    $0xc,%esp
+80108b13:	57                   	push   %edi
+80108b14:	e8 47 89 ff ff       	call   80101460 <fileclose>
+80108b19:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+80108b1c:	83 ec 0c             	sub    $0xc,%esp
+80108b1f:	56                   	push   %esi
+80108b20:	e8 2b a0 ff ff       	call   80102b50 <iunlockput>
+    end_op();
+80108b25:	e8 d6 c4 ff ff       	call   80105000 <end_op>
+    return -1;
+80108b2a:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80108b2d:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80108b32:	eb 65                	jmp    80108b99 <sys_open+0x119>
+80108b34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    ip = create(path, T_FILE, 0, 0);
+80108b38:	83 ec 0c             	sub    $0xc,%esp
+80108b3b:	31 c9                	xor    %ecx,%ecx
+80108b3d:	ba 02 00 00 00       	mov    $0x2,%edx
+80108b42:	6a 00                	push   $0x0
+80108b44:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80108b47:	e8 74 f7 ff ff       	call   801082c0 <create>
+    if(ip == 0){
+80108b4c:	83 c4 10             	add    $0x10,%esp
+    ip = create(path, T_FILE, 0, 0);
+80108b4f:	89 c6                	mov    %eax,%esi
+    if(ip == 0){
+80108b51:	85 c0                	test   %eax,%eax
+80108b53:	75 99                	jne    80108aee <sys_open+0x6e>
+      end_op();
+80108b55:	e8 a6 c4 ff ff       	call   80105000 <end_op>
+      return -1;
+80108b5a:	eb d1                	jmp    80108b2d <sys_open+0xad>
+80108b5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  }
+  iunlock(ip);
+80108b60:	83 ec 0c             	sub    $0xc,%esp
+      curproc->ofile[fd] = f;
+80108b63:	89 7c 98 44          	mov    %edi,0x44(%eax,%ebx,4)
+  iunlock(ip);
+80108b67:	56                   	push   %esi
+80108b68:	e8 d3 9d ff ff       	call   80102940 <iunlock>
+  end_op();
+80108b6d:	e8 8e c4 ff ff       	call   80105000 <end_op>
+
+  f->type = FD_INODE;
+80108b72:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  f->ip = ip;
+  f->off = 0;
+  f->readable = !(omode & O_WRONLY);
+80108b78:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+80108b7b:	83 c4 10             	add    $0x10,%esp
+  f->ip = ip;
+80108b7e:	89 77 10             	mov    %esi,0x10(%edi)
+  f->readable = !(omode & O_WRONLY);
+80108b81:	89 d0                	mov    %edx,%eax
+  f->off = 0;
+80108b83:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+  f->readable = !(omode & O_WRONLY);
+80108b8a:	f7 d0                	not    %eax
+80108b8c:	83 e0 01             	and    $0x1,%eax
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+80108b8f:	83 e2 03             	and    $0x3,%edx
+  f->readable = !(omode & O_WRONLY);
+80108b92:	88 47 08             	mov    %al,0x8(%edi)
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+80108b95:	0f 95 47 09          	setne  0x9(%edi)
+  return fd;
+}
+80108b99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108b9c:	89 d8                	mov    %ebx,%eax
+80108b9e:	5b                   	pop    %ebx
+80108b9f:	5e                   	pop    %esi
+80108ba0:	5f                   	pop    %edi
+80108ba1:	5d                   	pop    %ebp
+80108ba2:	c3                   	ret
+80108ba3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108ba7:	90                   	nop
+    if(ip->type == T_DIR && omode != O_RDONLY){
+80108ba8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80108bab:	85 c9                	test   %ecx,%ecx
+80108bad:	0f 84 3b ff ff ff    	je     80108aee <sys_open+0x6e>
+80108bb3:	e9 64 ff ff ff       	jmp    80108b1c <sys_open+0x9c>
+80108bb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108bbf:	90                   	nop
+
+80108bc0 <sys_mkdir>:
+
+int
+sys_mkdir(void)
+{
+80108bc0:	55                   	push   %ebp
+80108bc1:	89 e5                	mov    %esp,%ebp
+80108bc3:	83 ec 18             	sub    $0x18,%esp
+  char *path;
+  struct inode *ip;
+
+  begin_op();
+80108bc6:	e8 95 c3 ff ff       	call   80104f60 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+80108bcb:	83 ec 08             	sub    $0x8,%esp
+80108bce:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108bd1:	50                   	push   %eax
+80108bd2:	6a 00                	push   $0x0
+80108bd4:	e8 17 f6 ff ff       	call   801081f0 <argstr>
+80108bd9:	83 c4 10             	add    $0x10,%esp
+80108bdc:	85 c0                	test   %eax,%eax
+80108bde:	78 30                	js     80108c10 <sys_mkdir+0x50>
+80108be0:	83 ec 0c             	sub    $0xc,%esp
+80108be3:	31 c9                	xor    %ecx,%ecx
+80108be5:	ba 01 00 00 00       	mov    $0x1,%edx
+80108bea:	6a 00                	push   $0x0
+80108bec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108bef:	e8 cc f6 ff ff       	call   801082c0 <create>
+80108bf4:	83 c4 10             	add    $0x10,%esp
+80108bf7:	85 c0                	test   %eax,%eax
+80108bf9:	74 15                	je     80108c10 <sys_mkdir+0x50>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+80108bfb:	83 ec 0c             	sub    $0xc,%esp
+80108bfe:	50                   	push   %eax
+80108bff:	e8 4c 9f ff ff       	call   80102b50 <iunlockput>
+  end_op();
+80108c04:	e8 f7 c3 ff ff       	call   80105000 <end_op>
+  return 0;
+80108c09:	83 c4 10             	add    $0x10,%esp
+80108c0c:	31 c0                	xor    %eax,%eax
+}
+80108c0e:	c9                   	leave
+80108c0f:	c3                   	ret
+    end_op();
+80108c10:	e8 eb c3 ff ff       	call   80105000 <end_op>
+    return -1;
+80108c15:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108c1a:	c9                   	leave
+80108c1b:	c3                   	ret
+80108c1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108c20 <sys_mknod>:
+
+int
+sys_mknod(void)
+{
+80108c20:	55                   	push   %ebp
+80108c21:	89 e5                	mov    %esp,%ebp
+80108c23:	83 ec 18             	sub    $0x18,%esp
+  struct inode *ip;
+  char *path;
+  int major, minor;
+
+  begin_op();
+80108c26:	e8 35 c3 ff ff       	call   80104f60 <begin_op>
+  if((argstr(0, &path)) < 0 ||
+80108c2b:	83 ec 08             	sub    $0x8,%esp
+80108c2e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80108c31:	50                   	push   %eax
+80108c32:	6a 00                	push   $0x0
+80108c34:	e8 b7 f5 ff ff       	call   801081f0 <argstr>
+80108c39:	83 c4 10             	add    $0x10,%esp
+80108c3c:	85 c0                	test   %eax,%eax
+80108c3e:	78 60                	js     80108ca0 <sys_mknod+0x80>
+     argint(1, &major) < 0 ||
+80108c40:	83 ec 08             	sub    $0x8,%esp
+80108c43:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108c46:	50                   	push   %eax
+80108c47:	6a 01                	push   $0x1
+80108c49:	e8 a2 f4 ff ff       	call   801080f0 <argint>
+  if((argstr(0, &path)) < 0 ||
+80108c4e:	83 c4 10             	add    $0x10,%esp
+80108c51:	85 c0                	test   %eax,%eax
+80108c53:	78 4b                	js     80108ca0 <sys_mknod+0x80>
+     argint(2, &minor) < 0 ||
+80108c55:	83 ec 08             	sub    $0x8,%esp
+80108c58:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108c5b:	50                   	push   %eax
+80108c5c:	6a 02                	push   $0x2
+80108c5e:	e8 8d f4 ff ff       	call   801080f0 <argint>
+     argint(1, &major) < 0 ||
+80108c63:	83 c4 10             	add    $0x10,%esp
+80108c66:	85 c0                	test   %eax,%eax
+80108c68:	78 36                	js     80108ca0 <sys_mknod+0x80>
+     (ip = create(path, T_DEV, major, minor)) == 0){
+80108c6a:	0f bf 45 f4          	movswl -0xc(%ebp),%eax
+80108c6e:	83 ec 0c             	sub    $0xc,%esp
+80108c71:	0f bf 4d f0          	movswl -0x10(%ebp),%ecx
+80108c75:	ba 03 00 00 00       	mov    $0x3,%edx
+80108c7a:	50                   	push   %eax
+80108c7b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+80108c7e:	e8 3d f6 ff ff       	call   801082c0 <create>
+     argint(2, &minor) < 0 ||
+80108c83:	83 c4 10             	add    $0x10,%esp
+80108c86:	85 c0                	test   %eax,%eax
+80108c88:	74 16                	je     80108ca0 <sys_mknod+0x80>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+80108c8a:	83 ec 0c             	sub    $0xc,%esp
+80108c8d:	50                   	push   %eax
+80108c8e:	e8 bd 9e ff ff       	call   80102b50 <iunlockput>
+  end_op();
+80108c93:	e8 68 c3 ff ff       	call   80105000 <end_op>
+  return 0;
+80108c98:	83 c4 10             	add    $0x10,%esp
+80108c9b:	31 c0                	xor    %eax,%eax
+}
+80108c9d:	c9                   	leave
+80108c9e:	c3                   	ret
+80108c9f:	90                   	nop
+    end_op();
+80108ca0:	e8 5b c3 ff ff       	call   80105000 <end_op>
+    return -1;
+80108ca5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108caa:	c9                   	leave
+80108cab:	c3                   	ret
+80108cac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108cb0 <sys_chdir>:
+
+int
+sys_chdir(void)
+{
+80108cb0:	55                   	push   %ebp
+80108cb1:	89 e5                	mov    %esp,%ebp
+80108cb3:	56                   	push   %esi
+80108cb4:	53                   	push   %ebx
+80108cb5:	83 ec 10             	sub    $0x10,%esp
+  char *path;
+  struct inode *ip;
+  struct proc *curproc = myproc();
+80108cb8:	e8 93 d8 ff ff       	call   80106550 <myproc>
+80108cbd:	89 c6                	mov    %eax,%esi
+  
+  begin_op();
+80108cbf:	e8 9c c2 ff ff       	call   80104f60 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
+80108cc4:	83 ec 08             	sub    $0x8,%esp
+80108cc7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108cca:	50                   	push   %eax
+80108ccb:	6a 00                	push   $0x0
+80108ccd:	e8 1e f5 ff ff       	call   801081f0 <argstr>
+80108cd2:	83 c4 10             	add    $0x10,%esp
+80108cd5:	85 c0                	test   %eax,%eax
+80108cd7:	78 77                	js     80108d50 <sys_chdir+0xa0>
+80108cd9:	83 ec 0c             	sub    $0xc,%esp
+80108cdc:	ff 75 f4             	push   -0xc(%ebp)
+80108cdf:	e8 1c a9 ff ff       	call   80103600 <namei>
+80108ce4:	83 c4 10             	add    $0x10,%esp
+80108ce7:	89 c3                	mov    %eax,%ebx
+80108ce9:	85 c0                	test   %eax,%eax
+80108ceb:	74 63                	je     80108d50 <sys_chdir+0xa0>
+    end_op();
+    return -1;
+  }
+  ilock(ip);
+80108ced:	83 ec 0c             	sub    $0xc,%esp
+80108cf0:	50                   	push   %eax
+80108cf1:	e8 6a 9b ff ff       	call   80102860 <ilock>
+  if(ip->type != T_DIR){
+80108cf6:	83 c4 10             	add    $0x10,%esp
+80108cf9:	66 83 7b 60 01       	cmpw   $0x1,0x60(%ebx)
+80108cfe:	75 30                	jne    80108d30 <sys_chdir+0x80>
+    iunlockput(ip);
+    end_op();
+    return -1;
+  }
+  iunlock(ip);
+80108d00:	83 ec 0c             	sub    $0xc,%esp
+80108d03:	53                   	push   %ebx
+80108d04:	e8 37 9c ff ff       	call   80102940 <iunlock>
+  iput(curproc->cwd);
+80108d09:	58                   	pop    %eax
+80108d0a:	ff b6 84 00 00 00    	push   0x84(%esi)
+80108d10:	e8 7b 9c ff ff       	call   80102990 <iput>
+  end_op();
+80108d15:	e8 e6 c2 ff ff       	call   80105000 <end_op>
+  curproc->cwd = ip;
+80108d1a:	89 9e 84 00 00 00    	mov    %ebx,0x84(%esi)
+  return 0;
+80108d20:	83 c4 10             	add    $0x10,%esp
+80108d23:	31 c0                	xor    %eax,%eax
+}
+80108d25:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108d28:	5b                   	pop    %ebx
+80108d29:	5e                   	pop    %esi
+80108d2a:	5d                   	pop    %ebp
+80108d2b:	c3                   	ret
+80108d2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iunlockput(ip);
+80108d30:	83 ec 0c             	sub    $0xc,%esp
+80108d33:	53                   	push   %ebx
+80108d34:	e8 17 9e ff ff       	call   80102b50 <iunlockput>
+    end_op();
+80108d39:	e8 c2 c2 ff ff       	call   80105000 <end_op>
+    return -1;
+80108d3e:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80108d41:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108d46:	eb dd                	jmp    80108d25 <sys_chdir+0x75>
+80108d48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108d4f:	90                   	nop
+    end_op();
+80108d50:	e8 ab c2 ff ff       	call   80105000 <end_op>
+    return -1;
+80108d55:	eb ea                	jmp    80108d41 <sys_chdir+0x91>
+80108d57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108d5e:	66 90                	xchg   %ax,%ax
+
+80108d60 <sys_exec>:
+
+int
+sys_exec(void)
+{
+80108d60:	55                   	push   %ebp
+80108d61:	89 e5                	mov    %esp,%ebp
+80108d63:	57                   	push   %edi
+80108d64:	56                   	push   %esi
+  char *path, *argv[MAXARG];
+  int i;
+  uint uargv, uarg;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+80108d65:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+{
+80108d6b:	53                   	push   %ebx
+80108d6c:	81 ec a4 00 00 00    	sub    $0xa4,%esp
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+80108d72:	50                   	push   %eax
+80108d73:	6a 00                	push   $0x0
+80108d75:	e8 76 f4 ff ff       	call   801081f0 <argstr>
+80108d7a:	83 c4 10             	add    $0x10,%esp
+80108d7d:	85 c0                	test   %eax,%eax
+80108d7f:	0f 88 87 00 00 00    	js     80108e0c <sys_exec+0xac>
+80108d85:	83 ec 08             	sub    $0x8,%esp
+80108d88:	8d 85 60 ff ff ff    	lea    -0xa0(%ebp),%eax
+80108d8e:	50                   	push   %eax
+80108d8f:	6a 01                	push   $0x1
+80108d91:	e8 5a f3 ff ff       	call   801080f0 <argint>
+80108d96:	83 c4 10             	add    $0x10,%esp
+80108d99:	85 c0                	test   %eax,%eax
+80108d9b:	78 6f                	js     80108e0c <sys_exec+0xac>
+    return -1;
+  }
+  memset(argv, 0, sizeof(argv));
+80108d9d:	83 ec 04             	sub    $0x4,%esp
+80108da0:	8d b5 68 ff ff ff    	lea    -0x98(%ebp),%esi
+  for(i=0;; i++){
+80108da6:	31 db                	xor    %ebx,%ebx
+  memset(argv, 0, sizeof(argv));
+80108da8:	68 80 00 00 00       	push   $0x80
+80108dad:	6a 00                	push   $0x0
+80108daf:	56                   	push   %esi
+80108db0:	e8 4b f0 ff ff       	call   80107e00 <memset>
+80108db5:	83 c4 10             	add    $0x10,%esp
+80108db8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108dbf:	90                   	nop
+    if(i >= NELEM(argv))
+      return -1;
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+80108dc0:	83 ec 08             	sub    $0x8,%esp
+80108dc3:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+80108dc9:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+80108dd0:	50                   	push   %eax
+80108dd1:	8b 85 60 ff ff ff    	mov    -0xa0(%ebp),%eax
+80108dd7:	01 f8                	add    %edi,%eax
+80108dd9:	50                   	push   %eax
+80108dda:	e8 41 f2 ff ff       	call   80108020 <fetchint>
+80108ddf:	83 c4 10             	add    $0x10,%esp
+80108de2:	85 c0                	test   %eax,%eax
+80108de4:	78 26                	js     80108e0c <sys_exec+0xac>
+      return -1;
+    if(uarg == 0){
+80108de6:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+80108dec:	85 c0                	test   %eax,%eax
+80108dee:	74 30                	je     80108e20 <sys_exec+0xc0>
+      argv[i] = 0;
+      break;
+    }
+    if(fetchstr(uarg, &argv[i]) < 0)
+80108df0:	83 ec 08             	sub    $0x8,%esp
+80108df3:	8d 14 3e             	lea    (%esi,%edi,1),%edx
+80108df6:	52                   	push   %edx
+80108df7:	50                   	push   %eax
+80108df8:	e8 73 f2 ff ff       	call   80108070 <fetchstr>
+80108dfd:	83 c4 10             	add    $0x10,%esp
+80108e00:	85 c0                	test   %eax,%eax
+80108e02:	78 08                	js     80108e0c <sys_exec+0xac>
+  for(i=0;; i++){
+80108e04:	83 c3 01             	add    $0x1,%ebx
+    if(i >= NELEM(argv))
+80108e07:	83 fb 20             	cmp    $0x20,%ebx
+80108e0a:	75 b4                	jne    80108dc0 <sys_exec+0x60>
+      return -1;
+  }
+  return exec(path, argv);
+}
+80108e0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+80108e0f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108e14:	5b                   	pop    %ebx
+80108e15:	5e                   	pop    %esi
+80108e16:	5f                   	pop    %edi
+80108e17:	5d                   	pop    %ebp
+80108e18:	c3                   	ret
+80108e19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      argv[i] = 0;
+80108e20:	c7 84 9d 68 ff ff ff 	movl   $0x0,-0x98(%ebp,%ebx,4)
+80108e27:	00 00 00 00 
+  return exec(path, argv);
+80108e2b:	83 ec 08             	sub    $0x8,%esp
+80108e2e:	56                   	push   %esi
+80108e2f:	ff b5 5c ff ff ff    	push   -0xa4(%ebp)
+80108e35:	e8 b6 81 ff ff       	call   80100ff0 <exec>
+80108e3a:	83 c4 10             	add    $0x10,%esp
+}
+80108e3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108e40:	5b                   	pop    %ebx
+80108e41:	5e                   	pop    %esi
+80108e42:	5f                   	pop    %edi
+80108e43:	5d                   	pop    %ebp
+80108e44:	c3                   	ret
+80108e45:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108e4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108e50 <sys_pipesize>:
+
+// Set the capacity of a pipe's buffer; see pipesize().
+int
+sys_pipesize(void)
+{
+80108e50:	55                   	push   %ebp
+80108e51:	89 e5                	mov    %esp,%ebp
+80108e53:	56                   	push   %esi
+80108e54:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80108e55:	8d 75 f4             	lea    -0xc(%ebp),%esi
+{
+80108e58:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80108e5b:	56                   	push   %esi
+80108e5c:	6a 00                	push   $0x0
+80108e5e:	e8 8d f2 ff ff       	call   801080f0 <argint>
+80108e63:	83 c4 10             	add    $0x10,%esp
+80108e66:	85 c0                	test   %eax,%eax
+80108e68:	78 46                	js     80108eb0 <sys_pipesize+0x60>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80108e6a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80108e6e:	77 40                	ja     80108eb0 <sys_pipesize+0x60>
+80108e70:	e8 db d6 ff ff       	call   80106550 <myproc>
+80108e75:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80108e78:	8b 5c 90 44          	mov    0x44(%eax,%edx,4),%ebx
+80108e7c:	85 db                	test   %ebx,%ebx
+80108e7e:	74 30                	je     80108eb0 <sys_pipesize+0x60>
+  struct file *f;
+  int n;
+
+  if(argfd(0, 0, &f) < 0 || argint(1, &n) < 0 || f->type != FD_PIPE)
+80108e80:	83 ec 08             	sub    $0x8,%esp
+80108e83:	56                   	push   %esi
+80108e84:	6a 01                	push   $0x1
+80108e86:	e8 65 f2 ff ff       	call   801080f0 <argint>
+80108e8b:	83 c4 10             	add    $0x10,%esp
+80108e8e:	85 c0                	test   %eax,%eax
+80108e90:	78 1e                	js     80108eb0 <sys_pipesize+0x60>
+80108e92:	83 3b 01             	cmpl   $0x1,(%ebx)
+80108e95:	75 19                	jne    80108eb0 <sys_pipesize+0x60>
+    return -1;
+  return pipesize(f->pipe, n);
+80108e97:	83 ec 08             	sub    $0x8,%esp
+80108e9a:	ff 75 f4             	push   -0xc(%ebp)
+80108e9d:	ff 73 0c             	push   0xc(%ebx)
+80108ea0:	e8 5b cf ff ff       	call   80105e00 <pipesize>
+80108ea5:	83 c4 10             	add    $0x10,%esp
+}
+80108ea8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108eab:	5b                   	pop    %ebx
+80108eac:	5e                   	pop    %esi
+80108ead:	5d                   	pop    %ebp
+80108eae:	c3                   	ret
+80108eaf:	90                   	nop
+    return -1;
+80108eb0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108eb5:	eb f1                	jmp    80108ea8 <sys_pipesize+0x58>
+80108eb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108ebe:	66 90                	xchg   %ax,%ax
+
+80108ec0 <sys_pipe>:
+
+int
+sys_pipe(void)
+{
+80108ec0:	55                   	push   %ebp
+80108ec1:	89 e5                	mov    %esp,%ebp
+80108ec3:	57                   	push   %edi
+80108ec4:	56                   	push   %esi
+  int *fd;
+  struct file *rf, *wf;
+  int fd0, fd1;
+
+  if(argwptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+80108ec5:	8d 45 dc             	lea    -0x24(%ebp),%eax
+{
+80108ec8:	53                   	push   %ebx
+80108ec9:	83 ec 20             	sub    $0x20,%esp
+  if(argwptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+80108ecc:	6a 08                	push   $0x8
+80108ece:	50                   	push   %eax
+80108ecf:	6a 00                	push   $0x0
+80108ed1:	e8 ca f2 ff ff       	call   801081a0 <argwptr>
+80108ed6:	83 c4 10             	add    $0x10,%esp
+80108ed9:	85 c0                	test   %eax,%eax
+80108edb:	0f 88 8b 00 00 00    	js     80108f6c <sys_pipe+0xac>
+    return -1;
+  if(pipealloc(&rf, &wf) < 0)
+80108ee1:	83 ec 08             	sub    $0x8,%esp
+80108ee4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80108ee7:	50                   	push   %eax
+80108ee8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+80108eeb:	50                   	push   %eax
+80108eec:	e8 bf c7 ff ff       	call   801056b0 <pipealloc>
+80108ef1:	83 c4 10             	add    $0x10,%esp
+80108ef4:	85 c0                	test   %eax,%eax
+80108ef6:	78 74                	js     80108f6c <sys_pipe+0xac>
+    return -1;
+  fd0 = -1;
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+80108ef8:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(fd = 0; fd < NOFILE; fd++){
+80108efb:	31 db                	xor    %ebx,%ebx
+  struct proc *curproc = myproc();
+80108efd:	e8 4e d6 ff ff       	call   80106550 <myproc>
+    if(curproc->ofile[fd] == 0){
+80108f02:	8b 74 98 44          	mov    0x44(%eax,%ebx,4),%esi
+80108f06:	85 f6                	test   %esi,%esi
+80108f08:	74 16                	je     80108f20 <sys_pipe+0x60>
+80108f0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(fd = 0; fd < NOFILE; fd++){
+80108f10:	83 c3 01             	add    $0x1,%ebx
+80108f13:	83 fb 10             	cmp    $0x10,%ebx
+80108f16:	74 3d                	je     80108f55 <sys_pipe+0x95>
+    if(curproc->ofile[fd] == 0){
+80108f18:	8b 74 98 44          	mov    0x44(%eax,%ebx,4),%esi
+80108f1c:	85 f6                	test   %esi,%esi
+80108f1e:	75 f0                	jne    80108f10 <sys_pipe+0x50>
+      curproc->ofile[fd] = f;
+80108f20:	8d 73 10             	lea    0x10(%ebx),%esi
+80108f23:	89 7c b0 04          	mov    %edi,0x4(%eax,%esi,4)
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+80108f27:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  struct proc *curproc = myproc();
+80108f2a:	e8 21 d6 ff ff       	call   80106550 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+80108f2f:	31 d2                	xor    %edx,%edx
+80108f31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(curproc->ofile[fd] == 0){
+80108f38:	8b 4c 90 44          	mov    0x44(%eax,%edx,4),%ecx
+80108f3c:	85 c9                	test   %ecx,%ecx
+80108f3e:	74 38                	je     80108f78 <sys_pipe+0xb8>
+  for(fd = 0; fd < NOFILE; fd++){
+80108f40:	83 c2 01             	add    $0x1,%edx
+80108f43:	83 fa 10             	cmp    $0x10,%edx
+80108f46:	75 f0                	jne    80108f38 <sys_pipe+0x78>
+    if(fd0 >= 0)
+      myproc()->ofile[fd0] = 0;
+80108f48:	e8 03 d6 ff ff       	call   80106550 <myproc>
+80108f4d:	c7 44 b0 04 00 00 00 	movl   $0x0,0x4(%eax,%esi,4)
+80108f54:	00 
+    fileclose(rf);
+80108f55:	83 ec 0c             	sub    $0xc,%esp
+80108f58:	ff 75 e0             	push   -0x20(%ebp)
+80108f5b:	e8 00 85 ff ff       	call   80101460 <fileclose>
+    fileclose(wf);
+80108f60:	58                   	pop    %eax
+80108f61:	ff 75 e4             	push   -0x1c(%ebp)
+80108f64:	e8 f7 84 ff ff       	call   80101460 <fileclose>
+    return -1;
+80108f69:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80108f6c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108f71:	eb 16                	jmp    80108f89 <sys_pipe+0xc9>
+80108f73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108f77:	90                   	nop
+      curproc->ofile[fd] = f;
+80108f78:	89 7c 90 44          	mov    %edi,0x44(%eax,%edx,4)
+  }
+  fd[0] = fd0;
+80108f7c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80108f7f:	89 18                	mov    %ebx,(%eax)
+  fd[1] = fd1;
+80108f81:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80108f84:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+80108f87:	31 c0                	xor    %eax,%eax
+}
+80108f89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108f8c:	5b                   	pop    %ebx
+80108f8d:	5e                   	pop    %esi
+80108f8e:	5f                   	pop    %edi
+80108f8f:	5d                   	pop    %ebp
+80108f90:	c3                   	ret
+80108f91:	66 90                	xchg   %ax,%ax
+80108f93:	66 90                	xchg   %ax,%ax
+80108f95:	66 90                	xchg   %ax,%ax
+80108f97:	66 90                	xchg   %ax,%ax
+80108f99:	66 90                	xchg   %ax,%ax
+80108f9b:	66 90                	xchg   %ax,%ax
+80108f9d:	66 90                	xchg   %ax,%ax
+80108f9f:	90                   	nop
+
+80108fa0 <sys_fork>:
+#include "pstat.h"
+
+int
+sys_fork(void)
+{
+  return fork();
+80108fa0:	e9 9b d8 ff ff       	jmp    80106840 <fork>
+80108fa5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108fac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108fb0 <sys_exit>:
+}
+
+int
+sys_exit(void)
+{
+80108fb0:	55                   	push   %ebp
+80108fb1:	89 e5                	mov    %esp,%ebp
+80108fb3:	83 ec 08             	sub    $0x8,%esp
+  exit();
+80108fb6:	e8 a5 df ff ff       	call   80106f60 <exit>
+  return 0;  // not reached
+}
+80108fbb:	31 c0                	xor    %eax,%eax
+80108fbd:	c9                   	leave
+80108fbe:	c3                   	ret
+80108fbf:	90                   	nop
+
+80108fc0 <sys_wait>:
+
+int
+sys_wait(void)
+{
+  return wait();
+80108fc0:	e9 3b e3 ff ff       	jmp    80107300 <wait>
+80108fc5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108fcc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108fd0 <sys_kill>:
+}
+
+int
+sys_kill(void)
+{
+80108fd0:	55                   	push   %ebp
+80108fd1:	89 e5                	mov    %esp,%ebp
+80108fd3:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0, &pid) < 0)
+80108fd6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108fd9:	50                   	push   %eax
+80108fda:	6a 00                	push   $0x0
+80108fdc:	e8 0f f1 ff ff       	call   801080f0 <argint>
+80108fe1:	83 c4 10             	add    $0x10,%esp
+80108fe4:	85 c0                	test   %eax,%eax
+80108fe6:	78 18                	js     80109000 <sys_kill+0x30>
+    return -1;
+  return kill(pid);
+80108fe8:	83 ec 0c             	sub    $0xc,%esp
+80108feb:	ff 75 f4             	push   -0xc(%ebp)
+80108fee:	e8 5d e5 ff ff       	call   80107550 <kill>
+80108ff3:	83 c4 10             	add    $0x10,%esp
+}
+80108ff6:	c9                   	leave
+80108ff7:	c3                   	ret
+80108ff8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108fff:	90                   	nop
+80109000:	c9                   	leave
+    return -1;
+80109001:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109006:	c3                   	ret
+80109007:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010900e:	66 90                	xchg   %ax,%ax
+
+80109010 <sys_getpid>:
+
+int
+sys_getpid(void)
+{
+80109010:	55                   	push   %ebp
+80109011:	89 e5                	mov    %esp,%ebp
+80109013:	83 ec 08             	sub    $0x8,%esp
+  return myproc()->pid;
+80109016:	e8 35 d5 ff ff       	call   80106550 <myproc>
+8010901b:	8b 40 10             	mov    0x10(%eax),%eax
+}
+8010901e:	c9                   	leave
+8010901f:	c3                   	ret
+
+80109020 <sys_sbrk>:
+
+int
+sys_sbrk(void)
+{
+80109020:	55                   	push   %ebp
+80109021:	89 e5                	mov    %esp,%ebp
+80109023:	53                   	push   %ebx
+  int addr;
+  int n;
+
+  if(argint(0, &n) < 0)
+80109024:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80109027:	83 ec 1c             	sub    $0x1c,%esp
+  if(argint(0, &n) < 0)
+8010902a:	50                   	push   %eax
+8010902b:	6a 00                	push   $0x0
+8010902d:	e8 be f0 ff ff       	call   801080f0 <argint>
+80109032:	83 c4 10             	add    $0x10,%esp
+80109035:	85 c0                	test   %eax,%eax
+80109037:	78 27                	js     80109060 <sys_sbrk+0x40>
+    return -1;
+  addr = myproc()->sz;
+80109039:	e8 12 d5 ff ff       	call   80106550 <myproc>
+  if(growproc(n) < 0)
+8010903e:	83 ec 0c             	sub    $0xc,%esp
+  addr = myproc()->sz;
+80109041:	8b 18                	mov    (%eax),%ebx
+  if(growproc(n) < 0)
+80109043:	ff 75 f4             	push   -0xc(%ebp)
+80109046:	e8 55 d7 ff ff       	call   801067a0 <growproc>
+8010904b:	83 c4 10             	add    $0x10,%esp
+8010904e:	85 c0                	test   %eax,%eax
+80109050:	78 0e                	js     80109060 <sys_sbrk+0x40>
+    return -1;
+  return addr;
+}
+80109052:	89 d8                	mov    %ebx,%eax
+80109054:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80109057:	c9                   	leave
+80109058:	c3                   	ret
+80109059:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+80109060:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80109065:	eb eb                	jmp    80109052 <sys_sbrk+0x32>
+80109067:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010906e:	66 90                	xchg   %ax,%ax
+
+80109070 <sys_sleep>:
+
+int
+sys_sleep(void)
+{
+80109070:	55                   	push   %ebp
+80109071:	89 e5                	mov    %esp,%ebp
+80109073:	53                   	push   %ebx
+  int n;
+  uint ticks0;
+
+  if(argint(0, &n) < 0)
+80109074:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80109077:	83 ec 1c             	sub    $0x1c,%esp
+  if(argint(0, &n) < 0)
+8010907a:	50                   	push   %eax
+8010907b:	6a 00                	push   $0x0
+8010907d:	e8 6e f0 ff ff       	call   801080f0 <argint>
+80109082:	83 c4 10             	add    $0x10,%esp
+80109085:	85 c0                	test   %eax,%eax
+80109087:	0f 88 8d 00 00 00    	js     8010911a <sys_sleep+0xaa>
+    return -1;
+  acquire(&tickslock);
+8010908d:	83 ec 0c             	sub    $0xc,%esp
+80109090:	68 60 35 14 80       	push   $0x80143560
+80109095:	e8 86 ec ff ff       	call   80107d20 <acquire>
+  ticks0 = ticks;
+  if(n > 0)
+8010909a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+8010909d:	83 c4 10             	add    $0x10,%esp
+801090a0:	31 d2                	xor    %edx,%edx
+  ticks0 = ticks;
+801090a2:	8b 1d 40 35 14 80    	mov    0x80143540,%ebx
+  if(n > 0)
+801090a8:	85 c0                	test   %eax,%eax
+801090aa:	7e 1e                	jle    801090ca <sys_sleep+0x5a>
+    timerset(ticks0 + n, &ticks);
+801090ac:	83 ec 08             	sub    $0x8,%esp
+801090af:	01 d8                	add    %ebx,%eax
+801090b1:	68 40 35 14 80       	push   $0x80143540
+801090b6:	50                   	push   %eax
+801090b7:	e8 e4 03 00 00       	call   801094a0 <timerset>
+  while(ticks - ticks0 < n){
+801090bc:	8b 15 40 35 14 80    	mov    0x80143540,%edx
+801090c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+801090c5:	83 c4 10             	add    $0x10,%esp
+801090c8:	29 da                	sub    %ebx,%edx
+801090ca:	39 c2                	cmp    %eax,%edx
+801090cc:	72 23                	jb     801090f1 <sys_sleep+0x81>
+801090ce:	eb 58                	jmp    80109128 <sys_sleep+0xb8>
+    if(myproc()->killed){
+      timerdel(myproc());
+      release(&tickslock);
+      return -1;
+    }
+    sleep(&ticks, &tickslock);
+801090d0:	83 ec 08             	sub    $0x8,%esp
+801090d3:	68 60 35 14 80       	push   $0x80143560
+801090d8:	68 40 35 14 80       	push   $0x80143540
+801090dd:	e8 de e0 ff ff       	call   801071c0 <sleep>
+  while(ticks - ticks0 < n){
+801090e2:	a1 40 35 14 80       	mov    0x80143540,%eax
+801090e7:	83 c4 10             	add    $0x10,%esp
+801090ea:	29 d8                	sub    %ebx,%eax
+801090ec:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+801090ef:	73 37                	jae    80109128 <sys_sleep+0xb8>
+    if(myproc()->killed){
+801090f1:	e8 5a d4 ff ff       	call   80106550 <myproc>
+801090f6:	8b 40 40             	mov    0x40(%eax),%eax
+801090f9:	85 c0                	test   %eax,%eax
+801090fb:	74 d3                	je     801090d0 <sys_sleep+0x60>
+      timerdel(myproc());
+801090fd:	e8 4e d4 ff ff       	call   80106550 <myproc>
+80109102:	83 ec 0c             	sub    $0xc,%esp
+80109105:	50                   	push   %eax
+80109106:	e8 25 03 00 00       	call   80109430 <timerdel>
+      release(&tickslock);
+8010910b:	c7 04 24 60 35 14 80 	movl   $0x80143560,(%esp)
+80109112:	e8 a9 eb ff ff       	call   80107cc0 <release>
+      return -1;
+80109117:	83 c4 10             	add    $0x10,%esp
+  }
+  timerdel(myproc());
+  release(&tickslock);
+  return 0;
+}
+8010911a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return -1;
+8010911d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109122:	c9                   	leave
+80109123:	c3                   	ret
+80109124:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  timerdel(myproc());
+80109128:	e8 23 d4 ff ff       	call   80106550 <myproc>
+8010912d:	83 ec 0c             	sub    $0xc,%esp
+80109130:	50                   	push   %eax
+80109131:	e8 fa 02 00 00       	call   80109430 <timerdel>
+  release(&tickslock);
+80109136:	c7 04 24 60 35 14 80 	movl   $0x80143560,(%esp)
+8010913d:	e8 7e eb ff ff       	call   80107cc0 <release>
+}
+80109142:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return 0;
+80109145:	83 c4 10             	add    $0x10,%esp
+80109148:	31 c0                	xor    %eax,%eax
+}
+8010914a:	c9                   	leave
+8010914b:	c3                   	ret
+8010914c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80109150 <sys_uptime>:
+
+// return how many clock tick interrupts have occurred since start.
+int
+sys_uptime(void)
+{
+80109150:	55                   	push   %ebp
+80109151:	89 e5                	mov    %esp,%ebp
+80109153:	53                   	push   %ebx
+80109154:	83 ec 10             	sub    $0x10,%esp
+  uint xticks;
+
+  acquire(&tickslock);
+80109157:	68 60 35 14 80       	push   $0x80143560
+8010915c:	e8 bf eb ff ff       	call   80107d20 <acquire>
+  xticks = ticks;
+80109161:	8b 1d 40 35 14 80    	mov    0x80143540,%ebx
+  release(&tickslock);
+80109167:	c7 04 24 60 35 14 80 	movl   $0x80143560,(%esp)
+8010916e:	e8 4d eb ff ff       	call   80107cc0 <release>
+  return xticks;
+}
+80109173:	89 d8                	mov    %ebx,%eax
+80109175:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80109178:	c9                   	leave
+80109179:	c3                   	ret
+8010917a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80109180 <sys_nice>:
+   Kernel enforces value range [0..4].
+   Returns previous nice on success, -1 on failure.
+*/
+int
+sys_nice(void)
+{
+80109180:	55                   	push   %ebp
+80109181:	89 e5                	mov    %esp,%ebp
+80109183:	53                   	push   %ebx
+  int a0, a1;
+  int got0 = argint(0, &a0);
+80109184:	8d 45 f0             	lea    -0x10(%ebp),%eax
+{
+80109187:	83 ec 1c             	sub    $0x1c,%esp
+  int got0 = argint(0, &a0);
+8010918a:	50                   	push   %eax
+8010918b:	6a 00                	push   $0x0
+8010918d:	e8 5e ef ff ff       	call   801080f0 <argint>
+80109192:	89 c3                	mov    %eax,%ebx
+  int got1 = argint(1, &a1);
+80109194:	58                   	pop    %eax
+80109195:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109198:	5a                   	pop    %edx
+80109199:	50                   	push   %eax
+8010919a:	6a 01                	push   $0x1
+8010919c:	e8 4f ef ff ff       	call   801080f0 <argint>
+
+  if(got0 < 0)
+801091a1:	83 c4 10             	add    $0x10,%esp
+801091a4:	85 db                	test   %ebx,%ebx
+801091a6:	78 38                	js     801091e0 <sys_nice+0x60>
+    return -1;                 // at least one arg required
+
+  int pid, val;
+  if(got1 < 0){
+801091a8:	85 c0                	test   %eax,%eax
+801091aa:	78 24                	js     801091d0 <sys_nice+0x50>
+    // only one argument: treat as <value> for current process
+    pid = myproc()->pid;
+    val = a0;
+  } else {
+    // two arguments: <pid> <value>
+    pid = a0;
+801091ac:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    val = a1;
+801091af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  }
+
+  // hard range check in kernel
+  if (val < 0 || val > 4)
+801091b2:	83 f8 04             	cmp    $0x4,%eax
+801091b5:	77 29                	ja     801091e0 <sys_nice+0x60>
+    return -1;
+
+  extern int setnice(int pid, int value);  // in proc.c
+  return setnice(pid, val);                // returns previous nice or -1
+801091b7:	83 ec 08             	sub    $0x8,%esp
+801091ba:	50                   	push   %eax
+801091bb:	52                   	push   %edx
+801091bc:	e8 3f e5 ff ff       	call   80107700 <setnice>
+801091c1:	83 c4 10             	add    $0x10,%esp
+}
+801091c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801091c7:	c9                   	leave
+801091c8:	c3                   	ret
+801091c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    pid = myproc()->pid;
+801091d0:	e8 7b d3 ff ff       	call   80106550 <myproc>
+801091d5:	8b 50 10             	mov    0x10(%eax),%edx
+    val = a0;
+801091d8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+801091db:	eb d5                	jmp    801091b2 <sys_nice+0x32>
+801091dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;                 // at least one arg required
+801091e0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801091e5:	eb dd                	jmp    801091c4 <sys_nice+0x44>
+801091e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801091ee:	66 90                	xchg   %ax,%ax
+
+801091f0 <sys_settickets>:
+
+// Give process pid n tickets (STRIDE_SCHED).
+// Returns its previous tickets, or -1.
+int
+sys_settickets(void)
+{
+801091f0:	55                   	push   %ebp
+801091f1:	89 e5                	mov    %esp,%ebp
+801091f3:	83 ec 20             	sub    $0x20,%esp
+  int pid, n;
+
+  if(argint(0, &pid) < 0 || argint(1, &n) < 0)
+801091f6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801091f9:	50                   	push   %eax
+801091fa:	6a 00                	push   $0x0
+801091fc:	e8 ef ee ff ff       	call   801080f0 <argint>
+80109201:	83 c4 10             	add    $0x10,%esp
+80109204:	85 c0                	test   %eax,%eax
+80109206:	78 28                	js     80109230 <sys_settickets+0x40>
+80109208:	83 ec 08             	sub    $0x8,%esp
+8010920b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+8010920e:	50                   	push   %eax
+8010920f:	6a 01                	push   $0x1
+80109211:	e8 da ee ff ff       	call   801080f0 <argint>
+80109216:	83 c4 10             	add    $0x10,%esp
+80109219:	85 c0                	test   %eax,%eax
+8010921b:	78 13                	js     80109230 <sys_settickets+0x40>
+    return -1;
+  return settickets(pid, n);
+8010921d:	83 ec 08             	sub    $0x8,%esp
+80109220:	ff 75 f4             	push   -0xc(%ebp)
+80109223:	ff 75 f0             	push   -0x10(%ebp)
+80109226:	e8 25 e6 ff ff       	call   80107850 <settickets>
+8010922b:	83 c4 10             	add    $0x10,%esp
+}
+8010922e:	c9                   	leave
+8010922f:	c3                   	ret
+80109230:	c9                   	leave
+    return -1;
+80109231:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109236:	c3                   	ret
+80109237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010923e:	66 90                	xchg   %ax,%ax
+
+80109240 <sys_transfer>:
+
+// Lend the caller's tickets to process pid whenever
+// the caller blocks; pid 0 stops lending.
+int
+sys_transfer(void)
+{
+80109240:	55                   	push   %ebp
+80109241:	89 e5                	mov    %esp,%ebp
+80109243:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0, &pid) < 0)
+80109246:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80109249:	50                   	push   %eax
+8010924a:	6a 00                	push   $0x0
+8010924c:	e8 9f ee ff ff       	call   801080f0 <argint>
+80109251:	83 c4 10             	add    $0x10,%esp
+80109254:	85 c0                	test   %eax,%eax
+80109256:	78 18                	js     80109270 <sys_transfer+0x30>
+    return -1;
+  return lendtickets(pid);
+80109258:	83 ec 0c             	sub    $0xc,%esp
+8010925b:	ff 75 f4             	push   -0xc(%ebp)
+8010925e:	e8 fd e5 ff ff       	call   80107860 <lendtickets>
+80109263:	83 c4 10             	add    $0x10,%esp
+}
+80109266:	c9                   	leave
+80109267:	c3                   	ret
+80109268:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010926f:	90                   	nop
+80109270:	c9                   	leave
+    return -1;
+80109271:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109276:	c3                   	ret
+80109277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010927e:	66 90                	xchg   %ax,%ax
+
+80109280 <sys_uptimens>:
+
+// Store the nanoseconds since boot in *ns.
+int
+sys_uptimens(void)
+{
+80109280:	55                   	push   %ebp
+80109281:	89 e5                	mov    %esp,%ebp
+80109283:	53                   	push   %ebx
+  uint64 *ns;
+
+  if(argwptr(0, (char**)&ns, sizeof(*ns)) < 0)
+80109284:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80109287:	83 ec 18             	sub    $0x18,%esp
+  if(argwptr(0, (char**)&ns, sizeof(*ns)) < 0)
+8010928a:	6a 08                	push   $0x8
+8010928c:	50                   	push   %eax
+8010928d:	6a 00                	push   $0x0
+8010928f:	e8 0c ef ff ff       	call   801081a0 <argwptr>
+80109294:	83 c4 10             	add    $0x10,%esp
+80109297:	85 c0                	test   %eax,%eax
+80109299:	78 15                	js     801092b0 <sys_uptimens+0x30>
+    return -1;
+  *ns = nsecs();
+8010929b:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+8010929e:	e8 bd b2 ff ff       	call   80104560 <nsecs>
+801092a3:	89 53 04             	mov    %edx,0x4(%ebx)
+801092a6:	89 03                	mov    %eax,(%ebx)
+  return 0;
+801092a8:	31 c0                	xor    %eax,%eax
+}
+801092aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801092ad:	c9                   	leave
+801092ae:	c3                   	ret
+801092af:	90                   	nop
+    return -1;
+801092b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801092b5:	eb f3                	jmp    801092aa <sys_uptimens+0x2a>
+801092b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801092be:	66 90                	xchg   %ax,%ax
+
+801092c0 <sys_getpstat>:
+
+// Fill in up to n struct pstats, one per process.
+// Returns the number filled in.
+int
+sys_getpstat(void)
+{
+801092c0:	55                   	push   %ebp
+801092c1:	89 e5                	mov    %esp,%ebp
+801092c3:	83 ec 20             	sub    $0x20,%esp
+  char *ps;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0)
+801092c6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801092c9:	50                   	push   %eax
+801092ca:	6a 01                	push   $0x1
+801092cc:	e8 1f ee ff ff       	call   801080f0 <argint>
+801092d1:	83 c4 10             	add    $0x10,%esp
+801092d4:	85 c0                	test   %eax,%eax
+801092d6:	78 48                	js     80109320 <sys_getpstat+0x60>
+801092d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+801092db:	85 c0                	test   %eax,%eax
+801092dd:	78 41                	js     80109320 <sys_getpstat+0x60>
+    return -1;
+  if(n > NPROC)
+801092df:	83 f8 40             	cmp    $0x40,%eax
+801092e2:	7f 2c                	jg     80109310 <sys_getpstat+0x50>
+    n = NPROC;
+  if(argptr(0, &ps, n*sizeof(struct pstat)) < 0)
+801092e4:	6b c0 38             	imul   $0x38,%eax,%eax
+801092e7:	83 ec 04             	sub    $0x4,%esp
+801092ea:	50                   	push   %eax
+801092eb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+801092ee:	50                   	push   %eax
+801092ef:	6a 00                	push   $0x0
+801092f1:	e8 2a ee ff ff       	call   80108120 <argptr>
+801092f6:	83 c4 10             	add    $0x10,%esp
+801092f9:	85 c0                	test   %eax,%eax
+801092fb:	78 23                	js     80109320 <sys_getpstat+0x60>
+    return -1;
+  return getpstat((uint)ps, n);
+801092fd:	83 ec 08             	sub    $0x8,%esp
+80109300:	ff 75 f4             	push   -0xc(%ebp)
+80109303:	ff 75 f0             	push   -0x10(%ebp)
+80109306:	e8 65 e5 ff ff       	call   80107870 <getpstat>
+8010930b:	83 c4 10             	add    $0x10,%esp
+}
+8010930e:	c9                   	leave
+8010930f:	c3                   	ret
+    n = NPROC;
+80109310:	c7 45 f4 40 00 00 00 	movl   $0x40,-0xc(%ebp)
+80109317:	b8 00 0e 00 00       	mov    $0xe00,%eax
+8010931c:	eb c9                	jmp    801092e7 <sys_getpstat+0x27>
+8010931e:	66 90                	xchg   %ax,%ax
+}
+80109320:	c9                   	leave
+    return -1;
+80109321:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109326:	c3                   	ret
+80109327:	66 90                	xchg   %ax,%ax
+80109329:	66 90                	xchg   %ax,%ax
+8010932b:	66 90                	xchg   %ax,%ax
+8010932d:	66 90                	xchg   %ax,%ax
+8010932f:	90                   	nop
+
+80109330 <wheeladd>:
+static uint wheelnow;   // next tick whose slot has yet to fire
+
+// Put p in the slot for p->expire.
+static void
+wheeladd(struct proc *p)
+{
+80109330:	55                   	push   %ebp
+  struct proc **slot;
+  uint t, delta;
+  int lvl;
+
+  t = p->expire;
+  if((int)(t - wheelnow) < 0)
+80109331:	8b 15 20 31 14 80    	mov    0x80143120,%edx
+{
+80109337:	89 c1                	mov    %eax,%ecx
+80109339:	89 e5                	mov    %esp,%ebp
+8010933b:	57                   	push   %edi
+8010933c:	56                   	push   %esi
+8010933d:	53                   	push   %ebx
+  t = p->expire;
+8010933e:	8b 98 e8 00 00 00    	mov    0xe8(%eax),%ebx
+  if((int)(t - wheelnow) < 0)
+80109344:	89 d8                	mov    %ebx,%eax
+80109346:	29 d0                	sub    %edx,%eax
+80109348:	0f 88 82 00 00 00    	js     801093d0 <wheeladd+0xa0>
+    t = wheelnow;               // already due: fire next time
+  delta = t - wheelnow;
+  for(lvl = 0; lvl < NLEVEL-1; lvl++)
+    if(delta < 1 << ((lvl+1)*WHEELBITS))
+8010934e:	83 f8 3f             	cmp    $0x3f,%eax
+80109351:	76 77                	jbe    801093ca <wheeladd+0x9a>
+80109353:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+80109358:	0f 86 9a 00 00 00    	jbe    801093f8 <wheeladd+0xc8>
+8010935e:	3d ff ff 03 00       	cmp    $0x3ffff,%eax
+80109363:	0f 86 a7 00 00 00    	jbe    80109410 <wheeladd+0xe0>
+      break;
+  if(lvl == NLEVEL-1 && delta >= 1 << (NLEVEL*WHEELBITS))
+80109369:	3d ff ff ff 00       	cmp    $0xffffff,%eax
+8010936e:	76 70                	jbe    801093e0 <wheeladd+0xb0>
+    t = wheelnow + (1 << (NLEVEL*WHEELBITS)) - 1;
+80109370:	81 c2 ff ff ff 00    	add    $0xffffff,%edx
+  slot = &wheel[lvl][(t >> (lvl*WHEELBITS)) & WHEELMASK];
+80109376:	bb c0 00 00 00       	mov    $0xc0,%ebx
+8010937b:	b8 03 00 00 00       	mov    $0x3,%eax
+80109380:	c1 ea 12             	shr    $0x12,%edx
+80109383:	83 e2 3f             	and    $0x3f,%edx
+80109386:	01 d3                	add    %edx,%ebx
+80109388:	8d 34 9d 40 31 14 80 	lea    -0x7febcec0(,%ebx,4),%esi
+
+  p->tnext = *slot;
+8010938f:	89 c3                	mov    %eax,%ebx
+80109391:	c1 e3 06             	shl    $0x6,%ebx
+80109394:	01 d3                	add    %edx,%ebx
+80109396:	8b 1c 9d 40 31 14 80 	mov    -0x7febcec0(,%ebx,4),%ebx
+8010939d:	89 99 f0 00 00 00    	mov    %ebx,0xf0(%ecx)
+  if(*slot)
+801093a3:	85 db                	test   %ebx,%ebx
+801093a5:	74 0c                	je     801093b3 <wheeladd+0x83>
+    (*slot)->tprev = &p->tnext;
+801093a7:	8d b9 f0 00 00 00    	lea    0xf0(%ecx),%edi
+801093ad:	89 bb f4 00 00 00    	mov    %edi,0xf4(%ebx)
+  p->tprev = slot;
+  *slot = p;
+801093b3:	c1 e0 06             	shl    $0x6,%eax
+}
+801093b6:	5b                   	pop    %ebx
+  p->tprev = slot;
+801093b7:	89 b1 f4 00 00 00    	mov    %esi,0xf4(%ecx)
+  *slot = p;
+801093bd:	01 d0                	add    %edx,%eax
+}
+801093bf:	5e                   	pop    %esi
+801093c0:	5f                   	pop    %edi
+  *slot = p;
+801093c1:	89 0c 85 40 31 14 80 	mov    %ecx,-0x7febcec0(,%eax,4)
+}
+801093c8:	5d                   	pop    %ebp
+801093c9:	c3                   	ret
+    if(delta < 1 << ((lvl+1)*WHEELBITS))
+801093ca:	89 da                	mov    %ebx,%edx
+801093cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801093d0:	31 db                	xor    %ebx,%ebx
+  for(lvl = 0; lvl < NLEVEL-1; lvl++)
+801093d2:	31 c0                	xor    %eax,%eax
+801093d4:	eb ad                	jmp    80109383 <wheeladd+0x53>
+801093d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801093dd:	8d 76 00             	lea    0x0(%esi),%esi
+  slot = &wheel[lvl][(t >> (lvl*WHEELBITS)) & WHEELMASK];
+801093e0:	89 da                	mov    %ebx,%edx
+801093e2:	b8 03 00 00 00       	mov    $0x3,%eax
+801093e7:	bb c0 00 00 00       	mov    $0xc0,%ebx
+801093ec:	c1 ea 12             	shr    $0x12,%edx
+801093ef:	eb 92                	jmp    80109383 <wheeladd+0x53>
+801093f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801093f8:	89 da                	mov    %ebx,%edx
+    if(delta < 1 << ((lvl+1)*WHEELBITS))
+801093fa:	b8 01 00 00 00       	mov    $0x1,%eax
+  slot = &wheel[lvl][(t >> (lvl*WHEELBITS)) & WHEELMASK];
+801093ff:	bb 40 00 00 00       	mov    $0x40,%ebx
+80109404:	c1 ea 06             	shr    $0x6,%edx
+80109407:	e9 77 ff ff ff       	jmp    80109383 <wheeladd+0x53>
+8010940c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80109410:	89 da                	mov    %ebx,%edx
+    if(delta < 1 << ((lvl+1)*WHEELBITS))
+80109412:	b8 02 00 00 00       	mov    $0x2,%eax
+  slot = &wheel[lvl][(t >> (lvl*WHEELBITS)) & WHEELMASK];
+80109417:	bb 80 00 00 00       	mov    $0x80,%ebx
+8010941c:	c1 ea 0c             	shr    $0xc,%edx
+8010941f:	e9 5f ff ff ff       	jmp    80109383 <wheeladd+0x53>
+80109424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010942b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010942f:	90                   	nop
+
+80109430 <timerdel>:
+
+// Take p off the wheel, if it is on it.
+void
+timerdel(struct proc *p)
+{
+80109430:	55                   	push   %ebp
+80109431:	89 e5                	mov    %esp,%ebp
+80109433:	53                   	push   %ebx
+80109434:	83 ec 10             	sub    $0x10,%esp
+80109437:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holding(&tickslock))
+8010943a:	68 60 35 14 80       	push   $0x80143560
+8010943f:	e8 3c e8 ff ff       	call   80107c80 <holding>
+80109444:	83 c4 10             	add    $0x10,%esp
+80109447:	85 c0                	test   %eax,%eax
+80109449:	74 3b                	je     80109486 <timerdel+0x56>
+    panic("timerdel");
+  if(p->tprev == 0)
+8010944b:	8b 93 f4 00 00 00    	mov    0xf4(%ebx),%edx
+80109451:	85 d2                	test   %edx,%edx
+80109453:	74 2c                	je     80109481 <timerdel+0x51>
+    return;
+  *p->tprev = p->tnext;
+80109455:	8b 83 f0 00 00 00    	mov    0xf0(%ebx),%eax
+8010945b:	89 02                	mov    %eax,(%edx)
+  if(p->tnext)
+8010945d:	85 c0                	test   %eax,%eax
+8010945f:	74 0c                	je     8010946d <timerdel+0x3d>
+    p->tnext->tprev = p->tprev;
+80109461:	8b 93 f4 00 00 00    	mov    0xf4(%ebx),%edx
+80109467:	89 90 f4 00 00 00    	mov    %edx,0xf4(%eax)
+  p->tnext = 0;
+8010946d:	c7 83 f0 00 00 00 00 	movl   $0x0,0xf0(%ebx)
+80109474:	00 00 00 
+  p->tprev = 0;
+80109477:	c7 83 f4 00 00 00 00 	movl   $0x0,0xf4(%ebx)
+8010947e:	00 00 00 
+}
+80109481:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80109484:	c9                   	leave
+80109485:	c3                   	ret
+    panic("timerdel");
+80109486:	83 ec 0c             	sub    $0xc,%esp
+80109489:	68 c5 bd 10 80       	push   $0x8010bdc5
+8010948e:	e8 ed 73 ff ff       	call   80100880 <panic>
+80109493:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010949a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801094a0 <timerset>:
+// Arrange for the current process to be woken from a sleep
+// on chan at tick t. Replaces any timer it already has.
+// Caller holds tickslock.
+void
+timerset(uint t, void *chan)
+{
+801094a0:	55                   	push   %ebp
+801094a1:	89 e5                	mov    %esp,%ebp
+801094a3:	57                   	push   %edi
+801094a4:	56                   	push   %esi
+801094a5:	53                   	push   %ebx
+801094a6:	83 ec 0c             	sub    $0xc,%esp
+801094a9:	8b 7d 08             	mov    0x8(%ebp),%edi
+801094ac:	8b 75 0c             	mov    0xc(%ebp),%esi
+  struct proc *p = myproc();
+801094af:	e8 9c d0 ff ff       	call   80106550 <myproc>
+  if(!holding(&tickslock))
+801094b4:	83 ec 0c             	sub    $0xc,%esp
+801094b7:	68 60 35 14 80       	push   $0x80143560
+  struct proc *p = myproc();
+801094bc:	89 c3                	mov    %eax,%ebx
+  if(!holding(&tickslock))
+801094be:	e8 bd e7 ff ff       	call   80107c80 <holding>
+801094c3:	83 c4 10             	add    $0x10,%esp
+801094c6:	85 c0                	test   %eax,%eax
+801094c8:	74 50                	je     8010951a <timerset+0x7a>
+  if(p->tprev == 0)
+801094ca:	8b 93 f4 00 00 00    	mov    0xf4(%ebx),%edx
+801094d0:	85 d2                	test   %edx,%edx
+801094d2:	74 2c                	je     80109500 <timerset+0x60>
+  *p->tprev = p->tnext;
+801094d4:	8b 83 f0 00 00 00    	mov    0xf0(%ebx),%eax
+801094da:	89 02                	mov    %eax,(%edx)
+  if(p->tnext)
+801094dc:	85 c0                	test   %eax,%eax
+801094de:	74 0c                	je     801094ec <timerset+0x4c>
+    p->tnext->tprev = p->tprev;
+801094e0:	8b 93 f4 00 00 00    	mov    0xf4(%ebx),%edx
+801094e6:	89 90 f4 00 00 00    	mov    %edx,0xf4(%eax)
+  p->tnext = 0;
+801094ec:	c7 83 f0 00 00 00 00 	movl   $0x0,0xf0(%ebx)
+801094f3:	00 00 00 
+  p->tprev = 0;
+801094f6:	c7 83 f4 00 00 00 00 	movl   $0x0,0xf4(%ebx)
+801094fd:	00 00 00 
+
+  timerdel(p);
+  p->expire = t;
+80109500:	89 bb e8 00 00 00    	mov    %edi,0xe8(%ebx)
+  p->tchan = chan;
+  wheeladd(p);
+80109506:	89 d8                	mov    %ebx,%eax
+  p->tchan = chan;
+80109508:	89 b3 ec 00 00 00    	mov    %esi,0xec(%ebx)
+}
+8010950e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109511:	5b                   	pop    %ebx
+80109512:	5e                   	pop    %esi
+80109513:	5f                   	pop    %edi
+80109514:	5d                   	pop    %ebp
+  wheeladd(p);
+80109515:	e9 16 fe ff ff       	jmp    80109330 <wheeladd>
+    panic("timerdel");
+8010951a:	83 ec 0c             	sub    $0xc,%esp
+8010951d:	68 c5 bd 10 80       	push   $0x8010bdc5
+80109522:	e8 59 73 ff ff       	call   80100880 <panic>
+80109527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010952e:	66 90                	xchg   %ax,%ax
+
+80109530 <timerrun>:
+
+// Run the wheel up to ticks, waking the processes that are
+// due. Called from the timer interrupt with tickslock held.
+void
+timerrun(void)
+{
+80109530:	55                   	push   %ebp
+80109531:	89 e5                	mov    %esp,%ebp
+80109533:	57                   	push   %edi
+80109534:	56                   	push   %esi
+80109535:	53                   	push   %ebx
+80109536:	83 ec 0c             	sub    $0xc,%esp
+  struct proc *p, *next;
+  int lvl;
+
+  while((int)(ticks - wheelnow) >= 0){
+80109539:	8b 35 20 31 14 80    	mov    0x80143120,%esi
+8010953f:	39 35 40 35 14 80    	cmp    %esi,0x80143540
+80109545:	0f 88 fe 00 00 00    	js     80109649 <timerrun+0x119>
+8010954b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010954f:	90                   	nop
+    // Bring down the coming runs of the levels above.
+    for(lvl = NLEVEL-1; lvl > 0; lvl--){
+80109550:	bb 03 00 00 00       	mov    $0x3,%ebx
+80109555:	eb 0e                	jmp    80109565 <timerrun+0x35>
+80109557:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010955e:	66 90                	xchg   %ax,%ax
+80109560:	83 eb 01             	sub    $0x1,%ebx
+80109563:	74 6b                	je     801095d0 <timerrun+0xa0>
+      if(wheelnow & ((1 << (lvl*WHEELBITS)) - 1))
+80109565:	8d 0c 5b             	lea    (%ebx,%ebx,2),%ecx
+80109568:	b8 01 00 00 00       	mov    $0x1,%eax
+8010956d:	01 c9                	add    %ecx,%ecx
+8010956f:	d3 e0                	shl    %cl,%eax
+80109571:	83 e8 01             	sub    $0x1,%eax
+80109574:	85 f0                	test   %esi,%eax
+80109576:	75 e8                	jne    80109560 <timerrun+0x30>
+        continue;
+      p = slottake(&wheel[lvl][(wheelnow >> (lvl*WHEELBITS)) & WHEELMASK]);
+80109578:	89 f2                	mov    %esi,%edx
+  p = *slot;
+8010957a:	89 d8                	mov    %ebx,%eax
+      p = slottake(&wheel[lvl][(wheelnow >> (lvl*WHEELBITS)) & WHEELMASK]);
+8010957c:	d3 ea                	shr    %cl,%edx
+  p = *slot;
+8010957e:	c1 e0 06             	shl    $0x6,%eax
+      p = slottake(&wheel[lvl][(wheelnow >> (lvl*WHEELBITS)) & WHEELMASK]);
+80109581:	83 e2 3f             	and    $0x3f,%edx
+  p = *slot;
+80109584:	01 d0                	add    %edx,%eax
+80109586:	8b 3c 85 40 31 14 80 	mov    -0x7febcec0(,%eax,4),%edi
+  *slot = 0;
+8010958d:	c7 04 85 40 31 14 80 	movl   $0x0,-0x7febcec0(,%eax,4)
+80109594:	00 00 00 00 
+  if(p)
+80109598:	85 ff                	test   %edi,%edi
+8010959a:	74 c4                	je     80109560 <timerrun+0x30>
+    p->tprev = 0;
+8010959c:	c7 87 f4 00 00 00 00 	movl   $0x0,0xf4(%edi)
+801095a3:	00 00 00 
+      for(; p; p = next){
+801095a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801095ad:	8d 76 00             	lea    0x0(%esi),%esi
+        next = p->tnext;
+801095b0:	89 f8                	mov    %edi,%eax
+801095b2:	8b bf f0 00 00 00    	mov    0xf0(%edi),%edi
+        p->tprev = 0;
+801095b8:	c7 80 f4 00 00 00 00 	movl   $0x0,0xf4(%eax)
+801095bf:	00 00 00 
+        wheeladd(p);
+801095c2:	e8 69 fd ff ff       	call   80109330 <wheeladd>
+      for(; p; p = next){
+801095c7:	85 ff                	test   %edi,%edi
+801095c9:	75 e5                	jne    801095b0 <timerrun+0x80>
+    for(lvl = NLEVEL-1; lvl > 0; lvl--){
+801095cb:	83 eb 01             	sub    $0x1,%ebx
+801095ce:	75 95                	jne    80109565 <timerrun+0x35>
+      }
+    }
+
+    p = slottake(&wheel[0][wheelnow & WHEELMASK]);
+801095d0:	89 f0                	mov    %esi,%eax
+    wheelnow++;
+801095d2:	83 c6 01             	add    $0x1,%esi
+    p = slottake(&wheel[0][wheelnow & WHEELMASK]);
+801095d5:	83 e0 3f             	and    $0x3f,%eax
+  p = *slot;
+801095d8:	8b 1c 85 40 31 14 80 	mov    -0x7febcec0(,%eax,4),%ebx
+  *slot = 0;
+801095df:	c7 04 85 40 31 14 80 	movl   $0x0,-0x7febcec0(,%eax,4)
+801095e6:	00 00 00 00 
+  if(p)
+801095ea:	85 db                	test   %ebx,%ebx
+801095ec:	74 6a                	je     80109658 <timerrun+0x128>
+    p->tprev = 0;
+801095ee:	c7 83 f4 00 00 00 00 	movl   $0x0,0xf4(%ebx)
+801095f5:	00 00 00 
+    wheelnow++;
+801095f8:	89 35 20 31 14 80    	mov    %esi,0x80143120
+    for(; p; p = next){
+801095fe:	eb 04                	jmp    80109604 <timerrun+0xd4>
+80109600:	85 db                	test   %ebx,%ebx
+80109602:	74 33                	je     80109637 <timerrun+0x107>
+      next = p->tnext;
+80109604:	89 de                	mov    %ebx,%esi
+      p->tprev = 0;
+      // If p has not got as far as sleeping yet,
+      // try again next tick.
+      if(!wakeproc(p, p->tchan))
+80109606:	83 ec 08             	sub    $0x8,%esp
+      next = p->tnext;
+80109609:	8b 9b f0 00 00 00    	mov    0xf0(%ebx),%ebx
+      p->tprev = 0;
+8010960f:	c7 86 f4 00 00 00 00 	movl   $0x0,0xf4(%esi)
+80109616:	00 00 00 
+      if(!wakeproc(p, p->tchan))
+80109619:	ff b6 ec 00 00 00    	push   0xec(%esi)
+8010961f:	56                   	push   %esi
+80109620:	e8 6b de ff ff       	call   80107490 <wakeproc>
+80109625:	83 c4 10             	add    $0x10,%esp
+80109628:	85 c0                	test   %eax,%eax
+8010962a:	75 d4                	jne    80109600 <timerrun+0xd0>
+        wheeladd(p);
+8010962c:	89 f0                	mov    %esi,%eax
+8010962e:	e8 fd fc ff ff       	call   80109330 <wheeladd>
+    for(; p; p = next){
+80109633:	85 db                	test   %ebx,%ebx
+80109635:	75 cd                	jne    80109604 <timerrun+0xd4>
+  while((int)(ticks - wheelnow) >= 0){
+80109637:	8b 35 20 31 14 80    	mov    0x80143120,%esi
+8010963d:	39 35 40 35 14 80    	cmp    %esi,0x80143540
+80109643:	0f 89 07 ff ff ff    	jns    80109550 <timerrun+0x20>
+    }
+  }
+}
+80109649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010964c:	5b                   	pop    %ebx
+8010964d:	5e                   	pop    %esi
+8010964e:	5f                   	pop    %edi
+8010964f:	5d                   	pop    %ebp
+80109650:	c3                   	ret
+80109651:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    wheelnow++;
+80109658:	89 35 20 31 14 80    	mov    %esi,0x80143120
+    for(; p; p = next){
+8010965e:	eb dd                	jmp    8010963d <timerrun+0x10d>
+
+80109660 <timernext>:
+// scan stops where level 1 next cascades down, since timers
+// there are not yet sorted into ticks.
+// Caller holds tickslock.
+uint
+timernext(void)
+{
+80109660:	55                   	push   %ebp
+  uint i;
+
+  for(i = 0; i < WHEELSIZE; i++){
+80109661:	31 d2                	xor    %edx,%edx
+{
+80109663:	89 e5                	mov    %esp,%ebp
+80109665:	53                   	push   %ebx
+    if(wheel[0][(wheelnow + i) & WHEELMASK])
+80109666:	8b 1d 20 31 14 80    	mov    0x80143120,%ebx
+8010966c:	eb 12                	jmp    80109680 <timernext+0x20>
+8010966e:	66 90                	xchg   %ax,%ax
+      return wheelnow + i - ticks;
+    if(i > 0 && ((wheelnow + i) & WHEELMASK) == 0)
+80109670:	85 c9                	test   %ecx,%ecx
+80109672:	75 04                	jne    80109678 <timernext+0x18>
+80109674:	85 d2                	test   %edx,%edx
+80109676:	75 28                	jne    801096a0 <timernext+0x40>
+  for(i = 0; i < WHEELSIZE; i++){
+80109678:	83 c2 01             	add    $0x1,%edx
+8010967b:	83 fa 40             	cmp    $0x40,%edx
+8010967e:	74 20                	je     801096a0 <timernext+0x40>
+    if(wheel[0][(wheelnow + i) & WHEELMASK])
+80109680:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+80109683:	89 c1                	mov    %eax,%ecx
+80109685:	83 e1 3f             	and    $0x3f,%ecx
+80109688:	83 3c 8d 40 31 14 80 	cmpl   $0x0,-0x7febcec0(,%ecx,4)
+8010968f:	00 
+80109690:	74 de                	je     80109670 <timernext+0x10>
+      return wheelnow + i - ticks;
+80109692:	2b 05 40 35 14 80    	sub    0x80143540,%eax
+      break;    // level 1 comes down here
+  }
+  return wheelnow + i - ticks;
+}
+80109698:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010969b:	c9                   	leave
+8010969c:	c3                   	ret
+8010969d:	8d 76 00             	lea    0x0(%esi),%esi
+  return wheelnow + i - ticks;
+801096a0:	2b 1d 40 35 14 80    	sub    0x80143540,%ebx
+801096a6:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+}
+801096a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801096ac:	c9                   	leave
+801096ad:	c3                   	ret
+
+801096ae <alltraps>:
+
+  # vectors.S sends all traps here.
+.globl alltraps
+alltraps:
+  # Build trap frame.
+  pushl %ds
+801096ae:	1e                   	push   %ds
+  pushl %es
+801096af:	06                   	push   %es
+  pushl %fs
+801096b0:	0f a0                	push   %fs
+  pushl %gs
+801096b2:	0f a8                	push   %gs
+  pushal
+801096b4:	60                   	pusha
+  
+  # Set up data segments.
+  movw $(SEG_KDATA<<3), %ax
+801096b5:	66 b8 10 00          	mov    $0x10,%ax
+  movw %ax, %ds
+801096b9:	8e d8                	mov    %eax,%ds
+  movw %ax, %es
+801096bb:	8e c0                	mov    %eax,%es
+
+  # Call trap(tf), where tf=%esp
+  pushl %esp
+801096bd:	54                   	push   %esp
+  call trap
+801096be:	e8 0d 01 00 00       	call   801097d0 <trap>
+  addl $4, %esp
+801096c3:	83 c4 04             	add    $0x4,%esp
+
+801096c6 <trapret>:
+
+  # Return falls through to trapret...
+.globl trapret
+trapret:
+  popal
+801096c6:	61                   	popa
+  popl %gs
+801096c7:	0f a9                	pop    %gs
+  popl %fs
+801096c9:	0f a1                	pop    %fs
+  popl %es
+801096cb:	07                   	pop    %es
+  popl %ds
+801096cc:	1f                   	pop    %ds
+  addl $0x8, %esp  # trapno and errcode
+801096cd:	83 c4 08             	add    $0x8,%esp
+  iret
+801096d0:	cf                   	iret
+801096d1:	66 90                	xchg   %ax,%ax
+801096d3:	66 90                	xchg   %ax,%ax
+801096d5:	66 90                	xchg   %ax,%ax
+801096d7:	66 90                	xchg   %ax,%ax
+801096d9:	66 90                	xchg   %ax,%ax
+801096db:	66 90                	xchg   %ax,%ax
+801096dd:	66 90                	xchg   %ax,%ax
+801096df:	90                   	nop
+
+801096e0 <tvinit>:
+
+#define IDLEMAX HZ  // longest an idle CPU goes without a tick
+
+void
+tvinit(void)
+{
+801096e0:	55                   	push   %ebp
+  int i;
+
+  for(i = 0; i < 256; i++)
+801096e1:	31 c0                	xor    %eax,%eax
+{
+801096e3:	89 e5                	mov    %esp,%ebp
+801096e5:	83 ec 08             	sub    $0x8,%esp
+801096e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801096ef:	90                   	nop
+    SETGATE(idt[i], 0, SEG_KCODE<<3, vectors[i], 0);
+801096f0:	8b 14 85 08 f0 10 80 	mov    -0x7fef0ff8(,%eax,4),%edx
+801096f7:	c7 04 c5 a2 35 14 80 	movl   $0x8e000008,-0x7febca5e(,%eax,8)
+801096fe:	08 00 00 8e 
+80109702:	66 89 14 c5 a0 35 14 	mov    %dx,-0x7febca60(,%eax,8)
+80109709:	80 
+8010970a:	c1 ea 10             	shr    $0x10,%edx
+8010970d:	66 89 14 c5 a6 35 14 	mov    %dx,-0x7febca5a(,%eax,8)
+80109714:	80 
+  for(i = 0; i < 256; i++)
+80109715:	83 c0 01             	add    $0x1,%eax
+80109718:	3d 00 01 00 00       	cmp    $0x100,%eax
+8010971d:	75 d1                	jne    801096f0 <tvinit+0x10>
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+8010971f:	a1 08 f1 10 80       	mov    0x8010f108,%eax
+
+  initlock(&tickslock, "time");
+80109724:	83 ec 08             	sub    $0x8,%esp
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+80109727:	c7 05 a2 37 14 80 08 	movl   $0xef000008,0x801437a2
+8010972e:	00 00 ef 
+80109731:	66 a3 a0 37 14 80    	mov    %ax,0x801437a0
+80109737:	c1 e8 10             	shr    $0x10,%eax
+8010973a:	66 a3 a6 37 14 80    	mov    %ax,0x801437a6
+  initlock(&tickslock, "time");
+80109740:	68 ce bd 10 80       	push   $0x8010bdce
+80109745:	68 60 35 14 80       	push   $0x80143560
+8010974a:	e8 f1 e3 ff ff       	call   80107b40 <initlock>
+}
+8010974f:	83 c4 10             	add    $0x10,%esp
+80109752:	c9                   	leave
+80109753:	c3                   	ret
+80109754:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010975b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010975f:	90                   	nop
+
+80109760 <idtinit>:
+
+void
+idtinit(void)
+{
+80109760:	55                   	push   %ebp
+  pd[0] = size-1;
+80109761:	b8 ff 07 00 00       	mov    $0x7ff,%eax
+80109766:	89 e5                	mov    %esp,%ebp
+80109768:	83 ec 10             	sub    $0x10,%esp
+8010976b:	66 89 45 fa          	mov    %ax,-0x6(%ebp)
+  pd[1] = (uint)p;
+8010976f:	b8 a0 35 14 80       	mov    $0x801435a0,%eax
+80109774:	66 89 45 fc          	mov    %ax,-0x4(%ebp)
+  pd[2] = (uint)p >> 16;
+80109778:	c1 e8 10             	shr    $0x10,%eax
+8010977b:	66 89 45 fe          	mov    %ax,-0x2(%ebp)
+  asm volatile("lidt (%0)" : : "r" (pd));
+8010977f:	8d 45 fa             	lea    -0x6(%ebp),%eax
+80109782:	0f 01 18             	lidtl  (%eax)
+  lidt(idt, sizeof(idt));
+}
+80109785:	c9                   	leave
+80109786:	c3                   	ret
+80109787:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010978e:	66 90                	xchg   %ax,%ax
+
+80109790 <idleticks>:
+
+// How many ticks an idle CPU may leave its timer off for.
+uint
+idleticks(void)
+{
+80109790:	55                   	push   %ebp
+80109791:	89 e5                	mov    %esp,%ebp
+80109793:	53                   	push   %ebx
+80109794:	83 ec 10             	sub    $0x10,%esp
+  uint n;
+
+  acquire(&tickslock);
+80109797:	68 60 35 14 80       	push   $0x80143560
+8010979c:	e8 7f e5 ff ff       	call   80107d20 <acquire>
+  n = timernext();
+801097a1:	e8 ba fe ff ff       	call   80109660 <timernext>
+  release(&tickslock);
+801097a6:	c7 04 24 60 35 14 80 	movl   $0x80143560,(%esp)
+  n = timernext();
+801097ad:	89 c3                	mov    %eax,%ebx
+  release(&tickslock);
+801097af:	e8 0c e5 ff ff       	call   80107cc0 <release>
+  if(n > IDLEMAX)
+    n = IDLEMAX;
+  return n > 0 ? n : 1;
+801097b4:	85 db                	test   %ebx,%ebx
+801097b6:	b8 01 00 00 00       	mov    $0x1,%eax
+801097bb:	ba 64 00 00 00       	mov    $0x64,%edx
+801097c0:	0f 45 c3             	cmovne %ebx,%eax
+}
+801097c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801097c6:	c9                   	leave
+  return n > 0 ? n : 1;
+801097c7:	39 d0                	cmp    %edx,%eax
+801097c9:	0f 47 c2             	cmova  %edx,%eax
+}
+801097cc:	c3                   	ret
+801097cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+801097d0 <trap>:
+}
+
+//PAGEBREAK: 41
+void
+trap(struct trapframe *tf)
+{
+801097d0:	55                   	push   %ebp
+801097d1:	89 e5                	mov    %esp,%ebp
+801097d3:	57                   	push   %edi
+801097d4:	56                   	push   %esi
+801097d5:	53                   	push   %ebx
+801097d6:	83 ec 1c             	sub    $0x1c,%esp
+801097d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(tf->trapno == T_SYSCALL){
+801097dc:	8b 43 30             	mov    0x30(%ebx),%eax
+801097df:	83 f8 40             	cmp    $0x40,%eax
+801097e2:	0f 84 68 01 00 00    	je     80109950 <trap+0x180>
+    if(myproc()->killed)
+      exit();
+    return;
+  }
+
+  switch(tf->trapno){
+801097e8:	83 e8 0e             	sub    $0xe,%eax
+801097eb:	83 f8 31             	cmp    $0x31,%eax
+801097ee:	0f 87 ac 00 00 00    	ja     801098a0 <trap+0xd0>
+801097f4:	ff 24 85 74 be 10 80 	jmp    *-0x7fef418c(,%eax,4)
+801097fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801097ff:	90                   	nop
+  case T_IRQ0 + IRQ_WAKEUP:
+    // Work was queued for this CPU while it was idle.
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_IDE:
+    ideintr();
+80109800:	e8 fb a2 ff ff       	call   80103b00 <ideintr>
+    lapiceoi();
+80109805:	e8 46 b0 ff ff       	call   80104850 <lapiceoi>
+  }
+
+  // Force process exit if it has been killed and is in user space.
+  // (If it is still executing in the kernel, let it keep running
+  // until it gets to the regular system call return.)
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+8010980a:	e8 41 cd ff ff       	call   80106550 <myproc>
+8010980f:	85 c0                	test   %eax,%eax
+80109811:	74 1d                	je     80109830 <trap+0x60>
+80109813:	e8 38 cd ff ff       	call   80106550 <myproc>
+80109818:	8b 50 40             	mov    0x40(%eax),%edx
+8010981b:	85 d2                	test   %edx,%edx
+8010981d:	74 11                	je     80109830 <trap+0x60>
+8010981f:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80109823:	83 e0 03             	and    $0x3,%eax
+80109826:	66 83 f8 03          	cmp    $0x3,%ax
+8010982a:	0f 84 20 02 00 00    	je     80109a50 <trap+0x280>
+    exit();
+
+  // Force process to give up CPU on clock tick.
+  // If interrupts were on while locks held, would need to check nlock.
+  if(myproc() && myproc()->state == RUNNING &&
+80109830:	e8 1b cd ff ff       	call   80106550 <myproc>
+80109835:	85 c0                	test   %eax,%eax
+80109837:	74 0f                	je     80109848 <trap+0x78>
+80109839:	e8 12 cd ff ff       	call   80106550 <myproc>
+8010983e:	83 78 0c 04          	cmpl   $0x4,0xc(%eax)
+80109842:	0f 84 e0 00 00 00    	je     80109928 <trap+0x158>
+     tf->trapno == T_IRQ0+IRQ_TIMER && timeslice())
+    yield();
+
+  // Check if the process has been killed since we yielded
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+80109848:	e8 03 cd ff ff       	call   80106550 <myproc>
+8010984d:	85 c0                	test   %eax,%eax
+8010984f:	74 1d                	je     8010986e <trap+0x9e>
+80109851:	e8 fa cc ff ff       	call   80106550 <myproc>
+80109856:	8b 40 40             	mov    0x40(%eax),%eax
+80109859:	85 c0                	test   %eax,%eax
+8010985b:	74 11                	je     8010986e <trap+0x9e>
+8010985d:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80109861:	83 e0 03             	and    $0x3,%eax
+80109864:	66 83 f8 03          	cmp    $0x3,%ax
+80109868:	0f 84 0f 01 00 00    	je     8010997d <trap+0x1ad>
+    exit();
+}
+8010986e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109871:	5b                   	pop    %ebx
+80109872:	5e                   	pop    %esi
+80109873:	5f                   	pop    %edi
+80109874:	5d                   	pop    %ebp
+80109875:	c3                   	ret
+80109876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010987d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(myproc() && (tf->err & FEC_WR) &&
+80109880:	e8 cb cc ff ff       	call   80106550 <myproc>
+80109885:	85 c0                	test   %eax,%eax
+80109887:	74 0a                	je     80109893 <trap+0xc3>
+80109889:	f6 43 34 02          	testb  $0x2,0x34(%ebx)
+8010988d:	0f 85 0d 02 00 00    	jne    80109aa0 <trap+0x2d0>
+    if(myproc() && lazyfault(myproc()->pgdir, myproc()->sz, rcr2()) == 0)
+80109893:	e8 b8 cc ff ff       	call   80106550 <myproc>
+80109898:	85 c0                	test   %eax,%eax
+8010989a:	0f 85 c0 01 00 00    	jne    80109a60 <trap+0x290>
+    if(myproc() == 0 || (tf->cs&3) == 0){
+801098a0:	e8 ab cc ff ff       	call   80106550 <myproc>
+801098a5:	8b 7b 38             	mov    0x38(%ebx),%edi
+801098a8:	85 c0                	test   %eax,%eax
+801098aa:	0f 84 14 02 00 00    	je     80109ac4 <trap+0x2f4>
+801098b0:	f6 43 3c 03          	testb  $0x3,0x3c(%ebx)
+801098b4:	0f 84 0a 02 00 00    	je     80109ac4 <trap+0x2f4>
+
+static inline uint
+rcr2(void)
+{
+  uint val;
+  asm volatile("movl %%cr2,%0" : "=r" (val));
+801098ba:	0f 20 d1             	mov    %cr2,%ecx
+801098bd:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+801098c0:	e8 0b ca ff ff       	call   801062d0 <cpuid>
+801098c5:	8b 73 30             	mov    0x30(%ebx),%esi
+801098c8:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801098cb:	8b 43 34             	mov    0x34(%ebx),%eax
+801098ce:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+            myproc()->pid, myproc()->name, tf->trapno,
+801098d1:	e8 7a cc ff ff       	call   80106550 <myproc>
+801098d6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801098d9:	e8 72 cc ff ff       	call   80106550 <myproc>
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+801098de:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+801098e1:	51                   	push   %ecx
+801098e2:	57                   	push   %edi
+801098e3:	8b 55 dc             	mov    -0x24(%ebp),%edx
+801098e6:	52                   	push   %edx
+801098e7:	ff 75 e4             	push   -0x1c(%ebp)
+801098ea:	56                   	push   %esi
+            myproc()->pid, myproc()->name, tf->trapno,
+801098eb:	8b 75 e0             	mov    -0x20(%ebp),%esi
+801098ee:	81 c6 88 00 00 00    	add    $0x88,%esi
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+801098f4:	56                   	push   %esi
+801098f5:	ff 70 10             	push   0x10(%eax)
+801098f8:	68 30 be 10 80       	push   $0x8010be30
+801098fd:	e8 ae 72 ff ff       	call   80100bb0 <cprintf>
+    myproc()->killed = 1;
+80109902:	83 c4 20             	add    $0x20,%esp
+80109905:	e8 46 cc ff ff       	call   80106550 <myproc>
+8010990a:	c7 40 40 01 00 00 00 	movl   $0x1,0x40(%eax)
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+80109911:	e8 3a cc ff ff       	call   80106550 <myproc>
+80109916:	85 c0                	test   %eax,%eax
+80109918:	0f 85 f5 fe ff ff    	jne    80109813 <trap+0x43>
+8010991e:	e9 0d ff ff ff       	jmp    80109830 <trap+0x60>
+80109923:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80109927:	90                   	nop
+  if(myproc() && myproc()->state == RUNNING &&
+80109928:	83 7b 30 20          	cmpl   $0x20,0x30(%ebx)
+8010992c:	0f 85 16 ff ff ff    	jne    80109848 <trap+0x78>
+     tf->trapno == T_IRQ0+IRQ_TIMER && timeslice())
+80109932:	e8 e9 d7 ff ff       	call   80107120 <timeslice>
+80109937:	85 c0                	test   %eax,%eax
+80109939:	0f 84 09 ff ff ff    	je     80109848 <trap+0x78>
+    yield();
+8010993f:	e8 ec d7 ff ff       	call   80107130 <yield>
+80109944:	e9 ff fe ff ff       	jmp    80109848 <trap+0x78>
+80109949:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(myproc()->killed)
+80109950:	e8 fb cb ff ff       	call   80106550 <myproc>
+80109955:	8b 70 40             	mov    0x40(%eax),%esi
+80109958:	85 f6                	test   %esi,%esi
+8010995a:	0f 85 30 01 00 00    	jne    80109a90 <trap+0x2c0>
+    myproc()->tf = tf;
+80109960:	e8 eb cb ff ff       	call   80106550 <myproc>
+80109965:	89 58 28             	mov    %ebx,0x28(%eax)
+    syscall();
+80109968:	e8 e3 e8 ff ff       	call   80108250 <syscall>
+    if(myproc()->killed)
+8010996d:	e8 de cb ff ff       	call   80106550 <myproc>
+80109972:	8b 48 40             	mov    0x40(%eax),%ecx
+80109975:	85 c9                	test   %ecx,%ecx
+80109977:	0f 84 f1 fe ff ff    	je     8010986e <trap+0x9e>
+}
+8010997d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109980:	5b                   	pop    %ebx
+80109981:	5e                   	pop    %esi
+80109982:	5f                   	pop    %edi
+80109983:	5d                   	pop    %ebp
+      exit();
+80109984:	e9 d7 d5 ff ff       	jmp    80106f60 <exit>
+80109989:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+80109990:	8b 7b 38             	mov    0x38(%ebx),%edi
+80109993:	0f b7 73 3c          	movzwl 0x3c(%ebx),%esi
+80109997:	e8 34 c9 ff ff       	call   801062d0 <cpuid>
+8010999c:	57                   	push   %edi
+8010999d:	56                   	push   %esi
+8010999e:	50                   	push   %eax
+8010999f:	68 d8 bd 10 80       	push   $0x8010bdd8
+801099a4:	e8 07 72 ff ff       	call   80100bb0 <cprintf>
+    lapiceoi();
+801099a9:	e8 a2 ae ff ff       	call   80104850 <lapiceoi>
+    break;
+801099ae:	83 c4 10             	add    $0x10,%esp
+801099b1:	e9 54 fe ff ff       	jmp    8010980a <trap+0x3a>
+801099b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801099bd:	8d 76 00             	lea    0x0(%esi),%esi
+  acquire(&tickslock);
+801099c0:	83 ec 0c             	sub    $0xc,%esp
+801099c3:	68 60 35 14 80       	push   $0x80143560
+801099c8:	e8 53 e3 ff ff       	call   80107d20 <acquire>
+  t = clockticks();
+801099cd:	e8 1e ac ff ff       	call   801045f0 <clockticks>
+  if((int)(t - ticks) > 0){
+801099d2:	83 c4 10             	add    $0x10,%esp
+801099d5:	89 c2                	mov    %eax,%edx
+801099d7:	2b 15 40 35 14 80    	sub    0x80143540,%edx
+801099dd:	85 d2                	test   %edx,%edx
+801099df:	7e 0a                	jle    801099eb <trap+0x21b>
+    ticks = t;
+801099e1:	a3 40 35 14 80       	mov    %eax,0x80143540
+    timerrun();
+801099e6:	e8 45 fb ff ff       	call   80109530 <timerrun>
+  release(&tickslock);
+801099eb:	83 ec 0c             	sub    $0xc,%esp
+801099ee:	68 60 35 14 80       	push   $0x80143560
+801099f3:	e8 c8 e2 ff ff       	call   80107cc0 <release>
+    if(myproc() && myproc()->state == RUNNING)
+801099f8:	e8 53 cb ff ff       	call   80106550 <myproc>
+801099fd:	83 c4 10             	add    $0x10,%esp
+80109a00:	85 c0                	test   %eax,%eax
+80109a02:	0f 84 fd fd ff ff    	je     80109805 <trap+0x35>
+80109a08:	e8 43 cb ff ff       	call   80106550 <myproc>
+80109a0d:	83 78 0c 04          	cmpl   $0x4,0xc(%eax)
+80109a11:	0f 85 ee fd ff ff    	jne    80109805 <trap+0x35>
+      myproc()->runticks++;
+80109a17:	e8 34 cb ff ff       	call   80106550 <myproc>
+80109a1c:	83 80 fc 00 00 00 01 	addl   $0x1,0xfc(%eax)
+    lapiceoi();
+80109a23:	e9 dd fd ff ff       	jmp    80109805 <trap+0x35>
+80109a28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109a2f:	90                   	nop
+    uartintr();
+80109a30:	e8 3b 02 00 00       	call   80109c70 <uartintr>
+    lapiceoi();
+80109a35:	e8 16 ae ff ff       	call   80104850 <lapiceoi>
+    break;
+80109a3a:	e9 cb fd ff ff       	jmp    8010980a <trap+0x3a>
+80109a3f:	90                   	nop
+    kbdintr();
+80109a40:	e8 4b aa ff ff       	call   80104490 <kbdintr>
+    lapiceoi();
+80109a45:	e8 06 ae ff ff       	call   80104850 <lapiceoi>
+    break;
+80109a4a:	e9 bb fd ff ff       	jmp    8010980a <trap+0x3a>
+80109a4f:	90                   	nop
+    exit();
+80109a50:	e8 0b d5 ff ff       	call   80106f60 <exit>
+80109a55:	e9 d6 fd ff ff       	jmp    80109830 <trap+0x60>
+80109a5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80109a60:	0f 20 d7             	mov    %cr2,%edi
+    if(myproc() && lazyfault(myproc()->pgdir, myproc()->sz, rcr2()) == 0)
+80109a63:	e8 e8 ca ff ff       	call   80106550 <myproc>
+80109a68:	8b 30                	mov    (%eax),%esi
+80109a6a:	e8 e1 ca ff ff       	call   80106550 <myproc>
+80109a6f:	83 ec 04             	sub    $0x4,%esp
+80109a72:	57                   	push   %edi
+80109a73:	56                   	push   %esi
+80109a74:	ff 70 04             	push   0x4(%eax)
+80109a77:	e8 84 16 00 00       	call   8010b100 <lazyfault>
+80109a7c:	83 c4 10             	add    $0x10,%esp
+80109a7f:	85 c0                	test   %eax,%eax
+80109a81:	0f 84 83 fd ff ff    	je     8010980a <trap+0x3a>
+80109a87:	e9 14 fe ff ff       	jmp    801098a0 <trap+0xd0>
+80109a8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      exit();
+80109a90:	e8 cb d4 ff ff       	call   80106f60 <exit>
+80109a95:	e9 c6 fe ff ff       	jmp    80109960 <trap+0x190>
+80109a9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80109aa0:	0f 20 d6             	mov    %cr2,%esi
+       cowfault(myproc()->pgdir, rcr2()) == 0)
+80109aa3:	e8 a8 ca ff ff       	call   80106550 <myproc>
+80109aa8:	83 ec 08             	sub    $0x8,%esp
+80109aab:	56                   	push   %esi
+80109aac:	ff 70 04             	push   0x4(%eax)
+80109aaf:	e8 cc 14 00 00       	call   8010af80 <cowfault>
+    if(myproc() && (tf->err & FEC_WR) &&
+80109ab4:	83 c4 10             	add    $0x10,%esp
+80109ab7:	85 c0                	test   %eax,%eax
+80109ab9:	0f 85 d4 fd ff ff    	jne    80109893 <trap+0xc3>
+80109abf:	e9 46 fd ff ff       	jmp    8010980a <trap+0x3a>
+80109ac4:	0f 20 d6             	mov    %cr2,%esi
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+80109ac7:	e8 04 c8 ff ff       	call   801062d0 <cpuid>
+80109acc:	83 ec 0c             	sub    $0xc,%esp
+80109acf:	56                   	push   %esi
+80109ad0:	57                   	push   %edi
+80109ad1:	50                   	push   %eax
+80109ad2:	ff 73 30             	push   0x30(%ebx)
+80109ad5:	68 fc bd 10 80       	push   $0x8010bdfc
+80109ada:	e8 d1 70 ff ff       	call   80100bb0 <cprintf>
+      panic("trap");
+80109adf:	83 c4 14             	add    $0x14,%esp
+80109ae2:	68 d3 bd 10 80       	push   $0x8010bdd3
+80109ae7:	e8 94 6d ff ff       	call   80100880 <panic>
+80109aec:	66 90                	xchg   %ax,%ax
+80109aee:	66 90                	xchg   %ax,%ax
+
+80109af0 <uartgetc>:
+}
+
+static int
+uartgetc(void)
+{
+  if(!uart)
+80109af0:	a1 a0 3d 14 80       	mov    0x80143da0,%eax
+80109af5:	85 c0                	test   %eax,%eax
+80109af7:	74 17                	je     80109b10 <uartgetc+0x20>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80109af9:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80109afe:	ec                   	in     (%dx),%al
+    return -1;
+  if(!(inb(COM1+5) & 0x01))
+80109aff:	a8 01                	test   $0x1,%al
+80109b01:	74 0d                	je     80109b10 <uartgetc+0x20>
+80109b03:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109b08:	ec                   	in     (%dx),%al
+    return -1;
+  return inb(COM1+0);
+80109b09:	0f b6 c0             	movzbl %al,%eax
+80109b0c:	c3                   	ret
+80109b0d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80109b10:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109b15:	c3                   	ret
+80109b16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109b1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80109b20 <uartinit>:
+{
+80109b20:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109b21:	31 c9                	xor    %ecx,%ecx
+80109b23:	89 c8                	mov    %ecx,%eax
+80109b25:	89 e5                	mov    %esp,%ebp
+80109b27:	57                   	push   %edi
+80109b28:	bf fa 03 00 00       	mov    $0x3fa,%edi
+80109b2d:	56                   	push   %esi
+80109b2e:	89 fa                	mov    %edi,%edx
+80109b30:	53                   	push   %ebx
+80109b31:	83 ec 1c             	sub    $0x1c,%esp
+80109b34:	ee                   	out    %al,(%dx)
+80109b35:	be fb 03 00 00       	mov    $0x3fb,%esi
+80109b3a:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+80109b3f:	89 f2                	mov    %esi,%edx
+80109b41:	ee                   	out    %al,(%dx)
+80109b42:	b8 0c 00 00 00       	mov    $0xc,%eax
+80109b47:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109b4c:	ee                   	out    %al,(%dx)
+80109b4d:	bb f9 03 00 00       	mov    $0x3f9,%ebx
+80109b52:	89 c8                	mov    %ecx,%eax
+80109b54:	89 da                	mov    %ebx,%edx
+80109b56:	ee                   	out    %al,(%dx)
+80109b57:	b8 03 00 00 00       	mov    $0x3,%eax
+80109b5c:	89 f2                	mov    %esi,%edx
+80109b5e:	ee                   	out    %al,(%dx)
+80109b5f:	ba fc 03 00 00       	mov    $0x3fc,%edx
+80109b64:	89 c8                	mov    %ecx,%eax
+80109b66:	ee                   	out    %al,(%dx)
+80109b67:	b8 01 00 00 00       	mov    $0x1,%eax
+80109b6c:	89 da                	mov    %ebx,%edx
+80109b6e:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80109b6f:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80109b74:	ec                   	in     (%dx),%al
+  if(inb(COM1+5) == 0xFF)
+80109b75:	3c ff                	cmp    $0xff,%al
+80109b77:	0f 84 7c 00 00 00    	je     80109bf9 <uartinit+0xd9>
+  uart = 1;
+80109b7d:	c7 05 a0 3d 14 80 01 	movl   $0x1,0x80143da0
+80109b84:	00 00 00 
+80109b87:	89 fa                	mov    %edi,%edx
+80109b89:	ec                   	in     (%dx),%al
+80109b8a:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109b8f:	ec                   	in     (%dx),%al
+  ioapicenable(IRQ_COM1, 0);
+80109b90:	83 ec 08             	sub    $0x8,%esp
+  for(p="xv6...\n"; *p; p++)
+80109b93:	bf 3c bf 10 80       	mov    $0x8010bf3c,%edi
+80109b98:	be fd 03 00 00       	mov    $0x3fd,%esi
+  ioapicenable(IRQ_COM1, 0);
+80109b9d:	6a 00                	push   $0x0
+80109b9f:	6a 04                	push   $0x4
+80109ba1:	e8 3a a3 ff ff       	call   80103ee0 <ioapicenable>
+  for(p="xv6...\n"; *p; p++)
+80109ba6:	c6 45 e7 78          	movb   $0x78,-0x19(%ebp)
+  ioapicenable(IRQ_COM1, 0);
+80109baa:	83 c4 10             	add    $0x10,%esp
+80109bad:	8d 76 00             	lea    0x0(%esi),%esi
+  if(!uart)
+80109bb0:	a1 a0 3d 14 80       	mov    0x80143da0,%eax
+80109bb5:	85 c0                	test   %eax,%eax
+80109bb7:	74 32                	je     80109beb <uartinit+0xcb>
+80109bb9:	89 f2                	mov    %esi,%edx
+80109bbb:	ec                   	in     (%dx),%al
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109bbc:	a8 20                	test   $0x20,%al
+80109bbe:	75 21                	jne    80109be1 <uartinit+0xc1>
+80109bc0:	bb 80 00 00 00       	mov    $0x80,%ebx
+80109bc5:	8d 76 00             	lea    0x0(%esi),%esi
+    microdelay(10);
+80109bc8:	83 ec 0c             	sub    $0xc,%esp
+80109bcb:	6a 0a                	push   $0xa
+80109bcd:	e8 9e ac ff ff       	call   80104870 <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109bd2:	83 c4 10             	add    $0x10,%esp
+80109bd5:	83 eb 01             	sub    $0x1,%ebx
+80109bd8:	74 07                	je     80109be1 <uartinit+0xc1>
+80109bda:	89 f2                	mov    %esi,%edx
+80109bdc:	ec                   	in     (%dx),%al
+80109bdd:	a8 20                	test   $0x20,%al
+80109bdf:	74 e7                	je     80109bc8 <uartinit+0xa8>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109be1:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109be6:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+80109bea:	ee                   	out    %al,(%dx)
+  for(p="xv6...\n"; *p; p++)
+80109beb:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+80109bef:	83 c7 01             	add    $0x1,%edi
+80109bf2:	88 45 e7             	mov    %al,-0x19(%ebp)
+80109bf5:	84 c0                	test   %al,%al
+80109bf7:	75 b7                	jne    80109bb0 <uartinit+0x90>
+}
+80109bf9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109bfc:	5b                   	pop    %ebx
+80109bfd:	5e                   	pop    %esi
+80109bfe:	5f                   	pop    %edi
+80109bff:	5d                   	pop    %ebp
+80109c00:	c3                   	ret
+80109c01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109c08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109c0f:	90                   	nop
+
+80109c10 <uartputc>:
+  if(!uart)
+80109c10:	a1 a0 3d 14 80       	mov    0x80143da0,%eax
+80109c15:	85 c0                	test   %eax,%eax
+80109c17:	74 4f                	je     80109c68 <uartputc+0x58>
+{
+80109c19:	55                   	push   %ebp
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80109c1a:	ba fd 03 00 00       	mov    $0x3fd,%edx
+80109c1f:	89 e5                	mov    %esp,%ebp
+80109c21:	56                   	push   %esi
+80109c22:	53                   	push   %ebx
+80109c23:	ec                   	in     (%dx),%al
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109c24:	a8 20                	test   $0x20,%al
+80109c26:	75 29                	jne    80109c51 <uartputc+0x41>
+80109c28:	bb 80 00 00 00       	mov    $0x80,%ebx
+80109c2d:	be fd 03 00 00       	mov    $0x3fd,%esi
+80109c32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    microdelay(10);
+80109c38:	83 ec 0c             	sub    $0xc,%esp
+80109c3b:	6a 0a                	push   $0xa
+80109c3d:	e8 2e ac ff ff       	call   80104870 <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109c42:	83 c4 10             	add    $0x10,%esp
+80109c45:	83 eb 01             	sub    $0x1,%ebx
+80109c48:	74 07                	je     80109c51 <uartputc+0x41>
+80109c4a:	89 f2                	mov    %esi,%edx
+80109c4c:	ec                   	in     (%dx),%al
+80109c4d:	a8 20                	test   $0x20,%al
+80109c4f:	74 e7                	je     80109c38 <uartputc+0x28>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109c51:	8b 45 08             	mov    0x8(%ebp),%eax
+80109c54:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109c59:	ee                   	out    %al,(%dx)
+}
+80109c5a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80109c5d:	5b                   	pop    %ebx
+80109c5e:	5e                   	pop    %esi
+80109c5f:	5d                   	pop    %ebp
+80109c60:	c3                   	ret
+80109c61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109c68:	c3                   	ret
+80109c69:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80109c70 <uartintr>:
+
+void
+uartintr(void)
+{
+80109c70:	55                   	push   %ebp
+80109c71:	89 e5                	mov    %esp,%ebp
+80109c73:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(uartgetc);
+80109c76:	68 f0 9a 10 80       	push   $0x80109af0
+80109c7b:	e8 40 71 ff ff       	call   80100dc0 <consoleintr>
+}
+80109c80:	83 c4 10             	add    $0x10,%esp
+80109c83:	c9                   	leave
+80109c84:	c3                   	ret
+
+80109c85 <vector0>:
+# generated by vectors.pl - do not edit
+# handlers
+.globl alltraps
+.globl vector0
+vector0:
+  pushl $0
+80109c85:	6a 00                	push   $0x0
+  pushl $0
+80109c87:	6a 00                	push   $0x0
+  jmp alltraps
+80109c89:	e9 20 fa ff ff       	jmp    801096ae <alltraps>
+
+80109c8e <vector1>:
+.globl vector1
+vector1:
+  pushl $0
+80109c8e:	6a 00                	push   $0x0
+  pushl $1
+80109c90:	6a 01                	push   $0x1
+  jmp alltraps
+80109c92:	e9 17 fa ff ff       	jmp    801096ae <alltraps>
+
+80109c97 <vector2>:
+.globl vector2
+vector2:
+  pushl $0
+80109c97:	6a 00                	push   $0x0
+  pushl $2
+80109c99:	6a 02                	push   $0x2
+  jmp alltraps
+80109c9b:	e9 0e fa ff ff       	jmp    801096ae <alltraps>
+
+80109ca0 <vector3>:
+.globl vector3
+vector3:
+  pushl $0
+80109ca0:	6a 00                	push   $0x0
+  pushl $3
+80109ca2:	6a 03                	push   $0x3
+  jmp alltraps
+80109ca4:	e9 05 fa ff ff       	jmp    801096ae <alltraps>
+
+80109ca9 <vector4>:
+.globl vector4
+vector4:
+  pushl $0
+80109ca9:	6a 00                	push   $0x0
+  pushl $4
+80109cab:	6a 04                	push   $0x4
+  jmp alltraps
+80109cad:	e9 fc f9 ff ff       	jmp    801096ae <alltraps>
+
+80109cb2 <vector5>:
+.globl vector5
+vector5:
+  pushl $0
+80109cb2:	6a 00                	push   $0x0
+  pushl $5
+80109cb4:	6a 05                	push   $0x5
+  jmp alltraps
+80109cb6:	e9 f3 f9 ff ff       	jmp    801096ae <alltraps>
+
+80109cbb <vector6>:
+.globl vector6
+vector6:
+  pushl $0
+80109cbb:	6a 00                	push   $0x0
+  pushl $6
+80109cbd:	6a 06                	push   $0x6
+  jmp alltraps
+80109cbf:	e9 ea f9 ff ff       	jmp    801096ae <alltraps>
+
+80109cc4 <vector7>:
+.globl vector7
+vector7:
+  pushl $0
+80109cc4:	6a 00                	push   $0x0
+  pushl $7
+80109cc6:	6a 07                	push   $0x7
+  jmp alltraps
+80109cc8:	e9 e1 f9 ff ff       	jmp    801096ae <alltraps>
+
+80109ccd <vector8>:
+.globl vector8
+vector8:
+  pushl $8
+80109ccd:	6a 08                	push   $0x8
+  jmp alltraps
+80109ccf:	e9 da f9 ff ff       	jmp    801096ae <alltraps>
+
+80109cd4 <vector9>:
+.globl vector9
+vector9:
+  pushl $0
+80109cd4:	6a 00                	push   $0x0
+  pushl $9
+80109cd6:	6a 09                	push   $0x9
+  jmp alltraps
+80109cd8:	e9 d1 f9 ff ff       	jmp    801096ae <alltraps>
+
+80109cdd <vector10>:
+.globl vector10
+vector10:
+  pushl $10
+80109cdd:	6a 0a                	push   $0xa
+  jmp alltraps
+80109cdf:	e9 ca f9 ff ff       	jmp    801096ae <alltraps>
+
+80109ce4 <vector11>:
+.globl vector11
+vector11:
+  pushl $11
+80109ce4:	6a 0b                	push   $0xb
+  jmp alltraps
+80109ce6:	e9 c3 f9 ff ff       	jmp    801096ae <alltraps>
+
+80109ceb <vector12>:
+.globl vector12
+vector12:
+  pushl $12
+80109ceb:	6a 0c                	push   $0xc
+  jmp alltraps
+80109ced:	e9 bc f9 ff ff       	jmp    801096ae <alltraps>
+
+80109cf2 <vector13>:
+.globl vector13
+vector13:
+  pushl $13
+80109cf2:	6a 0d                	push   $0xd
+  jmp alltraps
+80109cf4:	e9 b5 f9 ff ff       	jmp    801096ae <alltraps>
+
+80109cf9 <vector14>:
+.globl vector14
+vector14:
+  pushl $14
+80109cf9:	6a 0e                	push   $0xe
+  jmp alltraps
+80109cfb:	e9 ae f9 ff ff       	jmp    801096ae <alltraps>
+
+80109d00 <vector15>:
+.globl vector15
+vector15:
+  pushl $0
+80109d00:	6a 00                	push   $0x0
+  pushl $15
+80109d02:	6a 0f                	push   $0xf
+  jmp alltraps
+80109d04:	e9 a5 f9 ff ff       	jmp    801096ae <alltraps>
+
+80109d09 <vector16>:
+.globl vector16
+vector16:
+  pushl $0
+80109d09:	6a 00                	push   $0x0
+  pushl $16
+80109d0b:	6a 10                	push   $0x10
+  jmp alltraps
+80109d0d:	e9 9c f9 ff ff       	jmp    801096ae <alltraps>
+
+80109d12 <vector17>:
+.globl vector17
+vector17:
+  pushl $17
+80109d12:	6a 11                	push   $0x11
+  jmp alltraps
+80109d14:	e9 95 f9 ff ff       	jmp    801096ae <alltraps>
+
+80109d19 <vector18>:
+.globl vector18
+vector18:
+  pushl $0
+80109d19:	6a 00                	push   $0x0
+  pushl $18
+80109d1b:	6a 12                	push   $0x12
+  jmp alltraps
+80109d1d:	e9 8c f9 ff ff       	jmp    801096ae <alltraps>
+
+80109d22 <vector19>:
+.globl vector19
+vector19:
+  pushl $0
+80109d22:	6a 00                	push   $0x0
+  pushl $19
+80109d24:	6a 13                	push   $0x13
+  jmp alltraps
+80109d26:	e9 83 f9 ff ff       	jmp    801096ae <alltraps>
+
+80109d2b <vector20>:
+.globl vector20
+vector20:
+  pushl $0
+80109d2b:	6a 00                	push   $0x0
+  pushl $20
+80109d2d:	6a 14                	push   $0x14
+  jmp alltraps
+80109d2f:	e9 7a f9 ff ff       	jmp    801096ae <alltraps>
+
+80109d34 <vector21>:
+.globl vector21
+vector21:
+  pushl $0
+80109d34:	6a 00                	push   $0x0
+  pushl $21
+80109d36:	6a 15                	push   $0x15
+  jmp alltraps
+80109d38:	e9 71 f9 ff ff       	jmp    801096ae <alltraps>
+
+80109d3d <vector22>:
+.globl vector22
+vector22:
+  pushl $0
+80109d3d:	6a 00                	push   $0x0
+  pushl $22
+80109d3f:	6a 16                	push   $0x16
+  jmp alltraps
+80109d41:	e9 68 f9 ff ff       	jmp    801096ae <alltraps>
+
+80109d46 <vector23>:
+.globl vector23
+vector23:
+  pushl $0
+80109d46:	6a 00                	push   $0x0
+  pushl $23
+80109d48:	6a 17                	push   $0x17
+  jmp alltraps
+80109d4a:	e9 5f f9 ff ff       	jmp    801096ae <alltraps>
+
+80109d4f <vector24>:
+.globl vector24
+vector24:
+  pushl $0
+80109d4f:	6a 00                	push   $0x0
+  pushl $24
+80109d51:	6a 18                	push   $0x18
+  jmp alltraps
+80109d53:	e9 56 f9 ff ff       	jmp    801096ae <alltraps>
+
+80109d58 <vector25>:
+.globl vector25
+vector25:
+  pushl $0
+80109d58:	6a 00                	push   $0x0
+  pushl $25
+80109d5a:	6a 19                	push   $0x19
+  jmp alltraps
+80109d5c:	e9 4d f9 ff ff       	jmp    801096ae <alltraps>
+
+80109d61 <vector26>:
+.globl vector26
+vector26:
+  pushl $0
+80109d61:	6a 00                	push   $0x0
+  pushl $26
+80109d63:	6a 1a                	push   $0x1a
+  jmp alltraps
+80109d65:	e9 44 f9 ff ff       	jmp    801096ae <alltraps>
+
+80109d6a <vector27>:
+.globl vector27
+vector27:
+  pushl $0
+80109d6a:	6a 00                	push   $0x0
+  pushl $27
+80109d6c:	6a 1b                	push   $0x1b
+  jmp alltraps
+80109d6e:	e9 3b f9 ff ff       	jmp    801096ae <alltraps>
+
+80109d73 <vector28>:
+.globl vector28
+vector28:
+  pushl $0
+80109d73:	6a 00                	push   $0x0
+  pushl $28
+80109d75:	6a 1c                	push   $0x1c
+  jmp alltraps
+80109d77:	e9 32 f9 ff ff       	jmp    801096ae <alltraps>
+
+80109d7c <vector29>:
+.globl vector29
+vector29:
+  pushl $0
+80109d7c:	6a 00                	push   $0x0
+  pushl $29
+80109d7e:	6a 1d                	push   $0x1d
+  jmp alltraps
+80109d80:	e9 29 f9 ff ff       	jmp    801096ae <alltraps>
+
+80109d85 <vector30>:
+.globl vector30
+vector30:
+  pushl $0
+80109d85:	6a 00                	push   $0x0
+  pushl $30
+80109d87:	6a 1e                	push   $0x1e
+  jmp alltraps
+80109d89:	e9 20 f9 ff ff       	jmp    801096ae <alltraps>
+
+80109d8e <vector31>:
+.globl vector31
+vector31:
+  pushl $0
+80109d8e:	6a 00                	push   $0x0
+  pushl $31
+80109d90:	6a 1f                	push   $0x1f
+  jmp alltraps
+80109d92:	e9 17 f9 ff ff       	jmp    801096ae <alltraps>
+
+80109d97 <vector32>:
+.globl vector32
+vector32:
+  pushl $0
+80109d97:	6a 00                	push   $0x0
+  pushl $32
+80109d99:	6a 20                	push   $0x20
+  jmp alltraps
+80109d9b:	e9 0e f9 ff ff       	jmp    801096ae <alltraps>
+
+80109da0 <vector33>:
+.globl vector33
+vector33:
+  pushl $0
+80109da0:	6a 00                	push   $0x0
+  pushl $33
+80109da2:	6a 21                	push   $0x21
+  jmp alltraps
+80109da4:	e9 05 f9 ff ff       	jmp    801096ae <alltraps>
+
+80109da9 <vector34>:
+.globl vector34
+vector34:
+  pushl $0
+80109da9:	6a 00                	push   $0x0
+  pushl $34
+80109dab:	6a 22                	push   $0x22
+  jmp alltraps
+80109dad:	e9 fc f8 ff ff       	jmp    801096ae <alltraps>
+
+80109db2 <vector35>:
+.globl vector35
+vector35:
+  pushl $0
+80109db2:	6a 00                	push   $0x0
+  pushl $35
+80109db4:	6a 23                	push   $0x23
+  jmp alltraps
+80109db6:	e9 f3 f8 ff ff       	jmp    801096ae <alltraps>
+
+80109dbb <vector36>:
+.globl vector36
+vector36:
+  pushl $0
+80109dbb:	6a 00                	push   $0x0
+  pushl $36
+80109dbd:	6a 24                	push   $0x24
+  jmp alltraps
+80109dbf:	e9 ea f8 ff ff       	jmp    801096ae <alltraps>
+
+80109dc4 <vector37>:
+.globl vector37
+vector37:
+  pushl $0
+80109dc4:	6a 00                	push   $0x0
+  pushl $37
+80109dc6:	6a 25                	push   $0x25
+  jmp alltraps
+80109dc8:	e9 e1 f8 ff ff       	jmp    801096ae <alltraps>
+
+80109dcd <vector38>:
+.globl vector38
+vector38:
+  pushl $0
+80109dcd:	6a 00                	push   $0x0
+  pushl $38
+80109dcf:	6a 26                	push   $0x26
+  jmp alltraps
+80109dd1:	e9 d8 f8 ff ff       	jmp    801096ae <alltraps>
+
+80109dd6 <vector39>:
+.globl vector39
+vector39:
+  pushl $0
+80109dd6:	6a 00                	push   $0x0
+  pushl $39
+80109dd8:	6a 27                	push   $0x27
+  jmp alltraps
+80109dda:	e9 cf f8 ff ff       	jmp    801096ae <alltraps>
+
+80109ddf <vector40>:
+.globl vector40
+vector40:
+  pushl $0
+80109ddf:	6a 00                	push   $0x0
+  pushl $40
+80109de1:	6a 28                	push   $0x28
+  jmp alltraps
+80109de3:	e9 c6 f8 ff ff       	jmp    801096ae <alltraps>
+
+80109de8 <vector41>:
+.globl vector41
+vector41:
+  pushl $0
+80109de8:	6a 00                	push   $0x0
+  pushl $41
+80109dea:	6a 29                	push   $0x29
+  jmp alltraps
+80109dec:	e9 bd f8 ff ff       	jmp    801096ae <alltraps>
+
+80109df1 <vector42>:
+.globl vector42
+vector42:
+  pushl $0
+80109df1:	6a 00                	push   $0x0
+  pushl $42
+80109df3:	6a 2a                	push   $0x2a
+  jmp alltraps
+80109df5:	e9 b4 f8 ff ff       	jmp    801096ae <alltraps>
+
+80109dfa <vector43>:
+.globl vector43
+vector43:
+  pushl $0
+80109dfa:	6a 00                	push   $0x0
+  pushl $43
+80109dfc:	6a 2b                	push   $0x2b
+  jmp alltraps
+80109dfe:	e9 ab f8 ff ff       	jmp    801096ae <alltraps>
+
+80109e03 <vector44>:
+.globl vector44
+vector44:
+  pushl $0
+80109e03:	6a 00                	push   $0x0
+  pushl $44
+80109e05:	6a 2c                	push   $0x2c
+  jmp alltraps
+80109e07:	e9 a2 f8 ff ff       	jmp    801096ae <alltraps>
+
+80109e0c <vector45>:
+.globl vector45
+vector45:
+  pushl $0
+80109e0c:	6a 00                	push   $0x0
+  pushl $45
+80109e0e:	6a 2d                	push   $0x2d
+  jmp alltraps
+80109e10:	e9 99 f8 ff ff       	jmp    801096ae <alltraps>
+
+80109e15 <vector46>:
+.globl vector46
+vector46:
+  pushl $0
+80109e15:	6a 00                	push   $0x0
+  pushl $46
+80109e17:	6a 2e                	push   $0x2e
+  jmp alltraps
+80109e19:	e9 90 f8 ff ff       	jmp    801096ae <alltraps>
+
+80109e1e <vector47>:
+.globl vector47
+vector47:
+  pushl $0
+80109e1e:	6a 00                	push   $0x0
+  pushl $47
+80109e20:	6a 2f                	push   $0x2f
+  jmp alltraps
+80109e22:	e9 87 f8 ff ff       	jmp    801096ae <alltraps>
+
+80109e27 <vector48>:
+.globl vector48
+vector48:
+  pushl $0
+80109e27:	6a 00                	push   $0x0
+  pushl $48
+80109e29:	6a 30                	push   $0x30
+  jmp alltraps
+80109e2b:	e9 7e f8 ff ff       	jmp    801096ae <alltraps>
+
+80109e30 <vector49>:
+.globl vector49
+vector49:
+  pushl $0
+80109e30:	6a 00                	push   $0x0
+  pushl $49
+80109e32:	6a 31                	push   $0x31
+  jmp alltraps
+80109e34:	e9 75 f8 ff ff       	jmp    801096ae <alltraps>
+
+80109e39 <vector50>:
+.globl vector50
+vector50:
+  pushl $0
+80109e39:	6a 00                	push   $0x0
+  pushl $50
+80109e3b:	6a 32                	push   $0x32
+  jmp alltraps
+80109e3d:	e9 6c f8 ff ff       	jmp    801096ae <alltraps>
+
+80109e42 <vector51>:
+.globl vector51
+vector51:
+  pushl $0
+80109e42:	6a 00                	push   $0x0
+  pushl $51
+80109e44:	6a 33                	push   $0x33
+  jmp alltraps
+80109e46:	e9 63 f8 ff ff       	jmp    801096ae <alltraps>
+
+80109e4b <vector52>:
+.globl vector52
+vector52:
+  pushl $0
+80109e4b:	6a 00                	push   $0x0
+  pushl $52
+80109e4d:	6a 34                	push   $0x34
+  jmp alltraps
+80109e4f:	e9 5a f8 ff ff       	jmp    801096ae <alltraps>
+
+80109e54 <vector53>:
+.globl vector53
+vector53:
+  pushl $0
+80109e54:	6a 00                	push   $0x0
+  pushl $53
+80109e56:	6a 35                	push   $0x35
+  jmp alltraps
+80109e58:	e9 51 f8 ff ff       	jmp    801096ae <alltraps>
+
+80109e5d <vector54>:
+.globl vector54
+vector54:
+  pushl $0
+80109e5d:	6a 00                	push   $0x0
+  pushl $54
+80109e5f:	6a 36                	push   $0x36
+  jmp alltraps
+80109e61:	e9 48 f8 ff ff       	jmp    801096ae <alltraps>
+
+80109e66 <vector55>:
+.globl vector55
+vector55:
+  pushl $0
+80109e66:	6a 00                	push   $0x0
+  pushl $55
+80109e68:	6a 37                	push   $0x37
+  jmp alltraps
+80109e6a:	e9 3f f8 ff ff       	jmp    801096ae <alltraps>
+
+80109e6f <vector56>:
+.globl vector56
+vector56:
+  pushl $0
+80109e6f:	6a 00                	push   $0x0
+  pushl $56
+80109e71:	6a 38                	push   $0x38
+  jmp alltraps
+80109e73:	e9 36 f8 ff ff       	jmp    801096ae <alltraps>
+
+80109e78 <vector57>:
+.globl vector57
+vector57:
+  pushl $0
+80109e78:	6a 00                	push   $0x0
+  pushl $57
+80109e7a:	6a 39                	push   $0x39
+  jmp alltraps
+80109e7c:	e9 2d f8 ff ff       	jmp    801096ae <alltraps>
+
+80109e81 <vector58>:
+.globl vector58
+vector58:
+  pushl $0
+80109e81:	6a 00                	push   $0x0
+  pushl $58
+80109e83:	6a 3a                	push   $0x3a
+  jmp alltraps
+80109e85:	e9 24 f8 ff ff       	jmp    801096ae <alltraps>
+
+80109e8a <vector59>:
+.globl vector59
+vector59:
+  pushl $0
+80109e8a:	6a 00                	push   $0x0
+  pushl $59
+80109e8c:	6a 3b                	push   $0x3b
+  jmp alltraps
+80109e8e:	e9 1b f8 ff ff       	jmp    801096ae <alltraps>
+
+80109e93 <vector60>:
+.globl vector60
+vector60:
+  pushl $0
+80109e93:	6a 00                	push   $0x0
+  pushl $60
+80109e95:	6a 3c                	push   $0x3c
+  jmp alltraps
+80109e97:	e9 12 f8 ff ff       	jmp    801096ae <alltraps>
+
+80109e9c <vector61>:
+.globl vector61
+vector61:
+  pushl $0
+80109e9c:	6a 00                	push   $0x0
+  pushl $61
+80109e9e:	6a 3d                	push   $0x3d
+  jmp alltraps
+80109ea0:	e9 09 f8 ff ff       	jmp    801096ae <alltraps>
+
+80109ea5 <vector62>:
+.globl vector62
+vector62:
+  pushl $0
+80109ea5:	6a 00                	push   $0x0
+  pushl $62
+80109ea7:	6a 3e                	push   $0x3e
+  jmp alltraps
+80109ea9:	e9 00 f8 ff ff       	jmp    801096ae <alltraps>
+
+80109eae <vector63>:
+.globl vector63
+vector63:
+  pushl $0
+80109eae:	6a 00                	push   $0x0
+  pushl $63
+80109eb0:	6a 3f                	push   $0x3f
+  jmp alltraps
+80109eb2:	e9 f7 f7 ff ff       	jmp    801096ae <alltraps>
+
+80109eb7 <vector64>:
+.globl vector64
+vector64:
+  pushl $0
+80109eb7:	6a 00                	push   $0x0
+  pushl $64
+80109eb9:	6a 40                	push   $0x40
+  jmp alltraps
+80109ebb:	e9 ee f7 ff ff       	jmp    801096ae <alltraps>
+
+80109ec0 <vector65>:
+.globl vector65
+vector65:
+  pushl $0
+80109ec0:	6a 00                	push   $0x0
+  pushl $65
+80109ec2:	6a 41                	push   $0x41
+  jmp alltraps
+80109ec4:	e9 e5 f7 ff ff       	jmp    801096ae <alltraps>
+
+80109ec9 <vector66>:
+.globl vector66
+vector66:
+  pushl $0
+80109ec9:	6a 00                	push   $0x0
+  pushl $66
+80109ecb:	6a 42                	push   $0x42
+  jmp alltraps
+80109ecd:	e9 dc f7 ff ff       	jmp    801096ae <alltraps>
+
+80109ed2 <vector67>:
+.globl vector67
+vector67:
+  pushl $0
+80109ed2:	6a 00                	push   $0x0
+  pushl $67
+80109ed4:	6a 43                	push   $0x43
+  jmp alltraps
+80109ed6:	e9 d3 f7 ff ff       	jmp    801096ae <alltraps>
+
+80109edb <vector68>:
+.globl vector68
+vector68:
+  pushl $0
+80109edb:	6a 00                	push   $0x0
+  pushl $68
+80109edd:	6a 44                	push   $0x44
+  jmp alltraps
+80109edf:	e9 ca f7 ff ff       	jmp    801096ae <alltraps>
+
+80109ee4 <vector69>:
+.globl vector69
+vector69:
+  pushl $0
+80109ee4:	6a 00                	push   $0x0
+  pushl $69
+80109ee6:	6a 45                	push   $0x45
+  jmp alltraps
+80109ee8:	e9 c1 f7 ff ff       	jmp    801096ae <alltraps>
+
+80109eed <vector70>:
+.globl vector70
+vector70:
+  pushl $0
+80109eed:	6a 00                	push   $0x0
+  pushl $70
+80109eef:	6a 46                	push   $0x46
+  jmp alltraps
+80109ef1:	e9 b8 f7 ff ff       	jmp    801096ae <alltraps>
+
+80109ef6 <vector71>:
+.globl vector71
+vector71:
+  pushl $0
+80109ef6:	6a 00                	push   $0x0
+  pushl $71
+80109ef8:	6a 47                	push   $0x47
+  jmp alltraps
+80109efa:	e9 af f7 ff ff       	jmp    801096ae <alltraps>
+
+80109eff <vector72>:
+.globl vector72
+vector72:
+  pushl $0
+80109eff:	6a 00                	push   $0x0
+  pushl $72
+80109f01:	6a 48                	push   $0x48
+  jmp alltraps
+80109f03:	e9 a6 f7 ff ff       	jmp    801096ae <alltraps>
+
+80109f08 <vector73>:
+.globl vector73
+vector73:
+  pushl $0
+80109f08:	6a 00                	push   $0x0
+  pushl $73
+80109f0a:	6a 49                	push   $0x49
+  jmp alltraps
+80109f0c:	e9 9d f7 ff ff       	jmp    801096ae <alltraps>
+
+80109f11 <vector74>:
+.globl vector74
+vector74:
+  pushl $0
+80109f11:	6a 00                	push   $0x0
+  pushl $74
+80109f13:	6a 4a                	push   $0x4a
+  jmp alltraps
+80109f15:	e9 94 f7 ff ff       	jmp    801096ae <alltraps>
+
+80109f1a <vector75>:
+.globl vector75
+vector75:
+  pushl $0
+80109f1a:	6a 00                	push   $0x0
+  pushl $75
+80109f1c:	6a 4b                	push   $0x4b
+  jmp alltraps
+80109f1e:	e9 8b f7 ff ff       	jmp    801096ae <alltraps>
+
+80109f23 <vector76>:
+.globl vector76
+vector76:
+  pushl $0
+80109f23:	6a 00                	push   $0x0
+  pushl $76
+80109f25:	6a 4c                	push   $0x4c
+  jmp alltraps
+80109f27:	e9 82 f7 ff ff       	jmp    801096ae <alltraps>
+
+80109f2c <vector77>:
+.globl vector77
+vector77:
+  pushl $0
+80109f2c:	6a 00                	push   $0x0
+  pushl $77
+80109f2e:	6a 4d                	push   $0x4d
+  jmp alltraps
+80109f30:	e9 79 f7 ff ff       	jmp    801096ae <alltraps>
+
+80109f35 <vector78>:
+.globl vector78
+vector78:
+  pushl $0
+80109f35:	6a 00                	push   $0x0
+  pushl $78
+80109f37:	6a 4e                	push   $0x4e
+  jmp alltraps
+80109f39:	e9 70 f7 ff ff       	jmp    801096ae <alltraps>
+
+80109f3e <vector79>:
+.globl vector79
+vector79:
+  pushl $0
+80109f3e:	6a 00                	push   $0x0
+  pushl $79
+80109f40:	6a 4f                	push   $0x4f
+  jmp alltraps
+80109f42:	e9 67 f7 ff ff       	jmp    801096ae <alltraps>
+
+80109f47 <vector80>:
+.globl vector80
+vector80:
+  pushl $0
+80109f47:	6a 00                	push   $0x0
+  pushl $80
+80109f49:	6a 50                	push   $0x50
+  jmp alltraps
+80109f4b:	e9 5e f7 ff ff       	jmp    801096ae <alltraps>
+
+80109f50 <vector81>:
+.globl vector81
+vector81:
+  pushl $0
+80109f50:	6a 00                	push   $0x0
+  pushl $81
+80109f52:	6a 51                	push   $0x51
+  jmp alltraps
+80109f54:	e9 55 f7 ff ff       	jmp    801096ae <alltraps>
+
+80109f59 <vector82>:
+.globl vector82
+vector82:
+  pushl $0
+80109f59:	6a 00                	push   $0x0
+  pushl $82
+80109f5b:	6a 52                	push   $0x52
+  jmp alltraps
+80109f5d:	e9 4c f7 ff ff       	jmp    801096ae <alltraps>
+
+80109f62 <vector83>:
+.globl vector83
+vector83:
+  pushl $0
+80109f62:	6a 00                	push   $0x0
+  pushl $83
+80109f64:	6a 53                	push   $0x53
+  jmp alltraps
+80109f66:	e9 43 f7 ff ff       	jmp    801096ae <alltraps>
+
+80109f6b <vector84>:
+.globl vector84
+vector84:
+  pushl $0
+80109f6b:	6a 00                	push   $0x0
+  pushl $84
+80109f6d:	6a 54                	push   $0x54
+  jmp alltraps
+80109f6f:	e9 3a f7 ff ff       	jmp    801096ae <alltraps>
+
+80109f74 <vector85>:
+.globl vector85
+vector85:
+  pushl $0
+80109f74:	6a 00                	push   $0x0
+  pushl $85
+80109f76:	6a 55                	push   $0x55
+  jmp alltraps
+80109f78:	e9 31 f7 ff ff       	jmp    801096ae <alltraps>
+
+80109f7d <vector86>:
+.globl vector86
+vector86:
+  pushl $0
+80109f7d:	6a 00                	push   $0x0
+  pushl $86
+80109f7f:	6a 56                	push   $0x56
+  jmp alltraps
+80109f81:	e9 28 f7 ff ff       	jmp    801096ae <alltraps>
+
+80109f86 <vector87>:
+.globl vector87
+vector87:
+  pushl $0
+80109f86:	6a 00                	push   $0x0
+  pushl $87
+80109f88:	6a 57                	push   $0x57
+  jmp alltraps
+80109f8a:	e9 1f f7 ff ff       	jmp    801096ae <alltraps>
+
+80109f8f <vector88>:
+.globl vector88
+vector88:
+  pushl $0
+80109f8f:	6a 00                	push   $0x0
+  pushl $88
+80109f91:	6a 58                	push   $0x58
+  jmp alltraps
+80109f93:	e9 16 f7 ff ff       	jmp    801096ae <alltraps>
+
+80109f98 <vector89>:
+.globl vector89
+vector89:
+  pushl $0
+80109f98:	6a 00                	push   $0x0
+  pushl $89
+80109f9a:	6a 59                	push   $0x59
+  jmp alltraps
+80109f9c:	e9 0d f7 ff ff       	jmp    801096ae <alltraps>
+
+80109fa1 <vector90>:
+.globl vector90
+vector90:
+  pushl $0
+80109fa1:	6a 00                	push   $0x0
+  pushl $90
+80109fa3:	6a 5a                	push   $0x5a
+  jmp alltraps
+80109fa5:	e9 04 f7 ff ff       	jmp    801096ae <alltraps>
+
+80109faa <vector91>:
+.globl vector91
+vector91:
+  pushl $0
+80109faa:	6a 00                	push   $0x0
+  pushl $91
+80109fac:	6a 5b                	push   $0x5b
+  jmp alltraps
+80109fae:	e9 fb f6 ff ff       	jmp    801096ae <alltraps>
+
+80109fb3 <vector92>:
+.globl vector92
+vector92:
+  pushl $0
+80109fb3:	6a 00                	push   $0x0
+  pushl $92
+80109fb5:	6a 5c                	push   $0x5c
+  jmp alltraps
+80109fb7:	e9 f2 f6 ff ff       	jmp    801096ae <alltraps>
+
+80109fbc <vector93>:
+.globl vector93
+vector93:
+  pushl $0
+80109fbc:	6a 00                	push   $0x0
+  pushl $93
+80109fbe:	6a 5d                	push   $0x5d
+  jmp alltraps
+80109fc0:	e9 e9 f6 ff ff       	jmp    801096ae <alltraps>
+
+80109fc5 <vector94>:
+.globl vector94
+vector94:
+  pushl $0
+80109fc5:	6a 00                	push   $0x0
+  pushl $94
+80109fc7:	6a 5e                	push   $0x5e
+  jmp alltraps
+80109fc9:	e9 e0 f6 ff ff       	jmp    801096ae <alltraps>
+
+80109fce <vector95>:
+.globl vector95
+vector95:
+  pushl $0
+80109fce:	6a 00                	push   $0x0
+  pushl $95
+80109fd0:	6a 5f                	push   $0x5f
+  jmp alltraps
+80109fd2:	e9 d7 f6 ff ff       	jmp    801096ae <alltraps>
+
+80109fd7 <vector96>:
+.globl vector96
+vector96:
+  pushl $0
+80109fd7:	6a 00                	push   $0x0
+  pushl $96
+80109fd9:	6a 60                	push   $0x60
+  jmp alltraps
+80109fdb:	e9 ce f6 ff ff       	jmp    801096ae <alltraps>
+
+80109fe0 <vector97>:
+.globl vector97
+vector97:
+  pushl $0
+80109fe0:	6a 00                	push   $0x0
+  pushl $97
+80109fe2:	6a 61                	push   $0x61
+  jmp alltraps
+80109fe4:	e9 c5 f6 ff ff       	jmp    801096ae <alltraps>
+
+80109fe9 <vector98>:
+.globl vector98
+vector98:
+  pushl $0
+80109fe9:	6a 00                	push   $0x0
+  pushl $98
+80109feb:	6a 62                	push   $0x62
+  jmp alltraps
+80109fed:	e9 bc f6 ff ff       	jmp    801096ae <alltraps>
+
+80109ff2 <vector99>:
+.globl vector99
+vector99:
+  pushl $0
+80109ff2:	6a 00                	push   $0x0
+  pushl $99
+80109ff4:	6a 63                	push   $0x63
+  jmp alltraps
+80109ff6:	e9 b3 f6 ff ff       	jmp    801096ae <alltraps>
+
+80109ffb <vector100>:
+.globl vector100
+vector100:
+  pushl $0
+80109ffb:	6a 00                	push   $0x0
+  pushl $100
+80109ffd:	6a 64                	push   $0x64
+  jmp alltraps
+80109fff:	e9 aa f6 ff ff       	jmp    801096ae <alltraps>
+
+8010a004 <vector101>:
+.globl vector101
+vector101:
+  pushl $0
+8010a004:	6a 00                	push   $0x0
+  pushl $101
+8010a006:	6a 65                	push   $0x65
+  jmp alltraps
+8010a008:	e9 a1 f6 ff ff       	jmp    801096ae <alltraps>
+
+8010a00d <vector102>:
+.globl vector102
+vector102:
+  pushl $0
+8010a00d:	6a 00                	push   $0x0
+  pushl $102
+8010a00f:	6a 66                	push   $0x66
+  jmp alltraps
+8010a011:	e9 98 f6 ff ff       	jmp    801096ae <alltraps>
+
+8010a016 <vector103>:
+.globl vector103
+vector103:
+  pushl $0
+8010a016:	6a 00                	push   $0x0
+  pushl $103
+8010a018:	6a 67                	push   $0x67
+  jmp alltraps
+8010a01a:	e9 8f f6 ff ff       	jmp    801096ae <alltraps>
+
+8010a01f <vector104>:
+.globl vector104
+vector104:
+  pushl $0
+8010a01f:	6a 00                	push   $0x0
+  pushl $104
+8010a021:	6a 68                	push   $0x68
+  jmp alltraps
+8010a023:	e9 86 f6 ff ff       	jmp    801096ae <alltraps>
+
+8010a028 <vector105>:
+.globl vector105
+vector105:
+  pushl $0
+8010a028:	6a 00                	push   $0x0
+  pushl $105
+8010a02a:	6a 69                	push   $0x69
+  jmp alltraps
+8010a02c:	e9 7d f6 ff ff       	jmp    801096ae <alltraps>
+
+8010a031 <vector106>:
+.globl vector106
+vector106:
+  pushl $0
+8010a031:	6a 00                	push   $0x0
+  pushl $106
+8010a033:	6a 6a                	push   $0x6a
+  jmp alltraps
+8010a035:	e9 74 f6 ff ff       	jmp    801096ae <alltraps>
+
+8010a03a <vector107>:
+.globl vector107
+vector107:
+  pushl $0
+8010a03a:	6a 00                	push   $0x0
+  pushl $107
+8010a03c:	6a 6b                	push   $0x6b
+  jmp alltraps
+8010a03e:	e9 6b f6 ff ff       	jmp    801096ae <alltraps>
+
+8010a043 <vector108>:
+.globl vector108
+vector108:
+  pushl $0
+8010a043:	6a 00                	push   $0x0
+  pushl $108
+8010a045:	6a 6c                	push   $0x6c
+  jmp alltraps
+8010a047:	e9 62 f6 ff ff       	jmp    801096ae <alltraps>
+
+8010a04c <vector109>:
+.globl vector109
+vector109:
+  pushl $0
+8010a04c:	6a 00                	push   $0x0
+  pushl $109
+8010a04e:	6a 6d                	push   $0x6d
+  jmp alltraps
+8010a050:	e9 59 f6 ff ff       	jmp    801096ae <alltraps>
+
+8010a055 <vector110>:
+.globl vector110
+vector110:
+  pushl $0
+8010a055:	6a 00                	push   $0x0
+  pushl $110
+8010a057:	6a 6e                	push   $0x6e
+  jmp alltraps
+8010a059:	e9 50 f6 ff ff       	jmp    801096ae <alltraps>
+
+8010a05e <vector111>:
+.globl vector111
+vector111:
+  pushl $0
+8010a05e:	6a 00                	push   $0x0
+  pushl $111
+8010a060:	6a 6f                	push   $0x6f
+  jmp alltraps
+8010a062:	e9 47 f6 ff ff       	jmp    801096ae <alltraps>
+
+8010a067 <vector112>:
+.globl vector112
+vector112:
+  pushl $0
+8010a067:	6a 00                	push   $0x0
+  pushl $112
+8010a069:	6a 70                	push   $0x70
+  jmp alltraps
+8010a06b:	e9 3e f6 ff ff       	jmp    801096ae <alltraps>
+
+8010a070 <vector113>:
+.globl vector113
+vector113:
+  pushl $0
+8010a070:	6a 00                	push   $0x0
+  pushl $113
+8010a072:	6a 71                	push   $0x71
+  jmp alltraps
+8010a074:	e9 35 f6 ff ff       	jmp    801096ae <alltraps>
+
+8010a079 <vector114>:
+.globl vector114
+vector114:
+  pushl $0
+8010a079:	6a 00                	push   $0x0
+  pushl $114
+8010a07b:	6a 72                	push   $0x72
+  jmp alltraps
+8010a07d:	e9 2c f6 ff ff       	jmp    801096ae <alltraps>
+
+8010a082 <vector115>:
+.globl vector115
+vector115:
+  pushl $0
+8010a082:	6a 00                	push   $0x0
+  pushl $115
+8010a084:	6a 73                	push   $0x73
+  jmp alltraps
+8010a086:	e9 23 f6 ff ff       	jmp    801096ae <alltraps>
+
+8010a08b <vector116>:
+.globl vector116
+vector116:
+  pushl $0
+8010a08b:	6a 00                	push   $0x0
+  pushl $116
+8010a08d:	6a 74                	push   $0x74
+  jmp alltraps
+8010a08f:	e9 1a f6 ff ff       	jmp    801096ae <alltraps>
+
+8010a094 <vector117>:
+.globl vector117
+vector117:
+  pushl $0
+8010a094:	6a 00                	push   $0x0
+  pushl $117
+8010a096:	6a 75                	push   $0x75
+  jmp alltraps
+8010a098:	e9 11 f6 ff ff       	jmp    801096ae <alltraps>
+
+8010a09d <vector118>:
+.globl vector118
+vector118:
+  pushl $0
+8010a09d:	6a 00                	push   $0x0
+  pushl $118
+8010a09f:	6a 76                	push   $0x76
+  jmp alltraps
+8010a0a1:	e9 08 f6 ff ff       	jmp    801096ae <alltraps>
+
+8010a0a6 <vector119>:
+.globl vector119
+vector119:
+  pushl $0
+8010a0a6:	6a 00                	push   $0x0
+  pushl $119
+8010a0a8:	6a 77                	push   $0x77
+  jmp alltraps
+8010a0aa:	e9 ff f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a0af <vector120>:
+.globl vector120
+vector120:
+  pushl $0
+8010a0af:	6a 00                	push   $0x0
+  pushl $120
+8010a0b1:	6a 78                	push   $0x78
+  jmp alltraps
+8010a0b3:	e9 f6 f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a0b8 <vector121>:
+.globl vector121
+vector121:
+  pushl $0
+8010a0b8:	6a 00                	push   $0x0
+  pushl $121
+8010a0ba:	6a 79                	push   $0x79
+  jmp alltraps
+8010a0bc:	e9 ed f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a0c1 <vector122>:
+.globl vector122
+vector122:
+  pushl $0
+8010a0c1:	6a 00                	push   $0x0
+  pushl $122
+8010a0c3:	6a 7a                	push   $0x7a
+  jmp alltraps
+8010a0c5:	e9 e4 f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a0ca <vector123>:
+.globl vector123
+vector123:
+  pushl $0
+8010a0ca:	6a 00                	push   $0x0
+  pushl $123
+8010a0cc:	6a 7b                	push   $0x7b
+  jmp alltraps
+8010a0ce:	e9 db f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a0d3 <vector124>:
+.globl vector124
+vector124:
+  pushl $0
+8010a0d3:	6a 00                	push   $0x0
+  pushl $124
+8010a0d5:	6a 7c                	push   $0x7c
+  jmp alltraps
+8010a0d7:	e9 d2 f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a0dc <vector125>:
+.globl vector125
+vector125:
+  pushl $0
+8010a0dc:	6a 00                	push   $0x0
+  pushl $125
+8010a0de:	6a 7d                	push   $0x7d
+  jmp alltraps
+8010a0e0:	e9 c9 f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a0e5 <vector126>:
+.globl vector126
+vector126:
+  pushl $0
+8010a0e5:	6a 00                	push   $0x0
+  pushl $126
+8010a0e7:	6a 7e                	push   $0x7e
+  jmp alltraps
+8010a0e9:	e9 c0 f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a0ee <vector127>:
+.globl vector127
+vector127:
+  pushl $0
+8010a0ee:	6a 00                	push   $0x0
+  pushl $127
+8010a0f0:	6a 7f                	push   $0x7f
+  jmp alltraps
+8010a0f2:	e9 b7 f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a0f7 <vector128>:
+.globl vector128
+vector128:
+  pushl $0
+8010a0f7:	6a 00                	push   $0x0
+  pushl $128
+8010a0f9:	68 80 00 00 00       	push   $0x80
+  jmp alltraps
+8010a0fe:	e9 ab f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a103 <vector129>:
+.globl vector129
+vector129:
+  pushl $0
+8010a103:	6a 00                	push   $0x0
+  pushl $129
+8010a105:	68 81 00 00 00       	push   $0x81
+  jmp alltraps
+8010a10a:	e9 9f f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a10f <vector130>:
+.globl vector130
+vector130:
+  pushl $0
+8010a10f:	6a 00                	push   $0x0
+  pushl $130
+8010a111:	68 82 00 00 00       	push   $0x82
+  jmp alltraps
+8010a116:	e9 93 f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a11b <vector131>:
+.globl vector131
+vector131:
+  pushl $0
+8010a11b:	6a 00                	push   $0x0
+  pushl $131
+8010a11d:	68 83 00 00 00       	push   $0x83
+  jmp alltraps
+8010a122:	e9 87 f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a127 <vector132>:
+.globl vector132
+vector132:
+  pushl $0
+8010a127:	6a 00                	push   $0x0
+  pushl $132
+8010a129:	68 84 00 00 00       	push   $0x84
+  jmp alltraps
+8010a12e:	e9 7b f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a133 <vector133>:
+.globl vector133
+vector133:
+  pushl $0
+8010a133:	6a 00                	push   $0x0
+  pushl $133
+8010a135:	68 85 00 00 00       	push   $0x85
+  jmp alltraps
+8010a13a:	e9 6f f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a13f <vector134>:
+.globl vector134
+vector134:
+  pushl $0
+8010a13f:	6a 00                	push   $0x0
+  pushl $134
+8010a141:	68 86 00 00 00       	push   $0x86
+  jmp alltraps
+8010a146:	e9 63 f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a14b <vector135>:
+.globl vector135
+vector135:
+  pushl $0
+8010a14b:	6a 00                	push   $0x0
+  pushl $135
+8010a14d:	68 87 00 00 00       	push   $0x87
+  jmp alltraps
+8010a152:	e9 57 f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a157 <vector136>:
+.globl vector136
+vector136:
+  pushl $0
+8010a157:	6a 00                	push   $0x0
+  pushl $136
+8010a159:	68 88 00 00 00       	push   $0x88
+  jmp alltraps
+8010a15e:	e9 4b f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a163 <vector137>:
+.globl vector137
+vector137:
+  pushl $0
+8010a163:	6a 00                	push   $0x0
+  pushl $137
+8010a165:	68 89 00 00 00       	push   $0x89
+  jmp alltraps
+8010a16a:	e9 3f f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a16f <vector138>:
+.globl vector138
+vector138:
+  pushl $0
+8010a16f:	6a 00                	push   $0x0
+  pushl $138
+8010a171:	68 8a 00 00 00       	push   $0x8a
+  jmp alltraps
+8010a176:	e9 33 f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a17b <vector139>:
+.globl vector139
+vector139:
+  pushl $0
+8010a17b:	6a 00                	push   $0x0
+  pushl $139
+8010a17d:	68 8b 00 00 00       	push   $0x8b
+  jmp alltraps
+8010a182:	e9 27 f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a187 <vector140>:
+.globl vector140
+vector140:
+  pushl $0
+8010a187:	6a 00                	push   $0x0
+  pushl $140
+8010a189:	68 8c 00 00 00       	push   $0x8c
+  jmp alltraps
+8010a18e:	e9 1b f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a193 <vector141>:
+.globl vector141
+vector141:
+  pushl $0
+8010a193:	6a 00                	push   $0x0
+  pushl $141
+8010a195:	68 8d 00 00 00       	push   $0x8d
+  jmp alltraps
+8010a19a:	e9 0f f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a19f <vector142>:
+.globl vector142
+vector142:
+  pushl $0
+8010a19f:	6a 00                	push   $0x0
+  pushl $142
+8010a1a1:	68 8e 00 00 00       	push   $0x8e
+  jmp alltraps
+8010a1a6:	e9 03 f5 ff ff       	jmp    801096ae <alltraps>
+
+8010a1ab <vector143>:
+.globl vector143
+vector143:
+  pushl $0
+8010a1ab:	6a 00                	push   $0x0
+  pushl $143
+8010a1ad:	68 8f 00 00 00       	push   $0x8f
+  jmp alltraps
+8010a1b2:	e9 f7 f4 ff ff       	jmp    801096ae <alltraps>
+
+8010a1b7 <vector144>:
+.globl vector144
+vector144:
+  pushl $0
+8010a1b7:	6a 00                	push   $0x0
+  pushl $144
+8010a1b9:	68 90 00 00 00       	push   $0x90
+  jmp alltraps
+8010a1be:	e9 eb f4 ff ff       	jmp    801096ae <alltraps>
+
+8010a1c3 <vector145>:
+.globl vector145
+vector145:
+  pushl $0
+8010a1c3:	6a 00                	push   $0x0
+  pushl $145
+8010a1c5:	68 91 00 00 00       	push   $0x91
+  jmp alltraps
+8010a1ca:	e9 df f4 ff ff       	jmp    801096ae <alltraps>
+
+8010a1cf <vector146>:
+.globl vector146
+vector146:
+  pushl $0
+8010a1cf:	6a 00                	push   $0x0
+  pushl $146
+8010a1d1:	68 92 00 00 00       	push   $0x92
+  jmp alltraps
+8010a1d6:	e9 d3 f4 ff ff       	jmp    801096ae <alltraps>
+
+8010a1db <vector147>:
+.globl vector147
+vector147:
+  pushl $0
+8010a1db:	6a 00                	push   $0x0
+  pushl $147
+8010a1dd:	68 93 00 00 00       	push   $0x93
+  jmp alltraps
+8010a1e2:	e9 c7 f4 ff ff       	jmp    801096ae <alltraps>
+
+8010a1e7 <vector148>:
+.globl vector148
+vector148:
+  pushl $0
+8010a1e7:	6a 00                	push   $0x0
+  pushl $148
+8010a1e9:	68 94 00 00 00       	push   $0x94
+  jmp alltraps
+8010a1ee:	e9 bb f4 ff ff       	jmp    801096ae <alltraps>
+
+8010a1f3 <vector149>:
+.globl vector149
+vector149:
+  pushl $0
+8010a1f3:	6a 00                	push   $0x0
+  pushl $149
+8010a1f5:	68 95 00 00 00       	push   $0x95
+  jmp alltraps
+8010a1fa:	e9 af f4 ff ff       	jmp    801096ae <alltraps>
+
+8010a1ff <vector150>:
+.globl vector150
+vector150:
+  pushl $0
+8010a1ff:	6a 00                	push   $0x0
+  pushl $150
+8010a201:	68 96 00 00 00       	push   $0x96
+  jmp alltraps
+8010a206:	e9 a3 f4 ff ff       	jmp    801096ae <alltraps>
+
+8010a20b <vector151>:
+.globl vector151
+vector151:
+  pushl $0
+8010a20b:	6a 00                	push   $0x0
+  pushl $151
+8010a20d:	68 97 00 00 00       	push   $0x97
+  jmp alltraps
+8010a212:	e9 97 f4 ff ff       	jmp    801096ae <alltraps>
+
+8010a217 <vector152>:
+.globl vector152
+vector152:
+  pushl $0
+8010a217:	6a 00                	push   $0x0
+  pushl $152
+8010a219:	68 98 00 00 00       	push   $0x98
+  jmp alltraps
+8010a21e:	e9 8b f4 ff ff       	jmp    801096ae <alltraps>
+
+8010a223 <vector153>:
+.globl vector153
+vector153:
+  pushl $0
+8010a223:	6a 00                	push   $0x0
+  pushl $153
+8010a225:	68 99 00 00 00       	push   $0x99
+  jmp alltraps
+8010a22a:	e9 7f f4 ff ff       	jmp    801096ae <alltraps>
+
+8010a22f <vector154>:
+.globl vector154
+vector154:
+  pushl $0
+8010a22f:	6a 00                	push   $0x0
+  pushl $154
+8010a231:	68 9a 00 00 00       	push   $0x9a
+  jmp alltraps
+8010a236:	e9 73 f4 ff ff       	jmp    801096ae <alltraps>
+
+8010a23b <vector155>:
+.globl vector155
+vector155:
+  pushl $0
+8010a23b:	6a 00                	push   $0x0
+  pushl $155
+8010a23d:	68 9b 00 00 00       	push   $0x9b
+  jmp alltraps
+8010a242:	e9 67 f4 ff ff       	jmp    801096ae <alltraps>
+
+8010a247 <vector156>:
+.globl vector156
+vector156:
+  pushl $0
+8010a247:	6a 00                	push   $0x0
+  pushl $156
+8010a249:	68 9c 00 00 00       	push   $0x9c
+  jmp alltraps
+8010a24e:	e9 5b f4 ff ff       	jmp    801096ae <alltraps>
+
+8010a253 <vector157>:
+.globl vector157
+vector157:
+  pushl $0
+8010a253:	6a 00                	push   $0x0
+  pushl $157
+8010a255:	68 9d 00 00 00       	push   $0x9d
+  jmp alltraps
+8010a25a:	e9 4f f4 ff ff       	jmp    801096ae <alltraps>
+
+8010a25f <vector158>:
+.globl vector158
+vector158:
+  pushl $0
+8010a25f:	6a 00                	push   $0x0
+  pushl $158
+8010a261:	68 9e 00 00 00       	push   $0x9e
+  jmp alltraps
+8010a266:	e9 43 f4 ff ff       	jmp    801096ae <alltraps>
+
+8010a26b <vector159>:
+.globl vector159
+vector159:
+  pushl $0
+8010a26b:	6a 00                	push   $0x0
+  pushl $159
+8010a26d:	68 9f 00 00 00       	push   $0x9f
+  jmp alltraps
+8010a272:	e9 37 f4 ff ff       	jmp    801096ae <alltraps>
+
+8010a277 <vector160>:
+.globl vector160
+vector160:
+  pushl $0
+8010a277:	6a 00                	push   $0x0
+  pushl $160
+8010a279:	68 a0 00 00 00       	push   $0xa0
+  jmp alltraps
+8010a27e:	e9 2b f4 ff ff       	jmp    801096ae <alltraps>
+
+8010a283 <vector161>:
+.globl vector161
+vector161:
+  pushl $0
+8010a283:	6a 00                	push   $0x0
+  pushl $161
+8010a285:	68 a1 00 00 00       	push   $0xa1
+  jmp alltraps
+8010a28a:	e9 1f f4 ff ff       	jmp    801096ae <alltraps>
+
+8010a28f <vector162>:
+.globl vector162
+vector162:
+  pushl $0
+8010a28f:	6a 00                	push   $0x0
+  pushl $162
+8010a291:	68 a2 00 00 00       	push   $0xa2
+  jmp alltraps
+8010a296:	e9 13 f4 ff ff       	jmp    801096ae <alltraps>
+
+8010a29b <vector163>:
+.globl vector163
+vector163:
+  pushl $0
+8010a29b:	6a 00                	push   $0x0
+  pushl $163
+8010a29d:	68 a3 00 00 00       	push   $0xa3
+  jmp alltraps
+8010a2a2:	e9 07 f4 ff ff       	jmp    801096ae <alltraps>
+
+8010a2a7 <vector164>:
+.globl vector164
+vector164:
+  pushl $0
+8010a2a7:	6a 00                	push   $0x0
+  pushl $164
+8010a2a9:	68 a4 00 00 00       	push   $0xa4
+  jmp alltraps
+8010a2ae:	e9 fb f3 ff ff       	jmp    801096ae <alltraps>
+
+8010a2b3 <vector165>:
+.globl vector165
+vector165:
+  pushl $0
+8010a2b3:	6a 00                	push   $0x0
+  pushl $165
+8010a2b5:	68 a5 00 00 00       	push   $0xa5
+  jmp alltraps
+8010a2ba:	e9 ef f3 ff ff       	jmp    801096ae <alltraps>
+
+8010a2bf <vector166>:
+.globl vector166
+vector166:
+  pushl $0
+8010a2bf:	6a 00                	push   $0x0
+  pushl $166
+8010a2c1:	68 a6 00 00 00       	push   $0xa6
+  jmp alltraps
+8010a2c6:	e9 e3 f3 ff ff       	jmp    801096ae <alltraps>
+
+8010a2cb <vector167>:
+.globl vector167
+vector167:
+  pushl $0
+8010a2cb:	6a 00                	push   $0x0
+  pushl $167
+8010a2cd:	68 a7 00 00 00       	push   $0xa7
+  jmp alltraps
+8010a2d2:	e9 d7 f3 ff ff       	jmp    801096ae <alltraps>
+
+8010a2d7 <vector168>:
+.globl vector168
+vector168:
+  pushl $0
+8010a2d7:	6a 00                	push   $0x0
+  pushl $168
+8010a2d9:	68 a8 00 00 00       	push   $0xa8
+  jmp alltraps
+8010a2de:	e9 cb f3 ff ff       	jmp    801096ae <alltraps>
+
+8010a2e3 <vector169>:
+.globl vector169
+vector169:
+  pushl $0
+8010a2e3:	6a 00                	push   $0x0
+  pushl $169
+8010a2e5:	68 a9 00 00 00       	push   $0xa9
+  jmp alltraps
+8010a2ea:	e9 bf f3 ff ff       	jmp    801096ae <alltraps>
+
+8010a2ef <vector170>:
+.globl vector170
+vector170:
+  pushl $0
+8010a2ef:	6a 00                	push   $0x0
+  pushl $170
+8010a2f1:	68 aa 00 00 00       	push   $0xaa
+  jmp alltraps
+8010a2f6:	e9 b3 f3 ff ff       	jmp    801096ae <alltraps>
+
+8010a2fb <vector171>:
+.globl vector171
+vector171:
+  pushl $0
+8010a2fb:	6a 00                	push   $0x0
+  pushl $171
+8010a2fd:	68 ab 00 00 00       	push   $0xab
+  jmp alltraps
+8010a302:	e9 a7 f3 ff ff       	jmp    801096ae <alltraps>
+
+8010a307 <vector172>:
+.globl vector172
+vector172:
+  pushl $0
+8010a307:	6a 00                	push   $0x0
+  pushl $172
+8010a309:	68 ac 00 00 00       	push   $0xac
+  jmp alltraps
+8010a30e:	e9 9b f3 ff ff       	jmp    801096ae <alltraps>
+
+8010a313 <vector173>:
+.globl vector173
+vector173:
+  pushl $0
+8010a313:	6a 00                	push   $0x0
+  pushl $173
+8010a315:	68 ad 00 00 00       	push   $0xad
+  jmp alltraps
+8010a31a:	e9 8f f3 ff ff       	jmp    801096ae <alltraps>
+
+8010a31f <vector174>:
+.globl vector174
+vector174:
+  pushl $0
+8010a31f:	6a 00                	push   $0x0
+  pushl $174
+8010a321:	68 ae 00 00 00       	push   $0xae
+  jmp alltraps
+8010a326:	e9 83 f3 ff ff       	jmp    801096ae <alltraps>
+
+8010a32b <vector175>:
+.globl vector175
+vector175:
+  pushl $0
+8010a32b:	6a 00                	push   $0x0
+  pushl $175
+8010a32d:	68 af 00 00 00       	push   $0xaf
+  jmp alltraps
+8010a332:	e9 77 f3 ff ff       	jmp    801096ae <alltraps>
+
+8010a337 <vector176>:
+.globl vector176
+vector176:
+  pushl $0
+8010a337:	6a 00                	push   $0x0
+  pushl $176
+8010a339:	68 b0 00 00 00       	push   $0xb0
+  jmp alltraps
+8010a33e:	e9 6b f3 ff ff       	jmp    801096ae <alltraps>
+
+8010a343 <vector177>:
+.globl vector177
+vector177:
+  pushl $0
+8010a343:	6a 00                	push   $0x0
+  pushl $177
+8010a345:	68 b1 00 00 00       	push   $0xb1
+  jmp alltraps
+8010a34a:	e9 5f f3 ff ff       	jmp    801096ae <alltraps>
+
+8010a34f <vector178>:
+.globl vector178
+vector178:
+  pushl $0
+8010a34f:	6a 00                	push   $0x0
+  pushl $178
+8010a351:	68 b2 00 00 00       	push   $0xb2
+  jmp alltraps
+8010a356:	e9 53 f3 ff ff       	jmp    801096ae <alltraps>
+
+8010a35b <vector179>:
+.globl vector179
+vector179:
+  pushl $0
+8010a35b:	6a 00                	push   $0x0
+  pushl $179
+8010a35d:	68 b3 00 00 00       	push   $0xb3
+  jmp alltraps
+8010a362:	e9 47 f3 ff ff       	jmp    801096ae <alltraps>
+
+8010a367 <vector180>:
+.globl vector180
+vector180:
+  pushl $0
+8010a367:	6a 00                	push   $0x0
+  pushl $180
+8010a369:	68 b4 00 00 00       	push   $0xb4
+  jmp alltraps
+8010a36e:	e9 3b f3 ff ff       	jmp    801096ae <alltraps>
+
+8010a373 <vector181>:
+.globl vector181
+vector181:
+  pushl $0
+8010a373:	6a 00                	push   $0x0
+  pushl $181
+8010a375:	68 b5 00 00 00       	push   $0xb5
+  jmp alltraps
+8010a37a:	e9 2f f3 ff ff       	jmp    801096ae <alltraps>
+
+8010a37f <vector182>:
+.globl vector182
+vector182:
+  pushl $0
+8010a37f:	6a 00                	push   $0x0
+  pushl $182
+8010a381:	68 b6 00 00 00       	push   $0xb6
+  jmp alltraps
+8010a386:	e9 23 f3 ff ff       	jmp    801096ae <alltraps>
+
+8010a38b <vector183>:
+.globl vector183
+vector183:
+  pushl $0
+8010a38b:	6a 00                	push   $0x0
+  pushl $183
+8010a38d:	68 b7 00 00 00       	push   $0xb7
+  jmp alltraps
+8010a392:	e9 17 f3 ff ff       	jmp    801096ae <alltraps>
+
+8010a397 <vector184>:
+.globl vector184
+vector184:
+  pushl $0
+8010a397:	6a 00                	push   $0x0
+  pushl $184
+8010a399:	68 b8 00 00 00       	push   $0xb8
+  jmp alltraps
+8010a39e:	e9 0b f3 ff ff       	jmp    801096ae <alltraps>
+
+8010a3a3 <vector185>:
+.globl vector185
+vector185:
+  pushl $0
+8010a3a3:	6a 00                	push   $0x0
+  pushl $185
+8010a3a5:	68 b9 00 00 00       	push   $0xb9
+  jmp alltraps
+8010a3aa:	e9 ff f2 ff ff       	jmp    801096ae <alltraps>
+
+8010a3af <vector186>:
+.globl vector186
+vector186:
+  pushl $0
+8010a3af:	6a 00                	push   $0x0
+  pushl $186
+8010a3b1:	68 ba 00 00 00       	push   $0xba
+  jmp alltraps
+8010a3b6:	e9 f3 f2 ff ff       	jmp    801096ae <alltraps>
+
+8010a3bb <vector187>:
+.globl vector187
+vector187:
+  pushl $0
+8010a3bb:	6a 00                	push   $0x0
+  pushl $187
+8010a3bd:	68 bb 00 00 00       	push   $0xbb
+  jmp alltraps
+8010a3c2:	e9 e7 f2 ff ff       	jmp    801096ae <alltraps>
+
+8010a3c7 <vector188>:
+.globl vector188
+vector188:
+  pushl $0
+8010a3c7:	6a 00                	push   $0x0
+  pushl $188
+8010a3c9:	68 bc 00 00 00       	push   $0xbc
+  jmp alltraps
+8010a3ce:	e9 db f2 ff ff       	jmp    801096ae <alltraps>
+
+8010a3d3 <vector189>:
+.globl vector189
+vector189:
+  pushl $0
+8010a3d3:	6a 00                	push   $0x0
+  pushl $189
+8010a3d5:	68 bd 00 00 00       	push   $0xbd
+  jmp alltraps
+8010a3da:	e9 cf f2 ff ff       	jmp    801096ae <alltraps>
+
+8010a3df <vector190>:
+.globl vector190
+vector190:
+  pushl $0
+8010a3df:	6a 00                	push   $0x0
+  pushl $190
+8010a3e1:	68 be 00 00 00       	push   $0xbe
+  jmp alltraps
+8010a3e6:	e9 c3 f2 ff ff       	jmp    801096ae <alltraps>
+
+8010a3eb <vector191>:
+.globl vector191
+vector191:
+  pushl $0
+8010a3eb:	6a 00                	push   $0x0
+  pushl $191
+8010a3ed:	68 bf 00 00 00       	push   $0xbf
+  jmp alltraps
+8010a3f2:	e9 b7 f2 ff ff       	jmp    801096ae <alltraps>
+
+8010a3f7 <vector192>:
+.globl vector192
+vector192:
+  pushl $0
+8010a3f7:	6a 00                	push   $0x0
+  pushl $192
+8010a3f9:	68 c0 00 00 00       	push   $0xc0
+  jmp alltraps
+8010a3fe:	e9 ab f2 ff ff       	jmp    801096ae <alltraps>
+
+8010a403 <vector193>:
+.globl vector193
+vector193:
+  pushl $0
+8010a403:	6a 00                	push   $0x0
+  pushl $193
+8010a405:	68 c1 00 00 00       	push   $0xc1
+  jmp alltraps
+8010a40a:	e9 9f f2 ff ff       	jmp    801096ae <alltraps>
+
+8010a40f <vector194>:
+.globl vector194
+vector194:
+  pushl $0
+8010a40f:	6a 00                	push   $0x0
+  pushl $194
+8010a411:	68 c2 00 00 00       	push   $0xc2
+  jmp alltraps
+8010a416:	e9 93 f2 ff ff       	jmp    801096ae <alltraps>
+
+8010a41b <vector195>:
+.globl vector195
+vector195:
+  pushl $0
+8010a41b:	6a 00                	push   $0x0
+  pushl $195
+8010a41d:	68 c3 00 00 00       	push   $0xc3
+  jmp alltraps
+8010a422:	e9 87 f2 ff ff       	jmp    801096ae <alltraps>
+
+8010a427 <vector196>:
+.globl vector196
+vector196:
+  pushl $0
+8010a427:	6a 00                	push   $0x0
+  pushl $196
+8010a429:	68 c4 00 00 00       	push   $0xc4
+  jmp alltraps
+8010a42e:	e9 7b f2 ff ff       	jmp    801096ae <alltraps>
+
+8010a433 <vector197>:
+.globl vector197
+vector197:
+  pushl $0
+8010a433:	6a 00                	push   $0x0
+  pushl $197
+8010a435:	68 c5 00 00 00       	push   $0xc5
+  jmp alltraps
+8010a43a:	e9 6f f2 ff ff       	jmp    801096ae <alltraps>
+
+8010a43f <vector198>:
+.globl vector198
+vector198:
+  pushl $0
+8010a43f:	6a 00                	push   $0x0
+  pushl $198
+8010a441:	68 c6 00 00 00       	push   $0xc6
+  jmp alltraps
+8010a446:	e9 63 f2 ff ff       	jmp    801096ae <alltraps>
+
+8010a44b <vector199>:
+.globl vector199
+vector199:
+  pushl $0
+8010a44b:	6a 00                	push   $0x0
+  pushl $199
+8010a44d:	68 c7 00 00 00       	push   $0xc7
+  jmp alltraps
+8010a452:	e9 57 f2 ff ff       	jmp    801096ae <alltraps>
+
+8010a457 <vector200>:
+.globl vector200
+vector200:
+  pushl $0
+8010a457:	6a 00                	push   $0x0
+  pushl $200
+8010a459:	68 c8 00 00 00       	push   $0xc8
+  jmp alltraps
+8010a45e:	e9 4b f2 ff ff       	jmp    801096ae <alltraps>
+
+8010a463 <vector201>:
+.globl vector201
+vector201:
+  pushl $0
+8010a463:	6a 00                	push   $0x0
+  pushl $201
+8010a465:	68 c9 00 00 00       	push   $0xc9
+  jmp alltraps
+8010a46a:	e9 3f f2 ff ff       	jmp    801096ae <alltraps>
+
+8010a46f <vector202>:
+.globl vector202
+vector202:
+  pushl $0
+8010a46f:	6a 00                	push   $0x0
+  pushl $202
+8010a471:	68 ca 00 00 00       	push   $0xca
+  jmp alltraps
+8010a476:	e9 33 f2 ff ff       	jmp    801096ae <alltraps>
+
+8010a47b <vector203>:
+.globl vector203
+vector203:
+  pushl $0
+8010a47b:	6a 00                	push   $0x0
+  pushl $203
+8010a47d:	68 cb 00 00 00       	push   $0xcb
+  jmp alltraps
+8010a482:	e9 27 f2 ff ff       	jmp    801096ae <alltraps>
+
+8010a487 <vector204>:
+.globl vector204
+vector204:
+  pushl $0
+8010a487:	6a 00                	push   $0x0
+  pushl $204
+8010a489:	68 cc 00 00 00       	push   $0xcc
+  jmp alltraps
+8010a48e:	e9 1b f2 ff ff       	jmp    801096ae <alltraps>
+
+8010a493 <vector205>:
+.globl vector205
+vector205:
+  pushl $0
+8010a493:	6a 00                	push   $0x0
+  pushl $205
+8010a495:	68 cd 00 00 00       	push   $0xcd
+  jmp alltraps
+8010a49a:	e9 0f f2 ff ff       	jmp    801096ae <alltraps>
+
+8010a49f <vector206>:
+.globl vector206
+vector206:
+  pushl $0
+8010a49f:	6a 00                	push   $0x0
+  pushl $206
+8010a4a1:	68 ce 00 00 00       	push   $0xce
+  jmp alltraps
+8010a4a6:	e9 03 f2 ff ff       	jmp    801096ae <alltraps>
+
+8010a4ab <vector207>:
+.globl vector207
+vector207:
+  pushl $0
+8010a4ab:	6a 00                	push   $0x0
+  pushl $207
+8010a4ad:	68 cf 00 00 00       	push   $0xcf
+  jmp alltraps
+8010a4b2:	e9 f7 f1 ff ff       	jmp    801096ae <alltraps>
+
+8010a4b7 <vector208>:
+.globl vector208
+vector208:
+  pushl $0
+8010a4b7:	6a 00                	push   $0x0
+  pushl $208
+8010a4b9:	68 d0 00 00 00       	push   $0xd0
+  jmp alltraps
+8010a4be:	e9 eb f1 ff ff       	jmp    801096ae <alltraps>
+
+8010a4c3 <vector209>:
+.globl vector209
+vector209:
+  pushl $0
+8010a4c3:	6a 00                	push   $0x0
+  pushl $209
+8010a4c5:	68 d1 00 00 00       	push   $0xd1
+  jmp alltraps
+8010a4ca:	e9 df f1 ff ff       	jmp    801096ae <alltraps>
+
+8010a4cf <vector210>:
+.globl vector210
+vector210:
+  pushl $0
+8010a4cf:	6a 00                	push   $0x0
+  pushl $210
+8010a4d1:	68 d2 00 00 00       	push   $0xd2
+  jmp alltraps
+8010a4d6:	e9 d3 f1 ff ff       	jmp    801096ae <alltraps>
+
+8010a4db <vector211>:
+.globl vector211
+vector211:
+  pushl $0
+8010a4db:	6a 00                	push   $0x0
+  pushl $211
+8010a4dd:	68 d3 00 00 00       	push   $0xd3
+  jmp alltraps
+8010a4e2:	e9 c7 f1 ff ff       	jmp    801096ae <alltraps>
+
+8010a4e7 <vector212>:
+.globl vector212
+vector212:
+  pushl $0
+8010a4e7:	6a 00                	push   $0x0
+  pushl $212
+8010a4e9:	68 d4 00 00 00       	push   $0xd4
+  jmp alltraps
+8010a4ee:	e9 bb f1 ff ff       	jmp    801096ae <alltraps>
+
+8010a4f3 <vector213>:
+.globl vector213
+vector213:
+  pushl $0
+8010a4f3:	6a 00                	push   $0x0
+  pushl $213
+8010a4f5:	68 d5 00 00 00       	push   $0xd5
+  jmp alltraps
+8010a4fa:	e9 af f1 ff ff       	jmp    801096ae <alltraps>
+
+8010a4ff <vector214>:
+.globl vector214
+vector214:
+  pushl $0
+8010a4ff:	6a 00                	push   $0x0
+  pushl $214
+8010a501:	68 d6 00 00 00       	push   $0xd6
+  jmp alltraps
+8010a506:	e9 a3 f1 ff ff       	jmp    801096ae <alltraps>
+
+8010a50b <vector215>:
+.globl vector215
+vector215:
+  pushl $0
+8010a50b:	6a 00                	push   $0x0
+  pushl $215
+8010a50d:	68 d7 00 00 00       	push   $0xd7
+  jmp alltraps
+8010a512:	e9 97 f1 ff ff       	jmp    801096ae <alltraps>
+
+8010a517 <vector216>:
+.globl vector216
+vector216:
+  pushl $0
+8010a517:	6a 00                	push   $0x0
+  pushl $216
+8010a519:	68 d8 00 00 00       	push   $0xd8
+  jmp alltraps
+8010a51e:	e9 8b f1 ff ff       	jmp    801096ae <alltraps>
+
+8010a523 <vector217>:
+.globl vector217
+vector217:
+  pushl $0
+8010a523:	6a 00                	push   $0x0
+  pushl $217
+8010a525:	68 d9 00 00 00       	push   $0xd9
+  jmp alltraps
+8010a52a:	e9 7f f1 ff ff       	jmp    801096ae <alltraps>
+
+8010a52f <vector218>:
+.globl vector218
+vector218:
+  pushl $0
+8010a52f:	6a 00                	push   $0x0
+  pushl $218
+8010a531:	68 da 00 00 00       	push   $0xda
+  jmp alltraps
+8010a536:	e9 73 f1 ff ff       	jmp    801096ae <alltraps>
+
+8010a53b <vector219>:
+.globl vector219
+vector219:
+  pushl $0
+8010a53b:	6a 00                	push   $0x0
+  pushl $219
+8010a53d:	68 db 00 00 00       	push   $0xdb
+  jmp alltraps
+8010a542:	e9 67 f1 ff ff       	jmp    801096ae <alltraps>
+
+8010a547 <vector220>:
+.globl vector220
+vector220:
+  pushl $0
+8010a547:	6a 00                	push   $0x0
+  pushl $220
+8010a549:	68 dc 00 00 00       	push   $0xdc
+  jmp alltraps
+8010a54e:	e9 5b f1 ff ff       	jmp    801096ae <alltraps>
+
+8010a553 <vector221>:
+.globl vector221
+vector221:
+  pushl $0
+8010a553:	6a 00                	push   $0x0
+  pushl $221
+8010a555:	68 dd 00 00 00       	push   $0xdd
+  jmp alltraps
+8010a55a:	e9 4f f1 ff ff       	jmp    801096ae <alltraps>
+
+8010a55f <vector222>:
+.globl vector222
+vector222:
+  pushl $0
+8010a55f:	6a 00                	push   $0x0
+  pushl $222
+8010a561:	68 de 00 00 00       	push   $0xde
+  jmp alltraps
+8010a566:	e9 43 f1 ff ff       	jmp    801096ae <alltraps>
+
+8010a56b <vector223>:
+.globl vector223
+vector223:
+  pushl $0
+8010a56b:	6a 00                	push   $0x0
+  pushl $223
+8010a56d:	68 df 00 00 00       	push   $0xdf
+  jmp alltraps
+8010a572:	e9 37 f1 ff ff       	jmp    801096ae <alltraps>
+
+8010a577 <vector224>:
+.globl vector224
+vector224:
+  pushl $0
+8010a577:	6a 00                	push   $0x0
+  pushl $224
+8010a579:	68 e0 00 00 00       	push   $0xe0
+  jmp alltraps
+8010a57e:	e9 2b f1 ff ff       	jmp    801096ae <alltraps>
+
+8010a583 <vector225>:
+.globl vector225
+vector225:
+  pushl $0
+8010a583:	6a 00                	push   $0x0
+  pushl $225
+8010a585:	68 e1 00 00 00       	push   $0xe1
+  jmp alltraps
+8010a58a:	e9 1f f1 ff ff       	jmp    801096ae <alltraps>
+
+8010a58f <vector226>:
+.globl vector226
+vector226:
+  pushl $0
+8010a58f:	6a 00                	push   $0x0
+  pushl $226
+8010a591:	68 e2 00 00 00       	push   $0xe2
+  jmp alltraps
+8010a596:	e9 13 f1 ff ff       	jmp    801096ae <alltraps>
+
+8010a59b <vector227>:
+.globl vector227
+vector227:
+  pushl $0
+8010a59b:	6a 00                	push   $0x0
+  pushl $227
+8010a59d:	68 e3 00 00 00       	push   $0xe3
+  jmp alltraps
+8010a5a2:	e9 07 f1 ff ff       	jmp    801096ae <alltraps>
+
+8010a5a7 <vector228>:
+.globl vector228
+vector228:
+  pushl $0
+8010a5a7:	6a 00                	push   $0x0
+  pushl $228
+8010a5a9:	68 e4 00 00 00       	push   $0xe4
+  jmp alltraps
+8010a5ae:	e9 fb f0 ff ff       	jmp    801096ae <alltraps>
+
+8010a5b3 <vector229>:
+.globl vector229
+vector229:
+  pushl $0
+8010a5b3:	6a 00                	push   $0x0
+  pushl $229
+8010a5b5:	68 e5 00 00 00       	push   $0xe5
+  jmp alltraps
+8010a5ba:	e9 ef f0 ff ff       	jmp    801096ae <alltraps>
+
+8010a5bf <vector230>:
+.globl vector230
+vector230:
+  pushl $0
+8010a5bf:	6a 00                	push   $0x0
+  pushl $230
+8010a5c1:	68 e6 00 00 00       	push   $0xe6
+  jmp alltraps
+8010a5c6:	e9 e3 f0 ff ff       	jmp    801096ae <alltraps>
+
+8010a5cb <vector231>:
+.globl vector231
+vector231:
+  pushl $0
+8010a5cb:	6a 00                	push   $0x0
+  pushl $231
+8010a5cd:	68 e7 00 00 00       	push   $0xe7
+  jmp alltraps
+8010a5d2:	e9 d7 f0 ff ff       	jmp    801096ae <alltraps>
+
+8010a5d7 <vector232>:
+.globl vector232
+vector232:
+  pushl $0
+8010a5d7:	6a 00                	push   $0x0
+  pushl $232
+8010a5d9:	68 e8 00 00 00       	push   $0xe8
+  jmp alltraps
+8010a5de:	e9 cb f0 ff ff       	jmp    801096ae <alltraps>
+
+8010a5e3 <vector233>:
+.globl vector233
+vector233:
+  pushl $0
+8010a5e3:	6a 00                	push   $0x0
+  pushl $233
+8010a5e5:	68 e9 00 00 00       	push   $0xe9
+  jmp alltraps
+8010a5ea:	e9 bf f0 ff ff       	jmp    801096ae <alltraps>
+
+8010a5ef <vector234>:
+.globl vector234
+vector234:
+  pushl $0
+8010a5ef:	6a 00                	push   $0x0
+  pushl $234
+8010a5f1:	68 ea 00 00 00       	push   $0xea
+  jmp alltraps
+8010a5f6:	e9 b3 f0 ff ff       	jmp    801096ae <alltraps>
+
+8010a5fb <vector235>:
+.globl vector235
+vector235:
+  pushl $0
+8010a5fb:	6a 00                	push   $0x0
+  pushl $235
+8010a5fd:	68 eb 00 00 00       	push   $0xeb
+  jmp alltraps
+8010a602:	e9 a7 f0 ff ff       	jmp    801096ae <alltraps>
+
+8010a607 <vector236>:
+.globl vector236
+vector236:
+  pushl $0
+8010a607:	6a 00                	push   $0x0
+  pushl $236
+8010a609:	68 ec 00 00 00       	push   $0xec
+  jmp alltraps
+8010a60e:	e9 9b f0 ff ff       	jmp    801096ae <alltraps>
+
+8010a613 <vector237>:
+.globl vector237
+vector237:
+  pushl $0
+8010a613:	6a 00                	push   $0x0
+  pushl $237
+8010a615:	68 ed 00 00 00       	push   $0xed
+  jmp alltraps
+8010a61a:	e9 8f f0 ff ff       	jmp    801096ae <alltraps>
+
+8010a61f <vector238>:
+.globl vector238
+vector238:
+  pushl $0
+8010a61f:	6a 00                	push   $0x0
+  pushl $238
+8010a621:	68 ee 00 00 00       	push   $0xee
+  jmp alltraps
+8010a626:	e9 83 f0 ff ff       	jmp    801096ae <alltraps>
+
+8010a62b <vector239>:
+.globl vector239
+vector239:
+  pushl $0
+8010a62b:	6a 00                	push   $0x0
+  pushl $239
+8010a62d:	68 ef 00 00 00       	push   $0xef
+  jmp alltraps
+8010a632:	e9 77 f0 ff ff       	jmp    801096ae <alltraps>
+
+8010a637 <vector240>:
+.globl vector240
+vector240:
+  pushl $0
+8010a637:	6a 00                	push   $0x0
+  pushl $240
+8010a639:	68 f0 00 00 00       	push   $0xf0
+  jmp alltraps
+8010a63e:	e9 6b f0 ff ff       	jmp    801096ae <alltraps>
+
+8010a643 <vector241>:
+.globl vector241
+vector241:
+  pushl $0
+8010a643:	6a 00                	push   $0x0
+  pushl $241
+8010a645:	68 f1 00 00 00       	push   $0xf1
+  jmp alltraps
+8010a64a:	e9 5f f0 ff ff       	jmp    801096ae <alltraps>
+
+8010a64f <vector242>:
+.globl vector242
+vector242:
+  pushl $0
+8010a64f:	6a 00                	push   $0x0
+  pushl $242
+8010a651:	68 f2 00 00 00       	push   $0xf2
+  jmp alltraps
+8010a656:	e9 53 f0 ff ff       	jmp    801096ae <alltraps>
+
+8010a65b <vector243>:
+.globl vector243
+vector243:
+  pushl $0
+8010a65b:	6a 00                	push   $0x0
+  pushl $243
+8010a65d:	68 f3 00 00 00       	push   $0xf3
+  jmp alltraps
+8010a662:	e9 47 f0 ff ff       	jmp    801096ae <alltraps>
+
+8010a667 <vector244>:
+.globl vector244
+vector244:
+  pushl $0
+8010a667:	6a 00                	push   $0x0
+  pushl $244
+8010a669:	68 f4 00 00 00       	push   $0xf4
+  jmp alltraps
+8010a66e:	e9 3b f0 ff ff       	jmp    801096ae <alltraps>
+
+8010a673 <vector245>:
+.globl vector245
+vector245:
+  pushl $0
+8010a673:	6a 00                	push   $0x0
+  pushl $245
+8010a675:	68 f5 00 00 00       	push   $0xf5
+  jmp alltraps
+8010a67a:	e9 2f f0 ff ff       	jmp    801096ae <alltraps>
+
+8010a67f <vector246>:
+.globl vector246
+vector246:
+  pushl $0
+8010a67f:	6a 00                	push   $0x0
+  pushl $246
+8010a681:	68 f6 00 00 00       	push   $0xf6
+  jmp alltraps
+8010a686:	e9 23 f0 ff ff       	jmp    801096ae <alltraps>
+
+8010a68b <vector247>:
+.globl vector247
+vector247:
+  pushl $0
+8010a68b:	6a 00                	push   $0x0
+  pushl $247
+8010a68d:	68 f7 00 00 00       	push   $0xf7
+  jmp alltraps
+8010a692:	e9 17 f0 ff ff       	jmp    801096ae <alltraps>
+
+8010a697 <vector248>:
+.globl vector248
+vector248:
+  pushl $0
+8010a697:	6a 00                	push   $0x0
+  pushl $248
+8010a699:	68 f8 00 00 00       	push   $0xf8
+  jmp alltraps
+8010a69e:	e9 0b f0 ff ff       	jmp    801096ae <alltraps>
+
+8010a6a3 <vector249>:
+.globl vector249
+vector249:
+  pushl $0
+8010a6a3:	6a 00                	push   $0x0
+  pushl $249
+8010a6a5:	68 f9 00 00 00       	push   $0xf9
+  jmp alltraps
+8010a6aa:	e9 ff ef ff ff       	jmp    801096ae <alltraps>
+
+8010a6af <vector250>:
+.globl vector250
+vector250:
+  pushl $0
+8010a6af:	6a 00                	push   $0x0
+  pushl $250
+8010a6b1:	68 fa 00 00 00       	push   $0xfa
+  jmp alltraps
+8010a6b6:	e9 f3 ef ff ff       	jmp    801096ae <alltraps>
+
+8010a6bb <vector251>:
+.globl vector251
+vector251:
+  pushl $0
+8010a6bb:	6a 00                	push   $0x0
+  pushl $251
+8010a6bd:	68 fb 00 00 00       	push   $0xfb
+  jmp alltraps
+8010a6c2:	e9 e7 ef ff ff       	jmp    801096ae <alltraps>
+
+8010a6c7 <vector252>:
+.globl vector252
+vector252:
+  pushl $0
+8010a6c7:	6a 00                	push   $0x0
+  pushl $252
+8010a6c9:	68 fc 00 00 00       	push   $0xfc
+  jmp alltraps
+8010a6ce:	e9 db ef ff ff       	jmp    801096ae <alltraps>
+
+8010a6d3 <vector253>:
+.globl vector253
+vector253:
+  pushl $0
+8010a6d3:	6a 00                	push   $0x0
+  pushl $253
+8010a6d5:	68 fd 00 00 00       	push   $0xfd
+  jmp alltraps
+8010a6da:	e9 cf ef ff ff       	jmp    801096ae <alltraps>
+
+8010a6df <vector254>:
+.globl vector254
+vector254:
+  pushl $0
+8010a6df:	6a 00                	push   $0x0
+  pushl $254
+8010a6e1:	68 fe 00 00 00       	push   $0xfe
+  jmp alltraps
+8010a6e6:	e9 c3 ef ff ff       	jmp    801096ae <alltraps>
+
+8010a6eb <vector255>:
+.globl vector255
+vector255:
+  pushl $0
+8010a6eb:	6a 00                	push   $0x0
+  pushl $255
+8010a6ed:	68 ff 00 00 00       	push   $0xff
+  jmp alltraps
+8010a6f2:	e9 b7 ef ff ff       	jmp    801096ae <alltraps>
+8010a6f7:	66 90                	xchg   %ax,%ax
+8010a6f9:	66 90                	xchg   %ax,%ax
+8010a6fb:	66 90                	xchg   %ax,%ax
+8010a6fd:	66 90                	xchg   %ax,%ax
+8010a6ff:	90                   	nop
+
+8010a700 <deallocuvm.part.0>:
+// Deallocate user pages to bring the process size from oldsz to
+// newsz.  oldsz and newsz need not be page-aligned, nor does newsz
+// need to be less than oldsz.  oldsz can be larger than the actual
+// process size.  Returns the new process size.
+int
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+8010a700:	55                   	push   %ebp
+8010a701:	89 e5                	mov    %esp,%ebp
+8010a703:	57                   	push   %edi
+8010a704:	56                   	push   %esi
+8010a705:	53                   	push   %ebx
+  uint a, pa;
+
+  if(newsz >= oldsz)
+    return oldsz;
+
+  a = PGROUNDUP(newsz);
+8010a706:	8d 99 ff 0f 00 00    	lea    0xfff(%ecx),%ebx
+8010a70c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+8010a712:	83 ec 1c             	sub    $0x1c,%esp
+  for(; a  < oldsz; a += PGSIZE){
+8010a715:	39 d3                	cmp    %edx,%ebx
+8010a717:	73 56                	jae    8010a76f <deallocuvm.part.0+0x6f>
+8010a719:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010a71c:	89 c6                	mov    %eax,%esi
+8010a71e:	89 d7                	mov    %edx,%edi
+8010a720:	eb 12                	jmp    8010a734 <deallocuvm.part.0+0x34>
+8010a722:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+8010a728:	83 c2 01             	add    $0x1,%edx
+8010a72b:	89 d3                	mov    %edx,%ebx
+8010a72d:	c1 e3 16             	shl    $0x16,%ebx
+  for(; a  < oldsz; a += PGSIZE){
+8010a730:	39 fb                	cmp    %edi,%ebx
+8010a732:	73 38                	jae    8010a76c <deallocuvm.part.0+0x6c>
+  pde = &pgdir[PDX(va)];
+8010a734:	89 da                	mov    %ebx,%edx
+8010a736:	c1 ea 16             	shr    $0x16,%edx
+  if(*pde & PTE_P){
+8010a739:	8b 04 96             	mov    (%esi,%edx,4),%eax
+8010a73c:	a8 01                	test   $0x1,%al
+8010a73e:	74 e8                	je     8010a728 <deallocuvm.part.0+0x28>
+  return &pgtab[PTX(va)];
+8010a740:	89 d9                	mov    %ebx,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010a742:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010a747:	c1 e9 0a             	shr    $0xa,%ecx
+8010a74a:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010a750:	8d 84 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%eax
+    if(!pte)
+8010a757:	85 c0                	test   %eax,%eax
+8010a759:	74 cd                	je     8010a728 <deallocuvm.part.0+0x28>
+    else if((*pte & PTE_P) != 0){
+8010a75b:	8b 10                	mov    (%eax),%edx
+8010a75d:	f6 c2 01             	test   $0x1,%dl
+8010a760:	75 1e                	jne    8010a780 <deallocuvm.part.0+0x80>
+  for(; a  < oldsz; a += PGSIZE){
+8010a762:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010a768:	39 fb                	cmp    %edi,%ebx
+8010a76a:	72 c8                	jb     8010a734 <deallocuvm.part.0+0x34>
+8010a76c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      kfree(v);
+      *pte = 0;
+    }
+  }
+  return newsz;
+}
+8010a76f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a772:	89 c8                	mov    %ecx,%eax
+8010a774:	5b                   	pop    %ebx
+8010a775:	5e                   	pop    %esi
+8010a776:	5f                   	pop    %edi
+8010a777:	5d                   	pop    %ebp
+8010a778:	c3                   	ret
+8010a779:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(pa == 0)
+8010a780:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+8010a786:	74 26                	je     8010a7ae <deallocuvm.part.0+0xae>
+      kfree(v);
+8010a788:	83 ec 0c             	sub    $0xc,%esp
+      char *v = P2V(pa);
+8010a78b:	81 c2 00 00 00 80    	add    $0x80000000,%edx
+8010a791:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(; a  < oldsz; a += PGSIZE){
+8010a794:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+      kfree(v);
+8010a79a:	52                   	push   %edx
+8010a79b:	e8 80 97 ff ff       	call   80103f20 <kfree>
+      *pte = 0;
+8010a7a0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for(; a  < oldsz; a += PGSIZE){
+8010a7a3:	83 c4 10             	add    $0x10,%esp
+      *pte = 0;
+8010a7a6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+8010a7ac:	eb 82                	jmp    8010a730 <deallocuvm.part.0+0x30>
+        panic("kfree");
+8010a7ae:	83 ec 0c             	sub    $0xc,%esp
+8010a7b1:	68 4a b8 10 80       	push   $0x8010b84a
+8010a7b6:	e8 c5 60 ff ff       	call   80100880 <panic>
+8010a7bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010a7bf:	90                   	nop
+
+8010a7c0 <mappages>:
+{
+8010a7c0:	55                   	push   %ebp
+8010a7c1:	89 e5                	mov    %esp,%ebp
+8010a7c3:	57                   	push   %edi
+8010a7c4:	56                   	push   %esi
+8010a7c5:	53                   	push   %ebx
+  a = (char*)PGROUNDDOWN((uint)va);
+8010a7c6:	89 d3                	mov    %edx,%ebx
+8010a7c8:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+8010a7ce:	83 ec 1c             	sub    $0x1c,%esp
+8010a7d1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  last = (char*)PGROUNDDOWN(((uint)va) + size - 1);
+8010a7d4:	8d 44 0a ff          	lea    -0x1(%edx,%ecx,1),%eax
+8010a7d8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010a7dd:	89 45 dc             	mov    %eax,-0x24(%ebp)
+8010a7e0:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a7e3:	29 d8                	sub    %ebx,%eax
+8010a7e5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010a7e8:	eb 3f                	jmp    8010a829 <mappages+0x69>
+8010a7ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010a7f0:	89 da                	mov    %ebx,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010a7f2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010a7f7:	c1 ea 0a             	shr    $0xa,%edx
+8010a7fa:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010a800:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+8010a807:	85 c0                	test   %eax,%eax
+8010a809:	74 75                	je     8010a880 <mappages+0xc0>
+    if(*pte & PTE_P)
+8010a80b:	f6 00 01             	testb  $0x1,(%eax)
+8010a80e:	0f 85 86 00 00 00    	jne    8010a89a <mappages+0xda>
+    *pte = pa | perm | PTE_P;
+8010a814:	0b 75 0c             	or     0xc(%ebp),%esi
+8010a817:	83 ce 01             	or     $0x1,%esi
+8010a81a:	89 30                	mov    %esi,(%eax)
+    if(a == last)
+8010a81c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+8010a81f:	39 c3                	cmp    %eax,%ebx
+8010a821:	74 6d                	je     8010a890 <mappages+0xd0>
+    a += PGSIZE;
+8010a823:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  for(;;){
+8010a829:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+8010a82c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010a82f:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+8010a832:	89 d8                	mov    %ebx,%eax
+8010a834:	c1 e8 16             	shr    $0x16,%eax
+8010a837:	8d 3c 81             	lea    (%ecx,%eax,4),%edi
+  if(*pde & PTE_P){
+8010a83a:	8b 07                	mov    (%edi),%eax
+8010a83c:	a8 01                	test   $0x1,%al
+8010a83e:	75 b0                	jne    8010a7f0 <mappages+0x30>
+    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+8010a840:	e8 9b 99 ff ff       	call   801041e0 <kalloc>
+8010a845:	85 c0                	test   %eax,%eax
+8010a847:	74 37                	je     8010a880 <mappages+0xc0>
+    memset(pgtab, 0, PGSIZE);
+8010a849:	83 ec 04             	sub    $0x4,%esp
+8010a84c:	68 00 10 00 00       	push   $0x1000
+8010a851:	6a 00                	push   $0x0
+8010a853:	50                   	push   %eax
+8010a854:	89 45 d8             	mov    %eax,-0x28(%ebp)
+8010a857:	e8 a4 d5 ff ff       	call   80107e00 <memset>
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010a85c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  return &pgtab[PTX(va)];
+8010a85f:	83 c4 10             	add    $0x10,%esp
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010a862:	8d 82 00 00 00 80    	lea    -0x80000000(%edx),%eax
+8010a868:	83 c8 07             	or     $0x7,%eax
+8010a86b:	89 07                	mov    %eax,(%edi)
+  return &pgtab[PTX(va)];
+8010a86d:	89 d8                	mov    %ebx,%eax
+8010a86f:	c1 e8 0a             	shr    $0xa,%eax
+8010a872:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010a877:	01 d0                	add    %edx,%eax
+8010a879:	eb 90                	jmp    8010a80b <mappages+0x4b>
+8010a87b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010a87f:	90                   	nop
+}
+8010a880:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010a883:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010a888:	5b                   	pop    %ebx
+8010a889:	5e                   	pop    %esi
+8010a88a:	5f                   	pop    %edi
+8010a88b:	5d                   	pop    %ebp
+8010a88c:	c3                   	ret
+8010a88d:	8d 76 00             	lea    0x0(%esi),%esi
+8010a890:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010a893:	31 c0                	xor    %eax,%eax
+}
+8010a895:	5b                   	pop    %ebx
+8010a896:	5e                   	pop    %esi
+8010a897:	5f                   	pop    %edi
+8010a898:	5d                   	pop    %ebp
+8010a899:	c3                   	ret
+      panic("remap");
+8010a89a:	83 ec 0c             	sub    $0xc,%esp
+8010a89d:	68 44 bf 10 80       	push   $0x8010bf44
+8010a8a2:	e8 d9 5f ff ff       	call   80100880 <panic>
+8010a8a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a8ae:	66 90                	xchg   %ax,%ax
+
+8010a8b0 <seginit>:
+{
+8010a8b0:	55                   	push   %ebp
+8010a8b1:	89 e5                	mov    %esp,%ebp
+8010a8b3:	83 ec 18             	sub    $0x18,%esp
+  c = &cpus[cpuid()];
+8010a8b6:	e8 15 ba ff ff       	call   801062d0 <cpuid>
+  pd[0] = size-1;
+8010a8bb:	ba 2f 00 00 00       	mov    $0x2f,%edx
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+8010a8c0:	69 c0 b4 00 00 00    	imul   $0xb4,%eax,%eax
+8010a8c6:	c7 80 38 e2 13 80 ff 	movl   $0xffff,-0x7fec1dc8(%eax)
+8010a8cd:	ff 00 00 
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+8010a8d0:	c7 80 40 e2 13 80 ff 	movl   $0xffff,-0x7fec1dc0(%eax)
+8010a8d7:	ff 00 00 
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+8010a8da:	c7 80 48 e2 13 80 ff 	movl   $0xffff,-0x7fec1db8(%eax)
+8010a8e1:	ff 00 00 
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+8010a8e4:	c7 80 50 e2 13 80 ff 	movl   $0xffff,-0x7fec1db0(%eax)
+8010a8eb:	ff 00 00 
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+8010a8ee:	c7 80 3c e2 13 80 00 	movl   $0xcf9a00,-0x7fec1dc4(%eax)
+8010a8f5:	9a cf 00 
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+8010a8f8:	c7 80 44 e2 13 80 00 	movl   $0xcf9200,-0x7fec1dbc(%eax)
+8010a8ff:	92 cf 00 
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+8010a902:	c7 80 4c e2 13 80 00 	movl   $0xcffa00,-0x7fec1db4(%eax)
+8010a909:	fa cf 00 
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+8010a90c:	c7 80 54 e2 13 80 00 	movl   $0xcff200,-0x7fec1dac(%eax)
+8010a913:	f2 cf 00 
+  lgdt(c->gdt, sizeof(c->gdt));
+8010a916:	05 30 e2 13 80       	add    $0x8013e230,%eax
+8010a91b:	66 89 55 f2          	mov    %dx,-0xe(%ebp)
+  pd[1] = (uint)p;
+8010a91f:	66 89 45 f4          	mov    %ax,-0xc(%ebp)
+  pd[2] = (uint)p >> 16;
+8010a923:	c1 e8 10             	shr    $0x10,%eax
+8010a926:	66 89 45 f6          	mov    %ax,-0xa(%ebp)
+  asm volatile("lgdt (%0)" : : "r" (pd));
+8010a92a:	8d 45 f2             	lea    -0xe(%ebp),%eax
+8010a92d:	0f 01 10             	lgdtl  (%eax)
+}
+8010a930:	c9                   	leave
+8010a931:	c3                   	ret
+8010a932:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a939:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+8010a940 <switchkvm>:
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+8010a940:	a1 a4 3d 14 80       	mov    0x80143da4,%eax
+8010a945:	05 00 00 00 80       	add    $0x80000000,%eax
+}
+
+static inline void
+lcr3(uint val)
+{
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010a94a:	0f 22 d8             	mov    %eax,%cr3
+}
+8010a94d:	c3                   	ret
+8010a94e:	66 90                	xchg   %ax,%ax
+
+8010a950 <switchuvm>:
+{
+8010a950:	55                   	push   %ebp
+8010a951:	89 e5                	mov    %esp,%ebp
+8010a953:	57                   	push   %edi
+8010a954:	56                   	push   %esi
+8010a955:	53                   	push   %ebx
+8010a956:	83 ec 1c             	sub    $0x1c,%esp
+8010a959:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(p == 0)
+8010a95c:	85 f6                	test   %esi,%esi
+8010a95e:	0f 84 cb 00 00 00    	je     8010aa2f <switchuvm+0xdf>
+  if(p->kstack == 0)
+8010a964:	8b 46 08             	mov    0x8(%esi),%eax
+8010a967:	85 c0                	test   %eax,%eax
+8010a969:	0f 84 da 00 00 00    	je     8010aa49 <switchuvm+0xf9>
+  if(p->pgdir == 0)
+8010a96f:	8b 46 04             	mov    0x4(%esi),%eax
+8010a972:	85 c0                	test   %eax,%eax
+8010a974:	0f 84 c2 00 00 00    	je     8010aa3c <switchuvm+0xec>
+  pushcli();
+8010a97a:	e8 51 d2 ff ff       	call   80107bd0 <pushcli>
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
+8010a97f:	e8 ec b8 ff ff       	call   80106270 <mycpu>
+8010a984:	89 c3                	mov    %eax,%ebx
+8010a986:	e8 e5 b8 ff ff       	call   80106270 <mycpu>
+8010a98b:	89 c7                	mov    %eax,%edi
+8010a98d:	e8 de b8 ff ff       	call   80106270 <mycpu>
+8010a992:	83 c7 08             	add    $0x8,%edi
+8010a995:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010a998:	e8 d3 b8 ff ff       	call   80106270 <mycpu>
+8010a99d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010a9a0:	ba 67 00 00 00       	mov    $0x67,%edx
+8010a9a5:	66 89 bb 9a 00 00 00 	mov    %di,0x9a(%ebx)
+8010a9ac:	83 c0 08             	add    $0x8,%eax
+8010a9af:	66 89 93 98 00 00 00 	mov    %dx,0x98(%ebx)
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+8010a9b6:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
+8010a9bb:	83 c1 08             	add    $0x8,%ecx
+8010a9be:	c1 e8 18             	shr    $0x18,%eax
+8010a9c1:	c1 e9 10             	shr    $0x10,%ecx
+8010a9c4:	88 83 9f 00 00 00    	mov    %al,0x9f(%ebx)
+8010a9ca:	88 8b 9c 00 00 00    	mov    %cl,0x9c(%ebx)
+8010a9d0:	b9 99 40 00 00       	mov    $0x4099,%ecx
+8010a9d5:	66 89 8b 9d 00 00 00 	mov    %cx,0x9d(%ebx)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+8010a9dc:	bb 10 00 00 00       	mov    $0x10,%ebx
+  mycpu()->gdt[SEG_TSS].s = 0;
+8010a9e1:	e8 8a b8 ff ff       	call   80106270 <mycpu>
+8010a9e6:	80 a0 9d 00 00 00 ef 	andb   $0xef,0x9d(%eax)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+8010a9ed:	e8 7e b8 ff ff       	call   80106270 <mycpu>
+8010a9f2:	66 89 58 10          	mov    %bx,0x10(%eax)
+  mycpu()->ts.esp0 = (uint)p->kstack + KSTACKSIZE;
+8010a9f6:	8b 5e 08             	mov    0x8(%esi),%ebx
+8010a9f9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010a9ff:	e8 6c b8 ff ff       	call   80106270 <mycpu>
+8010aa04:	89 58 0c             	mov    %ebx,0xc(%eax)
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+8010aa07:	e8 64 b8 ff ff       	call   80106270 <mycpu>
+8010aa0c:	66 89 78 6e          	mov    %di,0x6e(%eax)
+  asm volatile("ltr %0" : : "r" (sel));
+8010aa10:	b8 28 00 00 00       	mov    $0x28,%eax
+8010aa15:	0f 00 d8             	ltr    %ax
+  lcr3(V2P(p->pgdir));  // switch to process's address space
+8010aa18:	8b 46 04             	mov    0x4(%esi),%eax
+8010aa1b:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010aa20:	0f 22 d8             	mov    %eax,%cr3
+}
+8010aa23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010aa26:	5b                   	pop    %ebx
+8010aa27:	5e                   	pop    %esi
+8010aa28:	5f                   	pop    %edi
+8010aa29:	5d                   	pop    %ebp
+  popcli();
+8010aa2a:	e9 f1 d1 ff ff       	jmp    80107c20 <popcli>
+    panic("switchuvm: no process");
+8010aa2f:	83 ec 0c             	sub    $0xc,%esp
+8010aa32:	68 4a bf 10 80       	push   $0x8010bf4a
+8010aa37:	e8 44 5e ff ff       	call   80100880 <panic>
+    panic("switchuvm: no pgdir");
+8010aa3c:	83 ec 0c             	sub    $0xc,%esp
+8010aa3f:	68 75 bf 10 80       	push   $0x8010bf75
+8010aa44:	e8 37 5e ff ff       	call   80100880 <panic>
+    panic("switchuvm: no kstack");
+8010aa49:	83 ec 0c             	sub    $0xc,%esp
+8010aa4c:	68 60 bf 10 80       	push   $0x8010bf60
+8010aa51:	e8 2a 5e ff ff       	call   80100880 <panic>
+8010aa56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010aa5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+8010aa60 <inituvm>:
+{
+8010aa60:	55                   	push   %ebp
+8010aa61:	89 e5                	mov    %esp,%ebp
+8010aa63:	57                   	push   %edi
+8010aa64:	56                   	push   %esi
+8010aa65:	53                   	push   %ebx
+8010aa66:	83 ec 1c             	sub    $0x1c,%esp
+8010aa69:	8b 45 08             	mov    0x8(%ebp),%eax
+8010aa6c:	8b 75 10             	mov    0x10(%ebp),%esi
+8010aa6f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+8010aa72:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(sz >= PGSIZE)
+8010aa75:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+8010aa7b:	77 49                	ja     8010aac6 <inituvm+0x66>
+  mem = kalloc();
+8010aa7d:	e8 5e 97 ff ff       	call   801041e0 <kalloc>
+  memset(mem, 0, PGSIZE);
+8010aa82:	83 ec 04             	sub    $0x4,%esp
+8010aa85:	68 00 10 00 00       	push   $0x1000
+  mem = kalloc();
+8010aa8a:	89 c3                	mov    %eax,%ebx
+  memset(mem, 0, PGSIZE);
+8010aa8c:	6a 00                	push   $0x0
+8010aa8e:	50                   	push   %eax
+8010aa8f:	e8 6c d3 ff ff       	call   80107e00 <memset>
+  mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
+8010aa94:	58                   	pop    %eax
+8010aa95:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010aa9b:	5a                   	pop    %edx
+8010aa9c:	6a 06                	push   $0x6
+8010aa9e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010aaa3:	31 d2                	xor    %edx,%edx
+8010aaa5:	50                   	push   %eax
+8010aaa6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010aaa9:	e8 12 fd ff ff       	call   8010a7c0 <mappages>
+  memmove(mem, init, sz);
+8010aaae:	89 75 10             	mov    %esi,0x10(%ebp)
+8010aab1:	83 c4 10             	add    $0x10,%esp
+8010aab4:	89 7d 0c             	mov    %edi,0xc(%ebp)
+8010aab7:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+8010aaba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010aabd:	5b                   	pop    %ebx
+8010aabe:	5e                   	pop    %esi
+8010aabf:	5f                   	pop    %edi
+8010aac0:	5d                   	pop    %ebp
+  memmove(mem, init, sz);
+8010aac1:	e9 ca d3 ff ff       	jmp    80107e90 <memmove>
+    panic("inituvm: more than a page");
+8010aac6:	83 ec 0c             	sub    $0xc,%esp
+8010aac9:	68 89 bf 10 80       	push   $0x8010bf89
+8010aace:	e8 ad 5d ff ff       	call   80100880 <panic>
+8010aad3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010aada:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010aae0 <loaduvm>:
+{
+8010aae0:	55                   	push   %ebp
+8010aae1:	89 e5                	mov    %esp,%ebp
+8010aae3:	57                   	push   %edi
+8010aae4:	56                   	push   %esi
+8010aae5:	53                   	push   %ebx
+8010aae6:	83 ec 0c             	sub    $0xc,%esp
+  if((uint) addr % PGSIZE != 0)
+8010aae9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+8010aaec:	8b 7d 18             	mov    0x18(%ebp),%edi
+  if((uint) addr % PGSIZE != 0)
+8010aaef:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+8010aaf5:	0f 85 a2 00 00 00    	jne    8010ab9d <loaduvm+0xbd>
+  for(i = 0; i < sz; i += PGSIZE){
+8010aafb:	85 ff                	test   %edi,%edi
+8010aafd:	74 7d                	je     8010ab7c <loaduvm+0x9c>
+8010aaff:	90                   	nop
+  pde = &pgdir[PDX(va)];
+8010ab00:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(*pde & PTE_P){
+8010ab03:	8b 55 08             	mov    0x8(%ebp),%edx
+8010ab06:	01 f0                	add    %esi,%eax
+  pde = &pgdir[PDX(va)];
+8010ab08:	89 c1                	mov    %eax,%ecx
+8010ab0a:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010ab0d:	8b 0c 8a             	mov    (%edx,%ecx,4),%ecx
+8010ab10:	f6 c1 01             	test   $0x1,%cl
+8010ab13:	75 13                	jne    8010ab28 <loaduvm+0x48>
+      panic("loaduvm: address should exist");
+8010ab15:	83 ec 0c             	sub    $0xc,%esp
+8010ab18:	68 a3 bf 10 80       	push   $0x8010bfa3
+8010ab1d:	e8 5e 5d ff ff       	call   80100880 <panic>
+8010ab22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010ab28:	c1 e8 0a             	shr    $0xa,%eax
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010ab2b:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  return &pgtab[PTX(va)];
+8010ab31:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010ab36:	8d 8c 01 00 00 00 80 	lea    -0x80000000(%ecx,%eax,1),%ecx
+    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
+8010ab3d:	85 c9                	test   %ecx,%ecx
+8010ab3f:	74 d4                	je     8010ab15 <loaduvm+0x35>
+    if(sz - i < PGSIZE)
+8010ab41:	89 fb                	mov    %edi,%ebx
+8010ab43:	b8 00 10 00 00       	mov    $0x1000,%eax
+8010ab48:	29 f3                	sub    %esi,%ebx
+8010ab4a:	39 c3                	cmp    %eax,%ebx
+8010ab4c:	0f 47 d8             	cmova  %eax,%ebx
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+8010ab4f:	53                   	push   %ebx
+8010ab50:	8b 45 14             	mov    0x14(%ebp),%eax
+8010ab53:	01 f0                	add    %esi,%eax
+8010ab55:	50                   	push   %eax
+    pa = PTE_ADDR(*pte);
+8010ab56:	8b 01                	mov    (%ecx),%eax
+8010ab58:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+8010ab5d:	05 00 00 00 80       	add    $0x80000000,%eax
+8010ab62:	50                   	push   %eax
+8010ab63:	ff 75 10             	push   0x10(%ebp)
+8010ab66:	e8 65 80 ff ff       	call   80102bd0 <readi>
+8010ab6b:	83 c4 10             	add    $0x10,%esp
+8010ab6e:	39 d8                	cmp    %ebx,%eax
+8010ab70:	75 1e                	jne    8010ab90 <loaduvm+0xb0>
+  for(i = 0; i < sz; i += PGSIZE){
+8010ab72:	81 c6 00 10 00 00    	add    $0x1000,%esi
+8010ab78:	39 fe                	cmp    %edi,%esi
+8010ab7a:	72 84                	jb     8010ab00 <loaduvm+0x20>
+}
+8010ab7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010ab7f:	31 c0                	xor    %eax,%eax
+}
+8010ab81:	5b                   	pop    %ebx
+8010ab82:	5e                   	pop    %esi
+8010ab83:	5f                   	pop    %edi
+8010ab84:	5d                   	pop    %ebp
+8010ab85:	c3                   	ret
+8010ab86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010ab8d:	8d 76 00             	lea    0x0(%esi),%esi
+8010ab90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010ab93:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010ab98:	5b                   	pop    %ebx
+8010ab99:	5e                   	pop    %esi
+8010ab9a:	5f                   	pop    %edi
+8010ab9b:	5d                   	pop    %ebp
+8010ab9c:	c3                   	ret
+    panic("loaduvm: addr must be page aligned");
+8010ab9d:	83 ec 0c             	sub    $0xc,%esp
+8010aba0:	68 10 c0 10 80       	push   $0x8010c010
+8010aba5:	e8 d6 5c ff ff       	call   80100880 <panic>
+8010abaa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010abb0 <allocuvm>:
+{
+8010abb0:	55                   	push   %ebp
+8010abb1:	89 e5                	mov    %esp,%ebp
+8010abb3:	57                   	push   %edi
+8010abb4:	56                   	push   %esi
+8010abb5:	53                   	push   %ebx
+8010abb6:	83 ec 1c             	sub    $0x1c,%esp
+8010abb9:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(newsz >= KERNBASE)
+8010abbc:	85 f6                	test   %esi,%esi
+8010abbe:	0f 88 98 00 00 00    	js     8010ac5c <allocuvm+0xac>
+8010abc4:	89 f2                	mov    %esi,%edx
+  if(newsz < oldsz)
+8010abc6:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010abc9:	0f 82 a1 00 00 00    	jb     8010ac70 <allocuvm+0xc0>
+  a = PGROUNDUP(oldsz);
+8010abcf:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010abd2:	05 ff 0f 00 00       	add    $0xfff,%eax
+8010abd7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010abdc:	89 c7                	mov    %eax,%edi
+  for(; a < newsz; a += PGSIZE){
+8010abde:	39 f0                	cmp    %esi,%eax
+8010abe0:	0f 83 8d 00 00 00    	jae    8010ac73 <allocuvm+0xc3>
+8010abe6:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+8010abe9:	eb 44                	jmp    8010ac2f <allocuvm+0x7f>
+8010abeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010abef:	90                   	nop
+    memset(mem, 0, PGSIZE);
+8010abf0:	83 ec 04             	sub    $0x4,%esp
+8010abf3:	68 00 10 00 00       	push   $0x1000
+8010abf8:	6a 00                	push   $0x0
+8010abfa:	50                   	push   %eax
+8010abfb:	e8 00 d2 ff ff       	call   80107e00 <memset>
+    if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+8010ac00:	58                   	pop    %eax
+8010ac01:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010ac07:	5a                   	pop    %edx
+8010ac08:	6a 06                	push   $0x6
+8010ac0a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010ac0f:	89 fa                	mov    %edi,%edx
+8010ac11:	50                   	push   %eax
+8010ac12:	8b 45 08             	mov    0x8(%ebp),%eax
+8010ac15:	e8 a6 fb ff ff       	call   8010a7c0 <mappages>
+8010ac1a:	83 c4 10             	add    $0x10,%esp
+8010ac1d:	85 c0                	test   %eax,%eax
+8010ac1f:	78 5f                	js     8010ac80 <allocuvm+0xd0>
+  for(; a < newsz; a += PGSIZE){
+8010ac21:	81 c7 00 10 00 00    	add    $0x1000,%edi
+8010ac27:	39 f7                	cmp    %esi,%edi
+8010ac29:	0f 83 89 00 00 00    	jae    8010acb8 <allocuvm+0x108>
+    mem = kalloc();
+8010ac2f:	e8 ac 95 ff ff       	call   801041e0 <kalloc>
+8010ac34:	89 c3                	mov    %eax,%ebx
+    if(mem == 0){
+8010ac36:	85 c0                	test   %eax,%eax
+8010ac38:	75 b6                	jne    8010abf0 <allocuvm+0x40>
+      cprintf("allocuvm out of memory\n");
+8010ac3a:	83 ec 0c             	sub    $0xc,%esp
+8010ac3d:	68 c1 bf 10 80       	push   $0x8010bfc1
+8010ac42:	e8 69 5f ff ff       	call   80100bb0 <cprintf>
+  if(newsz >= oldsz)
+8010ac47:	83 c4 10             	add    $0x10,%esp
+8010ac4a:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010ac4d:	74 0d                	je     8010ac5c <allocuvm+0xac>
+8010ac4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010ac52:	8b 45 08             	mov    0x8(%ebp),%eax
+8010ac55:	89 f2                	mov    %esi,%edx
+8010ac57:	e8 a4 fa ff ff       	call   8010a700 <deallocuvm.part.0>
+    return 0;
+8010ac5c:	31 d2                	xor    %edx,%edx
+}
+8010ac5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ac61:	89 d0                	mov    %edx,%eax
+8010ac63:	5b                   	pop    %ebx
+8010ac64:	5e                   	pop    %esi
+8010ac65:	5f                   	pop    %edi
+8010ac66:	5d                   	pop    %ebp
+8010ac67:	c3                   	ret
+8010ac68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010ac6f:	90                   	nop
+    return oldsz;
+8010ac70:	8b 55 0c             	mov    0xc(%ebp),%edx
+}
+8010ac73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ac76:	89 d0                	mov    %edx,%eax
+8010ac78:	5b                   	pop    %ebx
+8010ac79:	5e                   	pop    %esi
+8010ac7a:	5f                   	pop    %edi
+8010ac7b:	5d                   	pop    %ebp
+8010ac7c:	c3                   	ret
+8010ac7d:	8d 76 00             	lea    0x0(%esi),%esi
+      cprintf("allocuvm out of memory (2)\n");
+8010ac80:	83 ec 0c             	sub    $0xc,%esp
+8010ac83:	68 d9 bf 10 80       	push   $0x8010bfd9
+8010ac88:	e8 23 5f ff ff       	call   80100bb0 <cprintf>
+  if(newsz >= oldsz)
+8010ac8d:	83 c4 10             	add    $0x10,%esp
+8010ac90:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010ac93:	74 0d                	je     8010aca2 <allocuvm+0xf2>
+8010ac95:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010ac98:	8b 45 08             	mov    0x8(%ebp),%eax
+8010ac9b:	89 f2                	mov    %esi,%edx
+8010ac9d:	e8 5e fa ff ff       	call   8010a700 <deallocuvm.part.0>
+      kfree(mem);
+8010aca2:	83 ec 0c             	sub    $0xc,%esp
+8010aca5:	53                   	push   %ebx
+8010aca6:	e8 75 92 ff ff       	call   80103f20 <kfree>
+      return 0;
+8010acab:	83 c4 10             	add    $0x10,%esp
+    return 0;
+8010acae:	31 d2                	xor    %edx,%edx
+8010acb0:	eb ac                	jmp    8010ac5e <allocuvm+0xae>
+8010acb2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+8010acb8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+}
+8010acbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010acbe:	5b                   	pop    %ebx
+8010acbf:	5e                   	pop    %esi
+8010acc0:	89 d0                	mov    %edx,%eax
+8010acc2:	5f                   	pop    %edi
+8010acc3:	5d                   	pop    %ebp
+8010acc4:	c3                   	ret
+8010acc5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010accc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+8010acd0 <deallocuvm>:
+{
+8010acd0:	55                   	push   %ebp
+8010acd1:	89 e5                	mov    %esp,%ebp
+8010acd3:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010acd6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+8010acd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(newsz >= oldsz)
+8010acdc:	39 d1                	cmp    %edx,%ecx
+8010acde:	73 10                	jae    8010acf0 <deallocuvm+0x20>
+}
+8010ace0:	5d                   	pop    %ebp
+8010ace1:	e9 1a fa ff ff       	jmp    8010a700 <deallocuvm.part.0>
+8010ace6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010aced:	8d 76 00             	lea    0x0(%esi),%esi
+8010acf0:	89 d0                	mov    %edx,%eax
+8010acf2:	5d                   	pop    %ebp
+8010acf3:	c3                   	ret
+8010acf4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010acfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010acff:	90                   	nop
+
+8010ad00 <freevm>:
+
+// Free a page table and all the physical memory pages
+// in the user part.
+void
+freevm(pde_t *pgdir)
+{
+8010ad00:	55                   	push   %ebp
+8010ad01:	89 e5                	mov    %esp,%ebp
+8010ad03:	57                   	push   %edi
+8010ad04:	56                   	push   %esi
+8010ad05:	53                   	push   %ebx
+8010ad06:	83 ec 0c             	sub    $0xc,%esp
+8010ad09:	8b 75 08             	mov    0x8(%ebp),%esi
+  uint i;
+
+  if(pgdir == 0)
+8010ad0c:	85 f6                	test   %esi,%esi
+8010ad0e:	74 59                	je     8010ad69 <freevm+0x69>
+  if(newsz >= oldsz)
+8010ad10:	31 c9                	xor    %ecx,%ecx
+8010ad12:	ba 00 00 00 80       	mov    $0x80000000,%edx
+8010ad17:	89 f0                	mov    %esi,%eax
+8010ad19:	89 f3                	mov    %esi,%ebx
+8010ad1b:	e8 e0 f9 ff ff       	call   8010a700 <deallocuvm.part.0>
+    panic("freevm: no pgdir");
+  deallocuvm(pgdir, KERNBASE, 0);
+  for(i = 0; i < NPDENTRIES; i++){
+8010ad20:	8d be 00 10 00 00    	lea    0x1000(%esi),%edi
+8010ad26:	eb 0f                	jmp    8010ad37 <freevm+0x37>
+8010ad28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010ad2f:	90                   	nop
+8010ad30:	83 c3 04             	add    $0x4,%ebx
+8010ad33:	39 fb                	cmp    %edi,%ebx
+8010ad35:	74 23                	je     8010ad5a <freevm+0x5a>
+    if(pgdir[i] & PTE_P){
+8010ad37:	8b 03                	mov    (%ebx),%eax
+8010ad39:	a8 01                	test   $0x1,%al
+8010ad3b:	74 f3                	je     8010ad30 <freevm+0x30>
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+8010ad3d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+      kfree(v);
+8010ad42:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < NPDENTRIES; i++){
+8010ad45:	83 c3 04             	add    $0x4,%ebx
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+8010ad48:	05 00 00 00 80       	add    $0x80000000,%eax
+      kfree(v);
+8010ad4d:	50                   	push   %eax
+8010ad4e:	e8 cd 91 ff ff       	call   80103f20 <kfree>
+8010ad53:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NPDENTRIES; i++){
+8010ad56:	39 fb                	cmp    %edi,%ebx
+8010ad58:	75 dd                	jne    8010ad37 <freevm+0x37>
+    }
+  }
+  kfree((char*)pgdir);
+8010ad5a:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+8010ad5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ad60:	5b                   	pop    %ebx
+8010ad61:	5e                   	pop    %esi
+8010ad62:	5f                   	pop    %edi
+8010ad63:	5d                   	pop    %ebp
+  kfree((char*)pgdir);
+8010ad64:	e9 b7 91 ff ff       	jmp    80103f20 <kfree>
+    panic("freevm: no pgdir");
+8010ad69:	83 ec 0c             	sub    $0xc,%esp
+8010ad6c:	68 f5 bf 10 80       	push   $0x8010bff5
+8010ad71:	e8 0a 5b ff ff       	call   80100880 <panic>
+8010ad76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010ad7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+8010ad80 <setupkvm>:
+{
+8010ad80:	55                   	push   %ebp
+8010ad81:	89 e5                	mov    %esp,%ebp
+8010ad83:	56                   	push   %esi
+8010ad84:	53                   	push   %ebx
+  if((pgdir = (pde_t*)kalloc()) == 0)
+8010ad85:	e8 56 94 ff ff       	call   801041e0 <kalloc>
+8010ad8a:	85 c0                	test   %eax,%eax
+8010ad8c:	74 5e                	je     8010adec <setupkvm+0x6c>
+  memset(pgdir, 0, PGSIZE);
+8010ad8e:	83 ec 04             	sub    $0x4,%esp
+8010ad91:	89 c6                	mov    %eax,%esi
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+8010ad93:	bb 20 f4 10 80       	mov    $0x8010f420,%ebx
+  memset(pgdir, 0, PGSIZE);
+8010ad98:	68 00 10 00 00       	push   $0x1000
+8010ad9d:	6a 00                	push   $0x0
+8010ad9f:	50                   	push   %eax
+8010ada0:	e8 5b d0 ff ff       	call   80107e00 <memset>
+8010ada5:	83 c4 10             	add    $0x10,%esp
+                (uint)k->phys_start, k->perm) < 0) {
+8010ada8:	8b 43 04             	mov    0x4(%ebx),%eax
+    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
+8010adab:	83 ec 08             	sub    $0x8,%esp
+8010adae:	8b 4b 08             	mov    0x8(%ebx),%ecx
+8010adb1:	8b 13                	mov    (%ebx),%edx
+8010adb3:	ff 73 0c             	push   0xc(%ebx)
+8010adb6:	50                   	push   %eax
+8010adb7:	29 c1                	sub    %eax,%ecx
+8010adb9:	89 f0                	mov    %esi,%eax
+8010adbb:	e8 00 fa ff ff       	call   8010a7c0 <mappages>
+8010adc0:	83 c4 10             	add    $0x10,%esp
+8010adc3:	85 c0                	test   %eax,%eax
+8010adc5:	78 19                	js     8010ade0 <setupkvm+0x60>
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+8010adc7:	83 c3 10             	add    $0x10,%ebx
+8010adca:	81 fb 60 f4 10 80    	cmp    $0x8010f460,%ebx
+8010add0:	75 d6                	jne    8010ada8 <setupkvm+0x28>
+}
+8010add2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010add5:	89 f0                	mov    %esi,%eax
+8010add7:	5b                   	pop    %ebx
+8010add8:	5e                   	pop    %esi
+8010add9:	5d                   	pop    %ebp
+8010adda:	c3                   	ret
+8010addb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010addf:	90                   	nop
+      freevm(pgdir);
+8010ade0:	83 ec 0c             	sub    $0xc,%esp
+8010ade3:	56                   	push   %esi
+8010ade4:	e8 17 ff ff ff       	call   8010ad00 <freevm>
+      return 0;
+8010ade9:	83 c4 10             	add    $0x10,%esp
+}
+8010adec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+8010adef:	31 f6                	xor    %esi,%esi
+}
+8010adf1:	89 f0                	mov    %esi,%eax
+8010adf3:	5b                   	pop    %ebx
+8010adf4:	5e                   	pop    %esi
+8010adf5:	5d                   	pop    %ebp
+8010adf6:	c3                   	ret
+8010adf7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010adfe:	66 90                	xchg   %ax,%ax
+
+8010ae00 <kvmalloc>:
+{
+8010ae00:	55                   	push   %ebp
+8010ae01:	89 e5                	mov    %esp,%ebp
+8010ae03:	83 ec 08             	sub    $0x8,%esp
+  kpgdir = setupkvm();
+8010ae06:	e8 75 ff ff ff       	call   8010ad80 <setupkvm>
+8010ae0b:	a3 a4 3d 14 80       	mov    %eax,0x80143da4
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+8010ae10:	05 00 00 00 80       	add    $0x80000000,%eax
+8010ae15:	0f 22 d8             	mov    %eax,%cr3
+}
+8010ae18:	c9                   	leave
+8010ae19:	c3                   	ret
+8010ae1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010ae20 <clearpteu>:
+
+// Clear PTE_U on a page. Used to create an inaccessible
+// page beneath the user stack.
+void
+clearpteu(pde_t *pgdir, char *uva)
+{
+8010ae20:	55                   	push   %ebp
+8010ae21:	89 e5                	mov    %esp,%ebp
+8010ae23:	83 ec 08             	sub    $0x8,%esp
+8010ae26:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(*pde & PTE_P){
+8010ae29:	8b 55 08             	mov    0x8(%ebp),%edx
+  pde = &pgdir[PDX(va)];
+8010ae2c:	89 c1                	mov    %eax,%ecx
+8010ae2e:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010ae31:	8b 14 8a             	mov    (%edx,%ecx,4),%edx
+8010ae34:	f6 c2 01             	test   $0x1,%dl
+8010ae37:	75 17                	jne    8010ae50 <clearpteu+0x30>
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+  if(pte == 0)
+    panic("clearpteu");
+8010ae39:	83 ec 0c             	sub    $0xc,%esp
+8010ae3c:	68 06 c0 10 80       	push   $0x8010c006
+8010ae41:	e8 3a 5a ff ff       	call   80100880 <panic>
+8010ae46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010ae4d:	8d 76 00             	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010ae50:	c1 e8 0a             	shr    $0xa,%eax
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010ae53:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  return &pgtab[PTX(va)];
+8010ae59:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010ae5e:	8d 84 02 00 00 00 80 	lea    -0x80000000(%edx,%eax,1),%eax
+  if(pte == 0)
+8010ae65:	85 c0                	test   %eax,%eax
+8010ae67:	74 d0                	je     8010ae39 <clearpteu+0x19>
+  *pte &= ~PTE_U;
+8010ae69:	83 20 fb             	andl   $0xfffffffb,(%eax)
+}
+8010ae6c:	c9                   	leave
+8010ae6d:	c3                   	ret
+8010ae6e:	66 90                	xchg   %ax,%ax
+
+8010ae70 <copyuvm>:
+// map the same physical pages, with writable ones made
+// read-only and marked PTE_COW. cowfault() makes the private
+// copy when either side writes.
+pde_t*
+copyuvm(pde_t *pgdir, uint sz)
+{
+8010ae70:	55                   	push   %ebp
+8010ae71:	89 e5                	mov    %esp,%ebp
+8010ae73:	57                   	push   %edi
+8010ae74:	56                   	push   %esi
+8010ae75:	53                   	push   %ebx
+8010ae76:	83 ec 1c             	sub    $0x1c,%esp
+8010ae79:	8b 75 0c             	mov    0xc(%ebp),%esi
+  pde_t *d;
+  pte_t *pte;
+  uint pa, i, flags;
+
+  if((d = setupkvm()) == 0)
+8010ae7c:	e8 ff fe ff ff       	call   8010ad80 <setupkvm>
+8010ae81:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010ae84:	85 c0                	test   %eax,%eax
+8010ae86:	0f 84 e2 00 00 00    	je     8010af6e <copyuvm+0xfe>
+    return 0;
+  for(i = 0; i < sz; i += PGSIZE){
+8010ae8c:	85 f6                	test   %esi,%esi
+8010ae8e:	0f 84 ab 00 00 00    	je     8010af3f <copyuvm+0xcf>
+8010ae94:	31 ff                	xor    %edi,%edi
+8010ae96:	89 75 0c             	mov    %esi,0xc(%ebp)
+8010ae99:	89 fe                	mov    %edi,%esi
+8010ae9b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+8010ae9e:	eb 10                	jmp    8010aeb0 <copyuvm+0x40>
+    // Heap pages are allocated lazily; skip untouched ones.
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+8010aea0:	83 c1 01             	add    $0x1,%ecx
+8010aea3:	89 ce                	mov    %ecx,%esi
+8010aea5:	c1 e6 16             	shl    $0x16,%esi
+  for(i = 0; i < sz; i += PGSIZE){
+8010aea8:	39 fe                	cmp    %edi,%esi
+8010aeaa:	0f 83 8f 00 00 00    	jae    8010af3f <copyuvm+0xcf>
+  if(*pde & PTE_P){
+8010aeb0:	8b 45 08             	mov    0x8(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+8010aeb3:	89 f1                	mov    %esi,%ecx
+8010aeb5:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010aeb8:	8b 04 88             	mov    (%eax,%ecx,4),%eax
+8010aebb:	a8 01                	test   $0x1,%al
+8010aebd:	74 e1                	je     8010aea0 <copyuvm+0x30>
+  return &pgtab[PTX(va)];
+8010aebf:	89 f3                	mov    %esi,%ebx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010aec1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010aec6:	c1 eb 0a             	shr    $0xa,%ebx
+8010aec9:	81 e3 fc 0f 00 00    	and    $0xffc,%ebx
+8010aecf:	8d 84 18 00 00 00 80 	lea    -0x80000000(%eax,%ebx,1),%eax
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+8010aed6:	85 c0                	test   %eax,%eax
+8010aed8:	74 c6                	je     8010aea0 <copyuvm+0x30>
+      continue;
+    }
+    if(!(*pte & PTE_P))
+8010aeda:	8b 08                	mov    (%eax),%ecx
+8010aedc:	f6 c1 01             	test   $0x1,%cl
+8010aedf:	74 6f                	je     8010af50 <copyuvm+0xe0>
+      continue;
+    if(*pte & PTE_W){
+8010aee1:	f6 c1 02             	test   $0x2,%cl
+8010aee4:	74 10                	je     8010aef6 <copyuvm+0x86>
+      *pte = (*pte & ~PTE_W) | PTE_COW;
+8010aee6:	81 e1 fd fd ff ff    	and    $0xfffffdfd,%ecx
+8010aeec:	80 cd 02             	or     $0x2,%ch
+8010aeef:	89 08                	mov    %ecx,(%eax)
+}
+
+static inline void
+invlpg(void *addr)
+{
+  asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
+8010aef1:	0f 01 3e             	invlpg (%esi)
+      invlpg((void*)i);
+    }
+    pa = PTE_ADDR(*pte);
+8010aef4:	8b 08                	mov    (%eax),%ecx
+8010aef6:	89 cb                	mov    %ecx,%ebx
+    flags = PTE_FLAGS(*pte);
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
+8010aef8:	83 ec 08             	sub    $0x8,%esp
+    flags = PTE_FLAGS(*pte);
+8010aefb:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
+8010af01:	89 f2                	mov    %esi,%edx
+    pa = PTE_ADDR(*pte);
+8010af03:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
+8010af09:	51                   	push   %ecx
+8010af0a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010af0f:	53                   	push   %ebx
+8010af10:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010af13:	e8 a8 f8 ff ff       	call   8010a7c0 <mappages>
+8010af18:	83 c4 10             	add    $0x10,%esp
+8010af1b:	85 c0                	test   %eax,%eax
+8010af1d:	78 41                	js     8010af60 <copyuvm+0xf0>
+      goto bad;
+    kincref(P2V(pa));
+8010af1f:	83 ec 0c             	sub    $0xc,%esp
+8010af22:	81 c3 00 00 00 80    	add    $0x80000000,%ebx
+  for(i = 0; i < sz; i += PGSIZE){
+8010af28:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    kincref(P2V(pa));
+8010af2e:	53                   	push   %ebx
+8010af2f:	e8 cc 93 ff ff       	call   80104300 <kincref>
+  for(i = 0; i < sz; i += PGSIZE){
+8010af34:	83 c4 10             	add    $0x10,%esp
+8010af37:	39 fe                	cmp    %edi,%esi
+8010af39:	0f 82 71 ff ff ff    	jb     8010aeb0 <copyuvm+0x40>
+  return d;
+
+bad:
+  freevm(d);
+  return 0;
+}
+8010af3f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010af42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010af45:	5b                   	pop    %ebx
+8010af46:	5e                   	pop    %esi
+8010af47:	5f                   	pop    %edi
+8010af48:	5d                   	pop    %ebp
+8010af49:	c3                   	ret
+8010af4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < sz; i += PGSIZE){
+8010af50:	81 c6 00 10 00 00    	add    $0x1000,%esi
+8010af56:	e9 4d ff ff ff       	jmp    8010aea8 <copyuvm+0x38>
+8010af5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010af5f:	90                   	nop
+  freevm(d);
+8010af60:	83 ec 0c             	sub    $0xc,%esp
+8010af63:	ff 75 e4             	push   -0x1c(%ebp)
+8010af66:	e8 95 fd ff ff       	call   8010ad00 <freevm>
+  return 0;
+8010af6b:	83 c4 10             	add    $0x10,%esp
+    return 0;
+8010af6e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+}
+8010af75:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010af78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010af7b:	5b                   	pop    %ebx
+8010af7c:	5e                   	pop    %esi
+8010af7d:	5f                   	pop    %edi
+8010af7e:	5d                   	pop    %ebp
+8010af7f:	c3                   	ret
+
+8010af80 <cowfault>:
+// the page writable if no one else refers to it any more.
+// Returns 0 on success, -1 if va is not a copy-on-write page
+// or no memory is left for the copy.
+int
+cowfault(pde_t *pgdir, uint va)
+{
+8010af80:	55                   	push   %ebp
+8010af81:	89 e5                	mov    %esp,%ebp
+8010af83:	57                   	push   %edi
+8010af84:	56                   	push   %esi
+8010af85:	53                   	push   %ebx
+8010af86:	83 ec 1c             	sub    $0x1c,%esp
+8010af89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  pte_t *pte;
+  uint pa, flags;
+  char *mem;
+
+  if(va >= KERNBASE)
+8010af8c:	85 db                	test   %ebx,%ebx
+8010af8e:	0f 88 8c 00 00 00    	js     8010b020 <cowfault+0xa0>
+  if(*pde & PTE_P){
+8010af94:	8b 45 08             	mov    0x8(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+8010af97:	89 da                	mov    %ebx,%edx
+8010af99:	c1 ea 16             	shr    $0x16,%edx
+  if(*pde & PTE_P){
+8010af9c:	8b 04 90             	mov    (%eax,%edx,4),%eax
+8010af9f:	a8 01                	test   $0x1,%al
+8010afa1:	74 7d                	je     8010b020 <cowfault+0xa0>
+  return &pgtab[PTX(va)];
+8010afa3:	89 da                	mov    %ebx,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010afa5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010afaa:	c1 ea 0a             	shr    $0xa,%edx
+8010afad:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010afb3:	8d b4 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%esi
+    return -1;
+  if((pte = walkpgdir(pgdir, (void*)va, 0)) == 0)
+8010afba:	85 f6                	test   %esi,%esi
+8010afbc:	74 62                	je     8010b020 <cowfault+0xa0>
+    return -1;
+  if((*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+8010afbe:	8b 06                	mov    (%esi),%eax
+8010afc0:	89 c2                	mov    %eax,%edx
+8010afc2:	81 e2 05 02 00 00    	and    $0x205,%edx
+8010afc8:	81 fa 05 02 00 00    	cmp    $0x205,%edx
+8010afce:	75 50                	jne    8010b020 <cowfault+0xa0>
+    return -1;
+  pa = PTE_ADDR(*pte);
+8010afd0:	89 c2                	mov    %eax,%edx
+  flags = (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+8010afd2:	25 fd 0d 00 00       	and    $0xdfd,%eax
+  if(krefcount(P2V(pa)) == 1){
+8010afd7:	83 ec 0c             	sub    $0xc,%esp
+  pa = PTE_ADDR(*pte);
+8010afda:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  flags = (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+8010afe0:	83 c8 02             	or     $0x2,%eax
+  if(krefcount(P2V(pa)) == 1){
+8010afe3:	8d ba 00 00 00 80    	lea    -0x80000000(%edx),%edi
+  flags = (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+8010afe9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(krefcount(P2V(pa)) == 1){
+8010afec:	89 55 e0             	mov    %edx,-0x20(%ebp)
+8010afef:	57                   	push   %edi
+8010aff0:	e8 6b 93 ff ff       	call   80104360 <krefcount>
+8010aff5:	83 c4 10             	add    $0x10,%esp
+8010aff8:	83 f8 01             	cmp    $0x1,%eax
+8010affb:	75 33                	jne    8010b030 <cowfault+0xb0>
+    // Only this page table uses the page any more.
+    *pte = pa | flags;
+8010affd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010b000:	8b 55 e0             	mov    -0x20(%ebp),%edx
+8010b003:	09 c2                	or     %eax,%edx
+8010b005:	89 16                	mov    %edx,(%esi)
+      return -1;
+    memmove(mem, (char*)P2V(pa), PGSIZE);
+    *pte = V2P(mem) | flags;
+    kfree(P2V(pa));
+  }
+  invlpg((void*)PGROUNDDOWN(va));
+8010b007:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+8010b00d:	0f 01 3b             	invlpg (%ebx)
+  return 0;
+}
+8010b010:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010b013:	31 c0                	xor    %eax,%eax
+}
+8010b015:	5b                   	pop    %ebx
+8010b016:	5e                   	pop    %esi
+8010b017:	5f                   	pop    %edi
+8010b018:	5d                   	pop    %ebp
+8010b019:	c3                   	ret
+8010b01a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+8010b020:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+8010b023:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010b028:	5b                   	pop    %ebx
+8010b029:	5e                   	pop    %esi
+8010b02a:	5f                   	pop    %edi
+8010b02b:	5d                   	pop    %ebp
+8010b02c:	c3                   	ret
+8010b02d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((mem = kalloc()) == 0)
+8010b030:	e8 ab 91 ff ff       	call   801041e0 <kalloc>
+8010b035:	85 c0                	test   %eax,%eax
+8010b037:	74 e7                	je     8010b020 <cowfault+0xa0>
+    memmove(mem, (char*)P2V(pa), PGSIZE);
+8010b039:	83 ec 04             	sub    $0x4,%esp
+8010b03c:	68 00 10 00 00       	push   $0x1000
+8010b041:	57                   	push   %edi
+8010b042:	50                   	push   %eax
+8010b043:	89 45 e0             	mov    %eax,-0x20(%ebp)
+8010b046:	e8 45 ce ff ff       	call   80107e90 <memmove>
+    *pte = V2P(mem) | flags;
+8010b04b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+8010b04e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010b051:	81 c2 00 00 00 80    	add    $0x80000000,%edx
+8010b057:	09 c2                	or     %eax,%edx
+8010b059:	89 16                	mov    %edx,(%esi)
+    kfree(P2V(pa));
+8010b05b:	89 3c 24             	mov    %edi,(%esp)
+8010b05e:	e8 bd 8e ff ff       	call   80103f20 <kfree>
+8010b063:	83 c4 10             	add    $0x10,%esp
+8010b066:	eb 9f                	jmp    8010b007 <cowfault+0x87>
+8010b068:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b06f:	90                   	nop
+
+8010b070 <cowbreak>:
+// before the kernel writes there on a system call's behalf, so
+// that running out of memory for the copies fails the call
+// instead of faulting in the kernel. Returns -1 if memory ran out.
+int
+cowbreak(pde_t *pgdir, uint va, uint len)
+{
+8010b070:	55                   	push   %ebp
+8010b071:	89 e5                	mov    %esp,%ebp
+8010b073:	57                   	push   %edi
+8010b074:	56                   	push   %esi
+8010b075:	53                   	push   %ebx
+8010b076:	83 ec 0c             	sub    $0xc,%esp
+8010b079:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010b07c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  pte_t *pte;
+  uint a;
+
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+8010b07f:	89 f3                	mov    %esi,%ebx
+8010b081:	03 75 10             	add    0x10(%ebp),%esi
+8010b084:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+8010b08a:	39 f3                	cmp    %esi,%ebx
+8010b08c:	72 0c                	jb     8010b09a <cowbreak+0x2a>
+8010b08e:	eb 60                	jmp    8010b0f0 <cowbreak+0x80>
+8010b090:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010b096:	39 f3                	cmp    %esi,%ebx
+8010b098:	73 56                	jae    8010b0f0 <cowbreak+0x80>
+  pde = &pgdir[PDX(va)];
+8010b09a:	89 d8                	mov    %ebx,%eax
+8010b09c:	c1 e8 16             	shr    $0x16,%eax
+  if(*pde & PTE_P){
+8010b09f:	8b 04 87             	mov    (%edi,%eax,4),%eax
+8010b0a2:	a8 01                	test   $0x1,%al
+8010b0a4:	74 ea                	je     8010b090 <cowbreak+0x20>
+  return &pgtab[PTX(va)];
+8010b0a6:	89 da                	mov    %ebx,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b0a8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010b0ad:	c1 ea 0a             	shr    $0xa,%edx
+8010b0b0:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010b0b6:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(pte && (*pte & PTE_COW) && cowfault(pgdir, a) < 0)
+8010b0bd:	85 c0                	test   %eax,%eax
+8010b0bf:	74 cf                	je     8010b090 <cowbreak+0x20>
+8010b0c1:	8b 00                	mov    (%eax),%eax
+8010b0c3:	f6 c4 02             	test   $0x2,%ah
+8010b0c6:	74 c8                	je     8010b090 <cowbreak+0x20>
+8010b0c8:	83 ec 08             	sub    $0x8,%esp
+8010b0cb:	53                   	push   %ebx
+8010b0cc:	57                   	push   %edi
+8010b0cd:	e8 ae fe ff ff       	call   8010af80 <cowfault>
+8010b0d2:	83 c4 10             	add    $0x10,%esp
+8010b0d5:	85 c0                	test   %eax,%eax
+8010b0d7:	79 b7                	jns    8010b090 <cowbreak+0x20>
+      return -1;
+  }
+  return 0;
+}
+8010b0d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010b0dc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010b0e1:	5b                   	pop    %ebx
+8010b0e2:	5e                   	pop    %esi
+8010b0e3:	5f                   	pop    %edi
+8010b0e4:	5d                   	pop    %ebp
+8010b0e5:	c3                   	ret
+8010b0e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b0ed:	8d 76 00             	lea    0x0(%esi),%esi
+8010b0f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010b0f3:	31 c0                	xor    %eax,%eax
+}
+8010b0f5:	5b                   	pop    %ebx
+8010b0f6:	5e                   	pop    %esi
+8010b0f7:	5f                   	pop    %edi
+8010b0f8:	5d                   	pop    %ebp
+8010b0f9:	c3                   	ret
+8010b0fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010b100 <lazyfault>:
+// filled in with zeroed pages as it is touched.
+// Returns 0 on success, -1 if va is not such an address or
+// no memory is left.
+int
+lazyfault(pde_t *pgdir, uint sz, uint va)
+{
+8010b100:	55                   	push   %ebp
+8010b101:	89 e5                	mov    %esp,%ebp
+8010b103:	57                   	push   %edi
+8010b104:	56                   	push   %esi
+8010b105:	53                   	push   %ebx
+8010b106:	83 ec 0c             	sub    $0xc,%esp
+8010b109:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010b10c:	8b 45 10             	mov    0x10(%ebp),%eax
+  pte_t *pte;
+  char *mem;
+
+  if(va >= sz || va >= KERNBASE)
+8010b10f:	3b 45 0c             	cmp    0xc(%ebp),%eax
+8010b112:	73 7c                	jae    8010b190 <lazyfault+0x90>
+8010b114:	85 c0                	test   %eax,%eax
+8010b116:	78 78                	js     8010b190 <lazyfault+0x90>
+    return -1;
+  va = PGROUNDDOWN(va);
+8010b118:	89 c6                	mov    %eax,%esi
+  pde = &pgdir[PDX(va)];
+8010b11a:	c1 e8 16             	shr    $0x16,%eax
+  if(*pde & PTE_P){
+8010b11d:	8b 04 83             	mov    (%ebx,%eax,4),%eax
+  va = PGROUNDDOWN(va);
+8010b120:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  if(*pde & PTE_P){
+8010b126:	a8 01                	test   $0x1,%al
+8010b128:	75 46                	jne    8010b170 <lazyfault+0x70>
+  if((pte = walkpgdir(pgdir, (void*)va, 0)) != 0 && (*pte & PTE_P))
+    return -1;
+  if((mem = kalloc()) == 0)
+8010b12a:	e8 b1 90 ff ff       	call   801041e0 <kalloc>
+8010b12f:	89 c7                	mov    %eax,%edi
+8010b131:	85 c0                	test   %eax,%eax
+8010b133:	74 5b                	je     8010b190 <lazyfault+0x90>
+    return -1;
+  memset(mem, 0, PGSIZE);
+8010b135:	83 ec 04             	sub    $0x4,%esp
+8010b138:	68 00 10 00 00       	push   $0x1000
+8010b13d:	6a 00                	push   $0x0
+8010b13f:	50                   	push   %eax
+8010b140:	e8 bb cc ff ff       	call   80107e00 <memset>
+  if(mappages(pgdir, (void*)va, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+8010b145:	58                   	pop    %eax
+8010b146:	8d 87 00 00 00 80    	lea    -0x80000000(%edi),%eax
+8010b14c:	5a                   	pop    %edx
+8010b14d:	6a 06                	push   $0x6
+8010b14f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010b154:	89 f2                	mov    %esi,%edx
+8010b156:	50                   	push   %eax
+8010b157:	89 d8                	mov    %ebx,%eax
+8010b159:	e8 62 f6 ff ff       	call   8010a7c0 <mappages>
+8010b15e:	83 c4 10             	add    $0x10,%esp
+8010b161:	85 c0                	test   %eax,%eax
+8010b163:	78 32                	js     8010b197 <lazyfault+0x97>
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+8010b165:	31 c0                	xor    %eax,%eax
+}
+8010b167:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b16a:	5b                   	pop    %ebx
+8010b16b:	5e                   	pop    %esi
+8010b16c:	5f                   	pop    %edi
+8010b16d:	5d                   	pop    %ebp
+8010b16e:	c3                   	ret
+8010b16f:	90                   	nop
+  return &pgtab[PTX(va)];
+8010b170:	89 f2                	mov    %esi,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b172:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010b177:	c1 ea 0a             	shr    $0xa,%edx
+8010b17a:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010b180:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+  if((pte = walkpgdir(pgdir, (void*)va, 0)) != 0 && (*pte & PTE_P))
+8010b187:	85 c0                	test   %eax,%eax
+8010b189:	74 9f                	je     8010b12a <lazyfault+0x2a>
+8010b18b:	f6 00 01             	testb  $0x1,(%eax)
+8010b18e:	74 9a                	je     8010b12a <lazyfault+0x2a>
+    return -1;
+8010b190:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010b195:	eb d0                	jmp    8010b167 <lazyfault+0x67>
+    kfree(mem);
+8010b197:	83 ec 0c             	sub    $0xc,%esp
+8010b19a:	57                   	push   %edi
+8010b19b:	e8 80 8d ff ff       	call   80103f20 <kfree>
+    return -1;
+8010b1a0:	83 c4 10             	add    $0x10,%esp
+8010b1a3:	eb eb                	jmp    8010b190 <lazyfault+0x90>
+8010b1a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+8010b1b0 <lazyfill>:
+// kernel accesses them on a system call's behalf, so that running
+// out of memory fails the call instead of faulting in the kernel.
+// Returns -1 if memory ran out.
+int
+lazyfill(pde_t *pgdir, uint sz, uint va, uint len)
+{
+8010b1b0:	55                   	push   %ebp
+8010b1b1:	89 e5                	mov    %esp,%ebp
+8010b1b3:	57                   	push   %edi
+8010b1b4:	56                   	push   %esi
+8010b1b5:	53                   	push   %ebx
+8010b1b6:	83 ec 0c             	sub    $0xc,%esp
+8010b1b9:	8b 75 10             	mov    0x10(%ebp),%esi
+8010b1bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  pte_t *pte;
+  uint a;
+
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+8010b1bf:	89 f3                	mov    %esi,%ebx
+8010b1c1:	03 75 14             	add    0x14(%ebp),%esi
+8010b1c4:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+8010b1ca:	39 f3                	cmp    %esi,%ebx
+8010b1cc:	73 4c                	jae    8010b21a <lazyfill+0x6a>
+8010b1ce:	66 90                	xchg   %ax,%ax
+  pde = &pgdir[PDX(va)];
+8010b1d0:	89 d8                	mov    %ebx,%eax
+8010b1d2:	c1 e8 16             	shr    $0x16,%eax
+  if(*pde & PTE_P){
+8010b1d5:	8b 04 87             	mov    (%edi,%eax,4),%eax
+8010b1d8:	a8 01                	test   $0x1,%al
+8010b1da:	74 20                	je     8010b1fc <lazyfill+0x4c>
+  return &pgtab[PTX(va)];
+8010b1dc:	89 d9                	mov    %ebx,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b1de:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010b1e3:	c1 e9 0a             	shr    $0xa,%ecx
+8010b1e6:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010b1ec:	8d 84 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%eax
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if((pte == 0 || !(*pte & PTE_P)) && lazyfault(pgdir, sz, a) < 0)
+8010b1f3:	85 c0                	test   %eax,%eax
+8010b1f5:	74 05                	je     8010b1fc <lazyfill+0x4c>
+8010b1f7:	f6 00 01             	testb  $0x1,(%eax)
+8010b1fa:	75 14                	jne    8010b210 <lazyfill+0x60>
+8010b1fc:	83 ec 04             	sub    $0x4,%esp
+8010b1ff:	53                   	push   %ebx
+8010b200:	ff 75 0c             	push   0xc(%ebp)
+8010b203:	57                   	push   %edi
+8010b204:	e8 f7 fe ff ff       	call   8010b100 <lazyfault>
+8010b209:	83 c4 10             	add    $0x10,%esp
+8010b20c:	85 c0                	test   %eax,%eax
+8010b20e:	78 18                	js     8010b228 <lazyfill+0x78>
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+8010b210:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010b216:	39 f3                	cmp    %esi,%ebx
+8010b218:	72 b6                	jb     8010b1d0 <lazyfill+0x20>
+      return -1;
+  }
+  return 0;
+}
+8010b21a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010b21d:	31 c0                	xor    %eax,%eax
+}
+8010b21f:	5b                   	pop    %ebx
+8010b220:	5e                   	pop    %esi
+8010b221:	5f                   	pop    %edi
+8010b222:	5d                   	pop    %ebp
+8010b223:	c3                   	ret
+8010b224:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010b228:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010b22b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010b230:	5b                   	pop    %ebx
+8010b231:	5e                   	pop    %esi
+8010b232:	5f                   	pop    %edi
+8010b233:	5d                   	pop    %ebp
+8010b234:	c3                   	ret
+8010b235:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+8010b240 <loanpage>:
+// reference to it and make it copy-on-write, so that later
+// writes by this process go to a copy. Returns the page's
+// physical address, or 0 if va has no user page.
+uint
+loanpage(pde_t *pgdir, char *va)
+{
+8010b240:	55                   	push   %ebp
+8010b241:	89 e5                	mov    %esp,%ebp
+8010b243:	56                   	push   %esi
+8010b244:	53                   	push   %ebx
+8010b245:	8b 55 0c             	mov    0xc(%ebp),%edx
+  if(*pde & PTE_P){
+8010b248:	8b 45 08             	mov    0x8(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+8010b24b:	89 d1                	mov    %edx,%ecx
+8010b24d:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010b250:	8b 04 88             	mov    (%eax,%ecx,4),%eax
+8010b253:	89 c3                	mov    %eax,%ebx
+8010b255:	83 e3 01             	and    $0x1,%ebx
+8010b258:	74 55                	je     8010b2af <loanpage+0x6f>
+  return &pgtab[PTX(va)];
+8010b25a:	89 d1                	mov    %edx,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b25c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010b261:	c1 e9 0a             	shr    $0xa,%ecx
+8010b264:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010b26a:	8d 8c 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%ecx
+  pte_t *pte;
+  uint pa;
+
+  if((pte = walkpgdir(pgdir, va, 0)) == 0)
+8010b271:	85 c9                	test   %ecx,%ecx
+8010b273:	74 4b                	je     8010b2c0 <loanpage+0x80>
+    return 0;
+  if((*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U))
+8010b275:	8b 01                	mov    (%ecx),%eax
+    return 0;
+8010b277:	31 db                	xor    %ebx,%ebx
+  if((*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U))
+8010b279:	89 c6                	mov    %eax,%esi
+8010b27b:	83 e6 05             	and    $0x5,%esi
+8010b27e:	83 fe 05             	cmp    $0x5,%esi
+8010b281:	75 2c                	jne    8010b2af <loanpage+0x6f>
+    return 0;
+  if(*pte & PTE_W){
+8010b283:	a8 02                	test   $0x2,%al
+8010b285:	74 0f                	je     8010b296 <loanpage+0x56>
+    *pte = (*pte & ~PTE_W) | PTE_COW;
+8010b287:	25 fd fd ff ff       	and    $0xfffffdfd,%eax
+8010b28c:	80 cc 02             	or     $0x2,%ah
+8010b28f:	89 01                	mov    %eax,(%ecx)
+8010b291:	0f 01 3a             	invlpg (%edx)
+    invlpg(va);
+  }
+  pa = PTE_ADDR(*pte);
+8010b294:	8b 01                	mov    (%ecx),%eax
+8010b296:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  kincref(P2V(pa));
+8010b29b:	83 ec 0c             	sub    $0xc,%esp
+  pa = PTE_ADDR(*pte);
+8010b29e:	89 c3                	mov    %eax,%ebx
+  kincref(P2V(pa));
+8010b2a0:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+8010b2a6:	50                   	push   %eax
+8010b2a7:	e8 54 90 ff ff       	call   80104300 <kincref>
+  return pa;
+8010b2ac:	83 c4 10             	add    $0x10,%esp
+}
+8010b2af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010b2b2:	89 d8                	mov    %ebx,%eax
+8010b2b4:	5b                   	pop    %ebx
+8010b2b5:	5e                   	pop    %esi
+8010b2b6:	5d                   	pop    %ebp
+8010b2b7:	c3                   	ret
+8010b2b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b2bf:	90                   	nop
+    return 0;
+8010b2c0:	31 db                	xor    %ebx,%ebx
+8010b2c2:	eb eb                	jmp    8010b2af <loanpage+0x6f>
+8010b2c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b2cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010b2cf:	90                   	nop
+
+8010b2d0 <maploan>:
+// Map the lent page pa at user address va, copy-on-write, in
+// place of the page there. The caller's reference to pa goes
+// to the new mapping. Returns -1 if va cannot be remapped.
+int
+maploan(pde_t *pgdir, char *va, uint pa)
+{
+8010b2d0:	55                   	push   %ebp
+8010b2d1:	89 e5                	mov    %esp,%ebp
+8010b2d3:	57                   	push   %edi
+8010b2d4:	56                   	push   %esi
+8010b2d5:	53                   	push   %ebx
+8010b2d6:	83 ec 0c             	sub    $0xc,%esp
+8010b2d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  pde = &pgdir[PDX(va)];
+8010b2dc:	8b 45 08             	mov    0x8(%ebp),%eax
+8010b2df:	89 f3                	mov    %esi,%ebx
+8010b2e1:	c1 eb 16             	shr    $0x16,%ebx
+8010b2e4:	8d 1c 98             	lea    (%eax,%ebx,4),%ebx
+  if(*pde & PTE_P){
+8010b2e7:	8b 03                	mov    (%ebx),%eax
+8010b2e9:	a8 01                	test   $0x1,%al
+8010b2eb:	74 53                	je     8010b340 <maploan+0x70>
+  return &pgtab[PTX(va)];
+8010b2ed:	89 f2                	mov    %esi,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b2ef:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010b2f4:	c1 ea 0a             	shr    $0xa,%edx
+8010b2f7:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010b2fd:	8d bc 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%edi
+  pte_t *pte;
+
+  if((pte = walkpgdir(pgdir, va, 1)) == 0)
+8010b304:	85 ff                	test   %edi,%edi
+8010b306:	74 78                	je     8010b380 <maploan+0xb0>
+    return -1;
+  if(*pte & PTE_P){
+8010b308:	8b 07                	mov    (%edi),%eax
+8010b30a:	a8 01                	test   $0x1,%al
+8010b30c:	74 1a                	je     8010b328 <maploan+0x58>
+    if(!(*pte & PTE_U))
+8010b30e:	a8 04                	test   $0x4,%al
+8010b310:	74 6e                	je     8010b380 <maploan+0xb0>
+      return -1;
+    kfree(P2V(PTE_ADDR(*pte)));
+8010b312:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010b317:	83 ec 0c             	sub    $0xc,%esp
+8010b31a:	05 00 00 00 80       	add    $0x80000000,%eax
+8010b31f:	50                   	push   %eax
+8010b320:	e8 fb 8b ff ff       	call   80103f20 <kfree>
+8010b325:	83 c4 10             	add    $0x10,%esp
+  }
+  *pte = pa | PTE_P | PTE_U | PTE_COW;
+8010b328:	8b 45 10             	mov    0x10(%ebp),%eax
+8010b32b:	0d 05 02 00 00       	or     $0x205,%eax
+8010b330:	89 07                	mov    %eax,(%edi)
+8010b332:	0f 01 3e             	invlpg (%esi)
+  invlpg(va);
+  return 0;
+8010b335:	31 c0                	xor    %eax,%eax
+}
+8010b337:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010b33a:	5b                   	pop    %ebx
+8010b33b:	5e                   	pop    %esi
+8010b33c:	5f                   	pop    %edi
+8010b33d:	5d                   	pop    %ebp
+8010b33e:	c3                   	ret
+8010b33f:	90                   	nop
+    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+8010b340:	e8 9b 8e ff ff       	call   801041e0 <kalloc>
+8010b345:	89 c7                	mov    %eax,%edi
+8010b347:	85 c0                	test   %eax,%eax
+8010b349:	74 35                	je     8010b380 <maploan+0xb0>
+    memset(pgtab, 0, PGSIZE);
+8010b34b:	83 ec 04             	sub    $0x4,%esp
+8010b34e:	68 00 10 00 00       	push   $0x1000
+8010b353:	6a 00                	push   $0x0
+8010b355:	50                   	push   %eax
+8010b356:	e8 a5 ca ff ff       	call   80107e00 <memset>
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010b35b:	8d 87 00 00 00 80    	lea    -0x80000000(%edi),%eax
+  return &pgtab[PTX(va)];
+8010b361:	83 c4 10             	add    $0x10,%esp
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010b364:	83 c8 07             	or     $0x7,%eax
+8010b367:	89 03                	mov    %eax,(%ebx)
+  return &pgtab[PTX(va)];
+8010b369:	89 f0                	mov    %esi,%eax
+8010b36b:	c1 e8 0a             	shr    $0xa,%eax
+8010b36e:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010b373:	01 c7                	add    %eax,%edi
+  if(*pte & PTE_P){
+8010b375:	8b 07                	mov    (%edi),%eax
+8010b377:	a8 01                	test   $0x1,%al
+8010b379:	74 ad                	je     8010b328 <maploan+0x58>
+8010b37b:	eb 91                	jmp    8010b30e <maploan+0x3e>
+8010b37d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+8010b380:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010b385:	eb b0                	jmp    8010b337 <maploan+0x67>
+8010b387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b38e:	66 90                	xchg   %ax,%ax
+
+8010b390 <uva2ka>:
+
+//PAGEBREAK!
+// Map user virtual address to kernel address.
+char*
+uva2ka(pde_t *pgdir, char *uva)
+{
+8010b390:	55                   	push   %ebp
+8010b391:	89 e5                	mov    %esp,%ebp
+8010b393:	8b 55 0c             	mov    0xc(%ebp),%edx
+  if(*pde & PTE_P){
+8010b396:	8b 45 08             	mov    0x8(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+8010b399:	89 d1                	mov    %edx,%ecx
+8010b39b:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010b39e:	8b 0c 88             	mov    (%eax,%ecx,4),%ecx
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+  if(pte == 0 || (*pte & PTE_P) == 0)
+    return 0;
+8010b3a1:	31 c0                	xor    %eax,%eax
+  if(*pde & PTE_P){
+8010b3a3:	f6 c1 01             	test   $0x1,%cl
+8010b3a6:	74 36                	je     8010b3de <uva2ka+0x4e>
+  return &pgtab[PTX(va)];
+8010b3a8:	c1 ea 0a             	shr    $0xa,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b3ab:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  return &pgtab[PTX(va)];
+8010b3b1:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010b3b7:	8d 84 11 00 00 00 80 	lea    -0x80000000(%ecx,%edx,1),%eax
+  if(pte == 0 || (*pte & PTE_P) == 0)
+8010b3be:	85 c0                	test   %eax,%eax
+8010b3c0:	74 1c                	je     8010b3de <uva2ka+0x4e>
+8010b3c2:	8b 00                	mov    (%eax),%eax
+  if((*pte & PTE_U) == 0)
+8010b3c4:	89 c2                	mov    %eax,%edx
+    return 0;
+  return (char*)P2V(PTE_ADDR(*pte));
+8010b3c6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  if((*pte & PTE_U) == 0)
+8010b3cb:	83 e2 05             	and    $0x5,%edx
+  return (char*)P2V(PTE_ADDR(*pte));
+8010b3ce:	05 00 00 00 80       	add    $0x80000000,%eax
+8010b3d3:	83 fa 05             	cmp    $0x5,%edx
+8010b3d6:	ba 00 00 00 00       	mov    $0x0,%edx
+8010b3db:	0f 45 c2             	cmovne %edx,%eax
+}
+8010b3de:	5d                   	pop    %ebp
+8010b3df:	c3                   	ret
+
+8010b3e0 <copyout>:
+// Copy len bytes from p to user address va in page table pgdir.
+// Most useful when pgdir is not the current page table.
+// uva2ka ensures this only works for PTE_U pages.
+int
+copyout(pde_t *pgdir, uint va, void *p, uint len)
+{
+8010b3e0:	55                   	push   %ebp
+8010b3e1:	89 e5                	mov    %esp,%ebp
+8010b3e3:	57                   	push   %edi
+8010b3e4:	56                   	push   %esi
+8010b3e5:	53                   	push   %ebx
+8010b3e6:	83 ec 1c             	sub    $0x1c,%esp
+8010b3e9:	8b 7d 14             	mov    0x14(%ebp),%edi
+8010b3ec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *buf, *pa0;
+  uint n, va0;
+  pte_t *pte;
+
+  buf = (char*)p;
+  while(len > 0){
+8010b3ef:	85 ff                	test   %edi,%edi
+8010b3f1:	0f 84 ef 00 00 00    	je     8010b4e6 <copyout+0x106>
+8010b3f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b3fe:	66 90                	xchg   %ax,%ax
+  pde = &pgdir[PDX(va)];
+8010b400:	8b 4d 08             	mov    0x8(%ebp),%ecx
+8010b403:	89 d8                	mov    %ebx,%eax
+    va0 = (uint)PGROUNDDOWN(va);
+8010b405:	89 de                	mov    %ebx,%esi
+  pde = &pgdir[PDX(va)];
+8010b407:	c1 e8 16             	shr    $0x16,%eax
+    va0 = (uint)PGROUNDDOWN(va);
+8010b40a:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  pde = &pgdir[PDX(va)];
+8010b410:	8d 14 81             	lea    (%ecx,%eax,4),%edx
+  if(*pde & PTE_P){
+8010b413:	8b 02                	mov    (%edx),%eax
+8010b415:	a8 01                	test   $0x1,%al
+8010b417:	74 2a                	je     8010b443 <copyout+0x63>
+  return &pgtab[PTX(va)];
+8010b419:	89 f1                	mov    %esi,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b41b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010b420:	c1 e9 0a             	shr    $0xa,%ecx
+8010b423:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010b429:	8d 8c 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%ecx
+    // The write goes through the kernel mapping, so it would
+    // not fault; break copy-on-write sharing by hand.
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if(pte && (*pte & PTE_COW) && cowfault(pgdir, va0) < 0)
+8010b430:	85 c9                	test   %ecx,%ecx
+8010b432:	74 0f                	je     8010b443 <copyout+0x63>
+8010b434:	8b 01                	mov    (%ecx),%eax
+8010b436:	f6 c4 02             	test   $0x2,%ah
+8010b439:	0f 85 b1 00 00 00    	jne    8010b4f0 <copyout+0x110>
+      return -1;
+    // Nor would an untouched heap page; fill it in.
+    if((pte == 0 || !(*pte & PTE_P)) && pgdir == myproc()->pgdir &&
+8010b43f:	a8 01                	test   $0x1,%al
+8010b441:	75 48                	jne    8010b48b <copyout+0xab>
+8010b443:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010b446:	e8 05 b1 ff ff       	call   80106550 <myproc>
+8010b44b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+8010b44e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010b451:	39 48 04             	cmp    %ecx,0x4(%eax)
+8010b454:	0f 84 ce 00 00 00    	je     8010b528 <copyout+0x148>
+  if(*pde & PTE_P){
+8010b45a:	8b 02                	mov    (%edx),%eax
+8010b45c:	a8 01                	test   $0x1,%al
+8010b45e:	75 10                	jne    8010b470 <copyout+0x90>
+    len -= n;
+    buf += n;
+    va = va0 + PGSIZE;
+  }
+  return 0;
+}
+8010b460:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010b463:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010b468:	5b                   	pop    %ebx
+8010b469:	5e                   	pop    %esi
+8010b46a:	5f                   	pop    %edi
+8010b46b:	5d                   	pop    %ebp
+8010b46c:	c3                   	ret
+8010b46d:	8d 76 00             	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010b470:	89 f2                	mov    %esi,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010b472:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010b477:	c1 ea 0a             	shr    $0xa,%edx
+8010b47a:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010b480:	8d 8c 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%ecx
+  if(pte == 0 || (*pte & PTE_P) == 0)
+8010b487:	85 c9                	test   %ecx,%ecx
+8010b489:	74 d5                	je     8010b460 <copyout+0x80>
+8010b48b:	8b 01                	mov    (%ecx),%eax
+  if((*pte & PTE_U) == 0)
+8010b48d:	89 c2                	mov    %eax,%edx
+8010b48f:	83 e2 05             	and    $0x5,%edx
+8010b492:	83 fa 05             	cmp    $0x5,%edx
+8010b495:	75 c9                	jne    8010b460 <copyout+0x80>
+  return (char*)P2V(PTE_ADDR(*pte));
+8010b497:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010b49c:	89 c2                	mov    %eax,%edx
+8010b49e:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+    if(pa0 == 0)
+8010b4a4:	81 fa 00 00 00 80    	cmp    $0x80000000,%edx
+8010b4aa:	74 b4                	je     8010b460 <copyout+0x80>
+    n = PGSIZE - (va - va0);
+8010b4ac:	89 f2                	mov    %esi,%edx
+8010b4ae:	29 da                	sub    %ebx,%edx
+8010b4b0:	81 c2 00 10 00 00    	add    $0x1000,%edx
+8010b4b6:	39 fa                	cmp    %edi,%edx
+8010b4b8:	0f 47 d7             	cmova  %edi,%edx
+    memmove(pa0 + (va - va0), buf, n);
+8010b4bb:	29 f3                	sub    %esi,%ebx
+8010b4bd:	83 ec 04             	sub    $0x4,%esp
+8010b4c0:	01 d8                	add    %ebx,%eax
+    va = va0 + PGSIZE;
+8010b4c2:	8d 9e 00 10 00 00    	lea    0x1000(%esi),%ebx
+    memmove(pa0 + (va - va0), buf, n);
+8010b4c8:	52                   	push   %edx
+8010b4c9:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010b4cc:	ff 75 10             	push   0x10(%ebp)
+8010b4cf:	50                   	push   %eax
+8010b4d0:	e8 bb c9 ff ff       	call   80107e90 <memmove>
+    buf += n;
+8010b4d5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  while(len > 0){
+8010b4d8:	83 c4 10             	add    $0x10,%esp
+    buf += n;
+8010b4db:	01 55 10             	add    %edx,0x10(%ebp)
+  while(len > 0){
+8010b4de:	29 d7                	sub    %edx,%edi
+8010b4e0:	0f 85 1a ff ff ff    	jne    8010b400 <copyout+0x20>
+}
+8010b4e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010b4e9:	31 c0                	xor    %eax,%eax
+}
+8010b4eb:	5b                   	pop    %ebx
+8010b4ec:	5e                   	pop    %esi
+8010b4ed:	5f                   	pop    %edi
+8010b4ee:	5d                   	pop    %ebp
+8010b4ef:	c3                   	ret
+    if(pte && (*pte & PTE_COW) && cowfault(pgdir, va0) < 0)
+8010b4f0:	83 ec 08             	sub    $0x8,%esp
+8010b4f3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010b4f6:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010b4f9:	56                   	push   %esi
+8010b4fa:	ff 75 08             	push   0x8(%ebp)
+8010b4fd:	e8 7e fa ff ff       	call   8010af80 <cowfault>
+8010b502:	83 c4 10             	add    $0x10,%esp
+8010b505:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010b508:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010b50b:	85 c0                	test   %eax,%eax
+8010b50d:	0f 88 4d ff ff ff    	js     8010b460 <copyout+0x80>
+    if((pte == 0 || !(*pte & PTE_P)) && pgdir == myproc()->pgdir &&
+8010b513:	f6 01 01             	testb  $0x1,(%ecx)
+8010b516:	0f 84 27 ff ff ff    	je     8010b443 <copyout+0x63>
+8010b51c:	e9 39 ff ff ff       	jmp    8010b45a <copyout+0x7a>
+8010b521:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010b528:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+       lazyfault(pgdir, myproc()->sz, va0) < 0)
+8010b52b:	e8 20 b0 ff ff       	call   80106550 <myproc>
+8010b530:	83 ec 04             	sub    $0x4,%esp
+8010b533:	56                   	push   %esi
+8010b534:	ff 30                	push   (%eax)
+8010b536:	ff 75 08             	push   0x8(%ebp)
+8010b539:	e8 c2 fb ff ff       	call   8010b100 <lazyfault>
+    if((pte == 0 || !(*pte & PTE_P)) && pgdir == myproc()->pgdir &&
+8010b53e:	83 c4 10             	add    $0x10,%esp
+8010b541:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010b544:	85 c0                	test   %eax,%eax
+8010b546:	0f 89 0e ff ff ff    	jns    8010b45a <copyout+0x7a>
+8010b54c:	e9 0f ff ff ff       	jmp    8010b460 <copyout+0x80>
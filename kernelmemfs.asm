@@ -0,0 +1,22691 @@
+
+kernelmemfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+80100000 <multiboot_header>:
+80100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+80100006:	00 00                	add    %al,(%eax)
+80100008:	fe 4f 52             	decb   0x52(%edi)
+8010000b:	e4                   	.byte 0xe4
+
+8010000c <entry>:
+
+# Entering xv6 on boot processor, with paging off.
+.globl entry
+entry:
+  # Turn on page size extension for 4Mbyte pages
+  movl    %cr4, %eax
+8010000c:	0f 20 e0             	mov    %cr4,%eax
+  orl     $(CR4_PSE), %eax
+8010000f:	83 c8 10             	or     $0x10,%eax
+  movl    %eax, %cr4
+80100012:	0f 22 e0             	mov    %eax,%cr4
+  # Set page directory
+  movl    $(V2P_WO(entrypgdir)), %eax
+80100015:	b8 00 d0 10 00       	mov    $0x10d000,%eax
+  movl    %eax, %cr3
+8010001a:	0f 22 d8             	mov    %eax,%cr3
+  # Turn on paging.
+  movl    %cr0, %eax
+8010001d:	0f 20 c0             	mov    %cr0,%eax
+  orl     $(CR0_PG|CR0_WP), %eax
+80100020:	0d 00 00 01 80       	or     $0x80010000,%eax
+  movl    %eax, %cr0
+80100025:	0f 22 c0             	mov    %eax,%cr0
+
+  # Set up the stack pointer.
+  movl $(stack + KSTACKSIZE), %esp
+80100028:	bc 10 3b 91 80       	mov    $0x80913b10,%esp
+
+  # Jump to main(), and switch to executing at
+  # high addresses. The indirect call is needed because
+  # the assembler produces a PC-relative instruction
+  # for a direct jump.
+  mov $main, %eax
+8010002d:	b8 50 4a 10 80       	mov    $0x80104a50,%eax
+  jmp *%eax
+80100032:	ff e0                	jmp    *%eax
+80100034:	66 90                	xchg   %ax,%ax
+80100036:	66 90                	xchg   %ax,%ax
+80100038:	66 90                	xchg   %ax,%ax
+8010003a:	66 90                	xchg   %ax,%ax
+8010003c:	66 90                	xchg   %ax,%ax
+8010003e:	66 90                	xchg   %ax,%ax
+
+80100040 <bfind>:
+static struct buf*
+bfind(int h, uint dev, uint blockno)
+{
+  struct buf *b;
+
+  for(b = bcache.bucket[h].head; b; b = b->hnext){
+80100040:	6b c0 38             	imul   $0x38,%eax,%eax
+80100043:	8b 80 88 49 8e 80    	mov    -0x7f71b678(%eax),%eax
+80100049:	85 c0                	test   %eax,%eax
+8010004b:	75 0a                	jne    80100057 <bfind+0x17>
+8010004d:	eb 1f                	jmp    8010006e <bfind+0x2e>
+8010004f:	90                   	nop
+80100050:	8b 40 58             	mov    0x58(%eax),%eax
+80100053:	85 c0                	test   %eax,%eax
+80100055:	74 19                	je     80100070 <bfind+0x30>
+    if(b->dev == dev && b->blockno == blockno){
+80100057:	39 50 04             	cmp    %edx,0x4(%eax)
+8010005a:	75 f4                	jne    80100050 <bfind+0x10>
+8010005c:	39 48 08             	cmp    %ecx,0x8(%eax)
+8010005f:	75 ef                	jne    80100050 <bfind+0x10>
+      if(b->refcnt++ == 0){
+80100061:	8b 50 4c             	mov    0x4c(%eax),%edx
+80100064:	8d 4a 01             	lea    0x1(%edx),%ecx
+80100067:	89 48 4c             	mov    %ecx,0x4c(%eax)
+8010006a:	85 d2                	test   %edx,%edx
+8010006c:	74 03                	je     80100071 <bfind+0x31>
+      }
+      return b;
+    }
+  }
+  return 0;
+}
+8010006e:	c3                   	ret
+8010006f:	90                   	nop
+80100070:	c3                   	ret
+{
+80100071:	55                   	push   %ebp
+80100072:	89 e5                	mov    %esp,%ebp
+80100074:	83 ec 24             	sub    $0x24,%esp
+80100077:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        acquire(&bcache.lrulock);
+8010007a:	68 20 50 8e 80       	push   $0x808e5020
+8010007f:	e8 cc 74 00 00       	call   80107550 <acquire>
+  b->next->prev = b->prev;
+80100084:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80100087:	8b 48 54             	mov    0x54(%eax),%ecx
+8010008a:	8b 50 50             	mov    0x50(%eax),%edx
+8010008d:	89 51 50             	mov    %edx,0x50(%ecx)
+  b->prev->next = b->next;
+80100090:	8b 48 54             	mov    0x54(%eax),%ecx
+80100093:	89 4a 54             	mov    %ecx,0x54(%edx)
+        release(&bcache.lrulock);
+80100096:	c7 04 24 20 50 8e 80 	movl   $0x808e5020,(%esp)
+8010009d:	e8 4e 74 00 00       	call   801074f0 <release>
+801000a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+801000a5:	83 c4 10             	add    $0x10,%esp
+}
+801000a8:	c9                   	leave
+801000a9:	c3                   	ret
+801000aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801000b0 <bref>:
+// In either case, return the buffer with a reference
+// taken, but not locked. If every buffer is in use,
+// return 0 if mayfail, else panic.
+static struct buf*
+bref(uint dev, uint blockno, int mayfail)
+{
+801000b0:	55                   	push   %ebp
+801000b1:	89 e5                	mov    %esp,%ebp
+801000b3:	57                   	push   %edi
+801000b4:	89 c7                	mov    %eax,%edi
+801000b6:	56                   	push   %esi
+801000b7:	89 d6                	mov    %edx,%esi
+801000b9:	53                   	push   %ebx
+801000ba:	83 ec 38             	sub    $0x38,%esp
+801000bd:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  struct buf *b;
+  int h = BHASH(dev, blockno);
+801000c0:	8d 0c c5 00 00 00 00 	lea    0x0(,%eax,8),%ecx
+801000c7:	29 c1                	sub    %eax,%ecx
+801000c9:	b8 85 10 42 08       	mov    $0x8421085,%eax
+{
+801000ce:	89 55 d8             	mov    %edx,-0x28(%ebp)
+  int h = BHASH(dev, blockno);
+801000d1:	01 d1                	add    %edx,%ecx
+801000d3:	f7 e1                	mul    %ecx
+801000d5:	89 c8                	mov    %ecx,%eax
+801000d7:	29 d0                	sub    %edx,%eax
+801000d9:	d1 e8                	shr    %eax
+801000db:	8d 1c 02             	lea    (%edx,%eax,1),%ebx
+801000de:	c1 eb 04             	shr    $0x4,%ebx
+801000e1:	89 d8                	mov    %ebx,%eax
+801000e3:	c1 e0 05             	shl    $0x5,%eax
+801000e6:	29 d8                	sub    %ebx,%eax
+801000e8:	29 c1                	sub    %eax,%ecx
+
+  // Is the block already cached?
+  acquire(&bcache.bucket[h].lock);
+801000ea:	6b c1 38             	imul   $0x38,%ecx,%eax
+  int h = BHASH(dev, blockno);
+801000ed:	89 cb                	mov    %ecx,%ebx
+  acquire(&bcache.bucket[h].lock);
+801000ef:	05 54 49 8e 80       	add    $0x808e4954,%eax
+801000f4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801000f7:	50                   	push   %eax
+801000f8:	e8 53 74 00 00       	call   80107550 <acquire>
+  if((b = bfind(h, dev, blockno)) != 0)
+801000fd:	89 f1                	mov    %esi,%ecx
+801000ff:	89 fa                	mov    %edi,%edx
+80100101:	89 d8                	mov    %ebx,%eax
+80100103:	e8 38 ff ff ff       	call   80100040 <bfind>
+80100108:	83 c4 10             	add    $0x10,%esp
+8010010b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010010e:	85 c0                	test   %eax,%eax
+80100110:	74 1e                	je     80100130 <bref+0x80>
+    b->refcnt = 1;
+  }
+  release(&bcache.lock);
+
+found:
+  release(&bcache.bucket[h].lock);
+80100112:	83 ec 0c             	sub    $0xc,%esp
+80100115:	ff 75 e0             	push   -0x20(%ebp)
+80100118:	e8 d3 73 00 00       	call   801074f0 <release>
+  return b;
+}
+8010011d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80100120:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100123:	5b                   	pop    %ebx
+80100124:	5e                   	pop    %esi
+80100125:	5f                   	pop    %edi
+80100126:	5d                   	pop    %ebp
+80100127:	c3                   	ret
+80100128:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010012f:	90                   	nop
+  release(&bcache.bucket[h].lock);
+80100130:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80100133:	83 ec 0c             	sub    $0xc,%esp
+80100136:	56                   	push   %esi
+80100137:	e8 b4 73 00 00       	call   801074f0 <release>
+  acquire(&bcache.lock);
+8010013c:	c7 04 24 20 e5 8d 80 	movl   $0x808de520,(%esp)
+80100143:	e8 08 74 00 00       	call   80107550 <acquire>
+  acquire(&bcache.bucket[h].lock);
+80100148:	89 34 24             	mov    %esi,(%esp)
+8010014b:	e8 00 74 00 00       	call   80107550 <acquire>
+  if((b = bfind(h, dev, blockno)) == 0){
+80100150:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+80100153:	89 fa                	mov    %edi,%edx
+80100155:	89 d8                	mov    %ebx,%eax
+80100157:	e8 e4 fe ff ff       	call   80100040 <bfind>
+8010015c:	83 c4 10             	add    $0x10,%esp
+8010015f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80100162:	85 c0                	test   %eax,%eax
+80100164:	74 12                	je     80100178 <bref+0xc8>
+  release(&bcache.lock);
+80100166:	83 ec 0c             	sub    $0xc,%esp
+80100169:	68 20 e5 8d 80       	push   $0x808de520
+8010016e:	e8 7d 73 00 00       	call   801074f0 <release>
+80100173:	83 c4 10             	add    $0x10,%esp
+80100176:	eb 9a                	jmp    80100112 <bref+0x62>
+    h2 = BHASH(b->dev, b->blockno);
+80100178:	89 7d d0             	mov    %edi,-0x30(%ebp)
+8010017b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010017f:	90                   	nop
+    acquire(&bcache.lrulock);
+80100180:	83 ec 0c             	sub    $0xc,%esp
+80100183:	68 20 50 8e 80       	push   $0x808e5020
+80100188:	e8 c3 73 00 00       	call   80107550 <acquire>
+    for(b = bcache.lru.next; b != &bcache.lru; b = b->next)
+8010018d:	8b 3d a8 50 8e 80    	mov    0x808e50a8,%edi
+80100193:	83 c4 10             	add    $0x10,%esp
+80100196:	81 ff 54 50 8e 80    	cmp    $0x808e5054,%edi
+8010019c:	75 19                	jne    801001b7 <bref+0x107>
+8010019e:	e9 6d 01 00 00       	jmp    80100310 <bref+0x260>
+801001a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801001a7:	90                   	nop
+801001a8:	8b 7f 54             	mov    0x54(%edi),%edi
+801001ab:	81 ff 54 50 8e 80    	cmp    $0x808e5054,%edi
+801001b1:	0f 84 59 01 00 00    	je     80100310 <bref+0x260>
+      if((b->flags & B_DIRTY) == 0)
+801001b7:	f6 07 04             	testb  $0x4,(%edi)
+801001ba:	75 ec                	jne    801001a8 <bref+0xf8>
+    release(&bcache.lrulock);
+801001bc:	83 ec 0c             	sub    $0xc,%esp
+801001bf:	68 20 50 8e 80       	push   $0x808e5020
+801001c4:	e8 27 73 00 00       	call   801074f0 <release>
+    if(b == &bcache.lru)
+801001c9:	83 c4 10             	add    $0x10,%esp
+801001cc:	81 ff 54 50 8e 80    	cmp    $0x808e5054,%edi
+801001d2:	0f 84 48 01 00 00    	je     80100320 <bref+0x270>
+    h2 = BHASH(b->dev, b->blockno);
+801001d8:	8b 47 04             	mov    0x4(%edi),%eax
+801001db:	8d 34 c5 00 00 00 00 	lea    0x0(,%eax,8),%esi
+801001e2:	29 c6                	sub    %eax,%esi
+801001e4:	b8 85 10 42 08       	mov    $0x8421085,%eax
+801001e9:	03 77 08             	add    0x8(%edi),%esi
+801001ec:	f7 e6                	mul    %esi
+801001ee:	89 f0                	mov    %esi,%eax
+801001f0:	29 d0                	sub    %edx,%eax
+801001f2:	d1 e8                	shr    %eax
+801001f4:	01 c2                	add    %eax,%edx
+801001f6:	c1 ea 04             	shr    $0x4,%edx
+801001f9:	89 d0                	mov    %edx,%eax
+801001fb:	c1 e0 05             	shl    $0x5,%eax
+801001fe:	29 d0                	sub    %edx,%eax
+80100200:	29 c6                	sub    %eax,%esi
+80100202:	89 f2                	mov    %esi,%edx
+    if(h2 != h)
+80100204:	39 f3                	cmp    %esi,%ebx
+80100206:	74 38                	je     80100240 <bref+0x190>
+      acquire(&bcache.bucket[h2].lock);
+80100208:	6b f6 38             	imul   $0x38,%esi,%esi
+8010020b:	83 ec 0c             	sub    $0xc,%esp
+8010020e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80100211:	81 c6 54 49 8e 80    	add    $0x808e4954,%esi
+80100217:	56                   	push   %esi
+80100218:	e8 33 73 00 00       	call   80107550 <acquire>
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0)
+8010021d:	8b 47 4c             	mov    0x4c(%edi),%eax
+80100220:	83 c4 10             	add    $0x10,%esp
+80100223:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80100226:	85 c0                	test   %eax,%eax
+80100228:	74 36                	je     80100260 <bref+0x1b0>
+      release(&bcache.bucket[h2].lock);
+8010022a:	83 ec 0c             	sub    $0xc,%esp
+8010022d:	56                   	push   %esi
+8010022e:	e8 bd 72 00 00       	call   801074f0 <release>
+80100233:	83 c4 10             	add    $0x10,%esp
+80100236:	e9 45 ff ff ff       	jmp    80100180 <bref+0xd0>
+8010023b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010023f:	90                   	nop
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0)
+80100240:	8b 4f 4c             	mov    0x4c(%edi),%ecx
+80100243:	85 c9                	test   %ecx,%ecx
+80100245:	0f 85 35 ff ff ff    	jne    80100180 <bref+0xd0>
+8010024b:	f6 07 04             	testb  $0x4,(%edi)
+8010024e:	0f 85 2c ff ff ff    	jne    80100180 <bref+0xd0>
+80100254:	eb 0f                	jmp    80100265 <bref+0x1b5>
+80100256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010025d:	8d 76 00             	lea    0x0(%esi),%esi
+80100260:	f6 07 04             	testb  $0x4,(%edi)
+80100263:	75 c5                	jne    8010022a <bref+0x17a>
+  acquire(&bcache.lrulock);
+80100265:	83 ec 0c             	sub    $0xc,%esp
+80100268:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010026b:	89 fe                	mov    %edi,%esi
+8010026d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+80100270:	68 20 50 8e 80       	push   $0x808e5020
+80100275:	e8 d6 72 00 00       	call   80107550 <acquire>
+  b->next->prev = b->prev;
+8010027a:	8b 4e 54             	mov    0x54(%esi),%ecx
+8010027d:	8b 46 50             	mov    0x50(%esi),%eax
+80100280:	89 41 50             	mov    %eax,0x50(%ecx)
+  b->prev->next = b->next;
+80100283:	8b 4e 54             	mov    0x54(%esi),%ecx
+80100286:	89 48 54             	mov    %ecx,0x54(%eax)
+  release(&bcache.lrulock);
+80100289:	c7 04 24 20 50 8e 80 	movl   $0x808e5020,(%esp)
+80100290:	e8 5b 72 00 00       	call   801074f0 <release>
+  for(pp = &bcache.bucket[h2].head; *pp != b; pp = &(*pp)->hnext)
+80100295:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80100298:	83 c4 10             	add    $0x10,%esp
+8010029b:	6b ca 38             	imul   $0x38,%edx,%ecx
+8010029e:	8b 81 88 49 8e 80    	mov    -0x7f71b678(%ecx),%eax
+801002a4:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+801002a7:	39 c6                	cmp    %eax,%esi
+801002a9:	0f 84 91 00 00 00    	je     80100340 <bref+0x290>
+801002af:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801002b2:	8b 40 58             	mov    0x58(%eax),%eax
+801002b5:	39 f0                	cmp    %esi,%eax
+801002b7:	75 f6                	jne    801002af <bref+0x1ff>
+801002b9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801002bc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+801002bf:	83 c0 58             	add    $0x58,%eax
+  *pp = b->hnext;
+801002c2:	8b 4e 58             	mov    0x58(%esi),%ecx
+801002c5:	89 08                	mov    %ecx,(%eax)
+  if(h2 != h)
+801002c7:	39 d3                	cmp    %edx,%ebx
+801002c9:	74 14                	je     801002df <bref+0x22f>
+    release(&bcache.bucket[h2].lock);
+801002cb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801002ce:	83 ec 0c             	sub    $0xc,%esp
+801002d1:	05 54 49 8e 80       	add    $0x808e4954,%eax
+801002d6:	50                   	push   %eax
+801002d7:	e8 14 72 00 00       	call   801074f0 <release>
+801002dc:	83 c4 10             	add    $0x10,%esp
+  b->hnext = bcache.bucket[h].head;
+801002df:	6b c3 38             	imul   $0x38,%ebx,%eax
+    b->refcnt = 1;
+801002e2:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+  b->hnext = bcache.bucket[h].head;
+801002e5:	8b 90 88 49 8e 80    	mov    -0x7f71b678(%eax),%edx
+801002eb:	89 56 58             	mov    %edx,0x58(%esi)
+  bcache.bucket[h].head = b;
+801002ee:	89 b0 88 49 8e 80    	mov    %esi,-0x7f71b678(%eax)
+    b->blockno = blockno;
+801002f4:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    b->dev = dev;
+801002f7:	89 7e 04             	mov    %edi,0x4(%esi)
+    b->blockno = blockno;
+801002fa:	89 46 08             	mov    %eax,0x8(%esi)
+    b->flags = 0;
+801002fd:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    b->refcnt = 1;
+80100303:	c7 46 4c 01 00 00 00 	movl   $0x1,0x4c(%esi)
+8010030a:	e9 57 fe ff ff       	jmp    80100166 <bref+0xb6>
+8010030f:	90                   	nop
+    release(&bcache.lrulock);
+80100310:	83 ec 0c             	sub    $0xc,%esp
+80100313:	68 20 50 8e 80       	push   $0x808e5020
+80100318:	e8 d3 71 00 00       	call   801074f0 <release>
+8010031d:	83 c4 10             	add    $0x10,%esp
+      if(!mayfail)
+80100320:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80100323:	85 c0                	test   %eax,%eax
+80100325:	0f 85 3b fe ff ff    	jne    80100166 <bref+0xb6>
+        panic("bget: no buffers");
+8010032b:	83 ec 0c             	sub    $0xc,%esp
+8010032e:	68 00 af 10 80       	push   $0x8010af00
+80100333:	e8 48 05 00 00       	call   80100880 <panic>
+80100338:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010033f:	90                   	nop
+  for(pp = &bcache.bucket[h2].head; *pp != b; pp = &(*pp)->hnext)
+80100340:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80100343:	05 88 49 8e 80       	add    $0x808e4988,%eax
+80100348:	e9 75 ff ff ff       	jmp    801002c2 <bref+0x212>
+8010034d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80100350 <bunref>:
+
+// Drop a reference to b, taken by bref().
+// Move to the tail of the free list once unreferenced.
+static void
+bunref(struct buf *b)
+{
+80100350:	55                   	push   %ebp
+80100351:	89 e5                	mov    %esp,%ebp
+80100353:	56                   	push   %esi
+80100354:	89 c6                	mov    %eax,%esi
+80100356:	53                   	push   %ebx
+  int h;
+
+  h = BHASH(b->dev, b->blockno);
+80100357:	8b 40 04             	mov    0x4(%eax),%eax
+8010035a:	8d 0c c5 00 00 00 00 	lea    0x0(,%eax,8),%ecx
+80100361:	29 c1                	sub    %eax,%ecx
+80100363:	b8 85 10 42 08       	mov    $0x8421085,%eax
+80100368:	03 4e 08             	add    0x8(%esi),%ecx
+  acquire(&bcache.bucket[h].lock);
+8010036b:	83 ec 0c             	sub    $0xc,%esp
+  h = BHASH(b->dev, b->blockno);
+8010036e:	f7 e1                	mul    %ecx
+80100370:	89 c8                	mov    %ecx,%eax
+80100372:	29 d0                	sub    %edx,%eax
+80100374:	d1 e8                	shr    %eax
+80100376:	01 c2                	add    %eax,%edx
+80100378:	c1 ea 04             	shr    $0x4,%edx
+8010037b:	89 d0                	mov    %edx,%eax
+8010037d:	c1 e0 05             	shl    $0x5,%eax
+80100380:	29 d0                	sub    %edx,%eax
+80100382:	29 c1                	sub    %eax,%ecx
+  acquire(&bcache.bucket[h].lock);
+80100384:	6b d9 38             	imul   $0x38,%ecx,%ebx
+80100387:	81 c3 54 49 8e 80    	add    $0x808e4954,%ebx
+8010038d:	53                   	push   %ebx
+8010038e:	e8 bd 71 00 00       	call   80107550 <acquire>
+  b->refcnt--;
+80100393:	8b 46 4c             	mov    0x4c(%esi),%eax
+  if (b->refcnt == 0) {
+80100396:	83 c4 10             	add    $0x10,%esp
+  b->refcnt--;
+80100399:	83 e8 01             	sub    $0x1,%eax
+8010039c:	89 46 4c             	mov    %eax,0x4c(%esi)
+  if (b->refcnt == 0) {
+8010039f:	85 c0                	test   %eax,%eax
+801003a1:	74 1d                	je     801003c0 <bunref+0x70>
+    b->prev = bcache.lru.prev;
+    bcache.lru.prev->next = b;
+    bcache.lru.prev = b;
+    release(&bcache.lrulock);
+  }
+  release(&bcache.bucket[h].lock);
+801003a3:	83 ec 0c             	sub    $0xc,%esp
+801003a6:	53                   	push   %ebx
+801003a7:	e8 44 71 00 00       	call   801074f0 <release>
+}
+801003ac:	83 c4 10             	add    $0x10,%esp
+801003af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801003b2:	5b                   	pop    %ebx
+801003b3:	5e                   	pop    %esi
+801003b4:	5d                   	pop    %ebp
+801003b5:	c3                   	ret
+801003b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801003bd:	8d 76 00             	lea    0x0(%esi),%esi
+    acquire(&bcache.lrulock);
+801003c0:	83 ec 0c             	sub    $0xc,%esp
+801003c3:	68 20 50 8e 80       	push   $0x808e5020
+801003c8:	e8 83 71 00 00       	call   80107550 <acquire>
+    b->next = &bcache.lru;
+801003cd:	c7 46 54 54 50 8e 80 	movl   $0x808e5054,0x54(%esi)
+    b->prev = bcache.lru.prev;
+801003d4:	a1 a4 50 8e 80       	mov    0x808e50a4,%eax
+801003d9:	89 46 50             	mov    %eax,0x50(%esi)
+    bcache.lru.prev->next = b;
+801003dc:	89 70 54             	mov    %esi,0x54(%eax)
+    bcache.lru.prev = b;
+801003df:	89 35 a4 50 8e 80    	mov    %esi,0x808e50a4
+    release(&bcache.lrulock);
+801003e5:	c7 04 24 20 50 8e 80 	movl   $0x808e5020,(%esp)
+801003ec:	e8 ff 70 00 00       	call   801074f0 <release>
+801003f1:	83 c4 10             	add    $0x10,%esp
+801003f4:	eb ad                	jmp    801003a3 <bunref+0x53>
+801003f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801003fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80100400 <binit>:
+{
+80100400:	55                   	push   %ebp
+80100401:	89 e5                	mov    %esp,%ebp
+80100403:	53                   	push   %ebx
+80100404:	bb 54 49 8e 80       	mov    $0x808e4954,%ebx
+80100409:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&bcache.lock, "bcache");
+8010040c:	68 11 af 10 80       	push   $0x8010af11
+80100411:	68 20 e5 8d 80       	push   $0x808de520
+80100416:	e8 55 6f 00 00       	call   80107370 <initlock>
+  initlock(&bcache.lrulock, "bcache.lru");
+8010041b:	58                   	pop    %eax
+8010041c:	5a                   	pop    %edx
+8010041d:	68 18 af 10 80       	push   $0x8010af18
+80100422:	68 20 50 8e 80       	push   $0x808e5020
+80100427:	e8 44 6f 00 00       	call   80107370 <initlock>
+  for(h = 0; h < NBUCKET; h++)
+8010042c:	83 c4 10             	add    $0x10,%esp
+8010042f:	90                   	nop
+    initlock(&bcache.bucket[h].lock, "bcache.bucket");
+80100430:	83 ec 08             	sub    $0x8,%esp
+80100433:	68 23 af 10 80       	push   $0x8010af23
+80100438:	53                   	push   %ebx
+  for(h = 0; h < NBUCKET; h++)
+80100439:	83 c3 38             	add    $0x38,%ebx
+    initlock(&bcache.bucket[h].lock, "bcache.bucket");
+8010043c:	e8 2f 6f 00 00       	call   80107370 <initlock>
+  for(h = 0; h < NBUCKET; h++)
+80100441:	83 c4 10             	add    $0x10,%esp
+80100444:	81 fb 1c 50 8e 80    	cmp    $0x808e501c,%ebx
+8010044a:	75 e4                	jne    80100430 <binit+0x30>
+  bcache.lru.prev = &bcache.lru;
+8010044c:	c7 05 a4 50 8e 80 54 	movl   $0x808e5054,0x808e50a4
+80100453:	50 8e 80 
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+80100456:	bb 54 e5 8d 80       	mov    $0x808de554,%ebx
+  bcache.lru.next = &bcache.lru;
+8010045b:	c7 05 a8 50 8e 80 54 	movl   $0x808e5054,0x808e50a8
+80100462:	50 8e 80 
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+80100465:	8d 76 00             	lea    0x0(%esi),%esi
+    b->next = &bcache.lru;
+80100468:	c7 43 54 54 50 8e 80 	movl   $0x808e5054,0x54(%ebx)
+    b->prev = bcache.lru.prev;
+8010046f:	a1 a4 50 8e 80       	mov    0x808e50a4,%eax
+    initsleeplock(&b->lock, "buffer");
+80100474:	83 ec 08             	sub    $0x8,%esp
+    b->prev = bcache.lru.prev;
+80100477:	89 43 50             	mov    %eax,0x50(%ebx)
+    bcache.lru.prev->next = b;
+8010047a:	89 58 54             	mov    %ebx,0x54(%eax)
+    b->hnext = bcache.bucket[h].head;
+8010047d:	a1 88 49 8e 80       	mov    0x808e4988,%eax
+    bcache.lru.prev = b;
+80100482:	89 1d a4 50 8e 80    	mov    %ebx,0x808e50a4
+    b->hnext = bcache.bucket[h].head;
+80100488:	89 43 58             	mov    %eax,0x58(%ebx)
+    initsleeplock(&b->lock, "buffer");
+8010048b:	8d 43 0c             	lea    0xc(%ebx),%eax
+    bcache.bucket[h].head = b;
+8010048e:	89 1d 88 49 8e 80    	mov    %ebx,0x808e4988
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+80100494:	83 c3 64             	add    $0x64,%ebx
+    initsleeplock(&b->lock, "buffer");
+80100497:	68 31 af 10 80       	push   $0x8010af31
+8010049c:	50                   	push   %eax
+8010049d:	e8 3e 6d 00 00       	call   801071e0 <initsleeplock>
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+801004a2:	83 c4 10             	add    $0x10,%esp
+801004a5:	81 fb 54 49 8e 80    	cmp    $0x808e4954,%ebx
+801004ab:	75 bb                	jne    80100468 <binit+0x68>
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+801004ad:	bb 54 e5 8d 80       	mov    $0x808de554,%ebx
+801004b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if((b - bcache.buf) % (PGSIZE/BSIZE) == 0 && (mem = kalloc()) == 0)
+801004b8:	e8 23 35 00 00       	call   801039e0 <kalloc>
+801004bd:	85 c0                	test   %eax,%eax
+801004bf:	74 13                	je     801004d4 <binit+0xd4>
+    b->data = (uchar*)mem + (b - bcache.buf) % (PGSIZE/BSIZE) * BSIZE;
+801004c1:	89 43 60             	mov    %eax,0x60(%ebx)
+  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
+801004c4:	83 c3 64             	add    $0x64,%ebx
+801004c7:	81 fb 54 49 8e 80    	cmp    $0x808e4954,%ebx
+801004cd:	75 e9                	jne    801004b8 <binit+0xb8>
+}
+801004cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801004d2:	c9                   	leave
+801004d3:	c3                   	ret
+      panic("binit: out of memory");
+801004d4:	83 ec 0c             	sub    $0xc,%esp
+801004d7:	68 38 af 10 80       	push   $0x8010af38
+801004dc:	e8 9f 03 00 00       	call   80100880 <panic>
+801004e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801004e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801004ef:	90                   	nop
+
+801004f0 <bread>:
+}
+
+// Return a locked buf with the contents of the indicated block.
+struct buf*
+bread(uint dev, uint blockno)
+{
+801004f0:	55                   	push   %ebp
+  b = bref(dev, blockno, 0);
+801004f1:	31 c9                	xor    %ecx,%ecx
+{
+801004f3:	89 e5                	mov    %esp,%ebp
+801004f5:	53                   	push   %ebx
+801004f6:	83 ec 04             	sub    $0x4,%esp
+  b = bref(dev, blockno, 0);
+801004f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+801004fc:	8b 45 08             	mov    0x8(%ebp),%eax
+801004ff:	e8 ac fb ff ff       	call   801000b0 <bref>
+  acquiresleep(&b->lock);
+80100504:	83 ec 0c             	sub    $0xc,%esp
+  b = bref(dev, blockno, 0);
+80100507:	89 c3                	mov    %eax,%ebx
+  acquiresleep(&b->lock);
+80100509:	83 c0 0c             	add    $0xc,%eax
+8010050c:	50                   	push   %eax
+8010050d:	e8 0e 6d 00 00       	call   80107220 <acquiresleep>
+  struct buf *b;
+
+  b = bget(dev, blockno);
+  if((b->flags & B_VALID) == 0) {
+80100512:	83 c4 10             	add    $0x10,%esp
+80100515:	f6 03 02             	testb  $0x2,(%ebx)
+80100518:	74 0e                	je     80100528 <bread+0x38>
+    iderw(b);
+  }
+  return b;
+}
+8010051a:	89 d8                	mov    %ebx,%eax
+8010051c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010051f:	c9                   	leave
+80100520:	c3                   	ret
+80100521:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    iderw(b);
+80100528:	83 ec 0c             	sub    $0xc,%esp
+8010052b:	53                   	push   %ebx
+8010052c:	e8 8f a8 00 00       	call   8010adc0 <iderw>
+}
+80100531:	89 d8                	mov    %ebx,%eax
+    iderw(b);
+80100533:	83 c4 10             	add    $0x10,%esp
+}
+80100536:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100539:	c9                   	leave
+8010053a:	c3                   	ret
+8010053b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010053f:	90                   	nop
+
+80100540 <bwrite>:
+
+// Write b's contents to disk.  Must be locked.
+void
+bwrite(struct buf *b)
+{
+80100540:	55                   	push   %ebp
+80100541:	89 e5                	mov    %esp,%ebp
+80100543:	53                   	push   %ebx
+80100544:	83 ec 10             	sub    $0x10,%esp
+80100547:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+8010054a:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010054d:	50                   	push   %eax
+8010054e:	e8 cd 6d 00 00       	call   80107320 <holdingsleep>
+80100553:	83 c4 10             	add    $0x10,%esp
+80100556:	85 c0                	test   %eax,%eax
+80100558:	74 0f                	je     80100569 <bwrite+0x29>
+    panic("bwrite");
+  b->flags |= B_DIRTY;
+8010055a:	83 0b 04             	orl    $0x4,(%ebx)
+  iderw(b);
+8010055d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+80100560:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80100563:	c9                   	leave
+  iderw(b);
+80100564:	e9 57 a8 00 00       	jmp    8010adc0 <iderw>
+    panic("bwrite");
+80100569:	83 ec 0c             	sub    $0xc,%esp
+8010056c:	68 4d af 10 80       	push   $0x8010af4d
+80100571:	e8 0a 03 00 00       	call   80100880 <panic>
+80100576:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010057d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80100580 <bwritev>:
+
+// Write the n locked bufs in bp to disk together.
+void
+bwritev(struct buf **bp, int n)
+{
+80100580:	55                   	push   %ebp
+80100581:	89 e5                	mov    %esp,%ebp
+80100583:	57                   	push   %edi
+80100584:	56                   	push   %esi
+80100585:	53                   	push   %ebx
+80100586:	83 ec 0c             	sub    $0xc,%esp
+80100589:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010058c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i;
+
+  for(i = 0; i < n; i++){
+8010058f:	85 f6                	test   %esi,%esi
+80100591:	7e 28                	jle    801005bb <bwritev+0x3b>
+80100593:	31 db                	xor    %ebx,%ebx
+80100595:	8d 76 00             	lea    0x0(%esi),%esi
+    if(!holdingsleep(&bp[i]->lock))
+80100598:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+8010059b:	83 ec 0c             	sub    $0xc,%esp
+8010059e:	83 c0 0c             	add    $0xc,%eax
+801005a1:	50                   	push   %eax
+801005a2:	e8 79 6d 00 00       	call   80107320 <holdingsleep>
+801005a7:	83 c4 10             	add    $0x10,%esp
+801005aa:	85 c0                	test   %eax,%eax
+801005ac:	74 1f                	je     801005cd <bwritev+0x4d>
+      panic("bwritev");
+    bp[i]->flags |= B_DIRTY;
+801005ae:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  for(i = 0; i < n; i++){
+801005b1:	83 c3 01             	add    $0x1,%ebx
+    bp[i]->flags |= B_DIRTY;
+801005b4:	83 08 04             	orl    $0x4,(%eax)
+  for(i = 0; i < n; i++){
+801005b7:	39 de                	cmp    %ebx,%esi
+801005b9:	75 dd                	jne    80100598 <bwritev+0x18>
+  }
+  iderwv(bp, n);
+801005bb:	89 75 0c             	mov    %esi,0xc(%ebp)
+801005be:	89 7d 08             	mov    %edi,0x8(%ebp)
+}
+801005c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801005c4:	5b                   	pop    %ebx
+801005c5:	5e                   	pop    %esi
+801005c6:	5f                   	pop    %edi
+801005c7:	5d                   	pop    %ebp
+  iderwv(bp, n);
+801005c8:	e9 f3 a8 00 00       	jmp    8010aec0 <iderwv>
+      panic("bwritev");
+801005cd:	83 ec 0c             	sub    $0xc,%esp
+801005d0:	68 54 af 10 80       	push   $0x8010af54
+801005d5:	e8 a6 02 00 00       	call   80100880 <panic>
+801005da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801005e0 <breadahead>:
+// if NASYNC read-aheads are already in flight or there is
+// no free buffer. The disk driver calls bdone() when the
+// read completes.
+void
+breadahead(uint dev, uint blockno)
+{
+801005e0:	55                   	push   %ebp
+801005e1:	89 e5                	mov    %esp,%ebp
+801005e3:	56                   	push   %esi
+801005e4:	53                   	push   %ebx
+801005e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801005e8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  struct buf *b;
+
+  acquire(&bcache.lock);
+801005eb:	83 ec 0c             	sub    $0xc,%esp
+801005ee:	68 20 e5 8d 80       	push   $0x808de520
+801005f3:	e8 58 6f 00 00       	call   80107550 <acquire>
+  if(bcache.nasync >= NASYNC){
+801005f8:	a1 1c 50 8e 80       	mov    0x808e501c,%eax
+801005fd:	83 c4 10             	add    $0x10,%esp
+80100600:	83 f8 3f             	cmp    $0x3f,%eax
+80100603:	0f 8f ae 00 00 00    	jg     801006b7 <breadahead+0xd7>
+    release(&bcache.lock);
+    return;
+  }
+  bcache.nasync++;
+  release(&bcache.lock);
+80100609:	83 ec 0c             	sub    $0xc,%esp
+  bcache.nasync++;
+8010060c:	83 c0 01             	add    $0x1,%eax
+8010060f:	a3 1c 50 8e 80       	mov    %eax,0x808e501c
+  release(&bcache.lock);
+80100614:	68 20 e5 8d 80       	push   $0x808de520
+80100619:	e8 d2 6e 00 00       	call   801074f0 <release>
+
+  if((b = bref(dev, blockno, 1)) == 0){
+8010061e:	89 d8                	mov    %ebx,%eax
+80100620:	b9 01 00 00 00       	mov    $0x1,%ecx
+80100625:	89 f2                	mov    %esi,%edx
+80100627:	e8 84 fa ff ff       	call   801000b0 <bref>
+8010062c:	83 c4 10             	add    $0x10,%esp
+8010062f:	89 c3                	mov    %eax,%ebx
+80100631:	85 c0                	test   %eax,%eax
+80100633:	74 6b                	je     801006a0 <breadahead+0xc0>
+    bunasync();
+    return;
+  }
+  if((b->flags & B_VALID) || !tryacquiresleep(&b->lock)){
+80100635:	f6 00 02             	testb  $0x2,(%eax)
+80100638:	75 36                	jne    80100670 <breadahead+0x90>
+8010063a:	83 ec 0c             	sub    $0xc,%esp
+8010063d:	8d 70 0c             	lea    0xc(%eax),%esi
+80100640:	56                   	push   %esi
+80100641:	e8 3a 6c 00 00       	call   80107280 <tryacquiresleep>
+80100646:	83 c4 10             	add    $0x10,%esp
+80100649:	85 c0                	test   %eax,%eax
+8010064b:	74 23                	je     80100670 <breadahead+0x90>
+    bunasync();
+    bunref(b);
+    return;
+  }
+  if(b->flags & B_VALID){
+8010064d:	8b 03                	mov    (%ebx),%eax
+8010064f:	a8 02                	test   $0x2,%al
+80100651:	75 7d                	jne    801006d0 <breadahead+0xf0>
+    releasesleep(&b->lock);
+    bunasync();
+    bunref(b);
+    return;
+  }
+  b->flags |= B_ASYNC;
+80100653:	83 c8 08             	or     $0x8,%eax
+80100656:	89 03                	mov    %eax,(%ebx)
+  iderwasync(b);
+80100658:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+8010065b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010065e:	5b                   	pop    %ebx
+8010065f:	5e                   	pop    %esi
+80100660:	5d                   	pop    %ebp
+  iderwasync(b);
+80100661:	e9 2a a8 00 00       	jmp    8010ae90 <iderwasync>
+80100666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010066d:	8d 76 00             	lea    0x0(%esi),%esi
+  acquire(&bcache.lock);
+80100670:	83 ec 0c             	sub    $0xc,%esp
+80100673:	68 20 e5 8d 80       	push   $0x808de520
+80100678:	e8 d3 6e 00 00       	call   80107550 <acquire>
+  bcache.nasync--;
+8010067d:	83 2d 1c 50 8e 80 01 	subl   $0x1,0x808e501c
+  release(&bcache.lock);
+80100684:	c7 04 24 20 e5 8d 80 	movl   $0x808de520,(%esp)
+8010068b:	e8 60 6e 00 00       	call   801074f0 <release>
+    bunref(b);
+80100690:	83 c4 10             	add    $0x10,%esp
+}
+80100693:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    bunref(b);
+80100696:	89 d8                	mov    %ebx,%eax
+}
+80100698:	5b                   	pop    %ebx
+80100699:	5e                   	pop    %esi
+8010069a:	5d                   	pop    %ebp
+    bunref(b);
+8010069b:	e9 b0 fc ff ff       	jmp    80100350 <bunref>
+  acquire(&bcache.lock);
+801006a0:	83 ec 0c             	sub    $0xc,%esp
+801006a3:	68 20 e5 8d 80       	push   $0x808de520
+801006a8:	e8 a3 6e 00 00       	call   80107550 <acquire>
+  bcache.nasync--;
+801006ad:	83 2d 1c 50 8e 80 01 	subl   $0x1,0x808e501c
+  release(&bcache.lock);
+801006b4:	83 c4 10             	add    $0x10,%esp
+801006b7:	c7 45 08 20 e5 8d 80 	movl   $0x808de520,0x8(%ebp)
+}
+801006be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801006c1:	5b                   	pop    %ebx
+801006c2:	5e                   	pop    %esi
+801006c3:	5d                   	pop    %ebp
+  release(&bcache.lock);
+801006c4:	e9 27 6e 00 00       	jmp    801074f0 <release>
+801006c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    releasesleep(&b->lock);
+801006d0:	83 ec 0c             	sub    $0xc,%esp
+801006d3:	56                   	push   %esi
+801006d4:	e8 07 6c 00 00       	call   801072e0 <releasesleep>
+  acquire(&bcache.lock);
+801006d9:	c7 04 24 20 e5 8d 80 	movl   $0x808de520,(%esp)
+801006e0:	eb 96                	jmp    80100678 <breadahead+0x98>
+801006e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801006e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801006f0 <bdone>:
+
+// Release a buffer whose read-ahead has completed.
+// Called by the disk driver, in interrupt context.
+void
+bdone(struct buf *b)
+{
+801006f0:	55                   	push   %ebp
+801006f1:	89 e5                	mov    %esp,%ebp
+801006f3:	53                   	push   %ebx
+801006f4:	83 ec 10             	sub    $0x10,%esp
+801006f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  releasesleep(&b->lock);
+801006fa:	8d 43 0c             	lea    0xc(%ebx),%eax
+801006fd:	50                   	push   %eax
+801006fe:	e8 dd 6b 00 00       	call   801072e0 <releasesleep>
+  acquire(&bcache.lock);
+80100703:	c7 04 24 20 e5 8d 80 	movl   $0x808de520,(%esp)
+8010070a:	e8 41 6e 00 00       	call   80107550 <acquire>
+  bcache.nasync--;
+8010070f:	83 2d 1c 50 8e 80 01 	subl   $0x1,0x808e501c
+  release(&bcache.lock);
+80100716:	c7 04 24 20 e5 8d 80 	movl   $0x808de520,(%esp)
+8010071d:	e8 ce 6d 00 00       	call   801074f0 <release>
+  bunasync();
+  bunref(b);
+80100722:	83 c4 10             	add    $0x10,%esp
+80100725:	89 d8                	mov    %ebx,%eax
+}
+80100727:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010072a:	c9                   	leave
+  bunref(b);
+8010072b:	e9 20 fc ff ff       	jmp    80100350 <bunref>
+
+80100730 <brelse>:
+
+// Release a locked buffer.
+void
+brelse(struct buf *b)
+{
+80100730:	55                   	push   %ebp
+80100731:	89 e5                	mov    %esp,%ebp
+80100733:	56                   	push   %esi
+80100734:	53                   	push   %ebx
+80100735:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holdingsleep(&b->lock))
+80100738:	8d 73 0c             	lea    0xc(%ebx),%esi
+8010073b:	83 ec 0c             	sub    $0xc,%esp
+8010073e:	56                   	push   %esi
+8010073f:	e8 dc 6b 00 00       	call   80107320 <holdingsleep>
+80100744:	83 c4 10             	add    $0x10,%esp
+80100747:	85 c0                	test   %eax,%eax
+80100749:	74 19                	je     80100764 <brelse+0x34>
+    panic("brelse");
+
+  releasesleep(&b->lock);
+8010074b:	83 ec 0c             	sub    $0xc,%esp
+8010074e:	56                   	push   %esi
+8010074f:	e8 8c 6b 00 00       	call   801072e0 <releasesleep>
+  bunref(b);
+80100754:	83 c4 10             	add    $0x10,%esp
+}
+80100757:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  bunref(b);
+8010075a:	89 d8                	mov    %ebx,%eax
+}
+8010075c:	5b                   	pop    %ebx
+8010075d:	5e                   	pop    %esi
+8010075e:	5d                   	pop    %ebp
+  bunref(b);
+8010075f:	e9 ec fb ff ff       	jmp    80100350 <bunref>
+    panic("brelse");
+80100764:	83 ec 0c             	sub    $0xc,%esp
+80100767:	68 5c af 10 80       	push   $0x8010af5c
+8010076c:	e8 0f 01 00 00       	call   80100880 <panic>
+80100771:	66 90                	xchg   %ax,%ax
+80100773:	66 90                	xchg   %ax,%ax
+80100775:	66 90                	xchg   %ax,%ax
+80100777:	66 90                	xchg   %ax,%ax
+80100779:	66 90                	xchg   %ax,%ax
+8010077b:	66 90                	xchg   %ax,%ax
+8010077d:	66 90                	xchg   %ax,%ax
+8010077f:	90                   	nop
+
+80100780 <consoleread>:
+  }
+}
+
+int
+consoleread(struct inode *ip, char *dst, int n)
+{
+80100780:	55                   	push   %ebp
+80100781:	89 e5                	mov    %esp,%ebp
+80100783:	57                   	push   %edi
+80100784:	56                   	push   %esi
+80100785:	53                   	push   %ebx
+80100786:	83 ec 18             	sub    $0x18,%esp
+80100789:	8b 5d 10             	mov    0x10(%ebp),%ebx
+8010078c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  uint target;
+  int c;
+
+  iunlock(ip);
+8010078f:	ff 75 08             	push   0x8(%ebp)
+  target = n;
+80100792:	89 df                	mov    %ebx,%edi
+  iunlock(ip);
+80100794:	e8 a7 21 00 00       	call   80102940 <iunlock>
+  acquire(&cons.lock);
+80100799:	c7 04 24 60 51 8e 80 	movl   $0x808e5160,(%esp)
+801007a0:	e8 ab 6d 00 00       	call   80107550 <acquire>
+  while(n > 0){
+801007a5:	83 c4 10             	add    $0x10,%esp
+801007a8:	85 db                	test   %ebx,%ebx
+801007aa:	0f 8e 94 00 00 00    	jle    80100844 <consoleread+0xc4>
+    while(input.r == input.w){
+801007b0:	a1 40 51 8e 80       	mov    0x808e5140,%eax
+801007b5:	39 05 44 51 8e 80    	cmp    %eax,0x808e5144
+801007bb:	74 25                	je     801007e2 <consoleread+0x62>
+801007bd:	eb 59                	jmp    80100818 <consoleread+0x98>
+801007bf:	90                   	nop
+      if(myproc()->killed){
+        release(&cons.lock);
+        ilock(ip);
+        return -1;
+      }
+      sleep(&input.r, &cons.lock);
+801007c0:	83 ec 08             	sub    $0x8,%esp
+801007c3:	68 60 51 8e 80       	push   $0x808e5160
+801007c8:	68 40 51 8e 80       	push   $0x808e5140
+801007cd:	e8 1e 62 00 00       	call   801069f0 <sleep>
+    while(input.r == input.w){
+801007d2:	a1 40 51 8e 80       	mov    0x808e5140,%eax
+801007d7:	83 c4 10             	add    $0x10,%esp
+801007da:	3b 05 44 51 8e 80    	cmp    0x808e5144,%eax
+801007e0:	75 36                	jne    80100818 <consoleread+0x98>
+      if(myproc()->killed){
+801007e2:	e8 99 55 00 00       	call   80105d80 <myproc>
+801007e7:	8b 48 40             	mov    0x40(%eax),%ecx
+801007ea:	85 c9                	test   %ecx,%ecx
+801007ec:	74 d2                	je     801007c0 <consoleread+0x40>
+        release(&cons.lock);
+801007ee:	83 ec 0c             	sub    $0xc,%esp
+801007f1:	68 60 51 8e 80       	push   $0x808e5160
+801007f6:	e8 f5 6c 00 00       	call   801074f0 <release>
+        ilock(ip);
+801007fb:	5a                   	pop    %edx
+801007fc:	ff 75 08             	push   0x8(%ebp)
+801007ff:	e8 5c 20 00 00       	call   80102860 <ilock>
+        return -1;
+80100804:	83 c4 10             	add    $0x10,%esp
+  }
+  release(&cons.lock);
+  ilock(ip);
+
+  return target - n;
+}
+80100807:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return -1;
+8010080a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010080f:	5b                   	pop    %ebx
+80100810:	5e                   	pop    %esi
+80100811:	5f                   	pop    %edi
+80100812:	5d                   	pop    %ebp
+80100813:	c3                   	ret
+80100814:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    c = input.buf[input.r++ % INPUT_BUF];
+80100818:	8d 50 01             	lea    0x1(%eax),%edx
+8010081b:	89 15 40 51 8e 80    	mov    %edx,0x808e5140
+80100821:	89 c2                	mov    %eax,%edx
+80100823:	83 e2 7f             	and    $0x7f,%edx
+80100826:	0f be 8a c0 50 8e 80 	movsbl -0x7f71af40(%edx),%ecx
+    if(c == C('D')){  // EOF
+8010082d:	80 f9 04             	cmp    $0x4,%cl
+80100830:	74 37                	je     80100869 <consoleread+0xe9>
+    *dst++ = c;
+80100832:	83 c6 01             	add    $0x1,%esi
+    --n;
+80100835:	83 eb 01             	sub    $0x1,%ebx
+    *dst++ = c;
+80100838:	88 4e ff             	mov    %cl,-0x1(%esi)
+    if(c == '\n')
+8010083b:	83 f9 0a             	cmp    $0xa,%ecx
+8010083e:	0f 85 64 ff ff ff    	jne    801007a8 <consoleread+0x28>
+  release(&cons.lock);
+80100844:	83 ec 0c             	sub    $0xc,%esp
+80100847:	68 60 51 8e 80       	push   $0x808e5160
+8010084c:	e8 9f 6c 00 00       	call   801074f0 <release>
+  ilock(ip);
+80100851:	58                   	pop    %eax
+80100852:	ff 75 08             	push   0x8(%ebp)
+80100855:	e8 06 20 00 00       	call   80102860 <ilock>
+  return target - n;
+8010085a:	89 f8                	mov    %edi,%eax
+8010085c:	83 c4 10             	add    $0x10,%esp
+}
+8010085f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return target - n;
+80100862:	29 d8                	sub    %ebx,%eax
+}
+80100864:	5b                   	pop    %ebx
+80100865:	5e                   	pop    %esi
+80100866:	5f                   	pop    %edi
+80100867:	5d                   	pop    %ebp
+80100868:	c3                   	ret
+      if(n < target){
+80100869:	39 fb                	cmp    %edi,%ebx
+8010086b:	73 d7                	jae    80100844 <consoleread+0xc4>
+        input.r--;
+8010086d:	a3 40 51 8e 80       	mov    %eax,0x808e5140
+80100872:	eb d0                	jmp    80100844 <consoleread+0xc4>
+80100874:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010087b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010087f:	90                   	nop
+
+80100880 <panic>:
+{
+80100880:	55                   	push   %ebp
+80100881:	89 e5                	mov    %esp,%ebp
+80100883:	56                   	push   %esi
+80100884:	53                   	push   %ebx
+80100885:	83 ec 30             	sub    $0x30,%esp
+}
+
+static inline void
+cli(void)
+{
+  asm volatile("cli");
+80100888:	fa                   	cli
+  cons.locking = 0;
+80100889:	c7 05 94 51 8e 80 00 	movl   $0x0,0x808e5194
+80100890:	00 00 00 
+  getcallerpcs(&s, pcs);
+80100893:	8d 5d d0             	lea    -0x30(%ebp),%ebx
+80100896:	8d 75 f8             	lea    -0x8(%ebp),%esi
+  cprintf("lapicid %d: panic: ", lapicid());
+80100899:	e8 92 37 00 00       	call   80104030 <lapicid>
+8010089e:	83 ec 08             	sub    $0x8,%esp
+801008a1:	50                   	push   %eax
+801008a2:	68 63 af 10 80       	push   $0x8010af63
+801008a7:	e8 04 03 00 00       	call   80100bb0 <cprintf>
+  cprintf(s);
+801008ac:	58                   	pop    %eax
+801008ad:	ff 75 08             	push   0x8(%ebp)
+801008b0:	e8 fb 02 00 00       	call   80100bb0 <cprintf>
+  cprintf("\n");
+801008b5:	c7 04 24 13 b9 10 80 	movl   $0x8010b913,(%esp)
+801008bc:	e8 ef 02 00 00       	call   80100bb0 <cprintf>
+  getcallerpcs(&s, pcs);
+801008c1:	8d 45 08             	lea    0x8(%ebp),%eax
+801008c4:	5a                   	pop    %edx
+801008c5:	59                   	pop    %ecx
+801008c6:	53                   	push   %ebx
+801008c7:	50                   	push   %eax
+801008c8:	e8 c3 6a 00 00       	call   80107390 <getcallerpcs>
+  for(i=0; i<10; i++)
+801008cd:	83 c4 10             	add    $0x10,%esp
+    cprintf(" %p", pcs[i]);
+801008d0:	83 ec 08             	sub    $0x8,%esp
+801008d3:	ff 33                	push   (%ebx)
+  for(i=0; i<10; i++)
+801008d5:	83 c3 04             	add    $0x4,%ebx
+    cprintf(" %p", pcs[i]);
+801008d8:	68 77 af 10 80       	push   $0x8010af77
+801008dd:	e8 ce 02 00 00       	call   80100bb0 <cprintf>
+  for(i=0; i<10; i++)
+801008e2:	83 c4 10             	add    $0x10,%esp
+801008e5:	39 f3                	cmp    %esi,%ebx
+801008e7:	75 e7                	jne    801008d0 <panic+0x50>
+  panicked = 1; // freeze other CPU
+801008e9:	c7 05 98 51 8e 80 01 	movl   $0x1,0x808e5198
+801008f0:	00 00 00 
+  for(;;)
+801008f3:	eb fe                	jmp    801008f3 <panic+0x73>
+801008f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801008fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100900 <consputc.part.0>:
+consputc(int c)
+80100900:	55                   	push   %ebp
+80100901:	89 e5                	mov    %esp,%ebp
+80100903:	57                   	push   %edi
+80100904:	56                   	push   %esi
+80100905:	53                   	push   %ebx
+80100906:	83 ec 1c             	sub    $0x1c,%esp
+  if(c == BACKSPACE){
+80100909:	3d 00 01 00 00       	cmp    $0x100,%eax
+8010090e:	0f 84 cc 00 00 00    	je     801009e0 <consputc.part.0+0xe0>
+    uartputc(c);
+80100914:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100917:	bf d4 03 00 00       	mov    $0x3d4,%edi
+8010091c:	89 c3                	mov    %eax,%ebx
+8010091e:	50                   	push   %eax
+8010091f:	e8 1c 8b 00 00       	call   80109440 <uartputc>
+80100924:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100929:	89 fa                	mov    %edi,%edx
+8010092b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010092c:	be d5 03 00 00       	mov    $0x3d5,%esi
+80100931:	89 f2                	mov    %esi,%edx
+80100933:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+80100934:	0f b6 c8             	movzbl %al,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100937:	89 fa                	mov    %edi,%edx
+80100939:	b8 0f 00 00 00       	mov    $0xf,%eax
+8010093e:	c1 e1 08             	shl    $0x8,%ecx
+80100941:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100942:	89 f2                	mov    %esi,%edx
+80100944:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+80100945:	0f b6 c0             	movzbl %al,%eax
+  if(c == '\n')
+80100948:	83 c4 10             	add    $0x10,%esp
+  pos |= inb(CRTPORT+1);
+8010094b:	09 c8                	or     %ecx,%eax
+  if(c == '\n')
+8010094d:	83 fb 0a             	cmp    $0xa,%ebx
+80100950:	75 76                	jne    801009c8 <consputc.part.0+0xc8>
+    pos += 80 - pos%80;
+80100952:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+80100957:	f7 e2                	mul    %edx
+80100959:	c1 ea 06             	shr    $0x6,%edx
+8010095c:	8d 04 92             	lea    (%edx,%edx,4),%eax
+8010095f:	c1 e0 04             	shl    $0x4,%eax
+80100962:	8d 70 50             	lea    0x50(%eax),%esi
+  if(pos < 0 || pos > 25*80)
+80100965:	81 fe d0 07 00 00    	cmp    $0x7d0,%esi
+8010096b:	0f 8f 2f 01 00 00    	jg     80100aa0 <consputc.part.0+0x1a0>
+  if((pos/80) >= 24){  // Scroll up.
+80100971:	81 fe 7f 07 00 00    	cmp    $0x77f,%esi
+80100977:	0f 8f c3 00 00 00    	jg     80100a40 <consputc.part.0+0x140>
+  outb(CRTPORT+1, pos>>8);
+8010097d:	89 f0                	mov    %esi,%eax
+  crt[pos] = ' ' | 0x0700;
+8010097f:	8d b4 36 00 80 0b 80 	lea    -0x7ff48000(%esi,%esi,1),%esi
+  outb(CRTPORT+1, pos);
+80100986:	88 45 e7             	mov    %al,-0x19(%ebp)
+  outb(CRTPORT+1, pos>>8);
+80100989:	0f b6 fc             	movzbl %ah,%edi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010098c:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+80100991:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100996:	89 da                	mov    %ebx,%edx
+80100998:	ee                   	out    %al,(%dx)
+80100999:	b9 d5 03 00 00       	mov    $0x3d5,%ecx
+8010099e:	89 f8                	mov    %edi,%eax
+801009a0:	89 ca                	mov    %ecx,%edx
+801009a2:	ee                   	out    %al,(%dx)
+801009a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+801009a8:	89 da                	mov    %ebx,%edx
+801009aa:	ee                   	out    %al,(%dx)
+801009ab:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+801009af:	89 ca                	mov    %ecx,%edx
+801009b1:	ee                   	out    %al,(%dx)
+  crt[pos] = ' ' | 0x0700;
+801009b2:	b8 20 07 00 00       	mov    $0x720,%eax
+801009b7:	66 89 06             	mov    %ax,(%esi)
+}
+801009ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801009bd:	5b                   	pop    %ebx
+801009be:	5e                   	pop    %esi
+801009bf:	5f                   	pop    %edi
+801009c0:	5d                   	pop    %ebp
+801009c1:	c3                   	ret
+801009c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    crt[pos++] = (c&0xff) | 0x0700;  // black on white
+801009c8:	0f b6 db             	movzbl %bl,%ebx
+801009cb:	8d 70 01             	lea    0x1(%eax),%esi
+801009ce:	80 cf 07             	or     $0x7,%bh
+801009d1:	66 89 9c 00 00 80 0b 	mov    %bx,-0x7ff48000(%eax,%eax,1)
+801009d8:	80 
+801009d9:	eb 8a                	jmp    80100965 <consputc.part.0+0x65>
+801009db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801009df:	90                   	nop
+    uartputc('\b'); uartputc(' '); uartputc('\b');
+801009e0:	83 ec 0c             	sub    $0xc,%esp
+801009e3:	be d4 03 00 00       	mov    $0x3d4,%esi
+801009e8:	6a 08                	push   $0x8
+801009ea:	e8 51 8a 00 00       	call   80109440 <uartputc>
+801009ef:	c7 04 24 20 00 00 00 	movl   $0x20,(%esp)
+801009f6:	e8 45 8a 00 00       	call   80109440 <uartputc>
+801009fb:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+80100a02:	e8 39 8a 00 00       	call   80109440 <uartputc>
+80100a07:	b8 0e 00 00 00       	mov    $0xe,%eax
+80100a0c:	89 f2                	mov    %esi,%edx
+80100a0e:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100a0f:	bb d5 03 00 00       	mov    $0x3d5,%ebx
+80100a14:	89 da                	mov    %ebx,%edx
+80100a16:	ec                   	in     (%dx),%al
+  pos = inb(CRTPORT+1) << 8;
+80100a17:	0f b6 c8             	movzbl %al,%ecx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80100a1a:	89 f2                	mov    %esi,%edx
+80100a1c:	b8 0f 00 00 00       	mov    $0xf,%eax
+80100a21:	c1 e1 08             	shl    $0x8,%ecx
+80100a24:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80100a25:	89 da                	mov    %ebx,%edx
+80100a27:	ec                   	in     (%dx),%al
+  pos |= inb(CRTPORT+1);
+80100a28:	0f b6 f0             	movzbl %al,%esi
+    if(pos > 0) --pos;
+80100a2b:	83 c4 10             	add    $0x10,%esp
+80100a2e:	09 ce                	or     %ecx,%esi
+80100a30:	74 5e                	je     80100a90 <consputc.part.0+0x190>
+80100a32:	83 ee 01             	sub    $0x1,%esi
+80100a35:	e9 2b ff ff ff       	jmp    80100965 <consputc.part.0+0x65>
+80100a3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+80100a40:	83 ec 04             	sub    $0x4,%esp
+    pos -= 80;
+80100a43:	8d 5e b0             	lea    -0x50(%esi),%ebx
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+80100a46:	8d b4 36 60 7f 0b 80 	lea    -0x7ff480a0(%esi,%esi,1),%esi
+  outb(CRTPORT+1, pos);
+80100a4d:	bf 07 00 00 00       	mov    $0x7,%edi
+    memmove(crt, crt+80, sizeof(crt[0])*23*80);
+80100a52:	68 60 0e 00 00       	push   $0xe60
+80100a57:	68 a0 80 0b 80       	push   $0x800b80a0
+80100a5c:	68 00 80 0b 80       	push   $0x800b8000
+80100a61:	e8 5a 6c 00 00       	call   801076c0 <memmove>
+    memset(crt+pos, 0, sizeof(crt[0])*(24*80 - pos));
+80100a66:	b8 80 07 00 00       	mov    $0x780,%eax
+80100a6b:	83 c4 0c             	add    $0xc,%esp
+80100a6e:	29 d8                	sub    %ebx,%eax
+80100a70:	01 c0                	add    %eax,%eax
+80100a72:	50                   	push   %eax
+80100a73:	6a 00                	push   $0x0
+80100a75:	56                   	push   %esi
+80100a76:	e8 b5 6b 00 00       	call   80107630 <memset>
+  outb(CRTPORT+1, pos);
+80100a7b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+80100a7e:	83 c4 10             	add    $0x10,%esp
+80100a81:	e9 06 ff ff ff       	jmp    8010098c <consputc.part.0+0x8c>
+80100a86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100a8d:	8d 76 00             	lea    0x0(%esi),%esi
+80100a90:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+80100a94:	be 00 80 0b 80       	mov    $0x800b8000,%esi
+80100a99:	31 ff                	xor    %edi,%edi
+80100a9b:	e9 ec fe ff ff       	jmp    8010098c <consputc.part.0+0x8c>
+    panic("pos under/overflow");
+80100aa0:	83 ec 0c             	sub    $0xc,%esp
+80100aa3:	68 7b af 10 80       	push   $0x8010af7b
+80100aa8:	e8 d3 fd ff ff       	call   80100880 <panic>
+80100aad:	8d 76 00             	lea    0x0(%esi),%esi
+
+80100ab0 <consolewrite>:
+
+int
+consolewrite(struct inode *ip, char *buf, int n)
+{
+80100ab0:	55                   	push   %ebp
+80100ab1:	89 e5                	mov    %esp,%ebp
+80100ab3:	57                   	push   %edi
+80100ab4:	56                   	push   %esi
+80100ab5:	53                   	push   %ebx
+80100ab6:	83 ec 18             	sub    $0x18,%esp
+80100ab9:	8b 75 10             	mov    0x10(%ebp),%esi
+  int i;
+
+  iunlock(ip);
+80100abc:	ff 75 08             	push   0x8(%ebp)
+80100abf:	e8 7c 1e 00 00       	call   80102940 <iunlock>
+  acquire(&cons.lock);
+80100ac4:	c7 04 24 60 51 8e 80 	movl   $0x808e5160,(%esp)
+80100acb:	e8 80 6a 00 00       	call   80107550 <acquire>
+  for(i = 0; i < n; i++)
+80100ad0:	83 c4 10             	add    $0x10,%esp
+80100ad3:	85 f6                	test   %esi,%esi
+80100ad5:	7e 25                	jle    80100afc <consolewrite+0x4c>
+80100ad7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+80100ada:	8d 3c 33             	lea    (%ebx,%esi,1),%edi
+  if(panicked){
+80100add:	8b 15 98 51 8e 80    	mov    0x808e5198,%edx
+    consputc(buf[i] & 0xff);
+80100ae3:	0f b6 03             	movzbl (%ebx),%eax
+  if(panicked){
+80100ae6:	85 d2                	test   %edx,%edx
+80100ae8:	74 06                	je     80100af0 <consolewrite+0x40>
+  asm volatile("cli");
+80100aea:	fa                   	cli
+    for(;;)
+80100aeb:	eb fe                	jmp    80100aeb <consolewrite+0x3b>
+80100aed:	8d 76 00             	lea    0x0(%esi),%esi
+80100af0:	e8 0b fe ff ff       	call   80100900 <consputc.part.0>
+  for(i = 0; i < n; i++)
+80100af5:	83 c3 01             	add    $0x1,%ebx
+80100af8:	39 df                	cmp    %ebx,%edi
+80100afa:	75 e1                	jne    80100add <consolewrite+0x2d>
+  release(&cons.lock);
+80100afc:	83 ec 0c             	sub    $0xc,%esp
+80100aff:	68 60 51 8e 80       	push   $0x808e5160
+80100b04:	e8 e7 69 00 00       	call   801074f0 <release>
+  ilock(ip);
+80100b09:	58                   	pop    %eax
+80100b0a:	ff 75 08             	push   0x8(%ebp)
+80100b0d:	e8 4e 1d 00 00       	call   80102860 <ilock>
+
+  return n;
+}
+80100b12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100b15:	89 f0                	mov    %esi,%eax
+80100b17:	5b                   	pop    %ebx
+80100b18:	5e                   	pop    %esi
+80100b19:	5f                   	pop    %edi
+80100b1a:	5d                   	pop    %ebp
+80100b1b:	c3                   	ret
+80100b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80100b20 <printint>:
+{
+80100b20:	55                   	push   %ebp
+80100b21:	89 e5                	mov    %esp,%ebp
+80100b23:	57                   	push   %edi
+80100b24:	56                   	push   %esi
+80100b25:	89 c6                	mov    %eax,%esi
+80100b27:	53                   	push   %ebx
+80100b28:	89 d3                	mov    %edx,%ebx
+80100b2a:	83 ec 2c             	sub    $0x2c,%esp
+  if(sign && (sign = xx < 0))
+80100b2d:	85 c9                	test   %ecx,%ecx
+80100b2f:	74 04                	je     80100b35 <printint+0x15>
+80100b31:	85 c0                	test   %eax,%eax
+80100b33:	78 63                	js     80100b98 <printint+0x78>
+    x = xx;
+80100b35:	89 f1                	mov    %esi,%ecx
+80100b37:	31 c0                	xor    %eax,%eax
+  i = 0;
+80100b39:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+80100b3c:	31 f6                	xor    %esi,%esi
+80100b3e:	66 90                	xchg   %ax,%ax
+    buf[i++] = digits[x % base];
+80100b40:	89 c8                	mov    %ecx,%eax
+80100b42:	31 d2                	xor    %edx,%edx
+80100b44:	89 f7                	mov    %esi,%edi
+80100b46:	f7 f3                	div    %ebx
+80100b48:	8d 76 01             	lea    0x1(%esi),%esi
+80100b4b:	0f b6 92 c8 af 10 80 	movzbl -0x7fef5038(%edx),%edx
+80100b52:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+80100b56:	89 ca                	mov    %ecx,%edx
+80100b58:	89 c1                	mov    %eax,%ecx
+80100b5a:	39 da                	cmp    %ebx,%edx
+80100b5c:	73 e2                	jae    80100b40 <printint+0x20>
+  if(sign)
+80100b5e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80100b61:	85 c0                	test   %eax,%eax
+80100b63:	74 07                	je     80100b6c <printint+0x4c>
+    buf[i++] = '-';
+80100b65:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+80100b6a:	89 f7                	mov    %esi,%edi
+80100b6c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+80100b6f:	01 df                	add    %ebx,%edi
+  if(panicked){
+80100b71:	8b 15 98 51 8e 80    	mov    0x808e5198,%edx
+    consputc(buf[i]);
+80100b77:	0f be 07             	movsbl (%edi),%eax
+  if(panicked){
+80100b7a:	85 d2                	test   %edx,%edx
+80100b7c:	74 0a                	je     80100b88 <printint+0x68>
+80100b7e:	fa                   	cli
+    for(;;)
+80100b7f:	eb fe                	jmp    80100b7f <printint+0x5f>
+80100b81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100b88:	e8 73 fd ff ff       	call   80100900 <consputc.part.0>
+  while(--i >= 0)
+80100b8d:	8d 47 ff             	lea    -0x1(%edi),%eax
+80100b90:	39 df                	cmp    %ebx,%edi
+80100b92:	74 0c                	je     80100ba0 <printint+0x80>
+80100b94:	89 c7                	mov    %eax,%edi
+80100b96:	eb d9                	jmp    80100b71 <printint+0x51>
+80100b98:	89 c8                	mov    %ecx,%eax
+    x = -xx;
+80100b9a:	89 f1                	mov    %esi,%ecx
+80100b9c:	f7 d9                	neg    %ecx
+80100b9e:	eb 99                	jmp    80100b39 <printint+0x19>
+}
+80100ba0:	83 c4 2c             	add    $0x2c,%esp
+80100ba3:	5b                   	pop    %ebx
+80100ba4:	5e                   	pop    %esi
+80100ba5:	5f                   	pop    %edi
+80100ba6:	5d                   	pop    %ebp
+80100ba7:	c3                   	ret
+80100ba8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80100baf:	90                   	nop
+
+80100bb0 <cprintf>:
+{
+80100bb0:	55                   	push   %ebp
+80100bb1:	89 e5                	mov    %esp,%ebp
+80100bb3:	57                   	push   %edi
+80100bb4:	56                   	push   %esi
+80100bb5:	53                   	push   %ebx
+80100bb6:	83 ec 1c             	sub    $0x1c,%esp
+  locking = cons.locking;
+80100bb9:	8b 3d 94 51 8e 80    	mov    0x808e5194,%edi
+  if (fmt == 0)
+80100bbf:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(locking)
+80100bc2:	85 ff                	test   %edi,%edi
+80100bc4:	0f 85 36 01 00 00    	jne    80100d00 <cprintf+0x150>
+  if (fmt == 0)
+80100bca:	85 f6                	test   %esi,%esi
+80100bcc:	0f 84 e0 01 00 00    	je     80100db2 <cprintf+0x202>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100bd2:	0f b6 06             	movzbl (%esi),%eax
+80100bd5:	85 c0                	test   %eax,%eax
+80100bd7:	74 6b                	je     80100c44 <cprintf+0x94>
+  argp = (uint*)(void*)(&fmt + 1);
+80100bd9:	8d 55 0c             	lea    0xc(%ebp),%edx
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100bdc:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80100bdf:	31 db                	xor    %ebx,%ebx
+80100be1:	89 d7                	mov    %edx,%edi
+    if(c != '%'){
+80100be3:	83 f8 25             	cmp    $0x25,%eax
+80100be6:	0f 85 dc 00 00 00    	jne    80100cc8 <cprintf+0x118>
+    c = fmt[++i] & 0xff;
+80100bec:	83 c3 01             	add    $0x1,%ebx
+80100bef:	0f b6 0c 1e          	movzbl (%esi,%ebx,1),%ecx
+    if(c == 0)
+80100bf3:	85 c9                	test   %ecx,%ecx
+80100bf5:	74 42                	je     80100c39 <cprintf+0x89>
+    switch(c){
+80100bf7:	83 f9 70             	cmp    $0x70,%ecx
+80100bfa:	0f 84 99 00 00 00    	je     80100c99 <cprintf+0xe9>
+80100c00:	7f 4e                	jg     80100c50 <cprintf+0xa0>
+80100c02:	83 f9 25             	cmp    $0x25,%ecx
+80100c05:	0f 84 cd 00 00 00    	je     80100cd8 <cprintf+0x128>
+80100c0b:	83 f9 64             	cmp    $0x64,%ecx
+80100c0e:	0f 85 24 01 00 00    	jne    80100d38 <cprintf+0x188>
+      printint(*argp++, 10, 1);
+80100c14:	8d 47 04             	lea    0x4(%edi),%eax
+80100c17:	b9 01 00 00 00       	mov    $0x1,%ecx
+80100c1c:	ba 0a 00 00 00       	mov    $0xa,%edx
+80100c21:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80100c24:	8b 07                	mov    (%edi),%eax
+80100c26:	e8 f5 fe ff ff       	call   80100b20 <printint>
+80100c2b:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100c2e:	83 c3 01             	add    $0x1,%ebx
+80100c31:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+80100c35:	85 c0                	test   %eax,%eax
+80100c37:	75 aa                	jne    80100be3 <cprintf+0x33>
+80100c39:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  if(locking)
+80100c3c:	85 ff                	test   %edi,%edi
+80100c3e:	0f 85 df 00 00 00    	jne    80100d23 <cprintf+0x173>
+}
+80100c44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100c47:	5b                   	pop    %ebx
+80100c48:	5e                   	pop    %esi
+80100c49:	5f                   	pop    %edi
+80100c4a:	5d                   	pop    %ebp
+80100c4b:	c3                   	ret
+80100c4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+80100c50:	83 f9 73             	cmp    $0x73,%ecx
+80100c53:	75 3b                	jne    80100c90 <cprintf+0xe0>
+      if((s = (char*)*argp++) == 0)
+80100c55:	8b 17                	mov    (%edi),%edx
+80100c57:	8d 47 04             	lea    0x4(%edi),%eax
+80100c5a:	85 d2                	test   %edx,%edx
+80100c5c:	0f 85 0e 01 00 00    	jne    80100d70 <cprintf+0x1c0>
+80100c62:	b9 28 00 00 00       	mov    $0x28,%ecx
+        s = "(null)";
+80100c67:	bf 8e af 10 80       	mov    $0x8010af8e,%edi
+80100c6c:	89 5d e0             	mov    %ebx,-0x20(%ebp)
+80100c6f:	89 fb                	mov    %edi,%ebx
+80100c71:	89 f7                	mov    %esi,%edi
+80100c73:	89 c6                	mov    %eax,%esi
+80100c75:	0f be c1             	movsbl %cl,%eax
+  if(panicked){
+80100c78:	8b 15 98 51 8e 80    	mov    0x808e5198,%edx
+80100c7e:	85 d2                	test   %edx,%edx
+80100c80:	0f 84 fe 00 00 00    	je     80100d84 <cprintf+0x1d4>
+80100c86:	fa                   	cli
+    for(;;)
+80100c87:	eb fe                	jmp    80100c87 <cprintf+0xd7>
+80100c89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    switch(c){
+80100c90:	83 f9 78             	cmp    $0x78,%ecx
+80100c93:	0f 85 9f 00 00 00    	jne    80100d38 <cprintf+0x188>
+      printint(*argp++, 16, 0);
+80100c99:	8d 47 04             	lea    0x4(%edi),%eax
+80100c9c:	31 c9                	xor    %ecx,%ecx
+80100c9e:	ba 10 00 00 00       	mov    $0x10,%edx
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100ca3:	83 c3 01             	add    $0x1,%ebx
+      printint(*argp++, 16, 0);
+80100ca6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80100ca9:	8b 07                	mov    (%edi),%eax
+80100cab:	e8 70 fe ff ff       	call   80100b20 <printint>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100cb0:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+      printint(*argp++, 16, 0);
+80100cb4:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100cb7:	85 c0                	test   %eax,%eax
+80100cb9:	0f 85 24 ff ff ff    	jne    80100be3 <cprintf+0x33>
+80100cbf:	e9 75 ff ff ff       	jmp    80100c39 <cprintf+0x89>
+80100cc4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(panicked){
+80100cc8:	8b 0d 98 51 8e 80    	mov    0x808e5198,%ecx
+80100cce:	85 c9                	test   %ecx,%ecx
+80100cd0:	74 15                	je     80100ce7 <cprintf+0x137>
+80100cd2:	fa                   	cli
+    for(;;)
+80100cd3:	eb fe                	jmp    80100cd3 <cprintf+0x123>
+80100cd5:	8d 76 00             	lea    0x0(%esi),%esi
+  if(panicked){
+80100cd8:	8b 0d 98 51 8e 80    	mov    0x808e5198,%ecx
+80100cde:	85 c9                	test   %ecx,%ecx
+80100ce0:	75 7e                	jne    80100d60 <cprintf+0x1b0>
+80100ce2:	b8 25 00 00 00       	mov    $0x25,%eax
+80100ce7:	e8 14 fc ff ff       	call   80100900 <consputc.part.0>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100cec:	83 c3 01             	add    $0x1,%ebx
+80100cef:	0f b6 04 1e          	movzbl (%esi,%ebx,1),%eax
+80100cf3:	85 c0                	test   %eax,%eax
+80100cf5:	0f 85 e8 fe ff ff    	jne    80100be3 <cprintf+0x33>
+80100cfb:	e9 39 ff ff ff       	jmp    80100c39 <cprintf+0x89>
+    acquire(&cons.lock);
+80100d00:	83 ec 0c             	sub    $0xc,%esp
+80100d03:	68 60 51 8e 80       	push   $0x808e5160
+80100d08:	e8 43 68 00 00       	call   80107550 <acquire>
+  if (fmt == 0)
+80100d0d:	83 c4 10             	add    $0x10,%esp
+80100d10:	85 f6                	test   %esi,%esi
+80100d12:	0f 84 9a 00 00 00    	je     80100db2 <cprintf+0x202>
+  for(i = 0; (c = fmt[i] & 0xff) != 0; i++){
+80100d18:	0f b6 06             	movzbl (%esi),%eax
+80100d1b:	85 c0                	test   %eax,%eax
+80100d1d:	0f 85 b6 fe ff ff    	jne    80100bd9 <cprintf+0x29>
+    release(&cons.lock);
+80100d23:	83 ec 0c             	sub    $0xc,%esp
+80100d26:	68 60 51 8e 80       	push   $0x808e5160
+80100d2b:	e8 c0 67 00 00       	call   801074f0 <release>
+80100d30:	83 c4 10             	add    $0x10,%esp
+80100d33:	e9 0c ff ff ff       	jmp    80100c44 <cprintf+0x94>
+  if(panicked){
+80100d38:	8b 15 98 51 8e 80    	mov    0x808e5198,%edx
+80100d3e:	85 d2                	test   %edx,%edx
+80100d40:	75 26                	jne    80100d68 <cprintf+0x1b8>
+80100d42:	b8 25 00 00 00       	mov    $0x25,%eax
+80100d47:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+80100d4a:	e8 b1 fb ff ff       	call   80100900 <consputc.part.0>
+80100d4f:	a1 98 51 8e 80       	mov    0x808e5198,%eax
+80100d54:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+80100d57:	85 c0                	test   %eax,%eax
+80100d59:	74 4b                	je     80100da6 <cprintf+0x1f6>
+80100d5b:	fa                   	cli
+    for(;;)
+80100d5c:	eb fe                	jmp    80100d5c <cprintf+0x1ac>
+80100d5e:	66 90                	xchg   %ax,%ax
+80100d60:	fa                   	cli
+80100d61:	eb fe                	jmp    80100d61 <cprintf+0x1b1>
+80100d63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100d67:	90                   	nop
+80100d68:	fa                   	cli
+80100d69:	eb fe                	jmp    80100d69 <cprintf+0x1b9>
+80100d6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100d6f:	90                   	nop
+      for(; *s; s++)
+80100d70:	0f b6 0a             	movzbl (%edx),%ecx
+      if((s = (char*)*argp++) == 0)
+80100d73:	89 d7                	mov    %edx,%edi
+      for(; *s; s++)
+80100d75:	84 c9                	test   %cl,%cl
+80100d77:	0f 85 ef fe ff ff    	jne    80100c6c <cprintf+0xbc>
+      if((s = (char*)*argp++) == 0)
+80100d7d:	89 c7                	mov    %eax,%edi
+80100d7f:	e9 aa fe ff ff       	jmp    80100c2e <cprintf+0x7e>
+80100d84:	e8 77 fb ff ff       	call   80100900 <consputc.part.0>
+      for(; *s; s++)
+80100d89:	0f be 43 01          	movsbl 0x1(%ebx),%eax
+80100d8d:	83 c3 01             	add    $0x1,%ebx
+80100d90:	84 c0                	test   %al,%al
+80100d92:	0f 85 e0 fe ff ff    	jne    80100c78 <cprintf+0xc8>
+      if((s = (char*)*argp++) == 0)
+80100d98:	89 f0                	mov    %esi,%eax
+80100d9a:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80100d9d:	89 fe                	mov    %edi,%esi
+80100d9f:	89 c7                	mov    %eax,%edi
+80100da1:	e9 88 fe ff ff       	jmp    80100c2e <cprintf+0x7e>
+80100da6:	89 c8                	mov    %ecx,%eax
+80100da8:	e8 53 fb ff ff       	call   80100900 <consputc.part.0>
+80100dad:	e9 7c fe ff ff       	jmp    80100c2e <cprintf+0x7e>
+    panic("null fmt");
+80100db2:	83 ec 0c             	sub    $0xc,%esp
+80100db5:	68 95 af 10 80       	push   $0x8010af95
+80100dba:	e8 c1 fa ff ff       	call   80100880 <panic>
+80100dbf:	90                   	nop
+
+80100dc0 <consoleintr>:
+{
+80100dc0:	55                   	push   %ebp
+80100dc1:	89 e5                	mov    %esp,%ebp
+80100dc3:	57                   	push   %edi
+80100dc4:	56                   	push   %esi
+  int c, doprocdump = 0;
+80100dc5:	31 f6                	xor    %esi,%esi
+{
+80100dc7:	53                   	push   %ebx
+80100dc8:	83 ec 18             	sub    $0x18,%esp
+80100dcb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  acquire(&cons.lock);
+80100dce:	68 60 51 8e 80       	push   $0x808e5160
+80100dd3:	e8 78 67 00 00       	call   80107550 <acquire>
+  while((c = getc()) >= 0){
+80100dd8:	83 c4 10             	add    $0x10,%esp
+80100ddb:	eb 1a                	jmp    80100df7 <consoleintr+0x37>
+80100ddd:	8d 76 00             	lea    0x0(%esi),%esi
+    switch(c){
+80100de0:	83 fb 08             	cmp    $0x8,%ebx
+80100de3:	0f 84 d7 00 00 00    	je     80100ec0 <consoleintr+0x100>
+80100de9:	83 fb 10             	cmp    $0x10,%ebx
+80100dec:	0f 85 3d 01 00 00    	jne    80100f2f <consoleintr+0x16f>
+80100df2:	be 01 00 00 00       	mov    $0x1,%esi
+  while((c = getc()) >= 0){
+80100df7:	ff d7                	call   *%edi
+80100df9:	89 c3                	mov    %eax,%ebx
+80100dfb:	85 c0                	test   %eax,%eax
+80100dfd:	0f 88 e5 00 00 00    	js     80100ee8 <consoleintr+0x128>
+    switch(c){
+80100e03:	83 fb 15             	cmp    $0x15,%ebx
+80100e06:	74 7a                	je     80100e82 <consoleintr+0xc2>
+80100e08:	7e d6                	jle    80100de0 <consoleintr+0x20>
+80100e0a:	83 fb 7f             	cmp    $0x7f,%ebx
+80100e0d:	0f 84 ad 00 00 00    	je     80100ec0 <consoleintr+0x100>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+80100e13:	a1 48 51 8e 80       	mov    0x808e5148,%eax
+80100e18:	89 c2                	mov    %eax,%edx
+80100e1a:	2b 15 40 51 8e 80    	sub    0x808e5140,%edx
+80100e20:	83 fa 7f             	cmp    $0x7f,%edx
+80100e23:	77 d2                	ja     80100df7 <consoleintr+0x37>
+  if(panicked){
+80100e25:	8b 15 98 51 8e 80    	mov    0x808e5198,%edx
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100e2b:	8d 48 01             	lea    0x1(%eax),%ecx
+80100e2e:	83 e0 7f             	and    $0x7f,%eax
+80100e31:	89 0d 48 51 8e 80    	mov    %ecx,0x808e5148
+80100e37:	88 98 c0 50 8e 80    	mov    %bl,-0x7f71af40(%eax)
+  if(panicked){
+80100e3d:	85 d2                	test   %edx,%edx
+80100e3f:	0f 85 57 01 00 00    	jne    80100f9c <consoleintr+0x1dc>
+80100e45:	89 d8                	mov    %ebx,%eax
+80100e47:	e8 b4 fa ff ff       	call   80100900 <consputc.part.0>
+        if(c == '\n' || c == C('D') || input.e == input.r+INPUT_BUF){
+80100e4c:	83 fb 0a             	cmp    $0xa,%ebx
+80100e4f:	0f 84 28 01 00 00    	je     80100f7d <consoleintr+0x1bd>
+80100e55:	83 fb 04             	cmp    $0x4,%ebx
+80100e58:	0f 84 1f 01 00 00    	je     80100f7d <consoleintr+0x1bd>
+80100e5e:	a1 40 51 8e 80       	mov    0x808e5140,%eax
+80100e63:	83 e8 80             	sub    $0xffffff80,%eax
+80100e66:	39 05 48 51 8e 80    	cmp    %eax,0x808e5148
+80100e6c:	75 89                	jne    80100df7 <consoleintr+0x37>
+80100e6e:	e9 0f 01 00 00       	jmp    80100f82 <consoleintr+0x1c2>
+80100e73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80100e77:	90                   	nop
+80100e78:	b8 00 01 00 00       	mov    $0x100,%eax
+80100e7d:	e8 7e fa ff ff       	call   80100900 <consputc.part.0>
+      while(input.e != input.w &&
+80100e82:	a1 48 51 8e 80       	mov    0x808e5148,%eax
+80100e87:	3b 05 44 51 8e 80    	cmp    0x808e5144,%eax
+80100e8d:	0f 84 64 ff ff ff    	je     80100df7 <consoleintr+0x37>
+            input.buf[(input.e-1) % INPUT_BUF] != '\n'){
+80100e93:	83 e8 01             	sub    $0x1,%eax
+80100e96:	89 c2                	mov    %eax,%edx
+80100e98:	83 e2 7f             	and    $0x7f,%edx
+      while(input.e != input.w &&
+80100e9b:	80 ba c0 50 8e 80 0a 	cmpb   $0xa,-0x7f71af40(%edx)
+80100ea2:	0f 84 4f ff ff ff    	je     80100df7 <consoleintr+0x37>
+  if(panicked){
+80100ea8:	8b 15 98 51 8e 80    	mov    0x808e5198,%edx
+        input.e--;
+80100eae:	a3 48 51 8e 80       	mov    %eax,0x808e5148
+  if(panicked){
+80100eb3:	85 d2                	test   %edx,%edx
+80100eb5:	74 c1                	je     80100e78 <consoleintr+0xb8>
+80100eb7:	fa                   	cli
+    for(;;)
+80100eb8:	eb fe                	jmp    80100eb8 <consoleintr+0xf8>
+80100eba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(input.e != input.w){
+80100ec0:	a1 48 51 8e 80       	mov    0x808e5148,%eax
+80100ec5:	3b 05 44 51 8e 80    	cmp    0x808e5144,%eax
+80100ecb:	0f 84 26 ff ff ff    	je     80100df7 <consoleintr+0x37>
+        input.e--;
+80100ed1:	83 e8 01             	sub    $0x1,%eax
+80100ed4:	a3 48 51 8e 80       	mov    %eax,0x808e5148
+  if(panicked){
+80100ed9:	a1 98 51 8e 80       	mov    0x808e5198,%eax
+80100ede:	85 c0                	test   %eax,%eax
+80100ee0:	74 22                	je     80100f04 <consoleintr+0x144>
+80100ee2:	fa                   	cli
+    for(;;)
+80100ee3:	eb fe                	jmp    80100ee3 <consoleintr+0x123>
+80100ee5:	8d 76 00             	lea    0x0(%esi),%esi
+  release(&cons.lock);
+80100ee8:	83 ec 0c             	sub    $0xc,%esp
+80100eeb:	68 60 51 8e 80       	push   $0x808e5160
+80100ef0:	e8 fb 65 00 00       	call   801074f0 <release>
+  if(doprocdump){
+80100ef5:	83 c4 10             	add    $0x10,%esp
+80100ef8:	85 f6                	test   %esi,%esi
+80100efa:	75 17                	jne    80100f13 <consoleintr+0x153>
+}
+80100efc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100eff:	5b                   	pop    %ebx
+80100f00:	5e                   	pop    %esi
+80100f01:	5f                   	pop    %edi
+80100f02:	5d                   	pop    %ebp
+80100f03:	c3                   	ret
+80100f04:	b8 00 01 00 00       	mov    $0x100,%eax
+80100f09:	e8 f2 f9 ff ff       	call   80100900 <consputc.part.0>
+80100f0e:	e9 e4 fe ff ff       	jmp    80100df7 <consoleintr+0x37>
+    cprintf("PID STATE NAME  prio=E(base=B)\n");
+80100f13:	83 ec 0c             	sub    $0xc,%esp
+80100f16:	68 a8 af 10 80       	push   $0x8010afa8
+80100f1b:	e8 90 fc ff ff       	call   80100bb0 <cprintf>
+    procdump();  // now call procdump() w/o cons.lock held
+80100f20:	83 c4 10             	add    $0x10,%esp
+}
+80100f23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80100f26:	5b                   	pop    %ebx
+80100f27:	5e                   	pop    %esi
+80100f28:	5f                   	pop    %edi
+80100f29:	5d                   	pop    %ebp
+    procdump();  // now call procdump() w/o cons.lock held
+80100f2a:	e9 f1 5e 00 00       	jmp    80106e20 <procdump>
+      if(c != 0 && input.e-input.r < INPUT_BUF){
+80100f2f:	85 db                	test   %ebx,%ebx
+80100f31:	0f 84 c0 fe ff ff    	je     80100df7 <consoleintr+0x37>
+80100f37:	a1 48 51 8e 80       	mov    0x808e5148,%eax
+80100f3c:	89 c2                	mov    %eax,%edx
+80100f3e:	2b 15 40 51 8e 80    	sub    0x808e5140,%edx
+80100f44:	83 fa 7f             	cmp    $0x7f,%edx
+80100f47:	0f 87 aa fe ff ff    	ja     80100df7 <consoleintr+0x37>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100f4d:	8d 48 01             	lea    0x1(%eax),%ecx
+  if(panicked){
+80100f50:	8b 15 98 51 8e 80    	mov    0x808e5198,%edx
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100f56:	83 e0 7f             	and    $0x7f,%eax
+        c = (c == '\r') ? '\n' : c;
+80100f59:	83 fb 0d             	cmp    $0xd,%ebx
+80100f5c:	0f 85 cf fe ff ff    	jne    80100e31 <consoleintr+0x71>
+        input.buf[input.e++ % INPUT_BUF] = c;
+80100f62:	89 0d 48 51 8e 80    	mov    %ecx,0x808e5148
+80100f68:	c6 80 c0 50 8e 80 0a 	movb   $0xa,-0x7f71af40(%eax)
+  if(panicked){
+80100f6f:	85 d2                	test   %edx,%edx
+80100f71:	75 29                	jne    80100f9c <consoleintr+0x1dc>
+80100f73:	b8 0a 00 00 00       	mov    $0xa,%eax
+80100f78:	e8 83 f9 ff ff       	call   80100900 <consputc.part.0>
+          input.w = input.e;
+80100f7d:	a1 48 51 8e 80       	mov    0x808e5148,%eax
+          wakeup(&input.r);
+80100f82:	83 ec 0c             	sub    $0xc,%esp
+          input.w = input.e;
+80100f85:	a3 44 51 8e 80       	mov    %eax,0x808e5144
+          wakeup(&input.r);
+80100f8a:	68 40 51 8e 80       	push   $0x808e5140
+80100f8f:	e8 8c 5d 00 00       	call   80106d20 <wakeup>
+80100f94:	83 c4 10             	add    $0x10,%esp
+80100f97:	e9 5b fe ff ff       	jmp    80100df7 <consoleintr+0x37>
+80100f9c:	fa                   	cli
+    for(;;)
+80100f9d:	eb fe                	jmp    80100f9d <consoleintr+0x1dd>
+80100f9f:	90                   	nop
+
+80100fa0 <consoleinit>:
+
+void
+consoleinit(void)
+{
+80100fa0:	55                   	push   %ebp
+80100fa1:	89 e5                	mov    %esp,%ebp
+80100fa3:	83 ec 10             	sub    $0x10,%esp
+  initlock(&cons.lock, "console");
+80100fa6:	68 9e af 10 80       	push   $0x8010af9e
+80100fab:	68 60 51 8e 80       	push   $0x808e5160
+80100fb0:	e8 bb 63 00 00       	call   80107370 <initlock>
+
+  devsw[CONSOLE].write = consolewrite;
+80100fb5:	c7 05 0c 60 8e 80 b0 	movl   $0x80100ab0,0x808e600c
+80100fbc:	0a 10 80 
+  devsw[CONSOLE].read = consoleread;
+80100fbf:	c7 05 08 60 8e 80 80 	movl   $0x80100780,0x808e6008
+80100fc6:	07 10 80 
+  cons.locking = 1;
+80100fc9:	c7 05 94 51 8e 80 01 	movl   $0x1,0x808e5194
+80100fd0:	00 00 00 
+
+  ioapicenable(IRQ_KBD, 0);
+80100fd3:	58                   	pop    %eax
+80100fd4:	5a                   	pop    %edx
+80100fd5:	6a 00                	push   $0x0
+80100fd7:	6a 01                	push   $0x1
+80100fd9:	e8 02 27 00 00       	call   801036e0 <ioapicenable>
+}
+80100fde:	83 c4 10             	add    $0x10,%esp
+80100fe1:	c9                   	leave
+80100fe2:	c3                   	ret
+80100fe3:	66 90                	xchg   %ax,%ax
+80100fe5:	66 90                	xchg   %ax,%ax
+80100fe7:	66 90                	xchg   %ax,%ax
+80100fe9:	66 90                	xchg   %ax,%ax
+80100feb:	66 90                	xchg   %ax,%ax
+80100fed:	66 90                	xchg   %ax,%ax
+80100fef:	90                   	nop
+
+80100ff0 <exec>:
+#include "x86.h"
+#include "elf.h"
+
+int
+exec(char *path, char **argv)
+{
+80100ff0:	55                   	push   %ebp
+80100ff1:	89 e5                	mov    %esp,%ebp
+80100ff3:	57                   	push   %edi
+80100ff4:	56                   	push   %esi
+80100ff5:	53                   	push   %ebx
+80100ff6:	81 ec 0c 01 00 00    	sub    $0x10c,%esp
+  uint argc, sz, sp, ustack[3+MAXARG+1];
+  struct elfhdr elf;
+  struct inode *ip;
+  struct proghdr ph;
+  pde_t *pgdir, *oldpgdir;
+  struct proc *curproc = myproc();
+80100ffc:	e8 7f 4d 00 00       	call   80105d80 <myproc>
+80101001:	89 85 ec fe ff ff    	mov    %eax,-0x114(%ebp)
+
+  begin_op();
+80101007:	e8 54 37 00 00       	call   80104760 <begin_op>
+
+  if((ip = namei(path)) == 0){
+8010100c:	83 ec 0c             	sub    $0xc,%esp
+8010100f:	ff 75 08             	push   0x8(%ebp)
+80101012:	e8 e9 25 00 00       	call   80103600 <namei>
+80101017:	83 c4 10             	add    $0x10,%esp
+8010101a:	85 c0                	test   %eax,%eax
+8010101c:	0f 84 33 03 00 00    	je     80101355 <exec+0x365>
+    end_op();
+    cprintf("exec: fail\n");
+    return -1;
+  }
+  ilock(ip);
+80101022:	83 ec 0c             	sub    $0xc,%esp
+80101025:	89 c7                	mov    %eax,%edi
+80101027:	50                   	push   %eax
+80101028:	e8 33 18 00 00       	call   80102860 <ilock>
+  pgdir = 0;
+
+  // Check ELF header
+  if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
+8010102d:	8d 85 24 ff ff ff    	lea    -0xdc(%ebp),%eax
+80101033:	6a 34                	push   $0x34
+80101035:	6a 00                	push   $0x0
+80101037:	50                   	push   %eax
+80101038:	57                   	push   %edi
+80101039:	e8 92 1b 00 00       	call   80102bd0 <readi>
+8010103e:	83 c4 20             	add    $0x20,%esp
+80101041:	83 f8 34             	cmp    $0x34,%eax
+80101044:	0f 85 01 01 00 00    	jne    8010114b <exec+0x15b>
+    goto bad;
+  if(elf.magic != ELF_MAGIC)
+8010104a:	81 bd 24 ff ff ff 7f 	cmpl   $0x464c457f,-0xdc(%ebp)
+80101051:	45 4c 46 
+80101054:	0f 85 f1 00 00 00    	jne    8010114b <exec+0x15b>
+    goto bad;
+
+  if((pgdir = setupkvm()) == 0)
+8010105a:	e8 51 95 00 00       	call   8010a5b0 <setupkvm>
+8010105f:	89 85 f4 fe ff ff    	mov    %eax,-0x10c(%ebp)
+80101065:	85 c0                	test   %eax,%eax
+80101067:	0f 84 de 00 00 00    	je     8010114b <exec+0x15b>
+    goto bad;
+
+  // Load program into memory.
+  sz = 0;
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+8010106d:	66 83 bd 50 ff ff ff 	cmpw   $0x0,-0xb0(%ebp)
+80101074:	00 
+80101075:	8b b5 40 ff ff ff    	mov    -0xc0(%ebp),%esi
+8010107b:	0f 84 a4 02 00 00    	je     80101325 <exec+0x335>
+  sz = 0;
+80101081:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+80101088:	00 00 00 
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+8010108b:	31 db                	xor    %ebx,%ebx
+8010108d:	e9 8c 00 00 00       	jmp    8010111e <exec+0x12e>
+80101092:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+      goto bad;
+    if(ph.type != ELF_PROG_LOAD)
+80101098:	83 bd 04 ff ff ff 01 	cmpl   $0x1,-0xfc(%ebp)
+8010109f:	75 6c                	jne    8010110d <exec+0x11d>
+      continue;
+    if(ph.memsz < ph.filesz)
+801010a1:	8b 85 18 ff ff ff    	mov    -0xe8(%ebp),%eax
+801010a7:	3b 85 14 ff ff ff    	cmp    -0xec(%ebp),%eax
+801010ad:	0f 82 87 00 00 00    	jb     8010113a <exec+0x14a>
+      goto bad;
+    if(ph.vaddr + ph.memsz < ph.vaddr)
+801010b3:	03 85 0c ff ff ff    	add    -0xf4(%ebp),%eax
+801010b9:	72 7f                	jb     8010113a <exec+0x14a>
+      goto bad;
+    if((sz = allocuvm(pgdir, sz, ph.vaddr + ph.memsz)) == 0)
+801010bb:	83 ec 04             	sub    $0x4,%esp
+801010be:	50                   	push   %eax
+801010bf:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+801010c5:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+801010cb:	e8 10 93 00 00       	call   8010a3e0 <allocuvm>
+801010d0:	83 c4 10             	add    $0x10,%esp
+801010d3:	89 85 f0 fe ff ff    	mov    %eax,-0x110(%ebp)
+801010d9:	85 c0                	test   %eax,%eax
+801010db:	74 5d                	je     8010113a <exec+0x14a>
+      goto bad;
+    if(ph.vaddr % PGSIZE != 0)
+801010dd:	8b 85 0c ff ff ff    	mov    -0xf4(%ebp),%eax
+801010e3:	a9 ff 0f 00 00       	test   $0xfff,%eax
+801010e8:	75 50                	jne    8010113a <exec+0x14a>
+      goto bad;
+    if(loaduvm(pgdir, (char*)ph.vaddr, ip, ph.off, ph.filesz) < 0)
+801010ea:	83 ec 0c             	sub    $0xc,%esp
+801010ed:	ff b5 14 ff ff ff    	push   -0xec(%ebp)
+801010f3:	ff b5 08 ff ff ff    	push   -0xf8(%ebp)
+801010f9:	57                   	push   %edi
+801010fa:	50                   	push   %eax
+801010fb:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80101101:	e8 0a 92 00 00       	call   8010a310 <loaduvm>
+80101106:	83 c4 20             	add    $0x20,%esp
+80101109:	85 c0                	test   %eax,%eax
+8010110b:	78 2d                	js     8010113a <exec+0x14a>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+8010110d:	0f b7 85 50 ff ff ff 	movzwl -0xb0(%ebp),%eax
+80101114:	83 c3 01             	add    $0x1,%ebx
+80101117:	83 c6 20             	add    $0x20,%esi
+8010111a:	39 d8                	cmp    %ebx,%eax
+8010111c:	7e 52                	jle    80101170 <exec+0x180>
+    if(readi(ip, (char*)&ph, off, sizeof(ph)) != sizeof(ph))
+8010111e:	8d 85 04 ff ff ff    	lea    -0xfc(%ebp),%eax
+80101124:	6a 20                	push   $0x20
+80101126:	56                   	push   %esi
+80101127:	50                   	push   %eax
+80101128:	57                   	push   %edi
+80101129:	e8 a2 1a 00 00       	call   80102bd0 <readi>
+8010112e:	83 c4 10             	add    $0x10,%esp
+80101131:	83 f8 20             	cmp    $0x20,%eax
+80101134:	0f 84 5e ff ff ff    	je     80101098 <exec+0xa8>
+  freevm(oldpgdir);
+  return 0;
+
+ bad:
+  if(pgdir)
+    freevm(pgdir);
+8010113a:	83 ec 0c             	sub    $0xc,%esp
+8010113d:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80101143:	e8 e8 93 00 00       	call   8010a530 <freevm>
+  if(ip){
+80101148:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+8010114b:	83 ec 0c             	sub    $0xc,%esp
+8010114e:	57                   	push   %edi
+8010114f:	e8 fc 19 00 00       	call   80102b50 <iunlockput>
+    end_op();
+80101154:	e8 a7 36 00 00       	call   80104800 <end_op>
+80101159:	83 c4 10             	add    $0x10,%esp
+    return -1;
+8010115c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  }
+  return -1;
+}
+80101161:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101164:	5b                   	pop    %ebx
+80101165:	5e                   	pop    %esi
+80101166:	5f                   	pop    %edi
+80101167:	5d                   	pop    %ebp
+80101168:	c3                   	ret
+80101169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  sz = PGROUNDUP(sz);
+80101170:	8b b5 f0 fe ff ff    	mov    -0x110(%ebp),%esi
+80101176:	81 c6 ff 0f 00 00    	add    $0xfff,%esi
+8010117c:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+80101182:	8d 9e 00 20 00 00    	lea    0x2000(%esi),%ebx
+  iunlockput(ip);
+80101188:	83 ec 0c             	sub    $0xc,%esp
+8010118b:	57                   	push   %edi
+8010118c:	e8 bf 19 00 00       	call   80102b50 <iunlockput>
+  end_op();
+80101191:	e8 6a 36 00 00       	call   80104800 <end_op>
+  if((sz = allocuvm(pgdir, sz, sz + 2*PGSIZE)) == 0)
+80101196:	83 c4 0c             	add    $0xc,%esp
+80101199:	53                   	push   %ebx
+8010119a:	56                   	push   %esi
+8010119b:	8b b5 f4 fe ff ff    	mov    -0x10c(%ebp),%esi
+801011a1:	56                   	push   %esi
+801011a2:	e8 39 92 00 00       	call   8010a3e0 <allocuvm>
+801011a7:	83 c4 10             	add    $0x10,%esp
+801011aa:	89 c7                	mov    %eax,%edi
+801011ac:	85 c0                	test   %eax,%eax
+801011ae:	0f 84 86 00 00 00    	je     8010123a <exec+0x24a>
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+801011b4:	83 ec 08             	sub    $0x8,%esp
+801011b7:	8d 80 00 e0 ff ff    	lea    -0x2000(%eax),%eax
+  for(argc = 0; argv[argc]; argc++) {
+801011bd:	89 fb                	mov    %edi,%ebx
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+801011bf:	50                   	push   %eax
+801011c0:	56                   	push   %esi
+  for(argc = 0; argv[argc]; argc++) {
+801011c1:	31 f6                	xor    %esi,%esi
+  clearpteu(pgdir, (char*)(sz - 2*PGSIZE));
+801011c3:	e8 88 94 00 00       	call   8010a650 <clearpteu>
+  for(argc = 0; argv[argc]; argc++) {
+801011c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+801011cb:	83 c4 10             	add    $0x10,%esp
+801011ce:	8b 10                	mov    (%eax),%edx
+801011d0:	85 d2                	test   %edx,%edx
+801011d2:	0f 84 59 01 00 00    	je     80101331 <exec+0x341>
+801011d8:	89 bd f0 fe ff ff    	mov    %edi,-0x110(%ebp)
+801011de:	8b 7d 0c             	mov    0xc(%ebp),%edi
+801011e1:	eb 23                	jmp    80101206 <exec+0x216>
+801011e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801011e7:	90                   	nop
+801011e8:	8d 46 01             	lea    0x1(%esi),%eax
+    ustack[3+argc] = sp;
+801011eb:	89 9c b5 64 ff ff ff 	mov    %ebx,-0x9c(%ebp,%esi,4)
+801011f2:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+  for(argc = 0; argv[argc]; argc++) {
+801011f8:	8b 14 87             	mov    (%edi,%eax,4),%edx
+801011fb:	85 d2                	test   %edx,%edx
+801011fd:	74 51                	je     80101250 <exec+0x260>
+    if(argc >= MAXARG)
+801011ff:	83 f8 20             	cmp    $0x20,%eax
+80101202:	74 36                	je     8010123a <exec+0x24a>
+  for(argc = 0; argv[argc]; argc++) {
+80101204:	89 c6                	mov    %eax,%esi
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+80101206:	83 ec 0c             	sub    $0xc,%esp
+80101209:	52                   	push   %edx
+8010120a:	e8 11 66 00 00       	call   80107820 <strlen>
+8010120f:	29 c3                	sub    %eax,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+80101211:	58                   	pop    %eax
+80101212:	ff 34 b7             	push   (%edi,%esi,4)
+    sp = (sp - (strlen(argv[argc]) + 1)) & ~3;
+80101215:	83 eb 01             	sub    $0x1,%ebx
+80101218:	83 e3 fc             	and    $0xfffffffc,%ebx
+    if(copyout(pgdir, sp, argv[argc], strlen(argv[argc]) + 1) < 0)
+8010121b:	e8 00 66 00 00       	call   80107820 <strlen>
+80101220:	83 c0 01             	add    $0x1,%eax
+80101223:	50                   	push   %eax
+80101224:	ff 34 b7             	push   (%edi,%esi,4)
+80101227:	53                   	push   %ebx
+80101228:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+8010122e:	e8 dd 99 00 00       	call   8010ac10 <copyout>
+80101233:	83 c4 20             	add    $0x20,%esp
+80101236:	85 c0                	test   %eax,%eax
+80101238:	79 ae                	jns    801011e8 <exec+0x1f8>
+    freevm(pgdir);
+8010123a:	83 ec 0c             	sub    $0xc,%esp
+8010123d:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+80101243:	e8 e8 92 00 00       	call   8010a530 <freevm>
+80101248:	83 c4 10             	add    $0x10,%esp
+8010124b:	e9 0c ff ff ff       	jmp    8010115c <exec+0x16c>
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+80101250:	8d 14 b5 08 00 00 00 	lea    0x8(,%esi,4),%edx
+  ustack[3+argc] = 0;
+80101257:	8b bd f0 fe ff ff    	mov    -0x110(%ebp),%edi
+8010125d:	89 85 f0 fe ff ff    	mov    %eax,-0x110(%ebp)
+80101263:	8d 46 04             	lea    0x4(%esi),%eax
+  sp -= (3+argc+1) * 4;
+80101266:	8d 72 0c             	lea    0xc(%edx),%esi
+  ustack[3+argc] = 0;
+80101269:	c7 84 85 58 ff ff ff 	movl   $0x0,-0xa8(%ebp,%eax,4)
+80101270:	00 00 00 00 
+  ustack[1] = argc;
+80101274:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  ustack[0] = 0xffffffff;  // fake return PC
+8010127a:	c7 85 58 ff ff ff ff 	movl   $0xffffffff,-0xa8(%ebp)
+80101281:	ff ff ff 
+  ustack[1] = argc;
+80101284:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+8010128a:	89 d8                	mov    %ebx,%eax
+  sp -= (3+argc+1) * 4;
+8010128c:	29 f3                	sub    %esi,%ebx
+  ustack[2] = sp - (argc+1)*4;  // argv pointer
+8010128e:	29 d0                	sub    %edx,%eax
+80101290:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+  if(copyout(pgdir, sp, ustack, (3+argc+1)*4) < 0)
+80101296:	56                   	push   %esi
+80101297:	51                   	push   %ecx
+80101298:	53                   	push   %ebx
+80101299:	ff b5 f4 fe ff ff    	push   -0x10c(%ebp)
+8010129f:	e8 6c 99 00 00       	call   8010ac10 <copyout>
+801012a4:	83 c4 10             	add    $0x10,%esp
+801012a7:	85 c0                	test   %eax,%eax
+801012a9:	78 8f                	js     8010123a <exec+0x24a>
+  for(last=s=path; *s; s++)
+801012ab:	8b 45 08             	mov    0x8(%ebp),%eax
+801012ae:	8b 55 08             	mov    0x8(%ebp),%edx
+801012b1:	0f b6 00             	movzbl (%eax),%eax
+801012b4:	84 c0                	test   %al,%al
+801012b6:	74 17                	je     801012cf <exec+0x2df>
+801012b8:	89 d1                	mov    %edx,%ecx
+801012ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      last = s+1;
+801012c0:	83 c1 01             	add    $0x1,%ecx
+801012c3:	3c 2f                	cmp    $0x2f,%al
+  for(last=s=path; *s; s++)
+801012c5:	0f b6 01             	movzbl (%ecx),%eax
+      last = s+1;
+801012c8:	0f 44 d1             	cmove  %ecx,%edx
+  for(last=s=path; *s; s++)
+801012cb:	84 c0                	test   %al,%al
+801012cd:	75 f1                	jne    801012c0 <exec+0x2d0>
+  safestrcpy(curproc->name, last, sizeof(curproc->name));
+801012cf:	83 ec 04             	sub    $0x4,%esp
+801012d2:	6a 10                	push   $0x10
+801012d4:	52                   	push   %edx
+801012d5:	8b b5 ec fe ff ff    	mov    -0x114(%ebp),%esi
+801012db:	8d 86 88 00 00 00    	lea    0x88(%esi),%eax
+801012e1:	50                   	push   %eax
+801012e2:	e8 f9 64 00 00       	call   801077e0 <safestrcpy>
+  curproc->pgdir = pgdir;
+801012e7:	8b 8d f4 fe ff ff    	mov    -0x10c(%ebp),%ecx
+  oldpgdir = curproc->pgdir;
+801012ed:	89 f0                	mov    %esi,%eax
+801012ef:	8b 76 04             	mov    0x4(%esi),%esi
+  curproc->sz = sz;
+801012f2:	89 38                	mov    %edi,(%eax)
+  curproc->pgdir = pgdir;
+801012f4:	89 48 04             	mov    %ecx,0x4(%eax)
+  curproc->tf->eip = elf.entry;  // main
+801012f7:	89 c1                	mov    %eax,%ecx
+801012f9:	8b 95 3c ff ff ff    	mov    -0xc4(%ebp),%edx
+801012ff:	8b 40 28             	mov    0x28(%eax),%eax
+80101302:	89 50 38             	mov    %edx,0x38(%eax)
+  curproc->tf->esp = sp;
+80101305:	8b 41 28             	mov    0x28(%ecx),%eax
+80101308:	89 58 44             	mov    %ebx,0x44(%eax)
+  switchuvm(curproc);
+8010130b:	89 0c 24             	mov    %ecx,(%esp)
+8010130e:	e8 6d 8e 00 00       	call   8010a180 <switchuvm>
+  freevm(oldpgdir);
+80101313:	89 34 24             	mov    %esi,(%esp)
+80101316:	e8 15 92 00 00       	call   8010a530 <freevm>
+  return 0;
+8010131b:	83 c4 10             	add    $0x10,%esp
+8010131e:	31 c0                	xor    %eax,%eax
+80101320:	e9 3c fe ff ff       	jmp    80101161 <exec+0x171>
+  for(i=0, off=elf.phoff; i<elf.phnum; i++, off+=sizeof(ph)){
+80101325:	bb 00 20 00 00       	mov    $0x2000,%ebx
+8010132a:	31 f6                	xor    %esi,%esi
+8010132c:	e9 57 fe ff ff       	jmp    80101188 <exec+0x198>
+  for(argc = 0; argv[argc]; argc++) {
+80101331:	be 10 00 00 00       	mov    $0x10,%esi
+80101336:	ba 04 00 00 00       	mov    $0x4,%edx
+8010133b:	b8 03 00 00 00       	mov    $0x3,%eax
+80101340:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+80101347:	00 00 00 
+8010134a:	8d 8d 58 ff ff ff    	lea    -0xa8(%ebp),%ecx
+80101350:	e9 14 ff ff ff       	jmp    80101269 <exec+0x279>
+    end_op();
+80101355:	e8 a6 34 00 00       	call   80104800 <end_op>
+    cprintf("exec: fail\n");
+8010135a:	83 ec 0c             	sub    $0xc,%esp
+8010135d:	68 d9 af 10 80       	push   $0x8010afd9
+80101362:	e8 49 f8 ff ff       	call   80100bb0 <cprintf>
+    return -1;
+80101367:	83 c4 10             	add    $0x10,%esp
+8010136a:	e9 ed fd ff ff       	jmp    8010115c <exec+0x16c>
+8010136f:	90                   	nop
+
+80101370 <fileinit>:
+  struct file file[NFILE];
+} ftable;
+
+void
+fileinit(void)
+{
+80101370:	55                   	push   %ebp
+80101371:	89 e5                	mov    %esp,%ebp
+80101373:	83 ec 10             	sub    $0x10,%esp
+  initlock(&ftable.lock, "ftable");
+80101376:	68 e5 af 10 80       	push   $0x8010afe5
+8010137b:	68 a0 51 8e 80       	push   $0x808e51a0
+80101380:	e8 eb 5f 00 00       	call   80107370 <initlock>
+}
+80101385:	83 c4 10             	add    $0x10,%esp
+80101388:	c9                   	leave
+80101389:	c3                   	ret
+8010138a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80101390 <filealloc>:
+
+// Allocate a file structure.
+struct file*
+filealloc(void)
+{
+80101390:	55                   	push   %ebp
+80101391:	89 e5                	mov    %esp,%ebp
+80101393:	53                   	push   %ebx
+  struct file *f;
+
+  acquire(&ftable.lock);
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+80101394:	bb d4 51 8e 80       	mov    $0x808e51d4,%ebx
+{
+80101399:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ftable.lock);
+8010139c:	68 a0 51 8e 80       	push   $0x808e51a0
+801013a1:	e8 aa 61 00 00       	call   80107550 <acquire>
+801013a6:	83 c4 10             	add    $0x10,%esp
+801013a9:	eb 10                	jmp    801013bb <filealloc+0x2b>
+801013ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801013af:	90                   	nop
+  for(f = ftable.file; f < ftable.file + NFILE; f++){
+801013b0:	83 c3 24             	add    $0x24,%ebx
+801013b3:	81 fb e4 5f 8e 80    	cmp    $0x808e5fe4,%ebx
+801013b9:	74 3a                	je     801013f5 <filealloc+0x65>
+    if(f->ref == 0){
+801013bb:	8b 43 04             	mov    0x4(%ebx),%eax
+801013be:	85 c0                	test   %eax,%eax
+801013c0:	75 ee                	jne    801013b0 <filealloc+0x20>
+      f->ref = 1;
+      f->raoff = f->rawin = f->raend = 0;
+      release(&ftable.lock);
+801013c2:	83 ec 0c             	sub    $0xc,%esp
+      f->ref = 1;
+801013c5:	c7 43 04 01 00 00 00 	movl   $0x1,0x4(%ebx)
+      f->raoff = f->rawin = f->raend = 0;
+801013cc:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+801013d3:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+801013da:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%ebx)
+      release(&ftable.lock);
+801013e1:	68 a0 51 8e 80       	push   $0x808e51a0
+801013e6:	e8 05 61 00 00       	call   801074f0 <release>
+      return f;
+    }
+  }
+  release(&ftable.lock);
+  return 0;
+}
+801013eb:	89 d8                	mov    %ebx,%eax
+      return f;
+801013ed:	83 c4 10             	add    $0x10,%esp
+}
+801013f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801013f3:	c9                   	leave
+801013f4:	c3                   	ret
+  release(&ftable.lock);
+801013f5:	83 ec 0c             	sub    $0xc,%esp
+  return 0;
+801013f8:	31 db                	xor    %ebx,%ebx
+  release(&ftable.lock);
+801013fa:	68 a0 51 8e 80       	push   $0x808e51a0
+801013ff:	e8 ec 60 00 00       	call   801074f0 <release>
+}
+80101404:	89 d8                	mov    %ebx,%eax
+  return 0;
+80101406:	83 c4 10             	add    $0x10,%esp
+}
+80101409:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010140c:	c9                   	leave
+8010140d:	c3                   	ret
+8010140e:	66 90                	xchg   %ax,%ax
+
+80101410 <filedup>:
+
+// Increment ref count for file f.
+struct file*
+filedup(struct file *f)
+{
+80101410:	55                   	push   %ebp
+80101411:	89 e5                	mov    %esp,%ebp
+80101413:	53                   	push   %ebx
+80101414:	83 ec 10             	sub    $0x10,%esp
+80101417:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ftable.lock);
+8010141a:	68 a0 51 8e 80       	push   $0x808e51a0
+8010141f:	e8 2c 61 00 00       	call   80107550 <acquire>
+  if(f->ref < 1)
+80101424:	8b 43 04             	mov    0x4(%ebx),%eax
+80101427:	83 c4 10             	add    $0x10,%esp
+8010142a:	85 c0                	test   %eax,%eax
+8010142c:	7e 1a                	jle    80101448 <filedup+0x38>
+    panic("filedup");
+  f->ref++;
+8010142e:	83 c0 01             	add    $0x1,%eax
+  release(&ftable.lock);
+80101431:	83 ec 0c             	sub    $0xc,%esp
+  f->ref++;
+80101434:	89 43 04             	mov    %eax,0x4(%ebx)
+  release(&ftable.lock);
+80101437:	68 a0 51 8e 80       	push   $0x808e51a0
+8010143c:	e8 af 60 00 00       	call   801074f0 <release>
+  return f;
+}
+80101441:	89 d8                	mov    %ebx,%eax
+80101443:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80101446:	c9                   	leave
+80101447:	c3                   	ret
+    panic("filedup");
+80101448:	83 ec 0c             	sub    $0xc,%esp
+8010144b:	68 ec af 10 80       	push   $0x8010afec
+80101450:	e8 2b f4 ff ff       	call   80100880 <panic>
+80101455:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010145c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101460 <fileclose>:
+
+// Close file f.  (Decrement ref count, close when reaches 0.)
+void
+fileclose(struct file *f)
+{
+80101460:	55                   	push   %ebp
+80101461:	89 e5                	mov    %esp,%ebp
+80101463:	57                   	push   %edi
+80101464:	56                   	push   %esi
+80101465:	53                   	push   %ebx
+80101466:	83 ec 28             	sub    $0x28,%esp
+80101469:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct file ff;
+
+  acquire(&ftable.lock);
+8010146c:	68 a0 51 8e 80       	push   $0x808e51a0
+80101471:	e8 da 60 00 00       	call   80107550 <acquire>
+  if(f->ref < 1)
+80101476:	8b 53 04             	mov    0x4(%ebx),%edx
+80101479:	83 c4 10             	add    $0x10,%esp
+8010147c:	85 d2                	test   %edx,%edx
+8010147e:	0f 8e a5 00 00 00    	jle    80101529 <fileclose+0xc9>
+    panic("fileclose");
+  if(--f->ref > 0){
+80101484:	83 ea 01             	sub    $0x1,%edx
+80101487:	89 53 04             	mov    %edx,0x4(%ebx)
+8010148a:	75 44                	jne    801014d0 <fileclose+0x70>
+    release(&ftable.lock);
+    return;
+  }
+  ff = *f;
+8010148c:	0f b6 43 09          	movzbl 0x9(%ebx),%eax
+  f->ref = 0;
+  f->type = FD_NONE;
+  release(&ftable.lock);
+80101490:	83 ec 0c             	sub    $0xc,%esp
+  ff = *f;
+80101493:	8b 3b                	mov    (%ebx),%edi
+  f->type = FD_NONE;
+80101495:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  ff = *f;
+8010149b:	8b 73 0c             	mov    0xc(%ebx),%esi
+8010149e:	88 45 e7             	mov    %al,-0x19(%ebp)
+801014a1:	8b 43 10             	mov    0x10(%ebx),%eax
+801014a4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  release(&ftable.lock);
+801014a7:	68 a0 51 8e 80       	push   $0x808e51a0
+801014ac:	e8 3f 60 00 00       	call   801074f0 <release>
+
+  if(ff.type == FD_PIPE)
+801014b1:	83 c4 10             	add    $0x10,%esp
+801014b4:	83 ff 01             	cmp    $0x1,%edi
+801014b7:	74 57                	je     80101510 <fileclose+0xb0>
+    pipeclose(ff.pipe, ff.writable);
+  else if(ff.type == FD_INODE){
+801014b9:	83 ff 02             	cmp    $0x2,%edi
+801014bc:	74 2a                	je     801014e8 <fileclose+0x88>
+    begin_op();
+    iput(ff.ip);
+    end_op();
+  }
+}
+801014be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801014c1:	5b                   	pop    %ebx
+801014c2:	5e                   	pop    %esi
+801014c3:	5f                   	pop    %edi
+801014c4:	5d                   	pop    %ebp
+801014c5:	c3                   	ret
+801014c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801014cd:	8d 76 00             	lea    0x0(%esi),%esi
+    release(&ftable.lock);
+801014d0:	c7 45 08 a0 51 8e 80 	movl   $0x808e51a0,0x8(%ebp)
+}
+801014d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801014da:	5b                   	pop    %ebx
+801014db:	5e                   	pop    %esi
+801014dc:	5f                   	pop    %edi
+801014dd:	5d                   	pop    %ebp
+    release(&ftable.lock);
+801014de:	e9 0d 60 00 00       	jmp    801074f0 <release>
+801014e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801014e7:	90                   	nop
+    begin_op();
+801014e8:	e8 73 32 00 00       	call   80104760 <begin_op>
+    iput(ff.ip);
+801014ed:	83 ec 0c             	sub    $0xc,%esp
+801014f0:	ff 75 e0             	push   -0x20(%ebp)
+801014f3:	e8 98 14 00 00       	call   80102990 <iput>
+    end_op();
+801014f8:	83 c4 10             	add    $0x10,%esp
+}
+801014fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801014fe:	5b                   	pop    %ebx
+801014ff:	5e                   	pop    %esi
+80101500:	5f                   	pop    %edi
+80101501:	5d                   	pop    %ebp
+    end_op();
+80101502:	e9 f9 32 00 00       	jmp    80104800 <end_op>
+80101507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010150e:	66 90                	xchg   %ax,%ax
+    pipeclose(ff.pipe, ff.writable);
+80101510:	0f be 5d e7          	movsbl -0x19(%ebp),%ebx
+80101514:	83 ec 08             	sub    $0x8,%esp
+80101517:	53                   	push   %ebx
+80101518:	56                   	push   %esi
+80101519:	e8 c2 3a 00 00       	call   80104fe0 <pipeclose>
+8010151e:	83 c4 10             	add    $0x10,%esp
+}
+80101521:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101524:	5b                   	pop    %ebx
+80101525:	5e                   	pop    %esi
+80101526:	5f                   	pop    %edi
+80101527:	5d                   	pop    %ebp
+80101528:	c3                   	ret
+    panic("fileclose");
+80101529:	83 ec 0c             	sub    $0xc,%esp
+8010152c:	68 f4 af 10 80       	push   $0x8010aff4
+80101531:	e8 4a f3 ff ff       	call   80100880 <panic>
+80101536:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010153d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80101540 <filestat>:
+
+// Get metadata about file f.
+int
+filestat(struct file *f, struct stat *st)
+{
+80101540:	55                   	push   %ebp
+80101541:	89 e5                	mov    %esp,%ebp
+80101543:	53                   	push   %ebx
+80101544:	83 ec 04             	sub    $0x4,%esp
+80101547:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(f->type == FD_INODE){
+8010154a:	83 3b 02             	cmpl   $0x2,(%ebx)
+8010154d:	75 31                	jne    80101580 <filestat+0x40>
+    ilock(f->ip);
+8010154f:	83 ec 0c             	sub    $0xc,%esp
+80101552:	ff 73 10             	push   0x10(%ebx)
+80101555:	e8 06 13 00 00       	call   80102860 <ilock>
+    stati(f->ip, st);
+8010155a:	58                   	pop    %eax
+8010155b:	5a                   	pop    %edx
+8010155c:	ff 75 0c             	push   0xc(%ebp)
+8010155f:	ff 73 10             	push   0x10(%ebx)
+80101562:	e8 39 16 00 00       	call   80102ba0 <stati>
+    iunlock(f->ip);
+80101567:	59                   	pop    %ecx
+80101568:	ff 73 10             	push   0x10(%ebx)
+8010156b:	e8 d0 13 00 00       	call   80102940 <iunlock>
+    return 0;
+  }
+  return -1;
+}
+80101570:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+80101573:	83 c4 10             	add    $0x10,%esp
+80101576:	31 c0                	xor    %eax,%eax
+}
+80101578:	c9                   	leave
+80101579:	c3                   	ret
+8010157a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80101580:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return -1;
+80101583:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80101588:	c9                   	leave
+80101589:	c3                   	ret
+8010158a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80101590 <fileread>:
+}
+
+// Read from file f.
+int
+fileread(struct file *f, char *addr, int n)
+{
+80101590:	55                   	push   %ebp
+80101591:	89 e5                	mov    %esp,%ebp
+80101593:	57                   	push   %edi
+80101594:	56                   	push   %esi
+80101595:	53                   	push   %ebx
+80101596:	83 ec 1c             	sub    $0x1c,%esp
+80101599:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010159c:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010159f:	8b 45 10             	mov    0x10(%ebp),%eax
+  int r;
+  uint off;
+
+  if(f->readable == 0)
+801015a2:	80 7b 08 00          	cmpb   $0x0,0x8(%ebx)
+801015a6:	0f 84 04 01 00 00    	je     801016b0 <fileread+0x120>
+    return -1;
+  if(f->type == FD_PIPE)
+801015ac:	8b 3b                	mov    (%ebx),%edi
+801015ae:	83 ff 01             	cmp    $0x1,%edi
+801015b1:	0f 84 b9 00 00 00    	je     80101670 <fileread+0xe0>
+801015b7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    return piperead(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+801015ba:	83 ff 02             	cmp    $0x2,%edi
+801015bd:	0f 85 f7 00 00 00    	jne    801016ba <fileread+0x12a>
+    ilock(f->ip);
+801015c3:	83 ec 0c             	sub    $0xc,%esp
+801015c6:	ff 73 10             	push   0x10(%ebx)
+801015c9:	e8 92 12 00 00       	call   80102860 <ilock>
+    off = f->off;
+801015ce:	8b 53 14             	mov    0x14(%ebx),%edx
+    if((r = readi(f->ip, addr, off, n)) > 0){
+801015d1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801015d4:	50                   	push   %eax
+801015d5:	52                   	push   %edx
+801015d6:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801015d9:	56                   	push   %esi
+801015da:	ff 73 10             	push   0x10(%ebx)
+801015dd:	e8 ee 15 00 00       	call   80102bd0 <readi>
+801015e2:	83 c4 20             	add    $0x20,%esp
+801015e5:	89 c6                	mov    %eax,%esi
+801015e7:	85 c0                	test   %eax,%eax
+801015e9:	7f 1d                	jg     80101608 <fileread+0x78>
+      f->off += r;
+      readahead(f, off);
+    }
+    iunlock(f->ip);
+801015eb:	83 ec 0c             	sub    $0xc,%esp
+801015ee:	ff 73 10             	push   0x10(%ebx)
+801015f1:	e8 4a 13 00 00       	call   80102940 <iunlock>
+    return r;
+801015f6:	83 c4 10             	add    $0x10,%esp
+  }
+  panic("fileread");
+}
+801015f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801015fc:	89 f0                	mov    %esi,%eax
+801015fe:	5b                   	pop    %ebx
+801015ff:	5e                   	pop    %esi
+80101600:	5f                   	pop    %edi
+80101601:	5d                   	pop    %ebp
+80101602:	c3                   	ret
+80101603:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101607:	90                   	nop
+      f->off += r;
+80101608:	8b 4b 14             	mov    0x14(%ebx),%ecx
+  if(off != f->raoff){
+8010160b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+      f->off += r;
+8010160e:	01 c1                	add    %eax,%ecx
+80101610:	89 4b 14             	mov    %ecx,0x14(%ebx)
+  if(off != f->raoff){
+80101613:	3b 53 18             	cmp    0x18(%ebx),%edx
+80101616:	74 18                	je     80101630 <fileread+0xa0>
+    f->rawin = 0;
+80101618:	c7 43 1c 00 00 00 00 	movl   $0x0,0x1c(%ebx)
+    f->raend = 0;
+8010161f:	c7 43 20 00 00 00 00 	movl   $0x0,0x20(%ebx)
+  f->raoff = f->off;
+80101626:	89 4b 18             	mov    %ecx,0x18(%ebx)
+  if(f->rawin == 0)
+80101629:	eb c0                	jmp    801015eb <fileread+0x5b>
+8010162b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010162f:	90                   	nop
+  } else if(f->rawin == 0)
+80101630:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80101633:	85 c0                	test   %eax,%eax
+80101635:	75 51                	jne    80101688 <fileread+0xf8>
+    f->rawin = RAMIN;
+80101637:	c7 43 1c 02 00 00 00 	movl   $0x2,0x1c(%ebx)
+    ireadahead(f->ip, start, end - start);
+8010163e:	8b 53 10             	mov    0x10(%ebx),%edx
+  f->raoff = f->off;
+80101641:	89 4b 18             	mov    %ecx,0x18(%ebx)
+  start = f->off > f->raend ? f->off : f->raend;
+80101644:	8b 43 20             	mov    0x20(%ebx),%eax
+80101647:	39 c1                	cmp    %eax,%ecx
+80101649:	0f 43 c1             	cmovae %ecx,%eax
+  end = f->off + f->rawin*BSIZE;
+8010164c:	c1 e7 0c             	shl    $0xc,%edi
+8010164f:	01 cf                	add    %ecx,%edi
+  if(start < end){
+80101651:	39 f8                	cmp    %edi,%eax
+80101653:	73 96                	jae    801015eb <fileread+0x5b>
+    ireadahead(f->ip, start, end - start);
+80101655:	89 f9                	mov    %edi,%ecx
+80101657:	83 ec 04             	sub    $0x4,%esp
+8010165a:	29 c1                	sub    %eax,%ecx
+8010165c:	51                   	push   %ecx
+8010165d:	50                   	push   %eax
+8010165e:	52                   	push   %edx
+8010165f:	e8 6c 16 00 00       	call   80102cd0 <ireadahead>
+    f->raend = end;
+80101664:	89 7b 20             	mov    %edi,0x20(%ebx)
+80101667:	83 c4 10             	add    $0x10,%esp
+8010166a:	e9 7c ff ff ff       	jmp    801015eb <fileread+0x5b>
+8010166f:	90                   	nop
+    return piperead(f->pipe, addr, n);
+80101670:	8b 43 0c             	mov    0xc(%ebx),%eax
+80101673:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80101676:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101679:	5b                   	pop    %ebx
+8010167a:	5e                   	pop    %esi
+8010167b:	5f                   	pop    %edi
+8010167c:	5d                   	pop    %ebp
+    return piperead(f->pipe, addr, n);
+8010167d:	e9 7e 3c 00 00       	jmp    80105300 <piperead>
+80101682:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  else if(f->rawin < RAMAX)
+80101688:	83 f8 1f             	cmp    $0x1f,%eax
+8010168b:	77 13                	ja     801016a0 <fileread+0x110>
+    f->rawin *= 2;
+8010168d:	8d 3c 00             	lea    (%eax,%eax,1),%edi
+  f->raoff = f->off;
+80101690:	89 4b 18             	mov    %ecx,0x18(%ebx)
+    ireadahead(f->ip, start, end - start);
+80101693:	8b 53 10             	mov    0x10(%ebx),%edx
+    f->rawin *= 2;
+80101696:	89 7b 1c             	mov    %edi,0x1c(%ebx)
+  if(f->rawin == 0)
+80101699:	eb a9                	jmp    80101644 <fileread+0xb4>
+8010169b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010169f:	90                   	nop
+  f->raoff = f->off;
+801016a0:	89 4b 18             	mov    %ecx,0x18(%ebx)
+    ireadahead(f->ip, start, end - start);
+801016a3:	8b 53 10             	mov    0x10(%ebx),%edx
+801016a6:	89 c7                	mov    %eax,%edi
+801016a8:	eb 9a                	jmp    80101644 <fileread+0xb4>
+801016aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+801016b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+801016b5:	e9 3f ff ff ff       	jmp    801015f9 <fileread+0x69>
+  panic("fileread");
+801016ba:	83 ec 0c             	sub    $0xc,%esp
+801016bd:	68 fe af 10 80       	push   $0x8010affe
+801016c2:	e8 b9 f1 ff ff       	call   80100880 <panic>
+801016c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801016ce:	66 90                	xchg   %ax,%ax
+
+801016d0 <filewrite>:
+
+//PAGEBREAK!
+// Write to file f.
+int
+filewrite(struct file *f, char *addr, int n)
+{
+801016d0:	55                   	push   %ebp
+801016d1:	89 e5                	mov    %esp,%ebp
+801016d3:	57                   	push   %edi
+801016d4:	56                   	push   %esi
+801016d5:	53                   	push   %ebx
+801016d6:	83 ec 1c             	sub    $0x1c,%esp
+801016d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+801016dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+801016df:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801016e2:	8b 45 10             	mov    0x10(%ebp),%eax
+  int r;
+
+  if(f->writable == 0)
+801016e5:	80 7b 09 00          	cmpb   $0x0,0x9(%ebx)
+{
+801016e9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(f->writable == 0)
+801016ec:	0f 84 bb 00 00 00    	je     801017ad <filewrite+0xdd>
+    return -1;
+  if(f->type == FD_PIPE)
+801016f2:	8b 03                	mov    (%ebx),%eax
+801016f4:	83 f8 01             	cmp    $0x1,%eax
+801016f7:	0f 84 bf 00 00 00    	je     801017bc <filewrite+0xec>
+    return pipewrite(f->pipe, addr, n);
+  if(f->type == FD_INODE){
+801016fd:	83 f8 02             	cmp    $0x2,%eax
+80101700:	0f 85 c8 00 00 00    	jne    801017ce <filewrite+0xfe>
+    // non-aligned writes.
+    // this really belongs lower down, since writei()
+    // might be writing a device like the console.
+    int max = ((MAXOPBLOCKS-1-2-2) / 2) * BSIZE;
+    int i = 0;
+    while(i < n){
+80101706:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    int i = 0;
+80101709:	31 f6                	xor    %esi,%esi
+    while(i < n){
+8010170b:	85 c0                	test   %eax,%eax
+8010170d:	7f 30                	jg     8010173f <filewrite+0x6f>
+8010170f:	e9 94 00 00 00       	jmp    801017a8 <filewrite+0xd8>
+80101714:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        n1 = max;
+
+      begin_op();
+      ilock(f->ip);
+      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+        f->off += r;
+80101718:	01 43 14             	add    %eax,0x14(%ebx)
+      iunlock(f->ip);
+8010171b:	83 ec 0c             	sub    $0xc,%esp
+        f->off += r;
+8010171e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      iunlock(f->ip);
+80101721:	ff 73 10             	push   0x10(%ebx)
+80101724:	e8 17 12 00 00       	call   80102940 <iunlock>
+      end_op();
+80101729:	e8 d2 30 00 00       	call   80104800 <end_op>
+
+      if(r < 0)
+        break;
+      if(r != n1)
+8010172e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80101731:	83 c4 10             	add    $0x10,%esp
+80101734:	39 c7                	cmp    %eax,%edi
+80101736:	75 5c                	jne    80101794 <filewrite+0xc4>
+        panic("short filewrite");
+      i += r;
+80101738:	01 fe                	add    %edi,%esi
+    while(i < n){
+8010173a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+8010173d:	7e 69                	jle    801017a8 <filewrite+0xd8>
+      int n1 = n - i;
+8010173f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if(n1 > max)
+80101742:	b8 00 20 00 00       	mov    $0x2000,%eax
+      int n1 = n - i;
+80101747:	29 f7                	sub    %esi,%edi
+      if(n1 > max)
+80101749:	39 c7                	cmp    %eax,%edi
+8010174b:	0f 4f f8             	cmovg  %eax,%edi
+      begin_op();
+8010174e:	e8 0d 30 00 00       	call   80104760 <begin_op>
+      ilock(f->ip);
+80101753:	83 ec 0c             	sub    $0xc,%esp
+80101756:	ff 73 10             	push   0x10(%ebx)
+80101759:	e8 02 11 00 00       	call   80102860 <ilock>
+      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
+8010175e:	57                   	push   %edi
+8010175f:	ff 73 14             	push   0x14(%ebx)
+80101762:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80101765:	01 f0                	add    %esi,%eax
+80101767:	50                   	push   %eax
+80101768:	ff 73 10             	push   0x10(%ebx)
+8010176b:	e8 d0 15 00 00       	call   80102d40 <writei>
+80101770:	83 c4 20             	add    $0x20,%esp
+80101773:	85 c0                	test   %eax,%eax
+80101775:	7f a1                	jg     80101718 <filewrite+0x48>
+80101777:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      iunlock(f->ip);
+8010177a:	83 ec 0c             	sub    $0xc,%esp
+8010177d:	ff 73 10             	push   0x10(%ebx)
+80101780:	e8 bb 11 00 00       	call   80102940 <iunlock>
+      end_op();
+80101785:	e8 76 30 00 00       	call   80104800 <end_op>
+      if(r < 0)
+8010178a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010178d:	83 c4 10             	add    $0x10,%esp
+80101790:	85 c0                	test   %eax,%eax
+80101792:	75 14                	jne    801017a8 <filewrite+0xd8>
+        panic("short filewrite");
+80101794:	83 ec 0c             	sub    $0xc,%esp
+80101797:	68 07 b0 10 80       	push   $0x8010b007
+8010179c:	e8 df f0 ff ff       	call   80100880 <panic>
+801017a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    }
+    return i == n ? n : -1;
+801017a8:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+801017ab:	74 05                	je     801017b2 <filewrite+0xe2>
+    return -1;
+801017ad:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  }
+  panic("filewrite");
+}
+801017b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801017b5:	89 f0                	mov    %esi,%eax
+801017b7:	5b                   	pop    %ebx
+801017b8:	5e                   	pop    %esi
+801017b9:	5f                   	pop    %edi
+801017ba:	5d                   	pop    %ebp
+801017bb:	c3                   	ret
+    return pipewrite(f->pipe, addr, n);
+801017bc:	8b 43 0c             	mov    0xc(%ebx),%eax
+801017bf:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+801017c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801017c5:	5b                   	pop    %ebx
+801017c6:	5e                   	pop    %esi
+801017c7:	5f                   	pop    %edi
+801017c8:	5d                   	pop    %ebp
+    return pipewrite(f->pipe, addr, n);
+801017c9:	e9 22 39 00 00       	jmp    801050f0 <pipewrite>
+  panic("filewrite");
+801017ce:	83 ec 0c             	sub    $0xc,%esp
+801017d1:	68 0d b0 10 80       	push   $0x8010b00d
+801017d6:	e8 a5 f0 ff ff       	call   80100880 <panic>
+801017db:	66 90                	xchg   %ax,%ax
+801017dd:	66 90                	xchg   %ax,%ax
+801017df:	90                   	nop
+
+801017e0 <bfree>:
+}
+
+// Free a disk block.
+static void
+bfree(int dev, uint b)
+{
+801017e0:	55                   	push   %ebp
+801017e1:	89 e5                	mov    %esp,%ebp
+801017e3:	57                   	push   %edi
+801017e4:	56                   	push   %esi
+  struct buf *bp;
+  int bi, m;
+
+  bp = bread(dev, BBLOCK(b, sb));
+801017e5:	89 d6                	mov    %edx,%esi
+{
+801017e7:	53                   	push   %ebx
+801017e8:	89 d3                	mov    %edx,%ebx
+  bp = bread(dev, BBLOCK(b, sb));
+801017ea:	c1 ee 0f             	shr    $0xf,%esi
+{
+801017ed:	83 ec 14             	sub    $0x14,%esp
+  bp = bread(dev, BBLOCK(b, sb));
+801017f0:	8b 15 a0 0c 8f 80    	mov    0x808f0ca0,%edx
+801017f6:	01 f2                	add    %esi,%edx
+801017f8:	52                   	push   %edx
+801017f9:	50                   	push   %eax
+801017fa:	e8 f1 ec ff ff       	call   801004f0 <bread>
+  bi = b % BPB;
+  m = 1 << (bi % 8);
+801017ff:	89 d9                	mov    %ebx,%ecx
+  if((bp->data[bi/8] & m) == 0)
+80101801:	c1 fb 03             	sar    $0x3,%ebx
+80101804:	83 c4 10             	add    $0x10,%esp
+  bp = bread(dev, BBLOCK(b, sb));
+80101807:	89 c7                	mov    %eax,%edi
+  m = 1 << (bi % 8);
+80101809:	83 e1 07             	and    $0x7,%ecx
+8010180c:	b8 01 00 00 00       	mov    $0x1,%eax
+  if((bp->data[bi/8] & m) == 0)
+80101811:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+80101817:	03 5f 60             	add    0x60(%edi),%ebx
+  m = 1 << (bi % 8);
+8010181a:	d3 e0                	shl    %cl,%eax
+  if((bp->data[bi/8] & m) == 0)
+8010181c:	0f b6 0b             	movzbl (%ebx),%ecx
+8010181f:	85 c1                	test   %eax,%ecx
+80101821:	74 2a                	je     8010184d <bfree+0x6d>
+    panic("freeing free block");
+  bp->data[bi/8] &= ~m;
+80101823:	f7 d0                	not    %eax
+  bsum.nfree[b/BPB]++;
+  log_write(bp);
+80101825:	83 ec 0c             	sub    $0xc,%esp
+  bsum.nfree[b/BPB]++;
+80101828:	83 04 b5 a4 0c 8f 80 	addl   $0x1,-0x7f70f35c(,%esi,4)
+8010182f:	01 
+  bp->data[bi/8] &= ~m;
+80101830:	21 c8                	and    %ecx,%eax
+80101832:	88 03                	mov    %al,(%ebx)
+  log_write(bp);
+80101834:	57                   	push   %edi
+80101835:	e8 c6 30 00 00       	call   80104900 <log_write>
+  brelse(bp);
+8010183a:	89 3c 24             	mov    %edi,(%esp)
+8010183d:	e8 ee ee ff ff       	call   80100730 <brelse>
+}
+80101842:	83 c4 10             	add    $0x10,%esp
+80101845:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101848:	5b                   	pop    %ebx
+80101849:	5e                   	pop    %esi
+8010184a:	5f                   	pop    %edi
+8010184b:	5d                   	pop    %ebp
+8010184c:	c3                   	ret
+    panic("freeing free block");
+8010184d:	83 ec 0c             	sub    $0xc,%esp
+80101850:	68 17 b0 10 80       	push   $0x8010b017
+80101855:	e8 26 f0 ff ff       	call   80100880 <panic>
+8010185a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80101860 <bfreeind>:
+
+// Free the indirect block at addr and the blocks it lists,
+// which are themselves indirect blocks if depth > 1.
+static void
+bfreeind(struct inode *ip, uint addr, int depth)
+{
+80101860:	55                   	push   %ebp
+80101861:	89 e5                	mov    %esp,%ebp
+80101863:	57                   	push   %edi
+80101864:	89 c7                	mov    %eax,%edi
+80101866:	56                   	push   %esi
+80101867:	53                   	push   %ebx
+80101868:	83 ec 24             	sub    $0x24,%esp
+8010186b:	89 55 e0             	mov    %edx,-0x20(%ebp)
+8010186e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  int j;
+  struct buf *bp;
+  uint *a;
+
+  bp = bread(ip->dev, addr);
+80101871:	52                   	push   %edx
+80101872:	ff 30                	push   (%eax)
+80101874:	e8 77 ec ff ff       	call   801004f0 <bread>
+  a = (uint*)bp->data;
+  for(j = 0; j < NINDIRECT; j++){
+80101879:	83 c4 10             	add    $0x10,%esp
+8010187c:	8b 58 60             	mov    0x60(%eax),%ebx
+8010187f:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80101882:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+80101888:	eb 1d                	jmp    801018a7 <bfreeind+0x47>
+8010188a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(a[j] == 0)
+      continue;
+    if(depth > 1)
+      bfreeind(ip, a[j], depth-1);
+80101890:	8d 48 ff             	lea    -0x1(%eax),%ecx
+80101893:	89 f8                	mov    %edi,%eax
+80101895:	e8 c6 ff ff ff       	call   80101860 <bfreeind>
+8010189a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(j = 0; j < NINDIRECT; j++){
+801018a0:	83 c3 04             	add    $0x4,%ebx
+801018a3:	39 f3                	cmp    %esi,%ebx
+801018a5:	74 1c                	je     801018c3 <bfreeind+0x63>
+    if(a[j] == 0)
+801018a7:	8b 13                	mov    (%ebx),%edx
+801018a9:	85 d2                	test   %edx,%edx
+801018ab:	74 f3                	je     801018a0 <bfreeind+0x40>
+    if(depth > 1)
+801018ad:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801018b0:	83 f8 01             	cmp    $0x1,%eax
+801018b3:	75 db                	jne    80101890 <bfreeind+0x30>
+    else
+      bfree(ip->dev, a[j]);
+801018b5:	8b 07                	mov    (%edi),%eax
+  for(j = 0; j < NINDIRECT; j++){
+801018b7:	83 c3 04             	add    $0x4,%ebx
+      bfree(ip->dev, a[j]);
+801018ba:	e8 21 ff ff ff       	call   801017e0 <bfree>
+  for(j = 0; j < NINDIRECT; j++){
+801018bf:	39 f3                	cmp    %esi,%ebx
+801018c1:	75 e4                	jne    801018a7 <bfreeind+0x47>
+  }
+  brelse(bp);
+801018c3:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801018c6:	83 ec 0c             	sub    $0xc,%esp
+801018c9:	50                   	push   %eax
+801018ca:	e8 61 ee ff ff       	call   80100730 <brelse>
+  bfree(ip->dev, addr);
+801018cf:	8b 07                	mov    (%edi),%eax
+801018d1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+801018d4:	83 c4 10             	add    $0x10,%esp
+}
+801018d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801018da:	5b                   	pop    %ebx
+801018db:	5e                   	pop    %esi
+801018dc:	5f                   	pop    %edi
+801018dd:	5d                   	pop    %ebp
+  bfree(ip->dev, addr);
+801018de:	e9 fd fe ff ff       	jmp    801017e0 <bfree>
+801018e3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801018ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801018f0 <iget>:
+{
+801018f0:	55                   	push   %ebp
+801018f1:	89 e5                	mov    %esp,%ebp
+801018f3:	57                   	push   %edi
+801018f4:	89 d7                	mov    %edx,%edi
+801018f6:	56                   	push   %esi
+801018f7:	89 c6                	mov    %eax,%esi
+801018f9:	53                   	push   %ebx
+  h = IHASH(dev, inum);
+801018fa:	8d 1c f5 00 00 00 00 	lea    0x0(,%esi,8),%ebx
+80101901:	29 f3                	sub    %esi,%ebx
+80101903:	01 fb                	add    %edi,%ebx
+{
+80101905:	83 ec 28             	sub    $0x28,%esp
+  acquire(&icache.lock);
+80101908:	68 c0 8d 8e 80       	push   $0x808e8dc0
+8010190d:	e8 3e 5c 00 00       	call   80107550 <acquire>
+  h = IHASH(dev, inum);
+80101912:	b8 3f c5 25 43       	mov    $0x4325c53f,%eax
+  for(ip = icache.hash[h]; ip; ip = ip->hnext){
+80101917:	83 c4 10             	add    $0x10,%esp
+  h = IHASH(dev, inum);
+8010191a:	f7 e3                	mul    %ebx
+8010191c:	c1 ea 04             	shr    $0x4,%edx
+8010191f:	6b c2 3d             	imul   $0x3d,%edx,%eax
+80101922:	89 da                	mov    %ebx,%edx
+80101924:	29 c2                	sub    %eax,%edx
+  for(ip = icache.hash[h]; ip; ip = ip->hnext){
+80101926:	8d 8a 4c 1f 00 00    	lea    0x1f4c(%edx),%ecx
+8010192c:	8b 1c 8d c4 8d 8e 80 	mov    -0x7f71723c(,%ecx,4),%ebx
+80101933:	85 db                	test   %ebx,%ebx
+80101935:	75 10                	jne    80101947 <iget+0x57>
+80101937:	eb 3f                	jmp    80101978 <iget+0x88>
+80101939:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101940:	8b 5b 0c             	mov    0xc(%ebx),%ebx
+80101943:	85 db                	test   %ebx,%ebx
+80101945:	74 31                	je     80101978 <iget+0x88>
+    if(ip->dev == dev && ip->inum == inum){
+80101947:	39 33                	cmp    %esi,(%ebx)
+80101949:	75 f5                	jne    80101940 <iget+0x50>
+8010194b:	39 7b 04             	cmp    %edi,0x4(%ebx)
+8010194e:	75 f0                	jne    80101940 <iget+0x50>
+      if(ip->ref++ == 0)
+80101950:	8b 43 08             	mov    0x8(%ebx),%eax
+80101953:	8d 50 01             	lea    0x1(%eax),%edx
+80101956:	89 53 08             	mov    %edx,0x8(%ebx)
+80101959:	85 c0                	test   %eax,%eax
+8010195b:	0f 85 a4 00 00 00    	jne    80101a05 <iget+0x115>
+  ip->next->prev = ip->prev;
+80101961:	8b 53 14             	mov    0x14(%ebx),%edx
+80101964:	8b 43 10             	mov    0x10(%ebx),%eax
+80101967:	89 42 10             	mov    %eax,0x10(%edx)
+  ip->prev->next = ip->next;
+8010196a:	8b 53 14             	mov    0x14(%ebx),%edx
+8010196d:	89 50 14             	mov    %edx,0x14(%eax)
+}
+80101970:	e9 90 00 00 00       	jmp    80101a05 <iget+0x115>
+80101975:	8d 76 00             	lea    0x0(%esi),%esi
+  ip = icache.lru.next;
+80101978:	8b 1d fc 0b 8f 80    	mov    0x808f0bfc,%ebx
+  if(ip == &icache.lru)
+8010197e:	81 fb e8 0b 8f 80    	cmp    $0x808f0be8,%ebx
+80101984:	0f 84 9e 00 00 00    	je     80101a28 <iget+0x138>
+  ip->next->prev = ip->prev;
+8010198a:	8b 53 14             	mov    0x14(%ebx),%edx
+8010198d:	8b 43 10             	mov    0x10(%ebx),%eax
+80101990:	89 42 10             	mov    %eax,0x10(%edx)
+  ip->prev->next = ip->next;
+80101993:	8b 53 14             	mov    0x14(%ebx),%edx
+80101996:	89 50 14             	mov    %edx,0x14(%eax)
+  for(pp = &icache.hash[IHASH(ip->dev, ip->inum)]; *pp != ip; pp = &(*pp)->hnext)
+80101999:	8b 13                	mov    (%ebx),%edx
+8010199b:	8d 04 d5 00 00 00 00 	lea    0x0(,%edx,8),%eax
+801019a2:	29 d0                	sub    %edx,%eax
+801019a4:	ba 3f c5 25 43       	mov    $0x4325c53f,%edx
+801019a9:	03 43 04             	add    0x4(%ebx),%eax
+801019ac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801019af:	f7 e2                	mul    %edx
+801019b1:	c1 ea 04             	shr    $0x4,%edx
+801019b4:	6b c2 3d             	imul   $0x3d,%edx,%eax
+801019b7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801019ba:	29 c2                	sub    %eax,%edx
+801019bc:	8b 04 95 f4 0a 8f 80 	mov    -0x7f70f50c(,%edx,4),%eax
+801019c3:	39 c3                	cmp    %eax,%ebx
+801019c5:	74 58                	je     80101a1f <iget+0x12f>
+801019c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801019ce:	66 90                	xchg   %ax,%ax
+801019d0:	89 c2                	mov    %eax,%edx
+801019d2:	8b 40 0c             	mov    0xc(%eax),%eax
+801019d5:	39 c3                	cmp    %eax,%ebx
+801019d7:	75 f7                	jne    801019d0 <iget+0xe0>
+801019d9:	83 c2 0c             	add    $0xc,%edx
+  *pp = ip->hnext;
+801019dc:	8b 43 0c             	mov    0xc(%ebx),%eax
+801019df:	89 02                	mov    %eax,(%edx)
+  ip->hnext = icache.hash[h];
+801019e1:	8b 04 8d c4 8d 8e 80 	mov    -0x7f71723c(,%ecx,4),%eax
+801019e8:	89 43 0c             	mov    %eax,0xc(%ebx)
+  icache.hash[h] = ip;
+801019eb:	89 1c 8d c4 8d 8e 80 	mov    %ebx,-0x7f71723c(,%ecx,4)
+  ip->dev = dev;
+801019f2:	89 33                	mov    %esi,(%ebx)
+  ip->inum = inum;
+801019f4:	89 7b 04             	mov    %edi,0x4(%ebx)
+  ip->ref = 1;
+801019f7:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%ebx)
+  ip->valid = 0;
+801019fe:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+  release(&icache.lock);
+80101a05:	83 ec 0c             	sub    $0xc,%esp
+80101a08:	68 c0 8d 8e 80       	push   $0x808e8dc0
+80101a0d:	e8 de 5a 00 00       	call   801074f0 <release>
+  return ip;
+80101a12:	83 c4 10             	add    $0x10,%esp
+}
+80101a15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101a18:	89 d8                	mov    %ebx,%eax
+80101a1a:	5b                   	pop    %ebx
+80101a1b:	5e                   	pop    %esi
+80101a1c:	5f                   	pop    %edi
+80101a1d:	5d                   	pop    %ebp
+80101a1e:	c3                   	ret
+  for(pp = &icache.hash[IHASH(ip->dev, ip->inum)]; *pp != ip; pp = &(*pp)->hnext)
+80101a1f:	8d 14 95 f4 0a 8f 80 	lea    -0x7f70f50c(,%edx,4),%edx
+80101a26:	eb b4                	jmp    801019dc <iget+0xec>
+    panic("iget: no inodes");
+80101a28:	83 ec 0c             	sub    $0xc,%esp
+80101a2b:	68 2a b0 10 80       	push   $0x8010b02a
+80101a30:	e8 4b ee ff ff       	call   80100880 <panic>
+80101a35:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101a40 <balloc>:
+{
+80101a40:	55                   	push   %ebp
+80101a41:	89 e5                	mov    %esp,%ebp
+80101a43:	57                   	push   %edi
+80101a44:	56                   	push   %esi
+80101a45:	53                   	push   %ebx
+80101a46:	83 ec 3c             	sub    $0x3c,%esp
+80101a49:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(goal == 0 || goal >= sb.size)
+80101a4c:	8b 0d 88 0c 8f 80    	mov    0x808f0c88,%ecx
+{
+80101a52:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+  if(goal == 0 || goal >= sb.size)
+80101a55:	85 d2                	test   %edx,%edx
+80101a57:	0f 84 f3 00 00 00    	je     80101b50 <balloc+0x110>
+80101a5d:	39 ca                	cmp    %ecx,%edx
+80101a5f:	0f 83 eb 00 00 00    	jae    80101b50 <balloc+0x110>
+    bb = (goal/BPB + n) % nb;
+80101a65:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  nb = (sb.size + BPB - 1) / BPB;
+80101a68:	81 c1 ff 7f 00 00    	add    $0x7fff,%ecx
+  for(n = 0; n <= nb; n++){
+80101a6e:	31 f6                	xor    %esi,%esi
+  nb = (sb.size + BPB - 1) / BPB;
+80101a70:	89 cb                	mov    %ecx,%ebx
+    bb = (goal/BPB + n) % nb;
+80101a72:	89 c7                	mov    %eax,%edi
+      if(n == 0 && bi/32 == goal % BPB / 32)
+80101a74:	c1 e8 05             	shr    $0x5,%eax
+    bb = (goal/BPB + n) % nb;
+80101a77:	c1 ef 0f             	shr    $0xf,%edi
+      if(n == 0 && bi/32 == goal % BPB / 32)
+80101a7a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  nb = (sb.size + BPB - 1) / BPB;
+80101a7f:	c1 eb 0f             	shr    $0xf,%ebx
+    bb = (goal/BPB + n) % nb;
+80101a82:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+      if(n == 0 && bi/32 == goal % BPB / 32)
+80101a85:	89 45 bc             	mov    %eax,-0x44(%ebp)
+80101a88:	eb 13                	jmp    80101a9d <balloc+0x5d>
+80101a8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(n = 0; n <= nb; n++){
+80101a90:	8d 46 01             	lea    0x1(%esi),%eax
+80101a93:	39 de                	cmp    %ebx,%esi
+80101a95:	0f 84 75 01 00 00    	je     80101c10 <balloc+0x1d0>
+80101a9b:	89 c6                	mov    %eax,%esi
+    bb = (goal/BPB + n) % nb;
+80101a9d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80101aa0:	31 d2                	xor    %edx,%edx
+80101aa2:	01 f0                	add    %esi,%eax
+80101aa4:	f7 f3                	div    %ebx
+    if(bsum.nfree[bb] == 0)
+80101aa6:	8b 0c 95 a4 0c 8f 80 	mov    -0x7f70f35c(,%edx,4),%ecx
+    bb = (goal/BPB + n) % nb;
+80101aad:	89 d7                	mov    %edx,%edi
+    if(bsum.nfree[bb] == 0)
+80101aaf:	85 c9                	test   %ecx,%ecx
+80101ab1:	74 dd                	je     80101a90 <balloc+0x50>
+    bp = bread(dev, sb.bmapstart + bb);
+80101ab3:	a1 a0 0c 8f 80       	mov    0x808f0ca0,%eax
+80101ab8:	83 ec 08             	sub    $0x8,%esp
+80101abb:	01 d0                	add    %edx,%eax
+80101abd:	50                   	push   %eax
+80101abe:	ff 75 c0             	push   -0x40(%ebp)
+80101ac1:	e8 2a ea ff ff       	call   801004f0 <bread>
+    bi = n == 0 ? goal % BPB / 32 * 32 : 0;
+80101ac6:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+80101ac9:	83 c4 10             	add    $0x10,%esp
+80101acc:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+    bp = bread(dev, sb.bmapstart + bb);
+80101acf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    w = (uint*)bp->data;
+80101ad2:	8b 40 60             	mov    0x60(%eax),%eax
+    bi = n == 0 ? goal % BPB / 32 * 32 : 0;
+80101ad5:	81 e1 e0 7f 00 00    	and    $0x7fe0,%ecx
+80101adb:	89 7d d0             	mov    %edi,-0x30(%ebp)
+    w = (uint*)bp->data;
+80101ade:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    bi = n == 0 ? goal % BPB / 32 * 32 : 0;
+80101ae1:	31 c0                	xor    %eax,%eax
+80101ae3:	85 f6                	test   %esi,%esi
+80101ae5:	0f 44 c1             	cmove  %ecx,%eax
+    for(; bi < BPB && bb*BPB + bi < sb.size; bi += 32){
+80101ae8:	8b 0d 88 0c 8f 80    	mov    0x808f0c88,%ecx
+    bi = n == 0 ? goal % BPB / 32 * 32 : 0;
+80101aee:	89 c2                	mov    %eax,%edx
+    for(; bi < BPB && bb*BPB + bi < sb.size; bi += 32){
+80101af0:	89 f8                	mov    %edi,%eax
+80101af2:	c1 e0 0f             	shl    $0xf,%eax
+80101af5:	89 d7                	mov    %edx,%edi
+80101af7:	01 d0                	add    %edx,%eax
+80101af9:	89 ca                	mov    %ecx,%edx
+80101afb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80101afe:	39 55 e0             	cmp    %edx,-0x20(%ebp)
+80101b01:	0f 83 8c 00 00 00    	jae    80101b93 <balloc+0x153>
+      x = ~w[bi/32];
+80101b07:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80101b0a:	89 f9                	mov    %edi,%ecx
+80101b0c:	c1 e9 05             	shr    $0x5,%ecx
+80101b0f:	8d 04 88             	lea    (%eax,%ecx,4),%eax
+80101b12:	89 45 cc             	mov    %eax,-0x34(%ebp)
+80101b15:	8b 00                	mov    (%eax),%eax
+80101b17:	89 45 c8             	mov    %eax,-0x38(%ebp)
+80101b1a:	f7 d0                	not    %eax
+      if(n == 0 && bi/32 == goal % BPB / 32)
+80101b1c:	85 f6                	test   %esi,%esi
+80101b1e:	74 48                	je     80101b68 <balloc+0x128>
+      if(x == 0)
+80101b20:	85 c0                	test   %eax,%eax
+80101b22:	74 5c                	je     80101b80 <balloc+0x140>
+      b = bb*BPB + bi + __builtin_ctz(x);
+80101b24:	89 d1                	mov    %edx,%ecx
+80101b26:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80101b29:	f3 0f bc c0          	tzcnt  %eax,%eax
+80101b2d:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+80101b30:	8b 7d d0             	mov    -0x30(%ebp),%edi
+80101b33:	01 d0                	add    %edx,%eax
+      if(b >= sb.size)
+80101b35:	39 c8                	cmp    %ecx,%eax
+80101b37:	72 67                	jb     80101ba0 <balloc+0x160>
+    brelse(bp);
+80101b39:	83 ec 0c             	sub    $0xc,%esp
+80101b3c:	ff 75 d8             	push   -0x28(%ebp)
+80101b3f:	e8 ec eb ff ff       	call   80100730 <brelse>
+80101b44:	83 c4 10             	add    $0x10,%esp
+80101b47:	e9 44 ff ff ff       	jmp    80101a90 <balloc+0x50>
+80101b4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    goal = bsum.cursor % sb.size;
+80101b50:	a1 a8 0c 8f 80       	mov    0x808f0ca8,%eax
+80101b55:	31 d2                	xor    %edx,%edx
+80101b57:	f7 f1                	div    %ecx
+80101b59:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+80101b5c:	e9 04 ff ff ff       	jmp    80101a65 <balloc+0x25>
+80101b61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(n == 0 && bi/32 == goal % BPB / 32)
+80101b68:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+80101b6b:	39 d9                	cmp    %ebx,%ecx
+80101b6d:	75 b1                	jne    80101b20 <balloc+0xe0>
+        x &= ~0U << (goal % 32);   // prefer goal and after
+80101b6f:	0f b6 4d c4          	movzbl -0x3c(%ebp),%ecx
+80101b73:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80101b78:	d3 e3                	shl    %cl,%ebx
+80101b7a:	21 d8                	and    %ebx,%eax
+      if(x == 0)
+80101b7c:	85 c0                	test   %eax,%eax
+80101b7e:	75 a4                	jne    80101b24 <balloc+0xe4>
+    for(; bi < BPB && bb*BPB + bi < sb.size; bi += 32){
+80101b80:	83 c7 20             	add    $0x20,%edi
+80101b83:	83 45 e0 20          	addl   $0x20,-0x20(%ebp)
+80101b87:	81 ff ff 7f 00 00    	cmp    $0x7fff,%edi
+80101b8d:	0f 86 6b ff ff ff    	jbe    80101afe <balloc+0xbe>
+80101b93:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+80101b96:	eb a1                	jmp    80101b39 <balloc+0xf9>
+80101b98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101b9f:	90                   	nop
+      w[bi/32] |= 1 << (b % 32);   // Mark block in use.
+80101ba0:	89 c3                	mov    %eax,%ebx
+80101ba2:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80101ba5:	8b 55 cc             	mov    -0x34(%ebp),%edx
+      log_write(bp);
+80101ba8:	83 ec 0c             	sub    $0xc,%esp
+      w[bi/32] |= 1 << (b % 32);   // Mark block in use.
+80101bab:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+      bsum.nfree[bb]--;
+80101bae:	83 2c bd a4 0c 8f 80 	subl   $0x1,-0x7f70f35c(,%edi,4)
+80101bb5:	01 
+      w[bi/32] |= 1 << (b % 32);   // Mark block in use.
+80101bb6:	0f ab d8             	bts    %ebx,%eax
+80101bb9:	89 02                	mov    %eax,(%edx)
+      bsum.cursor = b + 1;
+80101bbb:	8d 43 01             	lea    0x1(%ebx),%eax
+80101bbe:	a3 a8 0c 8f 80       	mov    %eax,0x808f0ca8
+      log_write(bp);
+80101bc3:	51                   	push   %ecx
+80101bc4:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80101bc7:	e8 34 2d 00 00       	call   80104900 <log_write>
+      brelse(bp);
+80101bcc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80101bcf:	89 0c 24             	mov    %ecx,(%esp)
+80101bd2:	e8 59 eb ff ff       	call   80100730 <brelse>
+  bp = bread(dev, bno);
+80101bd7:	58                   	pop    %eax
+80101bd8:	5a                   	pop    %edx
+80101bd9:	53                   	push   %ebx
+80101bda:	ff 75 c0             	push   -0x40(%ebp)
+80101bdd:	e8 0e e9 ff ff       	call   801004f0 <bread>
+  memset(bp->data, 0, BSIZE);
+80101be2:	83 c4 0c             	add    $0xc,%esp
+80101be5:	68 00 10 00 00       	push   $0x1000
+  bp = bread(dev, bno);
+80101bea:	89 c6                	mov    %eax,%esi
+  memset(bp->data, 0, BSIZE);
+80101bec:	6a 00                	push   $0x0
+80101bee:	ff 70 60             	push   0x60(%eax)
+80101bf1:	e8 3a 5a 00 00       	call   80107630 <memset>
+  log_write(bp);
+80101bf6:	89 34 24             	mov    %esi,(%esp)
+80101bf9:	e8 02 2d 00 00       	call   80104900 <log_write>
+  brelse(bp);
+80101bfe:	89 34 24             	mov    %esi,(%esp)
+80101c01:	e8 2a eb ff ff       	call   80100730 <brelse>
+}
+80101c06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101c09:	89 d8                	mov    %ebx,%eax
+80101c0b:	5b                   	pop    %ebx
+80101c0c:	5e                   	pop    %esi
+80101c0d:	5f                   	pop    %edi
+80101c0e:	5d                   	pop    %ebp
+80101c0f:	c3                   	ret
+  panic("balloc: out of blocks");
+80101c10:	83 ec 0c             	sub    $0xc,%esp
+80101c13:	68 3a b0 10 80       	push   $0x8010b03a
+80101c18:	e8 63 ec ff ff       	call   80100880 <panic>
+80101c1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80101c20 <dcdrop>:
+
+// Take d out of its hash chain and mark it unused.
+// Caller holds dcache.lock.
+static void
+dcdrop(struct dentry *d)
+{
+80101c20:	55                   	push   %ebp
+80101c21:	89 c1                	mov    %eax,%ecx
+80101c23:	8d 51 08             	lea    0x8(%ecx),%edx
+80101c26:	89 e5                	mov    %esp,%ebp
+80101c28:	57                   	push   %edi
+80101c29:	8d 79 16             	lea    0x16(%ecx),%edi
+80101c2c:	56                   	push   %esi
+80101c2d:	53                   	push   %ebx
+  h = dev*7 + dir;
+80101c2e:	8b 00                	mov    (%eax),%eax
+80101c30:	8d 1c c5 00 00 00 00 	lea    0x0(,%eax,8),%ebx
+80101c37:	29 c3                	sub    %eax,%ebx
+80101c39:	03 59 04             	add    0x4(%ecx),%ebx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101c3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101c40:	0f b6 02             	movzbl (%edx),%eax
+80101c43:	84 c0                	test   %al,%al
+80101c45:	74 11                	je     80101c58 <dcdrop+0x38>
+    h = h*31 + (uchar)name[i];
+80101c47:	89 de                	mov    %ebx,%esi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101c49:	83 c2 01             	add    $0x1,%edx
+    h = h*31 + (uchar)name[i];
+80101c4c:	c1 e6 05             	shl    $0x5,%esi
+80101c4f:	29 de                	sub    %ebx,%esi
+80101c51:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101c54:	39 fa                	cmp    %edi,%edx
+80101c56:	75 e8                	jne    80101c40 <dcdrop+0x20>
+  return h % NDHASH;
+80101c58:	b8 3f c5 25 43       	mov    $0x4325c53f,%eax
+80101c5d:	f7 e3                	mul    %ebx
+80101c5f:	c1 ea 04             	shr    $0x4,%edx
+80101c62:	6b c2 3d             	imul   $0x3d,%edx,%eax
+80101c65:	29 c3                	sub    %eax,%ebx
+  struct dentry **pp;
+
+  for(pp = &dcache.hash[dhash(d->dev, d->dir, d->name)]; *pp != d; pp = &(*pp)->hnext)
+80101c67:	8b 04 9d 94 8c 8e 80 	mov    -0x7f71736c(,%ebx,4),%eax
+80101c6e:	39 c1                	cmp    %eax,%ecx
+80101c70:	74 4e                	je     80101cc0 <dcdrop+0xa0>
+80101c72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80101c78:	89 c2                	mov    %eax,%edx
+80101c7a:	8b 40 20             	mov    0x20(%eax),%eax
+80101c7d:	39 c1                	cmp    %eax,%ecx
+80101c7f:	75 f7                	jne    80101c78 <dcdrop+0x58>
+80101c81:	83 c2 20             	add    $0x20,%edx
+    ;
+  *pp = d->hnext;
+80101c84:	8b 41 20             	mov    0x20(%ecx),%eax
+80101c87:	89 02                	mov    %eax,(%edx)
+  d->next->prev = d->prev;
+80101c89:	8b 51 28             	mov    0x28(%ecx),%edx
+80101c8c:	8b 41 24             	mov    0x24(%ecx),%eax
+  d->dir = 0;
+80101c8f:	c7 41 04 00 00 00 00 	movl   $0x0,0x4(%ecx)
+  d->next->prev = d->prev;
+80101c96:	89 42 24             	mov    %eax,0x24(%edx)
+  d->prev->next = d->next;
+80101c99:	8b 51 28             	mov    0x28(%ecx),%edx
+80101c9c:	89 50 28             	mov    %edx,0x28(%eax)
+    d->prev = &dcache.lru;
+80101c9f:	c7 41 24 88 8d 8e 80 	movl   $0x808e8d88,0x24(%ecx)
+    d->next = dcache.lru.next;
+80101ca6:	a1 b0 8d 8e 80       	mov    0x808e8db0,%eax
+80101cab:	89 41 28             	mov    %eax,0x28(%ecx)
+  d->prev->next = d;
+80101cae:	89 0d b0 8d 8e 80    	mov    %ecx,0x808e8db0
+  d->next->prev = d;
+80101cb4:	8b 41 28             	mov    0x28(%ecx),%eax
+80101cb7:	89 48 24             	mov    %ecx,0x24(%eax)
+  dctouch(d, 1);
+}
+80101cba:	5b                   	pop    %ebx
+80101cbb:	5e                   	pop    %esi
+80101cbc:	5f                   	pop    %edi
+80101cbd:	5d                   	pop    %ebp
+80101cbe:	c3                   	ret
+80101cbf:	90                   	nop
+  for(pp = &dcache.hash[dhash(d->dev, d->dir, d->name)]; *pp != d; pp = &(*pp)->hnext)
+80101cc0:	8d 14 9d 94 8c 8e 80 	lea    -0x7f71736c(,%ebx,4),%edx
+80101cc7:	eb bb                	jmp    80101c84 <dcdrop+0x64>
+80101cc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80101cd0 <dcfind>:
+
+// Find the entry for name in dp. Caller holds dcache.lock.
+static struct dentry*
+dcfind(struct inode *dp, char *name)
+{
+80101cd0:	55                   	push   %ebp
+80101cd1:	89 e5                	mov    %esp,%ebp
+80101cd3:	57                   	push   %edi
+80101cd4:	89 d7                	mov    %edx,%edi
+80101cd6:	56                   	push   %esi
+80101cd7:	89 c6                	mov    %eax,%esi
+80101cd9:	53                   	push   %ebx
+80101cda:	83 ec 1c             	sub    $0x1c,%esp
+  struct dentry *d;
+
+  for(d = dcache.hash[dhash(dp->dev, dp->inum, name)]; d; d = d->hnext)
+80101cdd:	8b 18                	mov    (%eax),%ebx
+  h = dev*7 + dir;
+80101cdf:	89 75 e0             	mov    %esi,-0x20(%ebp)
+80101ce2:	8d 0c dd 00 00 00 00 	lea    0x0(,%ebx,8),%ecx
+80101ce9:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+80101cec:	29 d9                	sub    %ebx,%ecx
+80101cee:	03 48 04             	add    0x4(%eax),%ecx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101cf1:	8d 42 0e             	lea    0xe(%edx),%eax
+80101cf4:	89 c6                	mov    %eax,%esi
+80101cf6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101cfd:	8d 76 00             	lea    0x0(%esi),%esi
+80101d00:	0f b6 1a             	movzbl (%edx),%ebx
+80101d03:	84 db                	test   %bl,%bl
+80101d05:	74 13                	je     80101d1a <dcfind+0x4a>
+    h = h*31 + (uchar)name[i];
+80101d07:	89 c8                	mov    %ecx,%eax
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101d09:	83 c2 01             	add    $0x1,%edx
+    h = h*31 + (uchar)name[i];
+80101d0c:	c1 e0 05             	shl    $0x5,%eax
+80101d0f:	29 c8                	sub    %ecx,%eax
+80101d11:	0f b6 cb             	movzbl %bl,%ecx
+80101d14:	01 c1                	add    %eax,%ecx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101d16:	39 f2                	cmp    %esi,%edx
+80101d18:	75 e6                	jne    80101d00 <dcfind+0x30>
+  return h % NDHASH;
+80101d1a:	b8 3f c5 25 43       	mov    $0x4325c53f,%eax
+80101d1f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80101d22:	8b 75 e0             	mov    -0x20(%ebp),%esi
+80101d25:	f7 e1                	mul    %ecx
+80101d27:	c1 ea 04             	shr    $0x4,%edx
+80101d2a:	6b d2 3d             	imul   $0x3d,%edx,%edx
+80101d2d:	29 d1                	sub    %edx,%ecx
+  for(d = dcache.hash[dhash(dp->dev, dp->inum, name)]; d; d = d->hnext)
+80101d2f:	8b 14 8d 94 8c 8e 80 	mov    -0x7f71736c(,%ecx,4),%edx
+80101d36:	85 d2                	test   %edx,%edx
+80101d38:	74 36                	je     80101d70 <dcfind+0xa0>
+80101d3a:	89 d8                	mov    %ebx,%eax
+80101d3c:	89 d3                	mov    %edx,%ebx
+80101d3e:	eb 09                	jmp    80101d49 <dcfind+0x79>
+80101d40:	8b 5b 20             	mov    0x20(%ebx),%ebx
+80101d43:	85 db                	test   %ebx,%ebx
+80101d45:	74 29                	je     80101d70 <dcfind+0xa0>
+    if(d->dev == dp->dev && d->dir == dp->inum && namecmp(d->name, name) == 0)
+80101d47:	8b 06                	mov    (%esi),%eax
+80101d49:	39 03                	cmp    %eax,(%ebx)
+80101d4b:	75 f3                	jne    80101d40 <dcfind+0x70>
+80101d4d:	8b 46 04             	mov    0x4(%esi),%eax
+80101d50:	39 43 04             	cmp    %eax,0x4(%ebx)
+80101d53:	75 eb                	jne    80101d40 <dcfind+0x70>
+  return strncmp(s, t, DIRSIZ);
+80101d55:	83 ec 04             	sub    $0x4,%esp
+    if(d->dev == dp->dev && d->dir == dp->inum && namecmp(d->name, name) == 0)
+80101d58:	8d 43 08             	lea    0x8(%ebx),%eax
+  return strncmp(s, t, DIRSIZ);
+80101d5b:	6a 0e                	push   $0xe
+80101d5d:	57                   	push   %edi
+80101d5e:	50                   	push   %eax
+80101d5f:	e8 cc 59 00 00       	call   80107730 <strncmp>
+    if(d->dev == dp->dev && d->dir == dp->inum && namecmp(d->name, name) == 0)
+80101d64:	83 c4 10             	add    $0x10,%esp
+80101d67:	85 c0                	test   %eax,%eax
+80101d69:	75 d5                	jne    80101d40 <dcfind+0x70>
+80101d6b:	89 da                	mov    %ebx,%edx
+80101d6d:	eb 03                	jmp    80101d72 <dcfind+0xa2>
+80101d6f:	90                   	nop
+      return d;
+  return 0;
+80101d70:	31 d2                	xor    %edx,%edx
+}
+80101d72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101d75:	89 d0                	mov    %edx,%eax
+80101d77:	5b                   	pop    %ebx
+80101d78:	5e                   	pop    %esi
+80101d79:	5f                   	pop    %edi
+80101d7a:	5d                   	pop    %ebp
+80101d7b:	c3                   	ret
+80101d7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80101d80 <dcenter>:
+
+// Record that name in dp is the dirent at off referring
+// to inum, or that there is no such name if inum is 0.
+static void
+dcenter(struct inode *dp, char *name, uint inum, uint off)
+{
+80101d80:	55                   	push   %ebp
+80101d81:	89 e5                	mov    %esp,%ebp
+80101d83:	57                   	push   %edi
+80101d84:	89 d7                	mov    %edx,%edi
+80101d86:	56                   	push   %esi
+80101d87:	89 c6                	mov    %eax,%esi
+80101d89:	53                   	push   %ebx
+80101d8a:	83 ec 28             	sub    $0x28,%esp
+80101d8d:	8b 45 08             	mov    0x8(%ebp),%eax
+80101d90:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80101d93:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  struct dentry *d;
+  uint h;
+
+  acquire(&dcache.lock);
+80101d96:	68 60 60 8e 80       	push   $0x808e6060
+80101d9b:	e8 b0 57 00 00       	call   80107550 <acquire>
+  if((d = dcfind(dp, name)) == 0){
+80101da0:	89 fa                	mov    %edi,%edx
+80101da2:	89 f0                	mov    %esi,%eax
+80101da4:	e8 27 ff ff ff       	call   80101cd0 <dcfind>
+80101da9:	83 c4 10             	add    $0x10,%esp
+80101dac:	89 c3                	mov    %eax,%ebx
+80101dae:	85 c0                	test   %eax,%eax
+80101db0:	74 4e                	je     80101e00 <dcenter+0x80>
+    strncpy(d->name, name, DIRSIZ);
+    h = dhash(d->dev, d->dir, d->name);
+    d->hnext = dcache.hash[h];
+    dcache.hash[h] = d;
+  }
+  d->inum = inum;
+80101db2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  d->next->prev = d->prev;
+80101db5:	8b 53 28             	mov    0x28(%ebx),%edx
+  d->inum = inum;
+80101db8:	89 43 18             	mov    %eax,0x18(%ebx)
+  d->off = off;
+80101dbb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80101dbe:	89 43 1c             	mov    %eax,0x1c(%ebx)
+  d->next->prev = d->prev;
+80101dc1:	8b 43 24             	mov    0x24(%ebx),%eax
+80101dc4:	89 42 24             	mov    %eax,0x24(%edx)
+  d->prev->next = d->next;
+80101dc7:	8b 53 28             	mov    0x28(%ebx),%edx
+80101dca:	89 50 28             	mov    %edx,0x28(%eax)
+    d->next = &dcache.lru;
+80101dcd:	c7 43 28 88 8d 8e 80 	movl   $0x808e8d88,0x28(%ebx)
+    d->prev = dcache.lru.prev;
+80101dd4:	a1 ac 8d 8e 80       	mov    0x808e8dac,%eax
+80101dd9:	89 43 24             	mov    %eax,0x24(%ebx)
+  d->prev->next = d;
+80101ddc:	89 58 28             	mov    %ebx,0x28(%eax)
+  d->next->prev = d;
+80101ddf:	8b 43 28             	mov    0x28(%ebx),%eax
+80101de2:	89 58 24             	mov    %ebx,0x24(%eax)
+  dctouch(d, 0);
+  release(&dcache.lock);
+80101de5:	c7 45 08 60 60 8e 80 	movl   $0x808e6060,0x8(%ebp)
+}
+80101dec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101def:	5b                   	pop    %ebx
+80101df0:	5e                   	pop    %esi
+80101df1:	5f                   	pop    %edi
+80101df2:	5d                   	pop    %ebp
+  release(&dcache.lock);
+80101df3:	e9 f8 56 00 00       	jmp    801074f0 <release>
+80101df8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101dff:	90                   	nop
+    d = dcache.lru.next;
+80101e00:	8b 1d b0 8d 8e 80    	mov    0x808e8db0,%ebx
+    if(d->dir != 0)
+80101e06:	8b 43 04             	mov    0x4(%ebx),%eax
+80101e09:	85 c0                	test   %eax,%eax
+80101e0b:	0f 85 87 00 00 00    	jne    80101e98 <dcenter+0x118>
+    d->dev = dp->dev;
+80101e11:	8b 06                	mov    (%esi),%eax
+    strncpy(d->name, name, DIRSIZ);
+80101e13:	83 ec 04             	sub    $0x4,%esp
+    d->dev = dp->dev;
+80101e16:	89 03                	mov    %eax,(%ebx)
+    d->dir = dp->inum;
+80101e18:	8b 46 04             	mov    0x4(%esi),%eax
+    strncpy(d->name, name, DIRSIZ);
+80101e1b:	8d 73 08             	lea    0x8(%ebx),%esi
+    d->dir = dp->inum;
+80101e1e:	89 43 04             	mov    %eax,0x4(%ebx)
+    strncpy(d->name, name, DIRSIZ);
+80101e21:	6a 0e                	push   $0xe
+80101e23:	57                   	push   %edi
+80101e24:	8d 7b 16             	lea    0x16(%ebx),%edi
+80101e27:	56                   	push   %esi
+80101e28:	e8 53 59 00 00       	call   80107780 <strncpy>
+  h = dev*7 + dir;
+80101e2d:	8b 03                	mov    (%ebx),%eax
+80101e2f:	89 f2                	mov    %esi,%edx
+80101e31:	83 c4 10             	add    $0x10,%esp
+80101e34:	89 de                	mov    %ebx,%esi
+80101e36:	8d 0c c5 00 00 00 00 	lea    0x0(,%eax,8),%ecx
+80101e3d:	29 c1                	sub    %eax,%ecx
+80101e3f:	03 4b 04             	add    0x4(%ebx),%ecx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101e42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80101e48:	0f b6 1a             	movzbl (%edx),%ebx
+80101e4b:	84 db                	test   %bl,%bl
+80101e4d:	74 13                	je     80101e62 <dcenter+0xe2>
+    h = h*31 + (uchar)name[i];
+80101e4f:	89 c8                	mov    %ecx,%eax
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101e51:	83 c2 01             	add    $0x1,%edx
+    h = h*31 + (uchar)name[i];
+80101e54:	c1 e0 05             	shl    $0x5,%eax
+80101e57:	29 c8                	sub    %ecx,%eax
+80101e59:	0f b6 cb             	movzbl %bl,%ecx
+80101e5c:	01 c1                	add    %eax,%ecx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80101e5e:	39 fa                	cmp    %edi,%edx
+80101e60:	75 e6                	jne    80101e48 <dcenter+0xc8>
+  return h % NDHASH;
+80101e62:	b8 3f c5 25 43       	mov    $0x4325c53f,%eax
+80101e67:	89 f3                	mov    %esi,%ebx
+80101e69:	f7 e1                	mul    %ecx
+80101e6b:	c1 ea 04             	shr    $0x4,%edx
+80101e6e:	6b c2 3d             	imul   $0x3d,%edx,%eax
+80101e71:	29 c1                	sub    %eax,%ecx
+80101e73:	89 ca                	mov    %ecx,%edx
+    d->hnext = dcache.hash[h];
+80101e75:	81 c2 0c 0b 00 00    	add    $0xb0c,%edx
+80101e7b:	8b 04 95 64 60 8e 80 	mov    -0x7f719f9c(,%edx,4),%eax
+80101e82:	89 46 20             	mov    %eax,0x20(%esi)
+    dcache.hash[h] = d;
+80101e85:	89 34 95 64 60 8e 80 	mov    %esi,-0x7f719f9c(,%edx,4)
+80101e8c:	e9 21 ff ff ff       	jmp    80101db2 <dcenter+0x32>
+80101e91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      dcdrop(d);
+80101e98:	89 d8                	mov    %ebx,%eax
+80101e9a:	e8 81 fd ff ff       	call   80101c20 <dcdrop>
+80101e9f:	e9 6d ff ff ff       	jmp    80101e11 <dcenter+0x91>
+80101ea4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101eab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101eaf:	90                   	nop
+
+80101eb0 <bindirect>:
+{
+80101eb0:	55                   	push   %ebp
+80101eb1:	89 e5                	mov    %esp,%ebp
+80101eb3:	57                   	push   %edi
+80101eb4:	89 cf                	mov    %ecx,%edi
+80101eb6:	56                   	push   %esi
+80101eb7:	89 c6                	mov    %eax,%esi
+80101eb9:	53                   	push   %ebx
+80101eba:	83 ec 24             	sub    $0x24,%esp
+  bp = bread(ip->dev, addr);
+80101ebd:	52                   	push   %edx
+80101ebe:	ff 30                	push   (%eax)
+80101ec0:	e8 2b e6 ff ff       	call   801004f0 <bread>
+  if((addr = a[bn]) == 0){
+80101ec5:	83 c4 10             	add    $0x10,%esp
+  bp = bread(ip->dev, addr);
+80101ec8:	89 c3                	mov    %eax,%ebx
+  if((addr = a[bn]) == 0){
+80101eca:	8b 40 60             	mov    0x60(%eax),%eax
+80101ecd:	8d 0c b8             	lea    (%eax,%edi,4),%ecx
+80101ed0:	8b 39                	mov    (%ecx),%edi
+80101ed2:	85 ff                	test   %edi,%edi
+80101ed4:	74 1a                	je     80101ef0 <bindirect+0x40>
+  brelse(bp);
+80101ed6:	83 ec 0c             	sub    $0xc,%esp
+80101ed9:	53                   	push   %ebx
+80101eda:	e8 51 e8 ff ff       	call   80100730 <brelse>
+}
+80101edf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80101ee2:	89 f8                	mov    %edi,%eax
+80101ee4:	5b                   	pop    %ebx
+80101ee5:	5e                   	pop    %esi
+80101ee6:	5f                   	pop    %edi
+80101ee7:	5d                   	pop    %ebp
+80101ee8:	c3                   	ret
+80101ee9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ip->lastblk = balloc(ip->dev, ip->lastblk ? ip->lastblk + 1 : 0);
+80101ef0:	8b 56 5c             	mov    0x5c(%esi),%edx
+80101ef3:	8b 06                	mov    (%esi),%eax
+80101ef5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80101ef8:	83 fa 01             	cmp    $0x1,%edx
+80101efb:	83 da ff             	sbb    $0xffffffff,%edx
+80101efe:	e8 3d fb ff ff       	call   80101a40 <balloc>
+    a[bn] = addr = iballoc(ip);
+80101f03:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    log_write(bp);
+80101f06:	83 ec 0c             	sub    $0xc,%esp
+  ip->lastblk = balloc(ip->dev, ip->lastblk ? ip->lastblk + 1 : 0);
+80101f09:	89 46 5c             	mov    %eax,0x5c(%esi)
+80101f0c:	89 c7                	mov    %eax,%edi
+    a[bn] = addr = iballoc(ip);
+80101f0e:	89 01                	mov    %eax,(%ecx)
+    log_write(bp);
+80101f10:	53                   	push   %ebx
+80101f11:	e8 ea 29 00 00       	call   80104900 <log_write>
+80101f16:	83 c4 10             	add    $0x10,%esp
+80101f19:	eb bb                	jmp    80101ed6 <bindirect+0x26>
+80101f1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80101f1f:	90                   	nop
+
+80101f20 <bmap>:
+{
+80101f20:	55                   	push   %ebp
+80101f21:	89 e5                	mov    %esp,%ebp
+80101f23:	56                   	push   %esi
+80101f24:	53                   	push   %ebx
+80101f25:	89 c3                	mov    %eax,%ebx
+  if(bn < NDIRECT){
+80101f27:	83 fa 0a             	cmp    $0xa,%edx
+80101f2a:	0f 86 80 00 00 00    	jbe    80101fb0 <bmap+0x90>
+  bn -= NDIRECT;
+80101f30:	8d 72 f5             	lea    -0xb(%edx),%esi
+  if(bn < NINDIRECT){
+80101f33:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+80101f39:	76 45                	jbe    80101f80 <bmap+0x60>
+  bn -= NINDIRECT;
+80101f3b:	8d b2 f5 fb ff ff    	lea    -0x40b(%edx),%esi
+  if(bn < NDINDIRECT){
+80101f41:	81 fe ff ff 0f 00    	cmp    $0xfffff,%esi
+80101f47:	0f 87 c1 00 00 00    	ja     8010200e <bmap+0xee>
+    if((addr = ip->addrs[NDIRECT+1]) == 0)
+80101f4d:	8b 90 9c 00 00 00    	mov    0x9c(%eax),%edx
+80101f53:	85 d2                	test   %edx,%edx
+80101f55:	74 71                	je     80101fc8 <bmap+0xa8>
+    addr = bindirect(ip, addr, bn / NINDIRECT);
+80101f57:	89 f1                	mov    %esi,%ecx
+80101f59:	89 d8                	mov    %ebx,%eax
+    return bindirect(ip, addr, bn % NINDIRECT);
+80101f5b:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    addr = bindirect(ip, addr, bn / NINDIRECT);
+80101f61:	c1 e9 0a             	shr    $0xa,%ecx
+80101f64:	e8 47 ff ff ff       	call   80101eb0 <bindirect>
+80101f69:	89 c2                	mov    %eax,%edx
+}
+80101f6b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return bindirect(ip, addr, bn % NINDIRECT);
+80101f6e:	89 f1                	mov    %esi,%ecx
+80101f70:	89 d8                	mov    %ebx,%eax
+}
+80101f72:	5b                   	pop    %ebx
+80101f73:	5e                   	pop    %esi
+80101f74:	5d                   	pop    %ebp
+    return bindirect(ip, addr, bn % NINDIRECT);
+80101f75:	e9 36 ff ff ff       	jmp    80101eb0 <bindirect>
+80101f7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if((addr = ip->addrs[NDIRECT]) == 0)
+80101f80:	8b 90 98 00 00 00    	mov    0x98(%eax),%edx
+80101f86:	85 d2                	test   %edx,%edx
+80101f88:	75 e1                	jne    80101f6b <bmap+0x4b>
+  ip->lastblk = balloc(ip->dev, ip->lastblk ? ip->lastblk + 1 : 0);
+80101f8a:	8b 50 5c             	mov    0x5c(%eax),%edx
+80101f8d:	8b 00                	mov    (%eax),%eax
+80101f8f:	83 fa 01             	cmp    $0x1,%edx
+80101f92:	83 da ff             	sbb    $0xffffffff,%edx
+80101f95:	e8 a6 fa ff ff       	call   80101a40 <balloc>
+80101f9a:	89 43 5c             	mov    %eax,0x5c(%ebx)
+80101f9d:	89 c2                	mov    %eax,%edx
+      ip->addrs[NDIRECT] = addr = iballoc(ip);
+80101f9f:	89 83 98 00 00 00    	mov    %eax,0x98(%ebx)
+    return bindirect(ip, addr, bn);
+80101fa5:	eb c4                	jmp    80101f6b <bmap+0x4b>
+80101fa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101fae:	66 90                	xchg   %ax,%ax
+    if((addr = ip->addrs[bn]) == 0)
+80101fb0:	8d 72 18             	lea    0x18(%edx),%esi
+80101fb3:	8b 44 b0 0c          	mov    0xc(%eax,%esi,4),%eax
+80101fb7:	85 c0                	test   %eax,%eax
+80101fb9:	74 35                	je     80101ff0 <bmap+0xd0>
+}
+80101fbb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80101fbe:	5b                   	pop    %ebx
+80101fbf:	5e                   	pop    %esi
+80101fc0:	5d                   	pop    %ebp
+80101fc1:	c3                   	ret
+80101fc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  ip->lastblk = balloc(ip->dev, ip->lastblk ? ip->lastblk + 1 : 0);
+80101fc8:	8b 50 5c             	mov    0x5c(%eax),%edx
+80101fcb:	8b 00                	mov    (%eax),%eax
+80101fcd:	83 fa 01             	cmp    $0x1,%edx
+80101fd0:	83 da ff             	sbb    $0xffffffff,%edx
+80101fd3:	e8 68 fa ff ff       	call   80101a40 <balloc>
+80101fd8:	89 43 5c             	mov    %eax,0x5c(%ebx)
+80101fdb:	89 c2                	mov    %eax,%edx
+      ip->addrs[NDIRECT+1] = addr = iballoc(ip);
+80101fdd:	89 83 9c 00 00 00    	mov    %eax,0x9c(%ebx)
+80101fe3:	e9 6f ff ff ff       	jmp    80101f57 <bmap+0x37>
+80101fe8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80101fef:	90                   	nop
+  ip->lastblk = balloc(ip->dev, ip->lastblk ? ip->lastblk + 1 : 0);
+80101ff0:	8b 53 5c             	mov    0x5c(%ebx),%edx
+80101ff3:	8b 03                	mov    (%ebx),%eax
+80101ff5:	83 fa 01             	cmp    $0x1,%edx
+80101ff8:	83 da ff             	sbb    $0xffffffff,%edx
+80101ffb:	e8 40 fa ff ff       	call   80101a40 <balloc>
+80102000:	89 43 5c             	mov    %eax,0x5c(%ebx)
+      ip->addrs[bn] = addr = iballoc(ip);
+80102003:	89 44 b3 0c          	mov    %eax,0xc(%ebx,%esi,4)
+}
+80102007:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010200a:	5b                   	pop    %ebx
+8010200b:	5e                   	pop    %esi
+8010200c:	5d                   	pop    %ebp
+8010200d:	c3                   	ret
+  panic("bmap: out of range");
+8010200e:	83 ec 0c             	sub    $0xc,%esp
+80102011:	68 50 b0 10 80       	push   $0x8010b050
+80102016:	e8 65 e8 ff ff       	call   80100880 <panic>
+8010201b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010201f:	90                   	nop
+
+80102020 <readsb>:
+{
+80102020:	55                   	push   %ebp
+80102021:	89 e5                	mov    %esp,%ebp
+80102023:	56                   	push   %esi
+80102024:	53                   	push   %ebx
+80102025:	8b 75 0c             	mov    0xc(%ebp),%esi
+  bp = bread(dev, 1);
+80102028:	83 ec 08             	sub    $0x8,%esp
+8010202b:	6a 01                	push   $0x1
+8010202d:	ff 75 08             	push   0x8(%ebp)
+80102030:	e8 bb e4 ff ff       	call   801004f0 <bread>
+  memmove(sb, bp->data, sizeof(*sb));
+80102035:	83 c4 0c             	add    $0xc,%esp
+80102038:	6a 1c                	push   $0x1c
+  bp = bread(dev, 1);
+8010203a:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+8010203c:	ff 70 60             	push   0x60(%eax)
+8010203f:	56                   	push   %esi
+80102040:	e8 7b 56 00 00       	call   801076c0 <memmove>
+  brelse(bp);
+80102045:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80102048:	83 c4 10             	add    $0x10,%esp
+}
+8010204b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010204e:	5b                   	pop    %ebx
+8010204f:	5e                   	pop    %esi
+80102050:	5d                   	pop    %ebp
+  brelse(bp);
+80102051:	e9 da e6 ff ff       	jmp    80100730 <brelse>
+80102056:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010205d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80102060 <iinit>:
+{
+80102060:	55                   	push   %ebp
+80102061:	89 e5                	mov    %esp,%ebp
+80102063:	57                   	push   %edi
+80102064:	56                   	push   %esi
+80102065:	53                   	push   %ebx
+  for(ip = icache.inode; ip < &icache.inode[NINODE]; ip++){
+80102066:	bb f4 8d 8e 80       	mov    $0x808e8df4,%ebx
+{
+8010206b:	83 ec 34             	sub    $0x34,%esp
+  initlock(&icache.lock, "icache");
+8010206e:	68 63 b0 10 80       	push   $0x8010b063
+80102073:	68 c0 8d 8e 80       	push   $0x808e8dc0
+80102078:	e8 f3 52 00 00       	call   80107370 <initlock>
+  icache.lru.next = &icache.lru;
+8010207d:	83 c4 10             	add    $0x10,%esp
+  icache.lru.prev = &icache.lru;
+80102080:	c7 05 f8 0b 8f 80 e8 	movl   $0x808f0be8,0x808f0bf8
+80102087:	0b 8f 80 
+  icache.lru.next = &icache.lru;
+8010208a:	c7 05 fc 0b 8f 80 e8 	movl   $0x808f0be8,0x808f0bfc
+80102091:	0b 8f 80 
+  for(ip = icache.inode; ip < &icache.inode[NINODE]; ip++){
+80102094:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    initsleeplock(&ip->lock, "inode");
+80102098:	83 ec 08             	sub    $0x8,%esp
+8010209b:	8d 43 18             	lea    0x18(%ebx),%eax
+8010209e:	68 6a b0 10 80       	push   $0x8010b06a
+801020a3:	50                   	push   %eax
+801020a4:	e8 37 51 00 00       	call   801071e0 <initsleeplock>
+  ip->next = &icache.lru;
+801020a9:	c7 43 14 e8 0b 8f 80 	movl   $0x808f0be8,0x14(%ebx)
+  for(ip = icache.inode; ip < &icache.inode[NINODE]; ip++){
+801020b0:	83 c4 10             	add    $0x10,%esp
+  ip->prev = icache.lru.prev;
+801020b3:	a1 f8 0b 8f 80       	mov    0x808f0bf8,%eax
+801020b8:	89 43 10             	mov    %eax,0x10(%ebx)
+  icache.lru.prev->next = ip;
+801020bb:	89 58 14             	mov    %ebx,0x14(%eax)
+    ip->hnext = icache.hash[h];
+801020be:	a1 f4 0a 8f 80       	mov    0x808f0af4,%eax
+  icache.lru.prev = ip;
+801020c3:	89 1d f8 0b 8f 80    	mov    %ebx,0x808f0bf8
+    ip->hnext = icache.hash[h];
+801020c9:	89 43 0c             	mov    %eax,0xc(%ebx)
+    icache.hash[h] = ip;
+801020cc:	89 1d f4 0a 8f 80    	mov    %ebx,0x808f0af4
+  for(ip = icache.inode; ip < &icache.inode[NINODE]; ip++){
+801020d2:	81 c3 a0 00 00 00    	add    $0xa0,%ebx
+801020d8:	81 fb f4 0a 8f 80    	cmp    $0x808f0af4,%ebx
+801020de:	75 b8                	jne    80102098 <iinit+0x38>
+  initlock(&dcache.lock, "dcache");
+801020e0:	83 ec 08             	sub    $0x8,%esp
+801020e3:	68 70 b0 10 80       	push   $0x8010b070
+801020e8:	68 60 60 8e 80       	push   $0x808e6060
+801020ed:	e8 7e 52 00 00       	call   80107370 <initlock>
+  dcache.lru.next = &dcache.lru;
+801020f2:	83 c4 10             	add    $0x10,%esp
+  for(d = dcache.dentry; d < &dcache.dentry[NDENTRY]; d++){
+801020f5:	b8 94 60 8e 80       	mov    $0x808e6094,%eax
+  dcache.lru.prev = &dcache.lru;
+801020fa:	c7 05 ac 8d 8e 80 88 	movl   $0x808e8d88,0x808e8dac
+80102101:	8d 8e 80 
+  dcache.lru.next = &dcache.lru;
+80102104:	c7 05 b0 8d 8e 80 88 	movl   $0x808e8d88,0x808e8db0
+8010210b:	8d 8e 80 
+  for(d = dcache.dentry; d < &dcache.dentry[NDENTRY]; d++){
+8010210e:	66 90                	xchg   %ax,%ax
+    d->next = &dcache.lru;
+80102110:	c7 40 28 88 8d 8e 80 	movl   $0x808e8d88,0x28(%eax)
+    d->prev = dcache.lru.prev;
+80102117:	8b 15 ac 8d 8e 80    	mov    0x808e8dac,%edx
+8010211d:	89 50 24             	mov    %edx,0x24(%eax)
+    dcache.lru.prev->next = d;
+80102120:	89 42 28             	mov    %eax,0x28(%edx)
+    dcache.lru.prev = d;
+80102123:	a3 ac 8d 8e 80       	mov    %eax,0x808e8dac
+  for(d = dcache.dentry; d < &dcache.dentry[NDENTRY]; d++){
+80102128:	83 c0 2c             	add    $0x2c,%eax
+8010212b:	3d 94 8c 8e 80       	cmp    $0x808e8c94,%eax
+80102130:	75 de                	jne    80102110 <iinit+0xb0>
+  bp = bread(dev, 1);
+80102132:	83 ec 08             	sub    $0x8,%esp
+80102135:	6a 01                	push   $0x1
+80102137:	ff 75 08             	push   0x8(%ebp)
+8010213a:	e8 b1 e3 ff ff       	call   801004f0 <bread>
+  memmove(sb, bp->data, sizeof(*sb));
+8010213f:	83 c4 0c             	add    $0xc,%esp
+80102142:	6a 1c                	push   $0x1c
+  bp = bread(dev, 1);
+80102144:	89 c3                	mov    %eax,%ebx
+  memmove(sb, bp->data, sizeof(*sb));
+80102146:	ff 70 60             	push   0x60(%eax)
+80102149:	68 88 0c 8f 80       	push   $0x808f0c88
+8010214e:	e8 6d 55 00 00       	call   801076c0 <memmove>
+  brelse(bp);
+80102153:	89 1c 24             	mov    %ebx,(%esp)
+80102156:	e8 d5 e5 ff ff       	call   80100730 <brelse>
+  if(sb.size > NBMAP*BPB)
+8010215b:	a1 88 0c 8f 80       	mov    0x808f0c88,%eax
+80102160:	83 c4 10             	add    $0x10,%esp
+80102163:	3d 00 80 00 00       	cmp    $0x8000,%eax
+80102168:	0f 87 05 01 00 00    	ja     80102273 <iinit+0x213>
+  for(b = 0; b < sb.size; b += BPB){
+8010216e:	31 f6                	xor    %esi,%esi
+80102170:	85 c0                	test   %eax,%eax
+80102172:	0f 84 c1 00 00 00    	je     80102239 <iinit+0x1d9>
+    bp = bread(dev, BBLOCK(b, sb));
+80102178:	a1 a0 0c 8f 80       	mov    0x808f0ca0,%eax
+8010217d:	89 f3                	mov    %esi,%ebx
+8010217f:	83 ec 08             	sub    $0x8,%esp
+80102182:	c1 eb 0f             	shr    $0xf,%ebx
+80102185:	01 d8                	add    %ebx,%eax
+80102187:	50                   	push   %eax
+80102188:	ff 75 08             	push   0x8(%ebp)
+8010218b:	e8 60 e3 ff ff       	call   801004f0 <bread>
+    w = (uint*)bp->data;
+80102190:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+80102193:	83 c4 10             	add    $0x10,%esp
+80102196:	8b 78 60             	mov    0x60(%eax),%edi
+80102199:	89 45 d8             	mov    %eax,-0x28(%ebp)
+8010219c:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi += 32){
+8010219f:	8b 3d 88 0c 8f 80    	mov    0x808f0c88,%edi
+801021a5:	89 f9                	mov    %edi,%ecx
+801021a7:	89 7d e0             	mov    %edi,-0x20(%ebp)
+801021aa:	31 ff                	xor    %edi,%edi
+801021ac:	29 f1                	sub    %esi,%ecx
+801021ae:	66 90                	xchg   %ax,%ax
+801021b0:	8b 75 e0             	mov    -0x20(%ebp),%esi
+801021b3:	89 f0                	mov    %esi,%eax
+801021b5:	29 c8                	sub    %ecx,%eax
+801021b7:	39 f0                	cmp    %esi,%eax
+801021b9:	73 59                	jae    80102214 <iinit+0x1b4>
+      x = ~w[bi/32];
+801021bb:	8b 75 dc             	mov    -0x24(%ebp),%esi
+801021be:	89 f8                	mov    %edi,%eax
+801021c0:	c1 e8 05             	shr    $0x5,%eax
+801021c3:	8b 04 86             	mov    (%esi,%eax,4),%eax
+801021c6:	f7 d0                	not    %eax
+      if(sb.size - (b + bi) < 32)
+801021c8:	83 f9 1f             	cmp    $0x1f,%ecx
+801021cb:	77 0c                	ja     801021d9 <iinit+0x179>
+        x &= (1 << (sb.size - (b + bi))) - 1;
+801021cd:	ba 01 00 00 00       	mov    $0x1,%edx
+801021d2:	d3 e2                	shl    %cl,%edx
+801021d4:	83 ea 01             	sub    $0x1,%edx
+801021d7:	21 d0                	and    %edx,%eax
+      for(; x; x &= x - 1)
+801021d9:	85 c0                	test   %eax,%eax
+801021db:	74 29                	je     80102206 <iinit+0x1a6>
+801021dd:	8b 34 9d a4 0c 8f 80 	mov    -0x7f70f35c(,%ebx,4),%esi
+801021e4:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+801021e7:	8d 56 01             	lea    0x1(%esi),%edx
+801021ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801021f0:	8d 58 ff             	lea    -0x1(%eax),%ebx
+801021f3:	89 d6                	mov    %edx,%esi
+801021f5:	83 c2 01             	add    $0x1,%edx
+801021f8:	21 d8                	and    %ebx,%eax
+801021fa:	75 f4                	jne    801021f0 <iinit+0x190>
+801021fc:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+801021ff:	89 34 9d a4 0c 8f 80 	mov    %esi,-0x7f70f35c(,%ebx,4)
+    for(bi = 0; bi < BPB && b + bi < sb.size; bi += 32){
+80102206:	83 c7 20             	add    $0x20,%edi
+80102209:	83 e9 20             	sub    $0x20,%ecx
+8010220c:	81 ff 00 80 00 00    	cmp    $0x8000,%edi
+80102212:	75 9c                	jne    801021b0 <iinit+0x150>
+80102214:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    brelse(bp);
+80102217:	83 ec 0c             	sub    $0xc,%esp
+8010221a:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+8010221d:	50                   	push   %eax
+  for(b = 0; b < sb.size; b += BPB){
+8010221e:	81 c6 00 80 00 00    	add    $0x8000,%esi
+    brelse(bp);
+80102224:	e8 07 e5 ff ff       	call   80100730 <brelse>
+  for(b = 0; b < sb.size; b += BPB){
+80102229:	a1 88 0c 8f 80       	mov    0x808f0c88,%eax
+8010222e:	83 c4 10             	add    $0x10,%esp
+80102231:	39 c6                	cmp    %eax,%esi
+80102233:	0f 82 3f ff ff ff    	jb     80102178 <iinit+0x118>
+  cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
+80102239:	ff 35 a0 0c 8f 80    	push   0x808f0ca0
+8010223f:	ff 35 9c 0c 8f 80    	push   0x808f0c9c
+80102245:	ff 35 98 0c 8f 80    	push   0x808f0c98
+8010224b:	ff 35 94 0c 8f 80    	push   0x808f0c94
+80102251:	ff 35 90 0c 8f 80    	push   0x808f0c90
+80102257:	ff 35 8c 0c 8f 80    	push   0x808f0c8c
+8010225d:	50                   	push   %eax
+8010225e:	68 e8 b0 10 80       	push   $0x8010b0e8
+80102263:	e8 48 e9 ff ff       	call   80100bb0 <cprintf>
+}
+80102268:	83 c4 20             	add    $0x20,%esp
+8010226b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010226e:	5b                   	pop    %ebx
+8010226f:	5e                   	pop    %esi
+80102270:	5f                   	pop    %edi
+80102271:	5d                   	pop    %ebp
+80102272:	c3                   	ret
+    panic("bsuminit: bitmap too big");
+80102273:	83 ec 0c             	sub    $0xc,%esp
+80102276:	68 77 b0 10 80       	push   $0x8010b077
+8010227b:	e8 00 e6 ff ff       	call   80100880 <panic>
+
+80102280 <ialloc>:
+{
+80102280:	55                   	push   %ebp
+80102281:	89 e5                	mov    %esp,%ebp
+80102283:	57                   	push   %edi
+80102284:	56                   	push   %esi
+80102285:	53                   	push   %ebx
+80102286:	83 ec 1c             	sub    $0x1c,%esp
+80102289:	8b 45 0c             	mov    0xc(%ebp),%eax
+  for(inum = 1; inum < sb.ninodes; inum++){
+8010228c:	83 3d 90 0c 8f 80 01 	cmpl   $0x1,0x808f0c90
+{
+80102293:	8b 75 08             	mov    0x8(%ebp),%esi
+80102296:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(inum = 1; inum < sb.ninodes; inum++){
+80102299:	0f 86 94 00 00 00    	jbe    80102333 <ialloc+0xb3>
+8010229f:	bf 01 00 00 00       	mov    $0x1,%edi
+801022a4:	eb 21                	jmp    801022c7 <ialloc+0x47>
+801022a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801022ad:	8d 76 00             	lea    0x0(%esi),%esi
+    brelse(bp);
+801022b0:	83 ec 0c             	sub    $0xc,%esp
+  for(inum = 1; inum < sb.ninodes; inum++){
+801022b3:	83 c7 01             	add    $0x1,%edi
+    brelse(bp);
+801022b6:	50                   	push   %eax
+801022b7:	e8 74 e4 ff ff       	call   80100730 <brelse>
+  for(inum = 1; inum < sb.ninodes; inum++){
+801022bc:	83 c4 10             	add    $0x10,%esp
+801022bf:	3b 3d 90 0c 8f 80    	cmp    0x808f0c90,%edi
+801022c5:	73 6c                	jae    80102333 <ialloc+0xb3>
+    bp = bread(dev, IBLOCK(inum, sb));
+801022c7:	89 f8                	mov    %edi,%eax
+801022c9:	83 ec 08             	sub    $0x8,%esp
+    dip = (struct dinode*)bp->data + inum%IPB;
+801022cc:	89 fb                	mov    %edi,%ebx
+    bp = bread(dev, IBLOCK(inum, sb));
+801022ce:	c1 e8 06             	shr    $0x6,%eax
+801022d1:	03 05 9c 0c 8f 80    	add    0x808f0c9c,%eax
+    dip = (struct dinode*)bp->data + inum%IPB;
+801022d7:	83 e3 3f             	and    $0x3f,%ebx
+    bp = bread(dev, IBLOCK(inum, sb));
+801022da:	50                   	push   %eax
+    dip = (struct dinode*)bp->data + inum%IPB;
+801022db:	c1 e3 06             	shl    $0x6,%ebx
+    bp = bread(dev, IBLOCK(inum, sb));
+801022de:	56                   	push   %esi
+801022df:	e8 0c e2 ff ff       	call   801004f0 <bread>
+    if(dip->type == 0){  // a free inode
+801022e4:	83 c4 10             	add    $0x10,%esp
+    dip = (struct dinode*)bp->data + inum%IPB;
+801022e7:	03 58 60             	add    0x60(%eax),%ebx
+    if(dip->type == 0){  // a free inode
+801022ea:	66 83 3b 00          	cmpw   $0x0,(%ebx)
+801022ee:	75 c0                	jne    801022b0 <ialloc+0x30>
+      memset(dip, 0, sizeof(*dip));
+801022f0:	83 ec 04             	sub    $0x4,%esp
+801022f3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+801022f6:	6a 40                	push   $0x40
+801022f8:	6a 00                	push   $0x0
+801022fa:	53                   	push   %ebx
+801022fb:	e8 30 53 00 00       	call   80107630 <memset>
+      dip->type = type;
+80102300:	0f b7 45 e4          	movzwl -0x1c(%ebp),%eax
+      log_write(bp);   // mark it allocated on the disk
+80102304:	8b 55 e0             	mov    -0x20(%ebp),%edx
+      dip->type = type;
+80102307:	66 89 03             	mov    %ax,(%ebx)
+      log_write(bp);   // mark it allocated on the disk
+8010230a:	89 14 24             	mov    %edx,(%esp)
+8010230d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80102310:	e8 eb 25 00 00       	call   80104900 <log_write>
+      brelse(bp);
+80102315:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102318:	89 14 24             	mov    %edx,(%esp)
+8010231b:	e8 10 e4 ff ff       	call   80100730 <brelse>
+      return iget(dev, inum);
+80102320:	83 c4 10             	add    $0x10,%esp
+}
+80102323:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return iget(dev, inum);
+80102326:	89 fa                	mov    %edi,%edx
+}
+80102328:	5b                   	pop    %ebx
+      return iget(dev, inum);
+80102329:	89 f0                	mov    %esi,%eax
+}
+8010232b:	5e                   	pop    %esi
+8010232c:	5f                   	pop    %edi
+8010232d:	5d                   	pop    %ebp
+      return iget(dev, inum);
+8010232e:	e9 bd f5 ff ff       	jmp    801018f0 <iget>
+  panic("ialloc: no inodes");
+80102333:	83 ec 0c             	sub    $0xc,%esp
+80102336:	68 90 b0 10 80       	push   $0x8010b090
+8010233b:	e8 40 e5 ff ff       	call   80100880 <panic>
+
+80102340 <iupdate>:
+{
+80102340:	55                   	push   %ebp
+80102341:	89 e5                	mov    %esp,%ebp
+80102343:	56                   	push   %esi
+80102344:	53                   	push   %ebx
+80102345:	8b 75 08             	mov    0x8(%ebp),%esi
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80102348:	8b 46 04             	mov    0x4(%esi),%eax
+8010234b:	83 ec 08             	sub    $0x8,%esp
+8010234e:	c1 e8 06             	shr    $0x6,%eax
+80102351:	03 05 9c 0c 8f 80    	add    0x808f0c9c,%eax
+80102357:	50                   	push   %eax
+80102358:	ff 36                	push   (%esi)
+8010235a:	e8 91 e1 ff ff       	call   801004f0 <bread>
+  dip->type = ip->type;
+8010235f:	0f b7 56 60          	movzwl 0x60(%esi),%edx
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80102363:	83 c4 0c             	add    $0xc,%esp
+  bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+80102366:	89 c3                	mov    %eax,%ebx
+  dip = (struct dinode*)bp->data + ip->inum%IPB;
+80102368:	8b 46 04             	mov    0x4(%esi),%eax
+8010236b:	83 e0 3f             	and    $0x3f,%eax
+8010236e:	c1 e0 06             	shl    $0x6,%eax
+80102371:	03 43 60             	add    0x60(%ebx),%eax
+  dip->type = ip->type;
+80102374:	66 89 10             	mov    %dx,(%eax)
+  dip->major = ip->major;
+80102377:	0f b7 56 62          	movzwl 0x62(%esi),%edx
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+8010237b:	83 c0 0c             	add    $0xc,%eax
+  dip->major = ip->major;
+8010237e:	66 89 50 f6          	mov    %dx,-0xa(%eax)
+  dip->minor = ip->minor;
+80102382:	0f b7 56 64          	movzwl 0x64(%esi),%edx
+80102386:	66 89 50 f8          	mov    %dx,-0x8(%eax)
+  dip->nlink = ip->nlink;
+8010238a:	0f b7 56 66          	movzwl 0x66(%esi),%edx
+8010238e:	66 89 50 fa          	mov    %dx,-0x6(%eax)
+  dip->size = ip->size;
+80102392:	8b 56 68             	mov    0x68(%esi),%edx
+80102395:	89 50 fc             	mov    %edx,-0x4(%eax)
+  memmove(dip->addrs, ip->addrs, sizeof(ip->addrs));
+80102398:	8d 56 6c             	lea    0x6c(%esi),%edx
+8010239b:	6a 34                	push   $0x34
+8010239d:	52                   	push   %edx
+8010239e:	50                   	push   %eax
+8010239f:	e8 1c 53 00 00       	call   801076c0 <memmove>
+  log_write(bp);
+801023a4:	89 1c 24             	mov    %ebx,(%esp)
+801023a7:	e8 54 25 00 00       	call   80104900 <log_write>
+  brelse(bp);
+801023ac:	89 5d 08             	mov    %ebx,0x8(%ebp)
+801023af:	83 c4 10             	add    $0x10,%esp
+}
+801023b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801023b5:	5b                   	pop    %ebx
+801023b6:	5e                   	pop    %esi
+801023b7:	5d                   	pop    %ebp
+  brelse(bp);
+801023b8:	e9 73 e3 ff ff       	jmp    80100730 <brelse>
+801023bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+801023c0 <dxlink>:
+// Add (name, inum) to the hashed directory dp, splitting
+// its leaf if that is full. Return -1 if the leaf cannot
+// be split.
+static int
+dxlink(struct inode *dp, char *name, uint inum)
+{
+801023c0:	55                   	push   %ebp
+801023c1:	89 e5                	mov    %esp,%ebp
+801023c3:	57                   	push   %edi
+801023c4:	56                   	push   %esi
+801023c5:	53                   	push   %ebx
+801023c6:	89 c3                	mov    %eax,%ebx
+801023c8:	83 ec 5c             	sub    $0x5c,%esp
+801023cb:	89 55 b0             	mov    %edx,-0x50(%ebp)
+  h = 2166136261U;
+801023ce:	c7 45 e0 c5 9d 1c 81 	movl   $0x811c9dc5,-0x20(%ebp)
+{
+801023d5:	89 4d ac             	mov    %ecx,-0x54(%ebp)
+801023d8:	8d 4a 0e             	lea    0xe(%edx),%ecx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+801023db:	0f b6 02             	movzbl (%edx),%eax
+801023de:	84 c0                	test   %al,%al
+801023e0:	74 15                	je     801023f7 <dxlink+0x37>
+    h = (h ^ (uchar)name[i]) * 16777619;
+801023e2:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+801023e5:	83 c2 01             	add    $0x1,%edx
+    h = (h ^ (uchar)name[i]) * 16777619;
+801023e8:	31 f0                	xor    %esi,%eax
+801023ea:	69 c0 93 01 00 01    	imul   $0x1000193,%eax,%eax
+801023f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+801023f3:	39 ca                	cmp    %ecx,%edx
+801023f5:	75 e4                	jne    801023db <dxlink+0x1b>
+    if((addr = ip->addrs[bn]) == 0)
+801023f7:	8b 43 6c             	mov    0x6c(%ebx),%eax
+801023fa:	85 c0                	test   %eax,%eax
+801023fc:	0f 84 c8 03 00 00    	je     801027ca <dxlink+0x40a>
+  struct dirent *de, *nde;
+  uint h, m, bn, nb;
+  int i, j, k, n;
+
+  h = dirhash(name);
+  bp = bread(dp->dev, bmap(dp, 0));
+80102402:	83 ec 08             	sub    $0x8,%esp
+  lo = 0;
+80102405:	31 ff                	xor    %edi,%edi
+  bp = bread(dp->dev, bmap(dp, 0));
+80102407:	50                   	push   %eax
+80102408:	ff 33                	push   (%ebx)
+8010240a:	e8 e1 e0 ff ff       	call   801004f0 <bread>
+  while(lo < hi){
+8010240f:	83 c4 10             	add    $0x10,%esp
+  bp = bread(dp->dev, bmap(dp, 0));
+80102412:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  dx = (struct dxentry*)bp->data;
+80102415:	8b 40 60             	mov    0x60(%eax),%eax
+80102418:	89 45 bc             	mov    %eax,-0x44(%ebp)
+  n = dp->size/BSIZE - 1;
+8010241b:	8b 43 68             	mov    0x68(%ebx),%eax
+8010241e:	c1 e8 0c             	shr    $0xc,%eax
+80102421:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  hi = n - 1;
+80102424:	8d 50 fe             	lea    -0x2(%eax),%edx
+  while(lo < hi){
+80102427:	eb 18                	jmp    80102441 <dxlink+0x81>
+    mid = (lo + hi + 1) / 2;
+80102429:	8d 44 17 01          	lea    0x1(%edi,%edx,1),%eax
+    if(dx[mid].hash <= h)
+8010242d:	8b 75 bc             	mov    -0x44(%ebp),%esi
+80102430:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    mid = (lo + hi + 1) / 2;
+80102433:	d1 f8                	sar    %eax
+    if(dx[mid].hash <= h)
+80102435:	3b 4c c6 04          	cmp    0x4(%esi,%eax,8),%ecx
+80102439:	0f 82 da 00 00 00    	jb     80102519 <dxlink+0x159>
+    mid = (lo + hi + 1) / 2;
+8010243f:	89 c7                	mov    %eax,%edi
+  while(lo < hi){
+80102441:	39 d7                	cmp    %edx,%edi
+80102443:	7c e4                	jl     80102429 <dxlink+0x69>
+  k = dxfind(dx, n, h);
+  bn = dx[k].blk;
+80102445:	8d 04 fd 00 00 00 00 	lea    0x0(,%edi,8),%eax
+8010244c:	89 45 b8             	mov    %eax,-0x48(%ebp)
+8010244f:	8b 45 bc             	mov    -0x44(%ebp),%eax
+80102452:	0f b7 44 f8 02       	movzwl 0x2(%eax,%edi,8),%eax
+  lp = bread(dp->dev, bmap(dp, bn));
+80102457:	89 c2                	mov    %eax,%edx
+  bn = dx[k].blk;
+80102459:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+  lp = bread(dp->dev, bmap(dp, bn));
+8010245c:	89 d8                	mov    %ebx,%eax
+8010245e:	e8 bd fa ff ff       	call   80101f20 <bmap>
+80102463:	83 ec 08             	sub    $0x8,%esp
+80102466:	50                   	push   %eax
+80102467:	ff 33                	push   (%ebx)
+80102469:	e8 82 e0 ff ff       	call   801004f0 <bread>
+  de = (struct dirent*)lp->data;
+8010246e:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < DPB; i++)
+80102471:	31 d2                	xor    %edx,%edx
+  lp = bread(dp->dev, bmap(dp, bn));
+80102473:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  de = (struct dirent*)lp->data;
+80102476:	8b 40 60             	mov    0x60(%eax),%eax
+80102479:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  for(i = 0; i < DPB; i++)
+8010247c:	eb 0f                	jmp    8010248d <dxlink+0xcd>
+8010247e:	83 c2 01             	add    $0x1,%edx
+80102481:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+80102487:	0f 84 94 00 00 00    	je     80102521 <dxlink+0x161>
+    if(de[i].inum == 0)
+8010248d:	8b 75 d0             	mov    -0x30(%ebp),%esi
+80102490:	89 d0                	mov    %edx,%eax
+80102492:	c1 e0 04             	shl    $0x4,%eax
+80102495:	66 83 3c 06 00       	cmpw   $0x0,(%esi,%eax,1)
+8010249a:	75 e2                	jne    8010247e <dxlink+0xbe>
+
+  strncpy(de[i].name, name, DIRSIZ);
+  de[i].inum = inum;
+  log_write(lp);
+  brelse(lp);
+  dcenter(dp, name, inum, bn*BSIZE + i*sizeof(*de));
+8010249c:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+  strncpy(de[i].name, name, DIRSIZ);
+8010249f:	89 d7                	mov    %edx,%edi
+  dcenter(dp, name, inum, bn*BSIZE + i*sizeof(*de));
+801024a1:	c1 e6 08             	shl    $0x8,%esi
+801024a4:	89 75 c8             	mov    %esi,-0x38(%ebp)
+  de = (struct dirent*)lp->data;
+801024a7:	8b 75 d0             	mov    -0x30(%ebp),%esi
+801024aa:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  dcenter(dp, name, inum, bn*BSIZE + i*sizeof(*de));
+801024ad:	8b 75 d8             	mov    -0x28(%ebp),%esi
+  brelse(bp);
+801024b0:	83 ec 0c             	sub    $0xc,%esp
+801024b3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+801024b6:	ff 75 c0             	push   -0x40(%ebp)
+801024b9:	e8 72 e2 ff ff       	call   80100730 <brelse>
+  strncpy(de[i].name, name, DIRSIZ);
+801024be:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801024c1:	8b 55 dc             	mov    -0x24(%ebp),%edx
+801024c4:	83 c4 0c             	add    $0xc,%esp
+801024c7:	6a 0e                	push   $0xe
+801024c9:	01 c2                	add    %eax,%edx
+801024cb:	ff 75 b0             	push   -0x50(%ebp)
+801024ce:	8d 42 02             	lea    0x2(%edx),%eax
+801024d1:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801024d4:	50                   	push   %eax
+801024d5:	e8 a6 52 00 00       	call   80107780 <strncpy>
+  de[i].inum = inum;
+801024da:	0f b7 45 ac          	movzwl -0x54(%ebp),%eax
+801024de:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801024e1:	66 89 02             	mov    %ax,(%edx)
+  log_write(lp);
+801024e4:	89 34 24             	mov    %esi,(%esp)
+801024e7:	e8 14 24 00 00       	call   80104900 <log_write>
+  brelse(lp);
+801024ec:	89 34 24             	mov    %esi,(%esp)
+801024ef:	e8 3c e2 ff ff       	call   80100730 <brelse>
+  dcenter(dp, name, inum, bn*BSIZE + i*sizeof(*de));
+801024f4:	8b 45 c8             	mov    -0x38(%ebp),%eax
+801024f7:	01 f8                	add    %edi,%eax
+801024f9:	c1 e0 04             	shl    $0x4,%eax
+801024fc:	89 04 24             	mov    %eax,(%esp)
+801024ff:	8b 4d ac             	mov    -0x54(%ebp),%ecx
+80102502:	89 d8                	mov    %ebx,%eax
+80102504:	8b 55 b0             	mov    -0x50(%ebp),%edx
+80102507:	e8 74 f8 ff ff       	call   80101d80 <dcenter>
+  return 0;
+8010250c:	83 c4 10             	add    $0x10,%esp
+8010250f:	31 c0                	xor    %eax,%eax
+}
+80102511:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102514:	5b                   	pop    %ebx
+80102515:	5e                   	pop    %esi
+80102516:	5f                   	pop    %edi
+80102517:	5d                   	pop    %ebp
+80102518:	c3                   	ret
+      hi = mid - 1;
+80102519:	8d 50 ff             	lea    -0x1(%eax),%edx
+8010251c:	e9 20 ff ff ff       	jmp    80102441 <dxlink+0x81>
+  n = dp->size/BSIZE - 1;
+80102521:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+80102524:	8d 70 ff             	lea    -0x1(%eax),%esi
+80102527:	89 75 a4             	mov    %esi,-0x5c(%ebp)
+    if(n == NDXENTRY || (m = dxmedian(de, h)) == 0){
+8010252a:	3d 01 02 00 00       	cmp    $0x201,%eax
+8010252f:	0f 84 d0 02 00 00    	je     80102805 <dxlink+0x445>
+80102535:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  best = 0;
+80102538:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%ebp)
+  for(i = 0; i <= DPB; i++){
+8010253f:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+80102546:	8d 70 02             	lea    0x2(%eax),%esi
+  bestd = DPB + 1;
+80102549:	c7 45 c8 01 01 00 00 	movl   $0x101,-0x38(%ebp)
+80102550:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+80102553:	8d 70 10             	lea    0x10(%eax),%esi
+80102556:	05 10 10 00 00       	add    $0x1010,%eax
+8010255b:	89 75 a8             	mov    %esi,-0x58(%ebp)
+8010255e:	89 7d a0             	mov    %edi,-0x60(%ebp)
+80102561:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80102564:	89 d8                	mov    %ebx,%eax
+    x = i < DPB ? dirhash(de[i].name) : h;
+80102566:	8b 75 dc             	mov    -0x24(%ebp),%esi
+80102569:	81 fe 00 01 00 00    	cmp    $0x100,%esi
+8010256f:	0f 84 4b 02 00 00    	je     801027c0 <dxlink+0x400>
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80102575:	c1 e6 04             	shl    $0x4,%esi
+    x = i < DPB ? dirhash(de[i].name) : h;
+80102578:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+  h = 2166136261U;
+8010257b:	bf c5 9d 1c 81       	mov    $0x811c9dc5,%edi
+80102580:	89 f3                	mov    %esi,%ebx
+80102582:	8b 75 a8             	mov    -0x58(%ebp),%esi
+80102585:	01 f3                	add    %esi,%ebx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80102587:	0f b6 11             	movzbl (%ecx),%edx
+8010258a:	84 d2                	test   %dl,%dl
+8010258c:	74 0f                	je     8010259d <dxlink+0x1dd>
+    h = (h ^ (uchar)name[i]) * 16777619;
+8010258e:	31 d7                	xor    %edx,%edi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80102590:	83 c1 01             	add    $0x1,%ecx
+    h = (h ^ (uchar)name[i]) * 16777619;
+80102593:	69 ff 93 01 00 01    	imul   $0x1000193,%edi,%edi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80102599:	39 d9                	cmp    %ebx,%ecx
+8010259b:	75 ea                	jne    80102587 <dxlink+0x1c7>
+    below = h < x;
+8010259d:	31 db                	xor    %ebx,%ebx
+8010259f:	39 7d e0             	cmp    %edi,-0x20(%ebp)
+801025a2:	0f 92 c3             	setb   %bl
+801025a5:	89 de                	mov    %ebx,%esi
+    for(j = 0; j < DPB; j++)
+801025a7:	8b 5d a8             	mov    -0x58(%ebp),%ebx
+801025aa:	89 45 98             	mov    %eax,-0x68(%ebp)
+801025ad:	89 5d 9c             	mov    %ebx,-0x64(%ebp)
+      if(dirhash(de[j].name) < x)
+801025b0:	8d 4b f2             	lea    -0xe(%ebx),%ecx
+  h = 2166136261U;
+801025b3:	ba c5 9d 1c 81       	mov    $0x811c9dc5,%edx
+801025b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801025bf:	90                   	nop
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+801025c0:	0f b6 01             	movzbl (%ecx),%eax
+801025c3:	84 c0                	test   %al,%al
+801025c5:	74 0f                	je     801025d6 <dxlink+0x216>
+    h = (h ^ (uchar)name[i]) * 16777619;
+801025c7:	31 d0                	xor    %edx,%eax
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+801025c9:	83 c1 01             	add    $0x1,%ecx
+    h = (h ^ (uchar)name[i]) * 16777619;
+801025cc:	69 d0 93 01 00 01    	imul   $0x1000193,%eax,%edx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+801025d2:	39 d9                	cmp    %ebx,%ecx
+801025d4:	75 ea                	jne    801025c0 <dxlink+0x200>
+        below++;
+801025d6:	39 fa                	cmp    %edi,%edx
+    for(j = 0; j < DPB; j++)
+801025d8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+        below++;
+801025db:	83 d6 00             	adc    $0x0,%esi
+    for(j = 0; j < DPB; j++)
+801025de:	83 c3 10             	add    $0x10,%ebx
+801025e1:	39 c3                	cmp    %eax,%ebx
+801025e3:	75 cb                	jne    801025b0 <dxlink+0x1f0>
+    if(below == 0)
+801025e5:	8b 4d 9c             	mov    -0x64(%ebp),%ecx
+801025e8:	8b 45 98             	mov    -0x68(%ebp),%eax
+801025eb:	85 f6                	test   %esi,%esi
+801025ed:	74 17                	je     80102606 <dxlink+0x246>
+    d = below - (DPB+1)/2;
+801025ef:	83 c6 80             	add    $0xffffff80,%esi
+    if(d < 0)
+801025f2:	89 f2                	mov    %esi,%edx
+801025f4:	f7 da                	neg    %edx
+801025f6:	0f 48 d6             	cmovs  %esi,%edx
+    if(d < bestd){
+801025f9:	8b 75 c8             	mov    -0x38(%ebp),%esi
+801025fc:	39 f2                	cmp    %esi,%edx
+801025fe:	7d 06                	jge    80102606 <dxlink+0x246>
+80102600:	89 55 c8             	mov    %edx,-0x38(%ebp)
+      best = x;
+80102603:	89 7d cc             	mov    %edi,-0x34(%ebp)
+  for(i = 0; i <= DPB; i++){
+80102606:	83 45 dc 01          	addl   $0x1,-0x24(%ebp)
+8010260a:	8b 75 dc             	mov    -0x24(%ebp),%esi
+8010260d:	83 45 c4 10          	addl   $0x10,-0x3c(%ebp)
+80102611:	81 fe 01 01 00 00    	cmp    $0x101,%esi
+80102617:	0f 85 49 ff ff ff    	jne    80102566 <dxlink+0x1a6>
+    if(n == NDXENTRY || (m = dxmedian(de, h)) == 0){
+8010261d:	8b 75 cc             	mov    -0x34(%ebp),%esi
+80102620:	8b 7d a0             	mov    -0x60(%ebp),%edi
+80102623:	89 c3                	mov    %eax,%ebx
+80102625:	85 f6                	test   %esi,%esi
+80102627:	0f 84 d8 01 00 00    	je     80102805 <dxlink+0x445>
+    np = bread(dp->dev, bmap(dp, nb));
+8010262d:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+80102630:	89 4d a0             	mov    %ecx,-0x60(%ebp)
+80102633:	e8 e8 f8 ff ff       	call   80101f20 <bmap>
+80102638:	83 ec 08             	sub    $0x8,%esp
+8010263b:	50                   	push   %eax
+8010263c:	ff 33                	push   (%ebx)
+8010263e:	e8 ad de ff ff       	call   801004f0 <bread>
+    for(i = j = 0; i < DPB; i++){
+80102643:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+      dcmove(dp, nde[j].name, nb*BSIZE + j*sizeof(*de));
+8010264a:	83 c4 10             	add    $0x10,%esp
+    np = bread(dp->dev, bmap(dp, nb));
+8010264d:	89 c6                	mov    %eax,%esi
+    nde = (struct dirent*)np->data;
+8010264f:	8b 48 60             	mov    0x60(%eax),%ecx
+      dcmove(dp, nde[j].name, nb*BSIZE + j*sizeof(*de));
+80102652:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    for(i = j = 0; i < DPB; i++){
+80102655:	89 75 a8             	mov    %esi,-0x58(%ebp)
+80102658:	8b 75 a0             	mov    -0x60(%ebp),%esi
+      dcmove(dp, nde[j].name, nb*BSIZE + j*sizeof(*de));
+8010265b:	c1 e0 08             	shl    $0x8,%eax
+    nde = (struct dirent*)np->data;
+8010265e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+      dcmove(dp, nde[j].name, nb*BSIZE + j*sizeof(*de));
+80102661:	89 45 c8             	mov    %eax,-0x38(%ebp)
+      if(dirhash(de[i].name) < m)
+80102664:	8d 4e f2             	lea    -0xe(%esi),%ecx
+  h = 2166136261U;
+80102667:	ba c5 9d 1c 81       	mov    $0x811c9dc5,%edx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+8010266c:	0f b6 01             	movzbl (%ecx),%eax
+8010266f:	84 c0                	test   %al,%al
+80102671:	74 0f                	je     80102682 <dxlink+0x2c2>
+    h = (h ^ (uchar)name[i]) * 16777619;
+80102673:	31 d0                	xor    %edx,%eax
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80102675:	83 c1 01             	add    $0x1,%ecx
+    h = (h ^ (uchar)name[i]) * 16777619;
+80102678:	69 d0 93 01 00 01    	imul   $0x1000193,%eax,%edx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+8010267e:	39 ce                	cmp    %ecx,%esi
+80102680:	75 ea                	jne    8010266c <dxlink+0x2ac>
+      if(dirhash(de[i].name) < m)
+80102682:	8b 45 cc             	mov    -0x34(%ebp),%eax
+80102685:	39 c2                	cmp    %eax,%edx
+80102687:	72 77                	jb     80102700 <dxlink+0x340>
+      nde[j] = de[i];
+80102689:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+8010268c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+      memset(&de[i], 0, sizeof(de[i]));
+8010268f:	83 ec 04             	sub    $0x4,%esp
+      nde[j] = de[i];
+80102692:	c1 e2 04             	shl    $0x4,%edx
+80102695:	01 c2                	add    %eax,%edx
+80102697:	8b 46 f0             	mov    -0x10(%esi),%eax
+8010269a:	89 55 a0             	mov    %edx,-0x60(%ebp)
+8010269d:	89 02                	mov    %eax,(%edx)
+8010269f:	8b 46 f4             	mov    -0xc(%esi),%eax
+801026a2:	89 42 04             	mov    %eax,0x4(%edx)
+801026a5:	8b 46 f8             	mov    -0x8(%esi),%eax
+801026a8:	89 42 08             	mov    %eax,0x8(%edx)
+801026ab:	8b 46 fc             	mov    -0x4(%esi),%eax
+801026ae:	89 42 0c             	mov    %eax,0xc(%edx)
+      if(dirhash(de[i].name) < m)
+801026b1:	8d 46 f0             	lea    -0x10(%esi),%eax
+      memset(&de[i], 0, sizeof(de[i]));
+801026b4:	6a 10                	push   $0x10
+801026b6:	6a 00                	push   $0x0
+801026b8:	50                   	push   %eax
+801026b9:	e8 72 4f 00 00       	call   80107630 <memset>
+  acquire(&dcache.lock);
+801026be:	c7 04 24 60 60 8e 80 	movl   $0x808e6060,(%esp)
+801026c5:	e8 86 4e 00 00       	call   80107550 <acquire>
+      dcmove(dp, nde[j].name, nb*BSIZE + j*sizeof(*de));
+801026ca:	8b 55 a0             	mov    -0x60(%ebp),%edx
+  if((d = dcfind(dp, name)) != 0)
+801026cd:	89 d8                	mov    %ebx,%eax
+      dcmove(dp, nde[j].name, nb*BSIZE + j*sizeof(*de));
+801026cf:	83 c2 02             	add    $0x2,%edx
+  if((d = dcfind(dp, name)) != 0)
+801026d2:	e8 f9 f5 ff ff       	call   80101cd0 <dcfind>
+801026d7:	83 c4 10             	add    $0x10,%esp
+801026da:	85 c0                	test   %eax,%eax
+801026dc:	74 0e                	je     801026ec <dxlink+0x32c>
+      dcmove(dp, nde[j].name, nb*BSIZE + j*sizeof(*de));
+801026de:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+801026e1:	8b 4d c8             	mov    -0x38(%ebp),%ecx
+801026e4:	01 ca                	add    %ecx,%edx
+801026e6:	c1 e2 04             	shl    $0x4,%edx
+801026e9:	89 50 1c             	mov    %edx,0x1c(%eax)
+  release(&dcache.lock);
+801026ec:	83 ec 0c             	sub    $0xc,%esp
+801026ef:	68 60 60 8e 80       	push   $0x808e6060
+801026f4:	e8 f7 4d 00 00       	call   801074f0 <release>
+      j++;
+801026f9:	83 45 c4 01          	addl   $0x1,-0x3c(%ebp)
+801026fd:	83 c4 10             	add    $0x10,%esp
+    for(i = j = 0; i < DPB; i++){
+80102700:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80102703:	83 c6 10             	add    $0x10,%esi
+80102706:	39 c6                	cmp    %eax,%esi
+80102708:	0f 85 56 ff ff ff    	jne    80102664 <dxlink+0x2a4>
+    memmove(&dx[k+2], &dx[k+1], (n-k-1)*sizeof(*dx));
+8010270e:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+80102711:	8b 45 b8             	mov    -0x48(%ebp),%eax
+80102714:	83 ec 04             	sub    $0x4,%esp
+80102717:	8b 75 a8             	mov    -0x58(%ebp),%esi
+8010271a:	8d 54 01 08          	lea    0x8(%ecx,%eax,1),%edx
+8010271e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+80102721:	29 f8                	sub    %edi,%eax
+80102723:	8d 04 c5 f8 ff ff ff 	lea    -0x8(,%eax,8),%eax
+8010272a:	50                   	push   %eax
+8010272b:	52                   	push   %edx
+8010272c:	8b 45 b8             	mov    -0x48(%ebp),%eax
+8010272f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80102732:	8d 44 01 10          	lea    0x10(%ecx,%eax,1),%eax
+80102736:	50                   	push   %eax
+80102737:	e8 84 4f 00 00       	call   801076c0 <memmove>
+    dx[k+1].blk = nb;
+8010273c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010273f:	0f b7 45 d4          	movzwl -0x2c(%ebp),%eax
+    dx[k+1].hash = m;
+80102743:	8b 7d cc             	mov    -0x34(%ebp),%edi
+    dx[k+1].blk = nb;
+80102746:	66 89 42 02          	mov    %ax,0x2(%edx)
+    dx[k+1].hash = m;
+8010274a:	89 7a 04             	mov    %edi,0x4(%edx)
+    log_write(bp);
+8010274d:	58                   	pop    %eax
+8010274e:	ff 75 c0             	push   -0x40(%ebp)
+80102751:	e8 aa 21 00 00       	call   80104900 <log_write>
+    log_write(lp);
+80102756:	5a                   	pop    %edx
+80102757:	ff 75 d8             	push   -0x28(%ebp)
+8010275a:	e8 a1 21 00 00       	call   80104900 <log_write>
+    log_write(np);
+8010275f:	89 34 24             	mov    %esi,(%esp)
+80102762:	e8 99 21 00 00       	call   80104900 <log_write>
+    dp->size += BSIZE;
+80102767:	81 43 68 00 10 00 00 	addl   $0x1000,0x68(%ebx)
+    iupdate(dp);
+8010276e:	89 1c 24             	mov    %ebx,(%esp)
+80102771:	e8 ca fb ff ff       	call   80102340 <iupdate>
+    if(h >= m){
+80102776:	83 c4 10             	add    $0x10,%esp
+80102779:	39 7d e0             	cmp    %edi,-0x20(%ebp)
+8010277c:	72 67                	jb     801027e5 <dxlink+0x425>
+      brelse(lp);
+8010277e:	83 ec 0c             	sub    $0xc,%esp
+80102781:	ff 75 d8             	push   -0x28(%ebp)
+80102784:	e8 a7 df ff ff       	call   80100730 <brelse>
+      de = nde;
+80102789:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < DPB; i++)
+8010278c:	31 c0                	xor    %eax,%eax
+    if(de[i].inum == 0)
+8010278e:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80102791:	89 c7                	mov    %eax,%edi
+80102793:	c1 e0 04             	shl    $0x4,%eax
+80102796:	66 83 3c 02 00       	cmpw   $0x0,(%edx,%eax,1)
+8010279b:	0f 84 0f fd ff ff    	je     801024b0 <dxlink+0xf0>
+  for(i = 0; i < DPB; i++)
+801027a1:	8d 47 01             	lea    0x1(%edi),%eax
+801027a4:	81 ff ff 00 00 00    	cmp    $0xff,%edi
+801027aa:	75 e2                	jne    8010278e <dxlink+0x3ce>
+801027ac:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+801027b1:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+801027b6:	e9 f5 fc ff ff       	jmp    801024b0 <dxlink+0xf0>
+801027bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801027bf:	90                   	nop
+801027c0:	8b 7d e0             	mov    -0x20(%ebp),%edi
+801027c3:	31 f6                	xor    %esi,%esi
+801027c5:	e9 dd fd ff ff       	jmp    801025a7 <dxlink+0x1e7>
+  ip->lastblk = balloc(ip->dev, ip->lastblk ? ip->lastblk + 1 : 0);
+801027ca:	8b 53 5c             	mov    0x5c(%ebx),%edx
+801027cd:	8b 03                	mov    (%ebx),%eax
+801027cf:	83 fa 01             	cmp    $0x1,%edx
+801027d2:	83 da ff             	sbb    $0xffffffff,%edx
+801027d5:	e8 66 f2 ff ff       	call   80101a40 <balloc>
+801027da:	89 43 5c             	mov    %eax,0x5c(%ebx)
+      ip->addrs[bn] = addr = iballoc(ip);
+801027dd:	89 43 6c             	mov    %eax,0x6c(%ebx)
+801027e0:	e9 1d fc ff ff       	jmp    80102402 <dxlink+0x42>
+      brelse(np);
+801027e5:	83 ec 0c             	sub    $0xc,%esp
+801027e8:	56                   	push   %esi
+801027e9:	e8 42 df ff ff       	call   80100730 <brelse>
+  dcenter(dp, name, inum, bn*BSIZE + i*sizeof(*de));
+801027ee:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+801027f1:	8b 75 d8             	mov    -0x28(%ebp),%esi
+801027f4:	83 c4 10             	add    $0x10,%esp
+801027f7:	c1 e0 08             	shl    $0x8,%eax
+801027fa:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  de = (struct dirent*)lp->data;
+801027fd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+80102800:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80102803:	eb 87                	jmp    8010278c <dxlink+0x3cc>
+      brelse(lp);
+80102805:	83 ec 0c             	sub    $0xc,%esp
+80102808:	ff 75 d8             	push   -0x28(%ebp)
+8010280b:	e8 20 df ff ff       	call   80100730 <brelse>
+      brelse(bp);
+80102810:	59                   	pop    %ecx
+80102811:	ff 75 c0             	push   -0x40(%ebp)
+80102814:	e8 17 df ff ff       	call   80100730 <brelse>
+      return -1;
+80102819:	83 c4 10             	add    $0x10,%esp
+8010281c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102821:	e9 eb fc ff ff       	jmp    80102511 <dxlink+0x151>
+80102826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010282d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80102830 <idup>:
+{
+80102830:	55                   	push   %ebp
+80102831:	89 e5                	mov    %esp,%ebp
+80102833:	53                   	push   %ebx
+80102834:	83 ec 10             	sub    $0x10,%esp
+80102837:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&icache.lock);
+8010283a:	68 c0 8d 8e 80       	push   $0x808e8dc0
+8010283f:	e8 0c 4d 00 00       	call   80107550 <acquire>
+  ip->ref++;
+80102844:	83 43 08 01          	addl   $0x1,0x8(%ebx)
+  release(&icache.lock);
+80102848:	c7 04 24 c0 8d 8e 80 	movl   $0x808e8dc0,(%esp)
+8010284f:	e8 9c 4c 00 00       	call   801074f0 <release>
+}
+80102854:	89 d8                	mov    %ebx,%eax
+80102856:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80102859:	c9                   	leave
+8010285a:	c3                   	ret
+8010285b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010285f:	90                   	nop
+
+80102860 <ilock>:
+{
+80102860:	55                   	push   %ebp
+80102861:	89 e5                	mov    %esp,%ebp
+80102863:	56                   	push   %esi
+80102864:	53                   	push   %ebx
+80102865:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || ip->ref < 1)
+80102868:	85 db                	test   %ebx,%ebx
+8010286a:	0f 84 bd 00 00 00    	je     8010292d <ilock+0xcd>
+80102870:	8b 53 08             	mov    0x8(%ebx),%edx
+80102873:	85 d2                	test   %edx,%edx
+80102875:	0f 8e b2 00 00 00    	jle    8010292d <ilock+0xcd>
+  acquiresleep(&ip->lock);
+8010287b:	83 ec 0c             	sub    $0xc,%esp
+8010287e:	8d 43 18             	lea    0x18(%ebx),%eax
+80102881:	50                   	push   %eax
+80102882:	e8 99 49 00 00       	call   80107220 <acquiresleep>
+  if(ip->valid == 0){
+80102887:	8b 43 58             	mov    0x58(%ebx),%eax
+8010288a:	83 c4 10             	add    $0x10,%esp
+8010288d:	85 c0                	test   %eax,%eax
+8010288f:	74 0f                	je     801028a0 <ilock+0x40>
+}
+80102891:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102894:	5b                   	pop    %ebx
+80102895:	5e                   	pop    %esi
+80102896:	5d                   	pop    %ebp
+80102897:	c3                   	ret
+80102898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010289f:	90                   	nop
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+801028a0:	8b 43 04             	mov    0x4(%ebx),%eax
+801028a3:	83 ec 08             	sub    $0x8,%esp
+801028a6:	c1 e8 06             	shr    $0x6,%eax
+801028a9:	03 05 9c 0c 8f 80    	add    0x808f0c9c,%eax
+801028af:	50                   	push   %eax
+801028b0:	ff 33                	push   (%ebx)
+801028b2:	e8 39 dc ff ff       	call   801004f0 <bread>
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+801028b7:	83 c4 0c             	add    $0xc,%esp
+    bp = bread(ip->dev, IBLOCK(ip->inum, sb));
+801028ba:	89 c6                	mov    %eax,%esi
+    dip = (struct dinode*)bp->data + ip->inum%IPB;
+801028bc:	8b 43 04             	mov    0x4(%ebx),%eax
+801028bf:	83 e0 3f             	and    $0x3f,%eax
+801028c2:	c1 e0 06             	shl    $0x6,%eax
+801028c5:	03 46 60             	add    0x60(%esi),%eax
+    ip->type = dip->type;
+801028c8:	0f b7 10             	movzwl (%eax),%edx
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+801028cb:	83 c0 0c             	add    $0xc,%eax
+    ip->type = dip->type;
+801028ce:	66 89 53 60          	mov    %dx,0x60(%ebx)
+    ip->major = dip->major;
+801028d2:	0f b7 50 f6          	movzwl -0xa(%eax),%edx
+801028d6:	66 89 53 62          	mov    %dx,0x62(%ebx)
+    ip->minor = dip->minor;
+801028da:	0f b7 50 f8          	movzwl -0x8(%eax),%edx
+801028de:	66 89 53 64          	mov    %dx,0x64(%ebx)
+    ip->nlink = dip->nlink;
+801028e2:	0f b7 50 fa          	movzwl -0x6(%eax),%edx
+801028e6:	66 89 53 66          	mov    %dx,0x66(%ebx)
+    ip->size = dip->size;
+801028ea:	8b 50 fc             	mov    -0x4(%eax),%edx
+801028ed:	89 53 68             	mov    %edx,0x68(%ebx)
+    memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
+801028f0:	6a 34                	push   $0x34
+801028f2:	50                   	push   %eax
+801028f3:	8d 43 6c             	lea    0x6c(%ebx),%eax
+801028f6:	50                   	push   %eax
+801028f7:	e8 c4 4d 00 00       	call   801076c0 <memmove>
+    brelse(bp);
+801028fc:	89 34 24             	mov    %esi,(%esp)
+801028ff:	e8 2c de ff ff       	call   80100730 <brelse>
+    if(ip->type == 0)
+80102904:	83 c4 10             	add    $0x10,%esp
+80102907:	66 83 7b 60 00       	cmpw   $0x0,0x60(%ebx)
+    ip->lastblk = 0;
+8010290c:	c7 43 5c 00 00 00 00 	movl   $0x0,0x5c(%ebx)
+    ip->valid = 1;
+80102913:	c7 43 58 01 00 00 00 	movl   $0x1,0x58(%ebx)
+    if(ip->type == 0)
+8010291a:	0f 85 71 ff ff ff    	jne    80102891 <ilock+0x31>
+      panic("ilock: no type");
+80102920:	83 ec 0c             	sub    $0xc,%esp
+80102923:	68 a8 b0 10 80       	push   $0x8010b0a8
+80102928:	e8 53 df ff ff       	call   80100880 <panic>
+    panic("ilock");
+8010292d:	83 ec 0c             	sub    $0xc,%esp
+80102930:	68 a2 b0 10 80       	push   $0x8010b0a2
+80102935:	e8 46 df ff ff       	call   80100880 <panic>
+8010293a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80102940 <iunlock>:
+{
+80102940:	55                   	push   %ebp
+80102941:	89 e5                	mov    %esp,%ebp
+80102943:	56                   	push   %esi
+80102944:	53                   	push   %ebx
+80102945:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102948:	85 db                	test   %ebx,%ebx
+8010294a:	74 28                	je     80102974 <iunlock+0x34>
+8010294c:	83 ec 0c             	sub    $0xc,%esp
+8010294f:	8d 73 18             	lea    0x18(%ebx),%esi
+80102952:	56                   	push   %esi
+80102953:	e8 c8 49 00 00       	call   80107320 <holdingsleep>
+80102958:	83 c4 10             	add    $0x10,%esp
+8010295b:	85 c0                	test   %eax,%eax
+8010295d:	74 15                	je     80102974 <iunlock+0x34>
+8010295f:	8b 43 08             	mov    0x8(%ebx),%eax
+80102962:	85 c0                	test   %eax,%eax
+80102964:	7e 0e                	jle    80102974 <iunlock+0x34>
+  releasesleep(&ip->lock);
+80102966:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80102969:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010296c:	5b                   	pop    %ebx
+8010296d:	5e                   	pop    %esi
+8010296e:	5d                   	pop    %ebp
+  releasesleep(&ip->lock);
+8010296f:	e9 6c 49 00 00       	jmp    801072e0 <releasesleep>
+    panic("iunlock");
+80102974:	83 ec 0c             	sub    $0xc,%esp
+80102977:	68 b7 b0 10 80       	push   $0x8010b0b7
+8010297c:	e8 ff de ff ff       	call   80100880 <panic>
+80102981:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010298f:	90                   	nop
+
+80102990 <iput>:
+{
+80102990:	55                   	push   %ebp
+80102991:	89 e5                	mov    %esp,%ebp
+80102993:	57                   	push   %edi
+80102994:	56                   	push   %esi
+80102995:	53                   	push   %ebx
+80102996:	83 ec 28             	sub    $0x28,%esp
+80102999:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquiresleep(&ip->lock);
+8010299c:	8d 7b 18             	lea    0x18(%ebx),%edi
+8010299f:	57                   	push   %edi
+801029a0:	e8 7b 48 00 00       	call   80107220 <acquiresleep>
+  if(ip->valid && ip->nlink == 0){
+801029a5:	8b 53 58             	mov    0x58(%ebx),%edx
+801029a8:	83 c4 10             	add    $0x10,%esp
+801029ab:	85 d2                	test   %edx,%edx
+801029ad:	74 07                	je     801029b6 <iput+0x26>
+801029af:	66 83 7b 66 00       	cmpw   $0x0,0x66(%ebx)
+801029b4:	74 5a                	je     80102a10 <iput+0x80>
+  releasesleep(&ip->lock);
+801029b6:	83 ec 0c             	sub    $0xc,%esp
+801029b9:	57                   	push   %edi
+801029ba:	e8 21 49 00 00       	call   801072e0 <releasesleep>
+  acquire(&icache.lock);
+801029bf:	c7 04 24 c0 8d 8e 80 	movl   $0x808e8dc0,(%esp)
+801029c6:	e8 85 4b 00 00       	call   80107550 <acquire>
+  if(--ip->ref == 0)
+801029cb:	8b 43 08             	mov    0x8(%ebx),%eax
+801029ce:	83 c4 10             	add    $0x10,%esp
+801029d1:	83 e8 01             	sub    $0x1,%eax
+801029d4:	89 43 08             	mov    %eax,0x8(%ebx)
+801029d7:	85 c0                	test   %eax,%eax
+801029d9:	75 18                	jne    801029f3 <iput+0x63>
+  ip->next = &icache.lru;
+801029db:	c7 43 14 e8 0b 8f 80 	movl   $0x808f0be8,0x14(%ebx)
+  ip->prev = icache.lru.prev;
+801029e2:	a1 f8 0b 8f 80       	mov    0x808f0bf8,%eax
+801029e7:	89 43 10             	mov    %eax,0x10(%ebx)
+  icache.lru.prev->next = ip;
+801029ea:	89 58 14             	mov    %ebx,0x14(%eax)
+  icache.lru.prev = ip;
+801029ed:	89 1d f8 0b 8f 80    	mov    %ebx,0x808f0bf8
+  release(&icache.lock);
+801029f3:	c7 45 08 c0 8d 8e 80 	movl   $0x808e8dc0,0x8(%ebp)
+}
+801029fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801029fd:	5b                   	pop    %ebx
+801029fe:	5e                   	pop    %esi
+801029ff:	5f                   	pop    %edi
+80102a00:	5d                   	pop    %ebp
+  release(&icache.lock);
+80102a01:	e9 ea 4a 00 00       	jmp    801074f0 <release>
+80102a06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102a0d:	8d 76 00             	lea    0x0(%esi),%esi
+    acquire(&icache.lock);
+80102a10:	83 ec 0c             	sub    $0xc,%esp
+80102a13:	68 c0 8d 8e 80       	push   $0x808e8dc0
+80102a18:	e8 33 4b 00 00       	call   80107550 <acquire>
+    int r = ip->ref;
+80102a1d:	8b 73 08             	mov    0x8(%ebx),%esi
+    release(&icache.lock);
+80102a20:	c7 04 24 c0 8d 8e 80 	movl   $0x808e8dc0,(%esp)
+80102a27:	e8 c4 4a 00 00       	call   801074f0 <release>
+    if(r == 1){
+80102a2c:	83 c4 10             	add    $0x10,%esp
+80102a2f:	83 fe 01             	cmp    $0x1,%esi
+80102a32:	75 82                	jne    801029b6 <iput+0x26>
+      if(ip->type == T_DIR)
+80102a34:	66 83 7b 60 01       	cmpw   $0x1,0x60(%ebx)
+80102a39:	0f 84 b9 00 00 00    	je     80102af8 <iput+0x168>
+80102a3f:	8d 73 6c             	lea    0x6c(%ebx),%esi
+80102a42:	8d 8b 98 00 00 00    	lea    0x98(%ebx),%ecx
+80102a48:	eb 0d                	jmp    80102a57 <iput+0xc7>
+80102a4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < NDIRECT; i++){
+80102a50:	83 c6 04             	add    $0x4,%esi
+80102a53:	39 f1                	cmp    %esi,%ecx
+80102a55:	74 21                	je     80102a78 <iput+0xe8>
+    if(ip->addrs[i]){
+80102a57:	8b 16                	mov    (%esi),%edx
+80102a59:	85 d2                	test   %edx,%edx
+80102a5b:	74 f3                	je     80102a50 <iput+0xc0>
+      bfree(ip->dev, ip->addrs[i]);
+80102a5d:	8b 03                	mov    (%ebx),%eax
+80102a5f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+80102a62:	e8 79 ed ff ff       	call   801017e0 <bfree>
+      ip->addrs[i] = 0;
+80102a67:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+80102a6d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+80102a70:	eb de                	jmp    80102a50 <iput+0xc0>
+80102a72:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  if(ip->addrs[NDIRECT]){
+80102a78:	8b 93 98 00 00 00    	mov    0x98(%ebx),%edx
+80102a7e:	85 d2                	test   %edx,%edx
+80102a80:	75 5e                	jne    80102ae0 <iput+0x150>
+  if(ip->addrs[NDIRECT+1]){
+80102a82:	8b 93 9c 00 00 00    	mov    0x9c(%ebx),%edx
+80102a88:	85 d2                	test   %edx,%edx
+80102a8a:	75 34                	jne    80102ac0 <iput+0x130>
+  iupdate(ip);
+80102a8c:	83 ec 0c             	sub    $0xc,%esp
+  ip->size = 0;
+80102a8f:	c7 43 68 00 00 00 00 	movl   $0x0,0x68(%ebx)
+  iupdate(ip);
+80102a96:	53                   	push   %ebx
+80102a97:	e8 a4 f8 ff ff       	call   80102340 <iupdate>
+      ip->type = 0;
+80102a9c:	31 c0                	xor    %eax,%eax
+80102a9e:	66 89 43 60          	mov    %ax,0x60(%ebx)
+      iupdate(ip);
+80102aa2:	89 1c 24             	mov    %ebx,(%esp)
+80102aa5:	e8 96 f8 ff ff       	call   80102340 <iupdate>
+      ip->valid = 0;
+80102aaa:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+80102ab1:	83 c4 10             	add    $0x10,%esp
+80102ab4:	e9 fd fe ff ff       	jmp    801029b6 <iput+0x26>
+80102ab9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    bfreeind(ip, ip->addrs[NDIRECT+1], 2);
+80102ac0:	b9 02 00 00 00       	mov    $0x2,%ecx
+80102ac5:	89 d8                	mov    %ebx,%eax
+80102ac7:	e8 94 ed ff ff       	call   80101860 <bfreeind>
+    ip->addrs[NDIRECT+1] = 0;
+80102acc:	c7 83 9c 00 00 00 00 	movl   $0x0,0x9c(%ebx)
+80102ad3:	00 00 00 
+80102ad6:	eb b4                	jmp    80102a8c <iput+0xfc>
+80102ad8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102adf:	90                   	nop
+    bfreeind(ip, ip->addrs[NDIRECT], 1);
+80102ae0:	b9 01 00 00 00       	mov    $0x1,%ecx
+80102ae5:	89 d8                	mov    %ebx,%eax
+80102ae7:	e8 74 ed ff ff       	call   80101860 <bfreeind>
+    ip->addrs[NDIRECT] = 0;
+80102aec:	c7 83 98 00 00 00 00 	movl   $0x0,0x98(%ebx)
+80102af3:	00 00 00 
+80102af6:	eb 8a                	jmp    80102a82 <iput+0xf2>
+  acquire(&dcache.lock);
+80102af8:	83 ec 0c             	sub    $0xc,%esp
+  for(d = dcache.dentry; d < &dcache.dentry[NDENTRY]; d++)
+80102afb:	be 94 60 8e 80       	mov    $0x808e6094,%esi
+  acquire(&dcache.lock);
+80102b00:	68 60 60 8e 80       	push   $0x808e6060
+80102b05:	e8 46 4a 00 00       	call   80107550 <acquire>
+80102b0a:	83 c4 10             	add    $0x10,%esp
+80102b0d:	eb 0c                	jmp    80102b1b <iput+0x18b>
+80102b0f:	90                   	nop
+  for(d = dcache.dentry; d < &dcache.dentry[NDENTRY]; d++)
+80102b10:	83 c6 2c             	add    $0x2c,%esi
+80102b13:	81 fe 94 8c 8e 80    	cmp    $0x808e8c94,%esi
+80102b19:	74 17                	je     80102b32 <iput+0x1a2>
+    if(d->dir == dp->inum && d->dev == dp->dev)
+80102b1b:	8b 43 04             	mov    0x4(%ebx),%eax
+80102b1e:	39 46 04             	cmp    %eax,0x4(%esi)
+80102b21:	75 ed                	jne    80102b10 <iput+0x180>
+80102b23:	8b 03                	mov    (%ebx),%eax
+80102b25:	39 06                	cmp    %eax,(%esi)
+80102b27:	75 e7                	jne    80102b10 <iput+0x180>
+      dcdrop(d);
+80102b29:	89 f0                	mov    %esi,%eax
+80102b2b:	e8 f0 f0 ff ff       	call   80101c20 <dcdrop>
+80102b30:	eb de                	jmp    80102b10 <iput+0x180>
+  release(&dcache.lock);
+80102b32:	83 ec 0c             	sub    $0xc,%esp
+80102b35:	68 60 60 8e 80       	push   $0x808e6060
+80102b3a:	e8 b1 49 00 00       	call   801074f0 <release>
+80102b3f:	83 c4 10             	add    $0x10,%esp
+80102b42:	e9 f8 fe ff ff       	jmp    80102a3f <iput+0xaf>
+80102b47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102b4e:	66 90                	xchg   %ax,%ax
+
+80102b50 <iunlockput>:
+{
+80102b50:	55                   	push   %ebp
+80102b51:	89 e5                	mov    %esp,%ebp
+80102b53:	56                   	push   %esi
+80102b54:	53                   	push   %ebx
+80102b55:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80102b58:	85 db                	test   %ebx,%ebx
+80102b5a:	74 34                	je     80102b90 <iunlockput+0x40>
+80102b5c:	83 ec 0c             	sub    $0xc,%esp
+80102b5f:	8d 73 18             	lea    0x18(%ebx),%esi
+80102b62:	56                   	push   %esi
+80102b63:	e8 b8 47 00 00       	call   80107320 <holdingsleep>
+80102b68:	83 c4 10             	add    $0x10,%esp
+80102b6b:	85 c0                	test   %eax,%eax
+80102b6d:	74 21                	je     80102b90 <iunlockput+0x40>
+80102b6f:	8b 43 08             	mov    0x8(%ebx),%eax
+80102b72:	85 c0                	test   %eax,%eax
+80102b74:	7e 1a                	jle    80102b90 <iunlockput+0x40>
+  releasesleep(&ip->lock);
+80102b76:	83 ec 0c             	sub    $0xc,%esp
+80102b79:	56                   	push   %esi
+80102b7a:	e8 61 47 00 00       	call   801072e0 <releasesleep>
+  iput(ip);
+80102b7f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+80102b82:	83 c4 10             	add    $0x10,%esp
+}
+80102b85:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102b88:	5b                   	pop    %ebx
+80102b89:	5e                   	pop    %esi
+80102b8a:	5d                   	pop    %ebp
+  iput(ip);
+80102b8b:	e9 00 fe ff ff       	jmp    80102990 <iput>
+    panic("iunlock");
+80102b90:	83 ec 0c             	sub    $0xc,%esp
+80102b93:	68 b7 b0 10 80       	push   $0x8010b0b7
+80102b98:	e8 e3 dc ff ff       	call   80100880 <panic>
+80102b9d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80102ba0 <stati>:
+{
+80102ba0:	55                   	push   %ebp
+80102ba1:	89 e5                	mov    %esp,%ebp
+80102ba3:	8b 55 08             	mov    0x8(%ebp),%edx
+80102ba6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  st->dev = ip->dev;
+80102ba9:	8b 0a                	mov    (%edx),%ecx
+80102bab:	89 48 04             	mov    %ecx,0x4(%eax)
+  st->ino = ip->inum;
+80102bae:	8b 4a 04             	mov    0x4(%edx),%ecx
+80102bb1:	89 48 08             	mov    %ecx,0x8(%eax)
+  st->type = ip->type;
+80102bb4:	0f b7 4a 60          	movzwl 0x60(%edx),%ecx
+80102bb8:	66 89 08             	mov    %cx,(%eax)
+  st->nlink = ip->nlink;
+80102bbb:	0f b7 4a 66          	movzwl 0x66(%edx),%ecx
+80102bbf:	66 89 48 0c          	mov    %cx,0xc(%eax)
+  st->size = ip->size;
+80102bc3:	8b 52 68             	mov    0x68(%edx),%edx
+80102bc6:	89 50 10             	mov    %edx,0x10(%eax)
+}
+80102bc9:	5d                   	pop    %ebp
+80102bca:	c3                   	ret
+80102bcb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102bcf:	90                   	nop
+
+80102bd0 <readi>:
+{
+80102bd0:	55                   	push   %ebp
+80102bd1:	89 e5                	mov    %esp,%ebp
+80102bd3:	57                   	push   %edi
+80102bd4:	56                   	push   %esi
+80102bd5:	53                   	push   %ebx
+80102bd6:	83 ec 1c             	sub    $0x1c,%esp
+80102bd9:	8b 75 08             	mov    0x8(%ebp),%esi
+80102bdc:	8b 45 0c             	mov    0xc(%ebp),%eax
+80102bdf:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if(ip->type == T_DEV){
+80102be2:	66 83 7e 60 03       	cmpw   $0x3,0x60(%esi)
+{
+80102be7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80102bea:	89 75 d8             	mov    %esi,-0x28(%ebp)
+80102bed:	8b 45 14             	mov    0x14(%ebp),%eax
+  if(ip->type == T_DEV){
+80102bf0:	0f 84 aa 00 00 00    	je     80102ca0 <readi+0xd0>
+  if(off > ip->size || off + n < off)
+80102bf6:	8b 75 d8             	mov    -0x28(%ebp),%esi
+80102bf9:	8b 56 68             	mov    0x68(%esi),%edx
+80102bfc:	39 fa                	cmp    %edi,%edx
+80102bfe:	0f 82 bd 00 00 00    	jb     80102cc1 <readi+0xf1>
+80102c04:	89 f9                	mov    %edi,%ecx
+80102c06:	31 db                	xor    %ebx,%ebx
+80102c08:	01 c1                	add    %eax,%ecx
+80102c0a:	0f 92 c3             	setb   %bl
+80102c0d:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+80102c10:	0f 82 ab 00 00 00    	jb     80102cc1 <readi+0xf1>
+    n = ip->size - off;
+80102c16:	89 d3                	mov    %edx,%ebx
+80102c18:	29 fb                	sub    %edi,%ebx
+80102c1a:	39 ca                	cmp    %ecx,%edx
+80102c1c:	0f 42 c3             	cmovb  %ebx,%eax
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80102c1f:	85 c0                	test   %eax,%eax
+80102c21:	74 72                	je     80102c95 <readi+0xc5>
+    m = min(n - tot, BSIZE - off%BSIZE);
+80102c23:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80102c26:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80102c29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80102c30:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+80102c33:	89 fa                	mov    %edi,%edx
+80102c35:	c1 ea 0c             	shr    $0xc,%edx
+80102c38:	89 d8                	mov    %ebx,%eax
+80102c3a:	e8 e1 f2 ff ff       	call   80101f20 <bmap>
+80102c3f:	83 ec 08             	sub    $0x8,%esp
+80102c42:	50                   	push   %eax
+80102c43:	ff 33                	push   (%ebx)
+80102c45:	e8 a6 d8 ff ff       	call   801004f0 <bread>
+    m = min(n - tot, BSIZE - off%BSIZE);
+80102c4a:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80102c4d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80102c52:	89 c2                	mov    %eax,%edx
+    m = min(n - tot, BSIZE - off%BSIZE);
+80102c54:	89 f8                	mov    %edi,%eax
+80102c56:	25 ff 0f 00 00       	and    $0xfff,%eax
+80102c5b:	29 f3                	sub    %esi,%ebx
+80102c5d:	29 c1                	sub    %eax,%ecx
+80102c5f:	39 d9                	cmp    %ebx,%ecx
+80102c61:	0f 46 d9             	cmovbe %ecx,%ebx
+    memmove(dst, bp->data + off%BSIZE, m);
+80102c64:	83 c4 0c             	add    $0xc,%esp
+80102c67:	53                   	push   %ebx
+80102c68:	03 42 60             	add    0x60(%edx),%eax
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80102c6b:	01 de                	add    %ebx,%esi
+80102c6d:	01 df                	add    %ebx,%edi
+    memmove(dst, bp->data + off%BSIZE, m);
+80102c6f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80102c72:	50                   	push   %eax
+80102c73:	ff 75 e0             	push   -0x20(%ebp)
+80102c76:	e8 45 4a 00 00       	call   801076c0 <memmove>
+    brelse(bp);
+80102c7b:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80102c7e:	89 14 24             	mov    %edx,(%esp)
+80102c81:	e8 aa da ff ff       	call   80100730 <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
+80102c86:	01 5d e0             	add    %ebx,-0x20(%ebp)
+80102c89:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80102c8c:	83 c4 10             	add    $0x10,%esp
+80102c8f:	39 de                	cmp    %ebx,%esi
+80102c91:	72 9d                	jb     80102c30 <readi+0x60>
+80102c93:	89 d8                	mov    %ebx,%eax
+}
+80102c95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102c98:	5b                   	pop    %ebx
+80102c99:	5e                   	pop    %esi
+80102c9a:	5f                   	pop    %edi
+80102c9b:	5d                   	pop    %ebp
+80102c9c:	c3                   	ret
+80102c9d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
+80102ca0:	0f bf 56 62          	movswl 0x62(%esi),%edx
+80102ca4:	66 83 fa 09          	cmp    $0x9,%dx
+80102ca8:	77 17                	ja     80102cc1 <readi+0xf1>
+80102caa:	8b 14 d5 00 60 8e 80 	mov    -0x7f71a000(,%edx,8),%edx
+80102cb1:	85 d2                	test   %edx,%edx
+80102cb3:	74 0c                	je     80102cc1 <readi+0xf1>
+    return devsw[ip->major].read(ip, dst, n);
+80102cb5:	89 45 10             	mov    %eax,0x10(%ebp)
+}
+80102cb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102cbb:	5b                   	pop    %ebx
+80102cbc:	5e                   	pop    %esi
+80102cbd:	5f                   	pop    %edi
+80102cbe:	5d                   	pop    %ebp
+    return devsw[ip->major].read(ip, dst, n);
+80102cbf:	ff e2                	jmp    *%edx
+      return -1;
+80102cc1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102cc6:	eb cd                	jmp    80102c95 <readi+0xc5>
+80102cc8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102ccf:	90                   	nop
+
+80102cd0 <ireadahead>:
+{
+80102cd0:	55                   	push   %ebp
+80102cd1:	89 e5                	mov    %esp,%ebp
+80102cd3:	57                   	push   %edi
+80102cd4:	56                   	push   %esi
+80102cd5:	53                   	push   %ebx
+80102cd6:	83 ec 0c             	sub    $0xc,%esp
+80102cd9:	8b 75 08             	mov    0x8(%ebp),%esi
+80102cdc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(ip->type == T_DEV || off >= ip->size)
+80102cdf:	66 83 7e 60 03       	cmpw   $0x3,0x60(%esi)
+80102ce4:	74 4d                	je     80102d33 <ireadahead+0x63>
+80102ce6:	8b 7e 68             	mov    0x68(%esi),%edi
+80102ce9:	39 f8                	cmp    %edi,%eax
+80102ceb:	73 46                	jae    80102d33 <ireadahead+0x63>
+  end = off + n;
+80102ced:	31 c9                	xor    %ecx,%ecx
+80102cef:	89 c2                	mov    %eax,%edx
+80102cf1:	03 55 10             	add    0x10(%ebp),%edx
+80102cf4:	0f 92 c1             	setb   %cl
+  if(end > ip->size || end < off)
+80102cf7:	39 d7                	cmp    %edx,%edi
+80102cf9:	72 05                	jb     80102d00 <ireadahead+0x30>
+80102cfb:	85 c9                	test   %ecx,%ecx
+80102cfd:	0f 44 fa             	cmove  %edx,%edi
+  for(bn = off/BSIZE; bn*BSIZE < end; bn++)
+80102d00:	89 c3                	mov    %eax,%ebx
+80102d02:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+80102d07:	c1 eb 0c             	shr    $0xc,%ebx
+80102d0a:	39 f8                	cmp    %edi,%eax
+80102d0c:	73 25                	jae    80102d33 <ireadahead+0x63>
+80102d0e:	66 90                	xchg   %ax,%ax
+    breadahead(ip->dev, bmap(ip, bn));
+80102d10:	89 da                	mov    %ebx,%edx
+80102d12:	89 f0                	mov    %esi,%eax
+  for(bn = off/BSIZE; bn*BSIZE < end; bn++)
+80102d14:	83 c3 01             	add    $0x1,%ebx
+    breadahead(ip->dev, bmap(ip, bn));
+80102d17:	e8 04 f2 ff ff       	call   80101f20 <bmap>
+80102d1c:	83 ec 08             	sub    $0x8,%esp
+80102d1f:	50                   	push   %eax
+80102d20:	ff 36                	push   (%esi)
+80102d22:	e8 b9 d8 ff ff       	call   801005e0 <breadahead>
+  for(bn = off/BSIZE; bn*BSIZE < end; bn++)
+80102d27:	89 d8                	mov    %ebx,%eax
+80102d29:	83 c4 10             	add    $0x10,%esp
+80102d2c:	c1 e0 0c             	shl    $0xc,%eax
+80102d2f:	39 f8                	cmp    %edi,%eax
+80102d31:	72 dd                	jb     80102d10 <ireadahead+0x40>
+}
+80102d33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102d36:	5b                   	pop    %ebx
+80102d37:	5e                   	pop    %esi
+80102d38:	5f                   	pop    %edi
+80102d39:	5d                   	pop    %ebp
+80102d3a:	c3                   	ret
+80102d3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80102d3f:	90                   	nop
+
+80102d40 <writei>:
+{
+80102d40:	55                   	push   %ebp
+80102d41:	89 e5                	mov    %esp,%ebp
+80102d43:	57                   	push   %edi
+80102d44:	56                   	push   %esi
+80102d45:	53                   	push   %ebx
+80102d46:	83 ec 1c             	sub    $0x1c,%esp
+80102d49:	8b 45 0c             	mov    0xc(%ebp),%eax
+80102d4c:	8b 55 08             	mov    0x8(%ebp),%edx
+80102d4f:	8b 7d 10             	mov    0x10(%ebp),%edi
+80102d52:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80102d55:	8b 45 14             	mov    0x14(%ebp),%eax
+  if(ip->type == T_DEV){
+80102d58:	66 83 7a 60 03       	cmpw   $0x3,0x60(%edx)
+{
+80102d5d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(ip->type == T_DEV){
+80102d60:	0f 84 aa 00 00 00    	je     80102e10 <writei+0xd0>
+  if(off > ip->size || off + n < off)
+80102d66:	39 7a 68             	cmp    %edi,0x68(%edx)
+80102d69:	0f 82 da 00 00 00    	jb     80102e49 <writei+0x109>
+80102d6f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80102d72:	89 c6                	mov    %eax,%esi
+80102d74:	01 fe                	add    %edi,%esi
+80102d76:	0f 82 cd 00 00 00    	jb     80102e49 <writei+0x109>
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+80102d7c:	85 c0                	test   %eax,%eax
+80102d7e:	0f 84 80 00 00 00    	je     80102e04 <writei+0xc4>
+80102d84:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    m = min(n - tot, BSIZE - off%BSIZE);
+80102d8b:	89 55 d8             	mov    %edx,-0x28(%ebp)
+80102d8e:	66 90                	xchg   %ax,%ax
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80102d90:	8b 75 d8             	mov    -0x28(%ebp),%esi
+80102d93:	89 fa                	mov    %edi,%edx
+80102d95:	c1 ea 0c             	shr    $0xc,%edx
+80102d98:	89 f0                	mov    %esi,%eax
+80102d9a:	e8 81 f1 ff ff       	call   80101f20 <bmap>
+80102d9f:	83 ec 08             	sub    $0x8,%esp
+80102da2:	50                   	push   %eax
+80102da3:	ff 36                	push   (%esi)
+80102da5:	e8 46 d7 ff ff       	call   801004f0 <bread>
+    m = min(n - tot, BSIZE - off%BSIZE);
+80102daa:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102dad:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80102db0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+80102db5:	89 c6                	mov    %eax,%esi
+    m = min(n - tot, BSIZE - off%BSIZE);
+80102db7:	89 f8                	mov    %edi,%eax
+80102db9:	25 ff 0f 00 00       	and    $0xfff,%eax
+80102dbe:	29 d3                	sub    %edx,%ebx
+80102dc0:	29 c1                	sub    %eax,%ecx
+80102dc2:	39 d9                	cmp    %ebx,%ecx
+80102dc4:	0f 46 d9             	cmovbe %ecx,%ebx
+    memmove(bp->data + off%BSIZE, src, m);
+80102dc7:	83 c4 0c             	add    $0xc,%esp
+80102dca:	53                   	push   %ebx
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+80102dcb:	01 df                	add    %ebx,%edi
+    memmove(bp->data + off%BSIZE, src, m);
+80102dcd:	ff 75 dc             	push   -0x24(%ebp)
+80102dd0:	03 46 60             	add    0x60(%esi),%eax
+80102dd3:	50                   	push   %eax
+80102dd4:	e8 e7 48 00 00       	call   801076c0 <memmove>
+    log_write(bp);
+80102dd9:	89 34 24             	mov    %esi,(%esp)
+80102ddc:	e8 1f 1b 00 00       	call   80104900 <log_write>
+    brelse(bp);
+80102de1:	89 34 24             	mov    %esi,(%esp)
+80102de4:	e8 47 d9 ff ff       	call   80100730 <brelse>
+  for(tot=0; tot<n; tot+=m, off+=m, src+=m){
+80102de9:	01 5d e4             	add    %ebx,-0x1c(%ebp)
+80102dec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80102def:	83 c4 10             	add    $0x10,%esp
+80102df2:	01 5d dc             	add    %ebx,-0x24(%ebp)
+80102df5:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+80102df8:	39 d8                	cmp    %ebx,%eax
+80102dfa:	72 94                	jb     80102d90 <writei+0x50>
+  if(n > 0 && off > ip->size){
+80102dfc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+80102dff:	39 7a 68             	cmp    %edi,0x68(%edx)
+80102e02:	72 34                	jb     80102e38 <writei+0xf8>
+  return n;
+80102e04:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+80102e07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102e0a:	5b                   	pop    %ebx
+80102e0b:	5e                   	pop    %esi
+80102e0c:	5f                   	pop    %edi
+80102e0d:	5d                   	pop    %ebp
+80102e0e:	c3                   	ret
+80102e0f:	90                   	nop
+    if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].write)
+80102e10:	0f bf 42 62          	movswl 0x62(%edx),%eax
+80102e14:	66 83 f8 09          	cmp    $0x9,%ax
+80102e18:	77 2f                	ja     80102e49 <writei+0x109>
+80102e1a:	8b 04 c5 04 60 8e 80 	mov    -0x7f719ffc(,%eax,8),%eax
+80102e21:	85 c0                	test   %eax,%eax
+80102e23:	74 24                	je     80102e49 <writei+0x109>
+    return devsw[ip->major].write(ip, src, n);
+80102e25:	8b 7d e0             	mov    -0x20(%ebp),%edi
+80102e28:	89 7d 10             	mov    %edi,0x10(%ebp)
+}
+80102e2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102e2e:	5b                   	pop    %ebx
+80102e2f:	5e                   	pop    %esi
+80102e30:	5f                   	pop    %edi
+80102e31:	5d                   	pop    %ebp
+    return devsw[ip->major].write(ip, src, n);
+80102e32:	ff e0                	jmp    *%eax
+80102e34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iupdate(ip);
+80102e38:	83 ec 0c             	sub    $0xc,%esp
+    ip->size = off;
+80102e3b:	89 7a 68             	mov    %edi,0x68(%edx)
+    iupdate(ip);
+80102e3e:	52                   	push   %edx
+80102e3f:	e8 fc f4 ff ff       	call   80102340 <iupdate>
+80102e44:	83 c4 10             	add    $0x10,%esp
+80102e47:	eb bb                	jmp    80102e04 <writei+0xc4>
+      return -1;
+80102e49:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80102e4e:	eb b7                	jmp    80102e07 <writei+0xc7>
+
+80102e50 <namecmp>:
+{
+80102e50:	55                   	push   %ebp
+80102e51:	89 e5                	mov    %esp,%ebp
+80102e53:	83 ec 0c             	sub    $0xc,%esp
+  return strncmp(s, t, DIRSIZ);
+80102e56:	6a 0e                	push   $0xe
+80102e58:	ff 75 0c             	push   0xc(%ebp)
+80102e5b:	ff 75 08             	push   0x8(%ebp)
+80102e5e:	e8 cd 48 00 00       	call   80107730 <strncmp>
+}
+80102e63:	c9                   	leave
+80102e64:	c3                   	ret
+80102e65:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80102e6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80102e70 <dcinval>:
+{
+80102e70:	55                   	push   %ebp
+80102e71:	89 e5                	mov    %esp,%ebp
+80102e73:	56                   	push   %esi
+80102e74:	53                   	push   %ebx
+80102e75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80102e78:	8b 75 0c             	mov    0xc(%ebp),%esi
+  acquire(&dcache.lock);
+80102e7b:	83 ec 0c             	sub    $0xc,%esp
+80102e7e:	68 60 60 8e 80       	push   $0x808e6060
+80102e83:	e8 c8 46 00 00       	call   80107550 <acquire>
+  if((d = dcfind(dp, name)) != 0)
+80102e88:	89 f2                	mov    %esi,%edx
+80102e8a:	89 d8                	mov    %ebx,%eax
+80102e8c:	e8 3f ee ff ff       	call   80101cd0 <dcfind>
+80102e91:	83 c4 10             	add    $0x10,%esp
+80102e94:	85 c0                	test   %eax,%eax
+80102e96:	74 05                	je     80102e9d <dcinval+0x2d>
+    dcdrop(d);
+80102e98:	e8 83 ed ff ff       	call   80101c20 <dcdrop>
+  release(&dcache.lock);
+80102e9d:	c7 45 08 60 60 8e 80 	movl   $0x808e6060,0x8(%ebp)
+}
+80102ea4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80102ea7:	5b                   	pop    %ebx
+80102ea8:	5e                   	pop    %esi
+80102ea9:	5d                   	pop    %ebp
+  release(&dcache.lock);
+80102eaa:	e9 41 46 00 00       	jmp    801074f0 <release>
+80102eaf:	90                   	nop
+
+80102eb0 <dirlookup>:
+{
+80102eb0:	55                   	push   %ebp
+80102eb1:	89 e5                	mov    %esp,%ebp
+80102eb3:	57                   	push   %edi
+80102eb4:	56                   	push   %esi
+80102eb5:	53                   	push   %ebx
+80102eb6:	83 ec 1c             	sub    $0x1c,%esp
+80102eb9:	8b 45 0c             	mov    0xc(%ebp),%eax
+80102ebc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80102ebf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80102ec2:	8b 45 10             	mov    0x10(%ebp),%eax
+  if(dp->type != T_DIR)
+80102ec5:	66 83 7b 60 01       	cmpw   $0x1,0x60(%ebx)
+{
+80102eca:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  if(dp->type != T_DIR)
+80102ecd:	0f 85 30 02 00 00    	jne    80103103 <dirlookup+0x253>
+  acquire(&dcache.lock);
+80102ed3:	83 ec 0c             	sub    $0xc,%esp
+80102ed6:	68 60 60 8e 80       	push   $0x808e6060
+80102edb:	e8 70 46 00 00       	call   80107550 <acquire>
+  if((d = dcfind(dp, name)) != 0){
+80102ee0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102ee3:	89 d8                	mov    %ebx,%eax
+80102ee5:	e8 e6 ed ff ff       	call   80101cd0 <dcfind>
+80102eea:	83 c4 10             	add    $0x10,%esp
+80102eed:	85 c0                	test   %eax,%eax
+80102eef:	74 5f                	je     80102f50 <dirlookup+0xa0>
+  d->next->prev = d->prev;
+80102ef1:	8b 48 28             	mov    0x28(%eax),%ecx
+80102ef4:	8b 50 24             	mov    0x24(%eax),%edx
+    release(&dcache.lock);
+80102ef7:	83 ec 0c             	sub    $0xc,%esp
+  d->next->prev = d->prev;
+80102efa:	89 51 24             	mov    %edx,0x24(%ecx)
+  d->prev->next = d->next;
+80102efd:	8b 48 28             	mov    0x28(%eax),%ecx
+80102f00:	89 4a 28             	mov    %ecx,0x28(%edx)
+    d->next = &dcache.lru;
+80102f03:	c7 40 28 88 8d 8e 80 	movl   $0x808e8d88,0x28(%eax)
+    d->prev = dcache.lru.prev;
+80102f0a:	8b 15 ac 8d 8e 80    	mov    0x808e8dac,%edx
+80102f10:	89 50 24             	mov    %edx,0x24(%eax)
+  d->prev->next = d;
+80102f13:	89 42 28             	mov    %eax,0x28(%edx)
+  d->next->prev = d;
+80102f16:	8b 50 28             	mov    0x28(%eax),%edx
+80102f19:	89 42 24             	mov    %eax,0x24(%edx)
+    inum = d->inum;
+80102f1c:	8b 78 18             	mov    0x18(%eax),%edi
+    off = d->off;
+80102f1f:	8b 70 1c             	mov    0x1c(%eax),%esi
+    release(&dcache.lock);
+80102f22:	68 60 60 8e 80       	push   $0x808e6060
+80102f27:	e8 c4 45 00 00       	call   801074f0 <release>
+    if(inum == 0)
+80102f2c:	83 c4 10             	add    $0x10,%esp
+80102f2f:	85 ff                	test   %edi,%edi
+80102f31:	0f 84 d0 00 00 00    	je     80103007 <dirlookup+0x157>
+    if(poff)
+80102f37:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80102f3a:	85 c0                	test   %eax,%eax
+80102f3c:	74 02                	je     80102f40 <dirlookup+0x90>
+      *poff = off;
+80102f3e:	89 30                	mov    %esi,(%eax)
+    return iget(dp->dev, inum);
+80102f40:	8b 03                	mov    (%ebx),%eax
+80102f42:	89 fa                	mov    %edi,%edx
+}
+80102f44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80102f47:	5b                   	pop    %ebx
+80102f48:	5e                   	pop    %esi
+80102f49:	5f                   	pop    %edi
+80102f4a:	5d                   	pop    %ebp
+        return iget(dp->dev, inum);
+80102f4b:	e9 a0 e9 ff ff       	jmp    801018f0 <iget>
+  release(&dcache.lock);
+80102f50:	83 ec 0c             	sub    $0xc,%esp
+80102f53:	68 60 60 8e 80       	push   $0x808e6060
+80102f58:	e8 93 45 00 00       	call   801074f0 <release>
+  if(dp->size > 0){
+80102f5d:	8b 43 68             	mov    0x68(%ebx),%eax
+80102f60:	83 c4 10             	add    $0x10,%esp
+80102f63:	85 c0                	test   %eax,%eax
+80102f65:	0f 84 88 00 00 00    	je     80102ff3 <dirlookup+0x143>
+  if(dp->size <= BSIZE)
+80102f6b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+80102f70:	0f 87 a2 00 00 00    	ja     80103018 <dirlookup+0x168>
+80102f76:	31 f6                	xor    %esi,%esi
+    return 0;
+80102f78:	31 ff                	xor    %edi,%edi
+    bp = bread(dp->dev, bmap(dp, bn));
+80102f7a:	89 fa                	mov    %edi,%edx
+80102f7c:	89 d8                	mov    %ebx,%eax
+80102f7e:	89 f7                	mov    %esi,%edi
+80102f80:	e8 9b ef ff ff       	call   80101f20 <bmap>
+80102f85:	83 ec 08             	sub    $0x8,%esp
+80102f88:	c1 e7 04             	shl    $0x4,%edi
+80102f8b:	50                   	push   %eax
+80102f8c:	ff 33                	push   (%ebx)
+80102f8e:	e8 5d d5 ff ff       	call   801004f0 <bread>
+80102f93:	83 c4 10             	add    $0x10,%esp
+80102f96:	8b 70 60             	mov    0x60(%eax),%esi
+80102f99:	89 c1                	mov    %eax,%ecx
+    for(i = 0; i < DPB && bn*BSIZE + i*sizeof(*de) < dp->size; i++){
+80102f9b:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+80102f9e:	8d 86 00 10 00 00    	lea    0x1000(%esi),%eax
+80102fa4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80102fa7:	89 d8                	mov    %ebx,%eax
+80102fa9:	89 fb                	mov    %edi,%ebx
+80102fab:	89 c7                	mov    %eax,%edi
+80102fad:	eb 2e                	jmp    80102fdd <dirlookup+0x12d>
+80102faf:	90                   	nop
+      if(de[i].inum == 0)
+80102fb0:	66 83 3e 00          	cmpw   $0x0,(%esi)
+80102fb4:	74 1c                	je     80102fd2 <dirlookup+0x122>
+  return strncmp(s, t, DIRSIZ);
+80102fb6:	83 ec 04             	sub    $0x4,%esp
+      if(namecmp(name, de[i].name) == 0){
+80102fb9:	8d 46 02             	lea    0x2(%esi),%eax
+  return strncmp(s, t, DIRSIZ);
+80102fbc:	6a 0e                	push   $0xe
+80102fbe:	50                   	push   %eax
+80102fbf:	ff 75 e4             	push   -0x1c(%ebp)
+80102fc2:	e8 69 47 00 00       	call   80107730 <strncmp>
+      if(namecmp(name, de[i].name) == 0){
+80102fc7:	83 c4 10             	add    $0x10,%esp
+80102fca:	85 c0                	test   %eax,%eax
+80102fcc:	0f 84 d6 00 00 00    	je     801030a8 <dirlookup+0x1f8>
+    for(i = 0; i < DPB && bn*BSIZE + i*sizeof(*de) < dp->size; i++){
+80102fd2:	83 c3 10             	add    $0x10,%ebx
+80102fd5:	83 c6 10             	add    $0x10,%esi
+80102fd8:	39 75 e0             	cmp    %esi,-0x20(%ebp)
+80102fdb:	74 05                	je     80102fe2 <dirlookup+0x132>
+80102fdd:	3b 5f 68             	cmp    0x68(%edi),%ebx
+80102fe0:	72 ce                	jb     80102fb0 <dirlookup+0x100>
+80102fe2:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+    brelse(bp);
+80102fe5:	83 ec 0c             	sub    $0xc,%esp
+80102fe8:	89 fb                	mov    %edi,%ebx
+80102fea:	51                   	push   %ecx
+80102feb:	e8 40 d7 ff ff       	call   80100730 <brelse>
+80102ff0:	83 c4 10             	add    $0x10,%esp
+  dcenter(dp, name, 0, 0);
+80102ff3:	83 ec 0c             	sub    $0xc,%esp
+80102ff6:	31 c9                	xor    %ecx,%ecx
+80102ff8:	89 d8                	mov    %ebx,%eax
+80102ffa:	6a 00                	push   $0x0
+80102ffc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80102fff:	e8 7c ed ff ff       	call   80101d80 <dcenter>
+  return 0;
+80103004:	83 c4 10             	add    $0x10,%esp
+}
+80103007:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010300a:	31 c0                	xor    %eax,%eax
+8010300c:	5b                   	pop    %ebx
+8010300d:	5e                   	pop    %esi
+8010300e:	5f                   	pop    %edi
+8010300f:	5d                   	pop    %ebp
+80103010:	c3                   	ret
+80103011:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if((addr = ip->addrs[bn]) == 0)
+80103018:	8b 43 6c             	mov    0x6c(%ebx),%eax
+8010301b:	85 c0                	test   %eax,%eax
+8010301d:	0f 84 c5 00 00 00    	je     801030e8 <dirlookup+0x238>
+  bp = bread(dp->dev, bmap(dp, 0));
+80103023:	83 ec 08             	sub    $0x8,%esp
+80103026:	50                   	push   %eax
+80103027:	ff 33                	push   (%ebx)
+80103029:	e8 c2 d4 ff ff       	call   801004f0 <bread>
+8010302e:	83 c4 10             	add    $0x10,%esp
+80103031:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  dx = (struct dxentry*)bp->data;
+80103034:	8b 78 60             	mov    0x60(%eax),%edi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103037:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010303a:	89 c1                	mov    %eax,%ecx
+8010303c:	8d 70 0e             	lea    0xe(%eax),%esi
+  h = 2166136261U;
+8010303f:	b8 c5 9d 1c 81       	mov    $0x811c9dc5,%eax
+80103044:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103048:	0f b6 11             	movzbl (%ecx),%edx
+8010304b:	84 d2                	test   %dl,%dl
+8010304d:	74 0f                	je     8010305e <dirlookup+0x1ae>
+    h = (h ^ (uchar)name[i]) * 16777619;
+8010304f:	31 c2                	xor    %eax,%edx
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+80103051:	83 c1 01             	add    $0x1,%ecx
+    h = (h ^ (uchar)name[i]) * 16777619;
+80103054:	69 c2 93 01 00 01    	imul   $0x1000193,%edx,%eax
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+8010305a:	39 f1                	cmp    %esi,%ecx
+8010305c:	75 ea                	jne    80103048 <dirlookup+0x198>
+  bn = dx[dxfind(dx, dp->size/BSIZE - 1, dirhash(name))].blk;
+8010305e:	8b 73 68             	mov    0x68(%ebx),%esi
+  lo = 0;
+80103061:	31 c9                	xor    %ecx,%ecx
+  bn = dx[dxfind(dx, dp->size/BSIZE - 1, dirhash(name))].blk;
+80103063:	c1 ee 0c             	shr    $0xc,%esi
+  hi = n - 1;
+80103066:	83 ee 02             	sub    $0x2,%esi
+  while(lo < hi){
+80103069:	eb 13                	jmp    8010307e <dirlookup+0x1ce>
+8010306b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010306f:	90                   	nop
+    mid = (lo + hi + 1) / 2;
+80103070:	8d 54 0e 01          	lea    0x1(%esi,%ecx,1),%edx
+80103074:	d1 fa                	sar    %edx
+    if(dx[mid].hash <= h)
+80103076:	3b 44 d7 04          	cmp    0x4(%edi,%edx,8),%eax
+8010307a:	72 24                	jb     801030a0 <dirlookup+0x1f0>
+    mid = (lo + hi + 1) / 2;
+8010307c:	89 d1                	mov    %edx,%ecx
+  while(lo < hi){
+8010307e:	39 f1                	cmp    %esi,%ecx
+80103080:	7c ee                	jl     80103070 <dirlookup+0x1c0>
+  bn = dx[dxfind(dx, dp->size/BSIZE - 1, dirhash(name))].blk;
+80103082:	0f b7 7c cf 02       	movzwl 0x2(%edi,%ecx,8),%edi
+  brelse(bp);
+80103087:	83 ec 0c             	sub    $0xc,%esp
+8010308a:	ff 75 e0             	push   -0x20(%ebp)
+    for(i = 0; i < DPB && bn*BSIZE + i*sizeof(*de) < dp->size; i++){
+8010308d:	89 fe                	mov    %edi,%esi
+  brelse(bp);
+8010308f:	e8 9c d6 ff ff       	call   80100730 <brelse>
+    for(i = 0; i < DPB && bn*BSIZE + i*sizeof(*de) < dp->size; i++){
+80103094:	c1 e6 08             	shl    $0x8,%esi
+  return bn;
+80103097:	83 c4 10             	add    $0x10,%esp
+8010309a:	e9 db fe ff ff       	jmp    80102f7a <dirlookup+0xca>
+8010309f:	90                   	nop
+      hi = mid - 1;
+801030a0:	8d 72 ff             	lea    -0x1(%edx),%esi
+801030a3:	eb d9                	jmp    8010307e <dirlookup+0x1ce>
+801030a5:	8d 76 00             	lea    0x0(%esi),%esi
+        inum = de[i].inum;
+801030a8:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+        brelse(bp);
+801030ab:	83 ec 0c             	sub    $0xc,%esp
+        inum = de[i].inum;
+801030ae:	0f b7 36             	movzwl (%esi),%esi
+801030b1:	89 f8                	mov    %edi,%eax
+801030b3:	89 df                	mov    %ebx,%edi
+801030b5:	89 c3                	mov    %eax,%ebx
+        brelse(bp);
+801030b7:	51                   	push   %ecx
+801030b8:	e8 73 d6 ff ff       	call   80100730 <brelse>
+        if(poff)
+801030bd:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801030c0:	83 c4 10             	add    $0x10,%esp
+801030c3:	85 c0                	test   %eax,%eax
+801030c5:	74 02                	je     801030c9 <dirlookup+0x219>
+          *poff = off;
+801030c7:	89 38                	mov    %edi,(%eax)
+        dcenter(dp, name, inum, off);
+801030c9:	83 ec 0c             	sub    $0xc,%esp
+801030cc:	89 d8                	mov    %ebx,%eax
+801030ce:	89 f1                	mov    %esi,%ecx
+801030d0:	57                   	push   %edi
+801030d1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801030d4:	e8 a7 ec ff ff       	call   80101d80 <dcenter>
+        return iget(dp->dev, inum);
+801030d9:	8b 03                	mov    (%ebx),%eax
+801030db:	83 c4 10             	add    $0x10,%esp
+801030de:	89 f2                	mov    %esi,%edx
+801030e0:	e9 5f fe ff ff       	jmp    80102f44 <dirlookup+0x94>
+801030e5:	8d 76 00             	lea    0x0(%esi),%esi
+  ip->lastblk = balloc(ip->dev, ip->lastblk ? ip->lastblk + 1 : 0);
+801030e8:	8b 53 5c             	mov    0x5c(%ebx),%edx
+801030eb:	8b 03                	mov    (%ebx),%eax
+801030ed:	83 fa 01             	cmp    $0x1,%edx
+801030f0:	83 da ff             	sbb    $0xffffffff,%edx
+801030f3:	e8 48 e9 ff ff       	call   80101a40 <balloc>
+801030f8:	89 43 5c             	mov    %eax,0x5c(%ebx)
+      ip->addrs[bn] = addr = iballoc(ip);
+801030fb:	89 43 6c             	mov    %eax,0x6c(%ebx)
+801030fe:	e9 20 ff ff ff       	jmp    80103023 <dirlookup+0x173>
+    panic("dirlookup not DIR");
+80103103:	83 ec 0c             	sub    $0xc,%esp
+80103106:	68 bf b0 10 80       	push   $0x8010b0bf
+8010310b:	e8 70 d7 ff ff       	call   80100880 <panic>
+
+80103110 <namex>:
+// If parent != 0, return the inode for the parent and copy the final
+// path element into name, which must have room for DIRSIZ bytes.
+// Must be called inside a transaction since it calls iput().
+static struct inode*
+namex(char *path, int nameiparent, char *name)
+{
+80103110:	55                   	push   %ebp
+80103111:	89 e5                	mov    %esp,%ebp
+80103113:	57                   	push   %edi
+80103114:	56                   	push   %esi
+80103115:	53                   	push   %ebx
+80103116:	89 c3                	mov    %eax,%ebx
+80103118:	83 ec 1c             	sub    $0x1c,%esp
+  struct inode *ip, *next;
+
+  if(*path == '/')
+8010311b:	80 38 2f             	cmpb   $0x2f,(%eax)
+{
+8010311e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+80103121:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  if(*path == '/')
+80103124:	0f 84 74 01 00 00    	je     8010329e <namex+0x18e>
+    ip = iget(ROOTDEV, ROOTINO);
+  else
+    ip = idup(myproc()->cwd);
+8010312a:	e8 51 2c 00 00       	call   80105d80 <myproc>
+  acquire(&icache.lock);
+8010312f:	83 ec 0c             	sub    $0xc,%esp
+    ip = idup(myproc()->cwd);
+80103132:	8b b0 84 00 00 00    	mov    0x84(%eax),%esi
+  acquire(&icache.lock);
+80103138:	68 c0 8d 8e 80       	push   $0x808e8dc0
+8010313d:	e8 0e 44 00 00       	call   80107550 <acquire>
+  ip->ref++;
+80103142:	83 46 08 01          	addl   $0x1,0x8(%esi)
+  release(&icache.lock);
+80103146:	c7 04 24 c0 8d 8e 80 	movl   $0x808e8dc0,(%esp)
+8010314d:	e8 9e 43 00 00       	call   801074f0 <release>
+80103152:	83 c4 10             	add    $0x10,%esp
+80103155:	eb 0c                	jmp    80103163 <namex+0x53>
+80103157:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010315e:	66 90                	xchg   %ax,%ax
+    path++;
+80103160:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+80103163:	0f b6 03             	movzbl (%ebx),%eax
+80103166:	3c 2f                	cmp    $0x2f,%al
+80103168:	74 f6                	je     80103160 <namex+0x50>
+  if(*path == 0)
+8010316a:	84 c0                	test   %al,%al
+8010316c:	0f 84 0e 01 00 00    	je     80103280 <namex+0x170>
+  while(*path != '/' && *path != 0)
+80103172:	0f b6 03             	movzbl (%ebx),%eax
+80103175:	84 c0                	test   %al,%al
+80103177:	0f 84 18 01 00 00    	je     80103295 <namex+0x185>
+8010317d:	89 df                	mov    %ebx,%edi
+8010317f:	3c 2f                	cmp    $0x2f,%al
+80103181:	0f 84 0e 01 00 00    	je     80103295 <namex+0x185>
+80103187:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010318e:	66 90                	xchg   %ax,%ax
+80103190:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+    path++;
+80103194:	83 c7 01             	add    $0x1,%edi
+  while(*path != '/' && *path != 0)
+80103197:	3c 2f                	cmp    $0x2f,%al
+80103199:	74 04                	je     8010319f <namex+0x8f>
+8010319b:	84 c0                	test   %al,%al
+8010319d:	75 f1                	jne    80103190 <namex+0x80>
+  len = path - s;
+8010319f:	89 f8                	mov    %edi,%eax
+801031a1:	29 d8                	sub    %ebx,%eax
+  if(len >= DIRSIZ)
+801031a3:	83 f8 0d             	cmp    $0xd,%eax
+801031a6:	0f 8e ac 00 00 00    	jle    80103258 <namex+0x148>
+    memmove(name, s, DIRSIZ);
+801031ac:	83 ec 04             	sub    $0x4,%esp
+801031af:	6a 0e                	push   $0xe
+801031b1:	53                   	push   %ebx
+    path++;
+801031b2:	89 fb                	mov    %edi,%ebx
+    memmove(name, s, DIRSIZ);
+801031b4:	ff 75 e4             	push   -0x1c(%ebp)
+801031b7:	e8 04 45 00 00       	call   801076c0 <memmove>
+801031bc:	83 c4 10             	add    $0x10,%esp
+  while(*path == '/')
+801031bf:	80 3f 2f             	cmpb   $0x2f,(%edi)
+801031c2:	75 0c                	jne    801031d0 <namex+0xc0>
+801031c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    path++;
+801031c8:	83 c3 01             	add    $0x1,%ebx
+  while(*path == '/')
+801031cb:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+801031ce:	74 f8                	je     801031c8 <namex+0xb8>
+
+  while((path = skipelem(path, name)) != 0){
+    ilock(ip);
+801031d0:	83 ec 0c             	sub    $0xc,%esp
+801031d3:	56                   	push   %esi
+801031d4:	e8 87 f6 ff ff       	call   80102860 <ilock>
+    if(ip->type != T_DIR){
+801031d9:	83 c4 10             	add    $0x10,%esp
+801031dc:	66 83 7e 60 01       	cmpw   $0x1,0x60(%esi)
+801031e1:	0f 85 cd 00 00 00    	jne    801032b4 <namex+0x1a4>
+      iunlockput(ip);
+      return 0;
+    }
+    if(nameiparent && *path == '\0'){
+801031e7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801031ea:	85 c0                	test   %eax,%eax
+801031ec:	74 09                	je     801031f7 <namex+0xe7>
+801031ee:	80 3b 00             	cmpb   $0x0,(%ebx)
+801031f1:	0f 84 34 01 00 00    	je     8010332b <namex+0x21b>
+      // Stop one level early.
+      iunlock(ip);
+      return ip;
+    }
+    if((next = dirlookup(ip, name, 0)) == 0){
+801031f7:	83 ec 04             	sub    $0x4,%esp
+801031fa:	6a 00                	push   $0x0
+801031fc:	ff 75 e4             	push   -0x1c(%ebp)
+801031ff:	56                   	push   %esi
+80103200:	e8 ab fc ff ff       	call   80102eb0 <dirlookup>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80103205:	8d 56 18             	lea    0x18(%esi),%edx
+    if((next = dirlookup(ip, name, 0)) == 0){
+80103208:	83 c4 10             	add    $0x10,%esp
+8010320b:	89 c7                	mov    %eax,%edi
+8010320d:	85 c0                	test   %eax,%eax
+8010320f:	0f 84 e1 00 00 00    	je     801032f6 <namex+0x1e6>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+80103215:	83 ec 0c             	sub    $0xc,%esp
+80103218:	52                   	push   %edx
+80103219:	89 55 e0             	mov    %edx,-0x20(%ebp)
+8010321c:	e8 ff 40 00 00       	call   80107320 <holdingsleep>
+80103221:	83 c4 10             	add    $0x10,%esp
+80103224:	85 c0                	test   %eax,%eax
+80103226:	0f 84 3f 01 00 00    	je     8010336b <namex+0x25b>
+8010322c:	8b 56 08             	mov    0x8(%esi),%edx
+8010322f:	85 d2                	test   %edx,%edx
+80103231:	0f 8e 34 01 00 00    	jle    8010336b <namex+0x25b>
+  releasesleep(&ip->lock);
+80103237:	8b 55 e0             	mov    -0x20(%ebp),%edx
+8010323a:	83 ec 0c             	sub    $0xc,%esp
+8010323d:	52                   	push   %edx
+8010323e:	e8 9d 40 00 00       	call   801072e0 <releasesleep>
+  iput(ip);
+80103243:	89 34 24             	mov    %esi,(%esp)
+80103246:	89 fe                	mov    %edi,%esi
+80103248:	e8 43 f7 ff ff       	call   80102990 <iput>
+8010324d:	83 c4 10             	add    $0x10,%esp
+  while(*path == '/')
+80103250:	e9 0e ff ff ff       	jmp    80103163 <namex+0x53>
+80103255:	8d 76 00             	lea    0x0(%esi),%esi
+    name[len] = 0;
+80103258:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010325b:	8d 14 01             	lea    (%ecx,%eax,1),%edx
+    memmove(name, s, len);
+8010325e:	83 ec 04             	sub    $0x4,%esp
+80103261:	89 55 e0             	mov    %edx,-0x20(%ebp)
+80103264:	50                   	push   %eax
+80103265:	53                   	push   %ebx
+    name[len] = 0;
+80103266:	89 fb                	mov    %edi,%ebx
+    memmove(name, s, len);
+80103268:	ff 75 e4             	push   -0x1c(%ebp)
+8010326b:	e8 50 44 00 00       	call   801076c0 <memmove>
+    name[len] = 0;
+80103270:	8b 55 e0             	mov    -0x20(%ebp),%edx
+80103273:	83 c4 10             	add    $0x10,%esp
+80103276:	c6 02 00             	movb   $0x0,(%edx)
+80103279:	e9 41 ff ff ff       	jmp    801031bf <namex+0xaf>
+8010327e:	66 90                	xchg   %ax,%ax
+      return 0;
+    }
+    iunlockput(ip);
+    ip = next;
+  }
+  if(nameiparent){
+80103280:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80103283:	85 c0                	test   %eax,%eax
+80103285:	0f 85 d0 00 00 00    	jne    8010335b <namex+0x24b>
+    iput(ip);
+    return 0;
+  }
+  return ip;
+}
+8010328b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010328e:	89 f0                	mov    %esi,%eax
+80103290:	5b                   	pop    %ebx
+80103291:	5e                   	pop    %esi
+80103292:	5f                   	pop    %edi
+80103293:	5d                   	pop    %ebp
+80103294:	c3                   	ret
+  while(*path != '/' && *path != 0)
+80103295:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80103298:	89 df                	mov    %ebx,%edi
+8010329a:	31 c0                	xor    %eax,%eax
+8010329c:	eb c0                	jmp    8010325e <namex+0x14e>
+    ip = iget(ROOTDEV, ROOTINO);
+8010329e:	ba 01 00 00 00       	mov    $0x1,%edx
+801032a3:	b8 01 00 00 00       	mov    $0x1,%eax
+801032a8:	e8 43 e6 ff ff       	call   801018f0 <iget>
+801032ad:	89 c6                	mov    %eax,%esi
+801032af:	e9 af fe ff ff       	jmp    80103163 <namex+0x53>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+801032b4:	83 ec 0c             	sub    $0xc,%esp
+801032b7:	8d 5e 18             	lea    0x18(%esi),%ebx
+801032ba:	53                   	push   %ebx
+801032bb:	e8 60 40 00 00       	call   80107320 <holdingsleep>
+801032c0:	83 c4 10             	add    $0x10,%esp
+801032c3:	85 c0                	test   %eax,%eax
+801032c5:	0f 84 a0 00 00 00    	je     8010336b <namex+0x25b>
+801032cb:	8b 46 08             	mov    0x8(%esi),%eax
+801032ce:	85 c0                	test   %eax,%eax
+801032d0:	0f 8e 95 00 00 00    	jle    8010336b <namex+0x25b>
+  releasesleep(&ip->lock);
+801032d6:	83 ec 0c             	sub    $0xc,%esp
+801032d9:	53                   	push   %ebx
+801032da:	e8 01 40 00 00       	call   801072e0 <releasesleep>
+  iput(ip);
+801032df:	89 34 24             	mov    %esi,(%esp)
+      return 0;
+801032e2:	31 f6                	xor    %esi,%esi
+  iput(ip);
+801032e4:	e8 a7 f6 ff ff       	call   80102990 <iput>
+      return 0;
+801032e9:	83 c4 10             	add    $0x10,%esp
+}
+801032ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801032ef:	89 f0                	mov    %esi,%eax
+801032f1:	5b                   	pop    %ebx
+801032f2:	5e                   	pop    %esi
+801032f3:	5f                   	pop    %edi
+801032f4:	5d                   	pop    %ebp
+801032f5:	c3                   	ret
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+801032f6:	83 ec 0c             	sub    $0xc,%esp
+801032f9:	52                   	push   %edx
+801032fa:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+801032fd:	e8 1e 40 00 00       	call   80107320 <holdingsleep>
+80103302:	83 c4 10             	add    $0x10,%esp
+80103305:	85 c0                	test   %eax,%eax
+80103307:	74 62                	je     8010336b <namex+0x25b>
+80103309:	8b 4e 08             	mov    0x8(%esi),%ecx
+8010330c:	85 c9                	test   %ecx,%ecx
+8010330e:	7e 5b                	jle    8010336b <namex+0x25b>
+  releasesleep(&ip->lock);
+80103310:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80103313:	83 ec 0c             	sub    $0xc,%esp
+80103316:	52                   	push   %edx
+80103317:	e8 c4 3f 00 00       	call   801072e0 <releasesleep>
+  iput(ip);
+8010331c:	89 34 24             	mov    %esi,(%esp)
+      return 0;
+8010331f:	31 f6                	xor    %esi,%esi
+  iput(ip);
+80103321:	e8 6a f6 ff ff       	call   80102990 <iput>
+      return 0;
+80103326:	83 c4 10             	add    $0x10,%esp
+80103329:	eb c1                	jmp    801032ec <namex+0x1dc>
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
+8010332b:	83 ec 0c             	sub    $0xc,%esp
+8010332e:	8d 5e 18             	lea    0x18(%esi),%ebx
+80103331:	53                   	push   %ebx
+80103332:	e8 e9 3f 00 00       	call   80107320 <holdingsleep>
+80103337:	83 c4 10             	add    $0x10,%esp
+8010333a:	85 c0                	test   %eax,%eax
+8010333c:	74 2d                	je     8010336b <namex+0x25b>
+8010333e:	8b 7e 08             	mov    0x8(%esi),%edi
+80103341:	85 ff                	test   %edi,%edi
+80103343:	7e 26                	jle    8010336b <namex+0x25b>
+  releasesleep(&ip->lock);
+80103345:	83 ec 0c             	sub    $0xc,%esp
+80103348:	53                   	push   %ebx
+80103349:	e8 92 3f 00 00       	call   801072e0 <releasesleep>
+}
+8010334e:	83 c4 10             	add    $0x10,%esp
+}
+80103351:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103354:	89 f0                	mov    %esi,%eax
+80103356:	5b                   	pop    %ebx
+80103357:	5e                   	pop    %esi
+80103358:	5f                   	pop    %edi
+80103359:	5d                   	pop    %ebp
+8010335a:	c3                   	ret
+    iput(ip);
+8010335b:	83 ec 0c             	sub    $0xc,%esp
+8010335e:	56                   	push   %esi
+      return 0;
+8010335f:	31 f6                	xor    %esi,%esi
+    iput(ip);
+80103361:	e8 2a f6 ff ff       	call   80102990 <iput>
+    return 0;
+80103366:	83 c4 10             	add    $0x10,%esp
+80103369:	eb 81                	jmp    801032ec <namex+0x1dc>
+    panic("iunlock");
+8010336b:	83 ec 0c             	sub    $0xc,%esp
+8010336e:	68 b7 b0 10 80       	push   $0x8010b0b7
+80103373:	e8 08 d5 ff ff       	call   80100880 <panic>
+80103378:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010337f:	90                   	nop
+
+80103380 <dirlink>:
+{
+80103380:	55                   	push   %ebp
+80103381:	89 e5                	mov    %esp,%ebp
+80103383:	57                   	push   %edi
+80103384:	56                   	push   %esi
+80103385:	53                   	push   %ebx
+80103386:	83 ec 30             	sub    $0x30,%esp
+80103389:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010338c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+8010338f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80103392:	89 45 d0             	mov    %eax,-0x30(%ebp)
+80103395:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if((ip = dirlookup(dp, name, 0)) != 0){
+80103398:	6a 00                	push   $0x0
+8010339a:	50                   	push   %eax
+8010339b:	53                   	push   %ebx
+8010339c:	e8 0f fb ff ff       	call   80102eb0 <dirlookup>
+801033a1:	83 c4 10             	add    $0x10,%esp
+801033a4:	85 c0                	test   %eax,%eax
+801033a6:	0f 85 18 02 00 00    	jne    801035c4 <dirlink+0x244>
+  if(dp->size > BSIZE)
+801033ac:	8b 7b 68             	mov    0x68(%ebx),%edi
+801033af:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+801033b5:	0f 87 95 00 00 00    	ja     80103450 <dirlink+0xd0>
+  for(off = 0; off < dp->size; off += sizeof(de)){
+801033bb:	8d 75 d8             	lea    -0x28(%ebp),%esi
+801033be:	85 ff                	test   %edi,%edi
+801033c0:	74 3f                	je     80103401 <dirlink+0x81>
+801033c2:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+801033c9:	31 ff                	xor    %edi,%edi
+801033cb:	8d 75 d8             	lea    -0x28(%ebp),%esi
+801033ce:	eb 0b                	jmp    801033db <dirlink+0x5b>
+801033d0:	83 c7 10             	add    $0x10,%edi
+801033d3:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+801033d6:	3b 7b 68             	cmp    0x68(%ebx),%edi
+801033d9:	73 1d                	jae    801033f8 <dirlink+0x78>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+801033db:	6a 10                	push   $0x10
+801033dd:	57                   	push   %edi
+801033de:	56                   	push   %esi
+801033df:	53                   	push   %ebx
+801033e0:	e8 eb f7 ff ff       	call   80102bd0 <readi>
+801033e5:	83 c4 10             	add    $0x10,%esp
+801033e8:	83 f8 10             	cmp    $0x10,%eax
+801033eb:	0f 85 e9 01 00 00    	jne    801035da <dirlink+0x25a>
+    if(de.inum == 0)
+801033f1:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+801033f6:	75 d8                	jne    801033d0 <dirlink+0x50>
+  if(off == BSIZE){
+801033f8:	81 7d d4 00 10 00 00 	cmpl   $0x1000,-0x2c(%ebp)
+801033ff:	74 67                	je     80103468 <dirlink+0xe8>
+  strncpy(de.name, name, DIRSIZ);
+80103401:	83 ec 04             	sub    $0x4,%esp
+80103404:	8d 45 da             	lea    -0x26(%ebp),%eax
+80103407:	6a 0e                	push   $0xe
+80103409:	ff 75 d0             	push   -0x30(%ebp)
+8010340c:	50                   	push   %eax
+8010340d:	e8 6e 43 00 00       	call   80107780 <strncpy>
+  de.inum = inum;
+80103412:	0f b7 45 cc          	movzwl -0x34(%ebp),%eax
+80103416:	66 89 45 d8          	mov    %ax,-0x28(%ebp)
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+8010341a:	6a 10                	push   $0x10
+8010341c:	57                   	push   %edi
+8010341d:	56                   	push   %esi
+8010341e:	53                   	push   %ebx
+8010341f:	e8 1c f9 ff ff       	call   80102d40 <writei>
+80103424:	83 c4 20             	add    $0x20,%esp
+80103427:	83 f8 10             	cmp    $0x10,%eax
+8010342a:	0f 85 b7 01 00 00    	jne    801035e7 <dirlink+0x267>
+  dcenter(dp, name, inum, off);
+80103430:	83 ec 0c             	sub    $0xc,%esp
+80103433:	89 d8                	mov    %ebx,%eax
+80103435:	57                   	push   %edi
+80103436:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+80103439:	8b 55 d0             	mov    -0x30(%ebp),%edx
+8010343c:	e8 3f e9 ff ff       	call   80101d80 <dcenter>
+  return 0;
+80103441:	83 c4 10             	add    $0x10,%esp
+80103444:	31 c0                	xor    %eax,%eax
+}
+80103446:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103449:	5b                   	pop    %ebx
+8010344a:	5e                   	pop    %esi
+8010344b:	5f                   	pop    %edi
+8010344c:	5d                   	pop    %ebp
+8010344d:	c3                   	ret
+8010344e:	66 90                	xchg   %ax,%ax
+    return dxlink(dp, name, inum);
+80103450:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+80103453:	8b 55 d0             	mov    -0x30(%ebp),%edx
+}
+80103456:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return dxlink(dp, name, inum);
+80103459:	89 d8                	mov    %ebx,%eax
+}
+8010345b:	5b                   	pop    %ebx
+8010345c:	5e                   	pop    %esi
+8010345d:	5f                   	pop    %edi
+8010345e:	5d                   	pop    %ebp
+    return dxlink(dp, name, inum);
+8010345f:	e9 5c ef ff ff       	jmp    801023c0 <dxlink>
+80103464:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((addr = ip->addrs[bn]) == 0)
+80103468:	8b 43 70             	mov    0x70(%ebx),%eax
+8010346b:	85 c0                	test   %eax,%eax
+8010346d:	0f 84 36 01 00 00    	je     801035a9 <dirlink+0x229>
+  lp = bread(dp->dev, bmap(dp, 1));
+80103473:	83 ec 08             	sub    $0x8,%esp
+80103476:	50                   	push   %eax
+80103477:	ff 33                	push   (%ebx)
+80103479:	e8 72 d0 ff ff       	call   801004f0 <bread>
+    if((addr = ip->addrs[bn]) == 0)
+8010347e:	83 c4 10             	add    $0x10,%esp
+  lp = bread(dp->dev, bmap(dp, 1));
+80103481:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    if((addr = ip->addrs[bn]) == 0)
+80103484:	8b 43 6c             	mov    0x6c(%ebx),%eax
+80103487:	85 c0                	test   %eax,%eax
+80103489:	0f 84 ff 00 00 00    	je     8010358e <dirlink+0x20e>
+  bp = bread(dp->dev, bmap(dp, 0));
+8010348f:	83 ec 08             	sub    $0x8,%esp
+80103492:	50                   	push   %eax
+80103493:	ff 33                	push   (%ebx)
+80103495:	e8 56 d0 ff ff       	call   801004f0 <bread>
+  memmove(lp->data, bp->data, BSIZE);
+8010349a:	83 c4 0c             	add    $0xc,%esp
+8010349d:	68 00 10 00 00       	push   $0x1000
+  bp = bread(dp->dev, bmap(dp, 0));
+801034a2:	89 c6                	mov    %eax,%esi
+  memmove(lp->data, bp->data, BSIZE);
+801034a4:	ff 70 60             	push   0x60(%eax)
+801034a7:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+801034aa:	ff 77 60             	push   0x60(%edi)
+801034ad:	e8 0e 42 00 00       	call   801076c0 <memmove>
+  memset(bp->data, 0, BSIZE);
+801034b2:	83 c4 0c             	add    $0xc,%esp
+801034b5:	68 00 10 00 00       	push   $0x1000
+801034ba:	6a 00                	push   $0x0
+801034bc:	ff 76 60             	push   0x60(%esi)
+801034bf:	e8 6c 41 00 00       	call   80107630 <memset>
+  dx = (struct dxentry*)bp->data;
+801034c4:	8b 46 60             	mov    0x60(%esi),%eax
+  dx[0].blk = 1;
+801034c7:	ba 01 00 00 00       	mov    $0x1,%edx
+801034cc:	66 89 50 02          	mov    %dx,0x2(%eax)
+  dx[0].hash = 0;
+801034d0:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  log_write(lp);
+801034d7:	89 3c 24             	mov    %edi,(%esp)
+801034da:	e8 21 14 00 00       	call   80104900 <log_write>
+  log_write(bp);
+801034df:	89 34 24             	mov    %esi,(%esp)
+801034e2:	e8 19 14 00 00       	call   80104900 <log_write>
+  brelse(bp);
+801034e7:	89 34 24             	mov    %esi,(%esp)
+  de = (struct dirent*)lp->data;
+801034ea:	be 00 10 00 00       	mov    $0x1000,%esi
+  brelse(bp);
+801034ef:	e8 3c d2 ff ff       	call   80100730 <brelse>
+  dp->size = 2*BSIZE;
+801034f4:	c7 43 68 00 20 00 00 	movl   $0x2000,0x68(%ebx)
+  iupdate(dp);
+801034fb:	89 1c 24             	mov    %ebx,(%esp)
+801034fe:	e8 3d ee ff ff       	call   80102340 <iupdate>
+  for(i = 0; i < DPB; i++)
+80103503:	8b 47 60             	mov    0x60(%edi),%eax
+80103506:	83 c4 10             	add    $0x10,%esp
+80103509:	89 45 c8             	mov    %eax,-0x38(%ebp)
+8010350c:	8d 78 02             	lea    0x2(%eax),%edi
+8010350f:	eb 15                	jmp    80103526 <dirlink+0x1a6>
+80103511:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103518:	83 c6 10             	add    $0x10,%esi
+8010351b:	83 c7 10             	add    $0x10,%edi
+8010351e:	81 fe 00 20 00 00    	cmp    $0x2000,%esi
+80103524:	74 45                	je     8010356b <dirlink+0x1eb>
+    if(de[i].inum != 0)
+80103526:	66 83 7f fe 00       	cmpw   $0x0,-0x2(%edi)
+8010352b:	74 eb                	je     80103518 <dirlink+0x198>
+  acquire(&dcache.lock);
+8010352d:	83 ec 0c             	sub    $0xc,%esp
+80103530:	68 60 60 8e 80       	push   $0x808e6060
+80103535:	e8 16 40 00 00       	call   80107550 <acquire>
+  if((d = dcfind(dp, name)) != 0)
+8010353a:	89 fa                	mov    %edi,%edx
+8010353c:	89 d8                	mov    %ebx,%eax
+8010353e:	e8 8d e7 ff ff       	call   80101cd0 <dcfind>
+80103543:	83 c4 10             	add    $0x10,%esp
+80103546:	85 c0                	test   %eax,%eax
+80103548:	74 03                	je     8010354d <dirlink+0x1cd>
+    d->off = off;
+8010354a:	89 70 1c             	mov    %esi,0x1c(%eax)
+  release(&dcache.lock);
+8010354d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < DPB; i++)
+80103550:	83 c6 10             	add    $0x10,%esi
+80103553:	83 c7 10             	add    $0x10,%edi
+  release(&dcache.lock);
+80103556:	68 60 60 8e 80       	push   $0x808e6060
+8010355b:	e8 90 3f 00 00       	call   801074f0 <release>
+}
+80103560:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < DPB; i++)
+80103563:	81 fe 00 20 00 00    	cmp    $0x2000,%esi
+80103569:	75 bb                	jne    80103526 <dirlink+0x1a6>
+  brelse(lp);
+8010356b:	83 ec 0c             	sub    $0xc,%esp
+8010356e:	ff 75 d4             	push   -0x2c(%ebp)
+80103571:	e8 ba d1 ff ff       	call   80100730 <brelse>
+    return dxlink(dp, name, inum);
+80103576:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+80103579:	8b 55 d0             	mov    -0x30(%ebp),%edx
+8010357c:	89 d8                	mov    %ebx,%eax
+8010357e:	e8 3d ee ff ff       	call   801023c0 <dxlink>
+80103583:	83 c4 10             	add    $0x10,%esp
+}
+80103586:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80103589:	5b                   	pop    %ebx
+8010358a:	5e                   	pop    %esi
+8010358b:	5f                   	pop    %edi
+8010358c:	5d                   	pop    %ebp
+8010358d:	c3                   	ret
+  ip->lastblk = balloc(ip->dev, ip->lastblk ? ip->lastblk + 1 : 0);
+8010358e:	8b 53 5c             	mov    0x5c(%ebx),%edx
+80103591:	8b 03                	mov    (%ebx),%eax
+80103593:	83 fa 01             	cmp    $0x1,%edx
+80103596:	83 da ff             	sbb    $0xffffffff,%edx
+80103599:	e8 a2 e4 ff ff       	call   80101a40 <balloc>
+8010359e:	89 43 5c             	mov    %eax,0x5c(%ebx)
+      ip->addrs[bn] = addr = iballoc(ip);
+801035a1:	89 43 6c             	mov    %eax,0x6c(%ebx)
+801035a4:	e9 e6 fe ff ff       	jmp    8010348f <dirlink+0x10f>
+  ip->lastblk = balloc(ip->dev, ip->lastblk ? ip->lastblk + 1 : 0);
+801035a9:	8b 53 5c             	mov    0x5c(%ebx),%edx
+801035ac:	8b 03                	mov    (%ebx),%eax
+801035ae:	83 fa 01             	cmp    $0x1,%edx
+801035b1:	83 da ff             	sbb    $0xffffffff,%edx
+801035b4:	e8 87 e4 ff ff       	call   80101a40 <balloc>
+801035b9:	89 43 5c             	mov    %eax,0x5c(%ebx)
+      ip->addrs[bn] = addr = iballoc(ip);
+801035bc:	89 43 70             	mov    %eax,0x70(%ebx)
+801035bf:	e9 af fe ff ff       	jmp    80103473 <dirlink+0xf3>
+    iput(ip);
+801035c4:	83 ec 0c             	sub    $0xc,%esp
+801035c7:	50                   	push   %eax
+801035c8:	e8 c3 f3 ff ff       	call   80102990 <iput>
+    return -1;
+801035cd:	83 c4 10             	add    $0x10,%esp
+801035d0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801035d5:	e9 6c fe ff ff       	jmp    80103446 <dirlink+0xc6>
+      panic("dirlink read");
+801035da:	83 ec 0c             	sub    $0xc,%esp
+801035dd:	68 d1 b0 10 80       	push   $0x8010b0d1
+801035e2:	e8 99 d2 ff ff       	call   80100880 <panic>
+    panic("dirlink");
+801035e7:	83 ec 0c             	sub    $0xc,%esp
+801035ea:	68 de b0 10 80       	push   $0x8010b0de
+801035ef:	e8 8c d2 ff ff       	call   80100880 <panic>
+801035f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801035fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801035ff:	90                   	nop
+
+80103600 <namei>:
+
+struct inode*
+namei(char *path)
+{
+80103600:	55                   	push   %ebp
+  char name[DIRSIZ];
+  return namex(path, 0, name);
+80103601:	31 d2                	xor    %edx,%edx
+{
+80103603:	89 e5                	mov    %esp,%ebp
+80103605:	83 ec 18             	sub    $0x18,%esp
+  return namex(path, 0, name);
+80103608:	8b 45 08             	mov    0x8(%ebp),%eax
+8010360b:	8d 4d ea             	lea    -0x16(%ebp),%ecx
+8010360e:	e8 fd fa ff ff       	call   80103110 <namex>
+}
+80103613:	c9                   	leave
+80103614:	c3                   	ret
+80103615:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010361c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80103620 <nameiparent>:
+
+struct inode*
+nameiparent(char *path, char *name)
+{
+80103620:	55                   	push   %ebp
+  return namex(path, 1, name);
+80103621:	ba 01 00 00 00       	mov    $0x1,%edx
+{
+80103626:	89 e5                	mov    %esp,%ebp
+  return namex(path, 1, name);
+80103628:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010362b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+8010362e:	5d                   	pop    %ebp
+  return namex(path, 1, name);
+8010362f:	e9 dc fa ff ff       	jmp    80103110 <namex>
+80103634:	66 90                	xchg   %ax,%ax
+80103636:	66 90                	xchg   %ax,%ax
+80103638:	66 90                	xchg   %ax,%ax
+8010363a:	66 90                	xchg   %ax,%ax
+8010363c:	66 90                	xchg   %ax,%ax
+8010363e:	66 90                	xchg   %ax,%ax
+
+80103640 <ioapicinit>:
+  ioapic->data = data;
+}
+
+void
+ioapicinit(void)
+{
+80103640:	55                   	push   %ebp
+80103641:	89 e5                	mov    %esp,%ebp
+80103643:	56                   	push   %esi
+80103644:	53                   	push   %ebx
+  int i, id, maxintr;
+
+  ioapic = (volatile struct ioapic*)IOAPIC;
+80103645:	c7 05 ac 0c 8f 80 00 	movl   $0xfec00000,0x808f0cac
+8010364c:	00 c0 fe 
+  ioapic->reg = reg;
+8010364f:	c7 05 00 00 c0 fe 01 	movl   $0x1,0xfec00000
+80103656:	00 00 00 
+  return ioapic->data;
+80103659:	8b 15 ac 0c 8f 80    	mov    0x808f0cac,%edx
+8010365f:	8b 72 10             	mov    0x10(%edx),%esi
+  ioapic->reg = reg;
+80103662:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+  return ioapic->data;
+80103668:	8b 1d ac 0c 8f 80    	mov    0x808f0cac,%ebx
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+  id = ioapicread(REG_ID) >> 24;
+  if(id != ioapicid)
+8010366e:	0f b6 15 00 cf 90 80 	movzbl 0x8090cf00,%edx
+  maxintr = (ioapicread(REG_VER) >> 16) & 0xFF;
+80103675:	c1 ee 10             	shr    $0x10,%esi
+80103678:	89 f0                	mov    %esi,%eax
+8010367a:	0f b6 f0             	movzbl %al,%esi
+  return ioapic->data;
+8010367d:	8b 43 10             	mov    0x10(%ebx),%eax
+  id = ioapicread(REG_ID) >> 24;
+80103680:	c1 e8 18             	shr    $0x18,%eax
+  if(id != ioapicid)
+80103683:	39 c2                	cmp    %eax,%edx
+80103685:	74 16                	je     8010369d <ioapicinit+0x5d>
+    cprintf("ioapicinit: id isn't equal to ioapicid; not a MP\n");
+80103687:	83 ec 0c             	sub    $0xc,%esp
+8010368a:	68 3c b1 10 80       	push   $0x8010b13c
+8010368f:	e8 1c d5 ff ff       	call   80100bb0 <cprintf>
+  ioapic->reg = reg;
+80103694:	8b 1d ac 0c 8f 80    	mov    0x808f0cac,%ebx
+8010369a:	83 c4 10             	add    $0x10,%esp
+{
+8010369d:	ba 10 00 00 00       	mov    $0x10,%edx
+801036a2:	31 c0                	xor    %eax,%eax
+801036a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ioapic->reg = reg;
+801036a8:	89 13                	mov    %edx,(%ebx)
+801036aa:	8d 48 20             	lea    0x20(%eax),%ecx
+  ioapic->data = data;
+801036ad:	8b 1d ac 0c 8f 80    	mov    0x808f0cac,%ebx
+
+  // Mark all interrupts edge-triggered, active high, disabled,
+  // and not routed to any CPUs.
+  for(i = 0; i <= maxintr; i++){
+801036b3:	83 c0 01             	add    $0x1,%eax
+801036b6:	81 c9 00 00 01 00    	or     $0x10000,%ecx
+  ioapic->data = data;
+801036bc:	89 4b 10             	mov    %ecx,0x10(%ebx)
+  ioapic->reg = reg;
+801036bf:	8d 4a 01             	lea    0x1(%edx),%ecx
+  for(i = 0; i <= maxintr; i++){
+801036c2:	83 c2 02             	add    $0x2,%edx
+  ioapic->reg = reg;
+801036c5:	89 0b                	mov    %ecx,(%ebx)
+  ioapic->data = data;
+801036c7:	8b 1d ac 0c 8f 80    	mov    0x808f0cac,%ebx
+801036cd:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  for(i = 0; i <= maxintr; i++){
+801036d4:	39 c6                	cmp    %eax,%esi
+801036d6:	7d d0                	jge    801036a8 <ioapicinit+0x68>
+    ioapicwrite(REG_TABLE+2*i, INT_DISABLED | (T_IRQ0 + i));
+    ioapicwrite(REG_TABLE+2*i+1, 0);
+  }
+}
+801036d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801036db:	5b                   	pop    %ebx
+801036dc:	5e                   	pop    %esi
+801036dd:	5d                   	pop    %ebp
+801036de:	c3                   	ret
+801036df:	90                   	nop
+
+801036e0 <ioapicenable>:
+
+void
+ioapicenable(int irq, int cpunum)
+{
+801036e0:	55                   	push   %ebp
+  ioapic->reg = reg;
+801036e1:	8b 0d ac 0c 8f 80    	mov    0x808f0cac,%ecx
+{
+801036e7:	89 e5                	mov    %esp,%ebp
+801036e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  // Mark interrupt edge-triggered, active high,
+  // enabled, and routed to the given cpunum,
+  // which happens to be that cpu's APIC ID.
+  ioapicwrite(REG_TABLE+2*irq, T_IRQ0 + irq);
+801036ec:	8d 50 20             	lea    0x20(%eax),%edx
+801036ef:	8d 44 00 10          	lea    0x10(%eax,%eax,1),%eax
+  ioapic->reg = reg;
+801036f3:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+801036f5:	8b 0d ac 0c 8f 80    	mov    0x808f0cac,%ecx
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+801036fb:	83 c0 01             	add    $0x1,%eax
+  ioapic->data = data;
+801036fe:	89 51 10             	mov    %edx,0x10(%ecx)
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+80103701:	8b 55 0c             	mov    0xc(%ebp),%edx
+  ioapic->reg = reg;
+80103704:	89 01                	mov    %eax,(%ecx)
+  ioapic->data = data;
+80103706:	a1 ac 0c 8f 80       	mov    0x808f0cac,%eax
+  ioapicwrite(REG_TABLE+2*irq+1, cpunum << 24);
+8010370b:	c1 e2 18             	shl    $0x18,%edx
+  ioapic->data = data;
+8010370e:	89 50 10             	mov    %edx,0x10(%eax)
+}
+80103711:	5d                   	pop    %ebp
+80103712:	c3                   	ret
+80103713:	66 90                	xchg   %ax,%ax
+80103715:	66 90                	xchg   %ax,%ax
+80103717:	66 90                	xchg   %ax,%ax
+80103719:	66 90                	xchg   %ax,%ax
+8010371b:	66 90                	xchg   %ax,%ax
+8010371d:	66 90                	xchg   %ax,%ax
+8010371f:	90                   	nop
+
+80103720 <kfree>:
+// call to kalloc().  (The exception is when
+// initializing the allocator; see kinit above.)
+// The page is freed when the last reference goes away.
+void
+kfree(char *v)
+{
+80103720:	55                   	push   %ebp
+80103721:	89 e5                	mov    %esp,%ebp
+80103723:	56                   	push   %esi
+80103724:	53                   	push   %ebx
+80103725:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct run *r;
+  struct kcache *c;
+  int i;
+
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+80103728:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+8010372e:	0f 85 2b 01 00 00    	jne    8010385f <kfree+0x13f>
+80103734:	81 fb 10 3b 91 80    	cmp    $0x80913b10,%ebx
+8010373a:	0f 82 1f 01 00 00    	jb     8010385f <kfree+0x13f>
+80103740:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+80103746:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+8010374b:	0f 87 0e 01 00 00    	ja     8010385f <kfree+0x13f>
+    panic("kfree");
+
+  if(kmem.ref[V2P(v)/PGSIZE] == 0)
+80103751:	c1 e8 0c             	shr    $0xc,%eax
+80103754:	66 83 bc 00 40 0d 8f 	cmpw   $0x0,-0x7f70f2c0(%eax,%eax,1)
+8010375b:	80 00 
+8010375d:	8d 50 40             	lea    0x40(%eax),%edx
+80103760:	0f 84 06 01 00 00    	je     8010386c <kfree+0x14c>
+    panic("kfree: ref");
+  if(__sync_sub_and_fetch(&kmem.ref[V2P(v)/PGSIZE], 1) > 0)
+80103766:	66 f0 83 ac 12 c0 0c 	lock subw $0x1,-0x7f70f340(%edx,%edx,1)
+8010376d:	8f 80 01 
+80103770:	74 0e                	je     80103780 <kfree+0x60>
+    c->n -= KBATCH;
+    kmem.nfree += KBATCH;
+    release(&kmem.lock);
+  }
+  popcli();
+}
+80103772:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103775:	5b                   	pop    %ebx
+80103776:	5e                   	pop    %esi
+80103777:	5d                   	pop    %ebp
+80103778:	c3                   	ret
+80103779:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  memset(v, 1, PGSIZE);
+80103780:	83 ec 04             	sub    $0x4,%esp
+80103783:	68 00 10 00 00       	push   $0x1000
+80103788:	6a 01                	push   $0x1
+8010378a:	53                   	push   %ebx
+8010378b:	e8 a0 3e 00 00       	call   80107630 <memset>
+  if(!kmem.use_lock){
+80103790:	a1 f4 0c 8f 80       	mov    0x808f0cf4,%eax
+80103795:	83 c4 10             	add    $0x10,%esp
+80103798:	85 c0                	test   %eax,%eax
+8010379a:	75 24                	jne    801037c0 <kfree+0xa0>
+    r->next = kmem.freelist;
+8010379c:	a1 f8 0c 8f 80       	mov    0x808f0cf8,%eax
+801037a1:	89 03                	mov    %eax,(%ebx)
+    kmem.freelist = r;
+801037a3:	89 1d f8 0c 8f 80    	mov    %ebx,0x808f0cf8
+    kmem.nfree++;
+801037a9:	83 05 fc 0c 8f 80 01 	addl   $0x1,0x808f0cfc
+}
+801037b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801037b3:	5b                   	pop    %ebx
+801037b4:	5e                   	pop    %esi
+801037b5:	5d                   	pop    %ebp
+801037b6:	c3                   	ret
+801037b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801037be:	66 90                	xchg   %ax,%ax
+  pushcli();
+801037c0:	e8 3b 3c 00 00       	call   80107400 <pushcli>
+  c = &kmem.cache[cpuid()];
+801037c5:	e8 36 23 00 00       	call   80105b00 <cpuid>
+  r->next = c->freelist;
+801037ca:	8d 70 08             	lea    0x8(%eax),%esi
+801037cd:	8b 04 f5 c0 0c 8f 80 	mov    -0x7f70f340(,%esi,8),%eax
+801037d4:	89 03                	mov    %eax,(%ebx)
+  if(++c->n > KCACHE){
+801037d6:	8b 04 f5 c4 0c 8f 80 	mov    -0x7f70f33c(,%esi,8),%eax
+  c->freelist = r;
+801037dd:	89 1c f5 c0 0c 8f 80 	mov    %ebx,-0x7f70f340(,%esi,8)
+  if(++c->n > KCACHE){
+801037e4:	83 c0 01             	add    $0x1,%eax
+801037e7:	89 04 f5 c4 0c 8f 80 	mov    %eax,-0x7f70f33c(,%esi,8)
+801037ee:	83 f8 20             	cmp    $0x20,%eax
+801037f1:	7f 0d                	jg     80103800 <kfree+0xe0>
+}
+801037f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801037f6:	5b                   	pop    %ebx
+801037f7:	5e                   	pop    %esi
+801037f8:	5d                   	pop    %ebp
+  popcli();
+801037f9:	e9 52 3c 00 00       	jmp    80107450 <popcli>
+801037fe:	66 90                	xchg   %ax,%ax
+    acquire(&kmem.lock);
+80103800:	83 ec 0c             	sub    $0xc,%esp
+80103803:	68 c0 0c 8f 80       	push   $0x808f0cc0
+80103808:	e8 43 3d 00 00       	call   80107550 <acquire>
+      r->next = kmem.freelist;
+8010380d:	a1 f8 0c 8f 80       	mov    0x808f0cf8,%eax
+80103812:	83 c4 10             	add    $0x10,%esp
+80103815:	ba 10 00 00 00       	mov    $0x10,%edx
+8010381a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      r = c->freelist;
+80103820:	89 c1                	mov    %eax,%ecx
+80103822:	8b 04 f5 c0 0c 8f 80 	mov    -0x7f70f340(,%esi,8),%eax
+      c->freelist = r->next;
+80103829:	8b 18                	mov    (%eax),%ebx
+8010382b:	89 1c f5 c0 0c 8f 80 	mov    %ebx,-0x7f70f340(,%esi,8)
+      r->next = kmem.freelist;
+80103832:	89 08                	mov    %ecx,(%eax)
+      kmem.freelist = r;
+80103834:	a3 f8 0c 8f 80       	mov    %eax,0x808f0cf8
+    for(i = 0; i < KBATCH; i++){
+80103839:	83 ea 01             	sub    $0x1,%edx
+8010383c:	75 e2                	jne    80103820 <kfree+0x100>
+    release(&kmem.lock);
+8010383e:	83 ec 0c             	sub    $0xc,%esp
+    c->n -= KBATCH;
+80103841:	83 2c f5 c4 0c 8f 80 	subl   $0x10,-0x7f70f33c(,%esi,8)
+80103848:	10 
+    kmem.nfree += KBATCH;
+80103849:	83 05 fc 0c 8f 80 10 	addl   $0x10,0x808f0cfc
+    release(&kmem.lock);
+80103850:	68 c0 0c 8f 80       	push   $0x808f0cc0
+80103855:	e8 96 3c 00 00       	call   801074f0 <release>
+8010385a:	83 c4 10             	add    $0x10,%esp
+8010385d:	eb 94                	jmp    801037f3 <kfree+0xd3>
+    panic("kfree");
+8010385f:	83 ec 0c             	sub    $0xc,%esp
+80103862:	68 6e b1 10 80       	push   $0x8010b16e
+80103867:	e8 14 d0 ff ff       	call   80100880 <panic>
+    panic("kfree: ref");
+8010386c:	83 ec 0c             	sub    $0xc,%esp
+8010386f:	68 74 b1 10 80       	push   $0x8010b174
+80103874:	e8 07 d0 ff ff       	call   80100880 <panic>
+80103879:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80103880 <freerange>:
+{
+80103880:	55                   	push   %ebp
+80103881:	89 e5                	mov    %esp,%ebp
+80103883:	56                   	push   %esi
+80103884:	53                   	push   %ebx
+  p = (char*)PGROUNDUP((uint)vstart);
+80103885:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+80103888:	8b 75 0c             	mov    0xc(%ebp),%esi
+  p = (char*)PGROUNDUP((uint)vstart);
+8010388b:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80103891:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80103897:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010389d:	39 de                	cmp    %ebx,%esi
+8010389f:	72 39                	jb     801038da <freerange+0x5a>
+801038a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    kmem.ref[V2P(p)/PGSIZE] = 1;
+801038a8:	8d 83 00 f0 ff 7f    	lea    0x7ffff000(%ebx),%eax
+801038ae:	ba 01 00 00 00       	mov    $0x1,%edx
+    kfree(p);
+801038b3:	83 ec 0c             	sub    $0xc,%esp
+    kmem.ref[V2P(p)/PGSIZE] = 1;
+801038b6:	c1 e8 0c             	shr    $0xc,%eax
+801038b9:	66 89 94 00 40 0d 8f 	mov    %dx,-0x7f70f2c0(%eax,%eax,1)
+801038c0:	80 
+    kfree(p);
+801038c1:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+801038c7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+801038cd:	50                   	push   %eax
+801038ce:	e8 4d fe ff ff       	call   80103720 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+801038d3:	83 c4 10             	add    $0x10,%esp
+801038d6:	39 de                	cmp    %ebx,%esi
+801038d8:	73 ce                	jae    801038a8 <freerange+0x28>
+}
+801038da:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801038dd:	5b                   	pop    %ebx
+801038de:	5e                   	pop    %esi
+801038df:	5d                   	pop    %ebp
+801038e0:	c3                   	ret
+801038e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801038e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801038ef:	90                   	nop
+
+801038f0 <kinit2>:
+{
+801038f0:	55                   	push   %ebp
+801038f1:	89 e5                	mov    %esp,%ebp
+801038f3:	56                   	push   %esi
+801038f4:	53                   	push   %ebx
+  p = (char*)PGROUNDUP((uint)vstart);
+801038f5:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+801038f8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  p = (char*)PGROUNDUP((uint)vstart);
+801038fb:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80103901:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80103907:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010390d:	39 de                	cmp    %ebx,%esi
+8010390f:	72 39                	jb     8010394a <kinit2+0x5a>
+80103911:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    kmem.ref[V2P(p)/PGSIZE] = 1;
+80103918:	8d 83 00 f0 ff 7f    	lea    0x7ffff000(%ebx),%eax
+8010391e:	ba 01 00 00 00       	mov    $0x1,%edx
+    kfree(p);
+80103923:	83 ec 0c             	sub    $0xc,%esp
+    kmem.ref[V2P(p)/PGSIZE] = 1;
+80103926:	c1 e8 0c             	shr    $0xc,%eax
+80103929:	66 89 94 00 40 0d 8f 	mov    %dx,-0x7f70f2c0(%eax,%eax,1)
+80103930:	80 
+    kfree(p);
+80103931:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80103937:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+8010393d:	50                   	push   %eax
+8010393e:	e8 dd fd ff ff       	call   80103720 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80103943:	83 c4 10             	add    $0x10,%esp
+80103946:	39 de                	cmp    %ebx,%esi
+80103948:	73 ce                	jae    80103918 <kinit2+0x28>
+  kmem.use_lock = 1;
+8010394a:	c7 05 f4 0c 8f 80 01 	movl   $0x1,0x808f0cf4
+80103951:	00 00 00 
+}
+80103954:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103957:	5b                   	pop    %ebx
+80103958:	5e                   	pop    %esi
+80103959:	5d                   	pop    %ebp
+8010395a:	c3                   	ret
+8010395b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010395f:	90                   	nop
+
+80103960 <kinit1>:
+{
+80103960:	55                   	push   %ebp
+80103961:	89 e5                	mov    %esp,%ebp
+80103963:	56                   	push   %esi
+80103964:	53                   	push   %ebx
+80103965:	8b 75 0c             	mov    0xc(%ebp),%esi
+  initlock(&kmem.lock, "kmem");
+80103968:	83 ec 08             	sub    $0x8,%esp
+8010396b:	68 7f b1 10 80       	push   $0x8010b17f
+80103970:	68 c0 0c 8f 80       	push   $0x808f0cc0
+80103975:	e8 f6 39 00 00       	call   80107370 <initlock>
+  p = (char*)PGROUNDUP((uint)vstart);
+8010397a:	8b 45 08             	mov    0x8(%ebp),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+8010397d:	83 c4 10             	add    $0x10,%esp
+  kmem.use_lock = 0;
+80103980:	c7 05 f4 0c 8f 80 00 	movl   $0x0,0x808f0cf4
+80103987:	00 00 00 
+  p = (char*)PGROUNDUP((uint)vstart);
+8010398a:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+80103990:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+80103996:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010399c:	39 de                	cmp    %ebx,%esi
+8010399e:	72 32                	jb     801039d2 <kinit1+0x72>
+    kmem.ref[V2P(p)/PGSIZE] = 1;
+801039a0:	8d 83 00 f0 ff 7f    	lea    0x7ffff000(%ebx),%eax
+801039a6:	ba 01 00 00 00       	mov    $0x1,%edx
+    kfree(p);
+801039ab:	83 ec 0c             	sub    $0xc,%esp
+    kmem.ref[V2P(p)/PGSIZE] = 1;
+801039ae:	c1 e8 0c             	shr    $0xc,%eax
+801039b1:	66 89 94 00 40 0d 8f 	mov    %dx,-0x7f70f2c0(%eax,%eax,1)
+801039b8:	80 
+    kfree(p);
+801039b9:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+801039bf:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+    kfree(p);
+801039c5:	50                   	push   %eax
+801039c6:	e8 55 fd ff ff       	call   80103720 <kfree>
+  for(; p + PGSIZE <= (char*)vend; p += PGSIZE){
+801039cb:	83 c4 10             	add    $0x10,%esp
+801039ce:	39 de                	cmp    %ebx,%esi
+801039d0:	73 ce                	jae    801039a0 <kinit1+0x40>
+}
+801039d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801039d5:	5b                   	pop    %ebx
+801039d6:	5e                   	pop    %esi
+801039d7:	5d                   	pop    %ebp
+801039d8:	c3                   	ret
+801039d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801039e0 <kalloc>:
+// Allocate one 4096-byte page of physical memory.
+// Returns a pointer that the kernel can use.
+// Returns 0 if the memory cannot be allocated.
+char*
+kalloc(void)
+{
+801039e0:	55                   	push   %ebp
+801039e1:	89 e5                	mov    %esp,%ebp
+801039e3:	56                   	push   %esi
+801039e4:	53                   	push   %ebx
+  struct run *r;
+  struct kcache *c;
+
+  if(!kmem.use_lock){
+801039e5:	8b 1d f4 0c 8f 80    	mov    0x808f0cf4,%ebx
+801039eb:	85 db                	test   %ebx,%ebx
+801039ed:	75 41                	jne    80103a30 <kalloc+0x50>
+    r = kmem.freelist;
+801039ef:	8b 35 f8 0c 8f 80    	mov    0x808f0cf8,%esi
+    if(r){
+801039f5:	85 f6                	test   %esi,%esi
+801039f7:	0f 84 f0 00 00 00    	je     80103aed <kalloc+0x10d>
+      kmem.freelist = r->next;
+801039fd:	8b 06                	mov    (%esi),%eax
+      kmem.nfree--;
+801039ff:	83 2d fc 0c 8f 80 01 	subl   $0x1,0x808f0cfc
+      kmem.freelist = r->next;
+80103a06:	a3 f8 0c 8f 80       	mov    %eax,0x808f0cf8
+      c->n--;
+    }
+    popcli();
+  }
+  if(r)
+    kmem.ref[V2P(r)/PGSIZE] = 1;
+80103a0b:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+80103a11:	ba 01 00 00 00       	mov    $0x1,%edx
+80103a16:	c1 e8 0c             	shr    $0xc,%eax
+80103a19:	66 89 94 00 40 0d 8f 	mov    %dx,-0x7f70f2c0(%eax,%eax,1)
+80103a20:	80 
+  return (char*)r;
+}
+80103a21:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80103a24:	89 f0                	mov    %esi,%eax
+80103a26:	5b                   	pop    %ebx
+80103a27:	5e                   	pop    %esi
+80103a28:	5d                   	pop    %ebp
+80103a29:	c3                   	ret
+80103a2a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pushcli();
+80103a30:	e8 cb 39 00 00       	call   80107400 <pushcli>
+    c = &kmem.cache[cpuid()];
+80103a35:	e8 c6 20 00 00       	call   80105b00 <cpuid>
+    if(c->n == 0){
+80103a3a:	8b 0c c5 04 0d 8f 80 	mov    -0x7f70f2fc(,%eax,8),%ecx
+80103a41:	8d 58 08             	lea    0x8(%eax),%ebx
+80103a44:	85 c9                	test   %ecx,%ecx
+80103a46:	74 28                	je     80103a70 <kalloc+0x90>
+    if((r = c->freelist) != 0){
+80103a48:	8b 34 dd c0 0c 8f 80 	mov    -0x7f70f340(,%ebx,8),%esi
+80103a4f:	85 f6                	test   %esi,%esi
+80103a51:	0f 84 91 00 00 00    	je     80103ae8 <kalloc+0x108>
+      c->freelist = r->next;
+80103a57:	8b 06                	mov    (%esi),%eax
+      c->n--;
+80103a59:	83 2c dd c4 0c 8f 80 	subl   $0x1,-0x7f70f33c(,%ebx,8)
+80103a60:	01 
+      c->freelist = r->next;
+80103a61:	89 04 dd c0 0c 8f 80 	mov    %eax,-0x7f70f340(,%ebx,8)
+    popcli();
+80103a68:	e8 e3 39 00 00       	call   80107450 <popcli>
+  if(r)
+80103a6d:	eb 9c                	jmp    80103a0b <kalloc+0x2b>
+80103a6f:	90                   	nop
+      acquire(&kmem.lock);
+80103a70:	83 ec 0c             	sub    $0xc,%esp
+80103a73:	68 c0 0c 8f 80       	push   $0x808f0cc0
+80103a78:	e8 d3 3a 00 00       	call   80107550 <acquire>
+      while(c->n < KBATCH && (r = kmem.freelist) != 0){
+80103a7d:	83 c4 10             	add    $0x10,%esp
+80103a80:	83 3c dd c4 0c 8f 80 	cmpl   $0xf,-0x7f70f33c(,%ebx,8)
+80103a87:	0f 
+80103a88:	7e 3b                	jle    80103ac5 <kalloc+0xe5>
+80103a8a:	eb 42                	jmp    80103ace <kalloc+0xee>
+80103a8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        kmem.freelist = r->next;
+80103a90:	8b 10                	mov    (%eax),%edx
+        kmem.nfree--;
+80103a92:	83 2d fc 0c 8f 80 01 	subl   $0x1,0x808f0cfc
+        kmem.freelist = r->next;
+80103a99:	89 15 f8 0c 8f 80    	mov    %edx,0x808f0cf8
+        r->next = c->freelist;
+80103a9f:	8b 14 dd c0 0c 8f 80 	mov    -0x7f70f340(,%ebx,8),%edx
+80103aa6:	89 10                	mov    %edx,(%eax)
+        c->freelist = r;
+80103aa8:	89 04 dd c0 0c 8f 80 	mov    %eax,-0x7f70f340(,%ebx,8)
+        c->n++;
+80103aaf:	8b 04 dd c4 0c 8f 80 	mov    -0x7f70f33c(,%ebx,8),%eax
+80103ab6:	83 c0 01             	add    $0x1,%eax
+80103ab9:	89 04 dd c4 0c 8f 80 	mov    %eax,-0x7f70f33c(,%ebx,8)
+      while(c->n < KBATCH && (r = kmem.freelist) != 0){
+80103ac0:	83 f8 0f             	cmp    $0xf,%eax
+80103ac3:	7f 09                	jg     80103ace <kalloc+0xee>
+80103ac5:	a1 f8 0c 8f 80       	mov    0x808f0cf8,%eax
+80103aca:	85 c0                	test   %eax,%eax
+80103acc:	75 c2                	jne    80103a90 <kalloc+0xb0>
+      release(&kmem.lock);
+80103ace:	83 ec 0c             	sub    $0xc,%esp
+80103ad1:	68 c0 0c 8f 80       	push   $0x808f0cc0
+80103ad6:	e8 15 3a 00 00       	call   801074f0 <release>
+80103adb:	83 c4 10             	add    $0x10,%esp
+80103ade:	e9 65 ff ff ff       	jmp    80103a48 <kalloc+0x68>
+80103ae3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103ae7:	90                   	nop
+    popcli();
+80103ae8:	e8 63 39 00 00       	call   80107450 <popcli>
+    if((r = c->freelist) != 0){
+80103aed:	31 f6                	xor    %esi,%esi
+80103aef:	e9 2d ff ff ff       	jmp    80103a21 <kalloc+0x41>
+80103af4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103afb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103aff:	90                   	nop
+
+80103b00 <kincref>:
+
+// Add a reference to the page at v, which must already
+// be allocated. Used to share user pages copy-on-write.
+void
+kincref(char *v)
+{
+80103b00:	55                   	push   %ebp
+80103b01:	89 e5                	mov    %esp,%ebp
+80103b03:	83 ec 08             	sub    $0x8,%esp
+80103b06:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
+80103b09:	a9 ff 0f 00 00       	test   $0xfff,%eax
+80103b0e:	75 2f                	jne    80103b3f <kincref+0x3f>
+80103b10:	3d 10 3b 91 80       	cmp    $0x80913b10,%eax
+80103b15:	72 28                	jb     80103b3f <kincref+0x3f>
+80103b17:	05 00 00 00 80       	add    $0x80000000,%eax
+80103b1c:	3d ff ff ff 0d       	cmp    $0xdffffff,%eax
+80103b21:	77 1c                	ja     80103b3f <kincref+0x3f>
+    panic("kincref");
+  if(__sync_fetch_and_add(&kmem.ref[V2P(v)/PGSIZE], 1) == 0)
+80103b23:	c1 e8 0c             	shr    $0xc,%eax
+80103b26:	ba 01 00 00 00       	mov    $0x1,%edx
+80103b2b:	83 c0 40             	add    $0x40,%eax
+80103b2e:	66 f0 0f c1 94 00 c0 	lock xadd %dx,-0x7f70f340(%eax,%eax,1)
+80103b35:	0c 8f 80 
+80103b38:	66 85 d2             	test   %dx,%dx
+80103b3b:	74 0f                	je     80103b4c <kincref+0x4c>
+    panic("kincref: free page");
+}
+80103b3d:	c9                   	leave
+80103b3e:	c3                   	ret
+    panic("kincref");
+80103b3f:	83 ec 0c             	sub    $0xc,%esp
+80103b42:	68 84 b1 10 80       	push   $0x8010b184
+80103b47:	e8 34 cd ff ff       	call   80100880 <panic>
+    panic("kincref: free page");
+80103b4c:	83 ec 0c             	sub    $0xc,%esp
+80103b4f:	68 8c b1 10 80       	push   $0x8010b18c
+80103b54:	e8 27 cd ff ff       	call   80100880 <panic>
+80103b59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80103b60 <krefcount>:
+
+// Return the number of references to the page at v.
+int
+krefcount(char *v)
+{
+80103b60:	55                   	push   %ebp
+80103b61:	89 e5                	mov    %esp,%ebp
+  return kmem.ref[V2P(v)/PGSIZE];
+80103b63:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+80103b66:	5d                   	pop    %ebp
+  return kmem.ref[V2P(v)/PGSIZE];
+80103b67:	05 00 00 00 80       	add    $0x80000000,%eax
+80103b6c:	c1 e8 0c             	shr    $0xc,%eax
+80103b6f:	0f b7 84 00 40 0d 8f 	movzwl -0x7f70f2c0(%eax,%eax,1),%eax
+80103b76:	80 
+}
+80103b77:	c3                   	ret
+80103b78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103b7f:	90                   	nop
+
+80103b80 <kfreecount>:
+int
+kfreecount(void)
+{
+  int i, n;
+
+  n = kmem.nfree;
+80103b80:	8b 15 fc 0c 8f 80    	mov    0x808f0cfc,%edx
+  for(i = 0; i < NCPU; i++)
+80103b86:	31 c0                	xor    %eax,%eax
+80103b88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103b8f:	90                   	nop
+    n += kmem.cache[i].n;
+80103b90:	03 14 c5 04 0d 8f 80 	add    -0x7f70f2fc(,%eax,8),%edx
+  for(i = 0; i < NCPU; i++)
+80103b97:	83 c0 01             	add    $0x1,%eax
+80103b9a:	83 f8 08             	cmp    $0x8,%eax
+80103b9d:	75 f1                	jne    80103b90 <kfreecount+0x10>
+  return n;
+}
+80103b9f:	89 d0                	mov    %edx,%eax
+80103ba1:	c3                   	ret
+80103ba2:	66 90                	xchg   %ax,%ax
+80103ba4:	66 90                	xchg   %ax,%ax
+80103ba6:	66 90                	xchg   %ax,%ax
+80103ba8:	66 90                	xchg   %ax,%ax
+80103baa:	66 90                	xchg   %ax,%ax
+80103bac:	66 90                	xchg   %ax,%ax
+80103bae:	66 90                	xchg   %ax,%ax
+
+80103bb0 <kbdgetc>:
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103bb0:	ba 64 00 00 00       	mov    $0x64,%edx
+80103bb5:	ec                   	in     (%dx),%al
+    normalmap, shiftmap, ctlmap, ctlmap
+  };
+  uint st, data, c;
+
+  st = inb(KBSTATP);
+  if((st & KBS_DIB) == 0)
+80103bb6:	a8 01                	test   $0x1,%al
+80103bb8:	0f 84 c2 00 00 00    	je     80103c80 <kbdgetc+0xd0>
+{
+80103bbe:	55                   	push   %ebp
+80103bbf:	ba 60 00 00 00       	mov    $0x60,%edx
+80103bc4:	89 e5                	mov    %esp,%ebp
+80103bc6:	53                   	push   %ebx
+80103bc7:	ec                   	in     (%dx),%al
+    return -1;
+  data = inb(KBDATAP);
+
+  if(data == 0xE0){
+    shift |= E0ESC;
+80103bc8:	8b 1d 40 cd 90 80    	mov    0x8090cd40,%ebx
+  data = inb(KBDATAP);
+80103bce:	0f b6 c8             	movzbl %al,%ecx
+  if(data == 0xE0){
+80103bd1:	3c e0                	cmp    $0xe0,%al
+80103bd3:	74 5b                	je     80103c30 <kbdgetc+0x80>
+    return 0;
+  } else if(data & 0x80){
+    // Key released
+    data = (shift & E0ESC ? data : data & 0x7F);
+80103bd5:	89 da                	mov    %ebx,%edx
+80103bd7:	83 e2 40             	and    $0x40,%edx
+  } else if(data & 0x80){
+80103bda:	84 c0                	test   %al,%al
+80103bdc:	78 6a                	js     80103c48 <kbdgetc+0x98>
+    shift &= ~(shiftcode[data] | E0ESC);
+    return 0;
+  } else if(shift & E0ESC){
+80103bde:	85 d2                	test   %edx,%edx
+80103be0:	74 09                	je     80103beb <kbdgetc+0x3b>
+    // Last character was an E0 escape; or with 0x80
+    data |= 0x80;
+80103be2:	83 c8 80             	or     $0xffffff80,%eax
+    shift &= ~E0ESC;
+80103be5:	83 e3 bf             	and    $0xffffffbf,%ebx
+    data |= 0x80;
+80103be8:	0f b6 c8             	movzbl %al,%ecx
+  }
+
+  shift |= shiftcode[data];
+80103beb:	0f b6 91 c0 b2 10 80 	movzbl -0x7fef4d40(%ecx),%edx
+  shift ^= togglecode[data];
+80103bf2:	0f b6 81 c0 b1 10 80 	movzbl -0x7fef4e40(%ecx),%eax
+  shift |= shiftcode[data];
+80103bf9:	09 da                	or     %ebx,%edx
+  shift ^= togglecode[data];
+80103bfb:	31 c2                	xor    %eax,%edx
+  c = charcode[shift & (CTL | SHIFT)][data];
+80103bfd:	89 d0                	mov    %edx,%eax
+  shift ^= togglecode[data];
+80103bff:	89 15 40 cd 90 80    	mov    %edx,0x8090cd40
+  c = charcode[shift & (CTL | SHIFT)][data];
+80103c05:	83 e0 03             	and    $0x3,%eax
+  if(shift & CAPSLOCK){
+80103c08:	83 e2 08             	and    $0x8,%edx
+  c = charcode[shift & (CTL | SHIFT)][data];
+80103c0b:	8b 04 85 a0 b1 10 80 	mov    -0x7fef4e60(,%eax,4),%eax
+80103c12:	0f b6 04 08          	movzbl (%eax,%ecx,1),%eax
+  if(shift & CAPSLOCK){
+80103c16:	74 0b                	je     80103c23 <kbdgetc+0x73>
+    if('a' <= c && c <= 'z')
+80103c18:	8d 50 9f             	lea    -0x61(%eax),%edx
+80103c1b:	83 fa 19             	cmp    $0x19,%edx
+80103c1e:	77 48                	ja     80103c68 <kbdgetc+0xb8>
+      c += 'A' - 'a';
+80103c20:	83 e8 20             	sub    $0x20,%eax
+    else if('A' <= c && c <= 'Z')
+      c += 'a' - 'A';
+  }
+  return c;
+}
+80103c23:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103c26:	c9                   	leave
+80103c27:	c3                   	ret
+80103c28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103c2f:	90                   	nop
+    shift |= E0ESC;
+80103c30:	89 d8                	mov    %ebx,%eax
+80103c32:	83 c8 40             	or     $0x40,%eax
+    shift &= ~(shiftcode[data] | E0ESC);
+80103c35:	a3 40 cd 90 80       	mov    %eax,0x8090cd40
+    return 0;
+80103c3a:	31 c0                	xor    %eax,%eax
+}
+80103c3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103c3f:	c9                   	leave
+80103c40:	c3                   	ret
+80103c41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    data = (shift & E0ESC ? data : data & 0x7F);
+80103c48:	83 e0 7f             	and    $0x7f,%eax
+80103c4b:	85 d2                	test   %edx,%edx
+80103c4d:	0f 44 c8             	cmove  %eax,%ecx
+    shift &= ~(shiftcode[data] | E0ESC);
+80103c50:	0f b6 81 c0 b2 10 80 	movzbl -0x7fef4d40(%ecx),%eax
+80103c57:	83 c8 40             	or     $0x40,%eax
+80103c5a:	0f b6 c0             	movzbl %al,%eax
+80103c5d:	f7 d0                	not    %eax
+80103c5f:	21 d8                	and    %ebx,%eax
+    return 0;
+80103c61:	eb d2                	jmp    80103c35 <kbdgetc+0x85>
+80103c63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103c67:	90                   	nop
+    else if('A' <= c && c <= 'Z')
+80103c68:	8d 48 bf             	lea    -0x41(%eax),%ecx
+      c += 'a' - 'A';
+80103c6b:	8d 50 20             	lea    0x20(%eax),%edx
+}
+80103c6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80103c71:	c9                   	leave
+      c += 'a' - 'A';
+80103c72:	83 f9 1a             	cmp    $0x1a,%ecx
+80103c75:	0f 42 c2             	cmovb  %edx,%eax
+}
+80103c78:	c3                   	ret
+80103c79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+80103c80:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80103c85:	c3                   	ret
+80103c86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103c8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80103c90 <kbdintr>:
+
+void
+kbdintr(void)
+{
+80103c90:	55                   	push   %ebp
+80103c91:	89 e5                	mov    %esp,%ebp
+80103c93:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(kbdgetc);
+80103c96:	68 b0 3b 10 80       	push   $0x80103bb0
+80103c9b:	e8 20 d1 ff ff       	call   80100dc0 <consoleintr>
+}
+80103ca0:	83 c4 10             	add    $0x10,%esp
+80103ca3:	c9                   	leave
+80103ca4:	c3                   	ret
+80103ca5:	66 90                	xchg   %ax,%ax
+80103ca7:	66 90                	xchg   %ax,%ax
+80103ca9:	66 90                	xchg   %ax,%ax
+80103cab:	66 90                	xchg   %ax,%ax
+80103cad:	66 90                	xchg   %ax,%ax
+80103caf:	90                   	nop
+
+80103cb0 <lapictimer>:
+
+// Interrupt every tick if n is 0, else just once, n ticks
+// from now.
+void
+lapictimer(uint n)
+{
+80103cb0:	55                   	push   %ebp
+  if(!lapic)
+80103cb1:	8b 0d 48 cd 90 80    	mov    0x8090cd48,%ecx
+{
+80103cb7:	89 e5                	mov    %esp,%ebp
+80103cb9:	56                   	push   %esi
+80103cba:	53                   	push   %ebx
+80103cbb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!lapic)
+80103cbe:	85 c9                	test   %ecx,%ecx
+80103cc0:	74 29                	je     80103ceb <lapictimer+0x3b>
+    return;
+  if(n == 0){
+    lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
+    lapicw(TICR, lapictick);
+80103cc2:	8b 35 5c cd 90 80    	mov    0x8090cd5c,%esi
+  if(n == 0){
+80103cc8:	85 db                	test   %ebx,%ebx
+80103cca:	74 24                	je     80103cf0 <lapictimer+0x40>
+    return;
+  }
+  if(n > 0xffffffff / lapictick)
+80103ccc:	89 d8                	mov    %ebx,%eax
+80103cce:	f7 e6                	mul    %esi
+80103cd0:	70 38                	jo     80103d0a <lapictimer+0x5a>
+  lapic[index] = value;
+80103cd2:	c7 81 20 03 00 00 20 	movl   $0x20,0x320(%ecx)
+80103cd9:	00 00 00 
+    n = 0xffffffff / lapictick;
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+  lapicw(TICR, n * lapictick);
+80103cdc:	0f af de             	imul   %esi,%ebx
+  lapic[ID];  // wait for write to finish, by reading
+80103cdf:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80103ce2:	89 99 80 03 00 00    	mov    %ebx,0x380(%ecx)
+  lapic[ID];  // wait for write to finish, by reading
+80103ce8:	8b 41 20             	mov    0x20(%ecx),%eax
+}
+80103ceb:	5b                   	pop    %ebx
+80103cec:	5e                   	pop    %esi
+80103ced:	5d                   	pop    %ebp
+80103cee:	c3                   	ret
+80103cef:	90                   	nop
+  lapic[index] = value;
+80103cf0:	c7 81 20 03 00 00 20 	movl   $0x20020,0x320(%ecx)
+80103cf7:	00 02 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103cfa:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80103cfd:	89 b1 80 03 00 00    	mov    %esi,0x380(%ecx)
+}
+80103d03:	5b                   	pop    %ebx
+  lapic[ID];  // wait for write to finish, by reading
+80103d04:	8b 41 20             	mov    0x20(%ecx),%eax
+}
+80103d07:	5e                   	pop    %esi
+80103d08:	5d                   	pop    %ebp
+80103d09:	c3                   	ret
+  if(n > 0xffffffff / lapictick)
+80103d0a:	83 c8 ff             	or     $0xffffffff,%eax
+80103d0d:	31 d2                	xor    %edx,%edx
+80103d0f:	f7 f6                	div    %esi
+80103d11:	89 c3                	mov    %eax,%ebx
+80103d13:	eb bd                	jmp    80103cd2 <lapictimer+0x22>
+80103d15:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103d1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80103d20 <lapicipi>:
+
+// Send interrupt vector to the CPU whose local APIC id is
+// apicid. Caller must have interrupts off.
+void
+lapicipi(int apicid, int vector)
+{
+80103d20:	55                   	push   %ebp
+  lapic[index] = value;
+80103d21:	8b 15 48 cd 90 80    	mov    0x8090cd48,%edx
+{
+80103d27:	89 e5                	mov    %esp,%ebp
+  lapicw(ICRHI, apicid<<24);
+80103d29:	8b 45 08             	mov    0x8(%ebp),%eax
+80103d2c:	c1 e0 18             	shl    $0x18,%eax
+  lapic[index] = value;
+80103d2f:	89 82 10 03 00 00    	mov    %eax,0x310(%edx)
+  lapic[ID];  // wait for write to finish, by reading
+80103d35:	8b 42 20             	mov    0x20(%edx),%eax
+  lapic[index] = value;
+80103d38:	8b 45 0c             	mov    0xc(%ebp),%eax
+80103d3b:	89 82 00 03 00 00    	mov    %eax,0x300(%edx)
+  lapic[ID];  // wait for write to finish, by reading
+80103d41:	8b 42 20             	mov    0x20(%edx),%eax
+80103d44:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  lapicw(ICRLO, FIXED | vector);
+  while(lapic[ICRLO] & DELIVS)
+80103d48:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+80103d4e:	f6 c4 10             	test   $0x10,%ah
+80103d51:	75 f5                	jne    80103d48 <lapicipi+0x28>
+    ;
+}
+80103d53:	5d                   	pop    %ebp
+80103d54:	c3                   	ret
+80103d55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103d5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80103d60 <nsecs>:
+}
+
+// Nanoseconds since boot, from the TSC.
+uint64
+nsecs(void)
+{
+80103d60:	55                   	push   %ebp
+80103d61:	89 e5                	mov    %esp,%ebp
+80103d63:	57                   	push   %edi
+80103d64:	56                   	push   %esi
+80103d65:	53                   	push   %ebx
+80103d66:	83 ec 1c             	sub    $0x1c,%esp
+  uint64 ms;
+  uint r;
+
+  if(tscperms == 0)
+80103d69:	8b 1d 58 cd 90 80    	mov    0x8090cd58,%ebx
+80103d6f:	85 db                	test   %ebx,%ebx
+80103d71:	74 6d                	je     80103de0 <nsecs+0x80>
+static inline uint64
+rdtsc(void)
+{
+  uint64 t;
+
+  asm volatile("rdtsc" : "=A" (t));
+80103d73:	0f 31                	rdtsc
+    return 0;
+  ms = div64(rdtsc() - tsc0, tscperms, &r);
+80103d75:	2b 05 50 cd 90 80    	sub    0x8090cd50,%eax
+80103d7b:	1b 15 54 cd 90 80    	sbb    0x8090cd54,%edx
+  return ms * 1000000 + div64((uint64)r * 1000000, tscperms, 0);
+80103d81:	bf 40 42 0f 00       	mov    $0xf4240,%edi
+  ms = div64(rdtsc() - tsc0, tscperms, &r);
+80103d86:	89 c6                	mov    %eax,%esi
+  hi = n >> 32;
+80103d88:	89 d0                	mov    %edx,%eax
+80103d8a:	31 d2                	xor    %edx,%edx
+80103d8c:	f7 f3                	div    %ebx
+  asm("divl %2" : "+a" (lo), "+d" (r) : "rm" (d));
+80103d8e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80103d91:	89 f0                	mov    %esi,%eax
+80103d93:	f7 f3                	div    %ebx
+80103d95:	89 c1                	mov    %eax,%ecx
+  return ms * 1000000 + div64((uint64)r * 1000000, tscperms, 0);
+80103d97:	89 d0                	mov    %edx,%eax
+80103d99:	f7 e7                	mul    %edi
+  hi = n >> 32;
+80103d9b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80103d9e:	89 d0                	mov    %edx,%eax
+80103da0:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80103da3:	31 d2                	xor    %edx,%edx
+80103da5:	f7 f3                	div    %ebx
+80103da7:	89 c7                	mov    %eax,%edi
+  asm("divl %2" : "+a" (lo), "+d" (r) : "rm" (d));
+80103da9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80103dac:	f7 f3                	div    %ebx
+  return (uint64)hi << 32 | lo;
+80103dae:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  asm("divl %2" : "+a" (lo), "+d" (r) : "rm" (d));
+80103db1:	89 c6                	mov    %eax,%esi
+  return (uint64)hi << 32 | lo;
+80103db3:	89 c8                	mov    %ecx,%eax
+  return ms * 1000000 + div64((uint64)r * 1000000, tscperms, 0);
+80103db5:	b9 40 42 0f 00       	mov    $0xf4240,%ecx
+80103dba:	f7 e1                	mul    %ecx
+  return (uint64)hi << 32 | lo;
+80103dbc:	89 7d ec             	mov    %edi,-0x14(%ebp)
+  return ms * 1000000 + div64((uint64)r * 1000000, tscperms, 0);
+80103dbf:	69 db 40 42 0f 00    	imul   $0xf4240,%ebx,%ebx
+  return (uint64)hi << 32 | lo;
+80103dc5:	89 75 e8             	mov    %esi,-0x18(%ebp)
+  return ms * 1000000 + div64((uint64)r * 1000000, tscperms, 0);
+80103dc8:	01 da                	add    %ebx,%edx
+80103dca:	03 45 e8             	add    -0x18(%ebp),%eax
+80103dcd:	13 55 ec             	adc    -0x14(%ebp),%edx
+}
+80103dd0:	83 c4 1c             	add    $0x1c,%esp
+80103dd3:	5b                   	pop    %ebx
+80103dd4:	5e                   	pop    %esi
+80103dd5:	5f                   	pop    %edi
+80103dd6:	5d                   	pop    %ebp
+80103dd7:	c3                   	ret
+80103dd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103ddf:	90                   	nop
+80103de0:	83 c4 1c             	add    $0x1c,%esp
+80103de3:	31 c0                	xor    %eax,%eax
+80103de5:	31 d2                	xor    %edx,%edx
+80103de7:	5b                   	pop    %ebx
+80103de8:	5e                   	pop    %esi
+80103de9:	5f                   	pop    %edi
+80103dea:	5d                   	pop    %ebp
+80103deb:	c3                   	ret
+80103dec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80103df0 <clockticks>:
+// Ticks since boot, from the TSC. Unlike counting timer
+// interrupts, this stays right when CPUs leave their
+// timers off while idle.
+uint
+clockticks(void)
+{
+80103df0:	55                   	push   %ebp
+80103df1:	89 e5                	mov    %esp,%ebp
+80103df3:	56                   	push   %esi
+  if(tscperms == 0)
+80103df4:	8b 35 58 cd 90 80    	mov    0x8090cd58,%esi
+{
+80103dfa:	53                   	push   %ebx
+  if(tscperms == 0)
+80103dfb:	85 f6                	test   %esi,%esi
+80103dfd:	74 26                	je     80103e25 <clockticks+0x35>
+80103dff:	0f 31                	rdtsc
+    return 0;
+  return (uint)div64(rdtsc() - tsc0, tscperms, 0) / (1000/HZ);
+80103e01:	2b 05 50 cd 90 80    	sub    0x8090cd50,%eax
+80103e07:	1b 15 54 cd 90 80    	sbb    0x8090cd54,%edx
+80103e0d:	89 c1                	mov    %eax,%ecx
+  hi = n >> 32;
+80103e0f:	89 d0                	mov    %edx,%eax
+80103e11:	31 d2                	xor    %edx,%edx
+80103e13:	f7 f6                	div    %esi
+  asm("divl %2" : "+a" (lo), "+d" (r) : "rm" (d));
+80103e15:	89 c8                	mov    %ecx,%eax
+80103e17:	f7 f6                	div    %esi
+  return (uint)div64(rdtsc() - tsc0, tscperms, 0) / (1000/HZ);
+80103e19:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+80103e1e:	f7 e2                	mul    %edx
+80103e20:	89 d6                	mov    %edx,%esi
+80103e22:	c1 ee 03             	shr    $0x3,%esi
+}
+80103e25:	89 f0                	mov    %esi,%eax
+80103e27:	5b                   	pop    %ebx
+80103e28:	5e                   	pop    %esi
+80103e29:	5d                   	pop    %ebp
+80103e2a:	c3                   	ret
+80103e2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80103e2f:	90                   	nop
+
+80103e30 <lapicinit>:
+
+void
+lapicinit(void)
+{
+  if(!lapic)
+80103e30:	8b 0d 48 cd 90 80    	mov    0x8090cd48,%ecx
+80103e36:	85 c9                	test   %ecx,%ecx
+80103e38:	0f 84 e2 01 00 00    	je     80104020 <lapicinit+0x1f0>
+{
+80103e3e:	55                   	push   %ebp
+80103e3f:	89 e5                	mov    %esp,%ebp
+80103e41:	57                   	push   %edi
+80103e42:	56                   	push   %esi
+80103e43:	53                   	push   %ebx
+80103e44:	83 ec 14             	sub    $0x14,%esp
+  // The timer repeatedly counts down at bus frequency
+  // from lapic[TICR] and then issues an interrupt.
+  // The first CPU up measures the bus frequency, so
+  // that TICR gives HZ interrupts a second.
+  lapicw(TDCR, X1);
+  if(lapictick == 0)
+80103e47:	8b 1d 5c cd 90 80    	mov    0x8090cd5c,%ebx
+  lapic[index] = value;
+80103e4d:	c7 81 f0 00 00 00 3f 	movl   $0x13f,0xf0(%ecx)
+80103e54:	01 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103e57:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80103e5a:	c7 81 e0 03 00 00 0b 	movl   $0xb,0x3e0(%ecx)
+80103e61:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103e64:	8b 41 20             	mov    0x20(%ecx),%eax
+  if(lapictick == 0)
+80103e67:	85 db                	test   %ebx,%ebx
+80103e69:	0f 84 c9 00 00 00    	je     80103f38 <lapicinit+0x108>
+  lapic[index] = value;
+80103e6f:	c7 81 20 03 00 00 20 	movl   $0x20020,0x320(%ecx)
+80103e76:	00 02 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103e79:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80103e7c:	89 99 80 03 00 00    	mov    %ebx,0x380(%ecx)
+  lapic[ID];  // wait for write to finish, by reading
+80103e82:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80103e85:	c7 81 50 03 00 00 00 	movl   $0x10000,0x350(%ecx)
+80103e8c:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103e8f:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80103e92:	c7 81 60 03 00 00 00 	movl   $0x10000,0x360(%ecx)
+80103e99:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103e9c:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapicw(LINT0, MASKED);
+  lapicw(LINT1, MASKED);
+
+  // Disable performance counter overflow interrupts
+  // on machines that provide that interrupt entry.
+  if(((lapic[VER]>>16) & 0xFF) >= 4)
+80103e9f:	8b 41 30             	mov    0x30(%ecx),%eax
+80103ea2:	c1 e8 10             	shr    $0x10,%eax
+80103ea5:	a8 fc                	test   $0xfc,%al
+80103ea7:	75 77                	jne    80103f20 <lapicinit+0xf0>
+  lapic[index] = value;
+80103ea9:	c7 81 70 03 00 00 33 	movl   $0x33,0x370(%ecx)
+80103eb0:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103eb3:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80103eb6:	c7 81 80 02 00 00 00 	movl   $0x0,0x280(%ecx)
+80103ebd:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103ec0:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80103ec3:	c7 81 80 02 00 00 00 	movl   $0x0,0x280(%ecx)
+80103eca:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103ecd:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80103ed0:	c7 81 b0 00 00 00 00 	movl   $0x0,0xb0(%ecx)
+80103ed7:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103eda:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80103edd:	c7 81 10 03 00 00 00 	movl   $0x0,0x310(%ecx)
+80103ee4:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103ee7:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80103eea:	c7 81 00 03 00 00 00 	movl   $0x88500,0x300(%ecx)
+80103ef1:	85 08 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103ef4:	8b 41 20             	mov    0x20(%ecx),%eax
+80103ef7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80103efe:	66 90                	xchg   %ax,%ax
+  lapicw(EOI, 0);
+
+  // Send an Init Level De-Assert to synchronise arbitration ID's.
+  lapicw(ICRHI, 0);
+  lapicw(ICRLO, BCAST | INIT | LEVEL);
+  while(lapic[ICRLO] & DELIVS)
+80103f00:	8b 81 00 03 00 00    	mov    0x300(%ecx),%eax
+80103f06:	f6 c4 10             	test   $0x10,%ah
+80103f09:	75 f5                	jne    80103f00 <lapicinit+0xd0>
+  lapic[index] = value;
+80103f0b:	c7 81 80 00 00 00 00 	movl   $0x0,0x80(%ecx)
+80103f12:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103f15:	8b 41 20             	mov    0x20(%ecx),%eax
+    ;
+
+  // Enable interrupts on the APIC (but not on the processor).
+  lapicw(TPR, 0);
+}
+80103f18:	83 c4 14             	add    $0x14,%esp
+80103f1b:	5b                   	pop    %ebx
+80103f1c:	5e                   	pop    %esi
+80103f1d:	5f                   	pop    %edi
+80103f1e:	5d                   	pop    %ebp
+80103f1f:	c3                   	ret
+  lapic[index] = value;
+80103f20:	c7 81 40 03 00 00 00 	movl   $0x10000,0x340(%ecx)
+80103f27:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103f2a:	8b 41 20             	mov    0x20(%ecx),%eax
+}
+80103f2d:	e9 77 ff ff ff       	jmp    80103ea9 <lapicinit+0x79>
+80103f32:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103f38:	be 61 00 00 00       	mov    $0x61,%esi
+80103f3d:	89 f2                	mov    %esi,%edx
+80103f3f:	ec                   	in     (%dx),%al
+  gate = inb(PIT_GATE) & ~0x03;
+80103f40:	83 e0 fc             	and    $0xfffffffc,%eax
+80103f43:	89 c3                	mov    %eax,%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103f45:	ee                   	out    %al,(%dx)
+80103f46:	b8 b0 ff ff ff       	mov    $0xffffffb0,%eax
+80103f4b:	ba 43 00 00 00       	mov    $0x43,%edx
+80103f50:	ee                   	out    %al,(%dx)
+80103f51:	ba 42 00 00 00       	mov    $0x42,%edx
+80103f56:	b8 9b ff ff ff       	mov    $0xffffff9b,%eax
+80103f5b:	ee                   	out    %al,(%dx)
+80103f5c:	b8 2e 00 00 00       	mov    $0x2e,%eax
+80103f61:	ee                   	out    %al,(%dx)
+  lapic[index] = value;
+80103f62:	c7 81 20 03 00 00 00 	movl   $0x10000,0x320(%ecx)
+80103f69:	00 01 00 
+  lapic[ID];  // wait for write to finish, by reading
+80103f6c:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapic[index] = value;
+80103f6f:	c7 81 80 03 00 00 ff 	movl   $0xffffffff,0x380(%ecx)
+80103f76:	ff ff ff 
+  lapic[ID];  // wait for write to finish, by reading
+80103f79:	8b 41 20             	mov    0x20(%ecx),%eax
+  asm volatile("rdtsc" : "=A" (t));
+80103f7c:	0f 31                	rdtsc
+80103f7e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  outb(PIT_GATE, gate | 0x01);  // start counting
+80103f81:	89 d8                	mov    %ebx,%eax
+80103f83:	89 55 ec             	mov    %edx,-0x14(%ebp)
+80103f86:	83 c8 01             	or     $0x1,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80103f89:	89 f2                	mov    %esi,%edx
+80103f8b:	ee                   	out    %al,(%dx)
+80103f8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80103f90:	ec                   	in     (%dx),%al
+  while((inb(PIT_GATE) & 0x20) == 0)
+80103f91:	a8 20                	test   $0x20,%al
+80103f93:	74 fb                	je     80103f90 <lapicinit+0x160>
+  n = 0xffffffff - lapic[TCCR];
+80103f95:	8b 99 90 03 00 00    	mov    0x390(%ecx),%ebx
+  asm volatile("rdtsc" : "=A" (t));
+80103f9b:	0f 31                	rdtsc
+  lapic[index] = value;
+80103f9d:	c7 81 80 03 00 00 00 	movl   $0x0,0x380(%ecx)
+80103fa4:	00 00 00 
+  n = 0xffffffff - lapic[TCCR];
+80103fa7:	f7 d3                	not    %ebx
+80103fa9:	89 c6                	mov    %eax,%esi
+  lapic[ID];  // wait for write to finish, by reading
+80103fab:	8b 41 20             	mov    0x20(%ecx),%eax
+  lapictick = n * (1000/HZ) / CALIBMS;
+80103fae:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+80103fb1:	01 c0                	add    %eax,%eax
+80103fb3:	89 c3                	mov    %eax,%ebx
+80103fb5:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+80103fba:	f7 e3                	mul    %ebx
+  t = rdtsc() - t;
+80103fbc:	89 f0                	mov    %esi,%eax
+  lapictick = n * (1000/HZ) / CALIBMS;
+80103fbe:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+80103fc1:	c1 ea 03             	shr    $0x3,%edx
+  t = rdtsc() - t;
+80103fc4:	2b 45 e8             	sub    -0x18(%ebp),%eax
+  tscperms = (uint)t / CALIBMS;
+80103fc7:	89 c6                	mov    %eax,%esi
+80103fc9:	b8 cd cc cc cc       	mov    $0xcccccccd,%eax
+  lapictick = n * (1000/HZ) / CALIBMS;
+80103fce:	89 15 5c cd 90 80    	mov    %edx,0x8090cd5c
+80103fd4:	89 d3                	mov    %edx,%ebx
+  tscperms = (uint)t / CALIBMS;
+80103fd6:	f7 e6                	mul    %esi
+80103fd8:	89 d7                	mov    %edx,%edi
+80103fda:	c1 ef 03             	shr    $0x3,%edi
+  if(lapictick == 0)
+80103fdd:	83 7d e4 09          	cmpl   $0x9,-0x1c(%ebp)
+  tscperms = (uint)t / CALIBMS;
+80103fe1:	89 3d 58 cd 90 80    	mov    %edi,0x8090cd58
+  if(lapictick == 0)
+80103fe7:	77 0f                	ja     80103ff8 <lapicinit+0x1c8>
+    lapictick = 10000000;
+80103fe9:	c7 05 5c cd 90 80 80 	movl   $0x989680,0x8090cd5c
+80103ff0:	96 98 00 
+80103ff3:	bb 80 96 98 00       	mov    $0x989680,%ebx
+  if(tscperms == 0)
+80103ff8:	83 fe 09             	cmp    $0x9,%esi
+80103ffb:	77 0a                	ja     80104007 <lapicinit+0x1d7>
+    tscperms = 1000000;
+80103ffd:	c7 05 58 cd 90 80 40 	movl   $0xf4240,0x8090cd58
+80104004:	42 0f 00 
+80104007:	0f 31                	rdtsc
+  tsc0 = rdtsc();
+80104009:	a3 50 cd 90 80       	mov    %eax,0x8090cd50
+8010400e:	89 15 54 cd 90 80    	mov    %edx,0x8090cd54
+}
+80104014:	e9 56 fe ff ff       	jmp    80103e6f <lapicinit+0x3f>
+80104019:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104020:	c3                   	ret
+80104021:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104028:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010402f:	90                   	nop
+
+80104030 <lapicid>:
+
+int
+lapicid(void)
+{
+  if (!lapic)
+80104030:	a1 48 cd 90 80       	mov    0x8090cd48,%eax
+80104035:	85 c0                	test   %eax,%eax
+80104037:	74 07                	je     80104040 <lapicid+0x10>
+    return 0;
+  return lapic[ID] >> 24;
+80104039:	8b 40 20             	mov    0x20(%eax),%eax
+8010403c:	c1 e8 18             	shr    $0x18,%eax
+8010403f:	c3                   	ret
+    return 0;
+80104040:	31 c0                	xor    %eax,%eax
+}
+80104042:	c3                   	ret
+80104043:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010404a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80104050 <lapiceoi>:
+
+// Acknowledge interrupt.
+void
+lapiceoi(void)
+{
+  if(lapic)
+80104050:	a1 48 cd 90 80       	mov    0x8090cd48,%eax
+80104055:	85 c0                	test   %eax,%eax
+80104057:	74 0d                	je     80104066 <lapiceoi+0x16>
+  lapic[index] = value;
+80104059:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+80104060:	00 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+80104063:	8b 40 20             	mov    0x20(%eax),%eax
+    lapicw(EOI, 0);
+}
+80104066:	c3                   	ret
+80104067:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010406e:	66 90                	xchg   %ax,%ax
+
+80104070 <microdelay>:
+// Spin for a given number of microseconds.
+// On real hardware would want to tune this dynamically.
+void
+microdelay(int us)
+{
+}
+80104070:	c3                   	ret
+80104071:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104078:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010407f:	90                   	nop
+
+80104080 <lapicstartap>:
+
+// Start additional processor running entry code at addr.
+// See Appendix B of MultiProcessor Specification.
+void
+lapicstartap(uchar apicid, uint addr)
+{
+80104080:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104081:	b8 0f 00 00 00       	mov    $0xf,%eax
+80104086:	ba 70 00 00 00       	mov    $0x70,%edx
+8010408b:	89 e5                	mov    %esp,%ebp
+8010408d:	53                   	push   %ebx
+8010408e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80104091:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+80104094:	ee                   	out    %al,(%dx)
+80104095:	b8 0a 00 00 00       	mov    $0xa,%eax
+8010409a:	ba 71 00 00 00       	mov    $0x71,%edx
+8010409f:	ee                   	out    %al,(%dx)
+  // and the warm reset vector (DWORD based at 40:67) to point at
+  // the AP startup code prior to the [universal startup algorithm]."
+  outb(CMOS_PORT, 0xF);  // offset 0xF is shutdown code
+  outb(CMOS_PORT+1, 0x0A);
+  wrv = (ushort*)P2V((0x40<<4 | 0x67));  // Warm reset vector
+  wrv[0] = 0;
+801040a0:	31 c0                	xor    %eax,%eax
+  lapic[index] = value;
+801040a2:	c1 e3 18             	shl    $0x18,%ebx
+  wrv[0] = 0;
+801040a5:	66 a3 67 04 00 80    	mov    %ax,0x80000467
+  wrv[1] = addr >> 4;
+801040ab:	89 c8                	mov    %ecx,%eax
+  // when it is in the halted state due to an INIT.  So the second
+  // should be ignored, but it is part of the official Intel algorithm.
+  // Bochs complains about the second one.  Too bad for Bochs.
+  for(i = 0; i < 2; i++){
+    lapicw(ICRHI, apicid<<24);
+    lapicw(ICRLO, STARTUP | (addr>>12));
+801040ad:	c1 e9 0c             	shr    $0xc,%ecx
+  lapic[index] = value;
+801040b0:	89 da                	mov    %ebx,%edx
+  wrv[1] = addr >> 4;
+801040b2:	c1 e8 04             	shr    $0x4,%eax
+    lapicw(ICRLO, STARTUP | (addr>>12));
+801040b5:	80 cd 06             	or     $0x6,%ch
+  wrv[1] = addr >> 4;
+801040b8:	66 a3 69 04 00 80    	mov    %ax,0x80000469
+  lapic[index] = value;
+801040be:	a1 48 cd 90 80       	mov    0x8090cd48,%eax
+801040c3:	89 98 10 03 00 00    	mov    %ebx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+801040c9:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+801040cc:	c7 80 00 03 00 00 00 	movl   $0xc500,0x300(%eax)
+801040d3:	c5 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+801040d6:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+801040d9:	c7 80 00 03 00 00 00 	movl   $0x8500,0x300(%eax)
+801040e0:	85 00 00 
+  lapic[ID];  // wait for write to finish, by reading
+801040e3:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+801040e6:	89 90 10 03 00 00    	mov    %edx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+801040ec:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+801040ef:	89 88 00 03 00 00    	mov    %ecx,0x300(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+801040f5:	8b 58 20             	mov    0x20(%eax),%ebx
+  lapic[index] = value;
+801040f8:	89 90 10 03 00 00    	mov    %edx,0x310(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+801040fe:	8b 50 20             	mov    0x20(%eax),%edx
+  lapic[index] = value;
+80104101:	89 88 00 03 00 00    	mov    %ecx,0x300(%eax)
+  lapic[ID];  // wait for write to finish, by reading
+80104107:	8b 40 20             	mov    0x20(%eax),%eax
+    microdelay(200);
+  }
+}
+8010410a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010410d:	c9                   	leave
+8010410e:	c3                   	ret
+8010410f:	90                   	nop
+
+80104110 <cmostime>:
+}
+
+// qemu seems to use 24-hour GWT and the values are BCD encoded
+void
+cmostime(struct rtcdate *r)
+{
+80104110:	55                   	push   %ebp
+80104111:	b8 0b 00 00 00       	mov    $0xb,%eax
+80104116:	ba 70 00 00 00       	mov    $0x70,%edx
+8010411b:	89 e5                	mov    %esp,%ebp
+8010411d:	57                   	push   %edi
+8010411e:	56                   	push   %esi
+8010411f:	53                   	push   %ebx
+80104120:	83 ec 4c             	sub    $0x4c,%esp
+80104123:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104124:	ba 71 00 00 00       	mov    $0x71,%edx
+80104129:	ec                   	in     (%dx),%al
+  struct rtcdate t1, t2;
+  int sb, bcd;
+
+  sb = cmos_read(CMOS_STATB);
+
+  bcd = (sb & (1 << 2)) == 0;
+8010412a:	83 e0 04             	and    $0x4,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010412d:	bf 70 00 00 00       	mov    $0x70,%edi
+80104132:	88 45 b3             	mov    %al,-0x4d(%ebp)
+80104135:	8d 76 00             	lea    0x0(%esi),%esi
+80104138:	31 c0                	xor    %eax,%eax
+8010413a:	89 fa                	mov    %edi,%edx
+8010413c:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010413d:	b9 71 00 00 00       	mov    $0x71,%ecx
+80104142:	89 ca                	mov    %ecx,%edx
+80104144:	ec                   	in     (%dx),%al
+80104145:	88 45 b7             	mov    %al,-0x49(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104148:	89 fa                	mov    %edi,%edx
+8010414a:	b8 02 00 00 00       	mov    $0x2,%eax
+8010414f:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104150:	89 ca                	mov    %ecx,%edx
+80104152:	ec                   	in     (%dx),%al
+80104153:	88 45 b6             	mov    %al,-0x4a(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104156:	89 fa                	mov    %edi,%edx
+80104158:	b8 04 00 00 00       	mov    $0x4,%eax
+8010415d:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010415e:	89 ca                	mov    %ecx,%edx
+80104160:	ec                   	in     (%dx),%al
+80104161:	88 45 b5             	mov    %al,-0x4b(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104164:	89 fa                	mov    %edi,%edx
+80104166:	b8 07 00 00 00       	mov    $0x7,%eax
+8010416b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010416c:	89 ca                	mov    %ecx,%edx
+8010416e:	ec                   	in     (%dx),%al
+8010416f:	88 45 b4             	mov    %al,-0x4c(%ebp)
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104172:	89 fa                	mov    %edi,%edx
+80104174:	b8 08 00 00 00       	mov    $0x8,%eax
+80104179:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010417a:	89 ca                	mov    %ecx,%edx
+8010417c:	ec                   	in     (%dx),%al
+8010417d:	89 c6                	mov    %eax,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010417f:	89 fa                	mov    %edi,%edx
+80104181:	b8 09 00 00 00       	mov    $0x9,%eax
+80104186:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104187:	89 ca                	mov    %ecx,%edx
+80104189:	ec                   	in     (%dx),%al
+8010418a:	0f b6 d8             	movzbl %al,%ebx
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+8010418d:	89 fa                	mov    %edi,%edx
+8010418f:	b8 0a 00 00 00       	mov    $0xa,%eax
+80104194:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104195:	89 ca                	mov    %ecx,%edx
+80104197:	ec                   	in     (%dx),%al
+
+  // make sure CMOS doesn't modify time while we read it
+  for(;;) {
+    fill_rtcdate(&t1);
+    if(cmos_read(CMOS_STATA) & CMOS_UIP)
+80104198:	84 c0                	test   %al,%al
+8010419a:	78 9c                	js     80104138 <cmostime+0x28>
+  return inb(CMOS_RETURN);
+8010419c:	0f b6 45 b7          	movzbl -0x49(%ebp),%eax
+801041a0:	89 f2                	mov    %esi,%edx
+801041a2:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+801041a5:	0f b6 f2             	movzbl %dl,%esi
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801041a8:	89 fa                	mov    %edi,%edx
+801041aa:	89 45 b8             	mov    %eax,-0x48(%ebp)
+801041ad:	0f b6 45 b6          	movzbl -0x4a(%ebp),%eax
+801041b1:	89 75 c8             	mov    %esi,-0x38(%ebp)
+801041b4:	89 45 bc             	mov    %eax,-0x44(%ebp)
+801041b7:	0f b6 45 b5          	movzbl -0x4b(%ebp),%eax
+801041bb:	89 45 c0             	mov    %eax,-0x40(%ebp)
+801041be:	0f b6 45 b4          	movzbl -0x4c(%ebp),%eax
+801041c2:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+801041c5:	31 c0                	xor    %eax,%eax
+801041c7:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801041c8:	89 ca                	mov    %ecx,%edx
+801041ca:	ec                   	in     (%dx),%al
+801041cb:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801041ce:	89 fa                	mov    %edi,%edx
+801041d0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+801041d3:	b8 02 00 00 00       	mov    $0x2,%eax
+801041d8:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801041d9:	89 ca                	mov    %ecx,%edx
+801041db:	ec                   	in     (%dx),%al
+801041dc:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801041df:	89 fa                	mov    %edi,%edx
+801041e1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+801041e4:	b8 04 00 00 00       	mov    $0x4,%eax
+801041e9:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801041ea:	89 ca                	mov    %ecx,%edx
+801041ec:	ec                   	in     (%dx),%al
+801041ed:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+801041f0:	89 fa                	mov    %edi,%edx
+801041f2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+801041f5:	b8 07 00 00 00       	mov    $0x7,%eax
+801041fa:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+801041fb:	89 ca                	mov    %ecx,%edx
+801041fd:	ec                   	in     (%dx),%al
+801041fe:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104201:	89 fa                	mov    %edi,%edx
+80104203:	89 45 dc             	mov    %eax,-0x24(%ebp)
+80104206:	b8 08 00 00 00       	mov    $0x8,%eax
+8010420b:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010420c:	89 ca                	mov    %ecx,%edx
+8010420e:	ec                   	in     (%dx),%al
+8010420f:	0f b6 c0             	movzbl %al,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104212:	89 fa                	mov    %edi,%edx
+80104214:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80104217:	b8 09 00 00 00       	mov    $0x9,%eax
+8010421c:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010421d:	89 ca                	mov    %ecx,%edx
+8010421f:	ec                   	in     (%dx),%al
+80104220:	0f b6 c0             	movzbl %al,%eax
+        continue;
+    fill_rtcdate(&t2);
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+80104223:	83 ec 04             	sub    $0x4,%esp
+  return inb(CMOS_RETURN);
+80104226:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(memcmp(&t1, &t2, sizeof(t1)) == 0)
+80104229:	8d 45 d0             	lea    -0x30(%ebp),%eax
+8010422c:	6a 18                	push   $0x18
+8010422e:	50                   	push   %eax
+8010422f:	8d 45 b8             	lea    -0x48(%ebp),%eax
+80104232:	50                   	push   %eax
+80104233:	e8 38 34 00 00       	call   80107670 <memcmp>
+80104238:	83 c4 10             	add    $0x10,%esp
+8010423b:	85 c0                	test   %eax,%eax
+8010423d:	0f 85 f5 fe ff ff    	jne    80104138 <cmostime+0x28>
+      break;
+  }
+
+  // convert
+  if(bcd) {
+80104243:	0f b6 75 b3          	movzbl -0x4d(%ebp),%esi
+80104247:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010424a:	89 f0                	mov    %esi,%eax
+8010424c:	84 c0                	test   %al,%al
+8010424e:	75 78                	jne    801042c8 <cmostime+0x1b8>
+#define    CONV(x)     (t1.x = ((t1.x >> 4) * 10) + (t1.x & 0xf))
+    CONV(second);
+80104250:	8b 45 b8             	mov    -0x48(%ebp),%eax
+80104253:	89 c2                	mov    %eax,%edx
+80104255:	83 e0 0f             	and    $0xf,%eax
+80104258:	c1 ea 04             	shr    $0x4,%edx
+8010425b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+8010425e:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104261:	89 45 b8             	mov    %eax,-0x48(%ebp)
+    CONV(minute);
+80104264:	8b 45 bc             	mov    -0x44(%ebp),%eax
+80104267:	89 c2                	mov    %eax,%edx
+80104269:	83 e0 0f             	and    $0xf,%eax
+8010426c:	c1 ea 04             	shr    $0x4,%edx
+8010426f:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80104272:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104275:	89 45 bc             	mov    %eax,-0x44(%ebp)
+    CONV(hour  );
+80104278:	8b 45 c0             	mov    -0x40(%ebp),%eax
+8010427b:	89 c2                	mov    %eax,%edx
+8010427d:	83 e0 0f             	and    $0xf,%eax
+80104280:	c1 ea 04             	shr    $0x4,%edx
+80104283:	8d 14 92             	lea    (%edx,%edx,4),%edx
+80104286:	8d 04 50             	lea    (%eax,%edx,2),%eax
+80104289:	89 45 c0             	mov    %eax,-0x40(%ebp)
+    CONV(day   );
+8010428c:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+8010428f:	89 c2                	mov    %eax,%edx
+80104291:	83 e0 0f             	and    $0xf,%eax
+80104294:	c1 ea 04             	shr    $0x4,%edx
+80104297:	8d 14 92             	lea    (%edx,%edx,4),%edx
+8010429a:	8d 04 50             	lea    (%eax,%edx,2),%eax
+8010429d:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    CONV(month );
+801042a0:	8b 45 c8             	mov    -0x38(%ebp),%eax
+801042a3:	89 c2                	mov    %eax,%edx
+801042a5:	83 e0 0f             	and    $0xf,%eax
+801042a8:	c1 ea 04             	shr    $0x4,%edx
+801042ab:	8d 14 92             	lea    (%edx,%edx,4),%edx
+801042ae:	8d 04 50             	lea    (%eax,%edx,2),%eax
+801042b1:	89 45 c8             	mov    %eax,-0x38(%ebp)
+    CONV(year  );
+801042b4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+801042b7:	89 c2                	mov    %eax,%edx
+801042b9:	83 e0 0f             	and    $0xf,%eax
+801042bc:	c1 ea 04             	shr    $0x4,%edx
+801042bf:	8d 14 92             	lea    (%edx,%edx,4),%edx
+801042c2:	8d 04 50             	lea    (%eax,%edx,2),%eax
+801042c5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+#undef     CONV
+  }
+
+  *r = t1;
+801042c8:	8b 45 b8             	mov    -0x48(%ebp),%eax
+801042cb:	89 03                	mov    %eax,(%ebx)
+801042cd:	8b 45 bc             	mov    -0x44(%ebp),%eax
+801042d0:	89 43 04             	mov    %eax,0x4(%ebx)
+801042d3:	8b 45 c0             	mov    -0x40(%ebp),%eax
+801042d6:	89 43 08             	mov    %eax,0x8(%ebx)
+801042d9:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+801042dc:	89 43 0c             	mov    %eax,0xc(%ebx)
+801042df:	8b 45 c8             	mov    -0x38(%ebp),%eax
+801042e2:	89 43 10             	mov    %eax,0x10(%ebx)
+801042e5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+801042e8:	89 43 14             	mov    %eax,0x14(%ebx)
+  r->year += 2000;
+801042eb:	81 43 14 d0 07 00 00 	addl   $0x7d0,0x14(%ebx)
+}
+801042f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801042f5:	5b                   	pop    %ebx
+801042f6:	5e                   	pop    %esi
+801042f7:	5f                   	pop    %edi
+801042f8:	5d                   	pop    %ebp
+801042f9:	c3                   	ret
+801042fa:	66 90                	xchg   %ax,%ax
+801042fc:	66 90                	xchg   %ax,%ax
+801042fe:	66 90                	xchg   %ax,%ax
+
+80104300 <write_log>:
+}
+
+// Copy modified blocks from cache to log.
+static void
+write_log(void)
+{
+80104300:	55                   	push   %ebp
+80104301:	89 e5                	mov    %esp,%ebp
+80104303:	57                   	push   %edi
+80104304:	56                   	push   %esi
+80104305:	8d bd a8 fe ff ff    	lea    -0x158(%ebp),%edi
+8010430b:	53                   	push   %ebx
+8010430c:	81 ec 4c 01 00 00    	sub    $0x14c,%esp
+  struct buf *to[LOGSIZE];
+  int tail;
+
+  for (tail = 0; tail < log.lh.n; tail++) {
+80104312:	a1 b4 cd 90 80       	mov    0x8090cdb4,%eax
+80104317:	85 c0                	test   %eax,%eax
+80104319:	7e 6c                	jle    80104387 <write_log+0x87>
+8010431b:	31 db                	xor    %ebx,%ebx
+8010431d:	8d bd a8 fe ff ff    	lea    -0x158(%ebp),%edi
+80104323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104327:	90                   	nop
+    to[tail] = bread(log.dev, log.start+tail+1); // log block
+80104328:	a1 94 cd 90 80       	mov    0x8090cd94,%eax
+8010432d:	83 ec 08             	sub    $0x8,%esp
+80104330:	01 d8                	add    %ebx,%eax
+80104332:	83 c0 01             	add    $0x1,%eax
+80104335:	50                   	push   %eax
+80104336:	ff 35 a4 cd 90 80    	push   0x8090cda4
+8010433c:	e8 af c1 ff ff       	call   801004f0 <bread>
+80104341:	89 04 9f             	mov    %eax,(%edi,%ebx,4)
+    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+80104344:	5a                   	pop    %edx
+80104345:	59                   	pop    %ecx
+80104346:	ff 34 9d b8 cd 90 80 	push   -0x7f6f3248(,%ebx,4)
+8010434d:	ff 35 a4 cd 90 80    	push   0x8090cda4
+80104353:	e8 98 c1 ff ff       	call   801004f0 <bread>
+    memmove(to[tail]->data, from->data, BSIZE);
+80104358:	83 c4 0c             	add    $0xc,%esp
+8010435b:	68 00 10 00 00       	push   $0x1000
+    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
+80104360:	89 c6                	mov    %eax,%esi
+    memmove(to[tail]->data, from->data, BSIZE);
+80104362:	ff 70 60             	push   0x60(%eax)
+80104365:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  for (tail = 0; tail < log.lh.n; tail++) {
+80104368:	83 c3 01             	add    $0x1,%ebx
+    memmove(to[tail]->data, from->data, BSIZE);
+8010436b:	ff 70 60             	push   0x60(%eax)
+8010436e:	e8 4d 33 00 00       	call   801076c0 <memmove>
+    brelse(from);
+80104373:	89 34 24             	mov    %esi,(%esp)
+80104376:	e8 b5 c3 ff ff       	call   80100730 <brelse>
+  for (tail = 0; tail < log.lh.n; tail++) {
+8010437b:	a1 b4 cd 90 80       	mov    0x8090cdb4,%eax
+80104380:	83 c4 10             	add    $0x10,%esp
+80104383:	39 d8                	cmp    %ebx,%eax
+80104385:	7f a1                	jg     80104328 <write_log+0x28>
+  }
+  bwritev(to, log.lh.n);  // write the log
+80104387:	83 ec 08             	sub    $0x8,%esp
+8010438a:	50                   	push   %eax
+8010438b:	57                   	push   %edi
+8010438c:	e8 ef c1 ff ff       	call   80100580 <bwritev>
+  for (tail = 0; tail < log.lh.n; tail++)
+80104391:	a1 b4 cd 90 80       	mov    0x8090cdb4,%eax
+80104396:	83 c4 10             	add    $0x10,%esp
+80104399:	85 c0                	test   %eax,%eax
+8010439b:	7e 1c                	jle    801043b9 <write_log+0xb9>
+8010439d:	31 db                	xor    %ebx,%ebx
+8010439f:	90                   	nop
+    brelse(to[tail]);
+801043a0:	83 ec 0c             	sub    $0xc,%esp
+801043a3:	ff 34 9f             	push   (%edi,%ebx,4)
+  for (tail = 0; tail < log.lh.n; tail++)
+801043a6:	83 c3 01             	add    $0x1,%ebx
+    brelse(to[tail]);
+801043a9:	e8 82 c3 ff ff       	call   80100730 <brelse>
+  for (tail = 0; tail < log.lh.n; tail++)
+801043ae:	83 c4 10             	add    $0x10,%esp
+801043b1:	39 1d b4 cd 90 80    	cmp    %ebx,0x8090cdb4
+801043b7:	7f e7                	jg     801043a0 <write_log+0xa0>
+}
+801043b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801043bc:	5b                   	pop    %ebx
+801043bd:	5e                   	pop    %esi
+801043be:	5f                   	pop    %edi
+801043bf:	5d                   	pop    %ebp
+801043c0:	c3                   	ret
+801043c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801043c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801043cf:	90                   	nop
+
+801043d0 <install_trans>:
+{
+801043d0:	55                   	push   %ebp
+801043d1:	89 e5                	mov    %esp,%ebp
+801043d3:	57                   	push   %edi
+801043d4:	89 c7                	mov    %eax,%edi
+801043d6:	56                   	push   %esi
+801043d7:	8d b5 a8 fe ff ff    	lea    -0x158(%ebp),%esi
+801043dd:	53                   	push   %ebx
+801043de:	81 ec 5c 01 00 00    	sub    $0x15c,%esp
+  for (tail = 0; tail < log.lh.n; tail++) {
+801043e4:	a1 b4 cd 90 80       	mov    0x8090cdb4,%eax
+801043e9:	85 c0                	test   %eax,%eax
+801043eb:	0f 8e 8c 00 00 00    	jle    8010447d <install_trans+0xad>
+801043f1:	31 db                	xor    %ebx,%ebx
+801043f3:	8d b5 a8 fe ff ff    	lea    -0x158(%ebp),%esi
+801043f9:	eb 11                	jmp    8010440c <install_trans+0x3c>
+801043fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801043ff:	90                   	nop
+80104400:	a1 b4 cd 90 80       	mov    0x8090cdb4,%eax
+80104405:	83 c3 01             	add    $0x1,%ebx
+80104408:	39 d8                	cmp    %ebx,%eax
+8010440a:	7e 71                	jle    8010447d <install_trans+0xad>
+    dbuf[tail] = bread(log.dev, log.lh.block[tail]); // read dst
+8010440c:	83 ec 08             	sub    $0x8,%esp
+8010440f:	ff 34 9d b8 cd 90 80 	push   -0x7f6f3248(,%ebx,4)
+80104416:	ff 35 a4 cd 90 80    	push   0x8090cda4
+8010441c:	e8 cf c0 ff ff       	call   801004f0 <bread>
+    if(recovering){
+80104421:	83 c4 10             	add    $0x10,%esp
+    dbuf[tail] = bread(log.dev, log.lh.block[tail]); // read dst
+80104424:	89 04 9e             	mov    %eax,(%esi,%ebx,4)
+    if(recovering){
+80104427:	85 ff                	test   %edi,%edi
+80104429:	74 d5                	je     80104400 <install_trans+0x30>
+      struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
+8010442b:	a1 94 cd 90 80       	mov    0x8090cd94,%eax
+80104430:	83 ec 08             	sub    $0x8,%esp
+80104433:	01 d8                	add    %ebx,%eax
+80104435:	83 c0 01             	add    $0x1,%eax
+80104438:	50                   	push   %eax
+80104439:	ff 35 a4 cd 90 80    	push   0x8090cda4
+8010443f:	e8 ac c0 ff ff       	call   801004f0 <bread>
+      memmove(dbuf[tail]->data, lbuf->data, BSIZE);  // copy block to dst
+80104444:	83 c4 0c             	add    $0xc,%esp
+80104447:	68 00 10 00 00       	push   $0x1000
+8010444c:	ff 70 60             	push   0x60(%eax)
+8010444f:	89 85 a4 fe ff ff    	mov    %eax,-0x15c(%ebp)
+80104455:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  for (tail = 0; tail < log.lh.n; tail++) {
+80104458:	83 c3 01             	add    $0x1,%ebx
+      memmove(dbuf[tail]->data, lbuf->data, BSIZE);  // copy block to dst
+8010445b:	ff 70 60             	push   0x60(%eax)
+8010445e:	e8 5d 32 00 00       	call   801076c0 <memmove>
+      brelse(lbuf);
+80104463:	8b 95 a4 fe ff ff    	mov    -0x15c(%ebp),%edx
+80104469:	89 14 24             	mov    %edx,(%esp)
+8010446c:	e8 bf c2 ff ff       	call   80100730 <brelse>
+  for (tail = 0; tail < log.lh.n; tail++) {
+80104471:	a1 b4 cd 90 80       	mov    0x8090cdb4,%eax
+      brelse(lbuf);
+80104476:	83 c4 10             	add    $0x10,%esp
+  for (tail = 0; tail < log.lh.n; tail++) {
+80104479:	39 d8                	cmp    %ebx,%eax
+8010447b:	7f 8f                	jg     8010440c <install_trans+0x3c>
+  bwritev(dbuf, log.lh.n);  // write dst to disk
+8010447d:	83 ec 08             	sub    $0x8,%esp
+80104480:	50                   	push   %eax
+80104481:	56                   	push   %esi
+80104482:	e8 f9 c0 ff ff       	call   80100580 <bwritev>
+  for (tail = 0; tail < log.lh.n; tail++)
+80104487:	a1 b4 cd 90 80       	mov    0x8090cdb4,%eax
+8010448c:	83 c4 10             	add    $0x10,%esp
+8010448f:	85 c0                	test   %eax,%eax
+80104491:	7e 1e                	jle    801044b1 <install_trans+0xe1>
+80104493:	31 db                	xor    %ebx,%ebx
+80104495:	8d 76 00             	lea    0x0(%esi),%esi
+    brelse(dbuf[tail]);
+80104498:	83 ec 0c             	sub    $0xc,%esp
+8010449b:	ff 34 9e             	push   (%esi,%ebx,4)
+  for (tail = 0; tail < log.lh.n; tail++)
+8010449e:	83 c3 01             	add    $0x1,%ebx
+    brelse(dbuf[tail]);
+801044a1:	e8 8a c2 ff ff       	call   80100730 <brelse>
+  for (tail = 0; tail < log.lh.n; tail++)
+801044a6:	83 c4 10             	add    $0x10,%esp
+801044a9:	39 1d b4 cd 90 80    	cmp    %ebx,0x8090cdb4
+801044af:	7f e7                	jg     80104498 <install_trans+0xc8>
+}
+801044b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801044b4:	5b                   	pop    %ebx
+801044b5:	5e                   	pop    %esi
+801044b6:	5f                   	pop    %edi
+801044b7:	5d                   	pop    %ebp
+801044b8:	c3                   	ret
+801044b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801044c0 <write_head>:
+{
+801044c0:	55                   	push   %ebp
+801044c1:	89 e5                	mov    %esp,%ebp
+801044c3:	56                   	push   %esi
+801044c4:	53                   	push   %ebx
+  struct buf *buf = bread(log.dev, log.start);
+801044c5:	83 ec 08             	sub    $0x8,%esp
+801044c8:	ff 35 94 cd 90 80    	push   0x8090cd94
+801044ce:	ff 35 a4 cd 90 80    	push   0x8090cda4
+801044d4:	e8 17 c0 ff ff       	call   801004f0 <bread>
+  for (i = 0; i < log.lh.n; i++) {
+801044d9:	83 c4 10             	add    $0x10,%esp
+801044dc:	31 d2                	xor    %edx,%edx
+  struct logheader *hb = (struct logheader *) (buf->data);
+801044de:	8b 58 60             	mov    0x60(%eax),%ebx
+  struct buf *buf = bread(log.dev, log.start);
+801044e1:	89 c6                	mov    %eax,%esi
+  hb->n = log.lh.n;
+801044e3:	a1 b4 cd 90 80       	mov    0x8090cdb4,%eax
+801044e8:	89 03                	mov    %eax,(%ebx)
+  for (i = 0; i < log.lh.n; i++) {
+801044ea:	85 c0                	test   %eax,%eax
+801044ec:	7e 18                	jle    80104506 <write_head+0x46>
+801044ee:	66 90                	xchg   %ax,%ax
+    hb->block[i] = log.lh.block[i];
+801044f0:	8b 0c 95 b8 cd 90 80 	mov    -0x7f6f3248(,%edx,4),%ecx
+801044f7:	89 4c 93 04          	mov    %ecx,0x4(%ebx,%edx,4)
+  for (i = 0; i < log.lh.n; i++) {
+801044fb:	83 c2 01             	add    $0x1,%edx
+801044fe:	39 15 b4 cd 90 80    	cmp    %edx,0x8090cdb4
+80104504:	7f ea                	jg     801044f0 <write_head+0x30>
+  bwrite(buf);
+80104506:	83 ec 0c             	sub    $0xc,%esp
+80104509:	56                   	push   %esi
+8010450a:	e8 31 c0 ff ff       	call   80100540 <bwrite>
+  brelse(buf);
+8010450f:	89 34 24             	mov    %esi,(%esp)
+80104512:	e8 19 c2 ff ff       	call   80100730 <brelse>
+}
+80104517:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010451a:	5b                   	pop    %ebx
+8010451b:	5e                   	pop    %esi
+8010451c:	5d                   	pop    %ebp
+8010451d:	c3                   	ret
+8010451e:	66 90                	xchg   %ax,%ax
+
+80104520 <logflusher>:
+{
+80104520:	55                   	push   %ebp
+80104521:	89 e5                	mov    %esp,%ebp
+80104523:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+80104526:	68 60 cd 90 80       	push   $0x8090cd60
+8010452b:	e8 20 30 00 00       	call   80107550 <acquire>
+80104530:	83 c4 10             	add    $0x10,%esp
+80104533:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104537:	90                   	nop
+  if(log.lh.n == 0)
+80104538:	a1 b4 cd 90 80       	mov    0x8090cdb4,%eax
+8010453d:	85 c0                	test   %eax,%eax
+8010453f:	0f 84 e3 00 00 00    	je     80104628 <logflusher+0x108>
+         log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE ||
+80104545:	8b 15 ac cd 90 80    	mov    0x8090cdac,%edx
+8010454b:	85 d2                	test   %edx,%edx
+8010454d:	0f 8e f5 00 00 00    	jle    80104648 <logflusher+0x128>
+    acquire(&tickslock);
+80104553:	83 ec 0c             	sub    $0xc,%esp
+80104556:	68 c0 22 91 80       	push   $0x809122c0
+8010455b:	e8 f0 2f 00 00       	call   80107550 <acquire>
+    timerdel(myproc());
+80104560:	e8 1b 18 00 00       	call   80105d80 <myproc>
+80104565:	89 04 24             	mov    %eax,(%esp)
+80104568:	e8 f3 46 00 00       	call   80108c60 <timerdel>
+    release(&tickslock);
+8010456d:	c7 04 24 c0 22 91 80 	movl   $0x809122c0,(%esp)
+80104574:	e8 77 2f 00 00       	call   801074f0 <release>
+    while(log.outstanding > 0)
+80104579:	8b 0d 9c cd 90 80    	mov    0x8090cd9c,%ecx
+8010457f:	83 c4 10             	add    $0x10,%esp
+    log.committing = 1;
+80104582:	c7 05 a0 cd 90 80 01 	movl   $0x1,0x8090cda0
+80104589:	00 00 00 
+    while(log.outstanding > 0)
+8010458c:	85 c9                	test   %ecx,%ecx
+8010458e:	7e 1f                	jle    801045af <logflusher+0x8f>
+      sleep(&log.lh, &log.lock);
+80104590:	83 ec 08             	sub    $0x8,%esp
+80104593:	68 60 cd 90 80       	push   $0x8090cd60
+80104598:	68 b4 cd 90 80       	push   $0x8090cdb4
+8010459d:	e8 4e 24 00 00       	call   801069f0 <sleep>
+    while(log.outstanding > 0)
+801045a2:	8b 15 9c cd 90 80    	mov    0x8090cd9c,%edx
+801045a8:	83 c4 10             	add    $0x10,%esp
+801045ab:	85 d2                	test   %edx,%edx
+801045ad:	7f e1                	jg     80104590 <logflusher+0x70>
+    release(&log.lock);
+801045af:	83 ec 0c             	sub    $0xc,%esp
+801045b2:	68 60 cd 90 80       	push   $0x8090cd60
+801045b7:	e8 34 2f 00 00       	call   801074f0 <release>
+
+static void
+commit()
+{
+  if (log.lh.n > 0) {
+801045bc:	a1 b4 cd 90 80       	mov    0x8090cdb4,%eax
+801045c1:	83 c4 10             	add    $0x10,%esp
+801045c4:	85 c0                	test   %eax,%eax
+801045c6:	7e 20                	jle    801045e8 <logflusher+0xc8>
+    write_log();     // Write modified blocks from cache to log
+801045c8:	e8 33 fd ff ff       	call   80104300 <write_log>
+    write_head();    // Write header to disk -- the real commit
+801045cd:	e8 ee fe ff ff       	call   801044c0 <write_head>
+    install_trans(0); // Now install writes to home locations
+801045d2:	31 c0                	xor    %eax,%eax
+801045d4:	e8 f7 fd ff ff       	call   801043d0 <install_trans>
+    log.lh.n = 0;
+801045d9:	c7 05 b4 cd 90 80 00 	movl   $0x0,0x8090cdb4
+801045e0:	00 00 00 
+    write_head();    // Erase the transaction from the log
+801045e3:	e8 d8 fe ff ff       	call   801044c0 <write_head>
+    acquire(&log.lock);
+801045e8:	83 ec 0c             	sub    $0xc,%esp
+801045eb:	68 60 cd 90 80       	push   $0x8090cd60
+801045f0:	e8 5b 2f 00 00       	call   80107550 <acquire>
+    wakeup(&log);
+801045f5:	c7 04 24 60 cd 90 80 	movl   $0x8090cd60,(%esp)
+    log.ncommit++;
+801045fc:	83 05 a8 cd 90 80 01 	addl   $0x1,0x8090cda8
+    log.committing = 0;
+80104603:	c7 05 a0 cd 90 80 00 	movl   $0x0,0x8090cda0
+8010460a:	00 00 00 
+    wakeup(&log);
+8010460d:	e8 0e 27 00 00       	call   80106d20 <wakeup>
+  if(log.lh.n == 0)
+80104612:	a1 b4 cd 90 80       	mov    0x8090cdb4,%eax
+    while(!flushdue()){
+80104617:	83 c4 10             	add    $0x10,%esp
+  if(log.lh.n == 0)
+8010461a:	85 c0                	test   %eax,%eax
+8010461c:	0f 85 23 ff ff ff    	jne    80104545 <logflusher+0x25>
+80104622:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      sleep(&log.lh, &log.lock);
+80104628:	83 ec 08             	sub    $0x8,%esp
+8010462b:	68 60 cd 90 80       	push   $0x8090cd60
+80104630:	68 b4 cd 90 80       	push   $0x8090cdb4
+80104635:	e8 b6 23 00 00       	call   801069f0 <sleep>
+8010463a:	83 c4 10             	add    $0x10,%esp
+8010463d:	e9 f6 fe ff ff       	jmp    80104538 <logflusher+0x18>
+80104642:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+         log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE ||
+80104648:	8b 15 9c cd 90 80    	mov    0x8090cd9c,%edx
+8010464e:	8d 54 92 05          	lea    0x5(%edx,%edx,4),%edx
+80104652:	8d 14 50             	lea    (%eax,%edx,2),%edx
+  return log.syncwait > 0 ||
+80104655:	83 fa 50             	cmp    $0x50,%edx
+80104658:	0f 8f f5 fe ff ff    	jg     80104553 <logflusher+0x33>
+         ticks - log.opened >= LOGDELAY;
+8010465e:	8b 15 a0 22 91 80    	mov    0x809122a0,%edx
+80104664:	2b 15 b0 cd 90 80    	sub    0x8090cdb0,%edx
+         log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE ||
+8010466a:	83 fa 63             	cmp    $0x63,%edx
+8010466d:	0f 87 e0 fe ff ff    	ja     80104553 <logflusher+0x33>
+      if(log.lh.n > 0){
+80104673:	85 c0                	test   %eax,%eax
+80104675:	7e b1                	jle    80104628 <logflusher+0x108>
+        acquire(&tickslock);
+80104677:	83 ec 0c             	sub    $0xc,%esp
+8010467a:	68 c0 22 91 80       	push   $0x809122c0
+8010467f:	e8 cc 2e 00 00       	call   80107550 <acquire>
+        timerset(log.opened + LOGDELAY, &log.lh);
+80104684:	59                   	pop    %ecx
+80104685:	58                   	pop    %eax
+80104686:	68 b4 cd 90 80       	push   $0x8090cdb4
+8010468b:	a1 b0 cd 90 80       	mov    0x8090cdb0,%eax
+80104690:	83 c0 64             	add    $0x64,%eax
+80104693:	50                   	push   %eax
+80104694:	e8 37 46 00 00       	call   80108cd0 <timerset>
+        release(&tickslock);
+80104699:	c7 04 24 c0 22 91 80 	movl   $0x809122c0,(%esp)
+801046a0:	e8 4b 2e 00 00       	call   801074f0 <release>
+801046a5:	83 c4 10             	add    $0x10,%esp
+801046a8:	e9 7b ff ff ff       	jmp    80104628 <logflusher+0x108>
+801046ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+801046b0 <initlog>:
+{
+801046b0:	55                   	push   %ebp
+801046b1:	89 e5                	mov    %esp,%ebp
+801046b3:	56                   	push   %esi
+801046b4:	53                   	push   %ebx
+801046b5:	83 ec 28             	sub    $0x28,%esp
+801046b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&log.lock, "log");
+801046bb:	68 c0 b3 10 80       	push   $0x8010b3c0
+801046c0:	68 60 cd 90 80       	push   $0x8090cd60
+801046c5:	e8 a6 2c 00 00       	call   80107370 <initlock>
+  readsb(dev, &sb);
+801046ca:	8d 45 dc             	lea    -0x24(%ebp),%eax
+801046cd:	59                   	pop    %ecx
+801046ce:	5e                   	pop    %esi
+801046cf:	50                   	push   %eax
+801046d0:	53                   	push   %ebx
+801046d1:	e8 4a d9 ff ff       	call   80102020 <readsb>
+  log.size = sb.nlog;
+801046d6:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  log.start = sb.logstart;
+801046d9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  log.dev = dev;
+801046dc:	89 1d a4 cd 90 80    	mov    %ebx,0x8090cda4
+  log.start = sb.logstart;
+801046e2:	a3 94 cd 90 80       	mov    %eax,0x8090cd94
+  log.size = sb.nlog;
+801046e7:	89 15 98 cd 90 80    	mov    %edx,0x8090cd98
+  struct buf *buf = bread(log.dev, log.start);
+801046ed:	5a                   	pop    %edx
+801046ee:	59                   	pop    %ecx
+801046ef:	50                   	push   %eax
+801046f0:	53                   	push   %ebx
+801046f1:	e8 fa bd ff ff       	call   801004f0 <bread>
+  for (i = 0; i < log.lh.n; i++) {
+801046f6:	83 c4 10             	add    $0x10,%esp
+  struct logheader *lh = (struct logheader *) (buf->data);
+801046f9:	8b 70 60             	mov    0x60(%eax),%esi
+  log.lh.n = lh->n;
+801046fc:	8b 1e                	mov    (%esi),%ebx
+801046fe:	89 1d b4 cd 90 80    	mov    %ebx,0x8090cdb4
+  for (i = 0; i < log.lh.n; i++) {
+80104704:	85 db                	test   %ebx,%ebx
+80104706:	7e 1a                	jle    80104722 <initlog+0x72>
+80104708:	31 d2                	xor    %edx,%edx
+8010470a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    log.lh.block[i] = lh->block[i];
+80104710:	8b 4c 96 04          	mov    0x4(%esi,%edx,4),%ecx
+80104714:	89 0c 95 b8 cd 90 80 	mov    %ecx,-0x7f6f3248(,%edx,4)
+  for (i = 0; i < log.lh.n; i++) {
+8010471b:	83 c2 01             	add    $0x1,%edx
+8010471e:	39 d3                	cmp    %edx,%ebx
+80104720:	75 ee                	jne    80104710 <initlog+0x60>
+  brelse(buf);
+80104722:	83 ec 0c             	sub    $0xc,%esp
+80104725:	50                   	push   %eax
+80104726:	e8 05 c0 ff ff       	call   80100730 <brelse>
+  install_trans(1); // if committed, copy from log to disk
+8010472b:	b8 01 00 00 00       	mov    $0x1,%eax
+80104730:	e8 9b fc ff ff       	call   801043d0 <install_trans>
+  log.lh.n = 0;
+80104735:	c7 05 b4 cd 90 80 00 	movl   $0x0,0x8090cdb4
+8010473c:	00 00 00 
+  write_head(); // clear the log
+8010473f:	e8 7c fd ff ff       	call   801044c0 <write_head>
+  kthread("logflush", logflusher);
+80104744:	58                   	pop    %eax
+80104745:	5a                   	pop    %edx
+80104746:	68 20 45 10 80       	push   $0x80104520
+8010474b:	68 c4 b3 10 80       	push   $0x8010b3c4
+80104750:	e8 ab 17 00 00       	call   80105f00 <kthread>
+}
+80104755:	83 c4 10             	add    $0x10,%esp
+80104758:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010475b:	5b                   	pop    %ebx
+8010475c:	5e                   	pop    %esi
+8010475d:	5d                   	pop    %ebp
+8010475e:	c3                   	ret
+8010475f:	90                   	nop
+
+80104760 <begin_op>:
+{
+80104760:	55                   	push   %ebp
+80104761:	89 e5                	mov    %esp,%ebp
+80104763:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+80104766:	68 60 cd 90 80       	push   $0x8090cd60
+8010476b:	e8 e0 2d 00 00       	call   80107550 <acquire>
+80104770:	83 c4 10             	add    $0x10,%esp
+80104773:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104777:	90                   	nop
+    if(log.committing){
+80104778:	8b 0d a0 cd 90 80    	mov    0x8090cda0,%ecx
+8010477e:	85 c9                	test   %ecx,%ecx
+80104780:	75 44                	jne    801047c6 <begin_op+0x66>
+    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+80104782:	a1 9c cd 90 80       	mov    0x8090cd9c,%eax
+80104787:	8b 15 b4 cd 90 80    	mov    0x8090cdb4,%edx
+8010478d:	83 c0 01             	add    $0x1,%eax
+80104790:	8d 0c 80             	lea    (%eax,%eax,4),%ecx
+80104793:	8d 14 4a             	lea    (%edx,%ecx,2),%edx
+80104796:	83 fa 50             	cmp    $0x50,%edx
+80104799:	7e 45                	jle    801047e0 <begin_op+0x80>
+      wakeup(&log.lh);
+8010479b:	83 ec 0c             	sub    $0xc,%esp
+8010479e:	68 b4 cd 90 80       	push   $0x8090cdb4
+801047a3:	e8 78 25 00 00       	call   80106d20 <wakeup>
+      sleep(&log, &log.lock);
+801047a8:	58                   	pop    %eax
+801047a9:	5a                   	pop    %edx
+801047aa:	68 60 cd 90 80       	push   $0x8090cd60
+801047af:	68 60 cd 90 80       	push   $0x8090cd60
+801047b4:	e8 37 22 00 00       	call   801069f0 <sleep>
+    if(log.committing){
+801047b9:	8b 0d a0 cd 90 80    	mov    0x8090cda0,%ecx
+801047bf:	83 c4 10             	add    $0x10,%esp
+801047c2:	85 c9                	test   %ecx,%ecx
+801047c4:	74 bc                	je     80104782 <begin_op+0x22>
+      sleep(&log, &log.lock);
+801047c6:	83 ec 08             	sub    $0x8,%esp
+801047c9:	68 60 cd 90 80       	push   $0x8090cd60
+801047ce:	68 60 cd 90 80       	push   $0x8090cd60
+801047d3:	e8 18 22 00 00       	call   801069f0 <sleep>
+801047d8:	83 c4 10             	add    $0x10,%esp
+801047db:	eb 9b                	jmp    80104778 <begin_op+0x18>
+801047dd:	8d 76 00             	lea    0x0(%esi),%esi
+      release(&log.lock);
+801047e0:	83 ec 0c             	sub    $0xc,%esp
+      log.outstanding += 1;
+801047e3:	a3 9c cd 90 80       	mov    %eax,0x8090cd9c
+      release(&log.lock);
+801047e8:	68 60 cd 90 80       	push   $0x8090cd60
+801047ed:	e8 fe 2c 00 00       	call   801074f0 <release>
+}
+801047f2:	83 c4 10             	add    $0x10,%esp
+801047f5:	c9                   	leave
+801047f6:	c3                   	ret
+801047f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801047fe:	66 90                	xchg   %ax,%ax
+
+80104800 <end_op>:
+{
+80104800:	55                   	push   %ebp
+80104801:	89 e5                	mov    %esp,%ebp
+80104803:	83 ec 14             	sub    $0x14,%esp
+  acquire(&log.lock);
+80104806:	68 60 cd 90 80       	push   $0x8090cd60
+8010480b:	e8 40 2d 00 00       	call   80107550 <acquire>
+  log.outstanding -= 1;
+80104810:	a1 9c cd 90 80       	mov    0x8090cd9c,%eax
+  if(log.committing){
+80104815:	8b 15 a0 cd 90 80    	mov    0x8090cda0,%edx
+8010481b:	83 c4 10             	add    $0x10,%esp
+  log.outstanding -= 1;
+8010481e:	83 e8 01             	sub    $0x1,%eax
+80104821:	a3 9c cd 90 80       	mov    %eax,0x8090cd9c
+  if(log.committing){
+80104826:	85 d2                	test   %edx,%edx
+80104828:	74 2e                	je     80104858 <end_op+0x58>
+    if(log.outstanding == 0)
+8010482a:	85 c0                	test   %eax,%eax
+8010482c:	74 12                	je     80104840 <end_op+0x40>
+  release(&log.lock);
+8010482e:	83 ec 0c             	sub    $0xc,%esp
+80104831:	68 60 cd 90 80       	push   $0x8090cd60
+80104836:	e8 b5 2c 00 00       	call   801074f0 <release>
+}
+8010483b:	83 c4 10             	add    $0x10,%esp
+8010483e:	c9                   	leave
+8010483f:	c3                   	ret
+      wakeup(&log.lh);
+80104840:	83 ec 0c             	sub    $0xc,%esp
+80104843:	68 b4 cd 90 80       	push   $0x8090cdb4
+80104848:	e8 d3 24 00 00       	call   80106d20 <wakeup>
+8010484d:	83 c4 10             	add    $0x10,%esp
+80104850:	eb dc                	jmp    8010482e <end_op+0x2e>
+80104852:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wakeup(&log);
+80104858:	83 ec 0c             	sub    $0xc,%esp
+8010485b:	68 60 cd 90 80       	push   $0x8090cd60
+80104860:	e8 bb 24 00 00       	call   80106d20 <wakeup>
+80104865:	83 c4 10             	add    $0x10,%esp
+80104868:	eb c4                	jmp    8010482e <end_op+0x2e>
+8010486a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80104870 <log_sync>:
+{
+80104870:	55                   	push   %ebp
+80104871:	89 e5                	mov    %esp,%ebp
+80104873:	53                   	push   %ebx
+80104874:	83 ec 10             	sub    $0x10,%esp
+  acquire(&log.lock);
+80104877:	68 60 cd 90 80       	push   $0x8090cd60
+8010487c:	e8 cf 2c 00 00       	call   80107550 <acquire>
+  if(log.committing || log.lh.n > 0){
+80104881:	8b 15 a0 cd 90 80    	mov    0x8090cda0,%edx
+80104887:	83 c4 10             	add    $0x10,%esp
+8010488a:	85 d2                	test   %edx,%edx
+8010488c:	75 09                	jne    80104897 <log_sync+0x27>
+8010488e:	a1 b4 cd 90 80       	mov    0x8090cdb4,%eax
+80104893:	85 c0                	test   %eax,%eax
+80104895:	7e 4d                	jle    801048e4 <log_sync+0x74>
+    wakeup(&log.lh);
+80104897:	83 ec 0c             	sub    $0xc,%esp
+    log.syncwait++;
+8010489a:	83 05 ac cd 90 80 01 	addl   $0x1,0x8090cdac
+    n = log.ncommit + 1;
+801048a1:	8b 1d a8 cd 90 80    	mov    0x8090cda8,%ebx
+    wakeup(&log.lh);
+801048a7:	68 b4 cd 90 80       	push   $0x8090cdb4
+801048ac:	e8 6f 24 00 00       	call   80106d20 <wakeup>
+    while(log.ncommit < n)
+801048b1:	83 c4 10             	add    $0x10,%esp
+801048b4:	3b 1d a8 cd 90 80    	cmp    0x8090cda8,%ebx
+801048ba:	7c 21                	jl     801048dd <log_sync+0x6d>
+801048bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      sleep(&log, &log.lock);
+801048c0:	83 ec 08             	sub    $0x8,%esp
+801048c3:	68 60 cd 90 80       	push   $0x8090cd60
+801048c8:	68 60 cd 90 80       	push   $0x8090cd60
+801048cd:	e8 1e 21 00 00       	call   801069f0 <sleep>
+    while(log.ncommit < n)
+801048d2:	83 c4 10             	add    $0x10,%esp
+801048d5:	3b 1d a8 cd 90 80    	cmp    0x8090cda8,%ebx
+801048db:	7d e3                	jge    801048c0 <log_sync+0x50>
+    log.syncwait--;
+801048dd:	83 2d ac cd 90 80 01 	subl   $0x1,0x8090cdac
+  release(&log.lock);
+801048e4:	83 ec 0c             	sub    $0xc,%esp
+801048e7:	68 60 cd 90 80       	push   $0x8090cd60
+801048ec:	e8 ff 2b 00 00       	call   801074f0 <release>
+}
+801048f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801048f4:	83 c4 10             	add    $0x10,%esp
+801048f7:	c9                   	leave
+801048f8:	c3                   	ret
+801048f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80104900 <log_write>:
+//   modify bp->data[]
+//   log_write(bp)
+//   brelse(bp)
+void
+log_write(struct buf *b)
+{
+80104900:	55                   	push   %ebp
+80104901:	89 e5                	mov    %esp,%ebp
+80104903:	53                   	push   %ebx
+80104904:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+80104907:	8b 15 b4 cd 90 80    	mov    0x8090cdb4,%edx
+{
+8010490d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+80104910:	83 fa 4f             	cmp    $0x4f,%edx
+80104913:	0f 8f b9 00 00 00    	jg     801049d2 <log_write+0xd2>
+80104919:	a1 98 cd 90 80       	mov    0x8090cd98,%eax
+8010491e:	83 e8 01             	sub    $0x1,%eax
+80104921:	39 c2                	cmp    %eax,%edx
+80104923:	0f 8d a9 00 00 00    	jge    801049d2 <log_write+0xd2>
+    panic("too big a transaction");
+  if (log.outstanding < 1)
+80104929:	a1 9c cd 90 80       	mov    0x8090cd9c,%eax
+8010492e:	85 c0                	test   %eax,%eax
+80104930:	0f 8e a9 00 00 00    	jle    801049df <log_write+0xdf>
+    panic("log_write outside of trans");
+
+  acquire(&log.lock);
+80104936:	83 ec 0c             	sub    $0xc,%esp
+80104939:	68 60 cd 90 80       	push   $0x8090cd60
+8010493e:	e8 0d 2c 00 00       	call   80107550 <acquire>
+  for (i = 0; i < log.lh.n; i++) {
+80104943:	8b 15 b4 cd 90 80    	mov    0x8090cdb4,%edx
+80104949:	83 c4 10             	add    $0x10,%esp
+8010494c:	85 d2                	test   %edx,%edx
+8010494e:	7e 52                	jle    801049a2 <log_write+0xa2>
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+80104950:	8b 4b 08             	mov    0x8(%ebx),%ecx
+  for (i = 0; i < log.lh.n; i++) {
+80104953:	31 c0                	xor    %eax,%eax
+80104955:	eb 10                	jmp    80104967 <log_write+0x67>
+80104957:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010495e:	66 90                	xchg   %ax,%ax
+80104960:	83 c0 01             	add    $0x1,%eax
+80104963:	39 c2                	cmp    %eax,%edx
+80104965:	74 29                	je     80104990 <log_write+0x90>
+    if (log.lh.block[i] == b->blockno)   // log absorbtion
+80104967:	39 0c 85 b8 cd 90 80 	cmp    %ecx,-0x7f6f3248(,%eax,4)
+8010496e:	75 f0                	jne    80104960 <log_write+0x60>
+      break;
+  }
+  log.lh.block[i] = b->blockno;
+80104970:	89 0c 85 b8 cd 90 80 	mov    %ecx,-0x7f6f3248(,%eax,4)
+  if (i == log.lh.n){
+80104977:	39 c2                	cmp    %eax,%edx
+80104979:	74 1c                	je     80104997 <log_write+0x97>
+      // first write of a new group; start its clock.
+      log.opened = ticks;
+      wakeup(&log.lh);
+    }
+  }
+  b->flags |= B_DIRTY; // prevent eviction
+8010497b:	83 0b 04             	orl    $0x4,(%ebx)
+  release(&log.lock);
+}
+8010497e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  release(&log.lock);
+80104981:	c7 45 08 60 cd 90 80 	movl   $0x8090cd60,0x8(%ebp)
+}
+80104988:	c9                   	leave
+  release(&log.lock);
+80104989:	e9 62 2b 00 00       	jmp    801074f0 <release>
+8010498e:	66 90                	xchg   %ax,%ax
+  log.lh.block[i] = b->blockno;
+80104990:	89 0c 95 b8 cd 90 80 	mov    %ecx,-0x7f6f3248(,%edx,4)
+    if (log.lh.n++ == 0){
+80104997:	83 c2 01             	add    $0x1,%edx
+8010499a:	89 15 b4 cd 90 80    	mov    %edx,0x8090cdb4
+801049a0:	eb d9                	jmp    8010497b <log_write+0x7b>
+  log.lh.block[i] = b->blockno;
+801049a2:	8b 43 08             	mov    0x8(%ebx),%eax
+801049a5:	a3 b8 cd 90 80       	mov    %eax,0x8090cdb8
+  if (i == log.lh.n){
+801049aa:	75 cf                	jne    8010497b <log_write+0x7b>
+      log.opened = ticks;
+801049ac:	a1 a0 22 91 80       	mov    0x809122a0,%eax
+      wakeup(&log.lh);
+801049b1:	83 ec 0c             	sub    $0xc,%esp
+    if (log.lh.n++ == 0){
+801049b4:	c7 05 b4 cd 90 80 01 	movl   $0x1,0x8090cdb4
+801049bb:	00 00 00 
+      log.opened = ticks;
+801049be:	a3 b0 cd 90 80       	mov    %eax,0x8090cdb0
+      wakeup(&log.lh);
+801049c3:	68 b4 cd 90 80       	push   $0x8090cdb4
+801049c8:	e8 53 23 00 00       	call   80106d20 <wakeup>
+801049cd:	83 c4 10             	add    $0x10,%esp
+801049d0:	eb a9                	jmp    8010497b <log_write+0x7b>
+    panic("too big a transaction");
+801049d2:	83 ec 0c             	sub    $0xc,%esp
+801049d5:	68 cd b3 10 80       	push   $0x8010b3cd
+801049da:	e8 a1 be ff ff       	call   80100880 <panic>
+    panic("log_write outside of trans");
+801049df:	83 ec 0c             	sub    $0xc,%esp
+801049e2:	68 e3 b3 10 80       	push   $0x8010b3e3
+801049e7:	e8 94 be ff ff       	call   80100880 <panic>
+801049ec:	66 90                	xchg   %ax,%ax
+801049ee:	66 90                	xchg   %ax,%ax
+
+801049f0 <mpmain>:
+}
+
+// Common CPU setup code.
+static void
+mpmain(void)
+{
+801049f0:	55                   	push   %ebp
+801049f1:	89 e5                	mov    %esp,%ebp
+801049f3:	53                   	push   %ebx
+801049f4:	83 ec 04             	sub    $0x4,%esp
+  cprintf("cpu%d: starting %d\n", cpuid(), cpuid());
+801049f7:	e8 04 11 00 00       	call   80105b00 <cpuid>
+801049fc:	89 c3                	mov    %eax,%ebx
+801049fe:	e8 fd 10 00 00       	call   80105b00 <cpuid>
+80104a03:	83 ec 04             	sub    $0x4,%esp
+80104a06:	53                   	push   %ebx
+80104a07:	50                   	push   %eax
+80104a08:	68 fe b3 10 80       	push   $0x8010b3fe
+80104a0d:	e8 9e c1 ff ff       	call   80100bb0 <cprintf>
+  idtinit();       // load idt register
+80104a12:	e8 79 45 00 00       	call   80108f90 <idtinit>
+  xchg(&(mycpu()->started), 1); // tell startothers() we're up
+80104a17:	e8 84 10 00 00       	call   80105aa0 <mycpu>
+80104a1c:	89 c2                	mov    %eax,%edx
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+80104a1e:	b8 01 00 00 00       	mov    $0x1,%eax
+80104a23:	f0 87 82 a0 00 00 00 	lock xchg %eax,0xa0(%edx)
+  scheduler();     // start running processes
+80104a2a:	e8 a1 18 00 00       	call   801062d0 <scheduler>
+80104a2f:	90                   	nop
+
+80104a30 <mpenter>:
+{
+80104a30:	55                   	push   %ebp
+80104a31:	89 e5                	mov    %esp,%ebp
+80104a33:	83 ec 08             	sub    $0x8,%esp
+  switchkvm();
+80104a36:	e8 35 57 00 00       	call   8010a170 <switchkvm>
+  seginit();
+80104a3b:	e8 a0 56 00 00       	call   8010a0e0 <seginit>
+  lapicinit();
+80104a40:	e8 eb f3 ff ff       	call   80103e30 <lapicinit>
+  mpmain();
+80104a45:	e8 a6 ff ff ff       	call   801049f0 <mpmain>
+80104a4a:	66 90                	xchg   %ax,%ax
+80104a4c:	66 90                	xchg   %ax,%ax
+80104a4e:	66 90                	xchg   %ax,%ax
+
+80104a50 <main>:
+{
+80104a50:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+80104a54:	83 e4 f0             	and    $0xfffffff0,%esp
+80104a57:	ff 71 fc             	push   -0x4(%ecx)
+80104a5a:	55                   	push   %ebp
+80104a5b:	89 e5                	mov    %esp,%ebp
+80104a5d:	53                   	push   %ebx
+80104a5e:	51                   	push   %ecx
+  kinit1(end, P2V(ENTRYTOP)); // phys page allocator
+80104a5f:	83 ec 08             	sub    $0x8,%esp
+80104a62:	68 00 00 00 81       	push   $0x81000000
+80104a67:	68 10 3b 91 80       	push   $0x80913b10
+80104a6c:	e8 ef ee ff ff       	call   80103960 <kinit1>
+  kvmalloc();      // kernel page table
+80104a71:	e8 ba 5b 00 00       	call   8010a630 <kvmalloc>
+  mpinit();        // detect other processors
+80104a76:	e8 85 01 00 00       	call   80104c00 <mpinit>
+  lapicinit();     // interrupt controller
+80104a7b:	e8 b0 f3 ff ff       	call   80103e30 <lapicinit>
+  seginit();       // segment descriptors
+80104a80:	e8 5b 56 00 00       	call   8010a0e0 <seginit>
+  picinit();       // disable pic
+80104a85:	e8 86 03 00 00       	call   80104e10 <picinit>
+  ioapicinit();    // another interrupt controller
+80104a8a:	e8 b1 eb ff ff       	call   80103640 <ioapicinit>
+  consoleinit();   // console hardware
+80104a8f:	e8 0c c5 ff ff       	call   80100fa0 <consoleinit>
+  uartinit();      // serial port
+80104a94:	e8 b7 48 00 00       	call   80109350 <uartinit>
+  pinit();         // process table
+80104a99:	e8 b2 0f 00 00       	call   80105a50 <pinit>
+  tvinit();        // trap vectors
+80104a9e:	e8 6d 44 00 00       	call   80108f10 <tvinit>
+  fileinit();      // file table
+80104aa3:	e8 c8 c8 ff ff       	call   80101370 <fileinit>
+  ideinit();       // disk 
+80104aa8:	e8 e3 62 00 00       	call   8010ad90 <ideinit>
+
+  // Write entry code to unused memory at 0x7000.
+  // The linker has placed the image of entryother.S in
+  // _binary_entryother_start.
+  code = P2V(0x7000);
+  memmove(code, _binary_entryother_start, (uint)_binary_entryother_size);
+80104aad:	83 c4 0c             	add    $0xc,%esp
+80104ab0:	68 8a 00 00 00       	push   $0x8a
+80104ab5:	68 8c e4 10 80       	push   $0x8010e48c
+80104aba:	68 00 70 00 80       	push   $0x80007000
+80104abf:	e8 fc 2b 00 00       	call   801076c0 <memmove>
+
+  for(c = cpus; c < cpus+ncpu; c++){
+80104ac4:	83 c4 10             	add    $0x10,%esp
+80104ac7:	69 05 04 cf 90 80 b4 	imul   $0xb4,0x8090cf04,%eax
+80104ace:	00 00 00 
+80104ad1:	05 20 cf 90 80       	add    $0x8090cf20,%eax
+80104ad6:	3d 20 cf 90 80       	cmp    $0x8090cf20,%eax
+80104adb:	76 7b                	jbe    80104b58 <main+0x108>
+80104add:	bb 20 cf 90 80       	mov    $0x8090cf20,%ebx
+80104ae2:	eb 1d                	jmp    80104b01 <main+0xb1>
+80104ae4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104ae8:	69 05 04 cf 90 80 b4 	imul   $0xb4,0x8090cf04,%eax
+80104aef:	00 00 00 
+80104af2:	81 c3 b4 00 00 00    	add    $0xb4,%ebx
+80104af8:	05 20 cf 90 80       	add    $0x8090cf20,%eax
+80104afd:	39 c3                	cmp    %eax,%ebx
+80104aff:	73 57                	jae    80104b58 <main+0x108>
+    if(c == mycpu())  // We've started already.
+80104b01:	e8 9a 0f 00 00       	call   80105aa0 <mycpu>
+80104b06:	39 c3                	cmp    %eax,%ebx
+80104b08:	74 de                	je     80104ae8 <main+0x98>
+      continue;
+
+    // Tell entryother.S what stack to use, where to enter, and what
+    // pgdir to use. We cannot use kpgdir yet, because the AP processor
+    // is running in low  memory, so we use entrypgdir for the APs too.
+    stack = kalloc();
+80104b0a:	e8 d1 ee ff ff       	call   801039e0 <kalloc>
+    *(void**)(code-4) = stack + KSTACKSIZE;
+    *(void(**)(void))(code-8) = mpenter;
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+
+    lapicstartap(c->apicid, V2P(code));
+80104b0f:	83 ec 08             	sub    $0x8,%esp
+    *(void(**)(void))(code-8) = mpenter;
+80104b12:	c7 05 f8 6f 00 80 30 	movl   $0x80104a30,0x80006ff8
+80104b19:	4a 10 80 
+    *(int**)(code-12) = (void *) V2P(entrypgdir);
+80104b1c:	c7 05 f4 6f 00 80 00 	movl   $0x10d000,0x80006ff4
+80104b23:	d0 10 00 
+    *(void**)(code-4) = stack + KSTACKSIZE;
+80104b26:	05 00 10 00 00       	add    $0x1000,%eax
+80104b2b:	a3 fc 6f 00 80       	mov    %eax,0x80006ffc
+    lapicstartap(c->apicid, V2P(code));
+80104b30:	0f b6 03             	movzbl (%ebx),%eax
+80104b33:	68 00 70 00 00       	push   $0x7000
+80104b38:	50                   	push   %eax
+80104b39:	e8 42 f5 ff ff       	call   80104080 <lapicstartap>
+
+    // wait for cpu to finish mpmain()
+    while(c->started == 0)
+80104b3e:	83 c4 10             	add    $0x10,%esp
+80104b41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104b48:	8b 83 a0 00 00 00    	mov    0xa0(%ebx),%eax
+80104b4e:	85 c0                	test   %eax,%eax
+80104b50:	74 f6                	je     80104b48 <main+0xf8>
+80104b52:	eb 94                	jmp    80104ae8 <main+0x98>
+80104b54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  kinit2(P2V(ENTRYTOP), P2V(PHYSTOP)); // must come after startothers()
+80104b58:	83 ec 08             	sub    $0x8,%esp
+80104b5b:	68 00 00 00 8e       	push   $0x8e000000
+80104b60:	68 00 00 00 81       	push   $0x81000000
+80104b65:	e8 86 ed ff ff       	call   801038f0 <kinit2>
+  binit();         // buffer cache; allocates pages
+80104b6a:	e8 91 b8 ff ff       	call   80100400 <binit>
+  userinit();      // first user process
+80104b6f:	e8 3c 12 00 00       	call   80105db0 <userinit>
+  mpmain();        // finish this processor's setup
+80104b74:	e8 77 fe ff ff       	call   801049f0 <mpmain>
+80104b79:	66 90                	xchg   %ax,%ax
+80104b7b:	66 90                	xchg   %ax,%ax
+80104b7d:	66 90                	xchg   %ax,%ax
+80104b7f:	90                   	nop
+
+80104b80 <mpsearch1>:
+}
+
+// Look for an MP structure in the len bytes at addr.
+static struct mp*
+mpsearch1(uint a, int len)
+{
+80104b80:	55                   	push   %ebp
+80104b81:	89 e5                	mov    %esp,%ebp
+80104b83:	57                   	push   %edi
+80104b84:	56                   	push   %esi
+  uchar *e, *p, *addr;
+
+  addr = P2V(a);
+80104b85:	8d b0 00 00 00 80    	lea    -0x80000000(%eax),%esi
+{
+80104b8b:	53                   	push   %ebx
+  e = addr+len;
+80104b8c:	8d 1c 16             	lea    (%esi,%edx,1),%ebx
+{
+80104b8f:	83 ec 0c             	sub    $0xc,%esp
+  for(p = addr; p < e; p += sizeof(struct mp))
+80104b92:	39 de                	cmp    %ebx,%esi
+80104b94:	72 10                	jb     80104ba6 <mpsearch1+0x26>
+80104b96:	eb 50                	jmp    80104be8 <mpsearch1+0x68>
+80104b98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104b9f:	90                   	nop
+80104ba0:	89 fe                	mov    %edi,%esi
+80104ba2:	39 df                	cmp    %ebx,%edi
+80104ba4:	73 42                	jae    80104be8 <mpsearch1+0x68>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80104ba6:	83 ec 04             	sub    $0x4,%esp
+80104ba9:	8d 7e 10             	lea    0x10(%esi),%edi
+80104bac:	6a 04                	push   $0x4
+80104bae:	68 12 b4 10 80       	push   $0x8010b412
+80104bb3:	56                   	push   %esi
+80104bb4:	e8 b7 2a 00 00       	call   80107670 <memcmp>
+80104bb9:	83 c4 10             	add    $0x10,%esp
+80104bbc:	85 c0                	test   %eax,%eax
+80104bbe:	75 e0                	jne    80104ba0 <mpsearch1+0x20>
+80104bc0:	89 f2                	mov    %esi,%edx
+80104bc2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    sum += addr[i];
+80104bc8:	0f b6 0a             	movzbl (%edx),%ecx
+  for(i=0; i<len; i++)
+80104bcb:	83 c2 01             	add    $0x1,%edx
+    sum += addr[i];
+80104bce:	01 c8                	add    %ecx,%eax
+  for(i=0; i<len; i++)
+80104bd0:	39 fa                	cmp    %edi,%edx
+80104bd2:	75 f4                	jne    80104bc8 <mpsearch1+0x48>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80104bd4:	84 c0                	test   %al,%al
+80104bd6:	75 c8                	jne    80104ba0 <mpsearch1+0x20>
+      return (struct mp*)p;
+  return 0;
+}
+80104bd8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104bdb:	89 f0                	mov    %esi,%eax
+80104bdd:	5b                   	pop    %ebx
+80104bde:	5e                   	pop    %esi
+80104bdf:	5f                   	pop    %edi
+80104be0:	5d                   	pop    %ebp
+80104be1:	c3                   	ret
+80104be2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80104be8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+80104beb:	31 f6                	xor    %esi,%esi
+}
+80104bed:	5b                   	pop    %ebx
+80104bee:	89 f0                	mov    %esi,%eax
+80104bf0:	5e                   	pop    %esi
+80104bf1:	5f                   	pop    %edi
+80104bf2:	5d                   	pop    %ebp
+80104bf3:	c3                   	ret
+80104bf4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104bfb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104bff:	90                   	nop
+
+80104c00 <mpinit>:
+  return conf;
+}
+
+void
+mpinit(void)
+{
+80104c00:	55                   	push   %ebp
+80104c01:	89 e5                	mov    %esp,%ebp
+80104c03:	57                   	push   %edi
+80104c04:	56                   	push   %esi
+80104c05:	53                   	push   %ebx
+80104c06:	83 ec 1c             	sub    $0x1c,%esp
+  if((p = ((bda[0x0F]<<8)| bda[0x0E]) << 4)){
+80104c09:	0f b6 05 0f 04 00 80 	movzbl 0x8000040f,%eax
+80104c10:	0f b6 15 0e 04 00 80 	movzbl 0x8000040e,%edx
+80104c17:	c1 e0 08             	shl    $0x8,%eax
+80104c1a:	09 d0                	or     %edx,%eax
+80104c1c:	c1 e0 04             	shl    $0x4,%eax
+80104c1f:	75 1b                	jne    80104c3c <mpinit+0x3c>
+    p = ((bda[0x14]<<8)|bda[0x13])*1024;
+80104c21:	0f b6 05 14 04 00 80 	movzbl 0x80000414,%eax
+80104c28:	0f b6 15 13 04 00 80 	movzbl 0x80000413,%edx
+80104c2f:	c1 e0 08             	shl    $0x8,%eax
+80104c32:	09 d0                	or     %edx,%eax
+80104c34:	c1 e0 0a             	shl    $0xa,%eax
+    if((mp = mpsearch1(p-1024, 1024)))
+80104c37:	2d 00 04 00 00       	sub    $0x400,%eax
+    if((mp = mpsearch1(p, 1024)))
+80104c3c:	ba 00 04 00 00       	mov    $0x400,%edx
+80104c41:	e8 3a ff ff ff       	call   80104b80 <mpsearch1>
+80104c46:	89 c3                	mov    %eax,%ebx
+80104c48:	85 c0                	test   %eax,%eax
+80104c4a:	0f 84 50 01 00 00    	je     80104da0 <mpinit+0x1a0>
+  if((mp = mpsearch()) == 0 || mp->physaddr == 0)
+80104c50:	8b 73 04             	mov    0x4(%ebx),%esi
+80104c53:	85 f6                	test   %esi,%esi
+80104c55:	0f 84 35 01 00 00    	je     80104d90 <mpinit+0x190>
+  if(memcmp(conf, "PCMP", 4) != 0)
+80104c5b:	83 ec 04             	sub    $0x4,%esp
+  conf = (struct mpconf*) P2V((uint) mp->physaddr);
+80104c5e:	8d 86 00 00 00 80    	lea    -0x80000000(%esi),%eax
+80104c64:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(memcmp(conf, "PCMP", 4) != 0)
+80104c67:	6a 04                	push   $0x4
+80104c69:	68 17 b4 10 80       	push   $0x8010b417
+80104c6e:	50                   	push   %eax
+80104c6f:	e8 fc 29 00 00       	call   80107670 <memcmp>
+80104c74:	83 c4 10             	add    $0x10,%esp
+80104c77:	85 c0                	test   %eax,%eax
+80104c79:	0f 85 11 01 00 00    	jne    80104d90 <mpinit+0x190>
+  if(conf->version != 1 && conf->version != 4)
+80104c7f:	0f b6 86 06 00 00 80 	movzbl -0x7ffffffa(%esi),%eax
+80104c86:	3c 01                	cmp    $0x1,%al
+80104c88:	74 08                	je     80104c92 <mpinit+0x92>
+80104c8a:	3c 04                	cmp    $0x4,%al
+80104c8c:	0f 85 fe 00 00 00    	jne    80104d90 <mpinit+0x190>
+  if(sum((uchar*)conf, conf->length) != 0)
+80104c92:	0f b7 96 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edx
+  for(i=0; i<len; i++)
+80104c99:	66 85 d2             	test   %dx,%dx
+80104c9c:	74 22                	je     80104cc0 <mpinit+0xc0>
+80104c9e:	8d 3c 32             	lea    (%edx,%esi,1),%edi
+80104ca1:	89 f0                	mov    %esi,%eax
+  sum = 0;
+80104ca3:	31 d2                	xor    %edx,%edx
+80104ca5:	8d 76 00             	lea    0x0(%esi),%esi
+    sum += addr[i];
+80104ca8:	0f b6 88 00 00 00 80 	movzbl -0x80000000(%eax),%ecx
+  for(i=0; i<len; i++)
+80104caf:	83 c0 01             	add    $0x1,%eax
+    sum += addr[i];
+80104cb2:	01 ca                	add    %ecx,%edx
+  for(i=0; i<len; i++)
+80104cb4:	39 c7                	cmp    %eax,%edi
+80104cb6:	75 f0                	jne    80104ca8 <mpinit+0xa8>
+  if(sum((uchar*)conf, conf->length) != 0)
+80104cb8:	84 d2                	test   %dl,%dl
+80104cba:	0f 85 d0 00 00 00    	jne    80104d90 <mpinit+0x190>
+  struct mpioapic *ioapic;
+
+  if((conf = mpconfig(&mp)) == 0)
+    panic("Expect to run on an SMP");
+  ismp = 1;
+  lapic = (uint*)conf->lapicaddr;
+80104cc0:	8b 86 24 00 00 80    	mov    -0x7fffffdc(%esi),%eax
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80104cc6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80104cc9:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  lapic = (uint*)conf->lapicaddr;
+80104ccc:	a3 48 cd 90 80       	mov    %eax,0x8090cd48
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80104cd1:	0f b7 96 04 00 00 80 	movzwl -0x7ffffffc(%esi),%edx
+80104cd8:	8d 86 2c 00 00 80    	lea    -0x7fffffd4(%esi),%eax
+  ismp = 1;
+80104cde:	be 01 00 00 00       	mov    $0x1,%esi
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80104ce3:	01 d7                	add    %edx,%edi
+80104ce5:	89 fa                	mov    %edi,%edx
+80104ce7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104cee:	66 90                	xchg   %ax,%ax
+80104cf0:	39 d0                	cmp    %edx,%eax
+80104cf2:	73 15                	jae    80104d09 <mpinit+0x109>
+    switch(*p){
+80104cf4:	0f b6 08             	movzbl (%eax),%ecx
+80104cf7:	80 f9 02             	cmp    $0x2,%cl
+80104cfa:	74 54                	je     80104d50 <mpinit+0x150>
+80104cfc:	77 42                	ja     80104d40 <mpinit+0x140>
+80104cfe:	84 c9                	test   %cl,%cl
+80104d00:	74 5e                	je     80104d60 <mpinit+0x160>
+      p += sizeof(struct mpioapic);
+      continue;
+    case MPBUS:
+    case MPIOINTR:
+    case MPLINTR:
+      p += 8;
+80104d02:	83 c0 08             	add    $0x8,%eax
+  for(p=(uchar*)(conf+1), e=(uchar*)conf+conf->length; p<e; ){
+80104d05:	39 d0                	cmp    %edx,%eax
+80104d07:	72 eb                	jb     80104cf4 <mpinit+0xf4>
+    default:
+      ismp = 0;
+      break;
+    }
+  }
+  if(!ismp)
+80104d09:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80104d0c:	85 f6                	test   %esi,%esi
+80104d0e:	0f 84 e1 00 00 00    	je     80104df5 <mpinit+0x1f5>
+    panic("Didn't find a suitable machine");
+
+  if(mp->imcrp){
+80104d14:	80 7b 0c 00          	cmpb   $0x0,0xc(%ebx)
+80104d18:	74 15                	je     80104d2f <mpinit+0x12f>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104d1a:	b8 70 00 00 00       	mov    $0x70,%eax
+80104d1f:	ba 22 00 00 00       	mov    $0x22,%edx
+80104d24:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80104d25:	ba 23 00 00 00       	mov    $0x23,%edx
+80104d2a:	ec                   	in     (%dx),%al
+    // Bochs doesn't support IMCR, so this doesn't run on Bochs.
+    // But it would on real hardware.
+    outb(0x22, 0x70);   // Select IMCR
+    outb(0x23, inb(0x23) | 1);  // Mask external interrupts.
+80104d2b:	83 c8 01             	or     $0x1,%eax
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80104d2e:	ee                   	out    %al,(%dx)
+  }
+}
+80104d2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104d32:	5b                   	pop    %ebx
+80104d33:	5e                   	pop    %esi
+80104d34:	5f                   	pop    %edi
+80104d35:	5d                   	pop    %ebp
+80104d36:	c3                   	ret
+80104d37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104d3e:	66 90                	xchg   %ax,%ax
+    switch(*p){
+80104d40:	83 e9 03             	sub    $0x3,%ecx
+80104d43:	80 f9 01             	cmp    $0x1,%cl
+80104d46:	76 ba                	jbe    80104d02 <mpinit+0x102>
+80104d48:	31 f6                	xor    %esi,%esi
+80104d4a:	eb a4                	jmp    80104cf0 <mpinit+0xf0>
+80104d4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      ioapicid = ioapic->apicno;
+80104d50:	0f b6 48 01          	movzbl 0x1(%eax),%ecx
+      p += sizeof(struct mpioapic);
+80104d54:	83 c0 08             	add    $0x8,%eax
+      ioapicid = ioapic->apicno;
+80104d57:	88 0d 00 cf 90 80    	mov    %cl,0x8090cf00
+      continue;
+80104d5d:	eb 91                	jmp    80104cf0 <mpinit+0xf0>
+80104d5f:	90                   	nop
+      if(ncpu < NCPU) {
+80104d60:	8b 0d 04 cf 90 80    	mov    0x8090cf04,%ecx
+80104d66:	83 f9 07             	cmp    $0x7,%ecx
+80104d69:	7f 19                	jg     80104d84 <mpinit+0x184>
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+80104d6b:	69 f9 b4 00 00 00    	imul   $0xb4,%ecx,%edi
+80104d71:	0f b6 58 01          	movzbl 0x1(%eax),%ebx
+        ncpu++;
+80104d75:	83 c1 01             	add    $0x1,%ecx
+80104d78:	89 0d 04 cf 90 80    	mov    %ecx,0x8090cf04
+        cpus[ncpu].apicid = proc->apicid;  // apicid may differ from ncpu
+80104d7e:	88 9f 20 cf 90 80    	mov    %bl,-0x7f6f30e0(%edi)
+      p += sizeof(struct mpproc);
+80104d84:	83 c0 14             	add    $0x14,%eax
+      continue;
+80104d87:	e9 64 ff ff ff       	jmp    80104cf0 <mpinit+0xf0>
+80104d8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    panic("Expect to run on an SMP");
+80104d90:	83 ec 0c             	sub    $0xc,%esp
+80104d93:	68 1c b4 10 80       	push   $0x8010b41c
+80104d98:	e8 e3 ba ff ff       	call   80100880 <panic>
+80104d9d:	8d 76 00             	lea    0x0(%esi),%esi
+{
+80104da0:	bb 00 00 0f 80       	mov    $0x800f0000,%ebx
+80104da5:	eb 13                	jmp    80104dba <mpinit+0x1ba>
+80104da7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104dae:	66 90                	xchg   %ax,%ax
+  for(p = addr; p < e; p += sizeof(struct mp))
+80104db0:	89 f3                	mov    %esi,%ebx
+80104db2:	81 fe 00 00 10 80    	cmp    $0x80100000,%esi
+80104db8:	74 d6                	je     80104d90 <mpinit+0x190>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80104dba:	83 ec 04             	sub    $0x4,%esp
+80104dbd:	8d 73 10             	lea    0x10(%ebx),%esi
+80104dc0:	6a 04                	push   $0x4
+80104dc2:	68 12 b4 10 80       	push   $0x8010b412
+80104dc7:	53                   	push   %ebx
+80104dc8:	e8 a3 28 00 00       	call   80107670 <memcmp>
+80104dcd:	83 c4 10             	add    $0x10,%esp
+80104dd0:	85 c0                	test   %eax,%eax
+80104dd2:	75 dc                	jne    80104db0 <mpinit+0x1b0>
+80104dd4:	89 da                	mov    %ebx,%edx
+80104dd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80104ddd:	8d 76 00             	lea    0x0(%esi),%esi
+    sum += addr[i];
+80104de0:	0f b6 0a             	movzbl (%edx),%ecx
+  for(i=0; i<len; i++)
+80104de3:	83 c2 01             	add    $0x1,%edx
+    sum += addr[i];
+80104de6:	01 c8                	add    %ecx,%eax
+  for(i=0; i<len; i++)
+80104de8:	39 f2                	cmp    %esi,%edx
+80104dea:	75 f4                	jne    80104de0 <mpinit+0x1e0>
+    if(memcmp(p, "_MP_", 4) == 0 && sum(p, sizeof(struct mp)) == 0)
+80104dec:	84 c0                	test   %al,%al
+80104dee:	75 c0                	jne    80104db0 <mpinit+0x1b0>
+80104df0:	e9 5b fe ff ff       	jmp    80104c50 <mpinit+0x50>
+    panic("Didn't find a suitable machine");
+80104df5:	83 ec 0c             	sub    $0xc,%esp
+80104df8:	68 34 b4 10 80       	push   $0x8010b434
+80104dfd:	e8 7e ba ff ff       	call   80100880 <panic>
+80104e02:	66 90                	xchg   %ax,%ax
+80104e04:	66 90                	xchg   %ax,%ax
+80104e06:	66 90                	xchg   %ax,%ax
+80104e08:	66 90                	xchg   %ax,%ax
+80104e0a:	66 90                	xchg   %ax,%ax
+80104e0c:	66 90                	xchg   %ax,%ax
+80104e0e:	66 90                	xchg   %ax,%ax
+
+80104e10 <picinit>:
+80104e10:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104e15:	ba 21 00 00 00       	mov    $0x21,%edx
+80104e1a:	ee                   	out    %al,(%dx)
+80104e1b:	ba a1 00 00 00       	mov    $0xa1,%edx
+80104e20:	ee                   	out    %al,(%dx)
+picinit(void)
+{
+  // mask all interrupts
+  outb(IO_PIC1+1, 0xFF);
+  outb(IO_PIC2+1, 0xFF);
+}
+80104e21:	c3                   	ret
+80104e22:	66 90                	xchg   %ax,%ax
+80104e24:	66 90                	xchg   %ax,%ax
+80104e26:	66 90                	xchg   %ax,%ax
+80104e28:	66 90                	xchg   %ax,%ax
+80104e2a:	66 90                	xchg   %ax,%ax
+80104e2c:	66 90                	xchg   %ax,%ax
+80104e2e:	66 90                	xchg   %ax,%ax
+
+80104e30 <pipewait>:
+
+// Wait for room in p. Returns -1 if the pipe is closed
+// or the caller killed.
+static int
+pipewait(struct pipe *p)
+{
+80104e30:	55                   	push   %ebp
+80104e31:	89 e5                	mov    %esp,%ebp
+80104e33:	56                   	push   %esi
+80104e34:	53                   	push   %ebx
+  if(p->readopen == 0 || myproc()->killed){
+80104e35:	8b 90 f4 00 00 00    	mov    0xf4(%eax),%edx
+{
+80104e3b:	89 c3                	mov    %eax,%ebx
+  if(p->readopen == 0 || myproc()->killed){
+80104e3d:	85 d2                	test   %edx,%edx
+80104e3f:	74 57                	je     80104e98 <pipewait+0x68>
+80104e41:	e8 3a 0f 00 00       	call   80105d80 <myproc>
+80104e46:	8b 70 40             	mov    0x40(%eax),%esi
+80104e49:	85 f6                	test   %esi,%esi
+80104e4b:	75 4b                	jne    80104e98 <pipewait+0x68>
+    release(&p->lock);
+    return -1;
+  }
+  if(p->rwait)
+80104e4d:	8b 83 fc 00 00 00    	mov    0xfc(%ebx),%eax
+80104e53:	85 c0                	test   %eax,%eax
+80104e55:	75 29                	jne    80104e80 <pipewait+0x50>
+    wakeup(&p->nread);
+  p->wwait++;
+  sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+80104e57:	83 ec 08             	sub    $0x8,%esp
+  p->wwait++;
+80104e5a:	83 83 00 01 00 00 01 	addl   $0x1,0x100(%ebx)
+  sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+80104e61:	8d 43 38             	lea    0x38(%ebx),%eax
+80104e64:	53                   	push   %ebx
+80104e65:	50                   	push   %eax
+80104e66:	e8 85 1b 00 00       	call   801069f0 <sleep>
+  p->wwait--;
+80104e6b:	83 ab 00 01 00 00 01 	subl   $0x1,0x100(%ebx)
+  return 0;
+80104e72:	83 c4 10             	add    $0x10,%esp
+}
+80104e75:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80104e78:	89 f0                	mov    %esi,%eax
+80104e7a:	5b                   	pop    %ebx
+80104e7b:	5e                   	pop    %esi
+80104e7c:	5d                   	pop    %ebp
+80104e7d:	c3                   	ret
+80104e7e:	66 90                	xchg   %ax,%ax
+    wakeup(&p->nread);
+80104e80:	83 ec 0c             	sub    $0xc,%esp
+80104e83:	8d 43 34             	lea    0x34(%ebx),%eax
+80104e86:	50                   	push   %eax
+80104e87:	e8 94 1e 00 00       	call   80106d20 <wakeup>
+80104e8c:	83 c4 10             	add    $0x10,%esp
+80104e8f:	eb c6                	jmp    80104e57 <pipewait+0x27>
+80104e91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    release(&p->lock);
+80104e98:	83 ec 0c             	sub    $0xc,%esp
+    return -1;
+80104e9b:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    release(&p->lock);
+80104ea0:	53                   	push   %ebx
+80104ea1:	e8 4a 26 00 00       	call   801074f0 <release>
+    return -1;
+80104ea6:	83 c4 10             	add    $0x10,%esp
+80104ea9:	eb ca                	jmp    80104e75 <pipewait+0x45>
+80104eab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80104eaf:	90                   	nop
+
+80104eb0 <pipealloc>:
+{
+80104eb0:	55                   	push   %ebp
+80104eb1:	89 e5                	mov    %esp,%ebp
+80104eb3:	57                   	push   %edi
+80104eb4:	56                   	push   %esi
+80104eb5:	53                   	push   %ebx
+80104eb6:	83 ec 0c             	sub    $0xc,%esp
+80104eb9:	8b 75 08             	mov    0x8(%ebp),%esi
+80104ebc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  *f0 = *f1 = 0;
+80104ebf:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+80104ec5:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if((*f0 = filealloc()) == 0 || (*f1 = filealloc()) == 0)
+80104ecb:	e8 c0 c4 ff ff       	call   80101390 <filealloc>
+80104ed0:	89 06                	mov    %eax,(%esi)
+80104ed2:	85 c0                	test   %eax,%eax
+80104ed4:	0f 84 e3 00 00 00    	je     80104fbd <pipealloc+0x10d>
+80104eda:	e8 b1 c4 ff ff       	call   80101390 <filealloc>
+80104edf:	89 07                	mov    %eax,(%edi)
+80104ee1:	85 c0                	test   %eax,%eax
+80104ee3:	0f 84 c2 00 00 00    	je     80104fab <pipealloc+0xfb>
+  if((p = (struct pipe*)kalloc()) == 0)
+80104ee9:	e8 f2 ea ff ff       	call   801039e0 <kalloc>
+80104eee:	89 c3                	mov    %eax,%ebx
+80104ef0:	85 c0                	test   %eax,%eax
+80104ef2:	0f 84 de 00 00 00    	je     80104fd6 <pipealloc+0x126>
+  initlock(&p->lock, "pipe");
+80104ef8:	83 ec 08             	sub    $0x8,%esp
+  p->nwrite = 0;
+80104efb:	c7 40 38 00 00 00 00 	movl   $0x0,0x38(%eax)
+  p->readopen = 1;
+80104f02:	c7 80 f4 00 00 00 01 	movl   $0x1,0xf4(%eax)
+80104f09:	00 00 00 
+  p->writeopen = 1;
+80104f0c:	c7 80 f8 00 00 00 01 	movl   $0x1,0xf8(%eax)
+80104f13:	00 00 00 
+  p->nread = 0;
+80104f16:	c7 40 34 00 00 00 00 	movl   $0x0,0x34(%eax)
+  p->size = PIPEDATA;
+80104f1d:	c7 40 3c fc 0e 00 00 	movl   $0xefc,0x3c(%eax)
+  p->rhead = 0;
+80104f24:	c7 40 40 00 00 00 00 	movl   $0x0,0x40(%eax)
+  p->rcount = 0;
+80104f2b:	c7 40 44 00 00 00 00 	movl   $0x0,0x44(%eax)
+  p->npage = 0;
+80104f32:	c7 40 48 00 00 00 00 	movl   $0x0,0x48(%eax)
+  p->lwrite = 0;
+80104f39:	c7 80 f0 00 00 00 00 	movl   $0x0,0xf0(%eax)
+80104f40:	00 00 00 
+  p->lread = 0;
+80104f43:	c7 80 ec 00 00 00 00 	movl   $0x0,0xec(%eax)
+80104f4a:	00 00 00 
+  p->rwait = 0;
+80104f4d:	c7 80 fc 00 00 00 00 	movl   $0x0,0xfc(%eax)
+80104f54:	00 00 00 
+  p->wwait = 0;
+80104f57:	c7 80 00 01 00 00 00 	movl   $0x0,0x100(%eax)
+80104f5e:	00 00 00 
+  initlock(&p->lock, "pipe");
+80104f61:	68 53 b4 10 80       	push   $0x8010b453
+80104f66:	50                   	push   %eax
+80104f67:	e8 04 24 00 00       	call   80107370 <initlock>
+  (*f0)->type = FD_PIPE;
+80104f6c:	8b 06                	mov    (%esi),%eax
+  return 0;
+80104f6e:	83 c4 10             	add    $0x10,%esp
+  (*f0)->type = FD_PIPE;
+80104f71:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f0)->readable = 1;
+80104f77:	8b 06                	mov    (%esi),%eax
+80104f79:	c6 40 08 01          	movb   $0x1,0x8(%eax)
+  (*f0)->writable = 0;
+80104f7d:	8b 06                	mov    (%esi),%eax
+80104f7f:	c6 40 09 00          	movb   $0x0,0x9(%eax)
+  (*f0)->pipe = p;
+80104f83:	8b 06                	mov    (%esi),%eax
+80104f85:	89 58 0c             	mov    %ebx,0xc(%eax)
+  (*f1)->type = FD_PIPE;
+80104f88:	8b 07                	mov    (%edi),%eax
+80104f8a:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  (*f1)->readable = 0;
+80104f90:	8b 07                	mov    (%edi),%eax
+80104f92:	c6 40 08 00          	movb   $0x0,0x8(%eax)
+  (*f1)->writable = 1;
+80104f96:	8b 07                	mov    (%edi),%eax
+80104f98:	c6 40 09 01          	movb   $0x1,0x9(%eax)
+  (*f1)->pipe = p;
+80104f9c:	8b 07                	mov    (%edi),%eax
+80104f9e:	89 58 0c             	mov    %ebx,0xc(%eax)
+  return 0;
+80104fa1:	31 c0                	xor    %eax,%eax
+}
+80104fa3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80104fa6:	5b                   	pop    %ebx
+80104fa7:	5e                   	pop    %esi
+80104fa8:	5f                   	pop    %edi
+80104fa9:	5d                   	pop    %ebp
+80104faa:	c3                   	ret
+  if(*f0)
+80104fab:	8b 06                	mov    (%esi),%eax
+80104fad:	85 c0                	test   %eax,%eax
+80104faf:	74 1e                	je     80104fcf <pipealloc+0x11f>
+    fileclose(*f0);
+80104fb1:	83 ec 0c             	sub    $0xc,%esp
+80104fb4:	50                   	push   %eax
+80104fb5:	e8 a6 c4 ff ff       	call   80101460 <fileclose>
+80104fba:	83 c4 10             	add    $0x10,%esp
+  if(*f1)
+80104fbd:	8b 07                	mov    (%edi),%eax
+80104fbf:	85 c0                	test   %eax,%eax
+80104fc1:	74 0c                	je     80104fcf <pipealloc+0x11f>
+    fileclose(*f1);
+80104fc3:	83 ec 0c             	sub    $0xc,%esp
+80104fc6:	50                   	push   %eax
+80104fc7:	e8 94 c4 ff ff       	call   80101460 <fileclose>
+80104fcc:	83 c4 10             	add    $0x10,%esp
+  return -1;
+80104fcf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80104fd4:	eb cd                	jmp    80104fa3 <pipealloc+0xf3>
+  if(*f0)
+80104fd6:	8b 06                	mov    (%esi),%eax
+80104fd8:	85 c0                	test   %eax,%eax
+80104fda:	75 d5                	jne    80104fb1 <pipealloc+0x101>
+80104fdc:	eb df                	jmp    80104fbd <pipealloc+0x10d>
+80104fde:	66 90                	xchg   %ax,%ax
+
+80104fe0 <pipeclose>:
+{
+80104fe0:	55                   	push   %ebp
+80104fe1:	89 e5                	mov    %esp,%ebp
+80104fe3:	56                   	push   %esi
+80104fe4:	53                   	push   %ebx
+80104fe5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80104fe8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  acquire(&p->lock);
+80104feb:	83 ec 0c             	sub    $0xc,%esp
+80104fee:	53                   	push   %ebx
+80104fef:	e8 5c 25 00 00       	call   80107550 <acquire>
+  if(writable){
+80104ff4:	83 c4 10             	add    $0x10,%esp
+80104ff7:	85 f6                	test   %esi,%esi
+80104ff9:	74 45                	je     80105040 <pipeclose+0x60>
+    p->writeopen = 0;
+80104ffb:	c7 83 f8 00 00 00 00 	movl   $0x0,0xf8(%ebx)
+80105002:	00 00 00 
+    wakeup(&p->nread);
+80105005:	83 ec 0c             	sub    $0xc,%esp
+80105008:	8d 43 34             	lea    0x34(%ebx),%eax
+8010500b:	50                   	push   %eax
+8010500c:	e8 0f 1d 00 00       	call   80106d20 <wakeup>
+80105011:	83 c4 10             	add    $0x10,%esp
+  if(p->readopen == 0 && p->writeopen == 0){
+80105014:	8b 93 f4 00 00 00    	mov    0xf4(%ebx),%edx
+8010501a:	85 d2                	test   %edx,%edx
+8010501c:	75 0a                	jne    80105028 <pipeclose+0x48>
+8010501e:	8b 83 f8 00 00 00    	mov    0xf8(%ebx),%eax
+80105024:	85 c0                	test   %eax,%eax
+80105026:	74 38                	je     80105060 <pipeclose+0x80>
+    release(&p->lock);
+80105028:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+8010502b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010502e:	5b                   	pop    %ebx
+8010502f:	5e                   	pop    %esi
+80105030:	5d                   	pop    %ebp
+    release(&p->lock);
+80105031:	e9 ba 24 00 00       	jmp    801074f0 <release>
+80105036:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010503d:	8d 76 00             	lea    0x0(%esi),%esi
+    p->readopen = 0;
+80105040:	c7 83 f4 00 00 00 00 	movl   $0x0,0xf4(%ebx)
+80105047:	00 00 00 
+    wakeup(&p->nwrite);
+8010504a:	83 ec 0c             	sub    $0xc,%esp
+8010504d:	8d 43 38             	lea    0x38(%ebx),%eax
+80105050:	50                   	push   %eax
+80105051:	e8 ca 1c 00 00       	call   80106d20 <wakeup>
+80105056:	83 c4 10             	add    $0x10,%esp
+80105059:	eb b9                	jmp    80105014 <pipeclose+0x34>
+8010505b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010505f:	90                   	nop
+    release(&p->lock);
+80105060:	83 ec 0c             	sub    $0xc,%esp
+80105063:	53                   	push   %ebx
+80105064:	e8 87 24 00 00       	call   801074f0 <release>
+    for(; p->lread != p->lwrite; p->lread++)
+80105069:	8b 83 ec 00 00 00    	mov    0xec(%ebx),%eax
+8010506f:	83 c4 10             	add    $0x10,%esp
+80105072:	39 83 f0 00 00 00    	cmp    %eax,0xf0(%ebx)
+80105078:	74 3b                	je     801050b5 <pipeclose+0xd5>
+8010507a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      kfree(P2V(p->loan[p->lread % NLOAN].pa));
+80105080:	83 e0 07             	and    $0x7,%eax
+80105083:	83 ec 0c             	sub    $0xc,%esp
+80105086:	8d 04 40             	lea    (%eax,%eax,2),%eax
+80105089:	8b 84 83 90 00 00 00 	mov    0x90(%ebx,%eax,4),%eax
+80105090:	05 00 00 00 80       	add    $0x80000000,%eax
+80105095:	50                   	push   %eax
+80105096:	e8 85 e6 ff ff       	call   80103720 <kfree>
+    for(; p->lread != p->lwrite; p->lread++)
+8010509b:	8b 83 ec 00 00 00    	mov    0xec(%ebx),%eax
+801050a1:	83 c4 10             	add    $0x10,%esp
+801050a4:	83 c0 01             	add    $0x1,%eax
+801050a7:	89 83 ec 00 00 00    	mov    %eax,0xec(%ebx)
+801050ad:	3b 83 f0 00 00 00    	cmp    0xf0(%ebx),%eax
+801050b3:	75 cb                	jne    80105080 <pipeclose+0xa0>
+    while(p->npage > 0)
+801050b5:	8b 43 48             	mov    0x48(%ebx),%eax
+801050b8:	85 c0                	test   %eax,%eax
+801050ba:	7e 20                	jle    801050dc <pipeclose+0xfc>
+801050bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      kfree(p->page[--p->npage]);
+801050c0:	8d 50 ff             	lea    -0x1(%eax),%edx
+801050c3:	83 ec 0c             	sub    $0xc,%esp
+801050c6:	89 53 48             	mov    %edx,0x48(%ebx)
+801050c9:	ff 74 83 48          	push   0x48(%ebx,%eax,4)
+801050cd:	e8 4e e6 ff ff       	call   80103720 <kfree>
+    while(p->npage > 0)
+801050d2:	8b 43 48             	mov    0x48(%ebx),%eax
+801050d5:	83 c4 10             	add    $0x10,%esp
+801050d8:	85 c0                	test   %eax,%eax
+801050da:	7f e4                	jg     801050c0 <pipeclose+0xe0>
+    kfree((char*)p);
+801050dc:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+801050df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801050e2:	5b                   	pop    %ebx
+801050e3:	5e                   	pop    %esi
+801050e4:	5d                   	pop    %ebp
+    kfree((char*)p);
+801050e5:	e9 36 e6 ff ff       	jmp    80103720 <kfree>
+801050ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801050f0 <pipewrite>:
+
+//PAGEBREAK: 40
+int
+pipewrite(struct pipe *p, char *addr, int n)
+{
+801050f0:	55                   	push   %ebp
+801050f1:	89 e5                	mov    %esp,%ebp
+801050f3:	57                   	push   %edi
+801050f4:	56                   	push   %esi
+801050f5:	53                   	push   %ebx
+801050f6:	83 ec 28             	sub    $0x28,%esp
+801050f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  struct loan *l;
+  uint pa, m, run;
+  char *dst;
+  int i;
+
+  acquire(&p->lock);
+801050fc:	56                   	push   %esi
+801050fd:	e8 4e 24 00 00       	call   80107550 <acquire>
+  for(i = 0; i < n; i += m){
+80105102:	8b 5d 10             	mov    0x10(%ebp),%ebx
+80105105:	83 c4 10             	add    $0x10,%esp
+80105108:	85 db                	test   %ebx,%ebx
+8010510a:	0f 8e b8 00 00 00    	jle    801051c8 <pipewrite+0xd8>
+80105110:	31 ff                	xor    %edi,%edi
+    if((uint)(addr+i) % PGSIZE == 0 && n - i >= PGSIZE){
+80105112:	8b 45 0c             	mov    0xc(%ebp),%eax
+80105115:	01 f8                	add    %edi,%eax
+80105117:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010511a:	25 ff 0f 00 00       	and    $0xfff,%eax
+8010511f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80105122:	0f 85 d7 00 00 00    	jne    801051ff <pipewrite+0x10f>
+80105128:	8b 45 10             	mov    0x10(%ebp),%eax
+8010512b:	29 f8                	sub    %edi,%eax
+8010512d:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+80105132:	7f 1b                	jg     8010514f <pipewrite+0x5f>
+80105134:	e9 c6 00 00 00       	jmp    801051ff <pipewrite+0x10f>
+80105139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      // A whole page: lend it, unless the loans are all out.
+      while(p->lwrite == p->lread + NLOAN)
+        if(pipewait(p) < 0)
+80105140:	89 f0                	mov    %esi,%eax
+80105142:	e8 e9 fc ff ff       	call   80104e30 <pipewait>
+80105147:	85 c0                	test   %eax,%eax
+80105149:	0f 88 71 01 00 00    	js     801052c0 <pipewrite+0x1d0>
+      while(p->lwrite == p->lread + NLOAN)
+8010514f:	8b 86 ec 00 00 00    	mov    0xec(%esi),%eax
+80105155:	83 c0 08             	add    $0x8,%eax
+80105158:	39 86 f0 00 00 00    	cmp    %eax,0xf0(%esi)
+8010515e:	74 e0                	je     80105140 <pipewrite+0x50>
+          return -1;
+      if((pa = loanpage(myproc()->pgdir, addr+i)) != 0){
+80105160:	e8 1b 0c 00 00       	call   80105d80 <myproc>
+80105165:	83 ec 08             	sub    $0x8,%esp
+80105168:	ff 75 e4             	push   -0x1c(%ebp)
+8010516b:	ff 70 04             	push   0x4(%eax)
+8010516e:	e8 fd 58 00 00       	call   8010aa70 <loanpage>
+80105173:	83 c4 10             	add    $0x10,%esp
+80105176:	85 c0                	test   %eax,%eax
+80105178:	0f 84 81 00 00 00    	je     801051ff <pipewrite+0x10f>
+        l = &p->loan[p->lwrite++ % NLOAN];
+8010517e:	8b 96 f0 00 00 00    	mov    0xf0(%esi),%edx
+        l->pos = p->nwrite;
+        l->pa = pa;
+        l->off = 0;
+        p->nwrite += PGSIZE;
+        m = PGSIZE;
+80105184:	bb 00 10 00 00       	mov    $0x1000,%ebx
+        l = &p->loan[p->lwrite++ % NLOAN];
+80105189:	8d 4a 01             	lea    0x1(%edx),%ecx
+8010518c:	83 e2 07             	and    $0x7,%edx
+8010518f:	89 8e f0 00 00 00    	mov    %ecx,0xf0(%esi)
+        l->pos = p->nwrite;
+80105195:	8d 14 52             	lea    (%edx,%edx,2),%edx
+80105198:	8b 4e 38             	mov    0x38(%esi),%ecx
+8010519b:	8d 14 96             	lea    (%esi,%edx,4),%edx
+8010519e:	89 8a 8c 00 00 00    	mov    %ecx,0x8c(%edx)
+        p->nwrite += PGSIZE;
+801051a4:	81 c1 00 10 00 00    	add    $0x1000,%ecx
+        l->pa = pa;
+801051aa:	89 82 90 00 00 00    	mov    %eax,0x90(%edx)
+        l->off = 0;
+801051b0:	c7 82 94 00 00 00 00 	movl   $0x0,0x94(%edx)
+801051b7:	00 00 00 
+        p->nwrite += PGSIZE;
+801051ba:	89 4e 38             	mov    %ecx,0x38(%esi)
+  for(i = 0; i < n; i += m){
+801051bd:	01 df                	add    %ebx,%edi
+801051bf:	39 7d 10             	cmp    %edi,0x10(%ebp)
+801051c2:	0f 8f 4a ff ff ff    	jg     80105112 <pipewrite+0x22>
+    p->rcount += m;
+    p->nwrite += m;
+    if(p->rwait && p->rcount >= HIWAT(p) && p->rcount - m < HIWAT(p))
+      wakeup(&p->nread);
+  }
+  if(p->rwait)
+801051c8:	8b 86 fc 00 00 00    	mov    0xfc(%esi),%eax
+801051ce:	85 c0                	test   %eax,%eax
+801051d0:	0f 85 10 01 00 00    	jne    801052e6 <pipewrite+0x1f6>
+    wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+  release(&p->lock);
+801051d6:	83 ec 0c             	sub    $0xc,%esp
+801051d9:	56                   	push   %esi
+801051da:	e8 11 23 00 00       	call   801074f0 <release>
+  return n;
+801051df:	8b 45 10             	mov    0x10(%ebp),%eax
+801051e2:	83 c4 10             	add    $0x10,%esp
+801051e5:	e9 db 00 00 00       	jmp    801052c5 <pipewrite+0x1d5>
+801051ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(pipewait(p) < 0)
+801051f0:	89 f0                	mov    %esi,%eax
+801051f2:	e8 39 fc ff ff       	call   80104e30 <pipewait>
+801051f7:	85 c0                	test   %eax,%eax
+801051f9:	0f 88 c1 00 00 00    	js     801052c0 <pipewrite+0x1d0>
+    while(p->rcount == p->size)  //DOC: pipewrite-full
+801051ff:	8b 5e 44             	mov    0x44(%esi),%ebx
+80105202:	8b 4e 3c             	mov    0x3c(%esi),%ecx
+80105205:	39 cb                	cmp    %ecx,%ebx
+80105207:	74 e7                	je     801051f0 <pipewrite+0x100>
+    dst = ringptr(p, (p->rhead + p->rcount) % p->size, &run);
+80105209:	8b 46 40             	mov    0x40(%esi),%eax
+8010520c:	31 d2                	xor    %edx,%edx
+8010520e:	01 d8                	add    %ebx,%eax
+80105210:	f7 f1                	div    %ecx
+  if(i < PIPEDATA){
+80105212:	81 fa fb 0e 00 00    	cmp    $0xefb,%edx
+80105218:	0f 86 b2 00 00 00    	jbe    801052d0 <pipewrite+0x1e0>
+  i -= PIPEDATA;
+8010521e:	81 ea fc 0e 00 00    	sub    $0xefc,%edx
+  *n = PGSIZE - i%PGSIZE;
+80105224:	89 d0                	mov    %edx,%eax
+80105226:	89 55 d8             	mov    %edx,-0x28(%ebp)
+80105229:	ba 00 10 00 00       	mov    $0x1000,%edx
+8010522e:	25 ff 0f 00 00       	and    $0xfff,%eax
+80105233:	29 c2                	sub    %eax,%edx
+80105235:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  return p->page[i/PGSIZE] + i%PGSIZE;
+80105238:	8b 55 d8             	mov    -0x28(%ebp),%edx
+8010523b:	c1 ea 0c             	shr    $0xc,%edx
+8010523e:	03 44 96 4c          	add    0x4c(%esi,%edx,4),%eax
+80105242:	89 c2                	mov    %eax,%edx
+    m = n - i;
+80105244:	8b 45 10             	mov    0x10(%ebp),%eax
+    if(m > p->size - p->rcount)
+80105247:	29 d9                	sub    %ebx,%ecx
+    if(m > PGSIZE - (uint)(addr+i) % PGSIZE)
+80105249:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+    m = n - i;
+8010524c:	29 f8                	sub    %edi,%eax
+8010524e:	39 c1                	cmp    %eax,%ecx
+80105250:	0f 47 c8             	cmova  %eax,%ecx
+    if(m > PGSIZE - (uint)(addr+i) % PGSIZE)
+80105253:	b8 00 10 00 00       	mov    $0x1000,%eax
+80105258:	29 d8                	sub    %ebx,%eax
+8010525a:	39 c1                	cmp    %eax,%ecx
+8010525c:	0f 47 c8             	cmova  %eax,%ecx
+8010525f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+80105262:	39 c1                	cmp    %eax,%ecx
+80105264:	89 c3                	mov    %eax,%ebx
+80105266:	0f 46 d9             	cmovbe %ecx,%ebx
+    memmove(dst, addr+i, m);
+80105269:	83 ec 04             	sub    $0x4,%esp
+8010526c:	53                   	push   %ebx
+8010526d:	ff 75 e4             	push   -0x1c(%ebp)
+80105270:	52                   	push   %edx
+80105271:	e8 4a 24 00 00       	call   801076c0 <memmove>
+    p->rcount += m;
+80105276:	8b 46 44             	mov    0x44(%esi),%eax
+    p->nwrite += m;
+80105279:	01 5e 38             	add    %ebx,0x38(%esi)
+    if(p->rwait && p->rcount >= HIWAT(p) && p->rcount - m < HIWAT(p))
+8010527c:	83 c4 10             	add    $0x10,%esp
+8010527f:	8b 8e fc 00 00 00    	mov    0xfc(%esi),%ecx
+    p->rcount += m;
+80105285:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+80105288:	89 56 44             	mov    %edx,0x44(%esi)
+    if(p->rwait && p->rcount >= HIWAT(p) && p->rcount - m < HIWAT(p))
+8010528b:	85 c9                	test   %ecx,%ecx
+8010528d:	0f 84 2a ff ff ff    	je     801051bd <pipewrite+0xcd>
+80105293:	8b 4e 3c             	mov    0x3c(%esi),%ecx
+80105296:	d1 e9                	shr    %ecx
+80105298:	39 c8                	cmp    %ecx,%eax
+8010529a:	0f 83 1d ff ff ff    	jae    801051bd <pipewrite+0xcd>
+801052a0:	39 ca                	cmp    %ecx,%edx
+801052a2:	0f 82 15 ff ff ff    	jb     801051bd <pipewrite+0xcd>
+      wakeup(&p->nread);
+801052a8:	83 ec 0c             	sub    $0xc,%esp
+801052ab:	8d 46 34             	lea    0x34(%esi),%eax
+801052ae:	50                   	push   %eax
+801052af:	e8 6c 1a 00 00       	call   80106d20 <wakeup>
+801052b4:	83 c4 10             	add    $0x10,%esp
+801052b7:	e9 01 ff ff ff       	jmp    801051bd <pipewrite+0xcd>
+801052bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+          return -1;
+801052c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801052c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801052c8:	5b                   	pop    %ebx
+801052c9:	5e                   	pop    %esi
+801052ca:	5f                   	pop    %edi
+801052cb:	5d                   	pop    %ebp
+801052cc:	c3                   	ret
+801052cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *n = PIPEDATA - i;
+801052d0:	b8 fc 0e 00 00       	mov    $0xefc,%eax
+801052d5:	29 d0                	sub    %edx,%eax
+    return p->data + i;
+801052d7:	8d 94 16 04 01 00 00 	lea    0x104(%esi,%edx,1),%edx
+    *n = PIPEDATA - i;
+801052de:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    return p->data + i;
+801052e1:	e9 5e ff ff ff       	jmp    80105244 <pipewrite+0x154>
+    wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+801052e6:	83 ec 0c             	sub    $0xc,%esp
+801052e9:	8d 46 34             	lea    0x34(%esi),%eax
+801052ec:	50                   	push   %eax
+801052ed:	e8 2e 1a 00 00       	call   80106d20 <wakeup>
+801052f2:	83 c4 10             	add    $0x10,%esp
+801052f5:	e9 dc fe ff ff       	jmp    801051d6 <pipewrite+0xe6>
+801052fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80105300 <piperead>:
+
+int
+piperead(struct pipe *p, char *addr, int n)
+{
+80105300:	55                   	push   %ebp
+80105301:	89 e5                	mov    %esp,%ebp
+80105303:	57                   	push   %edi
+80105304:	56                   	push   %esi
+80105305:	53                   	push   %ebx
+80105306:	83 ec 38             	sub    $0x38,%esp
+80105309:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct loan *l;
+  uint m, run;
+  char *src;
+  int i, freed;
+
+  acquire(&p->lock);
+8010530c:	57                   	push   %edi
+8010530d:	8d 5f 34             	lea    0x34(%edi),%ebx
+80105310:	e8 3b 22 00 00       	call   80107550 <acquire>
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+80105315:	8b 47 34             	mov    0x34(%edi),%eax
+80105318:	83 c4 10             	add    $0x10,%esp
+8010531b:	39 47 38             	cmp    %eax,0x38(%edi)
+8010531e:	74 3b                	je     8010535b <piperead+0x5b>
+80105320:	eb 43                	jmp    80105365 <piperead+0x65>
+80105322:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(myproc()->killed){
+80105328:	e8 53 0a 00 00       	call   80105d80 <myproc>
+8010532d:	8b 70 40             	mov    0x40(%eax),%esi
+80105330:	85 f6                	test   %esi,%esi
+80105332:	0f 85 88 02 00 00    	jne    801055c0 <piperead+0x2c0>
+      release(&p->lock);
+      return -1;
+    }
+    p->rwait++;
+    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+80105338:	83 ec 08             	sub    $0x8,%esp
+    p->rwait++;
+8010533b:	83 87 fc 00 00 00 01 	addl   $0x1,0xfc(%edi)
+    sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+80105342:	57                   	push   %edi
+80105343:	53                   	push   %ebx
+80105344:	e8 a7 16 00 00       	call   801069f0 <sleep>
+    p->rwait--;
+80105349:	83 af fc 00 00 00 01 	subl   $0x1,0xfc(%edi)
+  while(p->nread == p->nwrite && p->writeopen){  //DOC: pipe-empty
+80105350:	8b 47 38             	mov    0x38(%edi),%eax
+80105353:	83 c4 10             	add    $0x10,%esp
+80105356:	39 47 34             	cmp    %eax,0x34(%edi)
+80105359:	75 0a                	jne    80105365 <piperead+0x65>
+8010535b:	8b 8f f8 00 00 00    	mov    0xf8(%edi),%ecx
+80105361:	85 c9                	test   %ecx,%ecx
+80105363:	75 c3                	jne    80105328 <piperead+0x28>
+  }
+  freed = 0;
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+80105365:	8b 45 10             	mov    0x10(%ebp),%eax
+80105368:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%ebp)
+8010536f:	31 f6                	xor    %esi,%esi
+80105371:	85 c0                	test   %eax,%eax
+80105373:	0f 8f 99 00 00 00    	jg     80105412 <piperead+0x112>
+80105379:	e9 91 02 00 00       	jmp    8010560f <piperead+0x30f>
+8010537e:	66 90                	xchg   %ax,%ax
+      continue;
+    }
+
+    // From a lent page: take the page itself if the reader
+    // wants all of it at a page boundary, else copy.
+    m = PGSIZE - l->off;
+80105380:	8b 55 cc             	mov    -0x34(%ebp),%edx
+80105383:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+80105386:	bb 00 10 00 00       	mov    $0x1000,%ebx
+8010538b:	8b 82 94 00 00 00    	mov    0x94(%edx),%eax
+    if(m > n - i)
+      m = n - i;
+    if(m == PGSIZE && (uint)(addr+i) % PGSIZE == 0 &&
+       maploan(myproc()->pgdir, addr+i, l->pa) == 0){
+80105391:	8b 92 90 00 00 00    	mov    0x90(%edx),%edx
+    m = PGSIZE - l->off;
+80105397:	29 c3                	sub    %eax,%ebx
+80105399:	39 cb                	cmp    %ecx,%ebx
+8010539b:	0f 47 d9             	cmova  %ecx,%ebx
+    if(m == PGSIZE && (uint)(addr+i) % PGSIZE == 0 &&
+8010539e:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+801053a4:	75 0d                	jne    801053b3 <piperead+0xb3>
+801053a6:	f7 45 e0 ff 0f 00 00 	testl  $0xfff,-0x20(%ebp)
+801053ad:	0f 84 dd 01 00 00    	je     80105590 <piperead+0x290>
+      l->pa = 0;
+    } else
+      memmove(addr+i, (char*)P2V(l->pa) + l->off, m);
+801053b3:	83 ec 04             	sub    $0x4,%esp
+801053b6:	53                   	push   %ebx
+801053b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+801053ba:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+801053bd:	01 ca                	add    %ecx,%edx
+801053bf:	8b 94 97 90 00 00 00 	mov    0x90(%edi,%edx,4),%edx
+801053c6:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+801053cd:	50                   	push   %eax
+801053ce:	ff 75 e0             	push   -0x20(%ebp)
+801053d1:	e8 ea 22 00 00       	call   801076c0 <memmove>
+801053d6:	83 c4 10             	add    $0x10,%esp
+    l->off += m;
+801053d9:	8b 55 dc             	mov    -0x24(%ebp),%edx
+801053dc:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+801053df:	01 d0                	add    %edx,%eax
+801053e1:	8d 04 87             	lea    (%edi,%eax,4),%eax
+801053e4:	8b 90 94 00 00 00    	mov    0x94(%eax),%edx
+    l->pos += m;
+801053ea:	01 98 8c 00 00 00    	add    %ebx,0x8c(%eax)
+    l->off += m;
+801053f0:	01 da                	add    %ebx,%edx
+801053f2:	89 90 94 00 00 00    	mov    %edx,0x94(%eax)
+    p->nread += m;
+801053f8:	01 5f 34             	add    %ebx,0x34(%edi)
+    if(l->off == PGSIZE){
+801053fb:	81 fa 00 10 00 00    	cmp    $0x1000,%edx
+80105401:	0f 84 49 01 00 00    	je     80105550 <piperead+0x250>
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+80105407:	01 de                	add    %ebx,%esi
+80105409:	39 75 10             	cmp    %esi,0x10(%ebp)
+8010540c:	0f 8e e4 00 00 00    	jle    801054f6 <piperead+0x1f6>
+80105412:	8b 47 34             	mov    0x34(%edi),%eax
+80105415:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80105418:	3b 47 38             	cmp    0x38(%edi),%eax
+8010541b:	0f 84 d5 00 00 00    	je     801054f6 <piperead+0x1f6>
+    if(m > n - i)
+80105421:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    l = &p->loan[p->lread % NLOAN];
+80105424:	8b 97 ec 00 00 00    	mov    0xec(%edi),%edx
+    if(p->lread == p->lwrite || l->pos != p->nread){
+8010542a:	8b 9f f0 00 00 00    	mov    0xf0(%edi),%ebx
+    if(m > n - i)
+80105430:	29 f1                	sub    %esi,%ecx
+    l = &p->loan[p->lread % NLOAN];
+80105432:	89 d0                	mov    %edx,%eax
+    if(m > n - i)
+80105434:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    if(m == PGSIZE && (uint)(addr+i) % PGSIZE == 0 &&
+80105437:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    l = &p->loan[p->lread % NLOAN];
+8010543a:	83 e0 07             	and    $0x7,%eax
+8010543d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    if(m == PGSIZE && (uint)(addr+i) % PGSIZE == 0 &&
+80105440:	01 f1                	add    %esi,%ecx
+    if(p->lread == p->lwrite || l->pos != p->nread){
+80105442:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    if(m == PGSIZE && (uint)(addr+i) % PGSIZE == 0 &&
+80105445:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+    if(p->lread == p->lwrite || l->pos != p->nread){
+80105448:	39 da                	cmp    %ebx,%edx
+8010544a:	74 1d                	je     80105469 <piperead+0x169>
+8010544c:	8d 0c 00             	lea    (%eax,%eax,1),%ecx
+8010544f:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+80105452:	01 c8                	add    %ecx,%eax
+80105454:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+80105457:	8d 04 87             	lea    (%edi,%eax,4),%eax
+8010545a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+8010545d:	39 98 8c 00 00 00    	cmp    %ebx,0x8c(%eax)
+80105463:	0f 84 17 ff ff ff    	je     80105380 <piperead+0x80>
+      src = ringptr(p, p->rhead, &run);
+80105469:	8b 47 40             	mov    0x40(%edi),%eax
+  if(i < PIPEDATA){
+8010546c:	3d fb 0e 00 00       	cmp    $0xefb,%eax
+80105471:	0f 86 b9 00 00 00    	jbe    80105530 <piperead+0x230>
+  i -= PIPEDATA;
+80105477:	2d fc 0e 00 00       	sub    $0xefc,%eax
+  *n = PGSIZE - i%PGSIZE;
+8010547c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+80105481:	89 c3                	mov    %eax,%ebx
+  return p->page[i/PGSIZE] + i%PGSIZE;
+80105483:	c1 e8 0c             	shr    $0xc,%eax
+  *n = PGSIZE - i%PGSIZE;
+80105486:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+8010548c:	29 d9                	sub    %ebx,%ecx
+  return p->page[i/PGSIZE] + i%PGSIZE;
+8010548e:	03 5c 87 4c          	add    0x4c(%edi,%eax,4),%ebx
+  *n = PGSIZE - i%PGSIZE;
+80105492:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  return p->page[i/PGSIZE] + i%PGSIZE;
+80105495:	89 d8                	mov    %ebx,%eax
+      if(m > run)
+80105497:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+8010549a:	8b 5f 44             	mov    0x44(%edi),%ebx
+8010549d:	39 d9                	cmp    %ebx,%ecx
+8010549f:	0f 46 d9             	cmovbe %ecx,%ebx
+801054a2:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+801054a5:	39 cb                	cmp    %ecx,%ebx
+801054a7:	0f 47 d9             	cmova  %ecx,%ebx
+      if(p->lread != p->lwrite && m > l->pos - p->nread)
+801054aa:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+801054ad:	39 ca                	cmp    %ecx,%edx
+801054af:	74 17                	je     801054c8 <piperead+0x1c8>
+801054b1:	8b 55 dc             	mov    -0x24(%ebp),%edx
+801054b4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+801054b7:	8d 14 52             	lea    (%edx,%edx,2),%edx
+801054ba:	8b 94 97 8c 00 00 00 	mov    0x8c(%edi,%edx,4),%edx
+801054c1:	29 ca                	sub    %ecx,%edx
+801054c3:	39 d3                	cmp    %edx,%ebx
+801054c5:	0f 47 da             	cmova  %edx,%ebx
+      memmove(addr+i, src, m);
+801054c8:	83 ec 04             	sub    $0x4,%esp
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+801054cb:	01 de                	add    %ebx,%esi
+      memmove(addr+i, src, m);
+801054cd:	53                   	push   %ebx
+801054ce:	50                   	push   %eax
+801054cf:	ff 75 e0             	push   -0x20(%ebp)
+801054d2:	e8 e9 21 00 00       	call   801076c0 <memmove>
+      p->rhead = (p->rhead + m) % p->size;
+801054d7:	8b 47 40             	mov    0x40(%edi),%eax
+801054da:	31 d2                	xor    %edx,%edx
+      p->rcount -= m;
+801054dc:	29 5f 44             	sub    %ebx,0x44(%edi)
+      p->nread += m;
+801054df:	01 5f 34             	add    %ebx,0x34(%edi)
+      continue;
+801054e2:	83 c4 10             	add    $0x10,%esp
+      p->rhead = (p->rhead + m) % p->size;
+801054e5:	01 d8                	add    %ebx,%eax
+801054e7:	f7 77 3c             	divl   0x3c(%edi)
+801054ea:	89 57 40             	mov    %edx,0x40(%edi)
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+801054ed:	39 75 10             	cmp    %esi,0x10(%ebp)
+801054f0:	0f 8f 1c ff ff ff    	jg     80105412 <piperead+0x112>
+        kfree(P2V(l->pa));
+      p->lread++;
+      freed = 1;
+    }
+  }
+  if(p->wwait && (freed || p->rcount <= LOWAT(p)))
+801054f6:	8b 97 00 01 00 00    	mov    0x100(%edi),%edx
+801054fc:	85 d2                	test   %edx,%edx
+801054fe:	74 12                	je     80105512 <piperead+0x212>
+80105500:	8b 45 c8             	mov    -0x38(%ebp),%eax
+80105503:	85 c0                	test   %eax,%eax
+80105505:	75 71                	jne    80105578 <piperead+0x278>
+80105507:	8b 47 3c             	mov    0x3c(%edi),%eax
+8010550a:	c1 e8 02             	shr    $0x2,%eax
+8010550d:	3b 47 44             	cmp    0x44(%edi),%eax
+80105510:	73 66                	jae    80105578 <piperead+0x278>
+    wakeup(&p->nwrite);  //DOC: piperead-wakeup
+  release(&p->lock);
+80105512:	83 ec 0c             	sub    $0xc,%esp
+80105515:	57                   	push   %edi
+80105516:	e8 d5 1f 00 00       	call   801074f0 <release>
+  return i;
+8010551b:	83 c4 10             	add    $0x10,%esp
+}
+8010551e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105521:	89 f0                	mov    %esi,%eax
+80105523:	5b                   	pop    %ebx
+80105524:	5e                   	pop    %esi
+80105525:	5f                   	pop    %edi
+80105526:	5d                   	pop    %ebp
+80105527:	c3                   	ret
+80105528:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010552f:	90                   	nop
+    *n = PIPEDATA - i;
+80105530:	bb fc 0e 00 00       	mov    $0xefc,%ebx
+80105535:	29 c3                	sub    %eax,%ebx
+    return p->data + i;
+80105537:	8d 84 07 04 01 00 00 	lea    0x104(%edi,%eax,1),%eax
+    *n = PIPEDATA - i;
+8010553e:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+    return p->data + i;
+80105541:	e9 51 ff ff ff       	jmp    80105497 <piperead+0x197>
+80105546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010554d:	8d 76 00             	lea    0x0(%esi),%esi
+      if(l->pa)
+80105550:	8b 80 90 00 00 00    	mov    0x90(%eax),%eax
+80105556:	85 c0                	test   %eax,%eax
+80105558:	0f 85 82 00 00 00    	jne    801055e0 <piperead+0x2e0>
+      p->lread++;
+8010555e:	83 87 ec 00 00 00 01 	addl   $0x1,0xec(%edi)
+      freed = 1;
+80105565:	c7 45 c8 01 00 00 00 	movl   $0x1,-0x38(%ebp)
+8010556c:	e9 96 fe ff ff       	jmp    80105407 <piperead+0x107>
+80105571:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    wakeup(&p->nwrite);  //DOC: piperead-wakeup
+80105578:	83 ec 0c             	sub    $0xc,%esp
+8010557b:	8d 47 38             	lea    0x38(%edi),%eax
+8010557e:	50                   	push   %eax
+8010557f:	e8 9c 17 00 00       	call   80106d20 <wakeup>
+80105584:	83 c4 10             	add    $0x10,%esp
+80105587:	eb 89                	jmp    80105512 <piperead+0x212>
+80105589:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105590:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+       maploan(myproc()->pgdir, addr+i, l->pa) == 0){
+80105593:	e8 e8 07 00 00       	call   80105d80 <myproc>
+80105598:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010559b:	83 ec 04             	sub    $0x4,%esp
+8010559e:	52                   	push   %edx
+8010559f:	ff 75 e0             	push   -0x20(%ebp)
+801055a2:	ff 70 04             	push   0x4(%eax)
+801055a5:	e8 56 55 00 00       	call   8010ab00 <maploan>
+    if(m == PGSIZE && (uint)(addr+i) % PGSIZE == 0 &&
+801055aa:	83 c4 10             	add    $0x10,%esp
+801055ad:	85 c0                	test   %eax,%eax
+      l->pa = 0;
+801055af:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    if(m == PGSIZE && (uint)(addr+i) % PGSIZE == 0 &&
+801055b2:	74 4c                	je     80105600 <piperead+0x300>
+      memmove(addr+i, (char*)P2V(l->pa) + l->off, m);
+801055b4:	8b 80 94 00 00 00    	mov    0x94(%eax),%eax
+801055ba:	e9 f4 fd ff ff       	jmp    801053b3 <piperead+0xb3>
+801055bf:	90                   	nop
+      release(&p->lock);
+801055c0:	83 ec 0c             	sub    $0xc,%esp
+      return -1;
+801055c3:	be ff ff ff ff       	mov    $0xffffffff,%esi
+      release(&p->lock);
+801055c8:	57                   	push   %edi
+801055c9:	e8 22 1f 00 00       	call   801074f0 <release>
+      return -1;
+801055ce:	83 c4 10             	add    $0x10,%esp
+}
+801055d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801055d4:	89 f0                	mov    %esi,%eax
+801055d6:	5b                   	pop    %ebx
+801055d7:	5e                   	pop    %esi
+801055d8:	5f                   	pop    %edi
+801055d9:	5d                   	pop    %ebp
+801055da:	c3                   	ret
+801055db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801055df:	90                   	nop
+        kfree(P2V(l->pa));
+801055e0:	83 ec 0c             	sub    $0xc,%esp
+801055e3:	05 00 00 00 80       	add    $0x80000000,%eax
+801055e8:	50                   	push   %eax
+801055e9:	e8 32 e1 ff ff       	call   80103720 <kfree>
+801055ee:	83 c4 10             	add    $0x10,%esp
+801055f1:	e9 68 ff ff ff       	jmp    8010555e <piperead+0x25e>
+801055f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801055fd:	8d 76 00             	lea    0x0(%esi),%esi
+      l->pa = 0;
+80105600:	c7 80 90 00 00 00 00 	movl   $0x0,0x90(%eax)
+80105607:	00 00 00 
+8010560a:	e9 ca fd ff ff       	jmp    801053d9 <piperead+0xd9>
+  if(p->wwait && (freed || p->rcount <= LOWAT(p)))
+8010560f:	8b b7 00 01 00 00    	mov    0x100(%edi),%esi
+80105615:	85 f6                	test   %esi,%esi
+80105617:	0f 84 f5 fe ff ff    	je     80105512 <piperead+0x212>
+8010561d:	31 f6                	xor    %esi,%esi
+8010561f:	e9 e3 fe ff ff       	jmp    80105507 <piperead+0x207>
+80105624:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010562b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010562f:	90                   	nop
+
+80105630 <pipesize>:
+// Make p's ring hold at least n bytes, or if n is 0 just
+// report its capacity. The ring can only change size while
+// it is empty. Returns the capacity, or -1.
+int
+pipesize(struct pipe *p, int n)
+{
+80105630:	55                   	push   %ebp
+80105631:	89 e5                	mov    %esp,%ebp
+80105633:	56                   	push   %esi
+80105634:	53                   	push   %ebx
+80105635:	8b 75 0c             	mov    0xc(%ebp),%esi
+80105638:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int npage, r;
+  char *pg;
+
+  if(n < 0)
+8010563b:	85 f6                	test   %esi,%esi
+8010563d:	0f 88 4a 01 00 00    	js     8010578d <pipesize+0x15d>
+    return -1;
+  acquire(&p->lock);
+80105643:	83 ec 0c             	sub    $0xc,%esp
+80105646:	53                   	push   %ebx
+80105647:	e8 04 1f 00 00       	call   80107550 <acquire>
+  r = 0;
+  if(n > 0){
+8010564c:	83 c4 10             	add    $0x10,%esp
+8010564f:	85 f6                	test   %esi,%esi
+80105651:	0f 84 c6 00 00 00    	je     8010571d <pipesize+0xed>
+    npage = n <= PIPEDATA ? 0 : (n - PIPEDATA + PGSIZE-1) / PGSIZE;
+80105657:	81 fe fc 0e 00 00    	cmp    $0xefc,%esi
+8010565d:	0f 8e d5 00 00 00    	jle    80105738 <pipesize+0x108>
+80105663:	8d 86 03 01 00 00    	lea    0x103(%esi),%eax
+80105669:	89 c6                	mov    %eax,%esi
+8010566b:	c1 ee 0c             	shr    $0xc,%esi
+    if(npage > PIPEMAXPG || p->rcount > 0){
+8010566e:	3d ff 0f 01 00       	cmp    $0x10fff,%eax
+80105673:	0f 87 08 01 00 00    	ja     80105781 <pipesize+0x151>
+80105679:	8b 43 44             	mov    0x44(%ebx),%eax
+8010567c:	85 c0                	test   %eax,%eax
+8010567e:	0f 85 fd 00 00 00    	jne    80105781 <pipesize+0x151>
+      release(&p->lock);
+      return -1;
+    }
+    while(p->npage > npage)
+80105684:	8b 43 48             	mov    0x48(%ebx),%eax
+80105687:	39 c6                	cmp    %eax,%esi
+80105689:	7d 21                	jge    801056ac <pipesize+0x7c>
+8010568b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010568f:	90                   	nop
+      kfree(p->page[--p->npage]);
+80105690:	8d 50 ff             	lea    -0x1(%eax),%edx
+80105693:	83 ec 0c             	sub    $0xc,%esp
+80105696:	89 53 48             	mov    %edx,0x48(%ebx)
+80105699:	ff 74 83 48          	push   0x48(%ebx,%eax,4)
+8010569d:	e8 7e e0 ff ff       	call   80103720 <kfree>
+    while(p->npage > npage)
+801056a2:	8b 43 48             	mov    0x48(%ebx),%eax
+801056a5:	83 c4 10             	add    $0x10,%esp
+801056a8:	39 f0                	cmp    %esi,%eax
+801056aa:	7f e4                	jg     80105690 <pipesize+0x60>
+    while(p->npage < npage){
+801056ac:	39 c6                	cmp    %eax,%esi
+801056ae:	7f 19                	jg     801056c9 <pipesize+0x99>
+801056b0:	e9 9c 00 00 00       	jmp    80105751 <pipesize+0x121>
+801056b5:	8d 76 00             	lea    0x0(%esi),%esi
+      if((pg = kalloc()) == 0){
+        r = -1;
+        break;
+      }
+      p->page[p->npage++] = pg;
+801056b8:	8b 4b 48             	mov    0x48(%ebx),%ecx
+801056bb:	8d 51 01             	lea    0x1(%ecx),%edx
+801056be:	89 53 48             	mov    %edx,0x48(%ebx)
+801056c1:	89 44 8b 4c          	mov    %eax,0x4c(%ebx,%ecx,4)
+    while(p->npage < npage){
+801056c5:	39 d6                	cmp    %edx,%esi
+801056c7:	7e 37                	jle    80105700 <pipesize+0xd0>
+      if((pg = kalloc()) == 0){
+801056c9:	e8 12 e3 ff ff       	call   801039e0 <kalloc>
+801056ce:	85 c0                	test   %eax,%eax
+801056d0:	75 e6                	jne    801056b8 <pipesize+0x88>
+    }
+    p->size = PIPEDATA + p->npage*PGSIZE;
+801056d2:	8b 43 48             	mov    0x48(%ebx),%eax
+    p->rhead = 0;
+    if(p->wwait)
+801056d5:	8b 8b 00 01 00 00    	mov    0x100(%ebx),%ecx
+    p->rhead = 0;
+801056db:	c7 43 40 00 00 00 00 	movl   $0x0,0x40(%ebx)
+    p->size = PIPEDATA + p->npage*PGSIZE;
+801056e2:	c1 e0 0c             	shl    $0xc,%eax
+801056e5:	05 fc 0e 00 00       	add    $0xefc,%eax
+801056ea:	89 43 3c             	mov    %eax,0x3c(%ebx)
+    if(p->wwait)
+801056ed:	85 c9                	test   %ecx,%ecx
+801056ef:	75 4f                	jne    80105740 <pipesize+0x110>
+    npage = n <= PIPEDATA ? 0 : (n - PIPEDATA + PGSIZE-1) / PGSIZE;
+801056f1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+801056f6:	eb 28                	jmp    80105720 <pipesize+0xf0>
+801056f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801056ff:	90                   	nop
+    p->size = PIPEDATA + p->npage*PGSIZE;
+80105700:	c1 e2 0c             	shl    $0xc,%edx
+    if(p->wwait)
+80105703:	8b 83 00 01 00 00    	mov    0x100(%ebx),%eax
+    p->rhead = 0;
+80105709:	c7 43 40 00 00 00 00 	movl   $0x0,0x40(%ebx)
+    p->size = PIPEDATA + p->npage*PGSIZE;
+80105710:	81 c2 fc 0e 00 00    	add    $0xefc,%edx
+80105716:	89 53 3c             	mov    %edx,0x3c(%ebx)
+    if(p->wwait)
+80105719:	85 c0                	test   %eax,%eax
+8010571b:	75 53                	jne    80105770 <pipesize+0x140>
+      wakeup(&p->nwrite);
+  }
+  if(r == 0)
+    r = p->size;
+8010571d:	8b 73 3c             	mov    0x3c(%ebx),%esi
+  release(&p->lock);
+80105720:	83 ec 0c             	sub    $0xc,%esp
+80105723:	53                   	push   %ebx
+80105724:	e8 c7 1d 00 00       	call   801074f0 <release>
+  return r;
+80105729:	83 c4 10             	add    $0x10,%esp
+}
+8010572c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010572f:	89 f0                	mov    %esi,%eax
+80105731:	5b                   	pop    %ebx
+80105732:	5e                   	pop    %esi
+80105733:	5d                   	pop    %ebp
+80105734:	c3                   	ret
+80105735:	8d 76 00             	lea    0x0(%esi),%esi
+    npage = n <= PIPEDATA ? 0 : (n - PIPEDATA + PGSIZE-1) / PGSIZE;
+80105738:	31 f6                	xor    %esi,%esi
+8010573a:	e9 3a ff ff ff       	jmp    80105679 <pipesize+0x49>
+8010573f:	90                   	nop
+      wakeup(&p->nwrite);
+80105740:	83 ec 0c             	sub    $0xc,%esp
+80105743:	8d 43 38             	lea    0x38(%ebx),%eax
+80105746:	50                   	push   %eax
+80105747:	e8 d4 15 00 00       	call   80106d20 <wakeup>
+8010574c:	83 c4 10             	add    $0x10,%esp
+8010574f:	eb a0                	jmp    801056f1 <pipesize+0xc1>
+    p->size = PIPEDATA + p->npage*PGSIZE;
+80105751:	c1 e0 0c             	shl    $0xc,%eax
+    if(p->wwait)
+80105754:	8b 93 00 01 00 00    	mov    0x100(%ebx),%edx
+    p->rhead = 0;
+8010575a:	c7 43 40 00 00 00 00 	movl   $0x0,0x40(%ebx)
+    p->size = PIPEDATA + p->npage*PGSIZE;
+80105761:	8d b0 fc 0e 00 00    	lea    0xefc(%eax),%esi
+80105767:	89 73 3c             	mov    %esi,0x3c(%ebx)
+    if(p->wwait)
+8010576a:	85 d2                	test   %edx,%edx
+8010576c:	74 b2                	je     80105720 <pipesize+0xf0>
+8010576e:	66 90                	xchg   %ax,%ax
+      wakeup(&p->nwrite);
+80105770:	83 ec 0c             	sub    $0xc,%esp
+80105773:	8d 43 38             	lea    0x38(%ebx),%eax
+80105776:	50                   	push   %eax
+80105777:	e8 a4 15 00 00       	call   80106d20 <wakeup>
+8010577c:	83 c4 10             	add    $0x10,%esp
+8010577f:	eb 9c                	jmp    8010571d <pipesize+0xed>
+      release(&p->lock);
+80105781:	83 ec 0c             	sub    $0xc,%esp
+80105784:	53                   	push   %ebx
+80105785:	e8 66 1d 00 00       	call   801074f0 <release>
+      return -1;
+8010578a:	83 c4 10             	add    $0x10,%esp
+    return -1;
+8010578d:	be ff ff ff ff       	mov    $0xffffffff,%esi
+80105792:	eb 98                	jmp    8010572c <pipesize+0xfc>
+80105794:	66 90                	xchg   %ax,%ax
+80105796:	66 90                	xchg   %ax,%ax
+80105798:	66 90                	xchg   %ax,%ax
+8010579a:	66 90                	xchg   %ax,%ax
+8010579c:	66 90                	xchg   %ax,%ax
+8010579e:	66 90                	xchg   %ax,%ax
+
+801057a0 <rqremove>:
+}
+
+// Unlink p from rq.
+static void
+rqremove(struct runq *rq, struct proc *p)
+{
+801057a0:	55                   	push   %ebp
+801057a1:	89 e5                	mov    %esp,%ebp
+801057a3:	57                   	push   %edi
+801057a4:	56                   	push   %esi
+801057a5:	53                   	push   %ebx
+801057a6:	89 c3                	mov    %eax,%ebx
+  return p->eff_priority;
+801057a8:	8b 8a a0 00 00 00    	mov    0xa0(%edx),%ecx
+{
+801057ae:	89 d0                	mov    %edx,%eax
+  int lvl = rqlevel(p);
+
+  if(p->rqprev)
+801057b0:	8b 92 e4 00 00 00    	mov    0xe4(%edx),%edx
+    p->rqprev->rqnext = p->rqnext;
+801057b6:	8b b8 e0 00 00 00    	mov    0xe0(%eax),%edi
+  if(p->rqprev)
+801057bc:	85 d2                	test   %edx,%edx
+801057be:	74 48                	je     80105808 <rqremove+0x68>
+    p->rqprev->rqnext = p->rqnext;
+801057c0:	89 ba e0 00 00 00    	mov    %edi,0xe0(%edx)
+  else
+    rq->head[lvl] = p->rqnext;
+  if(p->rqnext)
+801057c6:	8b 90 e0 00 00 00    	mov    0xe0(%eax),%edx
+801057cc:	8d 71 0c             	lea    0xc(%ecx),%esi
+    p->rqnext->rqprev = p->rqprev;
+801057cf:	8b b8 e4 00 00 00    	mov    0xe4(%eax),%edi
+  if(p->rqnext)
+801057d5:	85 d2                	test   %edx,%edx
+801057d7:	74 46                	je     8010581f <rqremove+0x7f>
+    p->rqnext->rqprev = p->rqprev;
+801057d9:	89 ba e4 00 00 00    	mov    %edi,0xe4(%edx)
+  else
+    rq->tail[lvl] = p->rqprev;
+  if(rq->head[lvl] == 0)
+801057df:	8b 54 b3 04          	mov    0x4(%ebx,%esi,4),%edx
+801057e3:	85 d2                	test   %edx,%edx
+801057e5:	74 44                	je     8010582b <rqremove+0x8b>
+    rq->bitmap &= ~(1 << lvl);
+  p->rqnext = p->rqprev = 0;
+801057e7:	c7 80 e4 00 00 00 00 	movl   $0x0,0xe4(%eax)
+801057ee:	00 00 00 
+801057f1:	c7 80 e0 00 00 00 00 	movl   $0x0,0xe0(%eax)
+801057f8:	00 00 00 
+  rq->nrunnable--;
+801057fb:	83 6b 60 01          	subl   $0x1,0x60(%ebx)
+}
+801057ff:	5b                   	pop    %ebx
+80105800:	5e                   	pop    %esi
+80105801:	5f                   	pop    %edi
+80105802:	5d                   	pop    %ebp
+80105803:	c3                   	ret
+80105804:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    rq->head[lvl] = p->rqnext;
+80105808:	8d 71 0c             	lea    0xc(%ecx),%esi
+8010580b:	89 7c b3 04          	mov    %edi,0x4(%ebx,%esi,4)
+  if(p->rqnext)
+8010580f:	8b 90 e0 00 00 00    	mov    0xe0(%eax),%edx
+    p->rqnext->rqprev = p->rqprev;
+80105815:	8b b8 e4 00 00 00    	mov    0xe4(%eax),%edi
+  if(p->rqnext)
+8010581b:	85 d2                	test   %edx,%edx
+8010581d:	75 ba                	jne    801057d9 <rqremove+0x39>
+    rq->tail[lvl] = p->rqprev;
+8010581f:	89 7c 8b 48          	mov    %edi,0x48(%ebx,%ecx,4)
+  if(rq->head[lvl] == 0)
+80105823:	8b 54 b3 04          	mov    0x4(%ebx,%esi,4),%edx
+80105827:	85 d2                	test   %edx,%edx
+80105829:	75 bc                	jne    801057e7 <rqremove+0x47>
+    rq->bitmap &= ~(1 << lvl);
+8010582b:	ba fe ff ff ff       	mov    $0xfffffffe,%edx
+80105830:	d3 c2                	rol    %cl,%edx
+80105832:	21 53 5c             	and    %edx,0x5c(%ebx)
+80105835:	eb b0                	jmp    801057e7 <rqremove+0x47>
+80105837:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010583e:	66 90                	xchg   %ax,%ax
+
+80105840 <allocproc>:
+}
+
+//PAGEBREAK: 32
+static struct proc*
+allocproc(void)
+{
+80105840:	55                   	push   %ebp
+80105841:	89 e5                	mov    %esp,%ebp
+80105843:	53                   	push   %ebx
+  struct proc *p;
+  char *sp;
+
+  acquire(&ptable.lock);
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80105844:	bb 74 d8 90 80       	mov    $0x8090d874,%ebx
+{
+80105849:	83 ec 10             	sub    $0x10,%esp
+  acquire(&ptable.lock);
+8010584c:	68 40 d8 90 80       	push   $0x8090d840
+80105851:	e8 fa 1c 00 00       	call   80107550 <acquire>
+80105856:	83 c4 10             	add    $0x10,%esp
+80105859:	eb 17                	jmp    80105872 <allocproc+0x32>
+8010585b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010585f:	90                   	nop
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
+80105860:	81 c3 10 01 00 00    	add    $0x110,%ebx
+80105866:	81 fb 74 1c 91 80    	cmp    $0x80911c74,%ebx
+8010586c:	0f 84 ad 01 00 00    	je     80105a1f <allocproc+0x1df>
+    if(p->state == UNUSED)
+80105872:	8b 43 0c             	mov    0xc(%ebx),%eax
+80105875:	85 c0                	test   %eax,%eax
+80105877:	75 e7                	jne    80105860 <allocproc+0x20>
+  release(&ptable.lock);
+  return 0;
+
+found:
+  p->state = EMBRYO;
+  p->pid = nextpid++;
+80105879:	a1 04 e0 10 80       	mov    0x8010e004,%eax
+  p->state = EMBRYO;
+8010587e:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%ebx)
+  pidhash(p);
+  release(&ptable.lock);
+80105885:	83 ec 0c             	sub    $0xc,%esp
+  p->pid = nextpid++;
+80105888:	8d 50 01             	lea    0x1(%eax),%edx
+8010588b:	89 43 10             	mov    %eax,0x10(%ebx)
+8010588e:	89 15 04 e0 10 80    	mov    %edx,0x8010e004
+  struct proc **pp = &ptable.pidhash[PIDHASH(p->pid)];
+80105894:	99                   	cltd
+80105895:	c1 ea 1a             	shr    $0x1a,%edx
+80105898:	01 d0                	add    %edx,%eax
+8010589a:	83 e0 3f             	and    $0x3f,%eax
+8010589d:	29 d0                	sub    %edx,%eax
+  p->pidnext = *pp;
+8010589f:	05 4c 11 00 00       	add    $0x114c,%eax
+801058a4:	8b 14 85 44 d8 90 80 	mov    -0x7f6f27bc(,%eax,4),%edx
+801058ab:	89 53 3c             	mov    %edx,0x3c(%ebx)
+  *pp = p;
+801058ae:	89 1c 85 44 d8 90 80 	mov    %ebx,-0x7f6f27bc(,%eax,4)
+  release(&ptable.lock);
+801058b5:	68 40 d8 90 80       	push   $0x8090d840
+801058ba:	e8 31 1c 00 00       	call   801074f0 <release>
+
+  // Allocate kernel stack.
+  if((p->kstack = kalloc()) == 0){
+801058bf:	e8 1c e1 ff ff       	call   801039e0 <kalloc>
+801058c4:	83 c4 10             	add    $0x10,%esp
+801058c7:	89 43 08             	mov    %eax,0x8(%ebx)
+801058ca:	85 c0                	test   %eax,%eax
+801058cc:	0f 84 f7 00 00 00    	je     801059c9 <allocproc+0x189>
+    return 0;
+  }
+  sp = p->kstack + KSTACKSIZE;
+
+  // Leave room for trap frame.
+  sp -= sizeof *p->tf;
+801058d2:	8d 90 b4 0f 00 00    	lea    0xfb4(%eax),%edx
+  sp -= 4;
+  *(uint*)sp = (uint)trapret;
+
+  sp -= sizeof *p->context;
+  p->context = (struct context*)sp;
+  memset(p->context, 0, sizeof *p->context);
+801058d8:	83 ec 04             	sub    $0x4,%esp
+  sp -= sizeof *p->context;
+801058db:	05 9c 0f 00 00       	add    $0xf9c,%eax
+  sp -= sizeof *p->tf;
+801058e0:	89 53 28             	mov    %edx,0x28(%ebx)
+  *(uint*)sp = (uint)trapret;
+801058e3:	c7 40 14 f6 8e 10 80 	movl   $0x80108ef6,0x14(%eax)
+  p->context = (struct context*)sp;
+801058ea:	89 43 2c             	mov    %eax,0x2c(%ebx)
+  memset(p->context, 0, sizeof *p->context);
+801058ed:	6a 14                	push   $0x14
+801058ef:	6a 00                	push   $0x0
+801058f1:	50                   	push   %eax
+801058f2:	e8 39 1d 00 00       	call   80107630 <memset>
+  p->context->eip = (uint)forkret;
+801058f7:	8b 43 2c             	mov    0x2c(%ebx),%eax
+
+  p->tprev = 0;
+  p->runticks = p->waitticks = p->maxwait = 0;
+  p->nswitch = p->nboost = 0;
+
+  return p;
+801058fa:	83 c4 10             	add    $0x10,%esp
+  p->context->eip = (uint)forkret;
+801058fd:	c7 40 10 10 5d 10 80 	movl   $0x80105d10,0x10(%eax)
+}
+80105904:	89 d8                	mov    %ebx,%eax
+  p->nice          = 2;
+80105906:	c7 83 98 00 00 00 02 	movl   $0x2,0x98(%ebx)
+8010590d:	00 00 00 
+  p->base_priority = 2;
+80105910:	c7 83 9c 00 00 00 02 	movl   $0x2,0x9c(%ebx)
+80105917:	00 00 00 
+  p->eff_priority  = 2;
+8010591a:	c7 83 a0 00 00 00 02 	movl   $0x2,0xa0(%ebx)
+80105921:	00 00 00 
+  p->agestart      = 0;   // EXTRA CREDIT: aging clock
+80105924:	c7 83 a4 00 00 00 00 	movl   $0x0,0xa4(%ebx)
+8010592b:	00 00 00 
+  p->slice         = 0;
+8010592e:	c7 83 a8 00 00 00 00 	movl   $0x0,0xa8(%ebx)
+80105935:	00 00 00 
+  p->boosted       = -1;
+80105938:	c7 83 ac 00 00 00 ff 	movl   $0xffffffff,0xac(%ebx)
+8010593f:	ff ff ff 
+  p->vruntime      = 0;
+80105942:	c7 83 b0 00 00 00 00 	movl   $0x0,0xb0(%ebx)
+80105949:	00 00 00 
+8010594c:	c7 83 b4 00 00 00 00 	movl   $0x0,0xb4(%ebx)
+80105953:	00 00 00 
+  p->tickets       = DEFTICKETS;
+80105956:	c7 83 c4 00 00 00 00 	movl   $0x400,0xc4(%ebx)
+8010595d:	04 00 00 
+  p->borrowed      = 0;
+80105960:	c7 83 c8 00 00 00 00 	movl   $0x0,0xc8(%ebx)
+80105967:	00 00 00 
+  p->lendto        = 0;
+8010596a:	c7 83 cc 00 00 00 00 	movl   $0x0,0xcc(%ebx)
+80105971:	00 00 00 
+  p->lendpid       = 0;
+80105974:	c7 83 d0 00 00 00 00 	movl   $0x0,0xd0(%ebx)
+8010597b:	00 00 00 
+  p->lending       = 0;
+8010597e:	c7 83 d4 00 00 00 00 	movl   $0x0,0xd4(%ebx)
+80105985:	00 00 00 
+  p->tprev = 0;
+80105988:	c7 83 f4 00 00 00 00 	movl   $0x0,0xf4(%ebx)
+8010598f:	00 00 00 
+  p->runticks = p->waitticks = p->maxwait = 0;
+80105992:	c7 83 04 01 00 00 00 	movl   $0x0,0x104(%ebx)
+80105999:	00 00 00 
+8010599c:	c7 83 00 01 00 00 00 	movl   $0x0,0x100(%ebx)
+801059a3:	00 00 00 
+801059a6:	c7 83 fc 00 00 00 00 	movl   $0x0,0xfc(%ebx)
+801059ad:	00 00 00 
+  p->nswitch = p->nboost = 0;
+801059b0:	c7 83 0c 01 00 00 00 	movl   $0x0,0x10c(%ebx)
+801059b7:	00 00 00 
+801059ba:	c7 83 08 01 00 00 00 	movl   $0x0,0x108(%ebx)
+801059c1:	00 00 00 
+}
+801059c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801059c7:	c9                   	leave
+801059c8:	c3                   	ret
+    acquire(&ptable.lock);
+801059c9:	83 ec 0c             	sub    $0xc,%esp
+801059cc:	68 40 d8 90 80       	push   $0x8090d840
+801059d1:	e8 7a 1b 00 00       	call   80107550 <acquire>
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+801059d6:	8b 43 10             	mov    0x10(%ebx),%eax
+801059d9:	83 c4 10             	add    $0x10,%esp
+801059dc:	89 c1                	mov    %eax,%ecx
+801059de:	c1 f9 1f             	sar    $0x1f,%ecx
+801059e1:	c1 e9 1a             	shr    $0x1a,%ecx
+801059e4:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+801059e7:	83 e2 3f             	and    $0x3f,%edx
+801059ea:	29 ca                	sub    %ecx,%edx
+801059ec:	8b 04 95 74 1d 91 80 	mov    -0x7f6ee28c(,%edx,4),%eax
+801059f3:	39 c3                	cmp    %eax,%ebx
+801059f5:	74 41                	je     80105a38 <allocproc+0x1f8>
+801059f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801059fe:	66 90                	xchg   %ax,%ax
+80105a00:	89 c2                	mov    %eax,%edx
+80105a02:	8b 40 3c             	mov    0x3c(%eax),%eax
+80105a05:	39 c3                	cmp    %eax,%ebx
+80105a07:	75 f7                	jne    80105a00 <allocproc+0x1c0>
+80105a09:	83 c2 3c             	add    $0x3c,%edx
+  *pp = p->pidnext;
+80105a0c:	8b 43 3c             	mov    0x3c(%ebx),%eax
+80105a0f:	89 02                	mov    %eax,(%edx)
+  p->pid = 0;
+80105a11:	c7 43 10 00 00 00 00 	movl   $0x0,0x10(%ebx)
+  p->state = UNUSED;
+80105a18:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    release(&ptable.lock);
+80105a1f:	83 ec 0c             	sub    $0xc,%esp
+  return 0;
+80105a22:	31 db                	xor    %ebx,%ebx
+    release(&ptable.lock);
+80105a24:	68 40 d8 90 80       	push   $0x8090d840
+80105a29:	e8 c2 1a 00 00       	call   801074f0 <release>
+}
+80105a2e:	89 d8                	mov    %ebx,%eax
+    return 0;
+80105a30:	83 c4 10             	add    $0x10,%esp
+}
+80105a33:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105a36:	c9                   	leave
+80105a37:	c3                   	ret
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+80105a38:	8d 14 95 74 1d 91 80 	lea    -0x7f6ee28c(,%edx,4),%edx
+80105a3f:	eb cb                	jmp    80105a0c <allocproc+0x1cc>
+80105a41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105a48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105a4f:	90                   	nop
+
+80105a50 <pinit>:
+{
+80105a50:	55                   	push   %ebp
+80105a51:	89 e5                	mov    %esp,%ebp
+80105a53:	53                   	push   %ebx
+80105a54:	bb c0 d4 90 80       	mov    $0x8090d4c0,%ebx
+80105a59:	83 ec 0c             	sub    $0xc,%esp
+  initlock(&ptable.lock, "ptable");
+80105a5c:	68 58 b4 10 80       	push   $0x8010b458
+80105a61:	68 40 d8 90 80       	push   $0x8090d840
+80105a66:	e8 05 19 00 00       	call   80107370 <initlock>
+  for(i = 0; i < NCPU; i++)
+80105a6b:	83 c4 10             	add    $0x10,%esp
+80105a6e:	66 90                	xchg   %ax,%ax
+    initlock(&runq[i].lock, "runq");
+80105a70:	83 ec 08             	sub    $0x8,%esp
+80105a73:	68 5f b4 10 80       	push   $0x8010b45f
+80105a78:	53                   	push   %ebx
+  for(i = 0; i < NCPU; i++)
+80105a79:	83 c3 70             	add    $0x70,%ebx
+    initlock(&runq[i].lock, "runq");
+80105a7c:	e8 ef 18 00 00       	call   80107370 <initlock>
+  for(i = 0; i < NCPU; i++)
+80105a81:	83 c4 10             	add    $0x10,%esp
+80105a84:	81 fb 40 d8 90 80    	cmp    $0x8090d840,%ebx
+80105a8a:	75 e4                	jne    80105a70 <pinit+0x20>
+}
+80105a8c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105a8f:	c9                   	leave
+80105a90:	c3                   	ret
+80105a91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105a98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105a9f:	90                   	nop
+
+80105aa0 <mycpu>:
+{
+80105aa0:	55                   	push   %ebp
+80105aa1:	89 e5                	mov    %esp,%ebp
+80105aa3:	56                   	push   %esi
+80105aa4:	53                   	push   %ebx
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80105aa5:	9c                   	pushf
+80105aa6:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80105aa7:	f6 c4 02             	test   $0x2,%ah
+80105aaa:	75 46                	jne    80105af2 <mycpu+0x52>
+  apicid = lapicid();
+80105aac:	e8 7f e5 ff ff       	call   80104030 <lapicid>
+  for (i = 0; i < ncpu; ++i) {
+80105ab1:	8b 35 04 cf 90 80    	mov    0x8090cf04,%esi
+80105ab7:	85 f6                	test   %esi,%esi
+80105ab9:	7e 2a                	jle    80105ae5 <mycpu+0x45>
+80105abb:	31 d2                	xor    %edx,%edx
+80105abd:	eb 08                	jmp    80105ac7 <mycpu+0x27>
+80105abf:	90                   	nop
+80105ac0:	83 c2 01             	add    $0x1,%edx
+80105ac3:	39 f2                	cmp    %esi,%edx
+80105ac5:	74 1e                	je     80105ae5 <mycpu+0x45>
+    if (cpus[i].apicid == apicid)
+80105ac7:	69 ca b4 00 00 00    	imul   $0xb4,%edx,%ecx
+80105acd:	0f b6 99 20 cf 90 80 	movzbl -0x7f6f30e0(%ecx),%ebx
+80105ad4:	39 c3                	cmp    %eax,%ebx
+80105ad6:	75 e8                	jne    80105ac0 <mycpu+0x20>
+}
+80105ad8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return &cpus[i];
+80105adb:	8d 81 20 cf 90 80    	lea    -0x7f6f30e0(%ecx),%eax
+}
+80105ae1:	5b                   	pop    %ebx
+80105ae2:	5e                   	pop    %esi
+80105ae3:	5d                   	pop    %ebp
+80105ae4:	c3                   	ret
+  panic("unknown apicid\n");
+80105ae5:	83 ec 0c             	sub    $0xc,%esp
+80105ae8:	68 64 b4 10 80       	push   $0x8010b464
+80105aed:	e8 8e ad ff ff       	call   80100880 <panic>
+    panic("mycpu called with interrupts enabled\n");
+80105af2:	83 ec 0c             	sub    $0xc,%esp
+80105af5:	68 58 b5 10 80       	push   $0x8010b558
+80105afa:	e8 81 ad ff ff       	call   80100880 <panic>
+80105aff:	90                   	nop
+
+80105b00 <cpuid>:
+cpuid() {
+80105b00:	55                   	push   %ebp
+80105b01:	89 e5                	mov    %esp,%ebp
+80105b03:	83 ec 08             	sub    $0x8,%esp
+  return mycpu()-cpus;
+80105b06:	e8 95 ff ff ff       	call   80105aa0 <mycpu>
+}
+80105b0b:	c9                   	leave
+  return mycpu()-cpus;
+80105b0c:	2d 20 cf 90 80       	sub    $0x8090cf20,%eax
+80105b11:	c1 f8 02             	sar    $0x2,%eax
+80105b14:	69 c0 a5 4f fa a4    	imul   $0xa4fa4fa5,%eax,%eax
+}
+80105b1a:	c3                   	ret
+80105b1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105b1f:	90                   	nop
+
+80105b20 <setrunnable>:
+{
+80105b20:	55                   	push   %ebp
+80105b21:	89 e5                	mov    %esp,%ebp
+80105b23:	57                   	push   %edi
+80105b24:	56                   	push   %esi
+80105b25:	53                   	push   %ebx
+80105b26:	83 ec 0c             	sub    $0xc,%esp
+  p->readyat = ticks;
+80105b29:	8b 0d a0 22 91 80    	mov    0x809122a0,%ecx
+  p->state = RUNNABLE;
+80105b2f:	c7 42 0c 03 00 00 00 	movl   $0x3,0xc(%edx)
+  p->readyat = ticks;
+80105b36:	89 8a f8 00 00 00    	mov    %ecx,0xf8(%edx)
+  p->agestart = rq->passes;       // start aging from zero
+80105b3c:	8b 48 64             	mov    0x64(%eax),%ecx
+  p->rqnext = 0;
+80105b3f:	c7 82 e0 00 00 00 00 	movl   $0x0,0xe0(%edx)
+80105b46:	00 00 00 
+  p->agestart = rq->passes;       // start aging from zero
+80105b49:	89 8a a4 00 00 00    	mov    %ecx,0xa4(%edx)
+  return p->eff_priority;
+80105b4f:	8b 8a a0 00 00 00    	mov    0xa0(%edx),%ecx
+  p->rqprev = rq->tail[lvl];
+80105b55:	8d 71 10             	lea    0x10(%ecx),%esi
+80105b58:	8b 5c b0 08          	mov    0x8(%eax,%esi,4),%ebx
+80105b5c:	89 9a e4 00 00 00    	mov    %ebx,0xe4(%edx)
+  if(rq->tail[lvl])
+80105b62:	85 db                	test   %ebx,%ebx
+80105b64:	0f 84 a6 00 00 00    	je     80105c10 <setrunnable+0xf0>
+    rq->tail[lvl]->rqnext = p;
+80105b6a:	89 93 e0 00 00 00    	mov    %edx,0xe0(%ebx)
+  rq->tail[lvl] = p;
+80105b70:	89 54 b0 08          	mov    %edx,0x8(%eax,%esi,4)
+  rq->bitmap |= 1 << lvl;
+80105b74:	ba 01 00 00 00       	mov    $0x1,%edx
+80105b79:	d3 e2                	shl    %cl,%edx
+  rq->nrunnable++;
+80105b7b:	8b 48 60             	mov    0x60(%eax),%ecx
+  rq->bitmap |= 1 << lvl;
+80105b7e:	09 50 5c             	or     %edx,0x5c(%eax)
+  rq->nrunnable++;
+80105b81:	8d 51 01             	lea    0x1(%ecx),%edx
+80105b84:	89 50 60             	mov    %edx,0x60(%eax)
+  c = &cpus[rq - runq];
+80105b87:	2d c0 d4 90 80       	sub    $0x8090d4c0,%eax
+80105b8c:	c1 f8 04             	sar    $0x4,%eax
+  if(c->idle){
+80105b8f:	69 f0 ac 24 49 92    	imul   $0x924924ac,%eax,%esi
+80105b95:	8b 9e d0 cf 90 80    	mov    -0x7f6f3030(%esi),%ebx
+80105b9b:	8d be 20 cf 90 80    	lea    -0x7f6f30e0(%esi),%edi
+80105ba1:	85 db                	test   %ebx,%ebx
+80105ba3:	75 7b                	jne    80105c20 <setrunnable+0x100>
+  if(rq->nrunnable < 2)
+80105ba5:	83 fa 01             	cmp    $0x1,%edx
+80105ba8:	7e 55                	jle    80105bff <setrunnable+0xdf>
+  for(i = 0; i < ncpu; i++){
+80105baa:	a1 04 cf 90 80       	mov    0x8090cf04,%eax
+80105baf:	85 c0                	test   %eax,%eax
+80105bb1:	7e 4c                	jle    80105bff <setrunnable+0xdf>
+80105bb3:	be 20 cf 90 80       	mov    $0x8090cf20,%esi
+80105bb8:	eb 17                	jmp    80105bd1 <setrunnable+0xb1>
+80105bba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80105bc0:	83 c3 01             	add    $0x1,%ebx
+80105bc3:	81 c6 b4 00 00 00    	add    $0xb4,%esi
+80105bc9:	3b 1d 04 cf 90 80    	cmp    0x8090cf04,%ebx
+80105bcf:	7d 2e                	jge    80105bff <setrunnable+0xdf>
+    if(cpus[i].idle && &cpus[i] != mycpu()){
+80105bd1:	69 fb b4 00 00 00    	imul   $0xb4,%ebx,%edi
+80105bd7:	8b 87 d0 cf 90 80    	mov    -0x7f6f3030(%edi),%eax
+80105bdd:	85 c0                	test   %eax,%eax
+80105bdf:	74 df                	je     80105bc0 <setrunnable+0xa0>
+80105be1:	e8 ba fe ff ff       	call   80105aa0 <mycpu>
+80105be6:	39 f0                	cmp    %esi,%eax
+80105be8:	74 d6                	je     80105bc0 <setrunnable+0xa0>
+      lapicipi(cpus[i].apicid, T_IRQ0 + IRQ_WAKEUP);
+80105bea:	83 ec 08             	sub    $0x8,%esp
+80105bed:	6a 3e                	push   $0x3e
+80105bef:	0f b6 87 20 cf 90 80 	movzbl -0x7f6f30e0(%edi),%eax
+80105bf6:	50                   	push   %eax
+80105bf7:	e8 24 e1 ff ff       	call   80103d20 <lapicipi>
+      return;
+80105bfc:	83 c4 10             	add    $0x10,%esp
+}
+80105bff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105c02:	5b                   	pop    %ebx
+80105c03:	5e                   	pop    %esi
+80105c04:	5f                   	pop    %edi
+80105c05:	5d                   	pop    %ebp
+80105c06:	c3                   	ret
+80105c07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105c0e:	66 90                	xchg   %ax,%ax
+    rq->head[lvl] = p;
+80105c10:	89 54 88 34          	mov    %edx,0x34(%eax,%ecx,4)
+80105c14:	e9 57 ff ff ff       	jmp    80105b70 <setrunnable+0x50>
+80105c19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(c != mycpu())
+80105c20:	e8 7b fe ff ff       	call   80105aa0 <mycpu>
+80105c25:	39 c7                	cmp    %eax,%edi
+80105c27:	74 d6                	je     80105bff <setrunnable+0xdf>
+      lapicipi(c->apicid, T_IRQ0 + IRQ_WAKEUP);
+80105c29:	83 ec 08             	sub    $0x8,%esp
+80105c2c:	6a 3e                	push   $0x3e
+80105c2e:	0f b6 86 20 cf 90 80 	movzbl -0x7f6f30e0(%esi),%eax
+80105c35:	50                   	push   %eax
+80105c36:	e8 e5 e0 ff ff       	call   80103d20 <lapicipi>
+80105c3b:	83 c4 10             	add    $0x10,%esp
+}
+80105c3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105c41:	5b                   	pop    %ebx
+80105c42:	5e                   	pop    %esi
+80105c43:	5f                   	pop    %edi
+80105c44:	5d                   	pop    %ebp
+80105c45:	c3                   	ret
+80105c46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105c4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80105c50 <wake1>:
+}
+
+// Wake p, which is SLEEPING. Caller holds ptable.lock.
+static void
+wake1(struct proc *p)
+{
+80105c50:	55                   	push   %ebp
+80105c51:	89 e5                	mov    %esp,%ebp
+80105c53:	57                   	push   %edi
+80105c54:	89 c7                	mov    %eax,%edi
+80105c56:	56                   	push   %esi
+80105c57:	53                   	push   %ebx
+80105c58:	83 ec 0c             	sub    $0xc,%esp
+  struct runq *rq;
+
+  *p->sprev = p->snext;
+80105c5b:	8b 50 38             	mov    0x38(%eax),%edx
+80105c5e:	8b 40 34             	mov    0x34(%eax),%eax
+80105c61:	89 02                	mov    %eax,(%edx)
+  if(p->snext)
+80105c63:	85 c0                	test   %eax,%eax
+80105c65:	74 06                	je     80105c6d <wake1+0x1d>
+    p->snext->sprev = p->sprev;
+80105c67:	8b 57 38             	mov    0x38(%edi),%edx
+80105c6a:	89 50 38             	mov    %edx,0x38(%eax)
+  p->chan = 0;
+80105c6d:	c7 47 30 00 00 00 00 	movl   $0x0,0x30(%edi)
+lockrq(struct proc *p)
+80105c74:	eb 16                	jmp    80105c8c <wake1+0x3c>
+80105c76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105c7d:	8d 76 00             	lea    0x0(%esi),%esi
+    release(&rq->lock);
+80105c80:	83 ec 0c             	sub    $0xc,%esp
+80105c83:	53                   	push   %ebx
+80105c84:	e8 67 18 00 00       	call   801074f0 <release>
+    rq = &runq[p->cpu];
+80105c89:	83 c4 10             	add    $0x10,%esp
+80105c8c:	6b b7 d8 00 00 00 70 	imul   $0x70,0xd8(%edi),%esi
+    acquire(&rq->lock);
+80105c93:	83 ec 0c             	sub    $0xc,%esp
+    rq = &runq[p->cpu];
+80105c96:	8d 9e c0 d4 90 80    	lea    -0x7f6f2b40(%esi),%ebx
+    acquire(&rq->lock);
+80105c9c:	53                   	push   %ebx
+80105c9d:	e8 ae 18 00 00       	call   80107550 <acquire>
+    if(rq == &runq[p->cpu])
+80105ca2:	6b 87 d8 00 00 00 70 	imul   $0x70,0xd8(%edi),%eax
+80105ca9:	83 c4 10             	add    $0x10,%esp
+80105cac:	39 c6                	cmp    %eax,%esi
+80105cae:	75 d0                	jne    80105c80 <wake1+0x30>
+  unlend(p);
+  rq = lockrq(p);
+  setrunnable(rq, p);
+80105cb0:	89 fa                	mov    %edi,%edx
+80105cb2:	89 d8                	mov    %ebx,%eax
+80105cb4:	e8 67 fe ff ff       	call   80105b20 <setrunnable>
+  release(&rq->lock);
+80105cb9:	83 ec 0c             	sub    $0xc,%esp
+80105cbc:	53                   	push   %ebx
+80105cbd:	e8 2e 18 00 00       	call   801074f0 <release>
+}
+80105cc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105cc5:	5b                   	pop    %ebx
+80105cc6:	5e                   	pop    %esi
+80105cc7:	5f                   	pop    %edi
+80105cc8:	5d                   	pop    %ebp
+80105cc9:	c3                   	ret
+80105cca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80105cd0 <wakeup1>:
+}
+
+// The ptable lock must be held.
+static void
+wakeup1(void *chan)
+{
+80105cd0:	55                   	push   %ebp
+80105cd1:	89 e5                	mov    %esp,%ebp
+80105cd3:	56                   	push   %esi
+80105cd4:	89 c6                	mov    %eax,%esi
+  struct proc *p, *next;
+
+  for(p = ptable.sleepq[SQHASH(chan)]; p; p = next){
+80105cd6:	69 c0 b1 79 37 9e    	imul   $0x9e3779b1,%eax,%eax
+{
+80105cdc:	53                   	push   %ebx
+  for(p = ptable.sleepq[SQHASH(chan)]; p; p = next){
+80105cdd:	c1 e8 1a             	shr    $0x1a,%eax
+80105ce0:	8b 1c 85 74 1c 91 80 	mov    -0x7f6ee38c(,%eax,4),%ebx
+80105ce7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105cee:	66 90                	xchg   %ax,%ax
+80105cf0:	85 db                	test   %ebx,%ebx
+80105cf2:	74 13                	je     80105d07 <wakeup1+0x37>
+    next = p->snext;
+80105cf4:	89 d8                	mov    %ebx,%eax
+80105cf6:	8b 5b 34             	mov    0x34(%ebx),%ebx
+    if(p->chan == chan)
+80105cf9:	39 70 30             	cmp    %esi,0x30(%eax)
+80105cfc:	75 f2                	jne    80105cf0 <wakeup1+0x20>
+      wake1(p);
+80105cfe:	e8 4d ff ff ff       	call   80105c50 <wake1>
+  for(p = ptable.sleepq[SQHASH(chan)]; p; p = next){
+80105d03:	85 db                	test   %ebx,%ebx
+80105d05:	75 ed                	jne    80105cf4 <wakeup1+0x24>
+  }
+}
+80105d07:	5b                   	pop    %ebx
+80105d08:	5e                   	pop    %esi
+80105d09:	5d                   	pop    %ebp
+80105d0a:	c3                   	ret
+80105d0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80105d0f:	90                   	nop
+
+80105d10 <forkret>:
+{
+80105d10:	55                   	push   %ebp
+80105d11:	89 e5                	mov    %esp,%ebp
+80105d13:	53                   	push   %ebx
+80105d14:	83 ec 04             	sub    $0x4,%esp
+  pushcli();
+80105d17:	e8 e4 16 00 00       	call   80107400 <pushcli>
+  c = mycpu();
+80105d1c:	e8 7f fd ff ff       	call   80105aa0 <mycpu>
+  p = c->proc;
+80105d21:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80105d27:	e8 24 17 00 00       	call   80107450 <popcli>
+  release(&runq[myproc()->cpu].lock);
+80105d2c:	83 ec 0c             	sub    $0xc,%esp
+80105d2f:	6b 83 d8 00 00 00 70 	imul   $0x70,0xd8(%ebx),%eax
+80105d36:	05 c0 d4 90 80       	add    $0x8090d4c0,%eax
+80105d3b:	50                   	push   %eax
+80105d3c:	e8 af 17 00 00       	call   801074f0 <release>
+  if (first) {
+80105d41:	a1 00 e0 10 80       	mov    0x8010e000,%eax
+80105d46:	83 c4 10             	add    $0x10,%esp
+80105d49:	85 c0                	test   %eax,%eax
+80105d4b:	75 0b                	jne    80105d58 <forkret+0x48>
+}
+80105d4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105d50:	c9                   	leave
+80105d51:	c3                   	ret
+80105d52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    first = 0;
+80105d58:	c7 05 00 e0 10 80 00 	movl   $0x0,0x8010e000
+80105d5f:	00 00 00 
+    iinit(ROOTDEV);
+80105d62:	83 ec 0c             	sub    $0xc,%esp
+80105d65:	6a 01                	push   $0x1
+80105d67:	e8 f4 c2 ff ff       	call   80102060 <iinit>
+    initlog(ROOTDEV);
+80105d6c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+80105d73:	e8 38 e9 ff ff       	call   801046b0 <initlog>
+}
+80105d78:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105d7b:	83 c4 10             	add    $0x10,%esp
+80105d7e:	c9                   	leave
+80105d7f:	c3                   	ret
+
+80105d80 <myproc>:
+myproc(void) {
+80105d80:	55                   	push   %ebp
+80105d81:	89 e5                	mov    %esp,%ebp
+80105d83:	53                   	push   %ebx
+80105d84:	83 ec 04             	sub    $0x4,%esp
+  pushcli();
+80105d87:	e8 74 16 00 00       	call   80107400 <pushcli>
+  c = mycpu();
+80105d8c:	e8 0f fd ff ff       	call   80105aa0 <mycpu>
+  p = c->proc;
+80105d91:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80105d97:	e8 b4 16 00 00       	call   80107450 <popcli>
+}
+80105d9c:	89 d8                	mov    %ebx,%eax
+80105d9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80105da1:	c9                   	leave
+80105da2:	c3                   	ret
+80105da3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105daa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80105db0 <userinit>:
+{
+80105db0:	55                   	push   %ebp
+80105db1:	89 e5                	mov    %esp,%ebp
+80105db3:	57                   	push   %edi
+80105db4:	56                   	push   %esi
+80105db5:	53                   	push   %ebx
+80105db6:	83 ec 0c             	sub    $0xc,%esp
+  p = allocproc();
+80105db9:	e8 82 fa ff ff       	call   80105840 <allocproc>
+80105dbe:	89 c6                	mov    %eax,%esi
+  initproc = p;
+80105dc0:	a3 74 1e 91 80       	mov    %eax,0x80911e74
+  if((p->pgdir = setupkvm()) == 0)
+80105dc5:	e8 e6 47 00 00       	call   8010a5b0 <setupkvm>
+80105dca:	89 46 04             	mov    %eax,0x4(%esi)
+80105dcd:	85 c0                	test   %eax,%eax
+80105dcf:	0f 84 0f 01 00 00    	je     80105ee4 <userinit+0x134>
+  inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+80105dd5:	83 ec 04             	sub    $0x4,%esp
+80105dd8:	68 2c 00 00 00       	push   $0x2c
+80105ddd:	68 60 e4 10 80       	push   $0x8010e460
+80105de2:	50                   	push   %eax
+80105de3:	e8 a8 44 00 00       	call   8010a290 <inituvm>
+  memset(p->tf, 0, sizeof(*p->tf));
+80105de8:	83 c4 0c             	add    $0xc,%esp
+  p->sz = PGSIZE;
+80105deb:	c7 06 00 10 00 00    	movl   $0x1000,(%esi)
+  memset(p->tf, 0, sizeof(*p->tf));
+80105df1:	6a 4c                	push   $0x4c
+80105df3:	6a 00                	push   $0x0
+80105df5:	ff 76 28             	push   0x28(%esi)
+80105df8:	e8 33 18 00 00       	call   80107630 <memset>
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+80105dfd:	8b 46 28             	mov    0x28(%esi),%eax
+80105e00:	ba 1b 00 00 00       	mov    $0x1b,%edx
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+80105e05:	83 c4 0c             	add    $0xc,%esp
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80105e08:	b9 23 00 00 00       	mov    $0x23,%ecx
+  p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
+80105e0d:	66 89 50 3c          	mov    %dx,0x3c(%eax)
+  p->tf->ds = (SEG_UDATA << 3) | DPL_USER;
+80105e11:	8b 46 28             	mov    0x28(%esi),%eax
+80105e14:	66 89 48 2c          	mov    %cx,0x2c(%eax)
+  p->tf->es = p->tf->ds;
+80105e18:	8b 46 28             	mov    0x28(%esi),%eax
+80105e1b:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80105e1f:	66 89 50 28          	mov    %dx,0x28(%eax)
+  p->tf->ss = p->tf->ds;
+80105e23:	8b 46 28             	mov    0x28(%esi),%eax
+80105e26:	0f b7 50 2c          	movzwl 0x2c(%eax),%edx
+80105e2a:	66 89 50 48          	mov    %dx,0x48(%eax)
+  p->tf->eflags = FL_IF;
+80105e2e:	8b 46 28             	mov    0x28(%esi),%eax
+80105e31:	c7 40 40 00 02 00 00 	movl   $0x200,0x40(%eax)
+  p->tf->esp = PGSIZE;
+80105e38:	8b 46 28             	mov    0x28(%esi),%eax
+80105e3b:	c7 40 44 00 10 00 00 	movl   $0x1000,0x44(%eax)
+  p->tf->eip = 0;  // beginning of initcode.S
+80105e42:	8b 46 28             	mov    0x28(%esi),%eax
+80105e45:	c7 40 38 00 00 00 00 	movl   $0x0,0x38(%eax)
+  safestrcpy(p->name, "initcode", sizeof(p->name));
+80105e4c:	8d 86 88 00 00 00    	lea    0x88(%esi),%eax
+80105e52:	6a 10                	push   $0x10
+80105e54:	68 8d b4 10 80       	push   $0x8010b48d
+80105e59:	50                   	push   %eax
+80105e5a:	e8 81 19 00 00       	call   801077e0 <safestrcpy>
+  p->cwd = namei("/");
+80105e5f:	c7 04 24 96 b4 10 80 	movl   $0x8010b496,(%esp)
+80105e66:	e8 95 d7 ff ff       	call   80103600 <namei>
+80105e6b:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  return mycpu()-cpus;
+80105e71:	e8 2a fc ff ff       	call   80105aa0 <mycpu>
+  p->cpu = cpuid();
+80105e76:	83 c4 10             	add    $0x10,%esp
+  return mycpu()-cpus;
+80105e79:	2d 20 cf 90 80       	sub    $0x8090cf20,%eax
+80105e7e:	89 c3                	mov    %eax,%ebx
+80105e80:	c1 fb 02             	sar    $0x2,%ebx
+80105e83:	69 db a5 4f fa a4    	imul   $0xa4fa4fa5,%ebx,%ebx
+  p->cpu = cpuid();
+80105e89:	89 9e d8 00 00 00    	mov    %ebx,0xd8(%esi)
+lockrq(struct proc *p)
+80105e8f:	eb 19                	jmp    80105eaa <userinit+0xfa>
+80105e91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    release(&rq->lock);
+80105e98:	83 ec 0c             	sub    $0xc,%esp
+80105e9b:	57                   	push   %edi
+80105e9c:	e8 4f 16 00 00       	call   801074f0 <release>
+    rq = &runq[p->cpu];
+80105ea1:	8b 9e d8 00 00 00    	mov    0xd8(%esi),%ebx
+80105ea7:	83 c4 10             	add    $0x10,%esp
+80105eaa:	6b db 70             	imul   $0x70,%ebx,%ebx
+    acquire(&rq->lock);
+80105ead:	83 ec 0c             	sub    $0xc,%esp
+    rq = &runq[p->cpu];
+80105eb0:	8d bb c0 d4 90 80    	lea    -0x7f6f2b40(%ebx),%edi
+    acquire(&rq->lock);
+80105eb6:	57                   	push   %edi
+80105eb7:	e8 94 16 00 00       	call   80107550 <acquire>
+    if(rq == &runq[p->cpu])
+80105ebc:	6b 86 d8 00 00 00 70 	imul   $0x70,0xd8(%esi),%eax
+80105ec3:	83 c4 10             	add    $0x10,%esp
+80105ec6:	39 d8                	cmp    %ebx,%eax
+80105ec8:	75 ce                	jne    80105e98 <userinit+0xe8>
+  setrunnable(rq, p);
+80105eca:	89 f2                	mov    %esi,%edx
+80105ecc:	89 f8                	mov    %edi,%eax
+80105ece:	e8 4d fc ff ff       	call   80105b20 <setrunnable>
+  release(&rq->lock);
+80105ed3:	83 ec 0c             	sub    $0xc,%esp
+80105ed6:	57                   	push   %edi
+80105ed7:	e8 14 16 00 00       	call   801074f0 <release>
+}
+80105edc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105edf:	5b                   	pop    %ebx
+80105ee0:	5e                   	pop    %esi
+80105ee1:	5f                   	pop    %edi
+80105ee2:	5d                   	pop    %ebp
+80105ee3:	c3                   	ret
+    panic("userinit: out of memory?");
+80105ee4:	83 ec 0c             	sub    $0xc,%esp
+80105ee7:	68 74 b4 10 80       	push   $0x8010b474
+80105eec:	e8 8f a9 ff ff       	call   80100880 <panic>
+80105ef1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105ef8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105eff:	90                   	nop
+
+80105f00 <kthread>:
+{
+80105f00:	55                   	push   %ebp
+80105f01:	89 e5                	mov    %esp,%ebp
+80105f03:	57                   	push   %edi
+80105f04:	56                   	push   %esi
+80105f05:	53                   	push   %ebx
+80105f06:	83 ec 0c             	sub    $0xc,%esp
+80105f09:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80105f0c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if((p = allocproc()) == 0 || (p->pgdir = setupkvm()) == 0)
+80105f0f:	e8 2c f9 ff ff       	call   80105840 <allocproc>
+80105f14:	85 c0                	test   %eax,%eax
+80105f16:	0f 84 9e 00 00 00    	je     80105fba <kthread+0xba>
+80105f1c:	89 c6                	mov    %eax,%esi
+80105f1e:	e8 8d 46 00 00       	call   8010a5b0 <setupkvm>
+80105f23:	89 46 04             	mov    %eax,0x4(%esi)
+80105f26:	85 c0                	test   %eax,%eax
+80105f28:	0f 84 8c 00 00 00    	je     80105fba <kthread+0xba>
+  *(uint*)(p->context + 1) = (uint)fn;
+80105f2e:	8b 46 2c             	mov    0x2c(%esi),%eax
+  safestrcpy(p->name, name, sizeof(p->name));
+80105f31:	83 ec 04             	sub    $0x4,%esp
+  *(uint*)(p->context + 1) = (uint)fn;
+80105f34:	89 78 14             	mov    %edi,0x14(%eax)
+  safestrcpy(p->name, name, sizeof(p->name));
+80105f37:	8d 86 88 00 00 00    	lea    0x88(%esi),%eax
+80105f3d:	6a 10                	push   $0x10
+80105f3f:	53                   	push   %ebx
+80105f40:	50                   	push   %eax
+80105f41:	e8 9a 18 00 00       	call   801077e0 <safestrcpy>
+  p->parent = 0;
+80105f46:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+  return mycpu()-cpus;
+80105f4d:	e8 4e fb ff ff       	call   80105aa0 <mycpu>
+  p->cpu = cpuid();
+80105f52:	83 c4 10             	add    $0x10,%esp
+  return mycpu()-cpus;
+80105f55:	2d 20 cf 90 80       	sub    $0x8090cf20,%eax
+80105f5a:	89 c3                	mov    %eax,%ebx
+80105f5c:	c1 fb 02             	sar    $0x2,%ebx
+80105f5f:	69 db a5 4f fa a4    	imul   $0xa4fa4fa5,%ebx,%ebx
+  p->cpu = cpuid();
+80105f65:	89 9e d8 00 00 00    	mov    %ebx,0xd8(%esi)
+lockrq(struct proc *p)
+80105f6b:	eb 15                	jmp    80105f82 <kthread+0x82>
+80105f6d:	8d 76 00             	lea    0x0(%esi),%esi
+    release(&rq->lock);
+80105f70:	83 ec 0c             	sub    $0xc,%esp
+80105f73:	57                   	push   %edi
+80105f74:	e8 77 15 00 00       	call   801074f0 <release>
+    rq = &runq[p->cpu];
+80105f79:	8b 9e d8 00 00 00    	mov    0xd8(%esi),%ebx
+80105f7f:	83 c4 10             	add    $0x10,%esp
+80105f82:	6b db 70             	imul   $0x70,%ebx,%ebx
+    acquire(&rq->lock);
+80105f85:	83 ec 0c             	sub    $0xc,%esp
+    rq = &runq[p->cpu];
+80105f88:	8d bb c0 d4 90 80    	lea    -0x7f6f2b40(%ebx),%edi
+    acquire(&rq->lock);
+80105f8e:	57                   	push   %edi
+80105f8f:	e8 bc 15 00 00       	call   80107550 <acquire>
+    if(rq == &runq[p->cpu])
+80105f94:	6b 86 d8 00 00 00 70 	imul   $0x70,0xd8(%esi),%eax
+80105f9b:	83 c4 10             	add    $0x10,%esp
+80105f9e:	39 d8                	cmp    %ebx,%eax
+80105fa0:	75 ce                	jne    80105f70 <kthread+0x70>
+  setrunnable(rq, p);
+80105fa2:	89 f2                	mov    %esi,%edx
+80105fa4:	89 f8                	mov    %edi,%eax
+80105fa6:	e8 75 fb ff ff       	call   80105b20 <setrunnable>
+  release(&rq->lock);
+80105fab:	89 7d 08             	mov    %edi,0x8(%ebp)
+}
+80105fae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80105fb1:	5b                   	pop    %ebx
+80105fb2:	5e                   	pop    %esi
+80105fb3:	5f                   	pop    %edi
+80105fb4:	5d                   	pop    %ebp
+  release(&rq->lock);
+80105fb5:	e9 36 15 00 00       	jmp    801074f0 <release>
+    panic("kthread");
+80105fba:	83 ec 0c             	sub    $0xc,%esp
+80105fbd:	68 98 b4 10 80       	push   $0x8010b498
+80105fc2:	e8 b9 a8 ff ff       	call   80100880 <panic>
+80105fc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80105fce:	66 90                	xchg   %ax,%ax
+
+80105fd0 <growproc>:
+{
+80105fd0:	55                   	push   %ebp
+80105fd1:	89 e5                	mov    %esp,%ebp
+80105fd3:	57                   	push   %edi
+80105fd4:	56                   	push   %esi
+80105fd5:	53                   	push   %ebx
+80105fd6:	83 ec 0c             	sub    $0xc,%esp
+80105fd9:	8b 75 08             	mov    0x8(%ebp),%esi
+  pushcli();
+80105fdc:	e8 1f 14 00 00       	call   80107400 <pushcli>
+  c = mycpu();
+80105fe1:	e8 ba fa ff ff       	call   80105aa0 <mycpu>
+  p = c->proc;
+80105fe6:	8b b8 ac 00 00 00    	mov    0xac(%eax),%edi
+  popcli();
+80105fec:	e8 5f 14 00 00       	call   80107450 <popcli>
+  sz = curproc->sz;
+80105ff1:	8b 07                	mov    (%edi),%eax
+  if(n > 0){
+80105ff3:	85 f6                	test   %esi,%esi
+80105ff5:	7e 49                	jle    80106040 <growproc+0x70>
+    if(sz + n < sz || sz + n >= KERNBASE ||
+80105ff7:	89 f3                	mov    %esi,%ebx
+80105ff9:	01 c3                	add    %eax,%ebx
+80105ffb:	72 63                	jb     80106060 <growproc+0x90>
+80105ffd:	85 db                	test   %ebx,%ebx
+80105fff:	78 5f                	js     80106060 <growproc+0x90>
+       PGROUNDUP(sz + n) - PGROUNDUP(sz) > (uint)kfreecount()*PGSIZE)
+80106001:	8d b3 ff 0f 00 00    	lea    0xfff(%ebx),%esi
+80106007:	05 ff 0f 00 00       	add    $0xfff,%eax
+8010600c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+80106011:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+80106017:	29 c6                	sub    %eax,%esi
+80106019:	e8 62 db ff ff       	call   80103b80 <kfreecount>
+8010601e:	c1 e0 0c             	shl    $0xc,%eax
+    if(sz + n < sz || sz + n >= KERNBASE ||
+80106021:	39 f0                	cmp    %esi,%eax
+80106023:	72 3b                	jb     80106060 <growproc+0x90>
+  switchuvm(curproc);
+80106025:	83 ec 0c             	sub    $0xc,%esp
+  curproc->sz = sz;
+80106028:	89 1f                	mov    %ebx,(%edi)
+  switchuvm(curproc);
+8010602a:	57                   	push   %edi
+8010602b:	e8 50 41 00 00       	call   8010a180 <switchuvm>
+  return 0;
+80106030:	83 c4 10             	add    $0x10,%esp
+80106033:	31 c0                	xor    %eax,%eax
+}
+80106035:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106038:	5b                   	pop    %ebx
+80106039:	5e                   	pop    %esi
+8010603a:	5f                   	pop    %edi
+8010603b:	5d                   	pop    %ebp
+8010603c:	c3                   	ret
+8010603d:	8d 76 00             	lea    0x0(%esi),%esi
+  sz = curproc->sz;
+80106040:	89 c3                	mov    %eax,%ebx
+  } else if(n < 0){
+80106042:	74 e1                	je     80106025 <growproc+0x55>
+    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+80106044:	83 ec 04             	sub    $0x4,%esp
+80106047:	01 c6                	add    %eax,%esi
+80106049:	56                   	push   %esi
+8010604a:	50                   	push   %eax
+8010604b:	ff 77 04             	push   0x4(%edi)
+8010604e:	e8 ad 44 00 00       	call   8010a500 <deallocuvm>
+80106053:	83 c4 10             	add    $0x10,%esp
+80106056:	89 c3                	mov    %eax,%ebx
+80106058:	85 c0                	test   %eax,%eax
+8010605a:	75 c9                	jne    80106025 <growproc+0x55>
+8010605c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      return -1;
+80106060:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106065:	eb ce                	jmp    80106035 <growproc+0x65>
+80106067:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010606e:	66 90                	xchg   %ax,%ax
+
+80106070 <fork>:
+{
+80106070:	55                   	push   %ebp
+80106071:	89 e5                	mov    %esp,%ebp
+80106073:	57                   	push   %edi
+80106074:	56                   	push   %esi
+80106075:	53                   	push   %ebx
+80106076:	83 ec 1c             	sub    $0x1c,%esp
+  pushcli();
+80106079:	e8 82 13 00 00       	call   80107400 <pushcli>
+  c = mycpu();
+8010607e:	e8 1d fa ff ff       	call   80105aa0 <mycpu>
+  p = c->proc;
+80106083:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80106089:	e8 c2 13 00 00       	call   80107450 <popcli>
+  if((np = allocproc()) == 0)
+8010608e:	e8 ad f7 ff ff       	call   80105840 <allocproc>
+80106093:	85 c0                	test   %eax,%eax
+80106095:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80106098:	0f 84 1b 02 00 00    	je     801062b9 <fork+0x249>
+  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+8010609e:	83 ec 08             	sub    $0x8,%esp
+801060a1:	ff 33                	push   (%ebx)
+801060a3:	ff 73 04             	push   0x4(%ebx)
+801060a6:	e8 f5 45 00 00       	call   8010a6a0 <copyuvm>
+801060ab:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801060ae:	83 c4 10             	add    $0x10,%esp
+801060b1:	89 42 04             	mov    %eax,0x4(%edx)
+801060b4:	85 c0                	test   %eax,%eax
+801060b6:	0f 84 8a 01 00 00    	je     80106246 <fork+0x1d6>
+  np->sz = curproc->sz;
+801060bc:	8b 03                	mov    (%ebx),%eax
+  *np->tf = *curproc->tf;
+801060be:	8b 7a 28             	mov    0x28(%edx),%edi
+801060c1:	b9 13 00 00 00       	mov    $0x13,%ecx
+  np->sz = curproc->sz;
+801060c6:	89 02                	mov    %eax,(%edx)
+  *np->tf = *curproc->tf;
+801060c8:	8b 73 28             	mov    0x28(%ebx),%esi
+801060cb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  for(i = 0; i < NOFILE; i++)
+801060cd:	31 f6                	xor    %esi,%esi
+801060cf:	89 d7                	mov    %edx,%edi
+  np->tf->eax = 0;
+801060d1:	8b 42 28             	mov    0x28(%edx),%eax
+801060d4:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  for(i = 0; i < NOFILE; i++)
+801060db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801060df:	90                   	nop
+    if(curproc->ofile[i])
+801060e0:	8b 44 b3 44          	mov    0x44(%ebx,%esi,4),%eax
+801060e4:	85 c0                	test   %eax,%eax
+801060e6:	74 10                	je     801060f8 <fork+0x88>
+      np->ofile[i] = filedup(curproc->ofile[i]);
+801060e8:	83 ec 0c             	sub    $0xc,%esp
+801060eb:	50                   	push   %eax
+801060ec:	e8 1f b3 ff ff       	call   80101410 <filedup>
+801060f1:	83 c4 10             	add    $0x10,%esp
+801060f4:	89 44 b7 44          	mov    %eax,0x44(%edi,%esi,4)
+  for(i = 0; i < NOFILE; i++)
+801060f8:	83 c6 01             	add    $0x1,%esi
+801060fb:	83 fe 10             	cmp    $0x10,%esi
+801060fe:	75 e0                	jne    801060e0 <fork+0x70>
+  np->cwd = idup(curproc->cwd);
+80106100:	83 ec 0c             	sub    $0xc,%esp
+80106103:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80106106:	ff b3 84 00 00 00    	push   0x84(%ebx)
+8010610c:	e8 1f c7 ff ff       	call   80102830 <idup>
+80106111:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+80106114:	83 c4 0c             	add    $0xc,%esp
+  np->cwd = idup(curproc->cwd);
+80106117:	89 82 84 00 00 00    	mov    %eax,0x84(%edx)
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+8010611d:	8d 83 88 00 00 00    	lea    0x88(%ebx),%eax
+80106123:	6a 10                	push   $0x10
+80106125:	50                   	push   %eax
+80106126:	8d 82 88 00 00 00    	lea    0x88(%edx),%eax
+8010612c:	50                   	push   %eax
+8010612d:	e8 ae 16 00 00       	call   801077e0 <safestrcpy>
+  np->nice          = curproc->nice;
+80106132:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80106135:	8b 83 98 00 00 00    	mov    0x98(%ebx),%eax
+8010613b:	89 82 98 00 00 00    	mov    %eax,0x98(%edx)
+  np->base_priority = curproc->base_priority;
+80106141:	8b 83 9c 00 00 00    	mov    0x9c(%ebx),%eax
+  pid = np->pid;
+80106147:	8b 72 10             	mov    0x10(%edx),%esi
+  np->base_priority = curproc->base_priority;
+8010614a:	89 82 9c 00 00 00    	mov    %eax,0x9c(%edx)
+  np->eff_priority  = curproc->eff_priority;
+80106150:	8b 83 a0 00 00 00    	mov    0xa0(%ebx),%eax
+80106156:	89 82 a0 00 00 00    	mov    %eax,0xa0(%edx)
+  np->tickets       = curproc->tickets;
+8010615c:	8b 83 c4 00 00 00    	mov    0xc4(%ebx),%eax
+80106162:	89 82 c4 00 00 00    	mov    %eax,0xc4(%edx)
+  acquire(&ptable.lock);
+80106168:	c7 04 24 40 d8 90 80 	movl   $0x8090d840,(%esp)
+8010616f:	e8 dc 13 00 00       	call   80107550 <acquire>
+  np->parent = curproc;
+80106174:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  childlink(&curproc->children, np);
+80106177:	8d 4b 18             	lea    0x18(%ebx),%ecx
+  if(*head)
+8010617a:	83 c4 10             	add    $0x10,%esp
+  np->parent = curproc;
+8010617d:	89 5a 14             	mov    %ebx,0x14(%edx)
+  p->sibling = *head;
+80106180:	8b 43 18             	mov    0x18(%ebx),%eax
+80106183:	89 42 20             	mov    %eax,0x20(%edx)
+  if(*head)
+80106186:	85 c0                	test   %eax,%eax
+80106188:	74 06                	je     80106190 <fork+0x120>
+    (*head)->psibling = &p->sibling;
+8010618a:	8d 7a 20             	lea    0x20(%edx),%edi
+8010618d:	89 78 24             	mov    %edi,0x24(%eax)
+  release(&ptable.lock);
+80106190:	83 ec 0c             	sub    $0xc,%esp
+  p->psibling = head;
+80106193:	89 4a 24             	mov    %ecx,0x24(%edx)
+  *head = p;
+80106196:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+80106199:	89 53 18             	mov    %edx,0x18(%ebx)
+  release(&ptable.lock);
+8010619c:	68 40 d8 90 80       	push   $0x8090d840
+801061a1:	e8 4a 13 00 00       	call   801074f0 <release>
+  for(i = 1; i < ncpu; i++)
+801061a6:	83 c4 10             	add    $0x10,%esp
+  best = 0;
+801061a9:	31 c0                	xor    %eax,%eax
+  for(i = 1; i < ncpu; i++)
+801061ab:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+801061ae:	8b 3d 04 cf 90 80    	mov    0x8090cf04,%edi
+801061b4:	83 ff 01             	cmp    $0x1,%edi
+801061b7:	7e 26                	jle    801061df <fork+0x16f>
+801061b9:	b9 01 00 00 00       	mov    $0x1,%ecx
+801061be:	66 90                	xchg   %ax,%ax
+    if(runq[i].nrunnable < runq[best].nrunnable)
+801061c0:	6b d1 70             	imul   $0x70,%ecx,%edx
+801061c3:	6b d8 70             	imul   $0x70,%eax,%ebx
+801061c6:	8b 92 20 d5 90 80    	mov    -0x7f6f2ae0(%edx),%edx
+801061cc:	39 93 20 d5 90 80    	cmp    %edx,-0x7f6f2ae0(%ebx)
+801061d2:	0f 4f c1             	cmovg  %ecx,%eax
+  for(i = 1; i < ncpu; i++)
+801061d5:	83 c1 01             	add    $0x1,%ecx
+801061d8:	39 cf                	cmp    %ecx,%edi
+801061da:	75 e4                	jne    801061c0 <fork+0x150>
+801061dc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  np->cpu = leastloaded();
+801061df:	89 82 d8 00 00 00    	mov    %eax,0xd8(%edx)
+801061e5:	89 d3                	mov    %edx,%ebx
+801061e7:	89 c7                	mov    %eax,%edi
+801061e9:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+801061ec:	eb 14                	jmp    80106202 <fork+0x192>
+801061ee:	66 90                	xchg   %ax,%ax
+    release(&rq->lock);
+801061f0:	83 ec 0c             	sub    $0xc,%esp
+801061f3:	56                   	push   %esi
+801061f4:	e8 f7 12 00 00       	call   801074f0 <release>
+    rq = &runq[p->cpu];
+801061f9:	8b bb d8 00 00 00    	mov    0xd8(%ebx),%edi
+801061ff:	83 c4 10             	add    $0x10,%esp
+80106202:	6b ff 70             	imul   $0x70,%edi,%edi
+    acquire(&rq->lock);
+80106205:	83 ec 0c             	sub    $0xc,%esp
+    rq = &runq[p->cpu];
+80106208:	8d b7 c0 d4 90 80    	lea    -0x7f6f2b40(%edi),%esi
+    acquire(&rq->lock);
+8010620e:	56                   	push   %esi
+8010620f:	e8 3c 13 00 00       	call   80107550 <acquire>
+    if(rq == &runq[p->cpu])
+80106214:	6b 93 d8 00 00 00 70 	imul   $0x70,0xd8(%ebx),%edx
+8010621b:	83 c4 10             	add    $0x10,%esp
+8010621e:	39 fa                	cmp    %edi,%edx
+80106220:	75 ce                	jne    801061f0 <fork+0x180>
+  setrunnable(rq, np);
+80106222:	89 da                	mov    %ebx,%edx
+80106224:	89 f3                	mov    %esi,%ebx
+80106226:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+80106229:	89 d8                	mov    %ebx,%eax
+8010622b:	e8 f0 f8 ff ff       	call   80105b20 <setrunnable>
+  release(&rq->lock);
+80106230:	83 ec 0c             	sub    $0xc,%esp
+80106233:	53                   	push   %ebx
+80106234:	e8 b7 12 00 00       	call   801074f0 <release>
+  return pid;
+80106239:	83 c4 10             	add    $0x10,%esp
+}
+8010623c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010623f:	89 f0                	mov    %esi,%eax
+80106241:	5b                   	pop    %ebx
+80106242:	5e                   	pop    %esi
+80106243:	5f                   	pop    %edi
+80106244:	5d                   	pop    %ebp
+80106245:	c3                   	ret
+    kfree(np->kstack);
+80106246:	83 ec 0c             	sub    $0xc,%esp
+80106249:	ff 72 08             	push   0x8(%edx)
+8010624c:	e8 cf d4 ff ff       	call   80103720 <kfree>
+    np->kstack = 0;
+80106251:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80106254:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+    acquire(&ptable.lock);
+8010625b:	c7 04 24 40 d8 90 80 	movl   $0x8090d840,(%esp)
+80106262:	e8 e9 12 00 00       	call   80107550 <acquire>
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+80106267:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010626a:	83 c4 10             	add    $0x10,%esp
+8010626d:	8b 42 10             	mov    0x10(%edx),%eax
+80106270:	89 c1                	mov    %eax,%ecx
+80106272:	c1 f9 1f             	sar    $0x1f,%ecx
+80106275:	c1 e9 1a             	shr    $0x1a,%ecx
+80106278:	01 c8                	add    %ecx,%eax
+8010627a:	83 e0 3f             	and    $0x3f,%eax
+8010627d:	29 c8                	sub    %ecx,%eax
+8010627f:	8b 0c 85 74 1d 91 80 	mov    -0x7f6ee28c(,%eax,4),%ecx
+80106286:	39 ca                	cmp    %ecx,%edx
+80106288:	74 39                	je     801062c3 <fork+0x253>
+8010628a:	89 c8                	mov    %ecx,%eax
+8010628c:	8b 49 3c             	mov    0x3c(%ecx),%ecx
+8010628f:	39 d1                	cmp    %edx,%ecx
+80106291:	75 f7                	jne    8010628a <fork+0x21a>
+80106293:	83 c0 3c             	add    $0x3c,%eax
+  *pp = p->pidnext;
+80106296:	8b 4a 3c             	mov    0x3c(%edx),%ecx
+    release(&ptable.lock);
+80106299:	83 ec 0c             	sub    $0xc,%esp
+  *pp = p->pidnext;
+8010629c:	89 08                	mov    %ecx,(%eax)
+  p->pid = 0;
+8010629e:	c7 42 10 00 00 00 00 	movl   $0x0,0x10(%edx)
+  p->state = UNUSED;
+801062a5:	c7 42 0c 00 00 00 00 	movl   $0x0,0xc(%edx)
+    release(&ptable.lock);
+801062ac:	68 40 d8 90 80       	push   $0x8090d840
+801062b1:	e8 3a 12 00 00       	call   801074f0 <release>
+    return -1;
+801062b6:	83 c4 10             	add    $0x10,%esp
+    return -1;
+801062b9:	be ff ff ff ff       	mov    $0xffffffff,%esi
+801062be:	e9 79 ff ff ff       	jmp    8010623c <fork+0x1cc>
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+801062c3:	8d 04 85 74 1d 91 80 	lea    -0x7f6ee28c(,%eax,4),%eax
+801062ca:	eb ca                	jmp    80106296 <fork+0x226>
+801062cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801062d0 <scheduler>:
+{
+801062d0:	55                   	push   %ebp
+801062d1:	89 e5                	mov    %esp,%ebp
+801062d3:	57                   	push   %edi
+801062d4:	56                   	push   %esi
+801062d5:	53                   	push   %ebx
+801062d6:	83 ec 3c             	sub    $0x3c,%esp
+  struct cpu *c = mycpu();
+801062d9:	e8 c2 f7 ff ff       	call   80105aa0 <mycpu>
+801062de:	89 c6                	mov    %eax,%esi
+801062e0:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  struct runq *rq = &runq[c - cpus];
+801062e3:	2d 20 cf 90 80       	sub    $0x8090cf20,%eax
+  c->proc = 0;
+801062e8:	c7 86 ac 00 00 00 00 	movl   $0x0,0xac(%esi)
+801062ef:	00 00 00 
+  struct runq *rq = &runq[c - cpus];
+801062f2:	c1 f8 02             	sar    $0x2,%eax
+801062f5:	83 c6 04             	add    $0x4,%esi
+801062f8:	69 d0 30 d8 82 2d    	imul   $0x2d82d830,%eax,%edx
+801062fe:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  p->rqprev = rq->tail[lvl];
+80106301:	69 c0 0c b6 60 0b    	imul   $0xb60b60c,%eax,%eax
+      p->cpu = rq - runq;
+80106307:	89 d1                	mov    %edx,%ecx
+  struct runq *rq = &runq[c - cpus];
+80106309:	8d ba c0 d4 90 80    	lea    -0x7f6f2b40(%edx),%edi
+  c->proc = 0;
+8010630f:	81 c2 d0 d4 90 80    	add    $0x8090d4d0,%edx
+      p->cpu = rq - runq;
+80106315:	c1 f9 04             	sar    $0x4,%ecx
+80106318:	89 55 d0             	mov    %edx,-0x30(%ebp)
+8010631b:	69 c9 b7 6d db b6    	imul   $0xb6db6db7,%ecx,%ecx
+  p->rqprev = rq->tail[lvl];
+80106321:	89 45 e0             	mov    %eax,-0x20(%ebp)
+      p->cpu = rq - runq;
+80106324:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+80106327:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010632e:	66 90                	xchg   %ax,%ax
+  asm volatile("sti");
+80106330:	fb                   	sti
+    if(rq->nrunnable == 0)
+80106331:	8b 47 60             	mov    0x60(%edi),%eax
+80106334:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80106337:	85 c0                	test   %eax,%eax
+80106339:	0f 84 d6 01 00 00    	je     80106515 <scheduler+0x245>
+  asm volatile("cli");
+8010633f:	fa                   	cli
+    acquire(&rq->lock);
+80106340:	83 ec 0c             	sub    $0xc,%esp
+80106343:	57                   	push   %edi
+80106344:	e8 07 12 00 00       	call   80107550 <acquire>
+  rq->passes++;
+80106349:	83 47 64 01          	addl   $0x1,0x64(%edi)
+  for(lvl = 1; lvl < NPRIO; lvl++){
+8010634d:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  rq->passes++;
+80106350:	83 c4 10             	add    $0x10,%esp
+80106353:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+80106356:	eb 27                	jmp    8010637f <scheduler+0xaf>
+80106358:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010635f:	90                   	nop
+    rq->tail[lvl]->rqnext = p;
+80106360:	89 98 e0 00 00 00    	mov    %ebx,0xe0(%eax)
+  rq->tail[lvl] = p;
+80106366:	8d 44 31 10          	lea    0x10(%ecx,%esi,1),%eax
+  rq->nrunnable++;
+8010636a:	83 47 60 01          	addl   $0x1,0x60(%edi)
+  rq->tail[lvl] = p;
+8010636e:	89 1c 85 c8 d4 90 80 	mov    %ebx,-0x7f6f2b38(,%eax,4)
+  rq->bitmap |= 1 << lvl;
+80106375:	b8 01 00 00 00       	mov    $0x1,%eax
+8010637a:	d3 e0                	shl    %cl,%eax
+8010637c:	09 47 5c             	or     %eax,0x5c(%edi)
+    while((p = rq->head[lvl]) != 0 &&
+8010637f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80106382:	8b 58 38             	mov    0x38(%eax),%ebx
+80106385:	85 db                	test   %ebx,%ebx
+80106387:	74 67                	je     801063f0 <scheduler+0x120>
+          rq->passes - p->agestart >= AGING_INTERVAL){
+80106389:	8b 47 64             	mov    0x64(%edi),%eax
+8010638c:	2b 83 a4 00 00 00    	sub    0xa4(%ebx),%eax
+    while((p = rq->head[lvl]) != 0 &&
+80106392:	3d c7 00 00 00       	cmp    $0xc7,%eax
+80106397:	76 57                	jbe    801063f0 <scheduler+0x120>
+      rqremove(rq, p);
+80106399:	89 da                	mov    %ebx,%edx
+8010639b:	89 f8                	mov    %edi,%eax
+8010639d:	e8 fe f3 ff ff       	call   801057a0 <rqremove>
+      p->eff_priority--;          // smaller number = higher priority
+801063a2:	8b 83 a0 00 00 00    	mov    0xa0(%ebx),%eax
+801063a8:	8d 48 ff             	lea    -0x1(%eax),%ecx
+801063ab:	89 8b a0 00 00 00    	mov    %ecx,0xa0(%ebx)
+      p->agestart = rq->passes;
+801063b1:	8b 47 64             	mov    0x64(%edi),%eax
+  p->rqprev = rq->tail[lvl];
+801063b4:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+      p->nboost++;
+801063b7:	83 83 0c 01 00 00 01 	addl   $0x1,0x10c(%ebx)
+      p->agestart = rq->passes;
+801063be:	89 83 a4 00 00 00    	mov    %eax,0xa4(%ebx)
+  p->rqnext = 0;
+801063c4:	c7 83 e0 00 00 00 00 	movl   $0x0,0xe0(%ebx)
+801063cb:	00 00 00 
+  p->rqprev = rq->tail[lvl];
+801063ce:	8b 04 95 08 d5 90 80 	mov    -0x7f6f2af8(,%edx,4),%eax
+801063d5:	89 83 e4 00 00 00    	mov    %eax,0xe4(%ebx)
+  if(rq->tail[lvl])
+801063db:	85 c0                	test   %eax,%eax
+801063dd:	75 81                	jne    80106360 <scheduler+0x90>
+    rq->head[lvl] = p;
+801063df:	89 1c 95 f4 d4 90 80 	mov    %ebx,-0x7f6f2b0c(,%edx,4)
+801063e6:	e9 7b ff ff ff       	jmp    80106366 <scheduler+0x96>
+801063eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801063ef:	90                   	nop
+  for(lvl = 1; lvl < NPRIO; lvl++){
+801063f0:	83 45 e4 04          	addl   $0x4,-0x1c(%ebp)
+801063f4:	8b 55 d0             	mov    -0x30(%ebp),%edx
+801063f7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+801063fa:	39 d0                	cmp    %edx,%eax
+801063fc:	75 81                	jne    8010637f <scheduler+0xaf>
+  if(rq->bitmap == 0)
+801063fe:	8b 47 5c             	mov    0x5c(%edi),%eax
+80106401:	85 c0                	test   %eax,%eax
+80106403:	0f 84 95 00 00 00    	je     8010649e <scheduler+0x1ce>
+  p = rq->head[__builtin_ctz(rq->bitmap)];
+80106409:	8b 75 e0             	mov    -0x20(%ebp),%esi
+8010640c:	f3 0f bc c0          	tzcnt  %eax,%eax
+80106410:	8d 44 30 0c          	lea    0xc(%eax,%esi,1),%eax
+80106414:	8b 1c 85 c4 d4 90 80 	mov    -0x7f6f2b3c(,%eax,4),%ebx
+  rqremove(rq, p);
+8010641b:	89 f8                	mov    %edi,%eax
+8010641d:	89 da                	mov    %ebx,%edx
+8010641f:	e8 7c f3 ff ff       	call   801057a0 <rqremove>
+    if((p = rqpop(rq)) != 0){
+80106424:	85 db                	test   %ebx,%ebx
+80106426:	74 76                	je     8010649e <scheduler+0x1ce>
+      w = ticks - p->readyat;
+80106428:	a1 a0 22 91 80       	mov    0x809122a0,%eax
+8010642d:	2b 83 f8 00 00 00    	sub    0xf8(%ebx),%eax
+      p->waitticks += w;
+80106433:	01 83 00 01 00 00    	add    %eax,0x100(%ebx)
+      if(w > p->maxwait)
+80106439:	39 83 04 01 00 00    	cmp    %eax,0x104(%ebx)
+8010643f:	73 06                	jae    80106447 <scheduler+0x177>
+        p->maxwait = w;
+80106441:	89 83 04 01 00 00    	mov    %eax,0x104(%ebx)
+      c->proc = p;
+80106447:	8b 75 c8             	mov    -0x38(%ebp),%esi
+      switchuvm(p);
+8010644a:	83 ec 0c             	sub    $0xc,%esp
+      p->nswitch++;
+8010644d:	83 83 08 01 00 00 01 	addl   $0x1,0x108(%ebx)
+      c->proc = p;
+80106454:	89 9e ac 00 00 00    	mov    %ebx,0xac(%esi)
+      switchuvm(p);
+8010645a:	53                   	push   %ebx
+8010645b:	e8 20 3d 00 00       	call   8010a180 <switchuvm>
+      p->state = RUNNING;
+80106460:	c7 43 0c 04 00 00 00 	movl   $0x4,0xc(%ebx)
+      swtch(&(c->scheduler), p->context);
+80106467:	58                   	pop    %eax
+80106468:	5a                   	pop    %edx
+80106469:	ff 73 2c             	push   0x2c(%ebx)
+8010646c:	ff 75 c4             	push   -0x3c(%ebp)
+8010646f:	e8 c7 13 00 00       	call   8010783b <swtch>
+      switchkvm();
+80106474:	e8 f7 3c 00 00       	call   8010a170 <switchkvm>
+      p->lastrun = ticks;
+80106479:	a1 a0 22 91 80       	mov    0x809122a0,%eax
+8010647e:	89 83 dc 00 00 00    	mov    %eax,0xdc(%ebx)
+      c->proc = 0;
+80106484:	c7 86 ac 00 00 00 00 	movl   $0x0,0xac(%esi)
+8010648b:	00 00 00 
+      release(&rq->lock);
+8010648e:	89 3c 24             	mov    %edi,(%esp)
+80106491:	e8 5a 10 00 00       	call   801074f0 <release>
+      continue;
+80106496:	83 c4 10             	add    $0x10,%esp
+80106499:	e9 92 fe ff ff       	jmp    80106330 <scheduler+0x60>
+    c->idle = 1;
+8010649e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    release(&rq->lock);
+801064a1:	83 ec 0c             	sub    $0xc,%esp
+    c->idle = 1;
+801064a4:	c7 80 b0 00 00 00 01 	movl   $0x1,0xb0(%eax)
+801064ab:	00 00 00 
+    release(&rq->lock);
+801064ae:	57                   	push   %edi
+801064af:	e8 3c 10 00 00       	call   801074f0 <release>
+  for(i = 0; i < ncpu; i++)
+801064b4:	8b 0d 04 cf 90 80    	mov    0x8090cf04,%ecx
+801064ba:	83 c4 10             	add    $0x10,%esp
+801064bd:	85 c9                	test   %ecx,%ecx
+801064bf:	0f 8e fb 01 00 00    	jle    801066c0 <scheduler+0x3f0>
+801064c5:	b8 20 d5 90 80       	mov    $0x8090d520,%eax
+801064ca:	31 d2                	xor    %edx,%edx
+801064cc:	eb 10                	jmp    801064de <scheduler+0x20e>
+801064ce:	66 90                	xchg   %ax,%ax
+801064d0:	83 c2 01             	add    $0x1,%edx
+801064d3:	83 c0 70             	add    $0x70,%eax
+801064d6:	39 d1                	cmp    %edx,%ecx
+801064d8:	0f 84 e2 01 00 00    	je     801066c0 <scheduler+0x3f0>
+    if(runq[i].nrunnable > 0)
+801064de:	8b 18                	mov    (%eax),%ebx
+801064e0:	85 db                	test   %ebx,%ebx
+801064e2:	7e ec                	jle    801064d0 <scheduler+0x200>
+      return MIGRATE_COST;
+801064e4:	b8 01 00 00 00       	mov    $0x1,%eax
+    lapictimer(idlefor());
+801064e9:	83 ec 0c             	sub    $0xc,%esp
+801064ec:	50                   	push   %eax
+801064ed:	e8 be d7 ff ff       	call   80103cb0 <lapictimer>
+  asm volatile("sti; hlt");
+801064f2:	fb                   	sti
+801064f3:	f4                   	hlt
+    c->idle = 0;
+801064f4:	8b 45 c8             	mov    -0x38(%ebp),%eax
+801064f7:	c7 80 b0 00 00 00 00 	movl   $0x0,0xb0(%eax)
+801064fe:	00 00 00 
+    lapictimer(0);
+80106501:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+80106508:	e8 a3 d7 ff ff       	call   80103cb0 <lapictimer>
+8010650d:	83 c4 10             	add    $0x10,%esp
+80106510:	e9 1b fe ff ff       	jmp    80106330 <scheduler+0x60>
+  for(i = 0; i < ncpu; i++)
+80106515:	a1 04 cf 90 80       	mov    0x8090cf04,%eax
+8010651a:	85 c0                	test   %eax,%eax
+8010651c:	0f 8e 1d fe ff ff    	jle    8010633f <scheduler+0x6f>
+80106522:	6b c0 70             	imul   $0x70,%eax,%eax
+  src = 0;
+80106525:	31 db                	xor    %ebx,%ebx
+80106527:	8d 88 c0 d4 90 80    	lea    -0x7f6f2b40(%eax),%ecx
+  for(i = 0; i < ncpu; i++)
+8010652d:	b8 c0 d4 90 80       	mov    $0x8090d4c0,%eax
+80106532:	eb 11                	jmp    80106545 <scheduler+0x275>
+80106534:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+       (src == 0 || runq[i].nrunnable > src->nrunnable))
+80106538:	3b 53 60             	cmp    0x60(%ebx),%edx
+8010653b:	0f 4f d8             	cmovg  %eax,%ebx
+  for(i = 0; i < ncpu; i++)
+8010653e:	83 c0 70             	add    $0x70,%eax
+80106541:	39 c8                	cmp    %ecx,%eax
+80106543:	74 18                	je     8010655d <scheduler+0x28d>
+    if(&runq[i] != rq && runq[i].nrunnable > 0 &&
+80106545:	39 c7                	cmp    %eax,%edi
+80106547:	74 f5                	je     8010653e <scheduler+0x26e>
+80106549:	8b 50 60             	mov    0x60(%eax),%edx
+8010654c:	85 d2                	test   %edx,%edx
+8010654e:	7e ee                	jle    8010653e <scheduler+0x26e>
+80106550:	85 db                	test   %ebx,%ebx
+80106552:	75 e4                	jne    80106538 <scheduler+0x268>
+80106554:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < ncpu; i++)
+80106556:	83 c0 70             	add    $0x70,%eax
+80106559:	39 c8                	cmp    %ecx,%eax
+8010655b:	75 e8                	jne    80106545 <scheduler+0x275>
+  if(src == 0)
+8010655d:	89 d8                	mov    %ebx,%eax
+8010655f:	85 db                	test   %ebx,%ebx
+80106561:	0f 84 d8 fd ff ff    	je     8010633f <scheduler+0x6f>
+  second = src < rq ? rq : src;
+80106567:	39 df                	cmp    %ebx,%edi
+  first = src < rq ? src : rq;
+80106569:	89 c6                	mov    %eax,%esi
+8010656b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+8010656e:	0f 46 f7             	cmovbe %edi,%esi
+  second = src < rq ? rq : src;
+80106571:	0f 43 df             	cmovae %edi,%ebx
+  acquire(&first->lock);
+80106574:	83 ec 0c             	sub    $0xc,%esp
+80106577:	56                   	push   %esi
+80106578:	e8 d3 0f 00 00       	call   80107550 <acquire>
+  acquire(&second->lock);
+8010657d:	89 1c 24             	mov    %ebx,(%esp)
+80106580:	e8 cb 0f 00 00       	call   80107550 <acquire>
+  n = (src->nrunnable + 1) / 2;
+80106585:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  for(lvl = 0; lvl < NPRIO && moved < n; lvl++){
+80106588:	83 c4 10             	add    $0x10,%esp
+  n = (src->nrunnable + 1) / 2;
+8010658b:	8b 48 60             	mov    0x60(%eax),%ecx
+8010658e:	8d 51 01             	lea    0x1(%ecx),%edx
+80106591:	89 d0                	mov    %edx,%eax
+80106593:	c1 e8 1f             	shr    $0x1f,%eax
+80106596:	01 d0                	add    %edx,%eax
+  for(lvl = 0; lvl < NPRIO && moved < n; lvl++){
+80106598:	31 d2                	xor    %edx,%edx
+  n = (src->nrunnable + 1) / 2;
+8010659a:	d1 f8                	sar    %eax
+8010659c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(lvl = 0; lvl < NPRIO && moved < n; lvl++){
+8010659f:	85 c9                	test   %ecx,%ecx
+801065a1:	0f 8e 00 01 00 00    	jle    801066a7 <scheduler+0x3d7>
+801065a7:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+801065aa:	89 75 bc             	mov    %esi,-0x44(%ebp)
+801065ad:	8d 76 00             	lea    0x0(%esi),%esi
+    for(p = src->head[lvl]; p != 0 && moved < n; p = next){
+801065b0:	8b 45 d8             	mov    -0x28(%ebp),%eax
+801065b3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+801065b6:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+801065b9:	8b 74 90 34          	mov    0x34(%eax,%edx,4),%esi
+801065bd:	0f 9c c0             	setl   %al
+801065c0:	85 f6                	test   %esi,%esi
+801065c2:	0f 84 bb 00 00 00    	je     80106683 <scheduler+0x3b3>
+801065c8:	84 c0                	test   %al,%al
+801065ca:	0f 84 b3 00 00 00    	je     80106683 <scheduler+0x3b3>
+801065d0:	89 55 cc             	mov    %edx,-0x34(%ebp)
+801065d3:	eb 3a                	jmp    8010660f <scheduler+0x33f>
+801065d5:	8d 76 00             	lea    0x0(%esi),%esi
+    rq->tail[lvl]->rqnext = p;
+801065d8:	89 98 e0 00 00 00    	mov    %ebx,0xe0(%eax)
+  rq->tail[lvl] = p;
+801065de:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  rq->nrunnable++;
+801065e1:	83 47 60 01          	addl   $0x1,0x60(%edi)
+      moved++;
+801065e5:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+  rq->tail[lvl] = p;
+801065e9:	8d 44 01 10          	lea    0x10(%ecx,%eax,1),%eax
+801065ed:	89 1c 85 c8 d4 90 80 	mov    %ebx,-0x7f6f2b38(,%eax,4)
+  rq->bitmap |= 1 << lvl;
+801065f4:	b8 01 00 00 00       	mov    $0x1,%eax
+801065f9:	d3 e0                	shl    %cl,%eax
+801065fb:	09 47 5c             	or     %eax,0x5c(%edi)
+    for(p = src->head[lvl]; p != 0 && moved < n; p = next){
+801065fe:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+80106601:	39 55 dc             	cmp    %edx,-0x24(%ebp)
+80106604:	0f 9f c0             	setg   %al
+80106607:	85 f6                	test   %esi,%esi
+80106609:	74 75                	je     80106680 <scheduler+0x3b0>
+8010660b:	84 c0                	test   %al,%al
+8010660d:	74 71                	je     80106680 <scheduler+0x3b0>
+      next = p->rqnext;
+8010660f:	89 f3                	mov    %esi,%ebx
+      if(ticks - p->lastrun < MIGRATE_COST)
+80106611:	a1 a0 22 91 80       	mov    0x809122a0,%eax
+      next = p->rqnext;
+80106616:	8b b6 e0 00 00 00    	mov    0xe0(%esi),%esi
+      if(ticks - p->lastrun < MIGRATE_COST)
+8010661c:	39 83 dc 00 00 00    	cmp    %eax,0xdc(%ebx)
+80106622:	74 da                	je     801065fe <scheduler+0x32e>
+      rqremove(src, p);
+80106624:	8b 45 d8             	mov    -0x28(%ebp),%eax
+80106627:	89 da                	mov    %ebx,%edx
+80106629:	e8 72 f1 ff ff       	call   801057a0 <rqremove>
+      p->cpu = rq - runq;
+8010662e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  return p->eff_priority;
+80106631:	8b 8b a0 00 00 00    	mov    0xa0(%ebx),%ecx
+      p->cpu = rq - runq;
+80106637:	89 83 d8 00 00 00    	mov    %eax,0xd8(%ebx)
+      p->agestart = rq->passes;
+8010663d:	8b 47 64             	mov    0x64(%edi),%eax
+  p->rqnext = 0;
+80106640:	c7 83 e0 00 00 00 00 	movl   $0x0,0xe0(%ebx)
+80106647:	00 00 00 
+      p->agestart = rq->passes;
+8010664a:	89 83 a4 00 00 00    	mov    %eax,0xa4(%ebx)
+  p->rqprev = rq->tail[lvl];
+80106650:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80106653:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+80106656:	8b 04 95 08 d5 90 80 	mov    -0x7f6f2af8(,%edx,4),%eax
+8010665d:	89 83 e4 00 00 00    	mov    %eax,0xe4(%ebx)
+  if(rq->tail[lvl])
+80106663:	85 c0                	test   %eax,%eax
+80106665:	0f 85 6d ff ff ff    	jne    801065d8 <scheduler+0x308>
+    rq->head[lvl] = p;
+8010666b:	89 1c 95 f4 d4 90 80 	mov    %ebx,-0x7f6f2b0c(,%edx,4)
+80106672:	e9 67 ff ff ff       	jmp    801065de <scheduler+0x30e>
+80106677:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010667e:	66 90                	xchg   %ax,%ax
+80106680:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  for(lvl = 0; lvl < NPRIO && moved < n; lvl++){
+80106683:	83 c2 01             	add    $0x1,%edx
+80106686:	83 fa 04             	cmp    $0x4,%edx
+80106689:	7f 08                	jg     80106693 <scheduler+0x3c3>
+8010668b:	84 c0                	test   %al,%al
+8010668d:	0f 85 1d ff ff ff    	jne    801065b0 <scheduler+0x2e0>
+  if(moved > 0){
+80106693:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80106696:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+80106699:	8b 75 bc             	mov    -0x44(%ebp),%esi
+8010669c:	85 c0                	test   %eax,%eax
+8010669e:	74 07                	je     801066a7 <scheduler+0x3d7>
+    rq->nsteals++;
+801066a0:	83 47 68 01          	addl   $0x1,0x68(%edi)
+    rq->nmigrations += moved;
+801066a4:	01 47 6c             	add    %eax,0x6c(%edi)
+  release(&second->lock);
+801066a7:	83 ec 0c             	sub    $0xc,%esp
+801066aa:	53                   	push   %ebx
+801066ab:	e8 40 0e 00 00       	call   801074f0 <release>
+  release(&first->lock);
+801066b0:	89 34 24             	mov    %esi,(%esp)
+801066b3:	e8 38 0e 00 00       	call   801074f0 <release>
+801066b8:	83 c4 10             	add    $0x10,%esp
+801066bb:	e9 7f fc ff ff       	jmp    8010633f <scheduler+0x6f>
+  return idleticks();
+801066c0:	e8 fb 28 00 00       	call   80108fc0 <idleticks>
+801066c5:	e9 1f fe ff ff       	jmp    801064e9 <scheduler+0x219>
+801066ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801066d0 <sched>:
+{
+801066d0:	55                   	push   %ebp
+801066d1:	89 e5                	mov    %esp,%ebp
+801066d3:	56                   	push   %esi
+801066d4:	53                   	push   %ebx
+  pushcli();
+801066d5:	e8 26 0d 00 00       	call   80107400 <pushcli>
+  c = mycpu();
+801066da:	e8 c1 f3 ff ff       	call   80105aa0 <mycpu>
+  p = c->proc;
+801066df:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+801066e5:	e8 66 0d 00 00       	call   80107450 <popcli>
+  if(!holding(&runq[p->cpu].lock))
+801066ea:	83 ec 0c             	sub    $0xc,%esp
+801066ed:	6b 83 d8 00 00 00 70 	imul   $0x70,0xd8(%ebx),%eax
+801066f4:	05 c0 d4 90 80       	add    $0x8090d4c0,%eax
+801066f9:	50                   	push   %eax
+801066fa:	e8 b1 0d 00 00       	call   801074b0 <holding>
+801066ff:	83 c4 10             	add    $0x10,%esp
+80106702:	85 c0                	test   %eax,%eax
+80106704:	74 4f                	je     80106755 <sched+0x85>
+  if(mycpu()->ncli != 1)
+80106706:	e8 95 f3 ff ff       	call   80105aa0 <mycpu>
+8010670b:	83 b8 a4 00 00 00 01 	cmpl   $0x1,0xa4(%eax)
+80106712:	75 68                	jne    8010677c <sched+0xac>
+  if(p->state == RUNNING)
+80106714:	83 7b 0c 04          	cmpl   $0x4,0xc(%ebx)
+80106718:	74 55                	je     8010676f <sched+0x9f>
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+8010671a:	9c                   	pushf
+8010671b:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+8010671c:	f6 c4 02             	test   $0x2,%ah
+8010671f:	75 41                	jne    80106762 <sched+0x92>
+  intena = mycpu()->intena;
+80106721:	e8 7a f3 ff ff       	call   80105aa0 <mycpu>
+  swtch(&p->context, mycpu()->scheduler);
+80106726:	83 c3 2c             	add    $0x2c,%ebx
+  intena = mycpu()->intena;
+80106729:	8b b0 a8 00 00 00    	mov    0xa8(%eax),%esi
+  swtch(&p->context, mycpu()->scheduler);
+8010672f:	e8 6c f3 ff ff       	call   80105aa0 <mycpu>
+80106734:	83 ec 08             	sub    $0x8,%esp
+80106737:	ff 70 04             	push   0x4(%eax)
+8010673a:	53                   	push   %ebx
+8010673b:	e8 fb 10 00 00       	call   8010783b <swtch>
+  mycpu()->intena = intena;
+80106740:	e8 5b f3 ff ff       	call   80105aa0 <mycpu>
+}
+80106745:	83 c4 10             	add    $0x10,%esp
+  mycpu()->intena = intena;
+80106748:	89 b0 a8 00 00 00    	mov    %esi,0xa8(%eax)
+}
+8010674e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106751:	5b                   	pop    %ebx
+80106752:	5e                   	pop    %esi
+80106753:	5d                   	pop    %ebp
+80106754:	c3                   	ret
+    panic("sched runq lock");
+80106755:	83 ec 0c             	sub    $0xc,%esp
+80106758:	68 a0 b4 10 80       	push   $0x8010b4a0
+8010675d:	e8 1e a1 ff ff       	call   80100880 <panic>
+    panic("sched interruptible");
+80106762:	83 ec 0c             	sub    $0xc,%esp
+80106765:	68 ca b4 10 80       	push   $0x8010b4ca
+8010676a:	e8 11 a1 ff ff       	call   80100880 <panic>
+    panic("sched running");
+8010676f:	83 ec 0c             	sub    $0xc,%esp
+80106772:	68 bc b4 10 80       	push   $0x8010b4bc
+80106777:	e8 04 a1 ff ff       	call   80100880 <panic>
+    panic("sched locks");
+8010677c:	83 ec 0c             	sub    $0xc,%esp
+8010677f:	68 b0 b4 10 80       	push   $0x8010b4b0
+80106784:	e8 f7 a0 ff ff       	call   80100880 <panic>
+80106789:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80106790 <exit>:
+{
+80106790:	55                   	push   %ebp
+80106791:	89 e5                	mov    %esp,%ebp
+80106793:	57                   	push   %edi
+80106794:	56                   	push   %esi
+80106795:	53                   	push   %ebx
+80106796:	83 ec 0c             	sub    $0xc,%esp
+  struct proc *curproc = myproc();
+80106799:	e8 e2 f5 ff ff       	call   80105d80 <myproc>
+  if(curproc == initproc)
+8010679e:	39 05 74 1e 91 80    	cmp    %eax,0x80911e74
+801067a4:	0f 84 8c 01 00 00    	je     80106936 <exit+0x1a6>
+801067aa:	89 c3                	mov    %eax,%ebx
+801067ac:	8d 70 44             	lea    0x44(%eax),%esi
+801067af:	8d b8 84 00 00 00    	lea    0x84(%eax),%edi
+801067b5:	8d 76 00             	lea    0x0(%esi),%esi
+    if(curproc->ofile[fd]){
+801067b8:	8b 06                	mov    (%esi),%eax
+801067ba:	85 c0                	test   %eax,%eax
+801067bc:	74 12                	je     801067d0 <exit+0x40>
+      fileclose(curproc->ofile[fd]);
+801067be:	83 ec 0c             	sub    $0xc,%esp
+801067c1:	50                   	push   %eax
+801067c2:	e8 99 ac ff ff       	call   80101460 <fileclose>
+      curproc->ofile[fd] = 0;
+801067c7:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+801067cd:	83 c4 10             	add    $0x10,%esp
+  for(fd = 0; fd < NOFILE; fd++){
+801067d0:	83 c6 04             	add    $0x4,%esi
+801067d3:	39 f7                	cmp    %esi,%edi
+801067d5:	75 e1                	jne    801067b8 <exit+0x28>
+  begin_op();
+801067d7:	e8 84 df ff ff       	call   80104760 <begin_op>
+  iput(curproc->cwd);
+801067dc:	83 ec 0c             	sub    $0xc,%esp
+801067df:	ff b3 84 00 00 00    	push   0x84(%ebx)
+801067e5:	e8 a6 c1 ff ff       	call   80102990 <iput>
+  end_op();
+801067ea:	e8 11 e0 ff ff       	call   80104800 <end_op>
+  curproc->cwd = 0;
+801067ef:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+801067f6:	00 00 00 
+  acquire(&ptable.lock);
+801067f9:	c7 04 24 40 d8 90 80 	movl   $0x8090d840,(%esp)
+80106800:	e8 4b 0d 00 00       	call   80107550 <acquire>
+  wakeup1(curproc->parent);
+80106805:	8b 43 14             	mov    0x14(%ebx),%eax
+80106808:	e8 c3 f4 ff ff       	call   80105cd0 <wakeup1>
+  while((p = curproc->children) != 0){
+8010680d:	8b 43 18             	mov    0x18(%ebx),%eax
+80106810:	83 c4 10             	add    $0x10,%esp
+80106813:	85 c0                	test   %eax,%eax
+80106815:	74 3b                	je     80106852 <exit+0xc2>
+    p->parent = initproc;
+80106817:	8b 0d 74 1e 91 80    	mov    0x80911e74,%ecx
+    childlink(&initproc->children, p);
+8010681d:	8d 71 18             	lea    0x18(%ecx),%esi
+  *p->psibling = p->sibling;
+80106820:	8b 78 24             	mov    0x24(%eax),%edi
+80106823:	8b 50 20             	mov    0x20(%eax),%edx
+80106826:	89 17                	mov    %edx,(%edi)
+  if(p->sibling)
+80106828:	85 d2                	test   %edx,%edx
+8010682a:	74 06                	je     80106832 <exit+0xa2>
+    p->sibling->psibling = p->psibling;
+8010682c:	8b 78 24             	mov    0x24(%eax),%edi
+8010682f:	89 7a 24             	mov    %edi,0x24(%edx)
+    p->parent = initproc;
+80106832:	89 48 14             	mov    %ecx,0x14(%eax)
+  p->sibling = *head;
+80106835:	8b 51 18             	mov    0x18(%ecx),%edx
+80106838:	89 50 20             	mov    %edx,0x20(%eax)
+  if(*head)
+8010683b:	85 d2                	test   %edx,%edx
+8010683d:	74 06                	je     80106845 <exit+0xb5>
+    (*head)->psibling = &p->sibling;
+8010683f:	8d 78 20             	lea    0x20(%eax),%edi
+80106842:	89 7a 24             	mov    %edi,0x24(%edx)
+  p->psibling = head;
+80106845:	89 70 24             	mov    %esi,0x24(%eax)
+  *head = p;
+80106848:	89 41 18             	mov    %eax,0x18(%ecx)
+  while((p = curproc->children) != 0){
+8010684b:	8b 43 18             	mov    0x18(%ebx),%eax
+8010684e:	85 c0                	test   %eax,%eax
+80106850:	75 ce                	jne    80106820 <exit+0x90>
+  if(curproc->zombies)
+80106852:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80106855:	85 c0                	test   %eax,%eax
+80106857:	74 51                	je     801068aa <exit+0x11a>
+    wakeup1(initproc);
+80106859:	a1 74 1e 91 80       	mov    0x80911e74,%eax
+8010685e:	e8 6d f4 ff ff       	call   80105cd0 <wakeup1>
+  while((p = curproc->zombies) != 0){
+80106863:	8b 43 1c             	mov    0x1c(%ebx),%eax
+80106866:	85 c0                	test   %eax,%eax
+80106868:	74 40                	je     801068aa <exit+0x11a>
+    p->parent = initproc;
+8010686a:	8b 0d 74 1e 91 80    	mov    0x80911e74,%ecx
+    childlink(&initproc->zombies, p);
+80106870:	8d 71 1c             	lea    0x1c(%ecx),%esi
+80106873:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106877:	90                   	nop
+  *p->psibling = p->sibling;
+80106878:	8b 78 24             	mov    0x24(%eax),%edi
+8010687b:	8b 50 20             	mov    0x20(%eax),%edx
+8010687e:	89 17                	mov    %edx,(%edi)
+  if(p->sibling)
+80106880:	85 d2                	test   %edx,%edx
+80106882:	74 06                	je     8010688a <exit+0xfa>
+    p->sibling->psibling = p->psibling;
+80106884:	8b 78 24             	mov    0x24(%eax),%edi
+80106887:	89 7a 24             	mov    %edi,0x24(%edx)
+    p->parent = initproc;
+8010688a:	89 48 14             	mov    %ecx,0x14(%eax)
+  p->sibling = *head;
+8010688d:	8b 51 1c             	mov    0x1c(%ecx),%edx
+80106890:	89 50 20             	mov    %edx,0x20(%eax)
+  if(*head)
+80106893:	85 d2                	test   %edx,%edx
+80106895:	74 06                	je     8010689d <exit+0x10d>
+    (*head)->psibling = &p->sibling;
+80106897:	8d 78 20             	lea    0x20(%eax),%edi
+8010689a:	89 7a 24             	mov    %edi,0x24(%edx)
+  p->psibling = head;
+8010689d:	89 70 24             	mov    %esi,0x24(%eax)
+  *head = p;
+801068a0:	89 41 1c             	mov    %eax,0x1c(%ecx)
+  while((p = curproc->zombies) != 0){
+801068a3:	8b 43 1c             	mov    0x1c(%ebx),%eax
+801068a6:	85 c0                	test   %eax,%eax
+801068a8:	75 ce                	jne    80106878 <exit+0xe8>
+  *p->psibling = p->sibling;
+801068aa:	8b 53 24             	mov    0x24(%ebx),%edx
+801068ad:	8b 43 20             	mov    0x20(%ebx),%eax
+  curproc->state = ZOMBIE;
+801068b0:	c7 43 0c 05 00 00 00 	movl   $0x5,0xc(%ebx)
+  *p->psibling = p->sibling;
+801068b7:	89 02                	mov    %eax,(%edx)
+  if(p->sibling)
+801068b9:	85 c0                	test   %eax,%eax
+801068bb:	74 06                	je     801068c3 <exit+0x133>
+    p->sibling->psibling = p->psibling;
+801068bd:	8b 53 24             	mov    0x24(%ebx),%edx
+801068c0:	89 50 24             	mov    %edx,0x24(%eax)
+  childlink(&curproc->parent->zombies, curproc);
+801068c3:	8b 43 14             	mov    0x14(%ebx),%eax
+  p->sibling = *head;
+801068c6:	8b 50 1c             	mov    0x1c(%eax),%edx
+  childlink(&curproc->parent->zombies, curproc);
+801068c9:	8d 48 1c             	lea    0x1c(%eax),%ecx
+  p->sibling = *head;
+801068cc:	89 53 20             	mov    %edx,0x20(%ebx)
+  if(*head)
+801068cf:	85 d2                	test   %edx,%edx
+801068d1:	74 06                	je     801068d9 <exit+0x149>
+    (*head)->psibling = &p->sibling;
+801068d3:	8d 73 20             	lea    0x20(%ebx),%esi
+801068d6:	89 72 24             	mov    %esi,0x24(%edx)
+  p->psibling = head;
+801068d9:	89 4b 24             	mov    %ecx,0x24(%ebx)
+  *head = p;
+801068dc:	89 58 1c             	mov    %ebx,0x1c(%eax)
+lockrq(struct proc *p)
+801068df:	eb 13                	jmp    801068f4 <exit+0x164>
+801068e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    release(&rq->lock);
+801068e8:	83 ec 0c             	sub    $0xc,%esp
+801068eb:	57                   	push   %edi
+801068ec:	e8 ff 0b 00 00       	call   801074f0 <release>
+    rq = &runq[p->cpu];
+801068f1:	83 c4 10             	add    $0x10,%esp
+801068f4:	6b b3 d8 00 00 00 70 	imul   $0x70,0xd8(%ebx),%esi
+    acquire(&rq->lock);
+801068fb:	83 ec 0c             	sub    $0xc,%esp
+    rq = &runq[p->cpu];
+801068fe:	8d be c0 d4 90 80    	lea    -0x7f6f2b40(%esi),%edi
+    acquire(&rq->lock);
+80106904:	57                   	push   %edi
+80106905:	e8 46 0c 00 00       	call   80107550 <acquire>
+    if(rq == &runq[p->cpu])
+8010690a:	6b 83 d8 00 00 00 70 	imul   $0x70,0xd8(%ebx),%eax
+80106911:	83 c4 10             	add    $0x10,%esp
+80106914:	39 c6                	cmp    %eax,%esi
+80106916:	75 d0                	jne    801068e8 <exit+0x158>
+  release(&ptable.lock);
+80106918:	83 ec 0c             	sub    $0xc,%esp
+8010691b:	68 40 d8 90 80       	push   $0x8090d840
+80106920:	e8 cb 0b 00 00       	call   801074f0 <release>
+  sched();
+80106925:	e8 a6 fd ff ff       	call   801066d0 <sched>
+  panic("zombie exit");
+8010692a:	c7 04 24 eb b4 10 80 	movl   $0x8010b4eb,(%esp)
+80106931:	e8 4a 9f ff ff       	call   80100880 <panic>
+    panic("init exiting");
+80106936:	83 ec 0c             	sub    $0xc,%esp
+80106939:	68 de b4 10 80       	push   $0x8010b4de
+8010693e:	e8 3d 9f ff ff       	call   80100880 <panic>
+80106943:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010694a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80106950 <timeslice>:
+}
+80106950:	b8 01 00 00 00       	mov    $0x1,%eax
+80106955:	c3                   	ret
+80106956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010695d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80106960 <yield>:
+{
+80106960:	55                   	push   %ebp
+80106961:	89 e5                	mov    %esp,%ebp
+80106963:	57                   	push   %edi
+80106964:	56                   	push   %esi
+80106965:	53                   	push   %ebx
+80106966:	83 ec 0c             	sub    $0xc,%esp
+  pushcli();
+80106969:	e8 92 0a 00 00       	call   80107400 <pushcli>
+  c = mycpu();
+8010696e:	e8 2d f1 ff ff       	call   80105aa0 <mycpu>
+  p = c->proc;
+80106973:	8b b8 ac 00 00 00    	mov    0xac(%eax),%edi
+  popcli();
+80106979:	e8 d2 0a 00 00       	call   80107450 <popcli>
+lockrq(struct proc *p)
+8010697e:	eb 0c                	jmp    8010698c <yield+0x2c>
+    release(&rq->lock);
+80106980:	83 ec 0c             	sub    $0xc,%esp
+80106983:	53                   	push   %ebx
+80106984:	e8 67 0b 00 00       	call   801074f0 <release>
+    rq = &runq[p->cpu];
+80106989:	83 c4 10             	add    $0x10,%esp
+8010698c:	6b b7 d8 00 00 00 70 	imul   $0x70,0xd8(%edi),%esi
+    acquire(&rq->lock);
+80106993:	83 ec 0c             	sub    $0xc,%esp
+    rq = &runq[p->cpu];
+80106996:	8d 9e c0 d4 90 80    	lea    -0x7f6f2b40(%esi),%ebx
+    acquire(&rq->lock);
+8010699c:	53                   	push   %ebx
+8010699d:	e8 ae 0b 00 00       	call   80107550 <acquire>
+    if(rq == &runq[p->cpu])
+801069a2:	6b 87 d8 00 00 00 70 	imul   $0x70,0xd8(%edi),%eax
+801069a9:	83 c4 10             	add    $0x10,%esp
+801069ac:	39 f0                	cmp    %esi,%eax
+801069ae:	75 d0                	jne    80106980 <yield+0x20>
+  p->eff_priority = p->base_priority;
+801069b0:	8b 87 9c 00 00 00    	mov    0x9c(%edi),%eax
+  setrunnable(rq, p);
+801069b6:	89 fa                	mov    %edi,%edx
+  p->eff_priority = p->base_priority;
+801069b8:	89 87 a0 00 00 00    	mov    %eax,0xa0(%edi)
+  setrunnable(rq, p);
+801069be:	89 d8                	mov    %ebx,%eax
+801069c0:	e8 5b f1 ff ff       	call   80105b20 <setrunnable>
+  sched();
+801069c5:	e8 06 fd ff ff       	call   801066d0 <sched>
+  release(&runq[p->cpu].lock);
+801069ca:	6b 87 d8 00 00 00 70 	imul   $0x70,0xd8(%edi),%eax
+801069d1:	83 ec 0c             	sub    $0xc,%esp
+801069d4:	05 c0 d4 90 80       	add    $0x8090d4c0,%eax
+801069d9:	50                   	push   %eax
+801069da:	e8 11 0b 00 00       	call   801074f0 <release>
+}
+801069df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801069e2:	5b                   	pop    %ebx
+801069e3:	5e                   	pop    %esi
+801069e4:	5f                   	pop    %edi
+801069e5:	5d                   	pop    %ebp
+801069e6:	c3                   	ret
+801069e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801069ee:	66 90                	xchg   %ax,%ax
+
+801069f0 <sleep>:
+{
+801069f0:	55                   	push   %ebp
+801069f1:	89 e5                	mov    %esp,%ebp
+801069f3:	57                   	push   %edi
+801069f4:	56                   	push   %esi
+801069f5:	53                   	push   %ebx
+801069f6:	83 ec 1c             	sub    $0x1c,%esp
+801069f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+801069fc:	8b 75 08             	mov    0x8(%ebp),%esi
+801069ff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  pushcli();
+80106a02:	e8 f9 09 00 00       	call   80107400 <pushcli>
+  c = mycpu();
+80106a07:	e8 94 f0 ff ff       	call   80105aa0 <mycpu>
+  p = c->proc;
+80106a0c:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80106a12:	e8 39 0a 00 00       	call   80107450 <popcli>
+  if(p == 0) panic("sleep");
+80106a17:	85 db                	test   %ebx,%ebx
+80106a19:	0f 84 ec 00 00 00    	je     80106b0b <sleep+0x11b>
+  if(lk == 0) panic("sleep without lk");
+80106a1f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80106a22:	85 c0                	test   %eax,%eax
+80106a24:	0f 84 ee 00 00 00    	je     80106b18 <sleep+0x128>
+  if(lk != &ptable.lock){
+80106a2a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+80106a2d:	81 ff 40 d8 90 80    	cmp    $0x8090d840,%edi
+80106a33:	74 18                	je     80106a4d <sleep+0x5d>
+    acquire(&ptable.lock);
+80106a35:	83 ec 0c             	sub    $0xc,%esp
+80106a38:	68 40 d8 90 80       	push   $0x8090d840
+80106a3d:	e8 0e 0b 00 00       	call   80107550 <acquire>
+    release(lk);
+80106a42:	89 3c 24             	mov    %edi,(%esp)
+80106a45:	e8 a6 0a 00 00       	call   801074f0 <release>
+80106a4a:	83 c4 10             	add    $0x10,%esp
+  p->chan = chan;
+80106a4d:	89 73 30             	mov    %esi,0x30(%ebx)
+  struct proc **pp = &ptable.sleepq[SQHASH(p->chan)];
+80106a50:	69 f6 b1 79 37 9e    	imul   $0x9e3779b1,%esi,%esi
+  p->state = SLEEPING;
+80106a56:	c7 43 0c 02 00 00 00 	movl   $0x2,0xc(%ebx)
+  struct proc **pp = &ptable.sleepq[SQHASH(p->chan)];
+80106a5d:	c1 ee 1a             	shr    $0x1a,%esi
+80106a60:	8d 14 b5 74 1c 91 80 	lea    -0x7f6ee38c(,%esi,4),%edx
+  p->snext = *pp;
+80106a67:	81 c6 0c 11 00 00    	add    $0x110c,%esi
+80106a6d:	8b 04 b5 44 d8 90 80 	mov    -0x7f6f27bc(,%esi,4),%eax
+80106a74:	89 43 34             	mov    %eax,0x34(%ebx)
+  if(*pp)
+80106a77:	85 c0                	test   %eax,%eax
+80106a79:	74 06                	je     80106a81 <sleep+0x91>
+    (*pp)->sprev = &p->snext;
+80106a7b:	8d 4b 34             	lea    0x34(%ebx),%ecx
+80106a7e:	89 48 38             	mov    %ecx,0x38(%eax)
+  p->sprev = pp;
+80106a81:	89 53 38             	mov    %edx,0x38(%ebx)
+  *pp = p;
+80106a84:	89 1c b5 44 d8 90 80 	mov    %ebx,-0x7f6f27bc(,%esi,4)
+  p->eff_priority = p->base_priority;
+80106a8b:	8b 83 9c 00 00 00    	mov    0x9c(%ebx),%eax
+80106a91:	89 83 a0 00 00 00    	mov    %eax,0xa0(%ebx)
+lockrq(struct proc *p)
+80106a97:	eb 13                	jmp    80106aac <sleep+0xbc>
+80106a99:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    release(&rq->lock);
+80106aa0:	83 ec 0c             	sub    $0xc,%esp
+80106aa3:	57                   	push   %edi
+80106aa4:	e8 47 0a 00 00       	call   801074f0 <release>
+    rq = &runq[p->cpu];
+80106aa9:	83 c4 10             	add    $0x10,%esp
+80106aac:	6b b3 d8 00 00 00 70 	imul   $0x70,0xd8(%ebx),%esi
+    acquire(&rq->lock);
+80106ab3:	83 ec 0c             	sub    $0xc,%esp
+    rq = &runq[p->cpu];
+80106ab6:	8d be c0 d4 90 80    	lea    -0x7f6f2b40(%esi),%edi
+    acquire(&rq->lock);
+80106abc:	57                   	push   %edi
+80106abd:	e8 8e 0a 00 00       	call   80107550 <acquire>
+    if(rq == &runq[p->cpu])
+80106ac2:	6b 93 d8 00 00 00 70 	imul   $0x70,0xd8(%ebx),%edx
+80106ac9:	83 c4 10             	add    $0x10,%esp
+80106acc:	39 d6                	cmp    %edx,%esi
+80106ace:	75 d0                	jne    80106aa0 <sleep+0xb0>
+  release(&ptable.lock);
+80106ad0:	83 ec 0c             	sub    $0xc,%esp
+80106ad3:	68 40 d8 90 80       	push   $0x8090d840
+80106ad8:	e8 13 0a 00 00       	call   801074f0 <release>
+  sched();
+80106add:	e8 ee fb ff ff       	call   801066d0 <sched>
+  release(&runq[p->cpu].lock);
+80106ae2:	6b 83 d8 00 00 00 70 	imul   $0x70,0xd8(%ebx),%eax
+80106ae9:	05 c0 d4 90 80       	add    $0x8090d4c0,%eax
+80106aee:	89 04 24             	mov    %eax,(%esp)
+80106af1:	e8 fa 09 00 00       	call   801074f0 <release>
+  acquire(lk);
+80106af6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80106af9:	83 c4 10             	add    $0x10,%esp
+80106afc:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80106aff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106b02:	5b                   	pop    %ebx
+80106b03:	5e                   	pop    %esi
+80106b04:	5f                   	pop    %edi
+80106b05:	5d                   	pop    %ebp
+  acquire(lk);
+80106b06:	e9 45 0a 00 00       	jmp    80107550 <acquire>
+  if(p == 0) panic("sleep");
+80106b0b:	83 ec 0c             	sub    $0xc,%esp
+80106b0e:	68 f7 b4 10 80       	push   $0x8010b4f7
+80106b13:	e8 68 9d ff ff       	call   80100880 <panic>
+  if(lk == 0) panic("sleep without lk");
+80106b18:	83 ec 0c             	sub    $0xc,%esp
+80106b1b:	68 fd b4 10 80       	push   $0x8010b4fd
+80106b20:	e8 5b 9d ff ff       	call   80100880 <panic>
+80106b25:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106b2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80106b30 <wait>:
+{
+80106b30:	55                   	push   %ebp
+80106b31:	89 e5                	mov    %esp,%ebp
+80106b33:	56                   	push   %esi
+80106b34:	53                   	push   %ebx
+  pushcli();
+80106b35:	e8 c6 08 00 00       	call   80107400 <pushcli>
+  c = mycpu();
+80106b3a:	e8 61 ef ff ff       	call   80105aa0 <mycpu>
+  p = c->proc;
+80106b3f:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+80106b45:	e8 06 09 00 00       	call   80107450 <popcli>
+  acquire(&ptable.lock);
+80106b4a:	83 ec 0c             	sub    $0xc,%esp
+80106b4d:	68 40 d8 90 80       	push   $0x8090d840
+80106b52:	e8 f9 09 00 00       	call   80107550 <acquire>
+    if((p = curproc->zombies) != 0){
+80106b57:	8b 73 1c             	mov    0x1c(%ebx),%esi
+80106b5a:	83 c4 10             	add    $0x10,%esp
+80106b5d:	85 f6                	test   %esi,%esi
+80106b5f:	74 26                	je     80106b87 <wait+0x57>
+80106b61:	eb 4d                	jmp    80106bb0 <wait+0x80>
+80106b63:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106b67:	90                   	nop
+    if(curproc->children == 0 || curproc->killed){
+80106b68:	8b 43 40             	mov    0x40(%ebx),%eax
+80106b6b:	85 c0                	test   %eax,%eax
+80106b6d:	75 1f                	jne    80106b8e <wait+0x5e>
+    sleep(curproc, &ptable.lock);
+80106b6f:	83 ec 08             	sub    $0x8,%esp
+80106b72:	68 40 d8 90 80       	push   $0x8090d840
+80106b77:	53                   	push   %ebx
+80106b78:	e8 73 fe ff ff       	call   801069f0 <sleep>
+    if((p = curproc->zombies) != 0){
+80106b7d:	8b 73 1c             	mov    0x1c(%ebx),%esi
+80106b80:	83 c4 10             	add    $0x10,%esp
+80106b83:	85 f6                	test   %esi,%esi
+80106b85:	75 29                	jne    80106bb0 <wait+0x80>
+    if(curproc->children == 0 || curproc->killed){
+80106b87:	8b 53 18             	mov    0x18(%ebx),%edx
+80106b8a:	85 d2                	test   %edx,%edx
+80106b8c:	75 da                	jne    80106b68 <wait+0x38>
+      release(&ptable.lock);
+80106b8e:	83 ec 0c             	sub    $0xc,%esp
+      return -1;
+80106b91:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+      release(&ptable.lock);
+80106b96:	68 40 d8 90 80       	push   $0x8090d840
+80106b9b:	e8 50 09 00 00       	call   801074f0 <release>
+      return -1;
+80106ba0:	83 c4 10             	add    $0x10,%esp
+}
+80106ba3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106ba6:	89 d8                	mov    %ebx,%eax
+80106ba8:	5b                   	pop    %ebx
+80106ba9:	5e                   	pop    %esi
+80106baa:	5d                   	pop    %ebp
+80106bab:	c3                   	ret
+80106bac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      acquire(&runq[p->cpu].lock);
+80106bb0:	6b 86 d8 00 00 00 70 	imul   $0x70,0xd8(%esi),%eax
+80106bb7:	83 ec 0c             	sub    $0xc,%esp
+80106bba:	05 c0 d4 90 80       	add    $0x8090d4c0,%eax
+80106bbf:	50                   	push   %eax
+80106bc0:	e8 8b 09 00 00       	call   80107550 <acquire>
+      release(&runq[p->cpu].lock);
+80106bc5:	6b 86 d8 00 00 00 70 	imul   $0x70,0xd8(%esi),%eax
+80106bcc:	05 c0 d4 90 80       	add    $0x8090d4c0,%eax
+80106bd1:	89 04 24             	mov    %eax,(%esp)
+80106bd4:	e8 17 09 00 00       	call   801074f0 <release>
+  *p->psibling = p->sibling;
+80106bd9:	8b 56 24             	mov    0x24(%esi),%edx
+80106bdc:	8b 46 20             	mov    0x20(%esi),%eax
+  if(p->sibling)
+80106bdf:	83 c4 10             	add    $0x10,%esp
+  *p->psibling = p->sibling;
+80106be2:	89 02                	mov    %eax,(%edx)
+  if(p->sibling)
+80106be4:	85 c0                	test   %eax,%eax
+80106be6:	74 06                	je     80106bee <wait+0xbe>
+    p->sibling->psibling = p->psibling;
+80106be8:	8b 56 24             	mov    0x24(%esi),%edx
+80106beb:	89 50 24             	mov    %edx,0x24(%eax)
+      kfree(p->kstack);
+80106bee:	83 ec 0c             	sub    $0xc,%esp
+      pid = p->pid;
+80106bf1:	8b 5e 10             	mov    0x10(%esi),%ebx
+      kfree(p->kstack);
+80106bf4:	ff 76 08             	push   0x8(%esi)
+80106bf7:	e8 24 cb ff ff       	call   80103720 <kfree>
+      p->kstack = 0;
+80106bfc:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+      freevm(p->pgdir);
+80106c03:	59                   	pop    %ecx
+80106c04:	ff 76 04             	push   0x4(%esi)
+80106c07:	e8 24 39 00 00       	call   8010a530 <freevm>
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+80106c0c:	8b 46 10             	mov    0x10(%esi),%eax
+80106c0f:	83 c4 10             	add    $0x10,%esp
+      p->parent = 0;
+80106c12:	c7 46 14 00 00 00 00 	movl   $0x0,0x14(%esi)
+      p->name[0] = 0;
+80106c19:	c6 86 88 00 00 00 00 	movb   $0x0,0x88(%esi)
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+80106c20:	89 c1                	mov    %eax,%ecx
+      p->killed = 0;
+80106c22:	c7 46 40 00 00 00 00 	movl   $0x0,0x40(%esi)
+      p->nice = 2;
+80106c29:	c7 86 98 00 00 00 02 	movl   $0x2,0x98(%esi)
+80106c30:	00 00 00 
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+80106c33:	c1 f9 1f             	sar    $0x1f,%ecx
+      p->base_priority = 2;
+80106c36:	c7 86 9c 00 00 00 02 	movl   $0x2,0x9c(%esi)
+80106c3d:	00 00 00 
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+80106c40:	c1 e9 1a             	shr    $0x1a,%ecx
+      p->eff_priority = 2;
+80106c43:	c7 86 a0 00 00 00 02 	movl   $0x2,0xa0(%esi)
+80106c4a:	00 00 00 
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+80106c4d:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+      p->agestart = 0;
+80106c50:	c7 86 a4 00 00 00 00 	movl   $0x0,0xa4(%esi)
+80106c57:	00 00 00 
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+80106c5a:	83 e2 3f             	and    $0x3f,%edx
+80106c5d:	29 ca                	sub    %ecx,%edx
+80106c5f:	8b 04 95 74 1d 91 80 	mov    -0x7f6ee28c(,%edx,4),%eax
+80106c66:	39 f0                	cmp    %esi,%eax
+80106c68:	74 3e                	je     80106ca8 <wait+0x178>
+80106c6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80106c70:	89 c2                	mov    %eax,%edx
+80106c72:	8b 40 3c             	mov    0x3c(%eax),%eax
+80106c75:	39 f0                	cmp    %esi,%eax
+80106c77:	75 f7                	jne    80106c70 <wait+0x140>
+80106c79:	83 c2 3c             	add    $0x3c,%edx
+  *pp = p->pidnext;
+80106c7c:	8b 46 3c             	mov    0x3c(%esi),%eax
+      release(&ptable.lock);
+80106c7f:	83 ec 0c             	sub    $0xc,%esp
+  *pp = p->pidnext;
+80106c82:	89 02                	mov    %eax,(%edx)
+  p->pid = 0;
+80106c84:	c7 46 10 00 00 00 00 	movl   $0x0,0x10(%esi)
+  p->state = UNUSED;
+80106c8b:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+      release(&ptable.lock);
+80106c92:	68 40 d8 90 80       	push   $0x8090d840
+80106c97:	e8 54 08 00 00       	call   801074f0 <release>
+      return pid;
+80106c9c:	83 c4 10             	add    $0x10,%esp
+}
+80106c9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106ca2:	89 d8                	mov    %ebx,%eax
+80106ca4:	5b                   	pop    %ebx
+80106ca5:	5e                   	pop    %esi
+80106ca6:	5d                   	pop    %ebp
+80106ca7:	c3                   	ret
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+80106ca8:	8d 14 95 74 1d 91 80 	lea    -0x7f6ee28c(,%edx,4),%edx
+80106caf:	eb cb                	jmp    80106c7c <wait+0x14c>
+80106cb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106cb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106cbf:	90                   	nop
+
+80106cc0 <wakeproc>:
+
+// Wake p if it is sleeping on chan. Returns whether it was.
+int
+wakeproc(struct proc *p, void *chan)
+{
+80106cc0:	55                   	push   %ebp
+80106cc1:	89 e5                	mov    %esp,%ebp
+80106cc3:	56                   	push   %esi
+  int r;
+
+  acquire(&ptable.lock);
+  r = p->state == SLEEPING && p->chan == chan;
+80106cc4:	31 f6                	xor    %esi,%esi
+{
+80106cc6:	53                   	push   %ebx
+80106cc7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&ptable.lock);
+80106cca:	83 ec 0c             	sub    $0xc,%esp
+80106ccd:	68 40 d8 90 80       	push   $0x8090d840
+80106cd2:	e8 79 08 00 00       	call   80107550 <acquire>
+  r = p->state == SLEEPING && p->chan == chan;
+80106cd7:	83 c4 10             	add    $0x10,%esp
+80106cda:	83 7b 0c 02          	cmpl   $0x2,0xc(%ebx)
+80106cde:	74 20                	je     80106d00 <wakeproc+0x40>
+  if(r)
+    wake1(p);
+  release(&ptable.lock);
+80106ce0:	83 ec 0c             	sub    $0xc,%esp
+80106ce3:	68 40 d8 90 80       	push   $0x8090d840
+80106ce8:	e8 03 08 00 00       	call   801074f0 <release>
+  return r;
+}
+80106ced:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106cf0:	89 f0                	mov    %esi,%eax
+80106cf2:	5b                   	pop    %ebx
+80106cf3:	5e                   	pop    %esi
+80106cf4:	5d                   	pop    %ebp
+80106cf5:	c3                   	ret
+80106cf6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106cfd:	8d 76 00             	lea    0x0(%esi),%esi
+  r = p->state == SLEEPING && p->chan == chan;
+80106d00:	8b 45 0c             	mov    0xc(%ebp),%eax
+80106d03:	39 43 30             	cmp    %eax,0x30(%ebx)
+80106d06:	75 d8                	jne    80106ce0 <wakeproc+0x20>
+    wake1(p);
+80106d08:	89 d8                	mov    %ebx,%eax
+  r = p->state == SLEEPING && p->chan == chan;
+80106d0a:	be 01 00 00 00       	mov    $0x1,%esi
+    wake1(p);
+80106d0f:	e8 3c ef ff ff       	call   80105c50 <wake1>
+80106d14:	eb ca                	jmp    80106ce0 <wakeproc+0x20>
+80106d16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106d1d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80106d20 <wakeup>:
+
+void
+wakeup(void *chan)
+{
+80106d20:	55                   	push   %ebp
+80106d21:	89 e5                	mov    %esp,%ebp
+80106d23:	56                   	push   %esi
+80106d24:	53                   	push   %ebx
+80106d25:	8b 75 08             	mov    0x8(%ebp),%esi
+  acquire(&ptable.lock);
+80106d28:	83 ec 0c             	sub    $0xc,%esp
+80106d2b:	68 40 d8 90 80       	push   $0x8090d840
+80106d30:	e8 1b 08 00 00       	call   80107550 <acquire>
+  for(p = ptable.sleepq[SQHASH(chan)]; p; p = next){
+80106d35:	69 c6 b1 79 37 9e    	imul   $0x9e3779b1,%esi,%eax
+80106d3b:	83 c4 10             	add    $0x10,%esp
+80106d3e:	c1 e8 1a             	shr    $0x1a,%eax
+80106d41:	8b 1c 85 74 1c 91 80 	mov    -0x7f6ee38c(,%eax,4),%ebx
+80106d48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106d4f:	90                   	nop
+80106d50:	85 db                	test   %ebx,%ebx
+80106d52:	74 13                	je     80106d67 <wakeup+0x47>
+    next = p->snext;
+80106d54:	89 d8                	mov    %ebx,%eax
+80106d56:	8b 5b 34             	mov    0x34(%ebx),%ebx
+    if(p->chan == chan)
+80106d59:	3b 70 30             	cmp    0x30(%eax),%esi
+80106d5c:	75 f2                	jne    80106d50 <wakeup+0x30>
+      wake1(p);
+80106d5e:	e8 ed ee ff ff       	call   80105c50 <wake1>
+  for(p = ptable.sleepq[SQHASH(chan)]; p; p = next){
+80106d63:	85 db                	test   %ebx,%ebx
+80106d65:	75 ed                	jne    80106d54 <wakeup+0x34>
+  wakeup1(chan);
+  release(&ptable.lock);
+80106d67:	c7 45 08 40 d8 90 80 	movl   $0x8090d840,0x8(%ebp)
+}
+80106d6e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80106d71:	5b                   	pop    %ebx
+80106d72:	5e                   	pop    %esi
+80106d73:	5d                   	pop    %ebp
+  release(&ptable.lock);
+80106d74:	e9 77 07 00 00       	jmp    801074f0 <release>
+80106d79:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80106d80 <kill>:
+
+int
+kill(int pid)
+{
+80106d80:	55                   	push   %ebp
+80106d81:	89 e5                	mov    %esp,%ebp
+80106d83:	53                   	push   %ebx
+80106d84:	83 ec 10             	sub    $0x10,%esp
+80106d87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *p;
+
+  acquire(&ptable.lock);
+80106d8a:	68 40 d8 90 80       	push   $0x8090d840
+80106d8f:	e8 bc 07 00 00       	call   80107550 <acquire>
+  for(p = ptable.pidhash[PIDHASH(pid)]; p; p = p->pidnext)
+80106d94:	89 da                	mov    %ebx,%edx
+80106d96:	83 c4 10             	add    $0x10,%esp
+80106d99:	c1 fa 1f             	sar    $0x1f,%edx
+80106d9c:	c1 ea 1a             	shr    $0x1a,%edx
+80106d9f:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+80106da2:	83 e0 3f             	and    $0x3f,%eax
+80106da5:	29 d0                	sub    %edx,%eax
+80106da7:	8b 04 85 74 1d 91 80 	mov    -0x7f6ee28c(,%eax,4),%eax
+80106dae:	85 c0                	test   %eax,%eax
+80106db0:	75 0d                	jne    80106dbf <kill+0x3f>
+80106db2:	eb 4c                	jmp    80106e00 <kill+0x80>
+80106db4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106db8:	8b 40 3c             	mov    0x3c(%eax),%eax
+80106dbb:	85 c0                	test   %eax,%eax
+80106dbd:	74 41                	je     80106e00 <kill+0x80>
+    if(p->pid == pid)
+80106dbf:	3b 58 10             	cmp    0x10(%eax),%ebx
+80106dc2:	75 f4                	jne    80106db8 <kill+0x38>
+    release(&ptable.lock);
+    return -1;
+  }
+  p->killed = 1;
+  // Wake process from sleep if necessary.
+  if(p->state == SLEEPING)
+80106dc4:	83 78 0c 02          	cmpl   $0x2,0xc(%eax)
+  p->killed = 1;
+80106dc8:	c7 40 40 01 00 00 00 	movl   $0x1,0x40(%eax)
+  if(p->state == SLEEPING)
+80106dcf:	74 1f                	je     80106df0 <kill+0x70>
+    wake1(p);
+  release(&ptable.lock);
+80106dd1:	83 ec 0c             	sub    $0xc,%esp
+80106dd4:	68 40 d8 90 80       	push   $0x8090d840
+80106dd9:	e8 12 07 00 00       	call   801074f0 <release>
+  return 0;
+80106dde:	83 c4 10             	add    $0x10,%esp
+80106de1:	31 c0                	xor    %eax,%eax
+}
+80106de3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80106de6:	c9                   	leave
+80106de7:	c3                   	ret
+80106de8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106def:	90                   	nop
+    wake1(p);
+80106df0:	e8 5b ee ff ff       	call   80105c50 <wake1>
+80106df5:	eb da                	jmp    80106dd1 <kill+0x51>
+80106df7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106dfe:	66 90                	xchg   %ax,%ax
+    release(&ptable.lock);
+80106e00:	83 ec 0c             	sub    $0xc,%esp
+80106e03:	68 40 d8 90 80       	push   $0x8090d840
+80106e08:	e8 e3 06 00 00       	call   801074f0 <release>
+    return -1;
+80106e0d:	83 c4 10             	add    $0x10,%esp
+80106e10:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80106e15:	eb cc                	jmp    80106de3 <kill+0x63>
+80106e17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106e1e:	66 90                	xchg   %ax,%ax
+
+80106e20 <procdump>:
+
+//PAGEBREAK: 36
+void
+procdump(void)
+{
+80106e20:	55                   	push   %ebp
+80106e21:	89 e5                	mov    %esp,%ebp
+80106e23:	57                   	push   %edi
+80106e24:	56                   	push   %esi
+80106e25:	8d 75 e8             	lea    -0x18(%ebp),%esi
+80106e28:	53                   	push   %ebx
+80106e29:	bb fc d8 90 80       	mov    $0x8090d8fc,%ebx
+80106e2e:	83 ec 3c             	sub    $0x3c,%esp
+80106e31:	eb 27                	jmp    80106e5a <procdump+0x3a>
+80106e33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106e37:	90                   	nop
+    if(p->state == SLEEPING){
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+      for(i=0; i<10 && pc[i] != 0; i++)
+        cprintf(" %p", pc[i]);
+    }
+    cprintf("\n");
+80106e38:	83 ec 0c             	sub    $0xc,%esp
+80106e3b:	68 13 b9 10 80       	push   $0x8010b913
+80106e40:	e8 6b 9d ff ff       	call   80100bb0 <cprintf>
+80106e45:	83 c4 10             	add    $0x10,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+80106e48:	81 c3 10 01 00 00    	add    $0x110,%ebx
+80106e4e:	81 fb fc 1c 91 80    	cmp    $0x80911cfc,%ebx
+80106e54:	0f 84 96 00 00 00    	je     80106ef0 <procdump+0xd0>
+    if(p->state == UNUSED)
+80106e5a:	8b 43 84             	mov    -0x7c(%ebx),%eax
+80106e5d:	85 c0                	test   %eax,%eax
+80106e5f:	74 e7                	je     80106e48 <procdump+0x28>
+      state = "???";
+80106e61:	ba 0e b5 10 80       	mov    $0x8010b50e,%edx
+    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+80106e66:	83 f8 05             	cmp    $0x5,%eax
+80106e69:	77 11                	ja     80106e7c <procdump+0x5c>
+80106e6b:	8b 14 85 ac b5 10 80 	mov    -0x7fef4a54(,%eax,4),%edx
+      state = "???";
+80106e72:	b8 0e b5 10 80       	mov    $0x8010b50e,%eax
+80106e77:	85 d2                	test   %edx,%edx
+80106e79:	0f 44 d0             	cmove  %eax,%edx
+    cprintf("%d %s %s", p->pid, state, p->name);
+80106e7c:	53                   	push   %ebx
+80106e7d:	52                   	push   %edx
+80106e7e:	ff 73 88             	push   -0x78(%ebx)
+80106e81:	68 12 b5 10 80       	push   $0x8010b512
+80106e86:	e8 25 9d ff ff       	call   80100bb0 <cprintf>
+    cprintf("  prio=%d(base=%d)", p->eff_priority, p->base_priority);
+80106e8b:	83 c4 0c             	add    $0xc,%esp
+80106e8e:	ff 73 14             	push   0x14(%ebx)
+80106e91:	ff 73 18             	push   0x18(%ebx)
+80106e94:	68 1b b5 10 80       	push   $0x8010b51b
+80106e99:	e8 12 9d ff ff       	call   80100bb0 <cprintf>
+    if(p->state == SLEEPING){
+80106e9e:	83 c4 10             	add    $0x10,%esp
+80106ea1:	83 7b 84 02          	cmpl   $0x2,-0x7c(%ebx)
+80106ea5:	75 91                	jne    80106e38 <procdump+0x18>
+      getcallerpcs((uint*)p->context->ebp+2, pc);
+80106ea7:	83 ec 08             	sub    $0x8,%esp
+80106eaa:	8d 45 c0             	lea    -0x40(%ebp),%eax
+80106ead:	8d 7d c0             	lea    -0x40(%ebp),%edi
+80106eb0:	50                   	push   %eax
+80106eb1:	8b 43 a4             	mov    -0x5c(%ebx),%eax
+80106eb4:	8b 40 0c             	mov    0xc(%eax),%eax
+80106eb7:	83 c0 08             	add    $0x8,%eax
+80106eba:	50                   	push   %eax
+80106ebb:	e8 d0 04 00 00       	call   80107390 <getcallerpcs>
+      for(i=0; i<10 && pc[i] != 0; i++)
+80106ec0:	83 c4 10             	add    $0x10,%esp
+80106ec3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80106ec7:	90                   	nop
+80106ec8:	8b 17                	mov    (%edi),%edx
+80106eca:	85 d2                	test   %edx,%edx
+80106ecc:	0f 84 66 ff ff ff    	je     80106e38 <procdump+0x18>
+        cprintf(" %p", pc[i]);
+80106ed2:	83 ec 08             	sub    $0x8,%esp
+      for(i=0; i<10 && pc[i] != 0; i++)
+80106ed5:	83 c7 04             	add    $0x4,%edi
+        cprintf(" %p", pc[i]);
+80106ed8:	52                   	push   %edx
+80106ed9:	68 77 af 10 80       	push   $0x8010af77
+80106ede:	e8 cd 9c ff ff       	call   80100bb0 <cprintf>
+      for(i=0; i<10 && pc[i] != 0; i++)
+80106ee3:	83 c4 10             	add    $0x10,%esp
+80106ee6:	39 f7                	cmp    %esi,%edi
+80106ee8:	75 de                	jne    80106ec8 <procdump+0xa8>
+80106eea:	e9 49 ff ff ff       	jmp    80106e38 <procdump+0x18>
+80106eef:	90                   	nop
+  }
+
+  for(i = 0; i < ncpu; i++)
+80106ef0:	a1 04 cf 90 80       	mov    0x8090cf04,%eax
+80106ef5:	85 c0                	test   %eax,%eax
+80106ef7:	7e 2f                	jle    80106f28 <procdump+0x108>
+80106ef9:	bb 20 d5 90 80       	mov    $0x8090d520,%ebx
+80106efe:	31 f6                	xor    %esi,%esi
+    cprintf("cpu%d: runnable %d steals %d migrations %d\n", i,
+80106f00:	83 ec 0c             	sub    $0xc,%esp
+80106f03:	ff 73 0c             	push   0xc(%ebx)
+  for(i = 0; i < ncpu; i++)
+80106f06:	83 c3 70             	add    $0x70,%ebx
+    cprintf("cpu%d: runnable %d steals %d migrations %d\n", i,
+80106f09:	ff 73 98             	push   -0x68(%ebx)
+80106f0c:	ff 73 90             	push   -0x70(%ebx)
+80106f0f:	56                   	push   %esi
+  for(i = 0; i < ncpu; i++)
+80106f10:	83 c6 01             	add    $0x1,%esi
+    cprintf("cpu%d: runnable %d steals %d migrations %d\n", i,
+80106f13:	68 80 b5 10 80       	push   $0x8010b580
+80106f18:	e8 93 9c ff ff       	call   80100bb0 <cprintf>
+  for(i = 0; i < ncpu; i++)
+80106f1d:	83 c4 20             	add    $0x20,%esp
+80106f20:	39 35 04 cf 90 80    	cmp    %esi,0x8090cf04
+80106f26:	7f d8                	jg     80106f00 <procdump+0xe0>
+            runq[i].nrunnable, runq[i].nsteals, runq[i].nmigrations);
+}
+80106f28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80106f2b:	5b                   	pop    %ebx
+80106f2c:	5e                   	pop    %esi
+80106f2d:	5f                   	pop    %edi
+80106f2e:	5d                   	pop    %ebp
+80106f2f:	c3                   	ret
+
+80106f30 <setnice>:
+
+/* --------- HW3 helper for nice/priority ---------- */
+// Returns previous nice on success, -1 on error.
+int
+setnice(int pid, int value)
+{
+80106f30:	55                   	push   %ebp
+80106f31:	89 e5                	mov    %esp,%ebp
+80106f33:	57                   	push   %edi
+80106f34:	56                   	push   %esi
+80106f35:	53                   	push   %ebx
+80106f36:	83 ec 1c             	sub    $0x1c,%esp
+80106f39:	8b 75 0c             	mov    0xc(%ebp),%esi
+80106f3c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if (value < 0 || value > 4)
+80106f3f:	83 fe 04             	cmp    $0x4,%esi
+80106f42:	0f 87 20 01 00 00    	ja     80107068 <setnice+0x138>
+    return -1;
+
+  acquire(&ptable.lock);
+80106f48:	83 ec 0c             	sub    $0xc,%esp
+80106f4b:	68 40 d8 90 80       	push   $0x8090d840
+80106f50:	e8 fb 05 00 00       	call   80107550 <acquire>
+  for(p = ptable.pidhash[PIDHASH(pid)]; p; p = p->pidnext)
+80106f55:	89 fa                	mov    %edi,%edx
+80106f57:	83 c4 10             	add    $0x10,%esp
+80106f5a:	c1 fa 1f             	sar    $0x1f,%edx
+80106f5d:	c1 ea 1a             	shr    $0x1a,%edx
+80106f60:	8d 04 17             	lea    (%edi,%edx,1),%eax
+80106f63:	83 e0 3f             	and    $0x3f,%eax
+80106f66:	29 d0                	sub    %edx,%eax
+80106f68:	8b 1c 85 74 1d 91 80 	mov    -0x7f6ee28c(,%eax,4),%ebx
+80106f6f:	85 db                	test   %ebx,%ebx
+80106f71:	75 18                	jne    80106f8b <setnice+0x5b>
+80106f73:	e9 e0 00 00 00       	jmp    80107058 <setnice+0x128>
+80106f78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106f7f:	90                   	nop
+80106f80:	8b 5b 3c             	mov    0x3c(%ebx),%ebx
+80106f83:	85 db                	test   %ebx,%ebx
+80106f85:	0f 84 cd 00 00 00    	je     80107058 <setnice+0x128>
+    if(p->pid == pid)
+80106f8b:	3b 7b 10             	cmp    0x10(%ebx),%edi
+80106f8e:	75 f0                	jne    80106f80 <setnice+0x50>
+  struct proc *p = findproc(pid);
+  if (p != 0) {
+    int old = p->nice;
+80106f90:	8b 83 98 00 00 00    	mov    0x98(%ebx),%eax
+80106f96:	89 75 0c             	mov    %esi,0xc(%ebp)
+80106f99:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    uint readyat = p->readyat;
+80106f9c:	8b 83 f8 00 00 00    	mov    0xf8(%ebx),%eax
+80106fa2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+lockrq(struct proc *p)
+80106fa5:	eb 15                	jmp    80106fbc <setnice+0x8c>
+80106fa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80106fae:	66 90                	xchg   %ax,%ax
+    release(&rq->lock);
+80106fb0:	83 ec 0c             	sub    $0xc,%esp
+80106fb3:	56                   	push   %esi
+80106fb4:	e8 37 05 00 00       	call   801074f0 <release>
+    rq = &runq[p->cpu];
+80106fb9:	83 c4 10             	add    $0x10,%esp
+80106fbc:	6b bb d8 00 00 00 70 	imul   $0x70,0xd8(%ebx),%edi
+    acquire(&rq->lock);
+80106fc3:	83 ec 0c             	sub    $0xc,%esp
+    rq = &runq[p->cpu];
+80106fc6:	8d b7 c0 d4 90 80    	lea    -0x7f6f2b40(%edi),%esi
+    acquire(&rq->lock);
+80106fcc:	56                   	push   %esi
+80106fcd:	e8 7e 05 00 00       	call   80107550 <acquire>
+    if(rq == &runq[p->cpu])
+80106fd2:	6b 93 d8 00 00 00 70 	imul   $0x70,0xd8(%ebx),%edx
+80106fd9:	83 c4 10             	add    $0x10,%esp
+80106fdc:	39 d7                	cmp    %edx,%edi
+80106fde:	75 d0                	jne    80106fb0 <setnice+0x80>
+    struct runq *rq = lockrq(p);
+
+    // A queued process has to move to its new level.
+    if (p->state == RUNNABLE)
+80106fe0:	83 7b 0c 03          	cmpl   $0x3,0xc(%ebx)
+80106fe4:	89 f7                	mov    %esi,%edi
+80106fe6:	8b 75 0c             	mov    0xc(%ebp),%esi
+80106fe9:	74 35                	je     80107020 <setnice+0xf0>
+      rqremove(rq, p);
+    p->nice = value;
+80106feb:	89 b3 98 00 00 00    	mov    %esi,0x98(%ebx)
+    p->base_priority = value;
+80106ff1:	89 b3 9c 00 00 00    	mov    %esi,0x9c(%ebx)
+    p->eff_priority  = value;
+80106ff7:	89 b3 a0 00 00 00    	mov    %esi,0xa0(%ebx)
+#endif
+    if (p->state == RUNNABLE) {
+      setrunnable(rq, p);
+      p->readyat = readyat;    // still the same wait
+    }
+    release(&rq->lock);
+80106ffd:	83 ec 0c             	sub    $0xc,%esp
+80107000:	57                   	push   %edi
+80107001:	e8 ea 04 00 00       	call   801074f0 <release>
+
+    release(&ptable.lock);
+80107006:	c7 04 24 40 d8 90 80 	movl   $0x8090d840,(%esp)
+8010700d:	e8 de 04 00 00       	call   801074f0 <release>
+    return old;
+80107012:	83 c4 10             	add    $0x10,%esp
+  }
+  release(&ptable.lock);
+  return -1;
+}
+80107015:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+80107018:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010701b:	5b                   	pop    %ebx
+8010701c:	5e                   	pop    %esi
+8010701d:	5f                   	pop    %edi
+8010701e:	5d                   	pop    %ebp
+8010701f:	c3                   	ret
+      rqremove(rq, p);
+80107020:	89 da                	mov    %ebx,%edx
+80107022:	89 f8                	mov    %edi,%eax
+80107024:	e8 77 e7 ff ff       	call   801057a0 <rqremove>
+    if (p->state == RUNNABLE) {
+80107029:	83 7b 0c 03          	cmpl   $0x3,0xc(%ebx)
+    p->nice = value;
+8010702d:	89 b3 98 00 00 00    	mov    %esi,0x98(%ebx)
+    p->base_priority = value;
+80107033:	89 b3 9c 00 00 00    	mov    %esi,0x9c(%ebx)
+    p->eff_priority  = value;
+80107039:	89 b3 a0 00 00 00    	mov    %esi,0xa0(%ebx)
+    if (p->state == RUNNABLE) {
+8010703f:	75 bc                	jne    80106ffd <setnice+0xcd>
+      setrunnable(rq, p);
+80107041:	89 f8                	mov    %edi,%eax
+80107043:	89 da                	mov    %ebx,%edx
+80107045:	e8 d6 ea ff ff       	call   80105b20 <setrunnable>
+      p->readyat = readyat;    // still the same wait
+8010704a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+8010704d:	89 83 f8 00 00 00    	mov    %eax,0xf8(%ebx)
+80107053:	eb a8                	jmp    80106ffd <setnice+0xcd>
+80107055:	8d 76 00             	lea    0x0(%esi),%esi
+  release(&ptable.lock);
+80107058:	83 ec 0c             	sub    $0xc,%esp
+8010705b:	68 40 d8 90 80       	push   $0x8090d840
+80107060:	e8 8b 04 00 00       	call   801074f0 <release>
+  return -1;
+80107065:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80107068:	c7 45 e4 ff ff ff ff 	movl   $0xffffffff,-0x1c(%ebp)
+8010706f:	eb a4                	jmp    80107015 <setnice+0xe5>
+80107071:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107078:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010707f:	90                   	nop
+
+80107080 <settickets>:
+  release(&ptable.lock);
+  return old;
+#else
+  return -1;
+#endif
+}
+80107080:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107085:	c3                   	ret
+80107086:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010708d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107090 <lendtickets>:
+  release(&ptable.lock);
+  return 0;
+#else
+  return -1;
+#endif
+}
+80107090:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107095:	c3                   	ret
+80107096:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010709d:	8d 76 00             	lea    0x0(%esi),%esi
+
+801070a0 <getpstat>:
+
+// Copy scheduler statistics for up to n processes out to
+// user address uva. Returns the number copied, or -1.
+int
+getpstat(uint uva, int n)
+{
+801070a0:	55                   	push   %ebp
+801070a1:	89 e5                	mov    %esp,%ebp
+801070a3:	57                   	push   %edi
+  struct proc *p;
+  struct pstat ps;
+  int i;
+
+  i = 0;
+801070a4:	31 ff                	xor    %edi,%edi
+{
+801070a6:	56                   	push   %esi
+801070a7:	53                   	push   %ebx
+801070a8:	83 ec 5c             	sub    $0x5c,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC] && i < n; p++){
+801070ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+801070ae:	85 c0                	test   %eax,%eax
+801070b0:	0f 8e 01 01 00 00    	jle    801071b7 <getpstat+0x117>
+801070b6:	be 74 d8 90 80       	mov    $0x8090d874,%esi
+801070bb:	e9 be 00 00 00       	jmp    8010717e <getpstat+0xde>
+    acquire(&ptable.lock);
+    if(p->state == UNUSED){
+      release(&ptable.lock);
+      continue;
+    }
+    ps.pid = p->pid;
+801070c0:	8b 4e 10             	mov    0x10(%esi),%ecx
+    ps.state = p->state;
+    safestrcpy(ps.name, p->name, sizeof(ps.name));
+801070c3:	83 ec 04             	sub    $0x4,%esp
+    ps.state = p->state;
+801070c6:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+    safestrcpy(ps.name, p->name, sizeof(ps.name));
+801070c9:	8d 86 88 00 00 00    	lea    0x88(%esi),%eax
+    ps.pid = p->pid;
+801070cf:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+    safestrcpy(ps.name, p->name, sizeof(ps.name));
+801070d2:	6a 10                	push   $0x10
+801070d4:	50                   	push   %eax
+801070d5:	8d 45 b8             	lea    -0x48(%ebp),%eax
+801070d8:	50                   	push   %eax
+801070d9:	e8 02 07 00 00       	call   801077e0 <safestrcpy>
+    ps.cpu = p->cpu;
+801070de:	8b 86 98 00 00 00    	mov    0x98(%esi),%eax
+801070e4:	8b 9e a0 00 00 00    	mov    0xa0(%esi),%ebx
+801070ea:	8b 8e d8 00 00 00    	mov    0xd8(%esi),%ecx
+801070f0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    ps.nice = p->nice;
+    ps.prio = p->eff_priority;
+    ps.runticks = p->runticks;
+801070f3:	8b 86 00 01 00 00    	mov    0x100(%esi),%eax
+    ps.cpu = p->cpu;
+801070f9:	89 4d c8             	mov    %ecx,-0x38(%ebp)
+    ps.runticks = p->runticks;
+801070fc:	8b 8e fc 00 00 00    	mov    0xfc(%esi),%ecx
+80107102:	89 45 d8             	mov    %eax,-0x28(%ebp)
+80107105:	8b 86 08 01 00 00    	mov    0x108(%esi),%eax
+    ps.cpu = p->cpu;
+8010710b:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    ps.runticks = p->runticks;
+8010710e:	8b 9e 04 01 00 00    	mov    0x104(%esi),%ebx
+80107114:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80107117:	8b 86 0c 01 00 00    	mov    0x10c(%esi),%eax
+8010711d:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+80107120:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+80107123:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+    ps.nswitch = p->nswitch;
+    ps.nboost = p->nboost;
+    release(&ptable.lock);
+
+    // copyout() may allocate, so not under ptable.lock.
+    if(copyout(myproc()->pgdir, uva + i*sizeof(ps), &ps, sizeof(ps)) < 0)
+80107126:	6b df 38             	imul   $0x38,%edi,%ebx
+    release(&ptable.lock);
+80107129:	c7 04 24 40 d8 90 80 	movl   $0x8090d840,(%esp)
+80107130:	e8 bb 03 00 00       	call   801074f0 <release>
+    if(copyout(myproc()->pgdir, uva + i*sizeof(ps), &ps, sizeof(ps)) < 0)
+80107135:	03 5d 08             	add    0x8(%ebp),%ebx
+80107138:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+  pushcli();
+8010713b:	e8 c0 02 00 00       	call   80107400 <pushcli>
+  c = mycpu();
+80107140:	e8 5b e9 ff ff       	call   80105aa0 <mycpu>
+  p = c->proc;
+80107145:	8b 98 ac 00 00 00    	mov    0xac(%eax),%ebx
+  popcli();
+8010714b:	e8 00 03 00 00       	call   80107450 <popcli>
+    if(copyout(myproc()->pgdir, uva + i*sizeof(ps), &ps, sizeof(ps)) < 0)
+80107150:	8d 45 b0             	lea    -0x50(%ebp),%eax
+80107153:	6a 38                	push   $0x38
+80107155:	50                   	push   %eax
+80107156:	ff 75 a4             	push   -0x5c(%ebp)
+80107159:	ff 73 04             	push   0x4(%ebx)
+8010715c:	e8 af 3a 00 00       	call   8010ac10 <copyout>
+80107161:	83 c4 20             	add    $0x20,%esp
+80107164:	85 c0                	test   %eax,%eax
+80107166:	78 60                	js     801071c8 <getpstat+0x128>
+  for(p = ptable.proc; p < &ptable.proc[NPROC] && i < n; p++){
+80107168:	81 c6 10 01 00 00    	add    $0x110,%esi
+      return -1;
+    i++;
+8010716e:	83 c7 01             	add    $0x1,%edi
+  for(p = ptable.proc; p < &ptable.proc[NPROC] && i < n; p++){
+80107171:	81 fe 74 1c 91 80    	cmp    $0x80911c74,%esi
+80107177:	73 3e                	jae    801071b7 <getpstat+0x117>
+80107179:	3b 7d 0c             	cmp    0xc(%ebp),%edi
+8010717c:	7d 39                	jge    801071b7 <getpstat+0x117>
+    acquire(&ptable.lock);
+8010717e:	83 ec 0c             	sub    $0xc,%esp
+80107181:	68 40 d8 90 80       	push   $0x8090d840
+80107186:	e8 c5 03 00 00       	call   80107550 <acquire>
+    if(p->state == UNUSED){
+8010718b:	8b 46 0c             	mov    0xc(%esi),%eax
+8010718e:	83 c4 10             	add    $0x10,%esp
+80107191:	85 c0                	test   %eax,%eax
+80107193:	0f 85 27 ff ff ff    	jne    801070c0 <getpstat+0x20>
+      release(&ptable.lock);
+80107199:	83 ec 0c             	sub    $0xc,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC] && i < n; p++){
+8010719c:	81 c6 10 01 00 00    	add    $0x110,%esi
+      release(&ptable.lock);
+801071a2:	68 40 d8 90 80       	push   $0x8090d840
+801071a7:	e8 44 03 00 00       	call   801074f0 <release>
+      continue;
+801071ac:	83 c4 10             	add    $0x10,%esp
+  for(p = ptable.proc; p < &ptable.proc[NPROC] && i < n; p++){
+801071af:	81 fe 74 1c 91 80    	cmp    $0x80911c74,%esi
+801071b5:	72 c2                	jb     80107179 <getpstat+0xd9>
+  }
+  return i;
+}
+801071b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801071ba:	89 f8                	mov    %edi,%eax
+801071bc:	5b                   	pop    %ebx
+801071bd:	5e                   	pop    %esi
+801071be:	5f                   	pop    %edi
+801071bf:	5d                   	pop    %ebp
+801071c0:	c3                   	ret
+801071c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801071c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+801071cb:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+}
+801071d0:	5b                   	pop    %ebx
+801071d1:	89 f8                	mov    %edi,%eax
+801071d3:	5e                   	pop    %esi
+801071d4:	5f                   	pop    %edi
+801071d5:	5d                   	pop    %ebp
+801071d6:	c3                   	ret
+801071d7:	66 90                	xchg   %ax,%ax
+801071d9:	66 90                	xchg   %ax,%ax
+801071db:	66 90                	xchg   %ax,%ax
+801071dd:	66 90                	xchg   %ax,%ax
+801071df:	90                   	nop
+
+801071e0 <initsleeplock>:
+#include "spinlock.h"
+#include "sleeplock.h"
+
+void
+initsleeplock(struct sleeplock *lk, char *name)
+{
+801071e0:	55                   	push   %ebp
+801071e1:	89 e5                	mov    %esp,%ebp
+801071e3:	53                   	push   %ebx
+801071e4:	83 ec 0c             	sub    $0xc,%esp
+801071e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  initlock(&lk->lk, "sleep lock");
+801071ea:	68 c4 b5 10 80       	push   $0x8010b5c4
+801071ef:	8d 43 04             	lea    0x4(%ebx),%eax
+801071f2:	50                   	push   %eax
+801071f3:	e8 78 01 00 00       	call   80107370 <initlock>
+  lk->name = name;
+801071f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  lk->locked = 0;
+801071fb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+}
+80107201:	83 c4 10             	add    $0x10,%esp
+  lk->pid = 0;
+80107204:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+  lk->name = name;
+8010720b:	89 43 38             	mov    %eax,0x38(%ebx)
+}
+8010720e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107211:	c9                   	leave
+80107212:	c3                   	ret
+80107213:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010721a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107220 <acquiresleep>:
+
+void
+acquiresleep(struct sleeplock *lk)
+{
+80107220:	55                   	push   %ebp
+80107221:	89 e5                	mov    %esp,%ebp
+80107223:	56                   	push   %esi
+80107224:	53                   	push   %ebx
+80107225:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+80107228:	8d 73 04             	lea    0x4(%ebx),%esi
+8010722b:	83 ec 0c             	sub    $0xc,%esp
+8010722e:	56                   	push   %esi
+8010722f:	e8 1c 03 00 00       	call   80107550 <acquire>
+  while (lk->locked) {
+80107234:	8b 13                	mov    (%ebx),%edx
+80107236:	83 c4 10             	add    $0x10,%esp
+80107239:	85 d2                	test   %edx,%edx
+8010723b:	74 16                	je     80107253 <acquiresleep+0x33>
+8010723d:	8d 76 00             	lea    0x0(%esi),%esi
+    sleep(lk, &lk->lk);
+80107240:	83 ec 08             	sub    $0x8,%esp
+80107243:	56                   	push   %esi
+80107244:	53                   	push   %ebx
+80107245:	e8 a6 f7 ff ff       	call   801069f0 <sleep>
+  while (lk->locked) {
+8010724a:	8b 03                	mov    (%ebx),%eax
+8010724c:	83 c4 10             	add    $0x10,%esp
+8010724f:	85 c0                	test   %eax,%eax
+80107251:	75 ed                	jne    80107240 <acquiresleep+0x20>
+  }
+  lk->locked = 1;
+80107253:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  lk->pid = myproc()->pid;
+80107259:	e8 22 eb ff ff       	call   80105d80 <myproc>
+8010725e:	8b 40 10             	mov    0x10(%eax),%eax
+80107261:	89 43 3c             	mov    %eax,0x3c(%ebx)
+  release(&lk->lk);
+80107264:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+80107267:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010726a:	5b                   	pop    %ebx
+8010726b:	5e                   	pop    %esi
+8010726c:	5d                   	pop    %ebp
+  release(&lk->lk);
+8010726d:	e9 7e 02 00 00       	jmp    801074f0 <release>
+80107272:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107279:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107280 <tryacquiresleep>:
+
+// Acquire lk only if no one holds it.
+// Returns 1 if it was acquired, 0 if not.
+int
+tryacquiresleep(struct sleeplock *lk)
+{
+80107280:	55                   	push   %ebp
+80107281:	89 e5                	mov    %esp,%ebp
+80107283:	57                   	push   %edi
+80107284:	56                   	push   %esi
+80107285:	53                   	push   %ebx
+80107286:	83 ec 18             	sub    $0x18,%esp
+80107289:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+
+  acquire(&lk->lk);
+8010728c:	8d 73 04             	lea    0x4(%ebx),%esi
+8010728f:	56                   	push   %esi
+80107290:	e8 bb 02 00 00       	call   80107550 <acquire>
+  r = !lk->locked;
+80107295:	8b 13                	mov    (%ebx),%edx
+80107297:	31 c0                	xor    %eax,%eax
+80107299:	83 c4 10             	add    $0x10,%esp
+8010729c:	85 d2                	test   %edx,%edx
+8010729e:	0f 94 c0             	sete   %al
+801072a1:	89 c7                	mov    %eax,%edi
+  if(r){
+801072a3:	74 1b                	je     801072c0 <tryacquiresleep+0x40>
+    lk->locked = 1;
+    lk->pid = myproc()->pid;
+  }
+  release(&lk->lk);
+801072a5:	83 ec 0c             	sub    $0xc,%esp
+801072a8:	56                   	push   %esi
+801072a9:	e8 42 02 00 00       	call   801074f0 <release>
+  return r;
+}
+801072ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801072b1:	89 f8                	mov    %edi,%eax
+801072b3:	5b                   	pop    %ebx
+801072b4:	5e                   	pop    %esi
+801072b5:	5f                   	pop    %edi
+801072b6:	5d                   	pop    %ebp
+801072b7:	c3                   	ret
+801072b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801072bf:	90                   	nop
+    lk->locked = 1;
+801072c0:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+    lk->pid = myproc()->pid;
+801072c6:	e8 b5 ea ff ff       	call   80105d80 <myproc>
+801072cb:	8b 40 10             	mov    0x10(%eax),%eax
+801072ce:	89 43 3c             	mov    %eax,0x3c(%ebx)
+801072d1:	eb d2                	jmp    801072a5 <tryacquiresleep+0x25>
+801072d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801072da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801072e0 <releasesleep>:
+
+void
+releasesleep(struct sleeplock *lk)
+{
+801072e0:	55                   	push   %ebp
+801072e1:	89 e5                	mov    %esp,%ebp
+801072e3:	56                   	push   %esi
+801072e4:	53                   	push   %ebx
+801072e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  acquire(&lk->lk);
+801072e8:	8d 73 04             	lea    0x4(%ebx),%esi
+801072eb:	83 ec 0c             	sub    $0xc,%esp
+801072ee:	56                   	push   %esi
+801072ef:	e8 5c 02 00 00       	call   80107550 <acquire>
+  lk->locked = 0;
+801072f4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  lk->pid = 0;
+801072fa:	c7 43 3c 00 00 00 00 	movl   $0x0,0x3c(%ebx)
+  wakeup(lk);
+80107301:	89 1c 24             	mov    %ebx,(%esp)
+80107304:	e8 17 fa ff ff       	call   80106d20 <wakeup>
+  release(&lk->lk);
+80107309:	89 75 08             	mov    %esi,0x8(%ebp)
+8010730c:	83 c4 10             	add    $0x10,%esp
+}
+8010730f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107312:	5b                   	pop    %ebx
+80107313:	5e                   	pop    %esi
+80107314:	5d                   	pop    %ebp
+  release(&lk->lk);
+80107315:	e9 d6 01 00 00       	jmp    801074f0 <release>
+8010731a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107320 <holdingsleep>:
+
+int
+holdingsleep(struct sleeplock *lk)
+{
+80107320:	55                   	push   %ebp
+80107321:	89 e5                	mov    %esp,%ebp
+80107323:	57                   	push   %edi
+80107324:	31 ff                	xor    %edi,%edi
+80107326:	56                   	push   %esi
+80107327:	53                   	push   %ebx
+80107328:	83 ec 18             	sub    $0x18,%esp
+8010732b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  
+  acquire(&lk->lk);
+8010732e:	8d 73 04             	lea    0x4(%ebx),%esi
+80107331:	56                   	push   %esi
+80107332:	e8 19 02 00 00       	call   80107550 <acquire>
+  r = lk->locked && (lk->pid == myproc()->pid);
+80107337:	8b 03                	mov    (%ebx),%eax
+80107339:	83 c4 10             	add    $0x10,%esp
+8010733c:	85 c0                	test   %eax,%eax
+8010733e:	75 18                	jne    80107358 <holdingsleep+0x38>
+  release(&lk->lk);
+80107340:	83 ec 0c             	sub    $0xc,%esp
+80107343:	56                   	push   %esi
+80107344:	e8 a7 01 00 00       	call   801074f0 <release>
+  return r;
+}
+80107349:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010734c:	89 f8                	mov    %edi,%eax
+8010734e:	5b                   	pop    %ebx
+8010734f:	5e                   	pop    %esi
+80107350:	5f                   	pop    %edi
+80107351:	5d                   	pop    %ebp
+80107352:	c3                   	ret
+80107353:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107357:	90                   	nop
+  r = lk->locked && (lk->pid == myproc()->pid);
+80107358:	8b 5b 3c             	mov    0x3c(%ebx),%ebx
+8010735b:	e8 20 ea ff ff       	call   80105d80 <myproc>
+80107360:	39 58 10             	cmp    %ebx,0x10(%eax)
+80107363:	0f 94 c0             	sete   %al
+80107366:	0f b6 c0             	movzbl %al,%eax
+80107369:	89 c7                	mov    %eax,%edi
+8010736b:	eb d3                	jmp    80107340 <holdingsleep+0x20>
+8010736d:	66 90                	xchg   %ax,%ax
+8010736f:	90                   	nop
+
+80107370 <initlock>:
+#include "proc.h"
+#include "spinlock.h"
+
+void
+initlock(struct spinlock *lk, char *name)
+{
+80107370:	55                   	push   %ebp
+80107371:	89 e5                	mov    %esp,%ebp
+80107373:	8b 45 08             	mov    0x8(%ebp),%eax
+  lk->name = name;
+80107376:	8b 55 0c             	mov    0xc(%ebp),%edx
+  lk->locked = 0;
+80107379:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  lk->name = name;
+8010737f:	89 50 04             	mov    %edx,0x4(%eax)
+  lk->cpu = 0;
+80107382:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+}
+80107389:	5d                   	pop    %ebp
+8010738a:	c3                   	ret
+8010738b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010738f:	90                   	nop
+
+80107390 <getcallerpcs>:
+}
+
+// Record the current call stack in pcs[] by following the %ebp chain.
+void
+getcallerpcs(void *v, uint pcs[])
+{
+80107390:	55                   	push   %ebp
+80107391:	89 e5                	mov    %esp,%ebp
+80107393:	53                   	push   %ebx
+80107394:	8b 45 08             	mov    0x8(%ebp),%eax
+80107397:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  uint *ebp;
+  int i;
+
+  ebp = (uint*)v - 2;
+8010739a:	8d 50 f8             	lea    -0x8(%eax),%edx
+  for(i = 0; i < 10; i++){
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+8010739d:	05 f8 ff ff 7f       	add    $0x7ffffff8,%eax
+801073a2:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+  for(i = 0; i < 10; i++){
+801073a7:	b8 00 00 00 00       	mov    $0x0,%eax
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+801073ac:	76 10                	jbe    801073be <getcallerpcs+0x2e>
+801073ae:	eb 28                	jmp    801073d8 <getcallerpcs+0x48>
+801073b0:	8d 9a 00 00 00 80    	lea    -0x80000000(%edx),%ebx
+801073b6:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+801073bc:	77 1a                	ja     801073d8 <getcallerpcs+0x48>
+      break;
+    pcs[i] = ebp[1];     // saved %eip
+801073be:	8b 5a 04             	mov    0x4(%edx),%ebx
+801073c1:	89 1c 81             	mov    %ebx,(%ecx,%eax,4)
+  for(i = 0; i < 10; i++){
+801073c4:	83 c0 01             	add    $0x1,%eax
+    ebp = (uint*)ebp[0]; // saved %ebp
+801073c7:	8b 12                	mov    (%edx),%edx
+  for(i = 0; i < 10; i++){
+801073c9:	83 f8 0a             	cmp    $0xa,%eax
+801073cc:	75 e2                	jne    801073b0 <getcallerpcs+0x20>
+  }
+  for(; i < 10; i++)
+    pcs[i] = 0;
+}
+801073ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801073d1:	c9                   	leave
+801073d2:	c3                   	ret
+801073d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801073d7:	90                   	nop
+801073d8:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+801073db:	8d 51 28             	lea    0x28(%ecx),%edx
+801073de:	66 90                	xchg   %ax,%ax
+    pcs[i] = 0;
+801073e0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(; i < 10; i++)
+801073e6:	83 c0 04             	add    $0x4,%eax
+801073e9:	39 d0                	cmp    %edx,%eax
+801073eb:	75 f3                	jne    801073e0 <getcallerpcs+0x50>
+}
+801073ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801073f0:	c9                   	leave
+801073f1:	c3                   	ret
+801073f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801073f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107400 <pushcli>:
+// it takes two popcli to undo two pushcli.  Also, if interrupts
+// are off, then pushcli, popcli leaves them off.
+
+void
+pushcli(void)
+{
+80107400:	55                   	push   %ebp
+80107401:	89 e5                	mov    %esp,%ebp
+80107403:	53                   	push   %ebx
+80107404:	83 ec 04             	sub    $0x4,%esp
+80107407:	9c                   	pushf
+80107408:	5b                   	pop    %ebx
+  asm volatile("cli");
+80107409:	fa                   	cli
+  int eflags;
+
+  eflags = readeflags();
+  cli();
+  if(mycpu()->ncli == 0)
+8010740a:	e8 91 e6 ff ff       	call   80105aa0 <mycpu>
+8010740f:	8b 80 a4 00 00 00    	mov    0xa4(%eax),%eax
+80107415:	85 c0                	test   %eax,%eax
+80107417:	74 17                	je     80107430 <pushcli+0x30>
+    mycpu()->intena = eflags & FL_IF;
+  mycpu()->ncli += 1;
+80107419:	e8 82 e6 ff ff       	call   80105aa0 <mycpu>
+8010741e:	83 80 a4 00 00 00 01 	addl   $0x1,0xa4(%eax)
+}
+80107425:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107428:	c9                   	leave
+80107429:	c3                   	ret
+8010742a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mycpu()->intena = eflags & FL_IF;
+80107430:	e8 6b e6 ff ff       	call   80105aa0 <mycpu>
+80107435:	81 e3 00 02 00 00    	and    $0x200,%ebx
+8010743b:	89 98 a8 00 00 00    	mov    %ebx,0xa8(%eax)
+80107441:	eb d6                	jmp    80107419 <pushcli+0x19>
+80107443:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010744a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107450 <popcli>:
+
+void
+popcli(void)
+{
+80107450:	55                   	push   %ebp
+80107451:	89 e5                	mov    %esp,%ebp
+80107453:	83 ec 08             	sub    $0x8,%esp
+  asm volatile("pushfl; popl %0" : "=r" (eflags));
+80107456:	9c                   	pushf
+80107457:	58                   	pop    %eax
+  if(readeflags()&FL_IF)
+80107458:	f6 c4 02             	test   $0x2,%ah
+8010745b:	75 35                	jne    80107492 <popcli+0x42>
+    panic("popcli - interruptible");
+  if(--mycpu()->ncli < 0)
+8010745d:	e8 3e e6 ff ff       	call   80105aa0 <mycpu>
+80107462:	83 a8 a4 00 00 00 01 	subl   $0x1,0xa4(%eax)
+80107469:	78 34                	js     8010749f <popcli+0x4f>
+    panic("popcli");
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+8010746b:	e8 30 e6 ff ff       	call   80105aa0 <mycpu>
+80107470:	8b 90 a4 00 00 00    	mov    0xa4(%eax),%edx
+80107476:	85 d2                	test   %edx,%edx
+80107478:	74 06                	je     80107480 <popcli+0x30>
+    sti();
+}
+8010747a:	c9                   	leave
+8010747b:	c3                   	ret
+8010747c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  if(mycpu()->ncli == 0 && mycpu()->intena)
+80107480:	e8 1b e6 ff ff       	call   80105aa0 <mycpu>
+80107485:	8b 80 a8 00 00 00    	mov    0xa8(%eax),%eax
+8010748b:	85 c0                	test   %eax,%eax
+8010748d:	74 eb                	je     8010747a <popcli+0x2a>
+  asm volatile("sti");
+8010748f:	fb                   	sti
+}
+80107490:	c9                   	leave
+80107491:	c3                   	ret
+    panic("popcli - interruptible");
+80107492:	83 ec 0c             	sub    $0xc,%esp
+80107495:	68 cf b5 10 80       	push   $0x8010b5cf
+8010749a:	e8 e1 93 ff ff       	call   80100880 <panic>
+    panic("popcli");
+8010749f:	83 ec 0c             	sub    $0xc,%esp
+801074a2:	68 e6 b5 10 80       	push   $0x8010b5e6
+801074a7:	e8 d4 93 ff ff       	call   80100880 <panic>
+801074ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801074b0 <holding>:
+{
+801074b0:	55                   	push   %ebp
+801074b1:	89 e5                	mov    %esp,%ebp
+801074b3:	56                   	push   %esi
+801074b4:	53                   	push   %ebx
+801074b5:	8b 75 08             	mov    0x8(%ebp),%esi
+801074b8:	31 db                	xor    %ebx,%ebx
+  pushcli();
+801074ba:	e8 41 ff ff ff       	call   80107400 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+801074bf:	8b 06                	mov    (%esi),%eax
+801074c1:	85 c0                	test   %eax,%eax
+801074c3:	75 0b                	jne    801074d0 <holding+0x20>
+  popcli();
+801074c5:	e8 86 ff ff ff       	call   80107450 <popcli>
+}
+801074ca:	89 d8                	mov    %ebx,%eax
+801074cc:	5b                   	pop    %ebx
+801074cd:	5e                   	pop    %esi
+801074ce:	5d                   	pop    %ebp
+801074cf:	c3                   	ret
+  r = lock->locked && lock->cpu == mycpu();
+801074d0:	8b 5e 08             	mov    0x8(%esi),%ebx
+801074d3:	e8 c8 e5 ff ff       	call   80105aa0 <mycpu>
+801074d8:	39 c3                	cmp    %eax,%ebx
+801074da:	0f 94 c3             	sete   %bl
+  popcli();
+801074dd:	e8 6e ff ff ff       	call   80107450 <popcli>
+  r = lock->locked && lock->cpu == mycpu();
+801074e2:	0f b6 db             	movzbl %bl,%ebx
+}
+801074e5:	89 d8                	mov    %ebx,%eax
+801074e7:	5b                   	pop    %ebx
+801074e8:	5e                   	pop    %esi
+801074e9:	5d                   	pop    %ebp
+801074ea:	c3                   	ret
+801074eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801074ef:	90                   	nop
+
+801074f0 <release>:
+{
+801074f0:	55                   	push   %ebp
+801074f1:	89 e5                	mov    %esp,%ebp
+801074f3:	56                   	push   %esi
+801074f4:	53                   	push   %ebx
+801074f5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+801074f8:	e8 03 ff ff ff       	call   80107400 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+801074fd:	8b 03                	mov    (%ebx),%eax
+801074ff:	85 c0                	test   %eax,%eax
+80107501:	75 15                	jne    80107518 <release+0x28>
+  popcli();
+80107503:	e8 48 ff ff ff       	call   80107450 <popcli>
+    panic("release");
+80107508:	83 ec 0c             	sub    $0xc,%esp
+8010750b:	68 ed b5 10 80       	push   $0x8010b5ed
+80107510:	e8 6b 93 ff ff       	call   80100880 <panic>
+80107515:	8d 76 00             	lea    0x0(%esi),%esi
+  r = lock->locked && lock->cpu == mycpu();
+80107518:	8b 73 08             	mov    0x8(%ebx),%esi
+8010751b:	e8 80 e5 ff ff       	call   80105aa0 <mycpu>
+80107520:	39 c6                	cmp    %eax,%esi
+80107522:	75 df                	jne    80107503 <release+0x13>
+  popcli();
+80107524:	e8 27 ff ff ff       	call   80107450 <popcli>
+  lk->pcs[0] = 0;
+80107529:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+  lk->cpu = 0;
+80107530:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  __sync_synchronize();
+80107537:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  asm volatile("movl $0, %0" : "+m" (lk->locked) : );
+8010753c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+}
+80107542:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107545:	5b                   	pop    %ebx
+80107546:	5e                   	pop    %esi
+80107547:	5d                   	pop    %ebp
+  popcli();
+80107548:	e9 03 ff ff ff       	jmp    80107450 <popcli>
+8010754d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107550 <acquire>:
+{
+80107550:	55                   	push   %ebp
+80107551:	89 e5                	mov    %esp,%ebp
+80107553:	53                   	push   %ebx
+80107554:	83 ec 04             	sub    $0x4,%esp
+  pushcli(); // disable interrupts to avoid deadlock.
+80107557:	e8 a4 fe ff ff       	call   80107400 <pushcli>
+  if(holding(lk))
+8010755c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  pushcli();
+8010755f:	e8 9c fe ff ff       	call   80107400 <pushcli>
+  r = lock->locked && lock->cpu == mycpu();
+80107564:	8b 03                	mov    (%ebx),%eax
+80107566:	85 c0                	test   %eax,%eax
+80107568:	0f 85 9a 00 00 00    	jne    80107608 <acquire+0xb8>
+  popcli();
+8010756e:	e8 dd fe ff ff       	call   80107450 <popcli>
+  asm volatile("lock; xchgl %0, %1" :
+80107573:	b9 01 00 00 00       	mov    $0x1,%ecx
+80107578:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010757f:	90                   	nop
+  while(xchg(&lk->locked, 1) != 0)
+80107580:	8b 55 08             	mov    0x8(%ebp),%edx
+80107583:	89 c8                	mov    %ecx,%eax
+80107585:	f0 87 02             	lock xchg %eax,(%edx)
+80107588:	85 c0                	test   %eax,%eax
+8010758a:	75 f4                	jne    80107580 <acquire+0x30>
+  __sync_synchronize();
+8010758c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  lk->cpu = mycpu();
+80107591:	8b 5d 08             	mov    0x8(%ebp),%ebx
+80107594:	e8 07 e5 ff ff       	call   80105aa0 <mycpu>
+  getcallerpcs(&lk, lk->pcs);
+80107599:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  for(i = 0; i < 10; i++){
+8010759c:	31 d2                	xor    %edx,%edx
+  lk->cpu = mycpu();
+8010759e:	89 43 08             	mov    %eax,0x8(%ebx)
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+801075a1:	8d 85 00 00 00 80    	lea    -0x80000000(%ebp),%eax
+801075a7:	3d fe ff ff 7f       	cmp    $0x7ffffffe,%eax
+801075ac:	77 32                	ja     801075e0 <acquire+0x90>
+  ebp = (uint*)v - 2;
+801075ae:	89 e8                	mov    %ebp,%eax
+801075b0:	eb 14                	jmp    801075c6 <acquire+0x76>
+801075b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(ebp == 0 || ebp < (uint*)KERNBASE || ebp == (uint*)0xffffffff)
+801075b8:	8d 98 00 00 00 80    	lea    -0x80000000(%eax),%ebx
+801075be:	81 fb fe ff ff 7f    	cmp    $0x7ffffffe,%ebx
+801075c4:	77 1a                	ja     801075e0 <acquire+0x90>
+    pcs[i] = ebp[1];     // saved %eip
+801075c6:	8b 58 04             	mov    0x4(%eax),%ebx
+801075c9:	89 5c 91 0c          	mov    %ebx,0xc(%ecx,%edx,4)
+  for(i = 0; i < 10; i++){
+801075cd:	83 c2 01             	add    $0x1,%edx
+    ebp = (uint*)ebp[0]; // saved %ebp
+801075d0:	8b 00                	mov    (%eax),%eax
+  for(i = 0; i < 10; i++){
+801075d2:	83 fa 0a             	cmp    $0xa,%edx
+801075d5:	75 e1                	jne    801075b8 <acquire+0x68>
+}
+801075d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801075da:	c9                   	leave
+801075db:	c3                   	ret
+801075dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801075e0:	8d 44 91 0c          	lea    0xc(%ecx,%edx,4),%eax
+801075e4:	8d 51 34             	lea    0x34(%ecx),%edx
+801075e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801075ee:	66 90                	xchg   %ax,%ax
+    pcs[i] = 0;
+801075f0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  for(; i < 10; i++)
+801075f6:	83 c0 04             	add    $0x4,%eax
+801075f9:	39 c2                	cmp    %eax,%edx
+801075fb:	75 f3                	jne    801075f0 <acquire+0xa0>
+}
+801075fd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107600:	c9                   	leave
+80107601:	c3                   	ret
+80107602:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  r = lock->locked && lock->cpu == mycpu();
+80107608:	8b 5b 08             	mov    0x8(%ebx),%ebx
+8010760b:	e8 90 e4 ff ff       	call   80105aa0 <mycpu>
+80107610:	39 c3                	cmp    %eax,%ebx
+80107612:	0f 85 56 ff ff ff    	jne    8010756e <acquire+0x1e>
+  popcli();
+80107618:	e8 33 fe ff ff       	call   80107450 <popcli>
+    panic("acquire");
+8010761d:	83 ec 0c             	sub    $0xc,%esp
+80107620:	68 f5 b5 10 80       	push   $0x8010b5f5
+80107625:	e8 56 92 ff ff       	call   80100880 <panic>
+8010762a:	66 90                	xchg   %ax,%ax
+8010762c:	66 90                	xchg   %ax,%ax
+8010762e:	66 90                	xchg   %ax,%ax
+
+80107630 <memset>:
+#include "types.h"
+#include "x86.h"
+
+void*
+memset(void *dst, int c, uint n)
+{
+80107630:	55                   	push   %ebp
+80107631:	89 e5                	mov    %esp,%ebp
+80107633:	57                   	push   %edi
+80107634:	8b 55 08             	mov    0x8(%ebp),%edx
+80107637:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  if ((int)dst%4 == 0 && n%4 == 0){
+8010763a:	89 d0                	mov    %edx,%eax
+8010763c:	09 c8                	or     %ecx,%eax
+8010763e:	a8 03                	test   $0x3,%al
+80107640:	75 1e                	jne    80107660 <memset+0x30>
+    c &= 0xFF;
+80107642:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+    stosl(dst, (c<<24)|(c<<16)|(c<<8)|c, n/4);
+80107646:	c1 e9 02             	shr    $0x2,%ecx
+  asm volatile("cld; rep stosl" :
+80107649:	89 d7                	mov    %edx,%edi
+8010764b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+80107651:	fc                   	cld
+80107652:	f3 ab                	rep stos %eax,%es:(%edi)
+  } else
+    stosb(dst, c, n);
+  return dst;
+}
+80107654:	8b 7d fc             	mov    -0x4(%ebp),%edi
+80107657:	89 d0                	mov    %edx,%eax
+80107659:	c9                   	leave
+8010765a:	c3                   	ret
+8010765b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010765f:	90                   	nop
+  asm volatile("cld; rep stosb" :
+80107660:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107663:	89 d7                	mov    %edx,%edi
+80107665:	fc                   	cld
+80107666:	f3 aa                	rep stos %al,%es:(%edi)
+80107668:	8b 7d fc             	mov    -0x4(%ebp),%edi
+8010766b:	89 d0                	mov    %edx,%eax
+8010766d:	c9                   	leave
+8010766e:	c3                   	ret
+8010766f:	90                   	nop
+
+80107670 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, uint n)
+{
+80107670:	55                   	push   %ebp
+80107671:	89 e5                	mov    %esp,%ebp
+80107673:	56                   	push   %esi
+80107674:	53                   	push   %ebx
+80107675:	8b 75 10             	mov    0x10(%ebp),%esi
+80107678:	8b 55 08             	mov    0x8(%ebp),%edx
+8010767b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  const uchar *s1, *s2;
+
+  s1 = v1;
+  s2 = v2;
+  while(n-- > 0){
+8010767e:	85 f6                	test   %esi,%esi
+80107680:	74 2e                	je     801076b0 <memcmp+0x40>
+80107682:	01 c6                	add    %eax,%esi
+80107684:	eb 14                	jmp    8010769a <memcmp+0x2a>
+80107686:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010768d:	8d 76 00             	lea    0x0(%esi),%esi
+    if(*s1 != *s2)
+      return *s1 - *s2;
+    s1++, s2++;
+80107690:	83 c0 01             	add    $0x1,%eax
+80107693:	83 c2 01             	add    $0x1,%edx
+  while(n-- > 0){
+80107696:	39 f0                	cmp    %esi,%eax
+80107698:	74 16                	je     801076b0 <memcmp+0x40>
+    if(*s1 != *s2)
+8010769a:	0f b6 0a             	movzbl (%edx),%ecx
+8010769d:	0f b6 18             	movzbl (%eax),%ebx
+801076a0:	38 d9                	cmp    %bl,%cl
+801076a2:	74 ec                	je     80107690 <memcmp+0x20>
+      return *s1 - *s2;
+801076a4:	0f b6 c1             	movzbl %cl,%eax
+801076a7:	29 d8                	sub    %ebx,%eax
+  }
+
+  return 0;
+}
+801076a9:	5b                   	pop    %ebx
+801076aa:	5e                   	pop    %esi
+801076ab:	5d                   	pop    %ebp
+801076ac:	c3                   	ret
+801076ad:	8d 76 00             	lea    0x0(%esi),%esi
+801076b0:	5b                   	pop    %ebx
+  return 0;
+801076b1:	31 c0                	xor    %eax,%eax
+}
+801076b3:	5e                   	pop    %esi
+801076b4:	5d                   	pop    %ebp
+801076b5:	c3                   	ret
+801076b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801076bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+801076c0 <memmove>:
+
+void*
+memmove(void *dst, const void *src, uint n)
+{
+801076c0:	55                   	push   %ebp
+801076c1:	89 e5                	mov    %esp,%ebp
+801076c3:	57                   	push   %edi
+801076c4:	56                   	push   %esi
+801076c5:	8b 55 08             	mov    0x8(%ebp),%edx
+801076c8:	8b 75 0c             	mov    0xc(%ebp),%esi
+801076cb:	8b 45 10             	mov    0x10(%ebp),%eax
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if(s < d && s + n > d){
+801076ce:	39 d6                	cmp    %edx,%esi
+801076d0:	73 26                	jae    801076f8 <memmove+0x38>
+801076d2:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+801076d5:	39 ca                	cmp    %ecx,%edx
+801076d7:	73 1f                	jae    801076f8 <memmove+0x38>
+    s += n;
+    d += n;
+    while(n-- > 0)
+801076d9:	85 c0                	test   %eax,%eax
+801076db:	74 0f                	je     801076ec <memmove+0x2c>
+801076dd:	83 e8 01             	sub    $0x1,%eax
+      *--d = *--s;
+801076e0:	0f b6 0c 06          	movzbl (%esi,%eax,1),%ecx
+801076e4:	88 0c 02             	mov    %cl,(%edx,%eax,1)
+    while(n-- > 0)
+801076e7:	83 e8 01             	sub    $0x1,%eax
+801076ea:	73 f4                	jae    801076e0 <memmove+0x20>
+  } else
+    while(n-- > 0)
+      *d++ = *s++;
+
+  return dst;
+}
+801076ec:	5e                   	pop    %esi
+801076ed:	89 d0                	mov    %edx,%eax
+801076ef:	5f                   	pop    %edi
+801076f0:	5d                   	pop    %ebp
+801076f1:	c3                   	ret
+801076f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    while(n-- > 0)
+801076f8:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+801076fb:	89 d7                	mov    %edx,%edi
+801076fd:	85 c0                	test   %eax,%eax
+801076ff:	74 eb                	je     801076ec <memmove+0x2c>
+80107701:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      *d++ = *s++;
+80107708:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+    while(n-- > 0)
+80107709:	39 ce                	cmp    %ecx,%esi
+8010770b:	75 fb                	jne    80107708 <memmove+0x48>
+}
+8010770d:	5e                   	pop    %esi
+8010770e:	89 d0                	mov    %edx,%eax
+80107710:	5f                   	pop    %edi
+80107711:	5d                   	pop    %ebp
+80107712:	c3                   	ret
+80107713:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010771a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80107720 <memcpy>:
+
+// memcpy exists to placate GCC.  Use memmove.
+void*
+memcpy(void *dst, const void *src, uint n)
+{
+  return memmove(dst, src, n);
+80107720:	eb 9e                	jmp    801076c0 <memmove>
+80107722:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107729:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107730 <strncmp>:
+}
+
+int
+strncmp(const char *p, const char *q, uint n)
+{
+80107730:	55                   	push   %ebp
+80107731:	89 e5                	mov    %esp,%ebp
+80107733:	53                   	push   %ebx
+80107734:	8b 55 10             	mov    0x10(%ebp),%edx
+80107737:	8b 45 08             	mov    0x8(%ebp),%eax
+8010773a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(n > 0 && *p && *p == *q)
+8010773d:	85 d2                	test   %edx,%edx
+8010773f:	75 16                	jne    80107757 <strncmp+0x27>
+80107741:	eb 2d                	jmp    80107770 <strncmp+0x40>
+80107743:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107747:	90                   	nop
+80107748:	3a 19                	cmp    (%ecx),%bl
+8010774a:	75 12                	jne    8010775e <strncmp+0x2e>
+    n--, p++, q++;
+8010774c:	83 c0 01             	add    $0x1,%eax
+8010774f:	83 c1 01             	add    $0x1,%ecx
+  while(n > 0 && *p && *p == *q)
+80107752:	83 ea 01             	sub    $0x1,%edx
+80107755:	74 19                	je     80107770 <strncmp+0x40>
+80107757:	0f b6 18             	movzbl (%eax),%ebx
+8010775a:	84 db                	test   %bl,%bl
+8010775c:	75 ea                	jne    80107748 <strncmp+0x18>
+  if(n == 0)
+    return 0;
+  return (uchar)*p - (uchar)*q;
+8010775e:	0f b6 00             	movzbl (%eax),%eax
+80107761:	0f b6 11             	movzbl (%ecx),%edx
+}
+80107764:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107767:	c9                   	leave
+  return (uchar)*p - (uchar)*q;
+80107768:	29 d0                	sub    %edx,%eax
+}
+8010776a:	c3                   	ret
+8010776b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010776f:	90                   	nop
+80107770:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return 0;
+80107773:	31 c0                	xor    %eax,%eax
+}
+80107775:	c9                   	leave
+80107776:	c3                   	ret
+80107777:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010777e:	66 90                	xchg   %ax,%ax
+
+80107780 <strncpy>:
+
+char*
+strncpy(char *s, const char *t, int n)
+{
+80107780:	55                   	push   %ebp
+80107781:	89 e5                	mov    %esp,%ebp
+80107783:	57                   	push   %edi
+80107784:	56                   	push   %esi
+80107785:	53                   	push   %ebx
+80107786:	8b 75 08             	mov    0x8(%ebp),%esi
+80107789:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *os;
+
+  os = s;
+  while(n-- > 0 && (*s++ = *t++) != 0)
+8010778c:	89 f0                	mov    %esi,%eax
+8010778e:	eb 15                	jmp    801077a5 <strncpy+0x25>
+80107790:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+80107794:	8b 7d 0c             	mov    0xc(%ebp),%edi
+80107797:	83 c0 01             	add    $0x1,%eax
+8010779a:	0f b6 4f ff          	movzbl -0x1(%edi),%ecx
+8010779e:	88 48 ff             	mov    %cl,-0x1(%eax)
+801077a1:	84 c9                	test   %cl,%cl
+801077a3:	74 13                	je     801077b8 <strncpy+0x38>
+801077a5:	89 d3                	mov    %edx,%ebx
+801077a7:	83 ea 01             	sub    $0x1,%edx
+801077aa:	85 db                	test   %ebx,%ebx
+801077ac:	7f e2                	jg     80107790 <strncpy+0x10>
+    ;
+  while(n-- > 0)
+    *s++ = 0;
+  return os;
+}
+801077ae:	5b                   	pop    %ebx
+801077af:	89 f0                	mov    %esi,%eax
+801077b1:	5e                   	pop    %esi
+801077b2:	5f                   	pop    %edi
+801077b3:	5d                   	pop    %ebp
+801077b4:	c3                   	ret
+801077b5:	8d 76 00             	lea    0x0(%esi),%esi
+  while(n-- > 0)
+801077b8:	8d 0c 18             	lea    (%eax,%ebx,1),%ecx
+801077bb:	83 e9 01             	sub    $0x1,%ecx
+801077be:	85 d2                	test   %edx,%edx
+801077c0:	74 ec                	je     801077ae <strncpy+0x2e>
+801077c2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    *s++ = 0;
+801077c8:	83 c0 01             	add    $0x1,%eax
+801077cb:	89 ca                	mov    %ecx,%edx
+801077cd:	c6 40 ff 00          	movb   $0x0,-0x1(%eax)
+  while(n-- > 0)
+801077d1:	29 c2                	sub    %eax,%edx
+801077d3:	85 d2                	test   %edx,%edx
+801077d5:	7f f1                	jg     801077c8 <strncpy+0x48>
+}
+801077d7:	5b                   	pop    %ebx
+801077d8:	89 f0                	mov    %esi,%eax
+801077da:	5e                   	pop    %esi
+801077db:	5f                   	pop    %edi
+801077dc:	5d                   	pop    %ebp
+801077dd:	c3                   	ret
+801077de:	66 90                	xchg   %ax,%ax
+
+801077e0 <safestrcpy>:
+
+// Like strncpy but guaranteed to NUL-terminate.
+char*
+safestrcpy(char *s, const char *t, int n)
+{
+801077e0:	55                   	push   %ebp
+801077e1:	89 e5                	mov    %esp,%ebp
+801077e3:	56                   	push   %esi
+801077e4:	53                   	push   %ebx
+801077e5:	8b 55 10             	mov    0x10(%ebp),%edx
+801077e8:	8b 75 08             	mov    0x8(%ebp),%esi
+801077eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  char *os;
+
+  os = s;
+  if(n <= 0)
+801077ee:	85 d2                	test   %edx,%edx
+801077f0:	7e 25                	jle    80107817 <safestrcpy+0x37>
+801077f2:	8d 5c 10 ff          	lea    -0x1(%eax,%edx,1),%ebx
+801077f6:	89 f2                	mov    %esi,%edx
+801077f8:	eb 16                	jmp    80107810 <safestrcpy+0x30>
+801077fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return os;
+  while(--n > 0 && (*s++ = *t++) != 0)
+80107800:	0f b6 08             	movzbl (%eax),%ecx
+80107803:	83 c0 01             	add    $0x1,%eax
+80107806:	83 c2 01             	add    $0x1,%edx
+80107809:	88 4a ff             	mov    %cl,-0x1(%edx)
+8010780c:	84 c9                	test   %cl,%cl
+8010780e:	74 04                	je     80107814 <safestrcpy+0x34>
+80107810:	39 d8                	cmp    %ebx,%eax
+80107812:	75 ec                	jne    80107800 <safestrcpy+0x20>
+    ;
+  *s = 0;
+80107814:	c6 02 00             	movb   $0x0,(%edx)
+  return os;
+}
+80107817:	89 f0                	mov    %esi,%eax
+80107819:	5b                   	pop    %ebx
+8010781a:	5e                   	pop    %esi
+8010781b:	5d                   	pop    %ebp
+8010781c:	c3                   	ret
+8010781d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107820 <strlen>:
+
+int
+strlen(const char *s)
+{
+80107820:	55                   	push   %ebp
+  int n;
+
+  for(n = 0; s[n]; n++)
+80107821:	31 c0                	xor    %eax,%eax
+{
+80107823:	89 e5                	mov    %esp,%ebp
+80107825:	8b 55 08             	mov    0x8(%ebp),%edx
+  for(n = 0; s[n]; n++)
+80107828:	80 3a 00             	cmpb   $0x0,(%edx)
+8010782b:	74 0c                	je     80107839 <strlen+0x19>
+8010782d:	8d 76 00             	lea    0x0(%esi),%esi
+80107830:	83 c0 01             	add    $0x1,%eax
+80107833:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+80107837:	75 f7                	jne    80107830 <strlen+0x10>
+    ;
+  return n;
+}
+80107839:	5d                   	pop    %ebp
+8010783a:	c3                   	ret
+
+8010783b <swtch>:
+# a struct context, and save its address in *old.
+# Switch stacks to new and pop previously-saved registers.
+
+.globl swtch
+swtch:
+  movl 4(%esp), %eax
+8010783b:	8b 44 24 04          	mov    0x4(%esp),%eax
+  movl 8(%esp), %edx
+8010783f:	8b 54 24 08          	mov    0x8(%esp),%edx
+
+  # Save old callee-saved registers
+  pushl %ebp
+80107843:	55                   	push   %ebp
+  pushl %ebx
+80107844:	53                   	push   %ebx
+  pushl %esi
+80107845:	56                   	push   %esi
+  pushl %edi
+80107846:	57                   	push   %edi
+
+  # Switch stacks
+  movl %esp, (%eax)
+80107847:	89 20                	mov    %esp,(%eax)
+  movl %edx, %esp
+80107849:	89 d4                	mov    %edx,%esp
+
+  # Load new callee-saved registers
+  popl %edi
+8010784b:	5f                   	pop    %edi
+  popl %esi
+8010784c:	5e                   	pop    %esi
+  popl %ebx
+8010784d:	5b                   	pop    %ebx
+  popl %ebp
+8010784e:	5d                   	pop    %ebp
+  ret
+8010784f:	c3                   	ret
+
+80107850 <fetchint>:
+// to a saved program counter, and then the first argument.
+
+// Fetch the int at addr from the current process.
+int
+fetchint(uint addr, int *ip)
+{
+80107850:	55                   	push   %ebp
+80107851:	89 e5                	mov    %esp,%ebp
+80107853:	53                   	push   %ebx
+80107854:	83 ec 04             	sub    $0x4,%esp
+80107857:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct proc *curproc = myproc();
+8010785a:	e8 21 e5 ff ff       	call   80105d80 <myproc>
+
+  if(addr >= curproc->sz || addr+4 > curproc->sz)
+8010785f:	8b 10                	mov    (%eax),%edx
+80107861:	39 d3                	cmp    %edx,%ebx
+80107863:	73 2b                	jae    80107890 <fetchint+0x40>
+80107865:	8d 4b 04             	lea    0x4(%ebx),%ecx
+80107868:	39 ca                	cmp    %ecx,%edx
+8010786a:	72 24                	jb     80107890 <fetchint+0x40>
+    return -1;
+  if(lazyfill(curproc->pgdir, curproc->sz, addr, 4) < 0)
+8010786c:	6a 04                	push   $0x4
+8010786e:	53                   	push   %ebx
+8010786f:	52                   	push   %edx
+80107870:	ff 70 04             	push   0x4(%eax)
+80107873:	e8 68 31 00 00       	call   8010a9e0 <lazyfill>
+80107878:	83 c4 10             	add    $0x10,%esp
+8010787b:	85 c0                	test   %eax,%eax
+8010787d:	78 11                	js     80107890 <fetchint+0x40>
+    return -1;
+  *ip = *(int*)(addr);
+8010787f:	8b 45 0c             	mov    0xc(%ebp),%eax
+80107882:	8b 13                	mov    (%ebx),%edx
+80107884:	89 10                	mov    %edx,(%eax)
+  return 0;
+80107886:	31 c0                	xor    %eax,%eax
+}
+80107888:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010788b:	c9                   	leave
+8010788c:	c3                   	ret
+8010788d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80107890:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107895:	eb f1                	jmp    80107888 <fetchint+0x38>
+80107897:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010789e:	66 90                	xchg   %ax,%ax
+
+801078a0 <fetchstr>:
+// Fetch the nul-terminated string at addr from the current process.
+// Doesn't actually copy the string - just sets *pp to point at it.
+// Returns length of string, not including nul.
+int
+fetchstr(uint addr, char **pp)
+{
+801078a0:	55                   	push   %ebp
+801078a1:	89 e5                	mov    %esp,%ebp
+801078a3:	57                   	push   %edi
+801078a4:	56                   	push   %esi
+801078a5:	53                   	push   %ebx
+801078a6:	83 ec 0c             	sub    $0xc,%esp
+801078a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  char *s, *ep;
+  struct proc *curproc = myproc();
+801078ac:	e8 cf e4 ff ff       	call   80105d80 <myproc>
+
+  if(addr >= curproc->sz)
+801078b1:	3b 18                	cmp    (%eax),%ebx
+801078b3:	73 5b                	jae    80107910 <fetchstr+0x70>
+801078b5:	89 c6                	mov    %eax,%esi
+    return -1;
+  *pp = (char*)addr;
+801078b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+801078ba:	89 18                	mov    %ebx,(%eax)
+  ep = (char*)curproc->sz;
+801078bc:	8b 3e                	mov    (%esi),%edi
+  for(s = *pp; s < ep; s++){
+801078be:	39 fb                	cmp    %edi,%ebx
+801078c0:	73 4e                	jae    80107910 <fetchstr+0x70>
+801078c2:	89 d8                	mov    %ebx,%eax
+801078c4:	eb 16                	jmp    801078dc <fetchstr+0x3c>
+801078c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801078cd:	8d 76 00             	lea    0x0(%esi),%esi
+801078d0:	83 c3 01             	add    $0x1,%ebx
+801078d3:	39 fb                	cmp    %edi,%ebx
+801078d5:	73 39                	jae    80107910 <fetchstr+0x70>
+    if((s == *pp || (uint)s % PGSIZE == 0) &&
+       lazyfill(curproc->pgdir, curproc->sz, (uint)s, 1) < 0)
+      return -1;
+    if(*s == 0)
+      return s - *pp;
+801078d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+801078da:	8b 00                	mov    (%eax),%eax
+    if((s == *pp || (uint)s % PGSIZE == 0) &&
+801078dc:	39 d8                	cmp    %ebx,%eax
+801078de:	74 08                	je     801078e8 <fetchstr+0x48>
+801078e0:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+801078e6:	75 14                	jne    801078fc <fetchstr+0x5c>
+       lazyfill(curproc->pgdir, curproc->sz, (uint)s, 1) < 0)
+801078e8:	6a 01                	push   $0x1
+801078ea:	53                   	push   %ebx
+801078eb:	ff 36                	push   (%esi)
+801078ed:	ff 76 04             	push   0x4(%esi)
+801078f0:	e8 eb 30 00 00       	call   8010a9e0 <lazyfill>
+    if((s == *pp || (uint)s % PGSIZE == 0) &&
+801078f5:	83 c4 10             	add    $0x10,%esp
+801078f8:	85 c0                	test   %eax,%eax
+801078fa:	78 14                	js     80107910 <fetchstr+0x70>
+    if(*s == 0)
+801078fc:	80 3b 00             	cmpb   $0x0,(%ebx)
+801078ff:	75 cf                	jne    801078d0 <fetchstr+0x30>
+      return s - *pp;
+80107901:	8b 55 0c             	mov    0xc(%ebp),%edx
+80107904:	89 d8                	mov    %ebx,%eax
+80107906:	2b 02                	sub    (%edx),%eax
+  }
+  return -1;
+}
+80107908:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010790b:	5b                   	pop    %ebx
+8010790c:	5e                   	pop    %esi
+8010790d:	5f                   	pop    %edi
+8010790e:	5d                   	pop    %ebp
+8010790f:	c3                   	ret
+80107910:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+80107913:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80107918:	5b                   	pop    %ebx
+80107919:	5e                   	pop    %esi
+8010791a:	5f                   	pop    %edi
+8010791b:	5d                   	pop    %ebp
+8010791c:	c3                   	ret
+8010791d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107920 <argint>:
+
+// Fetch the nth 32-bit system call argument.
+int
+argint(int n, int *ip)
+{
+80107920:	55                   	push   %ebp
+80107921:	89 e5                	mov    %esp,%ebp
+80107923:	56                   	push   %esi
+80107924:	53                   	push   %ebx
+80107925:	8b 75 0c             	mov    0xc(%ebp),%esi
+80107928:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+8010792b:	e8 50 e4 ff ff       	call   80105d80 <myproc>
+80107930:	89 75 0c             	mov    %esi,0xc(%ebp)
+80107933:	8b 40 28             	mov    0x28(%eax),%eax
+80107936:	8b 40 44             	mov    0x44(%eax),%eax
+80107939:	8d 44 98 04          	lea    0x4(%eax,%ebx,4),%eax
+8010793d:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80107940:	5b                   	pop    %ebx
+80107941:	5e                   	pop    %esi
+80107942:	5d                   	pop    %ebp
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80107943:	e9 08 ff ff ff       	jmp    80107850 <fetchint>
+80107948:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010794f:	90                   	nop
+
+80107950 <argptr>:
+// Fetch the nth word-sized system call argument as a pointer
+// to a block of memory of size bytes.  Check that the pointer
+// lies within the process address space.
+int
+argptr(int n, char **pp, int size)
+{
+80107950:	55                   	push   %ebp
+80107951:	89 e5                	mov    %esp,%ebp
+80107953:	57                   	push   %edi
+80107954:	56                   	push   %esi
+80107955:	53                   	push   %ebx
+80107956:	83 ec 1c             	sub    $0x1c,%esp
+80107959:	8b 7d 10             	mov    0x10(%ebp),%edi
+  int i;
+  struct proc *curproc = myproc();
+8010795c:	e8 1f e4 ff ff       	call   80105d80 <myproc>
+80107961:	89 c3                	mov    %eax,%ebx
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80107963:	e8 18 e4 ff ff       	call   80105d80 <myproc>
+80107968:	83 ec 08             	sub    $0x8,%esp
+8010796b:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+8010796e:	52                   	push   %edx
+8010796f:	8b 40 28             	mov    0x28(%eax),%eax
+80107972:	8b 55 08             	mov    0x8(%ebp),%edx
+80107975:	8b 40 44             	mov    0x44(%eax),%eax
+80107978:	8d 44 90 04          	lea    0x4(%eax,%edx,4),%eax
+8010797c:	50                   	push   %eax
+8010797d:	e8 ce fe ff ff       	call   80107850 <fetchint>
+ 
+  if(argint(n, &i) < 0)
+    return -1;
+  if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
+80107982:	83 c4 10             	add    $0x10,%esp
+80107985:	09 f8                	or     %edi,%eax
+80107987:	78 37                	js     801079c0 <argptr+0x70>
+80107989:	8b 03                	mov    (%ebx),%eax
+8010798b:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+8010798e:	39 c6                	cmp    %eax,%esi
+80107990:	73 2e                	jae    801079c0 <argptr+0x70>
+80107992:	8d 14 3e             	lea    (%esi,%edi,1),%edx
+80107995:	39 d0                	cmp    %edx,%eax
+80107997:	72 27                	jb     801079c0 <argptr+0x70>
+    return -1;
+  if(lazyfill(curproc->pgdir, curproc->sz, i, size) < 0)
+80107999:	57                   	push   %edi
+8010799a:	56                   	push   %esi
+8010799b:	50                   	push   %eax
+8010799c:	ff 73 04             	push   0x4(%ebx)
+8010799f:	e8 3c 30 00 00       	call   8010a9e0 <lazyfill>
+801079a4:	83 c4 10             	add    $0x10,%esp
+801079a7:	85 c0                	test   %eax,%eax
+801079a9:	78 15                	js     801079c0 <argptr+0x70>
+    return -1;
+  *pp = (char*)i;
+801079ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+801079ae:	89 30                	mov    %esi,(%eax)
+  return 0;
+801079b0:	31 c0                	xor    %eax,%eax
+}
+801079b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801079b5:	5b                   	pop    %ebx
+801079b6:	5e                   	pop    %esi
+801079b7:	5f                   	pop    %edi
+801079b8:	5d                   	pop    %ebp
+801079b9:	c3                   	ret
+801079ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+801079c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801079c5:	eb eb                	jmp    801079b2 <argptr+0x62>
+801079c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801079ce:	66 90                	xchg   %ax,%ax
+
+801079d0 <argwptr>:
+// Like argptr, for a block of memory the system call is going
+// to write. Breaks copy-on-write sharing up front, so that a
+// failed copy makes the call fail rather than the kernel fault.
+int
+argwptr(int n, char **pp, int size)
+{
+801079d0:	55                   	push   %ebp
+801079d1:	89 e5                	mov    %esp,%ebp
+801079d3:	56                   	push   %esi
+801079d4:	53                   	push   %ebx
+801079d5:	8b 75 0c             	mov    0xc(%ebp),%esi
+801079d8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if(argptr(n, pp, size) < 0)
+801079db:	83 ec 04             	sub    $0x4,%esp
+801079de:	53                   	push   %ebx
+801079df:	56                   	push   %esi
+801079e0:	ff 75 08             	push   0x8(%ebp)
+801079e3:	e8 68 ff ff ff       	call   80107950 <argptr>
+801079e8:	83 c4 10             	add    $0x10,%esp
+801079eb:	85 c0                	test   %eax,%eax
+801079ed:	78 21                	js     80107a10 <argwptr+0x40>
+    return -1;
+  return cowbreak(myproc()->pgdir, (uint)*pp, size);
+801079ef:	8b 36                	mov    (%esi),%esi
+801079f1:	e8 8a e3 ff ff       	call   80105d80 <myproc>
+801079f6:	89 5d 10             	mov    %ebx,0x10(%ebp)
+801079f9:	89 75 0c             	mov    %esi,0xc(%ebp)
+801079fc:	8b 40 04             	mov    0x4(%eax),%eax
+801079ff:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80107a02:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107a05:	5b                   	pop    %ebx
+80107a06:	5e                   	pop    %esi
+80107a07:	5d                   	pop    %ebp
+  return cowbreak(myproc()->pgdir, (uint)*pp, size);
+80107a08:	e9 93 2e 00 00       	jmp    8010a8a0 <cowbreak>
+80107a0d:	8d 76 00             	lea    0x0(%esi),%esi
+}
+80107a10:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107a13:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107a18:	5b                   	pop    %ebx
+80107a19:	5e                   	pop    %esi
+80107a1a:	5d                   	pop    %ebp
+80107a1b:	c3                   	ret
+80107a1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80107a20 <argstr>:
+// Check that the pointer is valid and the string is nul-terminated.
+// (There is no shared writable memory, so the string can't change
+// between this check and being used by the kernel.)
+int
+argstr(int n, char **pp)
+{
+80107a20:	55                   	push   %ebp
+80107a21:	89 e5                	mov    %esp,%ebp
+80107a23:	56                   	push   %esi
+80107a24:	53                   	push   %ebx
+80107a25:	83 ec 10             	sub    $0x10,%esp
+80107a28:	8b 75 08             	mov    0x8(%ebp),%esi
+80107a2b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  return fetchint((myproc()->tf->esp) + 4 + 4*n, ip);
+80107a2e:	e8 4d e3 ff ff       	call   80105d80 <myproc>
+80107a33:	83 ec 08             	sub    $0x8,%esp
+80107a36:	8d 55 f4             	lea    -0xc(%ebp),%edx
+80107a39:	52                   	push   %edx
+80107a3a:	8b 40 28             	mov    0x28(%eax),%eax
+80107a3d:	8b 40 44             	mov    0x44(%eax),%eax
+80107a40:	8d 44 b0 04          	lea    0x4(%eax,%esi,4),%eax
+80107a44:	50                   	push   %eax
+80107a45:	e8 06 fe ff ff       	call   80107850 <fetchint>
+  int addr;
+  if(argint(n, &addr) < 0)
+80107a4a:	83 c4 10             	add    $0x10,%esp
+80107a4d:	85 c0                	test   %eax,%eax
+80107a4f:	78 17                	js     80107a68 <argstr+0x48>
+    return -1;
+  return fetchstr(addr, pp);
+80107a51:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80107a54:	89 5d 0c             	mov    %ebx,0xc(%ebp)
+80107a57:	89 45 08             	mov    %eax,0x8(%ebp)
+}
+80107a5a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107a5d:	5b                   	pop    %ebx
+80107a5e:	5e                   	pop    %esi
+80107a5f:	5d                   	pop    %ebp
+  return fetchstr(addr, pp);
+80107a60:	e9 3b fe ff ff       	jmp    801078a0 <fetchstr>
+80107a65:	8d 76 00             	lea    0x0(%esi),%esi
+}
+80107a68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107a6b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107a70:	5b                   	pop    %ebx
+80107a71:	5e                   	pop    %esi
+80107a72:	5d                   	pop    %ebp
+80107a73:	c3                   	ret
+80107a74:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107a7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107a7f:	90                   	nop
+
+80107a80 <syscall>:
+[SYS_transfer] sys_transfer,
+};
+
+void
+syscall(void)
+{
+80107a80:	55                   	push   %ebp
+80107a81:	89 e5                	mov    %esp,%ebp
+80107a83:	53                   	push   %ebx
+80107a84:	83 ec 04             	sub    $0x4,%esp
+  int num;
+  struct proc *curproc = myproc();
+80107a87:	e8 f4 e2 ff ff       	call   80105d80 <myproc>
+80107a8c:	89 c3                	mov    %eax,%ebx
+
+  num = curproc->tf->eax;
+80107a8e:	8b 40 28             	mov    0x28(%eax),%eax
+80107a91:	8b 40 1c             	mov    0x1c(%eax),%eax
+  if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
+80107a94:	8d 50 ff             	lea    -0x1(%eax),%edx
+80107a97:	83 fa 1b             	cmp    $0x1b,%edx
+80107a9a:	77 24                	ja     80107ac0 <syscall+0x40>
+80107a9c:	8b 14 85 20 b6 10 80 	mov    -0x7fef49e0(,%eax,4),%edx
+80107aa3:	85 d2                	test   %edx,%edx
+80107aa5:	74 19                	je     80107ac0 <syscall+0x40>
+    curproc->tf->eax = syscalls[num]();
+80107aa7:	ff d2                	call   *%edx
+80107aa9:	89 c2                	mov    %eax,%edx
+80107aab:	8b 43 28             	mov    0x28(%ebx),%eax
+80107aae:	89 50 1c             	mov    %edx,0x1c(%eax)
+  } else {
+    cprintf("%d %s: unknown sys call %d\n",
+            curproc->pid, curproc->name, num);
+    curproc->tf->eax = -1;
+  }
+}
+80107ab1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107ab4:	c9                   	leave
+80107ab5:	c3                   	ret
+80107ab6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107abd:	8d 76 00             	lea    0x0(%esi),%esi
+    cprintf("%d %s: unknown sys call %d\n",
+80107ac0:	50                   	push   %eax
+            curproc->pid, curproc->name, num);
+80107ac1:	8d 83 88 00 00 00    	lea    0x88(%ebx),%eax
+    cprintf("%d %s: unknown sys call %d\n",
+80107ac7:	50                   	push   %eax
+80107ac8:	ff 73 10             	push   0x10(%ebx)
+80107acb:	68 fd b5 10 80       	push   $0x8010b5fd
+80107ad0:	e8 db 90 ff ff       	call   80100bb0 <cprintf>
+    curproc->tf->eax = -1;
+80107ad5:	8b 43 28             	mov    0x28(%ebx),%eax
+80107ad8:	83 c4 10             	add    $0x10,%esp
+80107adb:	c7 40 1c ff ff ff ff 	movl   $0xffffffff,0x1c(%eax)
+}
+80107ae2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80107ae5:	c9                   	leave
+80107ae6:	c3                   	ret
+80107ae7:	66 90                	xchg   %ax,%ax
+80107ae9:	66 90                	xchg   %ax,%ax
+80107aeb:	66 90                	xchg   %ax,%ax
+80107aed:	66 90                	xchg   %ax,%ax
+80107aef:	90                   	nop
+
+80107af0 <create>:
+  return -1;
+}
+
+static struct inode*
+create(char *path, short type, short major, short minor)
+{
+80107af0:	55                   	push   %ebp
+80107af1:	89 e5                	mov    %esp,%ebp
+80107af3:	57                   	push   %edi
+80107af4:	56                   	push   %esi
+  struct inode *ip, *dp;
+  char name[DIRSIZ];
+
+  if((dp = nameiparent(path, name)) == 0)
+80107af5:	8d 7d da             	lea    -0x26(%ebp),%edi
+{
+80107af8:	53                   	push   %ebx
+80107af9:	83 ec 34             	sub    $0x34,%esp
+80107afc:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+80107aff:	8b 4d 08             	mov    0x8(%ebp),%ecx
+80107b02:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+80107b05:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if((dp = nameiparent(path, name)) == 0)
+80107b08:	57                   	push   %edi
+80107b09:	50                   	push   %eax
+80107b0a:	e8 11 bb ff ff       	call   80103620 <nameiparent>
+80107b0f:	83 c4 10             	add    $0x10,%esp
+80107b12:	85 c0                	test   %eax,%eax
+80107b14:	74 5e                	je     80107b74 <create+0x84>
+    return 0;
+  ilock(dp);
+80107b16:	83 ec 0c             	sub    $0xc,%esp
+80107b19:	89 c3                	mov    %eax,%ebx
+80107b1b:	50                   	push   %eax
+80107b1c:	e8 3f ad ff ff       	call   80102860 <ilock>
+
+  if((ip = dirlookup(dp, name, 0)) != 0){
+80107b21:	83 c4 0c             	add    $0xc,%esp
+80107b24:	6a 00                	push   $0x0
+80107b26:	57                   	push   %edi
+80107b27:	53                   	push   %ebx
+80107b28:	e8 83 b3 ff ff       	call   80102eb0 <dirlookup>
+80107b2d:	83 c4 10             	add    $0x10,%esp
+80107b30:	89 c6                	mov    %eax,%esi
+80107b32:	85 c0                	test   %eax,%eax
+80107b34:	74 4a                	je     80107b80 <create+0x90>
+    iunlockput(dp);
+80107b36:	83 ec 0c             	sub    $0xc,%esp
+80107b39:	53                   	push   %ebx
+80107b3a:	e8 11 b0 ff ff       	call   80102b50 <iunlockput>
+    ilock(ip);
+80107b3f:	89 34 24             	mov    %esi,(%esp)
+80107b42:	e8 19 ad ff ff       	call   80102860 <ilock>
+    if(type == T_FILE && ip->type == T_FILE)
+80107b47:	83 c4 10             	add    $0x10,%esp
+80107b4a:	66 83 7d d4 02       	cmpw   $0x2,-0x2c(%ebp)
+80107b4f:	75 17                	jne    80107b68 <create+0x78>
+80107b51:	66 83 7e 60 02       	cmpw   $0x2,0x60(%esi)
+80107b56:	75 10                	jne    80107b68 <create+0x78>
+  }
+
+  iunlockput(dp);
+
+  return ip;
+}
+80107b58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107b5b:	89 f0                	mov    %esi,%eax
+80107b5d:	5b                   	pop    %ebx
+80107b5e:	5e                   	pop    %esi
+80107b5f:	5f                   	pop    %edi
+80107b60:	5d                   	pop    %ebp
+80107b61:	c3                   	ret
+80107b62:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iunlockput(ip);
+80107b68:	83 ec 0c             	sub    $0xc,%esp
+80107b6b:	56                   	push   %esi
+80107b6c:	e8 df af ff ff       	call   80102b50 <iunlockput>
+    return 0;
+80107b71:	83 c4 10             	add    $0x10,%esp
+    return 0;
+80107b74:	31 f6                	xor    %esi,%esi
+}
+80107b76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107b79:	89 f0                	mov    %esi,%eax
+80107b7b:	5b                   	pop    %ebx
+80107b7c:	5e                   	pop    %esi
+80107b7d:	5f                   	pop    %edi
+80107b7e:	5d                   	pop    %ebp
+80107b7f:	c3                   	ret
+  if((ip = ialloc(dp->dev, type)) == 0)
+80107b80:	0f bf 45 d4          	movswl -0x2c(%ebp),%eax
+80107b84:	83 ec 08             	sub    $0x8,%esp
+80107b87:	50                   	push   %eax
+80107b88:	ff 33                	push   (%ebx)
+80107b8a:	e8 f1 a6 ff ff       	call   80102280 <ialloc>
+80107b8f:	83 c4 10             	add    $0x10,%esp
+80107b92:	89 c6                	mov    %eax,%esi
+80107b94:	85 c0                	test   %eax,%eax
+80107b96:	0f 84 fd 00 00 00    	je     80107c99 <create+0x1a9>
+  ilock(ip);
+80107b9c:	83 ec 0c             	sub    $0xc,%esp
+80107b9f:	50                   	push   %eax
+80107ba0:	e8 bb ac ff ff       	call   80102860 <ilock>
+  ip->major = major;
+80107ba5:	0f b7 45 d0          	movzwl -0x30(%ebp),%eax
+  ip->nlink = 1;
+80107ba9:	ba 01 00 00 00       	mov    $0x1,%edx
+80107bae:	66 89 56 66          	mov    %dx,0x66(%esi)
+  ip->major = major;
+80107bb2:	66 89 46 62          	mov    %ax,0x62(%esi)
+  ip->minor = minor;
+80107bb6:	0f b7 45 cc          	movzwl -0x34(%ebp),%eax
+80107bba:	66 89 46 64          	mov    %ax,0x64(%esi)
+  iupdate(ip);
+80107bbe:	89 34 24             	mov    %esi,(%esp)
+80107bc1:	e8 7a a7 ff ff       	call   80102340 <iupdate>
+  if(type == T_DIR){  // Create . and .. entries.
+80107bc6:	83 c4 10             	add    $0x10,%esp
+80107bc9:	66 83 7d d4 01       	cmpw   $0x1,-0x2c(%ebp)
+80107bce:	74 30                	je     80107c00 <create+0x110>
+  if(dirlink(dp, name, ip->inum) < 0){
+80107bd0:	83 ec 04             	sub    $0x4,%esp
+80107bd3:	ff 76 04             	push   0x4(%esi)
+80107bd6:	57                   	push   %edi
+80107bd7:	53                   	push   %ebx
+80107bd8:	e8 a3 b7 ff ff       	call   80103380 <dirlink>
+80107bdd:	83 c4 10             	add    $0x10,%esp
+80107be0:	85 c0                	test   %eax,%eax
+80107be2:	78 7f                	js     80107c63 <create+0x173>
+  iunlockput(dp);
+80107be4:	83 ec 0c             	sub    $0xc,%esp
+80107be7:	53                   	push   %ebx
+80107be8:	e8 63 af ff ff       	call   80102b50 <iunlockput>
+  return ip;
+80107bed:	83 c4 10             	add    $0x10,%esp
+}
+80107bf0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80107bf3:	89 f0                	mov    %esi,%eax
+80107bf5:	5b                   	pop    %ebx
+80107bf6:	5e                   	pop    %esi
+80107bf7:	5f                   	pop    %edi
+80107bf8:	5d                   	pop    %ebp
+80107bf9:	c3                   	ret
+80107bfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iupdate(dp);
+80107c00:	83 ec 0c             	sub    $0xc,%esp
+    dp->nlink++;  // for ".."
+80107c03:	66 83 43 66 01       	addw   $0x1,0x66(%ebx)
+    iupdate(dp);
+80107c08:	53                   	push   %ebx
+80107c09:	e8 32 a7 ff ff       	call   80102340 <iupdate>
+    if(dirlink(ip, ".", ip->inum) < 0 || dirlink(ip, "..", dp->inum) < 0)
+80107c0e:	83 c4 0c             	add    $0xc,%esp
+80107c11:	ff 76 04             	push   0x4(%esi)
+80107c14:	68 b0 b6 10 80       	push   $0x8010b6b0
+80107c19:	56                   	push   %esi
+80107c1a:	e8 61 b7 ff ff       	call   80103380 <dirlink>
+80107c1f:	83 c4 10             	add    $0x10,%esp
+80107c22:	85 c0                	test   %eax,%eax
+80107c24:	78 66                	js     80107c8c <create+0x19c>
+80107c26:	83 ec 04             	sub    $0x4,%esp
+80107c29:	ff 73 04             	push   0x4(%ebx)
+80107c2c:	68 af b6 10 80       	push   $0x8010b6af
+80107c31:	56                   	push   %esi
+80107c32:	e8 49 b7 ff ff       	call   80103380 <dirlink>
+80107c37:	83 c4 10             	add    $0x10,%esp
+80107c3a:	85 c0                	test   %eax,%eax
+80107c3c:	78 4e                	js     80107c8c <create+0x19c>
+  if(dirlink(dp, name, ip->inum) < 0){
+80107c3e:	83 ec 04             	sub    $0x4,%esp
+80107c41:	ff 76 04             	push   0x4(%esi)
+80107c44:	57                   	push   %edi
+80107c45:	53                   	push   %ebx
+80107c46:	e8 35 b7 ff ff       	call   80103380 <dirlink>
+80107c4b:	83 c4 10             	add    $0x10,%esp
+80107c4e:	85 c0                	test   %eax,%eax
+80107c50:	79 92                	jns    80107be4 <create+0xf4>
+      iupdate(dp);
+80107c52:	83 ec 0c             	sub    $0xc,%esp
+      dp->nlink--;
+80107c55:	66 83 6b 66 01       	subw   $0x1,0x66(%ebx)
+      iupdate(dp);
+80107c5a:	53                   	push   %ebx
+80107c5b:	e8 e0 a6 ff ff       	call   80102340 <iupdate>
+80107c60:	83 c4 10             	add    $0x10,%esp
+    iupdate(ip);
+80107c63:	83 ec 0c             	sub    $0xc,%esp
+    ip->nlink = 0;
+80107c66:	31 c0                	xor    %eax,%eax
+80107c68:	66 89 46 66          	mov    %ax,0x66(%esi)
+    iupdate(ip);
+80107c6c:	56                   	push   %esi
+80107c6d:	e8 ce a6 ff ff       	call   80102340 <iupdate>
+    iunlockput(ip);
+80107c72:	89 34 24             	mov    %esi,(%esp)
+    return 0;
+80107c75:	31 f6                	xor    %esi,%esi
+    iunlockput(ip);
+80107c77:	e8 d4 ae ff ff       	call   80102b50 <iunlockput>
+    iunlockput(dp);
+80107c7c:	89 1c 24             	mov    %ebx,(%esp)
+80107c7f:	e8 cc ae ff ff       	call   80102b50 <iunlockput>
+    return 0;
+80107c84:	83 c4 10             	add    $0x10,%esp
+80107c87:	e9 ea fe ff ff       	jmp    80107b76 <create+0x86>
+      panic("create dots");
+80107c8c:	83 ec 0c             	sub    $0xc,%esp
+80107c8f:	68 a3 b6 10 80       	push   $0x8010b6a3
+80107c94:	e8 e7 8b ff ff       	call   80100880 <panic>
+    panic("create: ialloc");
+80107c99:	83 ec 0c             	sub    $0xc,%esp
+80107c9c:	68 94 b6 10 80       	push   $0x8010b694
+80107ca1:	e8 da 8b ff ff       	call   80100880 <panic>
+80107ca6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107cad:	8d 76 00             	lea    0x0(%esi),%esi
+
+80107cb0 <sys_dup>:
+{
+80107cb0:	55                   	push   %ebp
+80107cb1:	89 e5                	mov    %esp,%ebp
+80107cb3:	56                   	push   %esi
+80107cb4:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80107cb5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80107cb8:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80107cbb:	50                   	push   %eax
+80107cbc:	6a 00                	push   $0x0
+80107cbe:	e8 5d fc ff ff       	call   80107920 <argint>
+80107cc3:	83 c4 10             	add    $0x10,%esp
+80107cc6:	85 c0                	test   %eax,%eax
+80107cc8:	78 36                	js     80107d00 <sys_dup+0x50>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107cca:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80107cce:	77 30                	ja     80107d00 <sys_dup+0x50>
+80107cd0:	e8 ab e0 ff ff       	call   80105d80 <myproc>
+80107cd5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107cd8:	8b 74 90 44          	mov    0x44(%eax,%edx,4),%esi
+80107cdc:	85 f6                	test   %esi,%esi
+80107cde:	74 20                	je     80107d00 <sys_dup+0x50>
+  struct proc *curproc = myproc();
+80107ce0:	e8 9b e0 ff ff       	call   80105d80 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+80107ce5:	31 db                	xor    %ebx,%ebx
+80107ce7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107cee:	66 90                	xchg   %ax,%ax
+    if(curproc->ofile[fd] == 0){
+80107cf0:	8b 54 98 44          	mov    0x44(%eax,%ebx,4),%edx
+80107cf4:	85 d2                	test   %edx,%edx
+80107cf6:	74 18                	je     80107d10 <sys_dup+0x60>
+  for(fd = 0; fd < NOFILE; fd++){
+80107cf8:	83 c3 01             	add    $0x1,%ebx
+80107cfb:	83 fb 10             	cmp    $0x10,%ebx
+80107cfe:	75 f0                	jne    80107cf0 <sys_dup+0x40>
+}
+80107d00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return -1;
+80107d03:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+}
+80107d08:	89 d8                	mov    %ebx,%eax
+80107d0a:	5b                   	pop    %ebx
+80107d0b:	5e                   	pop    %esi
+80107d0c:	5d                   	pop    %ebp
+80107d0d:	c3                   	ret
+80107d0e:	66 90                	xchg   %ax,%ax
+  filedup(f);
+80107d10:	83 ec 0c             	sub    $0xc,%esp
+      curproc->ofile[fd] = f;
+80107d13:	89 74 98 44          	mov    %esi,0x44(%eax,%ebx,4)
+  filedup(f);
+80107d17:	56                   	push   %esi
+80107d18:	e8 f3 96 ff ff       	call   80101410 <filedup>
+  return fd;
+80107d1d:	83 c4 10             	add    $0x10,%esp
+}
+80107d20:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107d23:	89 d8                	mov    %ebx,%eax
+80107d25:	5b                   	pop    %ebx
+80107d26:	5e                   	pop    %esi
+80107d27:	5d                   	pop    %ebp
+80107d28:	c3                   	ret
+80107d29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+80107d30 <sys_read>:
+{
+80107d30:	55                   	push   %ebp
+80107d31:	89 e5                	mov    %esp,%ebp
+80107d33:	56                   	push   %esi
+80107d34:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80107d35:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80107d38:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80107d3b:	53                   	push   %ebx
+80107d3c:	6a 00                	push   $0x0
+80107d3e:	e8 dd fb ff ff       	call   80107920 <argint>
+80107d43:	83 c4 10             	add    $0x10,%esp
+80107d46:	85 c0                	test   %eax,%eax
+80107d48:	78 5e                	js     80107da8 <sys_read+0x78>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107d4a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80107d4e:	77 58                	ja     80107da8 <sys_read+0x78>
+80107d50:	e8 2b e0 ff ff       	call   80105d80 <myproc>
+80107d55:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107d58:	8b 74 90 44          	mov    0x44(%eax,%edx,4),%esi
+80107d5c:	85 f6                	test   %esi,%esi
+80107d5e:	74 48                	je     80107da8 <sys_read+0x78>
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argwptr(1, &p, n) < 0)
+80107d60:	83 ec 08             	sub    $0x8,%esp
+80107d63:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80107d66:	50                   	push   %eax
+80107d67:	6a 02                	push   $0x2
+80107d69:	e8 b2 fb ff ff       	call   80107920 <argint>
+80107d6e:	83 c4 10             	add    $0x10,%esp
+80107d71:	85 c0                	test   %eax,%eax
+80107d73:	78 33                	js     80107da8 <sys_read+0x78>
+80107d75:	83 ec 04             	sub    $0x4,%esp
+80107d78:	ff 75 f0             	push   -0x10(%ebp)
+80107d7b:	53                   	push   %ebx
+80107d7c:	6a 01                	push   $0x1
+80107d7e:	e8 4d fc ff ff       	call   801079d0 <argwptr>
+80107d83:	83 c4 10             	add    $0x10,%esp
+80107d86:	85 c0                	test   %eax,%eax
+80107d88:	78 1e                	js     80107da8 <sys_read+0x78>
+  return fileread(f, p, n);
+80107d8a:	83 ec 04             	sub    $0x4,%esp
+80107d8d:	ff 75 f0             	push   -0x10(%ebp)
+80107d90:	ff 75 f4             	push   -0xc(%ebp)
+80107d93:	56                   	push   %esi
+80107d94:	e8 f7 97 ff ff       	call   80101590 <fileread>
+80107d99:	83 c4 10             	add    $0x10,%esp
+}
+80107d9c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107d9f:	5b                   	pop    %ebx
+80107da0:	5e                   	pop    %esi
+80107da1:	5d                   	pop    %ebp
+80107da2:	c3                   	ret
+80107da3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107da7:	90                   	nop
+    return -1;
+80107da8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107dad:	eb ed                	jmp    80107d9c <sys_read+0x6c>
+80107daf:	90                   	nop
+
+80107db0 <sys_write>:
+{
+80107db0:	55                   	push   %ebp
+80107db1:	89 e5                	mov    %esp,%ebp
+80107db3:	56                   	push   %esi
+80107db4:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80107db5:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80107db8:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80107dbb:	53                   	push   %ebx
+80107dbc:	6a 00                	push   $0x0
+80107dbe:	e8 5d fb ff ff       	call   80107920 <argint>
+80107dc3:	83 c4 10             	add    $0x10,%esp
+80107dc6:	85 c0                	test   %eax,%eax
+80107dc8:	78 5e                	js     80107e28 <sys_write+0x78>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107dca:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80107dce:	77 58                	ja     80107e28 <sys_write+0x78>
+80107dd0:	e8 ab df ff ff       	call   80105d80 <myproc>
+80107dd5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107dd8:	8b 74 90 44          	mov    0x44(%eax,%edx,4),%esi
+80107ddc:	85 f6                	test   %esi,%esi
+80107dde:	74 48                	je     80107e28 <sys_write+0x78>
+  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+80107de0:	83 ec 08             	sub    $0x8,%esp
+80107de3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80107de6:	50                   	push   %eax
+80107de7:	6a 02                	push   $0x2
+80107de9:	e8 32 fb ff ff       	call   80107920 <argint>
+80107dee:	83 c4 10             	add    $0x10,%esp
+80107df1:	85 c0                	test   %eax,%eax
+80107df3:	78 33                	js     80107e28 <sys_write+0x78>
+80107df5:	83 ec 04             	sub    $0x4,%esp
+80107df8:	ff 75 f0             	push   -0x10(%ebp)
+80107dfb:	53                   	push   %ebx
+80107dfc:	6a 01                	push   $0x1
+80107dfe:	e8 4d fb ff ff       	call   80107950 <argptr>
+80107e03:	83 c4 10             	add    $0x10,%esp
+80107e06:	85 c0                	test   %eax,%eax
+80107e08:	78 1e                	js     80107e28 <sys_write+0x78>
+  return filewrite(f, p, n);
+80107e0a:	83 ec 04             	sub    $0x4,%esp
+80107e0d:	ff 75 f0             	push   -0x10(%ebp)
+80107e10:	ff 75 f4             	push   -0xc(%ebp)
+80107e13:	56                   	push   %esi
+80107e14:	e8 b7 98 ff ff       	call   801016d0 <filewrite>
+80107e19:	83 c4 10             	add    $0x10,%esp
+}
+80107e1c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107e1f:	5b                   	pop    %ebx
+80107e20:	5e                   	pop    %esi
+80107e21:	5d                   	pop    %ebp
+80107e22:	c3                   	ret
+80107e23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80107e27:	90                   	nop
+    return -1;
+80107e28:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107e2d:	eb ed                	jmp    80107e1c <sys_write+0x6c>
+80107e2f:	90                   	nop
+
+80107e30 <sys_close>:
+{
+80107e30:	55                   	push   %ebp
+80107e31:	89 e5                	mov    %esp,%ebp
+80107e33:	56                   	push   %esi
+80107e34:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80107e35:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80107e38:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80107e3b:	50                   	push   %eax
+80107e3c:	6a 00                	push   $0x0
+80107e3e:	e8 dd fa ff ff       	call   80107920 <argint>
+80107e43:	83 c4 10             	add    $0x10,%esp
+80107e46:	85 c0                	test   %eax,%eax
+80107e48:	78 3e                	js     80107e88 <sys_close+0x58>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107e4a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80107e4e:	77 38                	ja     80107e88 <sys_close+0x58>
+80107e50:	e8 2b df ff ff       	call   80105d80 <myproc>
+80107e55:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107e58:	8d 5a 10             	lea    0x10(%edx),%ebx
+80107e5b:	8b 74 98 04          	mov    0x4(%eax,%ebx,4),%esi
+80107e5f:	85 f6                	test   %esi,%esi
+80107e61:	74 25                	je     80107e88 <sys_close+0x58>
+  myproc()->ofile[fd] = 0;
+80107e63:	e8 18 df ff ff       	call   80105d80 <myproc>
+  fileclose(f);
+80107e68:	83 ec 0c             	sub    $0xc,%esp
+  myproc()->ofile[fd] = 0;
+80107e6b:	c7 44 98 04 00 00 00 	movl   $0x0,0x4(%eax,%ebx,4)
+80107e72:	00 
+  fileclose(f);
+80107e73:	56                   	push   %esi
+80107e74:	e8 e7 95 ff ff       	call   80101460 <fileclose>
+  return 0;
+80107e79:	83 c4 10             	add    $0x10,%esp
+80107e7c:	31 c0                	xor    %eax,%eax
+}
+80107e7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107e81:	5b                   	pop    %ebx
+80107e82:	5e                   	pop    %esi
+80107e83:	5d                   	pop    %ebp
+80107e84:	c3                   	ret
+80107e85:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80107e88:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107e8d:	eb ef                	jmp    80107e7e <sys_close+0x4e>
+80107e8f:	90                   	nop
+
+80107e90 <sys_fstat>:
+{
+80107e90:	55                   	push   %ebp
+80107e91:	89 e5                	mov    %esp,%ebp
+80107e93:	56                   	push   %esi
+80107e94:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80107e95:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+{
+80107e98:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+80107e9b:	53                   	push   %ebx
+80107e9c:	6a 00                	push   $0x0
+80107e9e:	e8 7d fa ff ff       	call   80107920 <argint>
+80107ea3:	83 c4 10             	add    $0x10,%esp
+80107ea6:	85 c0                	test   %eax,%eax
+80107ea8:	78 46                	js     80107ef0 <sys_fstat+0x60>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107eaa:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80107eae:	77 40                	ja     80107ef0 <sys_fstat+0x60>
+80107eb0:	e8 cb de ff ff       	call   80105d80 <myproc>
+80107eb5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107eb8:	8b 74 90 44          	mov    0x44(%eax,%edx,4),%esi
+80107ebc:	85 f6                	test   %esi,%esi
+80107ebe:	74 30                	je     80107ef0 <sys_fstat+0x60>
+  if(argfd(0, 0, &f) < 0 || argwptr(1, (void*)&st, sizeof(*st)) < 0)
+80107ec0:	83 ec 04             	sub    $0x4,%esp
+80107ec3:	6a 14                	push   $0x14
+80107ec5:	53                   	push   %ebx
+80107ec6:	6a 01                	push   $0x1
+80107ec8:	e8 03 fb ff ff       	call   801079d0 <argwptr>
+80107ecd:	83 c4 10             	add    $0x10,%esp
+80107ed0:	85 c0                	test   %eax,%eax
+80107ed2:	78 1c                	js     80107ef0 <sys_fstat+0x60>
+  return filestat(f, st);
+80107ed4:	83 ec 08             	sub    $0x8,%esp
+80107ed7:	ff 75 f4             	push   -0xc(%ebp)
+80107eda:	56                   	push   %esi
+80107edb:	e8 60 96 ff ff       	call   80101540 <filestat>
+80107ee0:	83 c4 10             	add    $0x10,%esp
+}
+80107ee3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80107ee6:	5b                   	pop    %ebx
+80107ee7:	5e                   	pop    %esi
+80107ee8:	5d                   	pop    %ebp
+80107ee9:	c3                   	ret
+80107eea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return -1;
+80107ef0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80107ef5:	eb ec                	jmp    80107ee3 <sys_fstat+0x53>
+80107ef7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107efe:	66 90                	xchg   %ax,%ax
+
+80107f00 <sys_fsync>:
+{
+80107f00:	55                   	push   %ebp
+80107f01:	89 e5                	mov    %esp,%ebp
+80107f03:	83 ec 20             	sub    $0x20,%esp
+  if(argint(n, &fd) < 0)
+80107f06:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80107f09:	50                   	push   %eax
+80107f0a:	6a 00                	push   $0x0
+80107f0c:	e8 0f fa ff ff       	call   80107920 <argint>
+80107f11:	83 c4 10             	add    $0x10,%esp
+80107f14:	85 c0                	test   %eax,%eax
+80107f16:	78 28                	js     80107f40 <sys_fsync+0x40>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+80107f18:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+80107f1c:	77 22                	ja     80107f40 <sys_fsync+0x40>
+80107f1e:	e8 5d de ff ff       	call   80105d80 <myproc>
+80107f23:	8b 55 f4             	mov    -0xc(%ebp),%edx
+80107f26:	8b 44 90 44          	mov    0x44(%eax,%edx,4),%eax
+80107f2a:	85 c0                	test   %eax,%eax
+80107f2c:	74 12                	je     80107f40 <sys_fsync+0x40>
+  log_sync();
+80107f2e:	e8 3d c9 ff ff       	call   80104870 <log_sync>
+  return 0;
+80107f33:	31 c0                	xor    %eax,%eax
+}
+80107f35:	c9                   	leave
+80107f36:	c3                   	ret
+80107f37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107f3e:	66 90                	xchg   %ax,%ax
+80107f40:	c9                   	leave
+    return -1;
+80107f41:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80107f46:	c3                   	ret
+80107f47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80107f4e:	66 90                	xchg   %ax,%ax
+
+80107f50 <sys_link>:
+{
+80107f50:	55                   	push   %ebp
+80107f51:	89 e5                	mov    %esp,%ebp
+80107f53:	57                   	push   %edi
+80107f54:	56                   	push   %esi
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+80107f55:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+{
+80107f58:	53                   	push   %ebx
+80107f59:	83 ec 34             	sub    $0x34,%esp
+  if(argstr(0, &old) < 0 || argstr(1, &new) < 0)
+80107f5c:	50                   	push   %eax
+80107f5d:	6a 00                	push   $0x0
+80107f5f:	e8 bc fa ff ff       	call   80107a20 <argstr>
+80107f64:	83 c4 10             	add    $0x10,%esp
+80107f67:	85 c0                	test   %eax,%eax
+80107f69:	0f 88 fb 00 00 00    	js     8010806a <sys_link+0x11a>
+80107f6f:	83 ec 08             	sub    $0x8,%esp
+80107f72:	8d 45 d0             	lea    -0x30(%ebp),%eax
+80107f75:	50                   	push   %eax
+80107f76:	6a 01                	push   $0x1
+80107f78:	e8 a3 fa ff ff       	call   80107a20 <argstr>
+80107f7d:	83 c4 10             	add    $0x10,%esp
+80107f80:	85 c0                	test   %eax,%eax
+80107f82:	0f 88 e2 00 00 00    	js     8010806a <sys_link+0x11a>
+  begin_op();
+80107f88:	e8 d3 c7 ff ff       	call   80104760 <begin_op>
+  if((ip = namei(old)) == 0){
+80107f8d:	83 ec 0c             	sub    $0xc,%esp
+80107f90:	ff 75 d4             	push   -0x2c(%ebp)
+80107f93:	e8 68 b6 ff ff       	call   80103600 <namei>
+80107f98:	83 c4 10             	add    $0x10,%esp
+80107f9b:	89 c3                	mov    %eax,%ebx
+80107f9d:	85 c0                	test   %eax,%eax
+80107f9f:	0f 84 df 00 00 00    	je     80108084 <sys_link+0x134>
+  ilock(ip);
+80107fa5:	83 ec 0c             	sub    $0xc,%esp
+80107fa8:	50                   	push   %eax
+80107fa9:	e8 b2 a8 ff ff       	call   80102860 <ilock>
+  if(ip->type == T_DIR){
+80107fae:	83 c4 10             	add    $0x10,%esp
+80107fb1:	66 83 7b 60 01       	cmpw   $0x1,0x60(%ebx)
+80107fb6:	0f 84 b5 00 00 00    	je     80108071 <sys_link+0x121>
+  iupdate(ip);
+80107fbc:	83 ec 0c             	sub    $0xc,%esp
+  ip->nlink++;
+80107fbf:	66 83 43 66 01       	addw   $0x1,0x66(%ebx)
+  if((dp = nameiparent(new, name)) == 0)
+80107fc4:	8d 7d da             	lea    -0x26(%ebp),%edi
+  iupdate(ip);
+80107fc7:	53                   	push   %ebx
+80107fc8:	e8 73 a3 ff ff       	call   80102340 <iupdate>
+  iunlock(ip);
+80107fcd:	89 1c 24             	mov    %ebx,(%esp)
+80107fd0:	e8 6b a9 ff ff       	call   80102940 <iunlock>
+  if((dp = nameiparent(new, name)) == 0)
+80107fd5:	58                   	pop    %eax
+80107fd6:	5a                   	pop    %edx
+80107fd7:	57                   	push   %edi
+80107fd8:	ff 75 d0             	push   -0x30(%ebp)
+80107fdb:	e8 40 b6 ff ff       	call   80103620 <nameiparent>
+80107fe0:	83 c4 10             	add    $0x10,%esp
+80107fe3:	89 c6                	mov    %eax,%esi
+80107fe5:	85 c0                	test   %eax,%eax
+80107fe7:	74 5b                	je     80108044 <sys_link+0xf4>
+  ilock(dp);
+80107fe9:	83 ec 0c             	sub    $0xc,%esp
+80107fec:	50                   	push   %eax
+80107fed:	e8 6e a8 ff ff       	call   80102860 <ilock>
+  if(dp->dev != ip->dev || dirlink(dp, name, ip->inum) < 0){
+80107ff2:	8b 03                	mov    (%ebx),%eax
+80107ff4:	83 c4 10             	add    $0x10,%esp
+80107ff7:	39 06                	cmp    %eax,(%esi)
+80107ff9:	75 3d                	jne    80108038 <sys_link+0xe8>
+80107ffb:	83 ec 04             	sub    $0x4,%esp
+80107ffe:	ff 73 04             	push   0x4(%ebx)
+80108001:	57                   	push   %edi
+80108002:	56                   	push   %esi
+80108003:	e8 78 b3 ff ff       	call   80103380 <dirlink>
+80108008:	83 c4 10             	add    $0x10,%esp
+8010800b:	85 c0                	test   %eax,%eax
+8010800d:	78 29                	js     80108038 <sys_link+0xe8>
+  iunlockput(dp);
+8010800f:	83 ec 0c             	sub    $0xc,%esp
+80108012:	56                   	push   %esi
+80108013:	e8 38 ab ff ff       	call   80102b50 <iunlockput>
+  iput(ip);
+80108018:	89 1c 24             	mov    %ebx,(%esp)
+8010801b:	e8 70 a9 ff ff       	call   80102990 <iput>
+  end_op();
+80108020:	e8 db c7 ff ff       	call   80104800 <end_op>
+  return 0;
+80108025:	83 c4 10             	add    $0x10,%esp
+80108028:	31 c0                	xor    %eax,%eax
+}
+8010802a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010802d:	5b                   	pop    %ebx
+8010802e:	5e                   	pop    %esi
+8010802f:	5f                   	pop    %edi
+80108030:	5d                   	pop    %ebp
+80108031:	c3                   	ret
+80108032:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    iunlockput(dp);
+80108038:	83 ec 0c             	sub    $0xc,%esp
+8010803b:	56                   	push   %esi
+8010803c:	e8 0f ab ff ff       	call   80102b50 <iunlockput>
+    goto bad;
+80108041:	83 c4 10             	add    $0x10,%esp
+  ilock(ip);
+80108044:	83 ec 0c             	sub    $0xc,%esp
+80108047:	53                   	push   %ebx
+80108048:	e8 13 a8 ff ff       	call   80102860 <ilock>
+  ip->nlink--;
+8010804d:	66 83 6b 66 01       	subw   $0x1,0x66(%ebx)
+  iupdate(ip);
+80108052:	89 1c 24             	mov    %ebx,(%esp)
+80108055:	e8 e6 a2 ff ff       	call   80102340 <iupdate>
+  iunlockput(ip);
+8010805a:	89 1c 24             	mov    %ebx,(%esp)
+8010805d:	e8 ee aa ff ff       	call   80102b50 <iunlockput>
+  end_op();
+80108062:	e8 99 c7 ff ff       	call   80104800 <end_op>
+  return -1;
+80108067:	83 c4 10             	add    $0x10,%esp
+    return -1;
+8010806a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010806f:	eb b9                	jmp    8010802a <sys_link+0xda>
+    iunlockput(ip);
+80108071:	83 ec 0c             	sub    $0xc,%esp
+80108074:	53                   	push   %ebx
+80108075:	e8 d6 aa ff ff       	call   80102b50 <iunlockput>
+    end_op();
+8010807a:	e8 81 c7 ff ff       	call   80104800 <end_op>
+    return -1;
+8010807f:	83 c4 10             	add    $0x10,%esp
+80108082:	eb e6                	jmp    8010806a <sys_link+0x11a>
+    end_op();
+80108084:	e8 77 c7 ff ff       	call   80104800 <end_op>
+    return -1;
+80108089:	eb df                	jmp    8010806a <sys_link+0x11a>
+8010808b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010808f:	90                   	nop
+
+80108090 <sys_unlink>:
+{
+80108090:	55                   	push   %ebp
+80108091:	89 e5                	mov    %esp,%ebp
+80108093:	57                   	push   %edi
+80108094:	56                   	push   %esi
+  if(argstr(0, &path) < 0)
+80108095:	8d 45 c0             	lea    -0x40(%ebp),%eax
+{
+80108098:	53                   	push   %ebx
+80108099:	83 ec 54             	sub    $0x54,%esp
+  if(argstr(0, &path) < 0)
+8010809c:	50                   	push   %eax
+8010809d:	6a 00                	push   $0x0
+8010809f:	e8 7c f9 ff ff       	call   80107a20 <argstr>
+801080a4:	83 c4 10             	add    $0x10,%esp
+801080a7:	85 c0                	test   %eax,%eax
+801080a9:	0f 88 a9 01 00 00    	js     80108258 <sys_unlink+0x1c8>
+  begin_op();
+801080af:	e8 ac c6 ff ff       	call   80104760 <begin_op>
+  if((dp = nameiparent(path, name)) == 0){
+801080b4:	83 ec 08             	sub    $0x8,%esp
+801080b7:	8d 45 ca             	lea    -0x36(%ebp),%eax
+801080ba:	50                   	push   %eax
+801080bb:	ff 75 c0             	push   -0x40(%ebp)
+801080be:	e8 5d b5 ff ff       	call   80103620 <nameiparent>
+801080c3:	83 c4 10             	add    $0x10,%esp
+801080c6:	89 45 b4             	mov    %eax,-0x4c(%ebp)
+801080c9:	85 c0                	test   %eax,%eax
+801080cb:	0f 84 b0 01 00 00    	je     80108281 <sys_unlink+0x1f1>
+  ilock(dp);
+801080d1:	8b 75 b4             	mov    -0x4c(%ebp),%esi
+801080d4:	83 ec 0c             	sub    $0xc,%esp
+801080d7:	56                   	push   %esi
+801080d8:	e8 83 a7 ff ff       	call   80102860 <ilock>
+  if(namecmp(name, ".") == 0 || namecmp(name, "..") == 0)
+801080dd:	8d 45 ca             	lea    -0x36(%ebp),%eax
+801080e0:	5a                   	pop    %edx
+801080e1:	59                   	pop    %ecx
+801080e2:	68 b0 b6 10 80       	push   $0x8010b6b0
+801080e7:	50                   	push   %eax
+801080e8:	e8 63 ad ff ff       	call   80102e50 <namecmp>
+801080ed:	83 c4 10             	add    $0x10,%esp
+801080f0:	85 c0                	test   %eax,%eax
+801080f2:	0f 84 4d 01 00 00    	je     80108245 <sys_unlink+0x1b5>
+801080f8:	83 ec 08             	sub    $0x8,%esp
+801080fb:	8d 45 ca             	lea    -0x36(%ebp),%eax
+801080fe:	68 af b6 10 80       	push   $0x8010b6af
+80108103:	50                   	push   %eax
+80108104:	e8 47 ad ff ff       	call   80102e50 <namecmp>
+80108109:	83 c4 10             	add    $0x10,%esp
+8010810c:	85 c0                	test   %eax,%eax
+8010810e:	0f 84 31 01 00 00    	je     80108245 <sys_unlink+0x1b5>
+  if((ip = dirlookup(dp, name, &off)) == 0)
+80108114:	83 ec 04             	sub    $0x4,%esp
+80108117:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+8010811a:	50                   	push   %eax
+8010811b:	8d 45 ca             	lea    -0x36(%ebp),%eax
+8010811e:	50                   	push   %eax
+8010811f:	56                   	push   %esi
+80108120:	e8 8b ad ff ff       	call   80102eb0 <dirlookup>
+80108125:	83 c4 10             	add    $0x10,%esp
+80108128:	89 c3                	mov    %eax,%ebx
+8010812a:	85 c0                	test   %eax,%eax
+8010812c:	0f 84 13 01 00 00    	je     80108245 <sys_unlink+0x1b5>
+  ilock(ip);
+80108132:	83 ec 0c             	sub    $0xc,%esp
+80108135:	50                   	push   %eax
+80108136:	e8 25 a7 ff ff       	call   80102860 <ilock>
+  if(ip->nlink < 1)
+8010813b:	83 c4 10             	add    $0x10,%esp
+8010813e:	66 83 7b 66 00       	cmpw   $0x0,0x66(%ebx)
+80108143:	0f 8e 59 01 00 00    	jle    801082a2 <sys_unlink+0x212>
+  if(ip->type == T_DIR && !isdirempty(ip)){
+80108149:	66 83 7b 60 01       	cmpw   $0x1,0x60(%ebx)
+8010814e:	8d 75 d8             	lea    -0x28(%ebp),%esi
+80108151:	74 7d                	je     801081d0 <sys_unlink+0x140>
+  memset(&de, 0, sizeof(de));
+80108153:	83 ec 04             	sub    $0x4,%esp
+80108156:	6a 10                	push   $0x10
+80108158:	6a 00                	push   $0x0
+8010815a:	56                   	push   %esi
+8010815b:	e8 d0 f4 ff ff       	call   80107630 <memset>
+  if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+80108160:	6a 10                	push   $0x10
+80108162:	ff 75 c4             	push   -0x3c(%ebp)
+80108165:	56                   	push   %esi
+80108166:	ff 75 b4             	push   -0x4c(%ebp)
+80108169:	e8 d2 ab ff ff       	call   80102d40 <writei>
+8010816e:	83 c4 20             	add    $0x20,%esp
+80108171:	83 f8 10             	cmp    $0x10,%eax
+80108174:	0f 85 1b 01 00 00    	jne    80108295 <sys_unlink+0x205>
+  dcinval(dp, name);
+8010817a:	83 ec 08             	sub    $0x8,%esp
+8010817d:	8d 45 ca             	lea    -0x36(%ebp),%eax
+80108180:	50                   	push   %eax
+80108181:	ff 75 b4             	push   -0x4c(%ebp)
+80108184:	e8 e7 ac ff ff       	call   80102e70 <dcinval>
+  if(ip->type == T_DIR){
+80108189:	83 c4 10             	add    $0x10,%esp
+8010818c:	66 83 7b 60 01       	cmpw   $0x1,0x60(%ebx)
+80108191:	0f 84 d1 00 00 00    	je     80108268 <sys_unlink+0x1d8>
+  iunlockput(dp);
+80108197:	83 ec 0c             	sub    $0xc,%esp
+8010819a:	ff 75 b4             	push   -0x4c(%ebp)
+8010819d:	e8 ae a9 ff ff       	call   80102b50 <iunlockput>
+  ip->nlink--;
+801081a2:	66 83 6b 66 01       	subw   $0x1,0x66(%ebx)
+  iupdate(ip);
+801081a7:	89 1c 24             	mov    %ebx,(%esp)
+801081aa:	e8 91 a1 ff ff       	call   80102340 <iupdate>
+  iunlockput(ip);
+801081af:	89 1c 24             	mov    %ebx,(%esp)
+801081b2:	e8 99 a9 ff ff       	call   80102b50 <iunlockput>
+  end_op();
+801081b7:	e8 44 c6 ff ff       	call   80104800 <end_op>
+  return 0;
+801081bc:	83 c4 10             	add    $0x10,%esp
+801081bf:	31 c0                	xor    %eax,%eax
+}
+801081c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801081c4:	5b                   	pop    %ebx
+801081c5:	5e                   	pop    %esi
+801081c6:	5f                   	pop    %edi
+801081c7:	5d                   	pop    %ebp
+801081c8:	c3                   	ret
+801081c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for(off=0; off<dp->size; off+=sizeof(de)){
+801081d0:	8b 43 68             	mov    0x68(%ebx),%eax
+801081d3:	85 c0                	test   %eax,%eax
+801081d5:	0f 84 78 ff ff ff    	je     80108153 <sys_unlink+0xc3>
+801081db:	31 ff                	xor    %edi,%edi
+801081dd:	eb 0d                	jmp    801081ec <sys_unlink+0x15c>
+801081df:	90                   	nop
+801081e0:	83 c7 10             	add    $0x10,%edi
+801081e3:	3b 7b 68             	cmp    0x68(%ebx),%edi
+801081e6:	0f 83 67 ff ff ff    	jae    80108153 <sys_unlink+0xc3>
+    if(readi(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
+801081ec:	6a 10                	push   $0x10
+801081ee:	57                   	push   %edi
+801081ef:	56                   	push   %esi
+801081f0:	53                   	push   %ebx
+801081f1:	e8 da a9 ff ff       	call   80102bd0 <readi>
+801081f6:	83 c4 10             	add    $0x10,%esp
+801081f9:	83 f8 10             	cmp    $0x10,%eax
+801081fc:	0f 85 86 00 00 00    	jne    80108288 <sys_unlink+0x1f8>
+    if(de.inum != 0 && namecmp(de.name, ".") != 0 && namecmp(de.name, "..") != 0)
+80108202:	66 83 7d d8 00       	cmpw   $0x0,-0x28(%ebp)
+80108207:	74 d7                	je     801081e0 <sys_unlink+0x150>
+80108209:	83 ec 08             	sub    $0x8,%esp
+8010820c:	8d 45 da             	lea    -0x26(%ebp),%eax
+8010820f:	68 b0 b6 10 80       	push   $0x8010b6b0
+80108214:	50                   	push   %eax
+80108215:	e8 36 ac ff ff       	call   80102e50 <namecmp>
+8010821a:	83 c4 10             	add    $0x10,%esp
+8010821d:	85 c0                	test   %eax,%eax
+8010821f:	74 bf                	je     801081e0 <sys_unlink+0x150>
+80108221:	83 ec 08             	sub    $0x8,%esp
+80108224:	8d 45 da             	lea    -0x26(%ebp),%eax
+80108227:	68 af b6 10 80       	push   $0x8010b6af
+8010822c:	50                   	push   %eax
+8010822d:	e8 1e ac ff ff       	call   80102e50 <namecmp>
+80108232:	83 c4 10             	add    $0x10,%esp
+80108235:	85 c0                	test   %eax,%eax
+80108237:	74 a7                	je     801081e0 <sys_unlink+0x150>
+    iunlockput(ip);
+80108239:	83 ec 0c             	sub    $0xc,%esp
+8010823c:	53                   	push   %ebx
+8010823d:	e8 0e a9 ff ff       	call   80102b50 <iunlockput>
+    goto bad;
+80108242:	83 c4 10             	add    $0x10,%esp
+  iunlockput(dp);
+80108245:	83 ec 0c             	sub    $0xc,%esp
+80108248:	ff 75 b4             	push   -0x4c(%ebp)
+8010824b:	e8 00 a9 ff ff       	call   80102b50 <iunlockput>
+  end_op();
+80108250:	e8 ab c5 ff ff       	call   80104800 <end_op>
+  return -1;
+80108255:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80108258:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010825d:	e9 5f ff ff ff       	jmp    801081c1 <sys_unlink+0x131>
+80108262:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    dp->nlink--;
+80108268:	8b 45 b4             	mov    -0x4c(%ebp),%eax
+    iupdate(dp);
+8010826b:	83 ec 0c             	sub    $0xc,%esp
+    dp->nlink--;
+8010826e:	66 83 68 66 01       	subw   $0x1,0x66(%eax)
+    iupdate(dp);
+80108273:	50                   	push   %eax
+80108274:	e8 c7 a0 ff ff       	call   80102340 <iupdate>
+80108279:	83 c4 10             	add    $0x10,%esp
+8010827c:	e9 16 ff ff ff       	jmp    80108197 <sys_unlink+0x107>
+    end_op();
+80108281:	e8 7a c5 ff ff       	call   80104800 <end_op>
+    return -1;
+80108286:	eb d0                	jmp    80108258 <sys_unlink+0x1c8>
+      panic("isdirempty: readi");
+80108288:	83 ec 0c             	sub    $0xc,%esp
+8010828b:	68 c4 b6 10 80       	push   $0x8010b6c4
+80108290:	e8 eb 85 ff ff       	call   80100880 <panic>
+    panic("unlink: writei");
+80108295:	83 ec 0c             	sub    $0xc,%esp
+80108298:	68 d6 b6 10 80       	push   $0x8010b6d6
+8010829d:	e8 de 85 ff ff       	call   80100880 <panic>
+    panic("unlink: nlink < 1");
+801082a2:	83 ec 0c             	sub    $0xc,%esp
+801082a5:	68 b2 b6 10 80       	push   $0x8010b6b2
+801082aa:	e8 d1 85 ff ff       	call   80100880 <panic>
+801082af:	90                   	nop
+
+801082b0 <sys_open>:
+
+int
+sys_open(void)
+{
+801082b0:	55                   	push   %ebp
+801082b1:	89 e5                	mov    %esp,%ebp
+801082b3:	57                   	push   %edi
+801082b4:	56                   	push   %esi
+  char *path;
+  int fd, omode;
+  struct file *f;
+  struct inode *ip;
+
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+801082b5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+801082b8:	53                   	push   %ebx
+801082b9:	83 ec 24             	sub    $0x24,%esp
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+801082bc:	50                   	push   %eax
+801082bd:	6a 00                	push   $0x0
+801082bf:	e8 5c f7 ff ff       	call   80107a20 <argstr>
+801082c4:	83 c4 10             	add    $0x10,%esp
+801082c7:	85 c0                	test   %eax,%eax
+801082c9:	0f 88 8e 00 00 00    	js     8010835d <sys_open+0xad>
+801082cf:	83 ec 08             	sub    $0x8,%esp
+801082d2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+801082d5:	50                   	push   %eax
+801082d6:	6a 01                	push   $0x1
+801082d8:	e8 43 f6 ff ff       	call   80107920 <argint>
+801082dd:	83 c4 10             	add    $0x10,%esp
+801082e0:	85 c0                	test   %eax,%eax
+801082e2:	78 79                	js     8010835d <sys_open+0xad>
+    return -1;
+
+  begin_op();
+801082e4:	e8 77 c4 ff ff       	call   80104760 <begin_op>
+
+  if(omode & O_CREATE){
+801082e9:	f6 45 e5 02          	testb  $0x2,-0x1b(%ebp)
+801082ed:	75 79                	jne    80108368 <sys_open+0xb8>
+    if(ip == 0){
+      end_op();
+      return -1;
+    }
+  } else {
+    if((ip = namei(path)) == 0){
+801082ef:	83 ec 0c             	sub    $0xc,%esp
+801082f2:	ff 75 e0             	push   -0x20(%ebp)
+801082f5:	e8 06 b3 ff ff       	call   80103600 <namei>
+801082fa:	83 c4 10             	add    $0x10,%esp
+801082fd:	89 c6                	mov    %eax,%esi
+801082ff:	85 c0                	test   %eax,%eax
+80108301:	0f 84 7e 00 00 00    	je     80108385 <sys_open+0xd5>
+      end_op();
+      return -1;
+    }
+    ilock(ip);
+80108307:	83 ec 0c             	sub    $0xc,%esp
+8010830a:	50                   	push   %eax
+8010830b:	e8 50 a5 ff ff       	call   80102860 <ilock>
+    if(ip->type == T_DIR && omode != O_RDONLY){
+80108310:	83 c4 10             	add    $0x10,%esp
+80108313:	66 83 7e 60 01       	cmpw   $0x1,0x60(%esi)
+80108318:	0f 84 ba 00 00 00    	je     801083d8 <sys_open+0x128>
+      end_op();
+      return -1;
+    }
+  }
+
+  if((f = filealloc()) == 0 || (fd = fdalloc(f)) < 0){
+8010831e:	e8 6d 90 ff ff       	call   80101390 <filealloc>
+80108323:	89 c7                	mov    %eax,%edi
+80108325:	85 c0                	test   %eax,%eax
+80108327:	74 23                	je     8010834c <sys_open+0x9c>
+  struct proc *curproc = myproc();
+80108329:	e8 52 da ff ff       	call   80105d80 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+8010832e:	31 db                	xor    %ebx,%ebx
+    if(curproc->ofile[fd] == 0){
+80108330:	8b 54 98 44          	mov    0x44(%eax,%ebx,4),%edx
+80108334:	85 d2                	test   %edx,%edx
+80108336:	74 58                	je     80108390 <sys_open+0xe0>
+  for(fd = 0; fd < NOFILE; fd++){
+80108338:	83 c3 01             	add    $0x1,%ebx
+8010833b:	83 fb 10             	cmp    $0x10,%ebx
+8010833e:	75 f0                	jne    80108330 <sys_open+0x80>
+    if(f)
+      fileclose(f);
+80108340:	83 ec 0c             	sub    $0xc,%esp
+80108343:	57                   	push   %edi
+80108344:	e8 17 91 ff ff       	call   80101460 <fileclose>
+80108349:	83 c4 10             	add    $0x10,%esp
+    iunlockput(ip);
+8010834c:	83 ec 0c             	sub    $0xc,%esp
+8010834f:	56                   	push   %esi
+80108350:	e8 fb a7 ff ff       	call   80102b50 <iunlockput>
+    end_op();
+80108355:	e8 a6 c4 ff ff       	call   80104800 <end_op>
+    return -1;
+8010835a:	83 c4 10             	add    $0x10,%esp
+    return -1;
+8010835d:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80108362:	eb 65                	jmp    801083c9 <sys_open+0x119>
+80108364:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    ip = create(path, T_FILE, 0, 0);
+80108368:	83 ec 0c             	sub    $0xc,%esp
+8010836b:	31 c9                	xor    %ecx,%ecx
+8010836d:	ba 02 00 00 00       	mov    $0x2,%edx
+80108372:	6a 00                	push   $0x0
+80108374:	8b 45 e0             	mov    -0x20(%ebp),%eax
+80108377:	e8 74 f7 ff ff       	call   80107af0 <create>
+    if(ip == 0){
+8010837c:	83 c4 10             	add    $0x10,%esp
+    ip = create(path, T_FILE, 0, 0);
+8010837f:	89 c6                	mov    %eax,%esi
+    if(ip == 0){
+80108381:	85 c0                	test   %eax,%eax
+80108383:	75 99                	jne    8010831e <sys_open+0x6e>
+      end_op();
+80108385:	e8 76 c4 ff ff       	call   80104800 <end_op>
+      return -1;
+8010838a:	eb d1                	jmp    8010835d <sys_open+0xad>
+8010838c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  }
+  iunlock(ip);
+80108390:	83 ec 0c             	sub    $0xc,%esp
+      curproc->ofile[fd] = f;
+80108393:	89 7c 98 44          	mov    %edi,0x44(%eax,%ebx,4)
+  iunlock(ip);
+80108397:	56                   	push   %esi
+80108398:	e8 a3 a5 ff ff       	call   80102940 <iunlock>
+  end_op();
+8010839d:	e8 5e c4 ff ff       	call   80104800 <end_op>
+
+  f->type = FD_INODE;
+801083a2:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  f->ip = ip;
+  f->off = 0;
+  f->readable = !(omode & O_WRONLY);
+801083a8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+801083ab:	83 c4 10             	add    $0x10,%esp
+  f->ip = ip;
+801083ae:	89 77 10             	mov    %esi,0x10(%edi)
+  f->readable = !(omode & O_WRONLY);
+801083b1:	89 d0                	mov    %edx,%eax
+  f->off = 0;
+801083b3:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+  f->readable = !(omode & O_WRONLY);
+801083ba:	f7 d0                	not    %eax
+801083bc:	83 e0 01             	and    $0x1,%eax
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+801083bf:	83 e2 03             	and    $0x3,%edx
+  f->readable = !(omode & O_WRONLY);
+801083c2:	88 47 08             	mov    %al,0x8(%edi)
+  f->writable = (omode & O_WRONLY) || (omode & O_RDWR);
+801083c5:	0f 95 47 09          	setne  0x9(%edi)
+  return fd;
+}
+801083c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801083cc:	89 d8                	mov    %ebx,%eax
+801083ce:	5b                   	pop    %ebx
+801083cf:	5e                   	pop    %esi
+801083d0:	5f                   	pop    %edi
+801083d1:	5d                   	pop    %ebp
+801083d2:	c3                   	ret
+801083d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801083d7:	90                   	nop
+    if(ip->type == T_DIR && omode != O_RDONLY){
+801083d8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+801083db:	85 c9                	test   %ecx,%ecx
+801083dd:	0f 84 3b ff ff ff    	je     8010831e <sys_open+0x6e>
+801083e3:	e9 64 ff ff ff       	jmp    8010834c <sys_open+0x9c>
+801083e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801083ef:	90                   	nop
+
+801083f0 <sys_mkdir>:
+
+int
+sys_mkdir(void)
+{
+801083f0:	55                   	push   %ebp
+801083f1:	89 e5                	mov    %esp,%ebp
+801083f3:	83 ec 18             	sub    $0x18,%esp
+  char *path;
+  struct inode *ip;
+
+  begin_op();
+801083f6:	e8 65 c3 ff ff       	call   80104760 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = create(path, T_DIR, 0, 0)) == 0){
+801083fb:	83 ec 08             	sub    $0x8,%esp
+801083fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108401:	50                   	push   %eax
+80108402:	6a 00                	push   $0x0
+80108404:	e8 17 f6 ff ff       	call   80107a20 <argstr>
+80108409:	83 c4 10             	add    $0x10,%esp
+8010840c:	85 c0                	test   %eax,%eax
+8010840e:	78 30                	js     80108440 <sys_mkdir+0x50>
+80108410:	83 ec 0c             	sub    $0xc,%esp
+80108413:	31 c9                	xor    %ecx,%ecx
+80108415:	ba 01 00 00 00       	mov    $0x1,%edx
+8010841a:	6a 00                	push   $0x0
+8010841c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+8010841f:	e8 cc f6 ff ff       	call   80107af0 <create>
+80108424:	83 c4 10             	add    $0x10,%esp
+80108427:	85 c0                	test   %eax,%eax
+80108429:	74 15                	je     80108440 <sys_mkdir+0x50>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+8010842b:	83 ec 0c             	sub    $0xc,%esp
+8010842e:	50                   	push   %eax
+8010842f:	e8 1c a7 ff ff       	call   80102b50 <iunlockput>
+  end_op();
+80108434:	e8 c7 c3 ff ff       	call   80104800 <end_op>
+  return 0;
+80108439:	83 c4 10             	add    $0x10,%esp
+8010843c:	31 c0                	xor    %eax,%eax
+}
+8010843e:	c9                   	leave
+8010843f:	c3                   	ret
+    end_op();
+80108440:	e8 bb c3 ff ff       	call   80104800 <end_op>
+    return -1;
+80108445:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010844a:	c9                   	leave
+8010844b:	c3                   	ret
+8010844c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108450 <sys_mknod>:
+
+int
+sys_mknod(void)
+{
+80108450:	55                   	push   %ebp
+80108451:	89 e5                	mov    %esp,%ebp
+80108453:	83 ec 18             	sub    $0x18,%esp
+  struct inode *ip;
+  char *path;
+  int major, minor;
+
+  begin_op();
+80108456:	e8 05 c3 ff ff       	call   80104760 <begin_op>
+  if((argstr(0, &path)) < 0 ||
+8010845b:	83 ec 08             	sub    $0x8,%esp
+8010845e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+80108461:	50                   	push   %eax
+80108462:	6a 00                	push   $0x0
+80108464:	e8 b7 f5 ff ff       	call   80107a20 <argstr>
+80108469:	83 c4 10             	add    $0x10,%esp
+8010846c:	85 c0                	test   %eax,%eax
+8010846e:	78 60                	js     801084d0 <sys_mknod+0x80>
+     argint(1, &major) < 0 ||
+80108470:	83 ec 08             	sub    $0x8,%esp
+80108473:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108476:	50                   	push   %eax
+80108477:	6a 01                	push   $0x1
+80108479:	e8 a2 f4 ff ff       	call   80107920 <argint>
+  if((argstr(0, &path)) < 0 ||
+8010847e:	83 c4 10             	add    $0x10,%esp
+80108481:	85 c0                	test   %eax,%eax
+80108483:	78 4b                	js     801084d0 <sys_mknod+0x80>
+     argint(2, &minor) < 0 ||
+80108485:	83 ec 08             	sub    $0x8,%esp
+80108488:	8d 45 f4             	lea    -0xc(%ebp),%eax
+8010848b:	50                   	push   %eax
+8010848c:	6a 02                	push   $0x2
+8010848e:	e8 8d f4 ff ff       	call   80107920 <argint>
+     argint(1, &major) < 0 ||
+80108493:	83 c4 10             	add    $0x10,%esp
+80108496:	85 c0                	test   %eax,%eax
+80108498:	78 36                	js     801084d0 <sys_mknod+0x80>
+     (ip = create(path, T_DEV, major, minor)) == 0){
+8010849a:	0f bf 45 f4          	movswl -0xc(%ebp),%eax
+8010849e:	83 ec 0c             	sub    $0xc,%esp
+801084a1:	0f bf 4d f0          	movswl -0x10(%ebp),%ecx
+801084a5:	ba 03 00 00 00       	mov    $0x3,%edx
+801084aa:	50                   	push   %eax
+801084ab:	8b 45 ec             	mov    -0x14(%ebp),%eax
+801084ae:	e8 3d f6 ff ff       	call   80107af0 <create>
+     argint(2, &minor) < 0 ||
+801084b3:	83 c4 10             	add    $0x10,%esp
+801084b6:	85 c0                	test   %eax,%eax
+801084b8:	74 16                	je     801084d0 <sys_mknod+0x80>
+    end_op();
+    return -1;
+  }
+  iunlockput(ip);
+801084ba:	83 ec 0c             	sub    $0xc,%esp
+801084bd:	50                   	push   %eax
+801084be:	e8 8d a6 ff ff       	call   80102b50 <iunlockput>
+  end_op();
+801084c3:	e8 38 c3 ff ff       	call   80104800 <end_op>
+  return 0;
+801084c8:	83 c4 10             	add    $0x10,%esp
+801084cb:	31 c0                	xor    %eax,%eax
+}
+801084cd:	c9                   	leave
+801084ce:	c3                   	ret
+801084cf:	90                   	nop
+    end_op();
+801084d0:	e8 2b c3 ff ff       	call   80104800 <end_op>
+    return -1;
+801084d5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+801084da:	c9                   	leave
+801084db:	c3                   	ret
+801084dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801084e0 <sys_chdir>:
+
+int
+sys_chdir(void)
+{
+801084e0:	55                   	push   %ebp
+801084e1:	89 e5                	mov    %esp,%ebp
+801084e3:	56                   	push   %esi
+801084e4:	53                   	push   %ebx
+801084e5:	83 ec 10             	sub    $0x10,%esp
+  char *path;
+  struct inode *ip;
+  struct proc *curproc = myproc();
+801084e8:	e8 93 d8 ff ff       	call   80105d80 <myproc>
+801084ed:	89 c6                	mov    %eax,%esi
+  
+  begin_op();
+801084ef:	e8 6c c2 ff ff       	call   80104760 <begin_op>
+  if(argstr(0, &path) < 0 || (ip = namei(path)) == 0){
+801084f4:	83 ec 08             	sub    $0x8,%esp
+801084f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801084fa:	50                   	push   %eax
+801084fb:	6a 00                	push   $0x0
+801084fd:	e8 1e f5 ff ff       	call   80107a20 <argstr>
+80108502:	83 c4 10             	add    $0x10,%esp
+80108505:	85 c0                	test   %eax,%eax
+80108507:	78 77                	js     80108580 <sys_chdir+0xa0>
+80108509:	83 ec 0c             	sub    $0xc,%esp
+8010850c:	ff 75 f4             	push   -0xc(%ebp)
+8010850f:	e8 ec b0 ff ff       	call   80103600 <namei>
+80108514:	83 c4 10             	add    $0x10,%esp
+80108517:	89 c3                	mov    %eax,%ebx
+80108519:	85 c0                	test   %eax,%eax
+8010851b:	74 63                	je     80108580 <sys_chdir+0xa0>
+    end_op();
+    return -1;
+  }
+  ilock(ip);
+8010851d:	83 ec 0c             	sub    $0xc,%esp
+80108520:	50                   	push   %eax
+80108521:	e8 3a a3 ff ff       	call   80102860 <ilock>
+  if(ip->type != T_DIR){
+80108526:	83 c4 10             	add    $0x10,%esp
+80108529:	66 83 7b 60 01       	cmpw   $0x1,0x60(%ebx)
+8010852e:	75 30                	jne    80108560 <sys_chdir+0x80>
+    iunlockput(ip);
+    end_op();
+    return -1;
+  }
+  iunlock(ip);
+80108530:	83 ec 0c             	sub    $0xc,%esp
+80108533:	53                   	push   %ebx
+80108534:	e8 07 a4 ff ff       	call   80102940 <iunlock>
+  iput(curproc->cwd);
+80108539:	58                   	pop    %eax
+8010853a:	ff b6 84 00 00 00    	push   0x84(%esi)
+80108540:	e8 4b a4 ff ff       	call   80102990 <iput>
+  end_op();
+80108545:	e8 b6 c2 ff ff       	call   80104800 <end_op>
+  curproc->cwd = ip;
+8010854a:	89 9e 84 00 00 00    	mov    %ebx,0x84(%esi)
+  return 0;
+80108550:	83 c4 10             	add    $0x10,%esp
+80108553:	31 c0                	xor    %eax,%eax
+}
+80108555:	8d 65 f8             	lea    -0x8(%ebp),%esp
+80108558:	5b                   	pop    %ebx
+80108559:	5e                   	pop    %esi
+8010855a:	5d                   	pop    %ebp
+8010855b:	c3                   	ret
+8010855c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    iunlockput(ip);
+80108560:	83 ec 0c             	sub    $0xc,%esp
+80108563:	53                   	push   %ebx
+80108564:	e8 e7 a5 ff ff       	call   80102b50 <iunlockput>
+    end_op();
+80108569:	e8 92 c2 ff ff       	call   80104800 <end_op>
+    return -1;
+8010856e:	83 c4 10             	add    $0x10,%esp
+    return -1;
+80108571:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108576:	eb dd                	jmp    80108555 <sys_chdir+0x75>
+80108578:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010857f:	90                   	nop
+    end_op();
+80108580:	e8 7b c2 ff ff       	call   80104800 <end_op>
+    return -1;
+80108585:	eb ea                	jmp    80108571 <sys_chdir+0x91>
+80108587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010858e:	66 90                	xchg   %ax,%ax
+
+80108590 <sys_exec>:
+
+int
+sys_exec(void)
+{
+80108590:	55                   	push   %ebp
+80108591:	89 e5                	mov    %esp,%ebp
+80108593:	57                   	push   %edi
+80108594:	56                   	push   %esi
+  char *path, *argv[MAXARG];
+  int i;
+  uint uargv, uarg;
+
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+80108595:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+{
+8010859b:	53                   	push   %ebx
+8010859c:	81 ec a4 00 00 00    	sub    $0xa4,%esp
+  if(argstr(0, &path) < 0 || argint(1, (int*)&uargv) < 0){
+801085a2:	50                   	push   %eax
+801085a3:	6a 00                	push   $0x0
+801085a5:	e8 76 f4 ff ff       	call   80107a20 <argstr>
+801085aa:	83 c4 10             	add    $0x10,%esp
+801085ad:	85 c0                	test   %eax,%eax
+801085af:	0f 88 87 00 00 00    	js     8010863c <sys_exec+0xac>
+801085b5:	83 ec 08             	sub    $0x8,%esp
+801085b8:	8d 85 60 ff ff ff    	lea    -0xa0(%ebp),%eax
+801085be:	50                   	push   %eax
+801085bf:	6a 01                	push   $0x1
+801085c1:	e8 5a f3 ff ff       	call   80107920 <argint>
+801085c6:	83 c4 10             	add    $0x10,%esp
+801085c9:	85 c0                	test   %eax,%eax
+801085cb:	78 6f                	js     8010863c <sys_exec+0xac>
+    return -1;
+  }
+  memset(argv, 0, sizeof(argv));
+801085cd:	83 ec 04             	sub    $0x4,%esp
+801085d0:	8d b5 68 ff ff ff    	lea    -0x98(%ebp),%esi
+  for(i=0;; i++){
+801085d6:	31 db                	xor    %ebx,%ebx
+  memset(argv, 0, sizeof(argv));
+801085d8:	68 80 00 00 00       	push   $0x80
+801085dd:	6a 00                	push   $0x0
+801085df:	56                   	push   %esi
+801085e0:	e8 4b f0 ff ff       	call   80107630 <memset>
+801085e5:	83 c4 10             	add    $0x10,%esp
+801085e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801085ef:	90                   	nop
+    if(i >= NELEM(argv))
+      return -1;
+    if(fetchint(uargv+4*i, (int*)&uarg) < 0)
+801085f0:	83 ec 08             	sub    $0x8,%esp
+801085f3:	8d 85 64 ff ff ff    	lea    -0x9c(%ebp),%eax
+801085f9:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+80108600:	50                   	push   %eax
+80108601:	8b 85 60 ff ff ff    	mov    -0xa0(%ebp),%eax
+80108607:	01 f8                	add    %edi,%eax
+80108609:	50                   	push   %eax
+8010860a:	e8 41 f2 ff ff       	call   80107850 <fetchint>
+8010860f:	83 c4 10             	add    $0x10,%esp
+80108612:	85 c0                	test   %eax,%eax
+80108614:	78 26                	js     8010863c <sys_exec+0xac>
+      return -1;
+    if(uarg == 0){
+80108616:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+8010861c:	85 c0                	test   %eax,%eax
+8010861e:	74 30                	je     80108650 <sys_exec+0xc0>
+      argv[i] = 0;
+      break;
+    }
+    if(fetchstr(uarg, &argv[i]) < 0)
+80108620:	83 ec 08             	sub    $0x8,%esp
+80108623:	8d 14 3e             	lea    (%esi,%edi,1),%edx
+80108626:	52                   	push   %edx
+80108627:	50                   	push   %eax
+80108628:	e8 73 f2 ff ff       	call   801078a0 <fetchstr>
+8010862d:	83 c4 10             	add    $0x10,%esp
+80108630:	85 c0                	test   %eax,%eax
+80108632:	78 08                	js     8010863c <sys_exec+0xac>
+  for(i=0;; i++){
+80108634:	83 c3 01             	add    $0x1,%ebx
+    if(i >= NELEM(argv))
+80108637:	83 fb 20             	cmp    $0x20,%ebx
+8010863a:	75 b4                	jne    801085f0 <sys_exec+0x60>
+      return -1;
+  }
+  return exec(path, argv);
+}
+8010863c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+8010863f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108644:	5b                   	pop    %ebx
+80108645:	5e                   	pop    %esi
+80108646:	5f                   	pop    %edi
+80108647:	5d                   	pop    %ebp
+80108648:	c3                   	ret
+80108649:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      argv[i] = 0;
+80108650:	c7 84 9d 68 ff ff ff 	movl   $0x0,-0x98(%ebp,%ebx,4)
+80108657:	00 00 00 00 
+  return exec(path, argv);
+8010865b:	83 ec 08             	sub    $0x8,%esp
+8010865e:	56                   	push   %esi
+8010865f:	ff b5 5c ff ff ff    	push   -0xa4(%ebp)
+80108665:	e8 86 89 ff ff       	call   80100ff0 <exec>
+8010866a:	83 c4 10             	add    $0x10,%esp
+}
+8010866d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108670:	5b                   	pop    %ebx
+80108671:	5e                   	pop    %esi
+80108672:	5f                   	pop    %edi
+80108673:	5d                   	pop    %ebp
+80108674:	c3                   	ret
+80108675:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010867c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108680 <sys_pipesize>:
+
+// Set the capacity of a pipe's buffer; see pipesize().
+int
+sys_pipesize(void)
+{
+80108680:	55                   	push   %ebp
+80108681:	89 e5                	mov    %esp,%ebp
+80108683:	56                   	push   %esi
+80108684:	53                   	push   %ebx
+  if(argint(n, &fd) < 0)
+80108685:	8d 75 f4             	lea    -0xc(%ebp),%esi
+{
+80108688:	83 ec 18             	sub    $0x18,%esp
+  if(argint(n, &fd) < 0)
+8010868b:	56                   	push   %esi
+8010868c:	6a 00                	push   $0x0
+8010868e:	e8 8d f2 ff ff       	call   80107920 <argint>
+80108693:	83 c4 10             	add    $0x10,%esp
+80108696:	85 c0                	test   %eax,%eax
+80108698:	78 46                	js     801086e0 <sys_pipesize+0x60>
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+8010869a:	83 7d f4 0f          	cmpl   $0xf,-0xc(%ebp)
+8010869e:	77 40                	ja     801086e0 <sys_pipesize+0x60>
+801086a0:	e8 db d6 ff ff       	call   80105d80 <myproc>
+801086a5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+801086a8:	8b 5c 90 44          	mov    0x44(%eax,%edx,4),%ebx
+801086ac:	85 db                	test   %ebx,%ebx
+801086ae:	74 30                	je     801086e0 <sys_pipesize+0x60>
+  struct file *f;
+  int n;
+
+  if(argfd(0, 0, &f) < 0 || argint(1, &n) < 0 || f->type != FD_PIPE)
+801086b0:	83 ec 08             	sub    $0x8,%esp
+801086b3:	56                   	push   %esi
+801086b4:	6a 01                	push   $0x1
+801086b6:	e8 65 f2 ff ff       	call   80107920 <argint>
+801086bb:	83 c4 10             	add    $0x10,%esp
+801086be:	85 c0                	test   %eax,%eax
+801086c0:	78 1e                	js     801086e0 <sys_pipesize+0x60>
+801086c2:	83 3b 01             	cmpl   $0x1,(%ebx)
+801086c5:	75 19                	jne    801086e0 <sys_pipesize+0x60>
+    return -1;
+  return pipesize(f->pipe, n);
+801086c7:	83 ec 08             	sub    $0x8,%esp
+801086ca:	ff 75 f4             	push   -0xc(%ebp)
+801086cd:	ff 73 0c             	push   0xc(%ebx)
+801086d0:	e8 5b cf ff ff       	call   80105630 <pipesize>
+801086d5:	83 c4 10             	add    $0x10,%esp
+}
+801086d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+801086db:	5b                   	pop    %ebx
+801086dc:	5e                   	pop    %esi
+801086dd:	5d                   	pop    %ebp
+801086de:	c3                   	ret
+801086df:	90                   	nop
+    return -1;
+801086e0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801086e5:	eb f1                	jmp    801086d8 <sys_pipesize+0x58>
+801086e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801086ee:	66 90                	xchg   %ax,%ax
+
+801086f0 <sys_pipe>:
+
+int
+sys_pipe(void)
+{
+801086f0:	55                   	push   %ebp
+801086f1:	89 e5                	mov    %esp,%ebp
+801086f3:	57                   	push   %edi
+801086f4:	56                   	push   %esi
+  int *fd;
+  struct file *rf, *wf;
+  int fd0, fd1;
+
+  if(argwptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+801086f5:	8d 45 dc             	lea    -0x24(%ebp),%eax
+{
+801086f8:	53                   	push   %ebx
+801086f9:	83 ec 20             	sub    $0x20,%esp
+  if(argwptr(0, (void*)&fd, 2*sizeof(fd[0])) < 0)
+801086fc:	6a 08                	push   $0x8
+801086fe:	50                   	push   %eax
+801086ff:	6a 00                	push   $0x0
+80108701:	e8 ca f2 ff ff       	call   801079d0 <argwptr>
+80108706:	83 c4 10             	add    $0x10,%esp
+80108709:	85 c0                	test   %eax,%eax
+8010870b:	0f 88 8b 00 00 00    	js     8010879c <sys_pipe+0xac>
+    return -1;
+  if(pipealloc(&rf, &wf) < 0)
+80108711:	83 ec 08             	sub    $0x8,%esp
+80108714:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+80108717:	50                   	push   %eax
+80108718:	8d 45 e0             	lea    -0x20(%ebp),%eax
+8010871b:	50                   	push   %eax
+8010871c:	e8 8f c7 ff ff       	call   80104eb0 <pipealloc>
+80108721:	83 c4 10             	add    $0x10,%esp
+80108724:	85 c0                	test   %eax,%eax
+80108726:	78 74                	js     8010879c <sys_pipe+0xac>
+    return -1;
+  fd0 = -1;
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+80108728:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for(fd = 0; fd < NOFILE; fd++){
+8010872b:	31 db                	xor    %ebx,%ebx
+  struct proc *curproc = myproc();
+8010872d:	e8 4e d6 ff ff       	call   80105d80 <myproc>
+    if(curproc->ofile[fd] == 0){
+80108732:	8b 74 98 44          	mov    0x44(%eax,%ebx,4),%esi
+80108736:	85 f6                	test   %esi,%esi
+80108738:	74 16                	je     80108750 <sys_pipe+0x60>
+8010873a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(fd = 0; fd < NOFILE; fd++){
+80108740:	83 c3 01             	add    $0x1,%ebx
+80108743:	83 fb 10             	cmp    $0x10,%ebx
+80108746:	74 3d                	je     80108785 <sys_pipe+0x95>
+    if(curproc->ofile[fd] == 0){
+80108748:	8b 74 98 44          	mov    0x44(%eax,%ebx,4),%esi
+8010874c:	85 f6                	test   %esi,%esi
+8010874e:	75 f0                	jne    80108740 <sys_pipe+0x50>
+      curproc->ofile[fd] = f;
+80108750:	8d 73 10             	lea    0x10(%ebx),%esi
+80108753:	89 7c b0 04          	mov    %edi,0x4(%eax,%esi,4)
+  if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
+80108757:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  struct proc *curproc = myproc();
+8010875a:	e8 21 d6 ff ff       	call   80105d80 <myproc>
+  for(fd = 0; fd < NOFILE; fd++){
+8010875f:	31 d2                	xor    %edx,%edx
+80108761:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(curproc->ofile[fd] == 0){
+80108768:	8b 4c 90 44          	mov    0x44(%eax,%edx,4),%ecx
+8010876c:	85 c9                	test   %ecx,%ecx
+8010876e:	74 38                	je     801087a8 <sys_pipe+0xb8>
+  for(fd = 0; fd < NOFILE; fd++){
+80108770:	83 c2 01             	add    $0x1,%edx
+80108773:	83 fa 10             	cmp    $0x10,%edx
+80108776:	75 f0                	jne    80108768 <sys_pipe+0x78>
+    if(fd0 >= 0)
+      myproc()->ofile[fd0] = 0;
+80108778:	e8 03 d6 ff ff       	call   80105d80 <myproc>
+8010877d:	c7 44 b0 04 00 00 00 	movl   $0x0,0x4(%eax,%esi,4)
+80108784:	00 
+    fileclose(rf);
+80108785:	83 ec 0c             	sub    $0xc,%esp
+80108788:	ff 75 e0             	push   -0x20(%ebp)
+8010878b:	e8 d0 8c ff ff       	call   80101460 <fileclose>
+    fileclose(wf);
+80108790:	58                   	pop    %eax
+80108791:	ff 75 e4             	push   -0x1c(%ebp)
+80108794:	e8 c7 8c ff ff       	call   80101460 <fileclose>
+    return -1;
+80108799:	83 c4 10             	add    $0x10,%esp
+    return -1;
+8010879c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+801087a1:	eb 16                	jmp    801087b9 <sys_pipe+0xc9>
+801087a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+801087a7:	90                   	nop
+      curproc->ofile[fd] = f;
+801087a8:	89 7c 90 44          	mov    %edi,0x44(%eax,%edx,4)
+  }
+  fd[0] = fd0;
+801087ac:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801087af:	89 18                	mov    %ebx,(%eax)
+  fd[1] = fd1;
+801087b1:	8b 45 dc             	mov    -0x24(%ebp),%eax
+801087b4:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+801087b7:	31 c0                	xor    %eax,%eax
+}
+801087b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801087bc:	5b                   	pop    %ebx
+801087bd:	5e                   	pop    %esi
+801087be:	5f                   	pop    %edi
+801087bf:	5d                   	pop    %ebp
+801087c0:	c3                   	ret
+801087c1:	66 90                	xchg   %ax,%ax
+801087c3:	66 90                	xchg   %ax,%ax
+801087c5:	66 90                	xchg   %ax,%ax
+801087c7:	66 90                	xchg   %ax,%ax
+801087c9:	66 90                	xchg   %ax,%ax
+801087cb:	66 90                	xchg   %ax,%ax
+801087cd:	66 90                	xchg   %ax,%ax
+801087cf:	90                   	nop
+
+801087d0 <sys_fork>:
+#include "pstat.h"
+
+int
+sys_fork(void)
+{
+  return fork();
+801087d0:	e9 9b d8 ff ff       	jmp    80106070 <fork>
+801087d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801087dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+801087e0 <sys_exit>:
+}
+
+int
+sys_exit(void)
+{
+801087e0:	55                   	push   %ebp
+801087e1:	89 e5                	mov    %esp,%ebp
+801087e3:	83 ec 08             	sub    $0x8,%esp
+  exit();
+801087e6:	e8 a5 df ff ff       	call   80106790 <exit>
+  return 0;  // not reached
+}
+801087eb:	31 c0                	xor    %eax,%eax
+801087ed:	c9                   	leave
+801087ee:	c3                   	ret
+801087ef:	90                   	nop
+
+801087f0 <sys_wait>:
+
+int
+sys_wait(void)
+{
+  return wait();
+801087f0:	e9 3b e3 ff ff       	jmp    80106b30 <wait>
+801087f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801087fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108800 <sys_kill>:
+}
+
+int
+sys_kill(void)
+{
+80108800:	55                   	push   %ebp
+80108801:	89 e5                	mov    %esp,%ebp
+80108803:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0, &pid) < 0)
+80108806:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108809:	50                   	push   %eax
+8010880a:	6a 00                	push   $0x0
+8010880c:	e8 0f f1 ff ff       	call   80107920 <argint>
+80108811:	83 c4 10             	add    $0x10,%esp
+80108814:	85 c0                	test   %eax,%eax
+80108816:	78 18                	js     80108830 <sys_kill+0x30>
+    return -1;
+  return kill(pid);
+80108818:	83 ec 0c             	sub    $0xc,%esp
+8010881b:	ff 75 f4             	push   -0xc(%ebp)
+8010881e:	e8 5d e5 ff ff       	call   80106d80 <kill>
+80108823:	83 c4 10             	add    $0x10,%esp
+}
+80108826:	c9                   	leave
+80108827:	c3                   	ret
+80108828:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010882f:	90                   	nop
+80108830:	c9                   	leave
+    return -1;
+80108831:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108836:	c3                   	ret
+80108837:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010883e:	66 90                	xchg   %ax,%ax
+
+80108840 <sys_getpid>:
+
+int
+sys_getpid(void)
+{
+80108840:	55                   	push   %ebp
+80108841:	89 e5                	mov    %esp,%ebp
+80108843:	83 ec 08             	sub    $0x8,%esp
+  return myproc()->pid;
+80108846:	e8 35 d5 ff ff       	call   80105d80 <myproc>
+8010884b:	8b 40 10             	mov    0x10(%eax),%eax
+}
+8010884e:	c9                   	leave
+8010884f:	c3                   	ret
+
+80108850 <sys_sbrk>:
+
+int
+sys_sbrk(void)
+{
+80108850:	55                   	push   %ebp
+80108851:	89 e5                	mov    %esp,%ebp
+80108853:	53                   	push   %ebx
+  int addr;
+  int n;
+
+  if(argint(0, &n) < 0)
+80108854:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80108857:	83 ec 1c             	sub    $0x1c,%esp
+  if(argint(0, &n) < 0)
+8010885a:	50                   	push   %eax
+8010885b:	6a 00                	push   $0x0
+8010885d:	e8 be f0 ff ff       	call   80107920 <argint>
+80108862:	83 c4 10             	add    $0x10,%esp
+80108865:	85 c0                	test   %eax,%eax
+80108867:	78 27                	js     80108890 <sys_sbrk+0x40>
+    return -1;
+  addr = myproc()->sz;
+80108869:	e8 12 d5 ff ff       	call   80105d80 <myproc>
+  if(growproc(n) < 0)
+8010886e:	83 ec 0c             	sub    $0xc,%esp
+  addr = myproc()->sz;
+80108871:	8b 18                	mov    (%eax),%ebx
+  if(growproc(n) < 0)
+80108873:	ff 75 f4             	push   -0xc(%ebp)
+80108876:	e8 55 d7 ff ff       	call   80105fd0 <growproc>
+8010887b:	83 c4 10             	add    $0x10,%esp
+8010887e:	85 c0                	test   %eax,%eax
+80108880:	78 0e                	js     80108890 <sys_sbrk+0x40>
+    return -1;
+  return addr;
+}
+80108882:	89 d8                	mov    %ebx,%eax
+80108884:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108887:	c9                   	leave
+80108888:	c3                   	ret
+80108889:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    return -1;
+80108890:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+80108895:	eb eb                	jmp    80108882 <sys_sbrk+0x32>
+80108897:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010889e:	66 90                	xchg   %ax,%ax
+
+801088a0 <sys_sleep>:
+
+int
+sys_sleep(void)
+{
+801088a0:	55                   	push   %ebp
+801088a1:	89 e5                	mov    %esp,%ebp
+801088a3:	53                   	push   %ebx
+  int n;
+  uint ticks0;
+
+  if(argint(0, &n) < 0)
+801088a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+801088a7:	83 ec 1c             	sub    $0x1c,%esp
+  if(argint(0, &n) < 0)
+801088aa:	50                   	push   %eax
+801088ab:	6a 00                	push   $0x0
+801088ad:	e8 6e f0 ff ff       	call   80107920 <argint>
+801088b2:	83 c4 10             	add    $0x10,%esp
+801088b5:	85 c0                	test   %eax,%eax
+801088b7:	0f 88 8d 00 00 00    	js     8010894a <sys_sleep+0xaa>
+    return -1;
+  acquire(&tickslock);
+801088bd:	83 ec 0c             	sub    $0xc,%esp
+801088c0:	68 c0 22 91 80       	push   $0x809122c0
+801088c5:	e8 86 ec ff ff       	call   80107550 <acquire>
+  ticks0 = ticks;
+  if(n > 0)
+801088ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+801088cd:	83 c4 10             	add    $0x10,%esp
+801088d0:	31 d2                	xor    %edx,%edx
+  ticks0 = ticks;
+801088d2:	8b 1d a0 22 91 80    	mov    0x809122a0,%ebx
+  if(n > 0)
+801088d8:	85 c0                	test   %eax,%eax
+801088da:	7e 1e                	jle    801088fa <sys_sleep+0x5a>
+    timerset(ticks0 + n, &ticks);
+801088dc:	83 ec 08             	sub    $0x8,%esp
+801088df:	01 d8                	add    %ebx,%eax
+801088e1:	68 a0 22 91 80       	push   $0x809122a0
+801088e6:	50                   	push   %eax
+801088e7:	e8 e4 03 00 00       	call   80108cd0 <timerset>
+  while(ticks - ticks0 < n){
+801088ec:	8b 15 a0 22 91 80    	mov    0x809122a0,%edx
+801088f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+801088f5:	83 c4 10             	add    $0x10,%esp
+801088f8:	29 da                	sub    %ebx,%edx
+801088fa:	39 c2                	cmp    %eax,%edx
+801088fc:	72 23                	jb     80108921 <sys_sleep+0x81>
+801088fe:	eb 58                	jmp    80108958 <sys_sleep+0xb8>
+    if(myproc()->killed){
+      timerdel(myproc());
+      release(&tickslock);
+      return -1;
+    }
+    sleep(&ticks, &tickslock);
+80108900:	83 ec 08             	sub    $0x8,%esp
+80108903:	68 c0 22 91 80       	push   $0x809122c0
+80108908:	68 a0 22 91 80       	push   $0x809122a0
+8010890d:	e8 de e0 ff ff       	call   801069f0 <sleep>
+  while(ticks - ticks0 < n){
+80108912:	a1 a0 22 91 80       	mov    0x809122a0,%eax
+80108917:	83 c4 10             	add    $0x10,%esp
+8010891a:	29 d8                	sub    %ebx,%eax
+8010891c:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+8010891f:	73 37                	jae    80108958 <sys_sleep+0xb8>
+    if(myproc()->killed){
+80108921:	e8 5a d4 ff ff       	call   80105d80 <myproc>
+80108926:	8b 40 40             	mov    0x40(%eax),%eax
+80108929:	85 c0                	test   %eax,%eax
+8010892b:	74 d3                	je     80108900 <sys_sleep+0x60>
+      timerdel(myproc());
+8010892d:	e8 4e d4 ff ff       	call   80105d80 <myproc>
+80108932:	83 ec 0c             	sub    $0xc,%esp
+80108935:	50                   	push   %eax
+80108936:	e8 25 03 00 00       	call   80108c60 <timerdel>
+      release(&tickslock);
+8010893b:	c7 04 24 c0 22 91 80 	movl   $0x809122c0,(%esp)
+80108942:	e8 a9 eb ff ff       	call   801074f0 <release>
+      return -1;
+80108947:	83 c4 10             	add    $0x10,%esp
+  }
+  timerdel(myproc());
+  release(&tickslock);
+  return 0;
+}
+8010894a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    return -1;
+8010894d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108952:	c9                   	leave
+80108953:	c3                   	ret
+80108954:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  timerdel(myproc());
+80108958:	e8 23 d4 ff ff       	call   80105d80 <myproc>
+8010895d:	83 ec 0c             	sub    $0xc,%esp
+80108960:	50                   	push   %eax
+80108961:	e8 fa 02 00 00       	call   80108c60 <timerdel>
+  release(&tickslock);
+80108966:	c7 04 24 c0 22 91 80 	movl   $0x809122c0,(%esp)
+8010896d:	e8 7e eb ff ff       	call   801074f0 <release>
+}
+80108972:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  return 0;
+80108975:	83 c4 10             	add    $0x10,%esp
+80108978:	31 c0                	xor    %eax,%eax
+}
+8010897a:	c9                   	leave
+8010897b:	c3                   	ret
+8010897c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+80108980 <sys_uptime>:
+
+// return how many clock tick interrupts have occurred since start.
+int
+sys_uptime(void)
+{
+80108980:	55                   	push   %ebp
+80108981:	89 e5                	mov    %esp,%ebp
+80108983:	53                   	push   %ebx
+80108984:	83 ec 10             	sub    $0x10,%esp
+  uint xticks;
+
+  acquire(&tickslock);
+80108987:	68 c0 22 91 80       	push   $0x809122c0
+8010898c:	e8 bf eb ff ff       	call   80107550 <acquire>
+  xticks = ticks;
+80108991:	8b 1d a0 22 91 80    	mov    0x809122a0,%ebx
+  release(&tickslock);
+80108997:	c7 04 24 c0 22 91 80 	movl   $0x809122c0,(%esp)
+8010899e:	e8 4d eb ff ff       	call   801074f0 <release>
+  return xticks;
+}
+801089a3:	89 d8                	mov    %ebx,%eax
+801089a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801089a8:	c9                   	leave
+801089a9:	c3                   	ret
+801089aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+801089b0 <sys_nice>:
+   Kernel enforces value range [0..4].
+   Returns previous nice on success, -1 on failure.
+*/
+int
+sys_nice(void)
+{
+801089b0:	55                   	push   %ebp
+801089b1:	89 e5                	mov    %esp,%ebp
+801089b3:	53                   	push   %ebx
+  int a0, a1;
+  int got0 = argint(0, &a0);
+801089b4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+{
+801089b7:	83 ec 1c             	sub    $0x1c,%esp
+  int got0 = argint(0, &a0);
+801089ba:	50                   	push   %eax
+801089bb:	6a 00                	push   $0x0
+801089bd:	e8 5e ef ff ff       	call   80107920 <argint>
+801089c2:	89 c3                	mov    %eax,%ebx
+  int got1 = argint(1, &a1);
+801089c4:	58                   	pop    %eax
+801089c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+801089c8:	5a                   	pop    %edx
+801089c9:	50                   	push   %eax
+801089ca:	6a 01                	push   $0x1
+801089cc:	e8 4f ef ff ff       	call   80107920 <argint>
+
+  if(got0 < 0)
+801089d1:	83 c4 10             	add    $0x10,%esp
+801089d4:	85 db                	test   %ebx,%ebx
+801089d6:	78 38                	js     80108a10 <sys_nice+0x60>
+    return -1;                 // at least one arg required
+
+  int pid, val;
+  if(got1 < 0){
+801089d8:	85 c0                	test   %eax,%eax
+801089da:	78 24                	js     80108a00 <sys_nice+0x50>
+    // only one argument: treat as <value> for current process
+    pid = myproc()->pid;
+    val = a0;
+  } else {
+    // two arguments: <pid> <value>
+    pid = a0;
+801089dc:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    val = a1;
+801089df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  }
+
+  // hard range check in kernel
+  if (val < 0 || val > 4)
+801089e2:	83 f8 04             	cmp    $0x4,%eax
+801089e5:	77 29                	ja     80108a10 <sys_nice+0x60>
+    return -1;
+
+  extern int setnice(int pid, int value);  // in proc.c
+  return setnice(pid, val);                // returns previous nice or -1
+801089e7:	83 ec 08             	sub    $0x8,%esp
+801089ea:	50                   	push   %eax
+801089eb:	52                   	push   %edx
+801089ec:	e8 3f e5 ff ff       	call   80106f30 <setnice>
+801089f1:	83 c4 10             	add    $0x10,%esp
+}
+801089f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+801089f7:	c9                   	leave
+801089f8:	c3                   	ret
+801089f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    pid = myproc()->pid;
+80108a00:	e8 7b d3 ff ff       	call   80105d80 <myproc>
+80108a05:	8b 50 10             	mov    0x10(%eax),%edx
+    val = a0;
+80108a08:	8b 45 f0             	mov    -0x10(%ebp),%eax
+80108a0b:	eb d5                	jmp    801089e2 <sys_nice+0x32>
+80108a0d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;                 // at least one arg required
+80108a10:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108a15:	eb dd                	jmp    801089f4 <sys_nice+0x44>
+80108a17:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108a1e:	66 90                	xchg   %ax,%ax
+
+80108a20 <sys_settickets>:
+
+// Give process pid n tickets (STRIDE_SCHED).
+// Returns its previous tickets, or -1.
+int
+sys_settickets(void)
+{
+80108a20:	55                   	push   %ebp
+80108a21:	89 e5                	mov    %esp,%ebp
+80108a23:	83 ec 20             	sub    $0x20,%esp
+  int pid, n;
+
+  if(argint(0, &pid) < 0 || argint(1, &n) < 0)
+80108a26:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108a29:	50                   	push   %eax
+80108a2a:	6a 00                	push   $0x0
+80108a2c:	e8 ef ee ff ff       	call   80107920 <argint>
+80108a31:	83 c4 10             	add    $0x10,%esp
+80108a34:	85 c0                	test   %eax,%eax
+80108a36:	78 28                	js     80108a60 <sys_settickets+0x40>
+80108a38:	83 ec 08             	sub    $0x8,%esp
+80108a3b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108a3e:	50                   	push   %eax
+80108a3f:	6a 01                	push   $0x1
+80108a41:	e8 da ee ff ff       	call   80107920 <argint>
+80108a46:	83 c4 10             	add    $0x10,%esp
+80108a49:	85 c0                	test   %eax,%eax
+80108a4b:	78 13                	js     80108a60 <sys_settickets+0x40>
+    return -1;
+  return settickets(pid, n);
+80108a4d:	83 ec 08             	sub    $0x8,%esp
+80108a50:	ff 75 f4             	push   -0xc(%ebp)
+80108a53:	ff 75 f0             	push   -0x10(%ebp)
+80108a56:	e8 25 e6 ff ff       	call   80107080 <settickets>
+80108a5b:	83 c4 10             	add    $0x10,%esp
+}
+80108a5e:	c9                   	leave
+80108a5f:	c3                   	ret
+80108a60:	c9                   	leave
+    return -1;
+80108a61:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108a66:	c3                   	ret
+80108a67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108a6e:	66 90                	xchg   %ax,%ax
+
+80108a70 <sys_transfer>:
+
+// Lend the caller's tickets to process pid whenever
+// the caller blocks; pid 0 stops lending.
+int
+sys_transfer(void)
+{
+80108a70:	55                   	push   %ebp
+80108a71:	89 e5                	mov    %esp,%ebp
+80108a73:	83 ec 20             	sub    $0x20,%esp
+  int pid;
+
+  if(argint(0, &pid) < 0)
+80108a76:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108a79:	50                   	push   %eax
+80108a7a:	6a 00                	push   $0x0
+80108a7c:	e8 9f ee ff ff       	call   80107920 <argint>
+80108a81:	83 c4 10             	add    $0x10,%esp
+80108a84:	85 c0                	test   %eax,%eax
+80108a86:	78 18                	js     80108aa0 <sys_transfer+0x30>
+    return -1;
+  return lendtickets(pid);
+80108a88:	83 ec 0c             	sub    $0xc,%esp
+80108a8b:	ff 75 f4             	push   -0xc(%ebp)
+80108a8e:	e8 fd e5 ff ff       	call   80107090 <lendtickets>
+80108a93:	83 c4 10             	add    $0x10,%esp
+}
+80108a96:	c9                   	leave
+80108a97:	c3                   	ret
+80108a98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108a9f:	90                   	nop
+80108aa0:	c9                   	leave
+    return -1;
+80108aa1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108aa6:	c3                   	ret
+80108aa7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108aae:	66 90                	xchg   %ax,%ax
+
+80108ab0 <sys_uptimens>:
+
+// Store the nanoseconds since boot in *ns.
+int
+sys_uptimens(void)
+{
+80108ab0:	55                   	push   %ebp
+80108ab1:	89 e5                	mov    %esp,%ebp
+80108ab3:	53                   	push   %ebx
+  uint64 *ns;
+
+  if(argwptr(0, (char**)&ns, sizeof(*ns)) < 0)
+80108ab4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+80108ab7:	83 ec 18             	sub    $0x18,%esp
+  if(argwptr(0, (char**)&ns, sizeof(*ns)) < 0)
+80108aba:	6a 08                	push   $0x8
+80108abc:	50                   	push   %eax
+80108abd:	6a 00                	push   $0x0
+80108abf:	e8 0c ef ff ff       	call   801079d0 <argwptr>
+80108ac4:	83 c4 10             	add    $0x10,%esp
+80108ac7:	85 c0                	test   %eax,%eax
+80108ac9:	78 15                	js     80108ae0 <sys_uptimens+0x30>
+    return -1;
+  *ns = nsecs();
+80108acb:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+80108ace:	e8 8d b2 ff ff       	call   80103d60 <nsecs>
+80108ad3:	89 53 04             	mov    %edx,0x4(%ebx)
+80108ad6:	89 03                	mov    %eax,(%ebx)
+  return 0;
+80108ad8:	31 c0                	xor    %eax,%eax
+}
+80108ada:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108add:	c9                   	leave
+80108ade:	c3                   	ret
+80108adf:	90                   	nop
+    return -1;
+80108ae0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+80108ae5:	eb f3                	jmp    80108ada <sys_uptimens+0x2a>
+80108ae7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108aee:	66 90                	xchg   %ax,%ax
+
+80108af0 <sys_getpstat>:
+
+// Fill in up to n struct pstats, one per process.
+// Returns the number filled in.
+int
+sys_getpstat(void)
+{
+80108af0:	55                   	push   %ebp
+80108af1:	89 e5                	mov    %esp,%ebp
+80108af3:	83 ec 20             	sub    $0x20,%esp
+  char *ps;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0)
+80108af6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+80108af9:	50                   	push   %eax
+80108afa:	6a 01                	push   $0x1
+80108afc:	e8 1f ee ff ff       	call   80107920 <argint>
+80108b01:	83 c4 10             	add    $0x10,%esp
+80108b04:	85 c0                	test   %eax,%eax
+80108b06:	78 48                	js     80108b50 <sys_getpstat+0x60>
+80108b08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+80108b0b:	85 c0                	test   %eax,%eax
+80108b0d:	78 41                	js     80108b50 <sys_getpstat+0x60>
+    return -1;
+  if(n > NPROC)
+80108b0f:	83 f8 40             	cmp    $0x40,%eax
+80108b12:	7f 2c                	jg     80108b40 <sys_getpstat+0x50>
+    n = NPROC;
+  if(argptr(0, &ps, n*sizeof(struct pstat)) < 0)
+80108b14:	6b c0 38             	imul   $0x38,%eax,%eax
+80108b17:	83 ec 04             	sub    $0x4,%esp
+80108b1a:	50                   	push   %eax
+80108b1b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+80108b1e:	50                   	push   %eax
+80108b1f:	6a 00                	push   $0x0
+80108b21:	e8 2a ee ff ff       	call   80107950 <argptr>
+80108b26:	83 c4 10             	add    $0x10,%esp
+80108b29:	85 c0                	test   %eax,%eax
+80108b2b:	78 23                	js     80108b50 <sys_getpstat+0x60>
+    return -1;
+  return getpstat((uint)ps, n);
+80108b2d:	83 ec 08             	sub    $0x8,%esp
+80108b30:	ff 75 f4             	push   -0xc(%ebp)
+80108b33:	ff 75 f0             	push   -0x10(%ebp)
+80108b36:	e8 65 e5 ff ff       	call   801070a0 <getpstat>
+80108b3b:	83 c4 10             	add    $0x10,%esp
+}
+80108b3e:	c9                   	leave
+80108b3f:	c3                   	ret
+    n = NPROC;
+80108b40:	c7 45 f4 40 00 00 00 	movl   $0x40,-0xc(%ebp)
+80108b47:	b8 00 0e 00 00       	mov    $0xe00,%eax
+80108b4c:	eb c9                	jmp    80108b17 <sys_getpstat+0x27>
+80108b4e:	66 90                	xchg   %ax,%ax
+}
+80108b50:	c9                   	leave
+    return -1;
+80108b51:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80108b56:	c3                   	ret
+80108b57:	66 90                	xchg   %ax,%ax
+80108b59:	66 90                	xchg   %ax,%ax
+80108b5b:	66 90                	xchg   %ax,%ax
+80108b5d:	66 90                	xchg   %ax,%ax
+80108b5f:	90                   	nop
+
+80108b60 <wheeladd>:
+static uint wheelnow;   // next tick whose slot has yet to fire
+
+// Put p in the slot for p->expire.
+static void
+wheeladd(struct proc *p)
+{
+80108b60:	55                   	push   %ebp
+  struct proc **slot;
+  uint t, delta;
+  int lvl;
+
+  t = p->expire;
+  if((int)(t - wheelnow) < 0)
+80108b61:	8b 15 80 1e 91 80    	mov    0x80911e80,%edx
+{
+80108b67:	89 c1                	mov    %eax,%ecx
+80108b69:	89 e5                	mov    %esp,%ebp
+80108b6b:	57                   	push   %edi
+80108b6c:	56                   	push   %esi
+80108b6d:	53                   	push   %ebx
+  t = p->expire;
+80108b6e:	8b 98 e8 00 00 00    	mov    0xe8(%eax),%ebx
+  if((int)(t - wheelnow) < 0)
+80108b74:	89 d8                	mov    %ebx,%eax
+80108b76:	29 d0                	sub    %edx,%eax
+80108b78:	0f 88 82 00 00 00    	js     80108c00 <wheeladd+0xa0>
+    t = wheelnow;               // already due: fire next time
+  delta = t - wheelnow;
+  for(lvl = 0; lvl < NLEVEL-1; lvl++)
+    if(delta < 1 << ((lvl+1)*WHEELBITS))
+80108b7e:	83 f8 3f             	cmp    $0x3f,%eax
+80108b81:	76 77                	jbe    80108bfa <wheeladd+0x9a>
+80108b83:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+80108b88:	0f 86 9a 00 00 00    	jbe    80108c28 <wheeladd+0xc8>
+80108b8e:	3d ff ff 03 00       	cmp    $0x3ffff,%eax
+80108b93:	0f 86 a7 00 00 00    	jbe    80108c40 <wheeladd+0xe0>
+      break;
+  if(lvl == NLEVEL-1 && delta >= 1 << (NLEVEL*WHEELBITS))
+80108b99:	3d ff ff ff 00       	cmp    $0xffffff,%eax
+80108b9e:	76 70                	jbe    80108c10 <wheeladd+0xb0>
+    t = wheelnow + (1 << (NLEVEL*WHEELBITS)) - 1;
+80108ba0:	81 c2 ff ff ff 00    	add    $0xffffff,%edx
+  slot = &wheel[lvl][(t >> (lvl*WHEELBITS)) & WHEELMASK];
+80108ba6:	bb c0 00 00 00       	mov    $0xc0,%ebx
+80108bab:	b8 03 00 00 00       	mov    $0x3,%eax
+80108bb0:	c1 ea 12             	shr    $0x12,%edx
+80108bb3:	83 e2 3f             	and    $0x3f,%edx
+80108bb6:	01 d3                	add    %edx,%ebx
+80108bb8:	8d 34 9d a0 1e 91 80 	lea    -0x7f6ee160(,%ebx,4),%esi
+
+  p->tnext = *slot;
+80108bbf:	89 c3                	mov    %eax,%ebx
+80108bc1:	c1 e3 06             	shl    $0x6,%ebx
+80108bc4:	01 d3                	add    %edx,%ebx
+80108bc6:	8b 1c 9d a0 1e 91 80 	mov    -0x7f6ee160(,%ebx,4),%ebx
+80108bcd:	89 99 f0 00 00 00    	mov    %ebx,0xf0(%ecx)
+  if(*slot)
+80108bd3:	85 db                	test   %ebx,%ebx
+80108bd5:	74 0c                	je     80108be3 <wheeladd+0x83>
+    (*slot)->tprev = &p->tnext;
+80108bd7:	8d b9 f0 00 00 00    	lea    0xf0(%ecx),%edi
+80108bdd:	89 bb f4 00 00 00    	mov    %edi,0xf4(%ebx)
+  p->tprev = slot;
+  *slot = p;
+80108be3:	c1 e0 06             	shl    $0x6,%eax
+}
+80108be6:	5b                   	pop    %ebx
+  p->tprev = slot;
+80108be7:	89 b1 f4 00 00 00    	mov    %esi,0xf4(%ecx)
+  *slot = p;
+80108bed:	01 d0                	add    %edx,%eax
+}
+80108bef:	5e                   	pop    %esi
+80108bf0:	5f                   	pop    %edi
+  *slot = p;
+80108bf1:	89 0c 85 a0 1e 91 80 	mov    %ecx,-0x7f6ee160(,%eax,4)
+}
+80108bf8:	5d                   	pop    %ebp
+80108bf9:	c3                   	ret
+    if(delta < 1 << ((lvl+1)*WHEELBITS))
+80108bfa:	89 da                	mov    %ebx,%edx
+80108bfc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108c00:	31 db                	xor    %ebx,%ebx
+  for(lvl = 0; lvl < NLEVEL-1; lvl++)
+80108c02:	31 c0                	xor    %eax,%eax
+80108c04:	eb ad                	jmp    80108bb3 <wheeladd+0x53>
+80108c06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108c0d:	8d 76 00             	lea    0x0(%esi),%esi
+  slot = &wheel[lvl][(t >> (lvl*WHEELBITS)) & WHEELMASK];
+80108c10:	89 da                	mov    %ebx,%edx
+80108c12:	b8 03 00 00 00       	mov    $0x3,%eax
+80108c17:	bb c0 00 00 00       	mov    $0xc0,%ebx
+80108c1c:	c1 ea 12             	shr    $0x12,%edx
+80108c1f:	eb 92                	jmp    80108bb3 <wheeladd+0x53>
+80108c21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108c28:	89 da                	mov    %ebx,%edx
+    if(delta < 1 << ((lvl+1)*WHEELBITS))
+80108c2a:	b8 01 00 00 00       	mov    $0x1,%eax
+  slot = &wheel[lvl][(t >> (lvl*WHEELBITS)) & WHEELMASK];
+80108c2f:	bb 40 00 00 00       	mov    $0x40,%ebx
+80108c34:	c1 ea 06             	shr    $0x6,%edx
+80108c37:	e9 77 ff ff ff       	jmp    80108bb3 <wheeladd+0x53>
+80108c3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108c40:	89 da                	mov    %ebx,%edx
+    if(delta < 1 << ((lvl+1)*WHEELBITS))
+80108c42:	b8 02 00 00 00       	mov    $0x2,%eax
+  slot = &wheel[lvl][(t >> (lvl*WHEELBITS)) & WHEELMASK];
+80108c47:	bb 80 00 00 00       	mov    $0x80,%ebx
+80108c4c:	c1 ea 0c             	shr    $0xc,%edx
+80108c4f:	e9 5f ff ff ff       	jmp    80108bb3 <wheeladd+0x53>
+80108c54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108c5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108c5f:	90                   	nop
+
+80108c60 <timerdel>:
+
+// Take p off the wheel, if it is on it.
+void
+timerdel(struct proc *p)
+{
+80108c60:	55                   	push   %ebp
+80108c61:	89 e5                	mov    %esp,%ebp
+80108c63:	53                   	push   %ebx
+80108c64:	83 ec 10             	sub    $0x10,%esp
+80108c67:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(!holding(&tickslock))
+80108c6a:	68 c0 22 91 80       	push   $0x809122c0
+80108c6f:	e8 3c e8 ff ff       	call   801074b0 <holding>
+80108c74:	83 c4 10             	add    $0x10,%esp
+80108c77:	85 c0                	test   %eax,%eax
+80108c79:	74 3b                	je     80108cb6 <timerdel+0x56>
+    panic("timerdel");
+  if(p->tprev == 0)
+80108c7b:	8b 93 f4 00 00 00    	mov    0xf4(%ebx),%edx
+80108c81:	85 d2                	test   %edx,%edx
+80108c83:	74 2c                	je     80108cb1 <timerdel+0x51>
+    return;
+  *p->tprev = p->tnext;
+80108c85:	8b 83 f0 00 00 00    	mov    0xf0(%ebx),%eax
+80108c8b:	89 02                	mov    %eax,(%edx)
+  if(p->tnext)
+80108c8d:	85 c0                	test   %eax,%eax
+80108c8f:	74 0c                	je     80108c9d <timerdel+0x3d>
+    p->tnext->tprev = p->tprev;
+80108c91:	8b 93 f4 00 00 00    	mov    0xf4(%ebx),%edx
+80108c97:	89 90 f4 00 00 00    	mov    %edx,0xf4(%eax)
+  p->tnext = 0;
+80108c9d:	c7 83 f0 00 00 00 00 	movl   $0x0,0xf0(%ebx)
+80108ca4:	00 00 00 
+  p->tprev = 0;
+80108ca7:	c7 83 f4 00 00 00 00 	movl   $0x0,0xf4(%ebx)
+80108cae:	00 00 00 
+}
+80108cb1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108cb4:	c9                   	leave
+80108cb5:	c3                   	ret
+    panic("timerdel");
+80108cb6:	83 ec 0c             	sub    $0xc,%esp
+80108cb9:	68 e5 b6 10 80       	push   $0x8010b6e5
+80108cbe:	e8 bd 7b ff ff       	call   80100880 <panic>
+80108cc3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108cca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+80108cd0 <timerset>:
+// Arrange for the current process to be woken from a sleep
+// on chan at tick t. Replaces any timer it already has.
+// Caller holds tickslock.
+void
+timerset(uint t, void *chan)
+{
+80108cd0:	55                   	push   %ebp
+80108cd1:	89 e5                	mov    %esp,%ebp
+80108cd3:	57                   	push   %edi
+80108cd4:	56                   	push   %esi
+80108cd5:	53                   	push   %ebx
+80108cd6:	83 ec 0c             	sub    $0xc,%esp
+80108cd9:	8b 7d 08             	mov    0x8(%ebp),%edi
+80108cdc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  struct proc *p = myproc();
+80108cdf:	e8 9c d0 ff ff       	call   80105d80 <myproc>
+  if(!holding(&tickslock))
+80108ce4:	83 ec 0c             	sub    $0xc,%esp
+80108ce7:	68 c0 22 91 80       	push   $0x809122c0
+  struct proc *p = myproc();
+80108cec:	89 c3                	mov    %eax,%ebx
+  if(!holding(&tickslock))
+80108cee:	e8 bd e7 ff ff       	call   801074b0 <holding>
+80108cf3:	83 c4 10             	add    $0x10,%esp
+80108cf6:	85 c0                	test   %eax,%eax
+80108cf8:	74 50                	je     80108d4a <timerset+0x7a>
+  if(p->tprev == 0)
+80108cfa:	8b 93 f4 00 00 00    	mov    0xf4(%ebx),%edx
+80108d00:	85 d2                	test   %edx,%edx
+80108d02:	74 2c                	je     80108d30 <timerset+0x60>
+  *p->tprev = p->tnext;
+80108d04:	8b 83 f0 00 00 00    	mov    0xf0(%ebx),%eax
+80108d0a:	89 02                	mov    %eax,(%edx)
+  if(p->tnext)
+80108d0c:	85 c0                	test   %eax,%eax
+80108d0e:	74 0c                	je     80108d1c <timerset+0x4c>
+    p->tnext->tprev = p->tprev;
+80108d10:	8b 93 f4 00 00 00    	mov    0xf4(%ebx),%edx
+80108d16:	89 90 f4 00 00 00    	mov    %edx,0xf4(%eax)
+  p->tnext = 0;
+80108d1c:	c7 83 f0 00 00 00 00 	movl   $0x0,0xf0(%ebx)
+80108d23:	00 00 00 
+  p->tprev = 0;
+80108d26:	c7 83 f4 00 00 00 00 	movl   $0x0,0xf4(%ebx)
+80108d2d:	00 00 00 
+
+  timerdel(p);
+  p->expire = t;
+80108d30:	89 bb e8 00 00 00    	mov    %edi,0xe8(%ebx)
+  p->tchan = chan;
+  wheeladd(p);
+80108d36:	89 d8                	mov    %ebx,%eax
+  p->tchan = chan;
+80108d38:	89 b3 ec 00 00 00    	mov    %esi,0xec(%ebx)
+}
+80108d3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108d41:	5b                   	pop    %ebx
+80108d42:	5e                   	pop    %esi
+80108d43:	5f                   	pop    %edi
+80108d44:	5d                   	pop    %ebp
+  wheeladd(p);
+80108d45:	e9 16 fe ff ff       	jmp    80108b60 <wheeladd>
+    panic("timerdel");
+80108d4a:	83 ec 0c             	sub    $0xc,%esp
+80108d4d:	68 e5 b6 10 80       	push   $0x8010b6e5
+80108d52:	e8 29 7b ff ff       	call   80100880 <panic>
+80108d57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108d5e:	66 90                	xchg   %ax,%ax
+
+80108d60 <timerrun>:
+
+// Run the wheel up to ticks, waking the processes that are
+// due. Called from the timer interrupt with tickslock held.
+void
+timerrun(void)
+{
+80108d60:	55                   	push   %ebp
+80108d61:	89 e5                	mov    %esp,%ebp
+80108d63:	57                   	push   %edi
+80108d64:	56                   	push   %esi
+80108d65:	53                   	push   %ebx
+80108d66:	83 ec 0c             	sub    $0xc,%esp
+  struct proc *p, *next;
+  int lvl;
+
+  while((int)(ticks - wheelnow) >= 0){
+80108d69:	8b 35 80 1e 91 80    	mov    0x80911e80,%esi
+80108d6f:	39 35 a0 22 91 80    	cmp    %esi,0x809122a0
+80108d75:	0f 88 fe 00 00 00    	js     80108e79 <timerrun+0x119>
+80108d7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108d7f:	90                   	nop
+    // Bring down the coming runs of the levels above.
+    for(lvl = NLEVEL-1; lvl > 0; lvl--){
+80108d80:	bb 03 00 00 00       	mov    $0x3,%ebx
+80108d85:	eb 0e                	jmp    80108d95 <timerrun+0x35>
+80108d87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108d8e:	66 90                	xchg   %ax,%ax
+80108d90:	83 eb 01             	sub    $0x1,%ebx
+80108d93:	74 6b                	je     80108e00 <timerrun+0xa0>
+      if(wheelnow & ((1 << (lvl*WHEELBITS)) - 1))
+80108d95:	8d 0c 5b             	lea    (%ebx,%ebx,2),%ecx
+80108d98:	b8 01 00 00 00       	mov    $0x1,%eax
+80108d9d:	01 c9                	add    %ecx,%ecx
+80108d9f:	d3 e0                	shl    %cl,%eax
+80108da1:	83 e8 01             	sub    $0x1,%eax
+80108da4:	85 f0                	test   %esi,%eax
+80108da6:	75 e8                	jne    80108d90 <timerrun+0x30>
+        continue;
+      p = slottake(&wheel[lvl][(wheelnow >> (lvl*WHEELBITS)) & WHEELMASK]);
+80108da8:	89 f2                	mov    %esi,%edx
+  p = *slot;
+80108daa:	89 d8                	mov    %ebx,%eax
+      p = slottake(&wheel[lvl][(wheelnow >> (lvl*WHEELBITS)) & WHEELMASK]);
+80108dac:	d3 ea                	shr    %cl,%edx
+  p = *slot;
+80108dae:	c1 e0 06             	shl    $0x6,%eax
+      p = slottake(&wheel[lvl][(wheelnow >> (lvl*WHEELBITS)) & WHEELMASK]);
+80108db1:	83 e2 3f             	and    $0x3f,%edx
+  p = *slot;
+80108db4:	01 d0                	add    %edx,%eax
+80108db6:	8b 3c 85 a0 1e 91 80 	mov    -0x7f6ee160(,%eax,4),%edi
+  *slot = 0;
+80108dbd:	c7 04 85 a0 1e 91 80 	movl   $0x0,-0x7f6ee160(,%eax,4)
+80108dc4:	00 00 00 00 
+  if(p)
+80108dc8:	85 ff                	test   %edi,%edi
+80108dca:	74 c4                	je     80108d90 <timerrun+0x30>
+    p->tprev = 0;
+80108dcc:	c7 87 f4 00 00 00 00 	movl   $0x0,0xf4(%edi)
+80108dd3:	00 00 00 
+      for(; p; p = next){
+80108dd6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108ddd:	8d 76 00             	lea    0x0(%esi),%esi
+        next = p->tnext;
+80108de0:	89 f8                	mov    %edi,%eax
+80108de2:	8b bf f0 00 00 00    	mov    0xf0(%edi),%edi
+        p->tprev = 0;
+80108de8:	c7 80 f4 00 00 00 00 	movl   $0x0,0xf4(%eax)
+80108def:	00 00 00 
+        wheeladd(p);
+80108df2:	e8 69 fd ff ff       	call   80108b60 <wheeladd>
+      for(; p; p = next){
+80108df7:	85 ff                	test   %edi,%edi
+80108df9:	75 e5                	jne    80108de0 <timerrun+0x80>
+    for(lvl = NLEVEL-1; lvl > 0; lvl--){
+80108dfb:	83 eb 01             	sub    $0x1,%ebx
+80108dfe:	75 95                	jne    80108d95 <timerrun+0x35>
+      }
+    }
+
+    p = slottake(&wheel[0][wheelnow & WHEELMASK]);
+80108e00:	89 f0                	mov    %esi,%eax
+    wheelnow++;
+80108e02:	83 c6 01             	add    $0x1,%esi
+    p = slottake(&wheel[0][wheelnow & WHEELMASK]);
+80108e05:	83 e0 3f             	and    $0x3f,%eax
+  p = *slot;
+80108e08:	8b 1c 85 a0 1e 91 80 	mov    -0x7f6ee160(,%eax,4),%ebx
+  *slot = 0;
+80108e0f:	c7 04 85 a0 1e 91 80 	movl   $0x0,-0x7f6ee160(,%eax,4)
+80108e16:	00 00 00 00 
+  if(p)
+80108e1a:	85 db                	test   %ebx,%ebx
+80108e1c:	74 6a                	je     80108e88 <timerrun+0x128>
+    p->tprev = 0;
+80108e1e:	c7 83 f4 00 00 00 00 	movl   $0x0,0xf4(%ebx)
+80108e25:	00 00 00 
+    wheelnow++;
+80108e28:	89 35 80 1e 91 80    	mov    %esi,0x80911e80
+    for(; p; p = next){
+80108e2e:	eb 04                	jmp    80108e34 <timerrun+0xd4>
+80108e30:	85 db                	test   %ebx,%ebx
+80108e32:	74 33                	je     80108e67 <timerrun+0x107>
+      next = p->tnext;
+80108e34:	89 de                	mov    %ebx,%esi
+      p->tprev = 0;
+      // If p has not got as far as sleeping yet,
+      // try again next tick.
+      if(!wakeproc(p, p->tchan))
+80108e36:	83 ec 08             	sub    $0x8,%esp
+      next = p->tnext;
+80108e39:	8b 9b f0 00 00 00    	mov    0xf0(%ebx),%ebx
+      p->tprev = 0;
+80108e3f:	c7 86 f4 00 00 00 00 	movl   $0x0,0xf4(%esi)
+80108e46:	00 00 00 
+      if(!wakeproc(p, p->tchan))
+80108e49:	ff b6 ec 00 00 00    	push   0xec(%esi)
+80108e4f:	56                   	push   %esi
+80108e50:	e8 6b de ff ff       	call   80106cc0 <wakeproc>
+80108e55:	83 c4 10             	add    $0x10,%esp
+80108e58:	85 c0                	test   %eax,%eax
+80108e5a:	75 d4                	jne    80108e30 <timerrun+0xd0>
+        wheeladd(p);
+80108e5c:	89 f0                	mov    %esi,%eax
+80108e5e:	e8 fd fc ff ff       	call   80108b60 <wheeladd>
+    for(; p; p = next){
+80108e63:	85 db                	test   %ebx,%ebx
+80108e65:	75 cd                	jne    80108e34 <timerrun+0xd4>
+  while((int)(ticks - wheelnow) >= 0){
+80108e67:	8b 35 80 1e 91 80    	mov    0x80911e80,%esi
+80108e6d:	39 35 a0 22 91 80    	cmp    %esi,0x809122a0
+80108e73:	0f 89 07 ff ff ff    	jns    80108d80 <timerrun+0x20>
+    }
+  }
+}
+80108e79:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80108e7c:	5b                   	pop    %ebx
+80108e7d:	5e                   	pop    %esi
+80108e7e:	5f                   	pop    %edi
+80108e7f:	5d                   	pop    %ebp
+80108e80:	c3                   	ret
+80108e81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    wheelnow++;
+80108e88:	89 35 80 1e 91 80    	mov    %esi,0x80911e80
+    for(; p; p = next){
+80108e8e:	eb dd                	jmp    80108e6d <timerrun+0x10d>
+
+80108e90 <timernext>:
+// scan stops where level 1 next cascades down, since timers
+// there are not yet sorted into ticks.
+// Caller holds tickslock.
+uint
+timernext(void)
+{
+80108e90:	55                   	push   %ebp
+  uint i;
+
+  for(i = 0; i < WHEELSIZE; i++){
+80108e91:	31 d2                	xor    %edx,%edx
+{
+80108e93:	89 e5                	mov    %esp,%ebp
+80108e95:	53                   	push   %ebx
+    if(wheel[0][(wheelnow + i) & WHEELMASK])
+80108e96:	8b 1d 80 1e 91 80    	mov    0x80911e80,%ebx
+80108e9c:	eb 12                	jmp    80108eb0 <timernext+0x20>
+80108e9e:	66 90                	xchg   %ax,%ax
+      return wheelnow + i - ticks;
+    if(i > 0 && ((wheelnow + i) & WHEELMASK) == 0)
+80108ea0:	85 c9                	test   %ecx,%ecx
+80108ea2:	75 04                	jne    80108ea8 <timernext+0x18>
+80108ea4:	85 d2                	test   %edx,%edx
+80108ea6:	75 28                	jne    80108ed0 <timernext+0x40>
+  for(i = 0; i < WHEELSIZE; i++){
+80108ea8:	83 c2 01             	add    $0x1,%edx
+80108eab:	83 fa 40             	cmp    $0x40,%edx
+80108eae:	74 20                	je     80108ed0 <timernext+0x40>
+    if(wheel[0][(wheelnow + i) & WHEELMASK])
+80108eb0:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+80108eb3:	89 c1                	mov    %eax,%ecx
+80108eb5:	83 e1 3f             	and    $0x3f,%ecx
+80108eb8:	83 3c 8d a0 1e 91 80 	cmpl   $0x0,-0x7f6ee160(,%ecx,4)
+80108ebf:	00 
+80108ec0:	74 de                	je     80108ea0 <timernext+0x10>
+      return wheelnow + i - ticks;
+80108ec2:	2b 05 a0 22 91 80    	sub    0x809122a0,%eax
+      break;    // level 1 comes down here
+  }
+  return wheelnow + i - ticks;
+}
+80108ec8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108ecb:	c9                   	leave
+80108ecc:	c3                   	ret
+80108ecd:	8d 76 00             	lea    0x0(%esi),%esi
+  return wheelnow + i - ticks;
+80108ed0:	2b 1d a0 22 91 80    	sub    0x809122a0,%ebx
+80108ed6:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+}
+80108ed9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108edc:	c9                   	leave
+80108edd:	c3                   	ret
+
+80108ede <alltraps>:
+
+  # vectors.S sends all traps here.
+.globl alltraps
+alltraps:
+  # Build trap frame.
+  pushl %ds
+80108ede:	1e                   	push   %ds
+  pushl %es
+80108edf:	06                   	push   %es
+  pushl %fs
+80108ee0:	0f a0                	push   %fs
+  pushl %gs
+80108ee2:	0f a8                	push   %gs
+  pushal
+80108ee4:	60                   	pusha
+  
+  # Set up data segments.
+  movw $(SEG_KDATA<<3), %ax
+80108ee5:	66 b8 10 00          	mov    $0x10,%ax
+  movw %ax, %ds
+80108ee9:	8e d8                	mov    %eax,%ds
+  movw %ax, %es
+80108eeb:	8e c0                	mov    %eax,%es
+
+  # Call trap(tf), where tf=%esp
+  pushl %esp
+80108eed:	54                   	push   %esp
+  call trap
+80108eee:	e8 0d 01 00 00       	call   80109000 <trap>
+  addl $4, %esp
+80108ef3:	83 c4 04             	add    $0x4,%esp
+
+80108ef6 <trapret>:
+
+  # Return falls through to trapret...
+.globl trapret
+trapret:
+  popal
+80108ef6:	61                   	popa
+  popl %gs
+80108ef7:	0f a9                	pop    %gs
+  popl %fs
+80108ef9:	0f a1                	pop    %fs
+  popl %es
+80108efb:	07                   	pop    %es
+  popl %ds
+80108efc:	1f                   	pop    %ds
+  addl $0x8, %esp  # trapno and errcode
+80108efd:	83 c4 08             	add    $0x8,%esp
+  iret
+80108f00:	cf                   	iret
+80108f01:	66 90                	xchg   %ax,%ax
+80108f03:	66 90                	xchg   %ax,%ax
+80108f05:	66 90                	xchg   %ax,%ax
+80108f07:	66 90                	xchg   %ax,%ax
+80108f09:	66 90                	xchg   %ax,%ax
+80108f0b:	66 90                	xchg   %ax,%ax
+80108f0d:	66 90                	xchg   %ax,%ax
+80108f0f:	90                   	nop
+
+80108f10 <tvinit>:
+
+#define IDLEMAX HZ  // longest an idle CPU goes without a tick
+
+void
+tvinit(void)
+{
+80108f10:	55                   	push   %ebp
+  int i;
+
+  for(i = 0; i < 256; i++)
+80108f11:	31 c0                	xor    %eax,%eax
+{
+80108f13:	89 e5                	mov    %esp,%ebp
+80108f15:	83 ec 08             	sub    $0x8,%esp
+80108f18:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108f1f:	90                   	nop
+    SETGATE(idt[i], 0, SEG_KCODE<<3, vectors[i], 0);
+80108f20:	8b 14 85 08 e0 10 80 	mov    -0x7fef1ff8(,%eax,4),%edx
+80108f27:	c7 04 c5 02 23 91 80 	movl   $0x8e000008,-0x7f6edcfe(,%eax,8)
+80108f2e:	08 00 00 8e 
+80108f32:	66 89 14 c5 00 23 91 	mov    %dx,-0x7f6edd00(,%eax,8)
+80108f39:	80 
+80108f3a:	c1 ea 10             	shr    $0x10,%edx
+80108f3d:	66 89 14 c5 06 23 91 	mov    %dx,-0x7f6edcfa(,%eax,8)
+80108f44:	80 
+  for(i = 0; i < 256; i++)
+80108f45:	83 c0 01             	add    $0x1,%eax
+80108f48:	3d 00 01 00 00       	cmp    $0x100,%eax
+80108f4d:	75 d1                	jne    80108f20 <tvinit+0x10>
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+80108f4f:	a1 08 e1 10 80       	mov    0x8010e108,%eax
+
+  initlock(&tickslock, "time");
+80108f54:	83 ec 08             	sub    $0x8,%esp
+  SETGATE(idt[T_SYSCALL], 1, SEG_KCODE<<3, vectors[T_SYSCALL], DPL_USER);
+80108f57:	c7 05 02 25 91 80 08 	movl   $0xef000008,0x80912502
+80108f5e:	00 00 ef 
+80108f61:	66 a3 00 25 91 80    	mov    %ax,0x80912500
+80108f67:	c1 e8 10             	shr    $0x10,%eax
+80108f6a:	66 a3 06 25 91 80    	mov    %ax,0x80912506
+  initlock(&tickslock, "time");
+80108f70:	68 ee b6 10 80       	push   $0x8010b6ee
+80108f75:	68 c0 22 91 80       	push   $0x809122c0
+80108f7a:	e8 f1 e3 ff ff       	call   80107370 <initlock>
+}
+80108f7f:	83 c4 10             	add    $0x10,%esp
+80108f82:	c9                   	leave
+80108f83:	c3                   	ret
+80108f84:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108f8b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80108f8f:	90                   	nop
+
+80108f90 <idtinit>:
+
+void
+idtinit(void)
+{
+80108f90:	55                   	push   %ebp
+  pd[0] = size-1;
+80108f91:	b8 ff 07 00 00       	mov    $0x7ff,%eax
+80108f96:	89 e5                	mov    %esp,%ebp
+80108f98:	83 ec 10             	sub    $0x10,%esp
+80108f9b:	66 89 45 fa          	mov    %ax,-0x6(%ebp)
+  pd[1] = (uint)p;
+80108f9f:	b8 00 23 91 80       	mov    $0x80912300,%eax
+80108fa4:	66 89 45 fc          	mov    %ax,-0x4(%ebp)
+  pd[2] = (uint)p >> 16;
+80108fa8:	c1 e8 10             	shr    $0x10,%eax
+80108fab:	66 89 45 fe          	mov    %ax,-0x2(%ebp)
+  asm volatile("lidt (%0)" : : "r" (pd));
+80108faf:	8d 45 fa             	lea    -0x6(%ebp),%eax
+80108fb2:	0f 01 18             	lidtl  (%eax)
+  lidt(idt, sizeof(idt));
+}
+80108fb5:	c9                   	leave
+80108fb6:	c3                   	ret
+80108fb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80108fbe:	66 90                	xchg   %ax,%ax
+
+80108fc0 <idleticks>:
+
+// How many ticks an idle CPU may leave its timer off for.
+uint
+idleticks(void)
+{
+80108fc0:	55                   	push   %ebp
+80108fc1:	89 e5                	mov    %esp,%ebp
+80108fc3:	53                   	push   %ebx
+80108fc4:	83 ec 10             	sub    $0x10,%esp
+  uint n;
+
+  acquire(&tickslock);
+80108fc7:	68 c0 22 91 80       	push   $0x809122c0
+80108fcc:	e8 7f e5 ff ff       	call   80107550 <acquire>
+  n = timernext();
+80108fd1:	e8 ba fe ff ff       	call   80108e90 <timernext>
+  release(&tickslock);
+80108fd6:	c7 04 24 c0 22 91 80 	movl   $0x809122c0,(%esp)
+  n = timernext();
+80108fdd:	89 c3                	mov    %eax,%ebx
+  release(&tickslock);
+80108fdf:	e8 0c e5 ff ff       	call   801074f0 <release>
+  if(n > IDLEMAX)
+    n = IDLEMAX;
+  return n > 0 ? n : 1;
+80108fe4:	85 db                	test   %ebx,%ebx
+80108fe6:	b8 01 00 00 00       	mov    $0x1,%eax
+80108feb:	ba 64 00 00 00       	mov    $0x64,%edx
+80108ff0:	0f 45 c3             	cmovne %ebx,%eax
+}
+80108ff3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+80108ff6:	c9                   	leave
+  return n > 0 ? n : 1;
+80108ff7:	39 d0                	cmp    %edx,%eax
+80108ff9:	0f 47 c2             	cmova  %edx,%eax
+}
+80108ffc:	c3                   	ret
+80108ffd:	8d 76 00             	lea    0x0(%esi),%esi
+
+80109000 <trap>:
+}
+
+//PAGEBREAK: 41
+void
+trap(struct trapframe *tf)
+{
+80109000:	55                   	push   %ebp
+80109001:	89 e5                	mov    %esp,%ebp
+80109003:	57                   	push   %edi
+80109004:	56                   	push   %esi
+80109005:	53                   	push   %ebx
+80109006:	83 ec 1c             	sub    $0x1c,%esp
+80109009:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(tf->trapno == T_SYSCALL){
+8010900c:	8b 43 30             	mov    0x30(%ebx),%eax
+8010900f:	83 f8 40             	cmp    $0x40,%eax
+80109012:	0f 84 68 01 00 00    	je     80109180 <trap+0x180>
+    if(myproc()->killed)
+      exit();
+    return;
+  }
+
+  switch(tf->trapno){
+80109018:	83 e8 0e             	sub    $0xe,%eax
+8010901b:	83 f8 31             	cmp    $0x31,%eax
+8010901e:	0f 87 ac 00 00 00    	ja     801090d0 <trap+0xd0>
+80109024:	ff 24 85 94 b7 10 80 	jmp    *-0x7fef486c(,%eax,4)
+8010902b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010902f:	90                   	nop
+  case T_IRQ0 + IRQ_WAKEUP:
+    // Work was queued for this CPU while it was idle.
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_IDE:
+    ideintr();
+80109030:	e8 7b 1d 00 00       	call   8010adb0 <ideintr>
+    lapiceoi();
+80109035:	e8 16 b0 ff ff       	call   80104050 <lapiceoi>
+  }
+
+  // Force process exit if it has been killed and is in user space.
+  // (If it is still executing in the kernel, let it keep running
+  // until it gets to the regular system call return.)
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+8010903a:	e8 41 cd ff ff       	call   80105d80 <myproc>
+8010903f:	85 c0                	test   %eax,%eax
+80109041:	74 1d                	je     80109060 <trap+0x60>
+80109043:	e8 38 cd ff ff       	call   80105d80 <myproc>
+80109048:	8b 50 40             	mov    0x40(%eax),%edx
+8010904b:	85 d2                	test   %edx,%edx
+8010904d:	74 11                	je     80109060 <trap+0x60>
+8010904f:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80109053:	83 e0 03             	and    $0x3,%eax
+80109056:	66 83 f8 03          	cmp    $0x3,%ax
+8010905a:	0f 84 20 02 00 00    	je     80109280 <trap+0x280>
+    exit();
+
+  // Force process to give up CPU on clock tick.
+  // If interrupts were on while locks held, would need to check nlock.
+  if(myproc() && myproc()->state == RUNNING &&
+80109060:	e8 1b cd ff ff       	call   80105d80 <myproc>
+80109065:	85 c0                	test   %eax,%eax
+80109067:	74 0f                	je     80109078 <trap+0x78>
+80109069:	e8 12 cd ff ff       	call   80105d80 <myproc>
+8010906e:	83 78 0c 04          	cmpl   $0x4,0xc(%eax)
+80109072:	0f 84 e0 00 00 00    	je     80109158 <trap+0x158>
+     tf->trapno == T_IRQ0+IRQ_TIMER && timeslice())
+    yield();
+
+  // Check if the process has been killed since we yielded
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+80109078:	e8 03 cd ff ff       	call   80105d80 <myproc>
+8010907d:	85 c0                	test   %eax,%eax
+8010907f:	74 1d                	je     8010909e <trap+0x9e>
+80109081:	e8 fa cc ff ff       	call   80105d80 <myproc>
+80109086:	8b 40 40             	mov    0x40(%eax),%eax
+80109089:	85 c0                	test   %eax,%eax
+8010908b:	74 11                	je     8010909e <trap+0x9e>
+8010908d:	0f b7 43 3c          	movzwl 0x3c(%ebx),%eax
+80109091:	83 e0 03             	and    $0x3,%eax
+80109094:	66 83 f8 03          	cmp    $0x3,%ax
+80109098:	0f 84 0f 01 00 00    	je     801091ad <trap+0x1ad>
+    exit();
+}
+8010909e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801090a1:	5b                   	pop    %ebx
+801090a2:	5e                   	pop    %esi
+801090a3:	5f                   	pop    %edi
+801090a4:	5d                   	pop    %ebp
+801090a5:	c3                   	ret
+801090a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801090ad:	8d 76 00             	lea    0x0(%esi),%esi
+    if(myproc() && (tf->err & FEC_WR) &&
+801090b0:	e8 cb cc ff ff       	call   80105d80 <myproc>
+801090b5:	85 c0                	test   %eax,%eax
+801090b7:	74 0a                	je     801090c3 <trap+0xc3>
+801090b9:	f6 43 34 02          	testb  $0x2,0x34(%ebx)
+801090bd:	0f 85 0d 02 00 00    	jne    801092d0 <trap+0x2d0>
+    if(myproc() && lazyfault(myproc()->pgdir, myproc()->sz, rcr2()) == 0)
+801090c3:	e8 b8 cc ff ff       	call   80105d80 <myproc>
+801090c8:	85 c0                	test   %eax,%eax
+801090ca:	0f 85 c0 01 00 00    	jne    80109290 <trap+0x290>
+    if(myproc() == 0 || (tf->cs&3) == 0){
+801090d0:	e8 ab cc ff ff       	call   80105d80 <myproc>
+801090d5:	8b 7b 38             	mov    0x38(%ebx),%edi
+801090d8:	85 c0                	test   %eax,%eax
+801090da:	0f 84 14 02 00 00    	je     801092f4 <trap+0x2f4>
+801090e0:	f6 43 3c 03          	testb  $0x3,0x3c(%ebx)
+801090e4:	0f 84 0a 02 00 00    	je     801092f4 <trap+0x2f4>
+
+static inline uint
+rcr2(void)
+{
+  uint val;
+  asm volatile("movl %%cr2,%0" : "=r" (val));
+801090ea:	0f 20 d1             	mov    %cr2,%ecx
+801090ed:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+801090f0:	e8 0b ca ff ff       	call   80105b00 <cpuid>
+801090f5:	8b 73 30             	mov    0x30(%ebx),%esi
+801090f8:	89 45 dc             	mov    %eax,-0x24(%ebp)
+801090fb:	8b 43 34             	mov    0x34(%ebx),%eax
+801090fe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+            myproc()->pid, myproc()->name, tf->trapno,
+80109101:	e8 7a cc ff ff       	call   80105d80 <myproc>
+80109106:	89 45 e0             	mov    %eax,-0x20(%ebp)
+80109109:	e8 72 cc ff ff       	call   80105d80 <myproc>
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+8010910e:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+80109111:	51                   	push   %ecx
+80109112:	57                   	push   %edi
+80109113:	8b 55 dc             	mov    -0x24(%ebp),%edx
+80109116:	52                   	push   %edx
+80109117:	ff 75 e4             	push   -0x1c(%ebp)
+8010911a:	56                   	push   %esi
+            myproc()->pid, myproc()->name, tf->trapno,
+8010911b:	8b 75 e0             	mov    -0x20(%ebp),%esi
+8010911e:	81 c6 88 00 00 00    	add    $0x88,%esi
+    cprintf("pid %d %s: trap %d err %d on cpu %d "
+80109124:	56                   	push   %esi
+80109125:	ff 70 10             	push   0x10(%eax)
+80109128:	68 50 b7 10 80       	push   $0x8010b750
+8010912d:	e8 7e 7a ff ff       	call   80100bb0 <cprintf>
+    myproc()->killed = 1;
+80109132:	83 c4 20             	add    $0x20,%esp
+80109135:	e8 46 cc ff ff       	call   80105d80 <myproc>
+8010913a:	c7 40 40 01 00 00 00 	movl   $0x1,0x40(%eax)
+  if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
+80109141:	e8 3a cc ff ff       	call   80105d80 <myproc>
+80109146:	85 c0                	test   %eax,%eax
+80109148:	0f 85 f5 fe ff ff    	jne    80109043 <trap+0x43>
+8010914e:	e9 0d ff ff ff       	jmp    80109060 <trap+0x60>
+80109153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80109157:	90                   	nop
+  if(myproc() && myproc()->state == RUNNING &&
+80109158:	83 7b 30 20          	cmpl   $0x20,0x30(%ebx)
+8010915c:	0f 85 16 ff ff ff    	jne    80109078 <trap+0x78>
+     tf->trapno == T_IRQ0+IRQ_TIMER && timeslice())
+80109162:	e8 e9 d7 ff ff       	call   80106950 <timeslice>
+80109167:	85 c0                	test   %eax,%eax
+80109169:	0f 84 09 ff ff ff    	je     80109078 <trap+0x78>
+    yield();
+8010916f:	e8 ec d7 ff ff       	call   80106960 <yield>
+80109174:	e9 ff fe ff ff       	jmp    80109078 <trap+0x78>
+80109179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(myproc()->killed)
+80109180:	e8 fb cb ff ff       	call   80105d80 <myproc>
+80109185:	8b 70 40             	mov    0x40(%eax),%esi
+80109188:	85 f6                	test   %esi,%esi
+8010918a:	0f 85 30 01 00 00    	jne    801092c0 <trap+0x2c0>
+    myproc()->tf = tf;
+80109190:	e8 eb cb ff ff       	call   80105d80 <myproc>
+80109195:	89 58 28             	mov    %ebx,0x28(%eax)
+    syscall();
+80109198:	e8 e3 e8 ff ff       	call   80107a80 <syscall>
+    if(myproc()->killed)
+8010919d:	e8 de cb ff ff       	call   80105d80 <myproc>
+801091a2:	8b 48 40             	mov    0x40(%eax),%ecx
+801091a5:	85 c9                	test   %ecx,%ecx
+801091a7:	0f 84 f1 fe ff ff    	je     8010909e <trap+0x9e>
+}
+801091ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+801091b0:	5b                   	pop    %ebx
+801091b1:	5e                   	pop    %esi
+801091b2:	5f                   	pop    %edi
+801091b3:	5d                   	pop    %ebp
+      exit();
+801091b4:	e9 d7 d5 ff ff       	jmp    80106790 <exit>
+801091b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    cprintf("cpu%d: spurious interrupt at %x:%x\n",
+801091c0:	8b 7b 38             	mov    0x38(%ebx),%edi
+801091c3:	0f b7 73 3c          	movzwl 0x3c(%ebx),%esi
+801091c7:	e8 34 c9 ff ff       	call   80105b00 <cpuid>
+801091cc:	57                   	push   %edi
+801091cd:	56                   	push   %esi
+801091ce:	50                   	push   %eax
+801091cf:	68 f8 b6 10 80       	push   $0x8010b6f8
+801091d4:	e8 d7 79 ff ff       	call   80100bb0 <cprintf>
+    lapiceoi();
+801091d9:	e8 72 ae ff ff       	call   80104050 <lapiceoi>
+    break;
+801091de:	83 c4 10             	add    $0x10,%esp
+801091e1:	e9 54 fe ff ff       	jmp    8010903a <trap+0x3a>
+801091e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+801091ed:	8d 76 00             	lea    0x0(%esi),%esi
+  acquire(&tickslock);
+801091f0:	83 ec 0c             	sub    $0xc,%esp
+801091f3:	68 c0 22 91 80       	push   $0x809122c0
+801091f8:	e8 53 e3 ff ff       	call   80107550 <acquire>
+  t = clockticks();
+801091fd:	e8 ee ab ff ff       	call   80103df0 <clockticks>
+  if((int)(t - ticks) > 0){
+80109202:	83 c4 10             	add    $0x10,%esp
+80109205:	89 c2                	mov    %eax,%edx
+80109207:	2b 15 a0 22 91 80    	sub    0x809122a0,%edx
+8010920d:	85 d2                	test   %edx,%edx
+8010920f:	7e 0a                	jle    8010921b <trap+0x21b>
+    ticks = t;
+80109211:	a3 a0 22 91 80       	mov    %eax,0x809122a0
+    timerrun();
+80109216:	e8 45 fb ff ff       	call   80108d60 <timerrun>
+  release(&tickslock);
+8010921b:	83 ec 0c             	sub    $0xc,%esp
+8010921e:	68 c0 22 91 80       	push   $0x809122c0
+80109223:	e8 c8 e2 ff ff       	call   801074f0 <release>
+    if(myproc() && myproc()->state == RUNNING)
+80109228:	e8 53 cb ff ff       	call   80105d80 <myproc>
+8010922d:	83 c4 10             	add    $0x10,%esp
+80109230:	85 c0                	test   %eax,%eax
+80109232:	0f 84 fd fd ff ff    	je     80109035 <trap+0x35>
+80109238:	e8 43 cb ff ff       	call   80105d80 <myproc>
+8010923d:	83 78 0c 04          	cmpl   $0x4,0xc(%eax)
+80109241:	0f 85 ee fd ff ff    	jne    80109035 <trap+0x35>
+      myproc()->runticks++;
+80109247:	e8 34 cb ff ff       	call   80105d80 <myproc>
+8010924c:	83 80 fc 00 00 00 01 	addl   $0x1,0xfc(%eax)
+    lapiceoi();
+80109253:	e9 dd fd ff ff       	jmp    80109035 <trap+0x35>
+80109258:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010925f:	90                   	nop
+    uartintr();
+80109260:	e8 3b 02 00 00       	call   801094a0 <uartintr>
+    lapiceoi();
+80109265:	e8 e6 ad ff ff       	call   80104050 <lapiceoi>
+    break;
+8010926a:	e9 cb fd ff ff       	jmp    8010903a <trap+0x3a>
+8010926f:	90                   	nop
+    kbdintr();
+80109270:	e8 1b aa ff ff       	call   80103c90 <kbdintr>
+    lapiceoi();
+80109275:	e8 d6 ad ff ff       	call   80104050 <lapiceoi>
+    break;
+8010927a:	e9 bb fd ff ff       	jmp    8010903a <trap+0x3a>
+8010927f:	90                   	nop
+    exit();
+80109280:	e8 0b d5 ff ff       	call   80106790 <exit>
+80109285:	e9 d6 fd ff ff       	jmp    80109060 <trap+0x60>
+8010928a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+80109290:	0f 20 d7             	mov    %cr2,%edi
+    if(myproc() && lazyfault(myproc()->pgdir, myproc()->sz, rcr2()) == 0)
+80109293:	e8 e8 ca ff ff       	call   80105d80 <myproc>
+80109298:	8b 30                	mov    (%eax),%esi
+8010929a:	e8 e1 ca ff ff       	call   80105d80 <myproc>
+8010929f:	83 ec 04             	sub    $0x4,%esp
+801092a2:	57                   	push   %edi
+801092a3:	56                   	push   %esi
+801092a4:	ff 70 04             	push   0x4(%eax)
+801092a7:	e8 84 16 00 00       	call   8010a930 <lazyfault>
+801092ac:	83 c4 10             	add    $0x10,%esp
+801092af:	85 c0                	test   %eax,%eax
+801092b1:	0f 84 83 fd ff ff    	je     8010903a <trap+0x3a>
+801092b7:	e9 14 fe ff ff       	jmp    801090d0 <trap+0xd0>
+801092bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      exit();
+801092c0:	e8 cb d4 ff ff       	call   80106790 <exit>
+801092c5:	e9 c6 fe ff ff       	jmp    80109190 <trap+0x190>
+801092ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+801092d0:	0f 20 d6             	mov    %cr2,%esi
+       cowfault(myproc()->pgdir, rcr2()) == 0)
+801092d3:	e8 a8 ca ff ff       	call   80105d80 <myproc>
+801092d8:	83 ec 08             	sub    $0x8,%esp
+801092db:	56                   	push   %esi
+801092dc:	ff 70 04             	push   0x4(%eax)
+801092df:	e8 cc 14 00 00       	call   8010a7b0 <cowfault>
+    if(myproc() && (tf->err & FEC_WR) &&
+801092e4:	83 c4 10             	add    $0x10,%esp
+801092e7:	85 c0                	test   %eax,%eax
+801092e9:	0f 85 d4 fd ff ff    	jne    801090c3 <trap+0xc3>
+801092ef:	e9 46 fd ff ff       	jmp    8010903a <trap+0x3a>
+801092f4:	0f 20 d6             	mov    %cr2,%esi
+      cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
+801092f7:	e8 04 c8 ff ff       	call   80105b00 <cpuid>
+801092fc:	83 ec 0c             	sub    $0xc,%esp
+801092ff:	56                   	push   %esi
+80109300:	57                   	push   %edi
+80109301:	50                   	push   %eax
+80109302:	ff 73 30             	push   0x30(%ebx)
+80109305:	68 1c b7 10 80       	push   $0x8010b71c
+8010930a:	e8 a1 78 ff ff       	call   80100bb0 <cprintf>
+      panic("trap");
+8010930f:	83 c4 14             	add    $0x14,%esp
+80109312:	68 f3 b6 10 80       	push   $0x8010b6f3
+80109317:	e8 64 75 ff ff       	call   80100880 <panic>
+8010931c:	66 90                	xchg   %ax,%ax
+8010931e:	66 90                	xchg   %ax,%ax
+
+80109320 <uartgetc>:
+}
+
+static int
+uartgetc(void)
+{
+  if(!uart)
+80109320:	a1 00 2b 91 80       	mov    0x80912b00,%eax
+80109325:	85 c0                	test   %eax,%eax
+80109327:	74 17                	je     80109340 <uartgetc+0x20>
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+80109329:	ba fd 03 00 00       	mov    $0x3fd,%edx
+8010932e:	ec                   	in     (%dx),%al
+    return -1;
+  if(!(inb(COM1+5) & 0x01))
+8010932f:	a8 01                	test   $0x1,%al
+80109331:	74 0d                	je     80109340 <uartgetc+0x20>
+80109333:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109338:	ec                   	in     (%dx),%al
+    return -1;
+  return inb(COM1+0);
+80109339:	0f b6 c0             	movzbl %al,%eax
+8010933c:	c3                   	ret
+8010933d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+80109340:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+80109345:	c3                   	ret
+80109346:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010934d:	8d 76 00             	lea    0x0(%esi),%esi
+
+80109350 <uartinit>:
+{
+80109350:	55                   	push   %ebp
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109351:	31 c9                	xor    %ecx,%ecx
+80109353:	89 c8                	mov    %ecx,%eax
+80109355:	89 e5                	mov    %esp,%ebp
+80109357:	57                   	push   %edi
+80109358:	bf fa 03 00 00       	mov    $0x3fa,%edi
+8010935d:	56                   	push   %esi
+8010935e:	89 fa                	mov    %edi,%edx
+80109360:	53                   	push   %ebx
+80109361:	83 ec 1c             	sub    $0x1c,%esp
+80109364:	ee                   	out    %al,(%dx)
+80109365:	be fb 03 00 00       	mov    $0x3fb,%esi
+8010936a:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+8010936f:	89 f2                	mov    %esi,%edx
+80109371:	ee                   	out    %al,(%dx)
+80109372:	b8 0c 00 00 00       	mov    $0xc,%eax
+80109377:	ba f8 03 00 00       	mov    $0x3f8,%edx
+8010937c:	ee                   	out    %al,(%dx)
+8010937d:	bb f9 03 00 00       	mov    $0x3f9,%ebx
+80109382:	89 c8                	mov    %ecx,%eax
+80109384:	89 da                	mov    %ebx,%edx
+80109386:	ee                   	out    %al,(%dx)
+80109387:	b8 03 00 00 00       	mov    $0x3,%eax
+8010938c:	89 f2                	mov    %esi,%edx
+8010938e:	ee                   	out    %al,(%dx)
+8010938f:	ba fc 03 00 00       	mov    $0x3fc,%edx
+80109394:	89 c8                	mov    %ecx,%eax
+80109396:	ee                   	out    %al,(%dx)
+80109397:	b8 01 00 00 00       	mov    $0x1,%eax
+8010939c:	89 da                	mov    %ebx,%edx
+8010939e:	ee                   	out    %al,(%dx)
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010939f:	ba fd 03 00 00       	mov    $0x3fd,%edx
+801093a4:	ec                   	in     (%dx),%al
+  if(inb(COM1+5) == 0xFF)
+801093a5:	3c ff                	cmp    $0xff,%al
+801093a7:	0f 84 7c 00 00 00    	je     80109429 <uartinit+0xd9>
+  uart = 1;
+801093ad:	c7 05 00 2b 91 80 01 	movl   $0x1,0x80912b00
+801093b4:	00 00 00 
+801093b7:	89 fa                	mov    %edi,%edx
+801093b9:	ec                   	in     (%dx),%al
+801093ba:	ba f8 03 00 00       	mov    $0x3f8,%edx
+801093bf:	ec                   	in     (%dx),%al
+  ioapicenable(IRQ_COM1, 0);
+801093c0:	83 ec 08             	sub    $0x8,%esp
+  for(p="xv6...\n"; *p; p++)
+801093c3:	bf 5c b8 10 80       	mov    $0x8010b85c,%edi
+801093c8:	be fd 03 00 00       	mov    $0x3fd,%esi
+  ioapicenable(IRQ_COM1, 0);
+801093cd:	6a 00                	push   $0x0
+801093cf:	6a 04                	push   $0x4
+801093d1:	e8 0a a3 ff ff       	call   801036e0 <ioapicenable>
+  for(p="xv6...\n"; *p; p++)
+801093d6:	c6 45 e7 78          	movb   $0x78,-0x19(%ebp)
+  ioapicenable(IRQ_COM1, 0);
+801093da:	83 c4 10             	add    $0x10,%esp
+801093dd:	8d 76 00             	lea    0x0(%esi),%esi
+  if(!uart)
+801093e0:	a1 00 2b 91 80       	mov    0x80912b00,%eax
+801093e5:	85 c0                	test   %eax,%eax
+801093e7:	74 32                	je     8010941b <uartinit+0xcb>
+801093e9:	89 f2                	mov    %esi,%edx
+801093eb:	ec                   	in     (%dx),%al
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+801093ec:	a8 20                	test   $0x20,%al
+801093ee:	75 21                	jne    80109411 <uartinit+0xc1>
+801093f0:	bb 80 00 00 00       	mov    $0x80,%ebx
+801093f5:	8d 76 00             	lea    0x0(%esi),%esi
+    microdelay(10);
+801093f8:	83 ec 0c             	sub    $0xc,%esp
+801093fb:	6a 0a                	push   $0xa
+801093fd:	e8 6e ac ff ff       	call   80104070 <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109402:	83 c4 10             	add    $0x10,%esp
+80109405:	83 eb 01             	sub    $0x1,%ebx
+80109408:	74 07                	je     80109411 <uartinit+0xc1>
+8010940a:	89 f2                	mov    %esi,%edx
+8010940c:	ec                   	in     (%dx),%al
+8010940d:	a8 20                	test   $0x20,%al
+8010940f:	74 e7                	je     801093f8 <uartinit+0xa8>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109411:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109416:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+8010941a:	ee                   	out    %al,(%dx)
+  for(p="xv6...\n"; *p; p++)
+8010941b:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+8010941f:	83 c7 01             	add    $0x1,%edi
+80109422:	88 45 e7             	mov    %al,-0x19(%ebp)
+80109425:	84 c0                	test   %al,%al
+80109427:	75 b7                	jne    801093e0 <uartinit+0x90>
+}
+80109429:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010942c:	5b                   	pop    %ebx
+8010942d:	5e                   	pop    %esi
+8010942e:	5f                   	pop    %edi
+8010942f:	5d                   	pop    %ebp
+80109430:	c3                   	ret
+80109431:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109438:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010943f:	90                   	nop
+
+80109440 <uartputc>:
+  if(!uart)
+80109440:	a1 00 2b 91 80       	mov    0x80912b00,%eax
+80109445:	85 c0                	test   %eax,%eax
+80109447:	74 4f                	je     80109498 <uartputc+0x58>
+{
+80109449:	55                   	push   %ebp
+  asm volatile("in %1,%0" : "=a" (data) : "d" (port));
+8010944a:	ba fd 03 00 00       	mov    $0x3fd,%edx
+8010944f:	89 e5                	mov    %esp,%ebp
+80109451:	56                   	push   %esi
+80109452:	53                   	push   %ebx
+80109453:	ec                   	in     (%dx),%al
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109454:	a8 20                	test   $0x20,%al
+80109456:	75 29                	jne    80109481 <uartputc+0x41>
+80109458:	bb 80 00 00 00       	mov    $0x80,%ebx
+8010945d:	be fd 03 00 00       	mov    $0x3fd,%esi
+80109462:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    microdelay(10);
+80109468:	83 ec 0c             	sub    $0xc,%esp
+8010946b:	6a 0a                	push   $0xa
+8010946d:	e8 fe ab ff ff       	call   80104070 <microdelay>
+  for(i = 0; i < 128 && !(inb(COM1+5) & 0x20); i++)
+80109472:	83 c4 10             	add    $0x10,%esp
+80109475:	83 eb 01             	sub    $0x1,%ebx
+80109478:	74 07                	je     80109481 <uartputc+0x41>
+8010947a:	89 f2                	mov    %esi,%edx
+8010947c:	ec                   	in     (%dx),%al
+8010947d:	a8 20                	test   $0x20,%al
+8010947f:	74 e7                	je     80109468 <uartputc+0x28>
+  asm volatile("out %0,%1" : : "a" (data), "d" (port));
+80109481:	8b 45 08             	mov    0x8(%ebp),%eax
+80109484:	ba f8 03 00 00       	mov    $0x3f8,%edx
+80109489:	ee                   	out    %al,(%dx)
+}
+8010948a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010948d:	5b                   	pop    %ebx
+8010948e:	5e                   	pop    %esi
+8010948f:	5d                   	pop    %ebp
+80109490:	c3                   	ret
+80109491:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+80109498:	c3                   	ret
+80109499:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+801094a0 <uartintr>:
+
+void
+uartintr(void)
+{
+801094a0:	55                   	push   %ebp
+801094a1:	89 e5                	mov    %esp,%ebp
+801094a3:	83 ec 14             	sub    $0x14,%esp
+  consoleintr(uartgetc);
+801094a6:	68 20 93 10 80       	push   $0x80109320
+801094ab:	e8 10 79 ff ff       	call   80100dc0 <consoleintr>
+}
+801094b0:	83 c4 10             	add    $0x10,%esp
+801094b3:	c9                   	leave
+801094b4:	c3                   	ret
+
+801094b5 <vector0>:
+# generated by vectors.pl - do not edit
+# handlers
+.globl alltraps
+.globl vector0
+vector0:
+  pushl $0
+801094b5:	6a 00                	push   $0x0
+  pushl $0
+801094b7:	6a 00                	push   $0x0
+  jmp alltraps
+801094b9:	e9 20 fa ff ff       	jmp    80108ede <alltraps>
+
+801094be <vector1>:
+.globl vector1
+vector1:
+  pushl $0
+801094be:	6a 00                	push   $0x0
+  pushl $1
+801094c0:	6a 01                	push   $0x1
+  jmp alltraps
+801094c2:	e9 17 fa ff ff       	jmp    80108ede <alltraps>
+
+801094c7 <vector2>:
+.globl vector2
+vector2:
+  pushl $0
+801094c7:	6a 00                	push   $0x0
+  pushl $2
+801094c9:	6a 02                	push   $0x2
+  jmp alltraps
+801094cb:	e9 0e fa ff ff       	jmp    80108ede <alltraps>
+
+801094d0 <vector3>:
+.globl vector3
+vector3:
+  pushl $0
+801094d0:	6a 00                	push   $0x0
+  pushl $3
+801094d2:	6a 03                	push   $0x3
+  jmp alltraps
+801094d4:	e9 05 fa ff ff       	jmp    80108ede <alltraps>
+
+801094d9 <vector4>:
+.globl vector4
+vector4:
+  pushl $0
+801094d9:	6a 00                	push   $0x0
+  pushl $4
+801094db:	6a 04                	push   $0x4
+  jmp alltraps
+801094dd:	e9 fc f9 ff ff       	jmp    80108ede <alltraps>
+
+801094e2 <vector5>:
+.globl vector5
+vector5:
+  pushl $0
+801094e2:	6a 00                	push   $0x0
+  pushl $5
+801094e4:	6a 05                	push   $0x5
+  jmp alltraps
+801094e6:	e9 f3 f9 ff ff       	jmp    80108ede <alltraps>
+
+801094eb <vector6>:
+.globl vector6
+vector6:
+  pushl $0
+801094eb:	6a 00                	push   $0x0
+  pushl $6
+801094ed:	6a 06                	push   $0x6
+  jmp alltraps
+801094ef:	e9 ea f9 ff ff       	jmp    80108ede <alltraps>
+
+801094f4 <vector7>:
+.globl vector7
+vector7:
+  pushl $0
+801094f4:	6a 00                	push   $0x0
+  pushl $7
+801094f6:	6a 07                	push   $0x7
+  jmp alltraps
+801094f8:	e9 e1 f9 ff ff       	jmp    80108ede <alltraps>
+
+801094fd <vector8>:
+.globl vector8
+vector8:
+  pushl $8
+801094fd:	6a 08                	push   $0x8
+  jmp alltraps
+801094ff:	e9 da f9 ff ff       	jmp    80108ede <alltraps>
+
+80109504 <vector9>:
+.globl vector9
+vector9:
+  pushl $0
+80109504:	6a 00                	push   $0x0
+  pushl $9
+80109506:	6a 09                	push   $0x9
+  jmp alltraps
+80109508:	e9 d1 f9 ff ff       	jmp    80108ede <alltraps>
+
+8010950d <vector10>:
+.globl vector10
+vector10:
+  pushl $10
+8010950d:	6a 0a                	push   $0xa
+  jmp alltraps
+8010950f:	e9 ca f9 ff ff       	jmp    80108ede <alltraps>
+
+80109514 <vector11>:
+.globl vector11
+vector11:
+  pushl $11
+80109514:	6a 0b                	push   $0xb
+  jmp alltraps
+80109516:	e9 c3 f9 ff ff       	jmp    80108ede <alltraps>
+
+8010951b <vector12>:
+.globl vector12
+vector12:
+  pushl $12
+8010951b:	6a 0c                	push   $0xc
+  jmp alltraps
+8010951d:	e9 bc f9 ff ff       	jmp    80108ede <alltraps>
+
+80109522 <vector13>:
+.globl vector13
+vector13:
+  pushl $13
+80109522:	6a 0d                	push   $0xd
+  jmp alltraps
+80109524:	e9 b5 f9 ff ff       	jmp    80108ede <alltraps>
+
+80109529 <vector14>:
+.globl vector14
+vector14:
+  pushl $14
+80109529:	6a 0e                	push   $0xe
+  jmp alltraps
+8010952b:	e9 ae f9 ff ff       	jmp    80108ede <alltraps>
+
+80109530 <vector15>:
+.globl vector15
+vector15:
+  pushl $0
+80109530:	6a 00                	push   $0x0
+  pushl $15
+80109532:	6a 0f                	push   $0xf
+  jmp alltraps
+80109534:	e9 a5 f9 ff ff       	jmp    80108ede <alltraps>
+
+80109539 <vector16>:
+.globl vector16
+vector16:
+  pushl $0
+80109539:	6a 00                	push   $0x0
+  pushl $16
+8010953b:	6a 10                	push   $0x10
+  jmp alltraps
+8010953d:	e9 9c f9 ff ff       	jmp    80108ede <alltraps>
+
+80109542 <vector17>:
+.globl vector17
+vector17:
+  pushl $17
+80109542:	6a 11                	push   $0x11
+  jmp alltraps
+80109544:	e9 95 f9 ff ff       	jmp    80108ede <alltraps>
+
+80109549 <vector18>:
+.globl vector18
+vector18:
+  pushl $0
+80109549:	6a 00                	push   $0x0
+  pushl $18
+8010954b:	6a 12                	push   $0x12
+  jmp alltraps
+8010954d:	e9 8c f9 ff ff       	jmp    80108ede <alltraps>
+
+80109552 <vector19>:
+.globl vector19
+vector19:
+  pushl $0
+80109552:	6a 00                	push   $0x0
+  pushl $19
+80109554:	6a 13                	push   $0x13
+  jmp alltraps
+80109556:	e9 83 f9 ff ff       	jmp    80108ede <alltraps>
+
+8010955b <vector20>:
+.globl vector20
+vector20:
+  pushl $0
+8010955b:	6a 00                	push   $0x0
+  pushl $20
+8010955d:	6a 14                	push   $0x14
+  jmp alltraps
+8010955f:	e9 7a f9 ff ff       	jmp    80108ede <alltraps>
+
+80109564 <vector21>:
+.globl vector21
+vector21:
+  pushl $0
+80109564:	6a 00                	push   $0x0
+  pushl $21
+80109566:	6a 15                	push   $0x15
+  jmp alltraps
+80109568:	e9 71 f9 ff ff       	jmp    80108ede <alltraps>
+
+8010956d <vector22>:
+.globl vector22
+vector22:
+  pushl $0
+8010956d:	6a 00                	push   $0x0
+  pushl $22
+8010956f:	6a 16                	push   $0x16
+  jmp alltraps
+80109571:	e9 68 f9 ff ff       	jmp    80108ede <alltraps>
+
+80109576 <vector23>:
+.globl vector23
+vector23:
+  pushl $0
+80109576:	6a 00                	push   $0x0
+  pushl $23
+80109578:	6a 17                	push   $0x17
+  jmp alltraps
+8010957a:	e9 5f f9 ff ff       	jmp    80108ede <alltraps>
+
+8010957f <vector24>:
+.globl vector24
+vector24:
+  pushl $0
+8010957f:	6a 00                	push   $0x0
+  pushl $24
+80109581:	6a 18                	push   $0x18
+  jmp alltraps
+80109583:	e9 56 f9 ff ff       	jmp    80108ede <alltraps>
+
+80109588 <vector25>:
+.globl vector25
+vector25:
+  pushl $0
+80109588:	6a 00                	push   $0x0
+  pushl $25
+8010958a:	6a 19                	push   $0x19
+  jmp alltraps
+8010958c:	e9 4d f9 ff ff       	jmp    80108ede <alltraps>
+
+80109591 <vector26>:
+.globl vector26
+vector26:
+  pushl $0
+80109591:	6a 00                	push   $0x0
+  pushl $26
+80109593:	6a 1a                	push   $0x1a
+  jmp alltraps
+80109595:	e9 44 f9 ff ff       	jmp    80108ede <alltraps>
+
+8010959a <vector27>:
+.globl vector27
+vector27:
+  pushl $0
+8010959a:	6a 00                	push   $0x0
+  pushl $27
+8010959c:	6a 1b                	push   $0x1b
+  jmp alltraps
+8010959e:	e9 3b f9 ff ff       	jmp    80108ede <alltraps>
+
+801095a3 <vector28>:
+.globl vector28
+vector28:
+  pushl $0
+801095a3:	6a 00                	push   $0x0
+  pushl $28
+801095a5:	6a 1c                	push   $0x1c
+  jmp alltraps
+801095a7:	e9 32 f9 ff ff       	jmp    80108ede <alltraps>
+
+801095ac <vector29>:
+.globl vector29
+vector29:
+  pushl $0
+801095ac:	6a 00                	push   $0x0
+  pushl $29
+801095ae:	6a 1d                	push   $0x1d
+  jmp alltraps
+801095b0:	e9 29 f9 ff ff       	jmp    80108ede <alltraps>
+
+801095b5 <vector30>:
+.globl vector30
+vector30:
+  pushl $0
+801095b5:	6a 00                	push   $0x0
+  pushl $30
+801095b7:	6a 1e                	push   $0x1e
+  jmp alltraps
+801095b9:	e9 20 f9 ff ff       	jmp    80108ede <alltraps>
+
+801095be <vector31>:
+.globl vector31
+vector31:
+  pushl $0
+801095be:	6a 00                	push   $0x0
+  pushl $31
+801095c0:	6a 1f                	push   $0x1f
+  jmp alltraps
+801095c2:	e9 17 f9 ff ff       	jmp    80108ede <alltraps>
+
+801095c7 <vector32>:
+.globl vector32
+vector32:
+  pushl $0
+801095c7:	6a 00                	push   $0x0
+  pushl $32
+801095c9:	6a 20                	push   $0x20
+  jmp alltraps
+801095cb:	e9 0e f9 ff ff       	jmp    80108ede <alltraps>
+
+801095d0 <vector33>:
+.globl vector33
+vector33:
+  pushl $0
+801095d0:	6a 00                	push   $0x0
+  pushl $33
+801095d2:	6a 21                	push   $0x21
+  jmp alltraps
+801095d4:	e9 05 f9 ff ff       	jmp    80108ede <alltraps>
+
+801095d9 <vector34>:
+.globl vector34
+vector34:
+  pushl $0
+801095d9:	6a 00                	push   $0x0
+  pushl $34
+801095db:	6a 22                	push   $0x22
+  jmp alltraps
+801095dd:	e9 fc f8 ff ff       	jmp    80108ede <alltraps>
+
+801095e2 <vector35>:
+.globl vector35
+vector35:
+  pushl $0
+801095e2:	6a 00                	push   $0x0
+  pushl $35
+801095e4:	6a 23                	push   $0x23
+  jmp alltraps
+801095e6:	e9 f3 f8 ff ff       	jmp    80108ede <alltraps>
+
+801095eb <vector36>:
+.globl vector36
+vector36:
+  pushl $0
+801095eb:	6a 00                	push   $0x0
+  pushl $36
+801095ed:	6a 24                	push   $0x24
+  jmp alltraps
+801095ef:	e9 ea f8 ff ff       	jmp    80108ede <alltraps>
+
+801095f4 <vector37>:
+.globl vector37
+vector37:
+  pushl $0
+801095f4:	6a 00                	push   $0x0
+  pushl $37
+801095f6:	6a 25                	push   $0x25
+  jmp alltraps
+801095f8:	e9 e1 f8 ff ff       	jmp    80108ede <alltraps>
+
+801095fd <vector38>:
+.globl vector38
+vector38:
+  pushl $0
+801095fd:	6a 00                	push   $0x0
+  pushl $38
+801095ff:	6a 26                	push   $0x26
+  jmp alltraps
+80109601:	e9 d8 f8 ff ff       	jmp    80108ede <alltraps>
+
+80109606 <vector39>:
+.globl vector39
+vector39:
+  pushl $0
+80109606:	6a 00                	push   $0x0
+  pushl $39
+80109608:	6a 27                	push   $0x27
+  jmp alltraps
+8010960a:	e9 cf f8 ff ff       	jmp    80108ede <alltraps>
+
+8010960f <vector40>:
+.globl vector40
+vector40:
+  pushl $0
+8010960f:	6a 00                	push   $0x0
+  pushl $40
+80109611:	6a 28                	push   $0x28
+  jmp alltraps
+80109613:	e9 c6 f8 ff ff       	jmp    80108ede <alltraps>
+
+80109618 <vector41>:
+.globl vector41
+vector41:
+  pushl $0
+80109618:	6a 00                	push   $0x0
+  pushl $41
+8010961a:	6a 29                	push   $0x29
+  jmp alltraps
+8010961c:	e9 bd f8 ff ff       	jmp    80108ede <alltraps>
+
+80109621 <vector42>:
+.globl vector42
+vector42:
+  pushl $0
+80109621:	6a 00                	push   $0x0
+  pushl $42
+80109623:	6a 2a                	push   $0x2a
+  jmp alltraps
+80109625:	e9 b4 f8 ff ff       	jmp    80108ede <alltraps>
+
+8010962a <vector43>:
+.globl vector43
+vector43:
+  pushl $0
+8010962a:	6a 00                	push   $0x0
+  pushl $43
+8010962c:	6a 2b                	push   $0x2b
+  jmp alltraps
+8010962e:	e9 ab f8 ff ff       	jmp    80108ede <alltraps>
+
+80109633 <vector44>:
+.globl vector44
+vector44:
+  pushl $0
+80109633:	6a 00                	push   $0x0
+  pushl $44
+80109635:	6a 2c                	push   $0x2c
+  jmp alltraps
+80109637:	e9 a2 f8 ff ff       	jmp    80108ede <alltraps>
+
+8010963c <vector45>:
+.globl vector45
+vector45:
+  pushl $0
+8010963c:	6a 00                	push   $0x0
+  pushl $45
+8010963e:	6a 2d                	push   $0x2d
+  jmp alltraps
+80109640:	e9 99 f8 ff ff       	jmp    80108ede <alltraps>
+
+80109645 <vector46>:
+.globl vector46
+vector46:
+  pushl $0
+80109645:	6a 00                	push   $0x0
+  pushl $46
+80109647:	6a 2e                	push   $0x2e
+  jmp alltraps
+80109649:	e9 90 f8 ff ff       	jmp    80108ede <alltraps>
+
+8010964e <vector47>:
+.globl vector47
+vector47:
+  pushl $0
+8010964e:	6a 00                	push   $0x0
+  pushl $47
+80109650:	6a 2f                	push   $0x2f
+  jmp alltraps
+80109652:	e9 87 f8 ff ff       	jmp    80108ede <alltraps>
+
+80109657 <vector48>:
+.globl vector48
+vector48:
+  pushl $0
+80109657:	6a 00                	push   $0x0
+  pushl $48
+80109659:	6a 30                	push   $0x30
+  jmp alltraps
+8010965b:	e9 7e f8 ff ff       	jmp    80108ede <alltraps>
+
+80109660 <vector49>:
+.globl vector49
+vector49:
+  pushl $0
+80109660:	6a 00                	push   $0x0
+  pushl $49
+80109662:	6a 31                	push   $0x31
+  jmp alltraps
+80109664:	e9 75 f8 ff ff       	jmp    80108ede <alltraps>
+
+80109669 <vector50>:
+.globl vector50
+vector50:
+  pushl $0
+80109669:	6a 00                	push   $0x0
+  pushl $50
+8010966b:	6a 32                	push   $0x32
+  jmp alltraps
+8010966d:	e9 6c f8 ff ff       	jmp    80108ede <alltraps>
+
+80109672 <vector51>:
+.globl vector51
+vector51:
+  pushl $0
+80109672:	6a 00                	push   $0x0
+  pushl $51
+80109674:	6a 33                	push   $0x33
+  jmp alltraps
+80109676:	e9 63 f8 ff ff       	jmp    80108ede <alltraps>
+
+8010967b <vector52>:
+.globl vector52
+vector52:
+  pushl $0
+8010967b:	6a 00                	push   $0x0
+  pushl $52
+8010967d:	6a 34                	push   $0x34
+  jmp alltraps
+8010967f:	e9 5a f8 ff ff       	jmp    80108ede <alltraps>
+
+80109684 <vector53>:
+.globl vector53
+vector53:
+  pushl $0
+80109684:	6a 00                	push   $0x0
+  pushl $53
+80109686:	6a 35                	push   $0x35
+  jmp alltraps
+80109688:	e9 51 f8 ff ff       	jmp    80108ede <alltraps>
+
+8010968d <vector54>:
+.globl vector54
+vector54:
+  pushl $0
+8010968d:	6a 00                	push   $0x0
+  pushl $54
+8010968f:	6a 36                	push   $0x36
+  jmp alltraps
+80109691:	e9 48 f8 ff ff       	jmp    80108ede <alltraps>
+
+80109696 <vector55>:
+.globl vector55
+vector55:
+  pushl $0
+80109696:	6a 00                	push   $0x0
+  pushl $55
+80109698:	6a 37                	push   $0x37
+  jmp alltraps
+8010969a:	e9 3f f8 ff ff       	jmp    80108ede <alltraps>
+
+8010969f <vector56>:
+.globl vector56
+vector56:
+  pushl $0
+8010969f:	6a 00                	push   $0x0
+  pushl $56
+801096a1:	6a 38                	push   $0x38
+  jmp alltraps
+801096a3:	e9 36 f8 ff ff       	jmp    80108ede <alltraps>
+
+801096a8 <vector57>:
+.globl vector57
+vector57:
+  pushl $0
+801096a8:	6a 00                	push   $0x0
+  pushl $57
+801096aa:	6a 39                	push   $0x39
+  jmp alltraps
+801096ac:	e9 2d f8 ff ff       	jmp    80108ede <alltraps>
+
+801096b1 <vector58>:
+.globl vector58
+vector58:
+  pushl $0
+801096b1:	6a 00                	push   $0x0
+  pushl $58
+801096b3:	6a 3a                	push   $0x3a
+  jmp alltraps
+801096b5:	e9 24 f8 ff ff       	jmp    80108ede <alltraps>
+
+801096ba <vector59>:
+.globl vector59
+vector59:
+  pushl $0
+801096ba:	6a 00                	push   $0x0
+  pushl $59
+801096bc:	6a 3b                	push   $0x3b
+  jmp alltraps
+801096be:	e9 1b f8 ff ff       	jmp    80108ede <alltraps>
+
+801096c3 <vector60>:
+.globl vector60
+vector60:
+  pushl $0
+801096c3:	6a 00                	push   $0x0
+  pushl $60
+801096c5:	6a 3c                	push   $0x3c
+  jmp alltraps
+801096c7:	e9 12 f8 ff ff       	jmp    80108ede <alltraps>
+
+801096cc <vector61>:
+.globl vector61
+vector61:
+  pushl $0
+801096cc:	6a 00                	push   $0x0
+  pushl $61
+801096ce:	6a 3d                	push   $0x3d
+  jmp alltraps
+801096d0:	e9 09 f8 ff ff       	jmp    80108ede <alltraps>
+
+801096d5 <vector62>:
+.globl vector62
+vector62:
+  pushl $0
+801096d5:	6a 00                	push   $0x0
+  pushl $62
+801096d7:	6a 3e                	push   $0x3e
+  jmp alltraps
+801096d9:	e9 00 f8 ff ff       	jmp    80108ede <alltraps>
+
+801096de <vector63>:
+.globl vector63
+vector63:
+  pushl $0
+801096de:	6a 00                	push   $0x0
+  pushl $63
+801096e0:	6a 3f                	push   $0x3f
+  jmp alltraps
+801096e2:	e9 f7 f7 ff ff       	jmp    80108ede <alltraps>
+
+801096e7 <vector64>:
+.globl vector64
+vector64:
+  pushl $0
+801096e7:	6a 00                	push   $0x0
+  pushl $64
+801096e9:	6a 40                	push   $0x40
+  jmp alltraps
+801096eb:	e9 ee f7 ff ff       	jmp    80108ede <alltraps>
+
+801096f0 <vector65>:
+.globl vector65
+vector65:
+  pushl $0
+801096f0:	6a 00                	push   $0x0
+  pushl $65
+801096f2:	6a 41                	push   $0x41
+  jmp alltraps
+801096f4:	e9 e5 f7 ff ff       	jmp    80108ede <alltraps>
+
+801096f9 <vector66>:
+.globl vector66
+vector66:
+  pushl $0
+801096f9:	6a 00                	push   $0x0
+  pushl $66
+801096fb:	6a 42                	push   $0x42
+  jmp alltraps
+801096fd:	e9 dc f7 ff ff       	jmp    80108ede <alltraps>
+
+80109702 <vector67>:
+.globl vector67
+vector67:
+  pushl $0
+80109702:	6a 00                	push   $0x0
+  pushl $67
+80109704:	6a 43                	push   $0x43
+  jmp alltraps
+80109706:	e9 d3 f7 ff ff       	jmp    80108ede <alltraps>
+
+8010970b <vector68>:
+.globl vector68
+vector68:
+  pushl $0
+8010970b:	6a 00                	push   $0x0
+  pushl $68
+8010970d:	6a 44                	push   $0x44
+  jmp alltraps
+8010970f:	e9 ca f7 ff ff       	jmp    80108ede <alltraps>
+
+80109714 <vector69>:
+.globl vector69
+vector69:
+  pushl $0
+80109714:	6a 00                	push   $0x0
+  pushl $69
+80109716:	6a 45                	push   $0x45
+  jmp alltraps
+80109718:	e9 c1 f7 ff ff       	jmp    80108ede <alltraps>
+
+8010971d <vector70>:
+.globl vector70
+vector70:
+  pushl $0
+8010971d:	6a 00                	push   $0x0
+  pushl $70
+8010971f:	6a 46                	push   $0x46
+  jmp alltraps
+80109721:	e9 b8 f7 ff ff       	jmp    80108ede <alltraps>
+
+80109726 <vector71>:
+.globl vector71
+vector71:
+  pushl $0
+80109726:	6a 00                	push   $0x0
+  pushl $71
+80109728:	6a 47                	push   $0x47
+  jmp alltraps
+8010972a:	e9 af f7 ff ff       	jmp    80108ede <alltraps>
+
+8010972f <vector72>:
+.globl vector72
+vector72:
+  pushl $0
+8010972f:	6a 00                	push   $0x0
+  pushl $72
+80109731:	6a 48                	push   $0x48
+  jmp alltraps
+80109733:	e9 a6 f7 ff ff       	jmp    80108ede <alltraps>
+
+80109738 <vector73>:
+.globl vector73
+vector73:
+  pushl $0
+80109738:	6a 00                	push   $0x0
+  pushl $73
+8010973a:	6a 49                	push   $0x49
+  jmp alltraps
+8010973c:	e9 9d f7 ff ff       	jmp    80108ede <alltraps>
+
+80109741 <vector74>:
+.globl vector74
+vector74:
+  pushl $0
+80109741:	6a 00                	push   $0x0
+  pushl $74
+80109743:	6a 4a                	push   $0x4a
+  jmp alltraps
+80109745:	e9 94 f7 ff ff       	jmp    80108ede <alltraps>
+
+8010974a <vector75>:
+.globl vector75
+vector75:
+  pushl $0
+8010974a:	6a 00                	push   $0x0
+  pushl $75
+8010974c:	6a 4b                	push   $0x4b
+  jmp alltraps
+8010974e:	e9 8b f7 ff ff       	jmp    80108ede <alltraps>
+
+80109753 <vector76>:
+.globl vector76
+vector76:
+  pushl $0
+80109753:	6a 00                	push   $0x0
+  pushl $76
+80109755:	6a 4c                	push   $0x4c
+  jmp alltraps
+80109757:	e9 82 f7 ff ff       	jmp    80108ede <alltraps>
+
+8010975c <vector77>:
+.globl vector77
+vector77:
+  pushl $0
+8010975c:	6a 00                	push   $0x0
+  pushl $77
+8010975e:	6a 4d                	push   $0x4d
+  jmp alltraps
+80109760:	e9 79 f7 ff ff       	jmp    80108ede <alltraps>
+
+80109765 <vector78>:
+.globl vector78
+vector78:
+  pushl $0
+80109765:	6a 00                	push   $0x0
+  pushl $78
+80109767:	6a 4e                	push   $0x4e
+  jmp alltraps
+80109769:	e9 70 f7 ff ff       	jmp    80108ede <alltraps>
+
+8010976e <vector79>:
+.globl vector79
+vector79:
+  pushl $0
+8010976e:	6a 00                	push   $0x0
+  pushl $79
+80109770:	6a 4f                	push   $0x4f
+  jmp alltraps
+80109772:	e9 67 f7 ff ff       	jmp    80108ede <alltraps>
+
+80109777 <vector80>:
+.globl vector80
+vector80:
+  pushl $0
+80109777:	6a 00                	push   $0x0
+  pushl $80
+80109779:	6a 50                	push   $0x50
+  jmp alltraps
+8010977b:	e9 5e f7 ff ff       	jmp    80108ede <alltraps>
+
+80109780 <vector81>:
+.globl vector81
+vector81:
+  pushl $0
+80109780:	6a 00                	push   $0x0
+  pushl $81
+80109782:	6a 51                	push   $0x51
+  jmp alltraps
+80109784:	e9 55 f7 ff ff       	jmp    80108ede <alltraps>
+
+80109789 <vector82>:
+.globl vector82
+vector82:
+  pushl $0
+80109789:	6a 00                	push   $0x0
+  pushl $82
+8010978b:	6a 52                	push   $0x52
+  jmp alltraps
+8010978d:	e9 4c f7 ff ff       	jmp    80108ede <alltraps>
+
+80109792 <vector83>:
+.globl vector83
+vector83:
+  pushl $0
+80109792:	6a 00                	push   $0x0
+  pushl $83
+80109794:	6a 53                	push   $0x53
+  jmp alltraps
+80109796:	e9 43 f7 ff ff       	jmp    80108ede <alltraps>
+
+8010979b <vector84>:
+.globl vector84
+vector84:
+  pushl $0
+8010979b:	6a 00                	push   $0x0
+  pushl $84
+8010979d:	6a 54                	push   $0x54
+  jmp alltraps
+8010979f:	e9 3a f7 ff ff       	jmp    80108ede <alltraps>
+
+801097a4 <vector85>:
+.globl vector85
+vector85:
+  pushl $0
+801097a4:	6a 00                	push   $0x0
+  pushl $85
+801097a6:	6a 55                	push   $0x55
+  jmp alltraps
+801097a8:	e9 31 f7 ff ff       	jmp    80108ede <alltraps>
+
+801097ad <vector86>:
+.globl vector86
+vector86:
+  pushl $0
+801097ad:	6a 00                	push   $0x0
+  pushl $86
+801097af:	6a 56                	push   $0x56
+  jmp alltraps
+801097b1:	e9 28 f7 ff ff       	jmp    80108ede <alltraps>
+
+801097b6 <vector87>:
+.globl vector87
+vector87:
+  pushl $0
+801097b6:	6a 00                	push   $0x0
+  pushl $87
+801097b8:	6a 57                	push   $0x57
+  jmp alltraps
+801097ba:	e9 1f f7 ff ff       	jmp    80108ede <alltraps>
+
+801097bf <vector88>:
+.globl vector88
+vector88:
+  pushl $0
+801097bf:	6a 00                	push   $0x0
+  pushl $88
+801097c1:	6a 58                	push   $0x58
+  jmp alltraps
+801097c3:	e9 16 f7 ff ff       	jmp    80108ede <alltraps>
+
+801097c8 <vector89>:
+.globl vector89
+vector89:
+  pushl $0
+801097c8:	6a 00                	push   $0x0
+  pushl $89
+801097ca:	6a 59                	push   $0x59
+  jmp alltraps
+801097cc:	e9 0d f7 ff ff       	jmp    80108ede <alltraps>
+
+801097d1 <vector90>:
+.globl vector90
+vector90:
+  pushl $0
+801097d1:	6a 00                	push   $0x0
+  pushl $90
+801097d3:	6a 5a                	push   $0x5a
+  jmp alltraps
+801097d5:	e9 04 f7 ff ff       	jmp    80108ede <alltraps>
+
+801097da <vector91>:
+.globl vector91
+vector91:
+  pushl $0
+801097da:	6a 00                	push   $0x0
+  pushl $91
+801097dc:	6a 5b                	push   $0x5b
+  jmp alltraps
+801097de:	e9 fb f6 ff ff       	jmp    80108ede <alltraps>
+
+801097e3 <vector92>:
+.globl vector92
+vector92:
+  pushl $0
+801097e3:	6a 00                	push   $0x0
+  pushl $92
+801097e5:	6a 5c                	push   $0x5c
+  jmp alltraps
+801097e7:	e9 f2 f6 ff ff       	jmp    80108ede <alltraps>
+
+801097ec <vector93>:
+.globl vector93
+vector93:
+  pushl $0
+801097ec:	6a 00                	push   $0x0
+  pushl $93
+801097ee:	6a 5d                	push   $0x5d
+  jmp alltraps
+801097f0:	e9 e9 f6 ff ff       	jmp    80108ede <alltraps>
+
+801097f5 <vector94>:
+.globl vector94
+vector94:
+  pushl $0
+801097f5:	6a 00                	push   $0x0
+  pushl $94
+801097f7:	6a 5e                	push   $0x5e
+  jmp alltraps
+801097f9:	e9 e0 f6 ff ff       	jmp    80108ede <alltraps>
+
+801097fe <vector95>:
+.globl vector95
+vector95:
+  pushl $0
+801097fe:	6a 00                	push   $0x0
+  pushl $95
+80109800:	6a 5f                	push   $0x5f
+  jmp alltraps
+80109802:	e9 d7 f6 ff ff       	jmp    80108ede <alltraps>
+
+80109807 <vector96>:
+.globl vector96
+vector96:
+  pushl $0
+80109807:	6a 00                	push   $0x0
+  pushl $96
+80109809:	6a 60                	push   $0x60
+  jmp alltraps
+8010980b:	e9 ce f6 ff ff       	jmp    80108ede <alltraps>
+
+80109810 <vector97>:
+.globl vector97
+vector97:
+  pushl $0
+80109810:	6a 00                	push   $0x0
+  pushl $97
+80109812:	6a 61                	push   $0x61
+  jmp alltraps
+80109814:	e9 c5 f6 ff ff       	jmp    80108ede <alltraps>
+
+80109819 <vector98>:
+.globl vector98
+vector98:
+  pushl $0
+80109819:	6a 00                	push   $0x0
+  pushl $98
+8010981b:	6a 62                	push   $0x62
+  jmp alltraps
+8010981d:	e9 bc f6 ff ff       	jmp    80108ede <alltraps>
+
+80109822 <vector99>:
+.globl vector99
+vector99:
+  pushl $0
+80109822:	6a 00                	push   $0x0
+  pushl $99
+80109824:	6a 63                	push   $0x63
+  jmp alltraps
+80109826:	e9 b3 f6 ff ff       	jmp    80108ede <alltraps>
+
+8010982b <vector100>:
+.globl vector100
+vector100:
+  pushl $0
+8010982b:	6a 00                	push   $0x0
+  pushl $100
+8010982d:	6a 64                	push   $0x64
+  jmp alltraps
+8010982f:	e9 aa f6 ff ff       	jmp    80108ede <alltraps>
+
+80109834 <vector101>:
+.globl vector101
+vector101:
+  pushl $0
+80109834:	6a 00                	push   $0x0
+  pushl $101
+80109836:	6a 65                	push   $0x65
+  jmp alltraps
+80109838:	e9 a1 f6 ff ff       	jmp    80108ede <alltraps>
+
+8010983d <vector102>:
+.globl vector102
+vector102:
+  pushl $0
+8010983d:	6a 00                	push   $0x0
+  pushl $102
+8010983f:	6a 66                	push   $0x66
+  jmp alltraps
+80109841:	e9 98 f6 ff ff       	jmp    80108ede <alltraps>
+
+80109846 <vector103>:
+.globl vector103
+vector103:
+  pushl $0
+80109846:	6a 00                	push   $0x0
+  pushl $103
+80109848:	6a 67                	push   $0x67
+  jmp alltraps
+8010984a:	e9 8f f6 ff ff       	jmp    80108ede <alltraps>
+
+8010984f <vector104>:
+.globl vector104
+vector104:
+  pushl $0
+8010984f:	6a 00                	push   $0x0
+  pushl $104
+80109851:	6a 68                	push   $0x68
+  jmp alltraps
+80109853:	e9 86 f6 ff ff       	jmp    80108ede <alltraps>
+
+80109858 <vector105>:
+.globl vector105
+vector105:
+  pushl $0
+80109858:	6a 00                	push   $0x0
+  pushl $105
+8010985a:	6a 69                	push   $0x69
+  jmp alltraps
+8010985c:	e9 7d f6 ff ff       	jmp    80108ede <alltraps>
+
+80109861 <vector106>:
+.globl vector106
+vector106:
+  pushl $0
+80109861:	6a 00                	push   $0x0
+  pushl $106
+80109863:	6a 6a                	push   $0x6a
+  jmp alltraps
+80109865:	e9 74 f6 ff ff       	jmp    80108ede <alltraps>
+
+8010986a <vector107>:
+.globl vector107
+vector107:
+  pushl $0
+8010986a:	6a 00                	push   $0x0
+  pushl $107
+8010986c:	6a 6b                	push   $0x6b
+  jmp alltraps
+8010986e:	e9 6b f6 ff ff       	jmp    80108ede <alltraps>
+
+80109873 <vector108>:
+.globl vector108
+vector108:
+  pushl $0
+80109873:	6a 00                	push   $0x0
+  pushl $108
+80109875:	6a 6c                	push   $0x6c
+  jmp alltraps
+80109877:	e9 62 f6 ff ff       	jmp    80108ede <alltraps>
+
+8010987c <vector109>:
+.globl vector109
+vector109:
+  pushl $0
+8010987c:	6a 00                	push   $0x0
+  pushl $109
+8010987e:	6a 6d                	push   $0x6d
+  jmp alltraps
+80109880:	e9 59 f6 ff ff       	jmp    80108ede <alltraps>
+
+80109885 <vector110>:
+.globl vector110
+vector110:
+  pushl $0
+80109885:	6a 00                	push   $0x0
+  pushl $110
+80109887:	6a 6e                	push   $0x6e
+  jmp alltraps
+80109889:	e9 50 f6 ff ff       	jmp    80108ede <alltraps>
+
+8010988e <vector111>:
+.globl vector111
+vector111:
+  pushl $0
+8010988e:	6a 00                	push   $0x0
+  pushl $111
+80109890:	6a 6f                	push   $0x6f
+  jmp alltraps
+80109892:	e9 47 f6 ff ff       	jmp    80108ede <alltraps>
+
+80109897 <vector112>:
+.globl vector112
+vector112:
+  pushl $0
+80109897:	6a 00                	push   $0x0
+  pushl $112
+80109899:	6a 70                	push   $0x70
+  jmp alltraps
+8010989b:	e9 3e f6 ff ff       	jmp    80108ede <alltraps>
+
+801098a0 <vector113>:
+.globl vector113
+vector113:
+  pushl $0
+801098a0:	6a 00                	push   $0x0
+  pushl $113
+801098a2:	6a 71                	push   $0x71
+  jmp alltraps
+801098a4:	e9 35 f6 ff ff       	jmp    80108ede <alltraps>
+
+801098a9 <vector114>:
+.globl vector114
+vector114:
+  pushl $0
+801098a9:	6a 00                	push   $0x0
+  pushl $114
+801098ab:	6a 72                	push   $0x72
+  jmp alltraps
+801098ad:	e9 2c f6 ff ff       	jmp    80108ede <alltraps>
+
+801098b2 <vector115>:
+.globl vector115
+vector115:
+  pushl $0
+801098b2:	6a 00                	push   $0x0
+  pushl $115
+801098b4:	6a 73                	push   $0x73
+  jmp alltraps
+801098b6:	e9 23 f6 ff ff       	jmp    80108ede <alltraps>
+
+801098bb <vector116>:
+.globl vector116
+vector116:
+  pushl $0
+801098bb:	6a 00                	push   $0x0
+  pushl $116
+801098bd:	6a 74                	push   $0x74
+  jmp alltraps
+801098bf:	e9 1a f6 ff ff       	jmp    80108ede <alltraps>
+
+801098c4 <vector117>:
+.globl vector117
+vector117:
+  pushl $0
+801098c4:	6a 00                	push   $0x0
+  pushl $117
+801098c6:	6a 75                	push   $0x75
+  jmp alltraps
+801098c8:	e9 11 f6 ff ff       	jmp    80108ede <alltraps>
+
+801098cd <vector118>:
+.globl vector118
+vector118:
+  pushl $0
+801098cd:	6a 00                	push   $0x0
+  pushl $118
+801098cf:	6a 76                	push   $0x76
+  jmp alltraps
+801098d1:	e9 08 f6 ff ff       	jmp    80108ede <alltraps>
+
+801098d6 <vector119>:
+.globl vector119
+vector119:
+  pushl $0
+801098d6:	6a 00                	push   $0x0
+  pushl $119
+801098d8:	6a 77                	push   $0x77
+  jmp alltraps
+801098da:	e9 ff f5 ff ff       	jmp    80108ede <alltraps>
+
+801098df <vector120>:
+.globl vector120
+vector120:
+  pushl $0
+801098df:	6a 00                	push   $0x0
+  pushl $120
+801098e1:	6a 78                	push   $0x78
+  jmp alltraps
+801098e3:	e9 f6 f5 ff ff       	jmp    80108ede <alltraps>
+
+801098e8 <vector121>:
+.globl vector121
+vector121:
+  pushl $0
+801098e8:	6a 00                	push   $0x0
+  pushl $121
+801098ea:	6a 79                	push   $0x79
+  jmp alltraps
+801098ec:	e9 ed f5 ff ff       	jmp    80108ede <alltraps>
+
+801098f1 <vector122>:
+.globl vector122
+vector122:
+  pushl $0
+801098f1:	6a 00                	push   $0x0
+  pushl $122
+801098f3:	6a 7a                	push   $0x7a
+  jmp alltraps
+801098f5:	e9 e4 f5 ff ff       	jmp    80108ede <alltraps>
+
+801098fa <vector123>:
+.globl vector123
+vector123:
+  pushl $0
+801098fa:	6a 00                	push   $0x0
+  pushl $123
+801098fc:	6a 7b                	push   $0x7b
+  jmp alltraps
+801098fe:	e9 db f5 ff ff       	jmp    80108ede <alltraps>
+
+80109903 <vector124>:
+.globl vector124
+vector124:
+  pushl $0
+80109903:	6a 00                	push   $0x0
+  pushl $124
+80109905:	6a 7c                	push   $0x7c
+  jmp alltraps
+80109907:	e9 d2 f5 ff ff       	jmp    80108ede <alltraps>
+
+8010990c <vector125>:
+.globl vector125
+vector125:
+  pushl $0
+8010990c:	6a 00                	push   $0x0
+  pushl $125
+8010990e:	6a 7d                	push   $0x7d
+  jmp alltraps
+80109910:	e9 c9 f5 ff ff       	jmp    80108ede <alltraps>
+
+80109915 <vector126>:
+.globl vector126
+vector126:
+  pushl $0
+80109915:	6a 00                	push   $0x0
+  pushl $126
+80109917:	6a 7e                	push   $0x7e
+  jmp alltraps
+80109919:	e9 c0 f5 ff ff       	jmp    80108ede <alltraps>
+
+8010991e <vector127>:
+.globl vector127
+vector127:
+  pushl $0
+8010991e:	6a 00                	push   $0x0
+  pushl $127
+80109920:	6a 7f                	push   $0x7f
+  jmp alltraps
+80109922:	e9 b7 f5 ff ff       	jmp    80108ede <alltraps>
+
+80109927 <vector128>:
+.globl vector128
+vector128:
+  pushl $0
+80109927:	6a 00                	push   $0x0
+  pushl $128
+80109929:	68 80 00 00 00       	push   $0x80
+  jmp alltraps
+8010992e:	e9 ab f5 ff ff       	jmp    80108ede <alltraps>
+
+80109933 <vector129>:
+.globl vector129
+vector129:
+  pushl $0
+80109933:	6a 00                	push   $0x0
+  pushl $129
+80109935:	68 81 00 00 00       	push   $0x81
+  jmp alltraps
+8010993a:	e9 9f f5 ff ff       	jmp    80108ede <alltraps>
+
+8010993f <vector130>:
+.globl vector130
+vector130:
+  pushl $0
+8010993f:	6a 00                	push   $0x0
+  pushl $130
+80109941:	68 82 00 00 00       	push   $0x82
+  jmp alltraps
+80109946:	e9 93 f5 ff ff       	jmp    80108ede <alltraps>
+
+8010994b <vector131>:
+.globl vector131
+vector131:
+  pushl $0
+8010994b:	6a 00                	push   $0x0
+  pushl $131
+8010994d:	68 83 00 00 00       	push   $0x83
+  jmp alltraps
+80109952:	e9 87 f5 ff ff       	jmp    80108ede <alltraps>
+
+80109957 <vector132>:
+.globl vector132
+vector132:
+  pushl $0
+80109957:	6a 00                	push   $0x0
+  pushl $132
+80109959:	68 84 00 00 00       	push   $0x84
+  jmp alltraps
+8010995e:	e9 7b f5 ff ff       	jmp    80108ede <alltraps>
+
+80109963 <vector133>:
+.globl vector133
+vector133:
+  pushl $0
+80109963:	6a 00                	push   $0x0
+  pushl $133
+80109965:	68 85 00 00 00       	push   $0x85
+  jmp alltraps
+8010996a:	e9 6f f5 ff ff       	jmp    80108ede <alltraps>
+
+8010996f <vector134>:
+.globl vector134
+vector134:
+  pushl $0
+8010996f:	6a 00                	push   $0x0
+  pushl $134
+80109971:	68 86 00 00 00       	push   $0x86
+  jmp alltraps
+80109976:	e9 63 f5 ff ff       	jmp    80108ede <alltraps>
+
+8010997b <vector135>:
+.globl vector135
+vector135:
+  pushl $0
+8010997b:	6a 00                	push   $0x0
+  pushl $135
+8010997d:	68 87 00 00 00       	push   $0x87
+  jmp alltraps
+80109982:	e9 57 f5 ff ff       	jmp    80108ede <alltraps>
+
+80109987 <vector136>:
+.globl vector136
+vector136:
+  pushl $0
+80109987:	6a 00                	push   $0x0
+  pushl $136
+80109989:	68 88 00 00 00       	push   $0x88
+  jmp alltraps
+8010998e:	e9 4b f5 ff ff       	jmp    80108ede <alltraps>
+
+80109993 <vector137>:
+.globl vector137
+vector137:
+  pushl $0
+80109993:	6a 00                	push   $0x0
+  pushl $137
+80109995:	68 89 00 00 00       	push   $0x89
+  jmp alltraps
+8010999a:	e9 3f f5 ff ff       	jmp    80108ede <alltraps>
+
+8010999f <vector138>:
+.globl vector138
+vector138:
+  pushl $0
+8010999f:	6a 00                	push   $0x0
+  pushl $138
+801099a1:	68 8a 00 00 00       	push   $0x8a
+  jmp alltraps
+801099a6:	e9 33 f5 ff ff       	jmp    80108ede <alltraps>
+
+801099ab <vector139>:
+.globl vector139
+vector139:
+  pushl $0
+801099ab:	6a 00                	push   $0x0
+  pushl $139
+801099ad:	68 8b 00 00 00       	push   $0x8b
+  jmp alltraps
+801099b2:	e9 27 f5 ff ff       	jmp    80108ede <alltraps>
+
+801099b7 <vector140>:
+.globl vector140
+vector140:
+  pushl $0
+801099b7:	6a 00                	push   $0x0
+  pushl $140
+801099b9:	68 8c 00 00 00       	push   $0x8c
+  jmp alltraps
+801099be:	e9 1b f5 ff ff       	jmp    80108ede <alltraps>
+
+801099c3 <vector141>:
+.globl vector141
+vector141:
+  pushl $0
+801099c3:	6a 00                	push   $0x0
+  pushl $141
+801099c5:	68 8d 00 00 00       	push   $0x8d
+  jmp alltraps
+801099ca:	e9 0f f5 ff ff       	jmp    80108ede <alltraps>
+
+801099cf <vector142>:
+.globl vector142
+vector142:
+  pushl $0
+801099cf:	6a 00                	push   $0x0
+  pushl $142
+801099d1:	68 8e 00 00 00       	push   $0x8e
+  jmp alltraps
+801099d6:	e9 03 f5 ff ff       	jmp    80108ede <alltraps>
+
+801099db <vector143>:
+.globl vector143
+vector143:
+  pushl $0
+801099db:	6a 00                	push   $0x0
+  pushl $143
+801099dd:	68 8f 00 00 00       	push   $0x8f
+  jmp alltraps
+801099e2:	e9 f7 f4 ff ff       	jmp    80108ede <alltraps>
+
+801099e7 <vector144>:
+.globl vector144
+vector144:
+  pushl $0
+801099e7:	6a 00                	push   $0x0
+  pushl $144
+801099e9:	68 90 00 00 00       	push   $0x90
+  jmp alltraps
+801099ee:	e9 eb f4 ff ff       	jmp    80108ede <alltraps>
+
+801099f3 <vector145>:
+.globl vector145
+vector145:
+  pushl $0
+801099f3:	6a 00                	push   $0x0
+  pushl $145
+801099f5:	68 91 00 00 00       	push   $0x91
+  jmp alltraps
+801099fa:	e9 df f4 ff ff       	jmp    80108ede <alltraps>
+
+801099ff <vector146>:
+.globl vector146
+vector146:
+  pushl $0
+801099ff:	6a 00                	push   $0x0
+  pushl $146
+80109a01:	68 92 00 00 00       	push   $0x92
+  jmp alltraps
+80109a06:	e9 d3 f4 ff ff       	jmp    80108ede <alltraps>
+
+80109a0b <vector147>:
+.globl vector147
+vector147:
+  pushl $0
+80109a0b:	6a 00                	push   $0x0
+  pushl $147
+80109a0d:	68 93 00 00 00       	push   $0x93
+  jmp alltraps
+80109a12:	e9 c7 f4 ff ff       	jmp    80108ede <alltraps>
+
+80109a17 <vector148>:
+.globl vector148
+vector148:
+  pushl $0
+80109a17:	6a 00                	push   $0x0
+  pushl $148
+80109a19:	68 94 00 00 00       	push   $0x94
+  jmp alltraps
+80109a1e:	e9 bb f4 ff ff       	jmp    80108ede <alltraps>
+
+80109a23 <vector149>:
+.globl vector149
+vector149:
+  pushl $0
+80109a23:	6a 00                	push   $0x0
+  pushl $149
+80109a25:	68 95 00 00 00       	push   $0x95
+  jmp alltraps
+80109a2a:	e9 af f4 ff ff       	jmp    80108ede <alltraps>
+
+80109a2f <vector150>:
+.globl vector150
+vector150:
+  pushl $0
+80109a2f:	6a 00                	push   $0x0
+  pushl $150
+80109a31:	68 96 00 00 00       	push   $0x96
+  jmp alltraps
+80109a36:	e9 a3 f4 ff ff       	jmp    80108ede <alltraps>
+
+80109a3b <vector151>:
+.globl vector151
+vector151:
+  pushl $0
+80109a3b:	6a 00                	push   $0x0
+  pushl $151
+80109a3d:	68 97 00 00 00       	push   $0x97
+  jmp alltraps
+80109a42:	e9 97 f4 ff ff       	jmp    80108ede <alltraps>
+
+80109a47 <vector152>:
+.globl vector152
+vector152:
+  pushl $0
+80109a47:	6a 00                	push   $0x0
+  pushl $152
+80109a49:	68 98 00 00 00       	push   $0x98
+  jmp alltraps
+80109a4e:	e9 8b f4 ff ff       	jmp    80108ede <alltraps>
+
+80109a53 <vector153>:
+.globl vector153
+vector153:
+  pushl $0
+80109a53:	6a 00                	push   $0x0
+  pushl $153
+80109a55:	68 99 00 00 00       	push   $0x99
+  jmp alltraps
+80109a5a:	e9 7f f4 ff ff       	jmp    80108ede <alltraps>
+
+80109a5f <vector154>:
+.globl vector154
+vector154:
+  pushl $0
+80109a5f:	6a 00                	push   $0x0
+  pushl $154
+80109a61:	68 9a 00 00 00       	push   $0x9a
+  jmp alltraps
+80109a66:	e9 73 f4 ff ff       	jmp    80108ede <alltraps>
+
+80109a6b <vector155>:
+.globl vector155
+vector155:
+  pushl $0
+80109a6b:	6a 00                	push   $0x0
+  pushl $155
+80109a6d:	68 9b 00 00 00       	push   $0x9b
+  jmp alltraps
+80109a72:	e9 67 f4 ff ff       	jmp    80108ede <alltraps>
+
+80109a77 <vector156>:
+.globl vector156
+vector156:
+  pushl $0
+80109a77:	6a 00                	push   $0x0
+  pushl $156
+80109a79:	68 9c 00 00 00       	push   $0x9c
+  jmp alltraps
+80109a7e:	e9 5b f4 ff ff       	jmp    80108ede <alltraps>
+
+80109a83 <vector157>:
+.globl vector157
+vector157:
+  pushl $0
+80109a83:	6a 00                	push   $0x0
+  pushl $157
+80109a85:	68 9d 00 00 00       	push   $0x9d
+  jmp alltraps
+80109a8a:	e9 4f f4 ff ff       	jmp    80108ede <alltraps>
+
+80109a8f <vector158>:
+.globl vector158
+vector158:
+  pushl $0
+80109a8f:	6a 00                	push   $0x0
+  pushl $158
+80109a91:	68 9e 00 00 00       	push   $0x9e
+  jmp alltraps
+80109a96:	e9 43 f4 ff ff       	jmp    80108ede <alltraps>
+
+80109a9b <vector159>:
+.globl vector159
+vector159:
+  pushl $0
+80109a9b:	6a 00                	push   $0x0
+  pushl $159
+80109a9d:	68 9f 00 00 00       	push   $0x9f
+  jmp alltraps
+80109aa2:	e9 37 f4 ff ff       	jmp    80108ede <alltraps>
+
+80109aa7 <vector160>:
+.globl vector160
+vector160:
+  pushl $0
+80109aa7:	6a 00                	push   $0x0
+  pushl $160
+80109aa9:	68 a0 00 00 00       	push   $0xa0
+  jmp alltraps
+80109aae:	e9 2b f4 ff ff       	jmp    80108ede <alltraps>
+
+80109ab3 <vector161>:
+.globl vector161
+vector161:
+  pushl $0
+80109ab3:	6a 00                	push   $0x0
+  pushl $161
+80109ab5:	68 a1 00 00 00       	push   $0xa1
+  jmp alltraps
+80109aba:	e9 1f f4 ff ff       	jmp    80108ede <alltraps>
+
+80109abf <vector162>:
+.globl vector162
+vector162:
+  pushl $0
+80109abf:	6a 00                	push   $0x0
+  pushl $162
+80109ac1:	68 a2 00 00 00       	push   $0xa2
+  jmp alltraps
+80109ac6:	e9 13 f4 ff ff       	jmp    80108ede <alltraps>
+
+80109acb <vector163>:
+.globl vector163
+vector163:
+  pushl $0
+80109acb:	6a 00                	push   $0x0
+  pushl $163
+80109acd:	68 a3 00 00 00       	push   $0xa3
+  jmp alltraps
+80109ad2:	e9 07 f4 ff ff       	jmp    80108ede <alltraps>
+
+80109ad7 <vector164>:
+.globl vector164
+vector164:
+  pushl $0
+80109ad7:	6a 00                	push   $0x0
+  pushl $164
+80109ad9:	68 a4 00 00 00       	push   $0xa4
+  jmp alltraps
+80109ade:	e9 fb f3 ff ff       	jmp    80108ede <alltraps>
+
+80109ae3 <vector165>:
+.globl vector165
+vector165:
+  pushl $0
+80109ae3:	6a 00                	push   $0x0
+  pushl $165
+80109ae5:	68 a5 00 00 00       	push   $0xa5
+  jmp alltraps
+80109aea:	e9 ef f3 ff ff       	jmp    80108ede <alltraps>
+
+80109aef <vector166>:
+.globl vector166
+vector166:
+  pushl $0
+80109aef:	6a 00                	push   $0x0
+  pushl $166
+80109af1:	68 a6 00 00 00       	push   $0xa6
+  jmp alltraps
+80109af6:	e9 e3 f3 ff ff       	jmp    80108ede <alltraps>
+
+80109afb <vector167>:
+.globl vector167
+vector167:
+  pushl $0
+80109afb:	6a 00                	push   $0x0
+  pushl $167
+80109afd:	68 a7 00 00 00       	push   $0xa7
+  jmp alltraps
+80109b02:	e9 d7 f3 ff ff       	jmp    80108ede <alltraps>
+
+80109b07 <vector168>:
+.globl vector168
+vector168:
+  pushl $0
+80109b07:	6a 00                	push   $0x0
+  pushl $168
+80109b09:	68 a8 00 00 00       	push   $0xa8
+  jmp alltraps
+80109b0e:	e9 cb f3 ff ff       	jmp    80108ede <alltraps>
+
+80109b13 <vector169>:
+.globl vector169
+vector169:
+  pushl $0
+80109b13:	6a 00                	push   $0x0
+  pushl $169
+80109b15:	68 a9 00 00 00       	push   $0xa9
+  jmp alltraps
+80109b1a:	e9 bf f3 ff ff       	jmp    80108ede <alltraps>
+
+80109b1f <vector170>:
+.globl vector170
+vector170:
+  pushl $0
+80109b1f:	6a 00                	push   $0x0
+  pushl $170
+80109b21:	68 aa 00 00 00       	push   $0xaa
+  jmp alltraps
+80109b26:	e9 b3 f3 ff ff       	jmp    80108ede <alltraps>
+
+80109b2b <vector171>:
+.globl vector171
+vector171:
+  pushl $0
+80109b2b:	6a 00                	push   $0x0
+  pushl $171
+80109b2d:	68 ab 00 00 00       	push   $0xab
+  jmp alltraps
+80109b32:	e9 a7 f3 ff ff       	jmp    80108ede <alltraps>
+
+80109b37 <vector172>:
+.globl vector172
+vector172:
+  pushl $0
+80109b37:	6a 00                	push   $0x0
+  pushl $172
+80109b39:	68 ac 00 00 00       	push   $0xac
+  jmp alltraps
+80109b3e:	e9 9b f3 ff ff       	jmp    80108ede <alltraps>
+
+80109b43 <vector173>:
+.globl vector173
+vector173:
+  pushl $0
+80109b43:	6a 00                	push   $0x0
+  pushl $173
+80109b45:	68 ad 00 00 00       	push   $0xad
+  jmp alltraps
+80109b4a:	e9 8f f3 ff ff       	jmp    80108ede <alltraps>
+
+80109b4f <vector174>:
+.globl vector174
+vector174:
+  pushl $0
+80109b4f:	6a 00                	push   $0x0
+  pushl $174
+80109b51:	68 ae 00 00 00       	push   $0xae
+  jmp alltraps
+80109b56:	e9 83 f3 ff ff       	jmp    80108ede <alltraps>
+
+80109b5b <vector175>:
+.globl vector175
+vector175:
+  pushl $0
+80109b5b:	6a 00                	push   $0x0
+  pushl $175
+80109b5d:	68 af 00 00 00       	push   $0xaf
+  jmp alltraps
+80109b62:	e9 77 f3 ff ff       	jmp    80108ede <alltraps>
+
+80109b67 <vector176>:
+.globl vector176
+vector176:
+  pushl $0
+80109b67:	6a 00                	push   $0x0
+  pushl $176
+80109b69:	68 b0 00 00 00       	push   $0xb0
+  jmp alltraps
+80109b6e:	e9 6b f3 ff ff       	jmp    80108ede <alltraps>
+
+80109b73 <vector177>:
+.globl vector177
+vector177:
+  pushl $0
+80109b73:	6a 00                	push   $0x0
+  pushl $177
+80109b75:	68 b1 00 00 00       	push   $0xb1
+  jmp alltraps
+80109b7a:	e9 5f f3 ff ff       	jmp    80108ede <alltraps>
+
+80109b7f <vector178>:
+.globl vector178
+vector178:
+  pushl $0
+80109b7f:	6a 00                	push   $0x0
+  pushl $178
+80109b81:	68 b2 00 00 00       	push   $0xb2
+  jmp alltraps
+80109b86:	e9 53 f3 ff ff       	jmp    80108ede <alltraps>
+
+80109b8b <vector179>:
+.globl vector179
+vector179:
+  pushl $0
+80109b8b:	6a 00                	push   $0x0
+  pushl $179
+80109b8d:	68 b3 00 00 00       	push   $0xb3
+  jmp alltraps
+80109b92:	e9 47 f3 ff ff       	jmp    80108ede <alltraps>
+
+80109b97 <vector180>:
+.globl vector180
+vector180:
+  pushl $0
+80109b97:	6a 00                	push   $0x0
+  pushl $180
+80109b99:	68 b4 00 00 00       	push   $0xb4
+  jmp alltraps
+80109b9e:	e9 3b f3 ff ff       	jmp    80108ede <alltraps>
+
+80109ba3 <vector181>:
+.globl vector181
+vector181:
+  pushl $0
+80109ba3:	6a 00                	push   $0x0
+  pushl $181
+80109ba5:	68 b5 00 00 00       	push   $0xb5
+  jmp alltraps
+80109baa:	e9 2f f3 ff ff       	jmp    80108ede <alltraps>
+
+80109baf <vector182>:
+.globl vector182
+vector182:
+  pushl $0
+80109baf:	6a 00                	push   $0x0
+  pushl $182
+80109bb1:	68 b6 00 00 00       	push   $0xb6
+  jmp alltraps
+80109bb6:	e9 23 f3 ff ff       	jmp    80108ede <alltraps>
+
+80109bbb <vector183>:
+.globl vector183
+vector183:
+  pushl $0
+80109bbb:	6a 00                	push   $0x0
+  pushl $183
+80109bbd:	68 b7 00 00 00       	push   $0xb7
+  jmp alltraps
+80109bc2:	e9 17 f3 ff ff       	jmp    80108ede <alltraps>
+
+80109bc7 <vector184>:
+.globl vector184
+vector184:
+  pushl $0
+80109bc7:	6a 00                	push   $0x0
+  pushl $184
+80109bc9:	68 b8 00 00 00       	push   $0xb8
+  jmp alltraps
+80109bce:	e9 0b f3 ff ff       	jmp    80108ede <alltraps>
+
+80109bd3 <vector185>:
+.globl vector185
+vector185:
+  pushl $0
+80109bd3:	6a 00                	push   $0x0
+  pushl $185
+80109bd5:	68 b9 00 00 00       	push   $0xb9
+  jmp alltraps
+80109bda:	e9 ff f2 ff ff       	jmp    80108ede <alltraps>
+
+80109bdf <vector186>:
+.globl vector186
+vector186:
+  pushl $0
+80109bdf:	6a 00                	push   $0x0
+  pushl $186
+80109be1:	68 ba 00 00 00       	push   $0xba
+  jmp alltraps
+80109be6:	e9 f3 f2 ff ff       	jmp    80108ede <alltraps>
+
+80109beb <vector187>:
+.globl vector187
+vector187:
+  pushl $0
+80109beb:	6a 00                	push   $0x0
+  pushl $187
+80109bed:	68 bb 00 00 00       	push   $0xbb
+  jmp alltraps
+80109bf2:	e9 e7 f2 ff ff       	jmp    80108ede <alltraps>
+
+80109bf7 <vector188>:
+.globl vector188
+vector188:
+  pushl $0
+80109bf7:	6a 00                	push   $0x0
+  pushl $188
+80109bf9:	68 bc 00 00 00       	push   $0xbc
+  jmp alltraps
+80109bfe:	e9 db f2 ff ff       	jmp    80108ede <alltraps>
+
+80109c03 <vector189>:
+.globl vector189
+vector189:
+  pushl $0
+80109c03:	6a 00                	push   $0x0
+  pushl $189
+80109c05:	68 bd 00 00 00       	push   $0xbd
+  jmp alltraps
+80109c0a:	e9 cf f2 ff ff       	jmp    80108ede <alltraps>
+
+80109c0f <vector190>:
+.globl vector190
+vector190:
+  pushl $0
+80109c0f:	6a 00                	push   $0x0
+  pushl $190
+80109c11:	68 be 00 00 00       	push   $0xbe
+  jmp alltraps
+80109c16:	e9 c3 f2 ff ff       	jmp    80108ede <alltraps>
+
+80109c1b <vector191>:
+.globl vector191
+vector191:
+  pushl $0
+80109c1b:	6a 00                	push   $0x0
+  pushl $191
+80109c1d:	68 bf 00 00 00       	push   $0xbf
+  jmp alltraps
+80109c22:	e9 b7 f2 ff ff       	jmp    80108ede <alltraps>
+
+80109c27 <vector192>:
+.globl vector192
+vector192:
+  pushl $0
+80109c27:	6a 00                	push   $0x0
+  pushl $192
+80109c29:	68 c0 00 00 00       	push   $0xc0
+  jmp alltraps
+80109c2e:	e9 ab f2 ff ff       	jmp    80108ede <alltraps>
+
+80109c33 <vector193>:
+.globl vector193
+vector193:
+  pushl $0
+80109c33:	6a 00                	push   $0x0
+  pushl $193
+80109c35:	68 c1 00 00 00       	push   $0xc1
+  jmp alltraps
+80109c3a:	e9 9f f2 ff ff       	jmp    80108ede <alltraps>
+
+80109c3f <vector194>:
+.globl vector194
+vector194:
+  pushl $0
+80109c3f:	6a 00                	push   $0x0
+  pushl $194
+80109c41:	68 c2 00 00 00       	push   $0xc2
+  jmp alltraps
+80109c46:	e9 93 f2 ff ff       	jmp    80108ede <alltraps>
+
+80109c4b <vector195>:
+.globl vector195
+vector195:
+  pushl $0
+80109c4b:	6a 00                	push   $0x0
+  pushl $195
+80109c4d:	68 c3 00 00 00       	push   $0xc3
+  jmp alltraps
+80109c52:	e9 87 f2 ff ff       	jmp    80108ede <alltraps>
+
+80109c57 <vector196>:
+.globl vector196
+vector196:
+  pushl $0
+80109c57:	6a 00                	push   $0x0
+  pushl $196
+80109c59:	68 c4 00 00 00       	push   $0xc4
+  jmp alltraps
+80109c5e:	e9 7b f2 ff ff       	jmp    80108ede <alltraps>
+
+80109c63 <vector197>:
+.globl vector197
+vector197:
+  pushl $0
+80109c63:	6a 00                	push   $0x0
+  pushl $197
+80109c65:	68 c5 00 00 00       	push   $0xc5
+  jmp alltraps
+80109c6a:	e9 6f f2 ff ff       	jmp    80108ede <alltraps>
+
+80109c6f <vector198>:
+.globl vector198
+vector198:
+  pushl $0
+80109c6f:	6a 00                	push   $0x0
+  pushl $198
+80109c71:	68 c6 00 00 00       	push   $0xc6
+  jmp alltraps
+80109c76:	e9 63 f2 ff ff       	jmp    80108ede <alltraps>
+
+80109c7b <vector199>:
+.globl vector199
+vector199:
+  pushl $0
+80109c7b:	6a 00                	push   $0x0
+  pushl $199
+80109c7d:	68 c7 00 00 00       	push   $0xc7
+  jmp alltraps
+80109c82:	e9 57 f2 ff ff       	jmp    80108ede <alltraps>
+
+80109c87 <vector200>:
+.globl vector200
+vector200:
+  pushl $0
+80109c87:	6a 00                	push   $0x0
+  pushl $200
+80109c89:	68 c8 00 00 00       	push   $0xc8
+  jmp alltraps
+80109c8e:	e9 4b f2 ff ff       	jmp    80108ede <alltraps>
+
+80109c93 <vector201>:
+.globl vector201
+vector201:
+  pushl $0
+80109c93:	6a 00                	push   $0x0
+  pushl $201
+80109c95:	68 c9 00 00 00       	push   $0xc9
+  jmp alltraps
+80109c9a:	e9 3f f2 ff ff       	jmp    80108ede <alltraps>
+
+80109c9f <vector202>:
+.globl vector202
+vector202:
+  pushl $0
+80109c9f:	6a 00                	push   $0x0
+  pushl $202
+80109ca1:	68 ca 00 00 00       	push   $0xca
+  jmp alltraps
+80109ca6:	e9 33 f2 ff ff       	jmp    80108ede <alltraps>
+
+80109cab <vector203>:
+.globl vector203
+vector203:
+  pushl $0
+80109cab:	6a 00                	push   $0x0
+  pushl $203
+80109cad:	68 cb 00 00 00       	push   $0xcb
+  jmp alltraps
+80109cb2:	e9 27 f2 ff ff       	jmp    80108ede <alltraps>
+
+80109cb7 <vector204>:
+.globl vector204
+vector204:
+  pushl $0
+80109cb7:	6a 00                	push   $0x0
+  pushl $204
+80109cb9:	68 cc 00 00 00       	push   $0xcc
+  jmp alltraps
+80109cbe:	e9 1b f2 ff ff       	jmp    80108ede <alltraps>
+
+80109cc3 <vector205>:
+.globl vector205
+vector205:
+  pushl $0
+80109cc3:	6a 00                	push   $0x0
+  pushl $205
+80109cc5:	68 cd 00 00 00       	push   $0xcd
+  jmp alltraps
+80109cca:	e9 0f f2 ff ff       	jmp    80108ede <alltraps>
+
+80109ccf <vector206>:
+.globl vector206
+vector206:
+  pushl $0
+80109ccf:	6a 00                	push   $0x0
+  pushl $206
+80109cd1:	68 ce 00 00 00       	push   $0xce
+  jmp alltraps
+80109cd6:	e9 03 f2 ff ff       	jmp    80108ede <alltraps>
+
+80109cdb <vector207>:
+.globl vector207
+vector207:
+  pushl $0
+80109cdb:	6a 00                	push   $0x0
+  pushl $207
+80109cdd:	68 cf 00 00 00       	push   $0xcf
+  jmp alltraps
+80109ce2:	e9 f7 f1 ff ff       	jmp    80108ede <alltraps>
+
+80109ce7 <vector208>:
+.globl vector208
+vector208:
+  pushl $0
+80109ce7:	6a 00                	push   $0x0
+  pushl $208
+80109ce9:	68 d0 00 00 00       	push   $0xd0
+  jmp alltraps
+80109cee:	e9 eb f1 ff ff       	jmp    80108ede <alltraps>
+
+80109cf3 <vector209>:
+.globl vector209
+vector209:
+  pushl $0
+80109cf3:	6a 00                	push   $0x0
+  pushl $209
+80109cf5:	68 d1 00 00 00       	push   $0xd1
+  jmp alltraps
+80109cfa:	e9 df f1 ff ff       	jmp    80108ede <alltraps>
+
+80109cff <vector210>:
+.globl vector210
+vector210:
+  pushl $0
+80109cff:	6a 00                	push   $0x0
+  pushl $210
+80109d01:	68 d2 00 00 00       	push   $0xd2
+  jmp alltraps
+80109d06:	e9 d3 f1 ff ff       	jmp    80108ede <alltraps>
+
+80109d0b <vector211>:
+.globl vector211
+vector211:
+  pushl $0
+80109d0b:	6a 00                	push   $0x0
+  pushl $211
+80109d0d:	68 d3 00 00 00       	push   $0xd3
+  jmp alltraps
+80109d12:	e9 c7 f1 ff ff       	jmp    80108ede <alltraps>
+
+80109d17 <vector212>:
+.globl vector212
+vector212:
+  pushl $0
+80109d17:	6a 00                	push   $0x0
+  pushl $212
+80109d19:	68 d4 00 00 00       	push   $0xd4
+  jmp alltraps
+80109d1e:	e9 bb f1 ff ff       	jmp    80108ede <alltraps>
+
+80109d23 <vector213>:
+.globl vector213
+vector213:
+  pushl $0
+80109d23:	6a 00                	push   $0x0
+  pushl $213
+80109d25:	68 d5 00 00 00       	push   $0xd5
+  jmp alltraps
+80109d2a:	e9 af f1 ff ff       	jmp    80108ede <alltraps>
+
+80109d2f <vector214>:
+.globl vector214
+vector214:
+  pushl $0
+80109d2f:	6a 00                	push   $0x0
+  pushl $214
+80109d31:	68 d6 00 00 00       	push   $0xd6
+  jmp alltraps
+80109d36:	e9 a3 f1 ff ff       	jmp    80108ede <alltraps>
+
+80109d3b <vector215>:
+.globl vector215
+vector215:
+  pushl $0
+80109d3b:	6a 00                	push   $0x0
+  pushl $215
+80109d3d:	68 d7 00 00 00       	push   $0xd7
+  jmp alltraps
+80109d42:	e9 97 f1 ff ff       	jmp    80108ede <alltraps>
+
+80109d47 <vector216>:
+.globl vector216
+vector216:
+  pushl $0
+80109d47:	6a 00                	push   $0x0
+  pushl $216
+80109d49:	68 d8 00 00 00       	push   $0xd8
+  jmp alltraps
+80109d4e:	e9 8b f1 ff ff       	jmp    80108ede <alltraps>
+
+80109d53 <vector217>:
+.globl vector217
+vector217:
+  pushl $0
+80109d53:	6a 00                	push   $0x0
+  pushl $217
+80109d55:	68 d9 00 00 00       	push   $0xd9
+  jmp alltraps
+80109d5a:	e9 7f f1 ff ff       	jmp    80108ede <alltraps>
+
+80109d5f <vector218>:
+.globl vector218
+vector218:
+  pushl $0
+80109d5f:	6a 00                	push   $0x0
+  pushl $218
+80109d61:	68 da 00 00 00       	push   $0xda
+  jmp alltraps
+80109d66:	e9 73 f1 ff ff       	jmp    80108ede <alltraps>
+
+80109d6b <vector219>:
+.globl vector219
+vector219:
+  pushl $0
+80109d6b:	6a 00                	push   $0x0
+  pushl $219
+80109d6d:	68 db 00 00 00       	push   $0xdb
+  jmp alltraps
+80109d72:	e9 67 f1 ff ff       	jmp    80108ede <alltraps>
+
+80109d77 <vector220>:
+.globl vector220
+vector220:
+  pushl $0
+80109d77:	6a 00                	push   $0x0
+  pushl $220
+80109d79:	68 dc 00 00 00       	push   $0xdc
+  jmp alltraps
+80109d7e:	e9 5b f1 ff ff       	jmp    80108ede <alltraps>
+
+80109d83 <vector221>:
+.globl vector221
+vector221:
+  pushl $0
+80109d83:	6a 00                	push   $0x0
+  pushl $221
+80109d85:	68 dd 00 00 00       	push   $0xdd
+  jmp alltraps
+80109d8a:	e9 4f f1 ff ff       	jmp    80108ede <alltraps>
+
+80109d8f <vector222>:
+.globl vector222
+vector222:
+  pushl $0
+80109d8f:	6a 00                	push   $0x0
+  pushl $222
+80109d91:	68 de 00 00 00       	push   $0xde
+  jmp alltraps
+80109d96:	e9 43 f1 ff ff       	jmp    80108ede <alltraps>
+
+80109d9b <vector223>:
+.globl vector223
+vector223:
+  pushl $0
+80109d9b:	6a 00                	push   $0x0
+  pushl $223
+80109d9d:	68 df 00 00 00       	push   $0xdf
+  jmp alltraps
+80109da2:	e9 37 f1 ff ff       	jmp    80108ede <alltraps>
+
+80109da7 <vector224>:
+.globl vector224
+vector224:
+  pushl $0
+80109da7:	6a 00                	push   $0x0
+  pushl $224
+80109da9:	68 e0 00 00 00       	push   $0xe0
+  jmp alltraps
+80109dae:	e9 2b f1 ff ff       	jmp    80108ede <alltraps>
+
+80109db3 <vector225>:
+.globl vector225
+vector225:
+  pushl $0
+80109db3:	6a 00                	push   $0x0
+  pushl $225
+80109db5:	68 e1 00 00 00       	push   $0xe1
+  jmp alltraps
+80109dba:	e9 1f f1 ff ff       	jmp    80108ede <alltraps>
+
+80109dbf <vector226>:
+.globl vector226
+vector226:
+  pushl $0
+80109dbf:	6a 00                	push   $0x0
+  pushl $226
+80109dc1:	68 e2 00 00 00       	push   $0xe2
+  jmp alltraps
+80109dc6:	e9 13 f1 ff ff       	jmp    80108ede <alltraps>
+
+80109dcb <vector227>:
+.globl vector227
+vector227:
+  pushl $0
+80109dcb:	6a 00                	push   $0x0
+  pushl $227
+80109dcd:	68 e3 00 00 00       	push   $0xe3
+  jmp alltraps
+80109dd2:	e9 07 f1 ff ff       	jmp    80108ede <alltraps>
+
+80109dd7 <vector228>:
+.globl vector228
+vector228:
+  pushl $0
+80109dd7:	6a 00                	push   $0x0
+  pushl $228
+80109dd9:	68 e4 00 00 00       	push   $0xe4
+  jmp alltraps
+80109dde:	e9 fb f0 ff ff       	jmp    80108ede <alltraps>
+
+80109de3 <vector229>:
+.globl vector229
+vector229:
+  pushl $0
+80109de3:	6a 00                	push   $0x0
+  pushl $229
+80109de5:	68 e5 00 00 00       	push   $0xe5
+  jmp alltraps
+80109dea:	e9 ef f0 ff ff       	jmp    80108ede <alltraps>
+
+80109def <vector230>:
+.globl vector230
+vector230:
+  pushl $0
+80109def:	6a 00                	push   $0x0
+  pushl $230
+80109df1:	68 e6 00 00 00       	push   $0xe6
+  jmp alltraps
+80109df6:	e9 e3 f0 ff ff       	jmp    80108ede <alltraps>
+
+80109dfb <vector231>:
+.globl vector231
+vector231:
+  pushl $0
+80109dfb:	6a 00                	push   $0x0
+  pushl $231
+80109dfd:	68 e7 00 00 00       	push   $0xe7
+  jmp alltraps
+80109e02:	e9 d7 f0 ff ff       	jmp    80108ede <alltraps>
+
+80109e07 <vector232>:
+.globl vector232
+vector232:
+  pushl $0
+80109e07:	6a 00                	push   $0x0
+  pushl $232
+80109e09:	68 e8 00 00 00       	push   $0xe8
+  jmp alltraps
+80109e0e:	e9 cb f0 ff ff       	jmp    80108ede <alltraps>
+
+80109e13 <vector233>:
+.globl vector233
+vector233:
+  pushl $0
+80109e13:	6a 00                	push   $0x0
+  pushl $233
+80109e15:	68 e9 00 00 00       	push   $0xe9
+  jmp alltraps
+80109e1a:	e9 bf f0 ff ff       	jmp    80108ede <alltraps>
+
+80109e1f <vector234>:
+.globl vector234
+vector234:
+  pushl $0
+80109e1f:	6a 00                	push   $0x0
+  pushl $234
+80109e21:	68 ea 00 00 00       	push   $0xea
+  jmp alltraps
+80109e26:	e9 b3 f0 ff ff       	jmp    80108ede <alltraps>
+
+80109e2b <vector235>:
+.globl vector235
+vector235:
+  pushl $0
+80109e2b:	6a 00                	push   $0x0
+  pushl $235
+80109e2d:	68 eb 00 00 00       	push   $0xeb
+  jmp alltraps
+80109e32:	e9 a7 f0 ff ff       	jmp    80108ede <alltraps>
+
+80109e37 <vector236>:
+.globl vector236
+vector236:
+  pushl $0
+80109e37:	6a 00                	push   $0x0
+  pushl $236
+80109e39:	68 ec 00 00 00       	push   $0xec
+  jmp alltraps
+80109e3e:	e9 9b f0 ff ff       	jmp    80108ede <alltraps>
+
+80109e43 <vector237>:
+.globl vector237
+vector237:
+  pushl $0
+80109e43:	6a 00                	push   $0x0
+  pushl $237
+80109e45:	68 ed 00 00 00       	push   $0xed
+  jmp alltraps
+80109e4a:	e9 8f f0 ff ff       	jmp    80108ede <alltraps>
+
+80109e4f <vector238>:
+.globl vector238
+vector238:
+  pushl $0
+80109e4f:	6a 00                	push   $0x0
+  pushl $238
+80109e51:	68 ee 00 00 00       	push   $0xee
+  jmp alltraps
+80109e56:	e9 83 f0 ff ff       	jmp    80108ede <alltraps>
+
+80109e5b <vector239>:
+.globl vector239
+vector239:
+  pushl $0
+80109e5b:	6a 00                	push   $0x0
+  pushl $239
+80109e5d:	68 ef 00 00 00       	push   $0xef
+  jmp alltraps
+80109e62:	e9 77 f0 ff ff       	jmp    80108ede <alltraps>
+
+80109e67 <vector240>:
+.globl vector240
+vector240:
+  pushl $0
+80109e67:	6a 00                	push   $0x0
+  pushl $240
+80109e69:	68 f0 00 00 00       	push   $0xf0
+  jmp alltraps
+80109e6e:	e9 6b f0 ff ff       	jmp    80108ede <alltraps>
+
+80109e73 <vector241>:
+.globl vector241
+vector241:
+  pushl $0
+80109e73:	6a 00                	push   $0x0
+  pushl $241
+80109e75:	68 f1 00 00 00       	push   $0xf1
+  jmp alltraps
+80109e7a:	e9 5f f0 ff ff       	jmp    80108ede <alltraps>
+
+80109e7f <vector242>:
+.globl vector242
+vector242:
+  pushl $0
+80109e7f:	6a 00                	push   $0x0
+  pushl $242
+80109e81:	68 f2 00 00 00       	push   $0xf2
+  jmp alltraps
+80109e86:	e9 53 f0 ff ff       	jmp    80108ede <alltraps>
+
+80109e8b <vector243>:
+.globl vector243
+vector243:
+  pushl $0
+80109e8b:	6a 00                	push   $0x0
+  pushl $243
+80109e8d:	68 f3 00 00 00       	push   $0xf3
+  jmp alltraps
+80109e92:	e9 47 f0 ff ff       	jmp    80108ede <alltraps>
+
+80109e97 <vector244>:
+.globl vector244
+vector244:
+  pushl $0
+80109e97:	6a 00                	push   $0x0
+  pushl $244
+80109e99:	68 f4 00 00 00       	push   $0xf4
+  jmp alltraps
+80109e9e:	e9 3b f0 ff ff       	jmp    80108ede <alltraps>
+
+80109ea3 <vector245>:
+.globl vector245
+vector245:
+  pushl $0
+80109ea3:	6a 00                	push   $0x0
+  pushl $245
+80109ea5:	68 f5 00 00 00       	push   $0xf5
+  jmp alltraps
+80109eaa:	e9 2f f0 ff ff       	jmp    80108ede <alltraps>
+
+80109eaf <vector246>:
+.globl vector246
+vector246:
+  pushl $0
+80109eaf:	6a 00                	push   $0x0
+  pushl $246
+80109eb1:	68 f6 00 00 00       	push   $0xf6
+  jmp alltraps
+80109eb6:	e9 23 f0 ff ff       	jmp    80108ede <alltraps>
+
+80109ebb <vector247>:
+.globl vector247
+vector247:
+  pushl $0
+80109ebb:	6a 00                	push   $0x0
+  pushl $247
+80109ebd:	68 f7 00 00 00       	push   $0xf7
+  jmp alltraps
+80109ec2:	e9 17 f0 ff ff       	jmp    80108ede <alltraps>
+
+80109ec7 <vector248>:
+.globl vector248
+vector248:
+  pushl $0
+80109ec7:	6a 00                	push   $0x0
+  pushl $248
+80109ec9:	68 f8 00 00 00       	push   $0xf8
+  jmp alltraps
+80109ece:	e9 0b f0 ff ff       	jmp    80108ede <alltraps>
+
+80109ed3 <vector249>:
+.globl vector249
+vector249:
+  pushl $0
+80109ed3:	6a 00                	push   $0x0
+  pushl $249
+80109ed5:	68 f9 00 00 00       	push   $0xf9
+  jmp alltraps
+80109eda:	e9 ff ef ff ff       	jmp    80108ede <alltraps>
+
+80109edf <vector250>:
+.globl vector250
+vector250:
+  pushl $0
+80109edf:	6a 00                	push   $0x0
+  pushl $250
+80109ee1:	68 fa 00 00 00       	push   $0xfa
+  jmp alltraps
+80109ee6:	e9 f3 ef ff ff       	jmp    80108ede <alltraps>
+
+80109eeb <vector251>:
+.globl vector251
+vector251:
+  pushl $0
+80109eeb:	6a 00                	push   $0x0
+  pushl $251
+80109eed:	68 fb 00 00 00       	push   $0xfb
+  jmp alltraps
+80109ef2:	e9 e7 ef ff ff       	jmp    80108ede <alltraps>
+
+80109ef7 <vector252>:
+.globl vector252
+vector252:
+  pushl $0
+80109ef7:	6a 00                	push   $0x0
+  pushl $252
+80109ef9:	68 fc 00 00 00       	push   $0xfc
+  jmp alltraps
+80109efe:	e9 db ef ff ff       	jmp    80108ede <alltraps>
+
+80109f03 <vector253>:
+.globl vector253
+vector253:
+  pushl $0
+80109f03:	6a 00                	push   $0x0
+  pushl $253
+80109f05:	68 fd 00 00 00       	push   $0xfd
+  jmp alltraps
+80109f0a:	e9 cf ef ff ff       	jmp    80108ede <alltraps>
+
+80109f0f <vector254>:
+.globl vector254
+vector254:
+  pushl $0
+80109f0f:	6a 00                	push   $0x0
+  pushl $254
+80109f11:	68 fe 00 00 00       	push   $0xfe
+  jmp alltraps
+80109f16:	e9 c3 ef ff ff       	jmp    80108ede <alltraps>
+
+80109f1b <vector255>:
+.globl vector255
+vector255:
+  pushl $0
+80109f1b:	6a 00                	push   $0x0
+  pushl $255
+80109f1d:	68 ff 00 00 00       	push   $0xff
+  jmp alltraps
+80109f22:	e9 b7 ef ff ff       	jmp    80108ede <alltraps>
+80109f27:	66 90                	xchg   %ax,%ax
+80109f29:	66 90                	xchg   %ax,%ax
+80109f2b:	66 90                	xchg   %ax,%ax
+80109f2d:	66 90                	xchg   %ax,%ax
+80109f2f:	90                   	nop
+
+80109f30 <deallocuvm.part.0>:
+// Deallocate user pages to bring the process size from oldsz to
+// newsz.  oldsz and newsz need not be page-aligned, nor does newsz
+// need to be less than oldsz.  oldsz can be larger than the actual
+// process size.  Returns the new process size.
+int
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+80109f30:	55                   	push   %ebp
+80109f31:	89 e5                	mov    %esp,%ebp
+80109f33:	57                   	push   %edi
+80109f34:	56                   	push   %esi
+80109f35:	53                   	push   %ebx
+  uint a, pa;
+
+  if(newsz >= oldsz)
+    return oldsz;
+
+  a = PGROUNDUP(newsz);
+80109f36:	8d 99 ff 0f 00 00    	lea    0xfff(%ecx),%ebx
+80109f3c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
+80109f42:	83 ec 1c             	sub    $0x1c,%esp
+  for(; a  < oldsz; a += PGSIZE){
+80109f45:	39 d3                	cmp    %edx,%ebx
+80109f47:	73 56                	jae    80109f9f <deallocuvm.part.0+0x6f>
+80109f49:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+80109f4c:	89 c6                	mov    %eax,%esi
+80109f4e:	89 d7                	mov    %edx,%edi
+80109f50:	eb 12                	jmp    80109f64 <deallocuvm.part.0+0x34>
+80109f52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+80109f58:	83 c2 01             	add    $0x1,%edx
+80109f5b:	89 d3                	mov    %edx,%ebx
+80109f5d:	c1 e3 16             	shl    $0x16,%ebx
+  for(; a  < oldsz; a += PGSIZE){
+80109f60:	39 fb                	cmp    %edi,%ebx
+80109f62:	73 38                	jae    80109f9c <deallocuvm.part.0+0x6c>
+  pde = &pgdir[PDX(va)];
+80109f64:	89 da                	mov    %ebx,%edx
+80109f66:	c1 ea 16             	shr    $0x16,%edx
+  if(*pde & PTE_P){
+80109f69:	8b 04 96             	mov    (%esi,%edx,4),%eax
+80109f6c:	a8 01                	test   $0x1,%al
+80109f6e:	74 e8                	je     80109f58 <deallocuvm.part.0+0x28>
+  return &pgtab[PTX(va)];
+80109f70:	89 d9                	mov    %ebx,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+80109f72:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+80109f77:	c1 e9 0a             	shr    $0xa,%ecx
+80109f7a:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+80109f80:	8d 84 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%eax
+    if(!pte)
+80109f87:	85 c0                	test   %eax,%eax
+80109f89:	74 cd                	je     80109f58 <deallocuvm.part.0+0x28>
+    else if((*pte & PTE_P) != 0){
+80109f8b:	8b 10                	mov    (%eax),%edx
+80109f8d:	f6 c2 01             	test   $0x1,%dl
+80109f90:	75 1e                	jne    80109fb0 <deallocuvm.part.0+0x80>
+  for(; a  < oldsz; a += PGSIZE){
+80109f92:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+80109f98:	39 fb                	cmp    %edi,%ebx
+80109f9a:	72 c8                	jb     80109f64 <deallocuvm.part.0+0x34>
+80109f9c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      kfree(v);
+      *pte = 0;
+    }
+  }
+  return newsz;
+}
+80109f9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+80109fa2:	89 c8                	mov    %ecx,%eax
+80109fa4:	5b                   	pop    %ebx
+80109fa5:	5e                   	pop    %esi
+80109fa6:	5f                   	pop    %edi
+80109fa7:	5d                   	pop    %ebp
+80109fa8:	c3                   	ret
+80109fa9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      if(pa == 0)
+80109fb0:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+80109fb6:	74 26                	je     80109fde <deallocuvm.part.0+0xae>
+      kfree(v);
+80109fb8:	83 ec 0c             	sub    $0xc,%esp
+      char *v = P2V(pa);
+80109fbb:	81 c2 00 00 00 80    	add    $0x80000000,%edx
+80109fc1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(; a  < oldsz; a += PGSIZE){
+80109fc4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+      kfree(v);
+80109fca:	52                   	push   %edx
+80109fcb:	e8 50 97 ff ff       	call   80103720 <kfree>
+      *pte = 0;
+80109fd0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for(; a  < oldsz; a += PGSIZE){
+80109fd3:	83 c4 10             	add    $0x10,%esp
+      *pte = 0;
+80109fd6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+80109fdc:	eb 82                	jmp    80109f60 <deallocuvm.part.0+0x30>
+        panic("kfree");
+80109fde:	83 ec 0c             	sub    $0xc,%esp
+80109fe1:	68 6e b1 10 80       	push   $0x8010b16e
+80109fe6:	e8 95 68 ff ff       	call   80100880 <panic>
+80109feb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+80109fef:	90                   	nop
+
+80109ff0 <mappages>:
+{
+80109ff0:	55                   	push   %ebp
+80109ff1:	89 e5                	mov    %esp,%ebp
+80109ff3:	57                   	push   %edi
+80109ff4:	56                   	push   %esi
+80109ff5:	53                   	push   %ebx
+  a = (char*)PGROUNDDOWN((uint)va);
+80109ff6:	89 d3                	mov    %edx,%ebx
+80109ff8:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+{
+80109ffe:	83 ec 1c             	sub    $0x1c,%esp
+8010a001:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  last = (char*)PGROUNDDOWN(((uint)va) + size - 1);
+8010a004:	8d 44 0a ff          	lea    -0x1(%edx,%ecx,1),%eax
+8010a008:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010a00d:	89 45 dc             	mov    %eax,-0x24(%ebp)
+8010a010:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a013:	29 d8                	sub    %ebx,%eax
+8010a015:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010a018:	eb 3f                	jmp    8010a059 <mappages+0x69>
+8010a01a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010a020:	89 da                	mov    %ebx,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010a022:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010a027:	c1 ea 0a             	shr    $0xa,%edx
+8010a02a:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010a030:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+    if((pte = walkpgdir(pgdir, a, 1)) == 0)
+8010a037:	85 c0                	test   %eax,%eax
+8010a039:	74 75                	je     8010a0b0 <mappages+0xc0>
+    if(*pte & PTE_P)
+8010a03b:	f6 00 01             	testb  $0x1,(%eax)
+8010a03e:	0f 85 86 00 00 00    	jne    8010a0ca <mappages+0xda>
+    *pte = pa | perm | PTE_P;
+8010a044:	0b 75 0c             	or     0xc(%ebp),%esi
+8010a047:	83 ce 01             	or     $0x1,%esi
+8010a04a:	89 30                	mov    %esi,(%eax)
+    if(a == last)
+8010a04c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+8010a04f:	39 c3                	cmp    %eax,%ebx
+8010a051:	74 6d                	je     8010a0c0 <mappages+0xd0>
+    a += PGSIZE;
+8010a053:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  for(;;){
+8010a059:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+8010a05c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010a05f:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+8010a062:	89 d8                	mov    %ebx,%eax
+8010a064:	c1 e8 16             	shr    $0x16,%eax
+8010a067:	8d 3c 81             	lea    (%ecx,%eax,4),%edi
+  if(*pde & PTE_P){
+8010a06a:	8b 07                	mov    (%edi),%eax
+8010a06c:	a8 01                	test   $0x1,%al
+8010a06e:	75 b0                	jne    8010a020 <mappages+0x30>
+    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+8010a070:	e8 6b 99 ff ff       	call   801039e0 <kalloc>
+8010a075:	85 c0                	test   %eax,%eax
+8010a077:	74 37                	je     8010a0b0 <mappages+0xc0>
+    memset(pgtab, 0, PGSIZE);
+8010a079:	83 ec 04             	sub    $0x4,%esp
+8010a07c:	68 00 10 00 00       	push   $0x1000
+8010a081:	6a 00                	push   $0x0
+8010a083:	50                   	push   %eax
+8010a084:	89 45 d8             	mov    %eax,-0x28(%ebp)
+8010a087:	e8 a4 d5 ff ff       	call   80107630 <memset>
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010a08c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  return &pgtab[PTX(va)];
+8010a08f:	83 c4 10             	add    $0x10,%esp
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010a092:	8d 82 00 00 00 80    	lea    -0x80000000(%edx),%eax
+8010a098:	83 c8 07             	or     $0x7,%eax
+8010a09b:	89 07                	mov    %eax,(%edi)
+  return &pgtab[PTX(va)];
+8010a09d:	89 d8                	mov    %ebx,%eax
+8010a09f:	c1 e8 0a             	shr    $0xa,%eax
+8010a0a2:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010a0a7:	01 d0                	add    %edx,%eax
+8010a0a9:	eb 90                	jmp    8010a03b <mappages+0x4b>
+8010a0ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010a0af:	90                   	nop
+}
+8010a0b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010a0b3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010a0b8:	5b                   	pop    %ebx
+8010a0b9:	5e                   	pop    %esi
+8010a0ba:	5f                   	pop    %edi
+8010a0bb:	5d                   	pop    %ebp
+8010a0bc:	c3                   	ret
+8010a0bd:	8d 76 00             	lea    0x0(%esi),%esi
+8010a0c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010a0c3:	31 c0                	xor    %eax,%eax
+}
+8010a0c5:	5b                   	pop    %ebx
+8010a0c6:	5e                   	pop    %esi
+8010a0c7:	5f                   	pop    %edi
+8010a0c8:	5d                   	pop    %ebp
+8010a0c9:	c3                   	ret
+      panic("remap");
+8010a0ca:	83 ec 0c             	sub    $0xc,%esp
+8010a0cd:	68 64 b8 10 80       	push   $0x8010b864
+8010a0d2:	e8 a9 67 ff ff       	call   80100880 <panic>
+8010a0d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a0de:	66 90                	xchg   %ax,%ax
+
+8010a0e0 <seginit>:
+{
+8010a0e0:	55                   	push   %ebp
+8010a0e1:	89 e5                	mov    %esp,%ebp
+8010a0e3:	83 ec 18             	sub    $0x18,%esp
+  c = &cpus[cpuid()];
+8010a0e6:	e8 15 ba ff ff       	call   80105b00 <cpuid>
+  pd[0] = size-1;
+8010a0eb:	ba 2f 00 00 00       	mov    $0x2f,%edx
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+8010a0f0:	69 c0 b4 00 00 00    	imul   $0xb4,%eax,%eax
+8010a0f6:	c7 80 98 cf 90 80 ff 	movl   $0xffff,-0x7f6f3068(%eax)
+8010a0fd:	ff 00 00 
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+8010a100:	c7 80 a0 cf 90 80 ff 	movl   $0xffff,-0x7f6f3060(%eax)
+8010a107:	ff 00 00 
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+8010a10a:	c7 80 a8 cf 90 80 ff 	movl   $0xffff,-0x7f6f3058(%eax)
+8010a111:	ff 00 00 
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+8010a114:	c7 80 b0 cf 90 80 ff 	movl   $0xffff,-0x7f6f3050(%eax)
+8010a11b:	ff 00 00 
+  c->gdt[SEG_KCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, 0);
+8010a11e:	c7 80 9c cf 90 80 00 	movl   $0xcf9a00,-0x7f6f3064(%eax)
+8010a125:	9a cf 00 
+  c->gdt[SEG_KDATA] = SEG(STA_W, 0, 0xffffffff, 0);
+8010a128:	c7 80 a4 cf 90 80 00 	movl   $0xcf9200,-0x7f6f305c(%eax)
+8010a12f:	92 cf 00 
+  c->gdt[SEG_UCODE] = SEG(STA_X|STA_R, 0, 0xffffffff, DPL_USER);
+8010a132:	c7 80 ac cf 90 80 00 	movl   $0xcffa00,-0x7f6f3054(%eax)
+8010a139:	fa cf 00 
+  c->gdt[SEG_UDATA] = SEG(STA_W, 0, 0xffffffff, DPL_USER);
+8010a13c:	c7 80 b4 cf 90 80 00 	movl   $0xcff200,-0x7f6f304c(%eax)
+8010a143:	f2 cf 00 
+  lgdt(c->gdt, sizeof(c->gdt));
+8010a146:	05 90 cf 90 80       	add    $0x8090cf90,%eax
+8010a14b:	66 89 55 f2          	mov    %dx,-0xe(%ebp)
+  pd[1] = (uint)p;
+8010a14f:	66 89 45 f4          	mov    %ax,-0xc(%ebp)
+  pd[2] = (uint)p >> 16;
+8010a153:	c1 e8 10             	shr    $0x10,%eax
+8010a156:	66 89 45 f6          	mov    %ax,-0xa(%ebp)
+  asm volatile("lgdt (%0)" : : "r" (pd));
+8010a15a:	8d 45 f2             	lea    -0xe(%ebp),%eax
+8010a15d:	0f 01 10             	lgdtl  (%eax)
+}
+8010a160:	c9                   	leave
+8010a161:	c3                   	ret
+8010a162:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+8010a170 <switchkvm>:
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+8010a170:	a1 04 2b 91 80       	mov    0x80912b04,%eax
+8010a175:	05 00 00 00 80       	add    $0x80000000,%eax
+}
+
+static inline void
+lcr3(uint val)
+{
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010a17a:	0f 22 d8             	mov    %eax,%cr3
+}
+8010a17d:	c3                   	ret
+8010a17e:	66 90                	xchg   %ax,%ax
+
+8010a180 <switchuvm>:
+{
+8010a180:	55                   	push   %ebp
+8010a181:	89 e5                	mov    %esp,%ebp
+8010a183:	57                   	push   %edi
+8010a184:	56                   	push   %esi
+8010a185:	53                   	push   %ebx
+8010a186:	83 ec 1c             	sub    $0x1c,%esp
+8010a189:	8b 75 08             	mov    0x8(%ebp),%esi
+  if(p == 0)
+8010a18c:	85 f6                	test   %esi,%esi
+8010a18e:	0f 84 cb 00 00 00    	je     8010a25f <switchuvm+0xdf>
+  if(p->kstack == 0)
+8010a194:	8b 46 08             	mov    0x8(%esi),%eax
+8010a197:	85 c0                	test   %eax,%eax
+8010a199:	0f 84 da 00 00 00    	je     8010a279 <switchuvm+0xf9>
+  if(p->pgdir == 0)
+8010a19f:	8b 46 04             	mov    0x4(%esi),%eax
+8010a1a2:	85 c0                	test   %eax,%eax
+8010a1a4:	0f 84 c2 00 00 00    	je     8010a26c <switchuvm+0xec>
+  pushcli();
+8010a1aa:	e8 51 d2 ff ff       	call   80107400 <pushcli>
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
+8010a1af:	e8 ec b8 ff ff       	call   80105aa0 <mycpu>
+8010a1b4:	89 c3                	mov    %eax,%ebx
+8010a1b6:	e8 e5 b8 ff ff       	call   80105aa0 <mycpu>
+8010a1bb:	89 c7                	mov    %eax,%edi
+8010a1bd:	e8 de b8 ff ff       	call   80105aa0 <mycpu>
+8010a1c2:	83 c7 08             	add    $0x8,%edi
+8010a1c5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010a1c8:	e8 d3 b8 ff ff       	call   80105aa0 <mycpu>
+8010a1cd:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+8010a1d0:	ba 67 00 00 00       	mov    $0x67,%edx
+8010a1d5:	66 89 bb 9a 00 00 00 	mov    %di,0x9a(%ebx)
+8010a1dc:	83 c0 08             	add    $0x8,%eax
+8010a1df:	66 89 93 98 00 00 00 	mov    %dx,0x98(%ebx)
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+8010a1e6:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+  mycpu()->gdt[SEG_TSS] = SEG16(STS_T32A, &mycpu()->ts,
+8010a1eb:	83 c1 08             	add    $0x8,%ecx
+8010a1ee:	c1 e8 18             	shr    $0x18,%eax
+8010a1f1:	c1 e9 10             	shr    $0x10,%ecx
+8010a1f4:	88 83 9f 00 00 00    	mov    %al,0x9f(%ebx)
+8010a1fa:	88 8b 9c 00 00 00    	mov    %cl,0x9c(%ebx)
+8010a200:	b9 99 40 00 00       	mov    $0x4099,%ecx
+8010a205:	66 89 8b 9d 00 00 00 	mov    %cx,0x9d(%ebx)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+8010a20c:	bb 10 00 00 00       	mov    $0x10,%ebx
+  mycpu()->gdt[SEG_TSS].s = 0;
+8010a211:	e8 8a b8 ff ff       	call   80105aa0 <mycpu>
+8010a216:	80 a0 9d 00 00 00 ef 	andb   $0xef,0x9d(%eax)
+  mycpu()->ts.ss0 = SEG_KDATA << 3;
+8010a21d:	e8 7e b8 ff ff       	call   80105aa0 <mycpu>
+8010a222:	66 89 58 10          	mov    %bx,0x10(%eax)
+  mycpu()->ts.esp0 = (uint)p->kstack + KSTACKSIZE;
+8010a226:	8b 5e 08             	mov    0x8(%esi),%ebx
+8010a229:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010a22f:	e8 6c b8 ff ff       	call   80105aa0 <mycpu>
+8010a234:	89 58 0c             	mov    %ebx,0xc(%eax)
+  mycpu()->ts.iomb = (ushort) 0xFFFF;
+8010a237:	e8 64 b8 ff ff       	call   80105aa0 <mycpu>
+8010a23c:	66 89 78 6e          	mov    %di,0x6e(%eax)
+  asm volatile("ltr %0" : : "r" (sel));
+8010a240:	b8 28 00 00 00       	mov    $0x28,%eax
+8010a245:	0f 00 d8             	ltr    %ax
+  lcr3(V2P(p->pgdir));  // switch to process's address space
+8010a248:	8b 46 04             	mov    0x4(%esi),%eax
+8010a24b:	05 00 00 00 80       	add    $0x80000000,%eax
+  asm volatile("movl %0,%%cr3" : : "r" (val));
+8010a250:	0f 22 d8             	mov    %eax,%cr3
+}
+8010a253:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a256:	5b                   	pop    %ebx
+8010a257:	5e                   	pop    %esi
+8010a258:	5f                   	pop    %edi
+8010a259:	5d                   	pop    %ebp
+  popcli();
+8010a25a:	e9 f1 d1 ff ff       	jmp    80107450 <popcli>
+    panic("switchuvm: no process");
+8010a25f:	83 ec 0c             	sub    $0xc,%esp
+8010a262:	68 6a b8 10 80       	push   $0x8010b86a
+8010a267:	e8 14 66 ff ff       	call   80100880 <panic>
+    panic("switchuvm: no pgdir");
+8010a26c:	83 ec 0c             	sub    $0xc,%esp
+8010a26f:	68 95 b8 10 80       	push   $0x8010b895
+8010a274:	e8 07 66 ff ff       	call   80100880 <panic>
+    panic("switchuvm: no kstack");
+8010a279:	83 ec 0c             	sub    $0xc,%esp
+8010a27c:	68 80 b8 10 80       	push   $0x8010b880
+8010a281:	e8 fa 65 ff ff       	call   80100880 <panic>
+8010a286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a28d:	8d 76 00             	lea    0x0(%esi),%esi
+
+8010a290 <inituvm>:
+{
+8010a290:	55                   	push   %ebp
+8010a291:	89 e5                	mov    %esp,%ebp
+8010a293:	57                   	push   %edi
+8010a294:	56                   	push   %esi
+8010a295:	53                   	push   %ebx
+8010a296:	83 ec 1c             	sub    $0x1c,%esp
+8010a299:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a29c:	8b 75 10             	mov    0x10(%ebp),%esi
+8010a29f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+8010a2a2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(sz >= PGSIZE)
+8010a2a5:	81 fe ff 0f 00 00    	cmp    $0xfff,%esi
+8010a2ab:	77 49                	ja     8010a2f6 <inituvm+0x66>
+  mem = kalloc();
+8010a2ad:	e8 2e 97 ff ff       	call   801039e0 <kalloc>
+  memset(mem, 0, PGSIZE);
+8010a2b2:	83 ec 04             	sub    $0x4,%esp
+8010a2b5:	68 00 10 00 00       	push   $0x1000
+  mem = kalloc();
+8010a2ba:	89 c3                	mov    %eax,%ebx
+  memset(mem, 0, PGSIZE);
+8010a2bc:	6a 00                	push   $0x0
+8010a2be:	50                   	push   %eax
+8010a2bf:	e8 6c d3 ff ff       	call   80107630 <memset>
+  mappages(pgdir, 0, PGSIZE, V2P(mem), PTE_W|PTE_U);
+8010a2c4:	58                   	pop    %eax
+8010a2c5:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010a2cb:	5a                   	pop    %edx
+8010a2cc:	6a 06                	push   $0x6
+8010a2ce:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010a2d3:	31 d2                	xor    %edx,%edx
+8010a2d5:	50                   	push   %eax
+8010a2d6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010a2d9:	e8 12 fd ff ff       	call   80109ff0 <mappages>
+  memmove(mem, init, sz);
+8010a2de:	89 75 10             	mov    %esi,0x10(%ebp)
+8010a2e1:	83 c4 10             	add    $0x10,%esp
+8010a2e4:	89 7d 0c             	mov    %edi,0xc(%ebp)
+8010a2e7:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+8010a2ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a2ed:	5b                   	pop    %ebx
+8010a2ee:	5e                   	pop    %esi
+8010a2ef:	5f                   	pop    %edi
+8010a2f0:	5d                   	pop    %ebp
+  memmove(mem, init, sz);
+8010a2f1:	e9 ca d3 ff ff       	jmp    801076c0 <memmove>
+    panic("inituvm: more than a page");
+8010a2f6:	83 ec 0c             	sub    $0xc,%esp
+8010a2f9:	68 a9 b8 10 80       	push   $0x8010b8a9
+8010a2fe:	e8 7d 65 ff ff       	call   80100880 <panic>
+8010a303:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a30a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010a310 <loaduvm>:
+{
+8010a310:	55                   	push   %ebp
+8010a311:	89 e5                	mov    %esp,%ebp
+8010a313:	57                   	push   %edi
+8010a314:	56                   	push   %esi
+8010a315:	53                   	push   %ebx
+8010a316:	83 ec 0c             	sub    $0xc,%esp
+  if((uint) addr % PGSIZE != 0)
+8010a319:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+8010a31c:	8b 7d 18             	mov    0x18(%ebp),%edi
+  if((uint) addr % PGSIZE != 0)
+8010a31f:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+8010a325:	0f 85 a2 00 00 00    	jne    8010a3cd <loaduvm+0xbd>
+  for(i = 0; i < sz; i += PGSIZE){
+8010a32b:	85 ff                	test   %edi,%edi
+8010a32d:	74 7d                	je     8010a3ac <loaduvm+0x9c>
+8010a32f:	90                   	nop
+  pde = &pgdir[PDX(va)];
+8010a330:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(*pde & PTE_P){
+8010a333:	8b 55 08             	mov    0x8(%ebp),%edx
+8010a336:	01 f0                	add    %esi,%eax
+  pde = &pgdir[PDX(va)];
+8010a338:	89 c1                	mov    %eax,%ecx
+8010a33a:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010a33d:	8b 0c 8a             	mov    (%edx,%ecx,4),%ecx
+8010a340:	f6 c1 01             	test   $0x1,%cl
+8010a343:	75 13                	jne    8010a358 <loaduvm+0x48>
+      panic("loaduvm: address should exist");
+8010a345:	83 ec 0c             	sub    $0xc,%esp
+8010a348:	68 c3 b8 10 80       	push   $0x8010b8c3
+8010a34d:	e8 2e 65 ff ff       	call   80100880 <panic>
+8010a352:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010a358:	c1 e8 0a             	shr    $0xa,%eax
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010a35b:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  return &pgtab[PTX(va)];
+8010a361:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010a366:	8d 8c 01 00 00 00 80 	lea    -0x80000000(%ecx,%eax,1),%ecx
+    if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
+8010a36d:	85 c9                	test   %ecx,%ecx
+8010a36f:	74 d4                	je     8010a345 <loaduvm+0x35>
+    if(sz - i < PGSIZE)
+8010a371:	89 fb                	mov    %edi,%ebx
+8010a373:	b8 00 10 00 00       	mov    $0x1000,%eax
+8010a378:	29 f3                	sub    %esi,%ebx
+8010a37a:	39 c3                	cmp    %eax,%ebx
+8010a37c:	0f 47 d8             	cmova  %eax,%ebx
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+8010a37f:	53                   	push   %ebx
+8010a380:	8b 45 14             	mov    0x14(%ebp),%eax
+8010a383:	01 f0                	add    %esi,%eax
+8010a385:	50                   	push   %eax
+    pa = PTE_ADDR(*pte);
+8010a386:	8b 01                	mov    (%ecx),%eax
+8010a388:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    if(readi(ip, P2V(pa), offset+i, n) != n)
+8010a38d:	05 00 00 00 80       	add    $0x80000000,%eax
+8010a392:	50                   	push   %eax
+8010a393:	ff 75 10             	push   0x10(%ebp)
+8010a396:	e8 35 88 ff ff       	call   80102bd0 <readi>
+8010a39b:	83 c4 10             	add    $0x10,%esp
+8010a39e:	39 d8                	cmp    %ebx,%eax
+8010a3a0:	75 1e                	jne    8010a3c0 <loaduvm+0xb0>
+  for(i = 0; i < sz; i += PGSIZE){
+8010a3a2:	81 c6 00 10 00 00    	add    $0x1000,%esi
+8010a3a8:	39 fe                	cmp    %edi,%esi
+8010a3aa:	72 84                	jb     8010a330 <loaduvm+0x20>
+}
+8010a3ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010a3af:	31 c0                	xor    %eax,%eax
+}
+8010a3b1:	5b                   	pop    %ebx
+8010a3b2:	5e                   	pop    %esi
+8010a3b3:	5f                   	pop    %edi
+8010a3b4:	5d                   	pop    %ebp
+8010a3b5:	c3                   	ret
+8010a3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a3bd:	8d 76 00             	lea    0x0(%esi),%esi
+8010a3c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010a3c3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010a3c8:	5b                   	pop    %ebx
+8010a3c9:	5e                   	pop    %esi
+8010a3ca:	5f                   	pop    %edi
+8010a3cb:	5d                   	pop    %ebp
+8010a3cc:	c3                   	ret
+    panic("loaduvm: addr must be page aligned");
+8010a3cd:	83 ec 0c             	sub    $0xc,%esp
+8010a3d0:	68 30 b9 10 80       	push   $0x8010b930
+8010a3d5:	e8 a6 64 ff ff       	call   80100880 <panic>
+8010a3da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010a3e0 <allocuvm>:
+{
+8010a3e0:	55                   	push   %ebp
+8010a3e1:	89 e5                	mov    %esp,%ebp
+8010a3e3:	57                   	push   %edi
+8010a3e4:	56                   	push   %esi
+8010a3e5:	53                   	push   %ebx
+8010a3e6:	83 ec 1c             	sub    $0x1c,%esp
+8010a3e9:	8b 75 10             	mov    0x10(%ebp),%esi
+  if(newsz >= KERNBASE)
+8010a3ec:	85 f6                	test   %esi,%esi
+8010a3ee:	0f 88 98 00 00 00    	js     8010a48c <allocuvm+0xac>
+8010a3f4:	89 f2                	mov    %esi,%edx
+  if(newsz < oldsz)
+8010a3f6:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010a3f9:	0f 82 a1 00 00 00    	jb     8010a4a0 <allocuvm+0xc0>
+  a = PGROUNDUP(oldsz);
+8010a3ff:	8b 45 0c             	mov    0xc(%ebp),%eax
+8010a402:	05 ff 0f 00 00       	add    $0xfff,%eax
+8010a407:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010a40c:	89 c7                	mov    %eax,%edi
+  for(; a < newsz; a += PGSIZE){
+8010a40e:	39 f0                	cmp    %esi,%eax
+8010a410:	0f 83 8d 00 00 00    	jae    8010a4a3 <allocuvm+0xc3>
+8010a416:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+8010a419:	eb 44                	jmp    8010a45f <allocuvm+0x7f>
+8010a41b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010a41f:	90                   	nop
+    memset(mem, 0, PGSIZE);
+8010a420:	83 ec 04             	sub    $0x4,%esp
+8010a423:	68 00 10 00 00       	push   $0x1000
+8010a428:	6a 00                	push   $0x0
+8010a42a:	50                   	push   %eax
+8010a42b:	e8 00 d2 ff ff       	call   80107630 <memset>
+    if(mappages(pgdir, (char*)a, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+8010a430:	58                   	pop    %eax
+8010a431:	8d 83 00 00 00 80    	lea    -0x80000000(%ebx),%eax
+8010a437:	5a                   	pop    %edx
+8010a438:	6a 06                	push   $0x6
+8010a43a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010a43f:	89 fa                	mov    %edi,%edx
+8010a441:	50                   	push   %eax
+8010a442:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a445:	e8 a6 fb ff ff       	call   80109ff0 <mappages>
+8010a44a:	83 c4 10             	add    $0x10,%esp
+8010a44d:	85 c0                	test   %eax,%eax
+8010a44f:	78 5f                	js     8010a4b0 <allocuvm+0xd0>
+  for(; a < newsz; a += PGSIZE){
+8010a451:	81 c7 00 10 00 00    	add    $0x1000,%edi
+8010a457:	39 f7                	cmp    %esi,%edi
+8010a459:	0f 83 89 00 00 00    	jae    8010a4e8 <allocuvm+0x108>
+    mem = kalloc();
+8010a45f:	e8 7c 95 ff ff       	call   801039e0 <kalloc>
+8010a464:	89 c3                	mov    %eax,%ebx
+    if(mem == 0){
+8010a466:	85 c0                	test   %eax,%eax
+8010a468:	75 b6                	jne    8010a420 <allocuvm+0x40>
+      cprintf("allocuvm out of memory\n");
+8010a46a:	83 ec 0c             	sub    $0xc,%esp
+8010a46d:	68 e1 b8 10 80       	push   $0x8010b8e1
+8010a472:	e8 39 67 ff ff       	call   80100bb0 <cprintf>
+  if(newsz >= oldsz)
+8010a477:	83 c4 10             	add    $0x10,%esp
+8010a47a:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010a47d:	74 0d                	je     8010a48c <allocuvm+0xac>
+8010a47f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010a482:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a485:	89 f2                	mov    %esi,%edx
+8010a487:	e8 a4 fa ff ff       	call   80109f30 <deallocuvm.part.0>
+    return 0;
+8010a48c:	31 d2                	xor    %edx,%edx
+}
+8010a48e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a491:	89 d0                	mov    %edx,%eax
+8010a493:	5b                   	pop    %ebx
+8010a494:	5e                   	pop    %esi
+8010a495:	5f                   	pop    %edi
+8010a496:	5d                   	pop    %ebp
+8010a497:	c3                   	ret
+8010a498:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a49f:	90                   	nop
+    return oldsz;
+8010a4a0:	8b 55 0c             	mov    0xc(%ebp),%edx
+}
+8010a4a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a4a6:	89 d0                	mov    %edx,%eax
+8010a4a8:	5b                   	pop    %ebx
+8010a4a9:	5e                   	pop    %esi
+8010a4aa:	5f                   	pop    %edi
+8010a4ab:	5d                   	pop    %ebp
+8010a4ac:	c3                   	ret
+8010a4ad:	8d 76 00             	lea    0x0(%esi),%esi
+      cprintf("allocuvm out of memory (2)\n");
+8010a4b0:	83 ec 0c             	sub    $0xc,%esp
+8010a4b3:	68 f9 b8 10 80       	push   $0x8010b8f9
+8010a4b8:	e8 f3 66 ff ff       	call   80100bb0 <cprintf>
+  if(newsz >= oldsz)
+8010a4bd:	83 c4 10             	add    $0x10,%esp
+8010a4c0:	3b 75 0c             	cmp    0xc(%ebp),%esi
+8010a4c3:	74 0d                	je     8010a4d2 <allocuvm+0xf2>
+8010a4c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+8010a4c8:	8b 45 08             	mov    0x8(%ebp),%eax
+8010a4cb:	89 f2                	mov    %esi,%edx
+8010a4cd:	e8 5e fa ff ff       	call   80109f30 <deallocuvm.part.0>
+      kfree(mem);
+8010a4d2:	83 ec 0c             	sub    $0xc,%esp
+8010a4d5:	53                   	push   %ebx
+8010a4d6:	e8 45 92 ff ff       	call   80103720 <kfree>
+      return 0;
+8010a4db:	83 c4 10             	add    $0x10,%esp
+    return 0;
+8010a4de:	31 d2                	xor    %edx,%edx
+8010a4e0:	eb ac                	jmp    8010a48e <allocuvm+0xae>
+8010a4e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+8010a4e8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+}
+8010a4eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a4ee:	5b                   	pop    %ebx
+8010a4ef:	5e                   	pop    %esi
+8010a4f0:	89 d0                	mov    %edx,%eax
+8010a4f2:	5f                   	pop    %edi
+8010a4f3:	5d                   	pop    %ebp
+8010a4f4:	c3                   	ret
+8010a4f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a4fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+8010a500 <deallocuvm>:
+{
+8010a500:	55                   	push   %ebp
+8010a501:	89 e5                	mov    %esp,%ebp
+8010a503:	8b 55 0c             	mov    0xc(%ebp),%edx
+8010a506:	8b 4d 10             	mov    0x10(%ebp),%ecx
+8010a509:	8b 45 08             	mov    0x8(%ebp),%eax
+  if(newsz >= oldsz)
+8010a50c:	39 d1                	cmp    %edx,%ecx
+8010a50e:	73 10                	jae    8010a520 <deallocuvm+0x20>
+}
+8010a510:	5d                   	pop    %ebp
+8010a511:	e9 1a fa ff ff       	jmp    80109f30 <deallocuvm.part.0>
+8010a516:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a51d:	8d 76 00             	lea    0x0(%esi),%esi
+8010a520:	89 d0                	mov    %edx,%eax
+8010a522:	5d                   	pop    %ebp
+8010a523:	c3                   	ret
+8010a524:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a52b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010a52f:	90                   	nop
+
+8010a530 <freevm>:
+
+// Free a page table and all the physical memory pages
+// in the user part.
+void
+freevm(pde_t *pgdir)
+{
+8010a530:	55                   	push   %ebp
+8010a531:	89 e5                	mov    %esp,%ebp
+8010a533:	57                   	push   %edi
+8010a534:	56                   	push   %esi
+8010a535:	53                   	push   %ebx
+8010a536:	83 ec 0c             	sub    $0xc,%esp
+8010a539:	8b 75 08             	mov    0x8(%ebp),%esi
+  uint i;
+
+  if(pgdir == 0)
+8010a53c:	85 f6                	test   %esi,%esi
+8010a53e:	74 59                	je     8010a599 <freevm+0x69>
+  if(newsz >= oldsz)
+8010a540:	31 c9                	xor    %ecx,%ecx
+8010a542:	ba 00 00 00 80       	mov    $0x80000000,%edx
+8010a547:	89 f0                	mov    %esi,%eax
+8010a549:	89 f3                	mov    %esi,%ebx
+8010a54b:	e8 e0 f9 ff ff       	call   80109f30 <deallocuvm.part.0>
+    panic("freevm: no pgdir");
+  deallocuvm(pgdir, KERNBASE, 0);
+  for(i = 0; i < NPDENTRIES; i++){
+8010a550:	8d be 00 10 00 00    	lea    0x1000(%esi),%edi
+8010a556:	eb 0f                	jmp    8010a567 <freevm+0x37>
+8010a558:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a55f:	90                   	nop
+8010a560:	83 c3 04             	add    $0x4,%ebx
+8010a563:	39 fb                	cmp    %edi,%ebx
+8010a565:	74 23                	je     8010a58a <freevm+0x5a>
+    if(pgdir[i] & PTE_P){
+8010a567:	8b 03                	mov    (%ebx),%eax
+8010a569:	a8 01                	test   $0x1,%al
+8010a56b:	74 f3                	je     8010a560 <freevm+0x30>
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+8010a56d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+      kfree(v);
+8010a572:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < NPDENTRIES; i++){
+8010a575:	83 c3 04             	add    $0x4,%ebx
+      char * v = P2V(PTE_ADDR(pgdir[i]));
+8010a578:	05 00 00 00 80       	add    $0x80000000,%eax
+      kfree(v);
+8010a57d:	50                   	push   %eax
+8010a57e:	e8 9d 91 ff ff       	call   80103720 <kfree>
+8010a583:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < NPDENTRIES; i++){
+8010a586:	39 fb                	cmp    %edi,%ebx
+8010a588:	75 dd                	jne    8010a567 <freevm+0x37>
+    }
+  }
+  kfree((char*)pgdir);
+8010a58a:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+8010a58d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a590:	5b                   	pop    %ebx
+8010a591:	5e                   	pop    %esi
+8010a592:	5f                   	pop    %edi
+8010a593:	5d                   	pop    %ebp
+  kfree((char*)pgdir);
+8010a594:	e9 87 91 ff ff       	jmp    80103720 <kfree>
+    panic("freevm: no pgdir");
+8010a599:	83 ec 0c             	sub    $0xc,%esp
+8010a59c:	68 15 b9 10 80       	push   $0x8010b915
+8010a5a1:	e8 da 62 ff ff       	call   80100880 <panic>
+8010a5a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a5ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+8010a5b0 <setupkvm>:
+{
+8010a5b0:	55                   	push   %ebp
+8010a5b1:	89 e5                	mov    %esp,%ebp
+8010a5b3:	56                   	push   %esi
+8010a5b4:	53                   	push   %ebx
+  if((pgdir = (pde_t*)kalloc()) == 0)
+8010a5b5:	e8 26 94 ff ff       	call   801039e0 <kalloc>
+8010a5ba:	85 c0                	test   %eax,%eax
+8010a5bc:	74 5e                	je     8010a61c <setupkvm+0x6c>
+  memset(pgdir, 0, PGSIZE);
+8010a5be:	83 ec 04             	sub    $0x4,%esp
+8010a5c1:	89 c6                	mov    %eax,%esi
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+8010a5c3:	bb 20 e4 10 80       	mov    $0x8010e420,%ebx
+  memset(pgdir, 0, PGSIZE);
+8010a5c8:	68 00 10 00 00       	push   $0x1000
+8010a5cd:	6a 00                	push   $0x0
+8010a5cf:	50                   	push   %eax
+8010a5d0:	e8 5b d0 ff ff       	call   80107630 <memset>
+8010a5d5:	83 c4 10             	add    $0x10,%esp
+                (uint)k->phys_start, k->perm) < 0) {
+8010a5d8:	8b 43 04             	mov    0x4(%ebx),%eax
+    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start,
+8010a5db:	83 ec 08             	sub    $0x8,%esp
+8010a5de:	8b 4b 08             	mov    0x8(%ebx),%ecx
+8010a5e1:	8b 13                	mov    (%ebx),%edx
+8010a5e3:	ff 73 0c             	push   0xc(%ebx)
+8010a5e6:	50                   	push   %eax
+8010a5e7:	29 c1                	sub    %eax,%ecx
+8010a5e9:	89 f0                	mov    %esi,%eax
+8010a5eb:	e8 00 fa ff ff       	call   80109ff0 <mappages>
+8010a5f0:	83 c4 10             	add    $0x10,%esp
+8010a5f3:	85 c0                	test   %eax,%eax
+8010a5f5:	78 19                	js     8010a610 <setupkvm+0x60>
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+8010a5f7:	83 c3 10             	add    $0x10,%ebx
+8010a5fa:	81 fb 60 e4 10 80    	cmp    $0x8010e460,%ebx
+8010a600:	75 d6                	jne    8010a5d8 <setupkvm+0x28>
+}
+8010a602:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010a605:	89 f0                	mov    %esi,%eax
+8010a607:	5b                   	pop    %ebx
+8010a608:	5e                   	pop    %esi
+8010a609:	5d                   	pop    %ebp
+8010a60a:	c3                   	ret
+8010a60b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010a60f:	90                   	nop
+      freevm(pgdir);
+8010a610:	83 ec 0c             	sub    $0xc,%esp
+8010a613:	56                   	push   %esi
+8010a614:	e8 17 ff ff ff       	call   8010a530 <freevm>
+      return 0;
+8010a619:	83 c4 10             	add    $0x10,%esp
+}
+8010a61c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return 0;
+8010a61f:	31 f6                	xor    %esi,%esi
+}
+8010a621:	89 f0                	mov    %esi,%eax
+8010a623:	5b                   	pop    %ebx
+8010a624:	5e                   	pop    %esi
+8010a625:	5d                   	pop    %ebp
+8010a626:	c3                   	ret
+8010a627:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a62e:	66 90                	xchg   %ax,%ax
+
+8010a630 <kvmalloc>:
+{
+8010a630:	55                   	push   %ebp
+8010a631:	89 e5                	mov    %esp,%ebp
+8010a633:	83 ec 08             	sub    $0x8,%esp
+  kpgdir = setupkvm();
+8010a636:	e8 75 ff ff ff       	call   8010a5b0 <setupkvm>
+8010a63b:	a3 04 2b 91 80       	mov    %eax,0x80912b04
+  lcr3(V2P(kpgdir));   // switch to the kernel page table
+8010a640:	05 00 00 00 80       	add    $0x80000000,%eax
+8010a645:	0f 22 d8             	mov    %eax,%cr3
+}
+8010a648:	c9                   	leave
+8010a649:	c3                   	ret
+8010a64a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010a650 <clearpteu>:
+
+// Clear PTE_U on a page. Used to create an inaccessible
+// page beneath the user stack.
+void
+clearpteu(pde_t *pgdir, char *uva)
+{
+8010a650:	55                   	push   %ebp
+8010a651:	89 e5                	mov    %esp,%ebp
+8010a653:	83 ec 08             	sub    $0x8,%esp
+8010a656:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if(*pde & PTE_P){
+8010a659:	8b 55 08             	mov    0x8(%ebp),%edx
+  pde = &pgdir[PDX(va)];
+8010a65c:	89 c1                	mov    %eax,%ecx
+8010a65e:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010a661:	8b 14 8a             	mov    (%edx,%ecx,4),%edx
+8010a664:	f6 c2 01             	test   $0x1,%dl
+8010a667:	75 17                	jne    8010a680 <clearpteu+0x30>
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+  if(pte == 0)
+    panic("clearpteu");
+8010a669:	83 ec 0c             	sub    $0xc,%esp
+8010a66c:	68 26 b9 10 80       	push   $0x8010b926
+8010a671:	e8 0a 62 ff ff       	call   80100880 <panic>
+8010a676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a67d:	8d 76 00             	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010a680:	c1 e8 0a             	shr    $0xa,%eax
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010a683:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  return &pgtab[PTX(va)];
+8010a689:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010a68e:	8d 84 02 00 00 00 80 	lea    -0x80000000(%edx,%eax,1),%eax
+  if(pte == 0)
+8010a695:	85 c0                	test   %eax,%eax
+8010a697:	74 d0                	je     8010a669 <clearpteu+0x19>
+  *pte &= ~PTE_U;
+8010a699:	83 20 fb             	andl   $0xfffffffb,(%eax)
+}
+8010a69c:	c9                   	leave
+8010a69d:	c3                   	ret
+8010a69e:	66 90                	xchg   %ax,%ax
+
+8010a6a0 <copyuvm>:
+// map the same physical pages, with writable ones made
+// read-only and marked PTE_COW. cowfault() makes the private
+// copy when either side writes.
+pde_t*
+copyuvm(pde_t *pgdir, uint sz)
+{
+8010a6a0:	55                   	push   %ebp
+8010a6a1:	89 e5                	mov    %esp,%ebp
+8010a6a3:	57                   	push   %edi
+8010a6a4:	56                   	push   %esi
+8010a6a5:	53                   	push   %ebx
+8010a6a6:	83 ec 1c             	sub    $0x1c,%esp
+8010a6a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  pde_t *d;
+  pte_t *pte;
+  uint pa, i, flags;
+
+  if((d = setupkvm()) == 0)
+8010a6ac:	e8 ff fe ff ff       	call   8010a5b0 <setupkvm>
+8010a6b1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+8010a6b4:	85 c0                	test   %eax,%eax
+8010a6b6:	0f 84 e2 00 00 00    	je     8010a79e <copyuvm+0xfe>
+    return 0;
+  for(i = 0; i < sz; i += PGSIZE){
+8010a6bc:	85 f6                	test   %esi,%esi
+8010a6be:	0f 84 ab 00 00 00    	je     8010a76f <copyuvm+0xcf>
+8010a6c4:	31 ff                	xor    %edi,%edi
+8010a6c6:	89 75 0c             	mov    %esi,0xc(%ebp)
+8010a6c9:	89 fe                	mov    %edi,%esi
+8010a6cb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+8010a6ce:	eb 10                	jmp    8010a6e0 <copyuvm+0x40>
+    // Heap pages are allocated lazily; skip untouched ones.
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+8010a6d0:	83 c1 01             	add    $0x1,%ecx
+8010a6d3:	89 ce                	mov    %ecx,%esi
+8010a6d5:	c1 e6 16             	shl    $0x16,%esi
+  for(i = 0; i < sz; i += PGSIZE){
+8010a6d8:	39 fe                	cmp    %edi,%esi
+8010a6da:	0f 83 8f 00 00 00    	jae    8010a76f <copyuvm+0xcf>
+  if(*pde & PTE_P){
+8010a6e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+8010a6e3:	89 f1                	mov    %esi,%ecx
+8010a6e5:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010a6e8:	8b 04 88             	mov    (%eax,%ecx,4),%eax
+8010a6eb:	a8 01                	test   $0x1,%al
+8010a6ed:	74 e1                	je     8010a6d0 <copyuvm+0x30>
+  return &pgtab[PTX(va)];
+8010a6ef:	89 f3                	mov    %esi,%ebx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010a6f1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010a6f6:	c1 eb 0a             	shr    $0xa,%ebx
+8010a6f9:	81 e3 fc 0f 00 00    	and    $0xffc,%ebx
+8010a6ff:	8d 84 18 00 00 00 80 	lea    -0x80000000(%eax,%ebx,1),%eax
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+8010a706:	85 c0                	test   %eax,%eax
+8010a708:	74 c6                	je     8010a6d0 <copyuvm+0x30>
+      continue;
+    }
+    if(!(*pte & PTE_P))
+8010a70a:	8b 08                	mov    (%eax),%ecx
+8010a70c:	f6 c1 01             	test   $0x1,%cl
+8010a70f:	74 6f                	je     8010a780 <copyuvm+0xe0>
+      continue;
+    if(*pte & PTE_W){
+8010a711:	f6 c1 02             	test   $0x2,%cl
+8010a714:	74 10                	je     8010a726 <copyuvm+0x86>
+      *pte = (*pte & ~PTE_W) | PTE_COW;
+8010a716:	81 e1 fd fd ff ff    	and    $0xfffffdfd,%ecx
+8010a71c:	80 cd 02             	or     $0x2,%ch
+8010a71f:	89 08                	mov    %ecx,(%eax)
+}
+
+static inline void
+invlpg(void *addr)
+{
+  asm volatile("invlpg (%0)" : : "r" (addr) : "memory");
+8010a721:	0f 01 3e             	invlpg (%esi)
+      invlpg((void*)i);
+    }
+    pa = PTE_ADDR(*pte);
+8010a724:	8b 08                	mov    (%eax),%ecx
+8010a726:	89 cb                	mov    %ecx,%ebx
+    flags = PTE_FLAGS(*pte);
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
+8010a728:	83 ec 08             	sub    $0x8,%esp
+    flags = PTE_FLAGS(*pte);
+8010a72b:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
+8010a731:	89 f2                	mov    %esi,%edx
+    pa = PTE_ADDR(*pte);
+8010a733:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
+8010a739:	51                   	push   %ecx
+8010a73a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010a73f:	53                   	push   %ebx
+8010a740:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010a743:	e8 a8 f8 ff ff       	call   80109ff0 <mappages>
+8010a748:	83 c4 10             	add    $0x10,%esp
+8010a74b:	85 c0                	test   %eax,%eax
+8010a74d:	78 41                	js     8010a790 <copyuvm+0xf0>
+      goto bad;
+    kincref(P2V(pa));
+8010a74f:	83 ec 0c             	sub    $0xc,%esp
+8010a752:	81 c3 00 00 00 80    	add    $0x80000000,%ebx
+  for(i = 0; i < sz; i += PGSIZE){
+8010a758:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    kincref(P2V(pa));
+8010a75e:	53                   	push   %ebx
+8010a75f:	e8 9c 93 ff ff       	call   80103b00 <kincref>
+  for(i = 0; i < sz; i += PGSIZE){
+8010a764:	83 c4 10             	add    $0x10,%esp
+8010a767:	39 fe                	cmp    %edi,%esi
+8010a769:	0f 82 71 ff ff ff    	jb     8010a6e0 <copyuvm+0x40>
+  return d;
+
+bad:
+  freevm(d);
+  return 0;
+}
+8010a76f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010a772:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a775:	5b                   	pop    %ebx
+8010a776:	5e                   	pop    %esi
+8010a777:	5f                   	pop    %edi
+8010a778:	5d                   	pop    %ebp
+8010a779:	c3                   	ret
+8010a77a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < sz; i += PGSIZE){
+8010a780:	81 c6 00 10 00 00    	add    $0x1000,%esi
+8010a786:	e9 4d ff ff ff       	jmp    8010a6d8 <copyuvm+0x38>
+8010a78b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010a78f:	90                   	nop
+  freevm(d);
+8010a790:	83 ec 0c             	sub    $0xc,%esp
+8010a793:	ff 75 e4             	push   -0x1c(%ebp)
+8010a796:	e8 95 fd ff ff       	call   8010a530 <freevm>
+  return 0;
+8010a79b:	83 c4 10             	add    $0x10,%esp
+    return 0;
+8010a79e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+}
+8010a7a5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010a7a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a7ab:	5b                   	pop    %ebx
+8010a7ac:	5e                   	pop    %esi
+8010a7ad:	5f                   	pop    %edi
+8010a7ae:	5d                   	pop    %ebp
+8010a7af:	c3                   	ret
+
+8010a7b0 <cowfault>:
+// the page writable if no one else refers to it any more.
+// Returns 0 on success, -1 if va is not a copy-on-write page
+// or no memory is left for the copy.
+int
+cowfault(pde_t *pgdir, uint va)
+{
+8010a7b0:	55                   	push   %ebp
+8010a7b1:	89 e5                	mov    %esp,%ebp
+8010a7b3:	57                   	push   %edi
+8010a7b4:	56                   	push   %esi
+8010a7b5:	53                   	push   %ebx
+8010a7b6:	83 ec 1c             	sub    $0x1c,%esp
+8010a7b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  pte_t *pte;
+  uint pa, flags;
+  char *mem;
+
+  if(va >= KERNBASE)
+8010a7bc:	85 db                	test   %ebx,%ebx
+8010a7be:	0f 88 8c 00 00 00    	js     8010a850 <cowfault+0xa0>
+  if(*pde & PTE_P){
+8010a7c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+8010a7c7:	89 da                	mov    %ebx,%edx
+8010a7c9:	c1 ea 16             	shr    $0x16,%edx
+  if(*pde & PTE_P){
+8010a7cc:	8b 04 90             	mov    (%eax,%edx,4),%eax
+8010a7cf:	a8 01                	test   $0x1,%al
+8010a7d1:	74 7d                	je     8010a850 <cowfault+0xa0>
+  return &pgtab[PTX(va)];
+8010a7d3:	89 da                	mov    %ebx,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010a7d5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010a7da:	c1 ea 0a             	shr    $0xa,%edx
+8010a7dd:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010a7e3:	8d b4 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%esi
+    return -1;
+  if((pte = walkpgdir(pgdir, (void*)va, 0)) == 0)
+8010a7ea:	85 f6                	test   %esi,%esi
+8010a7ec:	74 62                	je     8010a850 <cowfault+0xa0>
+    return -1;
+  if((*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+8010a7ee:	8b 06                	mov    (%esi),%eax
+8010a7f0:	89 c2                	mov    %eax,%edx
+8010a7f2:	81 e2 05 02 00 00    	and    $0x205,%edx
+8010a7f8:	81 fa 05 02 00 00    	cmp    $0x205,%edx
+8010a7fe:	75 50                	jne    8010a850 <cowfault+0xa0>
+    return -1;
+  pa = PTE_ADDR(*pte);
+8010a800:	89 c2                	mov    %eax,%edx
+  flags = (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+8010a802:	25 fd 0d 00 00       	and    $0xdfd,%eax
+  if(krefcount(P2V(pa)) == 1){
+8010a807:	83 ec 0c             	sub    $0xc,%esp
+  pa = PTE_ADDR(*pte);
+8010a80a:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  flags = (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+8010a810:	83 c8 02             	or     $0x2,%eax
+  if(krefcount(P2V(pa)) == 1){
+8010a813:	8d ba 00 00 00 80    	lea    -0x80000000(%edx),%edi
+  flags = (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+8010a819:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(krefcount(P2V(pa)) == 1){
+8010a81c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+8010a81f:	57                   	push   %edi
+8010a820:	e8 3b 93 ff ff       	call   80103b60 <krefcount>
+8010a825:	83 c4 10             	add    $0x10,%esp
+8010a828:	83 f8 01             	cmp    $0x1,%eax
+8010a82b:	75 33                	jne    8010a860 <cowfault+0xb0>
+    // Only this page table uses the page any more.
+    *pte = pa | flags;
+8010a82d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010a830:	8b 55 e0             	mov    -0x20(%ebp),%edx
+8010a833:	09 c2                	or     %eax,%edx
+8010a835:	89 16                	mov    %edx,(%esi)
+      return -1;
+    memmove(mem, (char*)P2V(pa), PGSIZE);
+    *pte = V2P(mem) | flags;
+    kfree(P2V(pa));
+  }
+  invlpg((void*)PGROUNDDOWN(va));
+8010a837:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+8010a83d:	0f 01 3b             	invlpg (%ebx)
+  return 0;
+}
+8010a840:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010a843:	31 c0                	xor    %eax,%eax
+}
+8010a845:	5b                   	pop    %ebx
+8010a846:	5e                   	pop    %esi
+8010a847:	5f                   	pop    %edi
+8010a848:	5d                   	pop    %ebp
+8010a849:	c3                   	ret
+8010a84a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+8010a850:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    return -1;
+8010a853:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010a858:	5b                   	pop    %ebx
+8010a859:	5e                   	pop    %esi
+8010a85a:	5f                   	pop    %edi
+8010a85b:	5d                   	pop    %ebp
+8010a85c:	c3                   	ret
+8010a85d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((mem = kalloc()) == 0)
+8010a860:	e8 7b 91 ff ff       	call   801039e0 <kalloc>
+8010a865:	85 c0                	test   %eax,%eax
+8010a867:	74 e7                	je     8010a850 <cowfault+0xa0>
+    memmove(mem, (char*)P2V(pa), PGSIZE);
+8010a869:	83 ec 04             	sub    $0x4,%esp
+8010a86c:	68 00 10 00 00       	push   $0x1000
+8010a871:	57                   	push   %edi
+8010a872:	50                   	push   %eax
+8010a873:	89 45 e0             	mov    %eax,-0x20(%ebp)
+8010a876:	e8 45 ce ff ff       	call   801076c0 <memmove>
+    *pte = V2P(mem) | flags;
+8010a87b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+8010a87e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+8010a881:	81 c2 00 00 00 80    	add    $0x80000000,%edx
+8010a887:	09 c2                	or     %eax,%edx
+8010a889:	89 16                	mov    %edx,(%esi)
+    kfree(P2V(pa));
+8010a88b:	89 3c 24             	mov    %edi,(%esp)
+8010a88e:	e8 8d 8e ff ff       	call   80103720 <kfree>
+8010a893:	83 c4 10             	add    $0x10,%esp
+8010a896:	eb 9f                	jmp    8010a837 <cowfault+0x87>
+8010a898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a89f:	90                   	nop
+
+8010a8a0 <cowbreak>:
+// before the kernel writes there on a system call's behalf, so
+// that running out of memory for the copies fails the call
+// instead of faulting in the kernel. Returns -1 if memory ran out.
+int
+cowbreak(pde_t *pgdir, uint va, uint len)
+{
+8010a8a0:	55                   	push   %ebp
+8010a8a1:	89 e5                	mov    %esp,%ebp
+8010a8a3:	57                   	push   %edi
+8010a8a4:	56                   	push   %esi
+8010a8a5:	53                   	push   %ebx
+8010a8a6:	83 ec 0c             	sub    $0xc,%esp
+8010a8a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010a8ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  pte_t *pte;
+  uint a;
+
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+8010a8af:	89 f3                	mov    %esi,%ebx
+8010a8b1:	03 75 10             	add    0x10(%ebp),%esi
+8010a8b4:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+8010a8ba:	39 f3                	cmp    %esi,%ebx
+8010a8bc:	72 0c                	jb     8010a8ca <cowbreak+0x2a>
+8010a8be:	eb 60                	jmp    8010a920 <cowbreak+0x80>
+8010a8c0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010a8c6:	39 f3                	cmp    %esi,%ebx
+8010a8c8:	73 56                	jae    8010a920 <cowbreak+0x80>
+  pde = &pgdir[PDX(va)];
+8010a8ca:	89 d8                	mov    %ebx,%eax
+8010a8cc:	c1 e8 16             	shr    $0x16,%eax
+  if(*pde & PTE_P){
+8010a8cf:	8b 04 87             	mov    (%edi,%eax,4),%eax
+8010a8d2:	a8 01                	test   $0x1,%al
+8010a8d4:	74 ea                	je     8010a8c0 <cowbreak+0x20>
+  return &pgtab[PTX(va)];
+8010a8d6:	89 da                	mov    %ebx,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010a8d8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010a8dd:	c1 ea 0a             	shr    $0xa,%edx
+8010a8e0:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010a8e6:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(pte && (*pte & PTE_COW) && cowfault(pgdir, a) < 0)
+8010a8ed:	85 c0                	test   %eax,%eax
+8010a8ef:	74 cf                	je     8010a8c0 <cowbreak+0x20>
+8010a8f1:	8b 00                	mov    (%eax),%eax
+8010a8f3:	f6 c4 02             	test   $0x2,%ah
+8010a8f6:	74 c8                	je     8010a8c0 <cowbreak+0x20>
+8010a8f8:	83 ec 08             	sub    $0x8,%esp
+8010a8fb:	53                   	push   %ebx
+8010a8fc:	57                   	push   %edi
+8010a8fd:	e8 ae fe ff ff       	call   8010a7b0 <cowfault>
+8010a902:	83 c4 10             	add    $0x10,%esp
+8010a905:	85 c0                	test   %eax,%eax
+8010a907:	79 b7                	jns    8010a8c0 <cowbreak+0x20>
+      return -1;
+  }
+  return 0;
+}
+8010a909:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010a90c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010a911:	5b                   	pop    %ebx
+8010a912:	5e                   	pop    %esi
+8010a913:	5f                   	pop    %edi
+8010a914:	5d                   	pop    %ebp
+8010a915:	c3                   	ret
+8010a916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a91d:	8d 76 00             	lea    0x0(%esi),%esi
+8010a920:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010a923:	31 c0                	xor    %eax,%eax
+}
+8010a925:	5b                   	pop    %ebx
+8010a926:	5e                   	pop    %esi
+8010a927:	5f                   	pop    %edi
+8010a928:	5d                   	pop    %ebp
+8010a929:	c3                   	ret
+8010a92a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010a930 <lazyfault>:
+// filled in with zeroed pages as it is touched.
+// Returns 0 on success, -1 if va is not such an address or
+// no memory is left.
+int
+lazyfault(pde_t *pgdir, uint sz, uint va)
+{
+8010a930:	55                   	push   %ebp
+8010a931:	89 e5                	mov    %esp,%ebp
+8010a933:	57                   	push   %edi
+8010a934:	56                   	push   %esi
+8010a935:	53                   	push   %ebx
+8010a936:	83 ec 0c             	sub    $0xc,%esp
+8010a939:	8b 5d 08             	mov    0x8(%ebp),%ebx
+8010a93c:	8b 45 10             	mov    0x10(%ebp),%eax
+  pte_t *pte;
+  char *mem;
+
+  if(va >= sz || va >= KERNBASE)
+8010a93f:	3b 45 0c             	cmp    0xc(%ebp),%eax
+8010a942:	73 7c                	jae    8010a9c0 <lazyfault+0x90>
+8010a944:	85 c0                	test   %eax,%eax
+8010a946:	78 78                	js     8010a9c0 <lazyfault+0x90>
+    return -1;
+  va = PGROUNDDOWN(va);
+8010a948:	89 c6                	mov    %eax,%esi
+  pde = &pgdir[PDX(va)];
+8010a94a:	c1 e8 16             	shr    $0x16,%eax
+  if(*pde & PTE_P){
+8010a94d:	8b 04 83             	mov    (%ebx,%eax,4),%eax
+  va = PGROUNDDOWN(va);
+8010a950:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  if(*pde & PTE_P){
+8010a956:	a8 01                	test   $0x1,%al
+8010a958:	75 46                	jne    8010a9a0 <lazyfault+0x70>
+  if((pte = walkpgdir(pgdir, (void*)va, 0)) != 0 && (*pte & PTE_P))
+    return -1;
+  if((mem = kalloc()) == 0)
+8010a95a:	e8 81 90 ff ff       	call   801039e0 <kalloc>
+8010a95f:	89 c7                	mov    %eax,%edi
+8010a961:	85 c0                	test   %eax,%eax
+8010a963:	74 5b                	je     8010a9c0 <lazyfault+0x90>
+    return -1;
+  memset(mem, 0, PGSIZE);
+8010a965:	83 ec 04             	sub    $0x4,%esp
+8010a968:	68 00 10 00 00       	push   $0x1000
+8010a96d:	6a 00                	push   $0x0
+8010a96f:	50                   	push   %eax
+8010a970:	e8 bb cc ff ff       	call   80107630 <memset>
+  if(mappages(pgdir, (void*)va, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+8010a975:	58                   	pop    %eax
+8010a976:	8d 87 00 00 00 80    	lea    -0x80000000(%edi),%eax
+8010a97c:	5a                   	pop    %edx
+8010a97d:	6a 06                	push   $0x6
+8010a97f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+8010a984:	89 f2                	mov    %esi,%edx
+8010a986:	50                   	push   %eax
+8010a987:	89 d8                	mov    %ebx,%eax
+8010a989:	e8 62 f6 ff ff       	call   80109ff0 <mappages>
+8010a98e:	83 c4 10             	add    $0x10,%esp
+8010a991:	85 c0                	test   %eax,%eax
+8010a993:	78 32                	js     8010a9c7 <lazyfault+0x97>
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+8010a995:	31 c0                	xor    %eax,%eax
+}
+8010a997:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010a99a:	5b                   	pop    %ebx
+8010a99b:	5e                   	pop    %esi
+8010a99c:	5f                   	pop    %edi
+8010a99d:	5d                   	pop    %ebp
+8010a99e:	c3                   	ret
+8010a99f:	90                   	nop
+  return &pgtab[PTX(va)];
+8010a9a0:	89 f2                	mov    %esi,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010a9a2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010a9a7:	c1 ea 0a             	shr    $0xa,%edx
+8010a9aa:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010a9b0:	8d 84 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%eax
+  if((pte = walkpgdir(pgdir, (void*)va, 0)) != 0 && (*pte & PTE_P))
+8010a9b7:	85 c0                	test   %eax,%eax
+8010a9b9:	74 9f                	je     8010a95a <lazyfault+0x2a>
+8010a9bb:	f6 00 01             	testb  $0x1,(%eax)
+8010a9be:	74 9a                	je     8010a95a <lazyfault+0x2a>
+    return -1;
+8010a9c0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010a9c5:	eb d0                	jmp    8010a997 <lazyfault+0x67>
+    kfree(mem);
+8010a9c7:	83 ec 0c             	sub    $0xc,%esp
+8010a9ca:	57                   	push   %edi
+8010a9cb:	e8 50 8d ff ff       	call   80103720 <kfree>
+    return -1;
+8010a9d0:	83 c4 10             	add    $0x10,%esp
+8010a9d3:	eb eb                	jmp    8010a9c0 <lazyfault+0x90>
+8010a9d5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010a9dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+8010a9e0 <lazyfill>:
+// kernel accesses them on a system call's behalf, so that running
+// out of memory fails the call instead of faulting in the kernel.
+// Returns -1 if memory ran out.
+int
+lazyfill(pde_t *pgdir, uint sz, uint va, uint len)
+{
+8010a9e0:	55                   	push   %ebp
+8010a9e1:	89 e5                	mov    %esp,%ebp
+8010a9e3:	57                   	push   %edi
+8010a9e4:	56                   	push   %esi
+8010a9e5:	53                   	push   %ebx
+8010a9e6:	83 ec 0c             	sub    $0xc,%esp
+8010a9e9:	8b 75 10             	mov    0x10(%ebp),%esi
+8010a9ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  pte_t *pte;
+  uint a;
+
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+8010a9ef:	89 f3                	mov    %esi,%ebx
+8010a9f1:	03 75 14             	add    0x14(%ebp),%esi
+8010a9f4:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+8010a9fa:	39 f3                	cmp    %esi,%ebx
+8010a9fc:	73 4c                	jae    8010aa4a <lazyfill+0x6a>
+8010a9fe:	66 90                	xchg   %ax,%ax
+  pde = &pgdir[PDX(va)];
+8010aa00:	89 d8                	mov    %ebx,%eax
+8010aa02:	c1 e8 16             	shr    $0x16,%eax
+  if(*pde & PTE_P){
+8010aa05:	8b 04 87             	mov    (%edi,%eax,4),%eax
+8010aa08:	a8 01                	test   $0x1,%al
+8010aa0a:	74 20                	je     8010aa2c <lazyfill+0x4c>
+  return &pgtab[PTX(va)];
+8010aa0c:	89 d9                	mov    %ebx,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010aa0e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010aa13:	c1 e9 0a             	shr    $0xa,%ecx
+8010aa16:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010aa1c:	8d 84 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%eax
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if((pte == 0 || !(*pte & PTE_P)) && lazyfault(pgdir, sz, a) < 0)
+8010aa23:	85 c0                	test   %eax,%eax
+8010aa25:	74 05                	je     8010aa2c <lazyfill+0x4c>
+8010aa27:	f6 00 01             	testb  $0x1,(%eax)
+8010aa2a:	75 14                	jne    8010aa40 <lazyfill+0x60>
+8010aa2c:	83 ec 04             	sub    $0x4,%esp
+8010aa2f:	53                   	push   %ebx
+8010aa30:	ff 75 0c             	push   0xc(%ebp)
+8010aa33:	57                   	push   %edi
+8010aa34:	e8 f7 fe ff ff       	call   8010a930 <lazyfault>
+8010aa39:	83 c4 10             	add    $0x10,%esp
+8010aa3c:	85 c0                	test   %eax,%eax
+8010aa3e:	78 18                	js     8010aa58 <lazyfill+0x78>
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+8010aa40:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+8010aa46:	39 f3                	cmp    %esi,%ebx
+8010aa48:	72 b6                	jb     8010aa00 <lazyfill+0x20>
+      return -1;
+  }
+  return 0;
+}
+8010aa4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010aa4d:	31 c0                	xor    %eax,%eax
+}
+8010aa4f:	5b                   	pop    %ebx
+8010aa50:	5e                   	pop    %esi
+8010aa51:	5f                   	pop    %edi
+8010aa52:	5d                   	pop    %ebp
+8010aa53:	c3                   	ret
+8010aa54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010aa58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010aa5b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010aa60:	5b                   	pop    %ebx
+8010aa61:	5e                   	pop    %esi
+8010aa62:	5f                   	pop    %edi
+8010aa63:	5d                   	pop    %ebp
+8010aa64:	c3                   	ret
+8010aa65:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010aa6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+8010aa70 <loanpage>:
+// reference to it and make it copy-on-write, so that later
+// writes by this process go to a copy. Returns the page's
+// physical address, or 0 if va has no user page.
+uint
+loanpage(pde_t *pgdir, char *va)
+{
+8010aa70:	55                   	push   %ebp
+8010aa71:	89 e5                	mov    %esp,%ebp
+8010aa73:	56                   	push   %esi
+8010aa74:	53                   	push   %ebx
+8010aa75:	8b 55 0c             	mov    0xc(%ebp),%edx
+  if(*pde & PTE_P){
+8010aa78:	8b 45 08             	mov    0x8(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+8010aa7b:	89 d1                	mov    %edx,%ecx
+8010aa7d:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010aa80:	8b 04 88             	mov    (%eax,%ecx,4),%eax
+8010aa83:	89 c3                	mov    %eax,%ebx
+8010aa85:	83 e3 01             	and    $0x1,%ebx
+8010aa88:	74 55                	je     8010aadf <loanpage+0x6f>
+  return &pgtab[PTX(va)];
+8010aa8a:	89 d1                	mov    %edx,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010aa8c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010aa91:	c1 e9 0a             	shr    $0xa,%ecx
+8010aa94:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010aa9a:	8d 8c 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%ecx
+  pte_t *pte;
+  uint pa;
+
+  if((pte = walkpgdir(pgdir, va, 0)) == 0)
+8010aaa1:	85 c9                	test   %ecx,%ecx
+8010aaa3:	74 4b                	je     8010aaf0 <loanpage+0x80>
+    return 0;
+  if((*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U))
+8010aaa5:	8b 01                	mov    (%ecx),%eax
+    return 0;
+8010aaa7:	31 db                	xor    %ebx,%ebx
+  if((*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U))
+8010aaa9:	89 c6                	mov    %eax,%esi
+8010aaab:	83 e6 05             	and    $0x5,%esi
+8010aaae:	83 fe 05             	cmp    $0x5,%esi
+8010aab1:	75 2c                	jne    8010aadf <loanpage+0x6f>
+    return 0;
+  if(*pte & PTE_W){
+8010aab3:	a8 02                	test   $0x2,%al
+8010aab5:	74 0f                	je     8010aac6 <loanpage+0x56>
+    *pte = (*pte & ~PTE_W) | PTE_COW;
+8010aab7:	25 fd fd ff ff       	and    $0xfffffdfd,%eax
+8010aabc:	80 cc 02             	or     $0x2,%ah
+8010aabf:	89 01                	mov    %eax,(%ecx)
+8010aac1:	0f 01 3a             	invlpg (%edx)
+    invlpg(va);
+  }
+  pa = PTE_ADDR(*pte);
+8010aac4:	8b 01                	mov    (%ecx),%eax
+8010aac6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  kincref(P2V(pa));
+8010aacb:	83 ec 0c             	sub    $0xc,%esp
+  pa = PTE_ADDR(*pte);
+8010aace:	89 c3                	mov    %eax,%ebx
+  kincref(P2V(pa));
+8010aad0:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+8010aad6:	50                   	push   %eax
+8010aad7:	e8 24 90 ff ff       	call   80103b00 <kincref>
+  return pa;
+8010aadc:	83 c4 10             	add    $0x10,%esp
+}
+8010aadf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+8010aae2:	89 d8                	mov    %ebx,%eax
+8010aae4:	5b                   	pop    %ebx
+8010aae5:	5e                   	pop    %esi
+8010aae6:	5d                   	pop    %ebp
+8010aae7:	c3                   	ret
+8010aae8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010aaef:	90                   	nop
+    return 0;
+8010aaf0:	31 db                	xor    %ebx,%ebx
+8010aaf2:	eb eb                	jmp    8010aadf <loanpage+0x6f>
+8010aaf4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010aafb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+8010aaff:	90                   	nop
+
+8010ab00 <maploan>:
+// Map the lent page pa at user address va, copy-on-write, in
+// place of the page there. The caller's reference to pa goes
+// to the new mapping. Returns -1 if va cannot be remapped.
+int
+maploan(pde_t *pgdir, char *va, uint pa)
+{
+8010ab00:	55                   	push   %ebp
+8010ab01:	89 e5                	mov    %esp,%ebp
+8010ab03:	57                   	push   %edi
+8010ab04:	56                   	push   %esi
+8010ab05:	53                   	push   %ebx
+8010ab06:	83 ec 0c             	sub    $0xc,%esp
+8010ab09:	8b 75 0c             	mov    0xc(%ebp),%esi
+  pde = &pgdir[PDX(va)];
+8010ab0c:	8b 45 08             	mov    0x8(%ebp),%eax
+8010ab0f:	89 f3                	mov    %esi,%ebx
+8010ab11:	c1 eb 16             	shr    $0x16,%ebx
+8010ab14:	8d 1c 98             	lea    (%eax,%ebx,4),%ebx
+  if(*pde & PTE_P){
+8010ab17:	8b 03                	mov    (%ebx),%eax
+8010ab19:	a8 01                	test   $0x1,%al
+8010ab1b:	74 53                	je     8010ab70 <maploan+0x70>
+  return &pgtab[PTX(va)];
+8010ab1d:	89 f2                	mov    %esi,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010ab1f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010ab24:	c1 ea 0a             	shr    $0xa,%edx
+8010ab27:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010ab2d:	8d bc 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%edi
+  pte_t *pte;
+
+  if((pte = walkpgdir(pgdir, va, 1)) == 0)
+8010ab34:	85 ff                	test   %edi,%edi
+8010ab36:	74 78                	je     8010abb0 <maploan+0xb0>
+    return -1;
+  if(*pte & PTE_P){
+8010ab38:	8b 07                	mov    (%edi),%eax
+8010ab3a:	a8 01                	test   $0x1,%al
+8010ab3c:	74 1a                	je     8010ab58 <maploan+0x58>
+    if(!(*pte & PTE_U))
+8010ab3e:	a8 04                	test   $0x4,%al
+8010ab40:	74 6e                	je     8010abb0 <maploan+0xb0>
+      return -1;
+    kfree(P2V(PTE_ADDR(*pte)));
+8010ab42:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010ab47:	83 ec 0c             	sub    $0xc,%esp
+8010ab4a:	05 00 00 00 80       	add    $0x80000000,%eax
+8010ab4f:	50                   	push   %eax
+8010ab50:	e8 cb 8b ff ff       	call   80103720 <kfree>
+8010ab55:	83 c4 10             	add    $0x10,%esp
+  }
+  *pte = pa | PTE_P | PTE_U | PTE_COW;
+8010ab58:	8b 45 10             	mov    0x10(%ebp),%eax
+8010ab5b:	0d 05 02 00 00       	or     $0x205,%eax
+8010ab60:	89 07                	mov    %eax,(%edi)
+8010ab62:	0f 01 3e             	invlpg (%esi)
+  invlpg(va);
+  return 0;
+8010ab65:	31 c0                	xor    %eax,%eax
+}
+8010ab67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010ab6a:	5b                   	pop    %ebx
+8010ab6b:	5e                   	pop    %esi
+8010ab6c:	5f                   	pop    %edi
+8010ab6d:	5d                   	pop    %ebp
+8010ab6e:	c3                   	ret
+8010ab6f:	90                   	nop
+    if(!alloc || (pgtab = (pte_t*)kalloc()) == 0)
+8010ab70:	e8 6b 8e ff ff       	call   801039e0 <kalloc>
+8010ab75:	89 c7                	mov    %eax,%edi
+8010ab77:	85 c0                	test   %eax,%eax
+8010ab79:	74 35                	je     8010abb0 <maploan+0xb0>
+    memset(pgtab, 0, PGSIZE);
+8010ab7b:	83 ec 04             	sub    $0x4,%esp
+8010ab7e:	68 00 10 00 00       	push   $0x1000
+8010ab83:	6a 00                	push   $0x0
+8010ab85:	50                   	push   %eax
+8010ab86:	e8 a5 ca ff ff       	call   80107630 <memset>
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010ab8b:	8d 87 00 00 00 80    	lea    -0x80000000(%edi),%eax
+  return &pgtab[PTX(va)];
+8010ab91:	83 c4 10             	add    $0x10,%esp
+    *pde = V2P(pgtab) | PTE_P | PTE_W | PTE_U;
+8010ab94:	83 c8 07             	or     $0x7,%eax
+8010ab97:	89 03                	mov    %eax,(%ebx)
+  return &pgtab[PTX(va)];
+8010ab99:	89 f0                	mov    %esi,%eax
+8010ab9b:	c1 e8 0a             	shr    $0xa,%eax
+8010ab9e:	25 fc 0f 00 00       	and    $0xffc,%eax
+8010aba3:	01 c7                	add    %eax,%edi
+  if(*pte & PTE_P){
+8010aba5:	8b 07                	mov    (%edi),%eax
+8010aba7:	a8 01                	test   $0x1,%al
+8010aba9:	74 ad                	je     8010ab58 <maploan+0x58>
+8010abab:	eb 91                	jmp    8010ab3e <maploan+0x3e>
+8010abad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+8010abb0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+8010abb5:	eb b0                	jmp    8010ab67 <maploan+0x67>
+8010abb7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010abbe:	66 90                	xchg   %ax,%ax
+
+8010abc0 <uva2ka>:
+
+//PAGEBREAK!
+// Map user virtual address to kernel address.
+char*
+uva2ka(pde_t *pgdir, char *uva)
+{
+8010abc0:	55                   	push   %ebp
+8010abc1:	89 e5                	mov    %esp,%ebp
+8010abc3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  if(*pde & PTE_P){
+8010abc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  pde = &pgdir[PDX(va)];
+8010abc9:	89 d1                	mov    %edx,%ecx
+8010abcb:	c1 e9 16             	shr    $0x16,%ecx
+  if(*pde & PTE_P){
+8010abce:	8b 0c 88             	mov    (%eax,%ecx,4),%ecx
+  pte_t *pte;
+
+  pte = walkpgdir(pgdir, uva, 0);
+  if(pte == 0 || (*pte & PTE_P) == 0)
+    return 0;
+8010abd1:	31 c0                	xor    %eax,%eax
+  if(*pde & PTE_P){
+8010abd3:	f6 c1 01             	test   $0x1,%cl
+8010abd6:	74 36                	je     8010ac0e <uva2ka+0x4e>
+  return &pgtab[PTX(va)];
+8010abd8:	c1 ea 0a             	shr    $0xa,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010abdb:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+  return &pgtab[PTX(va)];
+8010abe1:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010abe7:	8d 84 11 00 00 00 80 	lea    -0x80000000(%ecx,%edx,1),%eax
+  if(pte == 0 || (*pte & PTE_P) == 0)
+8010abee:	85 c0                	test   %eax,%eax
+8010abf0:	74 1c                	je     8010ac0e <uva2ka+0x4e>
+8010abf2:	8b 00                	mov    (%eax),%eax
+  if((*pte & PTE_U) == 0)
+8010abf4:	89 c2                	mov    %eax,%edx
+    return 0;
+  return (char*)P2V(PTE_ADDR(*pte));
+8010abf6:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  if((*pte & PTE_U) == 0)
+8010abfb:	83 e2 05             	and    $0x5,%edx
+  return (char*)P2V(PTE_ADDR(*pte));
+8010abfe:	05 00 00 00 80       	add    $0x80000000,%eax
+8010ac03:	83 fa 05             	cmp    $0x5,%edx
+8010ac06:	ba 00 00 00 00       	mov    $0x0,%edx
+8010ac0b:	0f 45 c2             	cmovne %edx,%eax
+}
+8010ac0e:	5d                   	pop    %ebp
+8010ac0f:	c3                   	ret
+
+8010ac10 <copyout>:
+// Copy len bytes from p to user address va in page table pgdir.
+// Most useful when pgdir is not the current page table.
+// uva2ka ensures this only works for PTE_U pages.
+int
+copyout(pde_t *pgdir, uint va, void *p, uint len)
+{
+8010ac10:	55                   	push   %ebp
+8010ac11:	89 e5                	mov    %esp,%ebp
+8010ac13:	57                   	push   %edi
+8010ac14:	56                   	push   %esi
+8010ac15:	53                   	push   %ebx
+8010ac16:	83 ec 1c             	sub    $0x1c,%esp
+8010ac19:	8b 7d 14             	mov    0x14(%ebp),%edi
+8010ac1c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *buf, *pa0;
+  uint n, va0;
+  pte_t *pte;
+
+  buf = (char*)p;
+  while(len > 0){
+8010ac1f:	85 ff                	test   %edi,%edi
+8010ac21:	0f 84 ef 00 00 00    	je     8010ad16 <copyout+0x106>
+8010ac27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010ac2e:	66 90                	xchg   %ax,%ax
+  pde = &pgdir[PDX(va)];
+8010ac30:	8b 4d 08             	mov    0x8(%ebp),%ecx
+8010ac33:	89 d8                	mov    %ebx,%eax
+    va0 = (uint)PGROUNDDOWN(va);
+8010ac35:	89 de                	mov    %ebx,%esi
+  pde = &pgdir[PDX(va)];
+8010ac37:	c1 e8 16             	shr    $0x16,%eax
+    va0 = (uint)PGROUNDDOWN(va);
+8010ac3a:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  pde = &pgdir[PDX(va)];
+8010ac40:	8d 14 81             	lea    (%ecx,%eax,4),%edx
+  if(*pde & PTE_P){
+8010ac43:	8b 02                	mov    (%edx),%eax
+8010ac45:	a8 01                	test   $0x1,%al
+8010ac47:	74 2a                	je     8010ac73 <copyout+0x63>
+  return &pgtab[PTX(va)];
+8010ac49:	89 f1                	mov    %esi,%ecx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010ac4b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010ac50:	c1 e9 0a             	shr    $0xa,%ecx
+8010ac53:	81 e1 fc 0f 00 00    	and    $0xffc,%ecx
+8010ac59:	8d 8c 08 00 00 00 80 	lea    -0x80000000(%eax,%ecx,1),%ecx
+    // The write goes through the kernel mapping, so it would
+    // not fault; break copy-on-write sharing by hand.
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if(pte && (*pte & PTE_COW) && cowfault(pgdir, va0) < 0)
+8010ac60:	85 c9                	test   %ecx,%ecx
+8010ac62:	74 0f                	je     8010ac73 <copyout+0x63>
+8010ac64:	8b 01                	mov    (%ecx),%eax
+8010ac66:	f6 c4 02             	test   $0x2,%ah
+8010ac69:	0f 85 b1 00 00 00    	jne    8010ad20 <copyout+0x110>
+      return -1;
+    // Nor would an untouched heap page; fill it in.
+    if((pte == 0 || !(*pte & PTE_P)) && pgdir == myproc()->pgdir &&
+8010ac6f:	a8 01                	test   $0x1,%al
+8010ac71:	75 48                	jne    8010acbb <copyout+0xab>
+8010ac73:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010ac76:	e8 05 b1 ff ff       	call   80105d80 <myproc>
+8010ac7b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+8010ac7e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010ac81:	39 48 04             	cmp    %ecx,0x4(%eax)
+8010ac84:	0f 84 ce 00 00 00    	je     8010ad58 <copyout+0x148>
+  if(*pde & PTE_P){
+8010ac8a:	8b 02                	mov    (%edx),%eax
+8010ac8c:	a8 01                	test   $0x1,%al
+8010ac8e:	75 10                	jne    8010aca0 <copyout+0x90>
+    len -= n;
+    buf += n;
+    va = va0 + PGSIZE;
+  }
+  return 0;
+}
+8010ac90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return -1;
+8010ac93:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+8010ac98:	5b                   	pop    %ebx
+8010ac99:	5e                   	pop    %esi
+8010ac9a:	5f                   	pop    %edi
+8010ac9b:	5d                   	pop    %ebp
+8010ac9c:	c3                   	ret
+8010ac9d:	8d 76 00             	lea    0x0(%esi),%esi
+  return &pgtab[PTX(va)];
+8010aca0:	89 f2                	mov    %esi,%edx
+    pgtab = (pte_t*)P2V(PTE_ADDR(*pde));
+8010aca2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  return &pgtab[PTX(va)];
+8010aca7:	c1 ea 0a             	shr    $0xa,%edx
+8010acaa:	81 e2 fc 0f 00 00    	and    $0xffc,%edx
+8010acb0:	8d 8c 10 00 00 00 80 	lea    -0x80000000(%eax,%edx,1),%ecx
+  if(pte == 0 || (*pte & PTE_P) == 0)
+8010acb7:	85 c9                	test   %ecx,%ecx
+8010acb9:	74 d5                	je     8010ac90 <copyout+0x80>
+8010acbb:	8b 01                	mov    (%ecx),%eax
+  if((*pte & PTE_U) == 0)
+8010acbd:	89 c2                	mov    %eax,%edx
+8010acbf:	83 e2 05             	and    $0x5,%edx
+8010acc2:	83 fa 05             	cmp    $0x5,%edx
+8010acc5:	75 c9                	jne    8010ac90 <copyout+0x80>
+  return (char*)P2V(PTE_ADDR(*pte));
+8010acc7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+8010accc:	89 c2                	mov    %eax,%edx
+8010acce:	8d 80 00 00 00 80    	lea    -0x80000000(%eax),%eax
+    if(pa0 == 0)
+8010acd4:	81 fa 00 00 00 80    	cmp    $0x80000000,%edx
+8010acda:	74 b4                	je     8010ac90 <copyout+0x80>
+    n = PGSIZE - (va - va0);
+8010acdc:	89 f2                	mov    %esi,%edx
+8010acde:	29 da                	sub    %ebx,%edx
+8010ace0:	81 c2 00 10 00 00    	add    $0x1000,%edx
+8010ace6:	39 fa                	cmp    %edi,%edx
+8010ace8:	0f 47 d7             	cmova  %edi,%edx
+    memmove(pa0 + (va - va0), buf, n);
+8010aceb:	29 f3                	sub    %esi,%ebx
+8010aced:	83 ec 04             	sub    $0x4,%esp
+8010acf0:	01 d8                	add    %ebx,%eax
+    va = va0 + PGSIZE;
+8010acf2:	8d 9e 00 10 00 00    	lea    0x1000(%esi),%ebx
+    memmove(pa0 + (va - va0), buf, n);
+8010acf8:	52                   	push   %edx
+8010acf9:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010acfc:	ff 75 10             	push   0x10(%ebp)
+8010acff:	50                   	push   %eax
+8010ad00:	e8 bb c9 ff ff       	call   801076c0 <memmove>
+    buf += n;
+8010ad05:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  while(len > 0){
+8010ad08:	83 c4 10             	add    $0x10,%esp
+    buf += n;
+8010ad0b:	01 55 10             	add    %edx,0x10(%ebp)
+  while(len > 0){
+8010ad0e:	29 d7                	sub    %edx,%edi
+8010ad10:	0f 85 1a ff ff ff    	jne    8010ac30 <copyout+0x20>
+}
+8010ad16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+8010ad19:	31 c0                	xor    %eax,%eax
+}
+8010ad1b:	5b                   	pop    %ebx
+8010ad1c:	5e                   	pop    %esi
+8010ad1d:	5f                   	pop    %edi
+8010ad1e:	5d                   	pop    %ebp
+8010ad1f:	c3                   	ret
+    if(pte && (*pte & PTE_COW) && cowfault(pgdir, va0) < 0)
+8010ad20:	83 ec 08             	sub    $0x8,%esp
+8010ad23:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+8010ad26:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+8010ad29:	56                   	push   %esi
+8010ad2a:	ff 75 08             	push   0x8(%ebp)
+8010ad2d:	e8 7e fa ff ff       	call   8010a7b0 <cowfault>
+8010ad32:	83 c4 10             	add    $0x10,%esp
+8010ad35:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010ad38:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+8010ad3b:	85 c0                	test   %eax,%eax
+8010ad3d:	0f 88 4d ff ff ff    	js     8010ac90 <copyout+0x80>
+    if((pte == 0 || !(*pte & PTE_P)) && pgdir == myproc()->pgdir &&
+8010ad43:	f6 01 01             	testb  $0x1,(%ecx)
+8010ad46:	0f 84 27 ff ff ff    	je     8010ac73 <copyout+0x63>
+8010ad4c:	e9 39 ff ff ff       	jmp    8010ac8a <copyout+0x7a>
+8010ad51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010ad58:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+       lazyfault(pgdir, myproc()->sz, va0) < 0)
+8010ad5b:	e8 20 b0 ff ff       	call   80105d80 <myproc>
+8010ad60:	83 ec 04             	sub    $0x4,%esp
+8010ad63:	56                   	push   %esi
+8010ad64:	ff 30                	push   (%eax)
+8010ad66:	ff 75 08             	push   0x8(%ebp)
+8010ad69:	e8 c2 fb ff ff       	call   8010a930 <lazyfault>
+    if((pte == 0 || !(*pte & PTE_P)) && pgdir == myproc()->pgdir &&
+8010ad6e:	83 c4 10             	add    $0x10,%esp
+8010ad71:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+8010ad74:	85 c0                	test   %eax,%eax
+8010ad76:	0f 89 0e ff ff ff    	jns    8010ac8a <copyout+0x7a>
+8010ad7c:	e9 0f ff ff ff       	jmp    8010ac90 <copyout+0x80>
+8010ad81:	66 90                	xchg   %ax,%ax
+8010ad83:	66 90                	xchg   %ax,%ax
+8010ad85:	66 90                	xchg   %ax,%ax
+8010ad87:	66 90                	xchg   %ax,%ax
+8010ad89:	66 90                	xchg   %ax,%ax
+8010ad8b:	66 90                	xchg   %ax,%ax
+8010ad8d:	66 90                	xchg   %ax,%ax
+8010ad8f:	90                   	nop
+
+8010ad90 <ideinit>:
+static uchar *memdisk;
+
+void
+ideinit(void)
+{
+  memdisk = _binary_fs_img_start;
+8010ad90:	c7 05 08 2b 91 80 16 	movl   $0x8010e516,0x80912b08
+8010ad97:	e5 10 80 
+  disksize = (uint)_binary_fs_img_size/BSIZE;
+8010ad9a:	b8 00 00 7d 00       	mov    $0x7d0000,%eax
+8010ad9f:	c1 e8 0c             	shr    $0xc,%eax
+8010ada2:	a3 0c 2b 91 80       	mov    %eax,0x80912b0c
+}
+8010ada7:	c3                   	ret
+8010ada8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010adaf:	90                   	nop
+
+8010adb0 <ideintr>:
+// Interrupt handler.
+void
+ideintr(void)
+{
+  // no-op
+}
+8010adb0:	c3                   	ret
+8010adb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010adb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010adbf:	90                   	nop
+
+8010adc0 <iderw>:
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+8010adc0:	55                   	push   %ebp
+8010adc1:	89 e5                	mov    %esp,%ebp
+8010adc3:	53                   	push   %ebx
+8010adc4:	83 ec 10             	sub    $0x10,%esp
+8010adc7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  uchar *p;
+
+  if(!holdingsleep(&b->lock))
+8010adca:	8d 43 0c             	lea    0xc(%ebx),%eax
+8010adcd:	50                   	push   %eax
+8010adce:	e8 4d c5 ff ff       	call   80107320 <holdingsleep>
+8010add3:	83 c4 10             	add    $0x10,%esp
+8010add6:	85 c0                	test   %eax,%eax
+8010add8:	0f 84 98 00 00 00    	je     8010ae76 <iderw+0xb6>
+    panic("iderw: buf not locked");
+  if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
+8010adde:	8b 13                	mov    (%ebx),%edx
+8010ade0:	89 d0                	mov    %edx,%eax
+8010ade2:	83 e0 06             	and    $0x6,%eax
+8010ade5:	83 f8 02             	cmp    $0x2,%eax
+8010ade8:	74 7f                	je     8010ae69 <iderw+0xa9>
+    panic("iderw: nothing to do");
+  if(b->dev != 1)
+8010adea:	83 7b 04 01          	cmpl   $0x1,0x4(%ebx)
+8010adee:	75 6c                	jne    8010ae5c <iderw+0x9c>
+    panic("iderw: request not for disk 1");
+  if(b->blockno >= disksize)
+8010adf0:	8b 43 08             	mov    0x8(%ebx),%eax
+8010adf3:	3b 05 0c 2b 91 80    	cmp    0x80912b0c,%eax
+8010adf9:	73 54                	jae    8010ae4f <iderw+0x8f>
+    panic("iderw: block out of range");
+
+  p = memdisk + b->blockno*BSIZE;
+8010adfb:	c1 e0 0c             	shl    $0xc,%eax
+
+  if(b->flags & B_DIRTY){
+    b->flags &= ~B_DIRTY;
+    memmove(p, b->data, BSIZE);
+8010adfe:	8b 4b 60             	mov    0x60(%ebx),%ecx
+  p = memdisk + b->blockno*BSIZE;
+8010ae01:	03 05 08 2b 91 80    	add    0x80912b08,%eax
+  if(b->flags & B_DIRTY){
+8010ae07:	f6 c2 04             	test   $0x4,%dl
+8010ae0a:	75 24                	jne    8010ae30 <iderw+0x70>
+  } else
+    memmove(b->data, p, BSIZE);
+8010ae0c:	83 ec 04             	sub    $0x4,%esp
+8010ae0f:	68 00 10 00 00       	push   $0x1000
+8010ae14:	50                   	push   %eax
+8010ae15:	51                   	push   %ecx
+8010ae16:	e8 a5 c8 ff ff       	call   801076c0 <memmove>
+  b->flags |= B_VALID;
+8010ae1b:	83 0b 02             	orl    $0x2,(%ebx)
+    memmove(b->data, p, BSIZE);
+8010ae1e:	83 c4 10             	add    $0x10,%esp
+}
+8010ae21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010ae24:	c9                   	leave
+8010ae25:	c3                   	ret
+8010ae26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010ae2d:	8d 76 00             	lea    0x0(%esi),%esi
+    memmove(p, b->data, BSIZE);
+8010ae30:	83 ec 04             	sub    $0x4,%esp
+    b->flags &= ~B_DIRTY;
+8010ae33:	83 e2 fb             	and    $0xfffffffb,%edx
+8010ae36:	89 13                	mov    %edx,(%ebx)
+    memmove(p, b->data, BSIZE);
+8010ae38:	68 00 10 00 00       	push   $0x1000
+8010ae3d:	51                   	push   %ecx
+8010ae3e:	50                   	push   %eax
+8010ae3f:	e8 7c c8 ff ff       	call   801076c0 <memmove>
+  b->flags |= B_VALID;
+8010ae44:	83 0b 02             	orl    $0x2,(%ebx)
+8010ae47:	83 c4 10             	add    $0x10,%esp
+}
+8010ae4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010ae4d:	c9                   	leave
+8010ae4e:	c3                   	ret
+    panic("iderw: block out of range");
+8010ae4f:	83 ec 0c             	sub    $0xc,%esp
+8010ae52:	68 9c b9 10 80       	push   $0x8010b99c
+8010ae57:	e8 24 5a ff ff       	call   80100880 <panic>
+    panic("iderw: request not for disk 1");
+8010ae5c:	83 ec 0c             	sub    $0xc,%esp
+8010ae5f:	68 7e b9 10 80       	push   $0x8010b97e
+8010ae64:	e8 17 5a ff ff       	call   80100880 <panic>
+    panic("iderw: nothing to do");
+8010ae69:	83 ec 0c             	sub    $0xc,%esp
+8010ae6c:	68 69 b9 10 80       	push   $0x8010b969
+8010ae71:	e8 0a 5a ff ff       	call   80100880 <panic>
+    panic("iderw: buf not locked");
+8010ae76:	83 ec 0c             	sub    $0xc,%esp
+8010ae79:	68 53 b9 10 80       	push   $0x8010b953
+8010ae7e:	e8 fd 59 ff ff       	call   80100880 <panic>
+8010ae83:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010ae8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+8010ae90 <iderwasync>:
+
+// The memory disk has no latency to hide: do the read now.
+void
+iderwasync(struct buf *b)
+{
+8010ae90:	55                   	push   %ebp
+8010ae91:	89 e5                	mov    %esp,%ebp
+8010ae93:	53                   	push   %ebx
+8010ae94:	83 ec 10             	sub    $0x10,%esp
+8010ae97:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  iderw(b);
+8010ae9a:	53                   	push   %ebx
+8010ae9b:	e8 20 ff ff ff       	call   8010adc0 <iderw>
+  b->flags &= ~B_ASYNC;
+8010aea0:	83 23 f7             	andl   $0xfffffff7,(%ebx)
+  bdone(b);
+8010aea3:	83 c4 10             	add    $0x10,%esp
+8010aea6:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+8010aea9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+8010aeac:	c9                   	leave
+  bdone(b);
+8010aead:	e9 3e 58 ff ff       	jmp    801006f0 <bdone>
+8010aeb2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+8010aeb9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+8010aec0 <iderwv>:
+
+void
+iderwv(struct buf **bp, int n)
+{
+8010aec0:	55                   	push   %ebp
+8010aec1:	89 e5                	mov    %esp,%ebp
+8010aec3:	57                   	push   %edi
+8010aec4:	56                   	push   %esi
+8010aec5:	53                   	push   %ebx
+8010aec6:	83 ec 0c             	sub    $0xc,%esp
+8010aec9:	8b 75 0c             	mov    0xc(%ebp),%esi
+8010aecc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i;
+
+  for(i = 0; i < n; i++)
+8010aecf:	85 f6                	test   %esi,%esi
+8010aed1:	7e 1a                	jle    8010aeed <iderwv+0x2d>
+8010aed3:	31 db                	xor    %ebx,%ebx
+8010aed5:	8d 76 00             	lea    0x0(%esi),%esi
+    iderw(bp[i]);
+8010aed8:	83 ec 0c             	sub    $0xc,%esp
+8010aedb:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i = 0; i < n; i++)
+8010aede:	83 c3 01             	add    $0x1,%ebx
+    iderw(bp[i]);
+8010aee1:	e8 da fe ff ff       	call   8010adc0 <iderw>
+  for(i = 0; i < n; i++)
+8010aee6:	83 c4 10             	add    $0x10,%esp
+8010aee9:	39 de                	cmp    %ebx,%esi
+8010aeeb:	75 eb                	jne    8010aed8 <iderwv+0x18>
+}
+8010aeed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+8010aef0:	5b                   	pop    %ebx
+8010aef1:	5e                   	pop    %esi
+8010aef2:	5f                   	pop    %edi
+8010aef3:	5d                   	pop    %ebp
+8010aef4:	c3                   	ret
@@ -41,8 +41,19 @@
 #define TCCR    (0x0390/4)   // Timer Current Count
 #define TDCR    (0x03E0/4)   // Timer Divide Configuration
 
+// The PIT, used only to calibrate the timer and the TSC.
+#define PIT_HZ       1193182
+#define PIT_CH2      0x42     // channel 2 counter
+#define PIT_MODE     0x43
+#define PIT_GATE     0x61     // bit 0: channel 2 gate; bit 5: its output
+#define CALIBMS      10       // calibration period, in ms
+
 volatile uint *lapic;  // Initialized in mp.c
 
+static uint lapictick;  // timer counts per tick
+static uint tscperms;   // TSC cycles per ms
+static uint64 tsc0;     // TSC at calibration: time 0
+
 //PAGEBREAK!
 static void
 lapicw(int index, int value)
@@ -51,6 +62,111 @@ lapicw(int index, int value)
   lapic[ID];  // wait for write to finish, by reading
 }
 
+// Time CALIBMS ms on PIT channel 2, with the speaker off,
+// and see how far the timer and TSC count meanwhile.
+static void
+calibrate(void)
+{
+  uint n;
+  uint64 t;
+  uchar gate;
+
+  gate = inb(PIT_GATE) & ~0x03;
+  outb(PIT_GATE, gate);
+  outb(PIT_MODE, 0xb0);  // channel 2, low then high byte, mode 0
+  n = PIT_HZ * CALIBMS / 1000;
+  outb(PIT_CH2, n & 0xff);
+  outb(PIT_CH2, n >> 8);
+
+  lapicw(TIMER, MASKED);
+  lapicw(TICR, 0xffffffff);
+  t = rdtsc();
+  outb(PIT_GATE, gate | 0x01);  // start counting
+  while((inb(PIT_GATE) & 0x20) == 0)
+    ;
+  n = 0xffffffff - lapic[TCCR];
+  t = rdtsc() - t;
+  lapicw(TICR, 0);
+
+  lapictick = n * (1000/HZ) / CALIBMS;
+  tscperms = (uint)t / CALIBMS;
+  if(lapictick == 0)
+    lapictick = 10000000;
+  if(tscperms == 0)
+    tscperms = 1000000;
+  tsc0 = rdtsc();
+}
+
+// Interrupt every tick if n is 0, else just once, n ticks
+// from now.
+void
+lapictimer(uint n)
+{
+  if(!lapic)
+    return;
+  if(n == 0){
+    lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
+    lapicw(TICR, lapictick);
+    return;
+  }
+  if(n > 0xffffffff / lapictick)
+    n = 0xffffffff / lapictick;
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+  lapicw(TICR, n * lapictick);
+}
+
+// Send interrupt vector to the CPU whose local APIC id is
+// apicid. Caller must have interrupts off.
+void
+lapicipi(int apicid, int vector)
+{
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | vector);
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
+
+// Divide n by d using 32-bit divides; the kernel is not
+// linked with libgcc.
+static uint64
+div64(uint64 n, uint d, uint *rem)
+{
+  uint hi, lo, r;
+
+  hi = n >> 32;
+  lo = n;
+  r = hi % d;
+  hi = hi / d;
+  asm("divl %2" : "+a" (lo), "+d" (r) : "rm" (d));
+  if(rem)
+    *rem = r;
+  return (uint64)hi << 32 | lo;
+}
+
+// Nanoseconds since boot, from the TSC.
+uint64
+nsecs(void)
+{
+  uint64 ms;
+  uint r;
+
+  if(tscperms == 0)
+    return 0;
+  ms = div64(rdtsc() - tsc0, tscperms, &r);
+  return ms * 1000000 + div64((uint64)r * 1000000, tscperms, 0);
+}
+
+// Ticks since boot, from the TSC. Unlike counting timer
+// interrupts, this stays right when CPUs leave their
+// timers off while idle.
+uint
+clockticks(void)
+{
+  if(tscperms == 0)
+    return 0;
+  return (uint)div64(rdtsc() - tsc0, tscperms, 0) / (1000/HZ);
+}
+
 void
 lapicinit(void)
 {
@@ -62,11 +178,12 @@ lapicinit(void)
 
   // The timer repeatedly counts down at bus frequency
   // from lapic[TICR] and then issues an interrupt.
-  // If xv6 cared more about precise timekeeping,
-  // TICR would be calibrated using an external time source.
+  // The first CPU up measures the bus frequency, so
+  // that TICR gives HZ interrupts a second.
   lapicw(TDCR, X1);
-  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000);
+  if(lapictick == 0)
+    calibrate();
+  lapictimer(0);
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -0,0 +1,1759 @@
+
+_latbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+    x++;
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	81 ec 88 00 00 00    	sub    $0x88,%esp
+  17:	8b 19                	mov    (%ecx),%ebx
+  19:	8b 71 04             	mov    0x4(%ecx),%esi
+  int pids[MAXHOGS], i, n, start;
+  uint lat, sum, max;
+  struct pstat st;
+  uint64 t0, t1;
+
+  if(argc > 1) nhogs = atoi(argv[1]);
+  1c:	83 fb 01             	cmp    $0x1,%ebx
+  1f:	7f 6f                	jg     90 <main+0x90>
+  if(argc > 2) dur = atoi(argv[2]);
+  if(nhogs > MAXHOGS)
+    nhogs = MAXHOGS;
+
+  printf(1, "\n[LATBENCH] %d hogs, %d ticks\n", nhogs, dur);
+  21:	68 2c 01 00 00       	push   $0x12c
+  if(nhogs > MAXHOGS)
+  26:	bb 03 00 00 00       	mov    $0x3,%ebx
+  printf(1, "\n[LATBENCH] %d hogs, %d ticks\n", nhogs, dur);
+  2b:	6a 03                	push   $0x3
+  2d:	68 a0 0c 00 00       	push   $0xca0
+  32:	6a 01                	push   $0x1
+  34:	e8 07 06 00 00       	call   640 <printf>
+  39:	83 c4 10             	add    $0x10,%esp
+  int nhogs = 3, dur = 300;
+  3c:	c7 85 74 ff ff ff 2c 	movl   $0x12c,-0x8c(%ebp)
+  43:	01 00 00 
+  46:	c7 85 6c ff ff ff 03 	movl   $0x3,-0x94(%ebp)
+  4d:	00 00 00 
+
+  for(i = 0; i < nhogs; i++){
+  50:	31 ff                	xor    %edi,%edi
+  52:	8d 75 90             	lea    -0x70(%ebp),%esi
+  55:	eb 1a                	jmp    71 <main+0x71>
+  57:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5e:	66 90                	xchg   %ax,%ax
+    if((pids[i] = fork()) < 0){
+      printf(2, "latbench: fork failed\n");
+      exit();
+    }
+    if(pids[i] == 0)
+  60:	0f 84 81 01 00 00    	je     1e7 <main+0x1e7>
+  for(i = 0; i < nhogs; i++){
+  66:	83 c7 01             	add    $0x1,%edi
+  69:	39 fb                	cmp    %edi,%ebx
+  6b:	0f 8e 84 00 00 00    	jle    f5 <main+0xf5>
+    if((pids[i] = fork()) < 0){
+  71:	e8 45 04 00 00       	call   4bb <fork>
+  76:	89 04 be             	mov    %eax,(%esi,%edi,4)
+  79:	85 c0                	test   %eax,%eax
+  7b:	79 e3                	jns    60 <main+0x60>
+      printf(2, "latbench: fork failed\n");
+  7d:	53                   	push   %ebx
+  7e:	53                   	push   %ebx
+  7f:	68 00 0d 00 00       	push   $0xd00
+  84:	6a 02                	push   $0x2
+  86:	e8 b5 05 00 00       	call   640 <printf>
+      exit();
+  8b:	e8 33 04 00 00       	call   4c3 <exit>
+  if(argc > 1) nhogs = atoi(argv[1]);
+  90:	83 ec 0c             	sub    $0xc,%esp
+  93:	ff 76 04             	push   0x4(%esi)
+  96:	e8 b5 03 00 00       	call   450 <atoi>
+  if(argc > 2) dur = atoi(argv[2]);
+  9b:	83 c4 10             	add    $0x10,%esp
+  int nhogs = 3, dur = 300;
+  9e:	c7 85 74 ff ff ff 2c 	movl   $0x12c,-0x8c(%ebp)
+  a5:	01 00 00 
+  if(argc > 1) nhogs = atoi(argv[1]);
+  a8:	89 85 6c ff ff ff    	mov    %eax,-0x94(%ebp)
+  if(argc > 2) dur = atoi(argv[2]);
+  ae:	83 fb 02             	cmp    $0x2,%ebx
+  b1:	74 14                	je     c7 <main+0xc7>
+  b3:	83 ec 0c             	sub    $0xc,%esp
+  b6:	ff 76 08             	push   0x8(%esi)
+  b9:	e8 92 03 00 00       	call   450 <atoi>
+  be:	83 c4 10             	add    $0x10,%esp
+  c1:	89 85 74 ff ff ff    	mov    %eax,-0x8c(%ebp)
+  if(nhogs > MAXHOGS)
+  c7:	8b b5 6c ff ff ff    	mov    -0x94(%ebp),%esi
+  cd:	bb 08 00 00 00       	mov    $0x8,%ebx
+  printf(1, "\n[LATBENCH] %d hogs, %d ticks\n", nhogs, dur);
+  d2:	ff b5 74 ff ff ff    	push   -0x8c(%ebp)
+  if(nhogs > MAXHOGS)
+  d8:	39 de                	cmp    %ebx,%esi
+  da:	0f 4e de             	cmovle %esi,%ebx
+  printf(1, "\n[LATBENCH] %d hogs, %d ticks\n", nhogs, dur);
+  dd:	53                   	push   %ebx
+  de:	68 a0 0c 00 00       	push   $0xca0
+  e3:	6a 01                	push   $0x1
+  e5:	e8 56 05 00 00       	call   640 <printf>
+  for(i = 0; i < nhogs; i++){
+  ea:	83 c4 10             	add    $0x10,%esp
+  ed:	85 f6                	test   %esi,%esi
+  ef:	0f 8f 5b ff ff ff    	jg     50 <main+0x50>
+      hog();
+  }
+
+  n = 0;
+  sum = max = 0;
+  start = uptime();
+  f5:	e8 61 04 00 00       	call   55b <uptime>
+  sum = max = 0;
+  fa:	31 c9                	xor    %ecx,%ecx
+  fc:	89 9d 68 ff ff ff    	mov    %ebx,-0x98(%ebp)
+ 102:	31 ff                	xor    %edi,%edi
+  start = uptime();
+ 104:	89 c6                	mov    %eax,%esi
+  n = 0;
+ 106:	31 c0                	xor    %eax,%eax
+ 108:	89 b5 70 ff ff ff    	mov    %esi,-0x90(%ebp)
+ 10e:	89 c3                	mov    %eax,%ebx
+ 110:	89 ce                	mov    %ecx,%esi
+  while(uptime() - start < dur){
+ 112:	eb 44                	jmp    158 <main+0x158>
+ 114:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    uptimens(&t0);
+ 118:	83 ec 0c             	sub    $0xc,%esp
+ 11b:	8d 45 80             	lea    -0x80(%ebp),%eax
+ 11e:	50                   	push   %eax
+ 11f:	e8 5f 04 00 00       	call   583 <uptimens>
+    sleep(1);
+ 124:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+ 12b:	e8 23 04 00 00       	call   553 <sleep>
+    uptimens(&t1);
+ 130:	8d 45 88             	lea    -0x78(%ebp),%eax
+ 133:	89 04 24             	mov    %eax,(%esp)
+ 136:	e8 48 04 00 00       	call   583 <uptimens>
+    lat = (uint)(t1 - t0) / 1000;    // microseconds
+ 13b:	8b 55 88             	mov    -0x78(%ebp),%edx
+ 13e:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+ 143:	2b 55 80             	sub    -0x80(%ebp),%edx
+ 146:	f7 e2                	mul    %edx
+ 148:	c1 ea 06             	shr    $0x6,%edx
+    sum += lat;
+ 14b:	01 d6                	add    %edx,%esi
+    if(lat > max)
+ 14d:	39 d7                	cmp    %edx,%edi
+ 14f:	0f 42 fa             	cmovb  %edx,%edi
+      max = lat;
+    n++;
+ 152:	83 c3 01             	add    $0x1,%ebx
+ 155:	83 c4 10             	add    $0x10,%esp
+  while(uptime() - start < dur){
+ 158:	e8 fe 03 00 00       	call   55b <uptime>
+ 15d:	8b 8d 70 ff ff ff    	mov    -0x90(%ebp),%ecx
+ 163:	29 c8                	sub    %ecx,%eax
+ 165:	8b 8d 74 ff ff ff    	mov    -0x8c(%ebp),%ecx
+ 16b:	39 c8                	cmp    %ecx,%eax
+ 16d:	7c a9                	jl     118 <main+0x118>
+  }
+
+  if(pidstat(getpid(), &st) == 0)
+ 16f:	89 9d 74 ff ff ff    	mov    %ebx,-0x8c(%ebp)
+ 175:	8b 9d 68 ff ff ff    	mov    -0x98(%ebp),%ebx
+ 17b:	89 b5 70 ff ff ff    	mov    %esi,-0x90(%ebp)
+ 181:	8d 75 b0             	lea    -0x50(%ebp),%esi
+ 184:	e8 ba 03 00 00       	call   543 <getpid>
+ 189:	52                   	push   %edx
+ 18a:	52                   	push   %edx
+ 18b:	56                   	push   %esi
+ 18c:	50                   	push   %eax
+ 18d:	e8 de 07 00 00       	call   970 <pidstat>
+ 192:	83 c4 10             	add    $0x10,%esp
+ 195:	85 c0                	test   %eax,%eax
+ 197:	0f 84 b4 00 00 00    	je     251 <main+0x251>
+    printf(1, "[LATBENCH] sleeper level %d\n", st.prio);
+  if(nhogs > 0 && pidstat(pids[0], &st) == 0)
+ 19d:	83 bd 6c ff ff ff 00 	cmpl   $0x0,-0x94(%ebp)
+ 1a4:	7f 55                	jg     1fb <main+0x1fb>
+  for(i = 0; i < nhogs; i++)
+    kill(pids[i]);
+  for(i = 0; i < nhogs; i++)
+    wait();
+
+  if(n == 0)
+ 1a6:	83 bd 74 ff ff ff 00 	cmpl   $0x0,-0x8c(%ebp)
+ 1ad:	75 0a                	jne    1b9 <main+0x1b9>
+    n = 1;
+ 1af:	c7 85 74 ff ff ff 01 	movl   $0x1,-0x8c(%ebp)
+ 1b6:	00 00 00 
+  printf(1, "[LATBENCH] %d sleeps: avg %d us, max %d us (one tick is %d us)\n",
+ 1b9:	50                   	push   %eax
+ 1ba:	31 d2                	xor    %edx,%edx
+ 1bc:	50                   	push   %eax
+ 1bd:	68 10 27 00 00       	push   $0x2710
+ 1c2:	57                   	push   %edi
+ 1c3:	8b 85 70 ff ff ff    	mov    -0x90(%ebp),%eax
+ 1c9:	8b 8d 74 ff ff ff    	mov    -0x8c(%ebp),%ecx
+ 1cf:	f7 f1                	div    %ecx
+ 1d1:	50                   	push   %eax
+ 1d2:	51                   	push   %ecx
+ 1d3:	68 c0 0c 00 00       	push   $0xcc0
+ 1d8:	6a 01                	push   $0x1
+ 1da:	e8 61 04 00 00       	call   640 <printf>
+         n, sum / n, max, 1000000 / HZ);
+  exit();
+ 1df:	83 c4 20             	add    $0x20,%esp
+ 1e2:	e8 dc 02 00 00       	call   4c3 <exit>
+  volatile uint x = 0;
+ 1e7:	31 c9                	xor    %ecx,%ecx
+ 1e9:	89 4d b0             	mov    %ecx,-0x50(%ebp)
+ 1ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    x++;
+ 1f0:	8b 45 b0             	mov    -0x50(%ebp),%eax
+ 1f3:	83 c0 01             	add    $0x1,%eax
+ 1f6:	89 45 b0             	mov    %eax,-0x50(%ebp)
+  for(;;)
+ 1f9:	eb f5                	jmp    1f0 <main+0x1f0>
+  if(nhogs > 0 && pidstat(pids[0], &st) == 0)
+ 1fb:	51                   	push   %ecx
+ 1fc:	51                   	push   %ecx
+ 1fd:	56                   	push   %esi
+ 1fe:	ff 75 90             	push   -0x70(%ebp)
+ 201:	e8 6a 07 00 00       	call   970 <pidstat>
+ 206:	83 c4 10             	add    $0x10,%esp
+ 209:	85 c0                	test   %eax,%eax
+ 20b:	74 5c                	je     269 <main+0x269>
+  n = 0;
+ 20d:	31 d2                	xor    %edx,%edx
+ 20f:	89 bd 6c ff ff ff    	mov    %edi,-0x94(%ebp)
+ 215:	8d 75 90             	lea    -0x70(%ebp),%esi
+ 218:	89 d7                	mov    %edx,%edi
+ 21a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    kill(pids[i]);
+ 220:	83 ec 0c             	sub    $0xc,%esp
+ 223:	ff 34 be             	push   (%esi,%edi,4)
+  for(i = 0; i < nhogs; i++)
+ 226:	83 c7 01             	add    $0x1,%edi
+    kill(pids[i]);
+ 229:	e8 c5 02 00 00       	call   4f3 <kill>
+  for(i = 0; i < nhogs; i++)
+ 22e:	83 c4 10             	add    $0x10,%esp
+ 231:	39 fb                	cmp    %edi,%ebx
+ 233:	7f eb                	jg     220 <main+0x220>
+  for(i = 0; i < nhogs; i++)
+ 235:	8b bd 6c ff ff ff    	mov    -0x94(%ebp),%edi
+ 23b:	31 f6                	xor    %esi,%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+    wait();
+ 240:	e8 86 02 00 00       	call   4cb <wait>
+  for(i = 0; i < nhogs; i++)
+ 245:	83 c6 01             	add    $0x1,%esi
+ 248:	39 f3                	cmp    %esi,%ebx
+ 24a:	7f f4                	jg     240 <main+0x240>
+ 24c:	e9 55 ff ff ff       	jmp    1a6 <main+0x1a6>
+    printf(1, "[LATBENCH] sleeper level %d\n", st.prio);
+ 251:	50                   	push   %eax
+ 252:	ff 75 d0             	push   -0x30(%ebp)
+ 255:	68 17 0d 00 00       	push   $0xd17
+ 25a:	6a 01                	push   $0x1
+ 25c:	e8 df 03 00 00       	call   640 <printf>
+ 261:	83 c4 10             	add    $0x10,%esp
+ 264:	e9 34 ff ff ff       	jmp    19d <main+0x19d>
+    printf(1, "[LATBENCH] hog level %d\n", st.prio);
+ 269:	52                   	push   %edx
+ 26a:	ff 75 d0             	push   -0x30(%ebp)
+ 26d:	68 34 0d 00 00       	push   $0xd34
+ 272:	6a 01                	push   $0x1
+ 274:	e8 c7 03 00 00       	call   640 <printf>
+ 279:	83 c4 10             	add    $0x10,%esp
+ 27c:	eb 8f                	jmp    20d <main+0x20d>
+ 27e:	66 90                	xchg   %ax,%ax
+
+00000280 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 280:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 281:	31 c0                	xor    %eax,%eax
+{
+ 283:	89 e5                	mov    %esp,%ebp
+ 285:	53                   	push   %ebx
+ 286:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 289:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 290:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 294:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 297:	83 c0 01             	add    $0x1,%eax
+ 29a:	84 d2                	test   %dl,%dl
+ 29c:	75 f2                	jne    290 <strcpy+0x10>
+    ;
+  return os;
+}
+ 29e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2a1:	89 c8                	mov    %ecx,%eax
+ 2a3:	c9                   	leave
+ 2a4:	c3                   	ret
+ 2a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	53                   	push   %ebx
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2ba:	0f b6 02             	movzbl (%edx),%eax
+ 2bd:	84 c0                	test   %al,%al
+ 2bf:	75 17                	jne    2d8 <strcmp+0x28>
+ 2c1:	eb 3a                	jmp    2fd <strcmp+0x4d>
+ 2c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c7:	90                   	nop
+ 2c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2cc:	83 c2 01             	add    $0x1,%edx
+ 2cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2d2:	84 c0                	test   %al,%al
+ 2d4:	74 1a                	je     2f0 <strcmp+0x40>
+    p++, q++;
+ 2d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2d8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2db:	38 c3                	cmp    %al,%bl
+ 2dd:	74 e9                	je     2c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2df:	29 d8                	sub    %ebx,%eax
+}
+ 2e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2e4:	c9                   	leave
+ 2e5:	c3                   	ret
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2f4:	31 c0                	xor    %eax,%eax
+ 2f6:	29 d8                	sub    %ebx,%eax
+}
+ 2f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2fb:	c9                   	leave
+ 2fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 300:	31 c0                	xor    %eax,%eax
+ 302:	eb db                	jmp    2df <strcmp+0x2f>
+ 304:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+
+00000310 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 316:	80 3a 00             	cmpb   $0x0,(%edx)
+ 319:	74 15                	je     330 <strlen+0x20>
+ 31b:	31 c0                	xor    %eax,%eax
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+ 320:	83 c0 01             	add    $0x1,%eax
+ 323:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 327:	89 c1                	mov    %eax,%ecx
+ 329:	75 f5                	jne    320 <strlen+0x10>
+    ;
+  return n;
+}
+ 32b:	89 c8                	mov    %ecx,%eax
+ 32d:	5d                   	pop    %ebp
+ 32e:	c3                   	ret
+ 32f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 330:	31 c9                	xor    %ecx,%ecx
+}
+ 332:	5d                   	pop    %ebp
+ 333:	89 c8                	mov    %ecx,%eax
+ 335:	c3                   	ret
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 347:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 34a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 34d:	89 d7                	mov    %edx,%edi
+ 34f:	fc                   	cld
+ 350:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 352:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 355:	89 d0                	mov    %edx,%eax
+ 357:	c9                   	leave
+ 358:	c3                   	ret
+ 359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000360 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	8b 45 08             	mov    0x8(%ebp),%eax
+ 366:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 36a:	0f b6 10             	movzbl (%eax),%edx
+ 36d:	84 d2                	test   %dl,%dl
+ 36f:	75 12                	jne    383 <strchr+0x23>
+ 371:	eb 1d                	jmp    390 <strchr+0x30>
+ 373:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 377:	90                   	nop
+ 378:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 37c:	83 c0 01             	add    $0x1,%eax
+ 37f:	84 d2                	test   %dl,%dl
+ 381:	74 0d                	je     390 <strchr+0x30>
+    if(*s == c)
+ 383:	38 d1                	cmp    %dl,%cl
+ 385:	75 f1                	jne    378 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 387:	5d                   	pop    %ebp
+ 388:	c3                   	ret
+ 389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 390:	31 c0                	xor    %eax,%eax
+}
+ 392:	5d                   	pop    %ebp
+ 393:	c3                   	ret
+ 394:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 39f:	90                   	nop
+
+000003a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	57                   	push   %edi
+ 3a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3a9:	31 db                	xor    %ebx,%ebx
+{
+ 3ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3ae:	eb 27                	jmp    3d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3b0:	83 ec 04             	sub    $0x4,%esp
+ 3b3:	6a 01                	push   $0x1
+ 3b5:	56                   	push   %esi
+ 3b6:	6a 00                	push   $0x0
+ 3b8:	e8 1e 01 00 00       	call   4db <read>
+    if(cc < 1)
+ 3bd:	83 c4 10             	add    $0x10,%esp
+ 3c0:	85 c0                	test   %eax,%eax
+ 3c2:	7e 1d                	jle    3e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 3c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3cf:	3c 0a                	cmp    $0xa,%al
+ 3d1:	74 10                	je     3e3 <gets+0x43>
+ 3d3:	3c 0d                	cmp    $0xd,%al
+ 3d5:	74 0c                	je     3e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3d7:	89 df                	mov    %ebx,%edi
+ 3d9:	83 c3 01             	add    $0x1,%ebx
+ 3dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3df:	7c cf                	jl     3b0 <gets+0x10>
+ 3e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3ed:	5b                   	pop    %ebx
+ 3ee:	5e                   	pop    %esi
+ 3ef:	5f                   	pop    %edi
+ 3f0:	5d                   	pop    %ebp
+ 3f1:	c3                   	ret
+ 3f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	56                   	push   %esi
+ 404:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 405:	83 ec 08             	sub    $0x8,%esp
+ 408:	6a 00                	push   $0x0
+ 40a:	ff 75 08             	push   0x8(%ebp)
+ 40d:	e8 f1 00 00 00       	call   503 <open>
+  if(fd < 0)
+ 412:	83 c4 10             	add    $0x10,%esp
+ 415:	85 c0                	test   %eax,%eax
+ 417:	78 27                	js     440 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 419:	83 ec 08             	sub    $0x8,%esp
+ 41c:	ff 75 0c             	push   0xc(%ebp)
+ 41f:	89 c3                	mov    %eax,%ebx
+ 421:	50                   	push   %eax
+ 422:	e8 f4 00 00 00       	call   51b <fstat>
+  close(fd);
+ 427:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 42a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 42c:	e8 ba 00 00 00       	call   4eb <close>
+  return r;
+ 431:	83 c4 10             	add    $0x10,%esp
+}
+ 434:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 437:	89 f0                	mov    %esi,%eax
+ 439:	5b                   	pop    %ebx
+ 43a:	5e                   	pop    %esi
+ 43b:	5d                   	pop    %ebp
+ 43c:	c3                   	ret
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 440:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 445:	eb ed                	jmp    434 <stat+0x34>
+ 447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44e:	66 90                	xchg   %ax,%ax
+
+00000450 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	53                   	push   %ebx
+ 454:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 457:	0f be 02             	movsbl (%edx),%eax
+ 45a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 45d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 460:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 465:	77 1e                	ja     485 <atoi+0x35>
+ 467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 470:	83 c2 01             	add    $0x1,%edx
+ 473:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 476:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 47a:	0f be 02             	movsbl (%edx),%eax
+ 47d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 480:	80 fb 09             	cmp    $0x9,%bl
+ 483:	76 eb                	jbe    470 <atoi+0x20>
+  return n;
+}
+ 485:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 488:	89 c8                	mov    %ecx,%eax
+ 48a:	c9                   	leave
+ 48b:	c3                   	ret
+ 48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+ 495:	8b 45 10             	mov    0x10(%ebp),%eax
+ 498:	8b 55 08             	mov    0x8(%ebp),%edx
+ 49b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 49e:	85 c0                	test   %eax,%eax
+ 4a0:	7e 13                	jle    4b5 <memmove+0x25>
+ 4a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4a4:	89 d7                	mov    %edx,%edi
+ 4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4b1:	39 f8                	cmp    %edi,%eax
+ 4b3:	75 fb                	jne    4b0 <memmove+0x20>
+  return vdst;
+}
+ 4b5:	5e                   	pop    %esi
+ 4b6:	89 d0                	mov    %edx,%eax
+ 4b8:	5f                   	pop    %edi
+ 4b9:	5d                   	pop    %ebp
+ 4ba:	c3                   	ret
+
+000004bb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4bb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <exit>:
+SYSCALL(exit)
+ 4c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <wait>:
+SYSCALL(wait)
+ 4cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <pipe>:
+SYSCALL(pipe)
+ 4d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <read>:
+SYSCALL(read)
+ 4db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <write>:
+SYSCALL(write)
+ 4e3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+
+000004eb <close>:
+SYSCALL(close)
+ 4eb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4f0:	cd 40                	int    $0x40
+ 4f2:	c3                   	ret
+
+000004f3 <kill>:
+SYSCALL(kill)
+ 4f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4f8:	cd 40                	int    $0x40
+ 4fa:	c3                   	ret
+
+000004fb <exec>:
+SYSCALL(exec)
+ 4fb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 500:	cd 40                	int    $0x40
+ 502:	c3                   	ret
+
+00000503 <open>:
+SYSCALL(open)
+ 503:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 508:	cd 40                	int    $0x40
+ 50a:	c3                   	ret
+
+0000050b <mknod>:
+SYSCALL(mknod)
+ 50b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 510:	cd 40                	int    $0x40
+ 512:	c3                   	ret
+
+00000513 <unlink>:
+SYSCALL(unlink)
+ 513:	b8 12 00 00 00       	mov    $0x12,%eax
+ 518:	cd 40                	int    $0x40
+ 51a:	c3                   	ret
+
+0000051b <fstat>:
+SYSCALL(fstat)
+ 51b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 520:	cd 40                	int    $0x40
+ 522:	c3                   	ret
+
+00000523 <link>:
+SYSCALL(link)
+ 523:	b8 13 00 00 00       	mov    $0x13,%eax
+ 528:	cd 40                	int    $0x40
+ 52a:	c3                   	ret
+
+0000052b <mkdir>:
+SYSCALL(mkdir)
+ 52b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 530:	cd 40                	int    $0x40
+ 532:	c3                   	ret
+
+00000533 <chdir>:
+SYSCALL(chdir)
+ 533:	b8 09 00 00 00       	mov    $0x9,%eax
+ 538:	cd 40                	int    $0x40
+ 53a:	c3                   	ret
+
+0000053b <dup>:
+SYSCALL(dup)
+ 53b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 540:	cd 40                	int    $0x40
+ 542:	c3                   	ret
+
+00000543 <getpid>:
+SYSCALL(getpid)
+ 543:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 548:	cd 40                	int    $0x40
+ 54a:	c3                   	ret
+
+0000054b <sbrk>:
+SYSCALL(sbrk)
+ 54b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 550:	cd 40                	int    $0x40
+ 552:	c3                   	ret
+
+00000553 <sleep>:
+SYSCALL(sleep)
+ 553:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 558:	cd 40                	int    $0x40
+ 55a:	c3                   	ret
+
+0000055b <uptime>:
+SYSCALL(uptime)
+ 55b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 560:	cd 40                	int    $0x40
+ 562:	c3                   	ret
+
+00000563 <nice>:
+SYSCALL(nice)
+ 563:	b8 16 00 00 00       	mov    $0x16,%eax
+ 568:	cd 40                	int    $0x40
+ 56a:	c3                   	ret
+
+0000056b <fsync>:
+SYSCALL(fsync)
+ 56b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 570:	cd 40                	int    $0x40
+ 572:	c3                   	ret
+
+00000573 <getpstat>:
+SYSCALL(getpstat)
+ 573:	b8 18 00 00 00       	mov    $0x18,%eax
+ 578:	cd 40                	int    $0x40
+ 57a:	c3                   	ret
+
+0000057b <pipesize>:
+SYSCALL(pipesize)
+ 57b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 580:	cd 40                	int    $0x40
+ 582:	c3                   	ret
+
+00000583 <uptimens>:
+SYSCALL(uptimens)
+ 583:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 588:	cd 40                	int    $0x40
+ 58a:	c3                   	ret
+
+0000058b <settickets>:
+SYSCALL(settickets)
+ 58b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 590:	cd 40                	int    $0x40
+ 592:	c3                   	ret
+
+00000593 <transfer>:
+SYSCALL(transfer)
+ 593:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 598:	cd 40                	int    $0x40
+ 59a:	c3                   	ret
+ 59b:	66 90                	xchg   %ax,%ax
+ 59d:	66 90                	xchg   %ax,%ax
+ 59f:	90                   	nop
+
+000005a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	57                   	push   %edi
+ 5a4:	56                   	push   %esi
+ 5a5:	53                   	push   %ebx
+ 5a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5a8:	89 d1                	mov    %edx,%ecx
+{
+ 5aa:	83 ec 3c             	sub    $0x3c,%esp
+ 5ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5b0:	85 d2                	test   %edx,%edx
+ 5b2:	0f 89 80 00 00 00    	jns    638 <printint+0x98>
+ 5b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5bc:	74 7a                	je     638 <printint+0x98>
+    x = -xx;
+ 5be:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5c8:	31 f6                	xor    %esi,%esi
+ 5ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5d0:	89 c8                	mov    %ecx,%eax
+ 5d2:	31 d2                	xor    %edx,%edx
+ 5d4:	89 f7                	mov    %esi,%edi
+ 5d6:	f7 f3                	div    %ebx
+ 5d8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5db:	0f b6 92 ac 0d 00 00 	movzbl 0xdac(%edx),%edx
+ 5e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5e6:	89 ca                	mov    %ecx,%edx
+ 5e8:	89 c1                	mov    %eax,%ecx
+ 5ea:	39 da                	cmp    %ebx,%edx
+ 5ec:	73 e2                	jae    5d0 <printint+0x30>
+  if(neg)
+ 5ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5f1:	85 c0                	test   %eax,%eax
+ 5f3:	74 07                	je     5fc <printint+0x5c>
+    buf[i++] = '-';
+ 5f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5fa:	89 f7                	mov    %esi,%edi
+ 5fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 602:	01 df                	add    %ebx,%edi
+ 604:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 608:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 60b:	83 ec 04             	sub    $0x4,%esp
+ 60e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 611:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 614:	6a 01                	push   $0x1
+ 616:	50                   	push   %eax
+ 617:	56                   	push   %esi
+ 618:	e8 c6 fe ff ff       	call   4e3 <write>
+  while(--i >= 0)
+ 61d:	89 f8                	mov    %edi,%eax
+ 61f:	83 c4 10             	add    $0x10,%esp
+ 622:	83 ef 01             	sub    $0x1,%edi
+ 625:	39 d8                	cmp    %ebx,%eax
+ 627:	75 df                	jne    608 <printint+0x68>
+}
+ 629:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 62c:	5b                   	pop    %ebx
+ 62d:	5e                   	pop    %esi
+ 62e:	5f                   	pop    %edi
+ 62f:	5d                   	pop    %ebp
+ 630:	c3                   	ret
+ 631:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 638:	31 c0                	xor    %eax,%eax
+ 63a:	eb 89                	jmp    5c5 <printint+0x25>
+ 63c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000640 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	57                   	push   %edi
+ 644:	56                   	push   %esi
+ 645:	53                   	push   %ebx
+ 646:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 649:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 64c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 64f:	0f b6 1e             	movzbl (%esi),%ebx
+ 652:	83 c6 01             	add    $0x1,%esi
+ 655:	84 db                	test   %bl,%bl
+ 657:	74 67                	je     6c0 <printf+0x80>
+ 659:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 65c:	31 d2                	xor    %edx,%edx
+ 65e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 661:	eb 34                	jmp    697 <printf+0x57>
+ 663:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 667:	90                   	nop
+ 668:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 66b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 670:	83 f8 25             	cmp    $0x25,%eax
+ 673:	74 18                	je     68d <printf+0x4d>
+  write(fd, &c, 1);
+ 675:	83 ec 04             	sub    $0x4,%esp
+ 678:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 67b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 67e:	6a 01                	push   $0x1
+ 680:	50                   	push   %eax
+ 681:	57                   	push   %edi
+ 682:	e8 5c fe ff ff       	call   4e3 <write>
+ 687:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 68a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 68d:	0f b6 1e             	movzbl (%esi),%ebx
+ 690:	83 c6 01             	add    $0x1,%esi
+ 693:	84 db                	test   %bl,%bl
+ 695:	74 29                	je     6c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 697:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 69a:	85 d2                	test   %edx,%edx
+ 69c:	74 ca                	je     668 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 69e:	83 fa 25             	cmp    $0x25,%edx
+ 6a1:	75 ea                	jne    68d <printf+0x4d>
+      if(c == 'd'){
+ 6a3:	83 f8 25             	cmp    $0x25,%eax
+ 6a6:	0f 84 24 01 00 00    	je     7d0 <printf+0x190>
+ 6ac:	83 e8 63             	sub    $0x63,%eax
+ 6af:	83 f8 15             	cmp    $0x15,%eax
+ 6b2:	77 1c                	ja     6d0 <printf+0x90>
+ 6b4:	ff 24 85 54 0d 00 00 	jmp    *0xd54(,%eax,4)
+ 6bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6c3:	5b                   	pop    %ebx
+ 6c4:	5e                   	pop    %esi
+ 6c5:	5f                   	pop    %edi
+ 6c6:	5d                   	pop    %ebp
+ 6c7:	c3                   	ret
+ 6c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6cf:	90                   	nop
+  write(fd, &c, 1);
+ 6d0:	83 ec 04             	sub    $0x4,%esp
+ 6d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6da:	6a 01                	push   $0x1
+ 6dc:	52                   	push   %edx
+ 6dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6e0:	57                   	push   %edi
+ 6e1:	e8 fd fd ff ff       	call   4e3 <write>
+ 6e6:	83 c4 0c             	add    $0xc,%esp
+ 6e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6ec:	6a 01                	push   $0x1
+ 6ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6f1:	52                   	push   %edx
+ 6f2:	57                   	push   %edi
+ 6f3:	e8 eb fd ff ff       	call   4e3 <write>
+        putc(fd, c);
+ 6f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6fb:	31 d2                	xor    %edx,%edx
+ 6fd:	eb 8e                	jmp    68d <printf+0x4d>
+ 6ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 700:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 703:	83 ec 0c             	sub    $0xc,%esp
+ 706:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 70b:	8b 13                	mov    (%ebx),%edx
+ 70d:	6a 00                	push   $0x0
+ 70f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 711:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 714:	e8 87 fe ff ff       	call   5a0 <printint>
+        ap++;
+ 719:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 71c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 71f:	31 d2                	xor    %edx,%edx
+ 721:	e9 67 ff ff ff       	jmp    68d <printf+0x4d>
+ 726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 72d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 730:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 733:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 735:	83 c0 04             	add    $0x4,%eax
+ 738:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 73b:	85 db                	test   %ebx,%ebx
+ 73d:	0f 84 9d 00 00 00    	je     7e0 <printf+0x1a0>
+        while(*s != 0){
+ 743:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 746:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 748:	84 c0                	test   %al,%al
+ 74a:	0f 84 3d ff ff ff    	je     68d <printf+0x4d>
+ 750:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 753:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 756:	89 de                	mov    %ebx,%esi
+ 758:	89 d3                	mov    %edx,%ebx
+ 75a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 760:	83 ec 04             	sub    $0x4,%esp
+ 763:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 766:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 769:	6a 01                	push   $0x1
+ 76b:	53                   	push   %ebx
+ 76c:	57                   	push   %edi
+ 76d:	e8 71 fd ff ff       	call   4e3 <write>
+        while(*s != 0){
+ 772:	0f b6 06             	movzbl (%esi),%eax
+ 775:	83 c4 10             	add    $0x10,%esp
+ 778:	84 c0                	test   %al,%al
+ 77a:	75 e4                	jne    760 <printf+0x120>
+      state = 0;
+ 77c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 77f:	31 d2                	xor    %edx,%edx
+ 781:	e9 07 ff ff ff       	jmp    68d <printf+0x4d>
+ 786:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 790:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 793:	83 ec 0c             	sub    $0xc,%esp
+ 796:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 79b:	8b 13                	mov    (%ebx),%edx
+ 79d:	6a 01                	push   $0x1
+ 79f:	e9 6b ff ff ff       	jmp    70f <printf+0xcf>
+ 7a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7ab:	83 ec 04             	sub    $0x4,%esp
+ 7ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7b9:	6a 01                	push   $0x1
+ 7bb:	52                   	push   %edx
+ 7bc:	57                   	push   %edi
+ 7bd:	e8 21 fd ff ff       	call   4e3 <write>
+        ap++;
+ 7c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7c8:	31 d2                	xor    %edx,%edx
+ 7ca:	e9 be fe ff ff       	jmp    68d <printf+0x4d>
+ 7cf:	90                   	nop
+  write(fd, &c, 1);
+ 7d0:	83 ec 04             	sub    $0x4,%esp
+ 7d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7d9:	6a 01                	push   $0x1
+ 7db:	e9 11 ff ff ff       	jmp    6f1 <printf+0xb1>
+ 7e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7e5:	bb 4d 0d 00 00       	mov    $0xd4d,%ebx
+ 7ea:	e9 61 ff ff ff       	jmp    750 <printf+0x110>
+ 7ef:	90                   	nop
+
+000007f0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7f0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7f1:	a1 1c 11 00 00       	mov    0x111c,%eax
+{
+ 7f6:	89 e5                	mov    %esp,%ebp
+ 7f8:	57                   	push   %edi
+ 7f9:	56                   	push   %esi
+ 7fa:	53                   	push   %ebx
+ 7fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 7fe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 801:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 808:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 80a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 80c:	39 ca                	cmp    %ecx,%edx
+ 80e:	73 30                	jae    840 <free+0x50>
+ 810:	39 c1                	cmp    %eax,%ecx
+ 812:	72 04                	jb     818 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 814:	39 c2                	cmp    %eax,%edx
+ 816:	72 f0                	jb     808 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 818:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 81b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 81e:	39 f8                	cmp    %edi,%eax
+ 820:	74 2e                	je     850 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 822:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 825:	8b 42 04             	mov    0x4(%edx),%eax
+ 828:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 82b:	39 f1                	cmp    %esi,%ecx
+ 82d:	74 38                	je     867 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 82f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 831:	5b                   	pop    %ebx
+  freep = p;
+ 832:	89 15 1c 11 00 00    	mov    %edx,0x111c
+}
+ 838:	5e                   	pop    %esi
+ 839:	5f                   	pop    %edi
+ 83a:	5d                   	pop    %ebp
+ 83b:	c3                   	ret
+ 83c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 840:	39 c1                	cmp    %eax,%ecx
+ 842:	72 d0                	jb     814 <free+0x24>
+ 844:	eb c2                	jmp    808 <free+0x18>
+ 846:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 84d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 850:	03 70 04             	add    0x4(%eax),%esi
+ 853:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 856:	8b 02                	mov    (%edx),%eax
+ 858:	8b 00                	mov    (%eax),%eax
+ 85a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 85d:	8b 42 04             	mov    0x4(%edx),%eax
+ 860:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 863:	39 f1                	cmp    %esi,%ecx
+ 865:	75 c8                	jne    82f <free+0x3f>
+    p->s.size += bp->s.size;
+ 867:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 86a:	89 15 1c 11 00 00    	mov    %edx,0x111c
+    p->s.size += bp->s.size;
+ 870:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 873:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 876:	89 0a                	mov    %ecx,(%edx)
+}
+ 878:	5b                   	pop    %ebx
+ 879:	5e                   	pop    %esi
+ 87a:	5f                   	pop    %edi
+ 87b:	5d                   	pop    %ebp
+ 87c:	c3                   	ret
+ 87d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000880 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 880:	55                   	push   %ebp
+ 881:	89 e5                	mov    %esp,%ebp
+ 883:	57                   	push   %edi
+ 884:	56                   	push   %esi
+ 885:	53                   	push   %ebx
+ 886:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 889:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 88c:	8b 15 1c 11 00 00    	mov    0x111c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 892:	8d 78 07             	lea    0x7(%eax),%edi
+ 895:	c1 ef 03             	shr    $0x3,%edi
+ 898:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 89b:	85 d2                	test   %edx,%edx
+ 89d:	0f 84 8d 00 00 00    	je     930 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8a3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8a5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8a8:	39 f9                	cmp    %edi,%ecx
+ 8aa:	73 64                	jae    910 <malloc+0x90>
+  if(nu < 4096)
+ 8ac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8b1:	39 df                	cmp    %ebx,%edi
+ 8b3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8b6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 8bd:	eb 0a                	jmp    8c9 <malloc+0x49>
+ 8bf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8c0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8c2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8c5:	39 f9                	cmp    %edi,%ecx
+ 8c7:	73 47                	jae    910 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 8c9:	89 c2                	mov    %eax,%edx
+ 8cb:	39 05 1c 11 00 00    	cmp    %eax,0x111c
+ 8d1:	75 ed                	jne    8c0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 8d3:	83 ec 0c             	sub    $0xc,%esp
+ 8d6:	56                   	push   %esi
+ 8d7:	e8 6f fc ff ff       	call   54b <sbrk>
+  if(p == (char*)-1)
+ 8dc:	83 c4 10             	add    $0x10,%esp
+ 8df:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8e2:	74 1c                	je     900 <malloc+0x80>
+  hp->s.size = nu;
+ 8e4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8e7:	83 ec 0c             	sub    $0xc,%esp
+ 8ea:	83 c0 08             	add    $0x8,%eax
+ 8ed:	50                   	push   %eax
+ 8ee:	e8 fd fe ff ff       	call   7f0 <free>
+  return freep;
+ 8f3:	8b 15 1c 11 00 00    	mov    0x111c,%edx
+      if((p = morecore(nunits)) == 0)
+ 8f9:	83 c4 10             	add    $0x10,%esp
+ 8fc:	85 d2                	test   %edx,%edx
+ 8fe:	75 c0                	jne    8c0 <malloc+0x40>
+        return 0;
+  }
+}
+ 900:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 903:	31 c0                	xor    %eax,%eax
+}
+ 905:	5b                   	pop    %ebx
+ 906:	5e                   	pop    %esi
+ 907:	5f                   	pop    %edi
+ 908:	5d                   	pop    %ebp
+ 909:	c3                   	ret
+ 90a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 910:	39 cf                	cmp    %ecx,%edi
+ 912:	74 4c                	je     960 <malloc+0xe0>
+        p->s.size -= nunits;
+ 914:	29 f9                	sub    %edi,%ecx
+ 916:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 919:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 91c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 91f:	89 15 1c 11 00 00    	mov    %edx,0x111c
+}
+ 925:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 928:	83 c0 08             	add    $0x8,%eax
+}
+ 92b:	5b                   	pop    %ebx
+ 92c:	5e                   	pop    %esi
+ 92d:	5f                   	pop    %edi
+ 92e:	5d                   	pop    %ebp
+ 92f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 930:	c7 05 1c 11 00 00 20 	movl   $0x1120,0x111c
+ 937:	11 00 00 
+    base.s.size = 0;
+ 93a:	b8 20 11 00 00       	mov    $0x1120,%eax
+    base.s.ptr = freep = prevp = &base;
+ 93f:	c7 05 20 11 00 00 20 	movl   $0x1120,0x1120
+ 946:	11 00 00 
+    base.s.size = 0;
+ 949:	c7 05 24 11 00 00 00 	movl   $0x0,0x1124
+ 950:	00 00 00 
+    if(p->s.size >= nunits){
+ 953:	e9 54 ff ff ff       	jmp    8ac <malloc+0x2c>
+ 958:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 960:	8b 08                	mov    (%eax),%ecx
+ 962:	89 0a                	mov    %ecx,(%edx)
+ 964:	eb b9                	jmp    91f <malloc+0x9f>
+ 966:	66 90                	xchg   %ax,%ax
+ 968:	66 90                	xchg   %ax,%ax
+ 96a:	66 90                	xchg   %ax,%ax
+ 96c:	66 90                	xchg   %ax,%ax
+ 96e:	66 90                	xchg   %ax,%ax
+
+00000970 <pidstat>:
+
+// Fill in *st with the statistics of process pid.
+// Returns 0, or -1 if there is no such process.
+int
+pidstat(int pid, struct pstat *st)
+{
+ 970:	55                   	push   %ebp
+ 971:	89 e5                	mov    %esp,%ebp
+ 973:	56                   	push   %esi
+ 974:	53                   	push   %ebx
+  static struct pstat *ps;
+  int i, n;
+
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ 975:	a1 28 11 00 00       	mov    0x1128,%eax
+{
+ 97a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 97d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ 980:	85 c0                	test   %eax,%eax
+ 982:	0f 84 98 00 00 00    	je     a20 <pidstat+0xb0>
+    return -1;
+  n = getpstat(ps, NPROC);
+ 988:	83 ec 08             	sub    $0x8,%esp
+ 98b:	6a 40                	push   $0x40
+ 98d:	50                   	push   %eax
+ 98e:	e8 e0 fb ff ff       	call   573 <getpstat>
+  for(i = 0; i < n; i++){
+ 993:	83 c4 10             	add    $0x10,%esp
+ 996:	85 c0                	test   %eax,%eax
+ 998:	0f 8e 9f 00 00 00    	jle    a3d <pidstat+0xcd>
+ 99e:	8b 15 28 11 00 00    	mov    0x1128,%edx
+ 9a4:	31 c9                	xor    %ecx,%ecx
+ 9a6:	eb 16                	jmp    9be <pidstat+0x4e>
+ 9a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9af:	90                   	nop
+ 9b0:	83 c1 01             	add    $0x1,%ecx
+ 9b3:	83 c2 38             	add    $0x38,%edx
+ 9b6:	39 c8                	cmp    %ecx,%eax
+ 9b8:	0f 84 7f 00 00 00    	je     a3d <pidstat+0xcd>
+    if(ps[i].pid == pid){
+ 9be:	39 1a                	cmp    %ebx,(%edx)
+ 9c0:	75 ee                	jne    9b0 <pidstat+0x40>
+      *st = ps[i];
+ 9c2:	89 1e                	mov    %ebx,(%esi)
+ 9c4:	8b 42 04             	mov    0x4(%edx),%eax
+ 9c7:	89 46 04             	mov    %eax,0x4(%esi)
+ 9ca:	8b 42 08             	mov    0x8(%edx),%eax
+ 9cd:	89 46 08             	mov    %eax,0x8(%esi)
+ 9d0:	8b 42 0c             	mov    0xc(%edx),%eax
+ 9d3:	89 46 0c             	mov    %eax,0xc(%esi)
+ 9d6:	8b 42 10             	mov    0x10(%edx),%eax
+ 9d9:	89 46 10             	mov    %eax,0x10(%esi)
+ 9dc:	8b 42 14             	mov    0x14(%edx),%eax
+ 9df:	89 46 14             	mov    %eax,0x14(%esi)
+ 9e2:	8b 42 18             	mov    0x18(%edx),%eax
+ 9e5:	89 46 18             	mov    %eax,0x18(%esi)
+ 9e8:	8b 42 1c             	mov    0x1c(%edx),%eax
+ 9eb:	89 46 1c             	mov    %eax,0x1c(%esi)
+ 9ee:	8b 42 20             	mov    0x20(%edx),%eax
+ 9f1:	89 46 20             	mov    %eax,0x20(%esi)
+ 9f4:	8b 42 24             	mov    0x24(%edx),%eax
+ 9f7:	89 46 24             	mov    %eax,0x24(%esi)
+ 9fa:	8b 42 28             	mov    0x28(%edx),%eax
+ 9fd:	89 46 28             	mov    %eax,0x28(%esi)
+ a00:	8b 42 2c             	mov    0x2c(%edx),%eax
+ a03:	89 46 2c             	mov    %eax,0x2c(%esi)
+ a06:	8b 42 30             	mov    0x30(%edx),%eax
+ a09:	89 46 30             	mov    %eax,0x30(%esi)
+ a0c:	8b 42 34             	mov    0x34(%edx),%eax
+ a0f:	89 46 34             	mov    %eax,0x34(%esi)
+      return 0;
+    }
+  }
+  return -1;
+}
+ a12:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ a15:	31 c0                	xor    %eax,%eax
+}
+ a17:	5b                   	pop    %ebx
+ a18:	5e                   	pop    %esi
+ a19:	5d                   	pop    %ebp
+ a1a:	c3                   	ret
+ a1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a1f:	90                   	nop
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ a20:	83 ec 0c             	sub    $0xc,%esp
+ a23:	68 00 0e 00 00       	push   $0xe00
+ a28:	e8 53 fe ff ff       	call   880 <malloc>
+ a2d:	83 c4 10             	add    $0x10,%esp
+ a30:	a3 28 11 00 00       	mov    %eax,0x1128
+ a35:	85 c0                	test   %eax,%eax
+ a37:	0f 85 4b ff ff ff    	jne    988 <pidstat+0x18>
+}
+ a3d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return -1;
+ a40:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ a45:	5b                   	pop    %ebx
+ a46:	5e                   	pop    %esi
+ a47:	5d                   	pop    %ebp
+ a48:	c3                   	ret
+ a49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000a50 <sharetable>:
+// key[i] is printed in a column headed keyname, and so is
+// extra[i] under extraname unless extra is 0.
+void
+sharetable(char *tag, char *keyname, int *key, char *extraname, int *extra,
+           int n, int *pid, int *weight, uint *ticks)
+{
+ a50:	55                   	push   %ebp
+ a51:	89 e5                	mov    %esp,%ebp
+ a53:	57                   	push   %edi
+ a54:	56                   	push   %esi
+ a55:	53                   	push   %ebx
+ a56:	83 ec 3c             	sub    $0x3c,%esp
+ a59:	8b 45 08             	mov    0x8(%ebp),%eax
+ a5c:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+ a5f:	8b 75 24             	mov    0x24(%ebp),%esi
+ a62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ a65:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ a68:	8b 45 10             	mov    0x10(%ebp),%eax
+ a6b:	89 7d d0             	mov    %edi,-0x30(%ebp)
+ a6e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+ a71:	89 45 cc             	mov    %eax,-0x34(%ebp)
+ a74:	8b 45 18             	mov    0x18(%ebp),%eax
+ a77:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ a7a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ a7d:	8b 45 20             	mov    0x20(%ebp),%eax
+ a80:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ a83:	8b 45 28             	mov    0x28(%ebp),%eax
+ a86:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  int i, wsum, share, expect, err, maxerr;
+  uint tsum;
+
+  wsum = 0;
+  tsum = 0;
+  for(i = 0; i < n; i++){
+ a89:	85 ff                	test   %edi,%edi
+ a8b:	0f 8e df 01 00 00    	jle    c70 <sharetable+0x220>
+ a91:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+ a94:	89 fb                	mov    %edi,%ebx
+ a96:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  tsum = 0;
+ a99:	31 d2                	xor    %edx,%edx
+  for(i = 0; i < n; i++){
+ a9b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ a9e:	31 c0                	xor    %eax,%eax
+ aa0:	31 c9                	xor    %ecx,%ecx
+ aa2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wsum += weight[i];
+ aa8:	03 0c 86             	add    (%esi,%eax,4),%ecx
+    tsum += ticks[i];
+ aab:	03 14 87             	add    (%edi,%eax,4),%edx
+  for(i = 0; i < n; i++){
+ aae:	83 c0 01             	add    $0x1,%eax
+ ab1:	39 c3                	cmp    %eax,%ebx
+ ab3:	75 f3                	jne    aa8 <sharetable+0x58>
+ ab5:	85 d2                	test   %edx,%edx
+ ab7:	b8 01 00 00 00       	mov    $0x1,%eax
+ abc:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  }
+  if(tsum == 0)
+    tsum = 1;
+  if(wsum == 0)
+    wsum = 1;
+ abf:	8b 7d d8             	mov    -0x28(%ebp),%edi
+ ac2:	0f 45 c2             	cmovne %edx,%eax
+ ac5:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+  if(tsum == 0)
+ ac8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    wsum = 1;
+ acb:	85 ff                	test   %edi,%edi
+ acd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ ad0:	b8 01 00 00 00       	mov    $0x1,%eax
+ ad5:	0f 45 c7             	cmovne %edi,%eax
+ ad8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+
+  printf(1, "[%s]  pid %s ", tag, keyname);
+ adb:	51                   	push   %ecx
+ adc:	ff 75 dc             	push   -0x24(%ebp)
+ adf:	68 bd 0d 00 00       	push   $0xdbd
+ ae4:	6a 01                	push   $0x1
+ ae6:	e8 55 fb ff ff       	call   640 <printf>
+  if(extra)
+ aeb:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ aee:	83 c4 10             	add    $0x10,%esp
+ af1:	85 f6                	test   %esi,%esi
+ af3:	0f 84 47 01 00 00    	je     c40 <sharetable+0x1f0>
+    printf(1, "%s ", extraname);
+ af9:	83 ec 04             	sub    $0x4,%esp
+ afc:	53                   	push   %ebx
+ afd:	68 c7 0d 00 00       	push   $0xdc7
+ b02:	6a 01                	push   $0x1
+ b04:	e8 37 fb ff ff       	call   640 <printf>
+  printf(1, "ticks  share expected\n");
+ b09:	58                   	pop    %eax
+ b0a:	5a                   	pop    %edx
+ b0b:	68 cb 0d 00 00       	push   $0xdcb
+ b10:	6a 01                	push   $0x1
+ b12:	e8 29 fb ff ff       	call   640 <printf>
+  maxerr = 0;
+  for(i = 0; i < n; i++){
+ b17:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+ b1a:	83 c4 10             	add    $0x10,%esp
+ b1d:	85 c9                	test   %ecx,%ecx
+ b1f:	0f 8e 44 01 00 00    	jle    c69 <sharetable+0x219>
+  if(extra)
+ b25:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+ b2c:	31 ff                	xor    %edi,%edi
+ b2e:	66 90                	xchg   %ax,%ax
+    share = ticks[i] * 1000 / tsum;
+ b30:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ b33:	31 d2                	xor    %edx,%edx
+    expect = weight[i] * 1000 / wsum;
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+ b35:	83 ec 0c             	sub    $0xc,%esp
+    share = ticks[i] * 1000 / tsum;
+ b38:	69 04 b8 e8 03 00 00 	imul   $0x3e8,(%eax,%edi,4),%eax
+ b3f:	f7 75 c0             	divl   -0x40(%ebp)
+ b42:	89 c6                	mov    %eax,%esi
+    expect = weight[i] * 1000 / wsum;
+ b44:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ b47:	69 04 b8 e8 03 00 00 	imul   $0x3e8,(%eax,%edi,4),%eax
+ b4e:	99                   	cltd
+ b4f:	f7 7d d8             	idivl  -0x28(%ebp)
+ b52:	89 c3                	mov    %eax,%ebx
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+ b54:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ b57:	ff 34 b8             	push   (%eax,%edi,4)
+ b5a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ b5d:	ff 34 b8             	push   (%eax,%edi,4)
+ b60:	ff 75 dc             	push   -0x24(%ebp)
+ b63:	68 e2 0d 00 00       	push   $0xde2
+ b68:	6a 01                	push   $0x1
+ b6a:	e8 d1 fa ff ff       	call   640 <printf>
+    if(extra)
+ b6f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ b72:	83 c4 20             	add    $0x20,%esp
+ b75:	85 c0                	test   %eax,%eax
+ b77:	74 15                	je     b8e <sharetable+0x13e>
+      printf(1, "%d ", extra[i]);
+ b79:	83 ec 04             	sub    $0x4,%esp
+ b7c:	ff 34 b8             	push   (%eax,%edi,4)
+ b7f:	68 ea 0d 00 00       	push   $0xdea
+ b84:	6a 01                	push   $0x1
+ b86:	e8 b5 fa ff ff       	call   640 <printf>
+ b8b:	83 c4 10             	add    $0x10,%esp
+    printf(1, "%d %d.%d%% %d.%d%%\n", ticks[i], share / 10, share % 10,
+ b8e:	b8 67 66 66 66       	mov    $0x66666667,%eax
+ b93:	89 d9                	mov    %ebx,%ecx
+ b95:	83 ec 04             	sub    $0x4,%esp
+ b98:	f7 eb                	imul   %ebx
+ b9a:	89 d8                	mov    %ebx,%eax
+ b9c:	c1 f8 1f             	sar    $0x1f,%eax
+ b9f:	c1 fa 02             	sar    $0x2,%edx
+ ba2:	29 c2                	sub    %eax,%edx
+ ba4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ ba7:	01 c0                	add    %eax,%eax
+ ba9:	29 c1                	sub    %eax,%ecx
+ bab:	b8 67 66 66 66       	mov    $0x66666667,%eax
+ bb0:	51                   	push   %ecx
+ bb1:	89 f1                	mov    %esi,%ecx
+ bb3:	52                   	push   %edx
+ bb4:	f7 ee                	imul   %esi
+ bb6:	89 f0                	mov    %esi,%eax
+ bb8:	c1 f8 1f             	sar    $0x1f,%eax
+ bbb:	c1 fa 02             	sar    $0x2,%edx
+ bbe:	29 c2                	sub    %eax,%edx
+ bc0:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ bc3:	01 c0                	add    %eax,%eax
+ bc5:	29 c1                	sub    %eax,%ecx
+ bc7:	51                   	push   %ecx
+ bc8:	52                   	push   %edx
+ bc9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ bcc:	ff 34 b8             	push   (%eax,%edi,4)
+ bcf:	68 ee 0d 00 00       	push   $0xdee
+ bd4:	6a 01                	push   $0x1
+ bd6:	e8 65 fa ff ff       	call   640 <printf>
+           expect / 10, expect % 10);
+    err = share > expect ? share - expect : expect - share;
+ bdb:	89 f2                	mov    %esi,%edx
+ bdd:	89 d8                	mov    %ebx,%eax
+ bdf:	83 c4 20             	add    $0x20,%esp
+ be2:	29 f0                	sub    %esi,%eax
+ be4:	29 da                	sub    %ebx,%edx
+ be6:	39 de                	cmp    %ebx,%esi
+ be8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ beb:	0f 4f c2             	cmovg  %edx,%eax
+    if(err > maxerr)
+ bee:	39 c6                	cmp    %eax,%esi
+ bf0:	0f 4d c6             	cmovge %esi,%eax
+  for(i = 0; i < n; i++){
+ bf3:	83 c7 01             	add    $0x1,%edi
+ bf6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ bf9:	39 7d d0             	cmp    %edi,-0x30(%ebp)
+ bfc:	0f 85 2e ff ff ff    	jne    b30 <sharetable+0xe0>
+      maxerr = err;
+  }
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+ c02:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+ c07:	f7 e2                	mul    %edx
+ c09:	c1 ea 03             	shr    $0x3,%edx
+ c0c:	8d 0c 92             	lea    (%edx,%edx,4),%ecx
+ c0f:	89 d0                	mov    %edx,%eax
+ c11:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ c14:	01 c9                	add    %ecx,%ecx
+ c16:	29 ca                	sub    %ecx,%edx
+ c18:	89 45 14             	mov    %eax,0x14(%ebp)
+ c1b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ c1e:	89 55 18             	mov    %edx,0x18(%ebp)
+ c21:	89 45 10             	mov    %eax,0x10(%ebp)
+ c24:	c7 45 0c 04 0e 00 00 	movl   $0xe04,0xc(%ebp)
+ c2b:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+ c32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c35:	5b                   	pop    %ebx
+ c36:	5e                   	pop    %esi
+ c37:	5f                   	pop    %edi
+ c38:	5d                   	pop    %ebp
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+ c39:	e9 02 fa ff ff       	jmp    640 <printf>
+ c3e:	66 90                	xchg   %ax,%ax
+  printf(1, "ticks  share expected\n");
+ c40:	83 ec 08             	sub    $0x8,%esp
+ c43:	68 cb 0d 00 00       	push   $0xdcb
+ c48:	6a 01                	push   $0x1
+ c4a:	e8 f1 f9 ff ff       	call   640 <printf>
+ c4f:	83 c4 10             	add    $0x10,%esp
+ c52:	e9 ce fe ff ff       	jmp    b25 <sharetable+0xd5>
+ c57:	83 ec 08             	sub    $0x8,%esp
+ c5a:	68 cb 0d 00 00       	push   $0xdcb
+ c5f:	6a 01                	push   $0x1
+ c61:	e8 da f9 ff ff       	call   640 <printf>
+ c66:	83 c4 10             	add    $0x10,%esp
+  if(extra)
+ c69:	31 c0                	xor    %eax,%eax
+ c6b:	31 d2                	xor    %edx,%edx
+ c6d:	eb a9                	jmp    c18 <sharetable+0x1c8>
+ c6f:	90                   	nop
+  printf(1, "[%s]  pid %s ", tag, keyname);
+ c70:	51                   	push   %ecx
+ c71:	ff 75 dc             	push   -0x24(%ebp)
+ c74:	68 bd 0d 00 00       	push   $0xdbd
+ c79:	6a 01                	push   $0x1
+ c7b:	e8 c0 f9 ff ff       	call   640 <printf>
+  if(extra)
+ c80:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ c83:	83 c4 10             	add    $0x10,%esp
+ c86:	85 ff                	test   %edi,%edi
+ c88:	74 cd                	je     c57 <sharetable+0x207>
+    wsum = 1;
+ c8a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  if(extra)
+ c91:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+ c98:	e9 5c fe ff ff       	jmp    af9 <sharetable+0xa9>
@@ -0,0 +1,84 @@
+// latbench.c — wakeup latency benchmark
+// Starts CPU-bound hogs, then plays an interactive process: sleep
+// for a tick, do a little work, and repeat for a fixed window. A
+// sleep(1) should take at most one tick; anything beyond that is
+// time spent waiting for a CPU behind the hogs. Under MLFQ_SCHED the
+// hogs sink to the bottom level and the sleeper stays at the top,
+// so its wakeups should come through at once; under PRIORITY_SCHED
+// it waits its turn behind every hog.
+// Run with CPUS=1 so the hogs and the sleeper share one CPU.
+//
+// usage: latbench [hogs] [ticks]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "pstat.h"
+#include "param.h"
+
+#define MAXHOGS 8
+
+static void
+hog(void)
+{
+  volatile uint x = 0;
+
+  for(;;)
+    x++;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int nhogs = 3, dur = 300;
+  int pids[MAXHOGS], i, n, start;
+  uint lat, sum, max;
+  struct pstat st;
+  uint64 t0, t1;
+
+  if(argc > 1) nhogs = atoi(argv[1]);
+  if(argc > 2) dur = atoi(argv[2]);
+  if(nhogs > MAXHOGS)
+    nhogs = MAXHOGS;
+
+  printf(1, "\n[LATBENCH] %d hogs, %d ticks\n", nhogs, dur);
+
+  for(i = 0; i < nhogs; i++){
+    if((pids[i] = fork()) < 0){
+      printf(2, "latbench: fork failed\n");
+      exit();
+    }
+    if(pids[i] == 0)
+      hog();
+  }
+
+  n = 0;
+  sum = max = 0;
+  start = uptime();
+  while(uptime() - start < dur){
+    uptimens(&t0);
+    sleep(1);
+    uptimens(&t1);
+    lat = (uint)(t1 - t0) / 1000;    // microseconds
+    sum += lat;
+    if(lat > max)
+      max = lat;
+    n++;
+  }
+
+  if(pidstat(getpid(), &st) == 0)
+    printf(1, "[LATBENCH] sleeper level %d\n", st.prio);
+  if(nhogs > 0 && pidstat(pids[0], &st) == 0)
+    printf(1, "[LATBENCH] hog level %d\n", st.prio);
+
+  for(i = 0; i < nhogs; i++)
+    kill(pids[i]);
+  for(i = 0; i < nhogs; i++)
+    wait();
+
+  if(n == 0)
+    n = 1;
+  printf(1, "[LATBENCH] %d sleeps: avg %d us, max %d us (one tick is %d us)\n",
+         n, sum / n, max, 1000000 / HZ);
+  exit();
+}
@@ -18,7 +18,14 @@
 // its start and end. Usually begin_op() just increments
 // the count of in-progress FS system calls and returns.
 // But if it thinks the log is close to running out, it
-// sleeps until the last outstanding end_op() commits.
+// sleeps until the next commit.
+//
+// Commits are done by a kernel thread, the log flusher,
+// so that one commit covers a whole group of system calls
+// and none of them waits for the disk. The flusher commits
+// when the log is nearly full, when a process waits for
+// durability in log_sync(), or LOGDELAY ticks after the
+// group's first write.
 //
 // The log is a physical re-do log containing disk blocks.
 // The on-disk log format:
@@ -27,7 +34,6 @@
 //   block B
 //   block C
 //   ...
-// Log appends are synchronous.
 
 // Contents of the header block, used for both the on-disk header block
 // and to keep track in memory of logged block# before commit.
@@ -43,12 +49,18 @@ struct log {
   int outstanding; // how many FS sys calls are executing.
   int committing;  // in commit(), please wait.
   int dev;
+  int ncommit;     // commits done so far
+  int syncwait;    // processes waiting in log_sync()
+  uint opened;     // ticks at first write of current group
   struct logheader lh;
 };
 struct log log;
 
+#define LOGDELAY 100  // ticks a group may stay open
+
 static void recover_from_log(void);
 static void commit();
+static void logflusher(void);
 
 void
 initlog(int dev)
@@ -63,22 +75,29 @@ initlog(int dev)
   log.size = sb.nlog;
   log.dev = dev;
   recover_from_log();
+  kthread("logflush", logflusher);
 }
 
-// Copy committed blocks from log to their home location
+// Copy committed blocks from log to their home location.
+// After a commit the cached home blocks already hold the
+// logged data; only recovery needs to copy it from the log.
 static void
-install_trans(void)
+install_trans(int recovering)
 {
+  struct buf *dbuf[LOGSIZE];
   int tail;
 
   for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
-    brelse(lbuf);
-    brelse(dbuf);
+    dbuf[tail] = bread(log.dev, log.lh.block[tail]); // read dst
+    if(recovering){
+      struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
+      memmove(dbuf[tail]->data, lbuf->data, BSIZE);  // copy block to dst
+      brelse(lbuf);
+    }
   }
+  bwritev(dbuf, log.lh.n);  // write dst to disk
+  for (tail = 0; tail < log.lh.n; tail++)
+    brelse(dbuf[tail]);
 }
 
 // Read the log header from disk into the in-memory log header
@@ -116,7 +135,7 @@ static void
 recover_from_log(void)
 {
   read_head();
-  install_trans(); // if committed, copy from log to disk
+  install_trans(1); // if committed, copy from log to disk
   log.lh.n = 0;
   write_head(); // clear the log
 }
@@ -131,6 +150,7 @@ begin_op(void)
       sleep(&log, &log.lock);
     } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
       // this op might exhaust log space; wait for commit.
+      wakeup(&log.lh);
       sleep(&log, &log.lock);
     } else {
       log.outstanding += 1;
@@ -141,19 +161,16 @@ begin_op(void)
 }
 
 // called at the end of each FS system call.
-// commits if this was the last outstanding operation.
+// The commit itself is left to the log flusher.
 void
 end_op(void)
 {
-  int do_commit = 0;
-
   acquire(&log.lock);
   log.outstanding -= 1;
-  if(log.committing)
-    panic("log.committing");
-  if(log.outstanding == 0){
-    do_commit = 1;
-    log.committing = 1;
+  if(log.committing){
+    // the flusher waits for the last op of the group.
+    if(log.outstanding == 0)
+      wakeup(&log.lh);
   } else {
     // begin_op() may be waiting for log space,
     // and decrementing log.outstanding has decreased
@@ -161,15 +178,70 @@ end_op(void)
     wakeup(&log);
   }
   release(&log.lock);
+}
+
+// Wait until the FS system calls that have finished so far
+// are committed to disk.
+void
+log_sync(void)
+{
+  int n;
+
+  acquire(&log.lock);
+  if(log.committing || log.lh.n > 0){
+    n = log.ncommit + 1;
+    log.syncwait++;
+    wakeup(&log.lh);
+    while(log.ncommit < n)
+      sleep(&log, &log.lock);
+    log.syncwait--;
+  }
+  release(&log.lock);
+}
+
+// Should the flusher commit the current group now?
+static int
+flushdue(void)
+{
+  if(log.lh.n == 0)
+    return 0;
+  return log.syncwait > 0 ||
+         log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE ||
+         ticks - log.opened >= LOGDELAY;
+}
+
+// The log flusher's kernel thread.
+static void
+logflusher(void)
+{
+  acquire(&log.lock);
+  for(;;){
+    while(!flushdue()){
+      // Also wake when the group's LOGDELAY is up.
+      if(log.lh.n > 0){
+        acquire(&tickslock);
+        timerset(log.opened + LOGDELAY, &log.lh);
+        release(&tickslock);
+      }
+      sleep(&log.lh, &log.lock);
+    }
+    acquire(&tickslock);
+    timerdel(myproc());
+    release(&tickslock);
+
+    // Close the group, and let its last ops finish.
+    log.committing = 1;
+    while(log.outstanding > 0)
+      sleep(&log.lh, &log.lock);
 
-  if(do_commit){
     // call commit w/o holding locks, since not allowed
     // to sleep with locks.
+    release(&log.lock);
     commit();
     acquire(&log.lock);
     log.committing = 0;
+    log.ncommit++;
     wakeup(&log);
-    release(&log.lock);
   }
 }
 
@@ -177,16 +249,18 @@ end_op(void)
 static void
 write_log(void)
 {
+  struct buf *to[LOGSIZE];
   int tail;
 
   for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
+    to[tail] = bread(log.dev, log.start+tail+1); // log block
     struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
+    memmove(to[tail]->data, from->data, BSIZE);
     brelse(from);
-    brelse(to);
   }
+  bwritev(to, log.lh.n);  // write the log
+  for (tail = 0; tail < log.lh.n; tail++)
+    brelse(to[tail]);
 }
 
 static void
@@ -195,7 +269,7 @@ commit()
   if (log.lh.n > 0) {
     write_log();     // Write modified blocks from cache to log
     write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
+    install_trans(0); // Now install writes to home locations
     log.lh.n = 0;
     write_head();    // Erase the transaction from the log
   }
@@ -226,8 +300,13 @@ log_write(struct buf *b)
       break;
   }
   log.lh.block[i] = b->blockno;
-  if (i == log.lh.n)
-    log.lh.n++;
+  if (i == log.lh.n){
+    if (log.lh.n++ == 0){
+      // first write of a new group; start its clock.
+      log.opened = ticks;
+      wakeup(&log.lh);
+    }
+  }
   b->flags |= B_DIRTY; // prevent eviction
   release(&log.lock);
 }
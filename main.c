@@ -17,7 +17,7 @@ extern char end[]; // first address after kernel loaded from ELF file
 int
 main(void)
 {
-  kinit1(end, P2V(4*1024*1024)); // phys page allocator
+  kinit1(end, P2V(ENTRYTOP)); // phys page allocator
   kvmalloc();      // kernel page table
   mpinit();        // detect other processors
   lapicinit();     // interrupt controller
@@ -28,11 +28,11 @@ main(void)
   uartinit();      // serial port
   pinit();         // process table
   tvinit();        // trap vectors
-  binit();         // buffer cache
   fileinit();      // file table
   ideinit();       // disk 
   startothers();   // start other processors
-  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+  kinit2(P2V(ENTRYTOP), P2V(PHYSTOP)); // must come after startothers()
+  binit();         // buffer cache; allocates pages
   userinit();      // first user process
   mpmain();        // finish this processor's setup
 }
@@ -103,8 +103,12 @@ __attribute__((__aligned__(PGSIZE)))
 pde_t entrypgdir[NPDENTRIES] = {
   // Map VA's [0, 4MB) to PA's [0, 4MB)
   [0] = (0) | PTE_P | PTE_W | PTE_PS,
-  // Map VA's [KERNBASE, KERNBASE+4MB) to PA's [0, 4MB)
+  // Map VA's [KERNBASE, KERNBASE+ENTRYTOP) to PA's [0, ENTRYTOP),
+  // enough for kernelmemfs with fs.img linked in
   [KERNBASE>>PDXSHIFT] = (0) | PTE_P | PTE_W | PTE_PS,
+  [(KERNBASE>>PDXSHIFT)+1] = (4<<20) | PTE_P | PTE_W | PTE_PS,
+  [(KERNBASE>>PDXSHIFT)+2] = (8<<20) | PTE_P | PTE_W | PTE_PS,
+  [(KERNBASE>>PDXSHIFT)+3] = (12<<20) | PTE_P | PTE_W | PTE_PS,
 };
 
 //PAGEBREAK!
@@ -58,3 +58,21 @@ iderw(struct buf *b)
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
 }
+
+// The memory disk has no latency to hide: do the read now.
+void
+iderwasync(struct buf *b)
+{
+  iderw(b);
+  b->flags &= ~B_ASYNC;
+  bdone(b);
+}
+
+void
+iderwv(struct buf **bp, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    iderw(bp[i]);
+}
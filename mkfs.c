@@ -15,7 +15,7 @@
 #define static_assert(a, b) do { switch (0) case 0: case (a): ; } while (0)
 #endif
 
-#define NINODES 200
+#define NINODES 1000
 
 // Disk layout:
 // [ boot block | sb block | log | inode blocks | free bit map | data blocks ]
@@ -40,6 +40,8 @@ void rinode(uint inum, struct dinode *ip);
 void rsect(uint sec, void *buf);
 uint ialloc(ushort type);
 void iappend(uint inum, void *p, int n);
+uint indirect(uint addr, uint i);
+void wdir(uint inum, struct dirent *de, int n);
 
 // convert to intel byte order
 ushort
@@ -68,10 +70,10 @@ int
 main(int argc, char *argv[])
 {
   int i, cc, fd;
-  uint rootino, inum, off;
-  struct dirent de;
+  uint rootino, inum;
+  static struct dirent de[NDXENTRY*DPB];
+  int nde;
   char buf[BSIZE];
-  struct dinode din;
 
 
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
@@ -90,7 +92,7 @@ main(int argc, char *argv[])
     exit(1);
   }
 
-  // 1 fs block = 1 disk sector
+  // 1 fs block = BSIZE/512 disk sectors
   nmeta = 2 + nlog + ninodeblocks + nbitmap;
   nblocks = FSSIZE - nmeta;
 
@@ -117,15 +119,12 @@ main(int argc, char *argv[])
   rootino = ialloc(T_DIR);
   assert(rootino == ROOTINO);
 
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, ".");
-  iappend(rootino, &de, sizeof(de));
-
-  bzero(&de, sizeof(de));
-  de.inum = xshort(rootino);
-  strcpy(de.name, "..");
-  iappend(rootino, &de, sizeof(de));
+  bzero(de, sizeof(de));
+  de[0].inum = xshort(rootino);
+  strcpy(de[0].name, ".");
+  de[1].inum = xshort(rootino);
+  strcpy(de[1].name, "..");
+  nde = 2;
 
   for(i = 2; i < argc; i++){
     assert(index(argv[i], '/') == 0);
@@ -144,10 +143,10 @@ main(int argc, char *argv[])
 
     inum = ialloc(T_FILE);
 
-    bzero(&de, sizeof(de));
-    de.inum = xshort(inum);
-    strncpy(de.name, argv[i], DIRSIZ);
-    iappend(rootino, &de, sizeof(de));
+    assert(nde < sizeof(de)/sizeof(de[0]));
+    de[nde].inum = xshort(inum);
+    strncpy(de[nde].name, argv[i], DIRSIZ);
+    nde++;
 
     while((cc = read(fd, buf, sizeof(buf))) > 0)
       iappend(inum, buf, cc);
@@ -155,12 +154,7 @@ main(int argc, char *argv[])
     close(fd);
   }
 
-  // fix size of root inode dir
-  rinode(rootino, &din);
-  off = xint(din.size);
-  off = ((off/BSIZE) + 1) * BSIZE;
-  din.size = xint(off);
-  winode(rootino, &din);
+  wdir(rootino, de, nde);
 
   balloc(freeblock);
 
@@ -252,6 +246,21 @@ balloc(int used)
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
+// Return the i'th block number in the indirect block at
+// addr, allocating a block for it if necessary.
+uint
+indirect(uint addr, uint i)
+{
+  uint a[NINDIRECT];
+
+  rsect(addr, (char*)a);
+  if(a[i] == 0){
+    a[i] = xint(freeblock++);
+    wsect(addr, (char*)a);
+  }
+  return xint(a[i]);
+}
+
 void
 iappend(uint inum, void *xp, int n)
 {
@@ -259,7 +268,6 @@ iappend(uint inum, void *xp, int n)
   uint fbn, off, n1;
   struct dinode din;
   char buf[BSIZE];
-  uint indirect[NINDIRECT];
   uint x;
 
   rinode(inum, &din);
@@ -273,16 +281,17 @@ iappend(uint inum, void *xp, int n)
         din.addrs[fbn] = xint(freeblock++);
       }
       x = xint(din.addrs[fbn]);
-    } else {
+    } else if(fbn < NDIRECT + NINDIRECT){
       if(xint(din.addrs[NDIRECT]) == 0){
         din.addrs[NDIRECT] = xint(freeblock++);
       }
-      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      if(indirect[fbn - NDIRECT] == 0){
-        indirect[fbn - NDIRECT] = xint(freeblock++);
-        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
+      x = indirect(xint(din.addrs[NDIRECT]), fbn - NDIRECT);
+    } else {
+      if(xint(din.addrs[NDIRECT+1]) == 0){
+        din.addrs[NDIRECT+1] = xint(freeblock++);
       }
-      x = xint(indirect[fbn-NDIRECT]);
+      x = fbn - NDIRECT - NINDIRECT;
+      x = indirect(indirect(xint(din.addrs[NDIRECT+1]), x / NINDIRECT), x % NINDIRECT);
     }
     n1 = min(n, (fbn + 1) * BSIZE - off);
     rsect(x, buf);
@@ -295,3 +304,69 @@ iappend(uint inum, void *xp, int n)
   din.size = xint(off);
   winode(inum, &din);
 }
+
+// Same as dirhash() in fs.c.
+uint
+dirhash(char *name)
+{
+  uint h;
+  int i;
+
+  h = 2166136261U;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = (h ^ (uchar)name[i]) * 16777619;
+  return h;
+}
+
+int
+dircmp(const void *a, const void *b)
+{
+  uint x = dirhash(((struct dirent*)a)->name);
+  uint y = dirhash(((struct dirent*)b)->name);
+
+  return x < y ? -1 : x > y;
+}
+
+// Write the n entries in de as the contents of the empty
+// directory inum: a single block if they fit, else hashed
+// the way fs.c lays out big directories, with leaves half
+// full so the kernel does not have to split them right away.
+void
+wdir(uint inum, struct dirent *de, int n)
+{
+  struct dxentry dx[NDXENTRY];
+  struct dirent leaf[DPB];
+  int i, first[NDXENTRY+1], nleaf;
+
+  if(n <= DPB){
+    bzero(leaf, sizeof(leaf));
+    memmove(leaf, de, n*sizeof(*de));
+    iappend(inum, leaf, BSIZE);
+    return;
+  }
+
+  // Leaf k gets de[first[k]] up to de[first[k+1]].
+  qsort(de, n, sizeof(*de), dircmp);
+  bzero(dx, sizeof(dx));
+  nleaf = 0;
+  for(i = 0; i < n; i++){
+    // Start a new leaf once this one is half full, but
+    // keep names with the same hash in the same leaf.
+    if(i == 0 || (i - first[nleaf-1] >= DPB/2 &&
+                  dirhash(de[i].name) != dirhash(de[i-1].name))){
+      assert(nleaf < NDXENTRY);
+      dx[nleaf].blk = xshort(nleaf + 1);
+      dx[nleaf].hash = xint(i == 0 ? 0 : dirhash(de[i].name));
+      first[nleaf++] = i;
+    }
+    assert(i - first[nleaf-1] < DPB);
+  }
+  first[nleaf] = n;
+  iappend(inum, dx, BSIZE);
+
+  for(i = 0; i < nleaf; i++){
+    bzero(leaf, sizeof(leaf));
+    memmove(leaf, de + first[i], (first[i+1] - first[i])*sizeof(*de));
+    iappend(inum, leaf, BSIZE);
+  }
+}
@@ -0,0 +1,1687 @@
+
+_nice:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 1c             	sub    $0x1c,%esp
+  13:	8b 01                	mov    (%ecx),%eax
+  15:	8b 59 04             	mov    0x4(%ecx),%ebx
+  if(argc != 2 && argc != 3)
+  18:	8d 50 fe             	lea    -0x2(%eax),%edx
+  1b:	83 fa 01             	cmp    $0x1,%edx
+  1e:	77 78                	ja     98 <main+0x98>
+
+  int pid, val, old;
+
+  if(argc == 2){
+    // nice <value> : change current process
+    if (parse_uint_in_range(argv[1], 0, 4, &val) < 0) {
+  20:	8b 73 04             	mov    0x4(%ebx),%esi
+  if(argc == 2){
+  23:	83 f8 02             	cmp    $0x2,%eax
+  26:	0f 84 8d 00 00 00    	je     b9 <main+0xb9>
+    printf(1, "%d %d\n", pid, old);
+    exit();
+  }
+
+  // argc == 3 : nice <pid> <value>
+  if (parse_uint_in_range(argv[1], 1, 0x7fffffff, &pid) < 0) {
+  2c:	83 ec 0c             	sub    $0xc,%esp
+  2f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  32:	b9 ff ff ff 7f       	mov    $0x7fffffff,%ecx
+  37:	ba 01 00 00 00       	mov    $0x1,%edx
+  3c:	50                   	push   %eax
+  3d:	89 f0                	mov    %esi,%eax
+  3f:	e8 fc 00 00 00       	call   140 <parse_uint_in_range>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	0f 88 c8 00 00 00    	js     117 <main+0x117>
+    printf(2, "nice: invalid pid\n");
+    exit();
+  }
+  if (parse_uint_in_range(argv[2], 0, 4, &val) < 0) {
+  4f:	83 ec 0c             	sub    $0xc,%esp
+  52:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+  55:	8b 43 08             	mov    0x8(%ebx),%eax
+  58:	b9 04 00 00 00       	mov    $0x4,%ecx
+  5d:	52                   	push   %edx
+  5e:	31 d2                	xor    %edx,%edx
+  60:	e8 db 00 00 00       	call   140 <parse_uint_in_range>
+  65:	83 c4 10             	add    $0x10,%esp
+  68:	85 c0                	test   %eax,%eax
+  6a:	0f 88 94 00 00 00    	js     104 <main+0x104>
+    printf(2, "nice: value out of range (0..4)\n");
+    exit();
+  }
+
+  old = nice(pid, val);
+  70:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  73:	52                   	push   %edx
+  74:	52                   	push   %edx
+  75:	ff 75 e4             	push   -0x1c(%ebp)
+  78:	53                   	push   %ebx
+  79:	e8 f5 03 00 00       	call   473 <nice>
+  if(old < 0){
+  7e:	83 c4 10             	add    $0x10,%esp
+  81:	85 c0                	test   %eax,%eax
+  83:	79 6c                	jns    f1 <main+0xf1>
+    printf(2, "nice: failed for pid %d\n", pid);
+  85:	50                   	push   %eax
+  86:	53                   	push   %ebx
+  87:	68 08 0c 00 00       	push   $0xc08
+  8c:	6a 02                	push   $0x2
+  8e:	e8 bd 04 00 00       	call   550 <printf>
+    exit();
+  93:	e8 3b 03 00 00       	call   3d3 <exit>
+  printf(2, "usage: nice <pid> <value>\n");
+  98:	50                   	push   %eax
+  99:	50                   	push   %eax
+  9a:	68 b0 0b 00 00       	push   $0xbb0
+  9f:	6a 02                	push   $0x2
+  a1:	e8 aa 04 00 00       	call   550 <printf>
+  printf(2, "   or: nice <value>\n");
+  a6:	58                   	pop    %eax
+  a7:	5a                   	pop    %edx
+  a8:	68 cb 0b 00 00       	push   $0xbcb
+  ad:	6a 02                	push   $0x2
+  af:	e8 9c 04 00 00       	call   550 <printf>
+  exit();
+  b4:	e8 1a 03 00 00       	call   3d3 <exit>
+    if (parse_uint_in_range(argv[1], 0, 4, &val) < 0) {
+  b9:	83 ec 0c             	sub    $0xc,%esp
+  bc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  bf:	b9 04 00 00 00       	mov    $0x4,%ecx
+  c4:	31 d2                	xor    %edx,%edx
+  c6:	50                   	push   %eax
+  c7:	89 f0                	mov    %esi,%eax
+  c9:	e8 72 00 00 00       	call   140 <parse_uint_in_range>
+  ce:	83 c4 10             	add    $0x10,%esp
+  d1:	85 c0                	test   %eax,%eax
+  d3:	78 2f                	js     104 <main+0x104>
+    pid = getpid();
+  d5:	e8 79 03 00 00       	call   453 <getpid>
+  da:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  dd:	89 c3                	mov    %eax,%ebx
+    old = nice(pid, val);
+  df:	56                   	push   %esi
+  e0:	56                   	push   %esi
+  e1:	ff 75 e4             	push   -0x1c(%ebp)
+  e4:	50                   	push   %eax
+  e5:	e8 89 03 00 00       	call   473 <nice>
+    if(old < 0){
+  ea:	83 c4 10             	add    $0x10,%esp
+  ed:	85 c0                	test   %eax,%eax
+  ef:	78 39                	js     12a <main+0x12a>
+  }
+  printf(1, "%d %d\n", pid, old);
+  f1:	50                   	push   %eax
+  f2:	53                   	push   %ebx
+  f3:	68 ee 0b 00 00       	push   $0xbee
+  f8:	6a 01                	push   $0x1
+  fa:	e8 51 04 00 00       	call   550 <printf>
+  exit();
+  ff:	e8 cf 02 00 00       	call   3d3 <exit>
+      printf(2, "nice: value out of range (0..4)\n");
+ 104:	50                   	push   %eax
+ 105:	50                   	push   %eax
+ 106:	68 24 0c 00 00       	push   $0xc24
+ 10b:	6a 02                	push   $0x2
+ 10d:	e8 3e 04 00 00       	call   550 <printf>
+      exit();
+ 112:	e8 bc 02 00 00       	call   3d3 <exit>
+    printf(2, "nice: invalid pid\n");
+ 117:	51                   	push   %ecx
+ 118:	51                   	push   %ecx
+ 119:	68 f5 0b 00 00       	push   $0xbf5
+ 11e:	6a 02                	push   $0x2
+ 120:	e8 2b 04 00 00       	call   550 <printf>
+    exit();
+ 125:	e8 a9 02 00 00       	call   3d3 <exit>
+      printf(2, "nice: failed\n");
+ 12a:	53                   	push   %ebx
+ 12b:	53                   	push   %ebx
+ 12c:	68 e0 0b 00 00       	push   $0xbe0
+ 131:	6a 02                	push   $0x2
+ 133:	e8 18 04 00 00       	call   550 <printf>
+      exit();
+ 138:	e8 96 02 00 00       	call   3d3 <exit>
+ 13d:	66 90                	xchg   %ax,%ax
+ 13f:	90                   	nop
+
+00000140 <parse_uint_in_range>:
+static int parse_uint_in_range(const char *s, int lo, int hi, int *out) {
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	56                   	push   %esi
+ 144:	53                   	push   %ebx
+ 145:	89 c3                	mov    %eax,%ebx
+  for (; *s; s++) {
+ 147:	0f b6 00             	movzbl (%eax),%eax
+ 14a:	84 c0                	test   %al,%al
+ 14c:	74 29                	je     177 <parse_uint_in_range+0x37>
+  int v = 0;
+ 14e:	31 f6                	xor    %esi,%esi
+ 150:	eb 1e                	jmp    170 <parse_uint_in_range+0x30>
+ 152:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    v = v * 10 + (*s - '0');
+ 158:	8d 34 b6             	lea    (%esi,%esi,4),%esi
+ 15b:	0f be c0             	movsbl %al,%eax
+ 15e:	8d 34 70             	lea    (%eax,%esi,2),%esi
+    if (v > hi) return -1;
+ 161:	39 ce                	cmp    %ecx,%esi
+ 163:	7f 12                	jg     177 <parse_uint_in_range+0x37>
+  for (; *s; s++) {
+ 165:	0f b6 43 01          	movzbl 0x1(%ebx),%eax
+ 169:	83 c3 01             	add    $0x1,%ebx
+ 16c:	84 c0                	test   %al,%al
+ 16e:	74 10                	je     180 <parse_uint_in_range+0x40>
+    if (*s < '0' || *s > '9') return -1; // reject '-' and non-digits
+ 170:	83 e8 30             	sub    $0x30,%eax
+ 173:	3c 09                	cmp    $0x9,%al
+ 175:	76 e1                	jbe    158 <parse_uint_in_range+0x18>
+ 177:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 17c:	5b                   	pop    %ebx
+ 17d:	5e                   	pop    %esi
+ 17e:	5d                   	pop    %ebp
+ 17f:	c3                   	ret
+  if (!seen || v < lo) return -1;
+ 180:	39 f2                	cmp    %esi,%edx
+ 182:	7f f3                	jg     177 <parse_uint_in_range+0x37>
+  *out = v;
+ 184:	8b 45 08             	mov    0x8(%ebp),%eax
+ 187:	89 30                	mov    %esi,(%eax)
+  return 0;
+ 189:	31 c0                	xor    %eax,%eax
+ 18b:	eb ef                	jmp    17c <parse_uint_in_range+0x3c>
+ 18d:	66 90                	xchg   %ax,%ax
+ 18f:	90                   	nop
+
+00000190 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 190:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 191:	31 c0                	xor    %eax,%eax
+{
+ 193:	89 e5                	mov    %esp,%ebp
+ 195:	53                   	push   %ebx
+ 196:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 199:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 19c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1a0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1a4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1a7:	83 c0 01             	add    $0x1,%eax
+ 1aa:	84 d2                	test   %dl,%dl
+ 1ac:	75 f2                	jne    1a0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1b1:	89 c8                	mov    %ecx,%eax
+ 1b3:	c9                   	leave
+ 1b4:	c3                   	ret
+ 1b5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001c0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	53                   	push   %ebx
+ 1c4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1ca:	0f b6 02             	movzbl (%edx),%eax
+ 1cd:	84 c0                	test   %al,%al
+ 1cf:	75 17                	jne    1e8 <strcmp+0x28>
+ 1d1:	eb 3a                	jmp    20d <strcmp+0x4d>
+ 1d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1d7:	90                   	nop
+ 1d8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1dc:	83 c2 01             	add    $0x1,%edx
+ 1df:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1e2:	84 c0                	test   %al,%al
+ 1e4:	74 1a                	je     200 <strcmp+0x40>
+    p++, q++;
+ 1e6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1e8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1eb:	38 c3                	cmp    %al,%bl
+ 1ed:	74 e9                	je     1d8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1ef:	29 d8                	sub    %ebx,%eax
+}
+ 1f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1f4:	c9                   	leave
+ 1f5:	c3                   	ret
+ 1f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 200:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 204:	31 c0                	xor    %eax,%eax
+ 206:	29 d8                	sub    %ebx,%eax
+}
+ 208:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 20b:	c9                   	leave
+ 20c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 20d:	0f b6 19             	movzbl (%ecx),%ebx
+ 210:	31 c0                	xor    %eax,%eax
+ 212:	eb db                	jmp    1ef <strcmp+0x2f>
+ 214:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 21f:	90                   	nop
+
+00000220 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 226:	80 3a 00             	cmpb   $0x0,(%edx)
+ 229:	74 15                	je     240 <strlen+0x20>
+ 22b:	31 c0                	xor    %eax,%eax
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+ 230:	83 c0 01             	add    $0x1,%eax
+ 233:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 237:	89 c1                	mov    %eax,%ecx
+ 239:	75 f5                	jne    230 <strlen+0x10>
+    ;
+  return n;
+}
+ 23b:	89 c8                	mov    %ecx,%eax
+ 23d:	5d                   	pop    %ebp
+ 23e:	c3                   	ret
+ 23f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 240:	31 c9                	xor    %ecx,%ecx
+}
+ 242:	5d                   	pop    %ebp
+ 243:	89 c8                	mov    %ecx,%eax
+ 245:	c3                   	ret
+ 246:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000250 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	57                   	push   %edi
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 257:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 25a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 25d:	89 d7                	mov    %edx,%edi
+ 25f:	fc                   	cld
+ 260:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 262:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 265:	89 d0                	mov    %edx,%eax
+ 267:	c9                   	leave
+ 268:	c3                   	ret
+ 269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	8b 45 08             	mov    0x8(%ebp),%eax
+ 276:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 27a:	0f b6 10             	movzbl (%eax),%edx
+ 27d:	84 d2                	test   %dl,%dl
+ 27f:	75 12                	jne    293 <strchr+0x23>
+ 281:	eb 1d                	jmp    2a0 <strchr+0x30>
+ 283:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 287:	90                   	nop
+ 288:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 28c:	83 c0 01             	add    $0x1,%eax
+ 28f:	84 d2                	test   %dl,%dl
+ 291:	74 0d                	je     2a0 <strchr+0x30>
+    if(*s == c)
+ 293:	38 d1                	cmp    %dl,%cl
+ 295:	75 f1                	jne    288 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 297:	5d                   	pop    %ebp
+ 298:	c3                   	ret
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2a0:	31 c0                	xor    %eax,%eax
+}
+ 2a2:	5d                   	pop    %ebp
+ 2a3:	c3                   	ret
+ 2a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+
+000002b0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	57                   	push   %edi
+ 2b4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2b5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2b8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2b9:	31 db                	xor    %ebx,%ebx
+{
+ 2bb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2be:	eb 27                	jmp    2e7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2c0:	83 ec 04             	sub    $0x4,%esp
+ 2c3:	6a 01                	push   $0x1
+ 2c5:	56                   	push   %esi
+ 2c6:	6a 00                	push   $0x0
+ 2c8:	e8 1e 01 00 00       	call   3eb <read>
+    if(cc < 1)
+ 2cd:	83 c4 10             	add    $0x10,%esp
+ 2d0:	85 c0                	test   %eax,%eax
+ 2d2:	7e 1d                	jle    2f1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2d4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2db:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2df:	3c 0a                	cmp    $0xa,%al
+ 2e1:	74 10                	je     2f3 <gets+0x43>
+ 2e3:	3c 0d                	cmp    $0xd,%al
+ 2e5:	74 0c                	je     2f3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2e7:	89 df                	mov    %ebx,%edi
+ 2e9:	83 c3 01             	add    $0x1,%ebx
+ 2ec:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2ef:	7c cf                	jl     2c0 <gets+0x10>
+ 2f1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2fd:	5b                   	pop    %ebx
+ 2fe:	5e                   	pop    %esi
+ 2ff:	5f                   	pop    %edi
+ 300:	5d                   	pop    %ebp
+ 301:	c3                   	ret
+ 302:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	56                   	push   %esi
+ 314:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 315:	83 ec 08             	sub    $0x8,%esp
+ 318:	6a 00                	push   $0x0
+ 31a:	ff 75 08             	push   0x8(%ebp)
+ 31d:	e8 f1 00 00 00       	call   413 <open>
+  if(fd < 0)
+ 322:	83 c4 10             	add    $0x10,%esp
+ 325:	85 c0                	test   %eax,%eax
+ 327:	78 27                	js     350 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 329:	83 ec 08             	sub    $0x8,%esp
+ 32c:	ff 75 0c             	push   0xc(%ebp)
+ 32f:	89 c3                	mov    %eax,%ebx
+ 331:	50                   	push   %eax
+ 332:	e8 f4 00 00 00       	call   42b <fstat>
+  close(fd);
+ 337:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 33a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 33c:	e8 ba 00 00 00       	call   3fb <close>
+  return r;
+ 341:	83 c4 10             	add    $0x10,%esp
+}
+ 344:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 347:	89 f0                	mov    %esi,%eax
+ 349:	5b                   	pop    %ebx
+ 34a:	5e                   	pop    %esi
+ 34b:	5d                   	pop    %ebp
+ 34c:	c3                   	ret
+ 34d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 350:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 355:	eb ed                	jmp    344 <stat+0x34>
+ 357:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35e:	66 90                	xchg   %ax,%ax
+
+00000360 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	53                   	push   %ebx
+ 364:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 367:	0f be 02             	movsbl (%edx),%eax
+ 36a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 36d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 370:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 375:	77 1e                	ja     395 <atoi+0x35>
+ 377:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 37e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 380:	83 c2 01             	add    $0x1,%edx
+ 383:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 386:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 38a:	0f be 02             	movsbl (%edx),%eax
+ 38d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 390:	80 fb 09             	cmp    $0x9,%bl
+ 393:	76 eb                	jbe    380 <atoi+0x20>
+  return n;
+}
+ 395:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 398:	89 c8                	mov    %ecx,%eax
+ 39a:	c9                   	leave
+ 39b:	c3                   	ret
+ 39c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	57                   	push   %edi
+ 3a4:	56                   	push   %esi
+ 3a5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3ae:	85 c0                	test   %eax,%eax
+ 3b0:	7e 13                	jle    3c5 <memmove+0x25>
+ 3b2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3b4:	89 d7                	mov    %edx,%edi
+ 3b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3c0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3c1:	39 f8                	cmp    %edi,%eax
+ 3c3:	75 fb                	jne    3c0 <memmove+0x20>
+  return vdst;
+}
+ 3c5:	5e                   	pop    %esi
+ 3c6:	89 d0                	mov    %edx,%eax
+ 3c8:	5f                   	pop    %edi
+ 3c9:	5d                   	pop    %ebp
+ 3ca:	c3                   	ret
+
+000003cb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3cb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <exit>:
+SYSCALL(exit)
+ 3d3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <wait>:
+SYSCALL(wait)
+ 3db:	b8 03 00 00 00       	mov    $0x3,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <pipe>:
+SYSCALL(pipe)
+ 3e3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <read>:
+SYSCALL(read)
+ 3eb:	b8 05 00 00 00       	mov    $0x5,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <write>:
+SYSCALL(write)
+ 3f3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+
+000003fb <close>:
+SYSCALL(close)
+ 3fb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <kill>:
+SYSCALL(kill)
+ 403:	b8 06 00 00 00       	mov    $0x6,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <exec>:
+SYSCALL(exec)
+ 40b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <open>:
+SYSCALL(open)
+ 413:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <mknod>:
+SYSCALL(mknod)
+ 41b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <unlink>:
+SYSCALL(unlink)
+ 423:	b8 12 00 00 00       	mov    $0x12,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <fstat>:
+SYSCALL(fstat)
+ 42b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <link>:
+SYSCALL(link)
+ 433:	b8 13 00 00 00       	mov    $0x13,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <mkdir>:
+SYSCALL(mkdir)
+ 43b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <chdir>:
+SYSCALL(chdir)
+ 443:	b8 09 00 00 00       	mov    $0x9,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <dup>:
+SYSCALL(dup)
+ 44b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <getpid>:
+SYSCALL(getpid)
+ 453:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <sbrk>:
+SYSCALL(sbrk)
+ 45b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <sleep>:
+SYSCALL(sleep)
+ 463:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <uptime>:
+SYSCALL(uptime)
+ 46b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <nice>:
+SYSCALL(nice)
+ 473:	b8 16 00 00 00       	mov    $0x16,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <fsync>:
+SYSCALL(fsync)
+ 47b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <getpstat>:
+SYSCALL(getpstat)
+ 483:	b8 18 00 00 00       	mov    $0x18,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <pipesize>:
+SYSCALL(pipesize)
+ 48b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <uptimens>:
+SYSCALL(uptimens)
+ 493:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <settickets>:
+SYSCALL(settickets)
+ 49b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <transfer>:
+SYSCALL(transfer)
+ 4a3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+ 4ab:	66 90                	xchg   %ax,%ax
+ 4ad:	66 90                	xchg   %ax,%ax
+ 4af:	90                   	nop
+
+000004b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	57                   	push   %edi
+ 4b4:	56                   	push   %esi
+ 4b5:	53                   	push   %ebx
+ 4b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4b8:	89 d1                	mov    %edx,%ecx
+{
+ 4ba:	83 ec 3c             	sub    $0x3c,%esp
+ 4bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 4c0:	85 d2                	test   %edx,%edx
+ 4c2:	0f 89 80 00 00 00    	jns    548 <printint+0x98>
+ 4c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4cc:	74 7a                	je     548 <printint+0x98>
+    x = -xx;
+ 4ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 4d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 4d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 4d8:	31 f6                	xor    %esi,%esi
+ 4da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 4e0:	89 c8                	mov    %ecx,%eax
+ 4e2:	31 d2                	xor    %edx,%edx
+ 4e4:	89 f7                	mov    %esi,%edi
+ 4e6:	f7 f3                	div    %ebx
+ 4e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 4eb:	0f b6 92 a4 0c 00 00 	movzbl 0xca4(%edx),%edx
+ 4f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 4f6:	89 ca                	mov    %ecx,%edx
+ 4f8:	89 c1                	mov    %eax,%ecx
+ 4fa:	39 da                	cmp    %ebx,%edx
+ 4fc:	73 e2                	jae    4e0 <printint+0x30>
+  if(neg)
+ 4fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 501:	85 c0                	test   %eax,%eax
+ 503:	74 07                	je     50c <printint+0x5c>
+    buf[i++] = '-';
+ 505:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 50a:	89 f7                	mov    %esi,%edi
+ 50c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 50f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 512:	01 df                	add    %ebx,%edi
+ 514:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 518:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 51b:	83 ec 04             	sub    $0x4,%esp
+ 51e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 521:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 524:	6a 01                	push   $0x1
+ 526:	50                   	push   %eax
+ 527:	56                   	push   %esi
+ 528:	e8 c6 fe ff ff       	call   3f3 <write>
+  while(--i >= 0)
+ 52d:	89 f8                	mov    %edi,%eax
+ 52f:	83 c4 10             	add    $0x10,%esp
+ 532:	83 ef 01             	sub    $0x1,%edi
+ 535:	39 d8                	cmp    %ebx,%eax
+ 537:	75 df                	jne    518 <printint+0x68>
+}
+ 539:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 53c:	5b                   	pop    %ebx
+ 53d:	5e                   	pop    %esi
+ 53e:	5f                   	pop    %edi
+ 53f:	5d                   	pop    %ebp
+ 540:	c3                   	ret
+ 541:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 548:	31 c0                	xor    %eax,%eax
+ 54a:	eb 89                	jmp    4d5 <printint+0x25>
+ 54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	53                   	push   %ebx
+ 556:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 559:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 55c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 55f:	0f b6 1e             	movzbl (%esi),%ebx
+ 562:	83 c6 01             	add    $0x1,%esi
+ 565:	84 db                	test   %bl,%bl
+ 567:	74 67                	je     5d0 <printf+0x80>
+ 569:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 56c:	31 d2                	xor    %edx,%edx
+ 56e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 571:	eb 34                	jmp    5a7 <printf+0x57>
+ 573:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 577:	90                   	nop
+ 578:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 57b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 580:	83 f8 25             	cmp    $0x25,%eax
+ 583:	74 18                	je     59d <printf+0x4d>
+  write(fd, &c, 1);
+ 585:	83 ec 04             	sub    $0x4,%esp
+ 588:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 58b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 58e:	6a 01                	push   $0x1
+ 590:	50                   	push   %eax
+ 591:	57                   	push   %edi
+ 592:	e8 5c fe ff ff       	call   3f3 <write>
+ 597:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 59a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 59d:	0f b6 1e             	movzbl (%esi),%ebx
+ 5a0:	83 c6 01             	add    $0x1,%esi
+ 5a3:	84 db                	test   %bl,%bl
+ 5a5:	74 29                	je     5d0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 5a7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5aa:	85 d2                	test   %edx,%edx
+ 5ac:	74 ca                	je     578 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 5ae:	83 fa 25             	cmp    $0x25,%edx
+ 5b1:	75 ea                	jne    59d <printf+0x4d>
+      if(c == 'd'){
+ 5b3:	83 f8 25             	cmp    $0x25,%eax
+ 5b6:	0f 84 24 01 00 00    	je     6e0 <printf+0x190>
+ 5bc:	83 e8 63             	sub    $0x63,%eax
+ 5bf:	83 f8 15             	cmp    $0x15,%eax
+ 5c2:	77 1c                	ja     5e0 <printf+0x90>
+ 5c4:	ff 24 85 4c 0c 00 00 	jmp    *0xc4c(,%eax,4)
+ 5cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5cf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 5d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5d3:	5b                   	pop    %ebx
+ 5d4:	5e                   	pop    %esi
+ 5d5:	5f                   	pop    %edi
+ 5d6:	5d                   	pop    %ebp
+ 5d7:	c3                   	ret
+ 5d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5df:	90                   	nop
+  write(fd, &c, 1);
+ 5e0:	83 ec 04             	sub    $0x4,%esp
+ 5e3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5e6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 5ea:	6a 01                	push   $0x1
+ 5ec:	52                   	push   %edx
+ 5ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 5f0:	57                   	push   %edi
+ 5f1:	e8 fd fd ff ff       	call   3f3 <write>
+ 5f6:	83 c4 0c             	add    $0xc,%esp
+ 5f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5fc:	6a 01                	push   $0x1
+ 5fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 601:	52                   	push   %edx
+ 602:	57                   	push   %edi
+ 603:	e8 eb fd ff ff       	call   3f3 <write>
+        putc(fd, c);
+ 608:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 60b:	31 d2                	xor    %edx,%edx
+ 60d:	eb 8e                	jmp    59d <printf+0x4d>
+ 60f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 610:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 613:	83 ec 0c             	sub    $0xc,%esp
+ 616:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 61b:	8b 13                	mov    (%ebx),%edx
+ 61d:	6a 00                	push   $0x0
+ 61f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 621:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 624:	e8 87 fe ff ff       	call   4b0 <printint>
+        ap++;
+ 629:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 62c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 62f:	31 d2                	xor    %edx,%edx
+ 631:	e9 67 ff ff ff       	jmp    59d <printf+0x4d>
+ 636:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 63d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 640:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 643:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 645:	83 c0 04             	add    $0x4,%eax
+ 648:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 64b:	85 db                	test   %ebx,%ebx
+ 64d:	0f 84 9d 00 00 00    	je     6f0 <printf+0x1a0>
+        while(*s != 0){
+ 653:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 656:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 658:	84 c0                	test   %al,%al
+ 65a:	0f 84 3d ff ff ff    	je     59d <printf+0x4d>
+ 660:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 663:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 666:	89 de                	mov    %ebx,%esi
+ 668:	89 d3                	mov    %edx,%ebx
+ 66a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 670:	83 ec 04             	sub    $0x4,%esp
+ 673:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 676:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 679:	6a 01                	push   $0x1
+ 67b:	53                   	push   %ebx
+ 67c:	57                   	push   %edi
+ 67d:	e8 71 fd ff ff       	call   3f3 <write>
+        while(*s != 0){
+ 682:	0f b6 06             	movzbl (%esi),%eax
+ 685:	83 c4 10             	add    $0x10,%esp
+ 688:	84 c0                	test   %al,%al
+ 68a:	75 e4                	jne    670 <printf+0x120>
+      state = 0;
+ 68c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 68f:	31 d2                	xor    %edx,%edx
+ 691:	e9 07 ff ff ff       	jmp    59d <printf+0x4d>
+ 696:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 69d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 6a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6a3:	83 ec 0c             	sub    $0xc,%esp
+ 6a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6ab:	8b 13                	mov    (%ebx),%edx
+ 6ad:	6a 01                	push   $0x1
+ 6af:	e9 6b ff ff ff       	jmp    61f <printf+0xcf>
+ 6b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 6b8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 6bb:	83 ec 04             	sub    $0x4,%esp
+ 6be:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 6c1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 6c3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 6c6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6c9:	6a 01                	push   $0x1
+ 6cb:	52                   	push   %edx
+ 6cc:	57                   	push   %edi
+ 6cd:	e8 21 fd ff ff       	call   3f3 <write>
+        ap++;
+ 6d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 6d5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6d8:	31 d2                	xor    %edx,%edx
+ 6da:	e9 be fe ff ff       	jmp    59d <printf+0x4d>
+ 6df:	90                   	nop
+  write(fd, &c, 1);
+ 6e0:	83 ec 04             	sub    $0x4,%esp
+ 6e3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6e6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6e9:	6a 01                	push   $0x1
+ 6eb:	e9 11 ff ff ff       	jmp    601 <printf+0xb1>
+ 6f0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 6f5:	bb 45 0c 00 00       	mov    $0xc45,%ebx
+ 6fa:	e9 61 ff ff ff       	jmp    660 <printf+0x110>
+ 6ff:	90                   	nop
+
+00000700 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 700:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 701:	a1 3c 10 00 00       	mov    0x103c,%eax
+{
+ 706:	89 e5                	mov    %esp,%ebp
+ 708:	57                   	push   %edi
+ 709:	56                   	push   %esi
+ 70a:	53                   	push   %ebx
+ 70b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 70e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 711:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 718:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 71a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 71c:	39 ca                	cmp    %ecx,%edx
+ 71e:	73 30                	jae    750 <free+0x50>
+ 720:	39 c1                	cmp    %eax,%ecx
+ 722:	72 04                	jb     728 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 724:	39 c2                	cmp    %eax,%edx
+ 726:	72 f0                	jb     718 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 728:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 72b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 72e:	39 f8                	cmp    %edi,%eax
+ 730:	74 2e                	je     760 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 732:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 735:	8b 42 04             	mov    0x4(%edx),%eax
+ 738:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 73b:	39 f1                	cmp    %esi,%ecx
+ 73d:	74 38                	je     777 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 73f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 741:	5b                   	pop    %ebx
+  freep = p;
+ 742:	89 15 3c 10 00 00    	mov    %edx,0x103c
+}
+ 748:	5e                   	pop    %esi
+ 749:	5f                   	pop    %edi
+ 74a:	5d                   	pop    %ebp
+ 74b:	c3                   	ret
+ 74c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 750:	39 c1                	cmp    %eax,%ecx
+ 752:	72 d0                	jb     724 <free+0x24>
+ 754:	eb c2                	jmp    718 <free+0x18>
+ 756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 75d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 760:	03 70 04             	add    0x4(%eax),%esi
+ 763:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 766:	8b 02                	mov    (%edx),%eax
+ 768:	8b 00                	mov    (%eax),%eax
+ 76a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 76d:	8b 42 04             	mov    0x4(%edx),%eax
+ 770:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 773:	39 f1                	cmp    %esi,%ecx
+ 775:	75 c8                	jne    73f <free+0x3f>
+    p->s.size += bp->s.size;
+ 777:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 77a:	89 15 3c 10 00 00    	mov    %edx,0x103c
+    p->s.size += bp->s.size;
+ 780:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 783:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 786:	89 0a                	mov    %ecx,(%edx)
+}
+ 788:	5b                   	pop    %ebx
+ 789:	5e                   	pop    %esi
+ 78a:	5f                   	pop    %edi
+ 78b:	5d                   	pop    %ebp
+ 78c:	c3                   	ret
+ 78d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000790 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 790:	55                   	push   %ebp
+ 791:	89 e5                	mov    %esp,%ebp
+ 793:	57                   	push   %edi
+ 794:	56                   	push   %esi
+ 795:	53                   	push   %ebx
+ 796:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 799:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 79c:	8b 15 3c 10 00 00    	mov    0x103c,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7a2:	8d 78 07             	lea    0x7(%eax),%edi
+ 7a5:	c1 ef 03             	shr    $0x3,%edi
+ 7a8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 7ab:	85 d2                	test   %edx,%edx
+ 7ad:	0f 84 8d 00 00 00    	je     840 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7b3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7b5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7b8:	39 f9                	cmp    %edi,%ecx
+ 7ba:	73 64                	jae    820 <malloc+0x90>
+  if(nu < 4096)
+ 7bc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 7c1:	39 df                	cmp    %ebx,%edi
+ 7c3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 7c6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 7cd:	eb 0a                	jmp    7d9 <malloc+0x49>
+ 7cf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7d0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7d2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7d5:	39 f9                	cmp    %edi,%ecx
+ 7d7:	73 47                	jae    820 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 7d9:	89 c2                	mov    %eax,%edx
+ 7db:	39 05 3c 10 00 00    	cmp    %eax,0x103c
+ 7e1:	75 ed                	jne    7d0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 7e3:	83 ec 0c             	sub    $0xc,%esp
+ 7e6:	56                   	push   %esi
+ 7e7:	e8 6f fc ff ff       	call   45b <sbrk>
+  if(p == (char*)-1)
+ 7ec:	83 c4 10             	add    $0x10,%esp
+ 7ef:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 7f2:	74 1c                	je     810 <malloc+0x80>
+  hp->s.size = nu;
+ 7f4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 7f7:	83 ec 0c             	sub    $0xc,%esp
+ 7fa:	83 c0 08             	add    $0x8,%eax
+ 7fd:	50                   	push   %eax
+ 7fe:	e8 fd fe ff ff       	call   700 <free>
+  return freep;
+ 803:	8b 15 3c 10 00 00    	mov    0x103c,%edx
+      if((p = morecore(nunits)) == 0)
+ 809:	83 c4 10             	add    $0x10,%esp
+ 80c:	85 d2                	test   %edx,%edx
+ 80e:	75 c0                	jne    7d0 <malloc+0x40>
+        return 0;
+  }
+}
+ 810:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 813:	31 c0                	xor    %eax,%eax
+}
+ 815:	5b                   	pop    %ebx
+ 816:	5e                   	pop    %esi
+ 817:	5f                   	pop    %edi
+ 818:	5d                   	pop    %ebp
+ 819:	c3                   	ret
+ 81a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 820:	39 cf                	cmp    %ecx,%edi
+ 822:	74 4c                	je     870 <malloc+0xe0>
+        p->s.size -= nunits;
+ 824:	29 f9                	sub    %edi,%ecx
+ 826:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 829:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 82c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 82f:	89 15 3c 10 00 00    	mov    %edx,0x103c
+}
+ 835:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 838:	83 c0 08             	add    $0x8,%eax
+}
+ 83b:	5b                   	pop    %ebx
+ 83c:	5e                   	pop    %esi
+ 83d:	5f                   	pop    %edi
+ 83e:	5d                   	pop    %ebp
+ 83f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 840:	c7 05 3c 10 00 00 40 	movl   $0x1040,0x103c
+ 847:	10 00 00 
+    base.s.size = 0;
+ 84a:	b8 40 10 00 00       	mov    $0x1040,%eax
+    base.s.ptr = freep = prevp = &base;
+ 84f:	c7 05 40 10 00 00 40 	movl   $0x1040,0x1040
+ 856:	10 00 00 
+    base.s.size = 0;
+ 859:	c7 05 44 10 00 00 00 	movl   $0x0,0x1044
+ 860:	00 00 00 
+    if(p->s.size >= nunits){
+ 863:	e9 54 ff ff ff       	jmp    7bc <malloc+0x2c>
+ 868:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 86f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 870:	8b 08                	mov    (%eax),%ecx
+ 872:	89 0a                	mov    %ecx,(%edx)
+ 874:	eb b9                	jmp    82f <malloc+0x9f>
+ 876:	66 90                	xchg   %ax,%ax
+ 878:	66 90                	xchg   %ax,%ax
+ 87a:	66 90                	xchg   %ax,%ax
+ 87c:	66 90                	xchg   %ax,%ax
+ 87e:	66 90                	xchg   %ax,%ax
+
+00000880 <pidstat>:
+
+// Fill in *st with the statistics of process pid.
+// Returns 0, or -1 if there is no such process.
+int
+pidstat(int pid, struct pstat *st)
+{
+ 880:	55                   	push   %ebp
+ 881:	89 e5                	mov    %esp,%ebp
+ 883:	56                   	push   %esi
+ 884:	53                   	push   %ebx
+  static struct pstat *ps;
+  int i, n;
+
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ 885:	a1 48 10 00 00       	mov    0x1048,%eax
+{
+ 88a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 88d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ 890:	85 c0                	test   %eax,%eax
+ 892:	0f 84 98 00 00 00    	je     930 <pidstat+0xb0>
+    return -1;
+  n = getpstat(ps, NPROC);
+ 898:	83 ec 08             	sub    $0x8,%esp
+ 89b:	6a 40                	push   $0x40
+ 89d:	50                   	push   %eax
+ 89e:	e8 e0 fb ff ff       	call   483 <getpstat>
+  for(i = 0; i < n; i++){
+ 8a3:	83 c4 10             	add    $0x10,%esp
+ 8a6:	85 c0                	test   %eax,%eax
+ 8a8:	0f 8e 9f 00 00 00    	jle    94d <pidstat+0xcd>
+ 8ae:	8b 15 48 10 00 00    	mov    0x1048,%edx
+ 8b4:	31 c9                	xor    %ecx,%ecx
+ 8b6:	eb 16                	jmp    8ce <pidstat+0x4e>
+ 8b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8bf:	90                   	nop
+ 8c0:	83 c1 01             	add    $0x1,%ecx
+ 8c3:	83 c2 38             	add    $0x38,%edx
+ 8c6:	39 c8                	cmp    %ecx,%eax
+ 8c8:	0f 84 7f 00 00 00    	je     94d <pidstat+0xcd>
+    if(ps[i].pid == pid){
+ 8ce:	39 1a                	cmp    %ebx,(%edx)
+ 8d0:	75 ee                	jne    8c0 <pidstat+0x40>
+      *st = ps[i];
+ 8d2:	89 1e                	mov    %ebx,(%esi)
+ 8d4:	8b 42 04             	mov    0x4(%edx),%eax
+ 8d7:	89 46 04             	mov    %eax,0x4(%esi)
+ 8da:	8b 42 08             	mov    0x8(%edx),%eax
+ 8dd:	89 46 08             	mov    %eax,0x8(%esi)
+ 8e0:	8b 42 0c             	mov    0xc(%edx),%eax
+ 8e3:	89 46 0c             	mov    %eax,0xc(%esi)
+ 8e6:	8b 42 10             	mov    0x10(%edx),%eax
+ 8e9:	89 46 10             	mov    %eax,0x10(%esi)
+ 8ec:	8b 42 14             	mov    0x14(%edx),%eax
+ 8ef:	89 46 14             	mov    %eax,0x14(%esi)
+ 8f2:	8b 42 18             	mov    0x18(%edx),%eax
+ 8f5:	89 46 18             	mov    %eax,0x18(%esi)
+ 8f8:	8b 42 1c             	mov    0x1c(%edx),%eax
+ 8fb:	89 46 1c             	mov    %eax,0x1c(%esi)
+ 8fe:	8b 42 20             	mov    0x20(%edx),%eax
+ 901:	89 46 20             	mov    %eax,0x20(%esi)
+ 904:	8b 42 24             	mov    0x24(%edx),%eax
+ 907:	89 46 24             	mov    %eax,0x24(%esi)
+ 90a:	8b 42 28             	mov    0x28(%edx),%eax
+ 90d:	89 46 28             	mov    %eax,0x28(%esi)
+ 910:	8b 42 2c             	mov    0x2c(%edx),%eax
+ 913:	89 46 2c             	mov    %eax,0x2c(%esi)
+ 916:	8b 42 30             	mov    0x30(%edx),%eax
+ 919:	89 46 30             	mov    %eax,0x30(%esi)
+ 91c:	8b 42 34             	mov    0x34(%edx),%eax
+ 91f:	89 46 34             	mov    %eax,0x34(%esi)
+      return 0;
+    }
+  }
+  return -1;
+}
+ 922:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ 925:	31 c0                	xor    %eax,%eax
+}
+ 927:	5b                   	pop    %ebx
+ 928:	5e                   	pop    %esi
+ 929:	5d                   	pop    %ebp
+ 92a:	c3                   	ret
+ 92b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 92f:	90                   	nop
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ 930:	83 ec 0c             	sub    $0xc,%esp
+ 933:	68 00 0e 00 00       	push   $0xe00
+ 938:	e8 53 fe ff ff       	call   790 <malloc>
+ 93d:	83 c4 10             	add    $0x10,%esp
+ 940:	a3 48 10 00 00       	mov    %eax,0x1048
+ 945:	85 c0                	test   %eax,%eax
+ 947:	0f 85 4b ff ff ff    	jne    898 <pidstat+0x18>
+}
+ 94d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return -1;
+ 950:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 955:	5b                   	pop    %ebx
+ 956:	5e                   	pop    %esi
+ 957:	5d                   	pop    %ebp
+ 958:	c3                   	ret
+ 959:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000960 <sharetable>:
+// key[i] is printed in a column headed keyname, and so is
+// extra[i] under extraname unless extra is 0.
+void
+sharetable(char *tag, char *keyname, int *key, char *extraname, int *extra,
+           int n, int *pid, int *weight, uint *ticks)
+{
+ 960:	55                   	push   %ebp
+ 961:	89 e5                	mov    %esp,%ebp
+ 963:	57                   	push   %edi
+ 964:	56                   	push   %esi
+ 965:	53                   	push   %ebx
+ 966:	83 ec 3c             	sub    $0x3c,%esp
+ 969:	8b 45 08             	mov    0x8(%ebp),%eax
+ 96c:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+ 96f:	8b 75 24             	mov    0x24(%ebp),%esi
+ 972:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 975:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 978:	8b 45 10             	mov    0x10(%ebp),%eax
+ 97b:	89 7d d0             	mov    %edi,-0x30(%ebp)
+ 97e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+ 981:	89 45 cc             	mov    %eax,-0x34(%ebp)
+ 984:	8b 45 18             	mov    0x18(%ebp),%eax
+ 987:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ 98a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 98d:	8b 45 20             	mov    0x20(%ebp),%eax
+ 990:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 993:	8b 45 28             	mov    0x28(%ebp),%eax
+ 996:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  int i, wsum, share, expect, err, maxerr;
+  uint tsum;
+
+  wsum = 0;
+  tsum = 0;
+  for(i = 0; i < n; i++){
+ 999:	85 ff                	test   %edi,%edi
+ 99b:	0f 8e df 01 00 00    	jle    b80 <sharetable+0x220>
+ 9a1:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+ 9a4:	89 fb                	mov    %edi,%ebx
+ 9a6:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  tsum = 0;
+ 9a9:	31 d2                	xor    %edx,%edx
+  for(i = 0; i < n; i++){
+ 9ab:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 9ae:	31 c0                	xor    %eax,%eax
+ 9b0:	31 c9                	xor    %ecx,%ecx
+ 9b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wsum += weight[i];
+ 9b8:	03 0c 86             	add    (%esi,%eax,4),%ecx
+    tsum += ticks[i];
+ 9bb:	03 14 87             	add    (%edi,%eax,4),%edx
+  for(i = 0; i < n; i++){
+ 9be:	83 c0 01             	add    $0x1,%eax
+ 9c1:	39 c3                	cmp    %eax,%ebx
+ 9c3:	75 f3                	jne    9b8 <sharetable+0x58>
+ 9c5:	85 d2                	test   %edx,%edx
+ 9c7:	b8 01 00 00 00       	mov    $0x1,%eax
+ 9cc:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  }
+  if(tsum == 0)
+    tsum = 1;
+  if(wsum == 0)
+    wsum = 1;
+ 9cf:	8b 7d d8             	mov    -0x28(%ebp),%edi
+ 9d2:	0f 45 c2             	cmovne %edx,%eax
+ 9d5:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+  if(tsum == 0)
+ 9d8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    wsum = 1;
+ 9db:	85 ff                	test   %edi,%edi
+ 9dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 9e0:	b8 01 00 00 00       	mov    $0x1,%eax
+ 9e5:	0f 45 c7             	cmovne %edi,%eax
+ 9e8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+
+  printf(1, "[%s]  pid %s ", tag, keyname);
+ 9eb:	51                   	push   %ecx
+ 9ec:	ff 75 dc             	push   -0x24(%ebp)
+ 9ef:	68 b5 0c 00 00       	push   $0xcb5
+ 9f4:	6a 01                	push   $0x1
+ 9f6:	e8 55 fb ff ff       	call   550 <printf>
+  if(extra)
+ 9fb:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 9fe:	83 c4 10             	add    $0x10,%esp
+ a01:	85 f6                	test   %esi,%esi
+ a03:	0f 84 47 01 00 00    	je     b50 <sharetable+0x1f0>
+    printf(1, "%s ", extraname);
+ a09:	83 ec 04             	sub    $0x4,%esp
+ a0c:	53                   	push   %ebx
+ a0d:	68 bf 0c 00 00       	push   $0xcbf
+ a12:	6a 01                	push   $0x1
+ a14:	e8 37 fb ff ff       	call   550 <printf>
+  printf(1, "ticks  share expected\n");
+ a19:	58                   	pop    %eax
+ a1a:	5a                   	pop    %edx
+ a1b:	68 c3 0c 00 00       	push   $0xcc3
+ a20:	6a 01                	push   $0x1
+ a22:	e8 29 fb ff ff       	call   550 <printf>
+  maxerr = 0;
+  for(i = 0; i < n; i++){
+ a27:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+ a2a:	83 c4 10             	add    $0x10,%esp
+ a2d:	85 c9                	test   %ecx,%ecx
+ a2f:	0f 8e 44 01 00 00    	jle    b79 <sharetable+0x219>
+  if(extra)
+ a35:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+ a3c:	31 ff                	xor    %edi,%edi
+ a3e:	66 90                	xchg   %ax,%ax
+    share = ticks[i] * 1000 / tsum;
+ a40:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ a43:	31 d2                	xor    %edx,%edx
+    expect = weight[i] * 1000 / wsum;
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+ a45:	83 ec 0c             	sub    $0xc,%esp
+    share = ticks[i] * 1000 / tsum;
+ a48:	69 04 b8 e8 03 00 00 	imul   $0x3e8,(%eax,%edi,4),%eax
+ a4f:	f7 75 c0             	divl   -0x40(%ebp)
+ a52:	89 c6                	mov    %eax,%esi
+    expect = weight[i] * 1000 / wsum;
+ a54:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a57:	69 04 b8 e8 03 00 00 	imul   $0x3e8,(%eax,%edi,4),%eax
+ a5e:	99                   	cltd
+ a5f:	f7 7d d8             	idivl  -0x28(%ebp)
+ a62:	89 c3                	mov    %eax,%ebx
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+ a64:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ a67:	ff 34 b8             	push   (%eax,%edi,4)
+ a6a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ a6d:	ff 34 b8             	push   (%eax,%edi,4)
+ a70:	ff 75 dc             	push   -0x24(%ebp)
+ a73:	68 da 0c 00 00       	push   $0xcda
+ a78:	6a 01                	push   $0x1
+ a7a:	e8 d1 fa ff ff       	call   550 <printf>
+    if(extra)
+ a7f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ a82:	83 c4 20             	add    $0x20,%esp
+ a85:	85 c0                	test   %eax,%eax
+ a87:	74 15                	je     a9e <sharetable+0x13e>
+      printf(1, "%d ", extra[i]);
+ a89:	83 ec 04             	sub    $0x4,%esp
+ a8c:	ff 34 b8             	push   (%eax,%edi,4)
+ a8f:	68 e2 0c 00 00       	push   $0xce2
+ a94:	6a 01                	push   $0x1
+ a96:	e8 b5 fa ff ff       	call   550 <printf>
+ a9b:	83 c4 10             	add    $0x10,%esp
+    printf(1, "%d %d.%d%% %d.%d%%\n", ticks[i], share / 10, share % 10,
+ a9e:	b8 67 66 66 66       	mov    $0x66666667,%eax
+ aa3:	89 d9                	mov    %ebx,%ecx
+ aa5:	83 ec 04             	sub    $0x4,%esp
+ aa8:	f7 eb                	imul   %ebx
+ aaa:	89 d8                	mov    %ebx,%eax
+ aac:	c1 f8 1f             	sar    $0x1f,%eax
+ aaf:	c1 fa 02             	sar    $0x2,%edx
+ ab2:	29 c2                	sub    %eax,%edx
+ ab4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ ab7:	01 c0                	add    %eax,%eax
+ ab9:	29 c1                	sub    %eax,%ecx
+ abb:	b8 67 66 66 66       	mov    $0x66666667,%eax
+ ac0:	51                   	push   %ecx
+ ac1:	89 f1                	mov    %esi,%ecx
+ ac3:	52                   	push   %edx
+ ac4:	f7 ee                	imul   %esi
+ ac6:	89 f0                	mov    %esi,%eax
+ ac8:	c1 f8 1f             	sar    $0x1f,%eax
+ acb:	c1 fa 02             	sar    $0x2,%edx
+ ace:	29 c2                	sub    %eax,%edx
+ ad0:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ ad3:	01 c0                	add    %eax,%eax
+ ad5:	29 c1                	sub    %eax,%ecx
+ ad7:	51                   	push   %ecx
+ ad8:	52                   	push   %edx
+ ad9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ adc:	ff 34 b8             	push   (%eax,%edi,4)
+ adf:	68 e6 0c 00 00       	push   $0xce6
+ ae4:	6a 01                	push   $0x1
+ ae6:	e8 65 fa ff ff       	call   550 <printf>
+           expect / 10, expect % 10);
+    err = share > expect ? share - expect : expect - share;
+ aeb:	89 f2                	mov    %esi,%edx
+ aed:	89 d8                	mov    %ebx,%eax
+ aef:	83 c4 20             	add    $0x20,%esp
+ af2:	29 f0                	sub    %esi,%eax
+ af4:	29 da                	sub    %ebx,%edx
+ af6:	39 de                	cmp    %ebx,%esi
+ af8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ afb:	0f 4f c2             	cmovg  %edx,%eax
+    if(err > maxerr)
+ afe:	39 c6                	cmp    %eax,%esi
+ b00:	0f 4d c6             	cmovge %esi,%eax
+  for(i = 0; i < n; i++){
+ b03:	83 c7 01             	add    $0x1,%edi
+ b06:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ b09:	39 7d d0             	cmp    %edi,-0x30(%ebp)
+ b0c:	0f 85 2e ff ff ff    	jne    a40 <sharetable+0xe0>
+      maxerr = err;
+  }
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+ b12:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+ b17:	f7 e2                	mul    %edx
+ b19:	c1 ea 03             	shr    $0x3,%edx
+ b1c:	8d 0c 92             	lea    (%edx,%edx,4),%ecx
+ b1f:	89 d0                	mov    %edx,%eax
+ b21:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ b24:	01 c9                	add    %ecx,%ecx
+ b26:	29 ca                	sub    %ecx,%edx
+ b28:	89 45 14             	mov    %eax,0x14(%ebp)
+ b2b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ b2e:	89 55 18             	mov    %edx,0x18(%ebp)
+ b31:	89 45 10             	mov    %eax,0x10(%ebp)
+ b34:	c7 45 0c fc 0c 00 00 	movl   $0xcfc,0xc(%ebp)
+ b3b:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+ b42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b45:	5b                   	pop    %ebx
+ b46:	5e                   	pop    %esi
+ b47:	5f                   	pop    %edi
+ b48:	5d                   	pop    %ebp
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+ b49:	e9 02 fa ff ff       	jmp    550 <printf>
+ b4e:	66 90                	xchg   %ax,%ax
+  printf(1, "ticks  share expected\n");
+ b50:	83 ec 08             	sub    $0x8,%esp
+ b53:	68 c3 0c 00 00       	push   $0xcc3
+ b58:	6a 01                	push   $0x1
+ b5a:	e8 f1 f9 ff ff       	call   550 <printf>
+ b5f:	83 c4 10             	add    $0x10,%esp
+ b62:	e9 ce fe ff ff       	jmp    a35 <sharetable+0xd5>
+ b67:	83 ec 08             	sub    $0x8,%esp
+ b6a:	68 c3 0c 00 00       	push   $0xcc3
+ b6f:	6a 01                	push   $0x1
+ b71:	e8 da f9 ff ff       	call   550 <printf>
+ b76:	83 c4 10             	add    $0x10,%esp
+  if(extra)
+ b79:	31 c0                	xor    %eax,%eax
+ b7b:	31 d2                	xor    %edx,%edx
+ b7d:	eb a9                	jmp    b28 <sharetable+0x1c8>
+ b7f:	90                   	nop
+  printf(1, "[%s]  pid %s ", tag, keyname);
+ b80:	51                   	push   %ecx
+ b81:	ff 75 dc             	push   -0x24(%ebp)
+ b84:	68 b5 0c 00 00       	push   $0xcb5
+ b89:	6a 01                	push   $0x1
+ b8b:	e8 c0 f9 ff ff       	call   550 <printf>
+  if(extra)
+ b90:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ b93:	83 c4 10             	add    $0x10,%esp
+ b96:	85 ff                	test   %edi,%edi
+ b98:	74 cd                	je     b67 <sharetable+0x207>
+    wsum = 1;
+ b9a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  if(extra)
+ ba1:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+ ba8:	e9 5c fe ff ff       	jmp    a09 <sharetable+0xa9>
@@ -1,14 +1,19 @@
 #define NPROC        64  // maximum number of processes
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
+#define HZ          100  // timer interrupts per second
+#define NPRIO         5  // scheduling priority levels (0 = highest)
+#define DEFTICKETS 1024  // STRIDE_SCHED tickets of a new process
+#define MAXTICKETS 65536 // most tickets settickets() will give
 #define NOFILE       16  // open files per process
 #define NFILE       100  // open files per system
-#define NINODE       50  // maximum number of active i-nodes
+#define NINODE      200  // maximum number of active i-nodes
+#define NDENTRY     256  // size of directory name cache
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
-#define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define LOGSIZE      (MAXOPBLOCKS*8)  // max data blocks in on-disk log
+#define NBUF         256  // size of disk block cache
+#define FSSIZE       2000  // size of file system in blocks
 
@@ -1,6 +1,7 @@
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
 #include "fs.h"
@@ -8,17 +9,65 @@
 #include "sleeplock.h"
 #include "file.h"
 
-#define PIPESIZE 512
+#define NLOAN     8
+#define PIPEMAXPG 16  // most extra pages a pipe's ring may use
 
+// Writes of whole, page-aligned user pages do not copy the
+// data into the pipe. The page is lent to the pipe copy-on-
+// write instead, and the reader either maps it in the same
+// way or copies out of it. Smaller writes go through the ring.
+// The pipe's byte stream is both, in order: a loan covers
+// the stream from pos on.
+struct loan {
+  uint pos;       // stream offset of the first unread byte
+  uint pa;        // physical address of the page
+  uint off;       // first unread byte within the page
+};
+
+// The ring starts in data[], the rest of the pipe's own page,
+// and goes on into up to PIPEMAXPG more pages (see pipesize).
 struct pipe {
   struct spinlock lock;
-  char data[PIPESIZE];
   uint nread;     // number of bytes read
   uint nwrite;    // number of bytes written
+  uint size;      // capacity of the ring
+  uint rhead;     // ring index of the first unread byte
+  uint rcount;    // number of bytes in the ring
+  int npage;      // number of extra ring pages
+  char *page[PIPEMAXPG];
+  struct loan loan[NLOAN];
+  uint lread;     // number of loans used up
+  uint lwrite;    // number of loans made
   int readopen;   // read fd is still open
   int writeopen;  // write fd is still open
+  int rwait;      // number of readers asleep
+  int wwait;      // number of writers asleep
+  char data[];
 };
 
+#define PIPEDATA  (PGSIZE - sizeof(struct pipe))
+
+// Rather than on every chunk copied, wake readers when the
+// ring fills to the high-water mark or a write ends, and
+// writers once per read that made room. A reader may not read
+// again until the writer moves on, so a read that leaves data
+// behind must still wake a waiting writer.
+#define HIWAT(p)  ((p)->size / 2)
+
+// Address of ring byte i. Sets *n to the number of bytes
+// that are contiguous from there.
+static char*
+ringptr(struct pipe *p, uint i, uint *n)
+{
+  if(i < PIPEDATA){
+    *n = PIPEDATA - i;
+    return p->data + i;
+  }
+  i -= PIPEDATA;
+  *n = PGSIZE - i%PGSIZE;
+  return p->page[i/PGSIZE] + i%PGSIZE;
+}
+
 int
 pipealloc(struct file **f0, struct file **f1)
 {
@@ -34,6 +83,14 @@ pipealloc(struct file **f0, struct file **f1)
   p->writeopen = 1;
   p->nwrite = 0;
   p->nread = 0;
+  p->size = PIPEDATA;
+  p->rhead = 0;
+  p->rcount = 0;
+  p->npage = 0;
+  p->lwrite = 0;
+  p->lread = 0;
+  p->rwait = 0;
+  p->wwait = 0;
   initlock(&p->lock, "pipe");
   (*f0)->type = FD_PIPE;
   (*f0)->readable = 1;
@@ -69,30 +126,80 @@ pipeclose(struct pipe *p, int writable)
   }
   if(p->readopen == 0 && p->writeopen == 0){
     release(&p->lock);
+    for(; p->lread != p->lwrite; p->lread++)
+      kfree(P2V(p->loan[p->lread % NLOAN].pa));
+    while(p->npage > 0)
+      kfree(p->page[--p->npage]);
     kfree((char*)p);
   } else
     release(&p->lock);
 }
 
+// Wait for room in p. Returns -1 if the pipe is closed
+// or the caller killed.
+static int
+pipewait(struct pipe *p)
+{
+  if(p->readopen == 0 || myproc()->killed){
+    release(&p->lock);
+    return -1;
+  }
+  if(p->rwait)
+    wakeup(&p->nread);
+  p->wwait++;
+  sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
+  p->wwait--;
+  return 0;
+}
+
 //PAGEBREAK: 40
 int
 pipewrite(struct pipe *p, char *addr, int n)
 {
+  struct loan *l;
+  uint pa, m, run;
+  char *dst;
   int i;
 
   acquire(&p->lock);
-  for(i = 0; i < n; i++){
-    while(p->nwrite == p->nread + PIPESIZE){  //DOC: pipewrite-full
-      if(p->readopen == 0 || myproc()->killed){
-        release(&p->lock);
-        return -1;
+  for(i = 0; i < n; i += m){
+    if((uint)(addr+i) % PGSIZE == 0 && n - i >= PGSIZE){
+      // A whole page: lend it, unless the loans are all out.
+      while(p->lwrite == p->lread + NLOAN)
+        if(pipewait(p) < 0)
+          return -1;
+      if((pa = loanpage(myproc()->pgdir, addr+i)) != 0){
+        l = &p->loan[p->lwrite++ % NLOAN];
+        l->pos = p->nwrite;
+        l->pa = pa;
+        l->off = 0;
+        p->nwrite += PGSIZE;
+        m = PGSIZE;
+        continue;
       }
-      wakeup(&p->nread);
-      sleep(&p->nwrite, &p->lock);  //DOC: pipewrite-sleep
     }
-    p->data[p->nwrite++ % PIPESIZE] = addr[i];
+    while(p->rcount == p->size)  //DOC: pipewrite-full
+      if(pipewait(p) < 0)
+        return -1;
+
+    // Copy into the ring, stopping at a page boundary in
+    // addr in case the rest can be lent.
+    dst = ringptr(p, (p->rhead + p->rcount) % p->size, &run);
+    m = n - i;
+    if(m > p->size - p->rcount)
+      m = p->size - p->rcount;
+    if(m > run)
+      m = run;
+    if(m > PGSIZE - (uint)(addr+i) % PGSIZE)
+      m = PGSIZE - (uint)(addr+i) % PGSIZE;
+    memmove(dst, addr+i, m);
+    p->rcount += m;
+    p->nwrite += m;
+    if(p->rwait && p->rcount >= HIWAT(p) && p->rcount - m < HIWAT(p))
+      wakeup(&p->nread);
   }
-  wakeup(&p->nread);  //DOC: pipewrite-wakeup1
+  if(p->rwait)
+    wakeup(&p->nread);  //DOC: pipewrite-wakeup1
   release(&p->lock);
   return n;
 }
@@ -100,6 +207,9 @@ pipewrite(struct pipe *p, char *addr, int n)
 int
 piperead(struct pipe *p, char *addr, int n)
 {
+  struct loan *l;
+  uint m, run;
+  char *src;
   int i;
 
   acquire(&p->lock);
@@ -108,14 +218,89 @@ piperead(struct pipe *p, char *addr, int n)
       release(&p->lock);
       return -1;
     }
+    p->rwait++;
     sleep(&p->nread, &p->lock); //DOC: piperead-sleep
+    p->rwait--;
   }
-  for(i = 0; i < n; i++){  //DOC: piperead-copy
-    if(p->nread == p->nwrite)
-      break;
-    addr[i] = p->data[p->nread++ % PIPESIZE];
+  for(i = 0; i < n && p->nread != p->nwrite; i += m){  //DOC: piperead-copy
+    l = &p->loan[p->lread % NLOAN];
+    if(p->lread == p->lwrite || l->pos != p->nread){
+      // From the ring, up to the next loan.
+      src = ringptr(p, p->rhead, &run);
+      m = n - i;
+      if(m > p->rcount)
+        m = p->rcount;
+      if(m > run)
+        m = run;
+      if(p->lread != p->lwrite && m > l->pos - p->nread)
+        m = l->pos - p->nread;
+      memmove(addr+i, src, m);
+      p->rhead = (p->rhead + m) % p->size;
+      p->rcount -= m;
+      p->nread += m;
+      continue;
+    }
+
+    // From a lent page: take the page itself if the reader
+    // wants all of it at a page boundary, else copy.
+    m = PGSIZE - l->off;
+    if(m > n - i)
+      m = n - i;
+    if(m == PGSIZE && (uint)(addr+i) % PGSIZE == 0 &&
+       maploan(myproc()->pgdir, addr+i, l->pa) == 0){
+      l->pa = 0;
+    } else
+      memmove(addr+i, (char*)P2V(l->pa) + l->off, m);
+    l->off += m;
+    l->pos += m;
+    p->nread += m;
+    if(l->off == PGSIZE){
+      if(l->pa)
+        kfree(P2V(l->pa));
+      p->lread++;
+    }
   }
-  wakeup(&p->nwrite);  //DOC: piperead-wakeup
+  if(p->wwait && i > 0)
+    wakeup(&p->nwrite);  //DOC: piperead-wakeup
   release(&p->lock);
   return i;
 }
+
+// Make p's ring hold at least n bytes, or if n is 0 just
+// report its capacity. The ring can only change size while
+// it is empty. Returns the capacity, or -1.
+int
+pipesize(struct pipe *p, int n)
+{
+  int npage, r;
+  char *pg;
+
+  if(n < 0)
+    return -1;
+  acquire(&p->lock);
+  r = 0;
+  if(n > 0){
+    npage = n <= PIPEDATA ? 0 : (n - PIPEDATA + PGSIZE-1) / PGSIZE;
+    if(npage > PIPEMAXPG || p->rcount > 0){
+      release(&p->lock);
+      return -1;
+    }
+    while(p->npage > npage)
+      kfree(p->page[--p->npage]);
+    while(p->npage < npage){
+      if((pg = kalloc()) == 0){
+        r = -1;
+        break;
+      }
+      p->page[p->npage++] = pg;
+    }
+    p->size = PIPEDATA + p->npage*PGSIZE;
+    p->rhead = 0;
+    if(p->wwait)
+      wakeup(&p->nwrite);
+  }
+  if(r == 0)
+    r = p->size;
+  release(&p->lock);
+  return r;
+}
@@ -0,0 +1,1693 @@
+
+_pipebench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         cap, total / 1024, uptime() - start);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+  int kb = 4096, chunk = 512;
+   f:	be 00 10 00 00       	mov    $0x1000,%esi
+{
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 28             	sub    $0x28,%esp
+  19:	8b 19                	mov    (%ecx),%ebx
+  1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int kb = 4096, chunk = 512;
+  1e:	c7 45 d0 00 02 00 00 	movl   $0x200,-0x30(%ebp)
+  int i;
+
+  if (argc > 1) kb = atoi(argv[1]);
+  25:	83 fb 01             	cmp    $0x1,%ebx
+  28:	0f 8f e2 00 00 00    	jg     110 <main+0x110>
+  if (argc > 2) chunk = atoi(argv[2]);
+  if (chunk <= 0 || chunk > sizeof(buf) / 2)
+    chunk = 512;
+
+  printf(1, "\n[PIPEBENCH] %d KB in %d-byte writes\n", kb, chunk);
+  2e:	ff 75 d0             	push   -0x30(%ebp)
+  for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+  31:	31 ff                	xor    %edi,%edi
+  printf(1, "\n[PIPEBENCH] %d KB in %d-byte writes\n", kb, chunk);
+  33:	56                   	push   %esi
+  34:	68 f0 0b 00 00       	push   $0xbf0
+  39:	6a 01                	push   $0x1
+  3b:	e8 50 05 00 00       	call   590 <printf>
+  for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+  40:	89 75 cc             	mov    %esi,-0x34(%ebp)
+  printf(1, "\n[PIPEBENCH] %d KB in %d-byte writes\n", kb, chunk);
+  43:	83 c4 10             	add    $0x10,%esp
+  if (pipe(fds) < 0) {
+  46:	83 ec 0c             	sub    $0xc,%esp
+  49:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    run(sizes[i], kb, chunk);
+  4c:	8b 1c bd 94 0c 00 00 	mov    0xc94(,%edi,4),%ebx
+  if (pipe(fds) < 0) {
+  53:	50                   	push   %eax
+  54:	e8 ca 03 00 00       	call   423 <pipe>
+  59:	83 c4 10             	add    $0x10,%esp
+  5c:	85 c0                	test   %eax,%eax
+  5e:	0f 88 4c 01 00 00    	js     1b0 <main+0x1b0>
+  cap = pipesize(fds[0], size);   // 0: keep the default
+  64:	83 ec 08             	sub    $0x8,%esp
+  67:	53                   	push   %ebx
+  68:	ff 75 e0             	push   -0x20(%ebp)
+  6b:	e8 5b 04 00 00       	call   4cb <pipesize>
+  if (cap < 0) {
+  70:	83 c4 10             	add    $0x10,%esp
+  cap = pipesize(fds[0], size);   // 0: keep the default
+  73:	89 c6                	mov    %eax,%esi
+  if (cap < 0) {
+  75:	85 c0                	test   %eax,%eax
+  77:	0f 88 20 01 00 00    	js     19d <main+0x19d>
+  start = uptime();
+  7d:	e8 29 04 00 00       	call   4ab <uptime>
+  82:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  pid = fork();
+  85:	e8 81 03 00 00       	call   40b <fork>
+  if (pid < 0) {
+  8a:	85 c0                	test   %eax,%eax
+  8c:	0f 88 f8 00 00 00    	js     18a <main+0x18a>
+  if (pid == 0) {
+  92:	0f 84 b9 00 00 00    	je     151 <main+0x151>
+  close(fds[1]);
+  98:	83 ec 0c             	sub    $0xc,%esp
+  9b:	ff 75 e4             	push   -0x1c(%ebp)
+  total = 0;
+  9e:	31 db                	xor    %ebx,%ebx
+  close(fds[1]);
+  a0:	e8 96 03 00 00       	call   43b <close>
+  while ((n = read(fds[0], buf, sizeof(buf))) > 0)
+  a5:	83 c4 10             	add    $0x10,%esp
+  a8:	eb 08                	jmp    b2 <main+0xb2>
+  aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    total += n;
+  b0:	01 c3                	add    %eax,%ebx
+  while ((n = read(fds[0], buf, sizeof(buf))) > 0)
+  b2:	83 ec 04             	sub    $0x4,%esp
+  b5:	68 00 10 00 00       	push   $0x1000
+  ba:	68 80 10 00 00       	push   $0x1080
+  bf:	ff 75 e0             	push   -0x20(%ebp)
+  c2:	e8 64 03 00 00       	call   42b <read>
+  c7:	83 c4 10             	add    $0x10,%esp
+  ca:	85 c0                	test   %eax,%eax
+  cc:	7f e2                	jg     b0 <main+0xb0>
+  close(fds[0]);
+  ce:	83 ec 0c             	sub    $0xc,%esp
+  d1:	ff 75 e0             	push   -0x20(%ebp)
+  printf(1, "[PIPEBENCH] buffer=%d read=%d KB ticks=%d\n",
+  d4:	c1 fb 0a             	sar    $0xa,%ebx
+  for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+  d7:	83 c7 01             	add    $0x1,%edi
+  close(fds[0]);
+  da:	e8 5c 03 00 00       	call   43b <close>
+  wait();
+  df:	e8 37 03 00 00       	call   41b <wait>
+         cap, total / 1024, uptime() - start);
+  e4:	e8 c2 03 00 00       	call   4ab <uptime>
+  printf(1, "[PIPEBENCH] buffer=%d read=%d KB ticks=%d\n",
+  e9:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  ec:	29 d0                	sub    %edx,%eax
+  ee:	89 04 24             	mov    %eax,(%esp)
+  f1:	53                   	push   %ebx
+  f2:	56                   	push   %esi
+  f3:	68 38 0c 00 00       	push   $0xc38
+  f8:	6a 01                	push   $0x1
+  fa:	e8 91 04 00 00       	call   590 <printf>
+  for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+  ff:	83 c4 20             	add    $0x20,%esp
+ 102:	83 ff 03             	cmp    $0x3,%edi
+ 105:	0f 85 3b ff ff ff    	jne    46 <main+0x46>
+    exit();
+ 10b:	e8 03 03 00 00       	call   413 <exit>
+  if (argc > 1) kb = atoi(argv[1]);
+ 110:	83 ec 0c             	sub    $0xc,%esp
+ 113:	ff 77 04             	push   0x4(%edi)
+ 116:	e8 85 02 00 00       	call   3a0 <atoi>
+  if (argc > 2) chunk = atoi(argv[2]);
+ 11b:	83 c4 10             	add    $0x10,%esp
+  if (argc > 1) kb = atoi(argv[1]);
+ 11e:	89 c6                	mov    %eax,%esi
+  if (argc > 2) chunk = atoi(argv[2]);
+ 120:	83 fb 02             	cmp    $0x2,%ebx
+ 123:	75 0c                	jne    131 <main+0x131>
+    chunk = 512;
+ 125:	c7 45 d0 00 02 00 00 	movl   $0x200,-0x30(%ebp)
+ 12c:	e9 fd fe ff ff       	jmp    2e <main+0x2e>
+  if (argc > 2) chunk = atoi(argv[2]);
+ 131:	83 ec 0c             	sub    $0xc,%esp
+ 134:	ff 77 08             	push   0x8(%edi)
+ 137:	e8 64 02 00 00       	call   3a0 <atoi>
+  if (chunk <= 0 || chunk > sizeof(buf) / 2)
+ 13c:	83 c4 10             	add    $0x10,%esp
+  if (argc > 2) chunk = atoi(argv[2]);
+ 13f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if (chunk <= 0 || chunk > sizeof(buf) / 2)
+ 142:	83 e8 01             	sub    $0x1,%eax
+ 145:	3d ff 07 00 00       	cmp    $0x7ff,%eax
+ 14a:	77 d9                	ja     125 <main+0x125>
+ 14c:	e9 dd fe ff ff       	jmp    2e <main+0x2e>
+    close(fds[0]);
+ 151:	8b 75 cc             	mov    -0x34(%ebp),%esi
+ 154:	83 ec 0c             	sub    $0xc,%esp
+ 157:	ff 75 e0             	push   -0x20(%ebp)
+ 15a:	89 c3                	mov    %eax,%ebx
+    for (total = 0; total < kb * 1024; total += chunk)
+ 15c:	c1 e6 0a             	shl    $0xa,%esi
+    close(fds[0]);
+ 15f:	e8 d7 02 00 00       	call   43b <close>
+    for (total = 0; total < kb * 1024; total += chunk)
+ 164:	8b 7d d0             	mov    -0x30(%ebp),%edi
+ 167:	83 c4 10             	add    $0x10,%esp
+ 16a:	eb 18                	jmp    184 <main+0x184>
+      if (write(fds[1], buf, chunk) != chunk)
+ 16c:	50                   	push   %eax
+ 16d:	57                   	push   %edi
+ 16e:	68 80 10 00 00       	push   $0x1080
+ 173:	ff 75 e4             	push   -0x1c(%ebp)
+ 176:	e8 b8 02 00 00       	call   433 <write>
+ 17b:	83 c4 10             	add    $0x10,%esp
+ 17e:	39 c7                	cmp    %eax,%edi
+ 180:	75 89                	jne    10b <main+0x10b>
+    for (total = 0; total < kb * 1024; total += chunk)
+ 182:	01 fb                	add    %edi,%ebx
+ 184:	39 f3                	cmp    %esi,%ebx
+ 186:	7c e4                	jl     16c <main+0x16c>
+ 188:	eb 81                	jmp    10b <main+0x10b>
+    printf(2, "pipebench: fork failed\n");
+ 18a:	52                   	push   %edx
+ 18b:	52                   	push   %edx
+ 18c:	68 7b 0c 00 00       	push   $0xc7b
+ 191:	6a 02                	push   $0x2
+ 193:	e8 f8 03 00 00       	call   590 <printf>
+    exit();
+ 198:	e8 76 02 00 00       	call   413 <exit>
+    printf(2, "pipebench: pipesize %d failed\n", size);
+ 19d:	51                   	push   %ecx
+ 19e:	53                   	push   %ebx
+ 19f:	68 18 0c 00 00       	push   $0xc18
+ 1a4:	6a 02                	push   $0x2
+ 1a6:	e8 e5 03 00 00       	call   590 <printf>
+    exit();
+ 1ab:	e8 63 02 00 00       	call   413 <exit>
+    printf(2, "pipebench: pipe failed\n");
+ 1b0:	53                   	push   %ebx
+ 1b1:	53                   	push   %ebx
+ 1b2:	68 63 0c 00 00       	push   $0xc63
+ 1b7:	6a 02                	push   $0x2
+ 1b9:	e8 d2 03 00 00       	call   590 <printf>
+    exit();
+ 1be:	e8 50 02 00 00       	call   413 <exit>
+ 1c3:	66 90                	xchg   %ax,%ax
+ 1c5:	66 90                	xchg   %ax,%ax
+ 1c7:	66 90                	xchg   %ax,%ax
+ 1c9:	66 90                	xchg   %ax,%ax
+ 1cb:	66 90                	xchg   %ax,%ax
+ 1cd:	66 90                	xchg   %ax,%ax
+ 1cf:	90                   	nop
+
+000001d0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1d1:	31 c0                	xor    %eax,%eax
+{
+ 1d3:	89 e5                	mov    %esp,%ebp
+ 1d5:	53                   	push   %ebx
+ 1d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1e7:	83 c0 01             	add    $0x1,%eax
+ 1ea:	84 d2                	test   %dl,%dl
+ 1ec:	75 f2                	jne    1e0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1f1:	89 c8                	mov    %ecx,%eax
+ 1f3:	c9                   	leave
+ 1f4:	c3                   	ret
+ 1f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+ 207:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 20a:	0f b6 02             	movzbl (%edx),%eax
+ 20d:	84 c0                	test   %al,%al
+ 20f:	75 17                	jne    228 <strcmp+0x28>
+ 211:	eb 3a                	jmp    24d <strcmp+0x4d>
+ 213:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 217:	90                   	nop
+ 218:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 21c:	83 c2 01             	add    $0x1,%edx
+ 21f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 222:	84 c0                	test   %al,%al
+ 224:	74 1a                	je     240 <strcmp+0x40>
+    p++, q++;
+ 226:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 228:	0f b6 19             	movzbl (%ecx),%ebx
+ 22b:	38 c3                	cmp    %al,%bl
+ 22d:	74 e9                	je     218 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 22f:	29 d8                	sub    %ebx,%eax
+}
+ 231:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 234:	c9                   	leave
+ 235:	c3                   	ret
+ 236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 240:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 244:	31 c0                	xor    %eax,%eax
+ 246:	29 d8                	sub    %ebx,%eax
+}
+ 248:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 24b:	c9                   	leave
+ 24c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 24d:	0f b6 19             	movzbl (%ecx),%ebx
+ 250:	31 c0                	xor    %eax,%eax
+ 252:	eb db                	jmp    22f <strcmp+0x2f>
+ 254:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 25f:	90                   	nop
+
+00000260 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 266:	80 3a 00             	cmpb   $0x0,(%edx)
+ 269:	74 15                	je     280 <strlen+0x20>
+ 26b:	31 c0                	xor    %eax,%eax
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+ 270:	83 c0 01             	add    $0x1,%eax
+ 273:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 277:	89 c1                	mov    %eax,%ecx
+ 279:	75 f5                	jne    270 <strlen+0x10>
+    ;
+  return n;
+}
+ 27b:	89 c8                	mov    %ecx,%eax
+ 27d:	5d                   	pop    %ebp
+ 27e:	c3                   	ret
+ 27f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 280:	31 c9                	xor    %ecx,%ecx
+}
+ 282:	5d                   	pop    %ebp
+ 283:	89 c8                	mov    %ecx,%eax
+ 285:	c3                   	ret
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000290 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 297:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 29a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29d:	89 d7                	mov    %edx,%edi
+ 29f:	fc                   	cld
+ 2a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2a5:	89 d0                	mov    %edx,%eax
+ 2a7:	c9                   	leave
+ 2a8:	c3                   	ret
+ 2a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2ba:	0f b6 10             	movzbl (%eax),%edx
+ 2bd:	84 d2                	test   %dl,%dl
+ 2bf:	75 12                	jne    2d3 <strchr+0x23>
+ 2c1:	eb 1d                	jmp    2e0 <strchr+0x30>
+ 2c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c7:	90                   	nop
+ 2c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2cc:	83 c0 01             	add    $0x1,%eax
+ 2cf:	84 d2                	test   %dl,%dl
+ 2d1:	74 0d                	je     2e0 <strchr+0x30>
+    if(*s == c)
+ 2d3:	38 d1                	cmp    %dl,%cl
+ 2d5:	75 f1                	jne    2c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2d7:	5d                   	pop    %ebp
+ 2d8:	c3                   	ret
+ 2d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2e0:	31 c0                	xor    %eax,%eax
+}
+ 2e2:	5d                   	pop    %ebp
+ 2e3:	c3                   	ret
+ 2e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+
+000002f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2f9:	31 db                	xor    %ebx,%ebx
+{
+ 2fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2fe:	eb 27                	jmp    327 <gets+0x37>
+    cc = read(0, &c, 1);
+ 300:	83 ec 04             	sub    $0x4,%esp
+ 303:	6a 01                	push   $0x1
+ 305:	56                   	push   %esi
+ 306:	6a 00                	push   $0x0
+ 308:	e8 1e 01 00 00       	call   42b <read>
+    if(cc < 1)
+ 30d:	83 c4 10             	add    $0x10,%esp
+ 310:	85 c0                	test   %eax,%eax
+ 312:	7e 1d                	jle    331 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 314:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 318:	8b 55 08             	mov    0x8(%ebp),%edx
+ 31b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 31f:	3c 0a                	cmp    $0xa,%al
+ 321:	74 10                	je     333 <gets+0x43>
+ 323:	3c 0d                	cmp    $0xd,%al
+ 325:	74 0c                	je     333 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 327:	89 df                	mov    %ebx,%edi
+ 329:	83 c3 01             	add    $0x1,%ebx
+ 32c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 32f:	7c cf                	jl     300 <gets+0x10>
+ 331:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 333:	8b 45 08             	mov    0x8(%ebp),%eax
+ 336:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 33a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 33d:	5b                   	pop    %ebx
+ 33e:	5e                   	pop    %esi
+ 33f:	5f                   	pop    %edi
+ 340:	5d                   	pop    %ebp
+ 341:	c3                   	ret
+ 342:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 349:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	56                   	push   %esi
+ 354:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 355:	83 ec 08             	sub    $0x8,%esp
+ 358:	6a 00                	push   $0x0
+ 35a:	ff 75 08             	push   0x8(%ebp)
+ 35d:	e8 f1 00 00 00       	call   453 <open>
+  if(fd < 0)
+ 362:	83 c4 10             	add    $0x10,%esp
+ 365:	85 c0                	test   %eax,%eax
+ 367:	78 27                	js     390 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 369:	83 ec 08             	sub    $0x8,%esp
+ 36c:	ff 75 0c             	push   0xc(%ebp)
+ 36f:	89 c3                	mov    %eax,%ebx
+ 371:	50                   	push   %eax
+ 372:	e8 f4 00 00 00       	call   46b <fstat>
+  close(fd);
+ 377:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 37a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 37c:	e8 ba 00 00 00       	call   43b <close>
+  return r;
+ 381:	83 c4 10             	add    $0x10,%esp
+}
+ 384:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 387:	89 f0                	mov    %esi,%eax
+ 389:	5b                   	pop    %ebx
+ 38a:	5e                   	pop    %esi
+ 38b:	5d                   	pop    %ebp
+ 38c:	c3                   	ret
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 390:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 395:	eb ed                	jmp    384 <stat+0x34>
+ 397:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39e:	66 90                	xchg   %ax,%ax
+
+000003a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	53                   	push   %ebx
+ 3a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3a7:	0f be 02             	movsbl (%edx),%eax
+ 3aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3b5:	77 1e                	ja     3d5 <atoi+0x35>
+ 3b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3c0:	83 c2 01             	add    $0x1,%edx
+ 3c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3ca:	0f be 02             	movsbl (%edx),%eax
+ 3cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3d0:	80 fb 09             	cmp    $0x9,%bl
+ 3d3:	76 eb                	jbe    3c0 <atoi+0x20>
+  return n;
+}
+ 3d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3d8:	89 c8                	mov    %ecx,%eax
+ 3da:	c9                   	leave
+ 3db:	c3                   	ret
+ 3dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003e0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	57                   	push   %edi
+ 3e4:	56                   	push   %esi
+ 3e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3ee:	85 c0                	test   %eax,%eax
+ 3f0:	7e 13                	jle    405 <memmove+0x25>
+ 3f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3f4:	89 d7                	mov    %edx,%edi
+ 3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 400:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 401:	39 f8                	cmp    %edi,%eax
+ 403:	75 fb                	jne    400 <memmove+0x20>
+  return vdst;
+}
+ 405:	5e                   	pop    %esi
+ 406:	89 d0                	mov    %edx,%eax
+ 408:	5f                   	pop    %edi
+ 409:	5d                   	pop    %ebp
+ 40a:	c3                   	ret
+
+0000040b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 40b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <exit>:
+SYSCALL(exit)
+ 413:	b8 02 00 00 00       	mov    $0x2,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <wait>:
+SYSCALL(wait)
+ 41b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <pipe>:
+SYSCALL(pipe)
+ 423:	b8 04 00 00 00       	mov    $0x4,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <read>:
+SYSCALL(read)
+ 42b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <write>:
+SYSCALL(write)
+ 433:	b8 10 00 00 00       	mov    $0x10,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <close>:
+SYSCALL(close)
+ 43b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <kill>:
+SYSCALL(kill)
+ 443:	b8 06 00 00 00       	mov    $0x6,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <exec>:
+SYSCALL(exec)
+ 44b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <open>:
+SYSCALL(open)
+ 453:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <mknod>:
+SYSCALL(mknod)
+ 45b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <unlink>:
+SYSCALL(unlink)
+ 463:	b8 12 00 00 00       	mov    $0x12,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <fstat>:
+SYSCALL(fstat)
+ 46b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <link>:
+SYSCALL(link)
+ 473:	b8 13 00 00 00       	mov    $0x13,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <mkdir>:
+SYSCALL(mkdir)
+ 47b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <chdir>:
+SYSCALL(chdir)
+ 483:	b8 09 00 00 00       	mov    $0x9,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <dup>:
+SYSCALL(dup)
+ 48b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <getpid>:
+SYSCALL(getpid)
+ 493:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <sbrk>:
+SYSCALL(sbrk)
+ 49b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <sleep>:
+SYSCALL(sleep)
+ 4a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <uptime>:
+SYSCALL(uptime)
+ 4ab:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <nice>:
+SYSCALL(nice)
+ 4b3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <fsync>:
+SYSCALL(fsync)
+ 4bb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <getpstat>:
+SYSCALL(getpstat)
+ 4c3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <pipesize>:
+SYSCALL(pipesize)
+ 4cb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <uptimens>:
+SYSCALL(uptimens)
+ 4d3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+
+000004db <settickets>:
+SYSCALL(settickets)
+ 4db:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4e0:	cd 40                	int    $0x40
+ 4e2:	c3                   	ret
+
+000004e3 <transfer>:
+SYSCALL(transfer)
+ 4e3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4e8:	cd 40                	int    $0x40
+ 4ea:	c3                   	ret
+ 4eb:	66 90                	xchg   %ax,%ax
+ 4ed:	66 90                	xchg   %ax,%ax
+ 4ef:	90                   	nop
+
+000004f0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	57                   	push   %edi
+ 4f4:	56                   	push   %esi
+ 4f5:	53                   	push   %ebx
+ 4f6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4f8:	89 d1                	mov    %edx,%ecx
+{
+ 4fa:	83 ec 3c             	sub    $0x3c,%esp
+ 4fd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 500:	85 d2                	test   %edx,%edx
+ 502:	0f 89 80 00 00 00    	jns    588 <printint+0x98>
+ 508:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 50c:	74 7a                	je     588 <printint+0x98>
+    x = -xx;
+ 50e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 510:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 515:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 518:	31 f6                	xor    %esi,%esi
+ 51a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 520:	89 c8                	mov    %ecx,%eax
+ 522:	31 d2                	xor    %edx,%edx
+ 524:	89 f7                	mov    %esi,%edi
+ 526:	f7 f3                	div    %ebx
+ 528:	8d 76 01             	lea    0x1(%esi),%esi
+ 52b:	0f b6 92 00 0d 00 00 	movzbl 0xd00(%edx),%edx
+ 532:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 536:	89 ca                	mov    %ecx,%edx
+ 538:	89 c1                	mov    %eax,%ecx
+ 53a:	39 da                	cmp    %ebx,%edx
+ 53c:	73 e2                	jae    520 <printint+0x30>
+  if(neg)
+ 53e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 541:	85 c0                	test   %eax,%eax
+ 543:	74 07                	je     54c <printint+0x5c>
+    buf[i++] = '-';
+ 545:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 54a:	89 f7                	mov    %esi,%edi
+ 54c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 54f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 552:	01 df                	add    %ebx,%edi
+ 554:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 558:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 55b:	83 ec 04             	sub    $0x4,%esp
+ 55e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 561:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 564:	6a 01                	push   $0x1
+ 566:	50                   	push   %eax
+ 567:	56                   	push   %esi
+ 568:	e8 c6 fe ff ff       	call   433 <write>
+  while(--i >= 0)
+ 56d:	89 f8                	mov    %edi,%eax
+ 56f:	83 c4 10             	add    $0x10,%esp
+ 572:	83 ef 01             	sub    $0x1,%edi
+ 575:	39 d8                	cmp    %ebx,%eax
+ 577:	75 df                	jne    558 <printint+0x68>
+}
+ 579:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 57c:	5b                   	pop    %ebx
+ 57d:	5e                   	pop    %esi
+ 57e:	5f                   	pop    %edi
+ 57f:	5d                   	pop    %ebp
+ 580:	c3                   	ret
+ 581:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 588:	31 c0                	xor    %eax,%eax
+ 58a:	eb 89                	jmp    515 <printint+0x25>
+ 58c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000590 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	57                   	push   %edi
+ 594:	56                   	push   %esi
+ 595:	53                   	push   %ebx
+ 596:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 599:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 59c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 59f:	0f b6 1e             	movzbl (%esi),%ebx
+ 5a2:	83 c6 01             	add    $0x1,%esi
+ 5a5:	84 db                	test   %bl,%bl
+ 5a7:	74 67                	je     610 <printf+0x80>
+ 5a9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 5ac:	31 d2                	xor    %edx,%edx
+ 5ae:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5b1:	eb 34                	jmp    5e7 <printf+0x57>
+ 5b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5b7:	90                   	nop
+ 5b8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5bb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 5c0:	83 f8 25             	cmp    $0x25,%eax
+ 5c3:	74 18                	je     5dd <printf+0x4d>
+  write(fd, &c, 1);
+ 5c5:	83 ec 04             	sub    $0x4,%esp
+ 5c8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5cb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5ce:	6a 01                	push   $0x1
+ 5d0:	50                   	push   %eax
+ 5d1:	57                   	push   %edi
+ 5d2:	e8 5c fe ff ff       	call   433 <write>
+ 5d7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 5da:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 5dd:	0f b6 1e             	movzbl (%esi),%ebx
+ 5e0:	83 c6 01             	add    $0x1,%esi
+ 5e3:	84 db                	test   %bl,%bl
+ 5e5:	74 29                	je     610 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 5e7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5ea:	85 d2                	test   %edx,%edx
+ 5ec:	74 ca                	je     5b8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 5ee:	83 fa 25             	cmp    $0x25,%edx
+ 5f1:	75 ea                	jne    5dd <printf+0x4d>
+      if(c == 'd'){
+ 5f3:	83 f8 25             	cmp    $0x25,%eax
+ 5f6:	0f 84 24 01 00 00    	je     720 <printf+0x190>
+ 5fc:	83 e8 63             	sub    $0x63,%eax
+ 5ff:	83 f8 15             	cmp    $0x15,%eax
+ 602:	77 1c                	ja     620 <printf+0x90>
+ 604:	ff 24 85 a8 0c 00 00 	jmp    *0xca8(,%eax,4)
+ 60b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 60f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 610:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 613:	5b                   	pop    %ebx
+ 614:	5e                   	pop    %esi
+ 615:	5f                   	pop    %edi
+ 616:	5d                   	pop    %ebp
+ 617:	c3                   	ret
+ 618:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61f:	90                   	nop
+  write(fd, &c, 1);
+ 620:	83 ec 04             	sub    $0x4,%esp
+ 623:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 626:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 62a:	6a 01                	push   $0x1
+ 62c:	52                   	push   %edx
+ 62d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 630:	57                   	push   %edi
+ 631:	e8 fd fd ff ff       	call   433 <write>
+ 636:	83 c4 0c             	add    $0xc,%esp
+ 639:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 63c:	6a 01                	push   $0x1
+ 63e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 641:	52                   	push   %edx
+ 642:	57                   	push   %edi
+ 643:	e8 eb fd ff ff       	call   433 <write>
+        putc(fd, c);
+ 648:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 64b:	31 d2                	xor    %edx,%edx
+ 64d:	eb 8e                	jmp    5dd <printf+0x4d>
+ 64f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 650:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 653:	83 ec 0c             	sub    $0xc,%esp
+ 656:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 65b:	8b 13                	mov    (%ebx),%edx
+ 65d:	6a 00                	push   $0x0
+ 65f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 661:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 664:	e8 87 fe ff ff       	call   4f0 <printint>
+        ap++;
+ 669:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 66c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 66f:	31 d2                	xor    %edx,%edx
+ 671:	e9 67 ff ff ff       	jmp    5dd <printf+0x4d>
+ 676:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 67d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 680:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 683:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 685:	83 c0 04             	add    $0x4,%eax
+ 688:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 68b:	85 db                	test   %ebx,%ebx
+ 68d:	0f 84 9d 00 00 00    	je     730 <printf+0x1a0>
+        while(*s != 0){
+ 693:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 696:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 698:	84 c0                	test   %al,%al
+ 69a:	0f 84 3d ff ff ff    	je     5dd <printf+0x4d>
+ 6a0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6a3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 6a6:	89 de                	mov    %ebx,%esi
+ 6a8:	89 d3                	mov    %edx,%ebx
+ 6aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6b0:	83 ec 04             	sub    $0x4,%esp
+ 6b3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6b6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6b9:	6a 01                	push   $0x1
+ 6bb:	53                   	push   %ebx
+ 6bc:	57                   	push   %edi
+ 6bd:	e8 71 fd ff ff       	call   433 <write>
+        while(*s != 0){
+ 6c2:	0f b6 06             	movzbl (%esi),%eax
+ 6c5:	83 c4 10             	add    $0x10,%esp
+ 6c8:	84 c0                	test   %al,%al
+ 6ca:	75 e4                	jne    6b0 <printf+0x120>
+      state = 0;
+ 6cc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 6cf:	31 d2                	xor    %edx,%edx
+ 6d1:	e9 07 ff ff ff       	jmp    5dd <printf+0x4d>
+ 6d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 6e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6e3:	83 ec 0c             	sub    $0xc,%esp
+ 6e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6eb:	8b 13                	mov    (%ebx),%edx
+ 6ed:	6a 01                	push   $0x1
+ 6ef:	e9 6b ff ff ff       	jmp    65f <printf+0xcf>
+ 6f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 6f8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 6fb:	83 ec 04             	sub    $0x4,%esp
+ 6fe:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 701:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 703:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 706:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 709:	6a 01                	push   $0x1
+ 70b:	52                   	push   %edx
+ 70c:	57                   	push   %edi
+ 70d:	e8 21 fd ff ff       	call   433 <write>
+        ap++;
+ 712:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 715:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 718:	31 d2                	xor    %edx,%edx
+ 71a:	e9 be fe ff ff       	jmp    5dd <printf+0x4d>
+ 71f:	90                   	nop
+  write(fd, &c, 1);
+ 720:	83 ec 04             	sub    $0x4,%esp
+ 723:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 726:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 729:	6a 01                	push   $0x1
+ 72b:	e9 11 ff ff ff       	jmp    641 <printf+0xb1>
+ 730:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 735:	bb a0 0c 00 00       	mov    $0xca0,%ebx
+ 73a:	e9 61 ff ff ff       	jmp    6a0 <printf+0x110>
+ 73f:	90                   	nop
+
+00000740 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 740:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 741:	a1 80 20 00 00       	mov    0x2080,%eax
+{
+ 746:	89 e5                	mov    %esp,%ebp
+ 748:	57                   	push   %edi
+ 749:	56                   	push   %esi
+ 74a:	53                   	push   %ebx
+ 74b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 74e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 751:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 758:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 75a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 75c:	39 ca                	cmp    %ecx,%edx
+ 75e:	73 30                	jae    790 <free+0x50>
+ 760:	39 c1                	cmp    %eax,%ecx
+ 762:	72 04                	jb     768 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 764:	39 c2                	cmp    %eax,%edx
+ 766:	72 f0                	jb     758 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 768:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 76b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 76e:	39 f8                	cmp    %edi,%eax
+ 770:	74 2e                	je     7a0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 772:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 775:	8b 42 04             	mov    0x4(%edx),%eax
+ 778:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 77b:	39 f1                	cmp    %esi,%ecx
+ 77d:	74 38                	je     7b7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 77f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 781:	5b                   	pop    %ebx
+  freep = p;
+ 782:	89 15 80 20 00 00    	mov    %edx,0x2080
+}
+ 788:	5e                   	pop    %esi
+ 789:	5f                   	pop    %edi
+ 78a:	5d                   	pop    %ebp
+ 78b:	c3                   	ret
+ 78c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 790:	39 c1                	cmp    %eax,%ecx
+ 792:	72 d0                	jb     764 <free+0x24>
+ 794:	eb c2                	jmp    758 <free+0x18>
+ 796:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 7a0:	03 70 04             	add    0x4(%eax),%esi
+ 7a3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 7a6:	8b 02                	mov    (%edx),%eax
+ 7a8:	8b 00                	mov    (%eax),%eax
+ 7aa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 7ad:	8b 42 04             	mov    0x4(%edx),%eax
+ 7b0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7b3:	39 f1                	cmp    %esi,%ecx
+ 7b5:	75 c8                	jne    77f <free+0x3f>
+    p->s.size += bp->s.size;
+ 7b7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 7ba:	89 15 80 20 00 00    	mov    %edx,0x2080
+    p->s.size += bp->s.size;
+ 7c0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 7c3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 7c6:	89 0a                	mov    %ecx,(%edx)
+}
+ 7c8:	5b                   	pop    %ebx
+ 7c9:	5e                   	pop    %esi
+ 7ca:	5f                   	pop    %edi
+ 7cb:	5d                   	pop    %ebp
+ 7cc:	c3                   	ret
+ 7cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007d0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	57                   	push   %edi
+ 7d4:	56                   	push   %esi
+ 7d5:	53                   	push   %ebx
+ 7d6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 7dc:	8b 15 80 20 00 00    	mov    0x2080,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7e2:	8d 78 07             	lea    0x7(%eax),%edi
+ 7e5:	c1 ef 03             	shr    $0x3,%edi
+ 7e8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 7eb:	85 d2                	test   %edx,%edx
+ 7ed:	0f 84 8d 00 00 00    	je     880 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7f3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7f5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7f8:	39 f9                	cmp    %edi,%ecx
+ 7fa:	73 64                	jae    860 <malloc+0x90>
+  if(nu < 4096)
+ 7fc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 801:	39 df                	cmp    %ebx,%edi
+ 803:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 806:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 80d:	eb 0a                	jmp    819 <malloc+0x49>
+ 80f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 810:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 812:	8b 48 04             	mov    0x4(%eax),%ecx
+ 815:	39 f9                	cmp    %edi,%ecx
+ 817:	73 47                	jae    860 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 819:	89 c2                	mov    %eax,%edx
+ 81b:	39 05 80 20 00 00    	cmp    %eax,0x2080
+ 821:	75 ed                	jne    810 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 823:	83 ec 0c             	sub    $0xc,%esp
+ 826:	56                   	push   %esi
+ 827:	e8 6f fc ff ff       	call   49b <sbrk>
+  if(p == (char*)-1)
+ 82c:	83 c4 10             	add    $0x10,%esp
+ 82f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 832:	74 1c                	je     850 <malloc+0x80>
+  hp->s.size = nu;
+ 834:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 837:	83 ec 0c             	sub    $0xc,%esp
+ 83a:	83 c0 08             	add    $0x8,%eax
+ 83d:	50                   	push   %eax
+ 83e:	e8 fd fe ff ff       	call   740 <free>
+  return freep;
+ 843:	8b 15 80 20 00 00    	mov    0x2080,%edx
+      if((p = morecore(nunits)) == 0)
+ 849:	83 c4 10             	add    $0x10,%esp
+ 84c:	85 d2                	test   %edx,%edx
+ 84e:	75 c0                	jne    810 <malloc+0x40>
+        return 0;
+  }
+}
+ 850:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 853:	31 c0                	xor    %eax,%eax
+}
+ 855:	5b                   	pop    %ebx
+ 856:	5e                   	pop    %esi
+ 857:	5f                   	pop    %edi
+ 858:	5d                   	pop    %ebp
+ 859:	c3                   	ret
+ 85a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 860:	39 cf                	cmp    %ecx,%edi
+ 862:	74 4c                	je     8b0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 864:	29 f9                	sub    %edi,%ecx
+ 866:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 869:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 86c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 86f:	89 15 80 20 00 00    	mov    %edx,0x2080
+}
+ 875:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 878:	83 c0 08             	add    $0x8,%eax
+}
+ 87b:	5b                   	pop    %ebx
+ 87c:	5e                   	pop    %esi
+ 87d:	5f                   	pop    %edi
+ 87e:	5d                   	pop    %ebp
+ 87f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 880:	c7 05 80 20 00 00 84 	movl   $0x2084,0x2080
+ 887:	20 00 00 
+    base.s.size = 0;
+ 88a:	b8 84 20 00 00       	mov    $0x2084,%eax
+    base.s.ptr = freep = prevp = &base;
+ 88f:	c7 05 84 20 00 00 84 	movl   $0x2084,0x2084
+ 896:	20 00 00 
+    base.s.size = 0;
+ 899:	c7 05 88 20 00 00 00 	movl   $0x0,0x2088
+ 8a0:	00 00 00 
+    if(p->s.size >= nunits){
+ 8a3:	e9 54 ff ff ff       	jmp    7fc <malloc+0x2c>
+ 8a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8af:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 8b0:	8b 08                	mov    (%eax),%ecx
+ 8b2:	89 0a                	mov    %ecx,(%edx)
+ 8b4:	eb b9                	jmp    86f <malloc+0x9f>
+ 8b6:	66 90                	xchg   %ax,%ax
+ 8b8:	66 90                	xchg   %ax,%ax
+ 8ba:	66 90                	xchg   %ax,%ax
+ 8bc:	66 90                	xchg   %ax,%ax
+ 8be:	66 90                	xchg   %ax,%ax
+
+000008c0 <pidstat>:
+
+// Fill in *st with the statistics of process pid.
+// Returns 0, or -1 if there is no such process.
+int
+pidstat(int pid, struct pstat *st)
+{
+ 8c0:	55                   	push   %ebp
+ 8c1:	89 e5                	mov    %esp,%ebp
+ 8c3:	56                   	push   %esi
+ 8c4:	53                   	push   %ebx
+  static struct pstat *ps;
+  int i, n;
+
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ 8c5:	a1 8c 20 00 00       	mov    0x208c,%eax
+{
+ 8ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 8cd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ 8d0:	85 c0                	test   %eax,%eax
+ 8d2:	0f 84 98 00 00 00    	je     970 <pidstat+0xb0>
+    return -1;
+  n = getpstat(ps, NPROC);
+ 8d8:	83 ec 08             	sub    $0x8,%esp
+ 8db:	6a 40                	push   $0x40
+ 8dd:	50                   	push   %eax
+ 8de:	e8 e0 fb ff ff       	call   4c3 <getpstat>
+  for(i = 0; i < n; i++){
+ 8e3:	83 c4 10             	add    $0x10,%esp
+ 8e6:	85 c0                	test   %eax,%eax
+ 8e8:	0f 8e 9f 00 00 00    	jle    98d <pidstat+0xcd>
+ 8ee:	8b 15 8c 20 00 00    	mov    0x208c,%edx
+ 8f4:	31 c9                	xor    %ecx,%ecx
+ 8f6:	eb 16                	jmp    90e <pidstat+0x4e>
+ 8f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ff:	90                   	nop
+ 900:	83 c1 01             	add    $0x1,%ecx
+ 903:	83 c2 38             	add    $0x38,%edx
+ 906:	39 c8                	cmp    %ecx,%eax
+ 908:	0f 84 7f 00 00 00    	je     98d <pidstat+0xcd>
+    if(ps[i].pid == pid){
+ 90e:	39 1a                	cmp    %ebx,(%edx)
+ 910:	75 ee                	jne    900 <pidstat+0x40>
+      *st = ps[i];
+ 912:	89 1e                	mov    %ebx,(%esi)
+ 914:	8b 42 04             	mov    0x4(%edx),%eax
+ 917:	89 46 04             	mov    %eax,0x4(%esi)
+ 91a:	8b 42 08             	mov    0x8(%edx),%eax
+ 91d:	89 46 08             	mov    %eax,0x8(%esi)
+ 920:	8b 42 0c             	mov    0xc(%edx),%eax
+ 923:	89 46 0c             	mov    %eax,0xc(%esi)
+ 926:	8b 42 10             	mov    0x10(%edx),%eax
+ 929:	89 46 10             	mov    %eax,0x10(%esi)
+ 92c:	8b 42 14             	mov    0x14(%edx),%eax
+ 92f:	89 46 14             	mov    %eax,0x14(%esi)
+ 932:	8b 42 18             	mov    0x18(%edx),%eax
+ 935:	89 46 18             	mov    %eax,0x18(%esi)
+ 938:	8b 42 1c             	mov    0x1c(%edx),%eax
+ 93b:	89 46 1c             	mov    %eax,0x1c(%esi)
+ 93e:	8b 42 20             	mov    0x20(%edx),%eax
+ 941:	89 46 20             	mov    %eax,0x20(%esi)
+ 944:	8b 42 24             	mov    0x24(%edx),%eax
+ 947:	89 46 24             	mov    %eax,0x24(%esi)
+ 94a:	8b 42 28             	mov    0x28(%edx),%eax
+ 94d:	89 46 28             	mov    %eax,0x28(%esi)
+ 950:	8b 42 2c             	mov    0x2c(%edx),%eax
+ 953:	89 46 2c             	mov    %eax,0x2c(%esi)
+ 956:	8b 42 30             	mov    0x30(%edx),%eax
+ 959:	89 46 30             	mov    %eax,0x30(%esi)
+ 95c:	8b 42 34             	mov    0x34(%edx),%eax
+ 95f:	89 46 34             	mov    %eax,0x34(%esi)
+      return 0;
+    }
+  }
+  return -1;
+}
+ 962:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ 965:	31 c0                	xor    %eax,%eax
+}
+ 967:	5b                   	pop    %ebx
+ 968:	5e                   	pop    %esi
+ 969:	5d                   	pop    %ebp
+ 96a:	c3                   	ret
+ 96b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 96f:	90                   	nop
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ 970:	83 ec 0c             	sub    $0xc,%esp
+ 973:	68 00 0e 00 00       	push   $0xe00
+ 978:	e8 53 fe ff ff       	call   7d0 <malloc>
+ 97d:	83 c4 10             	add    $0x10,%esp
+ 980:	a3 8c 20 00 00       	mov    %eax,0x208c
+ 985:	85 c0                	test   %eax,%eax
+ 987:	0f 85 4b ff ff ff    	jne    8d8 <pidstat+0x18>
+}
+ 98d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return -1;
+ 990:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 995:	5b                   	pop    %ebx
+ 996:	5e                   	pop    %esi
+ 997:	5d                   	pop    %ebp
+ 998:	c3                   	ret
+ 999:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000009a0 <sharetable>:
+// key[i] is printed in a column headed keyname, and so is
+// extra[i] under extraname unless extra is 0.
+void
+sharetable(char *tag, char *keyname, int *key, char *extraname, int *extra,
+           int n, int *pid, int *weight, uint *ticks)
+{
+ 9a0:	55                   	push   %ebp
+ 9a1:	89 e5                	mov    %esp,%ebp
+ 9a3:	57                   	push   %edi
+ 9a4:	56                   	push   %esi
+ 9a5:	53                   	push   %ebx
+ 9a6:	83 ec 3c             	sub    $0x3c,%esp
+ 9a9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9ac:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+ 9af:	8b 75 24             	mov    0x24(%ebp),%esi
+ 9b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 9b5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 9b8:	8b 45 10             	mov    0x10(%ebp),%eax
+ 9bb:	89 7d d0             	mov    %edi,-0x30(%ebp)
+ 9be:	8b 5d 14             	mov    0x14(%ebp),%ebx
+ 9c1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+ 9c4:	8b 45 18             	mov    0x18(%ebp),%eax
+ 9c7:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ 9ca:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 9cd:	8b 45 20             	mov    0x20(%ebp),%eax
+ 9d0:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 9d3:	8b 45 28             	mov    0x28(%ebp),%eax
+ 9d6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  int i, wsum, share, expect, err, maxerr;
+  uint tsum;
+
+  wsum = 0;
+  tsum = 0;
+  for(i = 0; i < n; i++){
+ 9d9:	85 ff                	test   %edi,%edi
+ 9db:	0f 8e df 01 00 00    	jle    bc0 <sharetable+0x220>
+ 9e1:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+ 9e4:	89 fb                	mov    %edi,%ebx
+ 9e6:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  tsum = 0;
+ 9e9:	31 d2                	xor    %edx,%edx
+  for(i = 0; i < n; i++){
+ 9eb:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 9ee:	31 c0                	xor    %eax,%eax
+ 9f0:	31 c9                	xor    %ecx,%ecx
+ 9f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wsum += weight[i];
+ 9f8:	03 0c 86             	add    (%esi,%eax,4),%ecx
+    tsum += ticks[i];
+ 9fb:	03 14 87             	add    (%edi,%eax,4),%edx
+  for(i = 0; i < n; i++){
+ 9fe:	83 c0 01             	add    $0x1,%eax
+ a01:	39 c3                	cmp    %eax,%ebx
+ a03:	75 f3                	jne    9f8 <sharetable+0x58>
+ a05:	85 d2                	test   %edx,%edx
+ a07:	b8 01 00 00 00       	mov    $0x1,%eax
+ a0c:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  }
+  if(tsum == 0)
+    tsum = 1;
+  if(wsum == 0)
+    wsum = 1;
+ a0f:	8b 7d d8             	mov    -0x28(%ebp),%edi
+ a12:	0f 45 c2             	cmovne %edx,%eax
+ a15:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+  if(tsum == 0)
+ a18:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    wsum = 1;
+ a1b:	85 ff                	test   %edi,%edi
+ a1d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ a20:	b8 01 00 00 00       	mov    $0x1,%eax
+ a25:	0f 45 c7             	cmovne %edi,%eax
+ a28:	89 45 d8             	mov    %eax,-0x28(%ebp)
+
+  printf(1, "[%s]  pid %s ", tag, keyname);
+ a2b:	51                   	push   %ecx
+ a2c:	ff 75 dc             	push   -0x24(%ebp)
+ a2f:	68 11 0d 00 00       	push   $0xd11
+ a34:	6a 01                	push   $0x1
+ a36:	e8 55 fb ff ff       	call   590 <printf>
+  if(extra)
+ a3b:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a3e:	83 c4 10             	add    $0x10,%esp
+ a41:	85 f6                	test   %esi,%esi
+ a43:	0f 84 47 01 00 00    	je     b90 <sharetable+0x1f0>
+    printf(1, "%s ", extraname);
+ a49:	83 ec 04             	sub    $0x4,%esp
+ a4c:	53                   	push   %ebx
+ a4d:	68 1b 0d 00 00       	push   $0xd1b
+ a52:	6a 01                	push   $0x1
+ a54:	e8 37 fb ff ff       	call   590 <printf>
+  printf(1, "ticks  share expected\n");
+ a59:	58                   	pop    %eax
+ a5a:	5a                   	pop    %edx
+ a5b:	68 1f 0d 00 00       	push   $0xd1f
+ a60:	6a 01                	push   $0x1
+ a62:	e8 29 fb ff ff       	call   590 <printf>
+  maxerr = 0;
+  for(i = 0; i < n; i++){
+ a67:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+ a6a:	83 c4 10             	add    $0x10,%esp
+ a6d:	85 c9                	test   %ecx,%ecx
+ a6f:	0f 8e 44 01 00 00    	jle    bb9 <sharetable+0x219>
+  if(extra)
+ a75:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+ a7c:	31 ff                	xor    %edi,%edi
+ a7e:	66 90                	xchg   %ax,%ax
+    share = ticks[i] * 1000 / tsum;
+ a80:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ a83:	31 d2                	xor    %edx,%edx
+    expect = weight[i] * 1000 / wsum;
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+ a85:	83 ec 0c             	sub    $0xc,%esp
+    share = ticks[i] * 1000 / tsum;
+ a88:	69 04 b8 e8 03 00 00 	imul   $0x3e8,(%eax,%edi,4),%eax
+ a8f:	f7 75 c0             	divl   -0x40(%ebp)
+ a92:	89 c6                	mov    %eax,%esi
+    expect = weight[i] * 1000 / wsum;
+ a94:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a97:	69 04 b8 e8 03 00 00 	imul   $0x3e8,(%eax,%edi,4),%eax
+ a9e:	99                   	cltd
+ a9f:	f7 7d d8             	idivl  -0x28(%ebp)
+ aa2:	89 c3                	mov    %eax,%ebx
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+ aa4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ aa7:	ff 34 b8             	push   (%eax,%edi,4)
+ aaa:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ aad:	ff 34 b8             	push   (%eax,%edi,4)
+ ab0:	ff 75 dc             	push   -0x24(%ebp)
+ ab3:	68 36 0d 00 00       	push   $0xd36
+ ab8:	6a 01                	push   $0x1
+ aba:	e8 d1 fa ff ff       	call   590 <printf>
+    if(extra)
+ abf:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ ac2:	83 c4 20             	add    $0x20,%esp
+ ac5:	85 c0                	test   %eax,%eax
+ ac7:	74 15                	je     ade <sharetable+0x13e>
+      printf(1, "%d ", extra[i]);
+ ac9:	83 ec 04             	sub    $0x4,%esp
+ acc:	ff 34 b8             	push   (%eax,%edi,4)
+ acf:	68 3e 0d 00 00       	push   $0xd3e
+ ad4:	6a 01                	push   $0x1
+ ad6:	e8 b5 fa ff ff       	call   590 <printf>
+ adb:	83 c4 10             	add    $0x10,%esp
+    printf(1, "%d %d.%d%% %d.%d%%\n", ticks[i], share / 10, share % 10,
+ ade:	b8 67 66 66 66       	mov    $0x66666667,%eax
+ ae3:	89 d9                	mov    %ebx,%ecx
+ ae5:	83 ec 04             	sub    $0x4,%esp
+ ae8:	f7 eb                	imul   %ebx
+ aea:	89 d8                	mov    %ebx,%eax
+ aec:	c1 f8 1f             	sar    $0x1f,%eax
+ aef:	c1 fa 02             	sar    $0x2,%edx
+ af2:	29 c2                	sub    %eax,%edx
+ af4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ af7:	01 c0                	add    %eax,%eax
+ af9:	29 c1                	sub    %eax,%ecx
+ afb:	b8 67 66 66 66       	mov    $0x66666667,%eax
+ b00:	51                   	push   %ecx
+ b01:	89 f1                	mov    %esi,%ecx
+ b03:	52                   	push   %edx
+ b04:	f7 ee                	imul   %esi
+ b06:	89 f0                	mov    %esi,%eax
+ b08:	c1 f8 1f             	sar    $0x1f,%eax
+ b0b:	c1 fa 02             	sar    $0x2,%edx
+ b0e:	29 c2                	sub    %eax,%edx
+ b10:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ b13:	01 c0                	add    %eax,%eax
+ b15:	29 c1                	sub    %eax,%ecx
+ b17:	51                   	push   %ecx
+ b18:	52                   	push   %edx
+ b19:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ b1c:	ff 34 b8             	push   (%eax,%edi,4)
+ b1f:	68 42 0d 00 00       	push   $0xd42
+ b24:	6a 01                	push   $0x1
+ b26:	e8 65 fa ff ff       	call   590 <printf>
+           expect / 10, expect % 10);
+    err = share > expect ? share - expect : expect - share;
+ b2b:	89 f2                	mov    %esi,%edx
+ b2d:	89 d8                	mov    %ebx,%eax
+ b2f:	83 c4 20             	add    $0x20,%esp
+ b32:	29 f0                	sub    %esi,%eax
+ b34:	29 da                	sub    %ebx,%edx
+ b36:	39 de                	cmp    %ebx,%esi
+ b38:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ b3b:	0f 4f c2             	cmovg  %edx,%eax
+    if(err > maxerr)
+ b3e:	39 c6                	cmp    %eax,%esi
+ b40:	0f 4d c6             	cmovge %esi,%eax
+  for(i = 0; i < n; i++){
+ b43:	83 c7 01             	add    $0x1,%edi
+ b46:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ b49:	39 7d d0             	cmp    %edi,-0x30(%ebp)
+ b4c:	0f 85 2e ff ff ff    	jne    a80 <sharetable+0xe0>
+      maxerr = err;
+  }
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+ b52:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+ b57:	f7 e2                	mul    %edx
+ b59:	c1 ea 03             	shr    $0x3,%edx
+ b5c:	8d 0c 92             	lea    (%edx,%edx,4),%ecx
+ b5f:	89 d0                	mov    %edx,%eax
+ b61:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ b64:	01 c9                	add    %ecx,%ecx
+ b66:	29 ca                	sub    %ecx,%edx
+ b68:	89 45 14             	mov    %eax,0x14(%ebp)
+ b6b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ b6e:	89 55 18             	mov    %edx,0x18(%ebp)
+ b71:	89 45 10             	mov    %eax,0x10(%ebp)
+ b74:	c7 45 0c 58 0d 00 00 	movl   $0xd58,0xc(%ebp)
+ b7b:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+ b82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b85:	5b                   	pop    %ebx
+ b86:	5e                   	pop    %esi
+ b87:	5f                   	pop    %edi
+ b88:	5d                   	pop    %ebp
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+ b89:	e9 02 fa ff ff       	jmp    590 <printf>
+ b8e:	66 90                	xchg   %ax,%ax
+  printf(1, "ticks  share expected\n");
+ b90:	83 ec 08             	sub    $0x8,%esp
+ b93:	68 1f 0d 00 00       	push   $0xd1f
+ b98:	6a 01                	push   $0x1
+ b9a:	e8 f1 f9 ff ff       	call   590 <printf>
+ b9f:	83 c4 10             	add    $0x10,%esp
+ ba2:	e9 ce fe ff ff       	jmp    a75 <sharetable+0xd5>
+ ba7:	83 ec 08             	sub    $0x8,%esp
+ baa:	68 1f 0d 00 00       	push   $0xd1f
+ baf:	6a 01                	push   $0x1
+ bb1:	e8 da f9 ff ff       	call   590 <printf>
+ bb6:	83 c4 10             	add    $0x10,%esp
+  if(extra)
+ bb9:	31 c0                	xor    %eax,%eax
+ bbb:	31 d2                	xor    %edx,%edx
+ bbd:	eb a9                	jmp    b68 <sharetable+0x1c8>
+ bbf:	90                   	nop
+  printf(1, "[%s]  pid %s ", tag, keyname);
+ bc0:	51                   	push   %ecx
+ bc1:	ff 75 dc             	push   -0x24(%ebp)
+ bc4:	68 11 0d 00 00       	push   $0xd11
+ bc9:	6a 01                	push   $0x1
+ bcb:	e8 c0 f9 ff ff       	call   590 <printf>
+  if(extra)
+ bd0:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ bd3:	83 c4 10             	add    $0x10,%esp
+ bd6:	85 ff                	test   %edi,%edi
+ bd8:	74 cd                	je     ba7 <sharetable+0x207>
+    wsum = 1;
+ bda:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  if(extra)
+ be1:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+ be8:	e9 5c fe ff ff       	jmp    a49 <sharetable+0xa9>
@@ -0,0 +1,73 @@
+// pipebench.c — pipe throughput benchmark
+// For each pipe buffer size, a child writes a fixed amount of
+// data into a pipe in small chunks and the parent reads it,
+// timing the transfer. Chunks are smaller than a page, so the
+// data goes through the pipe's buffer rather than being lent.
+// Expect: ticks to drop as the buffer grows, since reader and
+// writer switch less often.
+//
+// usage: pipebench [kb] [chunk]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+static char buf[4096];
+
+static int sizes[] = { 0, 16*1024, 64*1024 };
+
+static void
+run(int size, int kb, int chunk)
+{
+  int fds[2], pid, n, total, start, cap;
+
+  if (pipe(fds) < 0) {
+    printf(2, "pipebench: pipe failed\n");
+    exit();
+  }
+  cap = pipesize(fds[0], size);   // 0: keep the default
+  if (cap < 0) {
+    printf(2, "pipebench: pipesize %d failed\n", size);
+    exit();
+  }
+
+  start = uptime();
+  pid = fork();
+  if (pid < 0) {
+    printf(2, "pipebench: fork failed\n");
+    exit();
+  }
+  if (pid == 0) {
+    close(fds[0]);
+    for (total = 0; total < kb * 1024; total += chunk)
+      if (write(fds[1], buf, chunk) != chunk)
+        break;
+    exit();
+  }
+  close(fds[1]);
+  total = 0;
+  while ((n = read(fds[0], buf, sizeof(buf))) > 0)
+    total += n;
+  close(fds[0]);
+  wait();
+
+  printf(1, "[PIPEBENCH] buffer=%d read=%d KB ticks=%d\n",
+         cap, total / 1024, uptime() - start);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int kb = 4096, chunk = 512;
+  int i;
+
+  if (argc > 1) kb = atoi(argv[1]);
+  if (argc > 2) chunk = atoi(argv[2]);
+  if (chunk <= 0 || chunk > sizeof(buf) / 2)
+    chunk = 512;
+
+  printf(1, "\n[PIPEBENCH] %d KB in %d-byte writes\n", kb, chunk);
+  for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    run(sizes[i], kb, chunk);
+  exit();
+}
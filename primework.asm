@@ -0,0 +1,1605 @@
+
+_primework:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  if(x < 2) return 0;
+  for(int j=2; j*j<=x; j++) if(x%j==0) return 0;
+  return 1;
+}
+
+int main(int argc, char**argv){
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+  int limit = 200000; // enough CPU spin
+  int pid = getpid();
+  int count = 0;
+   f:	31 f6                	xor    %esi,%esi
+int main(int argc, char**argv){
+  11:	53                   	push   %ebx
+  for(int i=1; i<limit; i++){
+  12:	bb 02 00 00 00       	mov    $0x2,%ebx
+int main(int argc, char**argv){
+  17:	51                   	push   %ecx
+  18:	83 ec 08             	sub    $0x8,%esp
+  int pid = getpid();
+  1b:	e8 83 03 00 00       	call   3a3 <getpid>
+  20:	89 c7                	mov    %eax,%edi
+  for(int i=1; i<limit; i++){
+  22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(int j=2; j*j<=x; j++) if(x%j==0) return 0;
+  28:	83 fb 03             	cmp    $0x3,%ebx
+  2b:	7e 49                	jle    76 <main+0x76>
+  2d:	f6 c3 01             	test   $0x1,%bl
+  30:	74 26                	je     58 <main+0x58>
+  32:	b9 02 00 00 00       	mov    $0x2,%ecx
+  37:	eb 10                	jmp    49 <main+0x49>
+  39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  40:	89 d8                	mov    %ebx,%eax
+  42:	99                   	cltd
+  43:	f7 f9                	idiv   %ecx
+  45:	85 d2                	test   %edx,%edx
+  47:	74 0f                	je     58 <main+0x58>
+  49:	83 c1 01             	add    $0x1,%ecx
+  4c:	89 c8                	mov    %ecx,%eax
+  4e:	0f af c1             	imul   %ecx,%eax
+  51:	39 d8                	cmp    %ebx,%eax
+  53:	7e eb                	jle    40 <main+0x40>
+    if(isprime(i)) count++;
+  55:	83 c6 01             	add    $0x1,%esi
+  for(int i=1; i<limit; i++){
+  58:	83 c3 01             	add    $0x1,%ebx
+  5b:	81 fb 40 0d 03 00    	cmp    $0x30d40,%ebx
+  61:	75 c5                	jne    28 <main+0x28>
+  }
+  printf(1, "primework pid=%d primes=%d\n", pid, count);
+  63:	56                   	push   %esi
+  64:	57                   	push   %edi
+  65:	68 00 0b 00 00       	push   $0xb00
+  6a:	6a 01                	push   $0x1
+  6c:	e8 2f 04 00 00       	call   4a0 <printf>
+  exit();
+  71:	e8 ad 02 00 00       	call   323 <exit>
+    if(isprime(i)) count++;
+  76:	83 c6 01             	add    $0x1,%esi
+  for(int i=1; i<limit; i++){
+  79:	83 c3 01             	add    $0x1,%ebx
+  7c:	eb aa                	jmp    28 <main+0x28>
+  7e:	66 90                	xchg   %ax,%ax
+
+00000080 <isprime>:
+int isprime(int x){
+  80:	55                   	push   %ebp
+  81:	89 e5                	mov    %esp,%ebp
+  83:	56                   	push   %esi
+  if(x < 2) return 0;
+  84:	31 f6                	xor    %esi,%esi
+int isprime(int x){
+  86:	53                   	push   %ebx
+  87:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(x < 2) return 0;
+  8a:	83 fb 01             	cmp    $0x1,%ebx
+  8d:	7e 2e                	jle    bd <isprime+0x3d>
+  for(int j=2; j*j<=x; j++) if(x%j==0) return 0;
+  8f:	83 fb 03             	cmp    $0x3,%ebx
+  92:	7e 3c                	jle    d0 <isprime+0x50>
+  94:	89 de                	mov    %ebx,%esi
+  96:	83 e6 01             	and    $0x1,%esi
+  99:	74 22                	je     bd <isprime+0x3d>
+  9b:	b9 02 00 00 00       	mov    $0x2,%ecx
+  a0:	eb 0f                	jmp    b1 <isprime+0x31>
+  a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  a8:	89 d8                	mov    %ebx,%eax
+  aa:	99                   	cltd
+  ab:	f7 f9                	idiv   %ecx
+  ad:	85 d2                	test   %edx,%edx
+  af:	74 17                	je     c8 <isprime+0x48>
+  b1:	83 c1 01             	add    $0x1,%ecx
+  b4:	89 c8                	mov    %ecx,%eax
+  b6:	0f af c1             	imul   %ecx,%eax
+  b9:	39 c3                	cmp    %eax,%ebx
+  bb:	7d eb                	jge    a8 <isprime+0x28>
+}
+  bd:	89 f0                	mov    %esi,%eax
+  bf:	5b                   	pop    %ebx
+  c0:	5e                   	pop    %esi
+  c1:	5d                   	pop    %ebp
+  c2:	c3                   	ret
+  c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  c7:	90                   	nop
+  if(x < 2) return 0;
+  c8:	31 f6                	xor    %esi,%esi
+}
+  ca:	5b                   	pop    %ebx
+  cb:	89 f0                	mov    %esi,%eax
+  cd:	5e                   	pop    %esi
+  ce:	5d                   	pop    %ebp
+  cf:	c3                   	ret
+  return 1;
+  d0:	be 01 00 00 00       	mov    $0x1,%esi
+  d5:	eb e6                	jmp    bd <isprime+0x3d>
+  d7:	66 90                	xchg   %ax,%ax
+  d9:	66 90                	xchg   %ax,%ax
+  db:	66 90                	xchg   %ax,%ax
+  dd:	66 90                	xchg   %ax,%ax
+  df:	90                   	nop
+
+000000e0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  e0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  e1:	31 c0                	xor    %eax,%eax
+{
+  e3:	89 e5                	mov    %esp,%ebp
+  e5:	53                   	push   %ebx
+  e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  e9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  f0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  f4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  f7:	83 c0 01             	add    $0x1,%eax
+  fa:	84 d2                	test   %dl,%dl
+  fc:	75 f2                	jne    f0 <strcpy+0x10>
+    ;
+  return os;
+}
+  fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 101:	89 c8                	mov    %ecx,%eax
+ 103:	c9                   	leave
+ 104:	c3                   	ret
+ 105:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000110 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	53                   	push   %ebx
+ 114:	8b 55 08             	mov    0x8(%ebp),%edx
+ 117:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 11a:	0f b6 02             	movzbl (%edx),%eax
+ 11d:	84 c0                	test   %al,%al
+ 11f:	75 17                	jne    138 <strcmp+0x28>
+ 121:	eb 3a                	jmp    15d <strcmp+0x4d>
+ 123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 127:	90                   	nop
+ 128:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 12c:	83 c2 01             	add    $0x1,%edx
+ 12f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 132:	84 c0                	test   %al,%al
+ 134:	74 1a                	je     150 <strcmp+0x40>
+    p++, q++;
+ 136:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 138:	0f b6 19             	movzbl (%ecx),%ebx
+ 13b:	38 c3                	cmp    %al,%bl
+ 13d:	74 e9                	je     128 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 13f:	29 d8                	sub    %ebx,%eax
+}
+ 141:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 144:	c9                   	leave
+ 145:	c3                   	ret
+ 146:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 150:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 154:	31 c0                	xor    %eax,%eax
+ 156:	29 d8                	sub    %ebx,%eax
+}
+ 158:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 15b:	c9                   	leave
+ 15c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 15d:	0f b6 19             	movzbl (%ecx),%ebx
+ 160:	31 c0                	xor    %eax,%eax
+ 162:	eb db                	jmp    13f <strcmp+0x2f>
+ 164:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 16f:	90                   	nop
+
+00000170 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 170:	55                   	push   %ebp
+ 171:	89 e5                	mov    %esp,%ebp
+ 173:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 176:	80 3a 00             	cmpb   $0x0,(%edx)
+ 179:	74 15                	je     190 <strlen+0x20>
+ 17b:	31 c0                	xor    %eax,%eax
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+ 180:	83 c0 01             	add    $0x1,%eax
+ 183:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 187:	89 c1                	mov    %eax,%ecx
+ 189:	75 f5                	jne    180 <strlen+0x10>
+    ;
+  return n;
+}
+ 18b:	89 c8                	mov    %ecx,%eax
+ 18d:	5d                   	pop    %ebp
+ 18e:	c3                   	ret
+ 18f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 190:	31 c9                	xor    %ecx,%ecx
+}
+ 192:	5d                   	pop    %ebp
+ 193:	89 c8                	mov    %ecx,%eax
+ 195:	c3                   	ret
+ 196:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001a0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1a7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ad:	89 d7                	mov    %edx,%edi
+ 1af:	fc                   	cld
+ 1b0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1b2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1b5:	89 d0                	mov    %edx,%eax
+ 1b7:	c9                   	leave
+ 1b8:	c3                   	ret
+ 1b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001c0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1ca:	0f b6 10             	movzbl (%eax),%edx
+ 1cd:	84 d2                	test   %dl,%dl
+ 1cf:	75 12                	jne    1e3 <strchr+0x23>
+ 1d1:	eb 1d                	jmp    1f0 <strchr+0x30>
+ 1d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1d7:	90                   	nop
+ 1d8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1dc:	83 c0 01             	add    $0x1,%eax
+ 1df:	84 d2                	test   %dl,%dl
+ 1e1:	74 0d                	je     1f0 <strchr+0x30>
+    if(*s == c)
+ 1e3:	38 d1                	cmp    %dl,%cl
+ 1e5:	75 f1                	jne    1d8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1e7:	5d                   	pop    %ebp
+ 1e8:	c3                   	ret
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 1f0:	31 c0                	xor    %eax,%eax
+}
+ 1f2:	5d                   	pop    %ebp
+ 1f3:	c3                   	ret
+ 1f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1ff:	90                   	nop
+
+00000200 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	57                   	push   %edi
+ 204:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 205:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 208:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 209:	31 db                	xor    %ebx,%ebx
+{
+ 20b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 20e:	eb 27                	jmp    237 <gets+0x37>
+    cc = read(0, &c, 1);
+ 210:	83 ec 04             	sub    $0x4,%esp
+ 213:	6a 01                	push   $0x1
+ 215:	56                   	push   %esi
+ 216:	6a 00                	push   $0x0
+ 218:	e8 1e 01 00 00       	call   33b <read>
+    if(cc < 1)
+ 21d:	83 c4 10             	add    $0x10,%esp
+ 220:	85 c0                	test   %eax,%eax
+ 222:	7e 1d                	jle    241 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 224:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 228:	8b 55 08             	mov    0x8(%ebp),%edx
+ 22b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 22f:	3c 0a                	cmp    $0xa,%al
+ 231:	74 10                	je     243 <gets+0x43>
+ 233:	3c 0d                	cmp    $0xd,%al
+ 235:	74 0c                	je     243 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 237:	89 df                	mov    %ebx,%edi
+ 239:	83 c3 01             	add    $0x1,%ebx
+ 23c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 23f:	7c cf                	jl     210 <gets+0x10>
+ 241:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 243:	8b 45 08             	mov    0x8(%ebp),%eax
+ 246:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 24a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 24d:	5b                   	pop    %ebx
+ 24e:	5e                   	pop    %esi
+ 24f:	5f                   	pop    %edi
+ 250:	5d                   	pop    %ebp
+ 251:	c3                   	ret
+ 252:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	56                   	push   %esi
+ 264:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 265:	83 ec 08             	sub    $0x8,%esp
+ 268:	6a 00                	push   $0x0
+ 26a:	ff 75 08             	push   0x8(%ebp)
+ 26d:	e8 f1 00 00 00       	call   363 <open>
+  if(fd < 0)
+ 272:	83 c4 10             	add    $0x10,%esp
+ 275:	85 c0                	test   %eax,%eax
+ 277:	78 27                	js     2a0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 279:	83 ec 08             	sub    $0x8,%esp
+ 27c:	ff 75 0c             	push   0xc(%ebp)
+ 27f:	89 c3                	mov    %eax,%ebx
+ 281:	50                   	push   %eax
+ 282:	e8 f4 00 00 00       	call   37b <fstat>
+  close(fd);
+ 287:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 28a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 28c:	e8 ba 00 00 00       	call   34b <close>
+  return r;
+ 291:	83 c4 10             	add    $0x10,%esp
+}
+ 294:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 297:	89 f0                	mov    %esi,%eax
+ 299:	5b                   	pop    %ebx
+ 29a:	5e                   	pop    %esi
+ 29b:	5d                   	pop    %ebp
+ 29c:	c3                   	ret
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2a0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2a5:	eb ed                	jmp    294 <stat+0x34>
+ 2a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ae:	66 90                	xchg   %ax,%ax
+
+000002b0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	53                   	push   %ebx
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2b7:	0f be 02             	movsbl (%edx),%eax
+ 2ba:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2bd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2c5:	77 1e                	ja     2e5 <atoi+0x35>
+ 2c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ce:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2d0:	83 c2 01             	add    $0x1,%edx
+ 2d3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2d6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2da:	0f be 02             	movsbl (%edx),%eax
+ 2dd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2e0:	80 fb 09             	cmp    $0x9,%bl
+ 2e3:	76 eb                	jbe    2d0 <atoi+0x20>
+  return n;
+}
+ 2e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2e8:	89 c8                	mov    %ecx,%eax
+ 2ea:	c9                   	leave
+ 2eb:	c3                   	ret
+ 2ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	57                   	push   %edi
+ 2f4:	56                   	push   %esi
+ 2f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 2fe:	85 c0                	test   %eax,%eax
+ 300:	7e 13                	jle    315 <memmove+0x25>
+ 302:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 304:	89 d7                	mov    %edx,%edi
+ 306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 310:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 311:	39 f8                	cmp    %edi,%eax
+ 313:	75 fb                	jne    310 <memmove+0x20>
+  return vdst;
+}
+ 315:	5e                   	pop    %esi
+ 316:	89 d0                	mov    %edx,%eax
+ 318:	5f                   	pop    %edi
+ 319:	5d                   	pop    %ebp
+ 31a:	c3                   	ret
+
+0000031b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 31b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 320:	cd 40                	int    $0x40
+ 322:	c3                   	ret
+
+00000323 <exit>:
+SYSCALL(exit)
+ 323:	b8 02 00 00 00       	mov    $0x2,%eax
+ 328:	cd 40                	int    $0x40
+ 32a:	c3                   	ret
+
+0000032b <wait>:
+SYSCALL(wait)
+ 32b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 330:	cd 40                	int    $0x40
+ 332:	c3                   	ret
+
+00000333 <pipe>:
+SYSCALL(pipe)
+ 333:	b8 04 00 00 00       	mov    $0x4,%eax
+ 338:	cd 40                	int    $0x40
+ 33a:	c3                   	ret
+
+0000033b <read>:
+SYSCALL(read)
+ 33b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 340:	cd 40                	int    $0x40
+ 342:	c3                   	ret
+
+00000343 <write>:
+SYSCALL(write)
+ 343:	b8 10 00 00 00       	mov    $0x10,%eax
+ 348:	cd 40                	int    $0x40
+ 34a:	c3                   	ret
+
+0000034b <close>:
+SYSCALL(close)
+ 34b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 350:	cd 40                	int    $0x40
+ 352:	c3                   	ret
+
+00000353 <kill>:
+SYSCALL(kill)
+ 353:	b8 06 00 00 00       	mov    $0x6,%eax
+ 358:	cd 40                	int    $0x40
+ 35a:	c3                   	ret
+
+0000035b <exec>:
+SYSCALL(exec)
+ 35b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 360:	cd 40                	int    $0x40
+ 362:	c3                   	ret
+
+00000363 <open>:
+SYSCALL(open)
+ 363:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 368:	cd 40                	int    $0x40
+ 36a:	c3                   	ret
+
+0000036b <mknod>:
+SYSCALL(mknod)
+ 36b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 370:	cd 40                	int    $0x40
+ 372:	c3                   	ret
+
+00000373 <unlink>:
+SYSCALL(unlink)
+ 373:	b8 12 00 00 00       	mov    $0x12,%eax
+ 378:	cd 40                	int    $0x40
+ 37a:	c3                   	ret
+
+0000037b <fstat>:
+SYSCALL(fstat)
+ 37b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 380:	cd 40                	int    $0x40
+ 382:	c3                   	ret
+
+00000383 <link>:
+SYSCALL(link)
+ 383:	b8 13 00 00 00       	mov    $0x13,%eax
+ 388:	cd 40                	int    $0x40
+ 38a:	c3                   	ret
+
+0000038b <mkdir>:
+SYSCALL(mkdir)
+ 38b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 390:	cd 40                	int    $0x40
+ 392:	c3                   	ret
+
+00000393 <chdir>:
+SYSCALL(chdir)
+ 393:	b8 09 00 00 00       	mov    $0x9,%eax
+ 398:	cd 40                	int    $0x40
+ 39a:	c3                   	ret
+
+0000039b <dup>:
+SYSCALL(dup)
+ 39b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 3a0:	cd 40                	int    $0x40
+ 3a2:	c3                   	ret
+
+000003a3 <getpid>:
+SYSCALL(getpid)
+ 3a3:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 3a8:	cd 40                	int    $0x40
+ 3aa:	c3                   	ret
+
+000003ab <sbrk>:
+SYSCALL(sbrk)
+ 3ab:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 3b0:	cd 40                	int    $0x40
+ 3b2:	c3                   	ret
+
+000003b3 <sleep>:
+SYSCALL(sleep)
+ 3b3:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 3b8:	cd 40                	int    $0x40
+ 3ba:	c3                   	ret
+
+000003bb <uptime>:
+SYSCALL(uptime)
+ 3bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 3c0:	cd 40                	int    $0x40
+ 3c2:	c3                   	ret
+
+000003c3 <nice>:
+SYSCALL(nice)
+ 3c3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 3c8:	cd 40                	int    $0x40
+ 3ca:	c3                   	ret
+
+000003cb <fsync>:
+SYSCALL(fsync)
+ 3cb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 3d0:	cd 40                	int    $0x40
+ 3d2:	c3                   	ret
+
+000003d3 <getpstat>:
+SYSCALL(getpstat)
+ 3d3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 3d8:	cd 40                	int    $0x40
+ 3da:	c3                   	ret
+
+000003db <pipesize>:
+SYSCALL(pipesize)
+ 3db:	b8 19 00 00 00       	mov    $0x19,%eax
+ 3e0:	cd 40                	int    $0x40
+ 3e2:	c3                   	ret
+
+000003e3 <uptimens>:
+SYSCALL(uptimens)
+ 3e3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 3e8:	cd 40                	int    $0x40
+ 3ea:	c3                   	ret
+
+000003eb <settickets>:
+SYSCALL(settickets)
+ 3eb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 3f0:	cd 40                	int    $0x40
+ 3f2:	c3                   	ret
+
+000003f3 <transfer>:
+SYSCALL(transfer)
+ 3f3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 3f8:	cd 40                	int    $0x40
+ 3fa:	c3                   	ret
+ 3fb:	66 90                	xchg   %ax,%ax
+ 3fd:	66 90                	xchg   %ax,%ax
+ 3ff:	90                   	nop
+
+00000400 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+ 405:	53                   	push   %ebx
+ 406:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 408:	89 d1                	mov    %edx,%ecx
+{
+ 40a:	83 ec 3c             	sub    $0x3c,%esp
+ 40d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 410:	85 d2                	test   %edx,%edx
+ 412:	0f 89 80 00 00 00    	jns    498 <printint+0x98>
+ 418:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 41c:	74 7a                	je     498 <printint+0x98>
+    x = -xx;
+ 41e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 420:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 425:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 428:	31 f6                	xor    %esi,%esi
+ 42a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 430:	89 c8                	mov    %ecx,%eax
+ 432:	31 d2                	xor    %edx,%edx
+ 434:	89 f7                	mov    %esi,%edi
+ 436:	f7 f3                	div    %ebx
+ 438:	8d 76 01             	lea    0x1(%esi),%esi
+ 43b:	0f b6 92 7c 0b 00 00 	movzbl 0xb7c(%edx),%edx
+ 442:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 446:	89 ca                	mov    %ecx,%edx
+ 448:	89 c1                	mov    %eax,%ecx
+ 44a:	39 da                	cmp    %ebx,%edx
+ 44c:	73 e2                	jae    430 <printint+0x30>
+  if(neg)
+ 44e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 451:	85 c0                	test   %eax,%eax
+ 453:	74 07                	je     45c <printint+0x5c>
+    buf[i++] = '-';
+ 455:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 45a:	89 f7                	mov    %esi,%edi
+ 45c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 45f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 462:	01 df                	add    %ebx,%edi
+ 464:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 468:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 46b:	83 ec 04             	sub    $0x4,%esp
+ 46e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 471:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 474:	6a 01                	push   $0x1
+ 476:	50                   	push   %eax
+ 477:	56                   	push   %esi
+ 478:	e8 c6 fe ff ff       	call   343 <write>
+  while(--i >= 0)
+ 47d:	89 f8                	mov    %edi,%eax
+ 47f:	83 c4 10             	add    $0x10,%esp
+ 482:	83 ef 01             	sub    $0x1,%edi
+ 485:	39 d8                	cmp    %ebx,%eax
+ 487:	75 df                	jne    468 <printint+0x68>
+}
+ 489:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 48c:	5b                   	pop    %ebx
+ 48d:	5e                   	pop    %esi
+ 48e:	5f                   	pop    %edi
+ 48f:	5d                   	pop    %ebp
+ 490:	c3                   	ret
+ 491:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 498:	31 c0                	xor    %eax,%eax
+ 49a:	eb 89                	jmp    425 <printint+0x25>
+ 49c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	57                   	push   %edi
+ 4a4:	56                   	push   %esi
+ 4a5:	53                   	push   %ebx
+ 4a6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 4a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 4ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 4af:	0f b6 1e             	movzbl (%esi),%ebx
+ 4b2:	83 c6 01             	add    $0x1,%esi
+ 4b5:	84 db                	test   %bl,%bl
+ 4b7:	74 67                	je     520 <printf+0x80>
+ 4b9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 4bc:	31 d2                	xor    %edx,%edx
+ 4be:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 4c1:	eb 34                	jmp    4f7 <printf+0x57>
+ 4c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4c7:	90                   	nop
+ 4c8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 4cb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 4d0:	83 f8 25             	cmp    $0x25,%eax
+ 4d3:	74 18                	je     4ed <printf+0x4d>
+  write(fd, &c, 1);
+ 4d5:	83 ec 04             	sub    $0x4,%esp
+ 4d8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 4db:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 4de:	6a 01                	push   $0x1
+ 4e0:	50                   	push   %eax
+ 4e1:	57                   	push   %edi
+ 4e2:	e8 5c fe ff ff       	call   343 <write>
+ 4e7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 4ea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 4ed:	0f b6 1e             	movzbl (%esi),%ebx
+ 4f0:	83 c6 01             	add    $0x1,%esi
+ 4f3:	84 db                	test   %bl,%bl
+ 4f5:	74 29                	je     520 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 4f7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 4fa:	85 d2                	test   %edx,%edx
+ 4fc:	74 ca                	je     4c8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 4fe:	83 fa 25             	cmp    $0x25,%edx
+ 501:	75 ea                	jne    4ed <printf+0x4d>
+      if(c == 'd'){
+ 503:	83 f8 25             	cmp    $0x25,%eax
+ 506:	0f 84 24 01 00 00    	je     630 <printf+0x190>
+ 50c:	83 e8 63             	sub    $0x63,%eax
+ 50f:	83 f8 15             	cmp    $0x15,%eax
+ 512:	77 1c                	ja     530 <printf+0x90>
+ 514:	ff 24 85 24 0b 00 00 	jmp    *0xb24(,%eax,4)
+ 51b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 51f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 520:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 523:	5b                   	pop    %ebx
+ 524:	5e                   	pop    %esi
+ 525:	5f                   	pop    %edi
+ 526:	5d                   	pop    %ebp
+ 527:	c3                   	ret
+ 528:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52f:	90                   	nop
+  write(fd, &c, 1);
+ 530:	83 ec 04             	sub    $0x4,%esp
+ 533:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 536:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 53a:	6a 01                	push   $0x1
+ 53c:	52                   	push   %edx
+ 53d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 540:	57                   	push   %edi
+ 541:	e8 fd fd ff ff       	call   343 <write>
+ 546:	83 c4 0c             	add    $0xc,%esp
+ 549:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 54c:	6a 01                	push   $0x1
+ 54e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 551:	52                   	push   %edx
+ 552:	57                   	push   %edi
+ 553:	e8 eb fd ff ff       	call   343 <write>
+        putc(fd, c);
+ 558:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 55b:	31 d2                	xor    %edx,%edx
+ 55d:	eb 8e                	jmp    4ed <printf+0x4d>
+ 55f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 560:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 563:	83 ec 0c             	sub    $0xc,%esp
+ 566:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 56b:	8b 13                	mov    (%ebx),%edx
+ 56d:	6a 00                	push   $0x0
+ 56f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 571:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 574:	e8 87 fe ff ff       	call   400 <printint>
+        ap++;
+ 579:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 57c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 57f:	31 d2                	xor    %edx,%edx
+ 581:	e9 67 ff ff ff       	jmp    4ed <printf+0x4d>
+ 586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 590:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 593:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 595:	83 c0 04             	add    $0x4,%eax
+ 598:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 59b:	85 db                	test   %ebx,%ebx
+ 59d:	0f 84 9d 00 00 00    	je     640 <printf+0x1a0>
+        while(*s != 0){
+ 5a3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 5a6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 5a8:	84 c0                	test   %al,%al
+ 5aa:	0f 84 3d ff ff ff    	je     4ed <printf+0x4d>
+ 5b0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 5b3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 5b6:	89 de                	mov    %ebx,%esi
+ 5b8:	89 d3                	mov    %edx,%ebx
+ 5ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 5c0:	83 ec 04             	sub    $0x4,%esp
+ 5c3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 5c6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 5c9:	6a 01                	push   $0x1
+ 5cb:	53                   	push   %ebx
+ 5cc:	57                   	push   %edi
+ 5cd:	e8 71 fd ff ff       	call   343 <write>
+        while(*s != 0){
+ 5d2:	0f b6 06             	movzbl (%esi),%eax
+ 5d5:	83 c4 10             	add    $0x10,%esp
+ 5d8:	84 c0                	test   %al,%al
+ 5da:	75 e4                	jne    5c0 <printf+0x120>
+      state = 0;
+ 5dc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 5df:	31 d2                	xor    %edx,%edx
+ 5e1:	e9 07 ff ff ff       	jmp    4ed <printf+0x4d>
+ 5e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5ed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 5f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 5f3:	83 ec 0c             	sub    $0xc,%esp
+ 5f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 5fb:	8b 13                	mov    (%ebx),%edx
+ 5fd:	6a 01                	push   $0x1
+ 5ff:	e9 6b ff ff ff       	jmp    56f <printf+0xcf>
+ 604:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 608:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 60b:	83 ec 04             	sub    $0x4,%esp
+ 60e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 611:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 613:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 616:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 619:	6a 01                	push   $0x1
+ 61b:	52                   	push   %edx
+ 61c:	57                   	push   %edi
+ 61d:	e8 21 fd ff ff       	call   343 <write>
+        ap++;
+ 622:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 625:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 628:	31 d2                	xor    %edx,%edx
+ 62a:	e9 be fe ff ff       	jmp    4ed <printf+0x4d>
+ 62f:	90                   	nop
+  write(fd, &c, 1);
+ 630:	83 ec 04             	sub    $0x4,%esp
+ 633:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 636:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 639:	6a 01                	push   $0x1
+ 63b:	e9 11 ff ff ff       	jmp    551 <printf+0xb1>
+ 640:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 645:	bb 1c 0b 00 00       	mov    $0xb1c,%ebx
+ 64a:	e9 61 ff ff ff       	jmp    5b0 <printf+0x110>
+ 64f:	90                   	nop
+
+00000650 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 650:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 651:	a1 28 0f 00 00       	mov    0xf28,%eax
+{
+ 656:	89 e5                	mov    %esp,%ebp
+ 658:	57                   	push   %edi
+ 659:	56                   	push   %esi
+ 65a:	53                   	push   %ebx
+ 65b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 65e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 661:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 668:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 66a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 66c:	39 ca                	cmp    %ecx,%edx
+ 66e:	73 30                	jae    6a0 <free+0x50>
+ 670:	39 c1                	cmp    %eax,%ecx
+ 672:	72 04                	jb     678 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 674:	39 c2                	cmp    %eax,%edx
+ 676:	72 f0                	jb     668 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 678:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 67b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 67e:	39 f8                	cmp    %edi,%eax
+ 680:	74 2e                	je     6b0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 682:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 685:	8b 42 04             	mov    0x4(%edx),%eax
+ 688:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 68b:	39 f1                	cmp    %esi,%ecx
+ 68d:	74 38                	je     6c7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 68f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 691:	5b                   	pop    %ebx
+  freep = p;
+ 692:	89 15 28 0f 00 00    	mov    %edx,0xf28
+}
+ 698:	5e                   	pop    %esi
+ 699:	5f                   	pop    %edi
+ 69a:	5d                   	pop    %ebp
+ 69b:	c3                   	ret
+ 69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 6a0:	39 c1                	cmp    %eax,%ecx
+ 6a2:	72 d0                	jb     674 <free+0x24>
+ 6a4:	eb c2                	jmp    668 <free+0x18>
+ 6a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 6b0:	03 70 04             	add    0x4(%eax),%esi
+ 6b3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 6b6:	8b 02                	mov    (%edx),%eax
+ 6b8:	8b 00                	mov    (%eax),%eax
+ 6ba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 6bd:	8b 42 04             	mov    0x4(%edx),%eax
+ 6c0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 6c3:	39 f1                	cmp    %esi,%ecx
+ 6c5:	75 c8                	jne    68f <free+0x3f>
+    p->s.size += bp->s.size;
+ 6c7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 6ca:	89 15 28 0f 00 00    	mov    %edx,0xf28
+    p->s.size += bp->s.size;
+ 6d0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 6d3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 6d6:	89 0a                	mov    %ecx,(%edx)
+}
+ 6d8:	5b                   	pop    %ebx
+ 6d9:	5e                   	pop    %esi
+ 6da:	5f                   	pop    %edi
+ 6db:	5d                   	pop    %ebp
+ 6dc:	c3                   	ret
+ 6dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006e0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	57                   	push   %edi
+ 6e4:	56                   	push   %esi
+ 6e5:	53                   	push   %ebx
+ 6e6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 6ec:	8b 15 28 0f 00 00    	mov    0xf28,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 6f2:	8d 78 07             	lea    0x7(%eax),%edi
+ 6f5:	c1 ef 03             	shr    $0x3,%edi
+ 6f8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 6fb:	85 d2                	test   %edx,%edx
+ 6fd:	0f 84 8d 00 00 00    	je     790 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 703:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 705:	8b 48 04             	mov    0x4(%eax),%ecx
+ 708:	39 f9                	cmp    %edi,%ecx
+ 70a:	73 64                	jae    770 <malloc+0x90>
+  if(nu < 4096)
+ 70c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 711:	39 df                	cmp    %ebx,%edi
+ 713:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 716:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 71d:	eb 0a                	jmp    729 <malloc+0x49>
+ 71f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 720:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 722:	8b 48 04             	mov    0x4(%eax),%ecx
+ 725:	39 f9                	cmp    %edi,%ecx
+ 727:	73 47                	jae    770 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 729:	89 c2                	mov    %eax,%edx
+ 72b:	39 05 28 0f 00 00    	cmp    %eax,0xf28
+ 731:	75 ed                	jne    720 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 733:	83 ec 0c             	sub    $0xc,%esp
+ 736:	56                   	push   %esi
+ 737:	e8 6f fc ff ff       	call   3ab <sbrk>
+  if(p == (char*)-1)
+ 73c:	83 c4 10             	add    $0x10,%esp
+ 73f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 742:	74 1c                	je     760 <malloc+0x80>
+  hp->s.size = nu;
+ 744:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 747:	83 ec 0c             	sub    $0xc,%esp
+ 74a:	83 c0 08             	add    $0x8,%eax
+ 74d:	50                   	push   %eax
+ 74e:	e8 fd fe ff ff       	call   650 <free>
+  return freep;
+ 753:	8b 15 28 0f 00 00    	mov    0xf28,%edx
+      if((p = morecore(nunits)) == 0)
+ 759:	83 c4 10             	add    $0x10,%esp
+ 75c:	85 d2                	test   %edx,%edx
+ 75e:	75 c0                	jne    720 <malloc+0x40>
+        return 0;
+  }
+}
+ 760:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 763:	31 c0                	xor    %eax,%eax
+}
+ 765:	5b                   	pop    %ebx
+ 766:	5e                   	pop    %esi
+ 767:	5f                   	pop    %edi
+ 768:	5d                   	pop    %ebp
+ 769:	c3                   	ret
+ 76a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 770:	39 cf                	cmp    %ecx,%edi
+ 772:	74 4c                	je     7c0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 774:	29 f9                	sub    %edi,%ecx
+ 776:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 779:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 77c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 77f:	89 15 28 0f 00 00    	mov    %edx,0xf28
+}
+ 785:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 788:	83 c0 08             	add    $0x8,%eax
+}
+ 78b:	5b                   	pop    %ebx
+ 78c:	5e                   	pop    %esi
+ 78d:	5f                   	pop    %edi
+ 78e:	5d                   	pop    %ebp
+ 78f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 790:	c7 05 28 0f 00 00 2c 	movl   $0xf2c,0xf28
+ 797:	0f 00 00 
+    base.s.size = 0;
+ 79a:	b8 2c 0f 00 00       	mov    $0xf2c,%eax
+    base.s.ptr = freep = prevp = &base;
+ 79f:	c7 05 2c 0f 00 00 2c 	movl   $0xf2c,0xf2c
+ 7a6:	0f 00 00 
+    base.s.size = 0;
+ 7a9:	c7 05 30 0f 00 00 00 	movl   $0x0,0xf30
+ 7b0:	00 00 00 
+    if(p->s.size >= nunits){
+ 7b3:	e9 54 ff ff ff       	jmp    70c <malloc+0x2c>
+ 7b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7bf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 7c0:	8b 08                	mov    (%eax),%ecx
+ 7c2:	89 0a                	mov    %ecx,(%edx)
+ 7c4:	eb b9                	jmp    77f <malloc+0x9f>
+ 7c6:	66 90                	xchg   %ax,%ax
+ 7c8:	66 90                	xchg   %ax,%ax
+ 7ca:	66 90                	xchg   %ax,%ax
+ 7cc:	66 90                	xchg   %ax,%ax
+ 7ce:	66 90                	xchg   %ax,%ax
+
+000007d0 <pidstat>:
+
+// Fill in *st with the statistics of process pid.
+// Returns 0, or -1 if there is no such process.
+int
+pidstat(int pid, struct pstat *st)
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	56                   	push   %esi
+ 7d4:	53                   	push   %ebx
+  static struct pstat *ps;
+  int i, n;
+
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ 7d5:	a1 34 0f 00 00       	mov    0xf34,%eax
+{
+ 7da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 7dd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ 7e0:	85 c0                	test   %eax,%eax
+ 7e2:	0f 84 98 00 00 00    	je     880 <pidstat+0xb0>
+    return -1;
+  n = getpstat(ps, NPROC);
+ 7e8:	83 ec 08             	sub    $0x8,%esp
+ 7eb:	6a 40                	push   $0x40
+ 7ed:	50                   	push   %eax
+ 7ee:	e8 e0 fb ff ff       	call   3d3 <getpstat>
+  for(i = 0; i < n; i++){
+ 7f3:	83 c4 10             	add    $0x10,%esp
+ 7f6:	85 c0                	test   %eax,%eax
+ 7f8:	0f 8e 9f 00 00 00    	jle    89d <pidstat+0xcd>
+ 7fe:	8b 15 34 0f 00 00    	mov    0xf34,%edx
+ 804:	31 c9                	xor    %ecx,%ecx
+ 806:	eb 16                	jmp    81e <pidstat+0x4e>
+ 808:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 80f:	90                   	nop
+ 810:	83 c1 01             	add    $0x1,%ecx
+ 813:	83 c2 38             	add    $0x38,%edx
+ 816:	39 c8                	cmp    %ecx,%eax
+ 818:	0f 84 7f 00 00 00    	je     89d <pidstat+0xcd>
+    if(ps[i].pid == pid){
+ 81e:	39 1a                	cmp    %ebx,(%edx)
+ 820:	75 ee                	jne    810 <pidstat+0x40>
+      *st = ps[i];
+ 822:	89 1e                	mov    %ebx,(%esi)
+ 824:	8b 42 04             	mov    0x4(%edx),%eax
+ 827:	89 46 04             	mov    %eax,0x4(%esi)
+ 82a:	8b 42 08             	mov    0x8(%edx),%eax
+ 82d:	89 46 08             	mov    %eax,0x8(%esi)
+ 830:	8b 42 0c             	mov    0xc(%edx),%eax
+ 833:	89 46 0c             	mov    %eax,0xc(%esi)
+ 836:	8b 42 10             	mov    0x10(%edx),%eax
+ 839:	89 46 10             	mov    %eax,0x10(%esi)
+ 83c:	8b 42 14             	mov    0x14(%edx),%eax
+ 83f:	89 46 14             	mov    %eax,0x14(%esi)
+ 842:	8b 42 18             	mov    0x18(%edx),%eax
+ 845:	89 46 18             	mov    %eax,0x18(%esi)
+ 848:	8b 42 1c             	mov    0x1c(%edx),%eax
+ 84b:	89 46 1c             	mov    %eax,0x1c(%esi)
+ 84e:	8b 42 20             	mov    0x20(%edx),%eax
+ 851:	89 46 20             	mov    %eax,0x20(%esi)
+ 854:	8b 42 24             	mov    0x24(%edx),%eax
+ 857:	89 46 24             	mov    %eax,0x24(%esi)
+ 85a:	8b 42 28             	mov    0x28(%edx),%eax
+ 85d:	89 46 28             	mov    %eax,0x28(%esi)
+ 860:	8b 42 2c             	mov    0x2c(%edx),%eax
+ 863:	89 46 2c             	mov    %eax,0x2c(%esi)
+ 866:	8b 42 30             	mov    0x30(%edx),%eax
+ 869:	89 46 30             	mov    %eax,0x30(%esi)
+ 86c:	8b 42 34             	mov    0x34(%edx),%eax
+ 86f:	89 46 34             	mov    %eax,0x34(%esi)
+      return 0;
+    }
+  }
+  return -1;
+}
+ 872:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ 875:	31 c0                	xor    %eax,%eax
+}
+ 877:	5b                   	pop    %ebx
+ 878:	5e                   	pop    %esi
+ 879:	5d                   	pop    %ebp
+ 87a:	c3                   	ret
+ 87b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 87f:	90                   	nop
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ 880:	83 ec 0c             	sub    $0xc,%esp
+ 883:	68 00 0e 00 00       	push   $0xe00
+ 888:	e8 53 fe ff ff       	call   6e0 <malloc>
+ 88d:	83 c4 10             	add    $0x10,%esp
+ 890:	a3 34 0f 00 00       	mov    %eax,0xf34
+ 895:	85 c0                	test   %eax,%eax
+ 897:	0f 85 4b ff ff ff    	jne    7e8 <pidstat+0x18>
+}
+ 89d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return -1;
+ 8a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 8a5:	5b                   	pop    %ebx
+ 8a6:	5e                   	pop    %esi
+ 8a7:	5d                   	pop    %ebp
+ 8a8:	c3                   	ret
+ 8a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000008b0 <sharetable>:
+// key[i] is printed in a column headed keyname, and so is
+// extra[i] under extraname unless extra is 0.
+void
+sharetable(char *tag, char *keyname, int *key, char *extraname, int *extra,
+           int n, int *pid, int *weight, uint *ticks)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	57                   	push   %edi
+ 8b4:	56                   	push   %esi
+ 8b5:	53                   	push   %ebx
+ 8b6:	83 ec 3c             	sub    $0x3c,%esp
+ 8b9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8bc:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+ 8bf:	8b 75 24             	mov    0x24(%ebp),%esi
+ 8c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 8c5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 8c8:	8b 45 10             	mov    0x10(%ebp),%eax
+ 8cb:	89 7d d0             	mov    %edi,-0x30(%ebp)
+ 8ce:	8b 5d 14             	mov    0x14(%ebp),%ebx
+ 8d1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+ 8d4:	8b 45 18             	mov    0x18(%ebp),%eax
+ 8d7:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ 8da:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 8dd:	8b 45 20             	mov    0x20(%ebp),%eax
+ 8e0:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 8e3:	8b 45 28             	mov    0x28(%ebp),%eax
+ 8e6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  int i, wsum, share, expect, err, maxerr;
+  uint tsum;
+
+  wsum = 0;
+  tsum = 0;
+  for(i = 0; i < n; i++){
+ 8e9:	85 ff                	test   %edi,%edi
+ 8eb:	0f 8e df 01 00 00    	jle    ad0 <sharetable+0x220>
+ 8f1:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+ 8f4:	89 fb                	mov    %edi,%ebx
+ 8f6:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  tsum = 0;
+ 8f9:	31 d2                	xor    %edx,%edx
+  for(i = 0; i < n; i++){
+ 8fb:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 8fe:	31 c0                	xor    %eax,%eax
+ 900:	31 c9                	xor    %ecx,%ecx
+ 902:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wsum += weight[i];
+ 908:	03 0c 86             	add    (%esi,%eax,4),%ecx
+    tsum += ticks[i];
+ 90b:	03 14 87             	add    (%edi,%eax,4),%edx
+  for(i = 0; i < n; i++){
+ 90e:	83 c0 01             	add    $0x1,%eax
+ 911:	39 c3                	cmp    %eax,%ebx
+ 913:	75 f3                	jne    908 <sharetable+0x58>
+ 915:	85 d2                	test   %edx,%edx
+ 917:	b8 01 00 00 00       	mov    $0x1,%eax
+ 91c:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  }
+  if(tsum == 0)
+    tsum = 1;
+  if(wsum == 0)
+    wsum = 1;
+ 91f:	8b 7d d8             	mov    -0x28(%ebp),%edi
+ 922:	0f 45 c2             	cmovne %edx,%eax
+ 925:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+  if(tsum == 0)
+ 928:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    wsum = 1;
+ 92b:	85 ff                	test   %edi,%edi
+ 92d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 930:	b8 01 00 00 00       	mov    $0x1,%eax
+ 935:	0f 45 c7             	cmovne %edi,%eax
+ 938:	89 45 d8             	mov    %eax,-0x28(%ebp)
+
+  printf(1, "[%s]  pid %s ", tag, keyname);
+ 93b:	51                   	push   %ecx
+ 93c:	ff 75 dc             	push   -0x24(%ebp)
+ 93f:	68 8d 0b 00 00       	push   $0xb8d
+ 944:	6a 01                	push   $0x1
+ 946:	e8 55 fb ff ff       	call   4a0 <printf>
+  if(extra)
+ 94b:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 94e:	83 c4 10             	add    $0x10,%esp
+ 951:	85 f6                	test   %esi,%esi
+ 953:	0f 84 47 01 00 00    	je     aa0 <sharetable+0x1f0>
+    printf(1, "%s ", extraname);
+ 959:	83 ec 04             	sub    $0x4,%esp
+ 95c:	53                   	push   %ebx
+ 95d:	68 97 0b 00 00       	push   $0xb97
+ 962:	6a 01                	push   $0x1
+ 964:	e8 37 fb ff ff       	call   4a0 <printf>
+  printf(1, "ticks  share expected\n");
+ 969:	58                   	pop    %eax
+ 96a:	5a                   	pop    %edx
+ 96b:	68 9b 0b 00 00       	push   $0xb9b
+ 970:	6a 01                	push   $0x1
+ 972:	e8 29 fb ff ff       	call   4a0 <printf>
+  maxerr = 0;
+  for(i = 0; i < n; i++){
+ 977:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+ 97a:	83 c4 10             	add    $0x10,%esp
+ 97d:	85 c9                	test   %ecx,%ecx
+ 97f:	0f 8e 44 01 00 00    	jle    ac9 <sharetable+0x219>
+  if(extra)
+ 985:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+ 98c:	31 ff                	xor    %edi,%edi
+ 98e:	66 90                	xchg   %ax,%ax
+    share = ticks[i] * 1000 / tsum;
+ 990:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 993:	31 d2                	xor    %edx,%edx
+    expect = weight[i] * 1000 / wsum;
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+ 995:	83 ec 0c             	sub    $0xc,%esp
+    share = ticks[i] * 1000 / tsum;
+ 998:	69 04 b8 e8 03 00 00 	imul   $0x3e8,(%eax,%edi,4),%eax
+ 99f:	f7 75 c0             	divl   -0x40(%ebp)
+ 9a2:	89 c6                	mov    %eax,%esi
+    expect = weight[i] * 1000 / wsum;
+ 9a4:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 9a7:	69 04 b8 e8 03 00 00 	imul   $0x3e8,(%eax,%edi,4),%eax
+ 9ae:	99                   	cltd
+ 9af:	f7 7d d8             	idivl  -0x28(%ebp)
+ 9b2:	89 c3                	mov    %eax,%ebx
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+ 9b4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ 9b7:	ff 34 b8             	push   (%eax,%edi,4)
+ 9ba:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ 9bd:	ff 34 b8             	push   (%eax,%edi,4)
+ 9c0:	ff 75 dc             	push   -0x24(%ebp)
+ 9c3:	68 b2 0b 00 00       	push   $0xbb2
+ 9c8:	6a 01                	push   $0x1
+ 9ca:	e8 d1 fa ff ff       	call   4a0 <printf>
+    if(extra)
+ 9cf:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 9d2:	83 c4 20             	add    $0x20,%esp
+ 9d5:	85 c0                	test   %eax,%eax
+ 9d7:	74 15                	je     9ee <sharetable+0x13e>
+      printf(1, "%d ", extra[i]);
+ 9d9:	83 ec 04             	sub    $0x4,%esp
+ 9dc:	ff 34 b8             	push   (%eax,%edi,4)
+ 9df:	68 ba 0b 00 00       	push   $0xbba
+ 9e4:	6a 01                	push   $0x1
+ 9e6:	e8 b5 fa ff ff       	call   4a0 <printf>
+ 9eb:	83 c4 10             	add    $0x10,%esp
+    printf(1, "%d %d.%d%% %d.%d%%\n", ticks[i], share / 10, share % 10,
+ 9ee:	b8 67 66 66 66       	mov    $0x66666667,%eax
+ 9f3:	89 d9                	mov    %ebx,%ecx
+ 9f5:	83 ec 04             	sub    $0x4,%esp
+ 9f8:	f7 eb                	imul   %ebx
+ 9fa:	89 d8                	mov    %ebx,%eax
+ 9fc:	c1 f8 1f             	sar    $0x1f,%eax
+ 9ff:	c1 fa 02             	sar    $0x2,%edx
+ a02:	29 c2                	sub    %eax,%edx
+ a04:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ a07:	01 c0                	add    %eax,%eax
+ a09:	29 c1                	sub    %eax,%ecx
+ a0b:	b8 67 66 66 66       	mov    $0x66666667,%eax
+ a10:	51                   	push   %ecx
+ a11:	89 f1                	mov    %esi,%ecx
+ a13:	52                   	push   %edx
+ a14:	f7 ee                	imul   %esi
+ a16:	89 f0                	mov    %esi,%eax
+ a18:	c1 f8 1f             	sar    $0x1f,%eax
+ a1b:	c1 fa 02             	sar    $0x2,%edx
+ a1e:	29 c2                	sub    %eax,%edx
+ a20:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ a23:	01 c0                	add    %eax,%eax
+ a25:	29 c1                	sub    %eax,%ecx
+ a27:	51                   	push   %ecx
+ a28:	52                   	push   %edx
+ a29:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ a2c:	ff 34 b8             	push   (%eax,%edi,4)
+ a2f:	68 be 0b 00 00       	push   $0xbbe
+ a34:	6a 01                	push   $0x1
+ a36:	e8 65 fa ff ff       	call   4a0 <printf>
+           expect / 10, expect % 10);
+    err = share > expect ? share - expect : expect - share;
+ a3b:	89 f2                	mov    %esi,%edx
+ a3d:	89 d8                	mov    %ebx,%eax
+ a3f:	83 c4 20             	add    $0x20,%esp
+ a42:	29 f0                	sub    %esi,%eax
+ a44:	29 da                	sub    %ebx,%edx
+ a46:	39 de                	cmp    %ebx,%esi
+ a48:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ a4b:	0f 4f c2             	cmovg  %edx,%eax
+    if(err > maxerr)
+ a4e:	39 c6                	cmp    %eax,%esi
+ a50:	0f 4d c6             	cmovge %esi,%eax
+  for(i = 0; i < n; i++){
+ a53:	83 c7 01             	add    $0x1,%edi
+ a56:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ a59:	39 7d d0             	cmp    %edi,-0x30(%ebp)
+ a5c:	0f 85 2e ff ff ff    	jne    990 <sharetable+0xe0>
+      maxerr = err;
+  }
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+ a62:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+ a67:	f7 e2                	mul    %edx
+ a69:	c1 ea 03             	shr    $0x3,%edx
+ a6c:	8d 0c 92             	lea    (%edx,%edx,4),%ecx
+ a6f:	89 d0                	mov    %edx,%eax
+ a71:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ a74:	01 c9                	add    %ecx,%ecx
+ a76:	29 ca                	sub    %ecx,%edx
+ a78:	89 45 14             	mov    %eax,0x14(%ebp)
+ a7b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ a7e:	89 55 18             	mov    %edx,0x18(%ebp)
+ a81:	89 45 10             	mov    %eax,0x10(%ebp)
+ a84:	c7 45 0c d4 0b 00 00 	movl   $0xbd4,0xc(%ebp)
+ a8b:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+ a92:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a95:	5b                   	pop    %ebx
+ a96:	5e                   	pop    %esi
+ a97:	5f                   	pop    %edi
+ a98:	5d                   	pop    %ebp
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+ a99:	e9 02 fa ff ff       	jmp    4a0 <printf>
+ a9e:	66 90                	xchg   %ax,%ax
+  printf(1, "ticks  share expected\n");
+ aa0:	83 ec 08             	sub    $0x8,%esp
+ aa3:	68 9b 0b 00 00       	push   $0xb9b
+ aa8:	6a 01                	push   $0x1
+ aaa:	e8 f1 f9 ff ff       	call   4a0 <printf>
+ aaf:	83 c4 10             	add    $0x10,%esp
+ ab2:	e9 ce fe ff ff       	jmp    985 <sharetable+0xd5>
+ ab7:	83 ec 08             	sub    $0x8,%esp
+ aba:	68 9b 0b 00 00       	push   $0xb9b
+ abf:	6a 01                	push   $0x1
+ ac1:	e8 da f9 ff ff       	call   4a0 <printf>
+ ac6:	83 c4 10             	add    $0x10,%esp
+  if(extra)
+ ac9:	31 c0                	xor    %eax,%eax
+ acb:	31 d2                	xor    %edx,%edx
+ acd:	eb a9                	jmp    a78 <sharetable+0x1c8>
+ acf:	90                   	nop
+  printf(1, "[%s]  pid %s ", tag, keyname);
+ ad0:	51                   	push   %ecx
+ ad1:	ff 75 dc             	push   -0x24(%ebp)
+ ad4:	68 8d 0b 00 00       	push   $0xb8d
+ ad9:	6a 01                	push   $0x1
+ adb:	e8 c0 f9 ff ff       	call   4a0 <printf>
+  if(extra)
+ ae0:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ ae3:	83 c4 10             	add    $0x10,%esp
+ ae6:	85 ff                	test   %edi,%edi
+ ae8:	74 cd                	je     ab7 <sharetable+0x207>
+    wsum = 1;
+ aea:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  if(extra)
+ af1:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+ af8:	e9 5c fe ff ff       	jmp    959 <sharetable+0xa9>
@@ -6,12 +6,70 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
+#include "pstat.h"
+#include "traps.h"
+
+// Sleeping processes are kept on sleep queues, hashed by chan, so
+// wakeup() looks only at processes that may be sleeping on its
+// channel; and every process but the UNUSED ones is on a hash
+// chain by pid. A process is on its parent's children list until
+// it exits and on the parent's zombies list from then until wait()
+// reaps it. ptable.lock protects all of these.
+#define NSLEEPQ 64
+#define SQHASH(chan) (((uint)(chan) * 2654435761U) >> 26)
+#define NPIDHASH NPROC
+#define PIDHASH(pid) ((pid) % NPIDHASH)
 
 struct {
   struct spinlock lock;
   struct proc proc[NPROC];
+  struct proc *sleepq[NSLEEPQ];   // chains through snext
+  struct proc *pidhash[NPIDHASH]; // chains through pidnext
 } ptable;
 
+// Per-CPU run queues.
+//
+// Every RUNNABLE process sits on exactly one run queue, the one
+// named by p->cpu, in the FIFO bucket for its priority level.
+// bitmap has bit i set when level i is non-empty, so picking the
+// next process is a find-first-set plus a dequeue.
+//
+// runq[i].lock protects the queue, and the RUNNABLE <-> RUNNING
+// transitions and p->cpu of the processes on it. ptable.lock still
+// protects SLEEPING/ZOMBIE transitions, chan and the parent links;
+// when both are needed ptable.lock is acquired first.
+//
+// The lock of the run queue a process belongs to is what is held
+// across swtch(): a process that gives up the CPU acquires its
+// queue's lock before calling sched(), and the scheduler releases
+// it once the process's context has been saved. This keeps another
+// CPU from picking the process up while it is still on its stack.
+
+// Run queues ordered by virtual time rather than by level.
+#if defined(FAIR_SCHED) || defined(STRIDE_SCHED)
+#define VTIME_SCHED
+#endif
+
+struct runq {
+  struct spinlock lock;
+  struct proc *head[NPRIO];
+  struct proc *tail[NPRIO];
+  uint bitmap;       // bit i set if head[i] != 0
+  int nrunnable;     // processes on this queue
+  uint passes;       // scheduling decisions made, for aging
+#ifdef MLFQ_SCHED
+  uint boosted;      // boost period last applied to the queue
+#endif
+  uint nsteals;      // times this CPU stole work
+  uint nmigrations;  // processes moved onto this queue by stealing
+#ifdef VTIME_SCHED
+  struct proc *heap[NPROC];  // min-heap on vruntime, in place of levels
+  uint64 minvrun;    // largest vruntime of a process popped so far
+#endif
+};
+
+struct runq runq[NCPU];
+
 static struct proc *initproc;
 
 int nextpid = 1;
@@ -19,16 +77,26 @@ extern void forkret(void);
 extern void trapret(void);
 
 static void wakeup1(void *chan);
+static void sqinsert(struct proc *p);
+static void lend(struct proc *p);
+static void unlend(struct proc *p);
 
 /* Fallback if you forgot to put this in proc.h */
 #ifndef AGING_INTERVAL
 #define AGING_INTERVAL 50
 #endif
+#ifndef BOOST_TICKS
+#define BOOST_TICKS 100
+#endif
 
 void
 pinit(void)
 {
+  int i;
+
   initlock(&ptable.lock, "ptable");
+  for(i = 0; i < NCPU; i++)
+    initlock(&runq[i].lock, "runq");
 }
 
 // Must be called with interrupts disabled
@@ -68,6 +136,509 @@ myproc(void) {
   return p;
 }
 
+//PAGEBREAK: 40
+// Run queue helpers. Callers hold the queue's lock.
+
+#ifdef VTIME_SCHED
+// Virtual-time scheduling, for FAIR_SCHED and STRIDE_SCHED.
+// A process accumulates virtual runtime: its nanoseconds on a CPU,
+// times NICE0_WEIGHT over its weight (see vweight), so one of twice
+// the weight ages half as fast. A run queue is a min-heap on
+// vruntime and always runs the root. A process joining a queue
+// starts no more than SLICE_NS behind the queue's minvrun, so time
+// spent asleep is not banked as CPU credit.
+//
+// FAIR_SCHED takes the weight from the nice value, as completely
+// fair scheduling does. STRIDE_SCHED takes it from tickets:
+// vruntime is then the pass, advanced by the stride
+// NICE0_WEIGHT/tickets for each nanosecond of service, so shares
+// come out exactly in proportion to tickets, with no randomness.
+// A client blocked on a server can lend the server its tickets
+// (see lendtickets).
+
+#define NICE0_WEIGHT 1024
+#define SLICE_NS (1000000000ULL / HZ)
+
+// Weight by nice value; each step is worth about 1.56x the CPU.
+// These are Linux's weights for nice -4, -2, 0, 2 and 4.
+static const uint niceweight[NPRIO] = { 2501, 1586, 1024, 655, 423 };
+
+static void
+heapswap(struct runq *rq, int i, int j)
+{
+  struct proc *t;
+
+  t = rq->heap[i];
+  rq->heap[i] = rq->heap[j];
+  rq->heap[j] = t;
+  rq->heap[i]->heapidx = i;
+  rq->heap[j]->heapidx = j;
+}
+
+// Move heap[i] up or down until the heap is in order.
+static void
+heapfix(struct runq *rq, int i)
+{
+  int c;
+
+  while(i > 0 && rq->heap[i]->vruntime < rq->heap[(i-1)/2]->vruntime){
+    heapswap(rq, i, (i-1)/2);
+    i = (i-1)/2;
+  }
+  for(;;){
+    c = 2*i + 1;
+    if(c >= rq->nrunnable)
+      break;
+    if(c+1 < rq->nrunnable && rq->heap[c+1]->vruntime < rq->heap[c]->vruntime)
+      c++;
+    if(rq->heap[i]->vruntime <= rq->heap[c]->vruntime)
+      break;
+    heapswap(rq, i, c);
+    i = c;
+  }
+}
+
+// Add p to rq.
+static void
+rqpush(struct runq *rq, struct proc *p)
+{
+  p->heapidx = rq->nrunnable++;
+  rq->heap[p->heapidx] = p;
+  heapfix(rq, p->heapidx);
+}
+
+// Take p off rq.
+static void
+rqremove(struct runq *rq, struct proc *p)
+{
+  int i = p->heapidx;
+
+  rq->nrunnable--;
+  if(i != rq->nrunnable){
+    rq->heap[i] = rq->heap[rq->nrunnable];
+    rq->heap[i]->heapidx = i;
+    heapfix(rq, i);
+  }
+}
+
+// Remove and return the process with the least
+// vruntime, or 0 if rq is empty.
+static struct proc*
+rqpop(struct runq *rq)
+{
+  struct proc *p;
+
+  if(rq->nrunnable == 0)
+    return 0;
+  p = rq->heap[0];
+  rqremove(rq, p);
+  if(p->vruntime > rq->minvrun)
+    rq->minvrun = p->vruntime;
+  return p;
+}
+
+// Weight that p's virtual time advances against.
+static uint
+vweight(struct proc *p)
+{
+#ifdef STRIDE_SCHED
+  return p->tickets + p->borrowed;
+#else
+  return niceweight[p->nice];
+#endif
+}
+
+// Charge the running process p for its time
+// on the CPU since the scheduler started it.
+static void
+vcharge(struct proc *p)
+{
+  uint64 ns;
+
+  ns = nsecs() - p->runstart;
+  if(ns > 0xffffffff)
+    ns = 0xffffffff;
+  p->vruntime += ns * ((NICE0_WEIGHT << 16) / vweight(p)) >> 16;
+}
+
+#else
+
+// Level of the bucket p is queued on.
+static int
+rqlevel(struct proc *p)
+{
+#if defined(PRIORITY_SCHED) || defined(MLFQ_SCHED)
+  return p->eff_priority;
+#else
+  return 0;
+#endif
+}
+
+// Append p to the tail of its level on rq.
+static void
+rqpush(struct runq *rq, struct proc *p)
+{
+  int lvl = rqlevel(p);
+
+  p->rqnext = 0;
+  p->rqprev = rq->tail[lvl];
+  if(rq->tail[lvl])
+    rq->tail[lvl]->rqnext = p;
+  else
+    rq->head[lvl] = p;
+  rq->tail[lvl] = p;
+  rq->bitmap |= 1 << lvl;
+  rq->nrunnable++;
+}
+
+// Unlink p from rq.
+static void
+rqremove(struct runq *rq, struct proc *p)
+{
+  int lvl = rqlevel(p);
+
+  if(p->rqprev)
+    p->rqprev->rqnext = p->rqnext;
+  else
+    rq->head[lvl] = p->rqnext;
+  if(p->rqnext)
+    p->rqnext->rqprev = p->rqprev;
+  else
+    rq->tail[lvl] = p->rqprev;
+  if(rq->head[lvl] == 0)
+    rq->bitmap &= ~(1 << lvl);
+  p->rqnext = p->rqprev = 0;
+  rq->nrunnable--;
+}
+
+// Remove and return the first process of the highest
+// non-empty level, or 0 if rq is empty.
+static struct proc*
+rqpop(struct runq *rq)
+{
+  struct proc *p;
+
+  if(rq->bitmap == 0)
+    return 0;
+  p = rq->head[__builtin_ctz(rq->bitmap)];
+  rqremove(rq, p);
+  return p;
+}
+
+#endif
+
+#ifdef PRIORITY_SCHED
+// EXTRA CREDIT: aging. Each level is FIFO in agestart order, so
+// only the heads need checking: promote any that have waited
+// AGING_INTERVAL passes to the tail of the next level up.
+static void
+rqage(struct runq *rq)
+{
+  struct proc *p;
+  int lvl;
+
+  rq->passes++;
+  for(lvl = 1; lvl < NPRIO; lvl++){
+    while((p = rq->head[lvl]) != 0 &&
+          rq->passes - p->agestart >= AGING_INTERVAL){
+      rqremove(rq, p);
+      p->eff_priority--;          // smaller number = higher priority
+      p->agestart = rq->passes;
+      p->nboost++;
+      rqpush(rq, p);
+    }
+  }
+}
+#endif
+
+#ifdef MLFQ_SCHED
+// Multilevel feedback queue. eff_priority is the level a process
+// runs at, and each level has its own quantum, longer further down.
+// A process that uses up its quantum at a level moves down one; one
+// that blocks having used less than half of it moves up one, but
+// never above base_priority, which nice sets. Every BOOST_TICKS
+// ticks all processes go back to base_priority, so those that have
+// sunk to the bottom are not starved, and a process whose behaviour
+// has changed is reclassified. Quanta are measured in nanoseconds,
+// so a process that runs briefly between ticks is charged exactly.
+
+#define TICK_NS (1000000000U / HZ)
+
+static const uint mlfqslice[NPRIO] = {
+  1*TICK_NS, 2*TICK_NS, 4*TICK_NS, 8*TICK_NS, 16*TICK_NS
+};
+
+// Add p's time on the CPU since runstart to its quantum use.
+static void
+mlfqcharge(struct proc *p)
+{
+  uint64 now = nsecs();
+
+  p->slice += (uint)(now - p->runstart);
+  p->runstart = now;
+}
+
+// If a boost period has begun since p last saw one, put p back at
+// its top level. Caller holds the lock of the queue p is to go on,
+// and p is not on it.
+static void
+mlfqboost(struct proc *p)
+{
+  uint period = ticks / BOOST_TICKS;
+
+  if(p->boosted == period)
+    return;
+  p->boosted = period;
+  if(p->eff_priority != p->base_priority){
+    p->eff_priority = p->base_priority;
+    p->nboost++;
+  }
+  p->slice = 0;
+}
+
+// Apply a new boost period to the processes waiting on rq.
+static void
+rqboost(struct runq *rq)
+{
+  struct proc *p, *next;
+  uint period = ticks / BOOST_TICKS;
+  int lvl;
+
+  if(rq->boosted == period)
+    return;
+  rq->boosted = period;
+  for(lvl = 0; lvl < NPRIO; lvl++){
+    for(p = rq->head[lvl]; p != 0; p = next){
+      next = p->rqnext;
+      if(p->boosted == period)
+        continue;
+      rqremove(rq, p);
+      mlfqboost(p);
+      rqpush(rq, p);
+    }
+  }
+}
+#endif
+
+// Lock and return the run queue p is on. p->cpu only changes
+// with the old queue's lock held, so recheck it after acquiring.
+static struct runq*
+lockrq(struct proc *p)
+{
+  struct runq *rq;
+
+  for(;;){
+    rq = &runq[p->cpu];
+    acquire(&rq->lock);
+    if(rq == &runq[p->cpu])
+      return rq;
+    release(&rq->lock);
+  }
+}
+
+// rq has gained work. If its CPU is idle, wake it; if rq has
+// more than its CPU can get to soon, wake an idle CPU to steal
+// some. Caller holds rq->lock.
+static void
+kick(struct runq *rq)
+{
+  struct cpu *c;
+  int i;
+
+  c = &cpus[rq - runq];
+  if(c->idle){
+    if(c != mycpu())
+      lapicipi(c->apicid, T_IRQ0 + IRQ_WAKEUP);
+    return;
+  }
+  if(rq->nrunnable < 2)
+    return;
+  for(i = 0; i < ncpu; i++){
+    if(cpus[i].idle && &cpus[i] != mycpu()){
+      lapicipi(cpus[i].apicid, T_IRQ0 + IRQ_WAKEUP);
+      return;
+    }
+  }
+}
+
+// Make p RUNNABLE and queue it. Caller holds runq[p->cpu].lock.
+static void
+setrunnable(struct runq *rq, struct proc *p)
+{
+  p->state = RUNNABLE;
+  p->readyat = ticks;
+#ifdef PRIORITY_SCHED
+  p->agestart = rq->passes;       // start aging from zero
+#elif defined(MLFQ_SCHED)
+  mlfqboost(p);
+#elif defined(VTIME_SCHED)
+  if(p->vruntime + SLICE_NS < rq->minvrun)
+    p->vruntime = rq->minvrun - SLICE_NS;
+#endif
+  rqpush(rq, p);
+  kick(rq);
+}
+
+// Pick a run queue for a new process: the one with the
+// fewest runnable processes. Racy, but only a hint.
+static int
+leastloaded(void)
+{
+  int i, best;
+
+  best = 0;
+  for(i = 1; i < ncpu; i++)
+    if(runq[i].nrunnable < runq[best].nrunnable)
+      best = i;
+  return best;
+}
+
+// A process that ran within the last MIGRATE_COST ticks is
+// cache-hot on its CPU and is not stolen. Keeping this at one
+// tick bounds how long an idle CPU can leave work queued elsewhere.
+#define MIGRATE_COST 1
+
+// Called by an idle CPU: move RUNNABLE processes from the busiest
+// other run queue onto rq, up to half of that queue's backlog.
+// Levels are scanned highest priority first; cache-hot processes
+// are left where they are.
+static void
+steal(struct runq *rq)
+{
+  struct runq *src, *first, *second;
+  struct proc *p;
+  int i, n, moved;
+#ifndef VTIME_SCHED
+  struct proc *next;
+  int lvl;
+#endif
+
+  src = 0;
+  for(i = 0; i < ncpu; i++)
+    if(&runq[i] != rq && runq[i].nrunnable > 0 &&
+       (src == 0 || runq[i].nrunnable > src->nrunnable))
+      src = &runq[i];
+  if(src == 0)
+    return;
+
+  // Lock in array order to avoid deadlock with a concurrent steal.
+  first = src < rq ? src : rq;
+  second = src < rq ? rq : src;
+  acquire(&first->lock);
+  acquire(&second->lock);
+
+  moved = 0;
+  n = (src->nrunnable + 1) / 2;
+#ifdef VTIME_SCHED
+  // Take from the bottom of the heap, the processes due to run
+  // last, keeping their place relative to the queue's minvrun.
+  for(i = src->nrunnable - 1; i >= 0 && moved < n; i--){
+    if(i >= src->nrunnable)
+      continue;
+    p = src->heap[i];
+    if(ticks - p->lastrun < MIGRATE_COST)
+      continue;
+    rqremove(src, p);
+    p->cpu = rq - runq;
+    p->vruntime = rq->minvrun +
+      (p->vruntime > src->minvrun ? p->vruntime - src->minvrun : 0);
+    rqpush(rq, p);
+    moved++;
+  }
+#else
+  for(lvl = 0; lvl < NPRIO && moved < n; lvl++){
+    for(p = src->head[lvl]; p != 0 && moved < n; p = next){
+      next = p->rqnext;
+      if(ticks - p->lastrun < MIGRATE_COST)
+        continue;
+      rqremove(src, p);
+      p->cpu = rq - runq;
+      p->agestart = rq->passes;
+      rqpush(rq, p);
+      moved++;
+    }
+  }
+#endif
+  if(moved > 0){
+    rq->nsteals++;
+    rq->nmigrations += moved;
+  }
+
+  release(&second->lock);
+  release(&first->lock);
+}
+
+// How long an idle CPU may halt: not past the next timed
+// wakeup, and only briefly if there is work it could steal.
+static uint
+idlefor(void)
+{
+  int i;
+
+  for(i = 0; i < ncpu; i++)
+    if(runq[i].nrunnable > 0)
+      return MIGRATE_COST;
+  return idleticks();
+}
+
+// Hash p by its pid. Caller holds ptable.lock.
+static void
+pidhash(struct proc *p)
+{
+  struct proc **pp = &ptable.pidhash[PIDHASH(p->pid)];
+
+  p->pidnext = *pp;
+  *pp = p;
+}
+
+// Take p out of the pid hash and give its slot back.
+// Caller holds ptable.lock.
+static void
+pidunhash(struct proc *p)
+{
+  struct proc **pp;
+
+  for(pp = &ptable.pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+    ;
+  *pp = p->pidnext;
+  p->pid = 0;
+  p->state = UNUSED;
+}
+
+// Return the process with the given pid, or 0.
+// Caller holds ptable.lock.
+static struct proc*
+findproc(int pid)
+{
+  struct proc *p;
+
+  for(p = ptable.pidhash[PIDHASH(pid)]; p; p = p->pidnext)
+    if(p->pid == pid)
+      return p;
+  return 0;
+}
+
+// Add p to the front of the child list *head.
+// Caller holds ptable.lock.
+static void
+childlink(struct proc **head, struct proc *p)
+{
+  p->sibling = *head;
+  if(*head)
+    (*head)->psibling = &p->sibling;
+  p->psibling = head;
+  *head = p;
+}
+
+// Take p off the child list it is on. Caller holds ptable.lock.
+static void
+childunlink(struct proc *p)
+{
+  *p->psibling = p->sibling;
+  if(p->sibling)
+    p->sibling->psibling = p->psibling;
+}
+
 //PAGEBREAK: 32
 static struct proc*
 allocproc(void)
@@ -85,11 +656,14 @@ allocproc(void)
 found:
   p->state = EMBRYO;
   p->pid = nextpid++;
+  pidhash(p);
   release(&ptable.lock);
 
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
-    p->state = UNUSED;
+    acquire(&ptable.lock);
+    pidunhash(p);
+    release(&ptable.lock);
     return 0;
   }
   sp = p->kstack + KSTACKSIZE;
@@ -112,7 +686,19 @@ found:
   p->nice          = 2;
   p->base_priority = 2;
   p->eff_priority  = 2;
-  p->wait_ticks    = 0;   // EXTRA CREDIT: aging counter
+  p->agestart      = 0;   // EXTRA CREDIT: aging clock
+  p->slice         = 0;
+  p->boosted       = -1;
+  p->vruntime      = 0;
+  p->tickets       = DEFTICKETS;
+  p->borrowed      = 0;
+  p->lendto        = 0;
+  p->lendpid       = 0;
+  p->lending       = 0;
+
+  p->tprev = 0;
+  p->runticks = p->waitticks = p->maxwait = 0;
+  p->nswitch = p->nboost = 0;
 
   return p;
 }
@@ -122,6 +708,7 @@ void
 userinit(void)
 {
   struct proc *p;
+  struct runq *rq;
   extern char _binary_initcode_start[], _binary_initcode_size[];
 
   p = allocproc();
@@ -143,9 +730,33 @@ userinit(void)
   safestrcpy(p->name, "initcode", sizeof(p->name));
   p->cwd = namei("/");
 
-  acquire(&ptable.lock);
-  p->state = RUNNABLE;
-  release(&ptable.lock);
+  p->cpu = cpuid();
+  rq = lockrq(p);
+  setrunnable(rq, p);
+  release(&rq->lock);
+}
+
+// Start a kernel thread running fn, which must not return.
+// It has no user memory, just the kernel mappings.
+void
+kthread(char *name, void (*fn)(void))
+{
+  struct proc *p;
+  struct runq *rq;
+
+  if((p = allocproc()) == 0 || (p->pgdir = setupkvm()) == 0)
+    panic("kthread");
+
+  // forkret returns to fn rather than trapret.
+  *(uint*)(p->context + 1) = (uint)fn;
+
+  safestrcpy(p->name, name, sizeof(p->name));
+  p->parent = 0;
+
+  p->cpu = cpuid();
+  rq = lockrq(p);
+  setrunnable(rq, p);
+  release(&rq->lock);
 }
 
 int
@@ -156,8 +767,14 @@ growproc(int n)
 
   sz = curproc->sz;
   if(n > 0){
-    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    // Only reserve the address space; lazyfault() allocates
+    // the pages on first touch. Refuse requests that could
+    // not be backed right now, so malloc() still sees
+    // running out of memory as an sbrk() failure.
+    if(sz + n < sz || sz + n >= KERNBASE ||
+       PGROUNDUP(sz + n) - PGROUNDUP(sz) > (uint)kfreecount()*PGSIZE)
       return -1;
+    sz += n;
   } else if(n < 0){
     if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
       return -1;
@@ -172,6 +789,7 @@ fork(void)
 {
   int i, pid;
   struct proc *np;
+  struct runq *rq;
   struct proc *curproc = myproc();
 
   if((np = allocproc()) == 0)
@@ -180,11 +798,12 @@ fork(void)
   if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
     kfree(np->kstack);
     np->kstack = 0;
-    np->state = UNUSED;
+    acquire(&ptable.lock);
+    pidunhash(np);
+    release(&ptable.lock);
     return -1;
   }
   np->sz = curproc->sz;
-  np->parent = curproc;
   *np->tf = *curproc->tf;
   np->tf->eax = 0;
 
@@ -199,14 +818,20 @@ fork(void)
   np->nice          = curproc->nice;
   np->base_priority = curproc->base_priority;
   np->eff_priority  = curproc->eff_priority;
-  np->wait_ticks    = 0;
+  np->tickets       = curproc->tickets;
 
   pid = np->pid;
 
   acquire(&ptable.lock);
-  np->state = RUNNABLE;
+  np->parent = curproc;
+  childlink(&curproc->children, np);
   release(&ptable.lock);
 
+  np->cpu = leastloaded();
+  rq = lockrq(np);
+  setrunnable(rq, np);
+  release(&rq->lock);
+
   return pid;
 }
 
@@ -236,15 +861,25 @@ exit(void)
 
   wakeup1(curproc->parent);
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->parent == curproc){
-      p->parent = initproc;
-      if(p->state == ZOMBIE)
-        wakeup1(initproc);
-    }
+  // Pass abandoned children to init.
+  while((p = curproc->children) != 0){
+    childunlink(p);
+    p->parent = initproc;
+    childlink(&initproc->children, p);
+  }
+  if(curproc->zombies)
+    wakeup1(initproc);
+  while((p = curproc->zombies) != 0){
+    childunlink(p);
+    p->parent = initproc;
+    childlink(&initproc->zombies, p);
   }
 
   curproc->state = ZOMBIE;
+  childunlink(curproc);
+  childlink(&curproc->parent->zombies, curproc);
+  lockrq(curproc);
+  release(&ptable.lock);
   sched();
   panic("zombie exit");
 }
@@ -253,38 +888,37 @@ int
 wait(void)
 {
   struct proc *p;
-  int havekids, pid;
+  int pid;
   struct proc *curproc = myproc();
 
   acquire(&ptable.lock);
   for(;;){
-    havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != curproc)
-        continue;
-      havekids = 1;
-      if(p->state == ZOMBIE){
-        pid = p->pid;
-        kfree(p->kstack);
-        p->kstack = 0;
-        freevm(p->pgdir);
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-
-        // Reset HW3/aging fields before reusing entry
-        p->nice = 2;
-        p->base_priority = 2;
-        p->eff_priority = 2;
-        p->wait_ticks = 0;
-
-        p->state = UNUSED;
-        release(&ptable.lock);
-        return pid;
-      }
+    if((p = curproc->zombies) != 0){
+      // exit() holds its run queue lock until the scheduler
+      // is off p's stack; wait for that before freeing it.
+      acquire(&runq[p->cpu].lock);
+      release(&runq[p->cpu].lock);
+
+      childunlink(p);
+      pid = p->pid;
+      kfree(p->kstack);
+      p->kstack = 0;
+      freevm(p->pgdir);
+      p->parent = 0;
+      p->name[0] = 0;
+      p->killed = 0;
+
+      // Reset HW3/aging fields before reusing entry
+      p->nice = 2;
+      p->base_priority = 2;
+      p->eff_priority = 2;
+      p->agestart = 0;
+
+      pidunhash(p);
+      release(&ptable.lock);
+      return pid;
     }
-    if(!havekids || curproc->killed){
+    if(curproc->children == 0 || curproc->killed){
       release(&ptable.lock);
       return -1;
     }
@@ -293,63 +927,48 @@ wait(void)
 }
 
 //PAGEBREAK: 42
+// Per-CPU process scheduler.
+// Each CPU calls scheduler() after setting itself up.
+// Scheduler never returns.  It loops, doing:
+//  - take the highest-priority process off this CPU's run queue
+//  - swtch to start running that process
+//  - eventually that process transfers control
+//      via swtch back to the scheduler, with the
+//      run queue lock held.
 void
 scheduler(void)
 {
   struct proc *p;
   struct cpu *c = mycpu();
+  struct runq *rq = &runq[c - cpus];
+  uint w;
   c->proc = 0;
 
   for(;;){
     sti();
 
-    acquire(&ptable.lock);
+    // Nothing to do here: try to take work from a busier CPU.
+    if(rq->nrunnable == 0)
+      steal(rq);
 
+    // Interrupts off, so that they stay off through the
+    // lock's release until we halt below.
+    cli();
+    acquire(&rq->lock);
 #ifdef PRIORITY_SCHED
-    // EXTRA CREDIT: age all RUNNABLE procs before selection
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state == RUNNABLE){
-        p->wait_ticks++;
-        if(p->wait_ticks >= AGING_INTERVAL){
-          if(p->eff_priority > 0)        // smaller number = higher priority
-            p->eff_priority--;
-          p->wait_ticks = 0;
-        }
-      }
-    }
-
-    for(;;){
-      struct proc *best = 0;
-
-      for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-        if(p->state != RUNNABLE)
-          continue;
-
-        if(best == 0)
-          best = p;
-        else if(p->eff_priority < best->eff_priority)
-          best = p;
-        else if(p->eff_priority == best->eff_priority && p->pid < best->pid)
-          best = p;
-      }
-
-      if(best == 0)
-        break;
-
-      c->proc = best;
-      switchuvm(best);
-      best->state = RUNNING;
-
-      swtch(&(c->scheduler), best->context);
-      switchkvm();
-
-      // process yielded/slept/exited; c->proc cleared below
-      c->proc = 0;
-    }
-#else
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
-        continue;
+    rqage(rq);
+#elif defined(MLFQ_SCHED)
+    rqboost(rq);
+#endif
+    if((p = rqpop(rq)) != 0){
+      w = ticks - p->readyat;
+      p->waitticks += w;
+      if(w > p->maxwait)
+        p->maxwait = w;
+      p->nswitch++;
+#if defined(VTIME_SCHED) || defined(MLFQ_SCHED)
+      p->runstart = nsecs();
+#endif
 
       c->proc = p;
       switchuvm(p);
@@ -358,21 +977,38 @@ scheduler(void)
       swtch(&(c->scheduler), p->context);
       switchkvm();
 
+      // Process is done running for now.
+      p->lastrun = ticks;
       c->proc = 0;
+      release(&rq->lock);
+      continue;
     }
-#endif
-    release(&ptable.lock);
+
+    // Still nothing to run: halt, with the timer off until the
+    // next timed wakeup. Once idle is set, work queued here
+    // brings an IPI, held pending until stihlt() enables
+    // interrupts (see kick).
+    c->idle = 1;
+    release(&rq->lock);
+    lapictimer(idlefor());
+    stihlt();
+    c->idle = 0;
+    lapictimer(0);
   }
 }
 
+// Enter scheduler.  Must hold only the lock of the run queue
+// p is on and have changed p->state. Saves and restores
+// intena because intena is a property of this
+// kernel thread, not this CPU.
 void
 sched(void)
 {
   int intena;
   struct proc *p = myproc();
 
-  if(!holding(&ptable.lock))
-    panic("sched ptable.lock");
+  if(!holding(&runq[p->cpu].lock))
+    panic("sched runq lock");
   if(mycpu()->ncli != 1)
     panic("sched locks");
   if(p->state == RUNNING)
@@ -384,29 +1020,57 @@ sched(void)
   mycpu()->intena = intena;
 }
 
+// Called on each timer tick on behalf of the running process.
+// Returns whether it should give up the CPU.
+int
+timeslice(void)
+{
+#ifdef MLFQ_SCHED
+  struct proc *p = myproc();
+
+  mlfqcharge(p);
+  if(p->slice >= mlfqslice[p->eff_priority]){
+    // Used its whole quantum: move down a level.
+    if(p->eff_priority < NPRIO-1)
+      p->eff_priority++;
+    p->slice = 0;
+    return 1;
+  }
+  // Keep the CPU unless a higher level has work waiting.
+  return (runq[p->cpu].bitmap & ((1 << p->eff_priority) - 1)) != 0;
+#else
+  return 1;
+#endif
+}
+
 // Give up the CPU for one scheduling round.
 void
 yield(void)
 {
-  acquire(&ptable.lock);
   struct proc *p = myproc();
-  p->state = RUNNABLE;
+  struct runq *rq = lockrq(p);
 
 #ifdef PRIORITY_SCHED
   // EXTRA CREDIT: reset effective prio after service
   p->eff_priority = p->base_priority;
-  p->wait_ticks   = 0;
+#elif defined(MLFQ_SCHED)
+  mlfqcharge(p);
+#elif defined(VTIME_SCHED)
+  vcharge(p);
 #endif
+  setrunnable(rq, p);
 
   sched();
-  release(&ptable.lock);
+  // May have been moved to another CPU's queue meanwhile.
+  release(&runq[p->cpu].lock);
 }
 
 void
 forkret(void)
 {
   static int first = 1;
-  release(&ptable.lock);
+  // Still holding the run queue lock from scheduler.
+  release(&runq[myproc()->cpu].lock);
 
   if (first) {
     first = 0;
@@ -417,6 +1081,7 @@ forkret(void)
 }
 
 // Atomically release lock and sleep on chan.
+// Reacquires lock when awakened.
 void
 sleep(void *chan, struct spinlock *lk)
 {
@@ -425,41 +1090,139 @@ sleep(void *chan, struct spinlock *lk)
   if(p == 0) panic("sleep");
   if(lk == 0) panic("sleep without lk");
 
+  // Must acquire ptable.lock in order to
+  // change p->state and then call sched.
+  // Once we hold ptable.lock, we can be
+  // guaranteed that we won't miss any wakeup
+  // (wakeup runs with ptable.lock locked),
+  // so it's okay to release lk.
   if(lk != &ptable.lock){
     acquire(&ptable.lock);
     release(lk);
   }
   p->chan = chan;
   p->state = SLEEPING;
+  sqinsert(p);
 
 #ifdef PRIORITY_SCHED
   // EXTRA CREDIT: on blocking, clear boost so it starts fresh on wake
   p->eff_priority = p->base_priority;
-  p->wait_ticks   = 0;
+#elif defined(MLFQ_SCHED)
+  // Blocked early: looks interactive, so move up a level.
+  mlfqcharge(p);
+  if(p->slice < mlfqslice[p->eff_priority] / 2){
+    if(p->eff_priority > p->base_priority){
+      p->eff_priority--;
+      p->nboost++;
+    }
+    p->slice = 0;
+  }
+#elif defined(VTIME_SCHED)
+  vcharge(p);
 #endif
+  lend(p);
 
+  // wakeup1() needs our run queue lock too, so it cannot
+  // make us RUNNABLE until sched() is done with our stack.
+  lockrq(p);
+  release(&ptable.lock);
   sched();
+  release(&runq[p->cpu].lock);
 
+  // Reacquire original lock.
+  acquire(lk);
+}
+
+//PAGEBREAK!
+// Put p, which is going to sleep on p->chan, on its sleep queue.
+// Caller holds ptable.lock.
+static void
+sqinsert(struct proc *p)
+{
+  struct proc **pp = &ptable.sleepq[SQHASH(p->chan)];
+
+  p->snext = *pp;
+  if(*pp)
+    (*pp)->sprev = &p->snext;
+  p->sprev = pp;
+  *pp = p;
+}
+
+// Wake p, which is SLEEPING. Caller holds ptable.lock.
+static void
+wake1(struct proc *p)
+{
+  struct runq *rq;
+
+  *p->sprev = p->snext;
+  if(p->snext)
+    p->snext->sprev = p->sprev;
   p->chan = 0;
+  unlend(p);
+  rq = lockrq(p);
+  setrunnable(rq, p);
+  release(&rq->lock);
+}
 
-  if(lk != &ptable.lock){
-    release(&ptable.lock);
-    acquire(lk);
+// p is going to sleep: if it named a server to transfer its
+// tickets to, fund the server with them until p wakes up.
+// Caller holds ptable.lock.
+static void
+lend(struct proc *p)
+{
+#ifdef STRIDE_SCHED
+  struct proc *s = p->lendto;
+
+  if(s == 0)
+    return;
+  if(s->pid != p->lendpid || s->state == ZOMBIE){
+    p->lendto = 0;              // server is gone
+    return;
   }
+  p->lending = p->tickets;
+  s->borrowed += p->lending;
+#endif
+}
+
+// p has woken up: take back what lend() gave away.
+// Caller holds ptable.lock.
+static void
+unlend(struct proc *p)
+{
+#ifdef STRIDE_SCHED
+  if(p->lending == 0)
+    return;
+  if(p->lendto->pid == p->lendpid)
+    p->lendto->borrowed -= p->lending;
+  p->lending = 0;
+#endif
 }
 
 // The ptable lock must be held.
 static void
 wakeup1(void *chan)
 {
-  struct proc *p;
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan){
-      p->state = RUNNABLE;
-#ifdef PRIORITY_SCHED
-      p->wait_ticks = 0;           // start aging from zero
-#endif
-    }
+  struct proc *p, *next;
+
+  for(p = ptable.sleepq[SQHASH(chan)]; p; p = next){
+    next = p->snext;
+    if(p->chan == chan)
+      wake1(p);
+  }
+}
+
+// Wake p if it is sleeping on chan. Returns whether it was.
+int
+wakeproc(struct proc *p, void *chan)
+{
+  int r;
+
+  acquire(&ptable.lock);
+  r = p->state == SLEEPING && p->chan == chan;
+  if(r)
+    wake1(p);
+  release(&ptable.lock);
+  return r;
 }
 
 void
@@ -476,17 +1239,16 @@ kill(int pid)
   struct proc *p;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->pid == pid){
-      p->killed = 1;
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
-      release(&ptable.lock);
-      return 0;
-    }
+  if((p = findproc(pid)) == 0){
+    release(&ptable.lock);
+    return -1;
   }
+  p->killed = 1;
+  // Wake process from sleep if necessary.
+  if(p->state == SLEEPING)
+    wake1(p);
   release(&ptable.lock);
-  return -1;
+  return 0;
 }
 
 //PAGEBREAK: 36
@@ -518,6 +1280,14 @@ procdump(void)
 
 #ifdef PRIORITY_SCHED
     cprintf("  prio=%d(base=%d)", p->eff_priority, p->base_priority);
+#elif defined(MLFQ_SCHED)
+    cprintf("  level=%d(top=%d) used=%dus", p->eff_priority,
+            p->base_priority, p->slice / 1000);
+#elif defined(FAIR_SCHED)
+    cprintf("  nice=%d vrun=%d", p->nice, (uint)(p->vruntime >> 20));
+#elif defined(STRIDE_SCHED)
+    cprintf("  tickets=%d+%d pass=%d", p->tickets, p->borrowed,
+            (uint)(p->vruntime >> 20));
 #endif
 
     if(p->state == SLEEPING){
@@ -527,6 +1297,10 @@ procdump(void)
     }
     cprintf("\n");
   }
+
+  for(i = 0; i < ncpu; i++)
+    cprintf("cpu%d: runnable %d steals %d migrations %d\n", i,
+            runq[i].nrunnable, runq[i].nsteals, runq[i].nmigrations);
 }
 
 /* --------- HW3 helper for nice/priority ---------- */
@@ -538,22 +1312,126 @@ setnice(int pid, int value)
     return -1;
 
   acquire(&ptable.lock);
+  struct proc *p = findproc(pid);
+  if (p != 0) {
+    int old = p->nice;
+    uint readyat = p->readyat;
+    struct runq *rq = lockrq(p);
+
+    // A queued process has to move to its new level.
+    if (p->state == RUNNABLE)
+      rqremove(rq, p);
+    p->nice = value;
+    p->base_priority = value;
+    p->eff_priority  = value;
+#ifdef STRIDE_SCHED
+    p->tickets = niceweight[value];
+#endif
+    if (p->state == RUNNABLE) {
+      setrunnable(rq, p);
+      p->readyat = readyat;    // still the same wait
+    }
+    release(&rq->lock);
+
+    release(&ptable.lock);
+    return old;
+  }
+  release(&ptable.lock);
+  return -1;
+}
+
+// Give process pid n tickets. Returns its previous
+// tickets, or -1 on error or if tickets are not in use
+// (only STRIDE_SCHED schedules by them).
+int
+settickets(int pid, int n)
+{
+#ifdef STRIDE_SCHED
+  struct proc *p;
+  int old;
+
+  if(n < 1 || n > MAXTICKETS)
+    return -1;
+  acquire(&ptable.lock);
+  if((p = findproc(pid)) == 0){
+    release(&ptable.lock);
+    return -1;
+  }
+  // The heap is ordered by pass, which this leaves alone;
+  // only the rate it advances at changes.
+  old = p->tickets;
+  p->tickets = n;
+  release(&ptable.lock);
+  return old;
+#else
+  return -1;
+#endif
+}
+
+// From now on, whenever the current process blocks, lend its
+// tickets to process pid until it wakes: a client waiting on a
+// server for a reply keeps the server running at its own share.
+// pid 0 stops lending. Returns 0, or -1 if there is no such
+// process or tickets are not in use.
+int
+lendtickets(int pid)
+{
+#ifdef STRIDE_SCHED
+  struct proc *curproc = myproc();
   struct proc *p;
-  for (p = ptable.proc; p < &ptable.proc[NPROC]; p++) {
-    if (p->pid == pid && p->state != UNUSED) {
-      int old = p->nice;
 
-      p->nice = value;
-      p->base_priority = value;
-      p->eff_priority  = value;
-#ifdef PRIORITY_SCHED
-      p->wait_ticks    = 0;
+  acquire(&ptable.lock);
+  if(pid == 0){
+    curproc->lendto = 0;
+    release(&ptable.lock);
+    return 0;
+  }
+  if((p = findproc(pid)) == 0 || p == curproc){
+    release(&ptable.lock);
+    return -1;
+  }
+  curproc->lendto = p;
+  curproc->lendpid = pid;
+  release(&ptable.lock);
+  return 0;
+#else
+  return -1;
 #endif
+}
 
+// Copy scheduler statistics for up to n processes out to
+// user address uva. Returns the number copied, or -1.
+int
+getpstat(uint uva, int n)
+{
+  struct proc *p;
+  struct pstat ps;
+  int i;
+
+  i = 0;
+  for(p = ptable.proc; p < &ptable.proc[NPROC] && i < n; p++){
+    acquire(&ptable.lock);
+    if(p->state == UNUSED){
       release(&ptable.lock);
-      return old;
+      continue;
     }
+    ps.pid = p->pid;
+    ps.state = p->state;
+    safestrcpy(ps.name, p->name, sizeof(ps.name));
+    ps.cpu = p->cpu;
+    ps.nice = p->nice;
+    ps.prio = p->eff_priority;
+    ps.runticks = p->runticks;
+    ps.waitticks = p->waitticks;
+    ps.maxwait = p->maxwait;
+    ps.nswitch = p->nswitch;
+    ps.nboost = p->nboost;
+    release(&ptable.lock);
+
+    // copyout() may allocate, so not under ptable.lock.
+    if(copyout(myproc()->pgdir, uva + i*sizeof(ps), &ps, sizeof(ps)) < 0)
+      return -1;
+    i++;
   }
-  release(&ptable.lock);
-  return -1;
+  return i;
 }
@@ -8,6 +8,7 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  volatile int idle;           // Halted in scheduler() for lack of work?
 };
 
 extern struct cpu cpus[NCPU];
@@ -41,9 +42,16 @@ struct proc {
   enum procstate state;        // Process state
   int pid;                     // Process ID
   struct proc *parent;         // Parent process
+  struct proc *children;       // Live children (see proc.c)
+  struct proc *zombies;        // Children that have exited
+  struct proc *sibling;        // Links on the parent's list
+  struct proc **psibling;
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
+  struct proc *snext;          // Sleep queue links (see proc.c)
+  struct proc **sprev;
+  struct proc *pidnext;        // Pid hash chain
   int killed;                  // If non-zero, have been killed
   struct file *ofile[NOFILE];  // Open files
   struct inode *cwd;           // Current directory
@@ -52,7 +60,34 @@ struct proc {
   int nice;
   int base_priority;
   int eff_priority;
-  int wait_ticks;  
+  uint agestart;               // Run queue pass when aging clock started
+  uint slice;                  // MLFQ_SCHED: ns of quantum used at this level
+  uint boosted;                //   boost period last applied
+  uint64 vruntime;             // FAIR_SCHED: weighted ns on a CPU
+  uint64 runstart;             //   nsecs() when last scheduled
+  int heapidx;                 //   index in its run queue's heap
+  int tickets;                 // STRIDE_SCHED: share; vruntime is the pass
+  int borrowed;                //   tickets lent by blocked clients
+  struct proc *lendto;         //   server to lend tickets to while blocked
+  int lendpid;                 //   its pid, in case it has gone
+  int lending;                 //   tickets lent out right now
+
+  int cpu;                     // Run queue this process is on / last ran on
+  uint lastrun;                // ticks when it last left the CPU
+  struct proc *rqnext;         // Run queue links (see proc.c)
+  struct proc *rqprev;
+
+  uint expire;                 // Timer: tick to wake at (see timer.c)
+  void *tchan;                 //   and what it sleeps on until then
+  struct proc *tnext;          //   timer wheel links
+  struct proc **tprev;         //   non-zero while on the wheel
+
+  uint readyat;                // ticks when it last became RUNNABLE
+  uint runticks;               // Scheduler statistics (see pstat.h)
+  uint waitticks;
+  uint maxwait;
+  uint nswitch;
+  uint nboost;
 };
 
 // Process memory is laid out contiguously, low addresses first:
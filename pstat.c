@@ -0,0 +1,70 @@
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "pstat.h"
+
+// Helpers for the scheduler benchmarks, on top of getpstat().
+
+// Fill in *st with the statistics of process pid.
+// Returns 0, or -1 if there is no such process.
+int
+pidstat(int pid, struct pstat *st)
+{
+  static struct pstat *ps;
+  int i, n;
+
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+    return -1;
+  n = getpstat(ps, NPROC);
+  for(i = 0; i < n; i++){
+    if(ps[i].pid == pid){
+      *st = ps[i];
+      return 0;
+    }
+  }
+  return -1;
+}
+
+// Print the CPU share each of n processes got, from its
+// ticks, next to the share its weight promises, and the
+// worst difference. Shares are in tenths of a percent.
+// key[i] is printed in a column headed keyname, and so is
+// extra[i] under extraname unless extra is 0.
+void
+sharetable(char *tag, char *keyname, int *key, char *extraname, int *extra,
+           int n, int *pid, int *weight, uint *ticks)
+{
+  int i, wsum, share, expect, err, maxerr;
+  uint tsum;
+
+  wsum = 0;
+  tsum = 0;
+  for(i = 0; i < n; i++){
+    wsum += weight[i];
+    tsum += ticks[i];
+  }
+  if(tsum == 0)
+    tsum = 1;
+  if(wsum == 0)
+    wsum = 1;
+
+  printf(1, "[%s]  pid %s ", tag, keyname);
+  if(extra)
+    printf(1, "%s ", extraname);
+  printf(1, "ticks  share expected\n");
+  maxerr = 0;
+  for(i = 0; i < n; i++){
+    share = ticks[i] * 1000 / tsum;
+    expect = weight[i] * 1000 / wsum;
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+    if(extra)
+      printf(1, "%d ", extra[i]);
+    printf(1, "%d %d.%d%% %d.%d%%\n", ticks[i], share / 10, share % 10,
+           expect / 10, expect % 10);
+    err = share > expect ? share - expect : expect - share;
+    if(err > maxerr)
+      maxerr = err;
+  }
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+}
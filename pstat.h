@@ -0,0 +1,15 @@
+// Scheduler statistics for one process, as returned by getpstat().
+// Times are in ticks.
+struct pstat {
+  int pid;
+  int state;        // enum procstate, see proc.h
+  char name[16];
+  int cpu;          // CPU it is queued on or last ran on
+  int nice;
+  int prio;         // effective priority
+  uint runticks;    // timer ticks taken while running
+  uint waitticks;   // time spent RUNNABLE, waiting for a CPU
+  uint maxwait;     // longest single wait for a CPU
+  uint nswitch;     // times switched onto a CPU
+  uint nboost;      // times raised a level by aging or MLFQ
+};
@@ -0,0 +1,1691 @@
+
+_readbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+static char buf[CHUNK];
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  int kb = 400;
+  int fd, i, n, total, start, t;
+
+  if (argc > 1) kb = atoi(argv[1]);
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  17:	8b 41 04             	mov    0x4(%ecx),%eax
+  int kb = 400;
+  1a:	c7 45 e0 90 01 00 00 	movl   $0x190,-0x20(%ebp)
+  if (argc > 1) kb = atoi(argv[1]);
+  21:	7e 11                	jle    34 <main+0x34>
+  23:	83 ec 0c             	sub    $0xc,%esp
+  26:	ff 70 04             	push   0x4(%eax)
+  29:	e8 62 03 00 00       	call   390 <atoi>
+  2e:	83 c4 10             	add    $0x10,%esp
+  31:	89 45 e0             	mov    %eax,-0x20(%ebp)
+
+  printf(1, "\n[READBENCH] %d KB file\n", kb);
+  34:	83 ec 04             	sub    $0x4,%esp
+  37:	ff 75 e0             	push   -0x20(%ebp)
+  3a:	68 e0 0b 00 00       	push   $0xbe0
+  3f:	6a 01                	push   $0x1
+  41:	e8 3a 05 00 00       	call   580 <printf>
+
+  fd = open("readbench.tmp", O_CREATE | O_RDWR);
+  46:	5b                   	pop    %ebx
+  47:	5e                   	pop    %esi
+  48:	68 02 02 00 00       	push   $0x202
+  4d:	68 f9 0b 00 00       	push   $0xbf9
+  52:	e8 ec 03 00 00       	call   443 <open>
+  if (fd < 0) {
+  57:	83 c4 10             	add    $0x10,%esp
+  fd = open("readbench.tmp", O_CREATE | O_RDWR);
+  5a:	89 c6                	mov    %eax,%esi
+    printf(2, "readbench: create failed\n");
+    exit();
+  }
+  for (i = 0; i < CHUNK; i++)
+  5c:	31 c0                	xor    %eax,%eax
+  if (fd < 0) {
+  5e:	85 f6                	test   %esi,%esi
+  60:	0f 88 29 01 00 00    	js     18f <main+0x18f>
+  66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6d:	8d 76 00             	lea    0x0(%esi),%esi
+    buf[i] = i;
+  70:	88 80 60 10 00 00    	mov    %al,0x1060(%eax)
+  for (i = 0; i < CHUNK; i++)
+  76:	83 c0 01             	add    $0x1,%eax
+  79:	3d 00 02 00 00       	cmp    $0x200,%eax
+  7e:	75 f0                	jne    70 <main+0x70>
+  total = 0;
+  for (i = 0; i < kb * 1024 / CHUNK; i++) {
+  80:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  83:	8d 14 00             	lea    (%eax,%eax,1),%edx
+  86:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  89:	85 c0                	test   %eax,%eax
+  8b:	0f 8e 11 01 00 00    	jle    1a2 <main+0x1a2>
+  total = 0;
+  91:	31 db                	xor    %ebx,%ebx
+  for (i = 0; i < kb * 1024 / CHUNK; i++) {
+  93:	31 ff                	xor    %edi,%edi
+  95:	eb 19                	jmp    b0 <main+0xb0>
+  97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9e:	66 90                	xchg   %ax,%ax
+  a0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  a3:	83 c7 01             	add    $0x1,%edi
+    if (write(fd, buf, CHUNK) != CHUNK)
+      break;
+    total += CHUNK;
+  a6:	81 c3 00 02 00 00    	add    $0x200,%ebx
+  for (i = 0; i < kb * 1024 / CHUNK; i++) {
+  ac:	39 c7                	cmp    %eax,%edi
+  ae:	7d 1d                	jge    cd <main+0xcd>
+    if (write(fd, buf, CHUNK) != CHUNK)
+  b0:	83 ec 04             	sub    $0x4,%esp
+  b3:	68 00 02 00 00       	push   $0x200
+  b8:	68 60 10 00 00       	push   $0x1060
+  bd:	56                   	push   %esi
+  be:	e8 60 03 00 00       	call   423 <write>
+  c3:	83 c4 10             	add    $0x10,%esp
+  c6:	3d 00 02 00 00       	cmp    $0x200,%eax
+  cb:	74 d3                	je     a0 <main+0xa0>
+  }
+  close(fd);
+  cd:	83 ec 0c             	sub    $0xc,%esp
+  d0:	56                   	push   %esi
+  d1:	e8 55 03 00 00       	call   42b <close>
+  if (total < kb * 1024)
+  d6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  d9:	83 c4 10             	add    $0x10,%esp
+  dc:	c1 e0 0a             	shl    $0xa,%eax
+  df:	39 d8                	cmp    %ebx,%eax
+  e1:	0f 8f 8f 00 00 00    	jg     176 <main+0x176>
+    printf(1, "[READBENCH] file stops at %d KB\n", total / 1024);
+
+  fd = open("readbench.tmp", O_RDONLY);
+  e7:	83 ec 08             	sub    $0x8,%esp
+  ea:	6a 00                	push   $0x0
+  ec:	68 f9 0b 00 00       	push   $0xbf9
+  f1:	e8 4d 03 00 00       	call   443 <open>
+  if (fd < 0) {
+  f6:	83 c4 10             	add    $0x10,%esp
+  fd = open("readbench.tmp", O_RDONLY);
+  f9:	89 c6                	mov    %eax,%esi
+  if (fd < 0) {
+  fb:	85 c0                	test   %eax,%eax
+  fd:	78 64                	js     163 <main+0x163>
+    printf(2, "readbench: open failed\n");
+    exit();
+  }
+  start = uptime();
+  ff:	e8 97 03 00 00       	call   49b <uptime>
+  total = 0;
+ 104:	31 db                	xor    %ebx,%ebx
+  start = uptime();
+ 106:	89 c7                	mov    %eax,%edi
+  while ((n = read(fd, buf, CHUNK)) > 0)
+ 108:	eb 08                	jmp    112 <main+0x112>
+ 10a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    total += n;
+ 110:	01 c3                	add    %eax,%ebx
+  while ((n = read(fd, buf, CHUNK)) > 0)
+ 112:	83 ec 04             	sub    $0x4,%esp
+ 115:	68 00 02 00 00       	push   $0x200
+ 11a:	68 60 10 00 00       	push   $0x1060
+ 11f:	56                   	push   %esi
+ 120:	e8 f6 02 00 00       	call   41b <read>
+ 125:	83 c4 10             	add    $0x10,%esp
+ 128:	85 c0                	test   %eax,%eax
+ 12a:	7f e4                	jg     110 <main+0x110>
+  t = uptime() - start;
+ 12c:	e8 6a 03 00 00       	call   49b <uptime>
+  close(fd);
+ 131:	83 ec 0c             	sub    $0xc,%esp
+  unlink("readbench.tmp");
+
+  printf(1, "[READBENCH] read %d KB in %d ticks\n", total / 1024, t);
+ 134:	c1 fb 0a             	sar    $0xa,%ebx
+  close(fd);
+ 137:	56                   	push   %esi
+  t = uptime() - start;
+ 138:	29 f8                	sub    %edi,%eax
+ 13a:	89 c7                	mov    %eax,%edi
+  close(fd);
+ 13c:	e8 ea 02 00 00       	call   42b <close>
+  unlink("readbench.tmp");
+ 141:	c7 04 24 f9 0b 00 00 	movl   $0xbf9,(%esp)
+ 148:	e8 06 03 00 00       	call   453 <unlink>
+  printf(1, "[READBENCH] read %d KB in %d ticks\n", total / 1024, t);
+ 14d:	57                   	push   %edi
+ 14e:	53                   	push   %ebx
+ 14f:	68 60 0c 00 00       	push   $0xc60
+ 154:	6a 01                	push   $0x1
+ 156:	e8 25 04 00 00       	call   580 <printf>
+  exit();
+ 15b:	83 c4 20             	add    $0x20,%esp
+ 15e:	e8 a0 02 00 00       	call   403 <exit>
+    printf(2, "readbench: open failed\n");
+ 163:	50                   	push   %eax
+ 164:	50                   	push   %eax
+ 165:	68 21 0c 00 00       	push   $0xc21
+ 16a:	6a 02                	push   $0x2
+ 16c:	e8 0f 04 00 00       	call   580 <printf>
+    exit();
+ 171:	e8 8d 02 00 00       	call   403 <exit>
+    printf(1, "[READBENCH] file stops at %d KB\n", total / 1024);
+ 176:	c1 fb 0a             	sar    $0xa,%ebx
+ 179:	52                   	push   %edx
+ 17a:	53                   	push   %ebx
+ 17b:	68 3c 0c 00 00       	push   $0xc3c
+ 180:	6a 01                	push   $0x1
+ 182:	e8 f9 03 00 00       	call   580 <printf>
+ 187:	83 c4 10             	add    $0x10,%esp
+ 18a:	e9 58 ff ff ff       	jmp    e7 <main+0xe7>
+    printf(2, "readbench: create failed\n");
+ 18f:	51                   	push   %ecx
+ 190:	51                   	push   %ecx
+ 191:	68 07 0c 00 00       	push   $0xc07
+ 196:	6a 02                	push   $0x2
+ 198:	e8 e3 03 00 00       	call   580 <printf>
+    exit();
+ 19d:	e8 61 02 00 00       	call   403 <exit>
+  close(fd);
+ 1a2:	83 ec 0c             	sub    $0xc,%esp
+ 1a5:	56                   	push   %esi
+ 1a6:	e8 80 02 00 00       	call   42b <close>
+ 1ab:	83 c4 10             	add    $0x10,%esp
+ 1ae:	e9 34 ff ff ff       	jmp    e7 <main+0xe7>
+ 1b3:	66 90                	xchg   %ax,%ax
+ 1b5:	66 90                	xchg   %ax,%ax
+ 1b7:	66 90                	xchg   %ax,%ax
+ 1b9:	66 90                	xchg   %ax,%ax
+ 1bb:	66 90                	xchg   %ax,%ax
+ 1bd:	66 90                	xchg   %ax,%ax
+ 1bf:	90                   	nop
+
+000001c0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1c0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1c1:	31 c0                	xor    %eax,%eax
+{
+ 1c3:	89 e5                	mov    %esp,%ebp
+ 1c5:	53                   	push   %ebx
+ 1c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 1d0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 1d4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 1d7:	83 c0 01             	add    $0x1,%eax
+ 1da:	84 d2                	test   %dl,%dl
+ 1dc:	75 f2                	jne    1d0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 1de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1e1:	89 c8                	mov    %ecx,%eax
+ 1e3:	c9                   	leave
+ 1e4:	c3                   	ret
+ 1e5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	53                   	push   %ebx
+ 1f4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1fa:	0f b6 02             	movzbl (%edx),%eax
+ 1fd:	84 c0                	test   %al,%al
+ 1ff:	75 17                	jne    218 <strcmp+0x28>
+ 201:	eb 3a                	jmp    23d <strcmp+0x4d>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+ 208:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 20c:	83 c2 01             	add    $0x1,%edx
+ 20f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 212:	84 c0                	test   %al,%al
+ 214:	74 1a                	je     230 <strcmp+0x40>
+    p++, q++;
+ 216:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 218:	0f b6 19             	movzbl (%ecx),%ebx
+ 21b:	38 c3                	cmp    %al,%bl
+ 21d:	74 e9                	je     208 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 21f:	29 d8                	sub    %ebx,%eax
+}
+ 221:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 224:	c9                   	leave
+ 225:	c3                   	ret
+ 226:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 230:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 234:	31 c0                	xor    %eax,%eax
+ 236:	29 d8                	sub    %ebx,%eax
+}
+ 238:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 23b:	c9                   	leave
+ 23c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 23d:	0f b6 19             	movzbl (%ecx),%ebx
+ 240:	31 c0                	xor    %eax,%eax
+ 242:	eb db                	jmp    21f <strcmp+0x2f>
+ 244:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 24f:	90                   	nop
+
+00000250 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 256:	80 3a 00             	cmpb   $0x0,(%edx)
+ 259:	74 15                	je     270 <strlen+0x20>
+ 25b:	31 c0                	xor    %eax,%eax
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+ 260:	83 c0 01             	add    $0x1,%eax
+ 263:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 267:	89 c1                	mov    %eax,%ecx
+ 269:	75 f5                	jne    260 <strlen+0x10>
+    ;
+  return n;
+}
+ 26b:	89 c8                	mov    %ecx,%eax
+ 26d:	5d                   	pop    %ebp
+ 26e:	c3                   	ret
+ 26f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 270:	31 c9                	xor    %ecx,%ecx
+}
+ 272:	5d                   	pop    %ebp
+ 273:	89 c8                	mov    %ecx,%eax
+ 275:	c3                   	ret
+ 276:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000280 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 287:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 28a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 28d:	89 d7                	mov    %edx,%edi
+ 28f:	fc                   	cld
+ 290:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 292:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 295:	89 d0                	mov    %edx,%eax
+ 297:	c9                   	leave
+ 298:	c3                   	ret
+ 299:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2aa:	0f b6 10             	movzbl (%eax),%edx
+ 2ad:	84 d2                	test   %dl,%dl
+ 2af:	75 12                	jne    2c3 <strchr+0x23>
+ 2b1:	eb 1d                	jmp    2d0 <strchr+0x30>
+ 2b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2b7:	90                   	nop
+ 2b8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2bc:	83 c0 01             	add    $0x1,%eax
+ 2bf:	84 d2                	test   %dl,%dl
+ 2c1:	74 0d                	je     2d0 <strchr+0x30>
+    if(*s == c)
+ 2c3:	38 d1                	cmp    %dl,%cl
+ 2c5:	75 f1                	jne    2b8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2c7:	5d                   	pop    %ebp
+ 2c8:	c3                   	ret
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 2d0:	31 c0                	xor    %eax,%eax
+}
+ 2d2:	5d                   	pop    %ebp
+ 2d3:	c3                   	ret
+ 2d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+
+000002e0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2e5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2e8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2e9:	31 db                	xor    %ebx,%ebx
+{
+ 2eb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2ee:	eb 27                	jmp    317 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2f0:	83 ec 04             	sub    $0x4,%esp
+ 2f3:	6a 01                	push   $0x1
+ 2f5:	56                   	push   %esi
+ 2f6:	6a 00                	push   $0x0
+ 2f8:	e8 1e 01 00 00       	call   41b <read>
+    if(cc < 1)
+ 2fd:	83 c4 10             	add    $0x10,%esp
+ 300:	85 c0                	test   %eax,%eax
+ 302:	7e 1d                	jle    321 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 304:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 308:	8b 55 08             	mov    0x8(%ebp),%edx
+ 30b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 30f:	3c 0a                	cmp    $0xa,%al
+ 311:	74 10                	je     323 <gets+0x43>
+ 313:	3c 0d                	cmp    $0xd,%al
+ 315:	74 0c                	je     323 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 317:	89 df                	mov    %ebx,%edi
+ 319:	83 c3 01             	add    $0x1,%ebx
+ 31c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 31f:	7c cf                	jl     2f0 <gets+0x10>
+ 321:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 323:	8b 45 08             	mov    0x8(%ebp),%eax
+ 326:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 32a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 32d:	5b                   	pop    %ebx
+ 32e:	5e                   	pop    %esi
+ 32f:	5f                   	pop    %edi
+ 330:	5d                   	pop    %ebp
+ 331:	c3                   	ret
+ 332:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 339:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000340 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	56                   	push   %esi
+ 344:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 345:	83 ec 08             	sub    $0x8,%esp
+ 348:	6a 00                	push   $0x0
+ 34a:	ff 75 08             	push   0x8(%ebp)
+ 34d:	e8 f1 00 00 00       	call   443 <open>
+  if(fd < 0)
+ 352:	83 c4 10             	add    $0x10,%esp
+ 355:	85 c0                	test   %eax,%eax
+ 357:	78 27                	js     380 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 359:	83 ec 08             	sub    $0x8,%esp
+ 35c:	ff 75 0c             	push   0xc(%ebp)
+ 35f:	89 c3                	mov    %eax,%ebx
+ 361:	50                   	push   %eax
+ 362:	e8 f4 00 00 00       	call   45b <fstat>
+  close(fd);
+ 367:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 36a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 36c:	e8 ba 00 00 00       	call   42b <close>
+  return r;
+ 371:	83 c4 10             	add    $0x10,%esp
+}
+ 374:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 377:	89 f0                	mov    %esi,%eax
+ 379:	5b                   	pop    %ebx
+ 37a:	5e                   	pop    %esi
+ 37b:	5d                   	pop    %ebp
+ 37c:	c3                   	ret
+ 37d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 380:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 385:	eb ed                	jmp    374 <stat+0x34>
+ 387:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38e:	66 90                	xchg   %ax,%ax
+
+00000390 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	53                   	push   %ebx
+ 394:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 397:	0f be 02             	movsbl (%edx),%eax
+ 39a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 39d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3a5:	77 1e                	ja     3c5 <atoi+0x35>
+ 3a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ae:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3b0:	83 c2 01             	add    $0x1,%edx
+ 3b3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3b6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3ba:	0f be 02             	movsbl (%edx),%eax
+ 3bd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3c0:	80 fb 09             	cmp    $0x9,%bl
+ 3c3:	76 eb                	jbe    3b0 <atoi+0x20>
+  return n;
+}
+ 3c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c8:	89 c8                	mov    %ecx,%eax
+ 3ca:	c9                   	leave
+ 3cb:	c3                   	ret
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	57                   	push   %edi
+ 3d4:	56                   	push   %esi
+ 3d5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3db:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 3de:	85 c0                	test   %eax,%eax
+ 3e0:	7e 13                	jle    3f5 <memmove+0x25>
+ 3e2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3e4:	89 d7                	mov    %edx,%edi
+ 3e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ed:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3f0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3f1:	39 f8                	cmp    %edi,%eax
+ 3f3:	75 fb                	jne    3f0 <memmove+0x20>
+  return vdst;
+}
+ 3f5:	5e                   	pop    %esi
+ 3f6:	89 d0                	mov    %edx,%eax
+ 3f8:	5f                   	pop    %edi
+ 3f9:	5d                   	pop    %ebp
+ 3fa:	c3                   	ret
+
+000003fb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 3fb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 400:	cd 40                	int    $0x40
+ 402:	c3                   	ret
+
+00000403 <exit>:
+SYSCALL(exit)
+ 403:	b8 02 00 00 00       	mov    $0x2,%eax
+ 408:	cd 40                	int    $0x40
+ 40a:	c3                   	ret
+
+0000040b <wait>:
+SYSCALL(wait)
+ 40b:	b8 03 00 00 00       	mov    $0x3,%eax
+ 410:	cd 40                	int    $0x40
+ 412:	c3                   	ret
+
+00000413 <pipe>:
+SYSCALL(pipe)
+ 413:	b8 04 00 00 00       	mov    $0x4,%eax
+ 418:	cd 40                	int    $0x40
+ 41a:	c3                   	ret
+
+0000041b <read>:
+SYSCALL(read)
+ 41b:	b8 05 00 00 00       	mov    $0x5,%eax
+ 420:	cd 40                	int    $0x40
+ 422:	c3                   	ret
+
+00000423 <write>:
+SYSCALL(write)
+ 423:	b8 10 00 00 00       	mov    $0x10,%eax
+ 428:	cd 40                	int    $0x40
+ 42a:	c3                   	ret
+
+0000042b <close>:
+SYSCALL(close)
+ 42b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 430:	cd 40                	int    $0x40
+ 432:	c3                   	ret
+
+00000433 <kill>:
+SYSCALL(kill)
+ 433:	b8 06 00 00 00       	mov    $0x6,%eax
+ 438:	cd 40                	int    $0x40
+ 43a:	c3                   	ret
+
+0000043b <exec>:
+SYSCALL(exec)
+ 43b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 440:	cd 40                	int    $0x40
+ 442:	c3                   	ret
+
+00000443 <open>:
+SYSCALL(open)
+ 443:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 448:	cd 40                	int    $0x40
+ 44a:	c3                   	ret
+
+0000044b <mknod>:
+SYSCALL(mknod)
+ 44b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 450:	cd 40                	int    $0x40
+ 452:	c3                   	ret
+
+00000453 <unlink>:
+SYSCALL(unlink)
+ 453:	b8 12 00 00 00       	mov    $0x12,%eax
+ 458:	cd 40                	int    $0x40
+ 45a:	c3                   	ret
+
+0000045b <fstat>:
+SYSCALL(fstat)
+ 45b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 460:	cd 40                	int    $0x40
+ 462:	c3                   	ret
+
+00000463 <link>:
+SYSCALL(link)
+ 463:	b8 13 00 00 00       	mov    $0x13,%eax
+ 468:	cd 40                	int    $0x40
+ 46a:	c3                   	ret
+
+0000046b <mkdir>:
+SYSCALL(mkdir)
+ 46b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 470:	cd 40                	int    $0x40
+ 472:	c3                   	ret
+
+00000473 <chdir>:
+SYSCALL(chdir)
+ 473:	b8 09 00 00 00       	mov    $0x9,%eax
+ 478:	cd 40                	int    $0x40
+ 47a:	c3                   	ret
+
+0000047b <dup>:
+SYSCALL(dup)
+ 47b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 480:	cd 40                	int    $0x40
+ 482:	c3                   	ret
+
+00000483 <getpid>:
+SYSCALL(getpid)
+ 483:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 488:	cd 40                	int    $0x40
+ 48a:	c3                   	ret
+
+0000048b <sbrk>:
+SYSCALL(sbrk)
+ 48b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 490:	cd 40                	int    $0x40
+ 492:	c3                   	ret
+
+00000493 <sleep>:
+SYSCALL(sleep)
+ 493:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 498:	cd 40                	int    $0x40
+ 49a:	c3                   	ret
+
+0000049b <uptime>:
+SYSCALL(uptime)
+ 49b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4a0:	cd 40                	int    $0x40
+ 4a2:	c3                   	ret
+
+000004a3 <nice>:
+SYSCALL(nice)
+ 4a3:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4a8:	cd 40                	int    $0x40
+ 4aa:	c3                   	ret
+
+000004ab <fsync>:
+SYSCALL(fsync)
+ 4ab:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4b0:	cd 40                	int    $0x40
+ 4b2:	c3                   	ret
+
+000004b3 <getpstat>:
+SYSCALL(getpstat)
+ 4b3:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4b8:	cd 40                	int    $0x40
+ 4ba:	c3                   	ret
+
+000004bb <pipesize>:
+SYSCALL(pipesize)
+ 4bb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4c0:	cd 40                	int    $0x40
+ 4c2:	c3                   	ret
+
+000004c3 <uptimens>:
+SYSCALL(uptimens)
+ 4c3:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4c8:	cd 40                	int    $0x40
+ 4ca:	c3                   	ret
+
+000004cb <settickets>:
+SYSCALL(settickets)
+ 4cb:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4d0:	cd 40                	int    $0x40
+ 4d2:	c3                   	ret
+
+000004d3 <transfer>:
+SYSCALL(transfer)
+ 4d3:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4d8:	cd 40                	int    $0x40
+ 4da:	c3                   	ret
+ 4db:	66 90                	xchg   %ax,%ax
+ 4dd:	66 90                	xchg   %ax,%ax
+ 4df:	90                   	nop
+
+000004e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	57                   	push   %edi
+ 4e4:	56                   	push   %esi
+ 4e5:	53                   	push   %ebx
+ 4e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 4e8:	89 d1                	mov    %edx,%ecx
+{
+ 4ea:	83 ec 3c             	sub    $0x3c,%esp
+ 4ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 4f0:	85 d2                	test   %edx,%edx
+ 4f2:	0f 89 80 00 00 00    	jns    578 <printint+0x98>
+ 4f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 4fc:	74 7a                	je     578 <printint+0x98>
+    x = -xx;
+ 4fe:	f7 d9                	neg    %ecx
+    neg = 1;
+ 500:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 505:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 508:	31 f6                	xor    %esi,%esi
+ 50a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 510:	89 c8                	mov    %ecx,%eax
+ 512:	31 d2                	xor    %edx,%edx
+ 514:	89 f7                	mov    %esi,%edi
+ 516:	f7 f3                	div    %ebx
+ 518:	8d 76 01             	lea    0x1(%esi),%esi
+ 51b:	0f b6 92 e4 0c 00 00 	movzbl 0xce4(%edx),%edx
+ 522:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 526:	89 ca                	mov    %ecx,%edx
+ 528:	89 c1                	mov    %eax,%ecx
+ 52a:	39 da                	cmp    %ebx,%edx
+ 52c:	73 e2                	jae    510 <printint+0x30>
+  if(neg)
+ 52e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 531:	85 c0                	test   %eax,%eax
+ 533:	74 07                	je     53c <printint+0x5c>
+    buf[i++] = '-';
+ 535:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 53a:	89 f7                	mov    %esi,%edi
+ 53c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 53f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 542:	01 df                	add    %ebx,%edi
+ 544:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 548:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 54b:	83 ec 04             	sub    $0x4,%esp
+ 54e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 551:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 554:	6a 01                	push   $0x1
+ 556:	50                   	push   %eax
+ 557:	56                   	push   %esi
+ 558:	e8 c6 fe ff ff       	call   423 <write>
+  while(--i >= 0)
+ 55d:	89 f8                	mov    %edi,%eax
+ 55f:	83 c4 10             	add    $0x10,%esp
+ 562:	83 ef 01             	sub    $0x1,%edi
+ 565:	39 d8                	cmp    %ebx,%eax
+ 567:	75 df                	jne    548 <printint+0x68>
+}
+ 569:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 56c:	5b                   	pop    %ebx
+ 56d:	5e                   	pop    %esi
+ 56e:	5f                   	pop    %edi
+ 56f:	5d                   	pop    %ebp
+ 570:	c3                   	ret
+ 571:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 578:	31 c0                	xor    %eax,%eax
+ 57a:	eb 89                	jmp    505 <printint+0x25>
+ 57c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000580 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+ 583:	57                   	push   %edi
+ 584:	56                   	push   %esi
+ 585:	53                   	push   %ebx
+ 586:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 589:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 58c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 58f:	0f b6 1e             	movzbl (%esi),%ebx
+ 592:	83 c6 01             	add    $0x1,%esi
+ 595:	84 db                	test   %bl,%bl
+ 597:	74 67                	je     600 <printf+0x80>
+ 599:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 59c:	31 d2                	xor    %edx,%edx
+ 59e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 5a1:	eb 34                	jmp    5d7 <printf+0x57>
+ 5a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5a7:	90                   	nop
+ 5a8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 5ab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 5b0:	83 f8 25             	cmp    $0x25,%eax
+ 5b3:	74 18                	je     5cd <printf+0x4d>
+  write(fd, &c, 1);
+ 5b5:	83 ec 04             	sub    $0x4,%esp
+ 5b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 5bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 5be:	6a 01                	push   $0x1
+ 5c0:	50                   	push   %eax
+ 5c1:	57                   	push   %edi
+ 5c2:	e8 5c fe ff ff       	call   423 <write>
+ 5c7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 5ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 5cd:	0f b6 1e             	movzbl (%esi),%ebx
+ 5d0:	83 c6 01             	add    $0x1,%esi
+ 5d3:	84 db                	test   %bl,%bl
+ 5d5:	74 29                	je     600 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 5d7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 5da:	85 d2                	test   %edx,%edx
+ 5dc:	74 ca                	je     5a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 5de:	83 fa 25             	cmp    $0x25,%edx
+ 5e1:	75 ea                	jne    5cd <printf+0x4d>
+      if(c == 'd'){
+ 5e3:	83 f8 25             	cmp    $0x25,%eax
+ 5e6:	0f 84 24 01 00 00    	je     710 <printf+0x190>
+ 5ec:	83 e8 63             	sub    $0x63,%eax
+ 5ef:	83 f8 15             	cmp    $0x15,%eax
+ 5f2:	77 1c                	ja     610 <printf+0x90>
+ 5f4:	ff 24 85 8c 0c 00 00 	jmp    *0xc8c(,%eax,4)
+ 5fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 600:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 603:	5b                   	pop    %ebx
+ 604:	5e                   	pop    %esi
+ 605:	5f                   	pop    %edi
+ 606:	5d                   	pop    %ebp
+ 607:	c3                   	ret
+ 608:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60f:	90                   	nop
+  write(fd, &c, 1);
+ 610:	83 ec 04             	sub    $0x4,%esp
+ 613:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 616:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 61a:	6a 01                	push   $0x1
+ 61c:	52                   	push   %edx
+ 61d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 620:	57                   	push   %edi
+ 621:	e8 fd fd ff ff       	call   423 <write>
+ 626:	83 c4 0c             	add    $0xc,%esp
+ 629:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 62c:	6a 01                	push   $0x1
+ 62e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 631:	52                   	push   %edx
+ 632:	57                   	push   %edi
+ 633:	e8 eb fd ff ff       	call   423 <write>
+        putc(fd, c);
+ 638:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 63b:	31 d2                	xor    %edx,%edx
+ 63d:	eb 8e                	jmp    5cd <printf+0x4d>
+ 63f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 640:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 643:	83 ec 0c             	sub    $0xc,%esp
+ 646:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 64b:	8b 13                	mov    (%ebx),%edx
+ 64d:	6a 00                	push   $0x0
+ 64f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 651:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 654:	e8 87 fe ff ff       	call   4e0 <printint>
+        ap++;
+ 659:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 65c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 65f:	31 d2                	xor    %edx,%edx
+ 661:	e9 67 ff ff ff       	jmp    5cd <printf+0x4d>
+ 666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 670:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 673:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 675:	83 c0 04             	add    $0x4,%eax
+ 678:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 67b:	85 db                	test   %ebx,%ebx
+ 67d:	0f 84 9d 00 00 00    	je     720 <printf+0x1a0>
+        while(*s != 0){
+ 683:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 686:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 688:	84 c0                	test   %al,%al
+ 68a:	0f 84 3d ff ff ff    	je     5cd <printf+0x4d>
+ 690:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 693:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 696:	89 de                	mov    %ebx,%esi
+ 698:	89 d3                	mov    %edx,%ebx
+ 69a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 6a0:	83 ec 04             	sub    $0x4,%esp
+ 6a3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 6a6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 6a9:	6a 01                	push   $0x1
+ 6ab:	53                   	push   %ebx
+ 6ac:	57                   	push   %edi
+ 6ad:	e8 71 fd ff ff       	call   423 <write>
+        while(*s != 0){
+ 6b2:	0f b6 06             	movzbl (%esi),%eax
+ 6b5:	83 c4 10             	add    $0x10,%esp
+ 6b8:	84 c0                	test   %al,%al
+ 6ba:	75 e4                	jne    6a0 <printf+0x120>
+      state = 0;
+ 6bc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 6bf:	31 d2                	xor    %edx,%edx
+ 6c1:	e9 07 ff ff ff       	jmp    5cd <printf+0x4d>
+ 6c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6cd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 6d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6d3:	83 ec 0c             	sub    $0xc,%esp
+ 6d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 6db:	8b 13                	mov    (%ebx),%edx
+ 6dd:	6a 01                	push   $0x1
+ 6df:	e9 6b ff ff ff       	jmp    64f <printf+0xcf>
+ 6e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 6e8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 6eb:	83 ec 04             	sub    $0x4,%esp
+ 6ee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 6f1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 6f3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 6f6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 6f9:	6a 01                	push   $0x1
+ 6fb:	52                   	push   %edx
+ 6fc:	57                   	push   %edi
+ 6fd:	e8 21 fd ff ff       	call   423 <write>
+        ap++;
+ 702:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 705:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 708:	31 d2                	xor    %edx,%edx
+ 70a:	e9 be fe ff ff       	jmp    5cd <printf+0x4d>
+ 70f:	90                   	nop
+  write(fd, &c, 1);
+ 710:	83 ec 04             	sub    $0x4,%esp
+ 713:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 716:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 719:	6a 01                	push   $0x1
+ 71b:	e9 11 ff ff ff       	jmp    631 <printf+0xb1>
+ 720:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 725:	bb 84 0c 00 00       	mov    $0xc84,%ebx
+ 72a:	e9 61 ff ff ff       	jmp    690 <printf+0x110>
+ 72f:	90                   	nop
+
+00000730 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 730:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 731:	a1 60 12 00 00       	mov    0x1260,%eax
+{
+ 736:	89 e5                	mov    %esp,%ebp
+ 738:	57                   	push   %edi
+ 739:	56                   	push   %esi
+ 73a:	53                   	push   %ebx
+ 73b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 73e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 741:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 748:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 74a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 74c:	39 ca                	cmp    %ecx,%edx
+ 74e:	73 30                	jae    780 <free+0x50>
+ 750:	39 c1                	cmp    %eax,%ecx
+ 752:	72 04                	jb     758 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 754:	39 c2                	cmp    %eax,%edx
+ 756:	72 f0                	jb     748 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 758:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 75b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 75e:	39 f8                	cmp    %edi,%eax
+ 760:	74 2e                	je     790 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 762:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 765:	8b 42 04             	mov    0x4(%edx),%eax
+ 768:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 76b:	39 f1                	cmp    %esi,%ecx
+ 76d:	74 38                	je     7a7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 76f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 771:	5b                   	pop    %ebx
+  freep = p;
+ 772:	89 15 60 12 00 00    	mov    %edx,0x1260
+}
+ 778:	5e                   	pop    %esi
+ 779:	5f                   	pop    %edi
+ 77a:	5d                   	pop    %ebp
+ 77b:	c3                   	ret
+ 77c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 780:	39 c1                	cmp    %eax,%ecx
+ 782:	72 d0                	jb     754 <free+0x24>
+ 784:	eb c2                	jmp    748 <free+0x18>
+ 786:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 78d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 790:	03 70 04             	add    0x4(%eax),%esi
+ 793:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 796:	8b 02                	mov    (%edx),%eax
+ 798:	8b 00                	mov    (%eax),%eax
+ 79a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 79d:	8b 42 04             	mov    0x4(%edx),%eax
+ 7a0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 7a3:	39 f1                	cmp    %esi,%ecx
+ 7a5:	75 c8                	jne    76f <free+0x3f>
+    p->s.size += bp->s.size;
+ 7a7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 7aa:	89 15 60 12 00 00    	mov    %edx,0x1260
+    p->s.size += bp->s.size;
+ 7b0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 7b3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 7b6:	89 0a                	mov    %ecx,(%edx)
+}
+ 7b8:	5b                   	pop    %ebx
+ 7b9:	5e                   	pop    %esi
+ 7ba:	5f                   	pop    %edi
+ 7bb:	5d                   	pop    %ebp
+ 7bc:	c3                   	ret
+ 7bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000007c0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 7c0:	55                   	push   %ebp
+ 7c1:	89 e5                	mov    %esp,%ebp
+ 7c3:	57                   	push   %edi
+ 7c4:	56                   	push   %esi
+ 7c5:	53                   	push   %ebx
+ 7c6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 7cc:	8b 15 60 12 00 00    	mov    0x1260,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 7d2:	8d 78 07             	lea    0x7(%eax),%edi
+ 7d5:	c1 ef 03             	shr    $0x3,%edi
+ 7d8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 7db:	85 d2                	test   %edx,%edx
+ 7dd:	0f 84 8d 00 00 00    	je     870 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 7e3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 7e5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 7e8:	39 f9                	cmp    %edi,%ecx
+ 7ea:	73 64                	jae    850 <malloc+0x90>
+  if(nu < 4096)
+ 7ec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 7f1:	39 df                	cmp    %ebx,%edi
+ 7f3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 7f6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 7fd:	eb 0a                	jmp    809 <malloc+0x49>
+ 7ff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 800:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 802:	8b 48 04             	mov    0x4(%eax),%ecx
+ 805:	39 f9                	cmp    %edi,%ecx
+ 807:	73 47                	jae    850 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 809:	89 c2                	mov    %eax,%edx
+ 80b:	39 05 60 12 00 00    	cmp    %eax,0x1260
+ 811:	75 ed                	jne    800 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 813:	83 ec 0c             	sub    $0xc,%esp
+ 816:	56                   	push   %esi
+ 817:	e8 6f fc ff ff       	call   48b <sbrk>
+  if(p == (char*)-1)
+ 81c:	83 c4 10             	add    $0x10,%esp
+ 81f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 822:	74 1c                	je     840 <malloc+0x80>
+  hp->s.size = nu;
+ 824:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 827:	83 ec 0c             	sub    $0xc,%esp
+ 82a:	83 c0 08             	add    $0x8,%eax
+ 82d:	50                   	push   %eax
+ 82e:	e8 fd fe ff ff       	call   730 <free>
+  return freep;
+ 833:	8b 15 60 12 00 00    	mov    0x1260,%edx
+      if((p = morecore(nunits)) == 0)
+ 839:	83 c4 10             	add    $0x10,%esp
+ 83c:	85 d2                	test   %edx,%edx
+ 83e:	75 c0                	jne    800 <malloc+0x40>
+        return 0;
+  }
+}
+ 840:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 843:	31 c0                	xor    %eax,%eax
+}
+ 845:	5b                   	pop    %ebx
+ 846:	5e                   	pop    %esi
+ 847:	5f                   	pop    %edi
+ 848:	5d                   	pop    %ebp
+ 849:	c3                   	ret
+ 84a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 850:	39 cf                	cmp    %ecx,%edi
+ 852:	74 4c                	je     8a0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 854:	29 f9                	sub    %edi,%ecx
+ 856:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 859:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 85c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 85f:	89 15 60 12 00 00    	mov    %edx,0x1260
+}
+ 865:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 868:	83 c0 08             	add    $0x8,%eax
+}
+ 86b:	5b                   	pop    %ebx
+ 86c:	5e                   	pop    %esi
+ 86d:	5f                   	pop    %edi
+ 86e:	5d                   	pop    %ebp
+ 86f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 870:	c7 05 60 12 00 00 64 	movl   $0x1264,0x1260
+ 877:	12 00 00 
+    base.s.size = 0;
+ 87a:	b8 64 12 00 00       	mov    $0x1264,%eax
+    base.s.ptr = freep = prevp = &base;
+ 87f:	c7 05 64 12 00 00 64 	movl   $0x1264,0x1264
+ 886:	12 00 00 
+    base.s.size = 0;
+ 889:	c7 05 68 12 00 00 00 	movl   $0x0,0x1268
+ 890:	00 00 00 
+    if(p->s.size >= nunits){
+ 893:	e9 54 ff ff ff       	jmp    7ec <malloc+0x2c>
+ 898:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 89f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 8a0:	8b 08                	mov    (%eax),%ecx
+ 8a2:	89 0a                	mov    %ecx,(%edx)
+ 8a4:	eb b9                	jmp    85f <malloc+0x9f>
+ 8a6:	66 90                	xchg   %ax,%ax
+ 8a8:	66 90                	xchg   %ax,%ax
+ 8aa:	66 90                	xchg   %ax,%ax
+ 8ac:	66 90                	xchg   %ax,%ax
+ 8ae:	66 90                	xchg   %ax,%ax
+
+000008b0 <pidstat>:
+
+// Fill in *st with the statistics of process pid.
+// Returns 0, or -1 if there is no such process.
+int
+pidstat(int pid, struct pstat *st)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	56                   	push   %esi
+ 8b4:	53                   	push   %ebx
+  static struct pstat *ps;
+  int i, n;
+
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ 8b5:	a1 6c 12 00 00       	mov    0x126c,%eax
+{
+ 8ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 8bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ 8c0:	85 c0                	test   %eax,%eax
+ 8c2:	0f 84 98 00 00 00    	je     960 <pidstat+0xb0>
+    return -1;
+  n = getpstat(ps, NPROC);
+ 8c8:	83 ec 08             	sub    $0x8,%esp
+ 8cb:	6a 40                	push   $0x40
+ 8cd:	50                   	push   %eax
+ 8ce:	e8 e0 fb ff ff       	call   4b3 <getpstat>
+  for(i = 0; i < n; i++){
+ 8d3:	83 c4 10             	add    $0x10,%esp
+ 8d6:	85 c0                	test   %eax,%eax
+ 8d8:	0f 8e 9f 00 00 00    	jle    97d <pidstat+0xcd>
+ 8de:	8b 15 6c 12 00 00    	mov    0x126c,%edx
+ 8e4:	31 c9                	xor    %ecx,%ecx
+ 8e6:	eb 16                	jmp    8fe <pidstat+0x4e>
+ 8e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ef:	90                   	nop
+ 8f0:	83 c1 01             	add    $0x1,%ecx
+ 8f3:	83 c2 38             	add    $0x38,%edx
+ 8f6:	39 c8                	cmp    %ecx,%eax
+ 8f8:	0f 84 7f 00 00 00    	je     97d <pidstat+0xcd>
+    if(ps[i].pid == pid){
+ 8fe:	39 1a                	cmp    %ebx,(%edx)
+ 900:	75 ee                	jne    8f0 <pidstat+0x40>
+      *st = ps[i];
+ 902:	89 1e                	mov    %ebx,(%esi)
+ 904:	8b 42 04             	mov    0x4(%edx),%eax
+ 907:	89 46 04             	mov    %eax,0x4(%esi)
+ 90a:	8b 42 08             	mov    0x8(%edx),%eax
+ 90d:	89 46 08             	mov    %eax,0x8(%esi)
+ 910:	8b 42 0c             	mov    0xc(%edx),%eax
+ 913:	89 46 0c             	mov    %eax,0xc(%esi)
+ 916:	8b 42 10             	mov    0x10(%edx),%eax
+ 919:	89 46 10             	mov    %eax,0x10(%esi)
+ 91c:	8b 42 14             	mov    0x14(%edx),%eax
+ 91f:	89 46 14             	mov    %eax,0x14(%esi)
+ 922:	8b 42 18             	mov    0x18(%edx),%eax
+ 925:	89 46 18             	mov    %eax,0x18(%esi)
+ 928:	8b 42 1c             	mov    0x1c(%edx),%eax
+ 92b:	89 46 1c             	mov    %eax,0x1c(%esi)
+ 92e:	8b 42 20             	mov    0x20(%edx),%eax
+ 931:	89 46 20             	mov    %eax,0x20(%esi)
+ 934:	8b 42 24             	mov    0x24(%edx),%eax
+ 937:	89 46 24             	mov    %eax,0x24(%esi)
+ 93a:	8b 42 28             	mov    0x28(%edx),%eax
+ 93d:	89 46 28             	mov    %eax,0x28(%esi)
+ 940:	8b 42 2c             	mov    0x2c(%edx),%eax
+ 943:	89 46 2c             	mov    %eax,0x2c(%esi)
+ 946:	8b 42 30             	mov    0x30(%edx),%eax
+ 949:	89 46 30             	mov    %eax,0x30(%esi)
+ 94c:	8b 42 34             	mov    0x34(%edx),%eax
+ 94f:	89 46 34             	mov    %eax,0x34(%esi)
+      return 0;
+    }
+  }
+  return -1;
+}
+ 952:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ 955:	31 c0                	xor    %eax,%eax
+}
+ 957:	5b                   	pop    %ebx
+ 958:	5e                   	pop    %esi
+ 959:	5d                   	pop    %ebp
+ 95a:	c3                   	ret
+ 95b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 95f:	90                   	nop
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ 960:	83 ec 0c             	sub    $0xc,%esp
+ 963:	68 00 0e 00 00       	push   $0xe00
+ 968:	e8 53 fe ff ff       	call   7c0 <malloc>
+ 96d:	83 c4 10             	add    $0x10,%esp
+ 970:	a3 6c 12 00 00       	mov    %eax,0x126c
+ 975:	85 c0                	test   %eax,%eax
+ 977:	0f 85 4b ff ff ff    	jne    8c8 <pidstat+0x18>
+}
+ 97d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return -1;
+ 980:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ 985:	5b                   	pop    %ebx
+ 986:	5e                   	pop    %esi
+ 987:	5d                   	pop    %ebp
+ 988:	c3                   	ret
+ 989:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000990 <sharetable>:
+// key[i] is printed in a column headed keyname, and so is
+// extra[i] under extraname unless extra is 0.
+void
+sharetable(char *tag, char *keyname, int *key, char *extraname, int *extra,
+           int n, int *pid, int *weight, uint *ticks)
+{
+ 990:	55                   	push   %ebp
+ 991:	89 e5                	mov    %esp,%ebp
+ 993:	57                   	push   %edi
+ 994:	56                   	push   %esi
+ 995:	53                   	push   %ebx
+ 996:	83 ec 3c             	sub    $0x3c,%esp
+ 999:	8b 45 08             	mov    0x8(%ebp),%eax
+ 99c:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+ 99f:	8b 75 24             	mov    0x24(%ebp),%esi
+ 9a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 9a5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 9a8:	8b 45 10             	mov    0x10(%ebp),%eax
+ 9ab:	89 7d d0             	mov    %edi,-0x30(%ebp)
+ 9ae:	8b 5d 14             	mov    0x14(%ebp),%ebx
+ 9b1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+ 9b4:	8b 45 18             	mov    0x18(%ebp),%eax
+ 9b7:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ 9ba:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ 9bd:	8b 45 20             	mov    0x20(%ebp),%eax
+ 9c0:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ 9c3:	8b 45 28             	mov    0x28(%ebp),%eax
+ 9c6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  int i, wsum, share, expect, err, maxerr;
+  uint tsum;
+
+  wsum = 0;
+  tsum = 0;
+  for(i = 0; i < n; i++){
+ 9c9:	85 ff                	test   %edi,%edi
+ 9cb:	0f 8e df 01 00 00    	jle    bb0 <sharetable+0x220>
+ 9d1:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+ 9d4:	89 fb                	mov    %edi,%ebx
+ 9d6:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  tsum = 0;
+ 9d9:	31 d2                	xor    %edx,%edx
+  for(i = 0; i < n; i++){
+ 9db:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ 9de:	31 c0                	xor    %eax,%eax
+ 9e0:	31 c9                	xor    %ecx,%ecx
+ 9e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wsum += weight[i];
+ 9e8:	03 0c 86             	add    (%esi,%eax,4),%ecx
+    tsum += ticks[i];
+ 9eb:	03 14 87             	add    (%edi,%eax,4),%edx
+  for(i = 0; i < n; i++){
+ 9ee:	83 c0 01             	add    $0x1,%eax
+ 9f1:	39 c3                	cmp    %eax,%ebx
+ 9f3:	75 f3                	jne    9e8 <sharetable+0x58>
+ 9f5:	85 d2                	test   %edx,%edx
+ 9f7:	b8 01 00 00 00       	mov    $0x1,%eax
+ 9fc:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  }
+  if(tsum == 0)
+    tsum = 1;
+  if(wsum == 0)
+    wsum = 1;
+ 9ff:	8b 7d d8             	mov    -0x28(%ebp),%edi
+ a02:	0f 45 c2             	cmovne %edx,%eax
+ a05:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+  if(tsum == 0)
+ a08:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    wsum = 1;
+ a0b:	85 ff                	test   %edi,%edi
+ a0d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ a10:	b8 01 00 00 00       	mov    $0x1,%eax
+ a15:	0f 45 c7             	cmovne %edi,%eax
+ a18:	89 45 d8             	mov    %eax,-0x28(%ebp)
+
+  printf(1, "[%s]  pid %s ", tag, keyname);
+ a1b:	51                   	push   %ecx
+ a1c:	ff 75 dc             	push   -0x24(%ebp)
+ a1f:	68 f5 0c 00 00       	push   $0xcf5
+ a24:	6a 01                	push   $0x1
+ a26:	e8 55 fb ff ff       	call   580 <printf>
+  if(extra)
+ a2b:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a2e:	83 c4 10             	add    $0x10,%esp
+ a31:	85 f6                	test   %esi,%esi
+ a33:	0f 84 47 01 00 00    	je     b80 <sharetable+0x1f0>
+    printf(1, "%s ", extraname);
+ a39:	83 ec 04             	sub    $0x4,%esp
+ a3c:	53                   	push   %ebx
+ a3d:	68 ff 0c 00 00       	push   $0xcff
+ a42:	6a 01                	push   $0x1
+ a44:	e8 37 fb ff ff       	call   580 <printf>
+  printf(1, "ticks  share expected\n");
+ a49:	58                   	pop    %eax
+ a4a:	5a                   	pop    %edx
+ a4b:	68 03 0d 00 00       	push   $0xd03
+ a50:	6a 01                	push   $0x1
+ a52:	e8 29 fb ff ff       	call   580 <printf>
+  maxerr = 0;
+  for(i = 0; i < n; i++){
+ a57:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+ a5a:	83 c4 10             	add    $0x10,%esp
+ a5d:	85 c9                	test   %ecx,%ecx
+ a5f:	0f 8e 44 01 00 00    	jle    ba9 <sharetable+0x219>
+  if(extra)
+ a65:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+ a6c:	31 ff                	xor    %edi,%edi
+ a6e:	66 90                	xchg   %ax,%ax
+    share = ticks[i] * 1000 / tsum;
+ a70:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ a73:	31 d2                	xor    %edx,%edx
+    expect = weight[i] * 1000 / wsum;
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+ a75:	83 ec 0c             	sub    $0xc,%esp
+    share = ticks[i] * 1000 / tsum;
+ a78:	69 04 b8 e8 03 00 00 	imul   $0x3e8,(%eax,%edi,4),%eax
+ a7f:	f7 75 c0             	divl   -0x40(%ebp)
+ a82:	89 c6                	mov    %eax,%esi
+    expect = weight[i] * 1000 / wsum;
+ a84:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ a87:	69 04 b8 e8 03 00 00 	imul   $0x3e8,(%eax,%edi,4),%eax
+ a8e:	99                   	cltd
+ a8f:	f7 7d d8             	idivl  -0x28(%ebp)
+ a92:	89 c3                	mov    %eax,%ebx
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+ a94:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ a97:	ff 34 b8             	push   (%eax,%edi,4)
+ a9a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ a9d:	ff 34 b8             	push   (%eax,%edi,4)
+ aa0:	ff 75 dc             	push   -0x24(%ebp)
+ aa3:	68 1a 0d 00 00       	push   $0xd1a
+ aa8:	6a 01                	push   $0x1
+ aaa:	e8 d1 fa ff ff       	call   580 <printf>
+    if(extra)
+ aaf:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ ab2:	83 c4 20             	add    $0x20,%esp
+ ab5:	85 c0                	test   %eax,%eax
+ ab7:	74 15                	je     ace <sharetable+0x13e>
+      printf(1, "%d ", extra[i]);
+ ab9:	83 ec 04             	sub    $0x4,%esp
+ abc:	ff 34 b8             	push   (%eax,%edi,4)
+ abf:	68 22 0d 00 00       	push   $0xd22
+ ac4:	6a 01                	push   $0x1
+ ac6:	e8 b5 fa ff ff       	call   580 <printf>
+ acb:	83 c4 10             	add    $0x10,%esp
+    printf(1, "%d %d.%d%% %d.%d%%\n", ticks[i], share / 10, share % 10,
+ ace:	b8 67 66 66 66       	mov    $0x66666667,%eax
+ ad3:	89 d9                	mov    %ebx,%ecx
+ ad5:	83 ec 04             	sub    $0x4,%esp
+ ad8:	f7 eb                	imul   %ebx
+ ada:	89 d8                	mov    %ebx,%eax
+ adc:	c1 f8 1f             	sar    $0x1f,%eax
+ adf:	c1 fa 02             	sar    $0x2,%edx
+ ae2:	29 c2                	sub    %eax,%edx
+ ae4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ ae7:	01 c0                	add    %eax,%eax
+ ae9:	29 c1                	sub    %eax,%ecx
+ aeb:	b8 67 66 66 66       	mov    $0x66666667,%eax
+ af0:	51                   	push   %ecx
+ af1:	89 f1                	mov    %esi,%ecx
+ af3:	52                   	push   %edx
+ af4:	f7 ee                	imul   %esi
+ af6:	89 f0                	mov    %esi,%eax
+ af8:	c1 f8 1f             	sar    $0x1f,%eax
+ afb:	c1 fa 02             	sar    $0x2,%edx
+ afe:	29 c2                	sub    %eax,%edx
+ b00:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ b03:	01 c0                	add    %eax,%eax
+ b05:	29 c1                	sub    %eax,%ecx
+ b07:	51                   	push   %ecx
+ b08:	52                   	push   %edx
+ b09:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ b0c:	ff 34 b8             	push   (%eax,%edi,4)
+ b0f:	68 26 0d 00 00       	push   $0xd26
+ b14:	6a 01                	push   $0x1
+ b16:	e8 65 fa ff ff       	call   580 <printf>
+           expect / 10, expect % 10);
+    err = share > expect ? share - expect : expect - share;
+ b1b:	89 f2                	mov    %esi,%edx
+ b1d:	89 d8                	mov    %ebx,%eax
+ b1f:	83 c4 20             	add    $0x20,%esp
+ b22:	29 f0                	sub    %esi,%eax
+ b24:	29 da                	sub    %ebx,%edx
+ b26:	39 de                	cmp    %ebx,%esi
+ b28:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ b2b:	0f 4f c2             	cmovg  %edx,%eax
+    if(err > maxerr)
+ b2e:	39 c6                	cmp    %eax,%esi
+ b30:	0f 4d c6             	cmovge %esi,%eax
+  for(i = 0; i < n; i++){
+ b33:	83 c7 01             	add    $0x1,%edi
+ b36:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ b39:	39 7d d0             	cmp    %edi,-0x30(%ebp)
+ b3c:	0f 85 2e ff ff ff    	jne    a70 <sharetable+0xe0>
+      maxerr = err;
+  }
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+ b42:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+ b47:	f7 e2                	mul    %edx
+ b49:	c1 ea 03             	shr    $0x3,%edx
+ b4c:	8d 0c 92             	lea    (%edx,%edx,4),%ecx
+ b4f:	89 d0                	mov    %edx,%eax
+ b51:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ b54:	01 c9                	add    %ecx,%ecx
+ b56:	29 ca                	sub    %ecx,%edx
+ b58:	89 45 14             	mov    %eax,0x14(%ebp)
+ b5b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ b5e:	89 55 18             	mov    %edx,0x18(%ebp)
+ b61:	89 45 10             	mov    %eax,0x10(%ebp)
+ b64:	c7 45 0c 3c 0d 00 00 	movl   $0xd3c,0xc(%ebp)
+ b6b:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+ b72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b75:	5b                   	pop    %ebx
+ b76:	5e                   	pop    %esi
+ b77:	5f                   	pop    %edi
+ b78:	5d                   	pop    %ebp
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+ b79:	e9 02 fa ff ff       	jmp    580 <printf>
+ b7e:	66 90                	xchg   %ax,%ax
+  printf(1, "ticks  share expected\n");
+ b80:	83 ec 08             	sub    $0x8,%esp
+ b83:	68 03 0d 00 00       	push   $0xd03
+ b88:	6a 01                	push   $0x1
+ b8a:	e8 f1 f9 ff ff       	call   580 <printf>
+ b8f:	83 c4 10             	add    $0x10,%esp
+ b92:	e9 ce fe ff ff       	jmp    a65 <sharetable+0xd5>
+ b97:	83 ec 08             	sub    $0x8,%esp
+ b9a:	68 03 0d 00 00       	push   $0xd03
+ b9f:	6a 01                	push   $0x1
+ ba1:	e8 da f9 ff ff       	call   580 <printf>
+ ba6:	83 c4 10             	add    $0x10,%esp
+  if(extra)
+ ba9:	31 c0                	xor    %eax,%eax
+ bab:	31 d2                	xor    %edx,%edx
+ bad:	eb a9                	jmp    b58 <sharetable+0x1c8>
+ baf:	90                   	nop
+  printf(1, "[%s]  pid %s ", tag, keyname);
+ bb0:	51                   	push   %ecx
+ bb1:	ff 75 dc             	push   -0x24(%ebp)
+ bb4:	68 f5 0c 00 00       	push   $0xcf5
+ bb9:	6a 01                	push   $0x1
+ bbb:	e8 c0 f9 ff ff       	call   580 <printf>
+  if(extra)
+ bc0:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ bc3:	83 c4 10             	add    $0x10,%esp
+ bc6:	85 ff                	test   %edi,%edi
+ bc8:	74 cd                	je     b97 <sharetable+0x207>
+    wsum = 1;
+ bca:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  if(extra)
+ bd1:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+ bd8:	e9 5c fe ff ff       	jmp    a39 <sharetable+0xa9>
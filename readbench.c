@@ -0,0 +1,62 @@
+// readbench.c — sequential file read benchmark
+// Writes a file of the given size, then reads it back from
+// start to end one block at a time, timing the read pass.
+// The file is larger than the buffer cache, so the read pass
+// goes to the disk; read-ahead should keep it from waiting
+// on every block.
+// Expect: ticks to drop when read-ahead is working.
+//
+// usage: readbench [kb]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define CHUNK 512
+
+static char buf[CHUNK];
+
+int
+main(int argc, char *argv[])
+{
+  int kb = 400;
+  int fd, i, n, total, start, t;
+
+  if (argc > 1) kb = atoi(argv[1]);
+
+  printf(1, "\n[READBENCH] %d KB file\n", kb);
+
+  fd = open("readbench.tmp", O_CREATE | O_RDWR);
+  if (fd < 0) {
+    printf(2, "readbench: create failed\n");
+    exit();
+  }
+  for (i = 0; i < CHUNK; i++)
+    buf[i] = i;
+  total = 0;
+  for (i = 0; i < kb * 1024 / CHUNK; i++) {
+    if (write(fd, buf, CHUNK) != CHUNK)
+      break;
+    total += CHUNK;
+  }
+  close(fd);
+  if (total < kb * 1024)
+    printf(1, "[READBENCH] file stops at %d KB\n", total / 1024);
+
+  fd = open("readbench.tmp", O_RDONLY);
+  if (fd < 0) {
+    printf(2, "readbench: open failed\n");
+    exit();
+  }
+  start = uptime();
+  total = 0;
+  while ((n = read(fd, buf, CHUNK)) > 0)
+    total += n;
+  t = uptime() - start;
+  close(fd);
+  unlink("readbench.tmp");
+
+  printf(1, "[READBENCH] read %d KB in %d ticks\n", total / 1024, t);
+  exit();
+}
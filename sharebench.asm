@@ -0,0 +1,2161 @@
+
+_sharebench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         share / 10, share % 10);
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	81 ec b8 00 00 00    	sub    $0xb8,%esp
+      17:	8b 31                	mov    (%ecx),%esi
+      19:	8b 51 04             	mov    0x4(%ecx),%edx
+  int dur = 500, nw = 4, tix[MAXW] = { 100, 200, 300, 400 };
+      1c:	c7 85 60 ff ff ff 00 	movl   $0x0,-0xa0(%ebp)
+      23:	00 00 00 
+      26:	c7 85 64 ff ff ff 00 	movl   $0x0,-0x9c(%ebp)
+      2d:	00 00 00 
+      30:	c7 85 68 ff ff ff 00 	movl   $0x0,-0x98(%ebp)
+      37:	00 00 00 
+      3a:	c7 85 6c ff ff ff 00 	movl   $0x0,-0x94(%ebp)
+      41:	00 00 00 
+      44:	c7 85 50 ff ff ff 64 	movl   $0x64,-0xb0(%ebp)
+      4b:	00 00 00 
+      4e:	c7 85 54 ff ff ff c8 	movl   $0xc8,-0xac(%ebp)
+      55:	00 00 00 
+      58:	c7 85 58 ff ff ff 2c 	movl   $0x12c,-0xa8(%ebp)
+      5f:	01 00 00 
+      62:	c7 85 5c ff ff ff 90 	movl   $0x190,-0xa4(%ebp)
+      69:	01 00 00 
+
+  if(argc > 1) dur = atoi(argv[1]);
+      6c:	83 fe 01             	cmp    $0x1,%esi
+      6f:	0f 8e e7 01 00 00    	jle    25c <main+0x25c>
+      75:	83 ec 0c             	sub    $0xc,%esp
+      78:	ff 72 04             	push   0x4(%edx)
+      7b:	89 95 3c ff ff ff    	mov    %edx,-0xc4(%ebp)
+      81:	e8 ba 07 00 00       	call   840 <atoi>
+  if(argc > 2){
+      86:	83 c4 10             	add    $0x10,%esp
+  if(argc > 1) dur = atoi(argv[1]);
+      89:	89 85 44 ff ff ff    	mov    %eax,-0xbc(%ebp)
+  if(argc > 2){
+      8f:	83 fe 02             	cmp    $0x2,%esi
+      92:	0f 84 ba 01 00 00    	je     252 <main+0x252>
+    for(nw = 0; nw < MAXW && nw + 2 < argc; nw++){
+      98:	31 db                	xor    %ebx,%ebx
+      9a:	89 b5 40 ff ff ff    	mov    %esi,-0xc0(%ebp)
+      a0:	8d bd 50 ff ff ff    	lea    -0xb0(%ebp),%edi
+      a6:	89 de                	mov    %ebx,%esi
+      a8:	8b 9d 3c ff ff ff    	mov    -0xc4(%ebp),%ebx
+      ae:	eb 0d                	jmp    bd <main+0xbd>
+      b0:	8d 56 03             	lea    0x3(%esi),%edx
+      b3:	39 95 40 ff ff ff    	cmp    %edx,-0xc0(%ebp)
+      b9:	7e 2a                	jle    e5 <main+0xe5>
+      bb:	89 ce                	mov    %ecx,%esi
+      tix[nw] = atoi(argv[nw + 2]);
+      bd:	83 ec 0c             	sub    $0xc,%esp
+      c0:	ff 74 b3 08          	push   0x8(%ebx,%esi,4)
+      c4:	e8 77 07 00 00       	call   840 <atoi>
+      if(tix[nw] < 1 || tix[nw] > MAXTICKETS){
+      c9:	83 c4 10             	add    $0x10,%esp
+      tix[nw] = atoi(argv[nw + 2]);
+      cc:	89 04 b7             	mov    %eax,(%edi,%esi,4)
+      if(tix[nw] < 1 || tix[nw] > MAXTICKETS){
+      cf:	83 e8 01             	sub    $0x1,%eax
+      d2:	3d ff ff 00 00       	cmp    $0xffff,%eax
+      d7:	0f 87 a6 01 00 00    	ja     283 <main+0x283>
+    for(nw = 0; nw < MAXW && nw + 2 < argc; nw++){
+      dd:	8d 4e 01             	lea    0x1(%esi),%ecx
+      e0:	83 fe 07             	cmp    $0x7,%esi
+      e3:	75 cb                	jne    b0 <main+0xb0>
+      e5:	89 8d 40 ff ff ff    	mov    %ecx,-0xc0(%ebp)
+        exit();
+      }
+    }
+  }
+
+  if(settickets(getpid(), DEFTICKETS) < 0){
+      eb:	e8 43 08 00 00       	call   933 <getpid>
+      f0:	83 ec 08             	sub    $0x8,%esp
+      f3:	68 00 04 00 00       	push   $0x400
+      f8:	50                   	push   %eax
+      f9:	e8 7d 08 00 00       	call   97b <settickets>
+      fe:	83 c4 10             	add    $0x10,%esp
+     101:	8b 8d 40 ff ff ff    	mov    -0xc0(%ebp),%ecx
+     107:	85 c0                	test   %eax,%eax
+     109:	0f 88 61 01 00 00    	js     270 <main+0x270>
+     10f:	89 8d 40 ff ff ff    	mov    %ecx,-0xc0(%ebp)
+  for(i = 0; i < nw; i++){
+     115:	31 f6                	xor    %esi,%esi
+    printf(2, "sharebench: tickets not in effect; build with SCHED=STRIDE\n");
+    exit();
+  }
+
+  printf(1, "\n[SHAREBENCH] %d ticks per run\n", dur);
+     117:	57                   	push   %edi
+     118:	ff b5 44 ff ff ff    	push   -0xbc(%ebp)
+     11e:	68 a4 11 00 00       	push   $0x11a4
+     123:	6a 01                	push   $0x1
+     125:	e8 06 09 00 00       	call   a30 <printf>
+  pipe(startfd);
+     12a:	8d 85 48 ff ff ff    	lea    -0xb8(%ebp),%eax
+     130:	89 04 24             	mov    %eax,(%esp)
+     133:	e8 8b 07 00 00       	call   8c3 <pipe>
+  for(i = 0; i < nw; i++){
+     138:	8b 9d 40 ff ff ff    	mov    -0xc0(%ebp),%ebx
+  pipe(startfd);
+     13e:	83 c4 10             	add    $0x10,%esp
+     141:	eb 07                	jmp    14a <main+0x14a>
+     143:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     147:	90                   	nop
+  for(i = 0; i < nw; i++){
+     148:	89 d6                	mov    %edx,%esi
+  if((pid = fork()) < 0){
+     14a:	e8 5c 07 00 00       	call   8ab <fork>
+     14f:	85 c0                	test   %eax,%eax
+     151:	0f 88 76 01 00 00    	js     2cd <main+0x2cd>
+  if(pid == 0){
+     157:	0f 84 3d 01 00 00    	je     29a <main+0x29a>
+    settickets(pids[i], tix[i]);
+     15d:	83 ec 08             	sub    $0x8,%esp
+     160:	8d bd 50 ff ff ff    	lea    -0xb0(%ebp),%edi
+    pids[i] = spawn(startfd, spin);
+     166:	89 84 b5 70 ff ff ff 	mov    %eax,-0x90(%ebp,%esi,4)
+    settickets(pids[i], tix[i]);
+     16d:	ff 34 b7             	push   (%edi,%esi,4)
+     170:	50                   	push   %eax
+     171:	e8 05 08 00 00       	call   97b <settickets>
+  for(i = 0; i < nw; i++){
+     176:	8d 56 01             	lea    0x1(%esi),%edx
+     179:	83 c4 10             	add    $0x10,%esp
+     17c:	39 d3                	cmp    %edx,%ebx
+     17e:	75 c8                	jne    148 <main+0x148>
+  close(startfd[0]);
+     180:	83 ec 0c             	sub    $0xc,%esp
+     183:	89 95 40 ff ff ff    	mov    %edx,-0xc0(%ebp)
+  for(i = 0; i < nw; i++)
+     189:	31 db                	xor    %ebx,%ebx
+  close(startfd[0]);
+     18b:	ff b5 48 ff ff ff    	push   -0xb8(%ebp)
+     191:	e8 45 07 00 00       	call   8db <close>
+  close(startfd[1]);
+     196:	5a                   	pop    %edx
+     197:	ff b5 4c ff ff ff    	push   -0xb4(%ebp)
+     19d:	e8 39 07 00 00       	call   8db <close>
+  sleep(dur);
+     1a2:	59                   	pop    %ecx
+     1a3:	ff b5 44 ff ff ff    	push   -0xbc(%ebp)
+     1a9:	e8 95 07 00 00       	call   943 <sleep>
+     1ae:	83 c4 10             	add    $0x10,%esp
+     1b1:	eb 07                	jmp    1ba <main+0x1ba>
+     1b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     1b7:	90                   	nop
+  for(i = 0; i < nw; i++)
+     1b8:	89 c3                	mov    %eax,%ebx
+  return pidstat(pid, &st) == 0 ? st.runticks : 0;
+     1ba:	83 ec 08             	sub    $0x8,%esp
+     1bd:	8d 45 b0             	lea    -0x50(%ebp),%eax
+     1c0:	50                   	push   %eax
+     1c1:	ff b4 9d 70 ff ff ff 	push   -0x90(%ebp,%ebx,4)
+     1c8:	e8 93 0b 00 00       	call   d60 <pidstat>
+     1cd:	83 c4 10             	add    $0x10,%esp
+     1d0:	89 c1                	mov    %eax,%ecx
+     1d2:	31 c0                	xor    %eax,%eax
+     1d4:	85 c9                	test   %ecx,%ecx
+     1d6:	75 03                	jne    1db <main+0x1db>
+     1d8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    ticks[i] = runticks(pids[i]);
+     1db:	89 44 9d 90          	mov    %eax,-0x70(%ebp,%ebx,4)
+  for(i = 0; i < nw; i++)
+     1df:	8d 43 01             	lea    0x1(%ebx),%eax
+     1e2:	39 f3                	cmp    %esi,%ebx
+     1e4:	75 d2                	jne    1b8 <main+0x1b8>
+  stop(pids, nw);
+     1e6:	8b 95 40 ff ff ff    	mov    -0xc0(%ebp),%edx
+     1ec:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+     1f2:	e8 39 01 00 00       	call   330 <stop>
+  sharetable("SHARE", "tickets", tix, 0, 0, nw, pids, tix, ticks);
+     1f7:	83 ec 0c             	sub    $0xc,%esp
+     1fa:	8d 45 90             	lea    -0x70(%ebp),%eax
+     1fd:	50                   	push   %eax
+     1fe:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+     204:	57                   	push   %edi
+     205:	50                   	push   %eax
+     206:	8b 95 40 ff ff ff    	mov    -0xc0(%ebp),%edx
+     20c:	52                   	push   %edx
+     20d:	6a 00                	push   $0x0
+     20f:	6a 00                	push   $0x0
+     211:	57                   	push   %edi
+     212:	68 ce 10 00 00       	push   $0x10ce
+     217:	68 d6 10 00 00       	push   $0x10d6
+     21c:	e8 1f 0c 00 00       	call   e40 <sharetable>
+  shares(dur, nw, tix);
+  rpc(dur, 0);
+     221:	8b bd 44 ff ff ff    	mov    -0xbc(%ebp),%edi
+     227:	83 c4 30             	add    $0x30,%esp
+     22a:	31 d2                	xor    %edx,%edx
+     22c:	89 f8                	mov    %edi,%eax
+     22e:	e8 bd 02 00 00       	call   4f0 <rpc>
+  rpc(dur, 1);
+     233:	89 f8                	mov    %edi,%eax
+     235:	ba 01 00 00 00       	mov    $0x1,%edx
+     23a:	e8 b1 02 00 00       	call   4f0 <rpc>
+  printf(1, "[SHAREBENCH] done\n\n");
+     23f:	50                   	push   %eax
+     240:	50                   	push   %eax
+     241:	68 dc 10 00 00       	push   $0x10dc
+     246:	6a 01                	push   $0x1
+     248:	e8 e3 07 00 00       	call   a30 <printf>
+  exit();
+     24d:	e8 61 06 00 00       	call   8b3 <exit>
+  int dur = 500, nw = 4, tix[MAXW] = { 100, 200, 300, 400 };
+     252:	b9 04 00 00 00       	mov    $0x4,%ecx
+     257:	e9 89 fe ff ff       	jmp    e5 <main+0xe5>
+     25c:	c7 85 44 ff ff ff f4 	movl   $0x1f4,-0xbc(%ebp)
+     263:	01 00 00 
+     266:	b9 04 00 00 00       	mov    $0x4,%ecx
+     26b:	e9 75 fe ff ff       	jmp    e5 <main+0xe5>
+    printf(2, "sharebench: tickets not in effect; build with SCHED=STRIDE\n");
+     270:	50                   	push   %eax
+     271:	50                   	push   %eax
+     272:	68 68 11 00 00       	push   $0x1168
+     277:	6a 02                	push   $0x2
+     279:	e8 b2 07 00 00       	call   a30 <printf>
+    exit();
+     27e:	e8 30 06 00 00       	call   8b3 <exit>
+        printf(2, "sharebench: tickets must be 1..%d\n", MAXTICKETS);
+     283:	50                   	push   %eax
+     284:	68 00 00 01 00       	push   $0x10000
+     289:	68 44 11 00 00       	push   $0x1144
+     28e:	6a 02                	push   $0x2
+     290:	e8 9b 07 00 00       	call   a30 <printf>
+        exit();
+     295:	e8 19 06 00 00       	call   8b3 <exit>
+    close(startfd[1]);
+     29a:	83 ec 0c             	sub    $0xc,%esp
+     29d:	ff b5 4c ff ff ff    	push   -0xb4(%ebp)
+     2a3:	e8 33 06 00 00       	call   8db <close>
+    read(startfd[0], &c, 1);
+     2a8:	83 c4 0c             	add    $0xc,%esp
+     2ab:	8d 45 b0             	lea    -0x50(%ebp),%eax
+     2ae:	6a 01                	push   $0x1
+     2b0:	50                   	push   %eax
+     2b1:	ff b5 48 ff ff ff    	push   -0xb8(%ebp)
+     2b7:	e8 0f 06 00 00       	call   8cb <read>
+    close(startfd[0]);
+     2bc:	5b                   	pop    %ebx
+     2bd:	ff b5 48 ff ff ff    	push   -0xb8(%ebp)
+     2c3:	e8 13 06 00 00       	call   8db <close>
+    fn();
+     2c8:	e8 13 00 00 00       	call   2e0 <spin>
+    printf(2, "sharebench: fork failed\n");
+     2cd:	56                   	push   %esi
+     2ce:	56                   	push   %esi
+     2cf:	68 ad 10 00 00       	push   $0x10ad
+     2d4:	6a 02                	push   $0x2
+     2d6:	e8 55 07 00 00       	call   a30 <printf>
+    exit();
+     2db:	e8 d3 05 00 00       	call   8b3 <exit>
+
+000002e0 <spin>:
+{
+     2e0:	55                   	push   %ebp
+     2e1:	89 e5                	mov    %esp,%ebp
+     2e3:	83 ec 10             	sub    $0x10,%esp
+  volatile uint x = 0;
+     2e6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     2ed:	8d 76 00             	lea    0x0(%esi),%esi
+    x++;
+     2f0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     2f3:	83 c0 01             	add    $0x1,%eax
+     2f6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  for(;;)
+     2f9:	eb f5                	jmp    2f0 <spin+0x10>
+     2fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     2ff:	90                   	nop
+
+00000300 <runticks>:
+{
+     300:	55                   	push   %ebp
+     301:	89 e5                	mov    %esp,%ebp
+     303:	83 ec 50             	sub    $0x50,%esp
+  return pidstat(pid, &st) == 0 ? st.runticks : 0;
+     306:	8d 55 c0             	lea    -0x40(%ebp),%edx
+     309:	52                   	push   %edx
+     30a:	50                   	push   %eax
+     30b:	e8 50 0a 00 00       	call   d60 <pidstat>
+     310:	83 c4 10             	add    $0x10,%esp
+     313:	85 c0                	test   %eax,%eax
+     315:	75 09                	jne    320 <runticks+0x20>
+     317:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+}
+     31a:	c9                   	leave
+     31b:	c3                   	ret
+     31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     320:	c9                   	leave
+  return pidstat(pid, &st) == 0 ? st.runticks : 0;
+     321:	31 c0                	xor    %eax,%eax
+}
+     323:	c3                   	ret
+     324:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     32b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     32f:	90                   	nop
+
+00000330 <stop>:
+{
+     330:	55                   	push   %ebp
+     331:	89 e5                	mov    %esp,%ebp
+     333:	57                   	push   %edi
+     334:	8d 3c 90             	lea    (%eax,%edx,4),%edi
+     337:	56                   	push   %esi
+     338:	89 d6                	mov    %edx,%esi
+     33a:	53                   	push   %ebx
+     33b:	89 c3                	mov    %eax,%ebx
+     33d:	83 ec 0c             	sub    $0xc,%esp
+    kill(pids[i]);
+     340:	83 ec 0c             	sub    $0xc,%esp
+     343:	ff 33                	push   (%ebx)
+  for(i = 0; i < n; i++)
+     345:	83 c3 04             	add    $0x4,%ebx
+    kill(pids[i]);
+     348:	e8 96 05 00 00       	call   8e3 <kill>
+  for(i = 0; i < n; i++)
+     34d:	83 c4 10             	add    $0x10,%esp
+     350:	39 df                	cmp    %ebx,%edi
+     352:	75 ec                	jne    340 <stop+0x10>
+  for(i = 0; i < n; i++)
+     354:	31 db                	xor    %ebx,%ebx
+     356:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     35d:	8d 76 00             	lea    0x0(%esi),%esi
+    wait();
+     360:	e8 56 05 00 00       	call   8bb <wait>
+  for(i = 0; i < n; i++)
+     365:	83 c3 01             	add    $0x1,%ebx
+     368:	39 de                	cmp    %ebx,%esi
+     36a:	75 f4                	jne    360 <stop+0x30>
+}
+     36c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     36f:	5b                   	pop    %ebx
+     370:	5e                   	pop    %esi
+     371:	5f                   	pop    %edi
+     372:	5d                   	pop    %ebp
+     373:	c3                   	ret
+     374:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     37b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     37f:	90                   	nop
+
+00000380 <client>:
+{
+     380:	55                   	push   %ebp
+     381:	89 e5                	mov    %esp,%ebp
+     383:	53                   	push   %ebx
+     384:	83 ec 20             	sub    $0x20,%esp
+  char c = 'r';
+     387:	c6 45 f7 72          	movb   $0x72,-0x9(%ebp)
+  close(reqfd[0]);
+     38b:	ff 35 b4 16 00 00    	push   0x16b4
+     391:	e8 45 05 00 00       	call   8db <close>
+  close(repfd[1]);
+     396:	5a                   	pop    %edx
+     397:	ff 35 b0 16 00 00    	push   0x16b0
+     39d:	e8 39 05 00 00       	call   8db <close>
+  if(lending && transfer(srvpid) < 0)
+     3a2:	8b 0d a4 16 00 00    	mov    0x16a4,%ecx
+     3a8:	83 c4 10             	add    $0x10,%esp
+     3ab:	85 c9                	test   %ecx,%ecx
+     3ad:	75 30                	jne    3df <client+0x5f>
+     3af:	8d 5d f7             	lea    -0x9(%ebp),%ebx
+     3b2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    write(reqfd[1], &c, 1);
+     3b8:	83 ec 04             	sub    $0x4,%esp
+     3bb:	6a 01                	push   $0x1
+     3bd:	53                   	push   %ebx
+     3be:	ff 35 b8 16 00 00    	push   0x16b8
+     3c4:	e8 0a 05 00 00       	call   8d3 <write>
+    read(repfd[0], &c, 1);
+     3c9:	83 c4 0c             	add    $0xc,%esp
+     3cc:	6a 01                	push   $0x1
+     3ce:	53                   	push   %ebx
+     3cf:	ff 35 ac 16 00 00    	push   0x16ac
+     3d5:	e8 f1 04 00 00       	call   8cb <read>
+     3da:	83 c4 10             	add    $0x10,%esp
+     3dd:	eb d9                	jmp    3b8 <client+0x38>
+  if(lending && transfer(srvpid) < 0)
+     3df:	83 ec 0c             	sub    $0xc,%esp
+     3e2:	ff 35 a8 16 00 00    	push   0x16a8
+     3e8:	e8 96 05 00 00       	call   983 <transfer>
+     3ed:	83 c4 10             	add    $0x10,%esp
+     3f0:	85 c0                	test   %eax,%eax
+     3f2:	79 bb                	jns    3af <client+0x2f>
+    printf(2, "sharebench: transfer failed\n");
+     3f4:	50                   	push   %eax
+     3f5:	50                   	push   %eax
+     3f6:	68 90 10 00 00       	push   $0x1090
+     3fb:	6a 02                	push   $0x2
+     3fd:	e8 2e 06 00 00       	call   a30 <printf>
+     402:	83 c4 10             	add    $0x10,%esp
+     405:	eb a8                	jmp    3af <client+0x2f>
+     407:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     40e:	66 90                	xchg   %ax,%ax
+
+00000410 <server>:
+{
+     410:	55                   	push   %ebp
+     411:	89 e5                	mov    %esp,%ebp
+     413:	53                   	push   %ebx
+     414:	8d 5d f3             	lea    -0xd(%ebp),%ebx
+     417:	83 ec 20             	sub    $0x20,%esp
+  volatile uint x = 0;
+     41a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  close(reqfd[1]);
+     421:	ff 35 b8 16 00 00    	push   0x16b8
+     427:	e8 af 04 00 00       	call   8db <close>
+  close(repfd[0]);
+     42c:	58                   	pop    %eax
+     42d:	ff 35 ac 16 00 00    	push   0x16ac
+     433:	e8 a3 04 00 00       	call   8db <close>
+  while(read(reqfd[0], &c, 1) == 1){
+     438:	83 c4 10             	add    $0x10,%esp
+     43b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     43f:	90                   	nop
+     440:	83 ec 04             	sub    $0x4,%esp
+     443:	6a 01                	push   $0x1
+     445:	53                   	push   %ebx
+     446:	ff 35 b4 16 00 00    	push   0x16b4
+     44c:	e8 7a 04 00 00       	call   8cb <read>
+     451:	83 c4 10             	add    $0x10,%esp
+     454:	83 f8 01             	cmp    $0x1,%eax
+     457:	75 2b                	jne    484 <server+0x74>
+     459:	ba 40 0d 03 00       	mov    $0x30d40,%edx
+     45e:	66 90                	xchg   %ax,%ax
+      x++;
+     460:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     463:	83 c0 01             	add    $0x1,%eax
+     466:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    for(i = 0; i < WORK; i++)
+     469:	83 ea 01             	sub    $0x1,%edx
+     46c:	75 f2                	jne    460 <server+0x50>
+    write(repfd[1], &c, 1);
+     46e:	83 ec 04             	sub    $0x4,%esp
+     471:	6a 01                	push   $0x1
+     473:	53                   	push   %ebx
+     474:	ff 35 b0 16 00 00    	push   0x16b0
+     47a:	e8 54 04 00 00       	call   8d3 <write>
+     47f:	83 c4 10             	add    $0x10,%esp
+     482:	eb bc                	jmp    440 <server+0x30>
+}
+     484:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     487:	c9                   	leave
+     488:	c3                   	ret
+     489:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <spawn>:
+{
+     490:	55                   	push   %ebp
+     491:	89 e5                	mov    %esp,%ebp
+     493:	56                   	push   %esi
+     494:	89 d6                	mov    %edx,%esi
+     496:	53                   	push   %ebx
+     497:	89 c3                	mov    %eax,%ebx
+     499:	83 ec 10             	sub    $0x10,%esp
+  if((pid = fork()) < 0){
+     49c:	e8 0a 04 00 00       	call   8ab <fork>
+     4a1:	85 c0                	test   %eax,%eax
+     4a3:	78 09                	js     4ae <spawn+0x1e>
+  if(pid == 0){
+     4a5:	74 1a                	je     4c1 <spawn+0x31>
+}
+     4a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     4aa:	5b                   	pop    %ebx
+     4ab:	5e                   	pop    %esi
+     4ac:	5d                   	pop    %ebp
+     4ad:	c3                   	ret
+    printf(2, "sharebench: fork failed\n");
+     4ae:	52                   	push   %edx
+     4af:	52                   	push   %edx
+     4b0:	68 ad 10 00 00       	push   $0x10ad
+     4b5:	6a 02                	push   $0x2
+     4b7:	e8 74 05 00 00       	call   a30 <printf>
+    exit();
+     4bc:	e8 f2 03 00 00       	call   8b3 <exit>
+    close(startfd[1]);
+     4c1:	83 ec 0c             	sub    $0xc,%esp
+     4c4:	ff 73 04             	push   0x4(%ebx)
+     4c7:	e8 0f 04 00 00       	call   8db <close>
+    read(startfd[0], &c, 1);
+     4cc:	83 c4 0c             	add    $0xc,%esp
+     4cf:	8d 45 f7             	lea    -0x9(%ebp),%eax
+     4d2:	6a 01                	push   $0x1
+     4d4:	50                   	push   %eax
+     4d5:	ff 33                	push   (%ebx)
+     4d7:	e8 ef 03 00 00       	call   8cb <read>
+    close(startfd[0]);
+     4dc:	58                   	pop    %eax
+     4dd:	ff 33                	push   (%ebx)
+     4df:	e8 f7 03 00 00       	call   8db <close>
+    fn();
+     4e4:	ff d6                	call   *%esi
+    exit();
+     4e6:	e8 c8 03 00 00       	call   8b3 <exit>
+     4eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     4ef:	90                   	nop
+
+000004f0 <rpc>:
+{
+     4f0:	55                   	push   %ebp
+     4f1:	89 e5                	mov    %esp,%ebp
+     4f3:	57                   	push   %edi
+     4f4:	89 d7                	mov    %edx,%edi
+     4f6:	56                   	push   %esi
+  pipe(startfd);
+     4f7:	8d 75 d4             	lea    -0x2c(%ebp),%esi
+{
+     4fa:	53                   	push   %ebx
+     4fb:	83 ec 48             	sub    $0x48,%esp
+     4fe:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  pipe(startfd);
+     501:	56                   	push   %esi
+     502:	e8 bc 03 00 00       	call   8c3 <pipe>
+  pipe(reqfd);
+     507:	c7 04 24 b4 16 00 00 	movl   $0x16b4,(%esp)
+     50e:	e8 b0 03 00 00       	call   8c3 <pipe>
+  pipe(repfd);
+     513:	c7 04 24 ac 16 00 00 	movl   $0x16ac,(%esp)
+     51a:	e8 a4 03 00 00       	call   8c3 <pipe>
+  srvpid = pids[0] = spawn(startfd, server);
+     51f:	ba 10 04 00 00       	mov    $0x410,%edx
+     524:	89 f0                	mov    %esi,%eax
+  lending = lend;
+     526:	89 7d c0             	mov    %edi,-0x40(%ebp)
+     529:	89 3d a4 16 00 00    	mov    %edi,0x16a4
+  srvpid = pids[0] = spawn(startfd, server);
+     52f:	e8 5c ff ff ff       	call   490 <spawn>
+  pids[1] = spawn(startfd, client);
+     534:	ba 80 03 00 00       	mov    $0x380,%edx
+  srvpid = pids[0] = spawn(startfd, server);
+     539:	89 c3                	mov    %eax,%ebx
+     53b:	89 45 dc             	mov    %eax,-0x24(%ebp)
+     53e:	a3 a8 16 00 00       	mov    %eax,0x16a8
+  pids[1] = spawn(startfd, client);
+     543:	89 f0                	mov    %esi,%eax
+     545:	e8 46 ff ff ff       	call   490 <spawn>
+  pids[2] = spawn(startfd, spin);
+     54a:	ba e0 02 00 00       	mov    $0x2e0,%edx
+  pids[1] = spawn(startfd, client);
+     54f:	89 c7                	mov    %eax,%edi
+     551:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  pids[2] = spawn(startfd, spin);
+     554:	89 f0                	mov    %esi,%eax
+     556:	e8 35 ff ff ff       	call   490 <spawn>
+     55b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     55e:	89 c6                	mov    %eax,%esi
+  settickets(pids[0], 1);
+     560:	58                   	pop    %eax
+     561:	5a                   	pop    %edx
+     562:	6a 01                	push   $0x1
+     564:	53                   	push   %ebx
+     565:	e8 11 04 00 00       	call   97b <settickets>
+  settickets(pids[1], DEFTICKETS);
+     56a:	59                   	pop    %ecx
+     56b:	58                   	pop    %eax
+     56c:	68 00 04 00 00       	push   $0x400
+     571:	57                   	push   %edi
+     572:	e8 04 04 00 00       	call   97b <settickets>
+  settickets(pids[2], DEFTICKETS);
+     577:	58                   	pop    %eax
+     578:	5a                   	pop    %edx
+     579:	68 00 04 00 00       	push   $0x400
+     57e:	56                   	push   %esi
+     57f:	e8 f7 03 00 00       	call   97b <settickets>
+  close(reqfd[0]);
+     584:	59                   	pop    %ecx
+     585:	ff 35 b4 16 00 00    	push   0x16b4
+     58b:	e8 4b 03 00 00       	call   8db <close>
+  close(reqfd[1]);
+     590:	58                   	pop    %eax
+     591:	ff 35 b8 16 00 00    	push   0x16b8
+     597:	e8 3f 03 00 00       	call   8db <close>
+  close(repfd[0]);
+     59c:	58                   	pop    %eax
+     59d:	ff 35 ac 16 00 00    	push   0x16ac
+     5a3:	e8 33 03 00 00       	call   8db <close>
+  close(repfd[1]);
+     5a8:	58                   	pop    %eax
+     5a9:	ff 35 b0 16 00 00    	push   0x16b0
+     5af:	e8 27 03 00 00       	call   8db <close>
+  close(startfd[0]);
+     5b4:	58                   	pop    %eax
+     5b5:	ff 75 d4             	push   -0x2c(%ebp)
+     5b8:	e8 1e 03 00 00       	call   8db <close>
+  close(startfd[1]);
+     5bd:	58                   	pop    %eax
+     5be:	ff 75 d8             	push   -0x28(%ebp)
+     5c1:	e8 15 03 00 00       	call   8db <close>
+  sleep(dur);
+     5c6:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+     5c9:	89 0c 24             	mov    %ecx,(%esp)
+     5cc:	e8 72 03 00 00       	call   943 <sleep>
+  s = runticks(pids[0]);
+     5d1:	89 d8                	mov    %ebx,%eax
+     5d3:	e8 28 fd ff ff       	call   300 <runticks>
+     5d8:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  c = runticks(pids[1]);
+     5db:	89 f8                	mov    %edi,%eax
+     5dd:	e8 1e fd ff ff       	call   300 <runticks>
+     5e2:	89 c7                	mov    %eax,%edi
+  h = runticks(pids[2]);
+     5e4:	89 f0                	mov    %esi,%eax
+  stop(pids, 3);
+     5e6:	8d 75 dc             	lea    -0x24(%ebp),%esi
+  h = runticks(pids[2]);
+     5e9:	e8 12 fd ff ff       	call   300 <runticks>
+  stop(pids, 3);
+     5ee:	ba 03 00 00 00       	mov    $0x3,%edx
+  h = runticks(pids[2]);
+     5f3:	89 c3                	mov    %eax,%ebx
+  stop(pids, 3);
+     5f5:	89 f0                	mov    %esi,%eax
+     5f7:	e8 34 fd ff ff       	call   330 <stop>
+  sum = s + c + h;
+     5fc:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+     5ff:	8d 34 3a             	lea    (%edx,%edi,1),%esi
+  share = (s + c) * 1000 / sum;
+     602:	ba 01 00 00 00       	mov    $0x1,%edx
+     607:	69 c6 e8 03 00 00    	imul   $0x3e8,%esi,%eax
+  sum = s + c + h;
+     60d:	01 de                	add    %ebx,%esi
+  share = (s + c) * 1000 / sum;
+     60f:	0f 44 f2             	cmove  %edx,%esi
+     612:	31 d2                	xor    %edx,%edx
+  printf(1, "[RPC] transfer=%s server %d client %d hog %d ticks, "
+     614:	83 c4 10             	add    $0x10,%esp
+  share = (s + c) * 1000 / sum;
+     617:	f7 f6                	div    %esi
+  printf(1, "[RPC] transfer=%s server %d client %d hog %d ticks, "
+     619:	ba 67 66 66 66       	mov    $0x66666667,%edx
+  share = (s + c) * 1000 / sum;
+     61e:	89 c1                	mov    %eax,%ecx
+  printf(1, "[RPC] transfer=%s server %d client %d hog %d ticks, "
+     620:	f7 ea                	imul   %edx
+     622:	89 c8                	mov    %ecx,%eax
+     624:	c1 f8 1f             	sar    $0x1f,%eax
+     627:	c1 fa 02             	sar    $0x2,%edx
+     62a:	29 c2                	sub    %eax,%edx
+     62c:	8d 34 92             	lea    (%edx,%edx,4),%esi
+     62f:	89 d0                	mov    %edx,%eax
+     631:	01 f6                	add    %esi,%esi
+     633:	29 f1                	sub    %esi,%ecx
+     635:	be c6 10 00 00       	mov    $0x10c6,%esi
+     63a:	89 ca                	mov    %ecx,%edx
+     63c:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+     63f:	52                   	push   %edx
+     640:	85 c9                	test   %ecx,%ecx
+     642:	b9 ca 10 00 00       	mov    $0x10ca,%ecx
+     647:	50                   	push   %eax
+     648:	0f 45 ce             	cmovne %esi,%ecx
+     64b:	53                   	push   %ebx
+     64c:	57                   	push   %edi
+     64d:	ff 75 c4             	push   -0x3c(%ebp)
+     650:	51                   	push   %ecx
+     651:	68 f0 10 00 00       	push   $0x10f0
+     656:	6a 01                	push   $0x1
+     658:	e8 d3 03 00 00       	call   a30 <printf>
+}
+     65d:	83 c4 20             	add    $0x20,%esp
+     660:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     663:	5b                   	pop    %ebx
+     664:	5e                   	pop    %esi
+     665:	5f                   	pop    %edi
+     666:	5d                   	pop    %ebp
+     667:	c3                   	ret
+     668:	66 90                	xchg   %ax,%ax
+     66a:	66 90                	xchg   %ax,%ax
+     66c:	66 90                	xchg   %ax,%ax
+     66e:	66 90                	xchg   %ax,%ax
+
+00000670 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     670:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     671:	31 c0                	xor    %eax,%eax
+{
+     673:	89 e5                	mov    %esp,%ebp
+     675:	53                   	push   %ebx
+     676:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     679:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     67c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     680:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     684:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     687:	83 c0 01             	add    $0x1,%eax
+     68a:	84 d2                	test   %dl,%dl
+     68c:	75 f2                	jne    680 <strcpy+0x10>
+    ;
+  return os;
+}
+     68e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     691:	89 c8                	mov    %ecx,%eax
+     693:	c9                   	leave
+     694:	c3                   	ret
+     695:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     6a0:	55                   	push   %ebp
+     6a1:	89 e5                	mov    %esp,%ebp
+     6a3:	53                   	push   %ebx
+     6a4:	8b 55 08             	mov    0x8(%ebp),%edx
+     6a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     6aa:	0f b6 02             	movzbl (%edx),%eax
+     6ad:	84 c0                	test   %al,%al
+     6af:	75 17                	jne    6c8 <strcmp+0x28>
+     6b1:	eb 3a                	jmp    6ed <strcmp+0x4d>
+     6b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6b7:	90                   	nop
+     6b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     6bc:	83 c2 01             	add    $0x1,%edx
+     6bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     6c2:	84 c0                	test   %al,%al
+     6c4:	74 1a                	je     6e0 <strcmp+0x40>
+    p++, q++;
+     6c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     6c8:	0f b6 19             	movzbl (%ecx),%ebx
+     6cb:	38 c3                	cmp    %al,%bl
+     6cd:	74 e9                	je     6b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     6cf:	29 d8                	sub    %ebx,%eax
+}
+     6d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6d4:	c9                   	leave
+     6d5:	c3                   	ret
+     6d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     6e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     6e4:	31 c0                	xor    %eax,%eax
+     6e6:	29 d8                	sub    %ebx,%eax
+}
+     6e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     6eb:	c9                   	leave
+     6ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     6ed:	0f b6 19             	movzbl (%ecx),%ebx
+     6f0:	31 c0                	xor    %eax,%eax
+     6f2:	eb db                	jmp    6cf <strcmp+0x2f>
+     6f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6ff:	90                   	nop
+
+00000700 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     700:	55                   	push   %ebp
+     701:	89 e5                	mov    %esp,%ebp
+     703:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     706:	80 3a 00             	cmpb   $0x0,(%edx)
+     709:	74 15                	je     720 <strlen+0x20>
+     70b:	31 c0                	xor    %eax,%eax
+     70d:	8d 76 00             	lea    0x0(%esi),%esi
+     710:	83 c0 01             	add    $0x1,%eax
+     713:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     717:	89 c1                	mov    %eax,%ecx
+     719:	75 f5                	jne    710 <strlen+0x10>
+    ;
+  return n;
+}
+     71b:	89 c8                	mov    %ecx,%eax
+     71d:	5d                   	pop    %ebp
+     71e:	c3                   	ret
+     71f:	90                   	nop
+  for(n = 0; s[n]; n++)
+     720:	31 c9                	xor    %ecx,%ecx
+}
+     722:	5d                   	pop    %ebp
+     723:	89 c8                	mov    %ecx,%eax
+     725:	c3                   	ret
+     726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     72d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000730 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     730:	55                   	push   %ebp
+     731:	89 e5                	mov    %esp,%ebp
+     733:	57                   	push   %edi
+     734:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     737:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     73a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     73d:	89 d7                	mov    %edx,%edi
+     73f:	fc                   	cld
+     740:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     742:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     745:	89 d0                	mov    %edx,%eax
+     747:	c9                   	leave
+     748:	c3                   	ret
+     749:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000750 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     750:	55                   	push   %ebp
+     751:	89 e5                	mov    %esp,%ebp
+     753:	8b 45 08             	mov    0x8(%ebp),%eax
+     756:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     75a:	0f b6 10             	movzbl (%eax),%edx
+     75d:	84 d2                	test   %dl,%dl
+     75f:	75 12                	jne    773 <strchr+0x23>
+     761:	eb 1d                	jmp    780 <strchr+0x30>
+     763:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     767:	90                   	nop
+     768:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     76c:	83 c0 01             	add    $0x1,%eax
+     76f:	84 d2                	test   %dl,%dl
+     771:	74 0d                	je     780 <strchr+0x30>
+    if(*s == c)
+     773:	38 d1                	cmp    %dl,%cl
+     775:	75 f1                	jne    768 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     777:	5d                   	pop    %ebp
+     778:	c3                   	ret
+     779:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     780:	31 c0                	xor    %eax,%eax
+}
+     782:	5d                   	pop    %ebp
+     783:	c3                   	ret
+     784:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     78b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     78f:	90                   	nop
+
+00000790 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     790:	55                   	push   %ebp
+     791:	89 e5                	mov    %esp,%ebp
+     793:	57                   	push   %edi
+     794:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     795:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     798:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     799:	31 db                	xor    %ebx,%ebx
+{
+     79b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     79e:	eb 27                	jmp    7c7 <gets+0x37>
+    cc = read(0, &c, 1);
+     7a0:	83 ec 04             	sub    $0x4,%esp
+     7a3:	6a 01                	push   $0x1
+     7a5:	56                   	push   %esi
+     7a6:	6a 00                	push   $0x0
+     7a8:	e8 1e 01 00 00       	call   8cb <read>
+    if(cc < 1)
+     7ad:	83 c4 10             	add    $0x10,%esp
+     7b0:	85 c0                	test   %eax,%eax
+     7b2:	7e 1d                	jle    7d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+     7b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     7b8:	8b 55 08             	mov    0x8(%ebp),%edx
+     7bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     7bf:	3c 0a                	cmp    $0xa,%al
+     7c1:	74 10                	je     7d3 <gets+0x43>
+     7c3:	3c 0d                	cmp    $0xd,%al
+     7c5:	74 0c                	je     7d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     7c7:	89 df                	mov    %ebx,%edi
+     7c9:	83 c3 01             	add    $0x1,%ebx
+     7cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     7cf:	7c cf                	jl     7a0 <gets+0x10>
+     7d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     7d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     7d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     7da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     7dd:	5b                   	pop    %ebx
+     7de:	5e                   	pop    %esi
+     7df:	5f                   	pop    %edi
+     7e0:	5d                   	pop    %ebp
+     7e1:	c3                   	ret
+     7e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000007f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     7f0:	55                   	push   %ebp
+     7f1:	89 e5                	mov    %esp,%ebp
+     7f3:	56                   	push   %esi
+     7f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     7f5:	83 ec 08             	sub    $0x8,%esp
+     7f8:	6a 00                	push   $0x0
+     7fa:	ff 75 08             	push   0x8(%ebp)
+     7fd:	e8 f1 00 00 00       	call   8f3 <open>
+  if(fd < 0)
+     802:	83 c4 10             	add    $0x10,%esp
+     805:	85 c0                	test   %eax,%eax
+     807:	78 27                	js     830 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     809:	83 ec 08             	sub    $0x8,%esp
+     80c:	ff 75 0c             	push   0xc(%ebp)
+     80f:	89 c3                	mov    %eax,%ebx
+     811:	50                   	push   %eax
+     812:	e8 f4 00 00 00       	call   90b <fstat>
+  close(fd);
+     817:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     81a:	89 c6                	mov    %eax,%esi
+  close(fd);
+     81c:	e8 ba 00 00 00       	call   8db <close>
+  return r;
+     821:	83 c4 10             	add    $0x10,%esp
+}
+     824:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     827:	89 f0                	mov    %esi,%eax
+     829:	5b                   	pop    %ebx
+     82a:	5e                   	pop    %esi
+     82b:	5d                   	pop    %ebp
+     82c:	c3                   	ret
+     82d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     830:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     835:	eb ed                	jmp    824 <stat+0x34>
+     837:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     83e:	66 90                	xchg   %ax,%ax
+
+00000840 <atoi>:
+
+int
+atoi(const char *s)
+{
+     840:	55                   	push   %ebp
+     841:	89 e5                	mov    %esp,%ebp
+     843:	53                   	push   %ebx
+     844:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     847:	0f be 02             	movsbl (%edx),%eax
+     84a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     84d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     850:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     855:	77 1e                	ja     875 <atoi+0x35>
+     857:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     85e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     860:	83 c2 01             	add    $0x1,%edx
+     863:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     866:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     86a:	0f be 02             	movsbl (%edx),%eax
+     86d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     870:	80 fb 09             	cmp    $0x9,%bl
+     873:	76 eb                	jbe    860 <atoi+0x20>
+  return n;
+}
+     875:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     878:	89 c8                	mov    %ecx,%eax
+     87a:	c9                   	leave
+     87b:	c3                   	ret
+     87c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000880 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     880:	55                   	push   %ebp
+     881:	89 e5                	mov    %esp,%ebp
+     883:	57                   	push   %edi
+     884:	56                   	push   %esi
+     885:	8b 45 10             	mov    0x10(%ebp),%eax
+     888:	8b 55 08             	mov    0x8(%ebp),%edx
+     88b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     88e:	85 c0                	test   %eax,%eax
+     890:	7e 13                	jle    8a5 <memmove+0x25>
+     892:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     894:	89 d7                	mov    %edx,%edi
+     896:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     89d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     8a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     8a1:	39 f8                	cmp    %edi,%eax
+     8a3:	75 fb                	jne    8a0 <memmove+0x20>
+  return vdst;
+}
+     8a5:	5e                   	pop    %esi
+     8a6:	89 d0                	mov    %edx,%eax
+     8a8:	5f                   	pop    %edi
+     8a9:	5d                   	pop    %ebp
+     8aa:	c3                   	ret
+
+000008ab <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     8ab:	b8 01 00 00 00       	mov    $0x1,%eax
+     8b0:	cd 40                	int    $0x40
+     8b2:	c3                   	ret
+
+000008b3 <exit>:
+SYSCALL(exit)
+     8b3:	b8 02 00 00 00       	mov    $0x2,%eax
+     8b8:	cd 40                	int    $0x40
+     8ba:	c3                   	ret
+
+000008bb <wait>:
+SYSCALL(wait)
+     8bb:	b8 03 00 00 00       	mov    $0x3,%eax
+     8c0:	cd 40                	int    $0x40
+     8c2:	c3                   	ret
+
+000008c3 <pipe>:
+SYSCALL(pipe)
+     8c3:	b8 04 00 00 00       	mov    $0x4,%eax
+     8c8:	cd 40                	int    $0x40
+     8ca:	c3                   	ret
+
+000008cb <read>:
+SYSCALL(read)
+     8cb:	b8 05 00 00 00       	mov    $0x5,%eax
+     8d0:	cd 40                	int    $0x40
+     8d2:	c3                   	ret
+
+000008d3 <write>:
+SYSCALL(write)
+     8d3:	b8 10 00 00 00       	mov    $0x10,%eax
+     8d8:	cd 40                	int    $0x40
+     8da:	c3                   	ret
+
+000008db <close>:
+SYSCALL(close)
+     8db:	b8 15 00 00 00       	mov    $0x15,%eax
+     8e0:	cd 40                	int    $0x40
+     8e2:	c3                   	ret
+
+000008e3 <kill>:
+SYSCALL(kill)
+     8e3:	b8 06 00 00 00       	mov    $0x6,%eax
+     8e8:	cd 40                	int    $0x40
+     8ea:	c3                   	ret
+
+000008eb <exec>:
+SYSCALL(exec)
+     8eb:	b8 07 00 00 00       	mov    $0x7,%eax
+     8f0:	cd 40                	int    $0x40
+     8f2:	c3                   	ret
+
+000008f3 <open>:
+SYSCALL(open)
+     8f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+     8f8:	cd 40                	int    $0x40
+     8fa:	c3                   	ret
+
+000008fb <mknod>:
+SYSCALL(mknod)
+     8fb:	b8 11 00 00 00       	mov    $0x11,%eax
+     900:	cd 40                	int    $0x40
+     902:	c3                   	ret
+
+00000903 <unlink>:
+SYSCALL(unlink)
+     903:	b8 12 00 00 00       	mov    $0x12,%eax
+     908:	cd 40                	int    $0x40
+     90a:	c3                   	ret
+
+0000090b <fstat>:
+SYSCALL(fstat)
+     90b:	b8 08 00 00 00       	mov    $0x8,%eax
+     910:	cd 40                	int    $0x40
+     912:	c3                   	ret
+
+00000913 <link>:
+SYSCALL(link)
+     913:	b8 13 00 00 00       	mov    $0x13,%eax
+     918:	cd 40                	int    $0x40
+     91a:	c3                   	ret
+
+0000091b <mkdir>:
+SYSCALL(mkdir)
+     91b:	b8 14 00 00 00       	mov    $0x14,%eax
+     920:	cd 40                	int    $0x40
+     922:	c3                   	ret
+
+00000923 <chdir>:
+SYSCALL(chdir)
+     923:	b8 09 00 00 00       	mov    $0x9,%eax
+     928:	cd 40                	int    $0x40
+     92a:	c3                   	ret
+
+0000092b <dup>:
+SYSCALL(dup)
+     92b:	b8 0a 00 00 00       	mov    $0xa,%eax
+     930:	cd 40                	int    $0x40
+     932:	c3                   	ret
+
+00000933 <getpid>:
+SYSCALL(getpid)
+     933:	b8 0b 00 00 00       	mov    $0xb,%eax
+     938:	cd 40                	int    $0x40
+     93a:	c3                   	ret
+
+0000093b <sbrk>:
+SYSCALL(sbrk)
+     93b:	b8 0c 00 00 00       	mov    $0xc,%eax
+     940:	cd 40                	int    $0x40
+     942:	c3                   	ret
+
+00000943 <sleep>:
+SYSCALL(sleep)
+     943:	b8 0d 00 00 00       	mov    $0xd,%eax
+     948:	cd 40                	int    $0x40
+     94a:	c3                   	ret
+
+0000094b <uptime>:
+SYSCALL(uptime)
+     94b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     950:	cd 40                	int    $0x40
+     952:	c3                   	ret
+
+00000953 <nice>:
+SYSCALL(nice)
+     953:	b8 16 00 00 00       	mov    $0x16,%eax
+     958:	cd 40                	int    $0x40
+     95a:	c3                   	ret
+
+0000095b <fsync>:
+SYSCALL(fsync)
+     95b:	b8 17 00 00 00       	mov    $0x17,%eax
+     960:	cd 40                	int    $0x40
+     962:	c3                   	ret
+
+00000963 <getpstat>:
+SYSCALL(getpstat)
+     963:	b8 18 00 00 00       	mov    $0x18,%eax
+     968:	cd 40                	int    $0x40
+     96a:	c3                   	ret
+
+0000096b <pipesize>:
+SYSCALL(pipesize)
+     96b:	b8 19 00 00 00       	mov    $0x19,%eax
+     970:	cd 40                	int    $0x40
+     972:	c3                   	ret
+
+00000973 <uptimens>:
+SYSCALL(uptimens)
+     973:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     978:	cd 40                	int    $0x40
+     97a:	c3                   	ret
+
+0000097b <settickets>:
+SYSCALL(settickets)
+     97b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     980:	cd 40                	int    $0x40
+     982:	c3                   	ret
+
+00000983 <transfer>:
+SYSCALL(transfer)
+     983:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     988:	cd 40                	int    $0x40
+     98a:	c3                   	ret
+     98b:	66 90                	xchg   %ax,%ax
+     98d:	66 90                	xchg   %ax,%ax
+     98f:	90                   	nop
+
+00000990 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     990:	55                   	push   %ebp
+     991:	89 e5                	mov    %esp,%ebp
+     993:	57                   	push   %edi
+     994:	56                   	push   %esi
+     995:	53                   	push   %ebx
+     996:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     998:	89 d1                	mov    %edx,%ecx
+{
+     99a:	83 ec 3c             	sub    $0x3c,%esp
+     99d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     9a0:	85 d2                	test   %edx,%edx
+     9a2:	0f 89 80 00 00 00    	jns    a28 <printint+0x98>
+     9a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     9ac:	74 7a                	je     a28 <printint+0x98>
+    x = -xx;
+     9ae:	f7 d9                	neg    %ecx
+    neg = 1;
+     9b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     9b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     9b8:	31 f6                	xor    %esi,%esi
+     9ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     9c0:	89 c8                	mov    %ecx,%eax
+     9c2:	31 d2                	xor    %edx,%edx
+     9c4:	89 f7                	mov    %esi,%edi
+     9c6:	f7 f3                	div    %ebx
+     9c8:	8d 76 01             	lea    0x1(%esi),%esi
+     9cb:	0f b6 92 24 12 00 00 	movzbl 0x1224(%edx),%edx
+     9d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     9d6:	89 ca                	mov    %ecx,%edx
+     9d8:	89 c1                	mov    %eax,%ecx
+     9da:	39 da                	cmp    %ebx,%edx
+     9dc:	73 e2                	jae    9c0 <printint+0x30>
+  if(neg)
+     9de:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     9e1:	85 c0                	test   %eax,%eax
+     9e3:	74 07                	je     9ec <printint+0x5c>
+    buf[i++] = '-';
+     9e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     9ea:	89 f7                	mov    %esi,%edi
+     9ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     9ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     9f2:	01 df                	add    %ebx,%edi
+     9f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     9f8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     9fb:	83 ec 04             	sub    $0x4,%esp
+     9fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+     a01:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     a04:	6a 01                	push   $0x1
+     a06:	50                   	push   %eax
+     a07:	56                   	push   %esi
+     a08:	e8 c6 fe ff ff       	call   8d3 <write>
+  while(--i >= 0)
+     a0d:	89 f8                	mov    %edi,%eax
+     a0f:	83 c4 10             	add    $0x10,%esp
+     a12:	83 ef 01             	sub    $0x1,%edi
+     a15:	39 d8                	cmp    %ebx,%eax
+     a17:	75 df                	jne    9f8 <printint+0x68>
+}
+     a19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a1c:	5b                   	pop    %ebx
+     a1d:	5e                   	pop    %esi
+     a1e:	5f                   	pop    %edi
+     a1f:	5d                   	pop    %ebp
+     a20:	c3                   	ret
+     a21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     a28:	31 c0                	xor    %eax,%eax
+     a2a:	eb 89                	jmp    9b5 <printint+0x25>
+     a2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a30 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     a30:	55                   	push   %ebp
+     a31:	89 e5                	mov    %esp,%ebp
+     a33:	57                   	push   %edi
+     a34:	56                   	push   %esi
+     a35:	53                   	push   %ebx
+     a36:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     a39:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     a3c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     a3f:	0f b6 1e             	movzbl (%esi),%ebx
+     a42:	83 c6 01             	add    $0x1,%esi
+     a45:	84 db                	test   %bl,%bl
+     a47:	74 67                	je     ab0 <printf+0x80>
+     a49:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     a4c:	31 d2                	xor    %edx,%edx
+     a4e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     a51:	eb 34                	jmp    a87 <printf+0x57>
+     a53:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a57:	90                   	nop
+     a58:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     a5b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     a60:	83 f8 25             	cmp    $0x25,%eax
+     a63:	74 18                	je     a7d <printf+0x4d>
+  write(fd, &c, 1);
+     a65:	83 ec 04             	sub    $0x4,%esp
+     a68:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     a6b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     a6e:	6a 01                	push   $0x1
+     a70:	50                   	push   %eax
+     a71:	57                   	push   %edi
+     a72:	e8 5c fe ff ff       	call   8d3 <write>
+     a77:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     a7a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     a7d:	0f b6 1e             	movzbl (%esi),%ebx
+     a80:	83 c6 01             	add    $0x1,%esi
+     a83:	84 db                	test   %bl,%bl
+     a85:	74 29                	je     ab0 <printf+0x80>
+    c = fmt[i] & 0xff;
+     a87:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     a8a:	85 d2                	test   %edx,%edx
+     a8c:	74 ca                	je     a58 <printf+0x28>
+      }
+    } else if(state == '%'){
+     a8e:	83 fa 25             	cmp    $0x25,%edx
+     a91:	75 ea                	jne    a7d <printf+0x4d>
+      if(c == 'd'){
+     a93:	83 f8 25             	cmp    $0x25,%eax
+     a96:	0f 84 24 01 00 00    	je     bc0 <printf+0x190>
+     a9c:	83 e8 63             	sub    $0x63,%eax
+     a9f:	83 f8 15             	cmp    $0x15,%eax
+     aa2:	77 1c                	ja     ac0 <printf+0x90>
+     aa4:	ff 24 85 cc 11 00 00 	jmp    *0x11cc(,%eax,4)
+     aab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     aaf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     ab0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ab3:	5b                   	pop    %ebx
+     ab4:	5e                   	pop    %esi
+     ab5:	5f                   	pop    %edi
+     ab6:	5d                   	pop    %ebp
+     ab7:	c3                   	ret
+     ab8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     abf:	90                   	nop
+  write(fd, &c, 1);
+     ac0:	83 ec 04             	sub    $0x4,%esp
+     ac3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     ac6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     aca:	6a 01                	push   $0x1
+     acc:	52                   	push   %edx
+     acd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     ad0:	57                   	push   %edi
+     ad1:	e8 fd fd ff ff       	call   8d3 <write>
+     ad6:	83 c4 0c             	add    $0xc,%esp
+     ad9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     adc:	6a 01                	push   $0x1
+     ade:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     ae1:	52                   	push   %edx
+     ae2:	57                   	push   %edi
+     ae3:	e8 eb fd ff ff       	call   8d3 <write>
+        putc(fd, c);
+     ae8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     aeb:	31 d2                	xor    %edx,%edx
+     aed:	eb 8e                	jmp    a7d <printf+0x4d>
+     aef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     af0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     af3:	83 ec 0c             	sub    $0xc,%esp
+     af6:	b9 10 00 00 00       	mov    $0x10,%ecx
+     afb:	8b 13                	mov    (%ebx),%edx
+     afd:	6a 00                	push   $0x0
+     aff:	89 f8                	mov    %edi,%eax
+        ap++;
+     b01:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     b04:	e8 87 fe ff ff       	call   990 <printint>
+        ap++;
+     b09:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     b0c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     b0f:	31 d2                	xor    %edx,%edx
+     b11:	e9 67 ff ff ff       	jmp    a7d <printf+0x4d>
+     b16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b1d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     b20:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     b23:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     b25:	83 c0 04             	add    $0x4,%eax
+     b28:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     b2b:	85 db                	test   %ebx,%ebx
+     b2d:	0f 84 9d 00 00 00    	je     bd0 <printf+0x1a0>
+        while(*s != 0){
+     b33:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     b36:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     b38:	84 c0                	test   %al,%al
+     b3a:	0f 84 3d ff ff ff    	je     a7d <printf+0x4d>
+     b40:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     b43:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     b46:	89 de                	mov    %ebx,%esi
+     b48:	89 d3                	mov    %edx,%ebx
+     b4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     b50:	83 ec 04             	sub    $0x4,%esp
+     b53:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     b56:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     b59:	6a 01                	push   $0x1
+     b5b:	53                   	push   %ebx
+     b5c:	57                   	push   %edi
+     b5d:	e8 71 fd ff ff       	call   8d3 <write>
+        while(*s != 0){
+     b62:	0f b6 06             	movzbl (%esi),%eax
+     b65:	83 c4 10             	add    $0x10,%esp
+     b68:	84 c0                	test   %al,%al
+     b6a:	75 e4                	jne    b50 <printf+0x120>
+      state = 0;
+     b6c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     b6f:	31 d2                	xor    %edx,%edx
+     b71:	e9 07 ff ff ff       	jmp    a7d <printf+0x4d>
+     b76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b7d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     b80:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     b83:	83 ec 0c             	sub    $0xc,%esp
+     b86:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     b8b:	8b 13                	mov    (%ebx),%edx
+     b8d:	6a 01                	push   $0x1
+     b8f:	e9 6b ff ff ff       	jmp    aff <printf+0xcf>
+     b94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     b98:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     b9b:	83 ec 04             	sub    $0x4,%esp
+     b9e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+     ba1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+     ba3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+     ba6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     ba9:	6a 01                	push   $0x1
+     bab:	52                   	push   %edx
+     bac:	57                   	push   %edi
+     bad:	e8 21 fd ff ff       	call   8d3 <write>
+        ap++;
+     bb2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     bb5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     bb8:	31 d2                	xor    %edx,%edx
+     bba:	e9 be fe ff ff       	jmp    a7d <printf+0x4d>
+     bbf:	90                   	nop
+  write(fd, &c, 1);
+     bc0:	83 ec 04             	sub    $0x4,%esp
+     bc3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     bc6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     bc9:	6a 01                	push   $0x1
+     bcb:	e9 11 ff ff ff       	jmp    ae1 <printf+0xb1>
+     bd0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     bd5:	bb c4 11 00 00       	mov    $0x11c4,%ebx
+     bda:	e9 61 ff ff ff       	jmp    b40 <printf+0x110>
+     bdf:	90                   	nop
+
+00000be0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     be0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     be1:	a1 bc 16 00 00       	mov    0x16bc,%eax
+{
+     be6:	89 e5                	mov    %esp,%ebp
+     be8:	57                   	push   %edi
+     be9:	56                   	push   %esi
+     bea:	53                   	push   %ebx
+     beb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     bee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     bf1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bf8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     bfa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     bfc:	39 ca                	cmp    %ecx,%edx
+     bfe:	73 30                	jae    c30 <free+0x50>
+     c00:	39 c1                	cmp    %eax,%ecx
+     c02:	72 04                	jb     c08 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     c04:	39 c2                	cmp    %eax,%edx
+     c06:	72 f0                	jb     bf8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     c08:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     c0b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     c0e:	39 f8                	cmp    %edi,%eax
+     c10:	74 2e                	je     c40 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     c12:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     c15:	8b 42 04             	mov    0x4(%edx),%eax
+     c18:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     c1b:	39 f1                	cmp    %esi,%ecx
+     c1d:	74 38                	je     c57 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     c1f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     c21:	5b                   	pop    %ebx
+  freep = p;
+     c22:	89 15 bc 16 00 00    	mov    %edx,0x16bc
+}
+     c28:	5e                   	pop    %esi
+     c29:	5f                   	pop    %edi
+     c2a:	5d                   	pop    %ebp
+     c2b:	c3                   	ret
+     c2c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     c30:	39 c1                	cmp    %eax,%ecx
+     c32:	72 d0                	jb     c04 <free+0x24>
+     c34:	eb c2                	jmp    bf8 <free+0x18>
+     c36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c3d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     c40:	03 70 04             	add    0x4(%eax),%esi
+     c43:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     c46:	8b 02                	mov    (%edx),%eax
+     c48:	8b 00                	mov    (%eax),%eax
+     c4a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     c4d:	8b 42 04             	mov    0x4(%edx),%eax
+     c50:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     c53:	39 f1                	cmp    %esi,%ecx
+     c55:	75 c8                	jne    c1f <free+0x3f>
+    p->s.size += bp->s.size;
+     c57:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     c5a:	89 15 bc 16 00 00    	mov    %edx,0x16bc
+    p->s.size += bp->s.size;
+     c60:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     c63:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     c66:	89 0a                	mov    %ecx,(%edx)
+}
+     c68:	5b                   	pop    %ebx
+     c69:	5e                   	pop    %esi
+     c6a:	5f                   	pop    %edi
+     c6b:	5d                   	pop    %ebp
+     c6c:	c3                   	ret
+     c6d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c70 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     c70:	55                   	push   %ebp
+     c71:	89 e5                	mov    %esp,%ebp
+     c73:	57                   	push   %edi
+     c74:	56                   	push   %esi
+     c75:	53                   	push   %ebx
+     c76:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     c79:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     c7c:	8b 15 bc 16 00 00    	mov    0x16bc,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     c82:	8d 78 07             	lea    0x7(%eax),%edi
+     c85:	c1 ef 03             	shr    $0x3,%edi
+     c88:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     c8b:	85 d2                	test   %edx,%edx
+     c8d:	0f 84 8d 00 00 00    	je     d20 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     c93:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     c95:	8b 48 04             	mov    0x4(%eax),%ecx
+     c98:	39 f9                	cmp    %edi,%ecx
+     c9a:	73 64                	jae    d00 <malloc+0x90>
+  if(nu < 4096)
+     c9c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     ca1:	39 df                	cmp    %ebx,%edi
+     ca3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     ca6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     cad:	eb 0a                	jmp    cb9 <malloc+0x49>
+     caf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     cb0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     cb2:	8b 48 04             	mov    0x4(%eax),%ecx
+     cb5:	39 f9                	cmp    %edi,%ecx
+     cb7:	73 47                	jae    d00 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     cb9:	89 c2                	mov    %eax,%edx
+     cbb:	39 05 bc 16 00 00    	cmp    %eax,0x16bc
+     cc1:	75 ed                	jne    cb0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     cc3:	83 ec 0c             	sub    $0xc,%esp
+     cc6:	56                   	push   %esi
+     cc7:	e8 6f fc ff ff       	call   93b <sbrk>
+  if(p == (char*)-1)
+     ccc:	83 c4 10             	add    $0x10,%esp
+     ccf:	83 f8 ff             	cmp    $0xffffffff,%eax
+     cd2:	74 1c                	je     cf0 <malloc+0x80>
+  hp->s.size = nu;
+     cd4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+     cd7:	83 ec 0c             	sub    $0xc,%esp
+     cda:	83 c0 08             	add    $0x8,%eax
+     cdd:	50                   	push   %eax
+     cde:	e8 fd fe ff ff       	call   be0 <free>
+  return freep;
+     ce3:	8b 15 bc 16 00 00    	mov    0x16bc,%edx
+      if((p = morecore(nunits)) == 0)
+     ce9:	83 c4 10             	add    $0x10,%esp
+     cec:	85 d2                	test   %edx,%edx
+     cee:	75 c0                	jne    cb0 <malloc+0x40>
+        return 0;
+  }
+}
+     cf0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     cf3:	31 c0                	xor    %eax,%eax
+}
+     cf5:	5b                   	pop    %ebx
+     cf6:	5e                   	pop    %esi
+     cf7:	5f                   	pop    %edi
+     cf8:	5d                   	pop    %ebp
+     cf9:	c3                   	ret
+     cfa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     d00:	39 cf                	cmp    %ecx,%edi
+     d02:	74 4c                	je     d50 <malloc+0xe0>
+        p->s.size -= nunits;
+     d04:	29 f9                	sub    %edi,%ecx
+     d06:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+     d09:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+     d0c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+     d0f:	89 15 bc 16 00 00    	mov    %edx,0x16bc
+}
+     d15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     d18:	83 c0 08             	add    $0x8,%eax
+}
+     d1b:	5b                   	pop    %ebx
+     d1c:	5e                   	pop    %esi
+     d1d:	5f                   	pop    %edi
+     d1e:	5d                   	pop    %ebp
+     d1f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+     d20:	c7 05 bc 16 00 00 c0 	movl   $0x16c0,0x16bc
+     d27:	16 00 00 
+    base.s.size = 0;
+     d2a:	b8 c0 16 00 00       	mov    $0x16c0,%eax
+    base.s.ptr = freep = prevp = &base;
+     d2f:	c7 05 c0 16 00 00 c0 	movl   $0x16c0,0x16c0
+     d36:	16 00 00 
+    base.s.size = 0;
+     d39:	c7 05 c4 16 00 00 00 	movl   $0x0,0x16c4
+     d40:	00 00 00 
+    if(p->s.size >= nunits){
+     d43:	e9 54 ff ff ff       	jmp    c9c <malloc+0x2c>
+     d48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d4f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     d50:	8b 08                	mov    (%eax),%ecx
+     d52:	89 0a                	mov    %ecx,(%edx)
+     d54:	eb b9                	jmp    d0f <malloc+0x9f>
+     d56:	66 90                	xchg   %ax,%ax
+     d58:	66 90                	xchg   %ax,%ax
+     d5a:	66 90                	xchg   %ax,%ax
+     d5c:	66 90                	xchg   %ax,%ax
+     d5e:	66 90                	xchg   %ax,%ax
+
+00000d60 <pidstat>:
+
+// Fill in *st with the statistics of process pid.
+// Returns 0, or -1 if there is no such process.
+int
+pidstat(int pid, struct pstat *st)
+{
+     d60:	55                   	push   %ebp
+     d61:	89 e5                	mov    %esp,%ebp
+     d63:	56                   	push   %esi
+     d64:	53                   	push   %ebx
+  static struct pstat *ps;
+  int i, n;
+
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+     d65:	a1 c8 16 00 00       	mov    0x16c8,%eax
+{
+     d6a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     d6d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+     d70:	85 c0                	test   %eax,%eax
+     d72:	0f 84 98 00 00 00    	je     e10 <pidstat+0xb0>
+    return -1;
+  n = getpstat(ps, NPROC);
+     d78:	83 ec 08             	sub    $0x8,%esp
+     d7b:	6a 40                	push   $0x40
+     d7d:	50                   	push   %eax
+     d7e:	e8 e0 fb ff ff       	call   963 <getpstat>
+  for(i = 0; i < n; i++){
+     d83:	83 c4 10             	add    $0x10,%esp
+     d86:	85 c0                	test   %eax,%eax
+     d88:	0f 8e 9f 00 00 00    	jle    e2d <pidstat+0xcd>
+     d8e:	8b 15 c8 16 00 00    	mov    0x16c8,%edx
+     d94:	31 c9                	xor    %ecx,%ecx
+     d96:	eb 16                	jmp    dae <pidstat+0x4e>
+     d98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d9f:	90                   	nop
+     da0:	83 c1 01             	add    $0x1,%ecx
+     da3:	83 c2 38             	add    $0x38,%edx
+     da6:	39 c8                	cmp    %ecx,%eax
+     da8:	0f 84 7f 00 00 00    	je     e2d <pidstat+0xcd>
+    if(ps[i].pid == pid){
+     dae:	39 1a                	cmp    %ebx,(%edx)
+     db0:	75 ee                	jne    da0 <pidstat+0x40>
+      *st = ps[i];
+     db2:	89 1e                	mov    %ebx,(%esi)
+     db4:	8b 42 04             	mov    0x4(%edx),%eax
+     db7:	89 46 04             	mov    %eax,0x4(%esi)
+     dba:	8b 42 08             	mov    0x8(%edx),%eax
+     dbd:	89 46 08             	mov    %eax,0x8(%esi)
+     dc0:	8b 42 0c             	mov    0xc(%edx),%eax
+     dc3:	89 46 0c             	mov    %eax,0xc(%esi)
+     dc6:	8b 42 10             	mov    0x10(%edx),%eax
+     dc9:	89 46 10             	mov    %eax,0x10(%esi)
+     dcc:	8b 42 14             	mov    0x14(%edx),%eax
+     dcf:	89 46 14             	mov    %eax,0x14(%esi)
+     dd2:	8b 42 18             	mov    0x18(%edx),%eax
+     dd5:	89 46 18             	mov    %eax,0x18(%esi)
+     dd8:	8b 42 1c             	mov    0x1c(%edx),%eax
+     ddb:	89 46 1c             	mov    %eax,0x1c(%esi)
+     dde:	8b 42 20             	mov    0x20(%edx),%eax
+     de1:	89 46 20             	mov    %eax,0x20(%esi)
+     de4:	8b 42 24             	mov    0x24(%edx),%eax
+     de7:	89 46 24             	mov    %eax,0x24(%esi)
+     dea:	8b 42 28             	mov    0x28(%edx),%eax
+     ded:	89 46 28             	mov    %eax,0x28(%esi)
+     df0:	8b 42 2c             	mov    0x2c(%edx),%eax
+     df3:	89 46 2c             	mov    %eax,0x2c(%esi)
+     df6:	8b 42 30             	mov    0x30(%edx),%eax
+     df9:	89 46 30             	mov    %eax,0x30(%esi)
+     dfc:	8b 42 34             	mov    0x34(%edx),%eax
+     dff:	89 46 34             	mov    %eax,0x34(%esi)
+      return 0;
+    }
+  }
+  return -1;
+}
+     e02:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+     e05:	31 c0                	xor    %eax,%eax
+}
+     e07:	5b                   	pop    %ebx
+     e08:	5e                   	pop    %esi
+     e09:	5d                   	pop    %ebp
+     e0a:	c3                   	ret
+     e0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e0f:	90                   	nop
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+     e10:	83 ec 0c             	sub    $0xc,%esp
+     e13:	68 00 0e 00 00       	push   $0xe00
+     e18:	e8 53 fe ff ff       	call   c70 <malloc>
+     e1d:	83 c4 10             	add    $0x10,%esp
+     e20:	a3 c8 16 00 00       	mov    %eax,0x16c8
+     e25:	85 c0                	test   %eax,%eax
+     e27:	0f 85 4b ff ff ff    	jne    d78 <pidstat+0x18>
+}
+     e2d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return -1;
+     e30:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     e35:	5b                   	pop    %ebx
+     e36:	5e                   	pop    %esi
+     e37:	5d                   	pop    %ebp
+     e38:	c3                   	ret
+     e39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000e40 <sharetable>:
+// key[i] is printed in a column headed keyname, and so is
+// extra[i] under extraname unless extra is 0.
+void
+sharetable(char *tag, char *keyname, int *key, char *extraname, int *extra,
+           int n, int *pid, int *weight, uint *ticks)
+{
+     e40:	55                   	push   %ebp
+     e41:	89 e5                	mov    %esp,%ebp
+     e43:	57                   	push   %edi
+     e44:	56                   	push   %esi
+     e45:	53                   	push   %ebx
+     e46:	83 ec 3c             	sub    $0x3c,%esp
+     e49:	8b 45 08             	mov    0x8(%ebp),%eax
+     e4c:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+     e4f:	8b 75 24             	mov    0x24(%ebp),%esi
+     e52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     e55:	89 45 dc             	mov    %eax,-0x24(%ebp)
+     e58:	8b 45 10             	mov    0x10(%ebp),%eax
+     e5b:	89 7d d0             	mov    %edi,-0x30(%ebp)
+     e5e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+     e61:	89 45 cc             	mov    %eax,-0x34(%ebp)
+     e64:	8b 45 18             	mov    0x18(%ebp),%eax
+     e67:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     e6a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     e6d:	8b 45 20             	mov    0x20(%ebp),%eax
+     e70:	89 45 c8             	mov    %eax,-0x38(%ebp)
+     e73:	8b 45 28             	mov    0x28(%ebp),%eax
+     e76:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  int i, wsum, share, expect, err, maxerr;
+  uint tsum;
+
+  wsum = 0;
+  tsum = 0;
+  for(i = 0; i < n; i++){
+     e79:	85 ff                	test   %edi,%edi
+     e7b:	0f 8e df 01 00 00    	jle    1060 <sharetable+0x220>
+     e81:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+     e84:	89 fb                	mov    %edi,%ebx
+     e86:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  tsum = 0;
+     e89:	31 d2                	xor    %edx,%edx
+  for(i = 0; i < n; i++){
+     e8b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+     e8e:	31 c0                	xor    %eax,%eax
+     e90:	31 c9                	xor    %ecx,%ecx
+     e92:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wsum += weight[i];
+     e98:	03 0c 86             	add    (%esi,%eax,4),%ecx
+    tsum += ticks[i];
+     e9b:	03 14 87             	add    (%edi,%eax,4),%edx
+  for(i = 0; i < n; i++){
+     e9e:	83 c0 01             	add    $0x1,%eax
+     ea1:	39 c3                	cmp    %eax,%ebx
+     ea3:	75 f3                	jne    e98 <sharetable+0x58>
+     ea5:	85 d2                	test   %edx,%edx
+     ea7:	b8 01 00 00 00       	mov    $0x1,%eax
+     eac:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  }
+  if(tsum == 0)
+    tsum = 1;
+  if(wsum == 0)
+    wsum = 1;
+     eaf:	8b 7d d8             	mov    -0x28(%ebp),%edi
+     eb2:	0f 45 c2             	cmovne %edx,%eax
+     eb5:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+  if(tsum == 0)
+     eb8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    wsum = 1;
+     ebb:	85 ff                	test   %edi,%edi
+     ebd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+     ec0:	b8 01 00 00 00       	mov    $0x1,%eax
+     ec5:	0f 45 c7             	cmovne %edi,%eax
+     ec8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+
+  printf(1, "[%s]  pid %s ", tag, keyname);
+     ecb:	51                   	push   %ecx
+     ecc:	ff 75 dc             	push   -0x24(%ebp)
+     ecf:	68 35 12 00 00       	push   $0x1235
+     ed4:	6a 01                	push   $0x1
+     ed6:	e8 55 fb ff ff       	call   a30 <printf>
+  if(extra)
+     edb:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     ede:	83 c4 10             	add    $0x10,%esp
+     ee1:	85 f6                	test   %esi,%esi
+     ee3:	0f 84 47 01 00 00    	je     1030 <sharetable+0x1f0>
+    printf(1, "%s ", extraname);
+     ee9:	83 ec 04             	sub    $0x4,%esp
+     eec:	53                   	push   %ebx
+     eed:	68 3f 12 00 00       	push   $0x123f
+     ef2:	6a 01                	push   $0x1
+     ef4:	e8 37 fb ff ff       	call   a30 <printf>
+  printf(1, "ticks  share expected\n");
+     ef9:	58                   	pop    %eax
+     efa:	5a                   	pop    %edx
+     efb:	68 43 12 00 00       	push   $0x1243
+     f00:	6a 01                	push   $0x1
+     f02:	e8 29 fb ff ff       	call   a30 <printf>
+  maxerr = 0;
+  for(i = 0; i < n; i++){
+     f07:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+     f0a:	83 c4 10             	add    $0x10,%esp
+     f0d:	85 c9                	test   %ecx,%ecx
+     f0f:	0f 8e 44 01 00 00    	jle    1059 <sharetable+0x219>
+  if(extra)
+     f15:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+     f1c:	31 ff                	xor    %edi,%edi
+     f1e:	66 90                	xchg   %ax,%ax
+    share = ticks[i] * 1000 / tsum;
+     f20:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     f23:	31 d2                	xor    %edx,%edx
+    expect = weight[i] * 1000 / wsum;
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+     f25:	83 ec 0c             	sub    $0xc,%esp
+    share = ticks[i] * 1000 / tsum;
+     f28:	69 04 b8 e8 03 00 00 	imul   $0x3e8,(%eax,%edi,4),%eax
+     f2f:	f7 75 c0             	divl   -0x40(%ebp)
+     f32:	89 c6                	mov    %eax,%esi
+    expect = weight[i] * 1000 / wsum;
+     f34:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     f37:	69 04 b8 e8 03 00 00 	imul   $0x3e8,(%eax,%edi,4),%eax
+     f3e:	99                   	cltd
+     f3f:	f7 7d d8             	idivl  -0x28(%ebp)
+     f42:	89 c3                	mov    %eax,%ebx
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+     f44:	8b 45 cc             	mov    -0x34(%ebp),%eax
+     f47:	ff 34 b8             	push   (%eax,%edi,4)
+     f4a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+     f4d:	ff 34 b8             	push   (%eax,%edi,4)
+     f50:	ff 75 dc             	push   -0x24(%ebp)
+     f53:	68 5a 12 00 00       	push   $0x125a
+     f58:	6a 01                	push   $0x1
+     f5a:	e8 d1 fa ff ff       	call   a30 <printf>
+    if(extra)
+     f5f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     f62:	83 c4 20             	add    $0x20,%esp
+     f65:	85 c0                	test   %eax,%eax
+     f67:	74 15                	je     f7e <sharetable+0x13e>
+      printf(1, "%d ", extra[i]);
+     f69:	83 ec 04             	sub    $0x4,%esp
+     f6c:	ff 34 b8             	push   (%eax,%edi,4)
+     f6f:	68 62 12 00 00       	push   $0x1262
+     f74:	6a 01                	push   $0x1
+     f76:	e8 b5 fa ff ff       	call   a30 <printf>
+     f7b:	83 c4 10             	add    $0x10,%esp
+    printf(1, "%d %d.%d%% %d.%d%%\n", ticks[i], share / 10, share % 10,
+     f7e:	b8 67 66 66 66       	mov    $0x66666667,%eax
+     f83:	89 d9                	mov    %ebx,%ecx
+     f85:	83 ec 04             	sub    $0x4,%esp
+     f88:	f7 eb                	imul   %ebx
+     f8a:	89 d8                	mov    %ebx,%eax
+     f8c:	c1 f8 1f             	sar    $0x1f,%eax
+     f8f:	c1 fa 02             	sar    $0x2,%edx
+     f92:	29 c2                	sub    %eax,%edx
+     f94:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     f97:	01 c0                	add    %eax,%eax
+     f99:	29 c1                	sub    %eax,%ecx
+     f9b:	b8 67 66 66 66       	mov    $0x66666667,%eax
+     fa0:	51                   	push   %ecx
+     fa1:	89 f1                	mov    %esi,%ecx
+     fa3:	52                   	push   %edx
+     fa4:	f7 ee                	imul   %esi
+     fa6:	89 f0                	mov    %esi,%eax
+     fa8:	c1 f8 1f             	sar    $0x1f,%eax
+     fab:	c1 fa 02             	sar    $0x2,%edx
+     fae:	29 c2                	sub    %eax,%edx
+     fb0:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     fb3:	01 c0                	add    %eax,%eax
+     fb5:	29 c1                	sub    %eax,%ecx
+     fb7:	51                   	push   %ecx
+     fb8:	52                   	push   %edx
+     fb9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     fbc:	ff 34 b8             	push   (%eax,%edi,4)
+     fbf:	68 66 12 00 00       	push   $0x1266
+     fc4:	6a 01                	push   $0x1
+     fc6:	e8 65 fa ff ff       	call   a30 <printf>
+           expect / 10, expect % 10);
+    err = share > expect ? share - expect : expect - share;
+     fcb:	89 f2                	mov    %esi,%edx
+     fcd:	89 d8                	mov    %ebx,%eax
+     fcf:	83 c4 20             	add    $0x20,%esp
+     fd2:	29 f0                	sub    %esi,%eax
+     fd4:	29 da                	sub    %ebx,%edx
+     fd6:	39 de                	cmp    %ebx,%esi
+     fd8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     fdb:	0f 4f c2             	cmovg  %edx,%eax
+    if(err > maxerr)
+     fde:	39 c6                	cmp    %eax,%esi
+     fe0:	0f 4d c6             	cmovge %esi,%eax
+  for(i = 0; i < n; i++){
+     fe3:	83 c7 01             	add    $0x1,%edi
+     fe6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     fe9:	39 7d d0             	cmp    %edi,-0x30(%ebp)
+     fec:	0f 85 2e ff ff ff    	jne    f20 <sharetable+0xe0>
+      maxerr = err;
+  }
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+     ff2:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+     ff7:	f7 e2                	mul    %edx
+     ff9:	c1 ea 03             	shr    $0x3,%edx
+     ffc:	8d 0c 92             	lea    (%edx,%edx,4),%ecx
+     fff:	89 d0                	mov    %edx,%eax
+    1001:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    1004:	01 c9                	add    %ecx,%ecx
+    1006:	29 ca                	sub    %ecx,%edx
+    1008:	89 45 14             	mov    %eax,0x14(%ebp)
+    100b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    100e:	89 55 18             	mov    %edx,0x18(%ebp)
+    1011:	89 45 10             	mov    %eax,0x10(%ebp)
+    1014:	c7 45 0c 7c 12 00 00 	movl   $0x127c,0xc(%ebp)
+    101b:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+    1022:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1025:	5b                   	pop    %ebx
+    1026:	5e                   	pop    %esi
+    1027:	5f                   	pop    %edi
+    1028:	5d                   	pop    %ebp
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+    1029:	e9 02 fa ff ff       	jmp    a30 <printf>
+    102e:	66 90                	xchg   %ax,%ax
+  printf(1, "ticks  share expected\n");
+    1030:	83 ec 08             	sub    $0x8,%esp
+    1033:	68 43 12 00 00       	push   $0x1243
+    1038:	6a 01                	push   $0x1
+    103a:	e8 f1 f9 ff ff       	call   a30 <printf>
+    103f:	83 c4 10             	add    $0x10,%esp
+    1042:	e9 ce fe ff ff       	jmp    f15 <sharetable+0xd5>
+    1047:	83 ec 08             	sub    $0x8,%esp
+    104a:	68 43 12 00 00       	push   $0x1243
+    104f:	6a 01                	push   $0x1
+    1051:	e8 da f9 ff ff       	call   a30 <printf>
+    1056:	83 c4 10             	add    $0x10,%esp
+  if(extra)
+    1059:	31 c0                	xor    %eax,%eax
+    105b:	31 d2                	xor    %edx,%edx
+    105d:	eb a9                	jmp    1008 <sharetable+0x1c8>
+    105f:	90                   	nop
+  printf(1, "[%s]  pid %s ", tag, keyname);
+    1060:	51                   	push   %ecx
+    1061:	ff 75 dc             	push   -0x24(%ebp)
+    1064:	68 35 12 00 00       	push   $0x1235
+    1069:	6a 01                	push   $0x1
+    106b:	e8 c0 f9 ff ff       	call   a30 <printf>
+  if(extra)
+    1070:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    1073:	83 c4 10             	add    $0x10,%esp
+    1076:	85 ff                	test   %edi,%edi
+    1078:	74 cd                	je     1047 <sharetable+0x207>
+    wsum = 1;
+    107a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  if(extra)
+    1081:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+    1088:	e9 5c fe ff ff       	jmp    ee9 <sharetable+0xa9>
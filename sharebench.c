@@ -0,0 +1,191 @@
+// sharebench.c — ticket share benchmark for STRIDE_SCHED
+// Part 1 gives CPU-bound workers the given tickets (default
+// 100 200 300 400), lets them run for a fixed window, and compares
+// the CPU ticks each got with its share of the tickets.
+// Part 2 runs a client that sends requests to a server holding a
+// single ticket, next to a hog holding as many tickets as the
+// client, once without and once with transfer(). Lending its
+// tickets to the server while it waits should lift the pair from
+// almost nothing to about half the CPU.
+// Run with CPUS=1 so the workers compete for one CPU.
+//
+// usage: sharebench [ticks] [tickets...]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "pstat.h"
+#include "param.h"
+
+#define MAXW 8
+#define WORK 200000  // loop iterations per request
+
+static void
+spin(void)
+{
+  volatile uint x = 0;
+
+  for(;;)
+    x++;
+}
+
+// CPU ticks pid has run for so far.
+static uint
+runticks(int pid)
+{
+  struct pstat st;
+
+  return pidstat(pid, &st) == 0 ? st.runticks : 0;
+}
+
+// Fork a child that waits for the start pipe to close,
+// then calls fn.
+static int
+spawn(int startfd[2], void (*fn)(void))
+{
+  int pid;
+  char c;
+
+  if((pid = fork()) < 0){
+    printf(2, "sharebench: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(startfd[1]);
+    read(startfd[0], &c, 1);
+    close(startfd[0]);
+    fn();
+    exit();
+  }
+  return pid;
+}
+
+static void
+stop(int *pids, int n)
+{
+  int i;
+
+  for(i = 0; i < n; i++)
+    kill(pids[i]);
+  for(i = 0; i < n; i++)
+    wait();
+}
+
+static void
+shares(int dur, int nw, int *tix)
+{
+  int pids[MAXW], startfd[2], i;
+  uint ticks[MAXW];
+
+  pipe(startfd);
+  for(i = 0; i < nw; i++){
+    pids[i] = spawn(startfd, spin);
+    settickets(pids[i], tix[i]);
+  }
+  close(startfd[0]);
+  close(startfd[1]);
+  sleep(dur);
+  for(i = 0; i < nw; i++)
+    ticks[i] = runticks(pids[i]);
+  stop(pids, nw);
+  sharetable("SHARE", "tickets", tix, 0, 0, nw, pids, tix, ticks);
+}
+
+static int reqfd[2], repfd[2], srvpid, lending;
+
+static void
+server(void)
+{
+  volatile uint x = 0;
+  int i;
+  char c;
+
+  close(reqfd[1]);
+  close(repfd[0]);
+  while(read(reqfd[0], &c, 1) == 1){
+    for(i = 0; i < WORK; i++)
+      x++;
+    write(repfd[1], &c, 1);
+  }
+}
+
+static void
+client(void)
+{
+  char c = 'r';
+
+  close(reqfd[0]);
+  close(repfd[1]);
+  if(lending && transfer(srvpid) < 0)
+    printf(2, "sharebench: transfer failed\n");
+  for(;;){
+    write(reqfd[1], &c, 1);
+    read(repfd[0], &c, 1);
+  }
+}
+
+static void
+rpc(int dur, int lend)
+{
+  int pids[3], startfd[2], share;
+  uint s, c, h, sum;
+
+  pipe(startfd);
+  pipe(reqfd);
+  pipe(repfd);
+  lending = lend;
+  srvpid = pids[0] = spawn(startfd, server);
+  pids[1] = spawn(startfd, client);
+  pids[2] = spawn(startfd, spin);
+  settickets(pids[0], 1);
+  settickets(pids[1], DEFTICKETS);
+  settickets(pids[2], DEFTICKETS);
+  close(reqfd[0]);
+  close(reqfd[1]);
+  close(repfd[0]);
+  close(repfd[1]);
+  close(startfd[0]);
+  close(startfd[1]);
+  sleep(dur);
+  s = runticks(pids[0]);
+  c = runticks(pids[1]);
+  h = runticks(pids[2]);
+  stop(pids, 3);
+
+  sum = s + c + h;
+  if(sum == 0)
+    sum = 1;
+  share = (s + c) * 1000 / sum;
+  printf(1, "[RPC] transfer=%s server %d client %d hog %d ticks, "
+         "client+server share %d.%d%%\n", lend ? "yes" : "no ", s, c, h,
+         share / 10, share % 10);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int dur = 500, nw = 4, tix[MAXW] = { 100, 200, 300, 400 };
+
+  if(argc > 1) dur = atoi(argv[1]);
+  if(argc > 2){
+    for(nw = 0; nw < MAXW && nw + 2 < argc; nw++){
+      tix[nw] = atoi(argv[nw + 2]);
+      if(tix[nw] < 1 || tix[nw] > MAXTICKETS){
+        printf(2, "sharebench: tickets must be 1..%d\n", MAXTICKETS);
+        exit();
+      }
+    }
+  }
+
+  if(settickets(getpid(), DEFTICKETS) < 0){
+    printf(2, "sharebench: tickets not in effect; build with SCHED=STRIDE\n");
+    exit();
+  }
+
+  printf(1, "\n[SHAREBENCH] %d ticks per run\n", dur);
+  shares(dur, nw, tix);
+  rpc(dur, 0);
+  rpc(dur, 1);
+  printf(1, "[SHAREBENCH] done\n\n");
+  exit();
+}
@@ -21,6 +21,8 @@ fetchint(uint addr, int *ip)
 
   if(addr >= curproc->sz || addr+4 > curproc->sz)
     return -1;
+  if(lazyfill(curproc->pgdir, curproc->sz, addr, 4) < 0)
+    return -1;
   *ip = *(int*)(addr);
   return 0;
 }
@@ -39,6 +41,9 @@ fetchstr(uint addr, char **pp)
   *pp = (char*)addr;
   ep = (char*)curproc->sz;
   for(s = *pp; s < ep; s++){
+    if((s == *pp || (uint)s % PGSIZE == 0) &&
+       lazyfill(curproc->pgdir, curproc->sz, (uint)s, 1) < 0)
+      return -1;
     if(*s == 0)
       return s - *pp;
   }
@@ -65,10 +70,23 @@ argptr(int n, char **pp, int size)
     return -1;
   if(size < 0 || (uint)i >= curproc->sz || (uint)i+size > curproc->sz)
     return -1;
+  if(lazyfill(curproc->pgdir, curproc->sz, i, size) < 0)
+    return -1;
   *pp = (char*)i;
   return 0;
 }
 
+// Like argptr, for a block of memory the system call is going
+// to write. Breaks copy-on-write sharing up front, so that a
+// failed copy makes the call fail rather than the kernel fault.
+int
+argwptr(int n, char **pp, int size)
+{
+  if(argptr(n, pp, size) < 0)
+    return -1;
+  return cowbreak(myproc()->pgdir, (uint)*pp, size);
+}
+
 // Fetch the nth word-sized system call argument as a string pointer.
 // Check that the pointer is valid and the string is nul-terminated.
 // (There is no shared writable memory, so the string can't change
@@ -104,6 +122,12 @@ extern int sys_wait(void);
 extern int sys_write(void);
 extern int sys_uptime(void);
 extern int sys_nice(void);   // HW3: added declaration for nice()
+extern int sys_fsync(void);
+extern int sys_getpstat(void);
+extern int sys_pipesize(void);
+extern int sys_uptimens(void);
+extern int sys_settickets(void);
+extern int sys_transfer(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -128,6 +152,12 @@ static int (*syscalls[])(void) = {
 [SYS_mkdir]   sys_mkdir,
 [SYS_close]   sys_close,
 [SYS_nice]    sys_nice,     // HW3: added entry for nice()
+[SYS_fsync]   sys_fsync,
+[SYS_getpstat] sys_getpstat,
+[SYS_pipesize] sys_pipesize,
+[SYS_uptimens] sys_uptimens,
+[SYS_settickets] sys_settickets,
+[SYS_transfer] sys_transfer,
 };
 
 void
@@ -23,3 +23,9 @@
 #define SYS_nice   22
 
 
+#define SYS_fsync  23
+#define SYS_getpstat 24
+#define SYS_pipesize 25
+#define SYS_uptimens 26
+#define SYS_settickets 27
+#define SYS_transfer 28
@@ -6,6 +6,7 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "proc.h"
+#include "pstat.h"
 
 int
 sys_fork(void)
@@ -66,13 +67,17 @@ sys_sleep(void)
     return -1;
   acquire(&tickslock);
   ticks0 = ticks;
+  if(n > 0)
+    timerset(ticks0 + n, &ticks);
   while(ticks - ticks0 < n){
     if(myproc()->killed){
+      timerdel(myproc());
       release(&tickslock);
       return -1;
     }
     sleep(&ticks, &tickslock);
   }
+  timerdel(myproc());
   release(&tickslock);
   return 0;
 }
@@ -124,3 +129,56 @@ sys_nice(void)
   extern int setnice(int pid, int value);  // in proc.c
   return setnice(pid, val);                // returns previous nice or -1
 }
+
+// Give process pid n tickets (STRIDE_SCHED).
+// Returns its previous tickets, or -1.
+int
+sys_settickets(void)
+{
+  int pid, n;
+
+  if(argint(0, &pid) < 0 || argint(1, &n) < 0)
+    return -1;
+  return settickets(pid, n);
+}
+
+// Lend the caller's tickets to process pid whenever
+// the caller blocks; pid 0 stops lending.
+int
+sys_transfer(void)
+{
+  int pid;
+
+  if(argint(0, &pid) < 0)
+    return -1;
+  return lendtickets(pid);
+}
+
+// Store the nanoseconds since boot in *ns.
+int
+sys_uptimens(void)
+{
+  uint64 *ns;
+
+  if(argwptr(0, (char**)&ns, sizeof(*ns)) < 0)
+    return -1;
+  *ns = nsecs();
+  return 0;
+}
+
+// Fill in up to n struct pstats, one per process.
+// Returns the number filled in.
+int
+sys_getpstat(void)
+{
+  char *ps;
+  int n;
+
+  if(argint(1, &n) < 0 || n < 0)
+    return -1;
+  if(n > NPROC)
+    n = NPROC;
+  if(argptr(0, &ps, n*sizeof(struct pstat)) < 0)
+    return -1;
+  return getpstat((uint)ps, n);
+}
@@ -0,0 +1,1945 @@
+
+_test2:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  write(fd, &r, sizeof(r));
+  exit();
+}
+
+int
+main(int argc, char *argv[]) {
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+  int dur = 1000;
+  int nw = 3, nices[MAXW] = { 0, 2, 4 }, pids[MAXW], w[MAXW], work[MAXW];
+   7:	31 c0                	xor    %eax,%eax
+main(int argc, char *argv[]) {
+   9:	ff 71 fc             	push   -0x4(%ecx)
+   c:	55                   	push   %ebp
+   d:	89 e5                	mov    %esp,%ebp
+   f:	57                   	push   %edi
+  10:	56                   	push   %esi
+  11:	53                   	push   %ebx
+  int nw = 3, nices[MAXW] = { 0, 2, 4 }, pids[MAXW], w[MAXW], work[MAXW];
+  12:	31 db                	xor    %ebx,%ebx
+main(int argc, char *argv[]) {
+  14:	51                   	push   %ecx
+  15:	81 ec 28 01 00 00    	sub    $0x128,%esp
+  1b:	8b 11                	mov    (%ecx),%edx
+  1d:	8b 71 04             	mov    0x4(%ecx),%esi
+  int nw = 3, nices[MAXW] = { 0, 2, 4 }, pids[MAXW], w[MAXW], work[MAXW];
+  20:	89 9c 05 e8 fe ff ff 	mov    %ebx,-0x118(%ebp,%eax,1)
+  27:	83 c0 04             	add    $0x4,%eax
+  2a:	83 f8 20             	cmp    $0x20,%eax
+  2d:	72 f1                	jb     20 <main+0x20>
+  struct result res[MAXW];
+  uint ticks[MAXW];
+  int fds[2], i, j;
+
+  if (argc > 1) dur = atoi(argv[1]);
+  2f:	83 fa 01             	cmp    $0x1,%edx
+  32:	89 95 d4 fe ff ff    	mov    %edx,-0x12c(%ebp)
+  int nw = 3, nices[MAXW] = { 0, 2, 4 }, pids[MAXW], w[MAXW], work[MAXW];
+  38:	c7 85 ec fe ff ff 02 	movl   $0x2,-0x114(%ebp)
+  3f:	00 00 00 
+  42:	c7 85 f0 fe ff ff 04 	movl   $0x4,-0x110(%ebp)
+  49:	00 00 00 
+  if (argc > 1) dur = atoi(argv[1]);
+  4c:	0f 8e d9 00 00 00    	jle    12b <main+0x12b>
+  52:	83 ec 0c             	sub    $0xc,%esp
+  55:	ff 76 04             	push   0x4(%esi)
+  58:	e8 f3 05 00 00       	call   650 <atoi>
+  if (argc > 2) {
+  5d:	8b 95 d4 fe ff ff    	mov    -0x12c(%ebp),%edx
+  63:	83 c4 10             	add    $0x10,%esp
+  if (argc > 1) dur = atoi(argv[1]);
+  66:	89 85 d0 fe ff ff    	mov    %eax,-0x130(%ebp)
+  if (argc > 2) {
+  6c:	83 fa 02             	cmp    $0x2,%edx
+  6f:	0f 84 d0 02 00 00    	je     345 <main+0x345>
+    for (nw = 0; nw < MAXW && nw + 2 < argc; nw++) {
+  75:	31 ff                	xor    %edi,%edi
+  77:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  7d:	89 fb                	mov    %edi,%ebx
+  7f:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  85:	89 d7                	mov    %edx,%edi
+  87:	eb 10                	jmp    99 <main+0x99>
+  89:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  90:	8d 53 03             	lea    0x3(%ebx),%edx
+  93:	89 c3                	mov    %eax,%ebx
+  95:	39 d7                	cmp    %edx,%edi
+  97:	7e 2b                	jle    c4 <main+0xc4>
+      nices[nw] = atoi(argv[nw + 2]);
+  99:	83 ec 0c             	sub    $0xc,%esp
+  9c:	ff 74 9e 08          	push   0x8(%esi,%ebx,4)
+  a0:	e8 ab 05 00 00       	call   650 <atoi>
+  a5:	8b 95 d4 fe ff ff    	mov    -0x12c(%ebp),%edx
+      if (nices[nw] < 0 || nices[nw] > 4) {
+  ab:	83 c4 10             	add    $0x10,%esp
+      nices[nw] = atoi(argv[nw + 2]);
+  ae:	89 04 9a             	mov    %eax,(%edx,%ebx,4)
+      if (nices[nw] < 0 || nices[nw] > 4) {
+  b1:	83 f8 04             	cmp    $0x4,%eax
+  b4:	0f 87 a6 03 00 00    	ja     460 <main+0x460>
+    for (nw = 0; nw < MAXW && nw + 2 < argc; nw++) {
+  ba:	8d 43 01             	lea    0x1(%ebx),%eax
+  bd:	83 fb 07             	cmp    $0x7,%ebx
+  c0:	75 ce                	jne    90 <main+0x90>
+  c2:	89 c3                	mov    %eax,%ebx
+        exit();
+      }
+    }
+  }
+
+  printf(1, "\n[TEST2] duration=%d ticks, %d workers\n", dur, nw);
+  c4:	53                   	push   %ebx
+  c5:	ff b5 d0 fe ff ff    	push   -0x130(%ebp)
+  cb:	68 30 0f 00 00       	push   $0xf30
+  d0:	6a 01                	push   $0x1
+  d2:	e8 69 07 00 00       	call   840 <printf>
+
+  if (pipe(fds) < 0) {
+  d7:	8d 85 e0 fe ff ff    	lea    -0x120(%ebp),%eax
+  dd:	89 04 24             	mov    %eax,(%esp)
+  e0:	e8 ee 05 00 00       	call   6d3 <pipe>
+  e5:	83 c4 10             	add    $0x10,%esp
+  e8:	85 c0                	test   %eax,%eax
+  ea:	0f 88 4f 01 00 00    	js     23f <main+0x23f>
+  f0:	8d b5 08 ff ff ff    	lea    -0xf8(%ebp),%esi
+  f6:	8d bc 9d 08 ff ff ff 	lea    -0xf8(%ebp,%ebx,4),%edi
+  fd:	eb 0e                	jmp    10d <main+0x10d>
+  ff:	90                   	nop
+    pids[i] = fork();
+    if (pids[i] < 0) {
+      printf(2, "test2: fork failed\n");
+      exit();
+    }
+    if (pids[i] == 0) {
+ 100:	0f 84 4c 01 00 00    	je     252 <main+0x252>
+  for (i = 0; i < nw; i++) {
+ 106:	83 c6 04             	add    $0x4,%esi
+ 109:	39 fe                	cmp    %edi,%esi
+ 10b:	74 2f                	je     13c <main+0x13c>
+    pids[i] = fork();
+ 10d:	e8 a9 05 00 00       	call   6bb <fork>
+ 112:	89 06                	mov    %eax,(%esi)
+    if (pids[i] < 0) {
+ 114:	85 c0                	test   %eax,%eax
+ 116:	79 e8                	jns    100 <main+0x100>
+      printf(2, "test2: fork failed\n");
+ 118:	56                   	push   %esi
+ 119:	56                   	push   %esi
+ 11a:	68 ce 0e 00 00       	push   $0xece
+ 11f:	6a 02                	push   $0x2
+ 121:	e8 1a 07 00 00       	call   840 <printf>
+      exit();
+ 126:	e8 98 05 00 00       	call   6c3 <exit>
+  int dur = 1000;
+ 12b:	c7 85 d0 fe ff ff e8 	movl   $0x3e8,-0x130(%ebp)
+ 132:	03 00 00 
+  int nw = 3, nices[MAXW] = { 0, 2, 4 }, pids[MAXW], w[MAXW], work[MAXW];
+ 135:	bb 03 00 00 00       	mov    $0x3,%ebx
+ 13a:	eb 88                	jmp    c4 <main+0xc4>
+      close(fds[0]);
+      worker(dur, fds[1]);
+    }
+  }
+  close(fds[1]);
+ 13c:	83 ec 0c             	sub    $0xc,%esp
+ 13f:	ff b5 e4 fe ff ff    	push   -0x11c(%ebp)
+ 145:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+
+  // parent: set nice values (lower is higher priority)
+  for (i = 0; i < nw; i++)
+ 14b:	31 ff                	xor    %edi,%edi
+  close(fds[1]);
+ 14d:	e8 99 05 00 00       	call   6eb <close>
+  for (i = 0; i < nw; i++)
+ 152:	89 b5 d4 fe ff ff    	mov    %esi,-0x12c(%ebp)
+  close(fds[1]);
+ 158:	83 c4 10             	add    $0x10,%esp
+ 15b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 15f:	90                   	nop
+    nice(pids[i], nices[i]);
+ 160:	83 ec 08             	sub    $0x8,%esp
+ 163:	ff 34 be             	push   (%esi,%edi,4)
+ 166:	ff b4 bd 08 ff ff ff 	push   -0xf8(%ebp,%edi,4)
+ 16d:	e8 f1 05 00 00       	call   763 <nice>
+  for (i = 0; i < nw; i++)
+ 172:	89 f8                	mov    %edi,%eax
+ 174:	83 c7 01             	add    $0x1,%edi
+ 177:	83 c4 10             	add    $0x10,%esp
+ 17a:	39 fb                	cmp    %edi,%ebx
+ 17c:	75 e2                	jne    160 <main+0x160>
+
+  printf(1, "[TEST2] set priorities:");
+ 17e:	89 85 cc fe ff ff    	mov    %eax,-0x134(%ebp)
+  for (i = 0; i < nw; i++)
+ 184:	31 f6                	xor    %esi,%esi
+  printf(1, "[TEST2] set priorities:");
+ 186:	51                   	push   %ecx
+ 187:	51                   	push   %ecx
+ 188:	68 f9 0e 00 00       	push   $0xef9
+ 18d:	6a 01                	push   $0x1
+ 18f:	e8 ac 06 00 00       	call   840 <printf>
+  for (i = 0; i < nw; i++)
+ 194:	89 9d d0 fe ff ff    	mov    %ebx,-0x130(%ebp)
+  printf(1, "[TEST2] set priorities:");
+ 19a:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < nw; i++)
+ 19d:	89 bd c8 fe ff ff    	mov    %edi,-0x138(%ebp)
+ 1a3:	8b bd cc fe ff ff    	mov    -0x134(%ebp),%edi
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    printf(1, " pid %d->%d", pids[i], nices[i]);
+ 1b0:	8b 85 d4 fe ff ff    	mov    -0x12c(%ebp),%eax
+ 1b6:	89 f3                	mov    %esi,%ebx
+ 1b8:	ff 34 b0             	push   (%eax,%esi,4)
+ 1bb:	ff b4 b5 08 ff ff ff 	push   -0xf8(%ebp,%esi,4)
+  for (i = 0; i < nw; i++)
+ 1c2:	83 c6 01             	add    $0x1,%esi
+    printf(1, " pid %d->%d", pids[i], nices[i]);
+ 1c5:	68 11 0f 00 00       	push   $0xf11
+ 1ca:	6a 01                	push   $0x1
+ 1cc:	e8 6f 06 00 00       	call   840 <printf>
+  for (i = 0; i < nw; i++)
+ 1d1:	83 c4 10             	add    $0x10,%esp
+ 1d4:	39 fb                	cmp    %edi,%ebx
+ 1d6:	75 d8                	jne    1b0 <main+0x1b0>
+  printf(1, "\n");
+ 1d8:	8b 9d d0 fe ff ff    	mov    -0x130(%ebp),%ebx
+ 1de:	8b bd c8 fe ff ff    	mov    -0x138(%ebp),%edi
+ 1e4:	52                   	push   %edx
+ 1e5:	52                   	push   %edx
+ 1e6:	68 70 10 00 00       	push   $0x1070
+ 1eb:	6b db 0c             	imul   $0xc,%ebx,%ebx
+ 1ee:	6a 01                	push   $0x1
+ 1f0:	e8 4b 06 00 00       	call   840 <printf>
+
+  // collect results, then reap
+  for (i = 0; i < nw; i++) {
+ 1f5:	8d 45 88             	lea    -0x78(%ebp),%eax
+ 1f8:	83 c4 10             	add    $0x10,%esp
+ 1fb:	01 c3                	add    %eax,%ebx
+  printf(1, "\n");
+ 1fd:	89 c6                	mov    %eax,%esi
+ 1ff:	eb 12                	jmp    213 <main+0x213>
+ 201:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  for (i = 0; i < nw; i++) {
+ 208:	83 c6 0c             	add    $0xc,%esi
+ 20b:	39 de                	cmp    %ebx,%esi
+ 20d:	0f 84 3c 01 00 00    	je     34f <main+0x34f>
+    if (read(fds[0], &res[i], sizeof(res[i])) != sizeof(res[i])) {
+ 213:	83 ec 04             	sub    $0x4,%esp
+ 216:	6a 0c                	push   $0xc
+ 218:	56                   	push   %esi
+ 219:	ff b5 e0 fe ff ff    	push   -0x120(%ebp)
+ 21f:	e8 b7 04 00 00       	call   6db <read>
+ 224:	83 c4 10             	add    $0x10,%esp
+ 227:	83 f8 0c             	cmp    $0xc,%eax
+ 22a:	74 dc                	je     208 <main+0x208>
+      printf(2, "test2: lost a worker's result\n");
+ 22c:	50                   	push   %eax
+ 22d:	50                   	push   %eax
+ 22e:	68 58 0f 00 00       	push   $0xf58
+ 233:	6a 02                	push   $0x2
+ 235:	e8 06 06 00 00       	call   840 <printf>
+      exit();
+ 23a:	e8 84 04 00 00       	call   6c3 <exit>
+    printf(2, "test2: pipe failed\n");
+ 23f:	57                   	push   %edi
+ 240:	57                   	push   %edi
+ 241:	68 ba 0e 00 00       	push   $0xeba
+ 246:	6a 02                	push   $0x2
+ 248:	e8 f3 05 00 00       	call   840 <printf>
+    exit();
+ 24d:	e8 71 04 00 00       	call   6c3 <exit>
+      close(fds[0]);
+ 252:	83 ec 0c             	sub    $0xc,%esp
+ 255:	ff b5 e0 fe ff ff    	push   -0x120(%ebp)
+  while (uptime() - start < dur_ticks) {
+ 25b:	31 ff                	xor    %edi,%edi
+  int n = 1;
+ 25d:	bb 01 00 00 00       	mov    $0x1,%ebx
+      close(fds[0]);
+ 262:	e8 84 04 00 00       	call   6eb <close>
+      worker(dur, fds[1]);
+ 267:	8b 85 e4 fe ff ff    	mov    -0x11c(%ebp),%eax
+ 26d:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  int start = uptime();
+ 273:	e8 e3 04 00 00       	call   75b <uptime>
+ 278:	89 c6                	mov    %eax,%esi
+  r.pid = getpid();
+ 27a:	e8 c4 04 00 00       	call   743 <getpid>
+  while (uptime() - start < dur_ticks) {
+ 27f:	83 c4 10             	add    $0x10,%esp
+  r.pid = getpid();
+ 282:	89 85 68 ff ff ff    	mov    %eax,-0x98(%ebp)
+  while (uptime() - start < dur_ticks) {
+ 288:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28f:	90                   	nop
+  r.count = 0;
+ 290:	89 bd 6c ff ff ff    	mov    %edi,-0x94(%ebp)
+  while (uptime() - start < dur_ticks) {
+ 296:	e8 c0 04 00 00       	call   75b <uptime>
+ 29b:	29 f0                	sub    %esi,%eax
+ 29d:	39 85 d0 fe ff ff    	cmp    %eax,-0x130(%ebp)
+ 2a3:	7e 47                	jle    2ec <main+0x2ec>
+  if (x < 2) return 0;
+ 2a5:	31 ff                	xor    %edi,%edi
+ 2a7:	83 fb 01             	cmp    $0x1,%ebx
+ 2aa:	74 31                	je     2dd <main+0x2dd>
+  for (int d = 2; d*d <= x; d++) {
+ 2ac:	83 fb 03             	cmp    $0x3,%ebx
+ 2af:	0f 8e a1 01 00 00    	jle    456 <main+0x456>
+    if (x % d == 0) return 0;
+ 2b5:	89 df                	mov    %ebx,%edi
+ 2b7:	83 e7 01             	and    $0x1,%edi
+ 2ba:	74 21                	je     2dd <main+0x2dd>
+  for (int d = 2; d*d <= x; d++) {
+ 2bc:	b9 02 00 00 00       	mov    $0x2,%ecx
+ 2c1:	eb 0e                	jmp    2d1 <main+0x2d1>
+ 2c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c7:	90                   	nop
+    if (x % d == 0) return 0;
+ 2c8:	89 d8                	mov    %ebx,%eax
+ 2ca:	99                   	cltd
+ 2cb:	f7 f9                	idiv   %ecx
+ 2cd:	85 d2                	test   %edx,%edx
+ 2cf:	74 17                	je     2e8 <main+0x2e8>
+  for (int d = 2; d*d <= x; d++) {
+ 2d1:	83 c1 01             	add    $0x1,%ecx
+ 2d4:	89 c8                	mov    %ecx,%eax
+ 2d6:	0f af c1             	imul   %ecx,%eax
+ 2d9:	39 c3                	cmp    %eax,%ebx
+ 2db:	7d eb                	jge    2c8 <main+0x2c8>
+    r.count += isprime(n);
+ 2dd:	03 bd 6c ff ff ff    	add    -0x94(%ebp),%edi
+    n++;
+ 2e3:	83 c3 01             	add    $0x1,%ebx
+ 2e6:	eb a8                	jmp    290 <main+0x290>
+  if (x < 2) return 0;
+ 2e8:	31 ff                	xor    %edi,%edi
+ 2ea:	eb f1                	jmp    2dd <main+0x2dd>
+  r.runticks = pidstat(r.pid, &st) == 0 ? st.runticks : 0;
+ 2ec:	8d 45 88             	lea    -0x78(%ebp),%eax
+ 2ef:	53                   	push   %ebx
+ 2f0:	53                   	push   %ebx
+ 2f1:	50                   	push   %eax
+ 2f2:	ff b5 68 ff ff ff    	push   -0x98(%ebp)
+ 2f8:	e8 73 08 00 00       	call   b70 <pidstat>
+ 2fd:	83 c4 10             	add    $0x10,%esp
+ 300:	89 c2                	mov    %eax,%edx
+ 302:	31 c0                	xor    %eax,%eax
+ 304:	85 d2                	test   %edx,%edx
+ 306:	75 03                	jne    30b <main+0x30b>
+ 308:	8b 45 ac             	mov    -0x54(%ebp),%eax
+ 30b:	89 85 70 ff ff ff    	mov    %eax,-0x90(%ebp)
+  printf(1, "worker pid=%d done=%d\n", r.pid, r.count);
+ 311:	ff b5 6c ff ff ff    	push   -0x94(%ebp)
+ 317:	ff b5 68 ff ff ff    	push   -0x98(%ebp)
+ 31d:	68 e2 0e 00 00       	push   $0xee2
+ 322:	6a 01                	push   $0x1
+ 324:	e8 17 05 00 00       	call   840 <printf>
+  write(fd, &r, sizeof(r));
+ 329:	83 c4 0c             	add    $0xc,%esp
+ 32c:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+ 332:	6a 0c                	push   $0xc
+ 334:	50                   	push   %eax
+ 335:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+ 33b:	e8 a3 03 00 00       	call   6e3 <write>
+  exit();
+ 340:	e8 7e 03 00 00       	call   6c3 <exit>
+  int nw = 3, nices[MAXW] = { 0, 2, 4 }, pids[MAXW], w[MAXW], work[MAXW];
+ 345:	bb 03 00 00 00       	mov    $0x3,%ebx
+ 34a:	e9 75 fd ff ff       	jmp    c4 <main+0xc4>
+    }
+  }
+  close(fds[0]);
+ 34f:	83 ec 0c             	sub    $0xc,%esp
+ 352:	ff b5 e0 fe ff ff    	push   -0x120(%ebp)
+  for (i = 0; i < nw; i++)
+ 358:	31 f6                	xor    %esi,%esi
+  close(fds[0]);
+ 35a:	e8 8c 03 00 00       	call   6eb <close>
+  for (i = 0; i < nw; i++)
+ 35f:	89 9d d0 fe ff ff    	mov    %ebx,-0x130(%ebp)
+ 365:	89 f3                	mov    %esi,%ebx
+  close(fds[0]);
+ 367:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < nw; i++)
+ 36a:	8b b5 cc fe ff ff    	mov    -0x134(%ebp),%esi
+    wait();
+ 370:	e8 56 03 00 00       	call   6cb <wait>
+  for (i = 0; i < nw; i++)
+ 375:	89 d8                	mov    %ebx,%eax
+ 377:	83 c3 01             	add    $0x1,%ebx
+ 37a:	39 c6                	cmp    %eax,%esi
+ 37c:	75 f2                	jne    370 <main+0x370>
+ 37e:	89 bd c8 fe ff ff    	mov    %edi,-0x138(%ebp)
+
+  for (i = 0; i < nw; i++) {
+ 384:	8b 9d d0 fe ff ff    	mov    -0x130(%ebp),%ebx
+ 38a:	31 d2                	xor    %edx,%edx
+ 38c:	8d b5 48 ff ff ff    	lea    -0xb8(%ebp),%esi
+ 392:	8b bd d4 fe ff ff    	mov    -0x12c(%ebp),%edi
+ 398:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39f:	90                   	nop
+    w[i] = weight[nices[i]];
+ 3a0:	8b 04 97             	mov    (%edi,%edx,4),%eax
+    work[i] = 0;
+ 3a3:	c7 04 96 00 00 00 00 	movl   $0x0,(%esi,%edx,4)
+    ticks[i] = 0;
+    for (j = 0; j < nw; j++) {
+      if (res[j].pid == pids[i]) {
+ 3aa:	89 bd d0 fe ff ff    	mov    %edi,-0x130(%ebp)
+ 3b0:	8b 8c 95 08 ff ff ff 	mov    -0xf8(%ebp,%edx,4),%ecx
+    w[i] = weight[nices[i]];
+ 3b7:	8b 04 85 a8 0f 00 00 	mov    0xfa8(,%eax,4),%eax
+    ticks[i] = 0;
+ 3be:	c7 84 95 68 ff ff ff 	movl   $0x0,-0x98(%ebp,%edx,4)
+ 3c5:	00 00 00 00 
+    w[i] = weight[nices[i]];
+ 3c9:	89 84 95 28 ff ff ff 	mov    %eax,-0xd8(%ebp,%edx,4)
+      if (res[j].pid == pids[i]) {
+ 3d0:	8d 45 88             	lea    -0x78(%ebp),%eax
+ 3d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3d7:	90                   	nop
+ 3d8:	39 08                	cmp    %ecx,(%eax)
+ 3da:	75 10                	jne    3ec <main+0x3ec>
+        work[i] = res[j].count;
+ 3dc:	8b 78 04             	mov    0x4(%eax),%edi
+ 3df:	89 3c 96             	mov    %edi,(%esi,%edx,4)
+        ticks[i] = res[j].runticks;
+ 3e2:	8b 78 08             	mov    0x8(%eax),%edi
+ 3e5:	89 bc 95 68 ff ff ff 	mov    %edi,-0x98(%ebp,%edx,4)
+    for (j = 0; j < nw; j++) {
+ 3ec:	83 c0 0c             	add    $0xc,%eax
+ 3ef:	39 c3                	cmp    %eax,%ebx
+ 3f1:	75 e5                	jne    3d8 <main+0x3d8>
+  for (i = 0; i < nw; i++) {
+ 3f3:	8b bd d0 fe ff ff    	mov    -0x130(%ebp),%edi
+ 3f9:	8d 42 01             	lea    0x1(%edx),%eax
+ 3fc:	39 95 cc fe ff ff    	cmp    %edx,-0x134(%ebp)
+ 402:	74 04                	je     408 <main+0x408>
+ 404:	89 c2                	mov    %eax,%edx
+ 406:	eb 98                	jmp    3a0 <main+0x3a0>
+      }
+    }
+  }
+  sharetable("TEST2", "nice", nices, "work", work, nw, pids, w, ticks);
+ 408:	83 ec 0c             	sub    $0xc,%esp
+ 40b:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+ 411:	8b bd c8 fe ff ff    	mov    -0x138(%ebp),%edi
+ 417:	50                   	push   %eax
+ 418:	8d 85 28 ff ff ff    	lea    -0xd8(%ebp),%eax
+ 41e:	50                   	push   %eax
+ 41f:	8d 85 08 ff ff ff    	lea    -0xf8(%ebp),%eax
+ 425:	50                   	push   %eax
+ 426:	57                   	push   %edi
+ 427:	56                   	push   %esi
+ 428:	68 1d 0f 00 00       	push   $0xf1d
+ 42d:	ff b5 d4 fe ff ff    	push   -0x12c(%ebp)
+ 433:	68 22 0f 00 00       	push   $0xf22
+ 438:	68 27 0f 00 00       	push   $0xf27
+ 43d:	e8 0e 08 00 00       	call   c50 <sharetable>
+  printf(1, "[TEST2] done (weights apply to FAIR_SCHED)\n\n");
+ 442:	83 c4 28             	add    $0x28,%esp
+ 445:	68 78 0f 00 00       	push   $0xf78
+ 44a:	6a 01                	push   $0x1
+ 44c:	e8 ef 03 00 00       	call   840 <printf>
+  exit();
+ 451:	e8 6d 02 00 00       	call   6c3 <exit>
+  return 1;
+ 456:	bf 01 00 00 00       	mov    $0x1,%edi
+ 45b:	e9 7d fe ff ff       	jmp    2dd <main+0x2dd>
+        printf(2, "test2: nice must be 0..4\n");
+ 460:	50                   	push   %eax
+ 461:	50                   	push   %eax
+ 462:	68 a0 0e 00 00       	push   $0xea0
+ 467:	6a 02                	push   $0x2
+ 469:	e8 d2 03 00 00       	call   840 <printf>
+        exit();
+ 46e:	e8 50 02 00 00       	call   6c3 <exit>
+ 473:	66 90                	xchg   %ax,%ax
+ 475:	66 90                	xchg   %ax,%ax
+ 477:	66 90                	xchg   %ax,%ax
+ 479:	66 90                	xchg   %ax,%ax
+ 47b:	66 90                	xchg   %ax,%ax
+ 47d:	66 90                	xchg   %ax,%ax
+ 47f:	90                   	nop
+
+00000480 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 480:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 481:	31 c0                	xor    %eax,%eax
+{
+ 483:	89 e5                	mov    %esp,%ebp
+ 485:	53                   	push   %ebx
+ 486:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 489:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 490:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 494:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 497:	83 c0 01             	add    $0x1,%eax
+ 49a:	84 d2                	test   %dl,%dl
+ 49c:	75 f2                	jne    490 <strcpy+0x10>
+    ;
+  return os;
+}
+ 49e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4a1:	89 c8                	mov    %ecx,%eax
+ 4a3:	c9                   	leave
+ 4a4:	c3                   	ret
+ 4a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	53                   	push   %ebx
+ 4b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 4ba:	0f b6 02             	movzbl (%edx),%eax
+ 4bd:	84 c0                	test   %al,%al
+ 4bf:	75 17                	jne    4d8 <strcmp+0x28>
+ 4c1:	eb 3a                	jmp    4fd <strcmp+0x4d>
+ 4c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4c7:	90                   	nop
+ 4c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 4cc:	83 c2 01             	add    $0x1,%edx
+ 4cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 4d2:	84 c0                	test   %al,%al
+ 4d4:	74 1a                	je     4f0 <strcmp+0x40>
+    p++, q++;
+ 4d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 4d8:	0f b6 19             	movzbl (%ecx),%ebx
+ 4db:	38 c3                	cmp    %al,%bl
+ 4dd:	74 e9                	je     4c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 4df:	29 d8                	sub    %ebx,%eax
+}
+ 4e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4e4:	c9                   	leave
+ 4e5:	c3                   	ret
+ 4e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 4f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 4f4:	31 c0                	xor    %eax,%eax
+ 4f6:	29 d8                	sub    %ebx,%eax
+}
+ 4f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4fb:	c9                   	leave
+ 4fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 4fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 500:	31 c0                	xor    %eax,%eax
+ 502:	eb db                	jmp    4df <strcmp+0x2f>
+ 504:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 50f:	90                   	nop
+
+00000510 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 516:	80 3a 00             	cmpb   $0x0,(%edx)
+ 519:	74 15                	je     530 <strlen+0x20>
+ 51b:	31 c0                	xor    %eax,%eax
+ 51d:	8d 76 00             	lea    0x0(%esi),%esi
+ 520:	83 c0 01             	add    $0x1,%eax
+ 523:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 527:	89 c1                	mov    %eax,%ecx
+ 529:	75 f5                	jne    520 <strlen+0x10>
+    ;
+  return n;
+}
+ 52b:	89 c8                	mov    %ecx,%eax
+ 52d:	5d                   	pop    %ebp
+ 52e:	c3                   	ret
+ 52f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 530:	31 c9                	xor    %ecx,%ecx
+}
+ 532:	5d                   	pop    %ebp
+ 533:	89 c8                	mov    %ecx,%eax
+ 535:	c3                   	ret
+ 536:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000540 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+ 543:	57                   	push   %edi
+ 544:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 547:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 54a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 54d:	89 d7                	mov    %edx,%edi
+ 54f:	fc                   	cld
+ 550:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 552:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 555:	89 d0                	mov    %edx,%eax
+ 557:	c9                   	leave
+ 558:	c3                   	ret
+ 559:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000560 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+ 563:	8b 45 08             	mov    0x8(%ebp),%eax
+ 566:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 56a:	0f b6 10             	movzbl (%eax),%edx
+ 56d:	84 d2                	test   %dl,%dl
+ 56f:	75 12                	jne    583 <strchr+0x23>
+ 571:	eb 1d                	jmp    590 <strchr+0x30>
+ 573:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 577:	90                   	nop
+ 578:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 57c:	83 c0 01             	add    $0x1,%eax
+ 57f:	84 d2                	test   %dl,%dl
+ 581:	74 0d                	je     590 <strchr+0x30>
+    if(*s == c)
+ 583:	38 d1                	cmp    %dl,%cl
+ 585:	75 f1                	jne    578 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 587:	5d                   	pop    %ebp
+ 588:	c3                   	ret
+ 589:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 590:	31 c0                	xor    %eax,%eax
+}
+ 592:	5d                   	pop    %ebp
+ 593:	c3                   	ret
+ 594:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 59b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 59f:	90                   	nop
+
+000005a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	57                   	push   %edi
+ 5a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 5a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 5a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 5a9:	31 db                	xor    %ebx,%ebx
+{
+ 5ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 5ae:	eb 27                	jmp    5d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 5b0:	83 ec 04             	sub    $0x4,%esp
+ 5b3:	6a 01                	push   $0x1
+ 5b5:	56                   	push   %esi
+ 5b6:	6a 00                	push   $0x0
+ 5b8:	e8 1e 01 00 00       	call   6db <read>
+    if(cc < 1)
+ 5bd:	83 c4 10             	add    $0x10,%esp
+ 5c0:	85 c0                	test   %eax,%eax
+ 5c2:	7e 1d                	jle    5e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 5c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 5c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 5cf:	3c 0a                	cmp    $0xa,%al
+ 5d1:	74 10                	je     5e3 <gets+0x43>
+ 5d3:	3c 0d                	cmp    $0xd,%al
+ 5d5:	74 0c                	je     5e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 5d7:	89 df                	mov    %ebx,%edi
+ 5d9:	83 c3 01             	add    $0x1,%ebx
+ 5dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 5df:	7c cf                	jl     5b0 <gets+0x10>
+ 5e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 5e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 5ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5ed:	5b                   	pop    %ebx
+ 5ee:	5e                   	pop    %esi
+ 5ef:	5f                   	pop    %edi
+ 5f0:	5d                   	pop    %ebp
+ 5f1:	c3                   	ret
+ 5f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000600 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	56                   	push   %esi
+ 604:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 605:	83 ec 08             	sub    $0x8,%esp
+ 608:	6a 00                	push   $0x0
+ 60a:	ff 75 08             	push   0x8(%ebp)
+ 60d:	e8 f1 00 00 00       	call   703 <open>
+  if(fd < 0)
+ 612:	83 c4 10             	add    $0x10,%esp
+ 615:	85 c0                	test   %eax,%eax
+ 617:	78 27                	js     640 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 619:	83 ec 08             	sub    $0x8,%esp
+ 61c:	ff 75 0c             	push   0xc(%ebp)
+ 61f:	89 c3                	mov    %eax,%ebx
+ 621:	50                   	push   %eax
+ 622:	e8 f4 00 00 00       	call   71b <fstat>
+  close(fd);
+ 627:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 62a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 62c:	e8 ba 00 00 00       	call   6eb <close>
+  return r;
+ 631:	83 c4 10             	add    $0x10,%esp
+}
+ 634:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 637:	89 f0                	mov    %esi,%eax
+ 639:	5b                   	pop    %ebx
+ 63a:	5e                   	pop    %esi
+ 63b:	5d                   	pop    %ebp
+ 63c:	c3                   	ret
+ 63d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 640:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 645:	eb ed                	jmp    634 <stat+0x34>
+ 647:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64e:	66 90                	xchg   %ax,%ax
+
+00000650 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	53                   	push   %ebx
+ 654:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 657:	0f be 02             	movsbl (%edx),%eax
+ 65a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 65d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 660:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 665:	77 1e                	ja     685 <atoi+0x35>
+ 667:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 66e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 670:	83 c2 01             	add    $0x1,%edx
+ 673:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 676:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 67a:	0f be 02             	movsbl (%edx),%eax
+ 67d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 680:	80 fb 09             	cmp    $0x9,%bl
+ 683:	76 eb                	jbe    670 <atoi+0x20>
+  return n;
+}
+ 685:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 688:	89 c8                	mov    %ecx,%eax
+ 68a:	c9                   	leave
+ 68b:	c3                   	ret
+ 68c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000690 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 690:	55                   	push   %ebp
+ 691:	89 e5                	mov    %esp,%ebp
+ 693:	57                   	push   %edi
+ 694:	56                   	push   %esi
+ 695:	8b 45 10             	mov    0x10(%ebp),%eax
+ 698:	8b 55 08             	mov    0x8(%ebp),%edx
+ 69b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 69e:	85 c0                	test   %eax,%eax
+ 6a0:	7e 13                	jle    6b5 <memmove+0x25>
+ 6a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 6a4:	89 d7                	mov    %edx,%edi
+ 6a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 6b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 6b1:	39 f8                	cmp    %edi,%eax
+ 6b3:	75 fb                	jne    6b0 <memmove+0x20>
+  return vdst;
+}
+ 6b5:	5e                   	pop    %esi
+ 6b6:	89 d0                	mov    %edx,%eax
+ 6b8:	5f                   	pop    %edi
+ 6b9:	5d                   	pop    %ebp
+ 6ba:	c3                   	ret
+
+000006bb <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 6bb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6c0:	cd 40                	int    $0x40
+ 6c2:	c3                   	ret
+
+000006c3 <exit>:
+SYSCALL(exit)
+ 6c3:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6c8:	cd 40                	int    $0x40
+ 6ca:	c3                   	ret
+
+000006cb <wait>:
+SYSCALL(wait)
+ 6cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6d0:	cd 40                	int    $0x40
+ 6d2:	c3                   	ret
+
+000006d3 <pipe>:
+SYSCALL(pipe)
+ 6d3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6d8:	cd 40                	int    $0x40
+ 6da:	c3                   	ret
+
+000006db <read>:
+SYSCALL(read)
+ 6db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6e0:	cd 40                	int    $0x40
+ 6e2:	c3                   	ret
+
+000006e3 <write>:
+SYSCALL(write)
+ 6e3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6e8:	cd 40                	int    $0x40
+ 6ea:	c3                   	ret
+
+000006eb <close>:
+SYSCALL(close)
+ 6eb:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6f0:	cd 40                	int    $0x40
+ 6f2:	c3                   	ret
+
+000006f3 <kill>:
+SYSCALL(kill)
+ 6f3:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6f8:	cd 40                	int    $0x40
+ 6fa:	c3                   	ret
+
+000006fb <exec>:
+SYSCALL(exec)
+ 6fb:	b8 07 00 00 00       	mov    $0x7,%eax
+ 700:	cd 40                	int    $0x40
+ 702:	c3                   	ret
+
+00000703 <open>:
+SYSCALL(open)
+ 703:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 708:	cd 40                	int    $0x40
+ 70a:	c3                   	ret
+
+0000070b <mknod>:
+SYSCALL(mknod)
+ 70b:	b8 11 00 00 00       	mov    $0x11,%eax
+ 710:	cd 40                	int    $0x40
+ 712:	c3                   	ret
+
+00000713 <unlink>:
+SYSCALL(unlink)
+ 713:	b8 12 00 00 00       	mov    $0x12,%eax
+ 718:	cd 40                	int    $0x40
+ 71a:	c3                   	ret
+
+0000071b <fstat>:
+SYSCALL(fstat)
+ 71b:	b8 08 00 00 00       	mov    $0x8,%eax
+ 720:	cd 40                	int    $0x40
+ 722:	c3                   	ret
+
+00000723 <link>:
+SYSCALL(link)
+ 723:	b8 13 00 00 00       	mov    $0x13,%eax
+ 728:	cd 40                	int    $0x40
+ 72a:	c3                   	ret
+
+0000072b <mkdir>:
+SYSCALL(mkdir)
+ 72b:	b8 14 00 00 00       	mov    $0x14,%eax
+ 730:	cd 40                	int    $0x40
+ 732:	c3                   	ret
+
+00000733 <chdir>:
+SYSCALL(chdir)
+ 733:	b8 09 00 00 00       	mov    $0x9,%eax
+ 738:	cd 40                	int    $0x40
+ 73a:	c3                   	ret
+
+0000073b <dup>:
+SYSCALL(dup)
+ 73b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 740:	cd 40                	int    $0x40
+ 742:	c3                   	ret
+
+00000743 <getpid>:
+SYSCALL(getpid)
+ 743:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 748:	cd 40                	int    $0x40
+ 74a:	c3                   	ret
+
+0000074b <sbrk>:
+SYSCALL(sbrk)
+ 74b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 750:	cd 40                	int    $0x40
+ 752:	c3                   	ret
+
+00000753 <sleep>:
+SYSCALL(sleep)
+ 753:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 758:	cd 40                	int    $0x40
+ 75a:	c3                   	ret
+
+0000075b <uptime>:
+SYSCALL(uptime)
+ 75b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 760:	cd 40                	int    $0x40
+ 762:	c3                   	ret
+
+00000763 <nice>:
+SYSCALL(nice)
+ 763:	b8 16 00 00 00       	mov    $0x16,%eax
+ 768:	cd 40                	int    $0x40
+ 76a:	c3                   	ret
+
+0000076b <fsync>:
+SYSCALL(fsync)
+ 76b:	b8 17 00 00 00       	mov    $0x17,%eax
+ 770:	cd 40                	int    $0x40
+ 772:	c3                   	ret
+
+00000773 <getpstat>:
+SYSCALL(getpstat)
+ 773:	b8 18 00 00 00       	mov    $0x18,%eax
+ 778:	cd 40                	int    $0x40
+ 77a:	c3                   	ret
+
+0000077b <pipesize>:
+SYSCALL(pipesize)
+ 77b:	b8 19 00 00 00       	mov    $0x19,%eax
+ 780:	cd 40                	int    $0x40
+ 782:	c3                   	ret
+
+00000783 <uptimens>:
+SYSCALL(uptimens)
+ 783:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 788:	cd 40                	int    $0x40
+ 78a:	c3                   	ret
+
+0000078b <settickets>:
+SYSCALL(settickets)
+ 78b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 790:	cd 40                	int    $0x40
+ 792:	c3                   	ret
+
+00000793 <transfer>:
+SYSCALL(transfer)
+ 793:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 798:	cd 40                	int    $0x40
+ 79a:	c3                   	ret
+ 79b:	66 90                	xchg   %ax,%ax
+ 79d:	66 90                	xchg   %ax,%ax
+ 79f:	90                   	nop
+
+000007a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7a0:	55                   	push   %ebp
+ 7a1:	89 e5                	mov    %esp,%ebp
+ 7a3:	57                   	push   %edi
+ 7a4:	56                   	push   %esi
+ 7a5:	53                   	push   %ebx
+ 7a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 7a8:	89 d1                	mov    %edx,%ecx
+{
+ 7aa:	83 ec 3c             	sub    $0x3c,%esp
+ 7ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 7b0:	85 d2                	test   %edx,%edx
+ 7b2:	0f 89 80 00 00 00    	jns    838 <printint+0x98>
+ 7b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 7bc:	74 7a                	je     838 <printint+0x98>
+    x = -xx;
+ 7be:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 7c8:	31 f6                	xor    %esi,%esi
+ 7ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 7d0:	89 c8                	mov    %ecx,%eax
+ 7d2:	31 d2                	xor    %edx,%edx
+ 7d4:	89 f7                	mov    %esi,%edi
+ 7d6:	f7 f3                	div    %ebx
+ 7d8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7db:	0f b6 92 1c 10 00 00 	movzbl 0x101c(%edx),%edx
+ 7e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7e6:	89 ca                	mov    %ecx,%edx
+ 7e8:	89 c1                	mov    %eax,%ecx
+ 7ea:	39 da                	cmp    %ebx,%edx
+ 7ec:	73 e2                	jae    7d0 <printint+0x30>
+  if(neg)
+ 7ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7f1:	85 c0                	test   %eax,%eax
+ 7f3:	74 07                	je     7fc <printint+0x5c>
+    buf[i++] = '-';
+ 7f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7fa:	89 f7                	mov    %esi,%edi
+ 7fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 802:	01 df                	add    %ebx,%edi
+ 804:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 808:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 80b:	83 ec 04             	sub    $0x4,%esp
+ 80e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 811:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 814:	6a 01                	push   $0x1
+ 816:	50                   	push   %eax
+ 817:	56                   	push   %esi
+ 818:	e8 c6 fe ff ff       	call   6e3 <write>
+  while(--i >= 0)
+ 81d:	89 f8                	mov    %edi,%eax
+ 81f:	83 c4 10             	add    $0x10,%esp
+ 822:	83 ef 01             	sub    $0x1,%edi
+ 825:	39 d8                	cmp    %ebx,%eax
+ 827:	75 df                	jne    808 <printint+0x68>
+}
+ 829:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 82c:	5b                   	pop    %ebx
+ 82d:	5e                   	pop    %esi
+ 82e:	5f                   	pop    %edi
+ 82f:	5d                   	pop    %ebp
+ 830:	c3                   	ret
+ 831:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 838:	31 c0                	xor    %eax,%eax
+ 83a:	eb 89                	jmp    7c5 <printint+0x25>
+ 83c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000840 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 840:	55                   	push   %ebp
+ 841:	89 e5                	mov    %esp,%ebp
+ 843:	57                   	push   %edi
+ 844:	56                   	push   %esi
+ 845:	53                   	push   %ebx
+ 846:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 849:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 84c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 84f:	0f b6 1e             	movzbl (%esi),%ebx
+ 852:	83 c6 01             	add    $0x1,%esi
+ 855:	84 db                	test   %bl,%bl
+ 857:	74 67                	je     8c0 <printf+0x80>
+ 859:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 85c:	31 d2                	xor    %edx,%edx
+ 85e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 861:	eb 34                	jmp    897 <printf+0x57>
+ 863:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 867:	90                   	nop
+ 868:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 86b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 870:	83 f8 25             	cmp    $0x25,%eax
+ 873:	74 18                	je     88d <printf+0x4d>
+  write(fd, &c, 1);
+ 875:	83 ec 04             	sub    $0x4,%esp
+ 878:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 87b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 87e:	6a 01                	push   $0x1
+ 880:	50                   	push   %eax
+ 881:	57                   	push   %edi
+ 882:	e8 5c fe ff ff       	call   6e3 <write>
+ 887:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 88a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 88d:	0f b6 1e             	movzbl (%esi),%ebx
+ 890:	83 c6 01             	add    $0x1,%esi
+ 893:	84 db                	test   %bl,%bl
+ 895:	74 29                	je     8c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 897:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 89a:	85 d2                	test   %edx,%edx
+ 89c:	74 ca                	je     868 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 89e:	83 fa 25             	cmp    $0x25,%edx
+ 8a1:	75 ea                	jne    88d <printf+0x4d>
+      if(c == 'd'){
+ 8a3:	83 f8 25             	cmp    $0x25,%eax
+ 8a6:	0f 84 24 01 00 00    	je     9d0 <printf+0x190>
+ 8ac:	83 e8 63             	sub    $0x63,%eax
+ 8af:	83 f8 15             	cmp    $0x15,%eax
+ 8b2:	77 1c                	ja     8d0 <printf+0x90>
+ 8b4:	ff 24 85 c4 0f 00 00 	jmp    *0xfc4(,%eax,4)
+ 8bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8c3:	5b                   	pop    %ebx
+ 8c4:	5e                   	pop    %esi
+ 8c5:	5f                   	pop    %edi
+ 8c6:	5d                   	pop    %ebp
+ 8c7:	c3                   	ret
+ 8c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8cf:	90                   	nop
+  write(fd, &c, 1);
+ 8d0:	83 ec 04             	sub    $0x4,%esp
+ 8d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 8da:	6a 01                	push   $0x1
+ 8dc:	52                   	push   %edx
+ 8dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8e0:	57                   	push   %edi
+ 8e1:	e8 fd fd ff ff       	call   6e3 <write>
+ 8e6:	83 c4 0c             	add    $0xc,%esp
+ 8e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8ec:	6a 01                	push   $0x1
+ 8ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8f1:	52                   	push   %edx
+ 8f2:	57                   	push   %edi
+ 8f3:	e8 eb fd ff ff       	call   6e3 <write>
+        putc(fd, c);
+ 8f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8fb:	31 d2                	xor    %edx,%edx
+ 8fd:	eb 8e                	jmp    88d <printf+0x4d>
+ 8ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 900:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 903:	83 ec 0c             	sub    $0xc,%esp
+ 906:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 90b:	8b 13                	mov    (%ebx),%edx
+ 90d:	6a 00                	push   $0x0
+ 90f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 911:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 914:	e8 87 fe ff ff       	call   7a0 <printint>
+        ap++;
+ 919:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 91c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 91f:	31 d2                	xor    %edx,%edx
+ 921:	e9 67 ff ff ff       	jmp    88d <printf+0x4d>
+ 926:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 92d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 930:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 933:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 935:	83 c0 04             	add    $0x4,%eax
+ 938:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 93b:	85 db                	test   %ebx,%ebx
+ 93d:	0f 84 9d 00 00 00    	je     9e0 <printf+0x1a0>
+        while(*s != 0){
+ 943:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 946:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 948:	84 c0                	test   %al,%al
+ 94a:	0f 84 3d ff ff ff    	je     88d <printf+0x4d>
+ 950:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 953:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 956:	89 de                	mov    %ebx,%esi
+ 958:	89 d3                	mov    %edx,%ebx
+ 95a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 960:	83 ec 04             	sub    $0x4,%esp
+ 963:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 966:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 969:	6a 01                	push   $0x1
+ 96b:	53                   	push   %ebx
+ 96c:	57                   	push   %edi
+ 96d:	e8 71 fd ff ff       	call   6e3 <write>
+        while(*s != 0){
+ 972:	0f b6 06             	movzbl (%esi),%eax
+ 975:	83 c4 10             	add    $0x10,%esp
+ 978:	84 c0                	test   %al,%al
+ 97a:	75 e4                	jne    960 <printf+0x120>
+      state = 0;
+ 97c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 97f:	31 d2                	xor    %edx,%edx
+ 981:	e9 07 ff ff ff       	jmp    88d <printf+0x4d>
+ 986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 990:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 993:	83 ec 0c             	sub    $0xc,%esp
+ 996:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 99b:	8b 13                	mov    (%ebx),%edx
+ 99d:	6a 01                	push   $0x1
+ 99f:	e9 6b ff ff ff       	jmp    90f <printf+0xcf>
+ 9a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 9a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 9ab:	83 ec 04             	sub    $0x4,%esp
+ 9ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 9b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 9b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 9b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 9b9:	6a 01                	push   $0x1
+ 9bb:	52                   	push   %edx
+ 9bc:	57                   	push   %edi
+ 9bd:	e8 21 fd ff ff       	call   6e3 <write>
+        ap++;
+ 9c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9c8:	31 d2                	xor    %edx,%edx
+ 9ca:	e9 be fe ff ff       	jmp    88d <printf+0x4d>
+ 9cf:	90                   	nop
+  write(fd, &c, 1);
+ 9d0:	83 ec 04             	sub    $0x4,%esp
+ 9d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9d9:	6a 01                	push   $0x1
+ 9db:	e9 11 ff ff ff       	jmp    8f1 <printf+0xb1>
+ 9e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9e5:	bb bc 0f 00 00       	mov    $0xfbc,%ebx
+ 9ea:	e9 61 ff ff ff       	jmp    950 <printf+0x110>
+ 9ef:	90                   	nop
+
+000009f0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9f0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9f1:	a1 90 13 00 00       	mov    0x1390,%eax
+{
+ 9f6:	89 e5                	mov    %esp,%ebp
+ 9f8:	57                   	push   %edi
+ 9f9:	56                   	push   %esi
+ 9fa:	53                   	push   %ebx
+ 9fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 9fe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a08:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a0a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a0c:	39 ca                	cmp    %ecx,%edx
+ a0e:	73 30                	jae    a40 <free+0x50>
+ a10:	39 c1                	cmp    %eax,%ecx
+ a12:	72 04                	jb     a18 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a14:	39 c2                	cmp    %eax,%edx
+ a16:	72 f0                	jb     a08 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a18:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a1b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a1e:	39 f8                	cmp    %edi,%eax
+ a20:	74 2e                	je     a50 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a22:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a25:	8b 42 04             	mov    0x4(%edx),%eax
+ a28:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a2b:	39 f1                	cmp    %esi,%ecx
+ a2d:	74 38                	je     a67 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a2f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a31:	5b                   	pop    %ebx
+  freep = p;
+ a32:	89 15 90 13 00 00    	mov    %edx,0x1390
+}
+ a38:	5e                   	pop    %esi
+ a39:	5f                   	pop    %edi
+ a3a:	5d                   	pop    %ebp
+ a3b:	c3                   	ret
+ a3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a40:	39 c1                	cmp    %eax,%ecx
+ a42:	72 d0                	jb     a14 <free+0x24>
+ a44:	eb c2                	jmp    a08 <free+0x18>
+ a46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a4d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a50:	03 70 04             	add    0x4(%eax),%esi
+ a53:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a56:	8b 02                	mov    (%edx),%eax
+ a58:	8b 00                	mov    (%eax),%eax
+ a5a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a5d:	8b 42 04             	mov    0x4(%edx),%eax
+ a60:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a63:	39 f1                	cmp    %esi,%ecx
+ a65:	75 c8                	jne    a2f <free+0x3f>
+    p->s.size += bp->s.size;
+ a67:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a6a:	89 15 90 13 00 00    	mov    %edx,0x1390
+    p->s.size += bp->s.size;
+ a70:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a73:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a76:	89 0a                	mov    %ecx,(%edx)
+}
+ a78:	5b                   	pop    %ebx
+ a79:	5e                   	pop    %esi
+ a7a:	5f                   	pop    %edi
+ a7b:	5d                   	pop    %ebp
+ a7c:	c3                   	ret
+ a7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a80 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a80:	55                   	push   %ebp
+ a81:	89 e5                	mov    %esp,%ebp
+ a83:	57                   	push   %edi
+ a84:	56                   	push   %esi
+ a85:	53                   	push   %ebx
+ a86:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a89:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a8c:	8b 15 90 13 00 00    	mov    0x1390,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a92:	8d 78 07             	lea    0x7(%eax),%edi
+ a95:	c1 ef 03             	shr    $0x3,%edi
+ a98:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a9b:	85 d2                	test   %edx,%edx
+ a9d:	0f 84 8d 00 00 00    	je     b30 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ aa3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ aa5:	8b 48 04             	mov    0x4(%eax),%ecx
+ aa8:	39 f9                	cmp    %edi,%ecx
+ aaa:	73 64                	jae    b10 <malloc+0x90>
+  if(nu < 4096)
+ aac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ ab1:	39 df                	cmp    %ebx,%edi
+ ab3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ ab6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ abd:	eb 0a                	jmp    ac9 <malloc+0x49>
+ abf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ac0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ac2:	8b 48 04             	mov    0x4(%eax),%ecx
+ ac5:	39 f9                	cmp    %edi,%ecx
+ ac7:	73 47                	jae    b10 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ ac9:	89 c2                	mov    %eax,%edx
+ acb:	39 05 90 13 00 00    	cmp    %eax,0x1390
+ ad1:	75 ed                	jne    ac0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ad3:	83 ec 0c             	sub    $0xc,%esp
+ ad6:	56                   	push   %esi
+ ad7:	e8 6f fc ff ff       	call   74b <sbrk>
+  if(p == (char*)-1)
+ adc:	83 c4 10             	add    $0x10,%esp
+ adf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ae2:	74 1c                	je     b00 <malloc+0x80>
+  hp->s.size = nu;
+ ae4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ae7:	83 ec 0c             	sub    $0xc,%esp
+ aea:	83 c0 08             	add    $0x8,%eax
+ aed:	50                   	push   %eax
+ aee:	e8 fd fe ff ff       	call   9f0 <free>
+  return freep;
+ af3:	8b 15 90 13 00 00    	mov    0x1390,%edx
+      if((p = morecore(nunits)) == 0)
+ af9:	83 c4 10             	add    $0x10,%esp
+ afc:	85 d2                	test   %edx,%edx
+ afe:	75 c0                	jne    ac0 <malloc+0x40>
+        return 0;
+  }
+}
+ b00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b03:	31 c0                	xor    %eax,%eax
+}
+ b05:	5b                   	pop    %ebx
+ b06:	5e                   	pop    %esi
+ b07:	5f                   	pop    %edi
+ b08:	5d                   	pop    %ebp
+ b09:	c3                   	ret
+ b0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b10:	39 cf                	cmp    %ecx,%edi
+ b12:	74 4c                	je     b60 <malloc+0xe0>
+        p->s.size -= nunits;
+ b14:	29 f9                	sub    %edi,%ecx
+ b16:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b19:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b1c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b1f:	89 15 90 13 00 00    	mov    %edx,0x1390
+}
+ b25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b28:	83 c0 08             	add    $0x8,%eax
+}
+ b2b:	5b                   	pop    %ebx
+ b2c:	5e                   	pop    %esi
+ b2d:	5f                   	pop    %edi
+ b2e:	5d                   	pop    %ebp
+ b2f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b30:	c7 05 90 13 00 00 94 	movl   $0x1394,0x1390
+ b37:	13 00 00 
+    base.s.size = 0;
+ b3a:	b8 94 13 00 00       	mov    $0x1394,%eax
+    base.s.ptr = freep = prevp = &base;
+ b3f:	c7 05 94 13 00 00 94 	movl   $0x1394,0x1394
+ b46:	13 00 00 
+    base.s.size = 0;
+ b49:	c7 05 98 13 00 00 00 	movl   $0x0,0x1398
+ b50:	00 00 00 
+    if(p->s.size >= nunits){
+ b53:	e9 54 ff ff ff       	jmp    aac <malloc+0x2c>
+ b58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b5f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b60:	8b 08                	mov    (%eax),%ecx
+ b62:	89 0a                	mov    %ecx,(%edx)
+ b64:	eb b9                	jmp    b1f <malloc+0x9f>
+ b66:	66 90                	xchg   %ax,%ax
+ b68:	66 90                	xchg   %ax,%ax
+ b6a:	66 90                	xchg   %ax,%ax
+ b6c:	66 90                	xchg   %ax,%ax
+ b6e:	66 90                	xchg   %ax,%ax
+
+00000b70 <pidstat>:
+
+// Fill in *st with the statistics of process pid.
+// Returns 0, or -1 if there is no such process.
+int
+pidstat(int pid, struct pstat *st)
+{
+ b70:	55                   	push   %ebp
+ b71:	89 e5                	mov    %esp,%ebp
+ b73:	56                   	push   %esi
+ b74:	53                   	push   %ebx
+  static struct pstat *ps;
+  int i, n;
+
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ b75:	a1 9c 13 00 00       	mov    0x139c,%eax
+{
+ b7a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ b7d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ b80:	85 c0                	test   %eax,%eax
+ b82:	0f 84 98 00 00 00    	je     c20 <pidstat+0xb0>
+    return -1;
+  n = getpstat(ps, NPROC);
+ b88:	83 ec 08             	sub    $0x8,%esp
+ b8b:	6a 40                	push   $0x40
+ b8d:	50                   	push   %eax
+ b8e:	e8 e0 fb ff ff       	call   773 <getpstat>
+  for(i = 0; i < n; i++){
+ b93:	83 c4 10             	add    $0x10,%esp
+ b96:	85 c0                	test   %eax,%eax
+ b98:	0f 8e 9f 00 00 00    	jle    c3d <pidstat+0xcd>
+ b9e:	8b 15 9c 13 00 00    	mov    0x139c,%edx
+ ba4:	31 c9                	xor    %ecx,%ecx
+ ba6:	eb 16                	jmp    bbe <pidstat+0x4e>
+ ba8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ baf:	90                   	nop
+ bb0:	83 c1 01             	add    $0x1,%ecx
+ bb3:	83 c2 38             	add    $0x38,%edx
+ bb6:	39 c8                	cmp    %ecx,%eax
+ bb8:	0f 84 7f 00 00 00    	je     c3d <pidstat+0xcd>
+    if(ps[i].pid == pid){
+ bbe:	39 1a                	cmp    %ebx,(%edx)
+ bc0:	75 ee                	jne    bb0 <pidstat+0x40>
+      *st = ps[i];
+ bc2:	89 1e                	mov    %ebx,(%esi)
+ bc4:	8b 42 04             	mov    0x4(%edx),%eax
+ bc7:	89 46 04             	mov    %eax,0x4(%esi)
+ bca:	8b 42 08             	mov    0x8(%edx),%eax
+ bcd:	89 46 08             	mov    %eax,0x8(%esi)
+ bd0:	8b 42 0c             	mov    0xc(%edx),%eax
+ bd3:	89 46 0c             	mov    %eax,0xc(%esi)
+ bd6:	8b 42 10             	mov    0x10(%edx),%eax
+ bd9:	89 46 10             	mov    %eax,0x10(%esi)
+ bdc:	8b 42 14             	mov    0x14(%edx),%eax
+ bdf:	89 46 14             	mov    %eax,0x14(%esi)
+ be2:	8b 42 18             	mov    0x18(%edx),%eax
+ be5:	89 46 18             	mov    %eax,0x18(%esi)
+ be8:	8b 42 1c             	mov    0x1c(%edx),%eax
+ beb:	89 46 1c             	mov    %eax,0x1c(%esi)
+ bee:	8b 42 20             	mov    0x20(%edx),%eax
+ bf1:	89 46 20             	mov    %eax,0x20(%esi)
+ bf4:	8b 42 24             	mov    0x24(%edx),%eax
+ bf7:	89 46 24             	mov    %eax,0x24(%esi)
+ bfa:	8b 42 28             	mov    0x28(%edx),%eax
+ bfd:	89 46 28             	mov    %eax,0x28(%esi)
+ c00:	8b 42 2c             	mov    0x2c(%edx),%eax
+ c03:	89 46 2c             	mov    %eax,0x2c(%esi)
+ c06:	8b 42 30             	mov    0x30(%edx),%eax
+ c09:	89 46 30             	mov    %eax,0x30(%esi)
+ c0c:	8b 42 34             	mov    0x34(%edx),%eax
+ c0f:	89 46 34             	mov    %eax,0x34(%esi)
+      return 0;
+    }
+  }
+  return -1;
+}
+ c12:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+ c15:	31 c0                	xor    %eax,%eax
+}
+ c17:	5b                   	pop    %ebx
+ c18:	5e                   	pop    %esi
+ c19:	5d                   	pop    %ebp
+ c1a:	c3                   	ret
+ c1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c1f:	90                   	nop
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+ c20:	83 ec 0c             	sub    $0xc,%esp
+ c23:	68 00 0e 00 00       	push   $0xe00
+ c28:	e8 53 fe ff ff       	call   a80 <malloc>
+ c2d:	83 c4 10             	add    $0x10,%esp
+ c30:	a3 9c 13 00 00       	mov    %eax,0x139c
+ c35:	85 c0                	test   %eax,%eax
+ c37:	0f 85 4b ff ff ff    	jne    b88 <pidstat+0x18>
+}
+ c3d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return -1;
+ c40:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+ c45:	5b                   	pop    %ebx
+ c46:	5e                   	pop    %esi
+ c47:	5d                   	pop    %ebp
+ c48:	c3                   	ret
+ c49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000c50 <sharetable>:
+// key[i] is printed in a column headed keyname, and so is
+// extra[i] under extraname unless extra is 0.
+void
+sharetable(char *tag, char *keyname, int *key, char *extraname, int *extra,
+           int n, int *pid, int *weight, uint *ticks)
+{
+ c50:	55                   	push   %ebp
+ c51:	89 e5                	mov    %esp,%ebp
+ c53:	57                   	push   %edi
+ c54:	56                   	push   %esi
+ c55:	53                   	push   %ebx
+ c56:	83 ec 3c             	sub    $0x3c,%esp
+ c59:	8b 45 08             	mov    0x8(%ebp),%eax
+ c5c:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+ c5f:	8b 75 24             	mov    0x24(%ebp),%esi
+ c62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ c65:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ c68:	8b 45 10             	mov    0x10(%ebp),%eax
+ c6b:	89 7d d0             	mov    %edi,-0x30(%ebp)
+ c6e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+ c71:	89 45 cc             	mov    %eax,-0x34(%ebp)
+ c74:	8b 45 18             	mov    0x18(%ebp),%eax
+ c77:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+ c7a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+ c7d:	8b 45 20             	mov    0x20(%ebp),%eax
+ c80:	89 45 c8             	mov    %eax,-0x38(%ebp)
+ c83:	8b 45 28             	mov    0x28(%ebp),%eax
+ c86:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  int i, wsum, share, expect, err, maxerr;
+  uint tsum;
+
+  wsum = 0;
+  tsum = 0;
+  for(i = 0; i < n; i++){
+ c89:	85 ff                	test   %edi,%edi
+ c8b:	0f 8e df 01 00 00    	jle    e70 <sharetable+0x220>
+ c91:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+ c94:	89 fb                	mov    %edi,%ebx
+ c96:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  tsum = 0;
+ c99:	31 d2                	xor    %edx,%edx
+  for(i = 0; i < n; i++){
+ c9b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+ c9e:	31 c0                	xor    %eax,%eax
+ ca0:	31 c9                	xor    %ecx,%ecx
+ ca2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wsum += weight[i];
+ ca8:	03 0c 86             	add    (%esi,%eax,4),%ecx
+    tsum += ticks[i];
+ cab:	03 14 87             	add    (%edi,%eax,4),%edx
+  for(i = 0; i < n; i++){
+ cae:	83 c0 01             	add    $0x1,%eax
+ cb1:	39 c3                	cmp    %eax,%ebx
+ cb3:	75 f3                	jne    ca8 <sharetable+0x58>
+ cb5:	85 d2                	test   %edx,%edx
+ cb7:	b8 01 00 00 00       	mov    $0x1,%eax
+ cbc:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  }
+  if(tsum == 0)
+    tsum = 1;
+  if(wsum == 0)
+    wsum = 1;
+ cbf:	8b 7d d8             	mov    -0x28(%ebp),%edi
+ cc2:	0f 45 c2             	cmovne %edx,%eax
+ cc5:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+  if(tsum == 0)
+ cc8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    wsum = 1;
+ ccb:	85 ff                	test   %edi,%edi
+ ccd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ cd0:	b8 01 00 00 00       	mov    $0x1,%eax
+ cd5:	0f 45 c7             	cmovne %edi,%eax
+ cd8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+
+  printf(1, "[%s]  pid %s ", tag, keyname);
+ cdb:	51                   	push   %ecx
+ cdc:	ff 75 dc             	push   -0x24(%ebp)
+ cdf:	68 2d 10 00 00       	push   $0x102d
+ ce4:	6a 01                	push   $0x1
+ ce6:	e8 55 fb ff ff       	call   840 <printf>
+  if(extra)
+ ceb:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ cee:	83 c4 10             	add    $0x10,%esp
+ cf1:	85 f6                	test   %esi,%esi
+ cf3:	0f 84 47 01 00 00    	je     e40 <sharetable+0x1f0>
+    printf(1, "%s ", extraname);
+ cf9:	83 ec 04             	sub    $0x4,%esp
+ cfc:	53                   	push   %ebx
+ cfd:	68 37 10 00 00       	push   $0x1037
+ d02:	6a 01                	push   $0x1
+ d04:	e8 37 fb ff ff       	call   840 <printf>
+  printf(1, "ticks  share expected\n");
+ d09:	58                   	pop    %eax
+ d0a:	5a                   	pop    %edx
+ d0b:	68 3b 10 00 00       	push   $0x103b
+ d10:	6a 01                	push   $0x1
+ d12:	e8 29 fb ff ff       	call   840 <printf>
+  maxerr = 0;
+  for(i = 0; i < n; i++){
+ d17:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+ d1a:	83 c4 10             	add    $0x10,%esp
+ d1d:	85 c9                	test   %ecx,%ecx
+ d1f:	0f 8e 44 01 00 00    	jle    e69 <sharetable+0x219>
+  if(extra)
+ d25:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+ d2c:	31 ff                	xor    %edi,%edi
+ d2e:	66 90                	xchg   %ax,%ax
+    share = ticks[i] * 1000 / tsum;
+ d30:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ d33:	31 d2                	xor    %edx,%edx
+    expect = weight[i] * 1000 / wsum;
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+ d35:	83 ec 0c             	sub    $0xc,%esp
+    share = ticks[i] * 1000 / tsum;
+ d38:	69 04 b8 e8 03 00 00 	imul   $0x3e8,(%eax,%edi,4),%eax
+ d3f:	f7 75 c0             	divl   -0x40(%ebp)
+ d42:	89 c6                	mov    %eax,%esi
+    expect = weight[i] * 1000 / wsum;
+ d44:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ d47:	69 04 b8 e8 03 00 00 	imul   $0x3e8,(%eax,%edi,4),%eax
+ d4e:	99                   	cltd
+ d4f:	f7 7d d8             	idivl  -0x28(%ebp)
+ d52:	89 c3                	mov    %eax,%ebx
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+ d54:	8b 45 cc             	mov    -0x34(%ebp),%eax
+ d57:	ff 34 b8             	push   (%eax,%edi,4)
+ d5a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+ d5d:	ff 34 b8             	push   (%eax,%edi,4)
+ d60:	ff 75 dc             	push   -0x24(%ebp)
+ d63:	68 52 10 00 00       	push   $0x1052
+ d68:	6a 01                	push   $0x1
+ d6a:	e8 d1 fa ff ff       	call   840 <printf>
+    if(extra)
+ d6f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ d72:	83 c4 20             	add    $0x20,%esp
+ d75:	85 c0                	test   %eax,%eax
+ d77:	74 15                	je     d8e <sharetable+0x13e>
+      printf(1, "%d ", extra[i]);
+ d79:	83 ec 04             	sub    $0x4,%esp
+ d7c:	ff 34 b8             	push   (%eax,%edi,4)
+ d7f:	68 5a 10 00 00       	push   $0x105a
+ d84:	6a 01                	push   $0x1
+ d86:	e8 b5 fa ff ff       	call   840 <printf>
+ d8b:	83 c4 10             	add    $0x10,%esp
+    printf(1, "%d %d.%d%% %d.%d%%\n", ticks[i], share / 10, share % 10,
+ d8e:	b8 67 66 66 66       	mov    $0x66666667,%eax
+ d93:	89 d9                	mov    %ebx,%ecx
+ d95:	83 ec 04             	sub    $0x4,%esp
+ d98:	f7 eb                	imul   %ebx
+ d9a:	89 d8                	mov    %ebx,%eax
+ d9c:	c1 f8 1f             	sar    $0x1f,%eax
+ d9f:	c1 fa 02             	sar    $0x2,%edx
+ da2:	29 c2                	sub    %eax,%edx
+ da4:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ da7:	01 c0                	add    %eax,%eax
+ da9:	29 c1                	sub    %eax,%ecx
+ dab:	b8 67 66 66 66       	mov    $0x66666667,%eax
+ db0:	51                   	push   %ecx
+ db1:	89 f1                	mov    %esi,%ecx
+ db3:	52                   	push   %edx
+ db4:	f7 ee                	imul   %esi
+ db6:	89 f0                	mov    %esi,%eax
+ db8:	c1 f8 1f             	sar    $0x1f,%eax
+ dbb:	c1 fa 02             	sar    $0x2,%edx
+ dbe:	29 c2                	sub    %eax,%edx
+ dc0:	8d 04 92             	lea    (%edx,%edx,4),%eax
+ dc3:	01 c0                	add    %eax,%eax
+ dc5:	29 c1                	sub    %eax,%ecx
+ dc7:	51                   	push   %ecx
+ dc8:	52                   	push   %edx
+ dc9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ dcc:	ff 34 b8             	push   (%eax,%edi,4)
+ dcf:	68 5e 10 00 00       	push   $0x105e
+ dd4:	6a 01                	push   $0x1
+ dd6:	e8 65 fa ff ff       	call   840 <printf>
+           expect / 10, expect % 10);
+    err = share > expect ? share - expect : expect - share;
+ ddb:	89 f2                	mov    %esi,%edx
+ ddd:	89 d8                	mov    %ebx,%eax
+ ddf:	83 c4 20             	add    $0x20,%esp
+ de2:	29 f0                	sub    %esi,%eax
+ de4:	29 da                	sub    %ebx,%edx
+ de6:	39 de                	cmp    %ebx,%esi
+ de8:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+ deb:	0f 4f c2             	cmovg  %edx,%eax
+    if(err > maxerr)
+ dee:	39 c6                	cmp    %eax,%esi
+ df0:	0f 4d c6             	cmovge %esi,%eax
+  for(i = 0; i < n; i++){
+ df3:	83 c7 01             	add    $0x1,%edi
+ df6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ df9:	39 7d d0             	cmp    %edi,-0x30(%ebp)
+ dfc:	0f 85 2e ff ff ff    	jne    d30 <sharetable+0xe0>
+      maxerr = err;
+  }
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+ e02:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+ e07:	f7 e2                	mul    %edx
+ e09:	c1 ea 03             	shr    $0x3,%edx
+ e0c:	8d 0c 92             	lea    (%edx,%edx,4),%ecx
+ e0f:	89 d0                	mov    %edx,%eax
+ e11:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ e14:	01 c9                	add    %ecx,%ecx
+ e16:	29 ca                	sub    %ecx,%edx
+ e18:	89 45 14             	mov    %eax,0x14(%ebp)
+ e1b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ e1e:	89 55 18             	mov    %edx,0x18(%ebp)
+ e21:	89 45 10             	mov    %eax,0x10(%ebp)
+ e24:	c7 45 0c 74 10 00 00 	movl   $0x1074,0xc(%ebp)
+ e2b:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+ e32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e35:	5b                   	pop    %ebx
+ e36:	5e                   	pop    %esi
+ e37:	5f                   	pop    %edi
+ e38:	5d                   	pop    %ebp
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+ e39:	e9 02 fa ff ff       	jmp    840 <printf>
+ e3e:	66 90                	xchg   %ax,%ax
+  printf(1, "ticks  share expected\n");
+ e40:	83 ec 08             	sub    $0x8,%esp
+ e43:	68 3b 10 00 00       	push   $0x103b
+ e48:	6a 01                	push   $0x1
+ e4a:	e8 f1 f9 ff ff       	call   840 <printf>
+ e4f:	83 c4 10             	add    $0x10,%esp
+ e52:	e9 ce fe ff ff       	jmp    d25 <sharetable+0xd5>
+ e57:	83 ec 08             	sub    $0x8,%esp
+ e5a:	68 3b 10 00 00       	push   $0x103b
+ e5f:	6a 01                	push   $0x1
+ e61:	e8 da f9 ff ff       	call   840 <printf>
+ e66:	83 c4 10             	add    $0x10,%esp
+  if(extra)
+ e69:	31 c0                	xor    %eax,%eax
+ e6b:	31 d2                	xor    %edx,%edx
+ e6d:	eb a9                	jmp    e18 <sharetable+0x1c8>
+ e6f:	90                   	nop
+  printf(1, "[%s]  pid %s ", tag, keyname);
+ e70:	51                   	push   %ecx
+ e71:	ff 75 dc             	push   -0x24(%ebp)
+ e74:	68 2d 10 00 00       	push   $0x102d
+ e79:	6a 01                	push   $0x1
+ e7b:	e8 c0 f9 ff ff       	call   840 <printf>
+  if(extra)
+ e80:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+ e83:	83 c4 10             	add    $0x10,%esp
+ e86:	85 ff                	test   %edi,%edi
+ e88:	74 cd                	je     e57 <sharetable+0x207>
+    wsum = 1;
+ e8a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  if(extra)
+ e91:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+ e98:	e9 5c fe ff ff       	jmp    cf9 <sharetable+0xa9>
@@ -1,11 +1,29 @@
-// test2.c — Priority RR sanity test
-// Spawns 3 CPU-bound workers for a fixed time window.
-// Parent assigns nice levels {0,2,4} to the children and compares work done.
-// Expect: count(nice=0) > count(nice=2) > count(nice=4) (roughly).
+// test2.c — CPU share benchmark
+// Spawns CPU-bound workers for a fixed time window.
+// Parent assigns each a nice level (default {0,2,4}) and compares
+// the CPU ticks each got against the shares the FAIR_SCHED weights
+// promise. Under PRIORITY_SCHED, expect instead
+// work(nice=0) > work(nice=2) > work(nice=4) (roughly).
+// Shares only mean something when the workers compete for one
+// CPU, so run with CPUS=1.
+//
+// usage: test2 [ticks] [nice...]
 
 #include "types.h"
 #include "stat.h"
 #include "user.h"
+#include "pstat.h"
+
+#define MAXW 8
+
+// Weight by nice value, as in proc.c.
+static int weight[] = { 2501, 1586, 1024, 655, 423 };
+
+struct result {
+  int pid;
+  int count;
+  uint runticks;
+};
 
 static int
 isprime(int x) {
@@ -17,53 +35,97 @@ isprime(int x) {
 }
 
 static void
-worker(int dur_ticks) {
+worker(int dur_ticks, int fd) {
   int start = uptime();
-  int n = 1, count = 0;
+  int n = 1;
+  struct result r;
+  struct pstat st;
 
+  r.pid = getpid();
+  r.count = 0;
   while (uptime() - start < dur_ticks) {
     // do some CPU work
-    count += isprime(n);
+    r.count += isprime(n);
     n++;
   }
 
-  printf(1, "worker pid=%d done=%d\n", getpid(), count);
+  r.runticks = pidstat(r.pid, &st) == 0 ? st.runticks : 0;
+
+  printf(1, "worker pid=%d done=%d\n", r.pid, r.count);
+  write(fd, &r, sizeof(r));
   exit();
 }
 
 int
 main(int argc, char *argv[]) {
-  int dur = 1000; 
-  if (argc > 1) dur = atoi(argv[1]);
-
-  printf(1, "\n[TEST2] duration=%d ticks\n", dur);
+  int dur = 1000;
+  int nw = 3, nices[MAXW] = { 0, 2, 4 }, pids[MAXW], w[MAXW], work[MAXW];
+  struct result res[MAXW];
+  uint ticks[MAXW];
+  int fds[2], i, j;
 
-  int p0 = fork();
-  if (p0 == 0) { worker(dur); }
+  if (argc > 1) dur = atoi(argv[1]);
+  if (argc > 2) {
+    for (nw = 0; nw < MAXW && nw + 2 < argc; nw++) {
+      nices[nw] = atoi(argv[nw + 2]);
+      if (nices[nw] < 0 || nices[nw] > 4) {
+        printf(2, "test2: nice must be 0..4\n");
+        exit();
+      }
+    }
+  }
 
-  int p2 = fork();
-  if (p2 == 0) { worker(dur); }
+  printf(1, "\n[TEST2] duration=%d ticks, %d workers\n", dur, nw);
 
-  int p4 = fork();
-  if (p4 == 0) { worker(dur); }
+  if (pipe(fds) < 0) {
+    printf(2, "test2: pipe failed\n");
+    exit();
+  }
+  for (i = 0; i < nw; i++) {
+    pids[i] = fork();
+    if (pids[i] < 0) {
+      printf(2, "test2: fork failed\n");
+      exit();
+    }
+    if (pids[i] == 0) {
+      close(fds[0]);
+      worker(dur, fds[1]);
+    }
+  }
+  close(fds[1]);
 
   // parent: set nice values (lower is higher priority)
-  sleep(1); // slight delay to ensure children exist
+  for (i = 0; i < nw; i++)
+    nice(pids[i], nices[i]);
 
-  // clamp is handled in kernel, but we set desired explicitly:
-  // nice(pid, value) returns old value; we don't need it here.
-  nice(p0, 0);
-  nice(p2, 2);
-  nice(p4, 4);
+  printf(1, "[TEST2] set priorities:");
+  for (i = 0; i < nw; i++)
+    printf(1, " pid %d->%d", pids[i], nices[i]);
+  printf(1, "\n");
 
-  printf(1, "[TEST2] set priorities: pid %d->0, pid %d->2, pid %d->4\n", p0, p2, p4);
-
-  // wait for all
-  wait();
-  wait();
-  wait();
+  // collect results, then reap
+  for (i = 0; i < nw; i++) {
+    if (read(fds[0], &res[i], sizeof(res[i])) != sizeof(res[i])) {
+      printf(2, "test2: lost a worker's result\n");
+      exit();
+    }
+  }
+  close(fds[0]);
+  for (i = 0; i < nw; i++)
+    wait();
 
-  printf(1, "[TEST2] done. Expect roughly: work(pid=%d) > work(pid=%d) > work(pid=%d)\n\n",
-         p0, p2, p4);
+  for (i = 0; i < nw; i++) {
+    w[i] = weight[nices[i]];
+    work[i] = 0;
+    ticks[i] = 0;
+    for (j = 0; j < nw; j++) {
+      if (res[j].pid == pids[i]) {
+        work[i] = res[j].count;
+        ticks[i] = res[j].runticks;
+      }
+    }
+  }
+  sharetable("TEST2", "nice", nices, "work", work, nw, pids, w, ticks);
+  printf(1, "[TEST2] done (weights apply to FAIR_SCHED)\n\n");
   exit();
 }
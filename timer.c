@@ -0,0 +1,154 @@
+// Timed sleeps.
+//
+// A process that sleeps until some tick puts itself on a
+// timer wheel, and the timer interrupt wakes just the
+// processes whose tick has come, instead of every sleeper
+// re-checking the time on every tick.
+//
+// The wheel is hierarchical: level 0 has a slot for each of
+// the next WHEELSIZE ticks, level 1 a slot for each of the
+// next WHEELSIZE runs of WHEELSIZE ticks, and so on. When
+// level 0 comes round to its first slot, the level 1 slot
+// for the coming run is emptied onto level 0, and likewise
+// up the levels. Deadlines beyond the top level are parked
+// in its farthest slot and re-sorted when it comes round.
+//
+// The wheel and the timer fields of struct proc are
+// protected by tickslock.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "spinlock.h"
+
+#define WHEELBITS  6
+#define WHEELSIZE  (1 << WHEELBITS)
+#define WHEELMASK  (WHEELSIZE - 1)
+#define NLEVEL     4
+
+static struct proc *wheel[NLEVEL][WHEELSIZE];
+static uint wheelnow;   // next tick whose slot has yet to fire
+
+// Put p in the slot for p->expire.
+static void
+wheeladd(struct proc *p)
+{
+  struct proc **slot;
+  uint t, delta;
+  int lvl;
+
+  t = p->expire;
+  if((int)(t - wheelnow) < 0)
+    t = wheelnow;               // already due: fire next time
+  delta = t - wheelnow;
+  for(lvl = 0; lvl < NLEVEL-1; lvl++)
+    if(delta < 1 << ((lvl+1)*WHEELBITS))
+      break;
+  if(lvl == NLEVEL-1 && delta >= 1 << (NLEVEL*WHEELBITS))
+    t = wheelnow + (1 << (NLEVEL*WHEELBITS)) - 1;
+  slot = &wheel[lvl][(t >> (lvl*WHEELBITS)) & WHEELMASK];
+
+  p->tnext = *slot;
+  if(*slot)
+    (*slot)->tprev = &p->tnext;
+  p->tprev = slot;
+  *slot = p;
+}
+
+// Take p off the wheel, if it is on it.
+void
+timerdel(struct proc *p)
+{
+  if(!holding(&tickslock))
+    panic("timerdel");
+  if(p->tprev == 0)
+    return;
+  *p->tprev = p->tnext;
+  if(p->tnext)
+    p->tnext->tprev = p->tprev;
+  p->tnext = 0;
+  p->tprev = 0;
+}
+
+// Arrange for the current process to be woken from a sleep
+// on chan at tick t. Replaces any timer it already has.
+// Caller holds tickslock.
+void
+timerset(uint t, void *chan)
+{
+  struct proc *p = myproc();
+
+  timerdel(p);
+  p->expire = t;
+  p->tchan = chan;
+  wheeladd(p);
+}
+
+// Empty a slot, returning the list that was in it.
+static struct proc*
+slottake(struct proc **slot)
+{
+  struct proc *p;
+
+  p = *slot;
+  *slot = 0;
+  if(p)
+    p->tprev = 0;
+  return p;
+}
+
+// Run the wheel up to ticks, waking the processes that are
+// due. Called from the timer interrupt with tickslock held.
+void
+timerrun(void)
+{
+  struct proc *p, *next;
+  int lvl;
+
+  while((int)(ticks - wheelnow) >= 0){
+    // Bring down the coming runs of the levels above.
+    for(lvl = NLEVEL-1; lvl > 0; lvl--){
+      if(wheelnow & ((1 << (lvl*WHEELBITS)) - 1))
+        continue;
+      p = slottake(&wheel[lvl][(wheelnow >> (lvl*WHEELBITS)) & WHEELMASK]);
+      for(; p; p = next){
+        next = p->tnext;
+        p->tprev = 0;
+        wheeladd(p);
+      }
+    }
+
+    p = slottake(&wheel[0][wheelnow & WHEELMASK]);
+    wheelnow++;
+    for(; p; p = next){
+      next = p->tnext;
+      p->tprev = 0;
+      // If p has not got as far as sleeping yet,
+      // try again next tick.
+      if(!wakeproc(p, p->tchan))
+        wheeladd(p);
+    }
+  }
+}
+
+// A lower bound on the ticks until the next timer is due:
+// the longest an idle CPU may sleep without missing one. The
+// scan stops where level 1 next cascades down, since timers
+// there are not yet sorted into ticks.
+// Caller holds tickslock.
+uint
+timernext(void)
+{
+  uint i;
+
+  for(i = 0; i < WHEELSIZE; i++){
+    if(wheel[0][(wheelnow + i) & WHEELMASK])
+      return wheelnow + i - ticks;
+    if(i > 0 && ((wheelnow + i) & WHEELMASK) == 0)
+      break;    // level 1 comes down here
+  }
+  return wheelnow + i - ticks;
+}
@@ -0,0 +1,2098 @@
+
+_top:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+  int count = 1, interval = 100;
+      10:	bb 01 00 00 00       	mov    $0x1,%ebx
+{
+      15:	51                   	push   %ecx
+      16:	83 ec 28             	sub    $0x28,%esp
+      19:	8b 39                	mov    (%ecx),%edi
+      1b:	8b 71 04             	mov    0x4(%ecx),%esi
+  int count = 1, interval = 100;
+      1e:	c7 45 cc 64 00 00 00 	movl   $0x64,-0x34(%ebp)
+  int n;
+
+  if (argc > 1) count = atoi(argv[1]);
+      25:	83 ff 01             	cmp    $0x1,%edi
+      28:	0f 8f 94 05 00 00    	jg     5c2 <main+0x5c2>
+  for (y = x, w--; y >= 10; y /= 10)
+      2e:	be cd cc cc cc       	mov    $0xcccccccd,%esi
+      33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      37:	90                   	nop
+  if (argc > 2) interval = atoi(argv[2]);
+
+  for (;;) {
+    if ((n = getpstat(ps, NPROC)) < 0) {
+      38:	83 ec 08             	sub    $0x8,%esp
+      3b:	6a 40                	push   $0x40
+      3d:	68 c0 22 00 00       	push   $0x22c0
+      42:	e8 ac 08 00 00       	call   8f3 <getpstat>
+      47:	83 c4 10             	add    $0x10,%esp
+      4a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+      4d:	85 c0                	test   %eax,%eax
+      4f:	0f 88 55 05 00 00    	js     5aa <main+0x5aa>
+  printf(1, "  PID CPU NI PR STATE     RUN    WAIT  MAXW  SWITCH BOOST NAME\n");
+      55:	83 ec 08             	sub    $0x8,%esp
+      58:	68 6c 10 00 00       	push   $0x106c
+      5d:	6a 01                	push   $0x1
+      5f:	e8 5c 09 00 00       	call   9c0 <printf>
+  for (i = 0; i < n; i++) {
+      64:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+      67:	83 c4 10             	add    $0x10,%esp
+      6a:	85 ff                	test   %edi,%edi
+      6c:	0f 84 2c 04 00 00    	je     49e <main+0x49e>
+      72:	c7 45 e4 c8 22 00 00 	movl   $0x22c8,-0x1c(%ebp)
+      79:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+      80:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+      83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      87:	90                   	nop
+    run = p->runticks;
+      88:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for (i = 0; i < nprev; i++)
+      8b:	8b 0d a0 14 00 00    	mov    0x14a0,%ecx
+    run = p->runticks;
+      91:	8b 78 1c             	mov    0x1c(%eax),%edi
+      94:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    wait = p->waitticks;
+      97:	8b 78 20             	mov    0x20(%eax),%edi
+      9a:	89 7d dc             	mov    %edi,-0x24(%ebp)
+    if ((q = lookup(p->pid)) != 0) {
+      9d:	8b 78 f8             	mov    -0x8(%eax),%edi
+  for (i = 0; i < nprev; i++)
+      a0:	85 c9                	test   %ecx,%ecx
+      a2:	7e 2f                	jle    d3 <main+0xd3>
+      a4:	ba c0 14 00 00       	mov    $0x14c0,%edx
+      a9:	31 c0                	xor    %eax,%eax
+      ab:	eb 0d                	jmp    ba <main+0xba>
+      ad:	8d 76 00             	lea    0x0(%esi),%esi
+      b0:	83 c0 01             	add    $0x1,%eax
+      b3:	83 c2 38             	add    $0x38,%edx
+      b6:	39 c8                	cmp    %ecx,%eax
+      b8:	74 19                	je     d3 <main+0xd3>
+    if (prev[i].pid == pid)
+      ba:	3b 3a                	cmp    (%edx),%edi
+      bc:	75 f2                	jne    b0 <main+0xb0>
+      run -= q->runticks;
+      be:	6b c0 38             	imul   $0x38,%eax,%eax
+      c1:	8b 88 e4 14 00 00    	mov    0x14e4(%eax),%ecx
+      wait -= q->waitticks;
+      c7:	8b 80 e8 14 00 00    	mov    0x14e8(%eax),%eax
+      run -= q->runticks;
+      cd:	29 4d e0             	sub    %ecx,-0x20(%ebp)
+      wait -= q->waitticks;
+      d0:	29 45 dc             	sub    %eax,-0x24(%ebp)
+  for (y = x, w--; y >= 10; y /= 10)
+      d3:	83 ff 09             	cmp    $0x9,%edi
+      d6:	0f 86 c4 04 00 00    	jbe    5a0 <main+0x5a0>
+      dc:	89 fa                	mov    %edi,%edx
+      de:	bb 04 00 00 00       	mov    $0x4,%ebx
+      e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      e7:	90                   	nop
+      e8:	89 d0                	mov    %edx,%eax
+      ea:	89 d1                	mov    %edx,%ecx
+    w--;
+      ec:	83 eb 01             	sub    $0x1,%ebx
+  for (y = x, w--; y >= 10; y /= 10)
+      ef:	f7 e6                	mul    %esi
+      f1:	c1 ea 03             	shr    $0x3,%edx
+      f4:	83 f9 63             	cmp    $0x63,%ecx
+      f7:	77 ef                	ja     e8 <main+0xe8>
+  for (; w > 0; w--)
+      f9:	85 db                	test   %ebx,%ebx
+      fb:	7e 1a                	jle    117 <main+0x117>
+      fd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+     100:	83 ec 08             	sub    $0x8,%esp
+     103:	68 64 11 00 00       	push   $0x1164
+     108:	6a 01                	push   $0x1
+     10a:	e8 b1 08 00 00       	call   9c0 <printf>
+  for (; w > 0; w--)
+     10f:	83 c4 10             	add    $0x10,%esp
+     112:	83 eb 01             	sub    $0x1,%ebx
+     115:	75 e9                	jne    100 <main+0x100>
+  printf(1, "%d", x);
+     117:	83 ec 04             	sub    $0x4,%esp
+     11a:	57                   	push   %edi
+     11b:	68 3a 10 00 00       	push   $0x103a
+     120:	6a 01                	push   $0x1
+     122:	e8 99 08 00 00       	call   9c0 <printf>
+    padd(p->cpu, 4);
+     127:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for (y = x, w--; y >= 10; y /= 10)
+     12a:	83 c4 10             	add    $0x10,%esp
+    padd(p->cpu, 4);
+     12d:	8b 78 10             	mov    0x10(%eax),%edi
+  for (y = x, w--; y >= 10; y /= 10)
+     130:	83 ff 09             	cmp    $0x9,%edi
+     133:	0f 86 57 04 00 00    	jbe    590 <main+0x590>
+     139:	89 fa                	mov    %edi,%edx
+     13b:	bb 03 00 00 00       	mov    $0x3,%ebx
+     140:	89 d0                	mov    %edx,%eax
+     142:	89 d1                	mov    %edx,%ecx
+    w--;
+     144:	83 eb 01             	sub    $0x1,%ebx
+  for (y = x, w--; y >= 10; y /= 10)
+     147:	f7 e6                	mul    %esi
+     149:	c1 ea 03             	shr    $0x3,%edx
+     14c:	83 f9 63             	cmp    $0x63,%ecx
+     14f:	77 ef                	ja     140 <main+0x140>
+  for (; w > 0; w--)
+     151:	85 db                	test   %ebx,%ebx
+     153:	7e 1a                	jle    16f <main+0x16f>
+     155:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+     158:	83 ec 08             	sub    $0x8,%esp
+     15b:	68 64 11 00 00       	push   $0x1164
+     160:	6a 01                	push   $0x1
+     162:	e8 59 08 00 00       	call   9c0 <printf>
+  for (; w > 0; w--)
+     167:	83 c4 10             	add    $0x10,%esp
+     16a:	83 eb 01             	sub    $0x1,%ebx
+     16d:	75 e9                	jne    158 <main+0x158>
+  printf(1, "%d", x);
+     16f:	83 ec 04             	sub    $0x4,%esp
+  for (y = x, w--; y >= 10; y /= 10)
+     172:	bb 02 00 00 00       	mov    $0x2,%ebx
+  printf(1, "%d", x);
+     177:	57                   	push   %edi
+     178:	68 3a 10 00 00       	push   $0x103a
+     17d:	6a 01                	push   $0x1
+     17f:	e8 3c 08 00 00       	call   9c0 <printf>
+    padd(p->nice, 3);
+     184:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for (y = x, w--; y >= 10; y /= 10)
+     187:	83 c4 10             	add    $0x10,%esp
+    padd(p->nice, 3);
+     18a:	8b 78 14             	mov    0x14(%eax),%edi
+  for (y = x, w--; y >= 10; y /= 10)
+     18d:	89 fa                	mov    %edi,%edx
+     18f:	83 ff 09             	cmp    $0x9,%edi
+     192:	0f 86 80 03 00 00    	jbe    518 <main+0x518>
+     198:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     19f:	90                   	nop
+     1a0:	89 d0                	mov    %edx,%eax
+     1a2:	89 d1                	mov    %edx,%ecx
+    w--;
+     1a4:	83 eb 01             	sub    $0x1,%ebx
+  for (y = x, w--; y >= 10; y /= 10)
+     1a7:	f7 e6                	mul    %esi
+     1a9:	c1 ea 03             	shr    $0x3,%edx
+     1ac:	83 f9 63             	cmp    $0x63,%ecx
+     1af:	77 ef                	ja     1a0 <main+0x1a0>
+  for (; w > 0; w--)
+     1b1:	83 fb 01             	cmp    $0x1,%ebx
+     1b4:	75 12                	jne    1c8 <main+0x1c8>
+    printf(1, " ");
+     1b6:	83 ec 08             	sub    $0x8,%esp
+     1b9:	68 64 11 00 00       	push   $0x1164
+     1be:	6a 01                	push   $0x1
+     1c0:	e8 fb 07 00 00       	call   9c0 <printf>
+     1c5:	83 c4 10             	add    $0x10,%esp
+  printf(1, "%d", x);
+     1c8:	83 ec 04             	sub    $0x4,%esp
+  for (y = x, w--; y >= 10; y /= 10)
+     1cb:	bb 02 00 00 00       	mov    $0x2,%ebx
+  printf(1, "%d", x);
+     1d0:	57                   	push   %edi
+     1d1:	68 3a 10 00 00       	push   $0x103a
+     1d6:	6a 01                	push   $0x1
+     1d8:	e8 e3 07 00 00       	call   9c0 <printf>
+    padd(p->prio, 3);
+     1dd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for (y = x, w--; y >= 10; y /= 10)
+     1e0:	83 c4 10             	add    $0x10,%esp
+    padd(p->prio, 3);
+     1e3:	8b 78 18             	mov    0x18(%eax),%edi
+  for (y = x, w--; y >= 10; y /= 10)
+     1e6:	89 fa                	mov    %edi,%edx
+     1e8:	83 ff 09             	cmp    $0x9,%edi
+     1eb:	0f 86 ff 02 00 00    	jbe    4f0 <main+0x4f0>
+     1f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1f8:	89 d0                	mov    %edx,%eax
+     1fa:	89 d1                	mov    %edx,%ecx
+    w--;
+     1fc:	83 eb 01             	sub    $0x1,%ebx
+  for (y = x, w--; y >= 10; y /= 10)
+     1ff:	f7 e6                	mul    %esi
+     201:	c1 ea 03             	shr    $0x3,%edx
+     204:	83 f9 63             	cmp    $0x63,%ecx
+     207:	77 ef                	ja     1f8 <main+0x1f8>
+  for (; w > 0; w--)
+     209:	83 fb 01             	cmp    $0x1,%ebx
+     20c:	75 12                	jne    220 <main+0x220>
+    printf(1, " ");
+     20e:	83 ec 08             	sub    $0x8,%esp
+     211:	68 64 11 00 00       	push   $0x1164
+     216:	6a 01                	push   $0x1
+     218:	e8 a3 07 00 00       	call   9c0 <printf>
+     21d:	83 c4 10             	add    $0x10,%esp
+  printf(1, "%d", x);
+     220:	83 ec 04             	sub    $0x4,%esp
+     223:	57                   	push   %edi
+     224:	68 3a 10 00 00       	push   $0x103a
+     229:	6a 01                	push   $0x1
+     22b:	e8 90 07 00 00       	call   9c0 <printf>
+    printf(1, " ");
+     230:	5b                   	pop    %ebx
+     231:	5f                   	pop    %edi
+     232:	68 64 11 00 00       	push   $0x1164
+     237:	6a 01                	push   $0x1
+    pads(p->state >= 0 && p->state < sizeof(states)/sizeof(states[0]) ? states[p->state] : "???", 6);
+     239:	bb 20 10 00 00       	mov    $0x1020,%ebx
+    printf(1, " ");
+     23e:	e8 7d 07 00 00       	call   9c0 <printf>
+    pads(p->state >= 0 && p->state < sizeof(states)/sizeof(states[0]) ? states[p->state] : "???", 6);
+     243:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     246:	83 c4 10             	add    $0x10,%esp
+     249:	8b 40 fc             	mov    -0x4(%eax),%eax
+     24c:	83 f8 05             	cmp    $0x5,%eax
+     24f:	77 07                	ja     258 <main+0x258>
+     251:	8b 1c 85 ac 10 00 00 	mov    0x10ac(,%eax,4),%ebx
+  printf(1, "%s", s);
+     258:	83 ec 04             	sub    $0x4,%esp
+     25b:	53                   	push   %ebx
+     25c:	68 3d 10 00 00       	push   $0x103d
+     261:	6a 01                	push   $0x1
+     263:	e8 58 07 00 00       	call   9c0 <printf>
+  for (w -= strlen(s); w > 0; w--)
+     268:	89 1c 24             	mov    %ebx,(%esp)
+     26b:	bb 06 00 00 00       	mov    $0x6,%ebx
+     270:	e8 1b 04 00 00       	call   690 <strlen>
+     275:	83 c4 10             	add    $0x10,%esp
+     278:	29 c3                	sub    %eax,%ebx
+     27a:	85 db                	test   %ebx,%ebx
+     27c:	7e 19                	jle    297 <main+0x297>
+     27e:	66 90                	xchg   %ax,%ax
+    printf(1, " ");
+     280:	83 ec 08             	sub    $0x8,%esp
+     283:	68 64 11 00 00       	push   $0x1164
+     288:	6a 01                	push   $0x1
+     28a:	e8 31 07 00 00       	call   9c0 <printf>
+  for (w -= strlen(s); w > 0; w--)
+     28f:	83 c4 10             	add    $0x10,%esp
+     292:	83 eb 01             	sub    $0x1,%ebx
+     295:	75 e9                	jne    280 <main+0x280>
+  for (y = x, w--; y >= 10; y /= 10)
+     297:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     29a:	83 f8 09             	cmp    $0x9,%eax
+     29d:	0f 86 cd 02 00 00    	jbe    570 <main+0x570>
+     2a3:	89 c2                	mov    %eax,%edx
+     2a5:	bb 07 00 00 00       	mov    $0x7,%ebx
+     2aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     2b0:	89 d0                	mov    %edx,%eax
+     2b2:	89 d1                	mov    %edx,%ecx
+    w--;
+     2b4:	83 eb 01             	sub    $0x1,%ebx
+  for (y = x, w--; y >= 10; y /= 10)
+     2b7:	f7 e6                	mul    %esi
+     2b9:	c1 ea 03             	shr    $0x3,%edx
+     2bc:	83 f9 63             	cmp    $0x63,%ecx
+     2bf:	77 ef                	ja     2b0 <main+0x2b0>
+  for (; w > 0; w--)
+     2c1:	85 db                	test   %ebx,%ebx
+     2c3:	7e 1a                	jle    2df <main+0x2df>
+     2c5:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+     2c8:	83 ec 08             	sub    $0x8,%esp
+     2cb:	68 64 11 00 00       	push   $0x1164
+     2d0:	6a 01                	push   $0x1
+     2d2:	e8 e9 06 00 00       	call   9c0 <printf>
+  for (; w > 0; w--)
+     2d7:	83 c4 10             	add    $0x10,%esp
+     2da:	83 eb 01             	sub    $0x1,%ebx
+     2dd:	75 e9                	jne    2c8 <main+0x2c8>
+  printf(1, "%d", x);
+     2df:	83 ec 04             	sub    $0x4,%esp
+     2e2:	ff 75 e0             	push   -0x20(%ebp)
+     2e5:	68 3a 10 00 00       	push   $0x103a
+     2ea:	6a 01                	push   $0x1
+     2ec:	e8 cf 06 00 00       	call   9c0 <printf>
+  for (y = x, w--; y >= 10; y /= 10)
+     2f1:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     2f4:	83 c4 10             	add    $0x10,%esp
+     2f7:	83 f8 09             	cmp    $0x9,%eax
+     2fa:	0f 86 60 02 00 00    	jbe    560 <main+0x560>
+     300:	89 c2                	mov    %eax,%edx
+     302:	bb 07 00 00 00       	mov    $0x7,%ebx
+     307:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     30e:	66 90                	xchg   %ax,%ax
+     310:	89 d0                	mov    %edx,%eax
+     312:	89 d1                	mov    %edx,%ecx
+    w--;
+     314:	83 eb 01             	sub    $0x1,%ebx
+  for (y = x, w--; y >= 10; y /= 10)
+     317:	f7 e6                	mul    %esi
+     319:	c1 ea 03             	shr    $0x3,%edx
+     31c:	83 f9 63             	cmp    $0x63,%ecx
+     31f:	77 ef                	ja     310 <main+0x310>
+  for (; w > 0; w--)
+     321:	85 db                	test   %ebx,%ebx
+     323:	7e 1a                	jle    33f <main+0x33f>
+     325:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+     328:	83 ec 08             	sub    $0x8,%esp
+     32b:	68 64 11 00 00       	push   $0x1164
+     330:	6a 01                	push   $0x1
+     332:	e8 89 06 00 00       	call   9c0 <printf>
+  for (; w > 0; w--)
+     337:	83 c4 10             	add    $0x10,%esp
+     33a:	83 eb 01             	sub    $0x1,%ebx
+     33d:	75 e9                	jne    328 <main+0x328>
+  printf(1, "%d", x);
+     33f:	83 ec 04             	sub    $0x4,%esp
+     342:	ff 75 dc             	push   -0x24(%ebp)
+     345:	68 3a 10 00 00       	push   $0x103a
+     34a:	6a 01                	push   $0x1
+     34c:	e8 6f 06 00 00       	call   9c0 <printf>
+    padd(p->maxwait, 6);
+     351:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for (y = x, w--; y >= 10; y /= 10)
+     354:	83 c4 10             	add    $0x10,%esp
+    padd(p->maxwait, 6);
+     357:	8b 78 24             	mov    0x24(%eax),%edi
+  for (y = x, w--; y >= 10; y /= 10)
+     35a:	83 ff 09             	cmp    $0x9,%edi
+     35d:	0f 86 ed 01 00 00    	jbe    550 <main+0x550>
+     363:	89 fa                	mov    %edi,%edx
+     365:	bb 05 00 00 00       	mov    $0x5,%ebx
+     36a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     370:	89 d0                	mov    %edx,%eax
+     372:	89 d1                	mov    %edx,%ecx
+    w--;
+     374:	83 eb 01             	sub    $0x1,%ebx
+  for (y = x, w--; y >= 10; y /= 10)
+     377:	f7 e6                	mul    %esi
+     379:	c1 ea 03             	shr    $0x3,%edx
+     37c:	83 f9 63             	cmp    $0x63,%ecx
+     37f:	77 ef                	ja     370 <main+0x370>
+  for (; w > 0; w--)
+     381:	85 db                	test   %ebx,%ebx
+     383:	7e 1a                	jle    39f <main+0x39f>
+     385:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+     388:	83 ec 08             	sub    $0x8,%esp
+     38b:	68 64 11 00 00       	push   $0x1164
+     390:	6a 01                	push   $0x1
+     392:	e8 29 06 00 00       	call   9c0 <printf>
+  for (; w > 0; w--)
+     397:	83 c4 10             	add    $0x10,%esp
+     39a:	83 eb 01             	sub    $0x1,%ebx
+     39d:	75 e9                	jne    388 <main+0x388>
+  printf(1, "%d", x);
+     39f:	83 ec 04             	sub    $0x4,%esp
+     3a2:	57                   	push   %edi
+     3a3:	68 3a 10 00 00       	push   $0x103a
+     3a8:	6a 01                	push   $0x1
+     3aa:	e8 11 06 00 00       	call   9c0 <printf>
+    padd(p->nswitch, 8);
+     3af:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for (y = x, w--; y >= 10; y /= 10)
+     3b2:	83 c4 10             	add    $0x10,%esp
+    padd(p->nswitch, 8);
+     3b5:	8b 78 28             	mov    0x28(%eax),%edi
+  for (y = x, w--; y >= 10; y /= 10)
+     3b8:	83 ff 09             	cmp    $0x9,%edi
+     3bb:	0f 86 7f 01 00 00    	jbe    540 <main+0x540>
+     3c1:	89 fa                	mov    %edi,%edx
+     3c3:	bb 07 00 00 00       	mov    $0x7,%ebx
+     3c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3cf:	90                   	nop
+     3d0:	89 d0                	mov    %edx,%eax
+     3d2:	89 d1                	mov    %edx,%ecx
+    w--;
+     3d4:	83 eb 01             	sub    $0x1,%ebx
+  for (y = x, w--; y >= 10; y /= 10)
+     3d7:	f7 e6                	mul    %esi
+     3d9:	c1 ea 03             	shr    $0x3,%edx
+     3dc:	83 f9 63             	cmp    $0x63,%ecx
+     3df:	77 ef                	ja     3d0 <main+0x3d0>
+  for (; w > 0; w--)
+     3e1:	85 db                	test   %ebx,%ebx
+     3e3:	7e 1a                	jle    3ff <main+0x3ff>
+     3e5:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+     3e8:	83 ec 08             	sub    $0x8,%esp
+     3eb:	68 64 11 00 00       	push   $0x1164
+     3f0:	6a 01                	push   $0x1
+     3f2:	e8 c9 05 00 00       	call   9c0 <printf>
+  for (; w > 0; w--)
+     3f7:	83 c4 10             	add    $0x10,%esp
+     3fa:	83 eb 01             	sub    $0x1,%ebx
+     3fd:	75 e9                	jne    3e8 <main+0x3e8>
+  printf(1, "%d", x);
+     3ff:	83 ec 04             	sub    $0x4,%esp
+     402:	57                   	push   %edi
+     403:	68 3a 10 00 00       	push   $0x103a
+     408:	6a 01                	push   $0x1
+     40a:	e8 b1 05 00 00       	call   9c0 <printf>
+    padd(p->nboost, 6);
+     40f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  for (y = x, w--; y >= 10; y /= 10)
+     412:	83 c4 10             	add    $0x10,%esp
+    padd(p->nboost, 6);
+     415:	8b 78 2c             	mov    0x2c(%eax),%edi
+  for (y = x, w--; y >= 10; y /= 10)
+     418:	83 ff 09             	cmp    $0x9,%edi
+     41b:	0f 86 5f 01 00 00    	jbe    580 <main+0x580>
+     421:	89 fa                	mov    %edi,%edx
+     423:	bb 05 00 00 00       	mov    $0x5,%ebx
+     428:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     42f:	90                   	nop
+     430:	89 d0                	mov    %edx,%eax
+     432:	89 d1                	mov    %edx,%ecx
+    w--;
+     434:	83 eb 01             	sub    $0x1,%ebx
+  for (y = x, w--; y >= 10; y /= 10)
+     437:	f7 e6                	mul    %esi
+     439:	c1 ea 03             	shr    $0x3,%edx
+     43c:	83 f9 63             	cmp    $0x63,%ecx
+     43f:	77 ef                	ja     430 <main+0x430>
+  for (; w > 0; w--)
+     441:	85 db                	test   %ebx,%ebx
+     443:	7e 1a                	jle    45f <main+0x45f>
+     445:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+     448:	83 ec 08             	sub    $0x8,%esp
+     44b:	68 64 11 00 00       	push   $0x1164
+     450:	6a 01                	push   $0x1
+     452:	e8 69 05 00 00       	call   9c0 <printf>
+  for (; w > 0; w--)
+     457:	83 c4 10             	add    $0x10,%esp
+     45a:	83 eb 01             	sub    $0x1,%ebx
+     45d:	75 e9                	jne    448 <main+0x448>
+  printf(1, "%d", x);
+     45f:	83 ec 04             	sub    $0x4,%esp
+     462:	57                   	push   %edi
+     463:	68 3a 10 00 00       	push   $0x103a
+     468:	6a 01                	push   $0x1
+     46a:	e8 51 05 00 00       	call   9c0 <printf>
+    printf(1, " %s\n", p->name);
+     46f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+     472:	83 c4 0c             	add    $0xc,%esp
+     475:	57                   	push   %edi
+  for (i = 0; i < n; i++) {
+     476:	83 c7 38             	add    $0x38,%edi
+    printf(1, " %s\n", p->name);
+     479:	68 40 10 00 00       	push   $0x1040
+     47e:	6a 01                	push   $0x1
+     480:	e8 3b 05 00 00       	call   9c0 <printf>
+  for (i = 0; i < n; i++) {
+     485:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+     489:	83 c4 10             	add    $0x10,%esp
+     48c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     48f:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+     492:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+     495:	0f 85 ed fb ff ff    	jne    88 <main+0x88>
+     49b:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+      printf(2, "top: getpstat failed\n");
+      exit();
+    }
+    show(n);
+    if (--count <= 0)
+     49e:	83 eb 01             	sub    $0x1,%ebx
+     4a1:	85 db                	test   %ebx,%ebx
+     4a3:	0f 8e 14 01 00 00    	jle    5bd <main+0x5bd>
+      break;
+    memmove(prev, ps, n * sizeof(ps[0]));
+     4a9:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+     4ac:	83 ec 04             	sub    $0x4,%esp
+     4af:	6b c7 38             	imul   $0x38,%edi,%eax
+     4b2:	50                   	push   %eax
+     4b3:	68 c0 22 00 00       	push   $0x22c0
+     4b8:	68 c0 14 00 00       	push   $0x14c0
+     4bd:	e8 4e 03 00 00       	call   810 <memmove>
+    nprev = n;
+    sleep(interval);
+     4c2:	58                   	pop    %eax
+     4c3:	ff 75 cc             	push   -0x34(%ebp)
+    nprev = n;
+     4c6:	89 3d a0 14 00 00    	mov    %edi,0x14a0
+    sleep(interval);
+     4cc:	e8 02 04 00 00       	call   8d3 <sleep>
+    printf(1, "\n");
+     4d1:	5a                   	pop    %edx
+     4d2:	59                   	pop    %ecx
+     4d3:	68 78 11 00 00       	push   $0x1178
+     4d8:	6a 01                	push   $0x1
+     4da:	e8 e1 04 00 00       	call   9c0 <printf>
+    if ((n = getpstat(ps, NPROC)) < 0) {
+     4df:	83 c4 10             	add    $0x10,%esp
+     4e2:	e9 51 fb ff ff       	jmp    38 <main+0x38>
+     4e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     4ee:	66 90                	xchg   %ax,%ax
+    printf(1, " ");
+     4f0:	83 ec 08             	sub    $0x8,%esp
+     4f3:	68 64 11 00 00       	push   $0x1164
+     4f8:	6a 01                	push   $0x1
+     4fa:	e8 c1 04 00 00       	call   9c0 <printf>
+     4ff:	58                   	pop    %eax
+     500:	5a                   	pop    %edx
+     501:	68 64 11 00 00       	push   $0x1164
+     506:	6a 01                	push   $0x1
+     508:	e8 b3 04 00 00       	call   9c0 <printf>
+  for (; w > 0; w--)
+     50d:	83 c4 10             	add    $0x10,%esp
+     510:	e9 0b fd ff ff       	jmp    220 <main+0x220>
+     515:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, " ");
+     518:	83 ec 08             	sub    $0x8,%esp
+     51b:	68 64 11 00 00       	push   $0x1164
+     520:	6a 01                	push   $0x1
+     522:	e8 99 04 00 00       	call   9c0 <printf>
+     527:	59                   	pop    %ecx
+     528:	5b                   	pop    %ebx
+     529:	68 64 11 00 00       	push   $0x1164
+     52e:	6a 01                	push   $0x1
+     530:	e8 8b 04 00 00       	call   9c0 <printf>
+  for (; w > 0; w--)
+     535:	83 c4 10             	add    $0x10,%esp
+     538:	e9 8b fc ff ff       	jmp    1c8 <main+0x1c8>
+     53d:	8d 76 00             	lea    0x0(%esi),%esi
+  for (y = x, w--; y >= 10; y /= 10)
+     540:	bb 07 00 00 00       	mov    $0x7,%ebx
+     545:	e9 9e fe ff ff       	jmp    3e8 <main+0x3e8>
+     54a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     550:	bb 05 00 00 00       	mov    $0x5,%ebx
+     555:	e9 2e fe ff ff       	jmp    388 <main+0x388>
+     55a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     560:	bb 07 00 00 00       	mov    $0x7,%ebx
+     565:	e9 be fd ff ff       	jmp    328 <main+0x328>
+     56a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     570:	bb 07 00 00 00       	mov    $0x7,%ebx
+     575:	e9 4e fd ff ff       	jmp    2c8 <main+0x2c8>
+     57a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     580:	bb 05 00 00 00       	mov    $0x5,%ebx
+     585:	e9 be fe ff ff       	jmp    448 <main+0x448>
+     58a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     590:	bb 03 00 00 00       	mov    $0x3,%ebx
+     595:	e9 be fb ff ff       	jmp    158 <main+0x158>
+     59a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+     5a0:	bb 04 00 00 00       	mov    $0x4,%ebx
+     5a5:	e9 56 fb ff ff       	jmp    100 <main+0x100>
+      printf(2, "top: getpstat failed\n");
+     5aa:	50                   	push   %eax
+     5ab:	50                   	push   %eax
+     5ac:	68 24 10 00 00       	push   $0x1024
+     5b1:	6a 02                	push   $0x2
+     5b3:	e8 08 04 00 00       	call   9c0 <printf>
+      exit();
+     5b8:	e8 86 02 00 00       	call   843 <exit>
+  }
+  exit();
+     5bd:	e8 81 02 00 00       	call   843 <exit>
+  if (argc > 1) count = atoi(argv[1]);
+     5c2:	83 ec 0c             	sub    $0xc,%esp
+     5c5:	ff 76 04             	push   0x4(%esi)
+     5c8:	e8 03 02 00 00       	call   7d0 <atoi>
+  if (argc > 2) interval = atoi(argv[2]);
+     5cd:	83 c4 10             	add    $0x10,%esp
+  if (argc > 1) count = atoi(argv[1]);
+     5d0:	89 c3                	mov    %eax,%ebx
+  if (argc > 2) interval = atoi(argv[2]);
+     5d2:	83 ff 02             	cmp    $0x2,%edi
+     5d5:	0f 84 53 fa ff ff    	je     2e <main+0x2e>
+     5db:	83 ec 0c             	sub    $0xc,%esp
+     5de:	ff 76 08             	push   0x8(%esi)
+     5e1:	e8 ea 01 00 00       	call   7d0 <atoi>
+     5e6:	83 c4 10             	add    $0x10,%esp
+     5e9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+     5ec:	e9 3d fa ff ff       	jmp    2e <main+0x2e>
+     5f1:	66 90                	xchg   %ax,%ax
+     5f3:	66 90                	xchg   %ax,%ax
+     5f5:	66 90                	xchg   %ax,%ax
+     5f7:	66 90                	xchg   %ax,%ax
+     5f9:	66 90                	xchg   %ax,%ax
+     5fb:	66 90                	xchg   %ax,%ax
+     5fd:	66 90                	xchg   %ax,%ax
+     5ff:	90                   	nop
+
+00000600 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     600:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     601:	31 c0                	xor    %eax,%eax
+{
+     603:	89 e5                	mov    %esp,%ebp
+     605:	53                   	push   %ebx
+     606:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     609:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     60c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     610:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     614:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     617:	83 c0 01             	add    $0x1,%eax
+     61a:	84 d2                	test   %dl,%dl
+     61c:	75 f2                	jne    610 <strcpy+0x10>
+    ;
+  return os;
+}
+     61e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     621:	89 c8                	mov    %ecx,%eax
+     623:	c9                   	leave
+     624:	c3                   	ret
+     625:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     62c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000630 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     630:	55                   	push   %ebp
+     631:	89 e5                	mov    %esp,%ebp
+     633:	53                   	push   %ebx
+     634:	8b 55 08             	mov    0x8(%ebp),%edx
+     637:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     63a:	0f b6 02             	movzbl (%edx),%eax
+     63d:	84 c0                	test   %al,%al
+     63f:	75 17                	jne    658 <strcmp+0x28>
+     641:	eb 3a                	jmp    67d <strcmp+0x4d>
+     643:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     647:	90                   	nop
+     648:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     64c:	83 c2 01             	add    $0x1,%edx
+     64f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     652:	84 c0                	test   %al,%al
+     654:	74 1a                	je     670 <strcmp+0x40>
+    p++, q++;
+     656:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     658:	0f b6 19             	movzbl (%ecx),%ebx
+     65b:	38 c3                	cmp    %al,%bl
+     65d:	74 e9                	je     648 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     65f:	29 d8                	sub    %ebx,%eax
+}
+     661:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     664:	c9                   	leave
+     665:	c3                   	ret
+     666:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     66d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     670:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     674:	31 c0                	xor    %eax,%eax
+     676:	29 d8                	sub    %ebx,%eax
+}
+     678:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     67b:	c9                   	leave
+     67c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     67d:	0f b6 19             	movzbl (%ecx),%ebx
+     680:	31 c0                	xor    %eax,%eax
+     682:	eb db                	jmp    65f <strcmp+0x2f>
+     684:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     68b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     68f:	90                   	nop
+
+00000690 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     690:	55                   	push   %ebp
+     691:	89 e5                	mov    %esp,%ebp
+     693:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     696:	80 3a 00             	cmpb   $0x0,(%edx)
+     699:	74 15                	je     6b0 <strlen+0x20>
+     69b:	31 c0                	xor    %eax,%eax
+     69d:	8d 76 00             	lea    0x0(%esi),%esi
+     6a0:	83 c0 01             	add    $0x1,%eax
+     6a3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     6a7:	89 c1                	mov    %eax,%ecx
+     6a9:	75 f5                	jne    6a0 <strlen+0x10>
+    ;
+  return n;
+}
+     6ab:	89 c8                	mov    %ecx,%eax
+     6ad:	5d                   	pop    %ebp
+     6ae:	c3                   	ret
+     6af:	90                   	nop
+  for(n = 0; s[n]; n++)
+     6b0:	31 c9                	xor    %ecx,%ecx
+}
+     6b2:	5d                   	pop    %ebp
+     6b3:	89 c8                	mov    %ecx,%eax
+     6b5:	c3                   	ret
+     6b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000006c0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     6c0:	55                   	push   %ebp
+     6c1:	89 e5                	mov    %esp,%ebp
+     6c3:	57                   	push   %edi
+     6c4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     6c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     6ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+     6cd:	89 d7                	mov    %edx,%edi
+     6cf:	fc                   	cld
+     6d0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     6d2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     6d5:	89 d0                	mov    %edx,%eax
+     6d7:	c9                   	leave
+     6d8:	c3                   	ret
+     6d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000006e0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     6e0:	55                   	push   %ebp
+     6e1:	89 e5                	mov    %esp,%ebp
+     6e3:	8b 45 08             	mov    0x8(%ebp),%eax
+     6e6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     6ea:	0f b6 10             	movzbl (%eax),%edx
+     6ed:	84 d2                	test   %dl,%dl
+     6ef:	75 12                	jne    703 <strchr+0x23>
+     6f1:	eb 1d                	jmp    710 <strchr+0x30>
+     6f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     6f7:	90                   	nop
+     6f8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     6fc:	83 c0 01             	add    $0x1,%eax
+     6ff:	84 d2                	test   %dl,%dl
+     701:	74 0d                	je     710 <strchr+0x30>
+    if(*s == c)
+     703:	38 d1                	cmp    %dl,%cl
+     705:	75 f1                	jne    6f8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     707:	5d                   	pop    %ebp
+     708:	c3                   	ret
+     709:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     710:	31 c0                	xor    %eax,%eax
+}
+     712:	5d                   	pop    %ebp
+     713:	c3                   	ret
+     714:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     71b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     71f:	90                   	nop
+
+00000720 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     720:	55                   	push   %ebp
+     721:	89 e5                	mov    %esp,%ebp
+     723:	57                   	push   %edi
+     724:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     725:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     728:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     729:	31 db                	xor    %ebx,%ebx
+{
+     72b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     72e:	eb 27                	jmp    757 <gets+0x37>
+    cc = read(0, &c, 1);
+     730:	83 ec 04             	sub    $0x4,%esp
+     733:	6a 01                	push   $0x1
+     735:	56                   	push   %esi
+     736:	6a 00                	push   $0x0
+     738:	e8 1e 01 00 00       	call   85b <read>
+    if(cc < 1)
+     73d:	83 c4 10             	add    $0x10,%esp
+     740:	85 c0                	test   %eax,%eax
+     742:	7e 1d                	jle    761 <gets+0x41>
+      break;
+    buf[i++] = c;
+     744:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     748:	8b 55 08             	mov    0x8(%ebp),%edx
+     74b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     74f:	3c 0a                	cmp    $0xa,%al
+     751:	74 10                	je     763 <gets+0x43>
+     753:	3c 0d                	cmp    $0xd,%al
+     755:	74 0c                	je     763 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     757:	89 df                	mov    %ebx,%edi
+     759:	83 c3 01             	add    $0x1,%ebx
+     75c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     75f:	7c cf                	jl     730 <gets+0x10>
+     761:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     763:	8b 45 08             	mov    0x8(%ebp),%eax
+     766:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     76a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     76d:	5b                   	pop    %ebx
+     76e:	5e                   	pop    %esi
+     76f:	5f                   	pop    %edi
+     770:	5d                   	pop    %ebp
+     771:	c3                   	ret
+     772:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     779:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000780 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     780:	55                   	push   %ebp
+     781:	89 e5                	mov    %esp,%ebp
+     783:	56                   	push   %esi
+     784:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     785:	83 ec 08             	sub    $0x8,%esp
+     788:	6a 00                	push   $0x0
+     78a:	ff 75 08             	push   0x8(%ebp)
+     78d:	e8 f1 00 00 00       	call   883 <open>
+  if(fd < 0)
+     792:	83 c4 10             	add    $0x10,%esp
+     795:	85 c0                	test   %eax,%eax
+     797:	78 27                	js     7c0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     799:	83 ec 08             	sub    $0x8,%esp
+     79c:	ff 75 0c             	push   0xc(%ebp)
+     79f:	89 c3                	mov    %eax,%ebx
+     7a1:	50                   	push   %eax
+     7a2:	e8 f4 00 00 00       	call   89b <fstat>
+  close(fd);
+     7a7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     7aa:	89 c6                	mov    %eax,%esi
+  close(fd);
+     7ac:	e8 ba 00 00 00       	call   86b <close>
+  return r;
+     7b1:	83 c4 10             	add    $0x10,%esp
+}
+     7b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7b7:	89 f0                	mov    %esi,%eax
+     7b9:	5b                   	pop    %ebx
+     7ba:	5e                   	pop    %esi
+     7bb:	5d                   	pop    %ebp
+     7bc:	c3                   	ret
+     7bd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     7c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     7c5:	eb ed                	jmp    7b4 <stat+0x34>
+     7c7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ce:	66 90                	xchg   %ax,%ax
+
+000007d0 <atoi>:
+
+int
+atoi(const char *s)
+{
+     7d0:	55                   	push   %ebp
+     7d1:	89 e5                	mov    %esp,%ebp
+     7d3:	53                   	push   %ebx
+     7d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     7d7:	0f be 02             	movsbl (%edx),%eax
+     7da:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     7dd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     7e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     7e5:	77 1e                	ja     805 <atoi+0x35>
+     7e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     7ee:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     7f0:	83 c2 01             	add    $0x1,%edx
+     7f3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     7f6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     7fa:	0f be 02             	movsbl (%edx),%eax
+     7fd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     800:	80 fb 09             	cmp    $0x9,%bl
+     803:	76 eb                	jbe    7f0 <atoi+0x20>
+  return n;
+}
+     805:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     808:	89 c8                	mov    %ecx,%eax
+     80a:	c9                   	leave
+     80b:	c3                   	ret
+     80c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000810 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     810:	55                   	push   %ebp
+     811:	89 e5                	mov    %esp,%ebp
+     813:	57                   	push   %edi
+     814:	56                   	push   %esi
+     815:	8b 45 10             	mov    0x10(%ebp),%eax
+     818:	8b 55 08             	mov    0x8(%ebp),%edx
+     81b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     81e:	85 c0                	test   %eax,%eax
+     820:	7e 13                	jle    835 <memmove+0x25>
+     822:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     824:	89 d7                	mov    %edx,%edi
+     826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     82d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     830:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     831:	39 f8                	cmp    %edi,%eax
+     833:	75 fb                	jne    830 <memmove+0x20>
+  return vdst;
+}
+     835:	5e                   	pop    %esi
+     836:	89 d0                	mov    %edx,%eax
+     838:	5f                   	pop    %edi
+     839:	5d                   	pop    %ebp
+     83a:	c3                   	ret
+
+0000083b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+     83b:	b8 01 00 00 00       	mov    $0x1,%eax
+     840:	cd 40                	int    $0x40
+     842:	c3                   	ret
+
+00000843 <exit>:
+SYSCALL(exit)
+     843:	b8 02 00 00 00       	mov    $0x2,%eax
+     848:	cd 40                	int    $0x40
+     84a:	c3                   	ret
+
+0000084b <wait>:
+SYSCALL(wait)
+     84b:	b8 03 00 00 00       	mov    $0x3,%eax
+     850:	cd 40                	int    $0x40
+     852:	c3                   	ret
+
+00000853 <pipe>:
+SYSCALL(pipe)
+     853:	b8 04 00 00 00       	mov    $0x4,%eax
+     858:	cd 40                	int    $0x40
+     85a:	c3                   	ret
+
+0000085b <read>:
+SYSCALL(read)
+     85b:	b8 05 00 00 00       	mov    $0x5,%eax
+     860:	cd 40                	int    $0x40
+     862:	c3                   	ret
+
+00000863 <write>:
+SYSCALL(write)
+     863:	b8 10 00 00 00       	mov    $0x10,%eax
+     868:	cd 40                	int    $0x40
+     86a:	c3                   	ret
+
+0000086b <close>:
+SYSCALL(close)
+     86b:	b8 15 00 00 00       	mov    $0x15,%eax
+     870:	cd 40                	int    $0x40
+     872:	c3                   	ret
+
+00000873 <kill>:
+SYSCALL(kill)
+     873:	b8 06 00 00 00       	mov    $0x6,%eax
+     878:	cd 40                	int    $0x40
+     87a:	c3                   	ret
+
+0000087b <exec>:
+SYSCALL(exec)
+     87b:	b8 07 00 00 00       	mov    $0x7,%eax
+     880:	cd 40                	int    $0x40
+     882:	c3                   	ret
+
+00000883 <open>:
+SYSCALL(open)
+     883:	b8 0f 00 00 00       	mov    $0xf,%eax
+     888:	cd 40                	int    $0x40
+     88a:	c3                   	ret
+
+0000088b <mknod>:
+SYSCALL(mknod)
+     88b:	b8 11 00 00 00       	mov    $0x11,%eax
+     890:	cd 40                	int    $0x40
+     892:	c3                   	ret
+
+00000893 <unlink>:
+SYSCALL(unlink)
+     893:	b8 12 00 00 00       	mov    $0x12,%eax
+     898:	cd 40                	int    $0x40
+     89a:	c3                   	ret
+
+0000089b <fstat>:
+SYSCALL(fstat)
+     89b:	b8 08 00 00 00       	mov    $0x8,%eax
+     8a0:	cd 40                	int    $0x40
+     8a2:	c3                   	ret
+
+000008a3 <link>:
+SYSCALL(link)
+     8a3:	b8 13 00 00 00       	mov    $0x13,%eax
+     8a8:	cd 40                	int    $0x40
+     8aa:	c3                   	ret
+
+000008ab <mkdir>:
+SYSCALL(mkdir)
+     8ab:	b8 14 00 00 00       	mov    $0x14,%eax
+     8b0:	cd 40                	int    $0x40
+     8b2:	c3                   	ret
+
+000008b3 <chdir>:
+SYSCALL(chdir)
+     8b3:	b8 09 00 00 00       	mov    $0x9,%eax
+     8b8:	cd 40                	int    $0x40
+     8ba:	c3                   	ret
+
+000008bb <dup>:
+SYSCALL(dup)
+     8bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+     8c0:	cd 40                	int    $0x40
+     8c2:	c3                   	ret
+
+000008c3 <getpid>:
+SYSCALL(getpid)
+     8c3:	b8 0b 00 00 00       	mov    $0xb,%eax
+     8c8:	cd 40                	int    $0x40
+     8ca:	c3                   	ret
+
+000008cb <sbrk>:
+SYSCALL(sbrk)
+     8cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+     8d0:	cd 40                	int    $0x40
+     8d2:	c3                   	ret
+
+000008d3 <sleep>:
+SYSCALL(sleep)
+     8d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+     8d8:	cd 40                	int    $0x40
+     8da:	c3                   	ret
+
+000008db <uptime>:
+SYSCALL(uptime)
+     8db:	b8 0e 00 00 00       	mov    $0xe,%eax
+     8e0:	cd 40                	int    $0x40
+     8e2:	c3                   	ret
+
+000008e3 <nice>:
+SYSCALL(nice)
+     8e3:	b8 16 00 00 00       	mov    $0x16,%eax
+     8e8:	cd 40                	int    $0x40
+     8ea:	c3                   	ret
+
+000008eb <fsync>:
+SYSCALL(fsync)
+     8eb:	b8 17 00 00 00       	mov    $0x17,%eax
+     8f0:	cd 40                	int    $0x40
+     8f2:	c3                   	ret
+
+000008f3 <getpstat>:
+SYSCALL(getpstat)
+     8f3:	b8 18 00 00 00       	mov    $0x18,%eax
+     8f8:	cd 40                	int    $0x40
+     8fa:	c3                   	ret
+
+000008fb <pipesize>:
+SYSCALL(pipesize)
+     8fb:	b8 19 00 00 00       	mov    $0x19,%eax
+     900:	cd 40                	int    $0x40
+     902:	c3                   	ret
+
+00000903 <uptimens>:
+SYSCALL(uptimens)
+     903:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     908:	cd 40                	int    $0x40
+     90a:	c3                   	ret
+
+0000090b <settickets>:
+SYSCALL(settickets)
+     90b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     910:	cd 40                	int    $0x40
+     912:	c3                   	ret
+
+00000913 <transfer>:
+SYSCALL(transfer)
+     913:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     918:	cd 40                	int    $0x40
+     91a:	c3                   	ret
+     91b:	66 90                	xchg   %ax,%ax
+     91d:	66 90                	xchg   %ax,%ax
+     91f:	90                   	nop
+
+00000920 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     920:	55                   	push   %ebp
+     921:	89 e5                	mov    %esp,%ebp
+     923:	57                   	push   %edi
+     924:	56                   	push   %esi
+     925:	53                   	push   %ebx
+     926:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+     928:	89 d1                	mov    %edx,%ecx
+{
+     92a:	83 ec 3c             	sub    $0x3c,%esp
+     92d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+     930:	85 d2                	test   %edx,%edx
+     932:	0f 89 80 00 00 00    	jns    9b8 <printint+0x98>
+     938:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+     93c:	74 7a                	je     9b8 <printint+0x98>
+    x = -xx;
+     93e:	f7 d9                	neg    %ecx
+    neg = 1;
+     940:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+     945:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+     948:	31 f6                	xor    %esi,%esi
+     94a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+     950:	89 c8                	mov    %ecx,%eax
+     952:	31 d2                	xor    %edx,%edx
+     954:	89 f7                	mov    %esi,%edi
+     956:	f7 f3                	div    %ebx
+     958:	8d 76 01             	lea    0x1(%esi),%esi
+     95b:	0f b6 92 24 11 00 00 	movzbl 0x1124(%edx),%edx
+     962:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+     966:	89 ca                	mov    %ecx,%edx
+     968:	89 c1                	mov    %eax,%ecx
+     96a:	39 da                	cmp    %ebx,%edx
+     96c:	73 e2                	jae    950 <printint+0x30>
+  if(neg)
+     96e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     971:	85 c0                	test   %eax,%eax
+     973:	74 07                	je     97c <printint+0x5c>
+    buf[i++] = '-';
+     975:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+     97a:	89 f7                	mov    %esi,%edi
+     97c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+     97f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+     982:	01 df                	add    %ebx,%edi
+     984:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+     988:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+     98b:	83 ec 04             	sub    $0x4,%esp
+     98e:	88 45 d7             	mov    %al,-0x29(%ebp)
+     991:	8d 45 d7             	lea    -0x29(%ebp),%eax
+     994:	6a 01                	push   $0x1
+     996:	50                   	push   %eax
+     997:	56                   	push   %esi
+     998:	e8 c6 fe ff ff       	call   863 <write>
+  while(--i >= 0)
+     99d:	89 f8                	mov    %edi,%eax
+     99f:	83 c4 10             	add    $0x10,%esp
+     9a2:	83 ef 01             	sub    $0x1,%edi
+     9a5:	39 d8                	cmp    %ebx,%eax
+     9a7:	75 df                	jne    988 <printint+0x68>
+}
+     9a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9ac:	5b                   	pop    %ebx
+     9ad:	5e                   	pop    %esi
+     9ae:	5f                   	pop    %edi
+     9af:	5d                   	pop    %ebp
+     9b0:	c3                   	ret
+     9b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+     9b8:	31 c0                	xor    %eax,%eax
+     9ba:	eb 89                	jmp    945 <printint+0x25>
+     9bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009c0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+     9c0:	55                   	push   %ebp
+     9c1:	89 e5                	mov    %esp,%ebp
+     9c3:	57                   	push   %edi
+     9c4:	56                   	push   %esi
+     9c5:	53                   	push   %ebx
+     9c6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+     9c9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+     9cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+     9cf:	0f b6 1e             	movzbl (%esi),%ebx
+     9d2:	83 c6 01             	add    $0x1,%esi
+     9d5:	84 db                	test   %bl,%bl
+     9d7:	74 67                	je     a40 <printf+0x80>
+     9d9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+     9dc:	31 d2                	xor    %edx,%edx
+     9de:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+     9e1:	eb 34                	jmp    a17 <printf+0x57>
+     9e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     9e7:	90                   	nop
+     9e8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+     9eb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+     9f0:	83 f8 25             	cmp    $0x25,%eax
+     9f3:	74 18                	je     a0d <printf+0x4d>
+  write(fd, &c, 1);
+     9f5:	83 ec 04             	sub    $0x4,%esp
+     9f8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+     9fb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     9fe:	6a 01                	push   $0x1
+     a00:	50                   	push   %eax
+     a01:	57                   	push   %edi
+     a02:	e8 5c fe ff ff       	call   863 <write>
+     a07:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+     a0a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+     a0d:	0f b6 1e             	movzbl (%esi),%ebx
+     a10:	83 c6 01             	add    $0x1,%esi
+     a13:	84 db                	test   %bl,%bl
+     a15:	74 29                	je     a40 <printf+0x80>
+    c = fmt[i] & 0xff;
+     a17:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+     a1a:	85 d2                	test   %edx,%edx
+     a1c:	74 ca                	je     9e8 <printf+0x28>
+      }
+    } else if(state == '%'){
+     a1e:	83 fa 25             	cmp    $0x25,%edx
+     a21:	75 ea                	jne    a0d <printf+0x4d>
+      if(c == 'd'){
+     a23:	83 f8 25             	cmp    $0x25,%eax
+     a26:	0f 84 24 01 00 00    	je     b50 <printf+0x190>
+     a2c:	83 e8 63             	sub    $0x63,%eax
+     a2f:	83 f8 15             	cmp    $0x15,%eax
+     a32:	77 1c                	ja     a50 <printf+0x90>
+     a34:	ff 24 85 cc 10 00 00 	jmp    *0x10cc(,%eax,4)
+     a3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     a3f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+     a40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a43:	5b                   	pop    %ebx
+     a44:	5e                   	pop    %esi
+     a45:	5f                   	pop    %edi
+     a46:	5d                   	pop    %ebp
+     a47:	c3                   	ret
+     a48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a4f:	90                   	nop
+  write(fd, &c, 1);
+     a50:	83 ec 04             	sub    $0x4,%esp
+     a53:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     a56:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+     a5a:	6a 01                	push   $0x1
+     a5c:	52                   	push   %edx
+     a5d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     a60:	57                   	push   %edi
+     a61:	e8 fd fd ff ff       	call   863 <write>
+     a66:	83 c4 0c             	add    $0xc,%esp
+     a69:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     a6c:	6a 01                	push   $0x1
+     a6e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     a71:	52                   	push   %edx
+     a72:	57                   	push   %edi
+     a73:	e8 eb fd ff ff       	call   863 <write>
+        putc(fd, c);
+     a78:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     a7b:	31 d2                	xor    %edx,%edx
+     a7d:	eb 8e                	jmp    a0d <printf+0x4d>
+     a7f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+     a80:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     a83:	83 ec 0c             	sub    $0xc,%esp
+     a86:	b9 10 00 00 00       	mov    $0x10,%ecx
+     a8b:	8b 13                	mov    (%ebx),%edx
+     a8d:	6a 00                	push   $0x0
+     a8f:	89 f8                	mov    %edi,%eax
+        ap++;
+     a91:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+     a94:	e8 87 fe ff ff       	call   920 <printint>
+        ap++;
+     a99:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     a9c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     a9f:	31 d2                	xor    %edx,%edx
+     aa1:	e9 67 ff ff ff       	jmp    a0d <printf+0x4d>
+     aa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aad:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+     ab0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     ab3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+     ab5:	83 c0 04             	add    $0x4,%eax
+     ab8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+     abb:	85 db                	test   %ebx,%ebx
+     abd:	0f 84 9d 00 00 00    	je     b60 <printf+0x1a0>
+        while(*s != 0){
+     ac3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+     ac6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+     ac8:	84 c0                	test   %al,%al
+     aca:	0f 84 3d ff ff ff    	je     a0d <printf+0x4d>
+     ad0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     ad3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+     ad6:	89 de                	mov    %ebx,%esi
+     ad8:	89 d3                	mov    %edx,%ebx
+     ada:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+     ae0:	83 ec 04             	sub    $0x4,%esp
+     ae3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+     ae6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+     ae9:	6a 01                	push   $0x1
+     aeb:	53                   	push   %ebx
+     aec:	57                   	push   %edi
+     aed:	e8 71 fd ff ff       	call   863 <write>
+        while(*s != 0){
+     af2:	0f b6 06             	movzbl (%esi),%eax
+     af5:	83 c4 10             	add    $0x10,%esp
+     af8:	84 c0                	test   %al,%al
+     afa:	75 e4                	jne    ae0 <printf+0x120>
+      state = 0;
+     afc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     aff:	31 d2                	xor    %edx,%edx
+     b01:	e9 07 ff ff ff       	jmp    a0d <printf+0x4d>
+     b06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b0d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+     b10:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     b13:	83 ec 0c             	sub    $0xc,%esp
+     b16:	b9 0a 00 00 00       	mov    $0xa,%ecx
+     b1b:	8b 13                	mov    (%ebx),%edx
+     b1d:	6a 01                	push   $0x1
+     b1f:	e9 6b ff ff ff       	jmp    a8f <printf+0xcf>
+     b24:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+     b28:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+     b2b:	83 ec 04             	sub    $0x4,%esp
+     b2e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+     b31:	8b 03                	mov    (%ebx),%eax
+        ap++;
+     b33:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+     b36:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+     b39:	6a 01                	push   $0x1
+     b3b:	52                   	push   %edx
+     b3c:	57                   	push   %edi
+     b3d:	e8 21 fd ff ff       	call   863 <write>
+        ap++;
+     b42:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     b45:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+     b48:	31 d2                	xor    %edx,%edx
+     b4a:	e9 be fe ff ff       	jmp    a0d <printf+0x4d>
+     b4f:	90                   	nop
+  write(fd, &c, 1);
+     b50:	83 ec 04             	sub    $0x4,%esp
+     b53:	88 5d e7             	mov    %bl,-0x19(%ebp)
+     b56:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     b59:	6a 01                	push   $0x1
+     b5b:	e9 11 ff ff ff       	jmp    a71 <printf+0xb1>
+     b60:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+     b65:	bb c4 10 00 00       	mov    $0x10c4,%ebx
+     b6a:	e9 61 ff ff ff       	jmp    ad0 <printf+0x110>
+     b6f:	90                   	nop
+
+00000b70 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     b70:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     b71:	a1 c0 30 00 00       	mov    0x30c0,%eax
+{
+     b76:	89 e5                	mov    %esp,%ebp
+     b78:	57                   	push   %edi
+     b79:	56                   	push   %esi
+     b7a:	53                   	push   %ebx
+     b7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+     b7e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     b81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b88:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     b8a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     b8c:	39 ca                	cmp    %ecx,%edx
+     b8e:	73 30                	jae    bc0 <free+0x50>
+     b90:	39 c1                	cmp    %eax,%ecx
+     b92:	72 04                	jb     b98 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     b94:	39 c2                	cmp    %eax,%edx
+     b96:	72 f0                	jb     b88 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     b98:	8b 73 fc             	mov    -0x4(%ebx),%esi
+     b9b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+     b9e:	39 f8                	cmp    %edi,%eax
+     ba0:	74 2e                	je     bd0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+     ba2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+     ba5:	8b 42 04             	mov    0x4(%edx),%eax
+     ba8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     bab:	39 f1                	cmp    %esi,%ecx
+     bad:	74 38                	je     be7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+     baf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+     bb1:	5b                   	pop    %ebx
+  freep = p;
+     bb2:	89 15 c0 30 00 00    	mov    %edx,0x30c0
+}
+     bb8:	5e                   	pop    %esi
+     bb9:	5f                   	pop    %edi
+     bba:	5d                   	pop    %ebp
+     bbb:	c3                   	ret
+     bbc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     bc0:	39 c1                	cmp    %eax,%ecx
+     bc2:	72 d0                	jb     b94 <free+0x24>
+     bc4:	eb c2                	jmp    b88 <free+0x18>
+     bc6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bcd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+     bd0:	03 70 04             	add    0x4(%eax),%esi
+     bd3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     bd6:	8b 02                	mov    (%edx),%eax
+     bd8:	8b 00                	mov    (%eax),%eax
+     bda:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+     bdd:	8b 42 04             	mov    0x4(%edx),%eax
+     be0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+     be3:	39 f1                	cmp    %esi,%ecx
+     be5:	75 c8                	jne    baf <free+0x3f>
+    p->s.size += bp->s.size;
+     be7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+     bea:	89 15 c0 30 00 00    	mov    %edx,0x30c0
+    p->s.size += bp->s.size;
+     bf0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+     bf3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+     bf6:	89 0a                	mov    %ecx,(%edx)
+}
+     bf8:	5b                   	pop    %ebx
+     bf9:	5e                   	pop    %esi
+     bfa:	5f                   	pop    %edi
+     bfb:	5d                   	pop    %ebp
+     bfc:	c3                   	ret
+     bfd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c00 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+     c00:	55                   	push   %ebp
+     c01:	89 e5                	mov    %esp,%ebp
+     c03:	57                   	push   %edi
+     c04:	56                   	push   %esi
+     c05:	53                   	push   %ebx
+     c06:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     c09:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+     c0c:	8b 15 c0 30 00 00    	mov    0x30c0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     c12:	8d 78 07             	lea    0x7(%eax),%edi
+     c15:	c1 ef 03             	shr    $0x3,%edi
+     c18:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+     c1b:	85 d2                	test   %edx,%edx
+     c1d:	0f 84 8d 00 00 00    	je     cb0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     c23:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     c25:	8b 48 04             	mov    0x4(%eax),%ecx
+     c28:	39 f9                	cmp    %edi,%ecx
+     c2a:	73 64                	jae    c90 <malloc+0x90>
+  if(nu < 4096)
+     c2c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+     c31:	39 df                	cmp    %ebx,%edi
+     c33:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+     c36:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+     c3d:	eb 0a                	jmp    c49 <malloc+0x49>
+     c3f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     c40:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+     c42:	8b 48 04             	mov    0x4(%eax),%ecx
+     c45:	39 f9                	cmp    %edi,%ecx
+     c47:	73 47                	jae    c90 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+     c49:	89 c2                	mov    %eax,%edx
+     c4b:	39 05 c0 30 00 00    	cmp    %eax,0x30c0
+     c51:	75 ed                	jne    c40 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+     c53:	83 ec 0c             	sub    $0xc,%esp
+     c56:	56                   	push   %esi
+     c57:	e8 6f fc ff ff       	call   8cb <sbrk>
+  if(p == (char*)-1)
+     c5c:	83 c4 10             	add    $0x10,%esp
+     c5f:	83 f8 ff             	cmp    $0xffffffff,%eax
+     c62:	74 1c                	je     c80 <malloc+0x80>
+  hp->s.size = nu;
+     c64:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+     c67:	83 ec 0c             	sub    $0xc,%esp
+     c6a:	83 c0 08             	add    $0x8,%eax
+     c6d:	50                   	push   %eax
+     c6e:	e8 fd fe ff ff       	call   b70 <free>
+  return freep;
+     c73:	8b 15 c0 30 00 00    	mov    0x30c0,%edx
+      if((p = morecore(nunits)) == 0)
+     c79:	83 c4 10             	add    $0x10,%esp
+     c7c:	85 d2                	test   %edx,%edx
+     c7e:	75 c0                	jne    c40 <malloc+0x40>
+        return 0;
+  }
+}
+     c80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+     c83:	31 c0                	xor    %eax,%eax
+}
+     c85:	5b                   	pop    %ebx
+     c86:	5e                   	pop    %esi
+     c87:	5f                   	pop    %edi
+     c88:	5d                   	pop    %ebp
+     c89:	c3                   	ret
+     c8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+     c90:	39 cf                	cmp    %ecx,%edi
+     c92:	74 4c                	je     ce0 <malloc+0xe0>
+        p->s.size -= nunits;
+     c94:	29 f9                	sub    %edi,%ecx
+     c96:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+     c99:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+     c9c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+     c9f:	89 15 c0 30 00 00    	mov    %edx,0x30c0
+}
+     ca5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+     ca8:	83 c0 08             	add    $0x8,%eax
+}
+     cab:	5b                   	pop    %ebx
+     cac:	5e                   	pop    %esi
+     cad:	5f                   	pop    %edi
+     cae:	5d                   	pop    %ebp
+     caf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+     cb0:	c7 05 c0 30 00 00 c4 	movl   $0x30c4,0x30c0
+     cb7:	30 00 00 
+    base.s.size = 0;
+     cba:	b8 c4 30 00 00       	mov    $0x30c4,%eax
+    base.s.ptr = freep = prevp = &base;
+     cbf:	c7 05 c4 30 00 00 c4 	movl   $0x30c4,0x30c4
+     cc6:	30 00 00 
+    base.s.size = 0;
+     cc9:	c7 05 c8 30 00 00 00 	movl   $0x0,0x30c8
+     cd0:	00 00 00 
+    if(p->s.size >= nunits){
+     cd3:	e9 54 ff ff ff       	jmp    c2c <malloc+0x2c>
+     cd8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cdf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+     ce0:	8b 08                	mov    (%eax),%ecx
+     ce2:	89 0a                	mov    %ecx,(%edx)
+     ce4:	eb b9                	jmp    c9f <malloc+0x9f>
+     ce6:	66 90                	xchg   %ax,%ax
+     ce8:	66 90                	xchg   %ax,%ax
+     cea:	66 90                	xchg   %ax,%ax
+     cec:	66 90                	xchg   %ax,%ax
+     cee:	66 90                	xchg   %ax,%ax
+
+00000cf0 <pidstat>:
+
+// Fill in *st with the statistics of process pid.
+// Returns 0, or -1 if there is no such process.
+int
+pidstat(int pid, struct pstat *st)
+{
+     cf0:	55                   	push   %ebp
+     cf1:	89 e5                	mov    %esp,%ebp
+     cf3:	56                   	push   %esi
+     cf4:	53                   	push   %ebx
+  static struct pstat *ps;
+  int i, n;
+
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+     cf5:	a1 cc 30 00 00       	mov    0x30cc,%eax
+{
+     cfa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     cfd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+     d00:	85 c0                	test   %eax,%eax
+     d02:	0f 84 98 00 00 00    	je     da0 <pidstat+0xb0>
+    return -1;
+  n = getpstat(ps, NPROC);
+     d08:	83 ec 08             	sub    $0x8,%esp
+     d0b:	6a 40                	push   $0x40
+     d0d:	50                   	push   %eax
+     d0e:	e8 e0 fb ff ff       	call   8f3 <getpstat>
+  for(i = 0; i < n; i++){
+     d13:	83 c4 10             	add    $0x10,%esp
+     d16:	85 c0                	test   %eax,%eax
+     d18:	0f 8e 9f 00 00 00    	jle    dbd <pidstat+0xcd>
+     d1e:	8b 15 cc 30 00 00    	mov    0x30cc,%edx
+     d24:	31 c9                	xor    %ecx,%ecx
+     d26:	eb 16                	jmp    d3e <pidstat+0x4e>
+     d28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d2f:	90                   	nop
+     d30:	83 c1 01             	add    $0x1,%ecx
+     d33:	83 c2 38             	add    $0x38,%edx
+     d36:	39 c8                	cmp    %ecx,%eax
+     d38:	0f 84 7f 00 00 00    	je     dbd <pidstat+0xcd>
+    if(ps[i].pid == pid){
+     d3e:	39 1a                	cmp    %ebx,(%edx)
+     d40:	75 ee                	jne    d30 <pidstat+0x40>
+      *st = ps[i];
+     d42:	89 1e                	mov    %ebx,(%esi)
+     d44:	8b 42 04             	mov    0x4(%edx),%eax
+     d47:	89 46 04             	mov    %eax,0x4(%esi)
+     d4a:	8b 42 08             	mov    0x8(%edx),%eax
+     d4d:	89 46 08             	mov    %eax,0x8(%esi)
+     d50:	8b 42 0c             	mov    0xc(%edx),%eax
+     d53:	89 46 0c             	mov    %eax,0xc(%esi)
+     d56:	8b 42 10             	mov    0x10(%edx),%eax
+     d59:	89 46 10             	mov    %eax,0x10(%esi)
+     d5c:	8b 42 14             	mov    0x14(%edx),%eax
+     d5f:	89 46 14             	mov    %eax,0x14(%esi)
+     d62:	8b 42 18             	mov    0x18(%edx),%eax
+     d65:	89 46 18             	mov    %eax,0x18(%esi)
+     d68:	8b 42 1c             	mov    0x1c(%edx),%eax
+     d6b:	89 46 1c             	mov    %eax,0x1c(%esi)
+     d6e:	8b 42 20             	mov    0x20(%edx),%eax
+     d71:	89 46 20             	mov    %eax,0x20(%esi)
+     d74:	8b 42 24             	mov    0x24(%edx),%eax
+     d77:	89 46 24             	mov    %eax,0x24(%esi)
+     d7a:	8b 42 28             	mov    0x28(%edx),%eax
+     d7d:	89 46 28             	mov    %eax,0x28(%esi)
+     d80:	8b 42 2c             	mov    0x2c(%edx),%eax
+     d83:	89 46 2c             	mov    %eax,0x2c(%esi)
+     d86:	8b 42 30             	mov    0x30(%edx),%eax
+     d89:	89 46 30             	mov    %eax,0x30(%esi)
+     d8c:	8b 42 34             	mov    0x34(%edx),%eax
+     d8f:	89 46 34             	mov    %eax,0x34(%esi)
+      return 0;
+    }
+  }
+  return -1;
+}
+     d92:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+     d95:	31 c0                	xor    %eax,%eax
+}
+     d97:	5b                   	pop    %ebx
+     d98:	5e                   	pop    %esi
+     d99:	5d                   	pop    %ebp
+     d9a:	c3                   	ret
+     d9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d9f:	90                   	nop
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+     da0:	83 ec 0c             	sub    $0xc,%esp
+     da3:	68 00 0e 00 00       	push   $0xe00
+     da8:	e8 53 fe ff ff       	call   c00 <malloc>
+     dad:	83 c4 10             	add    $0x10,%esp
+     db0:	a3 cc 30 00 00       	mov    %eax,0x30cc
+     db5:	85 c0                	test   %eax,%eax
+     db7:	0f 85 4b ff ff ff    	jne    d08 <pidstat+0x18>
+}
+     dbd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return -1;
+     dc0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+     dc5:	5b                   	pop    %ebx
+     dc6:	5e                   	pop    %esi
+     dc7:	5d                   	pop    %ebp
+     dc8:	c3                   	ret
+     dc9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000dd0 <sharetable>:
+// key[i] is printed in a column headed keyname, and so is
+// extra[i] under extraname unless extra is 0.
+void
+sharetable(char *tag, char *keyname, int *key, char *extraname, int *extra,
+           int n, int *pid, int *weight, uint *ticks)
+{
+     dd0:	55                   	push   %ebp
+     dd1:	89 e5                	mov    %esp,%ebp
+     dd3:	57                   	push   %edi
+     dd4:	56                   	push   %esi
+     dd5:	53                   	push   %ebx
+     dd6:	83 ec 3c             	sub    $0x3c,%esp
+     dd9:	8b 45 08             	mov    0x8(%ebp),%eax
+     ddc:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+     ddf:	8b 75 24             	mov    0x24(%ebp),%esi
+     de2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     de5:	89 45 dc             	mov    %eax,-0x24(%ebp)
+     de8:	8b 45 10             	mov    0x10(%ebp),%eax
+     deb:	89 7d d0             	mov    %edi,-0x30(%ebp)
+     dee:	8b 5d 14             	mov    0x14(%ebp),%ebx
+     df1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+     df4:	8b 45 18             	mov    0x18(%ebp),%eax
+     df7:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+     dfa:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     dfd:	8b 45 20             	mov    0x20(%ebp),%eax
+     e00:	89 45 c8             	mov    %eax,-0x38(%ebp)
+     e03:	8b 45 28             	mov    0x28(%ebp),%eax
+     e06:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  int i, wsum, share, expect, err, maxerr;
+  uint tsum;
+
+  wsum = 0;
+  tsum = 0;
+  for(i = 0; i < n; i++){
+     e09:	85 ff                	test   %edi,%edi
+     e0b:	0f 8e df 01 00 00    	jle    ff0 <sharetable+0x220>
+     e11:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+     e14:	89 fb                	mov    %edi,%ebx
+     e16:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  tsum = 0;
+     e19:	31 d2                	xor    %edx,%edx
+  for(i = 0; i < n; i++){
+     e1b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+     e1e:	31 c0                	xor    %eax,%eax
+     e20:	31 c9                	xor    %ecx,%ecx
+     e22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wsum += weight[i];
+     e28:	03 0c 86             	add    (%esi,%eax,4),%ecx
+    tsum += ticks[i];
+     e2b:	03 14 87             	add    (%edi,%eax,4),%edx
+  for(i = 0; i < n; i++){
+     e2e:	83 c0 01             	add    $0x1,%eax
+     e31:	39 c3                	cmp    %eax,%ebx
+     e33:	75 f3                	jne    e28 <sharetable+0x58>
+     e35:	85 d2                	test   %edx,%edx
+     e37:	b8 01 00 00 00       	mov    $0x1,%eax
+     e3c:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  }
+  if(tsum == 0)
+    tsum = 1;
+  if(wsum == 0)
+    wsum = 1;
+     e3f:	8b 7d d8             	mov    -0x28(%ebp),%edi
+     e42:	0f 45 c2             	cmovne %edx,%eax
+     e45:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+  if(tsum == 0)
+     e48:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    wsum = 1;
+     e4b:	85 ff                	test   %edi,%edi
+     e4d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+     e50:	b8 01 00 00 00       	mov    $0x1,%eax
+     e55:	0f 45 c7             	cmovne %edi,%eax
+     e58:	89 45 d8             	mov    %eax,-0x28(%ebp)
+
+  printf(1, "[%s]  pid %s ", tag, keyname);
+     e5b:	51                   	push   %ecx
+     e5c:	ff 75 dc             	push   -0x24(%ebp)
+     e5f:	68 35 11 00 00       	push   $0x1135
+     e64:	6a 01                	push   $0x1
+     e66:	e8 55 fb ff ff       	call   9c0 <printf>
+  if(extra)
+     e6b:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     e6e:	83 c4 10             	add    $0x10,%esp
+     e71:	85 f6                	test   %esi,%esi
+     e73:	0f 84 47 01 00 00    	je     fc0 <sharetable+0x1f0>
+    printf(1, "%s ", extraname);
+     e79:	83 ec 04             	sub    $0x4,%esp
+     e7c:	53                   	push   %ebx
+     e7d:	68 3f 11 00 00       	push   $0x113f
+     e82:	6a 01                	push   $0x1
+     e84:	e8 37 fb ff ff       	call   9c0 <printf>
+  printf(1, "ticks  share expected\n");
+     e89:	58                   	pop    %eax
+     e8a:	5a                   	pop    %edx
+     e8b:	68 43 11 00 00       	push   $0x1143
+     e90:	6a 01                	push   $0x1
+     e92:	e8 29 fb ff ff       	call   9c0 <printf>
+  maxerr = 0;
+  for(i = 0; i < n; i++){
+     e97:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+     e9a:	83 c4 10             	add    $0x10,%esp
+     e9d:	85 c9                	test   %ecx,%ecx
+     e9f:	0f 8e 44 01 00 00    	jle    fe9 <sharetable+0x219>
+  if(extra)
+     ea5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+     eac:	31 ff                	xor    %edi,%edi
+     eae:	66 90                	xchg   %ax,%ax
+    share = ticks[i] * 1000 / tsum;
+     eb0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     eb3:	31 d2                	xor    %edx,%edx
+    expect = weight[i] * 1000 / wsum;
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+     eb5:	83 ec 0c             	sub    $0xc,%esp
+    share = ticks[i] * 1000 / tsum;
+     eb8:	69 04 b8 e8 03 00 00 	imul   $0x3e8,(%eax,%edi,4),%eax
+     ebf:	f7 75 c0             	divl   -0x40(%ebp)
+     ec2:	89 c6                	mov    %eax,%esi
+    expect = weight[i] * 1000 / wsum;
+     ec4:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     ec7:	69 04 b8 e8 03 00 00 	imul   $0x3e8,(%eax,%edi,4),%eax
+     ece:	99                   	cltd
+     ecf:	f7 7d d8             	idivl  -0x28(%ebp)
+     ed2:	89 c3                	mov    %eax,%ebx
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+     ed4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+     ed7:	ff 34 b8             	push   (%eax,%edi,4)
+     eda:	8b 45 c8             	mov    -0x38(%ebp),%eax
+     edd:	ff 34 b8             	push   (%eax,%edi,4)
+     ee0:	ff 75 dc             	push   -0x24(%ebp)
+     ee3:	68 5a 11 00 00       	push   $0x115a
+     ee8:	6a 01                	push   $0x1
+     eea:	e8 d1 fa ff ff       	call   9c0 <printf>
+    if(extra)
+     eef:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     ef2:	83 c4 20             	add    $0x20,%esp
+     ef5:	85 c0                	test   %eax,%eax
+     ef7:	74 15                	je     f0e <sharetable+0x13e>
+      printf(1, "%d ", extra[i]);
+     ef9:	83 ec 04             	sub    $0x4,%esp
+     efc:	ff 34 b8             	push   (%eax,%edi,4)
+     eff:	68 62 11 00 00       	push   $0x1162
+     f04:	6a 01                	push   $0x1
+     f06:	e8 b5 fa ff ff       	call   9c0 <printf>
+     f0b:	83 c4 10             	add    $0x10,%esp
+    printf(1, "%d %d.%d%% %d.%d%%\n", ticks[i], share / 10, share % 10,
+     f0e:	b8 67 66 66 66       	mov    $0x66666667,%eax
+     f13:	89 d9                	mov    %ebx,%ecx
+     f15:	83 ec 04             	sub    $0x4,%esp
+     f18:	f7 eb                	imul   %ebx
+     f1a:	89 d8                	mov    %ebx,%eax
+     f1c:	c1 f8 1f             	sar    $0x1f,%eax
+     f1f:	c1 fa 02             	sar    $0x2,%edx
+     f22:	29 c2                	sub    %eax,%edx
+     f24:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     f27:	01 c0                	add    %eax,%eax
+     f29:	29 c1                	sub    %eax,%ecx
+     f2b:	b8 67 66 66 66       	mov    $0x66666667,%eax
+     f30:	51                   	push   %ecx
+     f31:	89 f1                	mov    %esi,%ecx
+     f33:	52                   	push   %edx
+     f34:	f7 ee                	imul   %esi
+     f36:	89 f0                	mov    %esi,%eax
+     f38:	c1 f8 1f             	sar    $0x1f,%eax
+     f3b:	c1 fa 02             	sar    $0x2,%edx
+     f3e:	29 c2                	sub    %eax,%edx
+     f40:	8d 04 92             	lea    (%edx,%edx,4),%eax
+     f43:	01 c0                	add    %eax,%eax
+     f45:	29 c1                	sub    %eax,%ecx
+     f47:	51                   	push   %ecx
+     f48:	52                   	push   %edx
+     f49:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     f4c:	ff 34 b8             	push   (%eax,%edi,4)
+     f4f:	68 66 11 00 00       	push   $0x1166
+     f54:	6a 01                	push   $0x1
+     f56:	e8 65 fa ff ff       	call   9c0 <printf>
+           expect / 10, expect % 10);
+    err = share > expect ? share - expect : expect - share;
+     f5b:	89 f2                	mov    %esi,%edx
+     f5d:	89 d8                	mov    %ebx,%eax
+     f5f:	83 c4 20             	add    $0x20,%esp
+     f62:	29 f0                	sub    %esi,%eax
+     f64:	29 da                	sub    %ebx,%edx
+     f66:	39 de                	cmp    %ebx,%esi
+     f68:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+     f6b:	0f 4f c2             	cmovg  %edx,%eax
+    if(err > maxerr)
+     f6e:	39 c6                	cmp    %eax,%esi
+     f70:	0f 4d c6             	cmovge %esi,%eax
+  for(i = 0; i < n; i++){
+     f73:	83 c7 01             	add    $0x1,%edi
+     f76:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     f79:	39 7d d0             	cmp    %edi,-0x30(%ebp)
+     f7c:	0f 85 2e ff ff ff    	jne    eb0 <sharetable+0xe0>
+      maxerr = err;
+  }
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+     f82:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+     f87:	f7 e2                	mul    %edx
+     f89:	c1 ea 03             	shr    $0x3,%edx
+     f8c:	8d 0c 92             	lea    (%edx,%edx,4),%ecx
+     f8f:	89 d0                	mov    %edx,%eax
+     f91:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     f94:	01 c9                	add    %ecx,%ecx
+     f96:	29 ca                	sub    %ecx,%edx
+     f98:	89 45 14             	mov    %eax,0x14(%ebp)
+     f9b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     f9e:	89 55 18             	mov    %edx,0x18(%ebp)
+     fa1:	89 45 10             	mov    %eax,0x10(%ebp)
+     fa4:	c7 45 0c 7c 11 00 00 	movl   $0x117c,0xc(%ebp)
+     fab:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+     fb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fb5:	5b                   	pop    %ebx
+     fb6:	5e                   	pop    %esi
+     fb7:	5f                   	pop    %edi
+     fb8:	5d                   	pop    %ebp
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+     fb9:	e9 02 fa ff ff       	jmp    9c0 <printf>
+     fbe:	66 90                	xchg   %ax,%ax
+  printf(1, "ticks  share expected\n");
+     fc0:	83 ec 08             	sub    $0x8,%esp
+     fc3:	68 43 11 00 00       	push   $0x1143
+     fc8:	6a 01                	push   $0x1
+     fca:	e8 f1 f9 ff ff       	call   9c0 <printf>
+     fcf:	83 c4 10             	add    $0x10,%esp
+     fd2:	e9 ce fe ff ff       	jmp    ea5 <sharetable+0xd5>
+     fd7:	83 ec 08             	sub    $0x8,%esp
+     fda:	68 43 11 00 00       	push   $0x1143
+     fdf:	6a 01                	push   $0x1
+     fe1:	e8 da f9 ff ff       	call   9c0 <printf>
+     fe6:	83 c4 10             	add    $0x10,%esp
+  if(extra)
+     fe9:	31 c0                	xor    %eax,%eax
+     feb:	31 d2                	xor    %edx,%edx
+     fed:	eb a9                	jmp    f98 <sharetable+0x1c8>
+     fef:	90                   	nop
+  printf(1, "[%s]  pid %s ", tag, keyname);
+     ff0:	51                   	push   %ecx
+     ff1:	ff 75 dc             	push   -0x24(%ebp)
+     ff4:	68 35 11 00 00       	push   $0x1135
+     ff9:	6a 01                	push   $0x1
+     ffb:	e8 c0 f9 ff ff       	call   9c0 <printf>
+  if(extra)
+    1000:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    1003:	83 c4 10             	add    $0x10,%esp
+    1006:	85 ff                	test   %edi,%edi
+    1008:	74 cd                	je     fd7 <sharetable+0x207>
+    wsum = 1;
+    100a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  if(extra)
+    1011:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+    1018:	e9 5c fe ff ff       	jmp    e79 <sharetable+0xa9>
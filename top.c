@@ -0,0 +1,109 @@
+// top.c — per-process scheduler statistics
+// Prints, for every process, its run time, time spent waiting
+// for a CPU, longest single wait, context switches and aging
+// boosts. With a count, repeats every interval ticks and shows
+// the run and wait time accumulated since the previous sample.
+//
+// usage: top [count] [interval]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "param.h"
+#include "pstat.h"
+
+static char *states[] = {
+  "unused", "embryo", "sleep", "runble", "run", "zombie"
+};
+
+static struct pstat ps[NPROC], prev[NPROC];
+static int nprev;
+
+// Print s left-justified in a field of width w.
+static void
+pads(char *s, int w)
+{
+  printf(1, "%s", s);
+  for (w -= strlen(s); w > 0; w--)
+    printf(1, " ");
+}
+
+// Print x right-justified in a field of width w.
+static void
+padd(uint x, int w)
+{
+  uint y;
+
+  for (y = x, w--; y >= 10; y /= 10)
+    w--;
+  for (; w > 0; w--)
+    printf(1, " ");
+  printf(1, "%d", x);
+}
+
+static struct pstat*
+lookup(int pid)
+{
+  int i;
+
+  for (i = 0; i < nprev; i++)
+    if (prev[i].pid == pid)
+      return &prev[i];
+  return 0;
+}
+
+static void
+show(int n)
+{
+  struct pstat *p, *q;
+  uint run, wait;
+  int i;
+
+  printf(1, "  PID CPU NI PR STATE     RUN    WAIT  MAXW  SWITCH BOOST NAME\n");
+  for (i = 0; i < n; i++) {
+    p = &ps[i];
+    run = p->runticks;
+    wait = p->waitticks;
+    if ((q = lookup(p->pid)) != 0) {
+      run -= q->runticks;
+      wait -= q->waitticks;
+    }
+    padd(p->pid, 5);
+    padd(p->cpu, 4);
+    padd(p->nice, 3);
+    padd(p->prio, 3);
+    printf(1, " ");
+    pads(p->state >= 0 && p->state < sizeof(states)/sizeof(states[0]) ? states[p->state] : "???", 6);
+    padd(run, 8);
+    padd(wait, 8);
+    padd(p->maxwait, 6);
+    padd(p->nswitch, 8);
+    padd(p->nboost, 6);
+    printf(1, " %s\n", p->name);
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int count = 1, interval = 100;
+  int n;
+
+  if (argc > 1) count = atoi(argv[1]);
+  if (argc > 2) interval = atoi(argv[2]);
+
+  for (;;) {
+    if ((n = getpstat(ps, NPROC)) < 0) {
+      printf(2, "top: getpstat failed\n");
+      exit();
+    }
+    show(n);
+    if (--count <= 0)
+      break;
+    memmove(prev, ps, n * sizeof(ps[0]));
+    nprev = n;
+    sleep(interval);
+    printf(1, "\n");
+  }
+  exit();
+}
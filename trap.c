@@ -14,6 +14,8 @@ extern uint vectors[];  // in vectors.S: array of 256 entry pointers
 struct spinlock tickslock;
 uint ticks;
 
+#define IDLEMAX HZ  // longest an idle CPU goes without a tick
+
 void
 tvinit(void)
 {
@@ -32,6 +34,36 @@ idtinit(void)
   lidt(idt, sizeof(idt));
 }
 
+// How many ticks an idle CPU may leave its timer off for.
+uint
+idleticks(void)
+{
+  uint n;
+
+  acquire(&tickslock);
+  n = timernext();
+  release(&tickslock);
+  if(n > IDLEMAX)
+    n = IDLEMAX;
+  return n > 0 ? n : 1;
+}
+
+// Bring ticks up to date. Any CPU's timer interrupt may do
+// this, since idle CPUs turn theirs off.
+static void
+clockintr(void)
+{
+  uint t;
+
+  acquire(&tickslock);
+  t = clockticks();
+  if((int)(t - ticks) > 0){
+    ticks = t;
+    timerrun();
+  }
+  release(&tickslock);
+}
+
 //PAGEBREAK: 41
 void
 trap(struct trapframe *tf)
@@ -48,12 +80,13 @@ trap(struct trapframe *tf)
 
   switch(tf->trapno){
   case T_IRQ0 + IRQ_TIMER:
-    if(cpuid() == 0){
-      acquire(&tickslock);
-      ticks++;
-      wakeup(&ticks);
-      release(&tickslock);
-    }
+    clockintr();
+    if(myproc() && myproc()->state == RUNNING)
+      myproc()->runticks++;
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_WAKEUP:
+    // Work was queued for this CPU while it was idle.
     lapiceoi();
     break;
   case T_IRQ0 + IRQ_IDE:
@@ -79,6 +112,18 @@ trap(struct trapframe *tf)
     break;
 
   //PAGEBREAK: 13
+  case T_PGFLT:
+    // A write to a page shared copy-on-write since fork(), or
+    // the first touch of a lazily allocated heap page. System
+    // calls prepare user memory before the kernel touches it
+    // (see argptr, argwptr, copyout), so that running out of
+    // memory fails the call; the kernel should not get here.
+    if(myproc() && (tf->err & FEC_WR) &&
+       cowfault(myproc()->pgdir, rcr2()) == 0)
+      break;
+    if(myproc() && lazyfault(myproc()->pgdir, myproc()->sz, rcr2()) == 0)
+      break;
+    // Otherwise a genuine fault.
   default:
     if(myproc() == 0 || (tf->cs&3) == 0){
       // In kernel, it must be our mistake.
@@ -103,7 +148,7 @@ trap(struct trapframe *tf)
   // Force process to give up CPU on clock tick.
   // If interrupts were on while locks held, would need to check nlock.
   if(myproc() && myproc()->state == RUNNING &&
-     tf->trapno == T_IRQ0+IRQ_TIMER)
+     tf->trapno == T_IRQ0+IRQ_TIMER && timeslice())
     yield();
 
   // Check if the process has been killed since we yielded
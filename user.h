@@ -1,4 +1,5 @@
 struct stat;
+struct pstat;
 struct rtcdate;
 
 // system calls
@@ -25,6 +26,12 @@ int sleep(int);
 int uptime(void);
 
 int nice(int pid, int value);   // HW3: two-argument nice syscall
+int fsync(int);
+int getpstat(struct pstat*, int);
+int pipesize(int, int);
+int uptimens(uint64*);
+int settickets(int, int);
+int transfer(int);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -39,3 +46,7 @@ void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
 int atoi(const char*);
+
+// pstat.c
+int pidstat(int, struct pstat*);
+void sharetable(char*, char*, int*, char*, int*, int, int*, int*, uint*);
@@ -0,0 +1,8184 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return randstate;
+}
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	51                   	push   %ecx
+       e:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "usertests starting\n");
+      11:	68 d4 5f 00 00       	push   $0x5fd4
+      16:	6a 01                	push   $0x1
+      18:	e8 c3 46 00 00       	call   46e0 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      1d:	59                   	pop    %ecx
+      1e:	58                   	pop    %eax
+      1f:	6a 00                	push   $0x0
+      21:	68 e8 5f 00 00       	push   $0x5fe8
+      26:	e8 78 45 00 00       	call   45a3 <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	85 c0                	test   %eax,%eax
+      30:	78 13                	js     45 <main+0x45>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      32:	52                   	push   %edx
+      33:	52                   	push   %edx
+      34:	68 08 69 00 00       	push   $0x6908
+      39:	6a 01                	push   $0x1
+      3b:	e8 a0 46 00 00       	call   46e0 <printf>
+    exit();
+      40:	e8 1e 45 00 00       	call   4563 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      45:	50                   	push   %eax
+      46:	50                   	push   %eax
+      47:	68 00 02 00 00       	push   $0x200
+      4c:	68 e8 5f 00 00       	push   $0x5fe8
+      51:	e8 4d 45 00 00       	call   45a3 <open>
+      56:	89 04 24             	mov    %eax,(%esp)
+      59:	e8 2d 45 00 00       	call   458b <close>
+
+  argptest();
+      5e:	e8 2d 42 00 00       	call   4290 <argptest>
+  createdelete();
+      63:	e8 d8 16 00 00       	call   1740 <createdelete>
+  linkunlink();
+      68:	e8 73 1f 00 00       	call   1fe0 <linkunlink>
+  concreate();
+      6d:	e8 6e 1c 00 00       	call   1ce0 <concreate>
+  fourfiles();
+      72:	e8 c9 14 00 00       	call   1540 <fourfiles>
+  sharedfd();
+      77:	e8 04 13 00 00       	call   1380 <sharedfd>
+
+  bigargtest();
+      7c:	e8 cf 3e 00 00       	call   3f50 <bigargtest>
+  bigwrite();
+      81:	e8 7a 28 00 00       	call   2900 <bigwrite>
+  bigargtest();
+      86:	e8 c5 3e 00 00       	call   3f50 <bigargtest>
+  bsstest();
+      8b:	e8 50 3e 00 00       	call   3ee0 <bsstest>
+  sbrktest();
+      90:	e8 bb 34 00 00       	call   3550 <sbrktest>
+  lazytest();
+      95:	e8 f6 3a 00 00       	call   3b90 <lazytest>
+  validatetest();
+      9a:	e8 91 3d 00 00       	call   3e30 <validatetest>
+
+  opentest();
+      9f:	e8 7c 03 00 00       	call   420 <opentest>
+  writetest();
+      a4:	e8 07 04 00 00       	call   4b0 <writetest>
+  writetest1();
+      a9:	e8 e2 05 00 00       	call   690 <writetest1>
+  fsynctest();
+      ae:	e8 dd 38 00 00       	call   3990 <fsynctest>
+  createtest();
+      b3:	e8 98 07 00 00       	call   850 <createtest>
+
+  openiputtest();
+      b8:	e8 63 02 00 00       	call   320 <openiputtest>
+  exitiputtest();
+      bd:	e8 5e 01 00 00       	call   220 <exitiputtest>
+  iputtest();
+      c2:	e8 79 00 00 00       	call   140 <iputtest>
+
+  mem();
+      c7:	e8 e4 11 00 00       	call   12b0 <mem>
+  pipe1();
+      cc:	e8 5f 09 00 00       	call   a30 <pipe1>
+  pipeloan();
+      d1:	e8 fa 0a 00 00       	call   bd0 <pipeloan>
+  pipesizetest();
+      d6:	e8 05 0d 00 00       	call   de0 <pipesizetest>
+  preempt();
+      db:	e8 f0 0f 00 00       	call   10d0 <preempt>
+  uptimenstest();
+      e0:	e8 fb 0e 00 00       	call   fe0 <uptimenstest>
+  exitwait();
+      e5:	e8 46 11 00 00       	call   1230 <exitwait>
+
+  rmdot();
+      ea:	e8 01 2c 00 00       	call   2cf0 <rmdot>
+  fourteen();
+      ef:	e8 bc 2a 00 00       	call   2bb0 <fourteen>
+  bigfile();
+      f4:	e8 e7 28 00 00       	call   29e0 <bigfile>
+  subdir();
+      f9:	e8 22 21 00 00       	call   2220 <subdir>
+  linktest();
+      fe:	e8 cd 19 00 00       	call   1ad0 <linktest>
+  unlinkread();
+     103:	e8 38 18 00 00       	call   1940 <unlinkread>
+  dirfile();
+     108:	e8 63 2d 00 00       	call   2e70 <dirfile>
+  iref();
+     10d:	e8 5e 2f 00 00       	call   3070 <iref>
+  dcachetest();
+     112:	e8 79 30 00 00       	call   3190 <dcachetest>
+  forktest();
+     117:	e8 84 31 00 00       	call   32a0 <forktest>
+  cowtest();
+     11c:	e8 2f 32 00 00       	call   3350 <cowtest>
+  bigdir(); // slow
+     121:	e8 ca 1f 00 00       	call   20f0 <bigdir>
+
+  uio();
+     126:	e8 f5 40 00 00       	call   4220 <uio>
+
+  exectest();
+     12b:	e8 b0 08 00 00       	call   9e0 <exectest>
+
+  exit();
+     130:	e8 2e 44 00 00       	call   4563 <exit>
+     135:	66 90                	xchg   %ax,%ax
+     137:	66 90                	xchg   %ax,%ax
+     139:	66 90                	xchg   %ax,%ax
+     13b:	66 90                	xchg   %ax,%ax
+     13d:	66 90                	xchg   %ax,%ax
+     13f:	90                   	nop
+
+00000140 <iputtest>:
+{
+     140:	55                   	push   %ebp
+     141:	89 e5                	mov    %esp,%ebp
+     143:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+     146:	68 d4 4d 00 00       	push   $0x4dd4
+     14b:	ff 35 88 74 00 00    	push   0x7488
+     151:	e8 8a 45 00 00       	call   46e0 <printf>
+  if(mkdir("iputdir") < 0){
+     156:	c7 04 24 67 4d 00 00 	movl   $0x4d67,(%esp)
+     15d:	e8 69 44 00 00       	call   45cb <mkdir>
+     162:	83 c4 10             	add    $0x10,%esp
+     165:	85 c0                	test   %eax,%eax
+     167:	78 58                	js     1c1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+     169:	83 ec 0c             	sub    $0xc,%esp
+     16c:	68 67 4d 00 00       	push   $0x4d67
+     171:	e8 5d 44 00 00       	call   45d3 <chdir>
+     176:	83 c4 10             	add    $0x10,%esp
+     179:	85 c0                	test   %eax,%eax
+     17b:	0f 88 85 00 00 00    	js     206 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+     181:	83 ec 0c             	sub    $0xc,%esp
+     184:	68 64 4d 00 00       	push   $0x4d64
+     189:	e8 25 44 00 00       	call   45b3 <unlink>
+     18e:	83 c4 10             	add    $0x10,%esp
+     191:	85 c0                	test   %eax,%eax
+     193:	78 5a                	js     1ef <iputtest+0xaf>
+  if(chdir("/") < 0){
+     195:	83 ec 0c             	sub    $0xc,%esp
+     198:	68 89 4d 00 00       	push   $0x4d89
+     19d:	e8 31 44 00 00       	call   45d3 <chdir>
+     1a2:	83 c4 10             	add    $0x10,%esp
+     1a5:	85 c0                	test   %eax,%eax
+     1a7:	78 2f                	js     1d8 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+     1a9:	83 ec 08             	sub    $0x8,%esp
+     1ac:	68 0c 4e 00 00       	push   $0x4e0c
+     1b1:	ff 35 88 74 00 00    	push   0x7488
+     1b7:	e8 24 45 00 00       	call   46e0 <printf>
+}
+     1bc:	83 c4 10             	add    $0x10,%esp
+     1bf:	c9                   	leave
+     1c0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     1c1:	50                   	push   %eax
+     1c2:	50                   	push   %eax
+     1c3:	68 40 4d 00 00       	push   $0x4d40
+     1c8:	ff 35 88 74 00 00    	push   0x7488
+     1ce:	e8 0d 45 00 00       	call   46e0 <printf>
+    exit();
+     1d3:	e8 8b 43 00 00       	call   4563 <exit>
+    printf(stdout, "chdir / failed\n");
+     1d8:	50                   	push   %eax
+     1d9:	50                   	push   %eax
+     1da:	68 8b 4d 00 00       	push   $0x4d8b
+     1df:	ff 35 88 74 00 00    	push   0x7488
+     1e5:	e8 f6 44 00 00       	call   46e0 <printf>
+    exit();
+     1ea:	e8 74 43 00 00       	call   4563 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+     1ef:	52                   	push   %edx
+     1f0:	52                   	push   %edx
+     1f1:	68 6f 4d 00 00       	push   $0x4d6f
+     1f6:	ff 35 88 74 00 00    	push   0x7488
+     1fc:	e8 df 44 00 00       	call   46e0 <printf>
+    exit();
+     201:	e8 5d 43 00 00       	call   4563 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+     206:	51                   	push   %ecx
+     207:	51                   	push   %ecx
+     208:	68 4e 4d 00 00       	push   $0x4d4e
+     20d:	ff 35 88 74 00 00    	push   0x7488
+     213:	e8 c8 44 00 00       	call   46e0 <printf>
+    exit();
+     218:	e8 46 43 00 00       	call   4563 <exit>
+     21d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000220 <exitiputtest>:
+{
+     220:	55                   	push   %ebp
+     221:	89 e5                	mov    %esp,%ebp
+     223:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+     226:	68 9b 4d 00 00       	push   $0x4d9b
+     22b:	ff 35 88 74 00 00    	push   0x7488
+     231:	e8 aa 44 00 00       	call   46e0 <printf>
+  pid = fork();
+     236:	e8 20 43 00 00       	call   455b <fork>
+  if(pid < 0){
+     23b:	83 c4 10             	add    $0x10,%esp
+     23e:	85 c0                	test   %eax,%eax
+     240:	0f 88 8a 00 00 00    	js     2d0 <exitiputtest+0xb0>
+  if(pid == 0){
+     246:	75 50                	jne    298 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+     248:	83 ec 0c             	sub    $0xc,%esp
+     24b:	68 67 4d 00 00       	push   $0x4d67
+     250:	e8 76 43 00 00       	call   45cb <mkdir>
+     255:	83 c4 10             	add    $0x10,%esp
+     258:	85 c0                	test   %eax,%eax
+     25a:	0f 88 87 00 00 00    	js     2e7 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+     260:	83 ec 0c             	sub    $0xc,%esp
+     263:	68 67 4d 00 00       	push   $0x4d67
+     268:	e8 66 43 00 00       	call   45d3 <chdir>
+     26d:	83 c4 10             	add    $0x10,%esp
+     270:	85 c0                	test   %eax,%eax
+     272:	0f 88 86 00 00 00    	js     2fe <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+     278:	83 ec 0c             	sub    $0xc,%esp
+     27b:	68 64 4d 00 00       	push   $0x4d64
+     280:	e8 2e 43 00 00       	call   45b3 <unlink>
+     285:	83 c4 10             	add    $0x10,%esp
+     288:	85 c0                	test   %eax,%eax
+     28a:	78 2c                	js     2b8 <exitiputtest+0x98>
+    exit();
+     28c:	e8 d2 42 00 00       	call   4563 <exit>
+     291:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+     298:	e8 ce 42 00 00       	call   456b <wait>
+  printf(stdout, "exitiput test ok\n");
+     29d:	83 ec 08             	sub    $0x8,%esp
+     2a0:	68 be 4d 00 00       	push   $0x4dbe
+     2a5:	ff 35 88 74 00 00    	push   0x7488
+     2ab:	e8 30 44 00 00       	call   46e0 <printf>
+}
+     2b0:	83 c4 10             	add    $0x10,%esp
+     2b3:	c9                   	leave
+     2b4:	c3                   	ret
+     2b5:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+     2b8:	83 ec 08             	sub    $0x8,%esp
+     2bb:	68 6f 4d 00 00       	push   $0x4d6f
+     2c0:	ff 35 88 74 00 00    	push   0x7488
+     2c6:	e8 15 44 00 00       	call   46e0 <printf>
+      exit();
+     2cb:	e8 93 42 00 00       	call   4563 <exit>
+    printf(stdout, "fork failed\n");
+     2d0:	51                   	push   %ecx
+     2d1:	51                   	push   %ecx
+     2d2:	68 27 5f 00 00       	push   $0x5f27
+     2d7:	ff 35 88 74 00 00    	push   0x7488
+     2dd:	e8 fe 43 00 00       	call   46e0 <printf>
+    exit();
+     2e2:	e8 7c 42 00 00       	call   4563 <exit>
+      printf(stdout, "mkdir failed\n");
+     2e7:	52                   	push   %edx
+     2e8:	52                   	push   %edx
+     2e9:	68 40 4d 00 00       	push   $0x4d40
+     2ee:	ff 35 88 74 00 00    	push   0x7488
+     2f4:	e8 e7 43 00 00       	call   46e0 <printf>
+      exit();
+     2f9:	e8 65 42 00 00       	call   4563 <exit>
+      printf(stdout, "child chdir failed\n");
+     2fe:	50                   	push   %eax
+     2ff:	50                   	push   %eax
+     300:	68 aa 4d 00 00       	push   $0x4daa
+     305:	ff 35 88 74 00 00    	push   0x7488
+     30b:	e8 d0 43 00 00       	call   46e0 <printf>
+      exit();
+     310:	e8 4e 42 00 00       	call   4563 <exit>
+     315:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <openiputtest>:
+{
+     320:	55                   	push   %ebp
+     321:	89 e5                	mov    %esp,%ebp
+     323:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+     326:	68 d0 4d 00 00       	push   $0x4dd0
+     32b:	ff 35 88 74 00 00    	push   0x7488
+     331:	e8 aa 43 00 00       	call   46e0 <printf>
+  if(mkdir("oidir") < 0){
+     336:	c7 04 24 df 4d 00 00 	movl   $0x4ddf,(%esp)
+     33d:	e8 89 42 00 00       	call   45cb <mkdir>
+     342:	83 c4 10             	add    $0x10,%esp
+     345:	85 c0                	test   %eax,%eax
+     347:	0f 88 9f 00 00 00    	js     3ec <openiputtest+0xcc>
+  pid = fork();
+     34d:	e8 09 42 00 00       	call   455b <fork>
+  if(pid < 0){
+     352:	85 c0                	test   %eax,%eax
+     354:	78 7f                	js     3d5 <openiputtest+0xb5>
+  if(pid == 0){
+     356:	75 38                	jne    390 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+     358:	83 ec 08             	sub    $0x8,%esp
+     35b:	6a 02                	push   $0x2
+     35d:	68 df 4d 00 00       	push   $0x4ddf
+     362:	e8 3c 42 00 00       	call   45a3 <open>
+    if(fd >= 0){
+     367:	83 c4 10             	add    $0x10,%esp
+     36a:	85 c0                	test   %eax,%eax
+     36c:	78 62                	js     3d0 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+     36e:	83 ec 08             	sub    $0x8,%esp
+     371:	68 08 60 00 00       	push   $0x6008
+     376:	ff 35 88 74 00 00    	push   0x7488
+     37c:	e8 5f 43 00 00       	call   46e0 <printf>
+      exit();
+     381:	e8 dd 41 00 00       	call   4563 <exit>
+     386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     38d:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+     390:	83 ec 0c             	sub    $0xc,%esp
+     393:	6a 01                	push   $0x1
+     395:	e8 59 42 00 00       	call   45f3 <sleep>
+  if(unlink("oidir") != 0){
+     39a:	c7 04 24 df 4d 00 00 	movl   $0x4ddf,(%esp)
+     3a1:	e8 0d 42 00 00       	call   45b3 <unlink>
+     3a6:	83 c4 10             	add    $0x10,%esp
+     3a9:	85 c0                	test   %eax,%eax
+     3ab:	75 56                	jne    403 <openiputtest+0xe3>
+  wait();
+     3ad:	e8 b9 41 00 00       	call   456b <wait>
+  printf(stdout, "openiput test ok\n");
+     3b2:	83 ec 08             	sub    $0x8,%esp
+     3b5:	68 08 4e 00 00       	push   $0x4e08
+     3ba:	ff 35 88 74 00 00    	push   0x7488
+     3c0:	e8 1b 43 00 00       	call   46e0 <printf>
+}
+     3c5:	83 c4 10             	add    $0x10,%esp
+     3c8:	c9                   	leave
+     3c9:	c3                   	ret
+     3ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+     3d0:	e8 8e 41 00 00       	call   4563 <exit>
+    printf(stdout, "fork failed\n");
+     3d5:	52                   	push   %edx
+     3d6:	52                   	push   %edx
+     3d7:	68 27 5f 00 00       	push   $0x5f27
+     3dc:	ff 35 88 74 00 00    	push   0x7488
+     3e2:	e8 f9 42 00 00       	call   46e0 <printf>
+    exit();
+     3e7:	e8 77 41 00 00       	call   4563 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+     3ec:	51                   	push   %ecx
+     3ed:	51                   	push   %ecx
+     3ee:	68 e5 4d 00 00       	push   $0x4de5
+     3f3:	ff 35 88 74 00 00    	push   0x7488
+     3f9:	e8 e2 42 00 00       	call   46e0 <printf>
+    exit();
+     3fe:	e8 60 41 00 00       	call   4563 <exit>
+    printf(stdout, "unlink failed\n");
+     403:	50                   	push   %eax
+     404:	50                   	push   %eax
+     405:	68 f9 4d 00 00       	push   $0x4df9
+     40a:	ff 35 88 74 00 00    	push   0x7488
+     410:	e8 cb 42 00 00       	call   46e0 <printf>
+    exit();
+     415:	e8 49 41 00 00       	call   4563 <exit>
+     41a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000420 <opentest>:
+{
+     420:	55                   	push   %ebp
+     421:	89 e5                	mov    %esp,%ebp
+     423:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+     426:	68 1a 4e 00 00       	push   $0x4e1a
+     42b:	ff 35 88 74 00 00    	push   0x7488
+     431:	e8 aa 42 00 00       	call   46e0 <printf>
+  fd = open("echo", 0);
+     436:	58                   	pop    %eax
+     437:	5a                   	pop    %edx
+     438:	6a 00                	push   $0x0
+     43a:	68 25 4e 00 00       	push   $0x4e25
+     43f:	e8 5f 41 00 00       	call   45a3 <open>
+  if(fd < 0){
+     444:	83 c4 10             	add    $0x10,%esp
+     447:	85 c0                	test   %eax,%eax
+     449:	78 36                	js     481 <opentest+0x61>
+  close(fd);
+     44b:	83 ec 0c             	sub    $0xc,%esp
+     44e:	50                   	push   %eax
+     44f:	e8 37 41 00 00       	call   458b <close>
+  fd = open("doesnotexist", 0);
+     454:	5a                   	pop    %edx
+     455:	59                   	pop    %ecx
+     456:	6a 00                	push   $0x0
+     458:	68 3d 4e 00 00       	push   $0x4e3d
+     45d:	e8 41 41 00 00       	call   45a3 <open>
+  if(fd >= 0){
+     462:	83 c4 10             	add    $0x10,%esp
+     465:	85 c0                	test   %eax,%eax
+     467:	79 2f                	jns    498 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+     469:	83 ec 08             	sub    $0x8,%esp
+     46c:	68 68 4e 00 00       	push   $0x4e68
+     471:	ff 35 88 74 00 00    	push   0x7488
+     477:	e8 64 42 00 00       	call   46e0 <printf>
+}
+     47c:	83 c4 10             	add    $0x10,%esp
+     47f:	c9                   	leave
+     480:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+     481:	50                   	push   %eax
+     482:	50                   	push   %eax
+     483:	68 2a 4e 00 00       	push   $0x4e2a
+     488:	ff 35 88 74 00 00    	push   0x7488
+     48e:	e8 4d 42 00 00       	call   46e0 <printf>
+    exit();
+     493:	e8 cb 40 00 00       	call   4563 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+     498:	50                   	push   %eax
+     499:	50                   	push   %eax
+     49a:	68 4a 4e 00 00       	push   $0x4e4a
+     49f:	ff 35 88 74 00 00    	push   0x7488
+     4a5:	e8 36 42 00 00       	call   46e0 <printf>
+    exit();
+     4aa:	e8 b4 40 00 00       	call   4563 <exit>
+     4af:	90                   	nop
+
+000004b0 <writetest>:
+{
+     4b0:	55                   	push   %ebp
+     4b1:	89 e5                	mov    %esp,%ebp
+     4b3:	56                   	push   %esi
+     4b4:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     4b5:	83 ec 08             	sub    $0x8,%esp
+     4b8:	68 76 4e 00 00       	push   $0x4e76
+     4bd:	ff 35 88 74 00 00    	push   0x7488
+     4c3:	e8 18 42 00 00       	call   46e0 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     4c8:	58                   	pop    %eax
+     4c9:	5a                   	pop    %edx
+     4ca:	68 02 02 00 00       	push   $0x202
+     4cf:	68 87 4e 00 00       	push   $0x4e87
+     4d4:	e8 ca 40 00 00       	call   45a3 <open>
+  if(fd >= 0){
+     4d9:	83 c4 10             	add    $0x10,%esp
+     4dc:	85 c0                	test   %eax,%eax
+     4de:	0f 88 88 01 00 00    	js     66c <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     4e4:	83 ec 08             	sub    $0x8,%esp
+     4e7:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     4e9:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     4eb:	68 8d 4e 00 00       	push   $0x4e8d
+     4f0:	ff 35 88 74 00 00    	push   0x7488
+     4f6:	e8 e5 41 00 00       	call   46e0 <printf>
+     4fb:	83 c4 10             	add    $0x10,%esp
+     4fe:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     500:	83 ec 04             	sub    $0x4,%esp
+     503:	6a 0a                	push   $0xa
+     505:	68 c4 4e 00 00       	push   $0x4ec4
+     50a:	56                   	push   %esi
+     50b:	e8 73 40 00 00       	call   4583 <write>
+     510:	83 c4 10             	add    $0x10,%esp
+     513:	83 f8 0a             	cmp    $0xa,%eax
+     516:	0f 85 d9 00 00 00    	jne    5f5 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     51c:	83 ec 04             	sub    $0x4,%esp
+     51f:	6a 0a                	push   $0xa
+     521:	68 cf 4e 00 00       	push   $0x4ecf
+     526:	56                   	push   %esi
+     527:	e8 57 40 00 00       	call   4583 <write>
+     52c:	83 c4 10             	add    $0x10,%esp
+     52f:	83 f8 0a             	cmp    $0xa,%eax
+     532:	0f 85 d6 00 00 00    	jne    60e <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     538:	83 c3 01             	add    $0x1,%ebx
+     53b:	83 fb 64             	cmp    $0x64,%ebx
+     53e:	75 c0                	jne    500 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     540:	83 ec 08             	sub    $0x8,%esp
+     543:	68 da 4e 00 00       	push   $0x4eda
+     548:	ff 35 88 74 00 00    	push   0x7488
+     54e:	e8 8d 41 00 00       	call   46e0 <printf>
+  close(fd);
+     553:	89 34 24             	mov    %esi,(%esp)
+     556:	e8 30 40 00 00       	call   458b <close>
+  fd = open("small", O_RDONLY);
+     55b:	5b                   	pop    %ebx
+     55c:	5e                   	pop    %esi
+     55d:	6a 00                	push   $0x0
+     55f:	68 87 4e 00 00       	push   $0x4e87
+     564:	e8 3a 40 00 00       	call   45a3 <open>
+  if(fd >= 0){
+     569:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     56c:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     56e:	85 c0                	test   %eax,%eax
+     570:	0f 88 b1 00 00 00    	js     627 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     576:	83 ec 08             	sub    $0x8,%esp
+     579:	68 e5 4e 00 00       	push   $0x4ee5
+     57e:	ff 35 88 74 00 00    	push   0x7488
+     584:	e8 57 41 00 00       	call   46e0 <printf>
+  i = read(fd, buf, 2000);
+     589:	83 c4 0c             	add    $0xc,%esp
+     58c:	68 d0 07 00 00       	push   $0x7d0
+     591:	68 c0 9b 00 00       	push   $0x9bc0
+     596:	53                   	push   %ebx
+     597:	e8 df 3f 00 00       	call   457b <read>
+  if(i == 2000){
+     59c:	83 c4 10             	add    $0x10,%esp
+     59f:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     5a4:	0f 85 94 00 00 00    	jne    63e <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     5aa:	83 ec 08             	sub    $0x8,%esp
+     5ad:	68 19 4f 00 00       	push   $0x4f19
+     5b2:	ff 35 88 74 00 00    	push   0x7488
+     5b8:	e8 23 41 00 00       	call   46e0 <printf>
+  close(fd);
+     5bd:	89 1c 24             	mov    %ebx,(%esp)
+     5c0:	e8 c6 3f 00 00       	call   458b <close>
+  if(unlink("small") < 0){
+     5c5:	c7 04 24 87 4e 00 00 	movl   $0x4e87,(%esp)
+     5cc:	e8 e2 3f 00 00       	call   45b3 <unlink>
+     5d1:	83 c4 10             	add    $0x10,%esp
+     5d4:	85 c0                	test   %eax,%eax
+     5d6:	78 7d                	js     655 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     5d8:	83 ec 08             	sub    $0x8,%esp
+     5db:	68 41 4f 00 00       	push   $0x4f41
+     5e0:	ff 35 88 74 00 00    	push   0x7488
+     5e6:	e8 f5 40 00 00       	call   46e0 <printf>
+}
+     5eb:	83 c4 10             	add    $0x10,%esp
+     5ee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     5f1:	5b                   	pop    %ebx
+     5f2:	5e                   	pop    %esi
+     5f3:	5d                   	pop    %ebp
+     5f4:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     5f5:	83 ec 04             	sub    $0x4,%esp
+     5f8:	53                   	push   %ebx
+     5f9:	68 2c 60 00 00       	push   $0x602c
+     5fe:	ff 35 88 74 00 00    	push   0x7488
+     604:	e8 d7 40 00 00       	call   46e0 <printf>
+      exit();
+     609:	e8 55 3f 00 00       	call   4563 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     60e:	83 ec 04             	sub    $0x4,%esp
+     611:	53                   	push   %ebx
+     612:	68 50 60 00 00       	push   $0x6050
+     617:	ff 35 88 74 00 00    	push   0x7488
+     61d:	e8 be 40 00 00       	call   46e0 <printf>
+      exit();
+     622:	e8 3c 3f 00 00       	call   4563 <exit>
+    printf(stdout, "error: open small failed!\n");
+     627:	51                   	push   %ecx
+     628:	51                   	push   %ecx
+     629:	68 fe 4e 00 00       	push   $0x4efe
+     62e:	ff 35 88 74 00 00    	push   0x7488
+     634:	e8 a7 40 00 00       	call   46e0 <printf>
+    exit();
+     639:	e8 25 3f 00 00       	call   4563 <exit>
+    printf(stdout, "read failed\n");
+     63e:	52                   	push   %edx
+     63f:	52                   	push   %edx
+     640:	68 56 53 00 00       	push   $0x5356
+     645:	ff 35 88 74 00 00    	push   0x7488
+     64b:	e8 90 40 00 00       	call   46e0 <printf>
+    exit();
+     650:	e8 0e 3f 00 00       	call   4563 <exit>
+    printf(stdout, "unlink small failed\n");
+     655:	50                   	push   %eax
+     656:	50                   	push   %eax
+     657:	68 2c 4f 00 00       	push   $0x4f2c
+     65c:	ff 35 88 74 00 00    	push   0x7488
+     662:	e8 79 40 00 00       	call   46e0 <printf>
+    exit();
+     667:	e8 f7 3e 00 00       	call   4563 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     66c:	50                   	push   %eax
+     66d:	50                   	push   %eax
+     66e:	68 a8 4e 00 00       	push   $0x4ea8
+     673:	ff 35 88 74 00 00    	push   0x7488
+     679:	e8 62 40 00 00       	call   46e0 <printf>
+    exit();
+     67e:	e8 e0 3e 00 00       	call   4563 <exit>
+     683:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     68a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000690 <writetest1>:
+{
+     690:	55                   	push   %ebp
+     691:	89 e5                	mov    %esp,%ebp
+     693:	56                   	push   %esi
+     694:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     695:	83 ec 08             	sub    $0x8,%esp
+     698:	68 55 4f 00 00       	push   $0x4f55
+     69d:	ff 35 88 74 00 00    	push   0x7488
+     6a3:	e8 38 40 00 00       	call   46e0 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     6a8:	58                   	pop    %eax
+     6a9:	5a                   	pop    %edx
+     6aa:	68 02 02 00 00       	push   $0x202
+     6af:	68 cf 4f 00 00       	push   $0x4fcf
+     6b4:	e8 ea 3e 00 00       	call   45a3 <open>
+  if(fd < 0){
+     6b9:	83 c4 10             	add    $0x10,%esp
+     6bc:	85 c0                	test   %eax,%eax
+     6be:	0f 88 5d 01 00 00    	js     821 <writetest1+0x191>
+     6c4:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < BIGBLOCKS; i++){
+     6c6:	31 db                	xor    %ebx,%ebx
+     6c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     6cf:	90                   	nop
+    if(write(fd, buf, 512) != 512){
+     6d0:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     6d3:	89 1d c0 9b 00 00    	mov    %ebx,0x9bc0
+    if(write(fd, buf, 512) != 512){
+     6d9:	68 00 02 00 00       	push   $0x200
+     6de:	68 c0 9b 00 00       	push   $0x9bc0
+     6e3:	56                   	push   %esi
+     6e4:	e8 9a 3e 00 00       	call   4583 <write>
+     6e9:	83 c4 10             	add    $0x10,%esp
+     6ec:	3d 00 02 00 00       	cmp    $0x200,%eax
+     6f1:	0f 85 b3 00 00 00    	jne    7aa <writetest1+0x11a>
+  for(i = 0; i < BIGBLOCKS; i++){
+     6f7:	83 c3 01             	add    $0x1,%ebx
+     6fa:	81 fb 98 20 00 00    	cmp    $0x2098,%ebx
+     700:	75 ce                	jne    6d0 <writetest1+0x40>
+  close(fd);
+     702:	83 ec 0c             	sub    $0xc,%esp
+     705:	56                   	push   %esi
+     706:	e8 80 3e 00 00       	call   458b <close>
+  fd = open("big", O_RDONLY);
+     70b:	5b                   	pop    %ebx
+     70c:	5e                   	pop    %esi
+     70d:	6a 00                	push   $0x0
+     70f:	68 cf 4f 00 00       	push   $0x4fcf
+     714:	e8 8a 3e 00 00       	call   45a3 <open>
+  if(fd < 0){
+     719:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     71c:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     71e:	85 c0                	test   %eax,%eax
+     720:	0f 88 e4 00 00 00    	js     80a <writetest1+0x17a>
+  n = 0;
+     726:	31 f6                	xor    %esi,%esi
+     728:	eb 1d                	jmp    747 <writetest1+0xb7>
+     72a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != 512){
+     730:	3d 00 02 00 00       	cmp    $0x200,%eax
+     735:	0f 85 9f 00 00 00    	jne    7da <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     73b:	a1 c0 9b 00 00       	mov    0x9bc0,%eax
+     740:	39 f0                	cmp    %esi,%eax
+     742:	75 7f                	jne    7c3 <writetest1+0x133>
+    n++;
+     744:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, 512);
+     747:	83 ec 04             	sub    $0x4,%esp
+     74a:	68 00 02 00 00       	push   $0x200
+     74f:	68 c0 9b 00 00       	push   $0x9bc0
+     754:	53                   	push   %ebx
+     755:	e8 21 3e 00 00       	call   457b <read>
+    if(i == 0){
+     75a:	83 c4 10             	add    $0x10,%esp
+     75d:	85 c0                	test   %eax,%eax
+     75f:	75 cf                	jne    730 <writetest1+0xa0>
+      if(n != BIGBLOCKS){
+     761:	81 fe 98 20 00 00    	cmp    $0x2098,%esi
+     767:	0f 85 86 00 00 00    	jne    7f3 <writetest1+0x163>
+  close(fd);
+     76d:	83 ec 0c             	sub    $0xc,%esp
+     770:	53                   	push   %ebx
+     771:	e8 15 3e 00 00       	call   458b <close>
+  if(unlink("big") < 0){
+     776:	c7 04 24 cf 4f 00 00 	movl   $0x4fcf,(%esp)
+     77d:	e8 31 3e 00 00       	call   45b3 <unlink>
+     782:	83 c4 10             	add    $0x10,%esp
+     785:	85 c0                	test   %eax,%eax
+     787:	0f 88 ab 00 00 00    	js     838 <writetest1+0x1a8>
+  printf(stdout, "big files ok\n");
+     78d:	83 ec 08             	sub    $0x8,%esp
+     790:	68 f6 4f 00 00       	push   $0x4ff6
+     795:	ff 35 88 74 00 00    	push   0x7488
+     79b:	e8 40 3f 00 00       	call   46e0 <printf>
+}
+     7a0:	83 c4 10             	add    $0x10,%esp
+     7a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     7a6:	5b                   	pop    %ebx
+     7a7:	5e                   	pop    %esi
+     7a8:	5d                   	pop    %ebp
+     7a9:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     7aa:	83 ec 04             	sub    $0x4,%esp
+     7ad:	53                   	push   %ebx
+     7ae:	68 7f 4f 00 00       	push   $0x4f7f
+     7b3:	ff 35 88 74 00 00    	push   0x7488
+     7b9:	e8 22 3f 00 00       	call   46e0 <printf>
+      exit();
+     7be:	e8 a0 3d 00 00       	call   4563 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     7c3:	50                   	push   %eax
+     7c4:	56                   	push   %esi
+     7c5:	68 74 60 00 00       	push   $0x6074
+     7ca:	ff 35 88 74 00 00    	push   0x7488
+     7d0:	e8 0b 3f 00 00       	call   46e0 <printf>
+      exit();
+     7d5:	e8 89 3d 00 00       	call   4563 <exit>
+      printf(stdout, "read failed %d\n", i);
+     7da:	83 ec 04             	sub    $0x4,%esp
+     7dd:	50                   	push   %eax
+     7de:	68 d3 4f 00 00       	push   $0x4fd3
+     7e3:	ff 35 88 74 00 00    	push   0x7488
+     7e9:	e8 f2 3e 00 00       	call   46e0 <printf>
+      exit();
+     7ee:	e8 70 3d 00 00       	call   4563 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     7f3:	52                   	push   %edx
+     7f4:	56                   	push   %esi
+     7f5:	68 b6 4f 00 00       	push   $0x4fb6
+     7fa:	ff 35 88 74 00 00    	push   0x7488
+     800:	e8 db 3e 00 00       	call   46e0 <printf>
+        exit();
+     805:	e8 59 3d 00 00       	call   4563 <exit>
+    printf(stdout, "error: open big failed!\n");
+     80a:	51                   	push   %ecx
+     80b:	51                   	push   %ecx
+     80c:	68 9d 4f 00 00       	push   $0x4f9d
+     811:	ff 35 88 74 00 00    	push   0x7488
+     817:	e8 c4 3e 00 00       	call   46e0 <printf>
+    exit();
+     81c:	e8 42 3d 00 00       	call   4563 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     821:	50                   	push   %eax
+     822:	50                   	push   %eax
+     823:	68 65 4f 00 00       	push   $0x4f65
+     828:	ff 35 88 74 00 00    	push   0x7488
+     82e:	e8 ad 3e 00 00       	call   46e0 <printf>
+    exit();
+     833:	e8 2b 3d 00 00       	call   4563 <exit>
+    printf(stdout, "unlink big failed\n");
+     838:	50                   	push   %eax
+     839:	50                   	push   %eax
+     83a:	68 e3 4f 00 00       	push   $0x4fe3
+     83f:	ff 35 88 74 00 00    	push   0x7488
+     845:	e8 96 3e 00 00       	call   46e0 <printf>
+    exit();
+     84a:	e8 14 3d 00 00       	call   4563 <exit>
+     84f:	90                   	nop
+
+00000850 <createtest>:
+{
+     850:	55                   	push   %ebp
+     851:	89 e5                	mov    %esp,%ebp
+     853:	53                   	push   %ebx
+  name[2] = '\0';
+     854:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     859:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     85c:	68 94 60 00 00       	push   $0x6094
+     861:	ff 35 88 74 00 00    	push   0x7488
+     867:	e8 74 3e 00 00       	call   46e0 <printf>
+  name[0] = 'a';
+     86c:	c6 05 b0 9b 00 00 61 	movb   $0x61,0x9bb0
+  name[2] = '\0';
+     873:	83 c4 10             	add    $0x10,%esp
+     876:	c6 05 b2 9b 00 00 00 	movb   $0x0,0x9bb2
+  for(i = 0; i < 52; i++){
+     87d:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     880:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     883:	88 1d b1 9b 00 00    	mov    %bl,0x9bb1
+  for(i = 0; i < 52; i++){
+     889:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     88c:	68 02 02 00 00       	push   $0x202
+     891:	68 b0 9b 00 00       	push   $0x9bb0
+     896:	e8 08 3d 00 00       	call   45a3 <open>
+    close(fd);
+     89b:	89 04 24             	mov    %eax,(%esp)
+     89e:	e8 e8 3c 00 00       	call   458b <close>
+  for(i = 0; i < 52; i++){
+     8a3:	83 c4 10             	add    $0x10,%esp
+     8a6:	80 fb 64             	cmp    $0x64,%bl
+     8a9:	75 d5                	jne    880 <createtest+0x30>
+  name[0] = 'a';
+     8ab:	c6 05 b0 9b 00 00 61 	movb   $0x61,0x9bb0
+  name[2] = '\0';
+     8b2:	bb 30 00 00 00       	mov    $0x30,%ebx
+     8b7:	c6 05 b2 9b 00 00 00 	movb   $0x0,0x9bb2
+  for(i = 0; i < 52; i++){
+     8be:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     8c0:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     8c3:	88 1d b1 9b 00 00    	mov    %bl,0x9bb1
+  for(i = 0; i < 52; i++){
+     8c9:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     8cc:	68 b0 9b 00 00       	push   $0x9bb0
+     8d1:	e8 dd 3c 00 00       	call   45b3 <unlink>
+  for(i = 0; i < 52; i++){
+     8d6:	83 c4 10             	add    $0x10,%esp
+     8d9:	80 fb 64             	cmp    $0x64,%bl
+     8dc:	75 e2                	jne    8c0 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     8de:	83 ec 08             	sub    $0x8,%esp
+     8e1:	68 bc 60 00 00       	push   $0x60bc
+     8e6:	ff 35 88 74 00 00    	push   0x7488
+     8ec:	e8 ef 3d 00 00       	call   46e0 <printf>
+}
+     8f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     8f4:	83 c4 10             	add    $0x10,%esp
+     8f7:	c9                   	leave
+     8f8:	c3                   	ret
+     8f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000900 <dirtest>:
+{
+     900:	55                   	push   %ebp
+     901:	89 e5                	mov    %esp,%ebp
+     903:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+     906:	68 04 50 00 00       	push   $0x5004
+     90b:	ff 35 88 74 00 00    	push   0x7488
+     911:	e8 ca 3d 00 00       	call   46e0 <printf>
+  if(mkdir("dir0") < 0){
+     916:	c7 04 24 10 50 00 00 	movl   $0x5010,(%esp)
+     91d:	e8 a9 3c 00 00       	call   45cb <mkdir>
+     922:	83 c4 10             	add    $0x10,%esp
+     925:	85 c0                	test   %eax,%eax
+     927:	78 58                	js     981 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+     929:	83 ec 0c             	sub    $0xc,%esp
+     92c:	68 10 50 00 00       	push   $0x5010
+     931:	e8 9d 3c 00 00       	call   45d3 <chdir>
+     936:	83 c4 10             	add    $0x10,%esp
+     939:	85 c0                	test   %eax,%eax
+     93b:	0f 88 85 00 00 00    	js     9c6 <dirtest+0xc6>
+  if(chdir("..") < 0){
+     941:	83 ec 0c             	sub    $0xc,%esp
+     944:	68 c6 56 00 00       	push   $0x56c6
+     949:	e8 85 3c 00 00       	call   45d3 <chdir>
+     94e:	83 c4 10             	add    $0x10,%esp
+     951:	85 c0                	test   %eax,%eax
+     953:	78 5a                	js     9af <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+     955:	83 ec 0c             	sub    $0xc,%esp
+     958:	68 10 50 00 00       	push   $0x5010
+     95d:	e8 51 3c 00 00       	call   45b3 <unlink>
+     962:	83 c4 10             	add    $0x10,%esp
+     965:	85 c0                	test   %eax,%eax
+     967:	78 2f                	js     998 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+     969:	83 ec 08             	sub    $0x8,%esp
+     96c:	68 4d 50 00 00       	push   $0x504d
+     971:	ff 35 88 74 00 00    	push   0x7488
+     977:	e8 64 3d 00 00       	call   46e0 <printf>
+}
+     97c:	83 c4 10             	add    $0x10,%esp
+     97f:	c9                   	leave
+     980:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+     981:	50                   	push   %eax
+     982:	50                   	push   %eax
+     983:	68 40 4d 00 00       	push   $0x4d40
+     988:	ff 35 88 74 00 00    	push   0x7488
+     98e:	e8 4d 3d 00 00       	call   46e0 <printf>
+    exit();
+     993:	e8 cb 3b 00 00       	call   4563 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+     998:	50                   	push   %eax
+     999:	50                   	push   %eax
+     99a:	68 39 50 00 00       	push   $0x5039
+     99f:	ff 35 88 74 00 00    	push   0x7488
+     9a5:	e8 36 3d 00 00       	call   46e0 <printf>
+    exit();
+     9aa:	e8 b4 3b 00 00       	call   4563 <exit>
+    printf(stdout, "chdir .. failed\n");
+     9af:	52                   	push   %edx
+     9b0:	52                   	push   %edx
+     9b1:	68 28 50 00 00       	push   $0x5028
+     9b6:	ff 35 88 74 00 00    	push   0x7488
+     9bc:	e8 1f 3d 00 00       	call   46e0 <printf>
+    exit();
+     9c1:	e8 9d 3b 00 00       	call   4563 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+     9c6:	51                   	push   %ecx
+     9c7:	51                   	push   %ecx
+     9c8:	68 15 50 00 00       	push   $0x5015
+     9cd:	ff 35 88 74 00 00    	push   0x7488
+     9d3:	e8 08 3d 00 00       	call   46e0 <printf>
+    exit();
+     9d8:	e8 86 3b 00 00       	call   4563 <exit>
+     9dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009e0 <exectest>:
+{
+     9e0:	55                   	push   %ebp
+     9e1:	89 e5                	mov    %esp,%ebp
+     9e3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+     9e6:	68 5c 50 00 00       	push   $0x505c
+     9eb:	ff 35 88 74 00 00    	push   0x7488
+     9f1:	e8 ea 3c 00 00       	call   46e0 <printf>
+  if(exec("echo", echoargv) < 0){
+     9f6:	5a                   	pop    %edx
+     9f7:	59                   	pop    %ecx
+     9f8:	68 8c 74 00 00       	push   $0x748c
+     9fd:	68 25 4e 00 00       	push   $0x4e25
+     a02:	e8 94 3b 00 00       	call   459b <exec>
+     a07:	83 c4 10             	add    $0x10,%esp
+     a0a:	85 c0                	test   %eax,%eax
+     a0c:	78 02                	js     a10 <exectest+0x30>
+}
+     a0e:	c9                   	leave
+     a0f:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+     a10:	50                   	push   %eax
+     a11:	50                   	push   %eax
+     a12:	68 67 50 00 00       	push   $0x5067
+     a17:	ff 35 88 74 00 00    	push   0x7488
+     a1d:	e8 be 3c 00 00       	call   46e0 <printf>
+    exit();
+     a22:	e8 3c 3b 00 00       	call   4563 <exit>
+     a27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a2e:	66 90                	xchg   %ax,%ax
+
+00000a30 <pipe1>:
+{
+     a30:	55                   	push   %ebp
+     a31:	89 e5                	mov    %esp,%ebp
+     a33:	57                   	push   %edi
+     a34:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     a35:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     a38:	53                   	push   %ebx
+     a39:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     a3c:	50                   	push   %eax
+     a3d:	e8 31 3b 00 00       	call   4573 <pipe>
+     a42:	83 c4 10             	add    $0x10,%esp
+     a45:	85 c0                	test   %eax,%eax
+     a47:	0f 85 41 01 00 00    	jne    b8e <pipe1+0x15e>
+     a4d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+     a4f:	e8 07 3b 00 00       	call   455b <fork>
+  if(pid == 0){
+     a54:	85 c0                	test   %eax,%eax
+     a56:	0f 84 92 00 00 00    	je     aee <pipe1+0xbe>
+  } else if(pid > 0){
+     a5c:	0f 8e 3f 01 00 00    	jle    ba1 <pipe1+0x171>
+    close(fds[1]);
+     a62:	83 ec 0c             	sub    $0xc,%esp
+     a65:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+     a68:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+     a6a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+     a6f:	e8 17 3b 00 00       	call   458b <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+     a74:	83 c4 10             	add    $0x10,%esp
+     a77:	83 ec 04             	sub    $0x4,%esp
+     a7a:	57                   	push   %edi
+     a7b:	68 c0 9b 00 00       	push   $0x9bc0
+     a80:	ff 75 e0             	push   -0x20(%ebp)
+     a83:	e8 f3 3a 00 00       	call   457b <read>
+     a88:	83 c4 10             	add    $0x10,%esp
+     a8b:	89 c1                	mov    %eax,%ecx
+     a8d:	85 c0                	test   %eax,%eax
+     a8f:	0f 8e b8 00 00 00    	jle    b4d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     a95:	89 f0                	mov    %esi,%eax
+     a97:	32 05 c0 9b 00 00    	xor    0x9bc0,%al
+     a9d:	0f b6 c0             	movzbl %al,%eax
+     aa0:	85 c0                	test   %eax,%eax
+     aa2:	75 30                	jne    ad4 <pipe1+0xa4>
+     aa4:	83 c6 01             	add    $0x1,%esi
+     aa7:	eb 0f                	jmp    ab8 <pipe1+0x88>
+     aa9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ab0:	38 90 c0 9b 00 00    	cmp    %dl,0x9bc0(%eax)
+     ab6:	75 1c                	jne    ad4 <pipe1+0xa4>
+     ab8:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+     abb:	83 c0 01             	add    $0x1,%eax
+     abe:	39 c1                	cmp    %eax,%ecx
+     ac0:	75 ee                	jne    ab0 <pipe1+0x80>
+      cc = cc * 2;
+     ac2:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+     ac4:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+     ac9:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+     acb:	89 d6                	mov    %edx,%esi
+     acd:	39 c7                	cmp    %eax,%edi
+     acf:	0f 4f f8             	cmovg  %eax,%edi
+     ad2:	eb a3                	jmp    a77 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+     ad4:	83 ec 08             	sub    $0x8,%esp
+     ad7:	68 96 50 00 00       	push   $0x5096
+     adc:	6a 01                	push   $0x1
+     ade:	e8 fd 3b 00 00       	call   46e0 <printf>
+     ae3:	83 c4 10             	add    $0x10,%esp
+}
+     ae6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     ae9:	5b                   	pop    %ebx
+     aea:	5e                   	pop    %esi
+     aeb:	5f                   	pop    %edi
+     aec:	5d                   	pop    %ebp
+     aed:	c3                   	ret
+    close(fds[0]);
+     aee:	83 ec 0c             	sub    $0xc,%esp
+     af1:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+     af4:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+     af6:	e8 90 3a 00 00       	call   458b <close>
+     afb:	83 c4 10             	add    $0x10,%esp
+     afe:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+     b00:	31 c0                	xor    %eax,%eax
+     b02:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+     b08:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+     b0b:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+     b0e:	88 90 bf 9b 00 00    	mov    %dl,0x9bbf(%eax)
+      for(i = 0; i < 1033; i++)
+     b14:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b19:	75 ed                	jne    b08 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+     b1b:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+     b1e:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+     b24:	68 09 04 00 00       	push   $0x409
+     b29:	68 c0 9b 00 00       	push   $0x9bc0
+     b2e:	ff 75 e4             	push   -0x1c(%ebp)
+     b31:	e8 4d 3a 00 00       	call   4583 <write>
+     b36:	83 c4 10             	add    $0x10,%esp
+     b39:	3d 09 04 00 00       	cmp    $0x409,%eax
+     b3e:	75 74                	jne    bb4 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+     b40:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b46:	75 b8                	jne    b00 <pipe1+0xd0>
+    exit();
+     b48:	e8 16 3a 00 00       	call   4563 <exit>
+    if(total != 5 * 1033){
+     b4d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+     b53:	75 26                	jne    b7b <pipe1+0x14b>
+    close(fds[0]);
+     b55:	83 ec 0c             	sub    $0xc,%esp
+     b58:	ff 75 e0             	push   -0x20(%ebp)
+     b5b:	e8 2b 3a 00 00       	call   458b <close>
+    wait();
+     b60:	e8 06 3a 00 00       	call   456b <wait>
+  printf(1, "pipe1 ok\n");
+     b65:	5a                   	pop    %edx
+     b66:	59                   	pop    %ecx
+     b67:	68 bb 50 00 00       	push   $0x50bb
+     b6c:	6a 01                	push   $0x1
+     b6e:	e8 6d 3b 00 00       	call   46e0 <printf>
+     b73:	83 c4 10             	add    $0x10,%esp
+     b76:	e9 6b ff ff ff       	jmp    ae6 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     b7b:	56                   	push   %esi
+     b7c:	53                   	push   %ebx
+     b7d:	68 a4 50 00 00       	push   $0x50a4
+     b82:	6a 01                	push   $0x1
+     b84:	e8 57 3b 00 00       	call   46e0 <printf>
+      exit();
+     b89:	e8 d5 39 00 00       	call   4563 <exit>
+    printf(1, "pipe() failed\n");
+     b8e:	50                   	push   %eax
+     b8f:	50                   	push   %eax
+     b90:	68 79 50 00 00       	push   $0x5079
+     b95:	6a 01                	push   $0x1
+     b97:	e8 44 3b 00 00       	call   46e0 <printf>
+    exit();
+     b9c:	e8 c2 39 00 00       	call   4563 <exit>
+    printf(1, "fork() failed\n");
+     ba1:	50                   	push   %eax
+     ba2:	50                   	push   %eax
+     ba3:	68 c5 50 00 00       	push   $0x50c5
+     ba8:	6a 01                	push   $0x1
+     baa:	e8 31 3b 00 00       	call   46e0 <printf>
+    exit();
+     baf:	e8 af 39 00 00       	call   4563 <exit>
+        printf(1, "pipe1 oops 1\n");
+     bb4:	57                   	push   %edi
+     bb5:	57                   	push   %edi
+     bb6:	68 88 50 00 00       	push   $0x5088
+     bbb:	6a 01                	push   $0x1
+     bbd:	e8 1e 3b 00 00       	call   46e0 <printf>
+        exit();
+     bc2:	e8 9c 39 00 00       	call   4563 <exit>
+     bc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bce:	66 90                	xchg   %ax,%ax
+
+00000bd0 <pipeloan>:
+{
+     bd0:	55                   	push   %ebp
+     bd1:	89 e5                	mov    %esp,%ebp
+     bd3:	57                   	push   %edi
+     bd4:	56                   	push   %esi
+     bd5:	53                   	push   %ebx
+     bd6:	83 ec 38             	sub    $0x38,%esp
+  a = sbrk(0);
+     bd9:	6a 00                	push   $0x0
+     bdb:	e8 0b 3a 00 00       	call   45eb <sbrk>
+  sbrk(4096 - (uint)a % 4096);
+     be0:	ba 00 10 00 00       	mov    $0x1000,%edx
+     be5:	25 ff 0f 00 00       	and    $0xfff,%eax
+     bea:	29 c2                	sub    %eax,%edx
+     bec:	89 14 24             	mov    %edx,(%esp)
+     bef:	e8 f7 39 00 00       	call   45eb <sbrk>
+  a = sbrk(8*4096);
+     bf4:	c7 04 24 00 80 00 00 	movl   $0x8000,(%esp)
+     bfb:	e8 eb 39 00 00       	call   45eb <sbrk>
+  if(a == (char*)0xffffffff){
+     c00:	83 c4 10             	add    $0x10,%esp
+     c03:	83 f8 ff             	cmp    $0xffffffff,%eax
+     c06:	0f 84 b8 01 00 00    	je     dc4 <pipeloan+0x1f4>
+     c0c:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 4*4096; i++)
+     c0e:	31 c0                	xor    %eax,%eax
+    a[i] = i / 4096 + i;
+     c10:	89 c2                	mov    %eax,%edx
+     c12:	c1 fa 0c             	sar    $0xc,%edx
+     c15:	01 c2                	add    %eax,%edx
+     c17:	88 14 06             	mov    %dl,(%esi,%eax,1)
+  for(i = 0; i < 4*4096; i++)
+     c1a:	83 c0 01             	add    $0x1,%eax
+     c1d:	3d 00 40 00 00       	cmp    $0x4000,%eax
+     c22:	75 ec                	jne    c10 <pipeloan+0x40>
+  if(pipe(fds) != 0){
+     c24:	83 ec 0c             	sub    $0xc,%esp
+     c27:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     c2a:	50                   	push   %eax
+     c2b:	e8 43 39 00 00       	call   4573 <pipe>
+     c30:	83 c4 10             	add    $0x10,%esp
+     c33:	89 c3                	mov    %eax,%ebx
+     c35:	85 c0                	test   %eax,%eax
+     c37:	0f 85 61 01 00 00    	jne    d9e <pipeloan+0x1ce>
+  pid = fork();
+     c3d:	e8 19 39 00 00       	call   455b <fork>
+  if(pid < 0){
+     c42:	85 c0                	test   %eax,%eax
+     c44:	0f 88 41 01 00 00    	js     d8b <pipeloan+0x1bb>
+  if(pid == 0){
+     c4a:	0f 84 d4 00 00 00    	je     d24 <pipeloan+0x154>
+  b = a + 4*4096;
+     c50:	8d 86 00 40 00 00    	lea    0x4000(%esi),%eax
+  close(fds[1]);
+     c56:	83 ec 0c             	sub    $0xc,%esp
+  b = a + 4*4096;
+     c59:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     c5c:	89 c7                	mov    %eax,%edi
+  close(fds[1]);
+     c5e:	ff 75 e4             	push   -0x1c(%ebp)
+     c61:	e8 25 39 00 00       	call   458b <close>
+  total = read(fds[0], b, 4096);
+     c66:	83 c4 0c             	add    $0xc,%esp
+     c69:	68 00 10 00 00       	push   $0x1000
+     c6e:	57                   	push   %edi
+     c6f:	ff 75 e0             	push   -0x20(%ebp)
+     c72:	e8 04 39 00 00       	call   457b <read>
+  for(n = 100; total < 4*4096 && n > 0; total += n)
+     c77:	83 c4 10             	add    $0x10,%esp
+  total = read(fds[0], b, 4096);
+     c7a:	89 c7                	mov    %eax,%edi
+  for(n = 100; total < 4*4096 && n > 0; total += n)
+     c7c:	3d ff 3f 00 00       	cmp    $0x3fff,%eax
+     c81:	7e 09                	jle    c8c <pipeloan+0xbc>
+     c83:	eb 2a                	jmp    caf <pipeloan+0xdf>
+     c85:	8d 76 00             	lea    0x0(%esi),%esi
+     c88:	85 c0                	test   %eax,%eax
+     c8a:	7e 23                	jle    caf <pipeloan+0xdf>
+    n = read(fds[0], b + total, 1000);
+     c8c:	83 ec 04             	sub    $0x4,%esp
+     c8f:	68 e8 03 00 00       	push   $0x3e8
+     c94:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     c97:	01 f8                	add    %edi,%eax
+     c99:	50                   	push   %eax
+     c9a:	ff 75 e0             	push   -0x20(%ebp)
+     c9d:	e8 d9 38 00 00       	call   457b <read>
+  for(n = 100; total < 4*4096 && n > 0; total += n)
+     ca2:	83 c4 10             	add    $0x10,%esp
+     ca5:	01 c7                	add    %eax,%edi
+     ca7:	81 ff ff 3f 00 00    	cmp    $0x3fff,%edi
+     cad:	7e d9                	jle    c88 <pipeloan+0xb8>
+  if(total != 4*4096){
+     caf:	81 ff 00 40 00 00    	cmp    $0x4000,%edi
+     cb5:	0f 85 f6 00 00 00    	jne    db1 <pipeloan+0x1e1>
+     cbb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     cbf:	90                   	nop
+    if(b[i] != (char)(i / 4096 + i)){
+     cc0:	89 d8                	mov    %ebx,%eax
+     cc2:	c1 f8 0c             	sar    $0xc,%eax
+     cc5:	01 d8                	add    %ebx,%eax
+     cc7:	38 84 1e 00 40 00 00 	cmp    %al,0x4000(%esi,%ebx,1)
+     cce:	0f 85 a2 00 00 00    	jne    d76 <pipeloan+0x1a6>
+  for(i = 0; i < 4*4096; i++){
+     cd4:	83 c3 01             	add    $0x1,%ebx
+     cd7:	81 fb 00 40 00 00    	cmp    $0x4000,%ebx
+     cdd:	75 e1                	jne    cc0 <pipeloan+0xf0>
+  memset(b, 0, 4*4096);
+     cdf:	83 ec 04             	sub    $0x4,%esp
+     ce2:	68 00 40 00 00       	push   $0x4000
+     ce7:	6a 00                	push   $0x0
+     ce9:	ff 75 d4             	push   -0x2c(%ebp)
+     cec:	e8 ef 36 00 00       	call   43e0 <memset>
+  close(fds[0]);
+     cf1:	58                   	pop    %eax
+     cf2:	ff 75 e0             	push   -0x20(%ebp)
+     cf5:	e8 91 38 00 00       	call   458b <close>
+  wait();
+     cfa:	e8 6c 38 00 00       	call   456b <wait>
+  sbrk(-(b + 4*4096 - a));
+     cff:	c7 04 24 00 80 ff ff 	movl   $0xffff8000,(%esp)
+     d06:	e8 e0 38 00 00       	call   45eb <sbrk>
+  printf(1, "pipeloan ok\n");
+     d0b:	5a                   	pop    %edx
+     d0c:	59                   	pop    %ecx
+     d0d:	68 34 51 00 00       	push   $0x5134
+     d12:	6a 01                	push   $0x1
+     d14:	e8 c7 39 00 00       	call   46e0 <printf>
+}
+     d19:	83 c4 10             	add    $0x10,%esp
+     d1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     d1f:	5b                   	pop    %ebx
+     d20:	5e                   	pop    %esi
+     d21:	5f                   	pop    %edi
+     d22:	5d                   	pop    %ebp
+     d23:	c3                   	ret
+    close(fds[0]);
+     d24:	83 ec 0c             	sub    $0xc,%esp
+     d27:	ff 75 e0             	push   -0x20(%ebp)
+     d2a:	e8 5c 38 00 00       	call   458b <close>
+    if(write(fds[1], a, 4*4096) != 4*4096){
+     d2f:	83 c4 0c             	add    $0xc,%esp
+     d32:	68 00 40 00 00       	push   $0x4000
+     d37:	56                   	push   %esi
+     d38:	ff 75 e4             	push   -0x1c(%ebp)
+     d3b:	e8 43 38 00 00       	call   4583 <write>
+     d40:	83 c4 10             	add    $0x10,%esp
+     d43:	3d 00 40 00 00       	cmp    $0x4000,%eax
+     d48:	74 14                	je     d5e <pipeloan+0x18e>
+      printf(1, "pipeloan write failed\n");
+     d4a:	83 ec 08             	sub    $0x8,%esp
+     d4d:	68 ea 50 00 00       	push   $0x50ea
+     d52:	6a 01                	push   $0x1
+     d54:	e8 87 39 00 00       	call   46e0 <printf>
+      exit();
+     d59:	e8 05 38 00 00       	call   4563 <exit>
+    memset(a, 0xff, 4*4096);
+     d5e:	83 ec 04             	sub    $0x4,%esp
+     d61:	68 00 40 00 00       	push   $0x4000
+     d66:	68 ff 00 00 00       	push   $0xff
+     d6b:	56                   	push   %esi
+     d6c:	e8 6f 36 00 00       	call   43e0 <memset>
+    exit();
+     d71:	e8 ed 37 00 00       	call   4563 <exit>
+      printf(1, "pipeloan wrong data at %d\n", i);
+     d76:	83 ec 04             	sub    $0x4,%esp
+     d79:	53                   	push   %ebx
+     d7a:	68 19 51 00 00       	push   $0x5119
+     d7f:	6a 01                	push   $0x1
+     d81:	e8 5a 39 00 00       	call   46e0 <printf>
+      exit();
+     d86:	e8 d8 37 00 00       	call   4563 <exit>
+    printf(1, "fork() failed\n");
+     d8b:	56                   	push   %esi
+     d8c:	56                   	push   %esi
+     d8d:	68 c5 50 00 00       	push   $0x50c5
+     d92:	6a 01                	push   $0x1
+     d94:	e8 47 39 00 00       	call   46e0 <printf>
+    exit();
+     d99:	e8 c5 37 00 00       	call   4563 <exit>
+    printf(1, "pipe() failed\n");
+     d9e:	57                   	push   %edi
+     d9f:	57                   	push   %edi
+     da0:	68 79 50 00 00       	push   $0x5079
+     da5:	6a 01                	push   $0x1
+     da7:	e8 34 39 00 00       	call   46e0 <printf>
+    exit();
+     dac:	e8 b2 37 00 00       	call   4563 <exit>
+    printf(1, "pipeloan read total %d\n", total);
+     db1:	53                   	push   %ebx
+     db2:	57                   	push   %edi
+     db3:	68 01 51 00 00       	push   $0x5101
+     db8:	6a 01                	push   $0x1
+     dba:	e8 21 39 00 00       	call   46e0 <printf>
+    exit();
+     dbf:	e8 9f 37 00 00       	call   4563 <exit>
+    printf(1, "pipeloan sbrk failed\n");
+     dc4:	50                   	push   %eax
+     dc5:	50                   	push   %eax
+     dc6:	68 d4 50 00 00       	push   $0x50d4
+     dcb:	6a 01                	push   $0x1
+     dcd:	e8 0e 39 00 00       	call   46e0 <printf>
+    exit();
+     dd2:	e8 8c 37 00 00       	call   4563 <exit>
+     dd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     dde:	66 90                	xchg   %ax,%ax
+
+00000de0 <pipesizetest>:
+{
+     de0:	55                   	push   %ebp
+     de1:	89 e5                	mov    %esp,%ebp
+     de3:	57                   	push   %edi
+     de4:	56                   	push   %esi
+  if(pipe(fds) != 0){
+     de5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+     de8:	53                   	push   %ebx
+     de9:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+     dec:	50                   	push   %eax
+     ded:	e8 81 37 00 00       	call   4573 <pipe>
+     df2:	83 c4 10             	add    $0x10,%esp
+     df5:	85 c0                	test   %eax,%eax
+     df7:	0f 85 a5 01 00 00    	jne    fa2 <pipesizetest+0x1c2>
+  if(pipesize(fds[0], 0) <= 0 || pipesize(0, 0) != -1){
+     dfd:	83 ec 08             	sub    $0x8,%esp
+     e00:	89 c6                	mov    %eax,%esi
+     e02:	6a 00                	push   $0x0
+     e04:	ff 75 e0             	push   -0x20(%ebp)
+     e07:	e8 0f 38 00 00       	call   461b <pipesize>
+     e0c:	83 c4 10             	add    $0x10,%esp
+     e0f:	85 c0                	test   %eax,%eax
+     e11:	0f 8e 78 01 00 00    	jle    f8f <pipesizetest+0x1af>
+     e17:	83 ec 08             	sub    $0x8,%esp
+     e1a:	6a 00                	push   $0x0
+     e1c:	6a 00                	push   $0x0
+     e1e:	e8 f8 37 00 00       	call   461b <pipesize>
+     e23:	83 c4 10             	add    $0x10,%esp
+     e26:	83 f8 ff             	cmp    $0xffffffff,%eax
+     e29:	0f 85 60 01 00 00    	jne    f8f <pipesizetest+0x1af>
+  if((cap = pipesize(fds[1], 6000)) < 6000){
+     e2f:	83 ec 08             	sub    $0x8,%esp
+     e32:	68 70 17 00 00       	push   $0x1770
+     e37:	ff 75 e4             	push   -0x1c(%ebp)
+     e3a:	e8 dc 37 00 00       	call   461b <pipesize>
+     e3f:	83 c4 10             	add    $0x10,%esp
+     e42:	89 c1                	mov    %eax,%ecx
+     e44:	3d 6f 17 00 00       	cmp    $0x176f,%eax
+     e49:	0f 8e 79 01 00 00    	jle    fc8 <pipesizetest+0x1e8>
+  for(i = 0; i < cap; i++)
+     e4f:	31 db                	xor    %ebx,%ebx
+     e51:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    buf[i] = i % 251;
+     e58:	b8 bf bf 8c 82       	mov    $0x828cbfbf,%eax
+     e5d:	89 df                	mov    %ebx,%edi
+     e5f:	f7 e3                	mul    %ebx
+     e61:	89 d8                	mov    %ebx,%eax
+  for(i = 0; i < cap; i++)
+     e63:	83 c3 01             	add    $0x1,%ebx
+    buf[i] = i % 251;
+     e66:	c1 ea 07             	shr    $0x7,%edx
+     e69:	69 d2 fb 00 00 00    	imul   $0xfb,%edx,%edx
+     e6f:	29 d0                	sub    %edx,%eax
+     e71:	88 83 bf 9b 00 00    	mov    %al,0x9bbf(%ebx)
+  for(i = 0; i < cap; i++)
+     e77:	39 d9                	cmp    %ebx,%ecx
+     e79:	75 dd                	jne    e58 <pipesizetest+0x78>
+  if(write(fds[1], buf+1, cap-1) != cap-1 || write(fds[1], buf, 1) != 1){
+     e7b:	83 ec 04             	sub    $0x4,%esp
+     e7e:	57                   	push   %edi
+     e7f:	68 c1 9b 00 00       	push   $0x9bc1
+     e84:	ff 75 e4             	push   -0x1c(%ebp)
+     e87:	e8 f7 36 00 00       	call   4583 <write>
+     e8c:	83 c4 10             	add    $0x10,%esp
+     e8f:	39 f8                	cmp    %edi,%eax
+     e91:	0f 85 e5 00 00 00    	jne    f7c <pipesizetest+0x19c>
+     e97:	83 ec 04             	sub    $0x4,%esp
+     e9a:	6a 01                	push   $0x1
+     e9c:	68 c0 9b 00 00       	push   $0x9bc0
+     ea1:	ff 75 e4             	push   -0x1c(%ebp)
+     ea4:	e8 da 36 00 00       	call   4583 <write>
+     ea9:	83 c4 10             	add    $0x10,%esp
+     eac:	83 f8 01             	cmp    $0x1,%eax
+     eaf:	0f 85 c7 00 00 00    	jne    f7c <pipesizetest+0x19c>
+  if(pipesize(fds[1], 10000) != -1){
+     eb5:	83 ec 08             	sub    $0x8,%esp
+     eb8:	68 10 27 00 00       	push   $0x2710
+     ebd:	ff 75 e4             	push   -0x1c(%ebp)
+     ec0:	e8 56 37 00 00       	call   461b <pipesize>
+     ec5:	83 c4 10             	add    $0x10,%esp
+     ec8:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ecb:	0f 85 e4 00 00 00    	jne    fb5 <pipesizetest+0x1d5>
+  close(fds[1]);
+     ed1:	83 ec 0c             	sub    $0xc,%esp
+     ed4:	ff 75 e4             	push   -0x1c(%ebp)
+     ed7:	e8 af 36 00 00       	call   458b <close>
+     edc:	83 c4 10             	add    $0x10,%esp
+     edf:	90                   	nop
+    buf[i] = 0;
+     ee0:	89 f0                	mov    %esi,%eax
+     ee2:	c6 86 c0 9b 00 00 00 	movb   $0x0,0x9bc0(%esi)
+  for(i = 0; i < cap; i++)
+     ee9:	83 c6 01             	add    $0x1,%esi
+     eec:	39 f8                	cmp    %edi,%eax
+     eee:	75 f0                	jne    ee0 <pipesizetest+0x100>
+  if(read(fds[0], buf, sizeof(buf)) != cap || buf[0] != 1 % 251 ||
+     ef0:	83 ec 04             	sub    $0x4,%esp
+     ef3:	68 00 20 00 00       	push   $0x2000
+     ef8:	68 c0 9b 00 00       	push   $0x9bc0
+     efd:	ff 75 e0             	push   -0x20(%ebp)
+     f00:	e8 76 36 00 00       	call   457b <read>
+     f05:	83 c4 10             	add    $0x10,%esp
+     f08:	39 d8                	cmp    %ebx,%eax
+     f0a:	75 5c                	jne    f68 <pipesizetest+0x188>
+     f0c:	80 3d c0 9b 00 00 01 	cmpb   $0x1,0x9bc0
+     f13:	75 53                	jne    f68 <pipesizetest+0x188>
+     buf[cap-2] != (char)((cap-1) % 251) || buf[cap-1] != 0){
+     f15:	b8 bf bf 8c 82       	mov    $0x828cbfbf,%eax
+     f1a:	f7 ef                	imul   %edi
+     f1c:	8d 04 3a             	lea    (%edx,%edi,1),%eax
+     f1f:	89 fa                	mov    %edi,%edx
+     f21:	c1 fa 1f             	sar    $0x1f,%edx
+     f24:	c1 f8 07             	sar    $0x7,%eax
+     f27:	29 d0                	sub    %edx,%eax
+     f29:	89 fa                	mov    %edi,%edx
+     f2b:	69 c0 fb 00 00 00    	imul   $0xfb,%eax,%eax
+     f31:	29 c2                	sub    %eax,%edx
+  if(read(fds[0], buf, sizeof(buf)) != cap || buf[0] != 1 % 251 ||
+     f33:	38 97 bf 9b 00 00    	cmp    %dl,0x9bbf(%edi)
+     f39:	75 2d                	jne    f68 <pipesizetest+0x188>
+     buf[cap-2] != (char)((cap-1) % 251) || buf[cap-1] != 0){
+     f3b:	80 bf c0 9b 00 00 00 	cmpb   $0x0,0x9bc0(%edi)
+     f42:	75 24                	jne    f68 <pipesizetest+0x188>
+  close(fds[0]);
+     f44:	83 ec 0c             	sub    $0xc,%esp
+     f47:	ff 75 e0             	push   -0x20(%ebp)
+     f4a:	e8 3c 36 00 00       	call   458b <close>
+  printf(1, "pipesize ok\n");
+     f4f:	58                   	pop    %eax
+     f50:	5a                   	pop    %edx
+     f51:	68 a3 51 00 00       	push   $0x51a3
+     f56:	6a 01                	push   $0x1
+     f58:	e8 83 37 00 00       	call   46e0 <printf>
+}
+     f5d:	83 c4 10             	add    $0x10,%esp
+     f60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     f63:	5b                   	pop    %ebx
+     f64:	5e                   	pop    %esi
+     f65:	5f                   	pop    %edi
+     f66:	5d                   	pop    %ebp
+     f67:	c3                   	ret
+    printf(1, "pipesize read back wrong data\n");
+     f68:	83 ec 08             	sub    $0x8,%esp
+     f6b:	68 e4 60 00 00       	push   $0x60e4
+     f70:	6a 01                	push   $0x1
+     f72:	e8 69 37 00 00       	call   46e0 <printf>
+    exit();
+     f77:	e8 e7 35 00 00       	call   4563 <exit>
+    printf(1, "pipesize write failed\n");
+     f7c:	53                   	push   %ebx
+     f7d:	53                   	push   %ebx
+     f7e:	68 6e 51 00 00       	push   $0x516e
+     f83:	6a 01                	push   $0x1
+     f85:	e8 56 37 00 00       	call   46e0 <printf>
+    exit();
+     f8a:	e8 d4 35 00 00       	call   4563 <exit>
+    printf(1, "pipesize query failed\n");
+     f8f:	57                   	push   %edi
+     f90:	57                   	push   %edi
+     f91:	68 41 51 00 00       	push   $0x5141
+     f96:	6a 01                	push   $0x1
+     f98:	e8 43 37 00 00       	call   46e0 <printf>
+    exit();
+     f9d:	e8 c1 35 00 00       	call   4563 <exit>
+    printf(1, "pipe() failed\n");
+     fa2:	50                   	push   %eax
+     fa3:	50                   	push   %eax
+     fa4:	68 79 50 00 00       	push   $0x5079
+     fa9:	6a 01                	push   $0x1
+     fab:	e8 30 37 00 00       	call   46e0 <printf>
+    exit();
+     fb0:	e8 ae 35 00 00       	call   4563 <exit>
+    printf(1, "pipesize resized a full pipe\n");
+     fb5:	51                   	push   %ecx
+     fb6:	51                   	push   %ecx
+     fb7:	68 85 51 00 00       	push   $0x5185
+     fbc:	6a 01                	push   $0x1
+     fbe:	e8 1d 37 00 00       	call   46e0 <printf>
+    exit();
+     fc3:	e8 9b 35 00 00       	call   4563 <exit>
+    printf(1, "pipesize 6000 failed\n");
+     fc8:	56                   	push   %esi
+     fc9:	56                   	push   %esi
+     fca:	68 58 51 00 00       	push   $0x5158
+     fcf:	6a 01                	push   $0x1
+     fd1:	e8 0a 37 00 00       	call   46e0 <printf>
+    exit();
+     fd6:	e8 88 35 00 00       	call   4563 <exit>
+     fdb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     fdf:	90                   	nop
+
+00000fe0 <uptimenstest>:
+{
+     fe0:	55                   	push   %ebp
+     fe1:	89 e5                	mov    %esp,%ebp
+     fe3:	56                   	push   %esi
+     fe4:	53                   	push   %ebx
+     fe5:	83 ec 18             	sub    $0x18,%esp
+  printf(stdout, "uptimens test\n");
+     fe8:	68 b0 51 00 00       	push   $0x51b0
+     fed:	ff 35 88 74 00 00    	push   0x7488
+     ff3:	e8 e8 36 00 00       	call   46e0 <printf>
+  if(uptimens(&t0) != 0 || uptimens(&t1) != 0 || t1 < t0){
+     ff8:	8d 45 e8             	lea    -0x18(%ebp),%eax
+     ffb:	89 04 24             	mov    %eax,(%esp)
+     ffe:	e8 20 36 00 00       	call   4623 <uptimens>
+    1003:	83 c4 10             	add    $0x10,%esp
+    1006:	85 c0                	test   %eax,%eax
+    1008:	75 7e                	jne    1088 <uptimenstest+0xa8>
+    100a:	83 ec 0c             	sub    $0xc,%esp
+    100d:	8d 75 f0             	lea    -0x10(%ebp),%esi
+    1010:	56                   	push   %esi
+    1011:	e8 0d 36 00 00       	call   4623 <uptimens>
+    1016:	83 c4 10             	add    $0x10,%esp
+    1019:	89 c3                	mov    %eax,%ebx
+    101b:	85 c0                	test   %eax,%eax
+    101d:	75 69                	jne    1088 <uptimenstest+0xa8>
+    101f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1022:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    1025:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1028:	1b 45 ec             	sbb    -0x14(%ebp),%eax
+    102b:	72 5b                	jb     1088 <uptimenstest+0xa8>
+  if(uptimens((uint64*)0xffffffff) != -1){
+    102d:	83 ec 0c             	sub    $0xc,%esp
+    1030:	6a ff                	push   $0xffffffff
+    1032:	e8 ec 35 00 00       	call   4623 <uptimens>
+    1037:	83 c4 10             	add    $0x10,%esp
+    103a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    103d:	75 78                	jne    10b7 <uptimenstest+0xd7>
+  sleep(10);
+    103f:	83 ec 0c             	sub    $0xc,%esp
+    1042:	6a 0a                	push   $0xa
+    1044:	e8 aa 35 00 00       	call   45f3 <sleep>
+  uptimens(&t1);
+    1049:	89 34 24             	mov    %esi,(%esp)
+    104c:	e8 d2 35 00 00       	call   4623 <uptimens>
+  if(t1 - t0 < 50000000ULL){
+    1051:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1054:	b9 7f f0 fa 02       	mov    $0x2faf07f,%ecx
+    1059:	2b 45 e8             	sub    -0x18(%ebp),%eax
+    105c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    105f:	1b 55 ec             	sbb    -0x14(%ebp),%edx
+    1062:	83 c4 10             	add    $0x10,%esp
+    1065:	39 c1                	cmp    %eax,%ecx
+    1067:	19 d3                	sbb    %edx,%ebx
+    1069:	73 35                	jae    10a0 <uptimenstest+0xc0>
+  printf(stdout, "uptimens ok\n");
+    106b:	83 ec 08             	sub    $0x8,%esp
+    106e:	68 d8 51 00 00       	push   $0x51d8
+    1073:	ff 35 88 74 00 00    	push   0x7488
+    1079:	e8 62 36 00 00       	call   46e0 <printf>
+}
+    107e:	83 c4 10             	add    $0x10,%esp
+    1081:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1084:	5b                   	pop    %ebx
+    1085:	5e                   	pop    %esi
+    1086:	5d                   	pop    %ebp
+    1087:	c3                   	ret
+    printf(stdout, "uptimens went backwards\n");
+    1088:	83 ec 08             	sub    $0x8,%esp
+    108b:	68 bf 51 00 00       	push   $0x51bf
+    1090:	ff 35 88 74 00 00    	push   0x7488
+    1096:	e8 45 36 00 00       	call   46e0 <printf>
+    exit();
+    109b:	e8 c3 34 00 00       	call   4563 <exit>
+    printf(stdout, "uptimens: sleep(10) took under 50ms\n");
+    10a0:	50                   	push   %eax
+    10a1:	50                   	push   %eax
+    10a2:	68 28 61 00 00       	push   $0x6128
+    10a7:	ff 35 88 74 00 00    	push   0x7488
+    10ad:	e8 2e 36 00 00       	call   46e0 <printf>
+    exit();
+    10b2:	e8 ac 34 00 00       	call   4563 <exit>
+    printf(stdout, "uptimens accepted a bad pointer\n");
+    10b7:	52                   	push   %edx
+    10b8:	52                   	push   %edx
+    10b9:	68 04 61 00 00       	push   $0x6104
+    10be:	ff 35 88 74 00 00    	push   0x7488
+    10c4:	e8 17 36 00 00       	call   46e0 <printf>
+    exit();
+    10c9:	e8 95 34 00 00       	call   4563 <exit>
+    10ce:	66 90                	xchg   %ax,%ax
+
+000010d0 <preempt>:
+{
+    10d0:	55                   	push   %ebp
+    10d1:	89 e5                	mov    %esp,%ebp
+    10d3:	57                   	push   %edi
+    10d4:	56                   	push   %esi
+    10d5:	53                   	push   %ebx
+    10d6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+    10d9:	68 e5 51 00 00       	push   $0x51e5
+    10de:	6a 01                	push   $0x1
+    10e0:	e8 fb 35 00 00       	call   46e0 <printf>
+  pid1 = fork();
+    10e5:	e8 71 34 00 00       	call   455b <fork>
+  if(pid1 == 0)
+    10ea:	83 c4 10             	add    $0x10,%esp
+    10ed:	85 c0                	test   %eax,%eax
+    10ef:	75 07                	jne    10f8 <preempt+0x28>
+    for(;;)
+    10f1:	eb fe                	jmp    10f1 <preempt+0x21>
+    10f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    10f7:	90                   	nop
+    10f8:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+    10fa:	e8 5c 34 00 00       	call   455b <fork>
+    10ff:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+    1101:	85 c0                	test   %eax,%eax
+    1103:	75 0b                	jne    1110 <preempt+0x40>
+    for(;;)
+    1105:	eb fe                	jmp    1105 <preempt+0x35>
+    1107:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    110e:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+    1110:	83 ec 0c             	sub    $0xc,%esp
+    1113:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1116:	50                   	push   %eax
+    1117:	e8 57 34 00 00       	call   4573 <pipe>
+  pid3 = fork();
+    111c:	e8 3a 34 00 00       	call   455b <fork>
+  if(pid3 == 0){
+    1121:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+    1124:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+    1126:	85 c0                	test   %eax,%eax
+    1128:	75 3e                	jne    1168 <preempt+0x98>
+    close(pfds[0]);
+    112a:	83 ec 0c             	sub    $0xc,%esp
+    112d:	ff 75 e0             	push   -0x20(%ebp)
+    1130:	e8 56 34 00 00       	call   458b <close>
+    if(write(pfds[1], "x", 1) != 1)
+    1135:	83 c4 0c             	add    $0xc,%esp
+    1138:	6a 01                	push   $0x1
+    113a:	68 16 5c 00 00       	push   $0x5c16
+    113f:	ff 75 e4             	push   -0x1c(%ebp)
+    1142:	e8 3c 34 00 00       	call   4583 <write>
+    1147:	83 c4 10             	add    $0x10,%esp
+    114a:	83 f8 01             	cmp    $0x1,%eax
+    114d:	0f 85 b8 00 00 00    	jne    120b <preempt+0x13b>
+    close(pfds[1]);
+    1153:	83 ec 0c             	sub    $0xc,%esp
+    1156:	ff 75 e4             	push   -0x1c(%ebp)
+    1159:	e8 2d 34 00 00       	call   458b <close>
+    115e:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+    1161:	eb fe                	jmp    1161 <preempt+0x91>
+    1163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1167:	90                   	nop
+  close(pfds[1]);
+    1168:	83 ec 0c             	sub    $0xc,%esp
+    116b:	ff 75 e4             	push   -0x1c(%ebp)
+    116e:	e8 18 34 00 00       	call   458b <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+    1173:	83 c4 0c             	add    $0xc,%esp
+    1176:	68 00 20 00 00       	push   $0x2000
+    117b:	68 c0 9b 00 00       	push   $0x9bc0
+    1180:	ff 75 e0             	push   -0x20(%ebp)
+    1183:	e8 f3 33 00 00       	call   457b <read>
+    1188:	83 c4 10             	add    $0x10,%esp
+    118b:	83 f8 01             	cmp    $0x1,%eax
+    118e:	75 67                	jne    11f7 <preempt+0x127>
+  close(pfds[0]);
+    1190:	83 ec 0c             	sub    $0xc,%esp
+    1193:	ff 75 e0             	push   -0x20(%ebp)
+    1196:	e8 f0 33 00 00       	call   458b <close>
+  printf(1, "kill... ");
+    119b:	58                   	pop    %eax
+    119c:	5a                   	pop    %edx
+    119d:	68 16 52 00 00       	push   $0x5216
+    11a2:	6a 01                	push   $0x1
+    11a4:	e8 37 35 00 00       	call   46e0 <printf>
+  kill(pid1);
+    11a9:	89 1c 24             	mov    %ebx,(%esp)
+    11ac:	e8 e2 33 00 00       	call   4593 <kill>
+  kill(pid2);
+    11b1:	89 34 24             	mov    %esi,(%esp)
+    11b4:	e8 da 33 00 00       	call   4593 <kill>
+  kill(pid3);
+    11b9:	89 3c 24             	mov    %edi,(%esp)
+    11bc:	e8 d2 33 00 00       	call   4593 <kill>
+  printf(1, "wait... ");
+    11c1:	59                   	pop    %ecx
+    11c2:	5b                   	pop    %ebx
+    11c3:	68 1f 52 00 00       	push   $0x521f
+    11c8:	6a 01                	push   $0x1
+    11ca:	e8 11 35 00 00       	call   46e0 <printf>
+  wait();
+    11cf:	e8 97 33 00 00       	call   456b <wait>
+  wait();
+    11d4:	e8 92 33 00 00       	call   456b <wait>
+  wait();
+    11d9:	e8 8d 33 00 00       	call   456b <wait>
+  printf(1, "preempt ok\n");
+    11de:	5e                   	pop    %esi
+    11df:	5f                   	pop    %edi
+    11e0:	68 28 52 00 00       	push   $0x5228
+    11e5:	6a 01                	push   $0x1
+    11e7:	e8 f4 34 00 00       	call   46e0 <printf>
+    11ec:	83 c4 10             	add    $0x10,%esp
+}
+    11ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    11f2:	5b                   	pop    %ebx
+    11f3:	5e                   	pop    %esi
+    11f4:	5f                   	pop    %edi
+    11f5:	5d                   	pop    %ebp
+    11f6:	c3                   	ret
+    printf(1, "preempt read error");
+    11f7:	83 ec 08             	sub    $0x8,%esp
+    11fa:	68 03 52 00 00       	push   $0x5203
+    11ff:	6a 01                	push   $0x1
+    1201:	e8 da 34 00 00       	call   46e0 <printf>
+    1206:	83 c4 10             	add    $0x10,%esp
+    1209:	eb e4                	jmp    11ef <preempt+0x11f>
+      printf(1, "preempt write error");
+    120b:	83 ec 08             	sub    $0x8,%esp
+    120e:	68 ef 51 00 00       	push   $0x51ef
+    1213:	6a 01                	push   $0x1
+    1215:	e8 c6 34 00 00       	call   46e0 <printf>
+    121a:	83 c4 10             	add    $0x10,%esp
+    121d:	e9 31 ff ff ff       	jmp    1153 <preempt+0x83>
+    1222:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1229:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001230 <exitwait>:
+{
+    1230:	55                   	push   %ebp
+    1231:	89 e5                	mov    %esp,%ebp
+    1233:	56                   	push   %esi
+    1234:	be 64 00 00 00       	mov    $0x64,%esi
+    1239:	53                   	push   %ebx
+    123a:	eb 14                	jmp    1250 <exitwait+0x20>
+    123c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+    1240:	74 68                	je     12aa <exitwait+0x7a>
+      if(wait() != pid){
+    1242:	e8 24 33 00 00       	call   456b <wait>
+    1247:	39 d8                	cmp    %ebx,%eax
+    1249:	75 2d                	jne    1278 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+    124b:	83 ee 01             	sub    $0x1,%esi
+    124e:	74 41                	je     1291 <exitwait+0x61>
+    pid = fork();
+    1250:	e8 06 33 00 00       	call   455b <fork>
+    1255:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1257:	85 c0                	test   %eax,%eax
+    1259:	79 e5                	jns    1240 <exitwait+0x10>
+      printf(1, "fork failed\n");
+    125b:	83 ec 08             	sub    $0x8,%esp
+    125e:	68 27 5f 00 00       	push   $0x5f27
+    1263:	6a 01                	push   $0x1
+    1265:	e8 76 34 00 00       	call   46e0 <printf>
+      return;
+    126a:	83 c4 10             	add    $0x10,%esp
+}
+    126d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1270:	5b                   	pop    %ebx
+    1271:	5e                   	pop    %esi
+    1272:	5d                   	pop    %ebp
+    1273:	c3                   	ret
+    1274:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+    1278:	83 ec 08             	sub    $0x8,%esp
+    127b:	68 34 52 00 00       	push   $0x5234
+    1280:	6a 01                	push   $0x1
+    1282:	e8 59 34 00 00       	call   46e0 <printf>
+        return;
+    1287:	83 c4 10             	add    $0x10,%esp
+}
+    128a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    128d:	5b                   	pop    %ebx
+    128e:	5e                   	pop    %esi
+    128f:	5d                   	pop    %ebp
+    1290:	c3                   	ret
+  printf(1, "exitwait ok\n");
+    1291:	83 ec 08             	sub    $0x8,%esp
+    1294:	68 44 52 00 00       	push   $0x5244
+    1299:	6a 01                	push   $0x1
+    129b:	e8 40 34 00 00       	call   46e0 <printf>
+    12a0:	83 c4 10             	add    $0x10,%esp
+}
+    12a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    12a6:	5b                   	pop    %ebx
+    12a7:	5e                   	pop    %esi
+    12a8:	5d                   	pop    %ebp
+    12a9:	c3                   	ret
+      exit();
+    12aa:	e8 b4 32 00 00       	call   4563 <exit>
+    12af:	90                   	nop
+
+000012b0 <mem>:
+{
+    12b0:	55                   	push   %ebp
+    12b1:	89 e5                	mov    %esp,%ebp
+    12b3:	56                   	push   %esi
+    12b4:	31 f6                	xor    %esi,%esi
+    12b6:	53                   	push   %ebx
+  printf(1, "mem test\n");
+    12b7:	83 ec 08             	sub    $0x8,%esp
+    12ba:	68 51 52 00 00       	push   $0x5251
+    12bf:	6a 01                	push   $0x1
+    12c1:	e8 1a 34 00 00       	call   46e0 <printf>
+  ppid = getpid();
+    12c6:	e8 18 33 00 00       	call   45e3 <getpid>
+    12cb:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+    12cd:	e8 89 32 00 00       	call   455b <fork>
+    12d2:	83 c4 10             	add    $0x10,%esp
+    12d5:	85 c0                	test   %eax,%eax
+    12d7:	74 0b                	je     12e4 <mem+0x34>
+    12d9:	e9 8a 00 00 00       	jmp    1368 <mem+0xb8>
+    12de:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+    12e0:	89 30                	mov    %esi,(%eax)
+    12e2:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+    12e4:	83 ec 0c             	sub    $0xc,%esp
+    12e7:	68 11 27 00 00       	push   $0x2711
+    12ec:	e8 2f 36 00 00       	call   4920 <malloc>
+    12f1:	83 c4 10             	add    $0x10,%esp
+    12f4:	85 c0                	test   %eax,%eax
+    12f6:	75 e8                	jne    12e0 <mem+0x30>
+    while(m1){
+    12f8:	85 f6                	test   %esi,%esi
+    12fa:	74 18                	je     1314 <mem+0x64>
+    12fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+    1300:	89 f0                	mov    %esi,%eax
+      free(m1);
+    1302:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+    1305:	8b 36                	mov    (%esi),%esi
+      free(m1);
+    1307:	50                   	push   %eax
+    1308:	e8 83 35 00 00       	call   4890 <free>
+    while(m1){
+    130d:	83 c4 10             	add    $0x10,%esp
+    1310:	85 f6                	test   %esi,%esi
+    1312:	75 ec                	jne    1300 <mem+0x50>
+    m1 = malloc(1024*20);
+    1314:	83 ec 0c             	sub    $0xc,%esp
+    1317:	68 00 50 00 00       	push   $0x5000
+    131c:	e8 ff 35 00 00       	call   4920 <malloc>
+    if(m1 == 0){
+    1321:	83 c4 10             	add    $0x10,%esp
+    1324:	85 c0                	test   %eax,%eax
+    1326:	74 20                	je     1348 <mem+0x98>
+    free(m1);
+    1328:	83 ec 0c             	sub    $0xc,%esp
+    132b:	50                   	push   %eax
+    132c:	e8 5f 35 00 00       	call   4890 <free>
+    printf(1, "mem ok\n");
+    1331:	58                   	pop    %eax
+    1332:	5a                   	pop    %edx
+    1333:	68 75 52 00 00       	push   $0x5275
+    1338:	6a 01                	push   $0x1
+    133a:	e8 a1 33 00 00       	call   46e0 <printf>
+    exit();
+    133f:	e8 1f 32 00 00       	call   4563 <exit>
+    1344:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+    1348:	83 ec 08             	sub    $0x8,%esp
+    134b:	68 5b 52 00 00       	push   $0x525b
+    1350:	6a 01                	push   $0x1
+    1352:	e8 89 33 00 00       	call   46e0 <printf>
+      kill(ppid);
+    1357:	89 1c 24             	mov    %ebx,(%esp)
+    135a:	e8 34 32 00 00       	call   4593 <kill>
+      exit();
+    135f:	e8 ff 31 00 00       	call   4563 <exit>
+    1364:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    1368:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    136b:	5b                   	pop    %ebx
+    136c:	5e                   	pop    %esi
+    136d:	5d                   	pop    %ebp
+    wait();
+    136e:	e9 f8 31 00 00       	jmp    456b <wait>
+    1373:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    137a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001380 <sharedfd>:
+{
+    1380:	55                   	push   %ebp
+    1381:	89 e5                	mov    %esp,%ebp
+    1383:	57                   	push   %edi
+    1384:	56                   	push   %esi
+    1385:	53                   	push   %ebx
+    1386:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+    1389:	68 7d 52 00 00       	push   $0x527d
+    138e:	6a 01                	push   $0x1
+    1390:	e8 4b 33 00 00       	call   46e0 <printf>
+  unlink("sharedfd");
+    1395:	c7 04 24 8c 52 00 00 	movl   $0x528c,(%esp)
+    139c:	e8 12 32 00 00       	call   45b3 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    13a1:	5b                   	pop    %ebx
+    13a2:	5e                   	pop    %esi
+    13a3:	68 02 02 00 00       	push   $0x202
+    13a8:	68 8c 52 00 00       	push   $0x528c
+    13ad:	e8 f1 31 00 00       	call   45a3 <open>
+  if(fd < 0){
+    13b2:	83 c4 10             	add    $0x10,%esp
+    13b5:	85 c0                	test   %eax,%eax
+    13b7:	0f 88 2a 01 00 00    	js     14e7 <sharedfd+0x167>
+    13bd:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    13bf:	8d 75 de             	lea    -0x22(%ebp),%esi
+    13c2:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+    13c7:	e8 8f 31 00 00       	call   455b <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    13cc:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+    13cf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    13d2:	19 c0                	sbb    %eax,%eax
+    13d4:	83 ec 04             	sub    $0x4,%esp
+    13d7:	83 e0 f3             	and    $0xfffffff3,%eax
+    13da:	6a 0a                	push   $0xa
+    13dc:	83 c0 70             	add    $0x70,%eax
+    13df:	50                   	push   %eax
+    13e0:	56                   	push   %esi
+    13e1:	e8 fa 2f 00 00       	call   43e0 <memset>
+    13e6:	83 c4 10             	add    $0x10,%esp
+    13e9:	eb 0a                	jmp    13f5 <sharedfd+0x75>
+    13eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    13ef:	90                   	nop
+  for(i = 0; i < 1000; i++){
+    13f0:	83 eb 01             	sub    $0x1,%ebx
+    13f3:	74 26                	je     141b <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    13f5:	83 ec 04             	sub    $0x4,%esp
+    13f8:	6a 0a                	push   $0xa
+    13fa:	56                   	push   %esi
+    13fb:	57                   	push   %edi
+    13fc:	e8 82 31 00 00       	call   4583 <write>
+    1401:	83 c4 10             	add    $0x10,%esp
+    1404:	83 f8 0a             	cmp    $0xa,%eax
+    1407:	74 e7                	je     13f0 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+    1409:	83 ec 08             	sub    $0x8,%esp
+    140c:	68 7c 61 00 00       	push   $0x617c
+    1411:	6a 01                	push   $0x1
+    1413:	e8 c8 32 00 00       	call   46e0 <printf>
+      break;
+    1418:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+    141b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    141e:	85 c9                	test   %ecx,%ecx
+    1420:	0f 84 f5 00 00 00    	je     151b <sharedfd+0x19b>
+    wait();
+    1426:	e8 40 31 00 00       	call   456b <wait>
+  close(fd);
+    142b:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+    142e:	31 db                	xor    %ebx,%ebx
+  close(fd);
+    1430:	57                   	push   %edi
+    1431:	8d 7d e8             	lea    -0x18(%ebp),%edi
+    1434:	e8 52 31 00 00       	call   458b <close>
+  fd = open("sharedfd", 0);
+    1439:	58                   	pop    %eax
+    143a:	5a                   	pop    %edx
+    143b:	6a 00                	push   $0x0
+    143d:	68 8c 52 00 00       	push   $0x528c
+    1442:	e8 5c 31 00 00       	call   45a3 <open>
+  if(fd < 0){
+    1447:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+    144a:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+    144c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+    144f:	85 c0                	test   %eax,%eax
+    1451:	0f 88 aa 00 00 00    	js     1501 <sharedfd+0x181>
+    1457:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    145e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    1460:	83 ec 04             	sub    $0x4,%esp
+    1463:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    1466:	6a 0a                	push   $0xa
+    1468:	56                   	push   %esi
+    1469:	ff 75 d0             	push   -0x30(%ebp)
+    146c:	e8 0a 31 00 00       	call   457b <read>
+    1471:	83 c4 10             	add    $0x10,%esp
+    1474:	85 c0                	test   %eax,%eax
+    1476:	7e 28                	jle    14a0 <sharedfd+0x120>
+    1478:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    147b:	89 f0                	mov    %esi,%eax
+    147d:	eb 13                	jmp    1492 <sharedfd+0x112>
+    147f:	90                   	nop
+        np++;
+    1480:	80 f9 70             	cmp    $0x70,%cl
+    1483:	0f 94 c1             	sete   %cl
+    1486:	0f b6 c9             	movzbl %cl,%ecx
+    1489:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+    148b:	83 c0 01             	add    $0x1,%eax
+    148e:	39 f8                	cmp    %edi,%eax
+    1490:	74 ce                	je     1460 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+    1492:	0f b6 08             	movzbl (%eax),%ecx
+    1495:	80 f9 63             	cmp    $0x63,%cl
+    1498:	75 e6                	jne    1480 <sharedfd+0x100>
+        nc++;
+    149a:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+    149d:	eb ec                	jmp    148b <sharedfd+0x10b>
+    149f:	90                   	nop
+  close(fd);
+    14a0:	83 ec 0c             	sub    $0xc,%esp
+    14a3:	ff 75 d0             	push   -0x30(%ebp)
+    14a6:	e8 e0 30 00 00       	call   458b <close>
+  unlink("sharedfd");
+    14ab:	c7 04 24 8c 52 00 00 	movl   $0x528c,(%esp)
+    14b2:	e8 fc 30 00 00       	call   45b3 <unlink>
+  if(nc == 10000 && np == 10000){
+    14b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    14ba:	83 c4 10             	add    $0x10,%esp
+    14bd:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+    14c3:	75 5b                	jne    1520 <sharedfd+0x1a0>
+    14c5:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+    14cb:	75 53                	jne    1520 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+    14cd:	83 ec 08             	sub    $0x8,%esp
+    14d0:	68 95 52 00 00       	push   $0x5295
+    14d5:	6a 01                	push   $0x1
+    14d7:	e8 04 32 00 00       	call   46e0 <printf>
+    14dc:	83 c4 10             	add    $0x10,%esp
+}
+    14df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14e2:	5b                   	pop    %ebx
+    14e3:	5e                   	pop    %esi
+    14e4:	5f                   	pop    %edi
+    14e5:	5d                   	pop    %ebp
+    14e6:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+    14e7:	83 ec 08             	sub    $0x8,%esp
+    14ea:	68 50 61 00 00       	push   $0x6150
+    14ef:	6a 01                	push   $0x1
+    14f1:	e8 ea 31 00 00       	call   46e0 <printf>
+    return;
+    14f6:	83 c4 10             	add    $0x10,%esp
+}
+    14f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    14fc:	5b                   	pop    %ebx
+    14fd:	5e                   	pop    %esi
+    14fe:	5f                   	pop    %edi
+    14ff:	5d                   	pop    %ebp
+    1500:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    1501:	83 ec 08             	sub    $0x8,%esp
+    1504:	68 9c 61 00 00       	push   $0x619c
+    1509:	6a 01                	push   $0x1
+    150b:	e8 d0 31 00 00       	call   46e0 <printf>
+    return;
+    1510:	83 c4 10             	add    $0x10,%esp
+}
+    1513:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1516:	5b                   	pop    %ebx
+    1517:	5e                   	pop    %esi
+    1518:	5f                   	pop    %edi
+    1519:	5d                   	pop    %ebp
+    151a:	c3                   	ret
+    exit();
+    151b:	e8 43 30 00 00       	call   4563 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    1520:	53                   	push   %ebx
+    1521:	52                   	push   %edx
+    1522:	68 a2 52 00 00       	push   $0x52a2
+    1527:	6a 01                	push   $0x1
+    1529:	e8 b2 31 00 00       	call   46e0 <printf>
+    exit();
+    152e:	e8 30 30 00 00       	call   4563 <exit>
+    1533:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    153a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001540 <fourfiles>:
+{
+    1540:	55                   	push   %ebp
+    1541:	89 e5                	mov    %esp,%ebp
+    1543:	57                   	push   %edi
+    1544:	56                   	push   %esi
+    1545:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+    1546:	31 db                	xor    %ebx,%ebx
+{
+    1548:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+    154b:	c7 45 d8 b7 52 00 00 	movl   $0x52b7,-0x28(%ebp)
+    1552:	c7 45 dc 00 54 00 00 	movl   $0x5400,-0x24(%ebp)
+    1559:	c7 45 e0 04 54 00 00 	movl   $0x5404,-0x20(%ebp)
+    1560:	c7 45 e4 ba 52 00 00 	movl   $0x52ba,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+    1567:	68 bd 52 00 00       	push   $0x52bd
+    156c:	6a 01                	push   $0x1
+    156e:	e8 6d 31 00 00       	call   46e0 <printf>
+    1573:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+    1576:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+    157a:	83 ec 0c             	sub    $0xc,%esp
+    157d:	56                   	push   %esi
+    157e:	e8 30 30 00 00       	call   45b3 <unlink>
+    pid = fork();
+    1583:	e8 d3 2f 00 00       	call   455b <fork>
+    if(pid < 0){
+    1588:	83 c4 10             	add    $0x10,%esp
+    158b:	85 c0                	test   %eax,%eax
+    158d:	0f 88 65 01 00 00    	js     16f8 <fourfiles+0x1b8>
+    if(pid == 0){
+    1593:	0f 84 eb 00 00 00    	je     1684 <fourfiles+0x144>
+  for(pi = 0; pi < 4; pi++){
+    1599:	83 c3 01             	add    $0x1,%ebx
+    159c:	83 fb 04             	cmp    $0x4,%ebx
+    159f:	75 d5                	jne    1576 <fourfiles+0x36>
+    wait();
+    15a1:	e8 c5 2f 00 00       	call   456b <wait>
+  for(i = 0; i < 2; i++){
+    15a6:	31 f6                	xor    %esi,%esi
+    wait();
+    15a8:	e8 be 2f 00 00       	call   456b <wait>
+    15ad:	e8 b9 2f 00 00       	call   456b <wait>
+    15b2:	e8 b4 2f 00 00       	call   456b <wait>
+    fname = names[i];
+    15b7:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+    15bb:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+    15be:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+    15c0:	6a 00                	push   $0x0
+    15c2:	53                   	push   %ebx
+    15c3:	e8 db 2f 00 00       	call   45a3 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    15c8:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    15cb:	83 c4 10             	add    $0x10,%esp
+    15ce:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    15d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15d8:	83 ec 04             	sub    $0x4,%esp
+    15db:	68 00 20 00 00       	push   $0x2000
+    15e0:	68 c0 9b 00 00       	push   $0x9bc0
+    15e5:	ff 75 d4             	push   -0x2c(%ebp)
+    15e8:	e8 8e 2f 00 00       	call   457b <read>
+    15ed:	83 c4 10             	add    $0x10,%esp
+    15f0:	89 c3                	mov    %eax,%ebx
+    15f2:	85 c0                	test   %eax,%eax
+    15f4:	7e 28                	jle    161e <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+    15f6:	31 c0                	xor    %eax,%eax
+    15f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    15ff:	90                   	nop
+        if(buf[j] != '0'+i){
+    1600:	83 fe 01             	cmp    $0x1,%esi
+    1603:	0f be 88 c0 9b 00 00 	movsbl 0x9bc0(%eax),%ecx
+    160a:	19 d2                	sbb    %edx,%edx
+    160c:	83 c2 31             	add    $0x31,%edx
+    160f:	39 d1                	cmp    %edx,%ecx
+    1611:	75 5d                	jne    1670 <fourfiles+0x130>
+      for(j = 0; j < n; j++){
+    1613:	83 c0 01             	add    $0x1,%eax
+    1616:	39 c3                	cmp    %eax,%ebx
+    1618:	75 e6                	jne    1600 <fourfiles+0xc0>
+      total += n;
+    161a:	01 df                	add    %ebx,%edi
+    161c:	eb ba                	jmp    15d8 <fourfiles+0x98>
+    close(fd);
+    161e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+    1621:	83 ec 0c             	sub    $0xc,%esp
+    1624:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1627:	51                   	push   %ecx
+    1628:	e8 5e 2f 00 00       	call   458b <close>
+    if(total != 12*500){
+    162d:	83 c4 10             	add    $0x10,%esp
+    1630:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+    1636:	0f 85 d0 00 00 00    	jne    170c <fourfiles+0x1cc>
+    unlink(fname);
+    163c:	83 ec 0c             	sub    $0xc,%esp
+    163f:	53                   	push   %ebx
+    1640:	e8 6e 2f 00 00       	call   45b3 <unlink>
+  for(i = 0; i < 2; i++){
+    1645:	83 c4 10             	add    $0x10,%esp
+    1648:	85 f6                	test   %esi,%esi
+    164a:	75 0a                	jne    1656 <fourfiles+0x116>
+    164c:	be 01 00 00 00       	mov    $0x1,%esi
+    1651:	e9 61 ff ff ff       	jmp    15b7 <fourfiles+0x77>
+  printf(1, "fourfiles ok\n");
+    1656:	83 ec 08             	sub    $0x8,%esp
+    1659:	68 fb 52 00 00       	push   $0x52fb
+    165e:	6a 01                	push   $0x1
+    1660:	e8 7b 30 00 00       	call   46e0 <printf>
+}
+    1665:	83 c4 10             	add    $0x10,%esp
+    1668:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    166b:	5b                   	pop    %ebx
+    166c:	5e                   	pop    %esi
+    166d:	5f                   	pop    %edi
+    166e:	5d                   	pop    %ebp
+    166f:	c3                   	ret
+          printf(1, "wrong char\n");
+    1670:	83 ec 08             	sub    $0x8,%esp
+    1673:	68 de 52 00 00       	push   $0x52de
+    1678:	6a 01                	push   $0x1
+    167a:	e8 61 30 00 00       	call   46e0 <printf>
+          exit();
+    167f:	e8 df 2e 00 00       	call   4563 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+    1684:	83 ec 08             	sub    $0x8,%esp
+    1687:	68 02 02 00 00       	push   $0x202
+    168c:	56                   	push   %esi
+    168d:	e8 11 2f 00 00       	call   45a3 <open>
+      if(fd < 0){
+    1692:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+    1695:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    1697:	85 c0                	test   %eax,%eax
+    1699:	78 45                	js     16e0 <fourfiles+0x1a0>
+      memset(buf, '0'+pi, 512);
+    169b:	83 ec 04             	sub    $0x4,%esp
+    169e:	83 c3 30             	add    $0x30,%ebx
+    16a1:	68 00 02 00 00       	push   $0x200
+    16a6:	53                   	push   %ebx
+    16a7:	bb 0c 00 00 00       	mov    $0xc,%ebx
+    16ac:	68 c0 9b 00 00       	push   $0x9bc0
+    16b1:	e8 2a 2d 00 00       	call   43e0 <memset>
+    16b6:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+    16b9:	83 ec 04             	sub    $0x4,%esp
+    16bc:	68 f4 01 00 00       	push   $0x1f4
+    16c1:	68 c0 9b 00 00       	push   $0x9bc0
+    16c6:	56                   	push   %esi
+    16c7:	e8 b7 2e 00 00       	call   4583 <write>
+    16cc:	83 c4 10             	add    $0x10,%esp
+    16cf:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+    16d4:	75 49                	jne    171f <fourfiles+0x1df>
+      for(i = 0; i < 12; i++){
+    16d6:	83 eb 01             	sub    $0x1,%ebx
+    16d9:	75 de                	jne    16b9 <fourfiles+0x179>
+      exit();
+    16db:	e8 83 2e 00 00       	call   4563 <exit>
+        printf(1, "create failed\n");
+    16e0:	51                   	push   %ecx
+    16e1:	51                   	push   %ecx
+    16e2:	68 58 55 00 00       	push   $0x5558
+    16e7:	6a 01                	push   $0x1
+    16e9:	e8 f2 2f 00 00       	call   46e0 <printf>
+        exit();
+    16ee:	e8 70 2e 00 00       	call   4563 <exit>
+    16f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    16f7:	90                   	nop
+      printf(1, "fork failed\n");
+    16f8:	83 ec 08             	sub    $0x8,%esp
+    16fb:	68 27 5f 00 00       	push   $0x5f27
+    1700:	6a 01                	push   $0x1
+    1702:	e8 d9 2f 00 00       	call   46e0 <printf>
+      exit();
+    1707:	e8 57 2e 00 00       	call   4563 <exit>
+      printf(1, "wrong length %d\n", total);
+    170c:	50                   	push   %eax
+    170d:	57                   	push   %edi
+    170e:	68 ea 52 00 00       	push   $0x52ea
+    1713:	6a 01                	push   $0x1
+    1715:	e8 c6 2f 00 00       	call   46e0 <printf>
+      exit();
+    171a:	e8 44 2e 00 00       	call   4563 <exit>
+          printf(1, "write failed %d\n", n);
+    171f:	52                   	push   %edx
+    1720:	50                   	push   %eax
+    1721:	68 cd 52 00 00       	push   $0x52cd
+    1726:	6a 01                	push   $0x1
+    1728:	e8 b3 2f 00 00       	call   46e0 <printf>
+          exit();
+    172d:	e8 31 2e 00 00       	call   4563 <exit>
+    1732:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1739:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001740 <createdelete>:
+{
+    1740:	55                   	push   %ebp
+    1741:	89 e5                	mov    %esp,%ebp
+    1743:	57                   	push   %edi
+    1744:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+    1745:	31 f6                	xor    %esi,%esi
+{
+    1747:	53                   	push   %ebx
+    1748:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+    174b:	68 09 53 00 00       	push   $0x5309
+    1750:	6a 01                	push   $0x1
+    1752:	e8 89 2f 00 00       	call   46e0 <printf>
+    1757:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    175a:	e8 fc 2d 00 00       	call   455b <fork>
+    175f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    1761:	85 c0                	test   %eax,%eax
+    1763:	0f 88 ac 01 00 00    	js     1915 <createdelete+0x1d5>
+    if(pid == 0){
+    1769:	0f 84 01 01 00 00    	je     1870 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+    176f:	83 c6 01             	add    $0x1,%esi
+    1772:	83 fe 04             	cmp    $0x4,%esi
+    1775:	75 e3                	jne    175a <createdelete+0x1a>
+    wait();
+    1777:	e8 ef 2d 00 00       	call   456b <wait>
+  for(i = 0; i < N; i++){
+    177c:	31 ff                	xor    %edi,%edi
+    177e:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+    1781:	e8 e5 2d 00 00       	call   456b <wait>
+    1786:	e8 e0 2d 00 00       	call   456b <wait>
+    178b:	e8 db 2d 00 00       	call   456b <wait>
+  name[0] = name[1] = name[2] = 0;
+    1790:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+    1794:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+    1798:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+    179a:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+    179d:	bb 70 00 00 00       	mov    $0x70,%ebx
+    17a2:	0f 94 c2             	sete   %dl
+    17a5:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+    17a8:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+    17ab:	0f 9f c0             	setg   %al
+    17ae:	09 c2                	or     %eax,%edx
+    17b0:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+    17b3:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+    17b7:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+    17ba:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+    17bd:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+    17c0:	6a 00                	push   $0x0
+    17c2:	56                   	push   %esi
+    17c3:	e8 db 2d 00 00       	call   45a3 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+    17c8:	83 c4 10             	add    $0x10,%esp
+    17cb:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+    17cf:	74 7f                	je     1850 <createdelete+0x110>
+    17d1:	85 c0                	test   %eax,%eax
+    17d3:	0f 88 27 01 00 00    	js     1900 <createdelete+0x1c0>
+        close(fd);
+    17d9:	83 ec 0c             	sub    $0xc,%esp
+    17dc:	50                   	push   %eax
+    17dd:	e8 a9 2d 00 00       	call   458b <close>
+    17e2:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+    17e5:	83 c3 01             	add    $0x1,%ebx
+    17e8:	80 fb 74             	cmp    $0x74,%bl
+    17eb:	75 c6                	jne    17b3 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+    17ed:	83 c7 01             	add    $0x1,%edi
+    17f0:	83 ff 14             	cmp    $0x14,%edi
+    17f3:	75 a3                	jne    1798 <createdelete+0x58>
+    17f5:	bf 70 00 00 00       	mov    $0x70,%edi
+    17fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+    1800:	8d 47 c0             	lea    -0x40(%edi),%eax
+    1803:	bb 04 00 00 00       	mov    $0x4,%ebx
+    1808:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+    180b:	89 f8                	mov    %edi,%eax
+      unlink(name);
+    180d:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+    1810:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+    1813:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+    1817:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+    181a:	56                   	push   %esi
+    181b:	e8 93 2d 00 00       	call   45b3 <unlink>
+    for(pi = 0; pi < 4; pi++){
+    1820:	83 c4 10             	add    $0x10,%esp
+    1823:	83 eb 01             	sub    $0x1,%ebx
+    1826:	75 e3                	jne    180b <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+    1828:	83 c7 01             	add    $0x1,%edi
+    182b:	89 f8                	mov    %edi,%eax
+    182d:	3c 84                	cmp    $0x84,%al
+    182f:	75 cf                	jne    1800 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+    1831:	83 ec 08             	sub    $0x8,%esp
+    1834:	68 1c 53 00 00       	push   $0x531c
+    1839:	6a 01                	push   $0x1
+    183b:	e8 a0 2e 00 00       	call   46e0 <printf>
+}
+    1840:	83 c4 10             	add    $0x10,%esp
+    1843:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1846:	5b                   	pop    %ebx
+    1847:	5e                   	pop    %esi
+    1848:	5f                   	pop    %edi
+    1849:	5d                   	pop    %ebp
+    184a:	c3                   	ret
+    184b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    184f:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+    1850:	85 c0                	test   %eax,%eax
+    1852:	78 91                	js     17e5 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+    1854:	50                   	push   %eax
+    1855:	56                   	push   %esi
+    1856:	68 ec 61 00 00       	push   $0x61ec
+    185b:	6a 01                	push   $0x1
+    185d:	e8 7e 2e 00 00       	call   46e0 <printf>
+        exit();
+    1862:	e8 fc 2c 00 00       	call   4563 <exit>
+    1867:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    186e:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+    1870:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+    1873:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+    1877:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+    187a:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+    187d:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+    1880:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+    1883:	8d 43 30             	lea    0x30(%ebx),%eax
+    1886:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+    1889:	68 02 02 00 00       	push   $0x202
+    188e:	56                   	push   %esi
+    188f:	e8 0f 2d 00 00       	call   45a3 <open>
+        if(fd < 0){
+    1894:	83 c4 10             	add    $0x10,%esp
+    1897:	85 c0                	test   %eax,%eax
+    1899:	0f 88 8a 00 00 00    	js     1929 <createdelete+0x1e9>
+        close(fd);
+    189f:	83 ec 0c             	sub    $0xc,%esp
+    18a2:	50                   	push   %eax
+    18a3:	e8 e3 2c 00 00       	call   458b <close>
+        if(i > 0 && (i % 2 ) == 0){
+    18a8:	83 c4 10             	add    $0x10,%esp
+    18ab:	85 db                	test   %ebx,%ebx
+    18ad:	74 19                	je     18c8 <createdelete+0x188>
+    18af:	f6 c3 01             	test   $0x1,%bl
+    18b2:	74 1b                	je     18cf <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+    18b4:	83 c3 01             	add    $0x1,%ebx
+    18b7:	83 fb 14             	cmp    $0x14,%ebx
+    18ba:	75 c4                	jne    1880 <createdelete+0x140>
+      exit();
+    18bc:	e8 a2 2c 00 00       	call   4563 <exit>
+    18c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+    18c8:	bb 01 00 00 00       	mov    $0x1,%ebx
+    18cd:	eb b1                	jmp    1880 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+    18cf:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+    18d1:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+    18d4:	d1 f8                	sar    %eax
+    18d6:	83 c0 30             	add    $0x30,%eax
+    18d9:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+    18dc:	56                   	push   %esi
+    18dd:	e8 d1 2c 00 00       	call   45b3 <unlink>
+    18e2:	83 c4 10             	add    $0x10,%esp
+    18e5:	85 c0                	test   %eax,%eax
+    18e7:	79 cb                	jns    18b4 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+    18e9:	52                   	push   %edx
+    18ea:	52                   	push   %edx
+    18eb:	68 f9 4d 00 00       	push   $0x4df9
+    18f0:	6a 01                	push   $0x1
+    18f2:	e8 e9 2d 00 00       	call   46e0 <printf>
+            exit();
+    18f7:	e8 67 2c 00 00       	call   4563 <exit>
+    18fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+    1900:	83 ec 04             	sub    $0x4,%esp
+    1903:	56                   	push   %esi
+    1904:	68 c8 61 00 00       	push   $0x61c8
+    1909:	6a 01                	push   $0x1
+    190b:	e8 d0 2d 00 00       	call   46e0 <printf>
+        exit();
+    1910:	e8 4e 2c 00 00       	call   4563 <exit>
+      printf(1, "fork failed\n");
+    1915:	83 ec 08             	sub    $0x8,%esp
+    1918:	68 27 5f 00 00       	push   $0x5f27
+    191d:	6a 01                	push   $0x1
+    191f:	e8 bc 2d 00 00       	call   46e0 <printf>
+      exit();
+    1924:	e8 3a 2c 00 00       	call   4563 <exit>
+          printf(1, "create failed\n");
+    1929:	83 ec 08             	sub    $0x8,%esp
+    192c:	68 58 55 00 00       	push   $0x5558
+    1931:	6a 01                	push   $0x1
+    1933:	e8 a8 2d 00 00       	call   46e0 <printf>
+          exit();
+    1938:	e8 26 2c 00 00       	call   4563 <exit>
+    193d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001940 <unlinkread>:
+{
+    1940:	55                   	push   %ebp
+    1941:	89 e5                	mov    %esp,%ebp
+    1943:	56                   	push   %esi
+    1944:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    1945:	83 ec 08             	sub    $0x8,%esp
+    1948:	68 2d 53 00 00       	push   $0x532d
+    194d:	6a 01                	push   $0x1
+    194f:	e8 8c 2d 00 00       	call   46e0 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    1954:	5b                   	pop    %ebx
+    1955:	5e                   	pop    %esi
+    1956:	68 02 02 00 00       	push   $0x202
+    195b:	68 3e 53 00 00       	push   $0x533e
+    1960:	e8 3e 2c 00 00       	call   45a3 <open>
+  if(fd < 0){
+    1965:	83 c4 10             	add    $0x10,%esp
+    1968:	85 c0                	test   %eax,%eax
+    196a:	0f 88 e6 00 00 00    	js     1a56 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    1970:	83 ec 04             	sub    $0x4,%esp
+    1973:	89 c3                	mov    %eax,%ebx
+    1975:	6a 05                	push   $0x5
+    1977:	68 63 53 00 00       	push   $0x5363
+    197c:	50                   	push   %eax
+    197d:	e8 01 2c 00 00       	call   4583 <write>
+  close(fd);
+    1982:	89 1c 24             	mov    %ebx,(%esp)
+    1985:	e8 01 2c 00 00       	call   458b <close>
+  fd = open("unlinkread", O_RDWR);
+    198a:	58                   	pop    %eax
+    198b:	5a                   	pop    %edx
+    198c:	6a 02                	push   $0x2
+    198e:	68 3e 53 00 00       	push   $0x533e
+    1993:	e8 0b 2c 00 00       	call   45a3 <open>
+  if(fd < 0){
+    1998:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    199b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    199d:	85 c0                	test   %eax,%eax
+    199f:	0f 88 10 01 00 00    	js     1ab5 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    19a5:	83 ec 0c             	sub    $0xc,%esp
+    19a8:	68 3e 53 00 00       	push   $0x533e
+    19ad:	e8 01 2c 00 00       	call   45b3 <unlink>
+    19b2:	83 c4 10             	add    $0x10,%esp
+    19b5:	85 c0                	test   %eax,%eax
+    19b7:	0f 85 e5 00 00 00    	jne    1aa2 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    19bd:	83 ec 08             	sub    $0x8,%esp
+    19c0:	68 02 02 00 00       	push   $0x202
+    19c5:	68 3e 53 00 00       	push   $0x533e
+    19ca:	e8 d4 2b 00 00       	call   45a3 <open>
+  write(fd1, "yyy", 3);
+    19cf:	83 c4 0c             	add    $0xc,%esp
+    19d2:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    19d4:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    19d6:	68 9b 53 00 00       	push   $0x539b
+    19db:	50                   	push   %eax
+    19dc:	e8 a2 2b 00 00       	call   4583 <write>
+  close(fd1);
+    19e1:	89 34 24             	mov    %esi,(%esp)
+    19e4:	e8 a2 2b 00 00       	call   458b <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    19e9:	83 c4 0c             	add    $0xc,%esp
+    19ec:	68 00 20 00 00       	push   $0x2000
+    19f1:	68 c0 9b 00 00       	push   $0x9bc0
+    19f6:	53                   	push   %ebx
+    19f7:	e8 7f 2b 00 00       	call   457b <read>
+    19fc:	83 c4 10             	add    $0x10,%esp
+    19ff:	83 f8 05             	cmp    $0x5,%eax
+    1a02:	0f 85 87 00 00 00    	jne    1a8f <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    1a08:	80 3d c0 9b 00 00 68 	cmpb   $0x68,0x9bc0
+    1a0f:	75 6b                	jne    1a7c <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    1a11:	83 ec 04             	sub    $0x4,%esp
+    1a14:	6a 0a                	push   $0xa
+    1a16:	68 c0 9b 00 00       	push   $0x9bc0
+    1a1b:	53                   	push   %ebx
+    1a1c:	e8 62 2b 00 00       	call   4583 <write>
+    1a21:	83 c4 10             	add    $0x10,%esp
+    1a24:	83 f8 0a             	cmp    $0xa,%eax
+    1a27:	75 40                	jne    1a69 <unlinkread+0x129>
+  close(fd);
+    1a29:	83 ec 0c             	sub    $0xc,%esp
+    1a2c:	53                   	push   %ebx
+    1a2d:	e8 59 2b 00 00       	call   458b <close>
+  unlink("unlinkread");
+    1a32:	c7 04 24 3e 53 00 00 	movl   $0x533e,(%esp)
+    1a39:	e8 75 2b 00 00       	call   45b3 <unlink>
+  printf(1, "unlinkread ok\n");
+    1a3e:	58                   	pop    %eax
+    1a3f:	5a                   	pop    %edx
+    1a40:	68 e6 53 00 00       	push   $0x53e6
+    1a45:	6a 01                	push   $0x1
+    1a47:	e8 94 2c 00 00       	call   46e0 <printf>
+}
+    1a4c:	83 c4 10             	add    $0x10,%esp
+    1a4f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    1a52:	5b                   	pop    %ebx
+    1a53:	5e                   	pop    %esi
+    1a54:	5d                   	pop    %ebp
+    1a55:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    1a56:	51                   	push   %ecx
+    1a57:	51                   	push   %ecx
+    1a58:	68 49 53 00 00       	push   $0x5349
+    1a5d:	6a 01                	push   $0x1
+    1a5f:	e8 7c 2c 00 00       	call   46e0 <printf>
+    exit();
+    1a64:	e8 fa 2a 00 00       	call   4563 <exit>
+    printf(1, "unlinkread write failed\n");
+    1a69:	51                   	push   %ecx
+    1a6a:	51                   	push   %ecx
+    1a6b:	68 cd 53 00 00       	push   $0x53cd
+    1a70:	6a 01                	push   $0x1
+    1a72:	e8 69 2c 00 00       	call   46e0 <printf>
+    exit();
+    1a77:	e8 e7 2a 00 00       	call   4563 <exit>
+    printf(1, "unlinkread wrong data\n");
+    1a7c:	53                   	push   %ebx
+    1a7d:	53                   	push   %ebx
+    1a7e:	68 b6 53 00 00       	push   $0x53b6
+    1a83:	6a 01                	push   $0x1
+    1a85:	e8 56 2c 00 00       	call   46e0 <printf>
+    exit();
+    1a8a:	e8 d4 2a 00 00       	call   4563 <exit>
+    printf(1, "unlinkread read failed");
+    1a8f:	56                   	push   %esi
+    1a90:	56                   	push   %esi
+    1a91:	68 9f 53 00 00       	push   $0x539f
+    1a96:	6a 01                	push   $0x1
+    1a98:	e8 43 2c 00 00       	call   46e0 <printf>
+    exit();
+    1a9d:	e8 c1 2a 00 00       	call   4563 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    1aa2:	50                   	push   %eax
+    1aa3:	50                   	push   %eax
+    1aa4:	68 81 53 00 00       	push   $0x5381
+    1aa9:	6a 01                	push   $0x1
+    1aab:	e8 30 2c 00 00       	call   46e0 <printf>
+    exit();
+    1ab0:	e8 ae 2a 00 00       	call   4563 <exit>
+    printf(1, "open unlinkread failed\n");
+    1ab5:	50                   	push   %eax
+    1ab6:	50                   	push   %eax
+    1ab7:	68 69 53 00 00       	push   $0x5369
+    1abc:	6a 01                	push   $0x1
+    1abe:	e8 1d 2c 00 00       	call   46e0 <printf>
+    exit();
+    1ac3:	e8 9b 2a 00 00       	call   4563 <exit>
+    1ac8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1acf:	90                   	nop
+
+00001ad0 <linktest>:
+{
+    1ad0:	55                   	push   %ebp
+    1ad1:	89 e5                	mov    %esp,%ebp
+    1ad3:	53                   	push   %ebx
+    1ad4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    1ad7:	68 f5 53 00 00       	push   $0x53f5
+    1adc:	6a 01                	push   $0x1
+    1ade:	e8 fd 2b 00 00       	call   46e0 <printf>
+  unlink("lf1");
+    1ae3:	c7 04 24 ff 53 00 00 	movl   $0x53ff,(%esp)
+    1aea:	e8 c4 2a 00 00       	call   45b3 <unlink>
+  unlink("lf2");
+    1aef:	c7 04 24 03 54 00 00 	movl   $0x5403,(%esp)
+    1af6:	e8 b8 2a 00 00       	call   45b3 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    1afb:	58                   	pop    %eax
+    1afc:	5a                   	pop    %edx
+    1afd:	68 02 02 00 00       	push   $0x202
+    1b02:	68 ff 53 00 00       	push   $0x53ff
+    1b07:	e8 97 2a 00 00       	call   45a3 <open>
+  if(fd < 0){
+    1b0c:	83 c4 10             	add    $0x10,%esp
+    1b0f:	85 c0                	test   %eax,%eax
+    1b11:	0f 88 1e 01 00 00    	js     1c35 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    1b17:	83 ec 04             	sub    $0x4,%esp
+    1b1a:	89 c3                	mov    %eax,%ebx
+    1b1c:	6a 05                	push   $0x5
+    1b1e:	68 63 53 00 00       	push   $0x5363
+    1b23:	50                   	push   %eax
+    1b24:	e8 5a 2a 00 00       	call   4583 <write>
+    1b29:	83 c4 10             	add    $0x10,%esp
+    1b2c:	83 f8 05             	cmp    $0x5,%eax
+    1b2f:	0f 85 98 01 00 00    	jne    1ccd <linktest+0x1fd>
+  close(fd);
+    1b35:	83 ec 0c             	sub    $0xc,%esp
+    1b38:	53                   	push   %ebx
+    1b39:	e8 4d 2a 00 00       	call   458b <close>
+  if(link("lf1", "lf2") < 0){
+    1b3e:	5b                   	pop    %ebx
+    1b3f:	58                   	pop    %eax
+    1b40:	68 03 54 00 00       	push   $0x5403
+    1b45:	68 ff 53 00 00       	push   $0x53ff
+    1b4a:	e8 74 2a 00 00       	call   45c3 <link>
+    1b4f:	83 c4 10             	add    $0x10,%esp
+    1b52:	85 c0                	test   %eax,%eax
+    1b54:	0f 88 60 01 00 00    	js     1cba <linktest+0x1ea>
+  unlink("lf1");
+    1b5a:	83 ec 0c             	sub    $0xc,%esp
+    1b5d:	68 ff 53 00 00       	push   $0x53ff
+    1b62:	e8 4c 2a 00 00       	call   45b3 <unlink>
+  if(open("lf1", 0) >= 0){
+    1b67:	58                   	pop    %eax
+    1b68:	5a                   	pop    %edx
+    1b69:	6a 00                	push   $0x0
+    1b6b:	68 ff 53 00 00       	push   $0x53ff
+    1b70:	e8 2e 2a 00 00       	call   45a3 <open>
+    1b75:	83 c4 10             	add    $0x10,%esp
+    1b78:	85 c0                	test   %eax,%eax
+    1b7a:	0f 89 27 01 00 00    	jns    1ca7 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    1b80:	83 ec 08             	sub    $0x8,%esp
+    1b83:	6a 00                	push   $0x0
+    1b85:	68 03 54 00 00       	push   $0x5403
+    1b8a:	e8 14 2a 00 00       	call   45a3 <open>
+  if(fd < 0){
+    1b8f:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    1b92:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1b94:	85 c0                	test   %eax,%eax
+    1b96:	0f 88 f8 00 00 00    	js     1c94 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    1b9c:	83 ec 04             	sub    $0x4,%esp
+    1b9f:	68 00 20 00 00       	push   $0x2000
+    1ba4:	68 c0 9b 00 00       	push   $0x9bc0
+    1ba9:	50                   	push   %eax
+    1baa:	e8 cc 29 00 00       	call   457b <read>
+    1baf:	83 c4 10             	add    $0x10,%esp
+    1bb2:	83 f8 05             	cmp    $0x5,%eax
+    1bb5:	0f 85 c6 00 00 00    	jne    1c81 <linktest+0x1b1>
+  close(fd);
+    1bbb:	83 ec 0c             	sub    $0xc,%esp
+    1bbe:	53                   	push   %ebx
+    1bbf:	e8 c7 29 00 00       	call   458b <close>
+  if(link("lf2", "lf2") >= 0){
+    1bc4:	58                   	pop    %eax
+    1bc5:	5a                   	pop    %edx
+    1bc6:	68 03 54 00 00       	push   $0x5403
+    1bcb:	68 03 54 00 00       	push   $0x5403
+    1bd0:	e8 ee 29 00 00       	call   45c3 <link>
+    1bd5:	83 c4 10             	add    $0x10,%esp
+    1bd8:	85 c0                	test   %eax,%eax
+    1bda:	0f 89 8e 00 00 00    	jns    1c6e <linktest+0x19e>
+  unlink("lf2");
+    1be0:	83 ec 0c             	sub    $0xc,%esp
+    1be3:	68 03 54 00 00       	push   $0x5403
+    1be8:	e8 c6 29 00 00       	call   45b3 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    1bed:	59                   	pop    %ecx
+    1bee:	5b                   	pop    %ebx
+    1bef:	68 ff 53 00 00       	push   $0x53ff
+    1bf4:	68 03 54 00 00       	push   $0x5403
+    1bf9:	e8 c5 29 00 00       	call   45c3 <link>
+    1bfe:	83 c4 10             	add    $0x10,%esp
+    1c01:	85 c0                	test   %eax,%eax
+    1c03:	79 56                	jns    1c5b <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    1c05:	83 ec 08             	sub    $0x8,%esp
+    1c08:	68 ff 53 00 00       	push   $0x53ff
+    1c0d:	68 c7 56 00 00       	push   $0x56c7
+    1c12:	e8 ac 29 00 00       	call   45c3 <link>
+    1c17:	83 c4 10             	add    $0x10,%esp
+    1c1a:	85 c0                	test   %eax,%eax
+    1c1c:	79 2a                	jns    1c48 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    1c1e:	83 ec 08             	sub    $0x8,%esp
+    1c21:	68 9d 54 00 00       	push   $0x549d
+    1c26:	6a 01                	push   $0x1
+    1c28:	e8 b3 2a 00 00       	call   46e0 <printf>
+}
+    1c2d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1c30:	83 c4 10             	add    $0x10,%esp
+    1c33:	c9                   	leave
+    1c34:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    1c35:	50                   	push   %eax
+    1c36:	50                   	push   %eax
+    1c37:	68 07 54 00 00       	push   $0x5407
+    1c3c:	6a 01                	push   $0x1
+    1c3e:	e8 9d 2a 00 00       	call   46e0 <printf>
+    exit();
+    1c43:	e8 1b 29 00 00       	call   4563 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    1c48:	50                   	push   %eax
+    1c49:	50                   	push   %eax
+    1c4a:	68 81 54 00 00       	push   $0x5481
+    1c4f:	6a 01                	push   $0x1
+    1c51:	e8 8a 2a 00 00       	call   46e0 <printf>
+    exit();
+    1c56:	e8 08 29 00 00       	call   4563 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    1c5b:	52                   	push   %edx
+    1c5c:	52                   	push   %edx
+    1c5d:	68 34 62 00 00       	push   $0x6234
+    1c62:	6a 01                	push   $0x1
+    1c64:	e8 77 2a 00 00       	call   46e0 <printf>
+    exit();
+    1c69:	e8 f5 28 00 00       	call   4563 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    1c6e:	50                   	push   %eax
+    1c6f:	50                   	push   %eax
+    1c70:	68 63 54 00 00       	push   $0x5463
+    1c75:	6a 01                	push   $0x1
+    1c77:	e8 64 2a 00 00       	call   46e0 <printf>
+    exit();
+    1c7c:	e8 e2 28 00 00       	call   4563 <exit>
+    printf(1, "read lf2 failed\n");
+    1c81:	51                   	push   %ecx
+    1c82:	51                   	push   %ecx
+    1c83:	68 52 54 00 00       	push   $0x5452
+    1c88:	6a 01                	push   $0x1
+    1c8a:	e8 51 2a 00 00       	call   46e0 <printf>
+    exit();
+    1c8f:	e8 cf 28 00 00       	call   4563 <exit>
+    printf(1, "open lf2 failed\n");
+    1c94:	53                   	push   %ebx
+    1c95:	53                   	push   %ebx
+    1c96:	68 41 54 00 00       	push   $0x5441
+    1c9b:	6a 01                	push   $0x1
+    1c9d:	e8 3e 2a 00 00       	call   46e0 <printf>
+    exit();
+    1ca2:	e8 bc 28 00 00       	call   4563 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    1ca7:	50                   	push   %eax
+    1ca8:	50                   	push   %eax
+    1ca9:	68 0c 62 00 00       	push   $0x620c
+    1cae:	6a 01                	push   $0x1
+    1cb0:	e8 2b 2a 00 00       	call   46e0 <printf>
+    exit();
+    1cb5:	e8 a9 28 00 00       	call   4563 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    1cba:	51                   	push   %ecx
+    1cbb:	51                   	push   %ecx
+    1cbc:	68 2c 54 00 00       	push   $0x542c
+    1cc1:	6a 01                	push   $0x1
+    1cc3:	e8 18 2a 00 00       	call   46e0 <printf>
+    exit();
+    1cc8:	e8 96 28 00 00       	call   4563 <exit>
+    printf(1, "write lf1 failed\n");
+    1ccd:	50                   	push   %eax
+    1cce:	50                   	push   %eax
+    1ccf:	68 1a 54 00 00       	push   $0x541a
+    1cd4:	6a 01                	push   $0x1
+    1cd6:	e8 05 2a 00 00       	call   46e0 <printf>
+    exit();
+    1cdb:	e8 83 28 00 00       	call   4563 <exit>
+
+00001ce0 <concreate>:
+{
+    1ce0:	55                   	push   %ebp
+    1ce1:	89 e5                	mov    %esp,%ebp
+    1ce3:	57                   	push   %edi
+    1ce4:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+    1ce5:	31 f6                	xor    %esi,%esi
+{
+    1ce7:	53                   	push   %ebx
+    1ce8:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+    1ceb:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+    1cee:	68 aa 54 00 00       	push   $0x54aa
+    1cf3:	6a 01                	push   $0x1
+    1cf5:	e8 e6 29 00 00       	call   46e0 <printf>
+  file[0] = 'C';
+    1cfa:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+    1cfe:	83 c4 10             	add    $0x10,%esp
+    1d01:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+    1d05:	eb 4c                	jmp    1d53 <concreate+0x73>
+    1d07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1d0e:	66 90                	xchg   %ax,%ax
+    1d10:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+    1d16:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+    1d1b:	0f 83 8f 00 00 00    	jae    1db0 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+    1d21:	83 ec 08             	sub    $0x8,%esp
+    1d24:	68 02 02 00 00       	push   $0x202
+    1d29:	53                   	push   %ebx
+    1d2a:	e8 74 28 00 00       	call   45a3 <open>
+      if(fd < 0){
+    1d2f:	83 c4 10             	add    $0x10,%esp
+    1d32:	85 c0                	test   %eax,%eax
+    1d34:	78 63                	js     1d99 <concreate+0xb9>
+      close(fd);
+    1d36:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+    1d39:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+    1d3c:	50                   	push   %eax
+    1d3d:	e8 49 28 00 00       	call   458b <close>
+    1d42:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1d45:	e8 21 28 00 00       	call   456b <wait>
+  for(i = 0; i < 40; i++){
+    1d4a:	83 fe 28             	cmp    $0x28,%esi
+    1d4d:	0f 84 7f 00 00 00    	je     1dd2 <concreate+0xf2>
+    unlink(file);
+    1d53:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+    1d56:	8d 46 30             	lea    0x30(%esi),%eax
+    1d59:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+    1d5c:	53                   	push   %ebx
+    1d5d:	e8 51 28 00 00       	call   45b3 <unlink>
+    pid = fork();
+    1d62:	e8 f4 27 00 00       	call   455b <fork>
+    if(pid && (i % 3) == 1){
+    1d67:	83 c4 10             	add    $0x10,%esp
+    1d6a:	85 c0                	test   %eax,%eax
+    1d6c:	75 a2                	jne    1d10 <concreate+0x30>
+      link("C0", file);
+    1d6e:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+    1d74:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+    1d7a:	0f 83 d0 00 00 00    	jae    1e50 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+    1d80:	83 ec 08             	sub    $0x8,%esp
+    1d83:	68 02 02 00 00       	push   $0x202
+    1d88:	53                   	push   %ebx
+    1d89:	e8 15 28 00 00       	call   45a3 <open>
+      if(fd < 0){
+    1d8e:	83 c4 10             	add    $0x10,%esp
+    1d91:	85 c0                	test   %eax,%eax
+    1d93:	0f 89 ea 01 00 00    	jns    1f83 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+    1d99:	83 ec 04             	sub    $0x4,%esp
+    1d9c:	53                   	push   %ebx
+    1d9d:	68 bd 54 00 00       	push   $0x54bd
+    1da2:	6a 01                	push   $0x1
+    1da4:	e8 37 29 00 00       	call   46e0 <printf>
+        exit();
+    1da9:	e8 b5 27 00 00       	call   4563 <exit>
+    1dae:	66 90                	xchg   %ax,%ax
+      link("C0", file);
+    1db0:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+    1db3:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+    1db6:	53                   	push   %ebx
+    1db7:	68 ba 54 00 00       	push   $0x54ba
+    1dbc:	e8 02 28 00 00       	call   45c3 <link>
+    1dc1:	83 c4 10             	add    $0x10,%esp
+      wait();
+    1dc4:	e8 a2 27 00 00       	call   456b <wait>
+  for(i = 0; i < 40; i++){
+    1dc9:	83 fe 28             	cmp    $0x28,%esi
+    1dcc:	0f 85 81 ff ff ff    	jne    1d53 <concreate+0x73>
+  memset(fa, 0, sizeof(fa));
+    1dd2:	83 ec 04             	sub    $0x4,%esp
+    1dd5:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    1dd8:	6a 28                	push   $0x28
+    1dda:	6a 00                	push   $0x0
+    1ddc:	50                   	push   %eax
+    1ddd:	e8 fe 25 00 00       	call   43e0 <memset>
+  fd = open(".", 0);
+    1de2:	5e                   	pop    %esi
+    1de3:	5f                   	pop    %edi
+    1de4:	6a 00                	push   $0x0
+    1de6:	68 c7 56 00 00       	push   $0x56c7
+    1deb:	8d 7d b0             	lea    -0x50(%ebp),%edi
+    1dee:	e8 b0 27 00 00       	call   45a3 <open>
+  n = 0;
+    1df3:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    1dfa:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    1dfd:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+    1dff:	90                   	nop
+    1e00:	83 ec 04             	sub    $0x4,%esp
+    1e03:	6a 10                	push   $0x10
+    1e05:	57                   	push   %edi
+    1e06:	56                   	push   %esi
+    1e07:	e8 6f 27 00 00       	call   457b <read>
+    1e0c:	83 c4 10             	add    $0x10,%esp
+    1e0f:	85 c0                	test   %eax,%eax
+    1e11:	7e 5d                	jle    1e70 <concreate+0x190>
+    if(de.inum == 0)
+    1e13:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+    1e18:	74 e6                	je     1e00 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    1e1a:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+    1e1e:	75 e0                	jne    1e00 <concreate+0x120>
+    1e20:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+    1e24:	75 da                	jne    1e00 <concreate+0x120>
+      i = de.name[1] - '0';
+    1e26:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+    1e2a:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+    1e2d:	83 f8 27             	cmp    $0x27,%eax
+    1e30:	0f 87 5e 01 00 00    	ja     1f94 <concreate+0x2b4>
+      if(fa[i]){
+    1e36:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+    1e3b:	0f 85 7e 01 00 00    	jne    1fbf <concreate+0x2df>
+      n++;
+    1e41:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+    1e45:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+    1e4a:	eb b4                	jmp    1e00 <concreate+0x120>
+    1e4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+    1e50:	83 ec 08             	sub    $0x8,%esp
+    1e53:	53                   	push   %ebx
+    1e54:	68 ba 54 00 00       	push   $0x54ba
+    1e59:	e8 65 27 00 00       	call   45c3 <link>
+    1e5e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1e61:	e8 fd 26 00 00       	call   4563 <exit>
+    1e66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e6d:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    1e70:	83 ec 0c             	sub    $0xc,%esp
+    1e73:	56                   	push   %esi
+    1e74:	e8 12 27 00 00       	call   458b <close>
+  if(n != 40){
+    1e79:	83 c4 10             	add    $0x10,%esp
+    1e7c:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    1e80:	0f 85 26 01 00 00    	jne    1fac <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    1e86:	31 f6                	xor    %esi,%esi
+    1e88:	eb 48                	jmp    1ed2 <concreate+0x1f2>
+    1e8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    1e90:	85 ff                	test   %edi,%edi
+    1e92:	74 05                	je     1e99 <concreate+0x1b9>
+    1e94:	83 f8 01             	cmp    $0x1,%eax
+    1e97:	74 68                	je     1f01 <concreate+0x221>
+      unlink(file);
+    1e99:	83 ec 0c             	sub    $0xc,%esp
+    1e9c:	53                   	push   %ebx
+    1e9d:	e8 11 27 00 00       	call   45b3 <unlink>
+      unlink(file);
+    1ea2:	89 1c 24             	mov    %ebx,(%esp)
+    1ea5:	e8 09 27 00 00       	call   45b3 <unlink>
+      unlink(file);
+    1eaa:	89 1c 24             	mov    %ebx,(%esp)
+    1ead:	e8 01 27 00 00       	call   45b3 <unlink>
+      unlink(file);
+    1eb2:	89 1c 24             	mov    %ebx,(%esp)
+    1eb5:	e8 f9 26 00 00       	call   45b3 <unlink>
+    1eba:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    1ebd:	85 ff                	test   %edi,%edi
+    1ebf:	74 a0                	je     1e61 <concreate+0x181>
+      wait();
+    1ec1:	e8 a5 26 00 00       	call   456b <wait>
+  for(i = 0; i < 40; i++){
+    1ec6:	83 c6 01             	add    $0x1,%esi
+    1ec9:	83 fe 28             	cmp    $0x28,%esi
+    1ecc:	0f 84 86 00 00 00    	je     1f58 <concreate+0x278>
+    file[1] = '0' + i;
+    1ed2:	8d 46 30             	lea    0x30(%esi),%eax
+    1ed5:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    1ed8:	e8 7e 26 00 00       	call   455b <fork>
+    1edd:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    1edf:	85 c0                	test   %eax,%eax
+    1ee1:	0f 88 88 00 00 00    	js     1f6f <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    1ee7:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    1eec:	f7 e6                	mul    %esi
+    1eee:	89 d0                	mov    %edx,%eax
+    1ef0:	83 e2 fe             	and    $0xfffffffe,%edx
+    1ef3:	d1 e8                	shr    %eax
+    1ef5:	01 c2                	add    %eax,%edx
+    1ef7:	89 f0                	mov    %esi,%eax
+    1ef9:	29 d0                	sub    %edx,%eax
+    1efb:	89 c1                	mov    %eax,%ecx
+    1efd:	09 f9                	or     %edi,%ecx
+    1eff:	75 8f                	jne    1e90 <concreate+0x1b0>
+      close(open(file, 0));
+    1f01:	83 ec 08             	sub    $0x8,%esp
+    1f04:	6a 00                	push   $0x0
+    1f06:	53                   	push   %ebx
+    1f07:	e8 97 26 00 00       	call   45a3 <open>
+    1f0c:	89 04 24             	mov    %eax,(%esp)
+    1f0f:	e8 77 26 00 00       	call   458b <close>
+      close(open(file, 0));
+    1f14:	58                   	pop    %eax
+    1f15:	5a                   	pop    %edx
+    1f16:	6a 00                	push   $0x0
+    1f18:	53                   	push   %ebx
+    1f19:	e8 85 26 00 00       	call   45a3 <open>
+    1f1e:	89 04 24             	mov    %eax,(%esp)
+    1f21:	e8 65 26 00 00       	call   458b <close>
+      close(open(file, 0));
+    1f26:	59                   	pop    %ecx
+    1f27:	58                   	pop    %eax
+    1f28:	6a 00                	push   $0x0
+    1f2a:	53                   	push   %ebx
+    1f2b:	e8 73 26 00 00       	call   45a3 <open>
+    1f30:	89 04 24             	mov    %eax,(%esp)
+    1f33:	e8 53 26 00 00       	call   458b <close>
+      close(open(file, 0));
+    1f38:	58                   	pop    %eax
+    1f39:	5a                   	pop    %edx
+    1f3a:	6a 00                	push   $0x0
+    1f3c:	53                   	push   %ebx
+    1f3d:	e8 61 26 00 00       	call   45a3 <open>
+    1f42:	89 04 24             	mov    %eax,(%esp)
+    1f45:	e8 41 26 00 00       	call   458b <close>
+    1f4a:	83 c4 10             	add    $0x10,%esp
+    1f4d:	e9 6b ff ff ff       	jmp    1ebd <concreate+0x1dd>
+    1f52:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    1f58:	83 ec 08             	sub    $0x8,%esp
+    1f5b:	68 0f 55 00 00       	push   $0x550f
+    1f60:	6a 01                	push   $0x1
+    1f62:	e8 79 27 00 00       	call   46e0 <printf>
+}
+    1f67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1f6a:	5b                   	pop    %ebx
+    1f6b:	5e                   	pop    %esi
+    1f6c:	5f                   	pop    %edi
+    1f6d:	5d                   	pop    %ebp
+    1f6e:	c3                   	ret
+      printf(1, "fork failed\n");
+    1f6f:	83 ec 08             	sub    $0x8,%esp
+    1f72:	68 27 5f 00 00       	push   $0x5f27
+    1f77:	6a 01                	push   $0x1
+    1f79:	e8 62 27 00 00       	call   46e0 <printf>
+      exit();
+    1f7e:	e8 e0 25 00 00       	call   4563 <exit>
+      close(fd);
+    1f83:	83 ec 0c             	sub    $0xc,%esp
+    1f86:	50                   	push   %eax
+    1f87:	e8 ff 25 00 00       	call   458b <close>
+    1f8c:	83 c4 10             	add    $0x10,%esp
+    1f8f:	e9 cd fe ff ff       	jmp    1e61 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    1f94:	83 ec 04             	sub    $0x4,%esp
+    1f97:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1f9a:	50                   	push   %eax
+    1f9b:	68 d9 54 00 00       	push   $0x54d9
+    1fa0:	6a 01                	push   $0x1
+    1fa2:	e8 39 27 00 00       	call   46e0 <printf>
+        exit();
+    1fa7:	e8 b7 25 00 00       	call   4563 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    1fac:	51                   	push   %ecx
+    1fad:	51                   	push   %ecx
+    1fae:	68 58 62 00 00       	push   $0x6258
+    1fb3:	6a 01                	push   $0x1
+    1fb5:	e8 26 27 00 00       	call   46e0 <printf>
+    exit();
+    1fba:	e8 a4 25 00 00       	call   4563 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    1fbf:	83 ec 04             	sub    $0x4,%esp
+    1fc2:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1fc5:	50                   	push   %eax
+    1fc6:	68 f2 54 00 00       	push   $0x54f2
+    1fcb:	6a 01                	push   $0x1
+    1fcd:	e8 0e 27 00 00       	call   46e0 <printf>
+        exit();
+    1fd2:	e8 8c 25 00 00       	call   4563 <exit>
+    1fd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1fde:	66 90                	xchg   %ax,%ax
+
+00001fe0 <linkunlink>:
+{
+    1fe0:	55                   	push   %ebp
+    1fe1:	89 e5                	mov    %esp,%ebp
+    1fe3:	57                   	push   %edi
+    1fe4:	56                   	push   %esi
+    1fe5:	53                   	push   %ebx
+    1fe6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    1fe9:	68 1d 55 00 00       	push   $0x551d
+    1fee:	6a 01                	push   $0x1
+    1ff0:	e8 eb 26 00 00       	call   46e0 <printf>
+  unlink("x");
+    1ff5:	c7 04 24 16 5c 00 00 	movl   $0x5c16,(%esp)
+    1ffc:	e8 b2 25 00 00       	call   45b3 <unlink>
+  pid = fork();
+    2001:	e8 55 25 00 00       	call   455b <fork>
+  if(pid < 0){
+    2006:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    2009:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    200c:	85 c0                	test   %eax,%eax
+    200e:	0f 88 b6 00 00 00    	js     20ca <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    2014:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    2018:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    201d:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    2022:	19 ff                	sbb    %edi,%edi
+    2024:	83 e7 60             	and    $0x60,%edi
+    2027:	83 c7 01             	add    $0x1,%edi
+    202a:	eb 1e                	jmp    204a <linkunlink+0x6a>
+    202c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    2030:	83 f8 01             	cmp    $0x1,%eax
+    2033:	74 7b                	je     20b0 <linkunlink+0xd0>
+      unlink("x");
+    2035:	83 ec 0c             	sub    $0xc,%esp
+    2038:	68 16 5c 00 00       	push   $0x5c16
+    203d:	e8 71 25 00 00       	call   45b3 <unlink>
+    2042:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    2045:	83 eb 01             	sub    $0x1,%ebx
+    2048:	74 41                	je     208b <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    204a:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    2050:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    2056:	89 f8                	mov    %edi,%eax
+    2058:	f7 e6                	mul    %esi
+    205a:	89 d0                	mov    %edx,%eax
+    205c:	83 e2 fe             	and    $0xfffffffe,%edx
+    205f:	d1 e8                	shr    %eax
+    2061:	01 c2                	add    %eax,%edx
+    2063:	89 f8                	mov    %edi,%eax
+    2065:	29 d0                	sub    %edx,%eax
+    2067:	75 c7                	jne    2030 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    2069:	83 ec 08             	sub    $0x8,%esp
+    206c:	68 02 02 00 00       	push   $0x202
+    2071:	68 16 5c 00 00       	push   $0x5c16
+    2076:	e8 28 25 00 00       	call   45a3 <open>
+    207b:	89 04 24             	mov    %eax,(%esp)
+    207e:	e8 08 25 00 00       	call   458b <close>
+    2083:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    2086:	83 eb 01             	sub    $0x1,%ebx
+    2089:	75 bf                	jne    204a <linkunlink+0x6a>
+  if(pid)
+    208b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    208e:	85 c0                	test   %eax,%eax
+    2090:	74 4b                	je     20dd <linkunlink+0xfd>
+    wait();
+    2092:	e8 d4 24 00 00       	call   456b <wait>
+  printf(1, "linkunlink ok\n");
+    2097:	83 ec 08             	sub    $0x8,%esp
+    209a:	68 32 55 00 00       	push   $0x5532
+    209f:	6a 01                	push   $0x1
+    20a1:	e8 3a 26 00 00       	call   46e0 <printf>
+}
+    20a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    20a9:	5b                   	pop    %ebx
+    20aa:	5e                   	pop    %esi
+    20ab:	5f                   	pop    %edi
+    20ac:	5d                   	pop    %ebp
+    20ad:	c3                   	ret
+    20ae:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    20b0:	83 ec 08             	sub    $0x8,%esp
+    20b3:	68 16 5c 00 00       	push   $0x5c16
+    20b8:	68 2e 55 00 00       	push   $0x552e
+    20bd:	e8 01 25 00 00       	call   45c3 <link>
+    20c2:	83 c4 10             	add    $0x10,%esp
+    20c5:	e9 7b ff ff ff       	jmp    2045 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    20ca:	52                   	push   %edx
+    20cb:	52                   	push   %edx
+    20cc:	68 27 5f 00 00       	push   $0x5f27
+    20d1:	6a 01                	push   $0x1
+    20d3:	e8 08 26 00 00       	call   46e0 <printf>
+    exit();
+    20d8:	e8 86 24 00 00       	call   4563 <exit>
+    exit();
+    20dd:	e8 81 24 00 00       	call   4563 <exit>
+    20e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    20e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000020f0 <bigdir>:
+{
+    20f0:	55                   	push   %ebp
+    20f1:	89 e5                	mov    %esp,%ebp
+    20f3:	57                   	push   %edi
+    20f4:	56                   	push   %esi
+    20f5:	53                   	push   %ebx
+    20f6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    20f9:	68 41 55 00 00       	push   $0x5541
+    20fe:	6a 01                	push   $0x1
+    2100:	e8 db 25 00 00       	call   46e0 <printf>
+  unlink("bd");
+    2105:	c7 04 24 4e 55 00 00 	movl   $0x554e,(%esp)
+    210c:	e8 a2 24 00 00       	call   45b3 <unlink>
+  fd = open("bd", O_CREATE);
+    2111:	5a                   	pop    %edx
+    2112:	59                   	pop    %ecx
+    2113:	68 00 02 00 00       	push   $0x200
+    2118:	68 4e 55 00 00       	push   $0x554e
+    211d:	e8 81 24 00 00       	call   45a3 <open>
+  if(fd < 0){
+    2122:	83 c4 10             	add    $0x10,%esp
+    2125:	85 c0                	test   %eax,%eax
+    2127:	0f 88 de 00 00 00    	js     220b <bigdir+0x11b>
+  close(fd);
+    212d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    2130:	31 f6                	xor    %esi,%esi
+    2132:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    2135:	50                   	push   %eax
+    2136:	e8 50 24 00 00       	call   458b <close>
+    213b:	83 c4 10             	add    $0x10,%esp
+    213e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    2140:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    2142:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    2145:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    2149:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    214c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    2150:	83 c0 30             	add    $0x30,%eax
+    2153:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    2156:	89 f0                	mov    %esi,%eax
+    2158:	83 e0 3f             	and    $0x3f,%eax
+    215b:	83 c0 30             	add    $0x30,%eax
+    215e:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    2161:	57                   	push   %edi
+    2162:	68 4e 55 00 00       	push   $0x554e
+    2167:	e8 57 24 00 00       	call   45c3 <link>
+    216c:	83 c4 10             	add    $0x10,%esp
+    216f:	89 c3                	mov    %eax,%ebx
+    2171:	85 c0                	test   %eax,%eax
+    2173:	75 6e                	jne    21e3 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    2175:	83 c6 01             	add    $0x1,%esi
+    2178:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    217e:	75 c0                	jne    2140 <bigdir+0x50>
+  unlink("bd");
+    2180:	83 ec 0c             	sub    $0xc,%esp
+    2183:	68 4e 55 00 00       	push   $0x554e
+    2188:	e8 26 24 00 00       	call   45b3 <unlink>
+    218d:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    2190:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    2192:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    2195:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    2199:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    219c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    21a0:	83 c0 30             	add    $0x30,%eax
+    21a3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    21a6:	89 d8                	mov    %ebx,%eax
+    21a8:	83 e0 3f             	and    $0x3f,%eax
+    21ab:	83 c0 30             	add    $0x30,%eax
+    21ae:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    21b1:	57                   	push   %edi
+    21b2:	e8 fc 23 00 00       	call   45b3 <unlink>
+    21b7:	83 c4 10             	add    $0x10,%esp
+    21ba:	85 c0                	test   %eax,%eax
+    21bc:	75 39                	jne    21f7 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    21be:	83 c3 01             	add    $0x1,%ebx
+    21c1:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    21c7:	75 c7                	jne    2190 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    21c9:	83 ec 08             	sub    $0x8,%esp
+    21cc:	68 90 55 00 00       	push   $0x5590
+    21d1:	6a 01                	push   $0x1
+    21d3:	e8 08 25 00 00       	call   46e0 <printf>
+    21d8:	83 c4 10             	add    $0x10,%esp
+}
+    21db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    21de:	5b                   	pop    %ebx
+    21df:	5e                   	pop    %esi
+    21e0:	5f                   	pop    %edi
+    21e1:	5d                   	pop    %ebp
+    21e2:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    21e3:	83 ec 08             	sub    $0x8,%esp
+    21e6:	68 67 55 00 00       	push   $0x5567
+    21eb:	6a 01                	push   $0x1
+    21ed:	e8 ee 24 00 00       	call   46e0 <printf>
+      exit();
+    21f2:	e8 6c 23 00 00       	call   4563 <exit>
+      printf(1, "bigdir unlink failed");
+    21f7:	83 ec 08             	sub    $0x8,%esp
+    21fa:	68 7b 55 00 00       	push   $0x557b
+    21ff:	6a 01                	push   $0x1
+    2201:	e8 da 24 00 00       	call   46e0 <printf>
+      exit();
+    2206:	e8 58 23 00 00       	call   4563 <exit>
+    printf(1, "bigdir create failed\n");
+    220b:	50                   	push   %eax
+    220c:	50                   	push   %eax
+    220d:	68 51 55 00 00       	push   $0x5551
+    2212:	6a 01                	push   $0x1
+    2214:	e8 c7 24 00 00       	call   46e0 <printf>
+    exit();
+    2219:	e8 45 23 00 00       	call   4563 <exit>
+    221e:	66 90                	xchg   %ax,%ax
+
+00002220 <subdir>:
+{
+    2220:	55                   	push   %ebp
+    2221:	89 e5                	mov    %esp,%ebp
+    2223:	53                   	push   %ebx
+    2224:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    2227:	68 9b 55 00 00       	push   $0x559b
+    222c:	6a 01                	push   $0x1
+    222e:	e8 ad 24 00 00       	call   46e0 <printf>
+  unlink("ff");
+    2233:	c7 04 24 24 56 00 00 	movl   $0x5624,(%esp)
+    223a:	e8 74 23 00 00       	call   45b3 <unlink>
+  if(mkdir("dd") != 0){
+    223f:	c7 04 24 c1 56 00 00 	movl   $0x56c1,(%esp)
+    2246:	e8 80 23 00 00       	call   45cb <mkdir>
+    224b:	83 c4 10             	add    $0x10,%esp
+    224e:	85 c0                	test   %eax,%eax
+    2250:	0f 85 b3 05 00 00    	jne    2809 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    2256:	83 ec 08             	sub    $0x8,%esp
+    2259:	68 02 02 00 00       	push   $0x202
+    225e:	68 fa 55 00 00       	push   $0x55fa
+    2263:	e8 3b 23 00 00       	call   45a3 <open>
+  if(fd < 0){
+    2268:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    226b:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    226d:	85 c0                	test   %eax,%eax
+    226f:	0f 88 81 05 00 00    	js     27f6 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    2275:	83 ec 04             	sub    $0x4,%esp
+    2278:	6a 02                	push   $0x2
+    227a:	68 24 56 00 00       	push   $0x5624
+    227f:	50                   	push   %eax
+    2280:	e8 fe 22 00 00       	call   4583 <write>
+  close(fd);
+    2285:	89 1c 24             	mov    %ebx,(%esp)
+    2288:	e8 fe 22 00 00       	call   458b <close>
+  if(unlink("dd") >= 0){
+    228d:	c7 04 24 c1 56 00 00 	movl   $0x56c1,(%esp)
+    2294:	e8 1a 23 00 00       	call   45b3 <unlink>
+    2299:	83 c4 10             	add    $0x10,%esp
+    229c:	85 c0                	test   %eax,%eax
+    229e:	0f 89 3f 05 00 00    	jns    27e3 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    22a4:	83 ec 0c             	sub    $0xc,%esp
+    22a7:	68 d5 55 00 00       	push   $0x55d5
+    22ac:	e8 1a 23 00 00       	call   45cb <mkdir>
+    22b1:	83 c4 10             	add    $0x10,%esp
+    22b4:	85 c0                	test   %eax,%eax
+    22b6:	0f 85 14 05 00 00    	jne    27d0 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    22bc:	83 ec 08             	sub    $0x8,%esp
+    22bf:	68 02 02 00 00       	push   $0x202
+    22c4:	68 f7 55 00 00       	push   $0x55f7
+    22c9:	e8 d5 22 00 00       	call   45a3 <open>
+  if(fd < 0){
+    22ce:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    22d1:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    22d3:	85 c0                	test   %eax,%eax
+    22d5:	0f 88 24 04 00 00    	js     26ff <subdir+0x4df>
+  write(fd, "FF", 2);
+    22db:	83 ec 04             	sub    $0x4,%esp
+    22de:	6a 02                	push   $0x2
+    22e0:	68 18 56 00 00       	push   $0x5618
+    22e5:	50                   	push   %eax
+    22e6:	e8 98 22 00 00       	call   4583 <write>
+  close(fd);
+    22eb:	89 1c 24             	mov    %ebx,(%esp)
+    22ee:	e8 98 22 00 00       	call   458b <close>
+  fd = open("dd/dd/../ff", 0);
+    22f3:	58                   	pop    %eax
+    22f4:	5a                   	pop    %edx
+    22f5:	6a 00                	push   $0x0
+    22f7:	68 1b 56 00 00       	push   $0x561b
+    22fc:	e8 a2 22 00 00       	call   45a3 <open>
+  if(fd < 0){
+    2301:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    2304:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2306:	85 c0                	test   %eax,%eax
+    2308:	0f 88 de 03 00 00    	js     26ec <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    230e:	83 ec 04             	sub    $0x4,%esp
+    2311:	68 00 20 00 00       	push   $0x2000
+    2316:	68 c0 9b 00 00       	push   $0x9bc0
+    231b:	50                   	push   %eax
+    231c:	e8 5a 22 00 00       	call   457b <read>
+  if(cc != 2 || buf[0] != 'f'){
+    2321:	83 c4 10             	add    $0x10,%esp
+    2324:	83 f8 02             	cmp    $0x2,%eax
+    2327:	0f 85 3a 03 00 00    	jne    2667 <subdir+0x447>
+    232d:	80 3d c0 9b 00 00 66 	cmpb   $0x66,0x9bc0
+    2334:	0f 85 2d 03 00 00    	jne    2667 <subdir+0x447>
+  close(fd);
+    233a:	83 ec 0c             	sub    $0xc,%esp
+    233d:	53                   	push   %ebx
+    233e:	e8 48 22 00 00       	call   458b <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    2343:	59                   	pop    %ecx
+    2344:	5b                   	pop    %ebx
+    2345:	68 5b 56 00 00       	push   $0x565b
+    234a:	68 f7 55 00 00       	push   $0x55f7
+    234f:	e8 6f 22 00 00       	call   45c3 <link>
+    2354:	83 c4 10             	add    $0x10,%esp
+    2357:	85 c0                	test   %eax,%eax
+    2359:	0f 85 c6 03 00 00    	jne    2725 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    235f:	83 ec 0c             	sub    $0xc,%esp
+    2362:	68 f7 55 00 00       	push   $0x55f7
+    2367:	e8 47 22 00 00       	call   45b3 <unlink>
+    236c:	83 c4 10             	add    $0x10,%esp
+    236f:	85 c0                	test   %eax,%eax
+    2371:	0f 85 16 03 00 00    	jne    268d <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2377:	83 ec 08             	sub    $0x8,%esp
+    237a:	6a 00                	push   $0x0
+    237c:	68 f7 55 00 00       	push   $0x55f7
+    2381:	e8 1d 22 00 00       	call   45a3 <open>
+    2386:	83 c4 10             	add    $0x10,%esp
+    2389:	85 c0                	test   %eax,%eax
+    238b:	0f 89 2c 04 00 00    	jns    27bd <subdir+0x59d>
+  if(chdir("dd") != 0){
+    2391:	83 ec 0c             	sub    $0xc,%esp
+    2394:	68 c1 56 00 00       	push   $0x56c1
+    2399:	e8 35 22 00 00       	call   45d3 <chdir>
+    239e:	83 c4 10             	add    $0x10,%esp
+    23a1:	85 c0                	test   %eax,%eax
+    23a3:	0f 85 01 04 00 00    	jne    27aa <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    23a9:	83 ec 0c             	sub    $0xc,%esp
+    23ac:	68 8f 56 00 00       	push   $0x568f
+    23b1:	e8 1d 22 00 00       	call   45d3 <chdir>
+    23b6:	83 c4 10             	add    $0x10,%esp
+    23b9:	85 c0                	test   %eax,%eax
+    23bb:	0f 85 b9 02 00 00    	jne    267a <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    23c1:	83 ec 0c             	sub    $0xc,%esp
+    23c4:	68 b5 56 00 00       	push   $0x56b5
+    23c9:	e8 05 22 00 00       	call   45d3 <chdir>
+    23ce:	83 c4 10             	add    $0x10,%esp
+    23d1:	85 c0                	test   %eax,%eax
+    23d3:	0f 85 a1 02 00 00    	jne    267a <subdir+0x45a>
+  if(chdir("./..") != 0){
+    23d9:	83 ec 0c             	sub    $0xc,%esp
+    23dc:	68 c4 56 00 00       	push   $0x56c4
+    23e1:	e8 ed 21 00 00       	call   45d3 <chdir>
+    23e6:	83 c4 10             	add    $0x10,%esp
+    23e9:	85 c0                	test   %eax,%eax
+    23eb:	0f 85 21 03 00 00    	jne    2712 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    23f1:	83 ec 08             	sub    $0x8,%esp
+    23f4:	6a 00                	push   $0x0
+    23f6:	68 5b 56 00 00       	push   $0x565b
+    23fb:	e8 a3 21 00 00       	call   45a3 <open>
+  if(fd < 0){
+    2400:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    2403:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    2405:	85 c0                	test   %eax,%eax
+    2407:	0f 88 e0 04 00 00    	js     28ed <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    240d:	83 ec 04             	sub    $0x4,%esp
+    2410:	68 00 20 00 00       	push   $0x2000
+    2415:	68 c0 9b 00 00       	push   $0x9bc0
+    241a:	50                   	push   %eax
+    241b:	e8 5b 21 00 00       	call   457b <read>
+    2420:	83 c4 10             	add    $0x10,%esp
+    2423:	83 f8 02             	cmp    $0x2,%eax
+    2426:	0f 85 ae 04 00 00    	jne    28da <subdir+0x6ba>
+  close(fd);
+    242c:	83 ec 0c             	sub    $0xc,%esp
+    242f:	53                   	push   %ebx
+    2430:	e8 56 21 00 00       	call   458b <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2435:	58                   	pop    %eax
+    2436:	5a                   	pop    %edx
+    2437:	6a 00                	push   $0x0
+    2439:	68 f7 55 00 00       	push   $0x55f7
+    243e:	e8 60 21 00 00       	call   45a3 <open>
+    2443:	83 c4 10             	add    $0x10,%esp
+    2446:	85 c0                	test   %eax,%eax
+    2448:	0f 89 65 02 00 00    	jns    26b3 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    244e:	83 ec 08             	sub    $0x8,%esp
+    2451:	68 02 02 00 00       	push   $0x202
+    2456:	68 0f 57 00 00       	push   $0x570f
+    245b:	e8 43 21 00 00       	call   45a3 <open>
+    2460:	83 c4 10             	add    $0x10,%esp
+    2463:	85 c0                	test   %eax,%eax
+    2465:	0f 89 35 02 00 00    	jns    26a0 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    246b:	83 ec 08             	sub    $0x8,%esp
+    246e:	68 02 02 00 00       	push   $0x202
+    2473:	68 34 57 00 00       	push   $0x5734
+    2478:	e8 26 21 00 00       	call   45a3 <open>
+    247d:	83 c4 10             	add    $0x10,%esp
+    2480:	85 c0                	test   %eax,%eax
+    2482:	0f 89 0f 03 00 00    	jns    2797 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    2488:	83 ec 08             	sub    $0x8,%esp
+    248b:	68 00 02 00 00       	push   $0x200
+    2490:	68 c1 56 00 00       	push   $0x56c1
+    2495:	e8 09 21 00 00       	call   45a3 <open>
+    249a:	83 c4 10             	add    $0x10,%esp
+    249d:	85 c0                	test   %eax,%eax
+    249f:	0f 89 df 02 00 00    	jns    2784 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    24a5:	83 ec 08             	sub    $0x8,%esp
+    24a8:	6a 02                	push   $0x2
+    24aa:	68 c1 56 00 00       	push   $0x56c1
+    24af:	e8 ef 20 00 00       	call   45a3 <open>
+    24b4:	83 c4 10             	add    $0x10,%esp
+    24b7:	85 c0                	test   %eax,%eax
+    24b9:	0f 89 b2 02 00 00    	jns    2771 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    24bf:	83 ec 08             	sub    $0x8,%esp
+    24c2:	6a 01                	push   $0x1
+    24c4:	68 c1 56 00 00       	push   $0x56c1
+    24c9:	e8 d5 20 00 00       	call   45a3 <open>
+    24ce:	83 c4 10             	add    $0x10,%esp
+    24d1:	85 c0                	test   %eax,%eax
+    24d3:	0f 89 85 02 00 00    	jns    275e <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    24d9:	83 ec 08             	sub    $0x8,%esp
+    24dc:	68 a3 57 00 00       	push   $0x57a3
+    24e1:	68 0f 57 00 00       	push   $0x570f
+    24e6:	e8 d8 20 00 00       	call   45c3 <link>
+    24eb:	83 c4 10             	add    $0x10,%esp
+    24ee:	85 c0                	test   %eax,%eax
+    24f0:	0f 84 55 02 00 00    	je     274b <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    24f6:	83 ec 08             	sub    $0x8,%esp
+    24f9:	68 a3 57 00 00       	push   $0x57a3
+    24fe:	68 34 57 00 00       	push   $0x5734
+    2503:	e8 bb 20 00 00       	call   45c3 <link>
+    2508:	83 c4 10             	add    $0x10,%esp
+    250b:	85 c0                	test   %eax,%eax
+    250d:	0f 84 25 02 00 00    	je     2738 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    2513:	83 ec 08             	sub    $0x8,%esp
+    2516:	68 5b 56 00 00       	push   $0x565b
+    251b:	68 fa 55 00 00       	push   $0x55fa
+    2520:	e8 9e 20 00 00       	call   45c3 <link>
+    2525:	83 c4 10             	add    $0x10,%esp
+    2528:	85 c0                	test   %eax,%eax
+    252a:	0f 84 a9 01 00 00    	je     26d9 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    2530:	83 ec 0c             	sub    $0xc,%esp
+    2533:	68 0f 57 00 00       	push   $0x570f
+    2538:	e8 8e 20 00 00       	call   45cb <mkdir>
+    253d:	83 c4 10             	add    $0x10,%esp
+    2540:	85 c0                	test   %eax,%eax
+    2542:	0f 84 7e 01 00 00    	je     26c6 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    2548:	83 ec 0c             	sub    $0xc,%esp
+    254b:	68 34 57 00 00       	push   $0x5734
+    2550:	e8 76 20 00 00       	call   45cb <mkdir>
+    2555:	83 c4 10             	add    $0x10,%esp
+    2558:	85 c0                	test   %eax,%eax
+    255a:	0f 84 67 03 00 00    	je     28c7 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    2560:	83 ec 0c             	sub    $0xc,%esp
+    2563:	68 5b 56 00 00       	push   $0x565b
+    2568:	e8 5e 20 00 00       	call   45cb <mkdir>
+    256d:	83 c4 10             	add    $0x10,%esp
+    2570:	85 c0                	test   %eax,%eax
+    2572:	0f 84 3c 03 00 00    	je     28b4 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    2578:	83 ec 0c             	sub    $0xc,%esp
+    257b:	68 34 57 00 00       	push   $0x5734
+    2580:	e8 2e 20 00 00       	call   45b3 <unlink>
+    2585:	83 c4 10             	add    $0x10,%esp
+    2588:	85 c0                	test   %eax,%eax
+    258a:	0f 84 11 03 00 00    	je     28a1 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    2590:	83 ec 0c             	sub    $0xc,%esp
+    2593:	68 0f 57 00 00       	push   $0x570f
+    2598:	e8 16 20 00 00       	call   45b3 <unlink>
+    259d:	83 c4 10             	add    $0x10,%esp
+    25a0:	85 c0                	test   %eax,%eax
+    25a2:	0f 84 e6 02 00 00    	je     288e <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    25a8:	83 ec 0c             	sub    $0xc,%esp
+    25ab:	68 fa 55 00 00       	push   $0x55fa
+    25b0:	e8 1e 20 00 00       	call   45d3 <chdir>
+    25b5:	83 c4 10             	add    $0x10,%esp
+    25b8:	85 c0                	test   %eax,%eax
+    25ba:	0f 84 bb 02 00 00    	je     287b <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    25c0:	83 ec 0c             	sub    $0xc,%esp
+    25c3:	68 a6 57 00 00       	push   $0x57a6
+    25c8:	e8 06 20 00 00       	call   45d3 <chdir>
+    25cd:	83 c4 10             	add    $0x10,%esp
+    25d0:	85 c0                	test   %eax,%eax
+    25d2:	0f 84 90 02 00 00    	je     2868 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    25d8:	83 ec 0c             	sub    $0xc,%esp
+    25db:	68 5b 56 00 00       	push   $0x565b
+    25e0:	e8 ce 1f 00 00       	call   45b3 <unlink>
+    25e5:	83 c4 10             	add    $0x10,%esp
+    25e8:	85 c0                	test   %eax,%eax
+    25ea:	0f 85 9d 00 00 00    	jne    268d <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    25f0:	83 ec 0c             	sub    $0xc,%esp
+    25f3:	68 fa 55 00 00       	push   $0x55fa
+    25f8:	e8 b6 1f 00 00       	call   45b3 <unlink>
+    25fd:	83 c4 10             	add    $0x10,%esp
+    2600:	85 c0                	test   %eax,%eax
+    2602:	0f 85 4d 02 00 00    	jne    2855 <subdir+0x635>
+  if(unlink("dd") == 0){
+    2608:	83 ec 0c             	sub    $0xc,%esp
+    260b:	68 c1 56 00 00       	push   $0x56c1
+    2610:	e8 9e 1f 00 00       	call   45b3 <unlink>
+    2615:	83 c4 10             	add    $0x10,%esp
+    2618:	85 c0                	test   %eax,%eax
+    261a:	0f 84 22 02 00 00    	je     2842 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    2620:	83 ec 0c             	sub    $0xc,%esp
+    2623:	68 d6 55 00 00       	push   $0x55d6
+    2628:	e8 86 1f 00 00       	call   45b3 <unlink>
+    262d:	83 c4 10             	add    $0x10,%esp
+    2630:	85 c0                	test   %eax,%eax
+    2632:	0f 88 f7 01 00 00    	js     282f <subdir+0x60f>
+  if(unlink("dd") < 0){
+    2638:	83 ec 0c             	sub    $0xc,%esp
+    263b:	68 c1 56 00 00       	push   $0x56c1
+    2640:	e8 6e 1f 00 00       	call   45b3 <unlink>
+    2645:	83 c4 10             	add    $0x10,%esp
+    2648:	85 c0                	test   %eax,%eax
+    264a:	0f 88 cc 01 00 00    	js     281c <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    2650:	83 ec 08             	sub    $0x8,%esp
+    2653:	68 a3 58 00 00       	push   $0x58a3
+    2658:	6a 01                	push   $0x1
+    265a:	e8 81 20 00 00       	call   46e0 <printf>
+}
+    265f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2662:	83 c4 10             	add    $0x10,%esp
+    2665:	c9                   	leave
+    2666:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    2667:	50                   	push   %eax
+    2668:	50                   	push   %eax
+    2669:	68 40 56 00 00       	push   $0x5640
+    266e:	6a 01                	push   $0x1
+    2670:	e8 6b 20 00 00       	call   46e0 <printf>
+    exit();
+    2675:	e8 e9 1e 00 00       	call   4563 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    267a:	50                   	push   %eax
+    267b:	50                   	push   %eax
+    267c:	68 9b 56 00 00       	push   $0x569b
+    2681:	6a 01                	push   $0x1
+    2683:	e8 58 20 00 00       	call   46e0 <printf>
+    exit();
+    2688:	e8 d6 1e 00 00       	call   4563 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    268d:	50                   	push   %eax
+    268e:	50                   	push   %eax
+    268f:	68 66 56 00 00       	push   $0x5666
+    2694:	6a 01                	push   $0x1
+    2696:	e8 45 20 00 00       	call   46e0 <printf>
+    exit();
+    269b:	e8 c3 1e 00 00       	call   4563 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    26a0:	51                   	push   %ecx
+    26a1:	51                   	push   %ecx
+    26a2:	68 18 57 00 00       	push   $0x5718
+    26a7:	6a 01                	push   $0x1
+    26a9:	e8 32 20 00 00       	call   46e0 <printf>
+    exit();
+    26ae:	e8 b0 1e 00 00       	call   4563 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    26b3:	53                   	push   %ebx
+    26b4:	53                   	push   %ebx
+    26b5:	68 fc 62 00 00       	push   $0x62fc
+    26ba:	6a 01                	push   $0x1
+    26bc:	e8 1f 20 00 00       	call   46e0 <printf>
+    exit();
+    26c1:	e8 9d 1e 00 00       	call   4563 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    26c6:	51                   	push   %ecx
+    26c7:	51                   	push   %ecx
+    26c8:	68 ac 57 00 00       	push   $0x57ac
+    26cd:	6a 01                	push   $0x1
+    26cf:	e8 0c 20 00 00       	call   46e0 <printf>
+    exit();
+    26d4:	e8 8a 1e 00 00       	call   4563 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    26d9:	53                   	push   %ebx
+    26da:	53                   	push   %ebx
+    26db:	68 6c 63 00 00       	push   $0x636c
+    26e0:	6a 01                	push   $0x1
+    26e2:	e8 f9 1f 00 00       	call   46e0 <printf>
+    exit();
+    26e7:	e8 77 1e 00 00       	call   4563 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    26ec:	50                   	push   %eax
+    26ed:	50                   	push   %eax
+    26ee:	68 27 56 00 00       	push   $0x5627
+    26f3:	6a 01                	push   $0x1
+    26f5:	e8 e6 1f 00 00       	call   46e0 <printf>
+    exit();
+    26fa:	e8 64 1e 00 00       	call   4563 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    26ff:	51                   	push   %ecx
+    2700:	51                   	push   %ecx
+    2701:	68 00 56 00 00       	push   $0x5600
+    2706:	6a 01                	push   $0x1
+    2708:	e8 d3 1f 00 00       	call   46e0 <printf>
+    exit();
+    270d:	e8 51 1e 00 00       	call   4563 <exit>
+    printf(1, "chdir ./.. failed\n");
+    2712:	50                   	push   %eax
+    2713:	50                   	push   %eax
+    2714:	68 c9 56 00 00       	push   $0x56c9
+    2719:	6a 01                	push   $0x1
+    271b:	e8 c0 1f 00 00       	call   46e0 <printf>
+    exit();
+    2720:	e8 3e 1e 00 00       	call   4563 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    2725:	52                   	push   %edx
+    2726:	52                   	push   %edx
+    2727:	68 b4 62 00 00       	push   $0x62b4
+    272c:	6a 01                	push   $0x1
+    272e:	e8 ad 1f 00 00       	call   46e0 <printf>
+    exit();
+    2733:	e8 2b 1e 00 00       	call   4563 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    2738:	50                   	push   %eax
+    2739:	50                   	push   %eax
+    273a:	68 48 63 00 00       	push   $0x6348
+    273f:	6a 01                	push   $0x1
+    2741:	e8 9a 1f 00 00       	call   46e0 <printf>
+    exit();
+    2746:	e8 18 1e 00 00       	call   4563 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    274b:	50                   	push   %eax
+    274c:	50                   	push   %eax
+    274d:	68 24 63 00 00       	push   $0x6324
+    2752:	6a 01                	push   $0x1
+    2754:	e8 87 1f 00 00       	call   46e0 <printf>
+    exit();
+    2759:	e8 05 1e 00 00       	call   4563 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    275e:	50                   	push   %eax
+    275f:	50                   	push   %eax
+    2760:	68 88 57 00 00       	push   $0x5788
+    2765:	6a 01                	push   $0x1
+    2767:	e8 74 1f 00 00       	call   46e0 <printf>
+    exit();
+    276c:	e8 f2 1d 00 00       	call   4563 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    2771:	50                   	push   %eax
+    2772:	50                   	push   %eax
+    2773:	68 6f 57 00 00       	push   $0x576f
+    2778:	6a 01                	push   $0x1
+    277a:	e8 61 1f 00 00       	call   46e0 <printf>
+    exit();
+    277f:	e8 df 1d 00 00       	call   4563 <exit>
+    printf(1, "create dd succeeded!\n");
+    2784:	50                   	push   %eax
+    2785:	50                   	push   %eax
+    2786:	68 59 57 00 00       	push   $0x5759
+    278b:	6a 01                	push   $0x1
+    278d:	e8 4e 1f 00 00       	call   46e0 <printf>
+    exit();
+    2792:	e8 cc 1d 00 00       	call   4563 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    2797:	52                   	push   %edx
+    2798:	52                   	push   %edx
+    2799:	68 3d 57 00 00       	push   $0x573d
+    279e:	6a 01                	push   $0x1
+    27a0:	e8 3b 1f 00 00       	call   46e0 <printf>
+    exit();
+    27a5:	e8 b9 1d 00 00       	call   4563 <exit>
+    printf(1, "chdir dd failed\n");
+    27aa:	50                   	push   %eax
+    27ab:	50                   	push   %eax
+    27ac:	68 7e 56 00 00       	push   $0x567e
+    27b1:	6a 01                	push   $0x1
+    27b3:	e8 28 1f 00 00       	call   46e0 <printf>
+    exit();
+    27b8:	e8 a6 1d 00 00       	call   4563 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    27bd:	50                   	push   %eax
+    27be:	50                   	push   %eax
+    27bf:	68 d8 62 00 00       	push   $0x62d8
+    27c4:	6a 01                	push   $0x1
+    27c6:	e8 15 1f 00 00       	call   46e0 <printf>
+    exit();
+    27cb:	e8 93 1d 00 00       	call   4563 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    27d0:	53                   	push   %ebx
+    27d1:	53                   	push   %ebx
+    27d2:	68 dc 55 00 00       	push   $0x55dc
+    27d7:	6a 01                	push   $0x1
+    27d9:	e8 02 1f 00 00       	call   46e0 <printf>
+    exit();
+    27de:	e8 80 1d 00 00       	call   4563 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    27e3:	50                   	push   %eax
+    27e4:	50                   	push   %eax
+    27e5:	68 8c 62 00 00       	push   $0x628c
+    27ea:	6a 01                	push   $0x1
+    27ec:	e8 ef 1e 00 00       	call   46e0 <printf>
+    exit();
+    27f1:	e8 6d 1d 00 00       	call   4563 <exit>
+    printf(1, "create dd/ff failed\n");
+    27f6:	50                   	push   %eax
+    27f7:	50                   	push   %eax
+    27f8:	68 c0 55 00 00       	push   $0x55c0
+    27fd:	6a 01                	push   $0x1
+    27ff:	e8 dc 1e 00 00       	call   46e0 <printf>
+    exit();
+    2804:	e8 5a 1d 00 00       	call   4563 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    2809:	50                   	push   %eax
+    280a:	50                   	push   %eax
+    280b:	68 a8 55 00 00       	push   $0x55a8
+    2810:	6a 01                	push   $0x1
+    2812:	e8 c9 1e 00 00       	call   46e0 <printf>
+    exit();
+    2817:	e8 47 1d 00 00       	call   4563 <exit>
+    printf(1, "unlink dd failed\n");
+    281c:	50                   	push   %eax
+    281d:	50                   	push   %eax
+    281e:	68 91 58 00 00       	push   $0x5891
+    2823:	6a 01                	push   $0x1
+    2825:	e8 b6 1e 00 00       	call   46e0 <printf>
+    exit();
+    282a:	e8 34 1d 00 00       	call   4563 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    282f:	52                   	push   %edx
+    2830:	52                   	push   %edx
+    2831:	68 7c 58 00 00       	push   $0x587c
+    2836:	6a 01                	push   $0x1
+    2838:	e8 a3 1e 00 00       	call   46e0 <printf>
+    exit();
+    283d:	e8 21 1d 00 00       	call   4563 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    2842:	51                   	push   %ecx
+    2843:	51                   	push   %ecx
+    2844:	68 90 63 00 00       	push   $0x6390
+    2849:	6a 01                	push   $0x1
+    284b:	e8 90 1e 00 00       	call   46e0 <printf>
+    exit();
+    2850:	e8 0e 1d 00 00       	call   4563 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    2855:	53                   	push   %ebx
+    2856:	53                   	push   %ebx
+    2857:	68 67 58 00 00       	push   $0x5867
+    285c:	6a 01                	push   $0x1
+    285e:	e8 7d 1e 00 00       	call   46e0 <printf>
+    exit();
+    2863:	e8 fb 1c 00 00       	call   4563 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    2868:	50                   	push   %eax
+    2869:	50                   	push   %eax
+    286a:	68 4f 58 00 00       	push   $0x584f
+    286f:	6a 01                	push   $0x1
+    2871:	e8 6a 1e 00 00       	call   46e0 <printf>
+    exit();
+    2876:	e8 e8 1c 00 00       	call   4563 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    287b:	50                   	push   %eax
+    287c:	50                   	push   %eax
+    287d:	68 37 58 00 00       	push   $0x5837
+    2882:	6a 01                	push   $0x1
+    2884:	e8 57 1e 00 00       	call   46e0 <printf>
+    exit();
+    2889:	e8 d5 1c 00 00       	call   4563 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    288e:	50                   	push   %eax
+    288f:	50                   	push   %eax
+    2890:	68 1b 58 00 00       	push   $0x581b
+    2895:	6a 01                	push   $0x1
+    2897:	e8 44 1e 00 00       	call   46e0 <printf>
+    exit();
+    289c:	e8 c2 1c 00 00       	call   4563 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    28a1:	50                   	push   %eax
+    28a2:	50                   	push   %eax
+    28a3:	68 ff 57 00 00       	push   $0x57ff
+    28a8:	6a 01                	push   $0x1
+    28aa:	e8 31 1e 00 00       	call   46e0 <printf>
+    exit();
+    28af:	e8 af 1c 00 00       	call   4563 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    28b4:	50                   	push   %eax
+    28b5:	50                   	push   %eax
+    28b6:	68 e2 57 00 00       	push   $0x57e2
+    28bb:	6a 01                	push   $0x1
+    28bd:	e8 1e 1e 00 00       	call   46e0 <printf>
+    exit();
+    28c2:	e8 9c 1c 00 00       	call   4563 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    28c7:	52                   	push   %edx
+    28c8:	52                   	push   %edx
+    28c9:	68 c7 57 00 00       	push   $0x57c7
+    28ce:	6a 01                	push   $0x1
+    28d0:	e8 0b 1e 00 00       	call   46e0 <printf>
+    exit();
+    28d5:	e8 89 1c 00 00       	call   4563 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    28da:	51                   	push   %ecx
+    28db:	51                   	push   %ecx
+    28dc:	68 f4 56 00 00       	push   $0x56f4
+    28e1:	6a 01                	push   $0x1
+    28e3:	e8 f8 1d 00 00       	call   46e0 <printf>
+    exit();
+    28e8:	e8 76 1c 00 00       	call   4563 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    28ed:	53                   	push   %ebx
+    28ee:	53                   	push   %ebx
+    28ef:	68 dc 56 00 00       	push   $0x56dc
+    28f4:	6a 01                	push   $0x1
+    28f6:	e8 e5 1d 00 00       	call   46e0 <printf>
+    exit();
+    28fb:	e8 63 1c 00 00       	call   4563 <exit>
+
+00002900 <bigwrite>:
+{
+    2900:	55                   	push   %ebp
+    2901:	89 e5                	mov    %esp,%ebp
+    2903:	56                   	push   %esi
+    2904:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+    2905:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+    290a:	83 ec 08             	sub    $0x8,%esp
+    290d:	68 ae 58 00 00       	push   $0x58ae
+    2912:	6a 01                	push   $0x1
+    2914:	e8 c7 1d 00 00       	call   46e0 <printf>
+  unlink("bigwrite");
+    2919:	c7 04 24 bd 58 00 00 	movl   $0x58bd,(%esp)
+    2920:	e8 8e 1c 00 00       	call   45b3 <unlink>
+    2925:	83 c4 10             	add    $0x10,%esp
+    2928:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    292f:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2930:	83 ec 08             	sub    $0x8,%esp
+    2933:	68 02 02 00 00       	push   $0x202
+    2938:	68 bd 58 00 00       	push   $0x58bd
+    293d:	e8 61 1c 00 00       	call   45a3 <open>
+    if(fd < 0){
+    2942:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    2945:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+    2947:	85 c0                	test   %eax,%eax
+    2949:	78 7e                	js     29c9 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+    294b:	83 ec 04             	sub    $0x4,%esp
+    294e:	53                   	push   %ebx
+    294f:	68 c0 9b 00 00       	push   $0x9bc0
+    2954:	50                   	push   %eax
+    2955:	e8 29 1c 00 00       	call   4583 <write>
+      if(cc != sz){
+    295a:	83 c4 10             	add    $0x10,%esp
+    295d:	39 d8                	cmp    %ebx,%eax
+    295f:	75 55                	jne    29b6 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+    2961:	83 ec 04             	sub    $0x4,%esp
+    2964:	53                   	push   %ebx
+    2965:	68 c0 9b 00 00       	push   $0x9bc0
+    296a:	56                   	push   %esi
+    296b:	e8 13 1c 00 00       	call   4583 <write>
+      if(cc != sz){
+    2970:	83 c4 10             	add    $0x10,%esp
+    2973:	39 c3                	cmp    %eax,%ebx
+    2975:	75 3f                	jne    29b6 <bigwrite+0xb6>
+    close(fd);
+    2977:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    297a:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+    2980:	56                   	push   %esi
+    2981:	e8 05 1c 00 00       	call   458b <close>
+    unlink("bigwrite");
+    2986:	c7 04 24 bd 58 00 00 	movl   $0x58bd,(%esp)
+    298d:	e8 21 1c 00 00       	call   45b3 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+    2992:	83 c4 10             	add    $0x10,%esp
+    2995:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+    299b:	75 93                	jne    2930 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+    299d:	83 ec 08             	sub    $0x8,%esp
+    29a0:	68 f0 58 00 00       	push   $0x58f0
+    29a5:	6a 01                	push   $0x1
+    29a7:	e8 34 1d 00 00       	call   46e0 <printf>
+}
+    29ac:	83 c4 10             	add    $0x10,%esp
+    29af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    29b2:	5b                   	pop    %ebx
+    29b3:	5e                   	pop    %esi
+    29b4:	5d                   	pop    %ebp
+    29b5:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    29b6:	50                   	push   %eax
+    29b7:	53                   	push   %ebx
+    29b8:	68 de 58 00 00       	push   $0x58de
+    29bd:	6a 01                	push   $0x1
+    29bf:	e8 1c 1d 00 00       	call   46e0 <printf>
+        exit();
+    29c4:	e8 9a 1b 00 00       	call   4563 <exit>
+      printf(1, "cannot create bigwrite\n");
+    29c9:	83 ec 08             	sub    $0x8,%esp
+    29cc:	68 c6 58 00 00       	push   $0x58c6
+    29d1:	6a 01                	push   $0x1
+    29d3:	e8 08 1d 00 00       	call   46e0 <printf>
+      exit();
+    29d8:	e8 86 1b 00 00       	call   4563 <exit>
+    29dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000029e0 <bigfile>:
+{
+    29e0:	55                   	push   %ebp
+    29e1:	89 e5                	mov    %esp,%ebp
+    29e3:	57                   	push   %edi
+    29e4:	56                   	push   %esi
+    29e5:	53                   	push   %ebx
+    29e6:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+    29e9:	68 fd 58 00 00       	push   $0x58fd
+    29ee:	6a 01                	push   $0x1
+    29f0:	e8 eb 1c 00 00       	call   46e0 <printf>
+  unlink("bigfile");
+    29f5:	c7 04 24 19 59 00 00 	movl   $0x5919,(%esp)
+    29fc:	e8 b2 1b 00 00       	call   45b3 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    2a01:	58                   	pop    %eax
+    2a02:	5a                   	pop    %edx
+    2a03:	68 02 02 00 00       	push   $0x202
+    2a08:	68 19 59 00 00       	push   $0x5919
+    2a0d:	e8 91 1b 00 00       	call   45a3 <open>
+  if(fd < 0){
+    2a12:	83 c4 10             	add    $0x10,%esp
+    2a15:	85 c0                	test   %eax,%eax
+    2a17:	0f 88 5e 01 00 00    	js     2b7b <bigfile+0x19b>
+    2a1d:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+    2a1f:	31 db                	xor    %ebx,%ebx
+    2a21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+    2a28:	83 ec 04             	sub    $0x4,%esp
+    2a2b:	68 58 02 00 00       	push   $0x258
+    2a30:	53                   	push   %ebx
+    2a31:	68 c0 9b 00 00       	push   $0x9bc0
+    2a36:	e8 a5 19 00 00       	call   43e0 <memset>
+    if(write(fd, buf, 600) != 600){
+    2a3b:	83 c4 0c             	add    $0xc,%esp
+    2a3e:	68 58 02 00 00       	push   $0x258
+    2a43:	68 c0 9b 00 00       	push   $0x9bc0
+    2a48:	56                   	push   %esi
+    2a49:	e8 35 1b 00 00       	call   4583 <write>
+    2a4e:	83 c4 10             	add    $0x10,%esp
+    2a51:	3d 58 02 00 00       	cmp    $0x258,%eax
+    2a56:	0f 85 f8 00 00 00    	jne    2b54 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+    2a5c:	83 c3 01             	add    $0x1,%ebx
+    2a5f:	83 fb 14             	cmp    $0x14,%ebx
+    2a62:	75 c4                	jne    2a28 <bigfile+0x48>
+  close(fd);
+    2a64:	83 ec 0c             	sub    $0xc,%esp
+    2a67:	56                   	push   %esi
+    2a68:	e8 1e 1b 00 00       	call   458b <close>
+  fd = open("bigfile", 0);
+    2a6d:	5e                   	pop    %esi
+    2a6e:	5f                   	pop    %edi
+    2a6f:	6a 00                	push   $0x0
+    2a71:	68 19 59 00 00       	push   $0x5919
+    2a76:	e8 28 1b 00 00       	call   45a3 <open>
+  if(fd < 0){
+    2a7b:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+    2a7e:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+    2a80:	85 c0                	test   %eax,%eax
+    2a82:	0f 88 e0 00 00 00    	js     2b68 <bigfile+0x188>
+  total = 0;
+    2a88:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+    2a8a:	31 ff                	xor    %edi,%edi
+    2a8c:	eb 30                	jmp    2abe <bigfile+0xde>
+    2a8e:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+    2a90:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+    2a95:	0f 85 91 00 00 00    	jne    2b2c <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+    2a9b:	89 fa                	mov    %edi,%edx
+    2a9d:	0f be 05 c0 9b 00 00 	movsbl 0x9bc0,%eax
+    2aa4:	d1 fa                	sar    %edx
+    2aa6:	39 d0                	cmp    %edx,%eax
+    2aa8:	75 6e                	jne    2b18 <bigfile+0x138>
+    2aaa:	0f be 15 eb 9c 00 00 	movsbl 0x9ceb,%edx
+    2ab1:	39 d0                	cmp    %edx,%eax
+    2ab3:	75 63                	jne    2b18 <bigfile+0x138>
+    total += cc;
+    2ab5:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+    2abb:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+    2abe:	83 ec 04             	sub    $0x4,%esp
+    2ac1:	68 2c 01 00 00       	push   $0x12c
+    2ac6:	68 c0 9b 00 00       	push   $0x9bc0
+    2acb:	56                   	push   %esi
+    2acc:	e8 aa 1a 00 00       	call   457b <read>
+    if(cc < 0){
+    2ad1:	83 c4 10             	add    $0x10,%esp
+    2ad4:	85 c0                	test   %eax,%eax
+    2ad6:	78 68                	js     2b40 <bigfile+0x160>
+    if(cc == 0)
+    2ad8:	75 b6                	jne    2a90 <bigfile+0xb0>
+  close(fd);
+    2ada:	83 ec 0c             	sub    $0xc,%esp
+    2add:	56                   	push   %esi
+    2ade:	e8 a8 1a 00 00       	call   458b <close>
+  if(total != 20*600){
+    2ae3:	83 c4 10             	add    $0x10,%esp
+    2ae6:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+    2aec:	0f 85 9c 00 00 00    	jne    2b8e <bigfile+0x1ae>
+  unlink("bigfile");
+    2af2:	83 ec 0c             	sub    $0xc,%esp
+    2af5:	68 19 59 00 00       	push   $0x5919
+    2afa:	e8 b4 1a 00 00       	call   45b3 <unlink>
+  printf(1, "bigfile test ok\n");
+    2aff:	58                   	pop    %eax
+    2b00:	5a                   	pop    %edx
+    2b01:	68 a8 59 00 00       	push   $0x59a8
+    2b06:	6a 01                	push   $0x1
+    2b08:	e8 d3 1b 00 00       	call   46e0 <printf>
+}
+    2b0d:	83 c4 10             	add    $0x10,%esp
+    2b10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    2b13:	5b                   	pop    %ebx
+    2b14:	5e                   	pop    %esi
+    2b15:	5f                   	pop    %edi
+    2b16:	5d                   	pop    %ebp
+    2b17:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+    2b18:	83 ec 08             	sub    $0x8,%esp
+    2b1b:	68 75 59 00 00       	push   $0x5975
+    2b20:	6a 01                	push   $0x1
+    2b22:	e8 b9 1b 00 00       	call   46e0 <printf>
+      exit();
+    2b27:	e8 37 1a 00 00       	call   4563 <exit>
+      printf(1, "short read bigfile\n");
+    2b2c:	83 ec 08             	sub    $0x8,%esp
+    2b2f:	68 61 59 00 00       	push   $0x5961
+    2b34:	6a 01                	push   $0x1
+    2b36:	e8 a5 1b 00 00       	call   46e0 <printf>
+      exit();
+    2b3b:	e8 23 1a 00 00       	call   4563 <exit>
+      printf(1, "read bigfile failed\n");
+    2b40:	83 ec 08             	sub    $0x8,%esp
+    2b43:	68 4c 59 00 00       	push   $0x594c
+    2b48:	6a 01                	push   $0x1
+    2b4a:	e8 91 1b 00 00       	call   46e0 <printf>
+      exit();
+    2b4f:	e8 0f 1a 00 00       	call   4563 <exit>
+      printf(1, "write bigfile failed\n");
+    2b54:	83 ec 08             	sub    $0x8,%esp
+    2b57:	68 21 59 00 00       	push   $0x5921
+    2b5c:	6a 01                	push   $0x1
+    2b5e:	e8 7d 1b 00 00       	call   46e0 <printf>
+      exit();
+    2b63:	e8 fb 19 00 00       	call   4563 <exit>
+    printf(1, "cannot open bigfile\n");
+    2b68:	53                   	push   %ebx
+    2b69:	53                   	push   %ebx
+    2b6a:	68 37 59 00 00       	push   $0x5937
+    2b6f:	6a 01                	push   $0x1
+    2b71:	e8 6a 1b 00 00       	call   46e0 <printf>
+    exit();
+    2b76:	e8 e8 19 00 00       	call   4563 <exit>
+    printf(1, "cannot create bigfile");
+    2b7b:	50                   	push   %eax
+    2b7c:	50                   	push   %eax
+    2b7d:	68 0b 59 00 00       	push   $0x590b
+    2b82:	6a 01                	push   $0x1
+    2b84:	e8 57 1b 00 00       	call   46e0 <printf>
+    exit();
+    2b89:	e8 d5 19 00 00       	call   4563 <exit>
+    printf(1, "read bigfile wrong total\n");
+    2b8e:	51                   	push   %ecx
+    2b8f:	51                   	push   %ecx
+    2b90:	68 8e 59 00 00       	push   $0x598e
+    2b95:	6a 01                	push   $0x1
+    2b97:	e8 44 1b 00 00       	call   46e0 <printf>
+    exit();
+    2b9c:	e8 c2 19 00 00       	call   4563 <exit>
+    2ba1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2ba8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2baf:	90                   	nop
+
+00002bb0 <fourteen>:
+{
+    2bb0:	55                   	push   %ebp
+    2bb1:	89 e5                	mov    %esp,%ebp
+    2bb3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    2bb6:	68 b9 59 00 00       	push   $0x59b9
+    2bbb:	6a 01                	push   $0x1
+    2bbd:	e8 1e 1b 00 00       	call   46e0 <printf>
+  if(mkdir("12345678901234") != 0){
+    2bc2:	c7 04 24 f4 59 00 00 	movl   $0x59f4,(%esp)
+    2bc9:	e8 fd 19 00 00       	call   45cb <mkdir>
+    2bce:	83 c4 10             	add    $0x10,%esp
+    2bd1:	85 c0                	test   %eax,%eax
+    2bd3:	0f 85 97 00 00 00    	jne    2c70 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    2bd9:	83 ec 0c             	sub    $0xc,%esp
+    2bdc:	68 b0 63 00 00       	push   $0x63b0
+    2be1:	e8 e5 19 00 00       	call   45cb <mkdir>
+    2be6:	83 c4 10             	add    $0x10,%esp
+    2be9:	85 c0                	test   %eax,%eax
+    2beb:	0f 85 de 00 00 00    	jne    2ccf <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    2bf1:	83 ec 08             	sub    $0x8,%esp
+    2bf4:	68 00 02 00 00       	push   $0x200
+    2bf9:	68 00 64 00 00       	push   $0x6400
+    2bfe:	e8 a0 19 00 00       	call   45a3 <open>
+  if(fd < 0){
+    2c03:	83 c4 10             	add    $0x10,%esp
+    2c06:	85 c0                	test   %eax,%eax
+    2c08:	0f 88 ae 00 00 00    	js     2cbc <fourteen+0x10c>
+  close(fd);
+    2c0e:	83 ec 0c             	sub    $0xc,%esp
+    2c11:	50                   	push   %eax
+    2c12:	e8 74 19 00 00       	call   458b <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    2c17:	58                   	pop    %eax
+    2c18:	5a                   	pop    %edx
+    2c19:	6a 00                	push   $0x0
+    2c1b:	68 70 64 00 00       	push   $0x6470
+    2c20:	e8 7e 19 00 00       	call   45a3 <open>
+  if(fd < 0){
+    2c25:	83 c4 10             	add    $0x10,%esp
+    2c28:	85 c0                	test   %eax,%eax
+    2c2a:	78 7d                	js     2ca9 <fourteen+0xf9>
+  close(fd);
+    2c2c:	83 ec 0c             	sub    $0xc,%esp
+    2c2f:	50                   	push   %eax
+    2c30:	e8 56 19 00 00       	call   458b <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    2c35:	c7 04 24 e5 59 00 00 	movl   $0x59e5,(%esp)
+    2c3c:	e8 8a 19 00 00       	call   45cb <mkdir>
+    2c41:	83 c4 10             	add    $0x10,%esp
+    2c44:	85 c0                	test   %eax,%eax
+    2c46:	74 4e                	je     2c96 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    2c48:	83 ec 0c             	sub    $0xc,%esp
+    2c4b:	68 0c 65 00 00       	push   $0x650c
+    2c50:	e8 76 19 00 00       	call   45cb <mkdir>
+    2c55:	83 c4 10             	add    $0x10,%esp
+    2c58:	85 c0                	test   %eax,%eax
+    2c5a:	74 27                	je     2c83 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    2c5c:	83 ec 08             	sub    $0x8,%esp
+    2c5f:	68 03 5a 00 00       	push   $0x5a03
+    2c64:	6a 01                	push   $0x1
+    2c66:	e8 75 1a 00 00       	call   46e0 <printf>
+}
+    2c6b:	83 c4 10             	add    $0x10,%esp
+    2c6e:	c9                   	leave
+    2c6f:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    2c70:	50                   	push   %eax
+    2c71:	50                   	push   %eax
+    2c72:	68 c8 59 00 00       	push   $0x59c8
+    2c77:	6a 01                	push   $0x1
+    2c79:	e8 62 1a 00 00       	call   46e0 <printf>
+    exit();
+    2c7e:	e8 e0 18 00 00       	call   4563 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    2c83:	50                   	push   %eax
+    2c84:	50                   	push   %eax
+    2c85:	68 2c 65 00 00       	push   $0x652c
+    2c8a:	6a 01                	push   $0x1
+    2c8c:	e8 4f 1a 00 00       	call   46e0 <printf>
+    exit();
+    2c91:	e8 cd 18 00 00       	call   4563 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    2c96:	52                   	push   %edx
+    2c97:	52                   	push   %edx
+    2c98:	68 dc 64 00 00       	push   $0x64dc
+    2c9d:	6a 01                	push   $0x1
+    2c9f:	e8 3c 1a 00 00       	call   46e0 <printf>
+    exit();
+    2ca4:	e8 ba 18 00 00       	call   4563 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    2ca9:	51                   	push   %ecx
+    2caa:	51                   	push   %ecx
+    2cab:	68 a0 64 00 00       	push   $0x64a0
+    2cb0:	6a 01                	push   $0x1
+    2cb2:	e8 29 1a 00 00       	call   46e0 <printf>
+    exit();
+    2cb7:	e8 a7 18 00 00       	call   4563 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    2cbc:	51                   	push   %ecx
+    2cbd:	51                   	push   %ecx
+    2cbe:	68 30 64 00 00       	push   $0x6430
+    2cc3:	6a 01                	push   $0x1
+    2cc5:	e8 16 1a 00 00       	call   46e0 <printf>
+    exit();
+    2cca:	e8 94 18 00 00       	call   4563 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    2ccf:	50                   	push   %eax
+    2cd0:	50                   	push   %eax
+    2cd1:	68 d0 63 00 00       	push   $0x63d0
+    2cd6:	6a 01                	push   $0x1
+    2cd8:	e8 03 1a 00 00       	call   46e0 <printf>
+    exit();
+    2cdd:	e8 81 18 00 00       	call   4563 <exit>
+    2ce2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2ce9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002cf0 <rmdot>:
+{
+    2cf0:	55                   	push   %ebp
+    2cf1:	89 e5                	mov    %esp,%ebp
+    2cf3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    2cf6:	68 10 5a 00 00       	push   $0x5a10
+    2cfb:	6a 01                	push   $0x1
+    2cfd:	e8 de 19 00 00       	call   46e0 <printf>
+  if(mkdir("dots") != 0){
+    2d02:	c7 04 24 1c 5a 00 00 	movl   $0x5a1c,(%esp)
+    2d09:	e8 bd 18 00 00       	call   45cb <mkdir>
+    2d0e:	83 c4 10             	add    $0x10,%esp
+    2d11:	85 c0                	test   %eax,%eax
+    2d13:	0f 85 b0 00 00 00    	jne    2dc9 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    2d19:	83 ec 0c             	sub    $0xc,%esp
+    2d1c:	68 1c 5a 00 00       	push   $0x5a1c
+    2d21:	e8 ad 18 00 00       	call   45d3 <chdir>
+    2d26:	83 c4 10             	add    $0x10,%esp
+    2d29:	85 c0                	test   %eax,%eax
+    2d2b:	0f 85 1d 01 00 00    	jne    2e4e <rmdot+0x15e>
+  if(unlink(".") == 0){
+    2d31:	83 ec 0c             	sub    $0xc,%esp
+    2d34:	68 c7 56 00 00       	push   $0x56c7
+    2d39:	e8 75 18 00 00       	call   45b3 <unlink>
+    2d3e:	83 c4 10             	add    $0x10,%esp
+    2d41:	85 c0                	test   %eax,%eax
+    2d43:	0f 84 f2 00 00 00    	je     2e3b <rmdot+0x14b>
+  if(unlink("..") == 0){
+    2d49:	83 ec 0c             	sub    $0xc,%esp
+    2d4c:	68 c6 56 00 00       	push   $0x56c6
+    2d51:	e8 5d 18 00 00       	call   45b3 <unlink>
+    2d56:	83 c4 10             	add    $0x10,%esp
+    2d59:	85 c0                	test   %eax,%eax
+    2d5b:	0f 84 c7 00 00 00    	je     2e28 <rmdot+0x138>
+  if(chdir("/") != 0){
+    2d61:	83 ec 0c             	sub    $0xc,%esp
+    2d64:	68 89 4d 00 00       	push   $0x4d89
+    2d69:	e8 65 18 00 00       	call   45d3 <chdir>
+    2d6e:	83 c4 10             	add    $0x10,%esp
+    2d71:	85 c0                	test   %eax,%eax
+    2d73:	0f 85 9c 00 00 00    	jne    2e15 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    2d79:	83 ec 0c             	sub    $0xc,%esp
+    2d7c:	68 64 5a 00 00       	push   $0x5a64
+    2d81:	e8 2d 18 00 00       	call   45b3 <unlink>
+    2d86:	83 c4 10             	add    $0x10,%esp
+    2d89:	85 c0                	test   %eax,%eax
+    2d8b:	74 75                	je     2e02 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    2d8d:	83 ec 0c             	sub    $0xc,%esp
+    2d90:	68 82 5a 00 00       	push   $0x5a82
+    2d95:	e8 19 18 00 00       	call   45b3 <unlink>
+    2d9a:	83 c4 10             	add    $0x10,%esp
+    2d9d:	85 c0                	test   %eax,%eax
+    2d9f:	74 4e                	je     2def <rmdot+0xff>
+  if(unlink("dots") != 0){
+    2da1:	83 ec 0c             	sub    $0xc,%esp
+    2da4:	68 1c 5a 00 00       	push   $0x5a1c
+    2da9:	e8 05 18 00 00       	call   45b3 <unlink>
+    2dae:	83 c4 10             	add    $0x10,%esp
+    2db1:	85 c0                	test   %eax,%eax
+    2db3:	75 27                	jne    2ddc <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    2db5:	83 ec 08             	sub    $0x8,%esp
+    2db8:	68 b7 5a 00 00       	push   $0x5ab7
+    2dbd:	6a 01                	push   $0x1
+    2dbf:	e8 1c 19 00 00       	call   46e0 <printf>
+}
+    2dc4:	83 c4 10             	add    $0x10,%esp
+    2dc7:	c9                   	leave
+    2dc8:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    2dc9:	50                   	push   %eax
+    2dca:	50                   	push   %eax
+    2dcb:	68 21 5a 00 00       	push   $0x5a21
+    2dd0:	6a 01                	push   $0x1
+    2dd2:	e8 09 19 00 00       	call   46e0 <printf>
+    exit();
+    2dd7:	e8 87 17 00 00       	call   4563 <exit>
+    printf(1, "unlink dots failed!\n");
+    2ddc:	50                   	push   %eax
+    2ddd:	50                   	push   %eax
+    2dde:	68 a2 5a 00 00       	push   $0x5aa2
+    2de3:	6a 01                	push   $0x1
+    2de5:	e8 f6 18 00 00       	call   46e0 <printf>
+    exit();
+    2dea:	e8 74 17 00 00       	call   4563 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    2def:	52                   	push   %edx
+    2df0:	52                   	push   %edx
+    2df1:	68 8a 5a 00 00       	push   $0x5a8a
+    2df6:	6a 01                	push   $0x1
+    2df8:	e8 e3 18 00 00       	call   46e0 <printf>
+    exit();
+    2dfd:	e8 61 17 00 00       	call   4563 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    2e02:	51                   	push   %ecx
+    2e03:	51                   	push   %ecx
+    2e04:	68 6b 5a 00 00       	push   $0x5a6b
+    2e09:	6a 01                	push   $0x1
+    2e0b:	e8 d0 18 00 00       	call   46e0 <printf>
+    exit();
+    2e10:	e8 4e 17 00 00       	call   4563 <exit>
+    printf(1, "chdir / failed\n");
+    2e15:	50                   	push   %eax
+    2e16:	50                   	push   %eax
+    2e17:	68 8b 4d 00 00       	push   $0x4d8b
+    2e1c:	6a 01                	push   $0x1
+    2e1e:	e8 bd 18 00 00       	call   46e0 <printf>
+    exit();
+    2e23:	e8 3b 17 00 00       	call   4563 <exit>
+    printf(1, "rm .. worked!\n");
+    2e28:	50                   	push   %eax
+    2e29:	50                   	push   %eax
+    2e2a:	68 55 5a 00 00       	push   $0x5a55
+    2e2f:	6a 01                	push   $0x1
+    2e31:	e8 aa 18 00 00       	call   46e0 <printf>
+    exit();
+    2e36:	e8 28 17 00 00       	call   4563 <exit>
+    printf(1, "rm . worked!\n");
+    2e3b:	50                   	push   %eax
+    2e3c:	50                   	push   %eax
+    2e3d:	68 47 5a 00 00       	push   $0x5a47
+    2e42:	6a 01                	push   $0x1
+    2e44:	e8 97 18 00 00       	call   46e0 <printf>
+    exit();
+    2e49:	e8 15 17 00 00       	call   4563 <exit>
+    printf(1, "chdir dots failed\n");
+    2e4e:	50                   	push   %eax
+    2e4f:	50                   	push   %eax
+    2e50:	68 34 5a 00 00       	push   $0x5a34
+    2e55:	6a 01                	push   $0x1
+    2e57:	e8 84 18 00 00       	call   46e0 <printf>
+    exit();
+    2e5c:	e8 02 17 00 00       	call   4563 <exit>
+    2e61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2e68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2e6f:	90                   	nop
+
+00002e70 <dirfile>:
+{
+    2e70:	55                   	push   %ebp
+    2e71:	89 e5                	mov    %esp,%ebp
+    2e73:	53                   	push   %ebx
+    2e74:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    2e77:	68 c1 5a 00 00       	push   $0x5ac1
+    2e7c:	6a 01                	push   $0x1
+    2e7e:	e8 5d 18 00 00       	call   46e0 <printf>
+  fd = open("dirfile", O_CREATE);
+    2e83:	5b                   	pop    %ebx
+    2e84:	58                   	pop    %eax
+    2e85:	68 00 02 00 00       	push   $0x200
+    2e8a:	68 ce 5a 00 00       	push   $0x5ace
+    2e8f:	e8 0f 17 00 00       	call   45a3 <open>
+  if(fd < 0){
+    2e94:	83 c4 10             	add    $0x10,%esp
+    2e97:	85 c0                	test   %eax,%eax
+    2e99:	0f 88 43 01 00 00    	js     2fe2 <dirfile+0x172>
+  close(fd);
+    2e9f:	83 ec 0c             	sub    $0xc,%esp
+    2ea2:	50                   	push   %eax
+    2ea3:	e8 e3 16 00 00       	call   458b <close>
+  if(chdir("dirfile") == 0){
+    2ea8:	c7 04 24 ce 5a 00 00 	movl   $0x5ace,(%esp)
+    2eaf:	e8 1f 17 00 00       	call   45d3 <chdir>
+    2eb4:	83 c4 10             	add    $0x10,%esp
+    2eb7:	85 c0                	test   %eax,%eax
+    2eb9:	0f 84 10 01 00 00    	je     2fcf <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    2ebf:	83 ec 08             	sub    $0x8,%esp
+    2ec2:	6a 00                	push   $0x0
+    2ec4:	68 07 5b 00 00       	push   $0x5b07
+    2ec9:	e8 d5 16 00 00       	call   45a3 <open>
+  if(fd >= 0){
+    2ece:	83 c4 10             	add    $0x10,%esp
+    2ed1:	85 c0                	test   %eax,%eax
+    2ed3:	0f 89 e3 00 00 00    	jns    2fbc <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    2ed9:	83 ec 08             	sub    $0x8,%esp
+    2edc:	68 00 02 00 00       	push   $0x200
+    2ee1:	68 07 5b 00 00       	push   $0x5b07
+    2ee6:	e8 b8 16 00 00       	call   45a3 <open>
+  if(fd >= 0){
+    2eeb:	83 c4 10             	add    $0x10,%esp
+    2eee:	85 c0                	test   %eax,%eax
+    2ef0:	0f 89 c6 00 00 00    	jns    2fbc <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    2ef6:	83 ec 0c             	sub    $0xc,%esp
+    2ef9:	68 07 5b 00 00       	push   $0x5b07
+    2efe:	e8 c8 16 00 00       	call   45cb <mkdir>
+    2f03:	83 c4 10             	add    $0x10,%esp
+    2f06:	85 c0                	test   %eax,%eax
+    2f08:	0f 84 46 01 00 00    	je     3054 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    2f0e:	83 ec 0c             	sub    $0xc,%esp
+    2f11:	68 07 5b 00 00       	push   $0x5b07
+    2f16:	e8 98 16 00 00       	call   45b3 <unlink>
+    2f1b:	83 c4 10             	add    $0x10,%esp
+    2f1e:	85 c0                	test   %eax,%eax
+    2f20:	0f 84 1b 01 00 00    	je     3041 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    2f26:	83 ec 08             	sub    $0x8,%esp
+    2f29:	68 07 5b 00 00       	push   $0x5b07
+    2f2e:	68 6b 5b 00 00       	push   $0x5b6b
+    2f33:	e8 8b 16 00 00       	call   45c3 <link>
+    2f38:	83 c4 10             	add    $0x10,%esp
+    2f3b:	85 c0                	test   %eax,%eax
+    2f3d:	0f 84 eb 00 00 00    	je     302e <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    2f43:	83 ec 0c             	sub    $0xc,%esp
+    2f46:	68 ce 5a 00 00       	push   $0x5ace
+    2f4b:	e8 63 16 00 00       	call   45b3 <unlink>
+    2f50:	83 c4 10             	add    $0x10,%esp
+    2f53:	85 c0                	test   %eax,%eax
+    2f55:	0f 85 c0 00 00 00    	jne    301b <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    2f5b:	83 ec 08             	sub    $0x8,%esp
+    2f5e:	6a 02                	push   $0x2
+    2f60:	68 c7 56 00 00       	push   $0x56c7
+    2f65:	e8 39 16 00 00       	call   45a3 <open>
+  if(fd >= 0){
+    2f6a:	83 c4 10             	add    $0x10,%esp
+    2f6d:	85 c0                	test   %eax,%eax
+    2f6f:	0f 89 93 00 00 00    	jns    3008 <dirfile+0x198>
+  fd = open(".", 0);
+    2f75:	83 ec 08             	sub    $0x8,%esp
+    2f78:	6a 00                	push   $0x0
+    2f7a:	68 c7 56 00 00       	push   $0x56c7
+    2f7f:	e8 1f 16 00 00       	call   45a3 <open>
+  if(write(fd, "x", 1) > 0){
+    2f84:	83 c4 0c             	add    $0xc,%esp
+    2f87:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    2f89:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    2f8b:	68 16 5c 00 00       	push   $0x5c16
+    2f90:	50                   	push   %eax
+    2f91:	e8 ed 15 00 00       	call   4583 <write>
+    2f96:	83 c4 10             	add    $0x10,%esp
+    2f99:	85 c0                	test   %eax,%eax
+    2f9b:	7f 58                	jg     2ff5 <dirfile+0x185>
+  close(fd);
+    2f9d:	83 ec 0c             	sub    $0xc,%esp
+    2fa0:	53                   	push   %ebx
+    2fa1:	e8 e5 15 00 00       	call   458b <close>
+  printf(1, "dir vs file OK\n");
+    2fa6:	58                   	pop    %eax
+    2fa7:	5a                   	pop    %edx
+    2fa8:	68 9e 5b 00 00       	push   $0x5b9e
+    2fad:	6a 01                	push   $0x1
+    2faf:	e8 2c 17 00 00       	call   46e0 <printf>
+}
+    2fb4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2fb7:	83 c4 10             	add    $0x10,%esp
+    2fba:	c9                   	leave
+    2fbb:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    2fbc:	50                   	push   %eax
+    2fbd:	50                   	push   %eax
+    2fbe:	68 12 5b 00 00       	push   $0x5b12
+    2fc3:	6a 01                	push   $0x1
+    2fc5:	e8 16 17 00 00       	call   46e0 <printf>
+    exit();
+    2fca:	e8 94 15 00 00       	call   4563 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    2fcf:	52                   	push   %edx
+    2fd0:	52                   	push   %edx
+    2fd1:	68 ed 5a 00 00       	push   $0x5aed
+    2fd6:	6a 01                	push   $0x1
+    2fd8:	e8 03 17 00 00       	call   46e0 <printf>
+    exit();
+    2fdd:	e8 81 15 00 00       	call   4563 <exit>
+    printf(1, "create dirfile failed\n");
+    2fe2:	51                   	push   %ecx
+    2fe3:	51                   	push   %ecx
+    2fe4:	68 d6 5a 00 00       	push   $0x5ad6
+    2fe9:	6a 01                	push   $0x1
+    2feb:	e8 f0 16 00 00       	call   46e0 <printf>
+    exit();
+    2ff0:	e8 6e 15 00 00       	call   4563 <exit>
+    printf(1, "write . succeeded!\n");
+    2ff5:	51                   	push   %ecx
+    2ff6:	51                   	push   %ecx
+    2ff7:	68 8a 5b 00 00       	push   $0x5b8a
+    2ffc:	6a 01                	push   $0x1
+    2ffe:	e8 dd 16 00 00       	call   46e0 <printf>
+    exit();
+    3003:	e8 5b 15 00 00       	call   4563 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    3008:	53                   	push   %ebx
+    3009:	53                   	push   %ebx
+    300a:	68 80 65 00 00       	push   $0x6580
+    300f:	6a 01                	push   $0x1
+    3011:	e8 ca 16 00 00       	call   46e0 <printf>
+    exit();
+    3016:	e8 48 15 00 00       	call   4563 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    301b:	50                   	push   %eax
+    301c:	50                   	push   %eax
+    301d:	68 72 5b 00 00       	push   $0x5b72
+    3022:	6a 01                	push   $0x1
+    3024:	e8 b7 16 00 00       	call   46e0 <printf>
+    exit();
+    3029:	e8 35 15 00 00       	call   4563 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    302e:	50                   	push   %eax
+    302f:	50                   	push   %eax
+    3030:	68 60 65 00 00       	push   $0x6560
+    3035:	6a 01                	push   $0x1
+    3037:	e8 a4 16 00 00       	call   46e0 <printf>
+    exit();
+    303c:	e8 22 15 00 00       	call   4563 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    3041:	50                   	push   %eax
+    3042:	50                   	push   %eax
+    3043:	68 4d 5b 00 00       	push   $0x5b4d
+    3048:	6a 01                	push   $0x1
+    304a:	e8 91 16 00 00       	call   46e0 <printf>
+    exit();
+    304f:	e8 0f 15 00 00       	call   4563 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    3054:	50                   	push   %eax
+    3055:	50                   	push   %eax
+    3056:	68 30 5b 00 00       	push   $0x5b30
+    305b:	6a 01                	push   $0x1
+    305d:	e8 7e 16 00 00       	call   46e0 <printf>
+    exit();
+    3062:	e8 fc 14 00 00       	call   4563 <exit>
+    3067:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    306e:	66 90                	xchg   %ax,%ax
+
+00003070 <iref>:
+{
+    3070:	55                   	push   %ebp
+    3071:	89 e5                	mov    %esp,%ebp
+    3073:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    3074:	bb c9 00 00 00       	mov    $0xc9,%ebx
+{
+    3079:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    307c:	68 ae 5b 00 00       	push   $0x5bae
+    3081:	6a 01                	push   $0x1
+    3083:	e8 58 16 00 00       	call   46e0 <printf>
+    3088:	83 c4 10             	add    $0x10,%esp
+    308b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    308f:	90                   	nop
+    if(mkdir("irefd") != 0){
+    3090:	83 ec 0c             	sub    $0xc,%esp
+    3093:	68 bf 5b 00 00       	push   $0x5bbf
+    3098:	e8 2e 15 00 00       	call   45cb <mkdir>
+    309d:	83 c4 10             	add    $0x10,%esp
+    30a0:	85 c0                	test   %eax,%eax
+    30a2:	0f 85 bb 00 00 00    	jne    3163 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    30a8:	83 ec 0c             	sub    $0xc,%esp
+    30ab:	68 bf 5b 00 00       	push   $0x5bbf
+    30b0:	e8 1e 15 00 00       	call   45d3 <chdir>
+    30b5:	83 c4 10             	add    $0x10,%esp
+    30b8:	85 c0                	test   %eax,%eax
+    30ba:	0f 85 b7 00 00 00    	jne    3177 <iref+0x107>
+    mkdir("");
+    30c0:	83 ec 0c             	sub    $0xc,%esp
+    30c3:	68 74 52 00 00       	push   $0x5274
+    30c8:	e8 fe 14 00 00       	call   45cb <mkdir>
+    link("README", "");
+    30cd:	59                   	pop    %ecx
+    30ce:	58                   	pop    %eax
+    30cf:	68 74 52 00 00       	push   $0x5274
+    30d4:	68 6b 5b 00 00       	push   $0x5b6b
+    30d9:	e8 e5 14 00 00       	call   45c3 <link>
+    fd = open("", O_CREATE);
+    30de:	58                   	pop    %eax
+    30df:	5a                   	pop    %edx
+    30e0:	68 00 02 00 00       	push   $0x200
+    30e5:	68 74 52 00 00       	push   $0x5274
+    30ea:	e8 b4 14 00 00       	call   45a3 <open>
+    if(fd >= 0)
+    30ef:	83 c4 10             	add    $0x10,%esp
+    30f2:	85 c0                	test   %eax,%eax
+    30f4:	78 0c                	js     3102 <iref+0x92>
+      close(fd);
+    30f6:	83 ec 0c             	sub    $0xc,%esp
+    30f9:	50                   	push   %eax
+    30fa:	e8 8c 14 00 00       	call   458b <close>
+    30ff:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    3102:	83 ec 08             	sub    $0x8,%esp
+    3105:	68 00 02 00 00       	push   $0x200
+    310a:	68 a9 57 00 00       	push   $0x57a9
+    310f:	e8 8f 14 00 00       	call   45a3 <open>
+    if(fd >= 0)
+    3114:	83 c4 10             	add    $0x10,%esp
+    3117:	85 c0                	test   %eax,%eax
+    3119:	78 0c                	js     3127 <iref+0xb7>
+      close(fd);
+    311b:	83 ec 0c             	sub    $0xc,%esp
+    311e:	50                   	push   %eax
+    311f:	e8 67 14 00 00       	call   458b <close>
+    3124:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    3127:	83 ec 0c             	sub    $0xc,%esp
+    312a:	68 a9 57 00 00       	push   $0x57a9
+    312f:	e8 7f 14 00 00       	call   45b3 <unlink>
+  for(i = 0; i < 200 + 1; i++){
+    3134:	83 c4 10             	add    $0x10,%esp
+    3137:	83 eb 01             	sub    $0x1,%ebx
+    313a:	0f 85 50 ff ff ff    	jne    3090 <iref+0x20>
+  chdir("/");
+    3140:	83 ec 0c             	sub    $0xc,%esp
+    3143:	68 89 4d 00 00       	push   $0x4d89
+    3148:	e8 86 14 00 00       	call   45d3 <chdir>
+  printf(1, "empty file name OK\n");
+    314d:	58                   	pop    %eax
+    314e:	5a                   	pop    %edx
+    314f:	68 ed 5b 00 00       	push   $0x5bed
+    3154:	6a 01                	push   $0x1
+    3156:	e8 85 15 00 00       	call   46e0 <printf>
+}
+    315b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    315e:	83 c4 10             	add    $0x10,%esp
+    3161:	c9                   	leave
+    3162:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    3163:	83 ec 08             	sub    $0x8,%esp
+    3166:	68 c5 5b 00 00       	push   $0x5bc5
+    316b:	6a 01                	push   $0x1
+    316d:	e8 6e 15 00 00       	call   46e0 <printf>
+      exit();
+    3172:	e8 ec 13 00 00       	call   4563 <exit>
+      printf(1, "chdir irefd failed\n");
+    3177:	83 ec 08             	sub    $0x8,%esp
+    317a:	68 d9 5b 00 00       	push   $0x5bd9
+    317f:	6a 01                	push   $0x1
+    3181:	e8 5a 15 00 00       	call   46e0 <printf>
+      exit();
+    3186:	e8 d8 13 00 00       	call   4563 <exit>
+    318b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    318f:	90                   	nop
+
+00003190 <dcachetest>:
+{
+    3190:	55                   	push   %ebp
+    3191:	89 e5                	mov    %esp,%ebp
+    3193:	53                   	push   %ebx
+  for(i = 0; i < 6; i++){
+    3194:	31 db                	xor    %ebx,%ebx
+{
+    3196:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dcache test\n");
+    3199:	68 01 5c 00 00       	push   $0x5c01
+    319e:	6a 01                	push   $0x1
+    31a0:	e8 3b 15 00 00       	call   46e0 <printf>
+    31a5:	83 c4 10             	add    $0x10,%esp
+    31a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    31af:	90                   	nop
+    if(mkdir("dcd") != 0 || open("dcd/x", 0) >= 0)
+    31b0:	83 ec 0c             	sub    $0xc,%esp
+    31b3:	68 0e 5c 00 00       	push   $0x5c0e
+    31b8:	e8 0e 14 00 00       	call   45cb <mkdir>
+    31bd:	83 c4 10             	add    $0x10,%esp
+    31c0:	85 c0                	test   %eax,%eax
+    31c2:	0f 85 bb 00 00 00    	jne    3283 <dcachetest+0xf3>
+    31c8:	83 ec 08             	sub    $0x8,%esp
+    31cb:	6a 00                	push   $0x0
+    31cd:	68 12 5c 00 00       	push   $0x5c12
+    31d2:	e8 cc 13 00 00       	call   45a3 <open>
+    31d7:	83 c4 10             	add    $0x10,%esp
+    31da:	85 c0                	test   %eax,%eax
+    31dc:	0f 89 a1 00 00 00    	jns    3283 <dcachetest+0xf3>
+    if((fd = open("dcd/x", O_CREATE|O_RDWR)) < 0)
+    31e2:	83 ec 08             	sub    $0x8,%esp
+    31e5:	68 02 02 00 00       	push   $0x202
+    31ea:	68 12 5c 00 00       	push   $0x5c12
+    31ef:	e8 af 13 00 00       	call   45a3 <open>
+    31f4:	83 c4 10             	add    $0x10,%esp
+    31f7:	85 c0                	test   %eax,%eax
+    31f9:	0f 88 84 00 00 00    	js     3283 <dcachetest+0xf3>
+    close(fd);
+    31ff:	83 ec 0c             	sub    $0xc,%esp
+    3202:	50                   	push   %eax
+    3203:	e8 83 13 00 00       	call   458b <close>
+    if((fd = open("dcd/x", 0)) < 0)
+    3208:	58                   	pop    %eax
+    3209:	5a                   	pop    %edx
+    320a:	6a 00                	push   $0x0
+    320c:	68 12 5c 00 00       	push   $0x5c12
+    3211:	e8 8d 13 00 00       	call   45a3 <open>
+    3216:	83 c4 10             	add    $0x10,%esp
+    3219:	85 c0                	test   %eax,%eax
+    321b:	78 66                	js     3283 <dcachetest+0xf3>
+    close(fd);
+    321d:	83 ec 0c             	sub    $0xc,%esp
+    3220:	50                   	push   %eax
+    3221:	e8 65 13 00 00       	call   458b <close>
+    if(unlink("dcd/x") != 0 || open("dcd/x", 0) >= 0 || unlink("dcd") != 0)
+    3226:	c7 04 24 12 5c 00 00 	movl   $0x5c12,(%esp)
+    322d:	e8 81 13 00 00       	call   45b3 <unlink>
+    3232:	83 c4 10             	add    $0x10,%esp
+    3235:	85 c0                	test   %eax,%eax
+    3237:	75 4a                	jne    3283 <dcachetest+0xf3>
+    3239:	83 ec 08             	sub    $0x8,%esp
+    323c:	6a 00                	push   $0x0
+    323e:	68 12 5c 00 00       	push   $0x5c12
+    3243:	e8 5b 13 00 00       	call   45a3 <open>
+    3248:	83 c4 10             	add    $0x10,%esp
+    324b:	85 c0                	test   %eax,%eax
+    324d:	79 34                	jns    3283 <dcachetest+0xf3>
+    324f:	83 ec 0c             	sub    $0xc,%esp
+    3252:	68 0e 5c 00 00       	push   $0x5c0e
+    3257:	e8 57 13 00 00       	call   45b3 <unlink>
+    325c:	83 c4 10             	add    $0x10,%esp
+    325f:	85 c0                	test   %eax,%eax
+    3261:	75 20                	jne    3283 <dcachetest+0xf3>
+  for(i = 0; i < 6; i++){
+    3263:	83 c3 01             	add    $0x1,%ebx
+    3266:	83 fb 06             	cmp    $0x6,%ebx
+    3269:	0f 85 41 ff ff ff    	jne    31b0 <dcachetest+0x20>
+  printf(1, "dcache test ok\n");
+    326f:	83 ec 08             	sub    $0x8,%esp
+    3272:	68 18 5c 00 00       	push   $0x5c18
+    3277:	6a 01                	push   $0x1
+    3279:	e8 62 14 00 00       	call   46e0 <printf>
+}
+    327e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3281:	c9                   	leave
+    3282:	c3                   	ret
+  printf(1, "dcache test failed at %d\n", i);
+    3283:	83 ec 04             	sub    $0x4,%esp
+    3286:	53                   	push   %ebx
+    3287:	68 28 5c 00 00       	push   $0x5c28
+    328c:	6a 01                	push   $0x1
+    328e:	e8 4d 14 00 00       	call   46e0 <printf>
+  exit();
+    3293:	e8 cb 12 00 00       	call   4563 <exit>
+    3298:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    329f:	90                   	nop
+
+000032a0 <forktest>:
+{
+    32a0:	55                   	push   %ebp
+    32a1:	89 e5                	mov    %esp,%ebp
+    32a3:	53                   	push   %ebx
+  for(n=0; n<1000; n++){
+    32a4:	31 db                	xor    %ebx,%ebx
+{
+    32a6:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    32a9:	68 42 5c 00 00       	push   $0x5c42
+    32ae:	6a 01                	push   $0x1
+    32b0:	e8 2b 14 00 00       	call   46e0 <printf>
+    32b5:	83 c4 10             	add    $0x10,%esp
+    32b8:	eb 13                	jmp    32cd <forktest+0x2d>
+    32ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    32c0:	74 4d                	je     330f <forktest+0x6f>
+  for(n=0; n<1000; n++){
+    32c2:	83 c3 01             	add    $0x1,%ebx
+    32c5:	81 fb e8 03 00 00    	cmp    $0x3e8,%ebx
+    32cb:	74 6e                	je     333b <forktest+0x9b>
+    pid = fork();
+    32cd:	e8 89 12 00 00       	call   455b <fork>
+    if(pid < 0)
+    32d2:	85 c0                	test   %eax,%eax
+    32d4:	79 ea                	jns    32c0 <forktest+0x20>
+  for(; n > 0; n--){
+    32d6:	85 db                	test   %ebx,%ebx
+    32d8:	74 14                	je     32ee <forktest+0x4e>
+    32da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    32e0:	e8 86 12 00 00       	call   456b <wait>
+    32e5:	85 c0                	test   %eax,%eax
+    32e7:	78 2b                	js     3314 <forktest+0x74>
+  for(; n > 0; n--){
+    32e9:	83 eb 01             	sub    $0x1,%ebx
+    32ec:	75 f2                	jne    32e0 <forktest+0x40>
+  if(wait() != -1){
+    32ee:	e8 78 12 00 00       	call   456b <wait>
+    32f3:	83 f8 ff             	cmp    $0xffffffff,%eax
+    32f6:	75 30                	jne    3328 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    32f8:	83 ec 08             	sub    $0x8,%esp
+    32fb:	68 74 5c 00 00       	push   $0x5c74
+    3300:	6a 01                	push   $0x1
+    3302:	e8 d9 13 00 00       	call   46e0 <printf>
+}
+    3307:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    330a:	83 c4 10             	add    $0x10,%esp
+    330d:	c9                   	leave
+    330e:	c3                   	ret
+      exit();
+    330f:	e8 4f 12 00 00       	call   4563 <exit>
+      printf(1, "wait stopped early\n");
+    3314:	83 ec 08             	sub    $0x8,%esp
+    3317:	68 4d 5c 00 00       	push   $0x5c4d
+    331c:	6a 01                	push   $0x1
+    331e:	e8 bd 13 00 00       	call   46e0 <printf>
+      exit();
+    3323:	e8 3b 12 00 00       	call   4563 <exit>
+    printf(1, "wait got too many\n");
+    3328:	50                   	push   %eax
+    3329:	50                   	push   %eax
+    332a:	68 61 5c 00 00       	push   $0x5c61
+    332f:	6a 01                	push   $0x1
+    3331:	e8 aa 13 00 00       	call   46e0 <printf>
+    exit();
+    3336:	e8 28 12 00 00       	call   4563 <exit>
+    printf(1, "fork claimed to work 1000 times!\n");
+    333b:	52                   	push   %edx
+    333c:	52                   	push   %edx
+    333d:	68 a0 65 00 00       	push   $0x65a0
+    3342:	6a 01                	push   $0x1
+    3344:	e8 97 13 00 00       	call   46e0 <printf>
+    exit();
+    3349:	e8 15 12 00 00       	call   4563 <exit>
+    334e:	66 90                	xchg   %ax,%ax
+
+00003350 <cowtest>:
+{
+    3350:	55                   	push   %ebp
+    3351:	89 e5                	mov    %esp,%ebp
+    3353:	57                   	push   %edi
+    3354:	56                   	push   %esi
+    3355:	53                   	push   %ebx
+    3356:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "cow test\n");
+    3359:	68 82 5c 00 00       	push   $0x5c82
+    335e:	6a 01                	push   $0x1
+    3360:	e8 7b 13 00 00       	call   46e0 <printf>
+  oldbrk = sbrk(0);
+    3365:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    336c:	e8 7a 12 00 00       	call   45eb <sbrk>
+    3371:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  a = sbrk(COWSZ);
+    3374:	c7 04 24 00 00 80 01 	movl   $0x1800000,(%esp)
+    337b:	e8 6b 12 00 00       	call   45eb <sbrk>
+  if(a == (char*)0xffffffff){
+    3380:	83 c4 10             	add    $0x10,%esp
+    3383:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3386:	0f 84 a7 01 00 00    	je     3533 <cowtest+0x1e3>
+    338c:	89 c3                	mov    %eax,%ebx
+    338e:	8d 90 00 00 80 01    	lea    0x1800000(%eax),%edx
+    3394:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    a[i] = 'p';
+    3398:	c6 00 70             	movb   $0x70,(%eax)
+  for(i = 0; i < COWSZ; i += 4096)
+    339b:	05 00 10 00 00       	add    $0x1000,%eax
+    33a0:	39 c2                	cmp    %eax,%edx
+    33a2:	75 f4                	jne    3398 <cowtest+0x48>
+  if(pipe(fds) != 0){
+    33a4:	83 ec 0c             	sub    $0xc,%esp
+    33a7:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    33aa:	50                   	push   %eax
+    33ab:	e8 c3 11 00 00       	call   4573 <pipe>
+    33b0:	83 c4 10             	add    $0x10,%esp
+    33b3:	89 c6                	mov    %eax,%esi
+    33b5:	85 c0                	test   %eax,%eax
+    33b7:	0f 85 3d 01 00 00    	jne    34fa <cowtest+0x1aa>
+  for(n = 0; n < 12; n++){
+    33bd:	31 ff                	xor    %edi,%edi
+    33bf:	90                   	nop
+    pid = fork();
+    33c0:	e8 96 11 00 00       	call   455b <fork>
+    if(pid < 0){
+    33c5:	85 c0                	test   %eax,%eax
+    33c7:	0f 88 18 01 00 00    	js     34e5 <cowtest+0x195>
+    if(pid == 0){
+    33cd:	0f 84 8d 00 00 00    	je     3460 <cowtest+0x110>
+    write(fds[1], "k", 1);
+    33d3:	83 ec 04             	sub    $0x4,%esp
+  for(n = 0; n < 12; n++){
+    33d6:	83 c7 01             	add    $0x1,%edi
+    write(fds[1], "k", 1);
+    33d9:	6a 01                	push   $0x1
+    33db:	68 fc 5e 00 00       	push   $0x5efc
+    33e0:	ff 75 e4             	push   -0x1c(%ebp)
+    33e3:	e8 9b 11 00 00       	call   4583 <write>
+  for(n = 0; n < 12; n++){
+    33e8:	83 c4 10             	add    $0x10,%esp
+    33eb:	83 ff 0c             	cmp    $0xc,%edi
+    33ee:	75 d0                	jne    33c0 <cowtest+0x70>
+    wait();
+    33f0:	e8 76 11 00 00       	call   456b <wait>
+  for(; n > 0; n--)
+    33f5:	83 ef 01             	sub    $0x1,%edi
+    33f8:	75 f6                	jne    33f0 <cowtest+0xa0>
+  close(fds[0]);
+    33fa:	83 ec 0c             	sub    $0xc,%esp
+    33fd:	ff 75 e0             	push   -0x20(%ebp)
+    3400:	e8 86 11 00 00       	call   458b <close>
+  close(fds[1]);
+    3405:	59                   	pop    %ecx
+    3406:	ff 75 e4             	push   -0x1c(%ebp)
+    3409:	e8 7d 11 00 00       	call   458b <close>
+    340e:	83 c4 10             	add    $0x10,%esp
+    3411:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(a[i] != 'p'){
+    3418:	80 3c 33 70          	cmpb   $0x70,(%ebx,%esi,1)
+    341c:	0f 85 ae 00 00 00    	jne    34d0 <cowtest+0x180>
+  for(i = 0; i < COWSZ; i += 4096){
+    3422:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    3428:	81 fe 00 00 80 01    	cmp    $0x1800000,%esi
+    342e:	75 e8                	jne    3418 <cowtest+0xc8>
+  sbrk(-(sbrk(0) - oldbrk));
+    3430:	83 ec 0c             	sub    $0xc,%esp
+    3433:	6a 00                	push   $0x0
+    3435:	e8 b1 11 00 00       	call   45eb <sbrk>
+    343a:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    343d:	29 c6                	sub    %eax,%esi
+    343f:	89 34 24             	mov    %esi,(%esp)
+    3442:	e8 a4 11 00 00       	call   45eb <sbrk>
+  printf(1, "cow test OK\n");
+    3447:	58                   	pop    %eax
+    3448:	5a                   	pop    %edx
+    3449:	68 d1 5c 00 00       	push   $0x5cd1
+    344e:	6a 01                	push   $0x1
+    3450:	e8 8b 12 00 00       	call   46e0 <printf>
+}
+    3455:	83 c4 10             	add    $0x10,%esp
+    3458:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    345b:	5b                   	pop    %ebx
+    345c:	5e                   	pop    %esi
+    345d:	5f                   	pop    %edi
+    345e:	5d                   	pop    %ebp
+    345f:	c3                   	ret
+      if(a[0] != 'p' || a[COWSZ-4096] != 'p'){
+    3460:	80 3b 70             	cmpb   $0x70,(%ebx)
+    3463:	0f 85 a4 00 00 00    	jne    350d <cowtest+0x1bd>
+    3469:	80 bb 00 f0 7f 01 70 	cmpb   $0x70,0x17ff000(%ebx)
+    3470:	0f 85 97 00 00 00    	jne    350d <cowtest+0x1bd>
+      a[4096*n] = 'c';
+    3476:	89 f8                	mov    %edi,%eax
+      if(read(fds[0], a + 4096*(n+1), 1) != 1 || a[4096*(n+1)] != 'k'){
+    3478:	83 ec 04             	sub    $0x4,%esp
+      a[4096*n] = 'c';
+    347b:	c1 e0 0c             	shl    $0xc,%eax
+      if(read(fds[0], a + 4096*(n+1), 1) != 1 || a[4096*(n+1)] != 'k'){
+    347e:	8d b4 03 00 10 00 00 	lea    0x1000(%ebx,%eax,1),%esi
+      a[4096*n] = 'c';
+    3485:	c6 04 03 63          	movb   $0x63,(%ebx,%eax,1)
+      if(read(fds[0], a + 4096*(n+1), 1) != 1 || a[4096*(n+1)] != 'k'){
+    3489:	6a 01                	push   $0x1
+    348b:	56                   	push   %esi
+    348c:	ff 75 e0             	push   -0x20(%ebp)
+    348f:	e8 e7 10 00 00       	call   457b <read>
+    3494:	83 c4 10             	add    $0x10,%esp
+    3497:	83 f8 01             	cmp    $0x1,%eax
+    349a:	0f 85 80 00 00 00    	jne    3520 <cowtest+0x1d0>
+    34a0:	80 3e 6b             	cmpb   $0x6b,(%esi)
+    34a3:	75 7b                	jne    3520 <cowtest+0x1d0>
+      if(a[0] != (n == 0 ? 'c' : 'p')){
+    34a5:	83 ff 01             	cmp    $0x1,%edi
+    34a8:	0f be 13             	movsbl (%ebx),%edx
+    34ab:	19 c0                	sbb    %eax,%eax
+    34ad:	83 e0 f3             	and    $0xfffffff3,%eax
+    34b0:	83 c0 70             	add    $0x70,%eax
+    34b3:	39 c2                	cmp    %eax,%edx
+    34b5:	74 14                	je     34cb <cowtest+0x17b>
+        printf(1, "cow test child sees sibling write\n");
+    34b7:	83 ec 08             	sub    $0x8,%esp
+    34ba:	68 0c 66 00 00       	push   $0x660c
+    34bf:	6a 01                	push   $0x1
+    34c1:	e8 1a 12 00 00       	call   46e0 <printf>
+        exit();
+    34c6:	e8 98 10 00 00       	call   4563 <exit>
+      exit();
+    34cb:	e8 93 10 00 00       	call   4563 <exit>
+      printf(1, "cow test parent sees child write at %d\n", i);
+    34d0:	83 ec 04             	sub    $0x4,%esp
+    34d3:	56                   	push   %esi
+    34d4:	68 30 66 00 00       	push   $0x6630
+    34d9:	6a 01                	push   $0x1
+    34db:	e8 00 12 00 00       	call   46e0 <printf>
+      exit();
+    34e0:	e8 7e 10 00 00       	call   4563 <exit>
+      printf(1, "cow test fork %d failed\n", n);
+    34e5:	83 ec 04             	sub    $0x4,%esp
+    34e8:	57                   	push   %edi
+    34e9:	68 b8 5c 00 00       	push   $0x5cb8
+    34ee:	6a 01                	push   $0x1
+    34f0:	e8 eb 11 00 00       	call   46e0 <printf>
+      exit();
+    34f5:	e8 69 10 00 00       	call   4563 <exit>
+    printf(1, "cow test pipe failed\n");
+    34fa:	57                   	push   %edi
+    34fb:	57                   	push   %edi
+    34fc:	68 a2 5c 00 00       	push   $0x5ca2
+    3501:	6a 01                	push   $0x1
+    3503:	e8 d8 11 00 00       	call   46e0 <printf>
+    exit();
+    3508:	e8 56 10 00 00       	call   4563 <exit>
+        printf(1, "cow test child sees wrong data\n");
+    350d:	56                   	push   %esi
+    350e:	56                   	push   %esi
+    350f:	68 c4 65 00 00       	push   $0x65c4
+    3514:	6a 01                	push   $0x1
+    3516:	e8 c5 11 00 00       	call   46e0 <printf>
+        exit();
+    351b:	e8 43 10 00 00       	call   4563 <exit>
+        printf(1, "cow test read into shared page failed\n");
+    3520:	53                   	push   %ebx
+    3521:	53                   	push   %ebx
+    3522:	68 e4 65 00 00       	push   $0x65e4
+    3527:	6a 01                	push   $0x1
+    3529:	e8 b2 11 00 00       	call   46e0 <printf>
+        exit();
+    352e:	e8 30 10 00 00       	call   4563 <exit>
+    printf(1, "cow test sbrk failed\n");
+    3533:	50                   	push   %eax
+    3534:	50                   	push   %eax
+    3535:	68 8c 5c 00 00       	push   $0x5c8c
+    353a:	6a 01                	push   $0x1
+    353c:	e8 9f 11 00 00       	call   46e0 <printf>
+    exit();
+    3541:	e8 1d 10 00 00       	call   4563 <exit>
+    3546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    354d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003550 <sbrktest>:
+{
+    3550:	55                   	push   %ebp
+    3551:	89 e5                	mov    %esp,%ebp
+    3553:	57                   	push   %edi
+    3554:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    3555:	31 f6                	xor    %esi,%esi
+{
+    3557:	53                   	push   %ebx
+    3558:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    355b:	68 27 5e 00 00       	push   $0x5e27
+    3560:	ff 35 88 74 00 00    	push   0x7488
+    3566:	e8 75 11 00 00       	call   46e0 <printf>
+  oldbrk = sbrk(0);
+    356b:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3572:	e8 74 10 00 00       	call   45eb <sbrk>
+    3577:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    357a:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3581:	e8 65 10 00 00       	call   45eb <sbrk>
+    3586:	83 c4 10             	add    $0x10,%esp
+    3589:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    358b:	eb 05                	jmp    3592 <sbrktest+0x42>
+    358d:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    3590:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    3592:	83 ec 0c             	sub    $0xc,%esp
+    3595:	6a 01                	push   $0x1
+    3597:	e8 4f 10 00 00       	call   45eb <sbrk>
+    if(b != a){
+    359c:	83 c4 10             	add    $0x10,%esp
+    359f:	39 d8                	cmp    %ebx,%eax
+    35a1:	0f 85 9c 02 00 00    	jne    3843 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+    35a7:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    35aa:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    35ad:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    35b0:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    35b6:	75 d8                	jne    3590 <sbrktest+0x40>
+  pid = fork();
+    35b8:	e8 9e 0f 00 00       	call   455b <fork>
+    35bd:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    35bf:	85 c0                	test   %eax,%eax
+    35c1:	0f 88 02 03 00 00    	js     38c9 <sbrktest+0x379>
+  c = sbrk(1);
+    35c7:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    35ca:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    35cd:	6a 01                	push   $0x1
+    35cf:	e8 17 10 00 00       	call   45eb <sbrk>
+  c = sbrk(1);
+    35d4:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    35db:	e8 0b 10 00 00       	call   45eb <sbrk>
+  if(c != a + 1){
+    35e0:	83 c4 10             	add    $0x10,%esp
+    35e3:	39 c3                	cmp    %eax,%ebx
+    35e5:	0f 85 3b 03 00 00    	jne    3926 <sbrktest+0x3d6>
+  if(pid == 0)
+    35eb:	85 f6                	test   %esi,%esi
+    35ed:	0f 84 2e 03 00 00    	je     3921 <sbrktest+0x3d1>
+  wait();
+    35f3:	e8 73 0f 00 00       	call   456b <wait>
+  a = sbrk(0);
+    35f8:	83 ec 0c             	sub    $0xc,%esp
+    35fb:	6a 00                	push   $0x0
+    35fd:	e8 e9 0f 00 00       	call   45eb <sbrk>
+    3602:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    3604:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3609:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    360b:	89 04 24             	mov    %eax,(%esp)
+    360e:	e8 d8 0f 00 00       	call   45eb <sbrk>
+  if (p != a) {
+    3613:	83 c4 10             	add    $0x10,%esp
+    3616:	39 c3                	cmp    %eax,%ebx
+    3618:	0f 85 94 02 00 00    	jne    38b2 <sbrktest+0x362>
+  a = sbrk(0);
+    361e:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    3621:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    3628:	6a 00                	push   $0x0
+    362a:	e8 bc 0f 00 00       	call   45eb <sbrk>
+  c = sbrk(-4096);
+    362f:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    3636:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    3638:	e8 ae 0f 00 00       	call   45eb <sbrk>
+  if(c == (char*)0xffffffff){
+    363d:	83 c4 10             	add    $0x10,%esp
+    3640:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3643:	0f 84 22 03 00 00    	je     396b <sbrktest+0x41b>
+  c = sbrk(0);
+    3649:	83 ec 0c             	sub    $0xc,%esp
+    364c:	6a 00                	push   $0x0
+    364e:	e8 98 0f 00 00       	call   45eb <sbrk>
+  if(c != a - 4096){
+    3653:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    3659:	83 c4 10             	add    $0x10,%esp
+    365c:	39 d0                	cmp    %edx,%eax
+    365e:	0f 85 f0 02 00 00    	jne    3954 <sbrktest+0x404>
+  a = sbrk(0);
+    3664:	83 ec 0c             	sub    $0xc,%esp
+    3667:	6a 00                	push   $0x0
+    3669:	e8 7d 0f 00 00       	call   45eb <sbrk>
+  c = sbrk(4096);
+    366e:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    3675:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    3677:	e8 6f 0f 00 00       	call   45eb <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    367c:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    367f:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    3681:	39 c3                	cmp    %eax,%ebx
+    3683:	0f 85 b4 02 00 00    	jne    393d <sbrktest+0x3ed>
+    3689:	83 ec 0c             	sub    $0xc,%esp
+    368c:	6a 00                	push   $0x0
+    368e:	e8 58 0f 00 00       	call   45eb <sbrk>
+    3693:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    3699:	83 c4 10             	add    $0x10,%esp
+    369c:	39 c2                	cmp    %eax,%edx
+    369e:	0f 85 99 02 00 00    	jne    393d <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+    36a4:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    36ab:	0f 84 2f 02 00 00    	je     38e0 <sbrktest+0x390>
+  a = sbrk(0);
+    36b1:	83 ec 0c             	sub    $0xc,%esp
+    36b4:	6a 00                	push   $0x0
+    36b6:	e8 30 0f 00 00       	call   45eb <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    36bb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    36c2:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    36c4:	e8 22 0f 00 00       	call   45eb <sbrk>
+    36c9:	89 c2                	mov    %eax,%edx
+    36cb:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    36ce:	29 d0                	sub    %edx,%eax
+    36d0:	89 04 24             	mov    %eax,(%esp)
+    36d3:	e8 13 0f 00 00       	call   45eb <sbrk>
+  if(c != a){
+    36d8:	83 c4 10             	add    $0x10,%esp
+    36db:	39 c3                	cmp    %eax,%ebx
+    36dd:	0f 85 b8 01 00 00    	jne    389b <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    36e3:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    36e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    36ef:	90                   	nop
+    ppid = getpid();
+    36f0:	e8 ee 0e 00 00       	call   45e3 <getpid>
+    36f5:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    36f7:	e8 5f 0e 00 00       	call   455b <fork>
+    if(pid < 0){
+    36fc:	85 c0                	test   %eax,%eax
+    36fe:	0f 88 5d 01 00 00    	js     3861 <sbrktest+0x311>
+    if(pid == 0){
+    3704:	0f 84 6f 01 00 00    	je     3879 <sbrktest+0x329>
+    wait();
+    370a:	e8 5c 0e 00 00       	call   456b <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    370f:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    3715:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    371b:	75 d3                	jne    36f0 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    371d:	83 ec 0c             	sub    $0xc,%esp
+    3720:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    3723:	50                   	push   %eax
+    3724:	e8 4a 0e 00 00       	call   4573 <pipe>
+    3729:	83 c4 10             	add    $0x10,%esp
+    372c:	85 c0                	test   %eax,%eax
+    372e:	0f 85 da 01 00 00    	jne    390e <sbrktest+0x3be>
+    3734:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    3737:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    373a:	89 df                	mov    %ebx,%edi
+    373c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    3740:	e8 16 0e 00 00       	call   455b <fork>
+    3745:	89 07                	mov    %eax,(%edi)
+    3747:	85 c0                	test   %eax,%eax
+    3749:	0f 84 91 00 00 00    	je     37e0 <sbrktest+0x290>
+    if(pids[i] != -1)
+    374f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3752:	74 14                	je     3768 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    3754:	83 ec 04             	sub    $0x4,%esp
+    3757:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    375a:	6a 01                	push   $0x1
+    375c:	50                   	push   %eax
+    375d:	ff 75 b8             	push   -0x48(%ebp)
+    3760:	e8 16 0e 00 00       	call   457b <read>
+    3765:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3768:	83 c7 04             	add    $0x4,%edi
+    376b:	39 f7                	cmp    %esi,%edi
+    376d:	75 d1                	jne    3740 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    376f:	83 ec 0c             	sub    $0xc,%esp
+    3772:	68 00 10 00 00       	push   $0x1000
+    3777:	e8 6f 0e 00 00       	call   45eb <sbrk>
+    377c:	83 c4 10             	add    $0x10,%esp
+    377f:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    3781:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    3788:	8b 03                	mov    (%ebx),%eax
+    378a:	83 f8 ff             	cmp    $0xffffffff,%eax
+    378d:	74 11                	je     37a0 <sbrktest+0x250>
+    kill(pids[i]);
+    378f:	83 ec 0c             	sub    $0xc,%esp
+    3792:	50                   	push   %eax
+    3793:	e8 fb 0d 00 00       	call   4593 <kill>
+    wait();
+    3798:	e8 ce 0d 00 00       	call   456b <wait>
+    379d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    37a0:	83 c3 04             	add    $0x4,%ebx
+    37a3:	39 f3                	cmp    %esi,%ebx
+    37a5:	75 e1                	jne    3788 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    37a7:	83 ff ff             	cmp    $0xffffffff,%edi
+    37aa:	0f 84 47 01 00 00    	je     38f7 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+    37b0:	83 ec 0c             	sub    $0xc,%esp
+    37b3:	6a 00                	push   $0x0
+    37b5:	e8 31 0e 00 00       	call   45eb <sbrk>
+    37ba:	83 c4 10             	add    $0x10,%esp
+    37bd:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    37c0:	72 60                	jb     3822 <sbrktest+0x2d2>
+  printf(stdout, "sbrk test OK\n");
+    37c2:	83 ec 08             	sub    $0x8,%esp
+    37c5:	68 7e 5e 00 00       	push   $0x5e7e
+    37ca:	ff 35 88 74 00 00    	push   0x7488
+    37d0:	e8 0b 0f 00 00       	call   46e0 <printf>
+}
+    37d5:	83 c4 10             	add    $0x10,%esp
+    37d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    37db:	5b                   	pop    %ebx
+    37dc:	5e                   	pop    %esi
+    37dd:	5f                   	pop    %edi
+    37de:	5d                   	pop    %ebp
+    37df:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    37e0:	83 ec 0c             	sub    $0xc,%esp
+    37e3:	6a 00                	push   $0x0
+    37e5:	e8 01 0e 00 00       	call   45eb <sbrk>
+    37ea:	89 c2                	mov    %eax,%edx
+    37ec:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    37f1:	29 d0                	sub    %edx,%eax
+    37f3:	89 04 24             	mov    %eax,(%esp)
+    37f6:	e8 f0 0d 00 00       	call   45eb <sbrk>
+      write(fds[1], "x", 1);
+    37fb:	83 c4 0c             	add    $0xc,%esp
+    37fe:	6a 01                	push   $0x1
+    3800:	68 16 5c 00 00       	push   $0x5c16
+    3805:	ff 75 bc             	push   -0x44(%ebp)
+    3808:	e8 76 0d 00 00       	call   4583 <write>
+    380d:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    3810:	83 ec 0c             	sub    $0xc,%esp
+    3813:	68 e8 03 00 00       	push   $0x3e8
+    3818:	e8 d6 0d 00 00       	call   45f3 <sleep>
+    381d:	83 c4 10             	add    $0x10,%esp
+    3820:	eb ee                	jmp    3810 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    3822:	83 ec 0c             	sub    $0xc,%esp
+    3825:	6a 00                	push   $0x0
+    3827:	e8 bf 0d 00 00       	call   45eb <sbrk>
+    382c:	89 c2                	mov    %eax,%edx
+    382e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3831:	29 d0                	sub    %edx,%eax
+    3833:	89 04 24             	mov    %eax,(%esp)
+    3836:	e8 b0 0d 00 00       	call   45eb <sbrk>
+    383b:	83 c4 10             	add    $0x10,%esp
+    383e:	e9 7f ff ff ff       	jmp    37c2 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    3843:	83 ec 0c             	sub    $0xc,%esp
+    3846:	50                   	push   %eax
+    3847:	53                   	push   %ebx
+    3848:	56                   	push   %esi
+    3849:	68 de 5c 00 00       	push   $0x5cde
+    384e:	ff 35 88 74 00 00    	push   0x7488
+    3854:	e8 87 0e 00 00       	call   46e0 <printf>
+      exit();
+    3859:	83 c4 20             	add    $0x20,%esp
+    385c:	e8 02 0d 00 00       	call   4563 <exit>
+      printf(stdout, "fork failed\n");
+    3861:	83 ec 08             	sub    $0x8,%esp
+    3864:	68 27 5f 00 00       	push   $0x5f27
+    3869:	ff 35 88 74 00 00    	push   0x7488
+    386f:	e8 6c 0e 00 00       	call   46e0 <printf>
+      exit();
+    3874:	e8 ea 0c 00 00       	call   4563 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    3879:	0f be 03             	movsbl (%ebx),%eax
+    387c:	50                   	push   %eax
+    387d:	53                   	push   %ebx
+    387e:	68 47 5d 00 00       	push   $0x5d47
+    3883:	ff 35 88 74 00 00    	push   0x7488
+    3889:	e8 52 0e 00 00       	call   46e0 <printf>
+      kill(ppid);
+    388e:	89 34 24             	mov    %esi,(%esp)
+    3891:	e8 fd 0c 00 00       	call   4593 <kill>
+      exit();
+    3896:	e8 c8 0c 00 00       	call   4563 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    389b:	50                   	push   %eax
+    389c:	53                   	push   %ebx
+    389d:	68 28 67 00 00       	push   $0x6728
+    38a2:	ff 35 88 74 00 00    	push   0x7488
+    38a8:	e8 33 0e 00 00       	call   46e0 <printf>
+    exit();
+    38ad:	e8 b1 0c 00 00       	call   4563 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    38b2:	56                   	push   %esi
+    38b3:	56                   	push   %esi
+    38b4:	68 58 66 00 00       	push   $0x6658
+    38b9:	ff 35 88 74 00 00    	push   0x7488
+    38bf:	e8 1c 0e 00 00       	call   46e0 <printf>
+    exit();
+    38c4:	e8 9a 0c 00 00       	call   4563 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    38c9:	50                   	push   %eax
+    38ca:	50                   	push   %eax
+    38cb:	68 f9 5c 00 00       	push   $0x5cf9
+    38d0:	ff 35 88 74 00 00    	push   0x7488
+    38d6:	e8 05 0e 00 00       	call   46e0 <printf>
+    exit();
+    38db:	e8 83 0c 00 00       	call   4563 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    38e0:	51                   	push   %ecx
+    38e1:	51                   	push   %ecx
+    38e2:	68 f8 66 00 00       	push   $0x66f8
+    38e7:	ff 35 88 74 00 00    	push   0x7488
+    38ed:	e8 ee 0d 00 00       	call   46e0 <printf>
+    exit();
+    38f2:	e8 6c 0c 00 00       	call   4563 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    38f7:	50                   	push   %eax
+    38f8:	50                   	push   %eax
+    38f9:	68 60 5d 00 00       	push   $0x5d60
+    38fe:	ff 35 88 74 00 00    	push   0x7488
+    3904:	e8 d7 0d 00 00       	call   46e0 <printf>
+    exit();
+    3909:	e8 55 0c 00 00       	call   4563 <exit>
+    printf(1, "pipe() failed\n");
+    390e:	52                   	push   %edx
+    390f:	52                   	push   %edx
+    3910:	68 79 50 00 00       	push   $0x5079
+    3915:	6a 01                	push   $0x1
+    3917:	e8 c4 0d 00 00       	call   46e0 <printf>
+    exit();
+    391c:	e8 42 0c 00 00       	call   4563 <exit>
+    exit();
+    3921:	e8 3d 0c 00 00       	call   4563 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    3926:	57                   	push   %edi
+    3927:	57                   	push   %edi
+    3928:	68 10 5d 00 00       	push   $0x5d10
+    392d:	ff 35 88 74 00 00    	push   0x7488
+    3933:	e8 a8 0d 00 00       	call   46e0 <printf>
+    exit();
+    3938:	e8 26 0c 00 00       	call   4563 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    393d:	56                   	push   %esi
+    393e:	53                   	push   %ebx
+    393f:	68 d0 66 00 00       	push   $0x66d0
+    3944:	ff 35 88 74 00 00    	push   0x7488
+    394a:	e8 91 0d 00 00       	call   46e0 <printf>
+    exit();
+    394f:	e8 0f 0c 00 00       	call   4563 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    3954:	50                   	push   %eax
+    3955:	53                   	push   %ebx
+    3956:	68 98 66 00 00       	push   $0x6698
+    395b:	ff 35 88 74 00 00    	push   0x7488
+    3961:	e8 7a 0d 00 00       	call   46e0 <printf>
+    exit();
+    3966:	e8 f8 0b 00 00       	call   4563 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    396b:	53                   	push   %ebx
+    396c:	53                   	push   %ebx
+    396d:	68 2c 5d 00 00       	push   $0x5d2c
+    3972:	ff 35 88 74 00 00    	push   0x7488
+    3978:	e8 63 0d 00 00       	call   46e0 <printf>
+    exit();
+    397d:	e8 e1 0b 00 00       	call   4563 <exit>
+    3982:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3989:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003990 <fsynctest>:
+{
+    3990:	55                   	push   %ebp
+    3991:	89 e5                	mov    %esp,%ebp
+    3993:	57                   	push   %edi
+    3994:	56                   	push   %esi
+    3995:	53                   	push   %ebx
+  name[2] = '\0';
+    3996:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+    399b:	83 ec 24             	sub    $0x24,%esp
+  printf(stdout, "fsync test\n");
+    399e:	68 7b 5d 00 00       	push   $0x5d7b
+    39a3:	ff 35 88 74 00 00    	push   0x7488
+    39a9:	e8 32 0d 00 00       	call   46e0 <printf>
+  name[0] = 'y';
+    39ae:	c6 45 e5 79          	movb   $0x79,-0x1b(%ebp)
+  name[2] = '\0';
+    39b2:	83 c4 10             	add    $0x10,%esp
+    39b5:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+    name[1] = '0' + pid;
+    39b9:	88 5d e6             	mov    %bl,-0x1a(%ebp)
+    if((n = fork()) < 0){
+    39bc:	e8 9a 0b 00 00       	call   455b <fork>
+    39c1:	85 c0                	test   %eax,%eax
+    39c3:	0f 88 4f 01 00 00    	js     3b18 <fsynctest+0x188>
+    if(n == 0){
+    39c9:	0f 84 d1 00 00 00    	je     3aa0 <fsynctest+0x110>
+  for(pid = 0; pid < 4; pid++){
+    39cf:	83 c3 01             	add    $0x1,%ebx
+    39d2:	80 fb 34             	cmp    $0x34,%bl
+    39d5:	75 e2                	jne    39b9 <fsynctest+0x29>
+    wait();
+    39d7:	e8 8f 0b 00 00       	call   456b <wait>
+    39dc:	be 30 00 00 00       	mov    $0x30,%esi
+    39e1:	8d 7d e5             	lea    -0x1b(%ebp),%edi
+    39e4:	e8 82 0b 00 00       	call   456b <wait>
+    39e9:	e8 7d 0b 00 00       	call   456b <wait>
+    39ee:	e8 78 0b 00 00       	call   456b <wait>
+    fd = open(name, O_RDONLY);
+    39f3:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + pid;
+    39f6:	89 f0                	mov    %esi,%eax
+    39f8:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    fd = open(name, O_RDONLY);
+    39fb:	6a 00                	push   $0x0
+    39fd:	57                   	push   %edi
+    39fe:	e8 a0 0b 00 00       	call   45a3 <open>
+    if(fd < 0 || read(fd, buf, sizeof(buf)) != 20 || buf[18] != 'y'){
+    3a03:	83 c4 10             	add    $0x10,%esp
+    fd = open(name, O_RDONLY);
+    3a06:	89 c3                	mov    %eax,%ebx
+    if(fd < 0 || read(fd, buf, sizeof(buf)) != 20 || buf[18] != 'y'){
+    3a08:	85 c0                	test   %eax,%eax
+    3a0a:	0f 88 ef 00 00 00    	js     3aff <fsynctest+0x16f>
+    3a10:	83 ec 04             	sub    $0x4,%esp
+    3a13:	68 00 20 00 00       	push   $0x2000
+    3a18:	68 c0 9b 00 00       	push   $0x9bc0
+    3a1d:	50                   	push   %eax
+    3a1e:	e8 58 0b 00 00       	call   457b <read>
+    3a23:	83 c4 10             	add    $0x10,%esp
+    3a26:	83 f8 14             	cmp    $0x14,%eax
+    3a29:	0f 85 d0 00 00 00    	jne    3aff <fsynctest+0x16f>
+    3a2f:	80 3d d2 9b 00 00 79 	cmpb   $0x79,0x9bd2
+    3a36:	0f 85 c3 00 00 00    	jne    3aff <fsynctest+0x16f>
+    if(fsync(fd) != 0){
+    3a3c:	83 ec 0c             	sub    $0xc,%esp
+    3a3f:	53                   	push   %ebx
+    3a40:	e8 c6 0b 00 00       	call   460b <fsync>
+    3a45:	83 c4 10             	add    $0x10,%esp
+    3a48:	85 c0                	test   %eax,%eax
+    3a4a:	0f 85 e0 00 00 00    	jne    3b30 <fsynctest+0x1a0>
+    close(fd);
+    3a50:	83 ec 0c             	sub    $0xc,%esp
+  for(pid = 0; pid < 4; pid++){
+    3a53:	83 c6 01             	add    $0x1,%esi
+    close(fd);
+    3a56:	53                   	push   %ebx
+    3a57:	e8 2f 0b 00 00       	call   458b <close>
+    unlink(name);
+    3a5c:	89 3c 24             	mov    %edi,(%esp)
+    3a5f:	e8 4f 0b 00 00       	call   45b3 <unlink>
+  for(pid = 0; pid < 4; pid++){
+    3a64:	89 f0                	mov    %esi,%eax
+    3a66:	83 c4 10             	add    $0x10,%esp
+    3a69:	3c 34                	cmp    $0x34,%al
+    3a6b:	75 86                	jne    39f3 <fsynctest+0x63>
+  if(fsync(fd) != -1){
+    3a6d:	83 ec 0c             	sub    $0xc,%esp
+    3a70:	53                   	push   %ebx
+    3a71:	e8 95 0b 00 00       	call   460b <fsync>
+    3a76:	83 c4 10             	add    $0x10,%esp
+    3a79:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3a7c:	0f 85 df 00 00 00    	jne    3b61 <fsynctest+0x1d1>
+  printf(stdout, "fsync test ok\n");
+    3a82:	83 ec 08             	sub    $0x8,%esp
+    3a85:	68 13 5e 00 00       	push   $0x5e13
+    3a8a:	ff 35 88 74 00 00    	push   0x7488
+    3a90:	e8 4b 0c 00 00       	call   46e0 <printf>
+}
+    3a95:	83 c4 10             	add    $0x10,%esp
+    3a98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3a9b:	5b                   	pop    %ebx
+    3a9c:	5e                   	pop    %esi
+    3a9d:	5f                   	pop    %edi
+    3a9e:	5d                   	pop    %ebp
+    3a9f:	c3                   	ret
+      fd = open(name, O_CREATE | O_RDWR);
+    3aa0:	83 ec 08             	sub    $0x8,%esp
+    3aa3:	8d 7d e5             	lea    -0x1b(%ebp),%edi
+    3aa6:	68 02 02 00 00       	push   $0x202
+    3aab:	57                   	push   %edi
+    3aac:	e8 f2 0a 00 00       	call   45a3 <open>
+      if(fd < 0){
+    3ab1:	83 c4 10             	add    $0x10,%esp
+      fd = open(name, O_CREATE | O_RDWR);
+    3ab4:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+    3ab6:	85 c0                	test   %eax,%eax
+    3ab8:	0f 88 ba 00 00 00    	js     3b78 <fsynctest+0x1e8>
+    3abe:	bb 0a 00 00 00       	mov    $0xa,%ebx
+    3ac3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3ac7:	90                   	nop
+        if(write(fd, name, 2) != 2 || fsync(fd) != 0){
+    3ac8:	83 ec 04             	sub    $0x4,%esp
+    3acb:	6a 02                	push   $0x2
+    3acd:	57                   	push   %edi
+    3ace:	56                   	push   %esi
+    3acf:	e8 af 0a 00 00       	call   4583 <write>
+    3ad4:	83 c4 10             	add    $0x10,%esp
+    3ad7:	83 f8 02             	cmp    $0x2,%eax
+    3ada:	75 6c                	jne    3b48 <fsynctest+0x1b8>
+    3adc:	83 ec 0c             	sub    $0xc,%esp
+    3adf:	56                   	push   %esi
+    3ae0:	e8 26 0b 00 00       	call   460b <fsync>
+    3ae5:	83 c4 10             	add    $0x10,%esp
+    3ae8:	85 c0                	test   %eax,%eax
+    3aea:	75 5c                	jne    3b48 <fsynctest+0x1b8>
+      for(i = 0; i < 10; i++){
+    3aec:	83 eb 01             	sub    $0x1,%ebx
+    3aef:	75 d7                	jne    3ac8 <fsynctest+0x138>
+      close(fd);
+    3af1:	83 ec 0c             	sub    $0xc,%esp
+    3af4:	56                   	push   %esi
+    3af5:	e8 91 0a 00 00       	call   458b <close>
+      exit();
+    3afa:	e8 64 0a 00 00       	call   4563 <exit>
+      printf(stdout, "fsync %s has wrong contents\n", name);
+    3aff:	83 ec 04             	sub    $0x4,%esp
+    3b02:	57                   	push   %edi
+    3b03:	68 bc 5d 00 00       	push   $0x5dbc
+    3b08:	ff 35 88 74 00 00    	push   0x7488
+    3b0e:	e8 cd 0b 00 00       	call   46e0 <printf>
+      exit();
+    3b13:	e8 4b 0a 00 00       	call   4563 <exit>
+      printf(stdout, "fork failed\n");
+    3b18:	83 ec 08             	sub    $0x8,%esp
+    3b1b:	68 27 5f 00 00       	push   $0x5f27
+    3b20:	ff 35 88 74 00 00    	push   0x7488
+    3b26:	e8 b5 0b 00 00       	call   46e0 <printf>
+      exit();
+    3b2b:	e8 33 0a 00 00       	call   4563 <exit>
+      printf(stdout, "fsync of clean file failed\n");
+    3b30:	83 ec 08             	sub    $0x8,%esp
+    3b33:	68 d9 5d 00 00       	push   $0x5dd9
+    3b38:	ff 35 88 74 00 00    	push   0x7488
+    3b3e:	e8 9d 0b 00 00       	call   46e0 <printf>
+      exit();
+    3b43:	e8 1b 0a 00 00       	call   4563 <exit>
+          printf(stdout, "fsync write/fsync %s failed\n", name);
+    3b48:	83 ec 04             	sub    $0x4,%esp
+    3b4b:	57                   	push   %edi
+    3b4c:	68 9f 5d 00 00       	push   $0x5d9f
+    3b51:	ff 35 88 74 00 00    	push   0x7488
+    3b57:	e8 84 0b 00 00       	call   46e0 <printf>
+          exit();
+    3b5c:	e8 02 0a 00 00       	call   4563 <exit>
+    printf(stdout, "fsync of closed fd succeeded\n");
+    3b61:	50                   	push   %eax
+    3b62:	50                   	push   %eax
+    3b63:	68 f5 5d 00 00       	push   $0x5df5
+    3b68:	ff 35 88 74 00 00    	push   0x7488
+    3b6e:	e8 6d 0b 00 00       	call   46e0 <printf>
+    exit();
+    3b73:	e8 eb 09 00 00       	call   4563 <exit>
+        printf(stdout, "fsync create %s failed\n", name);
+    3b78:	52                   	push   %edx
+    3b79:	57                   	push   %edi
+    3b7a:	68 87 5d 00 00       	push   $0x5d87
+    3b7f:	ff 35 88 74 00 00    	push   0x7488
+    3b85:	e8 56 0b 00 00       	call   46e0 <printf>
+        exit();
+    3b8a:	e8 d4 09 00 00       	call   4563 <exit>
+    3b8f:	90                   	nop
+
+00003b90 <lazytest>:
+{
+    3b90:	55                   	push   %ebp
+    3b91:	89 e5                	mov    %esp,%ebp
+    3b93:	57                   	push   %edi
+    3b94:	56                   	push   %esi
+    3b95:	53                   	push   %ebx
+    3b96:	83 ec 24             	sub    $0x24,%esp
+  printf(stdout, "lazy sbrk test\n");
+    3b99:	68 22 5e 00 00       	push   $0x5e22
+    3b9e:	ff 35 88 74 00 00    	push   0x7488
+    3ba4:	e8 37 0b 00 00       	call   46e0 <printf>
+  oldbrk = sbrk(0);
+    3ba9:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3bb0:	e8 36 0a 00 00       	call   45eb <sbrk>
+  a = sbrk(LAZYSZ);
+    3bb5:	c7 04 24 00 00 a0 00 	movl   $0xa00000,(%esp)
+  oldbrk = sbrk(0);
+    3bbc:	89 c7                	mov    %eax,%edi
+  a = sbrk(LAZYSZ);
+    3bbe:	e8 28 0a 00 00       	call   45eb <sbrk>
+  if(a == (char*)0xffffffff){
+    3bc3:	83 c4 10             	add    $0x10,%esp
+    3bc6:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3bc9:	0f 84 0b 02 00 00    	je     3dda <lazytest+0x24a>
+  fd = open("echo", O_RDONLY);
+    3bcf:	83 ec 08             	sub    $0x8,%esp
+    3bd2:	89 c3                	mov    %eax,%ebx
+    3bd4:	6a 00                	push   $0x0
+    3bd6:	68 25 4e 00 00       	push   $0x4e25
+    3bdb:	e8 c3 09 00 00       	call   45a3 <open>
+  if(fd < 0 || read(fd, a + LAZYSZ/2, 16) != 16 || a[LAZYSZ/2 + 1] != 'E'){
+    3be0:	83 c4 10             	add    $0x10,%esp
+  fd = open("echo", O_RDONLY);
+    3be3:	89 c6                	mov    %eax,%esi
+  if(fd < 0 || read(fd, a + LAZYSZ/2, 16) != 16 || a[LAZYSZ/2 + 1] != 'E'){
+    3be5:	85 c0                	test   %eax,%eax
+    3be7:	0f 88 a7 01 00 00    	js     3d94 <lazytest+0x204>
+    3bed:	83 ec 04             	sub    $0x4,%esp
+    3bf0:	8d 83 00 00 50 00    	lea    0x500000(%ebx),%eax
+    3bf6:	6a 10                	push   $0x10
+    3bf8:	50                   	push   %eax
+    3bf9:	56                   	push   %esi
+    3bfa:	e8 7c 09 00 00       	call   457b <read>
+    3bff:	83 c4 10             	add    $0x10,%esp
+    3c02:	83 f8 10             	cmp    $0x10,%eax
+    3c05:	0f 85 89 01 00 00    	jne    3d94 <lazytest+0x204>
+    3c0b:	80 bb 01 00 50 00 45 	cmpb   $0x45,0x500001(%ebx)
+    3c12:	0f 85 7c 01 00 00    	jne    3d94 <lazytest+0x204>
+  close(fd);
+    3c18:	83 ec 0c             	sub    $0xc,%esp
+    3c1b:	56                   	push   %esi
+    3c1c:	e8 6a 09 00 00       	call   458b <close>
+  if(pipe(fds) != 0 || write(fds[1], a + LAZYSZ - 4096, 1) != 1 ||
+    3c21:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    3c24:	89 04 24             	mov    %eax,(%esp)
+    3c27:	e8 47 09 00 00       	call   4573 <pipe>
+    3c2c:	83 c4 10             	add    $0x10,%esp
+    3c2f:	85 c0                	test   %eax,%eax
+    3c31:	0f 85 45 01 00 00    	jne    3d7c <lazytest+0x1ec>
+    3c37:	83 ec 04             	sub    $0x4,%esp
+    3c3a:	8d 83 00 f0 9f 00    	lea    0x9ff000(%ebx),%eax
+    3c40:	6a 01                	push   $0x1
+    3c42:	50                   	push   %eax
+    3c43:	ff 75 e4             	push   -0x1c(%ebp)
+    3c46:	e8 38 09 00 00       	call   4583 <write>
+    3c4b:	83 c4 10             	add    $0x10,%esp
+    3c4e:	83 f8 01             	cmp    $0x1,%eax
+    3c51:	0f 85 25 01 00 00    	jne    3d7c <lazytest+0x1ec>
+     read(fds[0], a, 1) != 1 || a[0] != 0){
+    3c57:	83 ec 04             	sub    $0x4,%esp
+    3c5a:	6a 01                	push   $0x1
+    3c5c:	53                   	push   %ebx
+    3c5d:	ff 75 e0             	push   -0x20(%ebp)
+    3c60:	e8 16 09 00 00       	call   457b <read>
+  if(pipe(fds) != 0 || write(fds[1], a + LAZYSZ - 4096, 1) != 1 ||
+    3c65:	83 c4 10             	add    $0x10,%esp
+    3c68:	83 f8 01             	cmp    $0x1,%eax
+    3c6b:	0f 85 0b 01 00 00    	jne    3d7c <lazytest+0x1ec>
+     read(fds[0], a, 1) != 1 || a[0] != 0){
+    3c71:	80 3b 00             	cmpb   $0x0,(%ebx)
+    3c74:	0f 85 02 01 00 00    	jne    3d7c <lazytest+0x1ec>
+  close(fds[0]);
+    3c7a:	83 ec 0c             	sub    $0xc,%esp
+    3c7d:	ff 75 e0             	push   -0x20(%ebp)
+    3c80:	e8 06 09 00 00       	call   458b <close>
+  close(fds[1]);
+    3c85:	58                   	pop    %eax
+    3c86:	ff 75 e4             	push   -0x1c(%ebp)
+    3c89:	e8 fd 08 00 00       	call   458b <close>
+  if(getpstat((struct pstat*)(a + LAZYSZ/4), 4) <= 0 ||
+    3c8e:	58                   	pop    %eax
+    3c8f:	8d 83 00 00 28 00    	lea    0x280000(%ebx),%eax
+    3c95:	5a                   	pop    %edx
+    3c96:	6a 04                	push   $0x4
+    3c98:	50                   	push   %eax
+    3c99:	e8 75 09 00 00       	call   4613 <getpstat>
+    3c9e:	83 c4 10             	add    $0x10,%esp
+    3ca1:	85 c0                	test   %eax,%eax
+    3ca3:	0f 8e 03 01 00 00    	jle    3dac <lazytest+0x21c>
+    3ca9:	8b 83 00 00 28 00    	mov    0x280000(%ebx),%eax
+    3caf:	85 c0                	test   %eax,%eax
+    3cb1:	0f 8e f5 00 00 00    	jle    3dac <lazytest+0x21c>
+  pid = fork();
+    3cb7:	e8 9f 08 00 00       	call   455b <fork>
+  if(pid < 0){
+    3cbc:	85 c0                	test   %eax,%eax
+    3cbe:	0f 88 ff 00 00 00    	js     3dc3 <lazytest+0x233>
+  if(pid == 0){
+    3cc4:	75 32                	jne    3cf8 <lazytest+0x168>
+    if(a[LAZYSZ - 1] != 0 || a[LAZYSZ/2 + 1] != 'E'){
+    3cc6:	80 bb ff ff 9f 00 00 	cmpb   $0x0,0x9fffff(%ebx)
+    3ccd:	75 0d                	jne    3cdc <lazytest+0x14c>
+    3ccf:	80 bb 01 00 50 00 45 	cmpb   $0x45,0x500001(%ebx)
+    3cd6:	0f 84 94 00 00 00    	je     3d70 <lazytest+0x1e0>
+      printf(stdout, "lazy sbrk child sees wrong data\n");
+    3cdc:	83 ec 08             	sub    $0x8,%esp
+    3cdf:	68 bc 67 00 00       	push   $0x67bc
+    3ce4:	ff 35 88 74 00 00    	push   0x7488
+    3cea:	e8 f1 09 00 00       	call   46e0 <printf>
+      exit();
+    3cef:	e8 6f 08 00 00       	call   4563 <exit>
+    3cf4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+    3cf8:	e8 6e 08 00 00       	call   456b <wait>
+  if(a[LAZYSZ - 1] != 0){
+    3cfd:	80 bb ff ff 9f 00 00 	cmpb   $0x0,0x9fffff(%ebx)
+    3d04:	0f 85 e7 00 00 00    	jne    3df1 <lazytest+0x261>
+  sbrk(-4096);
+    3d0a:	83 ec 0c             	sub    $0xc,%esp
+  a[LAZYSZ - 1] = 1;
+    3d0d:	c6 83 ff ff 9f 00 01 	movb   $0x1,0x9fffff(%ebx)
+  sbrk(-4096);
+    3d14:	68 00 f0 ff ff       	push   $0xfffff000
+    3d19:	e8 cd 08 00 00       	call   45eb <sbrk>
+  sbrk(4096);
+    3d1e:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+    3d25:	e8 c1 08 00 00       	call   45eb <sbrk>
+  if(a[LAZYSZ - 1] != 0){
+    3d2a:	83 c4 10             	add    $0x10,%esp
+    3d2d:	80 bb ff ff 9f 00 00 	cmpb   $0x0,0x9fffff(%ebx)
+    3d34:	0f 85 ce 00 00 00    	jne    3e08 <lazytest+0x278>
+  sbrk(-(sbrk(0) - oldbrk));
+    3d3a:	83 ec 0c             	sub    $0xc,%esp
+    3d3d:	6a 00                	push   $0x0
+    3d3f:	e8 a7 08 00 00       	call   45eb <sbrk>
+    3d44:	29 c7                	sub    %eax,%edi
+    3d46:	89 3c 24             	mov    %edi,(%esp)
+    3d49:	e8 9d 08 00 00       	call   45eb <sbrk>
+  printf(stdout, "lazy sbrk test OK\n");
+    3d4e:	58                   	pop    %eax
+    3d4f:	5a                   	pop    %edx
+    3d50:	68 79 5e 00 00       	push   $0x5e79
+    3d55:	ff 35 88 74 00 00    	push   0x7488
+    3d5b:	e8 80 09 00 00       	call   46e0 <printf>
+}
+    3d60:	83 c4 10             	add    $0x10,%esp
+    3d63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3d66:	5b                   	pop    %ebx
+    3d67:	5e                   	pop    %esi
+    3d68:	5f                   	pop    %edi
+    3d69:	5d                   	pop    %ebp
+    3d6a:	c3                   	ret
+    3d6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3d6f:	90                   	nop
+    a[LAZYSZ - 1] = 1;
+    3d70:	c6 83 ff ff 9f 00 01 	movb   $0x1,0x9fffff(%ebx)
+    exit();
+    3d77:	e8 e7 07 00 00       	call   4563 <exit>
+    printf(stdout, "lazy sbrk write() from heap failed\n");
+    3d7c:	83 ec 08             	sub    $0x8,%esp
+    3d7f:	68 70 67 00 00       	push   $0x6770
+    3d84:	ff 35 88 74 00 00    	push   0x7488
+    3d8a:	e8 51 09 00 00       	call   46e0 <printf>
+    exit();
+    3d8f:	e8 cf 07 00 00       	call   4563 <exit>
+    printf(stdout, "lazy sbrk read() into heap failed\n");
+    3d94:	83 ec 08             	sub    $0x8,%esp
+    3d97:	68 4c 67 00 00       	push   $0x674c
+    3d9c:	ff 35 88 74 00 00    	push   0x7488
+    3da2:	e8 39 09 00 00       	call   46e0 <printf>
+    exit();
+    3da7:	e8 b7 07 00 00       	call   4563 <exit>
+    printf(stdout, "lazy sbrk getpstat() into heap failed\n");
+    3dac:	57                   	push   %edi
+    3dad:	57                   	push   %edi
+    3dae:	68 94 67 00 00       	push   $0x6794
+    3db3:	ff 35 88 74 00 00    	push   0x7488
+    3db9:	e8 22 09 00 00       	call   46e0 <printf>
+    exit();
+    3dbe:	e8 a0 07 00 00       	call   4563 <exit>
+    printf(stdout, "lazy sbrk fork failed\n");
+    3dc3:	56                   	push   %esi
+    3dc4:	56                   	push   %esi
+    3dc5:	68 44 5e 00 00       	push   $0x5e44
+    3dca:	ff 35 88 74 00 00    	push   0x7488
+    3dd0:	e8 0b 09 00 00       	call   46e0 <printf>
+    exit();
+    3dd5:	e8 89 07 00 00       	call   4563 <exit>
+    printf(stdout, "lazy sbrk failed\n");
+    3dda:	51                   	push   %ecx
+    3ddb:	51                   	push   %ecx
+    3ddc:	68 32 5e 00 00       	push   $0x5e32
+    3de1:	ff 35 88 74 00 00    	push   0x7488
+    3de7:	e8 f4 08 00 00       	call   46e0 <printf>
+    exit();
+    3dec:	e8 72 07 00 00       	call   4563 <exit>
+    printf(stdout, "lazy sbrk child write leaked\n");
+    3df1:	53                   	push   %ebx
+    3df2:	53                   	push   %ebx
+    3df3:	68 5b 5e 00 00       	push   $0x5e5b
+    3df8:	ff 35 88 74 00 00    	push   0x7488
+    3dfe:	e8 dd 08 00 00       	call   46e0 <printf>
+    exit();
+    3e03:	e8 5b 07 00 00       	call   4563 <exit>
+    printf(stdout, "lazy sbrk shrink did not free page\n");
+    3e08:	51                   	push   %ecx
+    3e09:	51                   	push   %ecx
+    3e0a:	68 e0 67 00 00       	push   $0x67e0
+    3e0f:	ff 35 88 74 00 00    	push   0x7488
+    3e15:	e8 c6 08 00 00       	call   46e0 <printf>
+    exit();
+    3e1a:	e8 44 07 00 00       	call   4563 <exit>
+    3e1f:	90                   	nop
+
+00003e20 <validateint>:
+}
+    3e20:	c3                   	ret
+    3e21:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3e2f:	90                   	nop
+
+00003e30 <validatetest>:
+{
+    3e30:	55                   	push   %ebp
+    3e31:	89 e5                	mov    %esp,%ebp
+    3e33:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3e34:	31 f6                	xor    %esi,%esi
+{
+    3e36:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    3e37:	83 ec 08             	sub    $0x8,%esp
+    3e3a:	68 8c 5e 00 00       	push   $0x5e8c
+    3e3f:	ff 35 88 74 00 00    	push   0x7488
+    3e45:	e8 96 08 00 00       	call   46e0 <printf>
+    3e4a:	83 c4 10             	add    $0x10,%esp
+    3e4d:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    3e50:	e8 06 07 00 00       	call   455b <fork>
+    3e55:	89 c3                	mov    %eax,%ebx
+    3e57:	85 c0                	test   %eax,%eax
+    3e59:	74 63                	je     3ebe <validatetest+0x8e>
+    sleep(0);
+    3e5b:	83 ec 0c             	sub    $0xc,%esp
+    3e5e:	6a 00                	push   $0x0
+    3e60:	e8 8e 07 00 00       	call   45f3 <sleep>
+    sleep(0);
+    3e65:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    3e6c:	e8 82 07 00 00       	call   45f3 <sleep>
+    kill(pid);
+    3e71:	89 1c 24             	mov    %ebx,(%esp)
+    3e74:	e8 1a 07 00 00       	call   4593 <kill>
+    wait();
+    3e79:	e8 ed 06 00 00       	call   456b <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    3e7e:	58                   	pop    %eax
+    3e7f:	5a                   	pop    %edx
+    3e80:	56                   	push   %esi
+    3e81:	68 9b 5e 00 00       	push   $0x5e9b
+    3e86:	e8 38 07 00 00       	call   45c3 <link>
+    3e8b:	83 c4 10             	add    $0x10,%esp
+    3e8e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3e91:	75 30                	jne    3ec3 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3e93:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    3e99:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    3e9f:	75 af                	jne    3e50 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    3ea1:	83 ec 08             	sub    $0x8,%esp
+    3ea4:	68 bf 5e 00 00       	push   $0x5ebf
+    3ea9:	ff 35 88 74 00 00    	push   0x7488
+    3eaf:	e8 2c 08 00 00       	call   46e0 <printf>
+}
+    3eb4:	83 c4 10             	add    $0x10,%esp
+    3eb7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3eba:	5b                   	pop    %ebx
+    3ebb:	5e                   	pop    %esi
+    3ebc:	5d                   	pop    %ebp
+    3ebd:	c3                   	ret
+      exit();
+    3ebe:	e8 a0 06 00 00       	call   4563 <exit>
+      printf(stdout, "link should not succeed\n");
+    3ec3:	83 ec 08             	sub    $0x8,%esp
+    3ec6:	68 a6 5e 00 00       	push   $0x5ea6
+    3ecb:	ff 35 88 74 00 00    	push   0x7488
+    3ed1:	e8 0a 08 00 00       	call   46e0 <printf>
+      exit();
+    3ed6:	e8 88 06 00 00       	call   4563 <exit>
+    3edb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3edf:	90                   	nop
+
+00003ee0 <bsstest>:
+{
+    3ee0:	55                   	push   %ebp
+    3ee1:	89 e5                	mov    %esp,%ebp
+    3ee3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    3ee6:	68 cc 5e 00 00       	push   $0x5ecc
+    3eeb:	ff 35 88 74 00 00    	push   0x7488
+    3ef1:	e8 ea 07 00 00       	call   46e0 <printf>
+    3ef6:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    3ef9:	31 c0                	xor    %eax,%eax
+    3efb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3eff:	90                   	nop
+    if(uninit[i] != '\0'){
+    3f00:	80 b8 a0 74 00 00 00 	cmpb   $0x0,0x74a0(%eax)
+    3f07:	75 22                	jne    3f2b <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    3f09:	83 c0 01             	add    $0x1,%eax
+    3f0c:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    3f11:	75 ed                	jne    3f00 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    3f13:	83 ec 08             	sub    $0x8,%esp
+    3f16:	68 e7 5e 00 00       	push   $0x5ee7
+    3f1b:	ff 35 88 74 00 00    	push   0x7488
+    3f21:	e8 ba 07 00 00       	call   46e0 <printf>
+}
+    3f26:	83 c4 10             	add    $0x10,%esp
+    3f29:	c9                   	leave
+    3f2a:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    3f2b:	83 ec 08             	sub    $0x8,%esp
+    3f2e:	68 d6 5e 00 00       	push   $0x5ed6
+    3f33:	ff 35 88 74 00 00    	push   0x7488
+    3f39:	e8 a2 07 00 00       	call   46e0 <printf>
+      exit();
+    3f3e:	e8 20 06 00 00       	call   4563 <exit>
+    3f43:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003f50 <bigargtest>:
+{
+    3f50:	55                   	push   %ebp
+    3f51:	89 e5                	mov    %esp,%ebp
+    3f53:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    3f56:	68 f4 5e 00 00       	push   $0x5ef4
+    3f5b:	e8 53 06 00 00       	call   45b3 <unlink>
+  pid = fork();
+    3f60:	e8 f6 05 00 00       	call   455b <fork>
+  if(pid == 0){
+    3f65:	83 c4 10             	add    $0x10,%esp
+    3f68:	85 c0                	test   %eax,%eax
+    3f6a:	74 44                	je     3fb0 <bigargtest+0x60>
+  } else if(pid < 0){
+    3f6c:	0f 88 c3 00 00 00    	js     4035 <bigargtest+0xe5>
+  wait();
+    3f72:	e8 f4 05 00 00       	call   456b <wait>
+  fd = open("bigarg-ok", 0);
+    3f77:	83 ec 08             	sub    $0x8,%esp
+    3f7a:	6a 00                	push   $0x0
+    3f7c:	68 f4 5e 00 00       	push   $0x5ef4
+    3f81:	e8 1d 06 00 00       	call   45a3 <open>
+  if(fd < 0){
+    3f86:	83 c4 10             	add    $0x10,%esp
+    3f89:	85 c0                	test   %eax,%eax
+    3f8b:	0f 88 8d 00 00 00    	js     401e <bigargtest+0xce>
+  close(fd);
+    3f91:	83 ec 0c             	sub    $0xc,%esp
+    3f94:	50                   	push   %eax
+    3f95:	e8 f1 05 00 00       	call   458b <close>
+  unlink("bigarg-ok");
+    3f9a:	c7 04 24 f4 5e 00 00 	movl   $0x5ef4,(%esp)
+    3fa1:	e8 0d 06 00 00       	call   45b3 <unlink>
+}
+    3fa6:	83 c4 10             	add    $0x10,%esp
+    3fa9:	c9                   	leave
+    3faa:	c3                   	ret
+    3fab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3faf:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    3fb0:	c7 04 85 c0 bb 00 00 	movl   $0x6804,0xbbc0(,%eax,4)
+    3fb7:	04 68 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    3fbb:	83 c0 01             	add    $0x1,%eax
+    3fbe:	83 f8 1f             	cmp    $0x1f,%eax
+    3fc1:	75 ed                	jne    3fb0 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    3fc3:	31 c9                	xor    %ecx,%ecx
+    3fc5:	89 0d 3c bc 00 00    	mov    %ecx,0xbc3c
+    printf(stdout, "bigarg test\n");
+    3fcb:	50                   	push   %eax
+    3fcc:	50                   	push   %eax
+    3fcd:	68 fe 5e 00 00       	push   $0x5efe
+    3fd2:	ff 35 88 74 00 00    	push   0x7488
+    3fd8:	e8 03 07 00 00       	call   46e0 <printf>
+    exec("echo", args);
+    3fdd:	58                   	pop    %eax
+    3fde:	5a                   	pop    %edx
+    3fdf:	68 c0 bb 00 00       	push   $0xbbc0
+    3fe4:	68 25 4e 00 00       	push   $0x4e25
+    3fe9:	e8 ad 05 00 00       	call   459b <exec>
+    printf(stdout, "bigarg test ok\n");
+    3fee:	59                   	pop    %ecx
+    3fef:	58                   	pop    %eax
+    3ff0:	68 0b 5f 00 00       	push   $0x5f0b
+    3ff5:	ff 35 88 74 00 00    	push   0x7488
+    3ffb:	e8 e0 06 00 00       	call   46e0 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    4000:	58                   	pop    %eax
+    4001:	5a                   	pop    %edx
+    4002:	68 00 02 00 00       	push   $0x200
+    4007:	68 f4 5e 00 00       	push   $0x5ef4
+    400c:	e8 92 05 00 00       	call   45a3 <open>
+    close(fd);
+    4011:	89 04 24             	mov    %eax,(%esp)
+    4014:	e8 72 05 00 00       	call   458b <close>
+    exit();
+    4019:	e8 45 05 00 00       	call   4563 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    401e:	50                   	push   %eax
+    401f:	50                   	push   %eax
+    4020:	68 34 5f 00 00       	push   $0x5f34
+    4025:	ff 35 88 74 00 00    	push   0x7488
+    402b:	e8 b0 06 00 00       	call   46e0 <printf>
+    exit();
+    4030:	e8 2e 05 00 00       	call   4563 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    4035:	52                   	push   %edx
+    4036:	52                   	push   %edx
+    4037:	68 1b 5f 00 00       	push   $0x5f1b
+    403c:	ff 35 88 74 00 00    	push   0x7488
+    4042:	e8 99 06 00 00       	call   46e0 <printf>
+    exit();
+    4047:	e8 17 05 00 00       	call   4563 <exit>
+    404c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004050 <fsfull>:
+{
+    4050:	55                   	push   %ebp
+    4051:	89 e5                	mov    %esp,%ebp
+    4053:	57                   	push   %edi
+    4054:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    4055:	31 f6                	xor    %esi,%esi
+{
+    4057:	53                   	push   %ebx
+    4058:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    405b:	68 49 5f 00 00       	push   $0x5f49
+    4060:	6a 01                	push   $0x1
+    4062:	e8 79 06 00 00       	call   46e0 <printf>
+    4067:	83 c4 10             	add    $0x10,%esp
+    406a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    4070:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    4075:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    407a:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    407d:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4081:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    4083:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4087:	c1 ea 06             	shr    $0x6,%edx
+    408a:	8d 42 30             	lea    0x30(%edx),%eax
+    408d:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4090:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    4096:	89 f2                	mov    %esi,%edx
+    4098:	29 c2                	sub    %eax,%edx
+    409a:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    409f:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    40a1:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    40a6:	c1 ea 05             	shr    $0x5,%edx
+    40a9:	83 c2 30             	add    $0x30,%edx
+    40ac:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    40af:	f7 e6                	mul    %esi
+    40b1:	c1 ea 05             	shr    $0x5,%edx
+    40b4:	6b c2 64             	imul   $0x64,%edx,%eax
+    40b7:	89 f2                	mov    %esi,%edx
+    40b9:	29 c2                	sub    %eax,%edx
+    40bb:	89 d0                	mov    %edx,%eax
+    40bd:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    40bf:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    40c1:	c1 ea 03             	shr    $0x3,%edx
+    40c4:	83 c2 30             	add    $0x30,%edx
+    40c7:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    40ca:	f7 e1                	mul    %ecx
+    40cc:	89 f0                	mov    %esi,%eax
+    40ce:	c1 ea 03             	shr    $0x3,%edx
+    40d1:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    40d4:	01 d2                	add    %edx,%edx
+    40d6:	29 d0                	sub    %edx,%eax
+    40d8:	83 c0 30             	add    $0x30,%eax
+    40db:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    40de:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    40e1:	50                   	push   %eax
+    40e2:	68 56 5f 00 00       	push   $0x5f56
+    40e7:	6a 01                	push   $0x1
+    40e9:	e8 f2 05 00 00       	call   46e0 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    40ee:	58                   	pop    %eax
+    40ef:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    40f2:	5a                   	pop    %edx
+    40f3:	68 02 02 00 00       	push   $0x202
+    40f8:	50                   	push   %eax
+    40f9:	e8 a5 04 00 00       	call   45a3 <open>
+    if(fd < 0){
+    40fe:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    4101:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    4103:	85 c0                	test   %eax,%eax
+    4105:	78 4f                	js     4156 <fsfull+0x106>
+    int total = 0;
+    4107:	31 db                	xor    %ebx,%ebx
+    4109:	eb 07                	jmp    4112 <fsfull+0xc2>
+    410b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    410f:	90                   	nop
+      total += cc;
+    4110:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    4112:	83 ec 04             	sub    $0x4,%esp
+    4115:	68 00 02 00 00       	push   $0x200
+    411a:	68 c0 9b 00 00       	push   $0x9bc0
+    411f:	57                   	push   %edi
+    4120:	e8 5e 04 00 00       	call   4583 <write>
+      if(cc < 512)
+    4125:	83 c4 10             	add    $0x10,%esp
+    4128:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    412d:	7f e1                	jg     4110 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    412f:	83 ec 04             	sub    $0x4,%esp
+    4132:	53                   	push   %ebx
+    4133:	68 72 5f 00 00       	push   $0x5f72
+    4138:	6a 01                	push   $0x1
+    413a:	e8 a1 05 00 00       	call   46e0 <printf>
+    close(fd);
+    413f:	89 3c 24             	mov    %edi,(%esp)
+    4142:	e8 44 04 00 00       	call   458b <close>
+    if(total == 0)
+    4147:	83 c4 10             	add    $0x10,%esp
+    414a:	85 db                	test   %ebx,%ebx
+    414c:	74 1e                	je     416c <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    414e:	83 c6 01             	add    $0x1,%esi
+    4151:	e9 1a ff ff ff       	jmp    4070 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    4156:	83 ec 04             	sub    $0x4,%esp
+    4159:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    415c:	50                   	push   %eax
+    415d:	68 62 5f 00 00       	push   $0x5f62
+    4162:	6a 01                	push   $0x1
+    4164:	e8 77 05 00 00       	call   46e0 <printf>
+      break;
+    4169:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    416c:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4171:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    4176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    417d:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    4180:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    4182:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    4185:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4189:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    418b:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    418f:	c1 ea 06             	shr    $0x6,%edx
+    4192:	8d 42 30             	lea    0x30(%edx),%eax
+    4195:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4198:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    419e:	89 f2                	mov    %esi,%edx
+    41a0:	29 c2                	sub    %eax,%edx
+    41a2:	89 d0                	mov    %edx,%eax
+    41a4:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    41a6:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    41a8:	c1 ea 05             	shr    $0x5,%edx
+    41ab:	83 c2 30             	add    $0x30,%edx
+    41ae:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    41b1:	f7 e3                	mul    %ebx
+    41b3:	c1 ea 05             	shr    $0x5,%edx
+    41b6:	6b ca 64             	imul   $0x64,%edx,%ecx
+    41b9:	89 f2                	mov    %esi,%edx
+    41bb:	29 ca                	sub    %ecx,%edx
+    41bd:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    41c2:	89 d0                	mov    %edx,%eax
+    41c4:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    41c6:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    41c8:	c1 ea 03             	shr    $0x3,%edx
+    41cb:	83 c2 30             	add    $0x30,%edx
+    41ce:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    41d1:	f7 e1                	mul    %ecx
+    41d3:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    41d5:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    41d8:	c1 ea 03             	shr    $0x3,%edx
+    41db:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    41de:	01 d2                	add    %edx,%edx
+    41e0:	29 d0                	sub    %edx,%eax
+    41e2:	83 c0 30             	add    $0x30,%eax
+    41e5:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    41e8:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    41eb:	50                   	push   %eax
+    41ec:	e8 c2 03 00 00       	call   45b3 <unlink>
+  while(nfiles >= 0){
+    41f1:	83 c4 10             	add    $0x10,%esp
+    41f4:	83 fe ff             	cmp    $0xffffffff,%esi
+    41f7:	75 87                	jne    4180 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    41f9:	83 ec 08             	sub    $0x8,%esp
+    41fc:	68 82 5f 00 00       	push   $0x5f82
+    4201:	6a 01                	push   $0x1
+    4203:	e8 d8 04 00 00       	call   46e0 <printf>
+}
+    4208:	83 c4 10             	add    $0x10,%esp
+    420b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    420e:	5b                   	pop    %ebx
+    420f:	5e                   	pop    %esi
+    4210:	5f                   	pop    %edi
+    4211:	5d                   	pop    %ebp
+    4212:	c3                   	ret
+    4213:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    421a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00004220 <uio>:
+{
+    4220:	55                   	push   %ebp
+    4221:	89 e5                	mov    %esp,%ebp
+    4223:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    4226:	68 98 5f 00 00       	push   $0x5f98
+    422b:	6a 01                	push   $0x1
+    422d:	e8 ae 04 00 00       	call   46e0 <printf>
+  pid = fork();
+    4232:	e8 24 03 00 00       	call   455b <fork>
+  if(pid == 0){
+    4237:	83 c4 10             	add    $0x10,%esp
+    423a:	85 c0                	test   %eax,%eax
+    423c:	74 1b                	je     4259 <uio+0x39>
+  } else if(pid < 0){
+    423e:	78 3d                	js     427d <uio+0x5d>
+  wait();
+    4240:	e8 26 03 00 00       	call   456b <wait>
+  printf(1, "uio test done\n");
+    4245:	83 ec 08             	sub    $0x8,%esp
+    4248:	68 a2 5f 00 00       	push   $0x5fa2
+    424d:	6a 01                	push   $0x1
+    424f:	e8 8c 04 00 00       	call   46e0 <printf>
+}
+    4254:	83 c4 10             	add    $0x10,%esp
+    4257:	c9                   	leave
+    4258:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    4259:	b8 09 00 00 00       	mov    $0x9,%eax
+    425e:	ba 70 00 00 00       	mov    $0x70,%edx
+    4263:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    4264:	ba 71 00 00 00       	mov    $0x71,%edx
+    4269:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    426a:	52                   	push   %edx
+    426b:	52                   	push   %edx
+    426c:	68 e4 68 00 00       	push   $0x68e4
+    4271:	6a 01                	push   $0x1
+    4273:	e8 68 04 00 00       	call   46e0 <printf>
+    exit();
+    4278:	e8 e6 02 00 00       	call   4563 <exit>
+    printf (1, "fork failed\n");
+    427d:	50                   	push   %eax
+    427e:	50                   	push   %eax
+    427f:	68 27 5f 00 00       	push   $0x5f27
+    4284:	6a 01                	push   $0x1
+    4286:	e8 55 04 00 00       	call   46e0 <printf>
+    exit();
+    428b:	e8 d3 02 00 00       	call   4563 <exit>
+
+00004290 <argptest>:
+{
+    4290:	55                   	push   %ebp
+    4291:	89 e5                	mov    %esp,%ebp
+    4293:	53                   	push   %ebx
+    4294:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    4297:	6a 00                	push   $0x0
+    4299:	68 b1 5f 00 00       	push   $0x5fb1
+    429e:	e8 00 03 00 00       	call   45a3 <open>
+  if (fd < 0) {
+    42a3:	83 c4 10             	add    $0x10,%esp
+    42a6:	85 c0                	test   %eax,%eax
+    42a8:	78 39                	js     42e3 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    42aa:	83 ec 0c             	sub    $0xc,%esp
+    42ad:	89 c3                	mov    %eax,%ebx
+    42af:	6a 00                	push   $0x0
+    42b1:	e8 35 03 00 00       	call   45eb <sbrk>
+    42b6:	83 c4 0c             	add    $0xc,%esp
+    42b9:	83 e8 01             	sub    $0x1,%eax
+    42bc:	6a ff                	push   $0xffffffff
+    42be:	50                   	push   %eax
+    42bf:	53                   	push   %ebx
+    42c0:	e8 b6 02 00 00       	call   457b <read>
+  close(fd);
+    42c5:	89 1c 24             	mov    %ebx,(%esp)
+    42c8:	e8 be 02 00 00       	call   458b <close>
+  printf(1, "arg test passed\n");
+    42cd:	58                   	pop    %eax
+    42ce:	5a                   	pop    %edx
+    42cf:	68 c3 5f 00 00       	push   $0x5fc3
+    42d4:	6a 01                	push   $0x1
+    42d6:	e8 05 04 00 00       	call   46e0 <printf>
+}
+    42db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    42de:	83 c4 10             	add    $0x10,%esp
+    42e1:	c9                   	leave
+    42e2:	c3                   	ret
+    printf(2, "open failed\n");
+    42e3:	51                   	push   %ecx
+    42e4:	51                   	push   %ecx
+    42e5:	68 b6 5f 00 00       	push   $0x5fb6
+    42ea:	6a 02                	push   $0x2
+    42ec:	e8 ef 03 00 00       	call   46e0 <printf>
+    exit();
+    42f1:	e8 6d 02 00 00       	call   4563 <exit>
+    42f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    42fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004300 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    4300:	69 05 84 74 00 00 0d 	imul   $0x19660d,0x7484,%eax
+    4307:	66 19 00 
+    430a:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    430f:	a3 84 74 00 00       	mov    %eax,0x7484
+}
+    4314:	c3                   	ret
+    4315:	66 90                	xchg   %ax,%ax
+    4317:	66 90                	xchg   %ax,%ax
+    4319:	66 90                	xchg   %ax,%ax
+    431b:	66 90                	xchg   %ax,%ax
+    431d:	66 90                	xchg   %ax,%ax
+    431f:	90                   	nop
+
+00004320 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    4320:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    4321:	31 c0                	xor    %eax,%eax
+{
+    4323:	89 e5                	mov    %esp,%ebp
+    4325:	53                   	push   %ebx
+    4326:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    4329:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    432c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    4330:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    4334:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    4337:	83 c0 01             	add    $0x1,%eax
+    433a:	84 d2                	test   %dl,%dl
+    433c:	75 f2                	jne    4330 <strcpy+0x10>
+    ;
+  return os;
+}
+    433e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4341:	89 c8                	mov    %ecx,%eax
+    4343:	c9                   	leave
+    4344:	c3                   	ret
+    4345:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    434c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004350 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    4350:	55                   	push   %ebp
+    4351:	89 e5                	mov    %esp,%ebp
+    4353:	53                   	push   %ebx
+    4354:	8b 55 08             	mov    0x8(%ebp),%edx
+    4357:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    435a:	0f b6 02             	movzbl (%edx),%eax
+    435d:	84 c0                	test   %al,%al
+    435f:	75 17                	jne    4378 <strcmp+0x28>
+    4361:	eb 3a                	jmp    439d <strcmp+0x4d>
+    4363:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4367:	90                   	nop
+    4368:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    436c:	83 c2 01             	add    $0x1,%edx
+    436f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    4372:	84 c0                	test   %al,%al
+    4374:	74 1a                	je     4390 <strcmp+0x40>
+    p++, q++;
+    4376:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    4378:	0f b6 19             	movzbl (%ecx),%ebx
+    437b:	38 c3                	cmp    %al,%bl
+    437d:	74 e9                	je     4368 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    437f:	29 d8                	sub    %ebx,%eax
+}
+    4381:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4384:	c9                   	leave
+    4385:	c3                   	ret
+    4386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    438d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    4390:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    4394:	31 c0                	xor    %eax,%eax
+    4396:	29 d8                	sub    %ebx,%eax
+}
+    4398:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    439b:	c9                   	leave
+    439c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    439d:	0f b6 19             	movzbl (%ecx),%ebx
+    43a0:	31 c0                	xor    %eax,%eax
+    43a2:	eb db                	jmp    437f <strcmp+0x2f>
+    43a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    43ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    43af:	90                   	nop
+
+000043b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    43b0:	55                   	push   %ebp
+    43b1:	89 e5                	mov    %esp,%ebp
+    43b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    43b6:	80 3a 00             	cmpb   $0x0,(%edx)
+    43b9:	74 15                	je     43d0 <strlen+0x20>
+    43bb:	31 c0                	xor    %eax,%eax
+    43bd:	8d 76 00             	lea    0x0(%esi),%esi
+    43c0:	83 c0 01             	add    $0x1,%eax
+    43c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    43c7:	89 c1                	mov    %eax,%ecx
+    43c9:	75 f5                	jne    43c0 <strlen+0x10>
+    ;
+  return n;
+}
+    43cb:	89 c8                	mov    %ecx,%eax
+    43cd:	5d                   	pop    %ebp
+    43ce:	c3                   	ret
+    43cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+    43d0:	31 c9                	xor    %ecx,%ecx
+}
+    43d2:	5d                   	pop    %ebp
+    43d3:	89 c8                	mov    %ecx,%eax
+    43d5:	c3                   	ret
+    43d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    43dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000043e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    43e0:	55                   	push   %ebp
+    43e1:	89 e5                	mov    %esp,%ebp
+    43e3:	57                   	push   %edi
+    43e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    43e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    43ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+    43ed:	89 d7                	mov    %edx,%edi
+    43ef:	fc                   	cld
+    43f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    43f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    43f5:	89 d0                	mov    %edx,%eax
+    43f7:	c9                   	leave
+    43f8:	c3                   	ret
+    43f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004400 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    4400:	55                   	push   %ebp
+    4401:	89 e5                	mov    %esp,%ebp
+    4403:	8b 45 08             	mov    0x8(%ebp),%eax
+    4406:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    440a:	0f b6 10             	movzbl (%eax),%edx
+    440d:	84 d2                	test   %dl,%dl
+    440f:	75 12                	jne    4423 <strchr+0x23>
+    4411:	eb 1d                	jmp    4430 <strchr+0x30>
+    4413:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4417:	90                   	nop
+    4418:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    441c:	83 c0 01             	add    $0x1,%eax
+    441f:	84 d2                	test   %dl,%dl
+    4421:	74 0d                	je     4430 <strchr+0x30>
+    if(*s == c)
+    4423:	38 d1                	cmp    %dl,%cl
+    4425:	75 f1                	jne    4418 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    4427:	5d                   	pop    %ebp
+    4428:	c3                   	ret
+    4429:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    4430:	31 c0                	xor    %eax,%eax
+}
+    4432:	5d                   	pop    %ebp
+    4433:	c3                   	ret
+    4434:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    443b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    443f:	90                   	nop
+
+00004440 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    4440:	55                   	push   %ebp
+    4441:	89 e5                	mov    %esp,%ebp
+    4443:	57                   	push   %edi
+    4444:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    4445:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    4448:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    4449:	31 db                	xor    %ebx,%ebx
+{
+    444b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    444e:	eb 27                	jmp    4477 <gets+0x37>
+    cc = read(0, &c, 1);
+    4450:	83 ec 04             	sub    $0x4,%esp
+    4453:	6a 01                	push   $0x1
+    4455:	56                   	push   %esi
+    4456:	6a 00                	push   $0x0
+    4458:	e8 1e 01 00 00       	call   457b <read>
+    if(cc < 1)
+    445d:	83 c4 10             	add    $0x10,%esp
+    4460:	85 c0                	test   %eax,%eax
+    4462:	7e 1d                	jle    4481 <gets+0x41>
+      break;
+    buf[i++] = c;
+    4464:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    4468:	8b 55 08             	mov    0x8(%ebp),%edx
+    446b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    446f:	3c 0a                	cmp    $0xa,%al
+    4471:	74 10                	je     4483 <gets+0x43>
+    4473:	3c 0d                	cmp    $0xd,%al
+    4475:	74 0c                	je     4483 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    4477:	89 df                	mov    %ebx,%edi
+    4479:	83 c3 01             	add    $0x1,%ebx
+    447c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    447f:	7c cf                	jl     4450 <gets+0x10>
+    4481:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    4483:	8b 45 08             	mov    0x8(%ebp),%eax
+    4486:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    448a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    448d:	5b                   	pop    %ebx
+    448e:	5e                   	pop    %esi
+    448f:	5f                   	pop    %edi
+    4490:	5d                   	pop    %ebp
+    4491:	c3                   	ret
+    4492:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4499:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000044a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    44a0:	55                   	push   %ebp
+    44a1:	89 e5                	mov    %esp,%ebp
+    44a3:	56                   	push   %esi
+    44a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    44a5:	83 ec 08             	sub    $0x8,%esp
+    44a8:	6a 00                	push   $0x0
+    44aa:	ff 75 08             	push   0x8(%ebp)
+    44ad:	e8 f1 00 00 00       	call   45a3 <open>
+  if(fd < 0)
+    44b2:	83 c4 10             	add    $0x10,%esp
+    44b5:	85 c0                	test   %eax,%eax
+    44b7:	78 27                	js     44e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    44b9:	83 ec 08             	sub    $0x8,%esp
+    44bc:	ff 75 0c             	push   0xc(%ebp)
+    44bf:	89 c3                	mov    %eax,%ebx
+    44c1:	50                   	push   %eax
+    44c2:	e8 f4 00 00 00       	call   45bb <fstat>
+  close(fd);
+    44c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    44ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+    44cc:	e8 ba 00 00 00       	call   458b <close>
+  return r;
+    44d1:	83 c4 10             	add    $0x10,%esp
+}
+    44d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    44d7:	89 f0                	mov    %esi,%eax
+    44d9:	5b                   	pop    %ebx
+    44da:	5e                   	pop    %esi
+    44db:	5d                   	pop    %ebp
+    44dc:	c3                   	ret
+    44dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    44e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    44e5:	eb ed                	jmp    44d4 <stat+0x34>
+    44e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    44ee:	66 90                	xchg   %ax,%ax
+
+000044f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    44f0:	55                   	push   %ebp
+    44f1:	89 e5                	mov    %esp,%ebp
+    44f3:	53                   	push   %ebx
+    44f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    44f7:	0f be 02             	movsbl (%edx),%eax
+    44fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    44fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    4500:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    4505:	77 1e                	ja     4525 <atoi+0x35>
+    4507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    450e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    4510:	83 c2 01             	add    $0x1,%edx
+    4513:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    4516:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    451a:	0f be 02             	movsbl (%edx),%eax
+    451d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    4520:	80 fb 09             	cmp    $0x9,%bl
+    4523:	76 eb                	jbe    4510 <atoi+0x20>
+  return n;
+}
+    4525:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4528:	89 c8                	mov    %ecx,%eax
+    452a:	c9                   	leave
+    452b:	c3                   	ret
+    452c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00004530 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    4530:	55                   	push   %ebp
+    4531:	89 e5                	mov    %esp,%ebp
+    4533:	57                   	push   %edi
+    4534:	56                   	push   %esi
+    4535:	8b 45 10             	mov    0x10(%ebp),%eax
+    4538:	8b 55 08             	mov    0x8(%ebp),%edx
+    453b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    453e:	85 c0                	test   %eax,%eax
+    4540:	7e 13                	jle    4555 <memmove+0x25>
+    4542:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    4544:	89 d7                	mov    %edx,%edi
+    4546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    454d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    4550:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    4551:	39 f8                	cmp    %edi,%eax
+    4553:	75 fb                	jne    4550 <memmove+0x20>
+  return vdst;
+}
+    4555:	5e                   	pop    %esi
+    4556:	89 d0                	mov    %edx,%eax
+    4558:	5f                   	pop    %edi
+    4559:	5d                   	pop    %ebp
+    455a:	c3                   	ret
+
+0000455b <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    455b:	b8 01 00 00 00       	mov    $0x1,%eax
+    4560:	cd 40                	int    $0x40
+    4562:	c3                   	ret
+
+00004563 <exit>:
+SYSCALL(exit)
+    4563:	b8 02 00 00 00       	mov    $0x2,%eax
+    4568:	cd 40                	int    $0x40
+    456a:	c3                   	ret
+
+0000456b <wait>:
+SYSCALL(wait)
+    456b:	b8 03 00 00 00       	mov    $0x3,%eax
+    4570:	cd 40                	int    $0x40
+    4572:	c3                   	ret
+
+00004573 <pipe>:
+SYSCALL(pipe)
+    4573:	b8 04 00 00 00       	mov    $0x4,%eax
+    4578:	cd 40                	int    $0x40
+    457a:	c3                   	ret
+
+0000457b <read>:
+SYSCALL(read)
+    457b:	b8 05 00 00 00       	mov    $0x5,%eax
+    4580:	cd 40                	int    $0x40
+    4582:	c3                   	ret
+
+00004583 <write>:
+SYSCALL(write)
+    4583:	b8 10 00 00 00       	mov    $0x10,%eax
+    4588:	cd 40                	int    $0x40
+    458a:	c3                   	ret
+
+0000458b <close>:
+SYSCALL(close)
+    458b:	b8 15 00 00 00       	mov    $0x15,%eax
+    4590:	cd 40                	int    $0x40
+    4592:	c3                   	ret
+
+00004593 <kill>:
+SYSCALL(kill)
+    4593:	b8 06 00 00 00       	mov    $0x6,%eax
+    4598:	cd 40                	int    $0x40
+    459a:	c3                   	ret
+
+0000459b <exec>:
+SYSCALL(exec)
+    459b:	b8 07 00 00 00       	mov    $0x7,%eax
+    45a0:	cd 40                	int    $0x40
+    45a2:	c3                   	ret
+
+000045a3 <open>:
+SYSCALL(open)
+    45a3:	b8 0f 00 00 00       	mov    $0xf,%eax
+    45a8:	cd 40                	int    $0x40
+    45aa:	c3                   	ret
+
+000045ab <mknod>:
+SYSCALL(mknod)
+    45ab:	b8 11 00 00 00       	mov    $0x11,%eax
+    45b0:	cd 40                	int    $0x40
+    45b2:	c3                   	ret
+
+000045b3 <unlink>:
+SYSCALL(unlink)
+    45b3:	b8 12 00 00 00       	mov    $0x12,%eax
+    45b8:	cd 40                	int    $0x40
+    45ba:	c3                   	ret
+
+000045bb <fstat>:
+SYSCALL(fstat)
+    45bb:	b8 08 00 00 00       	mov    $0x8,%eax
+    45c0:	cd 40                	int    $0x40
+    45c2:	c3                   	ret
+
+000045c3 <link>:
+SYSCALL(link)
+    45c3:	b8 13 00 00 00       	mov    $0x13,%eax
+    45c8:	cd 40                	int    $0x40
+    45ca:	c3                   	ret
+
+000045cb <mkdir>:
+SYSCALL(mkdir)
+    45cb:	b8 14 00 00 00       	mov    $0x14,%eax
+    45d0:	cd 40                	int    $0x40
+    45d2:	c3                   	ret
+
+000045d3 <chdir>:
+SYSCALL(chdir)
+    45d3:	b8 09 00 00 00       	mov    $0x9,%eax
+    45d8:	cd 40                	int    $0x40
+    45da:	c3                   	ret
+
+000045db <dup>:
+SYSCALL(dup)
+    45db:	b8 0a 00 00 00       	mov    $0xa,%eax
+    45e0:	cd 40                	int    $0x40
+    45e2:	c3                   	ret
+
+000045e3 <getpid>:
+SYSCALL(getpid)
+    45e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+    45e8:	cd 40                	int    $0x40
+    45ea:	c3                   	ret
+
+000045eb <sbrk>:
+SYSCALL(sbrk)
+    45eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+    45f0:	cd 40                	int    $0x40
+    45f2:	c3                   	ret
+
+000045f3 <sleep>:
+SYSCALL(sleep)
+    45f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+    45f8:	cd 40                	int    $0x40
+    45fa:	c3                   	ret
+
+000045fb <uptime>:
+SYSCALL(uptime)
+    45fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+    4600:	cd 40                	int    $0x40
+    4602:	c3                   	ret
+
+00004603 <nice>:
+SYSCALL(nice)
+    4603:	b8 16 00 00 00       	mov    $0x16,%eax
+    4608:	cd 40                	int    $0x40
+    460a:	c3                   	ret
+
+0000460b <fsync>:
+SYSCALL(fsync)
+    460b:	b8 17 00 00 00       	mov    $0x17,%eax
+    4610:	cd 40                	int    $0x40
+    4612:	c3                   	ret
+
+00004613 <getpstat>:
+SYSCALL(getpstat)
+    4613:	b8 18 00 00 00       	mov    $0x18,%eax
+    4618:	cd 40                	int    $0x40
+    461a:	c3                   	ret
+
+0000461b <pipesize>:
+SYSCALL(pipesize)
+    461b:	b8 19 00 00 00       	mov    $0x19,%eax
+    4620:	cd 40                	int    $0x40
+    4622:	c3                   	ret
+
+00004623 <uptimens>:
+SYSCALL(uptimens)
+    4623:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    4628:	cd 40                	int    $0x40
+    462a:	c3                   	ret
+
+0000462b <settickets>:
+SYSCALL(settickets)
+    462b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    4630:	cd 40                	int    $0x40
+    4632:	c3                   	ret
+
+00004633 <transfer>:
+SYSCALL(transfer)
+    4633:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    4638:	cd 40                	int    $0x40
+    463a:	c3                   	ret
+    463b:	66 90                	xchg   %ax,%ax
+    463d:	66 90                	xchg   %ax,%ax
+    463f:	90                   	nop
+
+00004640 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    4640:	55                   	push   %ebp
+    4641:	89 e5                	mov    %esp,%ebp
+    4643:	57                   	push   %edi
+    4644:	56                   	push   %esi
+    4645:	53                   	push   %ebx
+    4646:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    4648:	89 d1                	mov    %edx,%ecx
+{
+    464a:	83 ec 3c             	sub    $0x3c,%esp
+    464d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    4650:	85 d2                	test   %edx,%edx
+    4652:	0f 89 80 00 00 00    	jns    46d8 <printint+0x98>
+    4658:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    465c:	74 7a                	je     46d8 <printint+0x98>
+    x = -xx;
+    465e:	f7 d9                	neg    %ecx
+    neg = 1;
+    4660:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    4665:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    4668:	31 f6                	xor    %esi,%esi
+    466a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    4670:	89 c8                	mov    %ecx,%eax
+    4672:	31 d2                	xor    %edx,%edx
+    4674:	89 f7                	mov    %esi,%edi
+    4676:	f7 f3                	div    %ebx
+    4678:	8d 76 01             	lea    0x1(%esi),%esi
+    467b:	0f b6 92 94 69 00 00 	movzbl 0x6994(%edx),%edx
+    4682:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    4686:	89 ca                	mov    %ecx,%edx
+    4688:	89 c1                	mov    %eax,%ecx
+    468a:	39 da                	cmp    %ebx,%edx
+    468c:	73 e2                	jae    4670 <printint+0x30>
+  if(neg)
+    468e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    4691:	85 c0                	test   %eax,%eax
+    4693:	74 07                	je     469c <printint+0x5c>
+    buf[i++] = '-';
+    4695:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    469a:	89 f7                	mov    %esi,%edi
+    469c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    469f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    46a2:	01 df                	add    %ebx,%edi
+    46a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    46a8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    46ab:	83 ec 04             	sub    $0x4,%esp
+    46ae:	88 45 d7             	mov    %al,-0x29(%ebp)
+    46b1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    46b4:	6a 01                	push   $0x1
+    46b6:	50                   	push   %eax
+    46b7:	56                   	push   %esi
+    46b8:	e8 c6 fe ff ff       	call   4583 <write>
+  while(--i >= 0)
+    46bd:	89 f8                	mov    %edi,%eax
+    46bf:	83 c4 10             	add    $0x10,%esp
+    46c2:	83 ef 01             	sub    $0x1,%edi
+    46c5:	39 d8                	cmp    %ebx,%eax
+    46c7:	75 df                	jne    46a8 <printint+0x68>
+}
+    46c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    46cc:	5b                   	pop    %ebx
+    46cd:	5e                   	pop    %esi
+    46ce:	5f                   	pop    %edi
+    46cf:	5d                   	pop    %ebp
+    46d0:	c3                   	ret
+    46d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    46d8:	31 c0                	xor    %eax,%eax
+    46da:	eb 89                	jmp    4665 <printint+0x25>
+    46dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000046e0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    46e0:	55                   	push   %ebp
+    46e1:	89 e5                	mov    %esp,%ebp
+    46e3:	57                   	push   %edi
+    46e4:	56                   	push   %esi
+    46e5:	53                   	push   %ebx
+    46e6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    46e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    46ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    46ef:	0f b6 1e             	movzbl (%esi),%ebx
+    46f2:	83 c6 01             	add    $0x1,%esi
+    46f5:	84 db                	test   %bl,%bl
+    46f7:	74 67                	je     4760 <printf+0x80>
+    46f9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    46fc:	31 d2                	xor    %edx,%edx
+    46fe:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    4701:	eb 34                	jmp    4737 <printf+0x57>
+    4703:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4707:	90                   	nop
+    4708:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    470b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    4710:	83 f8 25             	cmp    $0x25,%eax
+    4713:	74 18                	je     472d <printf+0x4d>
+  write(fd, &c, 1);
+    4715:	83 ec 04             	sub    $0x4,%esp
+    4718:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    471b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    471e:	6a 01                	push   $0x1
+    4720:	50                   	push   %eax
+    4721:	57                   	push   %edi
+    4722:	e8 5c fe ff ff       	call   4583 <write>
+    4727:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    472a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    472d:	0f b6 1e             	movzbl (%esi),%ebx
+    4730:	83 c6 01             	add    $0x1,%esi
+    4733:	84 db                	test   %bl,%bl
+    4735:	74 29                	je     4760 <printf+0x80>
+    c = fmt[i] & 0xff;
+    4737:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    473a:	85 d2                	test   %edx,%edx
+    473c:	74 ca                	je     4708 <printf+0x28>
+      }
+    } else if(state == '%'){
+    473e:	83 fa 25             	cmp    $0x25,%edx
+    4741:	75 ea                	jne    472d <printf+0x4d>
+      if(c == 'd'){
+    4743:	83 f8 25             	cmp    $0x25,%eax
+    4746:	0f 84 24 01 00 00    	je     4870 <printf+0x190>
+    474c:	83 e8 63             	sub    $0x63,%eax
+    474f:	83 f8 15             	cmp    $0x15,%eax
+    4752:	77 1c                	ja     4770 <printf+0x90>
+    4754:	ff 24 85 3c 69 00 00 	jmp    *0x693c(,%eax,4)
+    475b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    475f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    4760:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4763:	5b                   	pop    %ebx
+    4764:	5e                   	pop    %esi
+    4765:	5f                   	pop    %edi
+    4766:	5d                   	pop    %ebp
+    4767:	c3                   	ret
+    4768:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    476f:	90                   	nop
+  write(fd, &c, 1);
+    4770:	83 ec 04             	sub    $0x4,%esp
+    4773:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4776:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    477a:	6a 01                	push   $0x1
+    477c:	52                   	push   %edx
+    477d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    4780:	57                   	push   %edi
+    4781:	e8 fd fd ff ff       	call   4583 <write>
+    4786:	83 c4 0c             	add    $0xc,%esp
+    4789:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    478c:	6a 01                	push   $0x1
+    478e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    4791:	52                   	push   %edx
+    4792:	57                   	push   %edi
+    4793:	e8 eb fd ff ff       	call   4583 <write>
+        putc(fd, c);
+    4798:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    479b:	31 d2                	xor    %edx,%edx
+    479d:	eb 8e                	jmp    472d <printf+0x4d>
+    479f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    47a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    47a3:	83 ec 0c             	sub    $0xc,%esp
+    47a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+    47ab:	8b 13                	mov    (%ebx),%edx
+    47ad:	6a 00                	push   $0x0
+    47af:	89 f8                	mov    %edi,%eax
+        ap++;
+    47b1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    47b4:	e8 87 fe ff ff       	call   4640 <printint>
+        ap++;
+    47b9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    47bc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    47bf:	31 d2                	xor    %edx,%edx
+    47c1:	e9 67 ff ff ff       	jmp    472d <printf+0x4d>
+    47c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    47cd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    47d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    47d3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    47d5:	83 c0 04             	add    $0x4,%eax
+    47d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    47db:	85 db                	test   %ebx,%ebx
+    47dd:	0f 84 9d 00 00 00    	je     4880 <printf+0x1a0>
+        while(*s != 0){
+    47e3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    47e6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    47e8:	84 c0                	test   %al,%al
+    47ea:	0f 84 3d ff ff ff    	je     472d <printf+0x4d>
+    47f0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    47f3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    47f6:	89 de                	mov    %ebx,%esi
+    47f8:	89 d3                	mov    %edx,%ebx
+    47fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    4800:	83 ec 04             	sub    $0x4,%esp
+    4803:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    4806:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    4809:	6a 01                	push   $0x1
+    480b:	53                   	push   %ebx
+    480c:	57                   	push   %edi
+    480d:	e8 71 fd ff ff       	call   4583 <write>
+        while(*s != 0){
+    4812:	0f b6 06             	movzbl (%esi),%eax
+    4815:	83 c4 10             	add    $0x10,%esp
+    4818:	84 c0                	test   %al,%al
+    481a:	75 e4                	jne    4800 <printf+0x120>
+      state = 0;
+    481c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    481f:	31 d2                	xor    %edx,%edx
+    4821:	e9 07 ff ff ff       	jmp    472d <printf+0x4d>
+    4826:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    482d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    4830:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    4833:	83 ec 0c             	sub    $0xc,%esp
+    4836:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    483b:	8b 13                	mov    (%ebx),%edx
+    483d:	6a 01                	push   $0x1
+    483f:	e9 6b ff ff ff       	jmp    47af <printf+0xcf>
+    4844:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    4848:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    484b:	83 ec 04             	sub    $0x4,%esp
+    484e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    4851:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    4853:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    4856:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    4859:	6a 01                	push   $0x1
+    485b:	52                   	push   %edx
+    485c:	57                   	push   %edi
+    485d:	e8 21 fd ff ff       	call   4583 <write>
+        ap++;
+    4862:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    4865:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4868:	31 d2                	xor    %edx,%edx
+    486a:	e9 be fe ff ff       	jmp    472d <printf+0x4d>
+    486f:	90                   	nop
+  write(fd, &c, 1);
+    4870:	83 ec 04             	sub    $0x4,%esp
+    4873:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    4876:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4879:	6a 01                	push   $0x1
+    487b:	e9 11 ff ff ff       	jmp    4791 <printf+0xb1>
+    4880:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    4885:	bb 32 69 00 00       	mov    $0x6932,%ebx
+    488a:	e9 61 ff ff ff       	jmp    47f0 <printf+0x110>
+    488f:	90                   	nop
+
+00004890 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    4890:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4891:	a1 40 bc 00 00       	mov    0xbc40,%eax
+{
+    4896:	89 e5                	mov    %esp,%ebp
+    4898:	57                   	push   %edi
+    4899:	56                   	push   %esi
+    489a:	53                   	push   %ebx
+    489b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    489e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    48a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    48a8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    48aa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    48ac:	39 ca                	cmp    %ecx,%edx
+    48ae:	73 30                	jae    48e0 <free+0x50>
+    48b0:	39 c1                	cmp    %eax,%ecx
+    48b2:	72 04                	jb     48b8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    48b4:	39 c2                	cmp    %eax,%edx
+    48b6:	72 f0                	jb     48a8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    48b8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    48bb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    48be:	39 f8                	cmp    %edi,%eax
+    48c0:	74 2e                	je     48f0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    48c2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    48c5:	8b 42 04             	mov    0x4(%edx),%eax
+    48c8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    48cb:	39 f1                	cmp    %esi,%ecx
+    48cd:	74 38                	je     4907 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    48cf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    48d1:	5b                   	pop    %ebx
+  freep = p;
+    48d2:	89 15 40 bc 00 00    	mov    %edx,0xbc40
+}
+    48d8:	5e                   	pop    %esi
+    48d9:	5f                   	pop    %edi
+    48da:	5d                   	pop    %ebp
+    48db:	c3                   	ret
+    48dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    48e0:	39 c1                	cmp    %eax,%ecx
+    48e2:	72 d0                	jb     48b4 <free+0x24>
+    48e4:	eb c2                	jmp    48a8 <free+0x18>
+    48e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    48ed:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    48f0:	03 70 04             	add    0x4(%eax),%esi
+    48f3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    48f6:	8b 02                	mov    (%edx),%eax
+    48f8:	8b 00                	mov    (%eax),%eax
+    48fa:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    48fd:	8b 42 04             	mov    0x4(%edx),%eax
+    4900:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    4903:	39 f1                	cmp    %esi,%ecx
+    4905:	75 c8                	jne    48cf <free+0x3f>
+    p->s.size += bp->s.size;
+    4907:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    490a:	89 15 40 bc 00 00    	mov    %edx,0xbc40
+    p->s.size += bp->s.size;
+    4910:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    4913:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    4916:	89 0a                	mov    %ecx,(%edx)
+}
+    4918:	5b                   	pop    %ebx
+    4919:	5e                   	pop    %esi
+    491a:	5f                   	pop    %edi
+    491b:	5d                   	pop    %ebp
+    491c:	c3                   	ret
+    491d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004920 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    4920:	55                   	push   %ebp
+    4921:	89 e5                	mov    %esp,%ebp
+    4923:	57                   	push   %edi
+    4924:	56                   	push   %esi
+    4925:	53                   	push   %ebx
+    4926:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4929:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    492c:	8b 15 40 bc 00 00    	mov    0xbc40,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4932:	8d 78 07             	lea    0x7(%eax),%edi
+    4935:	c1 ef 03             	shr    $0x3,%edi
+    4938:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    493b:	85 d2                	test   %edx,%edx
+    493d:	0f 84 8d 00 00 00    	je     49d0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4943:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4945:	8b 48 04             	mov    0x4(%eax),%ecx
+    4948:	39 f9                	cmp    %edi,%ecx
+    494a:	73 64                	jae    49b0 <malloc+0x90>
+  if(nu < 4096)
+    494c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    4951:	39 df                	cmp    %ebx,%edi
+    4953:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    4956:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    495d:	eb 0a                	jmp    4969 <malloc+0x49>
+    495f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4960:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4962:	8b 48 04             	mov    0x4(%eax),%ecx
+    4965:	39 f9                	cmp    %edi,%ecx
+    4967:	73 47                	jae    49b0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    4969:	89 c2                	mov    %eax,%edx
+    496b:	39 05 40 bc 00 00    	cmp    %eax,0xbc40
+    4971:	75 ed                	jne    4960 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    4973:	83 ec 0c             	sub    $0xc,%esp
+    4976:	56                   	push   %esi
+    4977:	e8 6f fc ff ff       	call   45eb <sbrk>
+  if(p == (char*)-1)
+    497c:	83 c4 10             	add    $0x10,%esp
+    497f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4982:	74 1c                	je     49a0 <malloc+0x80>
+  hp->s.size = nu;
+    4984:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    4987:	83 ec 0c             	sub    $0xc,%esp
+    498a:	83 c0 08             	add    $0x8,%eax
+    498d:	50                   	push   %eax
+    498e:	e8 fd fe ff ff       	call   4890 <free>
+  return freep;
+    4993:	8b 15 40 bc 00 00    	mov    0xbc40,%edx
+      if((p = morecore(nunits)) == 0)
+    4999:	83 c4 10             	add    $0x10,%esp
+    499c:	85 d2                	test   %edx,%edx
+    499e:	75 c0                	jne    4960 <malloc+0x40>
+        return 0;
+  }
+}
+    49a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    49a3:	31 c0                	xor    %eax,%eax
+}
+    49a5:	5b                   	pop    %ebx
+    49a6:	5e                   	pop    %esi
+    49a7:	5f                   	pop    %edi
+    49a8:	5d                   	pop    %ebp
+    49a9:	c3                   	ret
+    49aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    49b0:	39 cf                	cmp    %ecx,%edi
+    49b2:	74 4c                	je     4a00 <malloc+0xe0>
+        p->s.size -= nunits;
+    49b4:	29 f9                	sub    %edi,%ecx
+    49b6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    49b9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    49bc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    49bf:	89 15 40 bc 00 00    	mov    %edx,0xbc40
+}
+    49c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    49c8:	83 c0 08             	add    $0x8,%eax
+}
+    49cb:	5b                   	pop    %ebx
+    49cc:	5e                   	pop    %esi
+    49cd:	5f                   	pop    %edi
+    49ce:	5d                   	pop    %ebp
+    49cf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    49d0:	c7 05 40 bc 00 00 44 	movl   $0xbc44,0xbc40
+    49d7:	bc 00 00 
+    base.s.size = 0;
+    49da:	b8 44 bc 00 00       	mov    $0xbc44,%eax
+    base.s.ptr = freep = prevp = &base;
+    49df:	c7 05 44 bc 00 00 44 	movl   $0xbc44,0xbc44
+    49e6:	bc 00 00 
+    base.s.size = 0;
+    49e9:	c7 05 48 bc 00 00 00 	movl   $0x0,0xbc48
+    49f0:	00 00 00 
+    if(p->s.size >= nunits){
+    49f3:	e9 54 ff ff ff       	jmp    494c <malloc+0x2c>
+    49f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    49ff:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    4a00:	8b 08                	mov    (%eax),%ecx
+    4a02:	89 0a                	mov    %ecx,(%edx)
+    4a04:	eb b9                	jmp    49bf <malloc+0x9f>
+    4a06:	66 90                	xchg   %ax,%ax
+    4a08:	66 90                	xchg   %ax,%ax
+    4a0a:	66 90                	xchg   %ax,%ax
+    4a0c:	66 90                	xchg   %ax,%ax
+    4a0e:	66 90                	xchg   %ax,%ax
+
+00004a10 <pidstat>:
+
+// Fill in *st with the statistics of process pid.
+// Returns 0, or -1 if there is no such process.
+int
+pidstat(int pid, struct pstat *st)
+{
+    4a10:	55                   	push   %ebp
+    4a11:	89 e5                	mov    %esp,%ebp
+    4a13:	56                   	push   %esi
+    4a14:	53                   	push   %ebx
+  static struct pstat *ps;
+  int i, n;
+
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+    4a15:	a1 4c bc 00 00       	mov    0xbc4c,%eax
+{
+    4a1a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    4a1d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+    4a20:	85 c0                	test   %eax,%eax
+    4a22:	0f 84 98 00 00 00    	je     4ac0 <pidstat+0xb0>
+    return -1;
+  n = getpstat(ps, NPROC);
+    4a28:	83 ec 08             	sub    $0x8,%esp
+    4a2b:	6a 40                	push   $0x40
+    4a2d:	50                   	push   %eax
+    4a2e:	e8 e0 fb ff ff       	call   4613 <getpstat>
+  for(i = 0; i < n; i++){
+    4a33:	83 c4 10             	add    $0x10,%esp
+    4a36:	85 c0                	test   %eax,%eax
+    4a38:	0f 8e 9f 00 00 00    	jle    4add <pidstat+0xcd>
+    4a3e:	8b 15 4c bc 00 00    	mov    0xbc4c,%edx
+    4a44:	31 c9                	xor    %ecx,%ecx
+    4a46:	eb 16                	jmp    4a5e <pidstat+0x4e>
+    4a48:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4a4f:	90                   	nop
+    4a50:	83 c1 01             	add    $0x1,%ecx
+    4a53:	83 c2 38             	add    $0x38,%edx
+    4a56:	39 c8                	cmp    %ecx,%eax
+    4a58:	0f 84 7f 00 00 00    	je     4add <pidstat+0xcd>
+    if(ps[i].pid == pid){
+    4a5e:	39 1a                	cmp    %ebx,(%edx)
+    4a60:	75 ee                	jne    4a50 <pidstat+0x40>
+      *st = ps[i];
+    4a62:	89 1e                	mov    %ebx,(%esi)
+    4a64:	8b 42 04             	mov    0x4(%edx),%eax
+    4a67:	89 46 04             	mov    %eax,0x4(%esi)
+    4a6a:	8b 42 08             	mov    0x8(%edx),%eax
+    4a6d:	89 46 08             	mov    %eax,0x8(%esi)
+    4a70:	8b 42 0c             	mov    0xc(%edx),%eax
+    4a73:	89 46 0c             	mov    %eax,0xc(%esi)
+    4a76:	8b 42 10             	mov    0x10(%edx),%eax
+    4a79:	89 46 10             	mov    %eax,0x10(%esi)
+    4a7c:	8b 42 14             	mov    0x14(%edx),%eax
+    4a7f:	89 46 14             	mov    %eax,0x14(%esi)
+    4a82:	8b 42 18             	mov    0x18(%edx),%eax
+    4a85:	89 46 18             	mov    %eax,0x18(%esi)
+    4a88:	8b 42 1c             	mov    0x1c(%edx),%eax
+    4a8b:	89 46 1c             	mov    %eax,0x1c(%esi)
+    4a8e:	8b 42 20             	mov    0x20(%edx),%eax
+    4a91:	89 46 20             	mov    %eax,0x20(%esi)
+    4a94:	8b 42 24             	mov    0x24(%edx),%eax
+    4a97:	89 46 24             	mov    %eax,0x24(%esi)
+    4a9a:	8b 42 28             	mov    0x28(%edx),%eax
+    4a9d:	89 46 28             	mov    %eax,0x28(%esi)
+    4aa0:	8b 42 2c             	mov    0x2c(%edx),%eax
+    4aa3:	89 46 2c             	mov    %eax,0x2c(%esi)
+    4aa6:	8b 42 30             	mov    0x30(%edx),%eax
+    4aa9:	89 46 30             	mov    %eax,0x30(%esi)
+    4aac:	8b 42 34             	mov    0x34(%edx),%eax
+    4aaf:	89 46 34             	mov    %eax,0x34(%esi)
+      return 0;
+    }
+  }
+  return -1;
+}
+    4ab2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+      return 0;
+    4ab5:	31 c0                	xor    %eax,%eax
+}
+    4ab7:	5b                   	pop    %ebx
+    4ab8:	5e                   	pop    %esi
+    4ab9:	5d                   	pop    %ebp
+    4aba:	c3                   	ret
+    4abb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    4abf:	90                   	nop
+  if(ps == 0 && (ps = malloc(NPROC * sizeof(*ps))) == 0)
+    4ac0:	83 ec 0c             	sub    $0xc,%esp
+    4ac3:	68 00 0e 00 00       	push   $0xe00
+    4ac8:	e8 53 fe ff ff       	call   4920 <malloc>
+    4acd:	83 c4 10             	add    $0x10,%esp
+    4ad0:	a3 4c bc 00 00       	mov    %eax,0xbc4c
+    4ad5:	85 c0                	test   %eax,%eax
+    4ad7:	0f 85 4b ff ff ff    	jne    4a28 <pidstat+0x18>
+}
+    4add:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    return -1;
+    4ae0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+    4ae5:	5b                   	pop    %ebx
+    4ae6:	5e                   	pop    %esi
+    4ae7:	5d                   	pop    %ebp
+    4ae8:	c3                   	ret
+    4ae9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00004af0 <sharetable>:
+// key[i] is printed in a column headed keyname, and so is
+// extra[i] under extraname unless extra is 0.
+void
+sharetable(char *tag, char *keyname, int *key, char *extraname, int *extra,
+           int n, int *pid, int *weight, uint *ticks)
+{
+    4af0:	55                   	push   %ebp
+    4af1:	89 e5                	mov    %esp,%ebp
+    4af3:	57                   	push   %edi
+    4af4:	56                   	push   %esi
+    4af5:	53                   	push   %ebx
+    4af6:	83 ec 3c             	sub    $0x3c,%esp
+    4af9:	8b 45 08             	mov    0x8(%ebp),%eax
+    4afc:	8b 7d 1c             	mov    0x1c(%ebp),%edi
+    4aff:	8b 75 24             	mov    0x24(%ebp),%esi
+    4b02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    4b05:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    4b08:	8b 45 10             	mov    0x10(%ebp),%eax
+    4b0b:	89 7d d0             	mov    %edi,-0x30(%ebp)
+    4b0e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+    4b11:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    4b14:	8b 45 18             	mov    0x18(%ebp),%eax
+    4b17:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+    4b1a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    4b1d:	8b 45 20             	mov    0x20(%ebp),%eax
+    4b20:	89 45 c8             	mov    %eax,-0x38(%ebp)
+    4b23:	8b 45 28             	mov    0x28(%ebp),%eax
+    4b26:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  int i, wsum, share, expect, err, maxerr;
+  uint tsum;
+
+  wsum = 0;
+  tsum = 0;
+  for(i = 0; i < n; i++){
+    4b29:	85 ff                	test   %edi,%edi
+    4b2b:	0f 8e df 01 00 00    	jle    4d10 <sharetable+0x220>
+    4b31:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+    4b34:	89 fb                	mov    %edi,%ebx
+    4b36:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  tsum = 0;
+    4b39:	31 d2                	xor    %edx,%edx
+  for(i = 0; i < n; i++){
+    4b3b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+    4b3e:	31 c0                	xor    %eax,%eax
+    4b40:	31 c9                	xor    %ecx,%ecx
+    4b42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wsum += weight[i];
+    4b48:	03 0c 86             	add    (%esi,%eax,4),%ecx
+    tsum += ticks[i];
+    4b4b:	03 14 87             	add    (%edi,%eax,4),%edx
+  for(i = 0; i < n; i++){
+    4b4e:	83 c0 01             	add    $0x1,%eax
+    4b51:	39 c3                	cmp    %eax,%ebx
+    4b53:	75 f3                	jne    4b48 <sharetable+0x58>
+    4b55:	85 d2                	test   %edx,%edx
+    4b57:	b8 01 00 00 00       	mov    $0x1,%eax
+    4b5c:	89 4d d8             	mov    %ecx,-0x28(%ebp)
+  }
+  if(tsum == 0)
+    tsum = 1;
+  if(wsum == 0)
+    wsum = 1;
+    4b5f:	8b 7d d8             	mov    -0x28(%ebp),%edi
+    4b62:	0f 45 c2             	cmovne %edx,%eax
+    4b65:	8b 5d c0             	mov    -0x40(%ebp),%ebx
+  if(tsum == 0)
+    4b68:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    wsum = 1;
+    4b6b:	85 ff                	test   %edi,%edi
+    4b6d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+    4b70:	b8 01 00 00 00       	mov    $0x1,%eax
+    4b75:	0f 45 c7             	cmovne %edi,%eax
+    4b78:	89 45 d8             	mov    %eax,-0x28(%ebp)
+
+  printf(1, "[%s]  pid %s ", tag, keyname);
+    4b7b:	51                   	push   %ecx
+    4b7c:	ff 75 dc             	push   -0x24(%ebp)
+    4b7f:	68 a5 69 00 00       	push   $0x69a5
+    4b84:	6a 01                	push   $0x1
+    4b86:	e8 55 fb ff ff       	call   46e0 <printf>
+  if(extra)
+    4b8b:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    4b8e:	83 c4 10             	add    $0x10,%esp
+    4b91:	85 f6                	test   %esi,%esi
+    4b93:	0f 84 47 01 00 00    	je     4ce0 <sharetable+0x1f0>
+    printf(1, "%s ", extraname);
+    4b99:	83 ec 04             	sub    $0x4,%esp
+    4b9c:	53                   	push   %ebx
+    4b9d:	68 af 69 00 00       	push   $0x69af
+    4ba2:	6a 01                	push   $0x1
+    4ba4:	e8 37 fb ff ff       	call   46e0 <printf>
+  printf(1, "ticks  share expected\n");
+    4ba9:	58                   	pop    %eax
+    4baa:	5a                   	pop    %edx
+    4bab:	68 b3 69 00 00       	push   $0x69b3
+    4bb0:	6a 01                	push   $0x1
+    4bb2:	e8 29 fb ff ff       	call   46e0 <printf>
+  maxerr = 0;
+  for(i = 0; i < n; i++){
+    4bb7:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+    4bba:	83 c4 10             	add    $0x10,%esp
+    4bbd:	85 c9                	test   %ecx,%ecx
+    4bbf:	0f 8e 44 01 00 00    	jle    4d09 <sharetable+0x219>
+  if(extra)
+    4bc5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    4bcc:	31 ff                	xor    %edi,%edi
+    4bce:	66 90                	xchg   %ax,%ax
+    share = ticks[i] * 1000 / tsum;
+    4bd0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    4bd3:	31 d2                	xor    %edx,%edx
+    expect = weight[i] * 1000 / wsum;
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+    4bd5:	83 ec 0c             	sub    $0xc,%esp
+    share = ticks[i] * 1000 / tsum;
+    4bd8:	69 04 b8 e8 03 00 00 	imul   $0x3e8,(%eax,%edi,4),%eax
+    4bdf:	f7 75 c0             	divl   -0x40(%ebp)
+    4be2:	89 c6                	mov    %eax,%esi
+    expect = weight[i] * 1000 / wsum;
+    4be4:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    4be7:	69 04 b8 e8 03 00 00 	imul   $0x3e8,(%eax,%edi,4),%eax
+    4bee:	99                   	cltd
+    4bef:	f7 7d d8             	idivl  -0x28(%ebp)
+    4bf2:	89 c3                	mov    %eax,%ebx
+    printf(1, "[%s] %d %d ", tag, pid[i], key[i]);
+    4bf4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    4bf7:	ff 34 b8             	push   (%eax,%edi,4)
+    4bfa:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    4bfd:	ff 34 b8             	push   (%eax,%edi,4)
+    4c00:	ff 75 dc             	push   -0x24(%ebp)
+    4c03:	68 ca 69 00 00       	push   $0x69ca
+    4c08:	6a 01                	push   $0x1
+    4c0a:	e8 d1 fa ff ff       	call   46e0 <printf>
+    if(extra)
+    4c0f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    4c12:	83 c4 20             	add    $0x20,%esp
+    4c15:	85 c0                	test   %eax,%eax
+    4c17:	74 15                	je     4c2e <sharetable+0x13e>
+      printf(1, "%d ", extra[i]);
+    4c19:	83 ec 04             	sub    $0x4,%esp
+    4c1c:	ff 34 b8             	push   (%eax,%edi,4)
+    4c1f:	68 d2 69 00 00       	push   $0x69d2
+    4c24:	6a 01                	push   $0x1
+    4c26:	e8 b5 fa ff ff       	call   46e0 <printf>
+    4c2b:	83 c4 10             	add    $0x10,%esp
+    printf(1, "%d %d.%d%% %d.%d%%\n", ticks[i], share / 10, share % 10,
+    4c2e:	b8 67 66 66 66       	mov    $0x66666667,%eax
+    4c33:	89 d9                	mov    %ebx,%ecx
+    4c35:	83 ec 04             	sub    $0x4,%esp
+    4c38:	f7 eb                	imul   %ebx
+    4c3a:	89 d8                	mov    %ebx,%eax
+    4c3c:	c1 f8 1f             	sar    $0x1f,%eax
+    4c3f:	c1 fa 02             	sar    $0x2,%edx
+    4c42:	29 c2                	sub    %eax,%edx
+    4c44:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    4c47:	01 c0                	add    %eax,%eax
+    4c49:	29 c1                	sub    %eax,%ecx
+    4c4b:	b8 67 66 66 66       	mov    $0x66666667,%eax
+    4c50:	51                   	push   %ecx
+    4c51:	89 f1                	mov    %esi,%ecx
+    4c53:	52                   	push   %edx
+    4c54:	f7 ee                	imul   %esi
+    4c56:	89 f0                	mov    %esi,%eax
+    4c58:	c1 f8 1f             	sar    $0x1f,%eax
+    4c5b:	c1 fa 02             	sar    $0x2,%edx
+    4c5e:	29 c2                	sub    %eax,%edx
+    4c60:	8d 04 92             	lea    (%edx,%edx,4),%eax
+    4c63:	01 c0                	add    %eax,%eax
+    4c65:	29 c1                	sub    %eax,%ecx
+    4c67:	51                   	push   %ecx
+    4c68:	52                   	push   %edx
+    4c69:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    4c6c:	ff 34 b8             	push   (%eax,%edi,4)
+    4c6f:	68 d6 69 00 00       	push   $0x69d6
+    4c74:	6a 01                	push   $0x1
+    4c76:	e8 65 fa ff ff       	call   46e0 <printf>
+           expect / 10, expect % 10);
+    err = share > expect ? share - expect : expect - share;
+    4c7b:	89 f2                	mov    %esi,%edx
+    4c7d:	89 d8                	mov    %ebx,%eax
+    4c7f:	83 c4 20             	add    $0x20,%esp
+    4c82:	29 f0                	sub    %esi,%eax
+    4c84:	29 da                	sub    %ebx,%edx
+    4c86:	39 de                	cmp    %ebx,%esi
+    4c88:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+    4c8b:	0f 4f c2             	cmovg  %edx,%eax
+    if(err > maxerr)
+    4c8e:	39 c6                	cmp    %eax,%esi
+    4c90:	0f 4d c6             	cmovge %esi,%eax
+  for(i = 0; i < n; i++){
+    4c93:	83 c7 01             	add    $0x1,%edi
+    4c96:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    4c99:	39 7d d0             	cmp    %edi,-0x30(%ebp)
+    4c9c:	0f 85 2e ff ff ff    	jne    4bd0 <sharetable+0xe0>
+      maxerr = err;
+  }
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+    4ca2:	ba cd cc cc cc       	mov    $0xcccccccd,%edx
+    4ca7:	f7 e2                	mul    %edx
+    4ca9:	c1 ea 03             	shr    $0x3,%edx
+    4cac:	8d 0c 92             	lea    (%edx,%edx,4),%ecx
+    4caf:	89 d0                	mov    %edx,%eax
+    4cb1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    4cb4:	01 c9                	add    %ecx,%ecx
+    4cb6:	29 ca                	sub    %ecx,%edx
+    4cb8:	89 45 14             	mov    %eax,0x14(%ebp)
+    4cbb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    4cbe:	89 55 18             	mov    %edx,0x18(%ebp)
+    4cc1:	89 45 10             	mov    %eax,0x10(%ebp)
+    4cc4:	c7 45 0c ec 69 00 00 	movl   $0x69ec,0xc(%ebp)
+    4ccb:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+    4cd2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    4cd5:	5b                   	pop    %ebx
+    4cd6:	5e                   	pop    %esi
+    4cd7:	5f                   	pop    %edi
+    4cd8:	5d                   	pop    %ebp
+  printf(1, "[%s] worst share error %d.%d%%\n", tag, maxerr / 10, maxerr % 10);
+    4cd9:	e9 02 fa ff ff       	jmp    46e0 <printf>
+    4cde:	66 90                	xchg   %ax,%ax
+  printf(1, "ticks  share expected\n");
+    4ce0:	83 ec 08             	sub    $0x8,%esp
+    4ce3:	68 b3 69 00 00       	push   $0x69b3
+    4ce8:	6a 01                	push   $0x1
+    4cea:	e8 f1 f9 ff ff       	call   46e0 <printf>
+    4cef:	83 c4 10             	add    $0x10,%esp
+    4cf2:	e9 ce fe ff ff       	jmp    4bc5 <sharetable+0xd5>
+    4cf7:	83 ec 08             	sub    $0x8,%esp
+    4cfa:	68 b3 69 00 00       	push   $0x69b3
+    4cff:	6a 01                	push   $0x1
+    4d01:	e8 da f9 ff ff       	call   46e0 <printf>
+    4d06:	83 c4 10             	add    $0x10,%esp
+  if(extra)
+    4d09:	31 c0                	xor    %eax,%eax
+    4d0b:	31 d2                	xor    %edx,%edx
+    4d0d:	eb a9                	jmp    4cb8 <sharetable+0x1c8>
+    4d0f:	90                   	nop
+  printf(1, "[%s]  pid %s ", tag, keyname);
+    4d10:	51                   	push   %ecx
+    4d11:	ff 75 dc             	push   -0x24(%ebp)
+    4d14:	68 a5 69 00 00       	push   $0x69a5
+    4d19:	6a 01                	push   $0x1
+    4d1b:	e8 c0 f9 ff ff       	call   46e0 <printf>
+  if(extra)
+    4d20:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+    4d23:	83 c4 10             	add    $0x10,%esp
+    4d26:	85 ff                	test   %edi,%edi
+    4d28:	74 cd                	je     4cf7 <sharetable+0x207>
+    wsum = 1;
+    4d2a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+  if(extra)
+    4d31:	c7 45 c0 01 00 00 00 	movl   $0x1,-0x40(%ebp)
+    4d38:	e9 5c fe ff ff       	jmp    4b99 <sharetable+0xa9>
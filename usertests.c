@@ -7,6 +7,7 @@
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
+#include "pstat.h"
 
 char buf[8192];
 char name[3];
@@ -184,6 +185,9 @@ writetest(void)
   printf(stdout, "small file test ok\n");
 }
 
+// enough 512-byte writes to need the double-indirect block.
+#define BIGBLOCKS ((NDIRECT + NINDIRECT + 8) * (BSIZE/512))
+
 void
 writetest1(void)
 {
@@ -197,7 +201,7 @@ writetest1(void)
     exit();
   }
 
-  for(i = 0; i < MAXFILE; i++){
+  for(i = 0; i < BIGBLOCKS; i++){
     ((int*)buf)[0] = i;
     if(write(fd, buf, 512) != 512){
       printf(stdout, "error: write big file failed\n", i);
@@ -217,7 +221,7 @@ writetest1(void)
   for(;;){
     i = read(fd, buf, 512);
     if(i == 0){
-      if(n == MAXFILE - 1){
+      if(n != BIGBLOCKS){
         printf(stdout, "read only %d blocks from big", n);
         exit();
       }
@@ -354,6 +358,135 @@ pipe1(void)
   printf(1, "pipe1 ok\n");
 }
 
+// page-sized pipe writes are lent to the reader, not copied.
+// the reader must see the data as of the write, whether it
+// takes the pages whole or copies out of them.
+void
+pipeloan(void)
+{
+  int fds[2], pid, i, n, total;
+  char *a, *b;
+
+  a = sbrk(0);
+  sbrk(4096 - (uint)a % 4096);
+  a = sbrk(8*4096);
+  if(a == (char*)0xffffffff){
+    printf(1, "pipeloan sbrk failed\n");
+    exit();
+  }
+  b = a + 4*4096;
+  for(i = 0; i < 4*4096; i++)
+    a[i] = i / 4096 + i;
+
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork() failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(fds[0]);
+    if(write(fds[1], a, 4*4096) != 4*4096){
+      printf(1, "pipeloan write failed\n");
+      exit();
+    }
+    // must not change what the reader sees.
+    memset(a, 0xff, 4*4096);
+    exit();
+  }
+  close(fds[1]);
+
+  // one page whole, then odd-sized pieces.
+  total = read(fds[0], b, 4096);
+  for(n = 100; total < 4*4096 && n > 0; total += n)
+    n = read(fds[0], b + total, 1000);
+  if(total != 4*4096){
+    printf(1, "pipeloan read total %d\n", total);
+    exit();
+  }
+  for(i = 0; i < 4*4096; i++){
+    if(b[i] != (char)(i / 4096 + i)){
+      printf(1, "pipeloan wrong data at %d\n", i);
+      exit();
+    }
+  }
+  // the pages are ours to write.
+  memset(b, 0, 4*4096);
+  close(fds[0]);
+  wait();
+
+  sbrk(-(b + 4*4096 - a));
+  printf(1, "pipeloan ok\n");
+}
+
+// a pipe buffer enlarged with pipesize() holds that much
+// without a reader.
+void
+pipesizetest(void)
+{
+  int fds[2], cap, i;
+
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  if(pipesize(fds[0], 0) <= 0 || pipesize(0, 0) != -1){
+    printf(1, "pipesize query failed\n");
+    exit();
+  }
+  if((cap = pipesize(fds[1], 6000)) < 6000){
+    printf(1, "pipesize 6000 failed\n");
+    exit();
+  }
+  for(i = 0; i < cap; i++)
+    buf[i] = i % 251;
+  if(write(fds[1], buf+1, cap-1) != cap-1 || write(fds[1], buf, 1) != 1){
+    printf(1, "pipesize write failed\n");
+    exit();
+  }
+  if(pipesize(fds[1], 10000) != -1){
+    printf(1, "pipesize resized a full pipe\n");
+    exit();
+  }
+  close(fds[1]);
+  for(i = 0; i < cap; i++)
+    buf[i] = 0;
+  if(read(fds[0], buf, sizeof(buf)) != cap || buf[0] != 1 % 251 ||
+     buf[cap-2] != (char)((cap-1) % 251) || buf[cap-1] != 0){
+    printf(1, "pipesize read back wrong data\n");
+    exit();
+  }
+  close(fds[0]);
+  printf(1, "pipesize ok\n");
+}
+
+// nanosecond uptime moves forward, and agrees with sleep().
+void
+uptimenstest(void)
+{
+  uint64 t0, t1;
+
+  printf(stdout, "uptimens test\n");
+  if(uptimens(&t0) != 0 || uptimens(&t1) != 0 || t1 < t0){
+    printf(stdout, "uptimens went backwards\n");
+    exit();
+  }
+  if(uptimens((uint64*)0xffffffff) != -1){
+    printf(stdout, "uptimens accepted a bad pointer\n");
+    exit();
+  }
+  sleep(10);
+  uptimens(&t1);
+  if(t1 - t0 < 50000000ULL){
+    printf(stdout, "uptimens: sleep(10) took under 50ms\n");
+    exit();
+  }
+  printf(stdout, "uptimens ok\n");
+}
+
 // meant to be run w/ at most two CPUs
 void
 preempt(void)
@@ -1347,8 +1480,8 @@ iref(void)
 
   printf(1, "empty file name\n");
 
-  // the 50 is NINODE
-  for(i = 0; i < 50 + 1; i++){
+  // the 200 is NINODE
+  for(i = 0; i < 200 + 1; i++){
     if(mkdir("irefd") != 0){
       printf(1, "mkdir irefd failed\n");
       exit();
@@ -1373,6 +1506,33 @@ iref(void)
   printf(1, "empty file name OK\n");
 }
 
+// the name cache must notice names that come and go,
+// including in a directory whose inode is reused.
+void
+dcachetest(void)
+{
+  int fd, i;
+
+  printf(1, "dcache test\n");
+  for(i = 0; i < 6; i++){
+    if(mkdir("dcd") != 0 || open("dcd/x", 0) >= 0)
+      goto bad;
+    if((fd = open("dcd/x", O_CREATE|O_RDWR)) < 0)
+      goto bad;
+    close(fd);
+    if((fd = open("dcd/x", 0)) < 0)
+      goto bad;
+    close(fd);
+    if(unlink("dcd/x") != 0 || open("dcd/x", 0) >= 0 || unlink("dcd") != 0)
+      goto bad;
+  }
+  printf(1, "dcache test ok\n");
+  return;
+bad:
+  printf(1, "dcache test failed at %d\n", i);
+  exit();
+}
+
 // test that fork fails gracefully
 // the forktest binary also does this, but it runs out of proc entries first.
 // inside the bigger usertests binary, we run out of memory first.
@@ -1411,6 +1571,71 @@ forktest(void)
   printf(1, "fork test OK\n");
 }
 
+// does fork() share memory copy-on-write?
+// children must see the parent's data but not each other's
+// writes, including writes made by the kernel in read(), and
+// forking a large process many times must not need a full
+// copy of it per child.
+void
+cowtest(void)
+{
+  int fds[2], i, n, pid;
+  char *a, *oldbrk;
+
+  printf(1, "cow test\n");
+#define COWSZ (24*1024*1024)
+  oldbrk = sbrk(0);
+  a = sbrk(COWSZ);
+  if(a == (char*)0xffffffff){
+    printf(1, "cow test sbrk failed\n");
+    exit();
+  }
+  for(i = 0; i < COWSZ; i += 4096)
+    a[i] = 'p';
+
+  if(pipe(fds) != 0){
+    printf(1, "cow test pipe failed\n");
+    exit();
+  }
+  for(n = 0; n < 12; n++){
+    pid = fork();
+    if(pid < 0){
+      printf(1, "cow test fork %d failed\n", n);
+      exit();
+    }
+    if(pid == 0){
+      if(a[0] != 'p' || a[COWSZ-4096] != 'p'){
+        printf(1, "cow test child sees wrong data\n");
+        exit();
+      }
+      a[4096*n] = 'c';
+      if(read(fds[0], a + 4096*(n+1), 1) != 1 || a[4096*(n+1)] != 'k'){
+        printf(1, "cow test read into shared page failed\n");
+        exit();
+      }
+      if(a[0] != (n == 0 ? 'c' : 'p')){
+        printf(1, "cow test child sees sibling write\n");
+        exit();
+      }
+      exit();
+    }
+    write(fds[1], "k", 1);
+  }
+  for(; n > 0; n--)
+    wait();
+  close(fds[0]);
+  close(fds[1]);
+
+  for(i = 0; i < COWSZ; i += 4096){
+    if(a[i] != 'p'){
+      printf(1, "cow test parent sees child write at %d\n", i);
+      exit();
+    }
+  }
+  sbrk(-(sbrk(0) - oldbrk));
+  printf(1, "cow test OK\n");
+}
+
 void
 sbrktest(void)
 {
@@ -1546,6 +1771,138 @@ sbrktest(void)
   printf(stdout, "sbrk test OK\n");
 }
 
+// several processes writing and waiting for their
+// writes to be committed at once.
+void
+fsynctest(void)
+{
+  int fd, i, pid, n;
+  char name[3];
+
+  printf(stdout, "fsync test\n");
+  name[0] = 'y';
+  name[2] = '\0';
+  for(pid = 0; pid < 4; pid++){
+    name[1] = '0' + pid;
+    if((n = fork()) < 0){
+      printf(stdout, "fork failed\n");
+      exit();
+    }
+    if(n == 0){
+      fd = open(name, O_CREATE | O_RDWR);
+      if(fd < 0){
+        printf(stdout, "fsync create %s failed\n", name);
+        exit();
+      }
+      for(i = 0; i < 10; i++){
+        if(write(fd, name, 2) != 2 || fsync(fd) != 0){
+          printf(stdout, "fsync write/fsync %s failed\n", name);
+          exit();
+        }
+      }
+      close(fd);
+      exit();
+    }
+  }
+  for(pid = 0; pid < 4; pid++)
+    wait();
+
+  for(pid = 0; pid < 4; pid++){
+    name[1] = '0' + pid;
+    fd = open(name, O_RDONLY);
+    if(fd < 0 || read(fd, buf, sizeof(buf)) != 20 || buf[18] != 'y'){
+      printf(stdout, "fsync %s has wrong contents\n", name);
+      exit();
+    }
+    if(fsync(fd) != 0){
+      printf(stdout, "fsync of clean file failed\n");
+      exit();
+    }
+    close(fd);
+    unlink(name);
+  }
+  if(fsync(fd) != -1){
+    printf(stdout, "fsync of closed fd succeeded\n");
+    exit();
+  }
+  printf(stdout, "fsync test ok\n");
+}
+
+// sbrk() only reserves address space; pages appear, zeroed,
+// on first touch, whether the touch comes from user code or
+// from the kernel inside a system call.
+void
+lazytest(void)
+{
+  int fd, fds[2], pid;
+  char *a, *oldbrk;
+
+  printf(stdout, "lazy sbrk test\n");
+#define LAZYSZ (10*1024*1024)
+  oldbrk = sbrk(0);
+  a = sbrk(LAZYSZ);
+  if(a == (char*)0xffffffff){
+    printf(stdout, "lazy sbrk failed\n");
+    exit();
+  }
+
+  // kernel writes into an untouched page
+  fd = open("echo", O_RDONLY);
+  if(fd < 0 || read(fd, a + LAZYSZ/2, 16) != 16 || a[LAZYSZ/2 + 1] != 'E'){
+    printf(stdout, "lazy sbrk read() into heap failed\n");
+    exit();
+  }
+  close(fd);
+
+  // kernel reads from an untouched page
+  if(pipe(fds) != 0 || write(fds[1], a + LAZYSZ - 4096, 1) != 1 ||
+     read(fds[0], a, 1) != 1 || a[0] != 0){
+    printf(stdout, "lazy sbrk write() from heap failed\n");
+    exit();
+  }
+  close(fds[0]);
+  close(fds[1]);
+
+  // copyout() into untouched pages
+  if(getpstat((struct pstat*)(a + LAZYSZ/4), 4) <= 0 ||
+     ((struct pstat*)(a + LAZYSZ/4))->pid <= 0){
+    printf(stdout, "lazy sbrk getpstat() into heap failed\n");
+    exit();
+  }
+
+  // a child gets its own zeroed pages for the untouched part
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "lazy sbrk fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    if(a[LAZYSZ - 1] != 0 || a[LAZYSZ/2 + 1] != 'E'){
+      printf(stdout, "lazy sbrk child sees wrong data\n");
+      exit();
+    }
+    a[LAZYSZ - 1] = 1;
+    exit();
+  }
+  wait();
+  if(a[LAZYSZ - 1] != 0){
+    printf(stdout, "lazy sbrk child write leaked\n");
+    exit();
+  }
+
+  // shrinking frees pages; growing again gives zeroed ones
+  a[LAZYSZ - 1] = 1;
+  sbrk(-4096);
+  sbrk(4096);
+  if(a[LAZYSZ - 1] != 0){
+    printf(stdout, "lazy sbrk shrink did not free page\n");
+    exit();
+  }
+
+  sbrk(-(sbrk(0) - oldbrk));
+  printf(stdout, "lazy sbrk test OK\n");
+}
+
 void
 validateint(int *p)
 {
@@ -1768,11 +2125,13 @@ main(int argc, char *argv[])
   bigargtest();
   bsstest();
   sbrktest();
+  lazytest();
   validatetest();
 
   opentest();
   writetest();
   writetest1();
+  fsynctest();
   createtest();
 
   openiputtest();
@@ -1781,7 +2140,10 @@ main(int argc, char *argv[])
 
   mem();
   pipe1();
+  pipeloan();
+  pipesizetest();
   preempt();
+  uptimenstest();
   exitwait();
 
   rmdot();
@@ -1792,7 +2154,9 @@ main(int argc, char *argv[])
   unlinkread();
   dirfile();
   iref();
+  dcachetest();
   forktest();
+  cowtest();
   bigdir(); // slow
 
   uio();
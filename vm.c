@@ -311,31 +311,36 @@ clearpteu(pde_t *pgdir, char *uva)
 }
 
 // Given a parent process's page table, create a copy
-// of it for a child.
+// of it for a child. Pages are not copied: both page tables
+// map the same physical pages, with writable ones made
+// read-only and marked PTE_COW. cowfault() makes the private
+// copy when either side writes.
 pde_t*
 copyuvm(pde_t *pgdir, uint sz)
 {
   pde_t *d;
   pte_t *pte;
   uint pa, i, flags;
-  char *mem;
 
   if((d = setupkvm()) == 0)
     return 0;
   for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
+    // Heap pages are allocated lazily; skip untouched ones.
+    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0){
+      i = PGADDR(PDX(i) + 1, 0, 0) - PGSIZE;
+      continue;
+    }
     if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
+      continue;
+    if(*pte & PTE_W){
+      *pte = (*pte & ~PTE_W) | PTE_COW;
+      invlpg((void*)i);
+    }
     pa = PTE_ADDR(*pte);
     flags = PTE_FLAGS(*pte);
-    if((mem = kalloc()) == 0)
-      goto bad;
-    memmove(mem, (char*)P2V(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
-      kfree(mem);
+    if(mappages(d, (void*)i, PGSIZE, pa, flags) < 0)
       goto bad;
-    }
+    kincref(P2V(pa));
   }
   return d;
 
@@ -344,6 +349,146 @@ bad:
   return 0;
 }
 
+// Handle a write to user address va in pgdir that faulted
+// because the page is shared copy-on-write. Gives the page
+// table a private, writable copy of the page, or just makes
+// the page writable if no one else refers to it any more.
+// Returns 0 on success, -1 if va is not a copy-on-write page
+// or no memory is left for the copy.
+int
+cowfault(pde_t *pgdir, uint va)
+{
+  pte_t *pte;
+  uint pa, flags;
+  char *mem;
+
+  if(va >= KERNBASE)
+    return -1;
+  if((pte = walkpgdir(pgdir, (void*)va, 0)) == 0)
+    return -1;
+  if((*pte & (PTE_P|PTE_U|PTE_COW)) != (PTE_P|PTE_U|PTE_COW))
+    return -1;
+  pa = PTE_ADDR(*pte);
+  flags = (PTE_FLAGS(*pte) & ~PTE_COW) | PTE_W;
+  if(krefcount(P2V(pa)) == 1){
+    // Only this page table uses the page any more.
+    *pte = pa | flags;
+  } else {
+    if((mem = kalloc()) == 0)
+      return -1;
+    memmove(mem, (char*)P2V(pa), PGSIZE);
+    *pte = V2P(mem) | flags;
+    kfree(P2V(pa));
+  }
+  invlpg((void*)PGROUNDDOWN(va));
+  return 0;
+}
+
+// Break copy-on-write sharing of the user pages in [va, va+len)
+// before the kernel writes there on a system call's behalf, so
+// that running out of memory for the copies fails the call
+// instead of faulting in the kernel. Returns -1 if memory ran out.
+int
+cowbreak(pde_t *pgdir, uint va, uint len)
+{
+  pte_t *pte;
+  uint a;
+
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(pte && (*pte & PTE_COW) && cowfault(pgdir, a) < 0)
+      return -1;
+  }
+  return 0;
+}
+
+// Handle a fault on user address va below sz that has no page
+// yet: growproc() only reserves address space, and the heap is
+// filled in with zeroed pages as it is touched.
+// Returns 0 on success, -1 if va is not such an address or
+// no memory is left.
+int
+lazyfault(pde_t *pgdir, uint sz, uint va)
+{
+  pte_t *pte;
+  char *mem;
+
+  if(va >= sz || va >= KERNBASE)
+    return -1;
+  va = PGROUNDDOWN(va);
+  if((pte = walkpgdir(pgdir, (void*)va, 0)) != 0 && (*pte & PTE_P))
+    return -1;
+  if((mem = kalloc()) == 0)
+    return -1;
+  memset(mem, 0, PGSIZE);
+  if(mappages(pgdir, (void*)va, PGSIZE, V2P(mem), PTE_W|PTE_U) < 0){
+    kfree(mem);
+    return -1;
+  }
+  return 0;
+}
+
+// Fill in the untouched heap pages in [va, va+len) before the
+// kernel accesses them on a system call's behalf, so that running
+// out of memory fails the call instead of faulting in the kernel.
+// Returns -1 if memory ran out.
+int
+lazyfill(pde_t *pgdir, uint sz, uint va, uint len)
+{
+  pte_t *pte;
+  uint a;
+
+  for(a = PGROUNDDOWN(va); a < va + len; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if((pte == 0 || !(*pte & PTE_P)) && lazyfault(pgdir, sz, a) < 0)
+      return -1;
+  }
+  return 0;
+}
+
+// Lend the user page at va to a pipe (see pipewrite): take a
+// reference to it and make it copy-on-write, so that later
+// writes by this process go to a copy. Returns the page's
+// physical address, or 0 if va has no user page.
+uint
+loanpage(pde_t *pgdir, char *va)
+{
+  pte_t *pte;
+  uint pa;
+
+  if((pte = walkpgdir(pgdir, va, 0)) == 0)
+    return 0;
+  if((*pte & (PTE_P|PTE_U)) != (PTE_P|PTE_U))
+    return 0;
+  if(*pte & PTE_W){
+    *pte = (*pte & ~PTE_W) | PTE_COW;
+    invlpg(va);
+  }
+  pa = PTE_ADDR(*pte);
+  kincref(P2V(pa));
+  return pa;
+}
+
+// Map the lent page pa at user address va, copy-on-write, in
+// place of the page there. The caller's reference to pa goes
+// to the new mapping. Returns -1 if va cannot be remapped.
+int
+maploan(pde_t *pgdir, char *va, uint pa)
+{
+  pte_t *pte;
+
+  if((pte = walkpgdir(pgdir, va, 1)) == 0)
+    return -1;
+  if(*pte & PTE_P){
+    if(!(*pte & PTE_U))
+      return -1;
+    kfree(P2V(PTE_ADDR(*pte)));
+  }
+  *pte = pa | PTE_P | PTE_U | PTE_COW;
+  invlpg(va);
+  return 0;
+}
+
 //PAGEBREAK!
 // Map user virtual address to kernel address.
 char*
@@ -352,7 +497,7 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
@@ -367,10 +512,20 @@ copyout(pde_t *pgdir, uint va, void *p, uint len)
 {
   char *buf, *pa0;
   uint n, va0;
+  pte_t *pte;
 
   buf = (char*)p;
   while(len > 0){
     va0 = (uint)PGROUNDDOWN(va);
+    // The write goes through the kernel mapping, so it would
+    // not fault; break copy-on-write sharing by hand.
+    pte = walkpgdir(pgdir, (char*)va0, 0);
+    if(pte && (*pte & PTE_COW) && cowfault(pgdir, va0) < 0)
+      return -1;
+    // Nor would an untouched heap page; fill it in.
+    if((pte == 0 || !(*pte & PTE_P)) && pgdir == myproc()->pgdir &&
+       lazyfault(pgdir, myproc()->sz, va0) < 0)
+      return -1;
     pa0 = uva2ka(pgdir, (char*)va0);
     if(pa0 == 0)
       return -1;